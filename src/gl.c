@@ -1,759 +1,6835 @@
+// pthread_setaffinity_np for pinning render farm workers
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include <glad/glad.h>
 #include <qdrt/ffi.h>
 #include <qdrt/runtime.h>
 #include <qdrt/stack.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GL_CONVERT_AVX 1
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 // ============================================================================
-// Initialization
+// Data Conversion
 // ============================================================================
+//
+// Quadrate stores floats as f64 and integers as i64, while GL consumes 32-bit
+// values. These helpers narrow native Quadrate arrays into a reusable scratch
+// buffer or directly into mapped GL memory.
 
-// LoadGL( -- success:i64 )
-// Must be called after creating an OpenGL context
-int LoadGL(qd_context* ctx) {
-	int success = gladLoadGL();
-	qd_push_i(ctx, success ? 1 : 0);
+static GLAD_THREAD_LOCAL void* scratch = NULL;
+static GLAD_THREAD_LOCAL size_t scratch_size = 0;
+
+static void* scratch_reserve(size_t size, const char* fn) {
+	if (size > scratch_size) {
+		void* block = realloc(scratch, size);
+		if (block == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		scratch = block;
+		scratch_size = size;
+	}
+	return scratch;
+}
+
+#if defined(GL_CONVERT_AVX)
+__attribute__((target("avx"))) static void convert_f64_to_f32_avx(float* dst, const double* src,
+		size_t count) {
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		_mm_storeu_ps(dst + i, _mm256_cvtpd_ps(_mm256_loadu_pd(src + i)));
+		_mm_storeu_ps(dst + i + 4, _mm256_cvtpd_ps(_mm256_loadu_pd(src + i + 4)));
+	}
+	for (; i < count; i++) {
+		dst[i] = (float)src[i];
+	}
+}
+#endif
+
+static void convert_f64_to_f32_scalar(float* dst, const double* src, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		dst[i] = (float)src[i];
+	}
+}
+
+static void convert_f64_to_f32(float* dst, const double* src, size_t count) {
+#if defined(GL_CONVERT_AVX)
+	// Threads racing to detect the CPU store the same value
+	static atomic_int has_avx = -1;
+	int avx = atomic_load_explicit(&has_avx, memory_order_relaxed);
+	if (avx < 0) {
+		__builtin_cpu_init();
+		avx = __builtin_cpu_supports("avx") != 0;
+		atomic_store_explicit(&has_avx, avx, memory_order_relaxed);
+	}
+	if (avx) {
+		convert_f64_to_f32_avx(dst, src, count);
+		return;
+	}
+#endif
+	size_t i = 0;
+#if defined(__SSE2__)
+	for (; i + 4 <= count; i += 4) {
+		__m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(src + i));
+		__m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(src + i + 2));
+		_mm_storeu_ps(dst + i, _mm_movelh_ps(lo, hi));
+	}
+#endif
+	convert_f64_to_f32_scalar(dst + i, src + i, count - i);
+}
+
+static void convert_i64_to_i32(GLint* dst, const int64_t* src, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		dst[i] = (GLint)src[i];
+	}
+}
+
+// ============================================================================
+// Object Name Pools
+// ============================================================================
+//
+// GenBuffer, GenTexture and GenVertexArray hand out names from per-type pools
+// that are refilled with one glGen* call per batch instead of one per object.
+// Names released by the Delete* wrappers go back to the driver, which hands
+// them out again in a later refill.
+
+#define GL_NAME_POOL_DEFAULT_BATCH 64
+
+typedef struct {
+	GLuint* names;
+	size_t count;
+	size_t capacity;
+	size_t batch;
+	int64_t hits;
+	int64_t refills;
+} gl_name_pool;
+
+static GLAD_THREAD_LOCAL gl_name_pool buffer_pool = {NULL, 0, 0, GL_NAME_POOL_DEFAULT_BATCH, 0, 0};
+static GLAD_THREAD_LOCAL gl_name_pool texture_pool = {NULL, 0, 0, GL_NAME_POOL_DEFAULT_BATCH, 0, 0};
+static GLAD_THREAD_LOCAL gl_name_pool vertex_array_pool = {NULL, 0, 0, GL_NAME_POOL_DEFAULT_BATCH, 0, 0};
+
+static GLuint name_pool_take(gl_name_pool* pool, PFNGLGENBUFFERSPROC gen, const char* fn) {
+	if (pool->count > 0) {
+		pool->hits++;
+		return pool->names[--pool->count];
+	}
+	if (pool->capacity < pool->batch) {
+		GLuint* names = realloc(pool->names, pool->batch * sizeof(GLuint));
+		if (names == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		pool->names = names;
+		pool->capacity = pool->batch;
+	}
+	gen((GLsizei)pool->batch, pool->names);
+	pool->refills++;
+	pool->count = pool->batch - 1;
+	return pool->names[pool->count];
+}
+
+static void name_pool_trim(gl_name_pool* pool, PFNGLDELETEBUFFERSPROC del) {
+	if (pool->count > 0) {
+		del((GLsizei)pool->count, pool->names);
+		pool->count = 0;
+	}
+}
+
+static gl_name_pool* name_pool_for(int64_t kind, const char* fn) {
+	switch (kind) {
+	case GL_BUFFER:
+		return &buffer_pool;
+	case GL_TEXTURE:
+		return &texture_pool;
+	case GL_VERTEX_ARRAY:
+		return &vertex_array_pool;
+	}
+	fprintf(stderr, "Fatal error in %s: Invalid object kind\n", fn);
+	abort();
+}
+
+// Pooled names belong to the context they were generated in, so they can
+// only be deleted (release) while that context is still current.
+static void name_pools_reset(int release) {
+	if (release) {
+		name_pool_trim(&buffer_pool, glDeleteBuffers);
+		name_pool_trim(&texture_pool, glDeleteTextures);
+		name_pool_trim(&vertex_array_pool, glDeleteVertexArrays);
+	}
+	buffer_pool.count = 0;
+	texture_pool.count = 0;
+	vertex_array_pool.count = 0;
+}
+
+// SetNamePoolBatch( kind:i64 size:i64 -- )
+// kind is GL_BUFFER, GL_TEXTURE or GL_VERTEX_ARRAY; a size of 1 disables pooling
+int SetNamePoolBatch(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in SetNamePoolBatch: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t size_elem, kind_elem;
+	qd_stack_pop(ctx->st, &size_elem);
+	qd_stack_pop(ctx->st, &kind_elem);
+	if (kind_elem.type != QD_STACK_TYPE_INT || size_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in SetNamePoolBatch: Type error\n");
+		abort();
+	}
+	if (size_elem.value.i < 1) {
+		fprintf(stderr, "Fatal error in SetNamePoolBatch: Invalid batch size\n");
+		abort();
+	}
+	name_pool_for(kind_elem.value.i, "SetNamePoolBatch")->batch = (size_t)size_elem.value.i;
 	return 0;
 }
 
-// GetVersion( -- major:i64 minor:i64 )
-int GetVersion(qd_context* ctx) {
-	qd_push_i(ctx, GLVersion.major);
-	qd_push_i(ctx, GLVersion.minor);
+// NamePoolStats( kind:i64 -- hits:i64 refills:i64 available:i64 )
+int NamePoolStats(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in NamePoolStats: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t kind_elem;
+	qd_stack_pop(ctx->st, &kind_elem);
+	if (kind_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in NamePoolStats: Type error\n");
+		abort();
+	}
+	const gl_name_pool* pool = name_pool_for(kind_elem.value.i, "NamePoolStats");
+	qd_push_i(ctx, pool->hits);
+	qd_push_i(ctx, pool->refills);
+	qd_push_i(ctx, (int64_t)pool->count);
+	return 0;
+}
+
+// NamePoolTrim( kind:i64 -- )
+// Returns the names still held by the pool to the driver in one call
+int NamePoolTrim(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in NamePoolTrim: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t kind_elem;
+	qd_stack_pop(ctx->st, &kind_elem);
+	if (kind_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in NamePoolTrim: Type error\n");
+		abort();
+	}
+	switch (kind_elem.value.i) {
+	case GL_BUFFER:
+		name_pool_trim(&buffer_pool, glDeleteBuffers);
+		break;
+	case GL_TEXTURE:
+		name_pool_trim(&texture_pool, glDeleteTextures);
+		break;
+	case GL_VERTEX_ARRAY:
+		name_pool_trim(&vertex_array_pool, glDeleteVertexArrays);
+		break;
+	default:
+		fprintf(stderr, "Fatal error in NamePoolTrim: Invalid object kind\n");
+		abort();
+	}
 	return 0;
 }
 
 // ============================================================================
-// State Management
+// Uniform Location Cache
 // ============================================================================
+//
+// Uniform names are interned into small integer ids, and locations are cached
+// per program in arrays indexed by that id. A program's table is filled from
+// glGetActiveUniform the first time it is queried after linking, so cached
+// lookups never reach the driver or touch the name string.
+//
+// Interned names are shared by every thread and context. Lookups take
+// intern_lock for reading and only new names take it for writing; the name
+// strings themselves never move or change once interned.
 
-// Enable( cap:i64 -- )
-int Enable(qd_context* ctx) {
+#define GL_UNIFORM_UNKNOWN (-2)
+
+typedef struct {
+	GLint* locations;
+	size_t count;
+	int populated;
+} gl_program_uniforms;
+
+static pthread_rwlock_t intern_lock = PTHREAD_RWLOCK_INITIALIZER;
+static char** interned_names = NULL;
+static size_t interned_count = 0;
+static size_t interned_capacity = 0;
+static uint32_t* intern_table = NULL;
+static size_t intern_table_size = 0;
+
+static GLAD_THREAD_LOCAL gl_program_uniforms* uniform_cache = NULL;
+static GLAD_THREAD_LOCAL size_t uniform_cache_size = 0;
+
+static uint64_t fnv1a64(const void* data, size_t length, uint64_t hash) {
+	const unsigned char* bytes = data;
+	for (size_t i = 0; i < length; i++) {
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+#define FNV1A64_INIT 0xcbf29ce484222325ULL
+
+static void intern_table_insert(uint32_t id) {
+	const char* name = interned_names[id];
+	size_t mask = intern_table_size - 1;
+	size_t slot = (size_t)fnv1a64(name, strlen(name), FNV1A64_INIT) & mask;
+	while (intern_table[slot] != 0) {
+		slot = (slot + 1) & mask;
+	}
+	intern_table[slot] = id + 1;
+}
+
+// Returns the id of name or -1. The caller holds intern_lock.
+static int64_t intern_find_locked(const char* name, size_t length) {
+	if (intern_table_size == 0) {
+		return -1;
+	}
+	size_t mask = intern_table_size - 1;
+	size_t slot = (size_t)fnv1a64(name, length, FNV1A64_INIT) & mask;
+	while (intern_table[slot] != 0) {
+		const char* existing = interned_names[intern_table[slot] - 1];
+		if (strncmp(existing, name, length) == 0 && existing[length] == '\0') {
+			return intern_table[slot] - 1;
+		}
+		slot = (slot + 1) & mask;
+	}
+	return -1;
+}
+
+// Returns the id of name without interning it, or -1
+static int64_t intern_find(const char* name, size_t length) {
+	pthread_rwlock_rdlock(&intern_lock);
+	int64_t found = intern_find_locked(name, length);
+	pthread_rwlock_unlock(&intern_lock);
+	return found;
+}
+
+static uint32_t intern_name(const char* name, size_t length, const char* fn) {
+	int64_t found = intern_find(name, length);
+	if (found >= 0) {
+		return (uint32_t)found;
+	}
+	pthread_rwlock_wrlock(&intern_lock);
+	// Another thread may have added it in between
+	found = intern_find_locked(name, length);
+	if (found >= 0) {
+		pthread_rwlock_unlock(&intern_lock);
+		return (uint32_t)found;
+	}
+	if (interned_count == interned_capacity) {
+		size_t capacity = interned_capacity ? interned_capacity * 2 : 64;
+		char** names = realloc(interned_names, capacity * sizeof(char*));
+		if (names == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		interned_names = names;
+		interned_capacity = capacity;
+	}
+	char* copy = malloc(length + 1);
+	if (copy == NULL) {
+		fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+		abort();
+	}
+	memcpy(copy, name, length);
+	copy[length] = '\0';
+	uint32_t id = (uint32_t)interned_count++;
+	interned_names[id] = copy;
+	// Keep the table at most half full
+	if (interned_count * 2 > intern_table_size) {
+		size_t size = intern_table_size ? intern_table_size * 2 : 128;
+		uint32_t* table = calloc(size, sizeof(uint32_t));
+		if (table == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		free(intern_table);
+		intern_table = table;
+		intern_table_size = size;
+		for (uint32_t i = 0; i < interned_count; i++) {
+			intern_table_insert(i);
+		}
+	} else {
+		intern_table_insert(id);
+	}
+	pthread_rwlock_unlock(&intern_lock);
+	return id;
+}
+
+// Returns the string interned as id, or NULL if id was never handed out
+static const char* interned_name(uint32_t id) {
+	pthread_rwlock_rdlock(&intern_lock);
+	const char* name = id < interned_count ? interned_names[id] : NULL;
+	pthread_rwlock_unlock(&intern_lock);
+	return name;
+}
+
+static void uniform_cache_store(gl_program_uniforms* entry, uint32_t id, GLint location,
+		const char* fn) {
+	if (id >= entry->count) {
+		size_t count = entry->count ? entry->count : 16;
+		while (count <= id) {
+			count *= 2;
+		}
+		GLint* locations = realloc(entry->locations, count * sizeof(GLint));
+		if (locations == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		for (size_t i = entry->count; i < count; i++) {
+			locations[i] = GL_UNIFORM_UNKNOWN;
+		}
+		entry->locations = locations;
+		entry->count = count;
+	}
+	entry->locations[id] = location;
+}
+
+static void uniform_cache_populate(GLuint program, gl_program_uniforms* entry, const char* fn) {
+	GLint active = 0, max_length = 0;
+	glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &active);
+	glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length);
+	entry->populated = 1;
+	if (active <= 0 || max_length <= 0) {
+		return;
+	}
+	char* name = malloc((size_t)max_length + 1);
+	if (name == NULL) {
+		fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+		abort();
+	}
+	for (GLint i = 0; i < active; i++) {
+		GLsizei length = 0;
+		GLint size;
+		GLenum type;
+		glGetActiveUniform(program, (GLuint)i, max_length, &length, &size, &type, name);
+		name[length] = '\0';
+		GLint location = glGetUniformLocation(program, name);
+		uniform_cache_store(entry, intern_name(name, (size_t)length, fn), location, fn);
+		// Arrays are reported as "name[0]"; "name" refers to the same location
+		if (length > 3 && strcmp(name + length - 3, "[0]") == 0) {
+			uniform_cache_store(entry, intern_name(name, (size_t)length - 3, fn), location, fn);
+		}
+	}
+	free(name);
+}
+
+// Returns the cache entry of program, growing the cache to hold it
+static gl_program_uniforms* uniform_cache_entry(GLuint program, const char* fn) {
+	if (program >= uniform_cache_size) {
+		size_t size = uniform_cache_size ? uniform_cache_size * 2 : 64;
+		while (size <= program) {
+			size *= 2;
+		}
+		gl_program_uniforms* cache = realloc(uniform_cache, size * sizeof(gl_program_uniforms));
+		if (cache == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		memset(cache + uniform_cache_size, 0, (size - uniform_cache_size) * sizeof(gl_program_uniforms));
+		uniform_cache = cache;
+		uniform_cache_size = size;
+	}
+	return &uniform_cache[program];
+}
+
+static GLint uniform_cache_lookup(GLuint program, uint32_t id, const char* fn) {
+	if (program < uniform_cache_size) {
+		const gl_program_uniforms* entry = &uniform_cache[program];
+		if (id < entry->count && entry->locations[id] != GL_UNIFORM_UNKNOWN) {
+			return entry->locations[id];
+		}
+	}
+	const char* name = interned_name(id);
+	if (name == NULL) {
+		fprintf(stderr, "Fatal error in %s: Invalid name id\n", fn);
+		abort();
+	}
+	gl_program_uniforms* entry = uniform_cache_entry(program, fn);
+	if (!entry->populated) {
+		uniform_cache_populate(program, entry, fn);
+		if (id < entry->count && entry->locations[id] != GL_UNIFORM_UNKNOWN) {
+			return entry->locations[id];
+		}
+	}
+	GLint location = glGetUniformLocation(program, name);
+	uniform_cache_store(entry, id, location, fn);
+	return location;
+}
+
+// Looks name up by string. Every name is interned, misses included, so a
+// name that is inactive or misspelled costs one glGetUniformLocation and is
+// then answered with -1 from the cache.
+static GLint uniform_cache_lookup_name(GLuint program, const char* name, const char* fn) {
+	return uniform_cache_lookup(program, intern_name(name, strlen(name), fn), fn);
+}
+
+// Bumped whenever any thread relinks or releases a program, so copies of
+// programs made elsewhere (render farm workers) know to rebuild
+static atomic_uint program_generation = 0;
+
+static void uniform_cache_clear(GLuint program) {
+	if (program < uniform_cache_size) {
+		gl_program_uniforms* entry = &uniform_cache[program];
+		for (size_t i = 0; i < entry->count; i++) {
+			entry->locations[i] = GL_UNIFORM_UNKNOWN;
+		}
+		entry->populated = 0;
+	}
+}
+
+// Called whenever a program is relinked or its name is released.
+static void uniform_cache_forget(GLuint program) {
+	uniform_cache_clear(program);
+	atomic_fetch_add(&program_generation, 1);
+}
+
+static void uniform_cache_reset(void) {
+	for (size_t program = 0; program < uniform_cache_size; program++) {
+		uniform_cache_clear((GLuint)program);
+	}
+}
+
+// InternName( name:str -- id:i64 )
+// Returns a stable id for name, for use with GetUniformLocationId
+int InternName(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in InternName: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t name_elem;
+	qd_stack_pop(ctx->st, &name_elem);
+	if (name_elem.type != QD_STACK_TYPE_STR) {
+		fprintf(stderr, "Fatal error in InternName: Type error\n");
+		abort();
+	}
+	const char* name = qd_string_data(name_elem.value.s);
+	uint32_t id = intern_name(name, strlen(name), "InternName");
+	qd_string_release(name_elem.value.s);
+	qd_push_i(ctx, (int64_t)id);
+	return 0;
+}
+
+// GetUniformLocationId( program:i64 id:i64 -- location:i64 )
+int GetUniformLocationId(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in GetUniformLocationId: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t id_elem, program_elem;
+	qd_stack_pop(ctx->st, &id_elem);
+	qd_stack_pop(ctx->st, &program_elem);
+	if (program_elem.type != QD_STACK_TYPE_INT || id_elem.type != QD_STACK_TYPE_INT ||
+			id_elem.value.i < 0) {
+		fprintf(stderr, "Fatal error in GetUniformLocationId: Type error\n");
+		abort();
+	}
+	GLint location = uniform_cache_lookup((GLuint)program_elem.value.i, (uint32_t)id_elem.value.i,
+			"GetUniformLocationId");
+	qd_push_i(ctx, (int64_t)location);
+	return 0;
+}
+
+// ============================================================================
+// Shader Preprocessor
+// ============================================================================
+//
+// CompileShaderCached expands #include "name" (or <name>) lines against a
+// virtual file table filled by ShaderFileSet, inserts the current define set
+// after the #version line, and hashes the result together with the shader
+// type. A shader whose expansion was compiled before is shared instead of
+// compiled again; DeleteShader only releases it once every user has. Entries
+// keep a copy of their expansion, so a hash collision never hands out the
+// wrong shader, and a shader that failed to compile is not shared again: the
+// next caller compiles its own and gets its own info log.
+//
+// Each file is included at most once per expansion, which also makes include
+// cycles harmless. #line directives keep compiler messages pointing at the
+// original text: the main source is source string 0 and an included file is
+// source string InternName of its name plus 1.
+//
+// The file table and the define set are shared by every thread behind
+// shader_file_lock; expansions only read them, and each thread keeps the
+// set of files its current expansion has included in its own mark array.
+
+typedef struct {
+	char* data;
+	size_t length;
+	size_t capacity;
+} gl_text;
+
+typedef struct {
+	char* source;
+	size_t length;
+	int present;
+} gl_shader_file;
+
+typedef struct {
+	uint64_t hash;
+	GLenum type;
+	GLuint shader;
+	uint32_t refs;
+	// GL_COMPILE_STATUS, or -1 until a reuse queries it
+	GLint status;
+	char* source;
+	size_t length;
+} gl_shared_shader;
+
+static pthread_rwlock_t shader_file_lock = PTHREAD_RWLOCK_INITIALIZER;
+static gl_shader_file* shader_files = NULL;
+static size_t shader_file_count = 0;
+static gl_text shader_defines = {0};
+// Files whose entry equals shader_expand_mark were included by the calling
+// thread's current expansion
+static GLAD_THREAD_LOCAL uint32_t* shader_expand_marks = NULL;
+static GLAD_THREAD_LOCAL size_t shader_expand_mark_count = 0;
+static GLAD_THREAD_LOCAL uint32_t shader_expand_mark = 0;
+static GLAD_THREAD_LOCAL gl_text shader_expanded = {0};
+// Shared shaders are few and only searched when compiling or deleting, so a
+// flat array is enough
+static GLAD_THREAD_LOCAL gl_shared_shader* shared_shaders = NULL;
+static GLAD_THREAD_LOCAL size_t shared_shader_count = 0;
+static GLAD_THREAD_LOCAL size_t shared_shader_capacity = 0;
+static GLAD_THREAD_LOCAL int64_t shared_shader_reuses = 0;
+
+static void text_append(gl_text* text, const char* data, size_t length, const char* fn) {
+	if (text->length + length + 1 > text->capacity) {
+		size_t capacity = text->capacity ? text->capacity * 2 : 4096;
+		while (capacity < text->length + length + 1) {
+			capacity *= 2;
+		}
+		char* grown = realloc(text->data, capacity);
+		if (grown == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		text->data = grown;
+		text->capacity = capacity;
+	}
+	memcpy(text->data + text->length, data, length);
+	text->length += length;
+	text->data[text->length] = '\0';
+}
+
+// The caller holds shader_file_lock for writing
+static gl_shader_file* shader_file_slot(uint32_t id, const char* fn) {
+	if (id >= shader_file_count) {
+		size_t count = shader_file_count ? shader_file_count : 64;
+		while (count <= id) {
+			count *= 2;
+		}
+		gl_shader_file* files = realloc(shader_files, count * sizeof(gl_shader_file));
+		if (files == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		memset(files + shader_file_count, 0, (count - shader_file_count) * sizeof(gl_shader_file));
+		shader_files = files;
+		shader_file_count = count;
+	}
+	return &shader_files[id];
+}
+
+// Parses an #include line, returning the name span or 0 if line is not one
+static int shader_parse_include(const char* line, const char* end, const char** name,
+		size_t* length) {
+	while (line < end && (*line == ' ' || *line == '\t')) {
+		line++;
+	}
+	if ((size_t)(end - line) < 8 || strncmp(line, "#include", 8) != 0) {
+		return 0;
+	}
+	line += 8;
+	while (line < end && (*line == ' ' || *line == '\t')) {
+		line++;
+	}
+	if (line == end || (*line != '"' && *line != '<')) {
+		return 0;
+	}
+	char close = *line == '"' ? '"' : '>';
+	const char* start = ++line;
+	while (line < end && *line != close) {
+		line++;
+	}
+	if (line == end) {
+		return 0;
+	}
+	*name = start;
+	*length = (size_t)(line - start);
+	return 1;
+}
+
+// Makes the next line of out line number line of source string string. GLSL
+// before 3.30 numbers the #line directive itself rather than the line after
+// it, which bias (1 there, 0 otherwise) accounts for.
+static void shader_line(gl_text* out, size_t line, uint32_t string, int bias, const char* fn) {
+	char directive[64];
+	int n = snprintf(directive, sizeof(directive), "#line %zu %u\n", line - (size_t)bias, string);
+	text_append(out, directive, (size_t)n, fn);
+}
+
+// Expands source, whose first line is line number first_line of source string
+// string. The caller holds shader_file_lock for reading.
+static void shader_expand(gl_text* out, const char* source, size_t length, uint32_t string,
+		size_t first_line, int bias, const char* fn) {
+	const char* end = source + length;
+	const char* line = source;
+	size_t number = first_line;
+	while (line < end) {
+		const char* eol = memchr(line, '\n', (size_t)(end - line));
+		const char* next = eol ? eol + 1 : end;
+		const char* name;
+		size_t name_length;
+		if (shader_parse_include(line, eol ? eol : end, &name, &name_length)) {
+			int64_t id = intern_find(name, name_length);
+			if (id < 0 || (size_t)id >= shader_file_count || !shader_files[id].present) {
+				fprintf(stderr, "Fatal error in %s: Unknown include \"%.*s\"\n", fn, (int)name_length,
+						name);
+				abort();
+			}
+			gl_shader_file* file = &shader_files[id];
+			if (shader_expand_marks[id] != shader_expand_mark) {
+				shader_expand_marks[id] = shader_expand_mark;
+				shader_line(out, 1, (uint32_t)id + 1, bias, fn);
+				shader_expand(out, file->source, file->length, (uint32_t)id + 1, 1, bias, fn);
+				if (file->length > 0 && file->source[file->length - 1] != '\n') {
+					text_append(out, "\n", 1, fn);
+				}
+				shader_line(out, number + 1, string, bias, fn);
+			} else {
+				// Keep the line numbering of the including source
+				text_append(out, "\n", 1, fn);
+			}
+		} else {
+			text_append(out, line, (size_t)(next - line), fn);
+		}
+		line = next;
+		number++;
+	}
+}
+
+// Expands source into out and returns the hash of type plus the expansion
+static uint64_t shader_preprocess(gl_text* out, GLenum type, const char* source, const char* fn) {
+	size_t length = strlen(source);
+	out->length = 0;
+	text_append(out, "", 0, fn);
+	pthread_rwlock_rdlock(&shader_file_lock);
+	if (shader_expand_mark_count < shader_file_count) {
+		uint32_t* marks = realloc(shader_expand_marks, shader_file_count * sizeof(uint32_t));
+		if (marks == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		memset(marks + shader_expand_mark_count, 0,
+				(shader_file_count - shader_expand_mark_count) * sizeof(uint32_t));
+		shader_expand_marks = marks;
+		shader_expand_mark_count = shader_file_count;
+	}
+	// Files included by an earlier expansion must be included again
+	if (++shader_expand_mark == 0) {
+		memset(shader_expand_marks, 0, shader_expand_mark_count * sizeof(uint32_t));
+		shader_expand_mark = 1;
+	}
+	// #version must stay the first directive, so defines go after it
+	const char* body = source;
+	while (body < source + length && (*body == ' ' || *body == '\t' || *body == '\n' ||
+			*body == '\r')) {
+		body++;
+	}
+	int bias = 1;
+	size_t first_line = 1;
+	if (strncmp(body, "#version", 8) == 0) {
+		bias = strtol(body + 8, NULL, 10) >= 300 ? 0 : 1;
+		const char* eol = strchr(body, '\n');
+		body = eol ? eol + 1 : source + length;
+		text_append(out, source, (size_t)(body - source), fn);
+		if (eol == NULL) {
+			text_append(out, "\n", 1, fn);
+		}
+		for (const char* c = source; c < body; c++) {
+			first_line += *c == '\n';
+		}
+	} else {
+		body = source;
+	}
+	if (shader_defines.length > 0) {
+		text_append(out, shader_defines.data, shader_defines.length, fn);
+		shader_line(out, first_line, 0, bias, fn);
+	}
+	shader_expand(out, body, (size_t)(source + length - body), 0, first_line, bias, fn);
+	pthread_rwlock_unlock(&shader_file_lock);
+	uint32_t type32 = (uint32_t)type;
+	uint64_t hash = fnv1a64(&type32, sizeof(type32), FNV1A64_INIT);
+	return fnv1a64(out->data, out->length, hash);
+}
+
+// Drops one reference to a shared shader. Returns 0 if shader is not shared,
+// 1 while other users remain and 2 once the last reference is gone.
+static int shared_shader_release(GLuint shader) {
+	for (size_t i = 0; i < shared_shader_count; i++) {
+		if (shared_shaders[i].shader == shader) {
+			if (--shared_shaders[i].refs > 0) {
+				return 1;
+			}
+			free(shared_shaders[i].source);
+			shared_shaders[i] = shared_shaders[--shared_shader_count];
+			return 2;
+		}
+	}
+	return 0;
+}
+
+// Shader objects belong to the context they were created in.
+static void shader_preprocessor_reset(void) {
+	for (size_t i = 0; i < shared_shader_count; i++) {
+		free(shared_shaders[i].source);
+	}
+	shared_shader_count = 0;
+}
+
+// ShaderFileSet( name:str source:str -- )
+// Adds or replaces a file that #include can name
+int ShaderFileSet(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in ShaderFileSet: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t source_elem, name_elem;
+	qd_stack_pop(ctx->st, &source_elem);
+	qd_stack_pop(ctx->st, &name_elem);
+	if (name_elem.type != QD_STACK_TYPE_STR || source_elem.type != QD_STACK_TYPE_STR) {
+		fprintf(stderr, "Fatal error in ShaderFileSet: Type error\n");
+		abort();
+	}
+	const char* name = qd_string_data(name_elem.value.s);
+	const char* source = qd_string_data(source_elem.value.s);
+	uint32_t id = intern_name(name, strlen(name), "ShaderFileSet");
+	size_t length = strlen(source);
+	char* copy = malloc(length + 1);
+	if (copy == NULL) {
+		fprintf(stderr, "Fatal error in ShaderFileSet: Out of memory\n");
+		abort();
+	}
+	memcpy(copy, source, length + 1);
+	pthread_rwlock_wrlock(&shader_file_lock);
+	gl_shader_file* file = shader_file_slot(id, "ShaderFileSet");
+	char* previous = file->source;
+	file->source = copy;
+	file->length = length;
+	file->present = 1;
+	pthread_rwlock_unlock(&shader_file_lock);
+	free(previous);
+	qd_string_release(name_elem.value.s);
+	qd_string_release(source_elem.value.s);
+	return 0;
+}
+
+// ShaderDefine( name:str value:str -- )
+// Adds #define name value to every following expansion
+int ShaderDefine(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in ShaderDefine: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t value_elem, name_elem;
+	qd_stack_pop(ctx->st, &value_elem);
+	qd_stack_pop(ctx->st, &name_elem);
+	if (name_elem.type != QD_STACK_TYPE_STR || value_elem.type != QD_STACK_TYPE_STR) {
+		fprintf(stderr, "Fatal error in ShaderDefine: Type error\n");
+		abort();
+	}
+	const char* name = qd_string_data(name_elem.value.s);
+	const char* value = qd_string_data(value_elem.value.s);
+	pthread_rwlock_wrlock(&shader_file_lock);
+	text_append(&shader_defines, "#define ", 8, "ShaderDefine");
+	text_append(&shader_defines, name, strlen(name), "ShaderDefine");
+	text_append(&shader_defines, " ", 1, "ShaderDefine");
+	text_append(&shader_defines, value, strlen(value), "ShaderDefine");
+	text_append(&shader_defines, "\n", 1, "ShaderDefine");
+	pthread_rwlock_unlock(&shader_file_lock);
+	qd_string_release(name_elem.value.s);
+	qd_string_release(value_elem.value.s);
+	return 0;
+}
+
+// ShaderDefinesClear( -- )
+int ShaderDefinesClear(qd_context* ctx) {
+	(void)ctx;
+	pthread_rwlock_wrlock(&shader_file_lock);
+	shader_defines.length = 0;
+	pthread_rwlock_unlock(&shader_file_lock);
+	return 0;
+}
+
+// ShaderPreprocess( type:i64 source:str -- expanded:str hash:i64 )
+int ShaderPreprocess(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in ShaderPreprocess: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t source_elem, type_elem;
+	qd_stack_pop(ctx->st, &source_elem);
+	qd_stack_pop(ctx->st, &type_elem);
+	if (type_elem.type != QD_STACK_TYPE_INT || source_elem.type != QD_STACK_TYPE_STR) {
+		fprintf(stderr, "Fatal error in ShaderPreprocess: Type error\n");
+		abort();
+	}
+	gl_text expanded = {0};
+	uint64_t hash = shader_preprocess(&expanded, (GLenum)type_elem.value.i,
+			qd_string_data(source_elem.value.s), "ShaderPreprocess");
+	qd_string_release(source_elem.value.s);
+	qd_push_s(ctx, expanded.data);
+	qd_push_i(ctx, (int64_t)hash);
+	free(expanded.data);
+	return 0;
+}
+
+// CompileShaderCached( type:i64 source:str -- shader:i64 )
+// Returns a compiled shader for the expanded source, shared with earlier
+// calls that produced the same expansion. Release it with DeleteShader.
+int CompileShaderCached(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in CompileShaderCached: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t source_elem, type_elem;
+	qd_stack_pop(ctx->st, &source_elem);
+	qd_stack_pop(ctx->st, &type_elem);
+	if (type_elem.type != QD_STACK_TYPE_INT || source_elem.type != QD_STACK_TYPE_STR) {
+		fprintf(stderr, "Fatal error in CompileShaderCached: Type error\n");
+		abort();
+	}
+	GLenum type = (GLenum)type_elem.value.i;
+	uint64_t hash = shader_preprocess(&shader_expanded, type, qd_string_data(source_elem.value.s),
+			"CompileShaderCached");
+	qd_string_release(source_elem.value.s);
+	for (size_t i = 0; i < shared_shader_count; i++) {
+		gl_shared_shader* entry = &shared_shaders[i];
+		if (entry->hash != hash || entry->type != type || entry->status == GL_FALSE ||
+				entry->length != shader_expanded.length ||
+				memcmp(entry->source, shader_expanded.data, entry->length) != 0) {
+			continue;
+		}
+		if (entry->status == -1) {
+			glGetShaderiv(entry->shader, GL_COMPILE_STATUS, &entry->status);
+		}
+		if (entry->status == GL_FALSE) {
+			// Its users keep it; this caller compiles its own below
+			continue;
+		}
+		entry->refs++;
+		shared_shader_reuses++;
+		qd_push_i(ctx, (int64_t)entry->shader);
+		return 0;
+	}
+	if (shared_shader_count == shared_shader_capacity) {
+		size_t capacity = shared_shader_capacity ? shared_shader_capacity * 2 : 64;
+		gl_shared_shader* shaders = realloc(shared_shaders, capacity * sizeof(gl_shared_shader));
+		if (shaders == NULL) {
+			fprintf(stderr, "Fatal error in CompileShaderCached: Out of memory\n");
+			abort();
+		}
+		shared_shaders = shaders;
+		shared_shader_capacity = capacity;
+	}
+	char* copy = malloc(shader_expanded.length + 1);
+	if (copy == NULL) {
+		fprintf(stderr, "Fatal error in CompileShaderCached: Out of memory\n");
+		abort();
+	}
+	memcpy(copy, shader_expanded.data, shader_expanded.length + 1);
+	GLuint shader = glCreateShader(type);
+	const char* text = shader_expanded.data;
+	glShaderSource(shader, 1, &text, NULL);
+	glCompileShader(shader);
+	shared_shaders[shared_shader_count++] =
+			(gl_shared_shader){hash, type, shader, 1, -1, copy, shader_expanded.length};
+	qd_push_i(ctx, (int64_t)shader);
+	return 0;
+}
+
+// SharedShaderStats( -- shaders:i64 reuses:i64 )
+// Reports the live shared shaders and how many compiles they have saved
+int SharedShaderStats(qd_context* ctx) {
+	qd_push_i(ctx, (int64_t)shared_shader_count);
+	qd_push_i(ctx, shared_shader_reuses);
+	return 0;
+}
+
+// ============================================================================
+// State Shadowing
+// ============================================================================
+//
+// When enabled, the wrappers for Enable/Disable, BindBuffer, BindVertexArray,
+// UseProgram, ActiveTexture, BindTexture and the unpack side of PixelStorei
+// keep a shadow copy of that state and drop calls that would not change it.
+// The shadow starts out unknown and must be invalidated (InvalidateStateCache)
+// after any GL call made behind the package's back, e.g. by another library
+// sharing the context.
+
+#define GL_STATE_UNKNOWN 0xFFFFFFFFu
+#define GL_STATE_CAPS 16
+#define GL_STATE_BUFFER_TARGETS 14
+#define GL_STATE_TEXTURE_UNITS 32
+#define GL_STATE_TEXTURE_TARGETS 8
+#define GL_STATE_UNPACK_PARAMS 6
+
+typedef struct {
+	int enabled;
+	signed char caps[GL_STATE_CAPS];
+	GLuint buffers[GL_STATE_BUFFER_TARGETS];
+	GLuint vertex_array;
+	GLuint program;
+	GLenum active_texture;
+	GLuint textures[GL_STATE_TEXTURE_UNITS][GL_STATE_TEXTURE_TARGETS];
+	GLint unpack[GL_STATE_UNPACK_PARAMS];
+	int64_t elided_frame;
+	int64_t elided_last_frame;
+	int64_t elided_total;
+} gl_state_shadow;
+
+static GLAD_THREAD_LOCAL gl_state_shadow state = {0};
+
+static int state_cap_slot(GLenum cap) {
+	switch (cap) {
+	case GL_BLEND:
+		return 0;
+	case GL_CULL_FACE:
+		return 1;
+	case GL_DEPTH_TEST:
+		return 2;
+	case GL_SCISSOR_TEST:
+		return 3;
+	case GL_STENCIL_TEST:
+		return 4;
+	case GL_MULTISAMPLE:
+		return 5;
+	case GL_POLYGON_OFFSET_FILL:
+		return 6;
+	case GL_FRAMEBUFFER_SRGB:
+		return 7;
+	case GL_PRIMITIVE_RESTART:
+		return 8;
+	case GL_RASTERIZER_DISCARD:
+		return 9;
+	case GL_PROGRAM_POINT_SIZE:
+		return 10;
+	case GL_DEPTH_CLAMP:
+		return 11;
+	case GL_TEXTURE_CUBE_MAP_SEAMLESS:
+		return 12;
+	case GL_SAMPLE_ALPHA_TO_COVERAGE:
+		return 13;
+	case GL_DITHER:
+		return 14;
+	case GL_LINE_SMOOTH:
+		return 15;
+	}
+	return -1;
+}
+
+static int state_buffer_slot(GLenum target) {
+	switch (target) {
+	case GL_ARRAY_BUFFER:
+		return 0;
+	case GL_ELEMENT_ARRAY_BUFFER:
+		return 1;
+	case GL_UNIFORM_BUFFER:
+		return 2;
+	case GL_PIXEL_UNPACK_BUFFER:
+		return 3;
+	case GL_PIXEL_PACK_BUFFER:
+		return 4;
+	case GL_DRAW_INDIRECT_BUFFER:
+		return 5;
+	case GL_COPY_READ_BUFFER:
+		return 6;
+	case GL_COPY_WRITE_BUFFER:
+		return 7;
+	case GL_SHADER_STORAGE_BUFFER:
+		return 8;
+	case GL_TEXTURE_BUFFER:
+		return 9;
+	case GL_ATOMIC_COUNTER_BUFFER:
+		return 10;
+	case GL_DISPATCH_INDIRECT_BUFFER:
+		return 11;
+	case GL_QUERY_BUFFER:
+		return 12;
+	case GL_TRANSFORM_FEEDBACK_BUFFER:
+		return 13;
+	}
+	return -1;
+}
+
+static int state_texture_slot(GLenum target) {
+	switch (target) {
+	case GL_TEXTURE_2D:
+		return 0;
+	case GL_TEXTURE_3D:
+		return 1;
+	case GL_TEXTURE_CUBE_MAP:
+		return 2;
+	case GL_TEXTURE_2D_ARRAY:
+		return 3;
+	case GL_TEXTURE_1D:
+		return 4;
+	case GL_TEXTURE_RECTANGLE:
+		return 5;
+	case GL_TEXTURE_BUFFER:
+		return 6;
+	case GL_TEXTURE_2D_MULTISAMPLE:
+		return 7;
+	}
+	return -1;
+}
+
+static int state_unpack_slot(GLenum pname) {
+	switch (pname) {
+	case GL_UNPACK_ALIGNMENT:
+		return 0;
+	case GL_UNPACK_ROW_LENGTH:
+		return 1;
+	case GL_UNPACK_IMAGE_HEIGHT:
+		return 2;
+	case GL_UNPACK_SKIP_PIXELS:
+		return 3;
+	case GL_UNPACK_SKIP_ROWS:
+		return 4;
+	case GL_UNPACK_SKIP_IMAGES:
+		return 5;
+	}
+	return -1;
+}
+
+static void state_invalidate(void) {
+	memset(state.caps, -1, sizeof(state.caps));
+	for (size_t i = 0; i < GL_STATE_BUFFER_TARGETS; i++) {
+		state.buffers[i] = GL_STATE_UNKNOWN;
+	}
+	state.vertex_array = GL_STATE_UNKNOWN;
+	state.program = GL_STATE_UNKNOWN;
+	state.active_texture = 0;
+	for (size_t unit = 0; unit < GL_STATE_TEXTURE_UNITS; unit++) {
+		for (size_t i = 0; i < GL_STATE_TEXTURE_TARGETS; i++) {
+			state.textures[unit][i] = GL_STATE_UNKNOWN;
+		}
+	}
+	for (size_t i = 0; i < GL_STATE_UNPACK_PARAMS; i++) {
+		state.unpack[i] = -1;
+	}
+}
+
+static void state_set_cap(GLenum cap, int enabled) {
+	int slot = state_cap_slot(cap);
+	if (state.enabled && slot >= 0) {
+		if (state.caps[slot] == enabled) {
+			state.elided_frame++;
+			return;
+		}
+		state.caps[slot] = (signed char)enabled;
+	}
+	if (enabled) {
+		glEnable(cap);
+	} else {
+		glDisable(cap);
+	}
+}
+
+static void state_pixel_store(GLenum pname, GLint param) {
+	int slot = state_unpack_slot(pname);
+	if (state.enabled && slot >= 0) {
+		if (state.unpack[slot] == param) {
+			state.elided_frame++;
+			return;
+		}
+		state.unpack[slot] = param;
+	}
+	glPixelStorei(pname, param);
+}
+
+static void state_bind_buffer(GLenum target, GLuint buffer) {
+	int slot = state_buffer_slot(target);
+	if (state.enabled && slot >= 0) {
+		if (state.buffers[slot] == buffer) {
+			state.elided_frame++;
+			return;
+		}
+		state.buffers[slot] = buffer;
+	}
+	glBindBuffer(target, buffer);
+}
+
+// glBindBufferBase/Range also replace the generic binding of target
+static void state_note_indexed_buffer(GLenum target, GLuint buffer) {
+	int slot = state_buffer_slot(target);
+	if (state.enabled && slot >= 0) {
+		state.buffers[slot] = buffer;
+	}
+}
+
+static void state_bind_vertex_array(GLuint vao) {
+	if (state.enabled) {
+		if (state.vertex_array == vao) {
+			state.elided_frame++;
+			return;
+		}
+		state.vertex_array = vao;
+		// The element array binding is part of the vertex array object
+		state.buffers[1] = GL_STATE_UNKNOWN;
+	}
+	glBindVertexArray(vao);
+}
+
+static void state_use_program(GLuint program) {
+	if (state.enabled) {
+		if (state.program == program) {
+			state.elided_frame++;
+			return;
+		}
+		state.program = program;
+	}
+	glUseProgram(program);
+}
+
+static void state_active_texture(GLenum unit) {
+	if (state.enabled) {
+		if (state.active_texture == unit) {
+			state.elided_frame++;
+			return;
+		}
+		state.active_texture = unit;
+	}
+	glActiveTexture(unit);
+}
+
+static void state_bind_texture(GLenum target, GLuint texture) {
+	int slot = state_texture_slot(target);
+	GLuint unit = state.active_texture - GL_TEXTURE0;
+	if (state.enabled && slot >= 0 && state.active_texture != 0 && unit < GL_STATE_TEXTURE_UNITS) {
+		if (state.textures[unit][slot] == texture) {
+			state.elided_frame++;
+			return;
+		}
+		state.textures[unit][slot] = texture;
+	}
+	glBindTexture(target, texture);
+}
+
+// Deleting an object unbinds it; forget any binding of the released names.
+static void state_forget_buffers(const GLuint* names, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		for (size_t slot = 0; slot < GL_STATE_BUFFER_TARGETS; slot++) {
+			if (state.buffers[slot] == names[i]) {
+				state.buffers[slot] = GL_STATE_UNKNOWN;
+			}
+		}
+	}
+}
+
+static void state_forget_textures(const GLuint* names, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		for (size_t unit = 0; unit < GL_STATE_TEXTURE_UNITS; unit++) {
+			for (size_t slot = 0; slot < GL_STATE_TEXTURE_TARGETS; slot++) {
+				if (state.textures[unit][slot] == names[i]) {
+					state.textures[unit][slot] = GL_STATE_UNKNOWN;
+				}
+			}
+		}
+	}
+}
+
+static void state_forget_vertex_arrays(const GLuint* names, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		if (state.vertex_array == names[i]) {
+			state.vertex_array = GL_STATE_UNKNOWN;
+			state.buffers[1] = GL_STATE_UNKNOWN;
+		}
+	}
+}
+
+static void state_forget_program(GLuint program) {
+	if (state.program == program) {
+		state.program = GL_STATE_UNKNOWN;
+	}
+}
+
+static void state_end_frame(void) {
+	state.elided_last_frame = state.elided_frame;
+	state.elided_total += state.elided_frame;
+	state.elided_frame = 0;
+}
+
+// SetStateCache( enabled:i64 -- )
+int SetStateCache(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in SetStateCache: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t enabled_elem;
+	qd_stack_pop(ctx->st, &enabled_elem);
+	if (enabled_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in SetStateCache: Type error\n");
+		abort();
+	}
+	state.enabled = enabled_elem.value.i != 0;
+	state_invalidate();
+	return 0;
+}
+
+// InvalidateStateCache( -- )
+// Must be called after GL state was changed outside this package or the
+// context was lost or recreated
+int InvalidateStateCache(qd_context* ctx) {
+	(void)ctx;
+	state_invalidate();
+	return 0;
+}
+
+// StateCacheStats( -- elided_last_frame:i64 elided_total:i64 )
+int StateCacheStats(qd_context* ctx) {
+	qd_push_i(ctx, state.elided_last_frame);
+	qd_push_i(ctx, state.elided_total + state.elided_frame);
+	return 0;
+}
+
+// ============================================================================
+// Streaming Buffers
+// ============================================================================
+//
+// A stream buffer is a persistently mapped, coherent ring allocated once with
+// glBufferStorage. Sub-allocations are handed out per frame; EndFrame fences
+// the bytes written during the frame, and a region is only reused once the
+// fence covering it has signaled.
+//
+// Rings belong to the context they were created in. LoadGL releases every
+// ring of the thread, so handles from StreamBufferCreate must not be used or
+// destroyed after it.
+
+#define GL_STREAM_FRAMES 8
+
+typedef struct {
+	GLsync fence;
+	size_t bytes;
+} gl_stream_frame;
+
+typedef struct gl_stream_buffer {
+	GLuint buffer;
+	GLenum target;
+	unsigned char* data;
+	size_t capacity;
+	size_t head;
+	size_t used;
+	size_t frame_bytes;
+	gl_stream_frame frames[GL_STREAM_FRAMES];
+	size_t frame_first;
+	size_t frame_count;
+	int64_t waits;
+	// Set for internal rings whose regions are consumed as soon as they are
+	// written; they wait on the GPU rather than abort when a frame fills them
+	int recycle;
+	struct gl_stream_buffer* next;
+} gl_stream_buffer;
+
+static GLAD_THREAD_LOCAL gl_stream_buffer* stream_buffers = NULL;
+
+static gl_stream_buffer* stream_buffer_create(GLenum target, size_t capacity, const char* fn) {
+	if (!GLAD_GL_VERSION_4_4 && !GLAD_GL_ARB_buffer_storage) {
+		return NULL;
+	}
+	gl_stream_buffer* sb = calloc(1, sizeof(gl_stream_buffer));
+	if (sb == NULL) {
+		fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+		abort();
+	}
+	GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	sb->buffer = name_pool_take(&buffer_pool, glGenBuffers, fn);
+	sb->target = target;
+	sb->capacity = capacity;
+	state_bind_buffer(target, sb->buffer);
+	glBufferStorage(target, (GLsizeiptr)capacity, NULL, flags);
+	sb->data = glMapBufferRange(target, 0, (GLsizeiptr)capacity, flags);
+	if (sb->data == NULL) {
+		glDeleteBuffers(1, &sb->buffer);
+		state_forget_buffers(&sb->buffer, 1);
+		free(sb);
+		return NULL;
+	}
+	sb->next = stream_buffers;
+	stream_buffers = sb;
+	return sb;
+}
+
+static void stream_buffer_release_oldest(gl_stream_buffer* sb) {
+	gl_stream_frame* frame = &sb->frames[sb->frame_first];
+	GLenum status = glClientWaitSync(frame->fence, 0, 0);
+	if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+		sb->waits++;
+		glClientWaitSync(frame->fence, GL_SYNC_FLUSH_COMMANDS_BIT, UINT64_MAX);
+	}
+	glDeleteSync(frame->fence);
+	sb->used -= frame->bytes;
+	sb->frame_first = (sb->frame_first + 1) % GL_STREAM_FRAMES;
+	sb->frame_count--;
+}
+
+// Fences the bytes written since the last fence as one frame.
+static void stream_buffer_push_frame(gl_stream_buffer* sb) {
+	if (sb->frame_count == GL_STREAM_FRAMES) {
+		stream_buffer_release_oldest(sb);
+	}
+	gl_stream_frame* frame = &sb->frames[(sb->frame_first + sb->frame_count) % GL_STREAM_FRAMES];
+	frame->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	frame->bytes = sb->frame_bytes;
+	sb->frame_count++;
+	sb->frame_bytes = 0;
+}
+
+// Returns the byte offset of a size-byte region aligned to align and stores
+// its write pointer in data.
+static size_t stream_buffer_alloc(gl_stream_buffer* sb, size_t size, size_t align, void** data,
+		const char* fn) {
+	if (align == 0 || (align & (align - 1)) != 0) {
+		fprintf(stderr, "Fatal error in %s: Alignment must be a power of two\n", fn);
+		abort();
+	}
+	for (;;) {
+		if (sb->used == 0) {
+			// Nothing in flight, so restart at the front rather than charge
+			// the tail skipped by wrapping
+			sb->head = 0;
+		}
+		size_t start = (sb->head + align - 1) & ~(align - 1);
+		if (start + size > sb->capacity) {
+			start = 0;
+		}
+		// Bytes consumed, including padding and the skipped tail when wrapping
+		size_t need = start >= sb->head ? start + size - sb->head : sb->capacity - sb->head + size;
+		if (sb->used + need <= sb->capacity) {
+			sb->used += need;
+			sb->frame_bytes += need;
+			sb->head = start + size;
+			*data = sb->data + start;
+			return start;
+		}
+		if (sb->frame_count == 0) {
+			if (!sb->recycle) {
+				fprintf(stderr, "Fatal error in %s: Stream buffer exhausted within one frame\n",
+						fn);
+				abort();
+			}
+			// Everything in flight was written this frame (or EndFrame is
+			// never called): fence it now and wait for it below
+			stream_buffer_push_frame(sb);
+		}
+		stream_buffer_release_oldest(sb);
+	}
+}
+
+static void stream_buffer_fence(gl_stream_buffer* sb) {
+	// Release whatever the GPU has already finished with
+	while (sb->frame_count > 0) {
+		GLenum status = glClientWaitSync(sb->frames[sb->frame_first].fence, 0, 0);
+		if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+			break;
+		}
+		stream_buffer_release_oldest(sb);
+	}
+	if (sb->frame_bytes == 0) {
+		return;
+	}
+	stream_buffer_push_frame(sb);
+}
+
+static void stream_buffers_end_frame(void) {
+	for (gl_stream_buffer* sb = stream_buffers; sb != NULL; sb = sb->next) {
+		stream_buffer_fence(sb);
+	}
+}
+
+static void stream_buffer_destroy(gl_stream_buffer* sb) {
+	for (gl_stream_buffer** link = &stream_buffers; *link != NULL; link = &(*link)->next) {
+		if (*link == sb) {
+			*link = sb->next;
+			break;
+		}
+	}
+	while (sb->frame_count > 0) {
+		stream_buffer_release_oldest(sb);
+	}
+	// Deleting the buffer also unmaps it
+	glDeleteBuffers(1, &sb->buffer);
+	state_forget_buffers(&sb->buffer, 1);
+	free(sb);
+}
+
+// Destroys every ring (release) while their context is still current;
+// otherwise the GL objects went away with the context and only the memory
+// is freed.
+static void stream_buffers_reset(int release) {
+	while (stream_buffers != NULL) {
+		gl_stream_buffer* next = stream_buffers->next;
+		if (release) {
+			stream_buffer_destroy(stream_buffers);
+		} else {
+			free(stream_buffers);
+		}
+		stream_buffers = next;
+	}
+}
+
+// StreamBufferCreate( target:i64 size:i64 -- sb:ptr )
+// Returns a null pointer when persistent mapping (GL 4.4 or
+// GL_ARB_buffer_storage) is unavailable
+int StreamBufferCreate(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in StreamBufferCreate: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t size_elem, target_elem;
+	qd_stack_pop(ctx->st, &size_elem);
+	qd_stack_pop(ctx->st, &target_elem);
+	if (target_elem.type != QD_STACK_TYPE_INT || size_elem.type != QD_STACK_TYPE_INT ||
+			size_elem.value.i <= 0) {
+		fprintf(stderr, "Fatal error in StreamBufferCreate: Type error\n");
+		abort();
+	}
+	gl_stream_buffer* sb = stream_buffer_create((GLenum)target_elem.value.i,
+			(size_t)size_elem.value.i, "StreamBufferCreate");
+	qd_push_p(ctx, sb);
+	return 0;
+}
+
+// StreamBufferDestroy( sb:ptr -- )
+int StreamBufferDestroy(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in StreamBufferDestroy: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t sb_elem;
+	qd_stack_pop(ctx->st, &sb_elem);
+	if (sb_elem.type != QD_STACK_TYPE_PTR) {
+		fprintf(stderr, "Fatal error in StreamBufferDestroy: Type error\n");
+		abort();
+	}
+	if (sb_elem.value.p != NULL) {
+		stream_buffer_destroy(sb_elem.value.p);
+	}
+	return 0;
+}
+
+// StreamBufferAlloc( sb:ptr size:i64 align:i64 -- offset:i64 data:ptr )
+// offset is the region's byte offset within StreamBufferName's buffer; data
+// stays writable until the end of the frame
+int StreamBufferAlloc(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 3) {
+		fprintf(stderr, "Fatal error in StreamBufferAlloc: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t align_elem, size_elem, sb_elem;
+	qd_stack_pop(ctx->st, &align_elem);
+	qd_stack_pop(ctx->st, &size_elem);
+	qd_stack_pop(ctx->st, &sb_elem);
+	if (sb_elem.type != QD_STACK_TYPE_PTR || sb_elem.value.p == NULL ||
+			size_elem.type != QD_STACK_TYPE_INT || align_elem.type != QD_STACK_TYPE_INT ||
+			size_elem.value.i < 0 || align_elem.value.i <= 0) {
+		fprintf(stderr, "Fatal error in StreamBufferAlloc: Type error\n");
+		abort();
+	}
+	gl_stream_buffer* sb = sb_elem.value.p;
+	if ((size_t)size_elem.value.i > sb->capacity) {
+		fprintf(stderr, "Fatal error in StreamBufferAlloc: Allocation larger than buffer\n");
+		abort();
+	}
+	void* data;
+	size_t offset = stream_buffer_alloc(sb, (size_t)size_elem.value.i, (size_t)align_elem.value.i,
+			&data, "StreamBufferAlloc");
+	qd_push_i(ctx, (int64_t)offset);
+	qd_push_p(ctx, data);
+	return 0;
+}
+
+// StreamBufferName( sb:ptr -- buffer:i64 )
+int StreamBufferName(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in StreamBufferName: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t sb_elem;
+	qd_stack_pop(ctx->st, &sb_elem);
+	if (sb_elem.type != QD_STACK_TYPE_PTR || sb_elem.value.p == NULL) {
+		fprintf(stderr, "Fatal error in StreamBufferName: Type error\n");
+		abort();
+	}
+	qd_push_i(ctx, (int64_t)((gl_stream_buffer*)sb_elem.value.p)->buffer);
+	return 0;
+}
+
+// StreamBufferStats( sb:ptr -- used:i64 waits:i64 )
+// used counts bytes still in flight; waits counts allocations that blocked
+// on the GPU
+int StreamBufferStats(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in StreamBufferStats: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t sb_elem;
+	qd_stack_pop(ctx->st, &sb_elem);
+	if (sb_elem.type != QD_STACK_TYPE_PTR || sb_elem.value.p == NULL) {
+		fprintf(stderr, "Fatal error in StreamBufferStats: Type error\n");
+		abort();
+	}
+	const gl_stream_buffer* sb = sb_elem.value.p;
+	qd_push_i(ctx, (int64_t)sb->used);
+	qd_push_i(ctx, sb->waits);
+	return 0;
+}
+
+// ============================================================================
+// Deferred Deletion
+// ============================================================================
+//
+// With deferred deletion enabled, the Delete* wrappers queue names on the
+// current frame instead of calling the driver. EndFrame fences the frame and
+// the queued names are released with one batched glDelete* call per type once
+// the fence has signaled, so objects still referenced by in-flight GPU work
+// are never deleted under the driver's feet.
+
+#define GL_DELETE_FRAMES 4
+
+typedef struct {
+	GLuint* names;
+	size_t count;
+	size_t capacity;
+} gl_name_list;
+
+typedef struct {
+	GLsync fence;
+	gl_name_list buffers;
+	gl_name_list textures;
+	gl_name_list vertex_arrays;
+	gl_name_list shaders;
+	gl_name_list programs;
+} gl_delete_frame;
+
+static GLAD_THREAD_LOCAL int deferred_delete_enabled = 0;
+static GLAD_THREAD_LOCAL gl_delete_frame delete_frames[GL_DELETE_FRAMES];
+static GLAD_THREAD_LOCAL size_t delete_frame_current = 0;
+static GLAD_THREAD_LOCAL int64_t deferred_deleted = 0;
+
+static void name_list_push(gl_name_list* list, GLuint name, const char* fn) {
+	if (list->count == list->capacity) {
+		size_t capacity = list->capacity ? list->capacity * 2 : 32;
+		GLuint* names = realloc(list->names, capacity * sizeof(GLuint));
+		if (names == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		list->names = names;
+		list->capacity = capacity;
+	}
+	list->names[list->count++] = name;
+}
+
+static size_t delete_frame_pending(const gl_delete_frame* frame) {
+	return frame->buffers.count + frame->textures.count + frame->vertex_arrays.count +
+			frame->shaders.count + frame->programs.count;
+}
+
+static void delete_frame_flush(gl_delete_frame* frame) {
+	if (frame->buffers.count > 0) {
+		glDeleteBuffers((GLsizei)frame->buffers.count, frame->buffers.names);
+		state_forget_buffers(frame->buffers.names, frame->buffers.count);
+	}
+	if (frame->textures.count > 0) {
+		glDeleteTextures((GLsizei)frame->textures.count, frame->textures.names);
+		state_forget_textures(frame->textures.names, frame->textures.count);
+	}
+	if (frame->vertex_arrays.count > 0) {
+		glDeleteVertexArrays((GLsizei)frame->vertex_arrays.count, frame->vertex_arrays.names);
+		state_forget_vertex_arrays(frame->vertex_arrays.names, frame->vertex_arrays.count);
+	}
+	for (size_t i = 0; i < frame->shaders.count; i++) {
+		glDeleteShader(frame->shaders.names[i]);
+	}
+	for (size_t i = 0; i < frame->programs.count; i++) {
+		glDeleteProgram(frame->programs.names[i]);
+		uniform_cache_forget(frame->programs.names[i]);
+		state_forget_program(frame->programs.names[i]);
+	}
+	deferred_deleted += (int64_t)delete_frame_pending(frame);
+	frame->buffers.count = 0;
+	frame->textures.count = 0;
+	frame->vertex_arrays.count = 0;
+	frame->shaders.count = 0;
+	frame->programs.count = 0;
+	if (frame->fence != NULL) {
+		glDeleteSync(frame->fence);
+		frame->fence = NULL;
+	}
+}
+
+static int delete_frame_signaled(gl_delete_frame* frame, GLuint64 timeout) {
+	if (frame->fence == NULL) {
+		return 0;
+	}
+	GLenum status = glClientWaitSync(frame->fence, timeout ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, timeout);
+	return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+}
+
+static void delete_frames_flush_all(void) {
+	for (size_t i = 0; i < GL_DELETE_FRAMES; i++) {
+		delete_frame_flush(&delete_frames[i]);
+	}
+}
+
+// Queued names and fences belong to the context they were created in; they
+// are deleted right away (release) while that context is still current.
+static void delete_frames_reset(int release) {
+	if (release) {
+		delete_frames_flush_all();
+	}
+	for (size_t i = 0; i < GL_DELETE_FRAMES; i++) {
+		gl_delete_frame* frame = &delete_frames[i];
+		frame->fence = NULL;
+		frame->buffers.count = 0;
+		frame->textures.count = 0;
+		frame->vertex_arrays.count = 0;
+		frame->shaders.count = 0;
+		frame->programs.count = 0;
+	}
+	delete_frame_current = 0;
+}
+
+// SetDeferredDelete( enabled:i64 -- )
+// Disabling deferred deletion releases everything still queued
+int SetDeferredDelete(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in SetDeferredDelete: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t enabled_elem;
+	qd_stack_pop(ctx->st, &enabled_elem);
+	if (enabled_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in SetDeferredDelete: Type error\n");
+		abort();
+	}
+	deferred_delete_enabled = enabled_elem.value.i != 0;
+	if (!deferred_delete_enabled) {
+		delete_frames_flush_all();
+	}
+	return 0;
+}
+
+// EndFrame( -- )
+// Marks the end of a frame: fences the names deleted during it and the
+// stream buffer regions written during it, releases the names of earlier
+// frames whose fences have signaled and latches the per-frame state cache
+// counters
+int EndFrame(qd_context* ctx) {
+	(void)ctx;
+	state_end_frame();
+	stream_buffers_end_frame();
+	gl_delete_frame* frame = &delete_frames[delete_frame_current];
+	if (delete_frame_pending(frame) > 0 && frame->fence == NULL &&
+			(GLAD_GL_VERSION_3_2 || GLAD_GL_ARB_sync)) {
+		frame->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+	delete_frame_current = (delete_frame_current + 1) % GL_DELETE_FRAMES;
+	for (size_t i = 0; i < GL_DELETE_FRAMES; i++) {
+		if (i != delete_frame_current && delete_frame_signaled(&delete_frames[i], 0)) {
+			delete_frame_flush(&delete_frames[i]);
+		}
+	}
+	// The slot being reused was fenced GL_DELETE_FRAMES frames ago; wait for it
+	// rather than growing the number of frames in flight.
+	gl_delete_frame* oldest = &delete_frames[delete_frame_current];
+	if (delete_frame_pending(oldest) > 0) {
+		delete_frame_signaled(oldest, UINT64_MAX);
+		delete_frame_flush(oldest);
+	}
+	return 0;
+}
+
+// FlushDeletes( -- )
+// Releases every queued name immediately, e.g. before destroying the context
+int FlushDeletes(qd_context* ctx) {
+	(void)ctx;
+	delete_frames_flush_all();
+	return 0;
+}
+
+// DeferredDeleteStats( -- pending:i64 deleted:i64 )
+int DeferredDeleteStats(qd_context* ctx) {
+	size_t pending = 0;
+	for (size_t i = 0; i < GL_DELETE_FRAMES; i++) {
+		pending += delete_frame_pending(&delete_frames[i]);
+	}
+	qd_push_i(ctx, (int64_t)pending);
+	qd_push_i(ctx, deferred_deleted);
+	return 0;
+}
+
+// ============================================================================
+// Initialization
+// ============================================================================
+//
+// LoadGL resolves every entry point the driver offers up front. LoadGLLazy
+// only queries the version and extensions and leaves each function pointer on
+// a trampoline (src/glad_lazy.c) that resolves it on first call, which skips
+// thousands of lookups for functions a program never uses. Availability
+// checks must therefore use the GLAD_GL_* flags, never a NULL pointer test.
+// LoadGLEGL and LoadGLEGLLazy do the same through EGL (eglGetProcAddress and
+// libOpenGL) for headless contexts, where libGL and GLX may be missing.
+
+static double load_seconds = 0.0;
+// Set once EGL was used, so LoadGLContext resolves through it as well
+static int load_through_egl = 0;
+
+static double gl_now(void) {
+	struct timespec ts;
+	timespec_get(&ts, TIME_UTC);
+	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void uniform_blocks_reset(int release);
+static void batcher_reset(int release);
+
+// Native context the thread's caches were last loaded for
+static GLAD_THREAD_LOCAL void* native_context = NULL;
+
+// Empties the caches tied to a context, deleting the GL objects they hold if
+// release is set; the caller checked that their context is current.
+static void context_objects_reset(int release) {
+	name_pools_reset(release);
+	delete_frames_reset(release);
+	uniform_blocks_reset(release);
+	batcher_reset(release);
+	stream_buffers_reset(release);
+	uniform_cache_reset();
+	shader_preprocessor_reset();
+	state_invalidate();
+}
+
+// Deletes the GL objects held by the thread's caches if the context they
+// were filled for is still current
+static void context_objects_release(void) {
+	void* current = gladGetCurrentNativeContext();
+	if (current != NULL && current == native_context) {
+		context_objects_reset(1);
+	}
+}
+
+// Resets the caches tied to the previous context. Reloading the context the
+// caches were filled for releases the objects they hold first; a new context
+// took the old one's objects with it.
+static void gl_loaded(void) {
+	void* current = gladGetCurrentNativeContext();
+	int release = current != NULL && current == native_context;
+	native_context = current;
+	context_objects_reset(release);
+}
+
+// LoadGL( -- success:i64 )
+// Must be called after creating an OpenGL context
+int LoadGL(qd_context* ctx) {
+	double start = gl_now();
+	int success = gladLoadGL();
+	load_seconds = gl_now() - start;
+	gl_loaded();
+	qd_push_i(ctx, success ? 1 : 0);
+	return 0;
+}
+
+// LoadGLLazy( -- success:i64 )
+// Like LoadGL, but resolves each function on its first call
+int LoadGLLazy(qd_context* ctx) {
+	double start = gl_now();
+	int success = gladLoadGLLazy();
+	load_seconds = gl_now() - start;
+	gl_loaded();
+	qd_push_i(ctx, success ? 1 : 0);
+	return 0;
+}
+
+// LoadGLEGL( -- success:i64 )
+// Like LoadGL, for an EGL context such as one from HeadlessCreate
+int LoadGLEGL(qd_context* ctx) {
+	double start = gl_now();
+	int success = gladLoadGLEGL();
+	load_seconds = gl_now() - start;
+	load_through_egl |= success;
+	gl_loaded();
+	qd_push_i(ctx, success ? 1 : 0);
+	return 0;
+}
+
+// LoadGLEGLLazy( -- success:i64 )
+// Like LoadGLLazy, for an EGL context
+int LoadGLEGLLazy(qd_context* ctx) {
+	double start = gl_now();
+	int success = gladLoadGLEGLLazy();
+	load_seconds = gl_now() - start;
+	load_through_egl |= success;
+	gl_loaded();
+	qd_push_i(ctx, success ? 1 : 0);
+	return 0;
+}
+
+// LoadTime( -- seconds:f64 )
+// Reports how long the last LoadGL or LoadGLLazy took
+int LoadTime(qd_context* ctx) {
+	qd_push_f(ctx, load_seconds);
+	return 0;
+}
+
+// LoaderProfile( -- core:i64 )
+// 1 when the package was built with the trimmed core profile loader
+// (-DGLAD_CORE_PROFILE), 0 for the full compatibility loader
+int LoaderProfile(qd_context* ctx) {
+#ifdef GLAD_CORE_PROFILE
+	qd_push_i(ctx, 1);
+#else
+	qd_push_i(ctx, 0);
+#endif
+	return 0;
+}
+
+// GetVersion( -- major:i64 minor:i64 )
+int GetVersion(qd_context* ctx) {
+	qd_push_i(ctx, GLVersion.major);
+	qd_push_i(ctx, GLVersion.minor);
+	return 0;
+}
+
+// HasExtension( name:str -- present:i64 )
+// Looks name up in the extension set built by the last LoadGL or LoadGLLazy
+int HasExtension(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in HasExtension: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t name_elem;
+	qd_stack_pop(ctx->st, &name_elem);
+	if (name_elem.type != QD_STACK_TYPE_STR) {
+		fprintf(stderr, "Fatal error in HasExtension: Type error\n");
+		abort();
+	}
+	int present = gladHasExtension(qd_string_data(name_elem.value.s));
+	qd_string_release(name_elem.value.s);
+	qd_push_i(ctx, present ? 1 : 0);
+	return 0;
+}
+
+// ============================================================================
+// State Management
+// ============================================================================
+
+// Enable( cap:i64 -- )
+int Enable(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in Enable: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t cap_elem;
+	qd_stack_pop(ctx->st, &cap_elem);
+	if (cap_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in Enable: Type error\n");
+		abort();
+	}
+	state_set_cap((GLenum)cap_elem.value.i, 1);
+	return 0;
+}
+
+// Disable( cap:i64 -- )
+int Disable(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in Disable: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t cap_elem;
+	qd_stack_pop(ctx->st, &cap_elem);
+	if (cap_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in Disable: Type error\n");
+		abort();
+	}
+	state_set_cap((GLenum)cap_elem.value.i, 0);
+	return 0;
+}
+
+// PixelStorei( pname:i64 param:i64 -- )
+int PixelStorei(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in PixelStorei: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t param_elem, pname_elem;
+	qd_stack_pop(ctx->st, &param_elem);
+	qd_stack_pop(ctx->st, &pname_elem);
+	if (pname_elem.type != QD_STACK_TYPE_INT || param_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in PixelStorei: Type error\n");
+		abort();
+	}
+	state_pixel_store((GLenum)pname_elem.value.i, (GLint)param_elem.value.i);
+	return 0;
+}
+
+// ============================================================================
+// Buffer Objects
+// ============================================================================
+
+// GenBuffer( -- buffer:i64 )
+int GenBuffer(qd_context* ctx) {
+	GLuint buffer = name_pool_take(&buffer_pool, glGenBuffers, "GenBuffer");
+	qd_push_i(ctx, (int64_t)buffer);
+	return 0;
+}
+
+// DeleteBuffer( buffer:i64 -- )
+int DeleteBuffer(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in DeleteBuffer: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t buffer_elem;
+	qd_stack_pop(ctx->st, &buffer_elem);
+	if (buffer_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in DeleteBuffer: Type error\n");
+		abort();
+	}
+	GLuint buffer = (GLuint)buffer_elem.value.i;
+	if (deferred_delete_enabled) {
+		name_list_push(&delete_frames[delete_frame_current].buffers, buffer, "DeleteBuffer");
+	} else {
+		glDeleteBuffers(1, &buffer);
+		state_forget_buffers(&buffer, 1);
+	}
+	return 0;
+}
+
+// BindBuffer( target:i64 buffer:i64 -- )
+int BindBuffer(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in BindBuffer: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t buffer_elem, target_elem;
+	qd_stack_pop(ctx->st, &buffer_elem);
+	qd_stack_pop(ctx->st, &target_elem);
+	if (target_elem.type != QD_STACK_TYPE_INT || buffer_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in BindBuffer: Type error\n");
+		abort();
+	}
+	state_bind_buffer((GLenum)target_elem.value.i, (GLuint)buffer_elem.value.i);
+	return 0;
+}
+
+// BindBufferBase( target:i64 index:i64 buffer:i64 -- )
+int BindBufferBase(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 3) {
+		fprintf(stderr, "Fatal error in BindBufferBase: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t buffer_elem, index_elem, target_elem;
+	qd_stack_pop(ctx->st, &buffer_elem);
+	qd_stack_pop(ctx->st, &index_elem);
+	qd_stack_pop(ctx->st, &target_elem);
+	if (target_elem.type != QD_STACK_TYPE_INT || index_elem.type != QD_STACK_TYPE_INT ||
+			buffer_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in BindBufferBase: Type error\n");
+		abort();
+	}
+	GLenum target = (GLenum)target_elem.value.i;
+	GLuint buffer = (GLuint)buffer_elem.value.i;
+	glBindBufferBase(target, (GLuint)index_elem.value.i, buffer);
+	state_note_indexed_buffer(target, buffer);
+	return 0;
+}
+
+// BindBufferRange( target:i64 index:i64 buffer:i64 offset:i64 size:i64 -- )
+int BindBufferRange(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 5) {
+		fprintf(stderr, "Fatal error in BindBufferRange: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t size_elem, offset_elem, buffer_elem, index_elem, target_elem;
+	qd_stack_pop(ctx->st, &size_elem);
+	qd_stack_pop(ctx->st, &offset_elem);
+	qd_stack_pop(ctx->st, &buffer_elem);
+	qd_stack_pop(ctx->st, &index_elem);
+	qd_stack_pop(ctx->st, &target_elem);
+	if (target_elem.type != QD_STACK_TYPE_INT || index_elem.type != QD_STACK_TYPE_INT ||
+			buffer_elem.type != QD_STACK_TYPE_INT || offset_elem.type != QD_STACK_TYPE_INT ||
+			size_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in BindBufferRange: Type error\n");
+		abort();
+	}
+	GLenum target = (GLenum)target_elem.value.i;
+	GLuint buffer = (GLuint)buffer_elem.value.i;
+	glBindBufferRange(target, (GLuint)index_elem.value.i, buffer, (GLintptr)offset_elem.value.i,
+			(GLsizeiptr)size_elem.value.i);
+	state_note_indexed_buffer(target, buffer);
+	return 0;
+}
+
+// BufferDataFloats( target:i64 data:ptr count:i64 usage:i64 -- )
+int BufferDataFloats(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 4) {
+		fprintf(stderr, "Fatal error in BufferDataFloats: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t usage_elem, count_elem, data_elem, target_elem;
+	qd_stack_pop(ctx->st, &usage_elem);
+	qd_stack_pop(ctx->st, &count_elem);
+	qd_stack_pop(ctx->st, &data_elem);
+	qd_stack_pop(ctx->st, &target_elem);
+	if (target_elem.type != QD_STACK_TYPE_INT || data_elem.type != QD_STACK_TYPE_PTR ||
+			count_elem.type != QD_STACK_TYPE_INT || usage_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in BufferDataFloats: Type error\n");
+		abort();
+	}
+	glBufferData((GLenum)target_elem.value.i, (GLsizeiptr)(count_elem.value.i * sizeof(float)),
+			data_elem.value.p, (GLenum)usage_elem.value.i);
+	return 0;
+}
+
+// OrphanBuffer( target:i64 size:i64 usage:i64 -- )
+// Re-specifies the store of the bound buffer without data, so the driver can
+// hand out fresh memory instead of waiting for draws still reading the old one
+int OrphanBuffer(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 3) {
+		fprintf(stderr, "Fatal error in OrphanBuffer: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t usage_elem, size_elem, target_elem;
+	qd_stack_pop(ctx->st, &usage_elem);
+	qd_stack_pop(ctx->st, &size_elem);
+	qd_stack_pop(ctx->st, &target_elem);
+	if (target_elem.type != QD_STACK_TYPE_INT || size_elem.type != QD_STACK_TYPE_INT ||
+			usage_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in OrphanBuffer: Type error\n");
+		abort();
+	}
+	glBufferData((GLenum)target_elem.value.i, (GLsizeiptr)size_elem.value.i, NULL,
+			(GLenum)usage_elem.value.i);
+	return 0;
+}
+
+// BufferDataF64( target:i64 data:ptr count:i64 usage:i64 -- )
+// Uploads count f64 values as 32-bit floats, converting straight into the
+// mapped buffer store
+int BufferDataF64(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 4) {
+		fprintf(stderr, "Fatal error in BufferDataF64: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t usage_elem, count_elem, data_elem, target_elem;
+	qd_stack_pop(ctx->st, &usage_elem);
+	qd_stack_pop(ctx->st, &count_elem);
+	qd_stack_pop(ctx->st, &data_elem);
+	qd_stack_pop(ctx->st, &target_elem);
+	if (target_elem.type != QD_STACK_TYPE_INT || data_elem.type != QD_STACK_TYPE_PTR ||
+			count_elem.type != QD_STACK_TYPE_INT || usage_elem.type != QD_STACK_TYPE_INT ||
+			count_elem.value.i < 0) {
+		fprintf(stderr, "Fatal error in BufferDataF64: Type error\n");
+		abort();
+	}
+	GLenum target = (GLenum)target_elem.value.i;
+	size_t count = (size_t)count_elem.value.i;
+	GLsizeiptr size = (GLsizeiptr)(count * sizeof(float));
+	glBufferData(target, size, NULL, (GLenum)usage_elem.value.i);
+	if (count == 0) {
+		return 0;
+	}
+	float* dst = glMapBufferRange(target, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+	if (dst != NULL) {
+		convert_f64_to_f32(dst, data_elem.value.p, count);
+		if (glUnmapBuffer(target)) {
+			return 0;
+		}
+	}
+	// Mapping failed or the store was lost while mapped; upload from scratch
+	float* values = scratch_reserve((size_t)size, "BufferDataF64");
+	convert_f64_to_f32(values, data_elem.value.p, count);
+	glBufferSubData(target, 0, size, values);
+	return 0;
+}
+
+// BufferSubDataF64( target:i64 offset:i64 data:ptr count:i64 -- )
+// offset is in bytes of the destination buffer
+int BufferSubDataF64(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 4) {
+		fprintf(stderr, "Fatal error in BufferSubDataF64: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t count_elem, data_elem, offset_elem, target_elem;
+	qd_stack_pop(ctx->st, &count_elem);
+	qd_stack_pop(ctx->st, &data_elem);
+	qd_stack_pop(ctx->st, &offset_elem);
+	qd_stack_pop(ctx->st, &target_elem);
+	if (target_elem.type != QD_STACK_TYPE_INT || offset_elem.type != QD_STACK_TYPE_INT ||
+			data_elem.type != QD_STACK_TYPE_PTR || count_elem.type != QD_STACK_TYPE_INT ||
+			count_elem.value.i < 0) {
+		fprintf(stderr, "Fatal error in BufferSubDataF64: Type error\n");
+		abort();
+	}
+	GLenum target = (GLenum)target_elem.value.i;
+	size_t count = (size_t)count_elem.value.i;
+	GLsizeiptr size = (GLsizeiptr)(count * sizeof(float));
+	if (count == 0) {
+		return 0;
+	}
+	float* dst = glMapBufferRange(target, (GLintptr)offset_elem.value.i, size,
+			GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+	if (dst != NULL) {
+		convert_f64_to_f32(dst, data_elem.value.p, count);
+		if (glUnmapBuffer(target)) {
+			return 0;
+		}
+	}
+	float* values = scratch_reserve((size_t)size, "BufferSubDataF64");
+	convert_f64_to_f32(values, data_elem.value.p, count);
+	glBufferSubData(target, (GLintptr)offset_elem.value.i, size, values);
+	return 0;
+}
+
+// ConvertBenchmark( count:i64 iterations:i64 -- scalar:f64 simd:f64 )
+// Measures the f64 to f32 conversion behind BufferDataF64 and the *fv
+// uniforms against a plain loop, in GB/s of bytes read plus written
+int ConvertBenchmark(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in ConvertBenchmark: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t iterations_elem, count_elem;
+	qd_stack_pop(ctx->st, &iterations_elem);
+	qd_stack_pop(ctx->st, &count_elem);
+	if (count_elem.type != QD_STACK_TYPE_INT || iterations_elem.type != QD_STACK_TYPE_INT ||
+			count_elem.value.i <= 0 || iterations_elem.value.i <= 0) {
+		fprintf(stderr, "Fatal error in ConvertBenchmark: Type error\n");
+		abort();
+	}
+	size_t count = (size_t)count_elem.value.i;
+	int64_t iterations = iterations_elem.value.i;
+	double* src = malloc(count * sizeof(double));
+	float* dst = malloc(count * sizeof(float));
+	if (src == NULL || dst == NULL) {
+		fprintf(stderr, "Fatal error in ConvertBenchmark: Out of memory\n");
+		abort();
+	}
+	for (size_t i = 0; i < count; i++) {
+		src[i] = (double)i * 0.25;
+	}
+	double bytes = (double)count * (sizeof(double) + sizeof(float)) * (double)iterations;
+	double rates[2];
+	volatile float sink = 0.0f;
+	for (int simd = 0; simd < 2; simd++) {
+		// One untimed pass to fault in the pages
+		convert_f64_to_f32_scalar(dst, src, count);
+		double start = gl_now();
+		for (int64_t i = 0; i < iterations; i++) {
+			if (simd) {
+				convert_f64_to_f32(dst, src, count);
+			} else {
+				convert_f64_to_f32_scalar(dst, src, count);
+			}
+			// Read back part of each pass so the compiler cannot drop it
+			sink += dst[(size_t)i % count];
+		}
+		double seconds = gl_now() - start;
+		rates[simd] = seconds > 0.0 ? bytes / seconds * 1e-9 : 0.0;
+	}
+	free(src);
+	free(dst);
+	qd_push_f(ctx, rates[0]);
+	qd_push_f(ctx, rates[1]);
+	return 0;
+}
+
+// ============================================================================
+// Vertex Arrays
+// ============================================================================
+
+// GenVertexArray( -- vao:i64 )
+int GenVertexArray(qd_context* ctx) {
+	GLuint vao = name_pool_take(&vertex_array_pool, glGenVertexArrays, "GenVertexArray");
+	qd_push_i(ctx, (int64_t)vao);
+	return 0;
+}
+
+// DeleteVertexArray( vao:i64 -- )
+int DeleteVertexArray(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in DeleteVertexArray: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t vao_elem;
+	qd_stack_pop(ctx->st, &vao_elem);
+	if (vao_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in DeleteVertexArray: Type error\n");
+		abort();
+	}
+	GLuint vao = (GLuint)vao_elem.value.i;
+	if (deferred_delete_enabled) {
+		name_list_push(&delete_frames[delete_frame_current].vertex_arrays, vao, "DeleteVertexArray");
+	} else {
+		glDeleteVertexArrays(1, &vao);
+		state_forget_vertex_arrays(&vao, 1);
+	}
+	return 0;
+}
+
+// BindVertexArray( vao:i64 -- )
+int BindVertexArray(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in BindVertexArray: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t vao_elem;
+	qd_stack_pop(ctx->st, &vao_elem);
+	if (vao_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in BindVertexArray: Type error\n");
+		abort();
+	}
+	state_bind_vertex_array((GLuint)vao_elem.value.i);
+	return 0;
+}
+
+// ============================================================================
+// Shaders
+// ============================================================================
+
+// DeleteShader( shader:i64 -- )
+int DeleteShader(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in DeleteShader: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t shader_elem;
+	qd_stack_pop(ctx->st, &shader_elem);
+	if (shader_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in DeleteShader: Type error\n");
+		abort();
+	}
+	GLuint shader = (GLuint)shader_elem.value.i;
+	if (shared_shader_release(shader) == 1) {
+		return 0;
+	}
+	if (deferred_delete_enabled) {
+		name_list_push(&delete_frames[delete_frame_current].shaders, shader, "DeleteShader");
+	} else {
+		glDeleteShader(shader);
+	}
+	return 0;
+}
+
+// ShaderSource( shader:i64 source:str -- )
+int ShaderSource(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in ShaderSource: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t source_elem, shader_elem;
+	qd_stack_pop(ctx->st, &source_elem);
+	qd_stack_pop(ctx->st, &shader_elem);
+	if (shader_elem.type != QD_STACK_TYPE_INT || source_elem.type != QD_STACK_TYPE_STR) {
+		fprintf(stderr, "Fatal error in ShaderSource: Type error\n");
+		abort();
+	}
+	const char* source = qd_string_data(source_elem.value.s);
+	glShaderSource((GLuint)shader_elem.value.i, 1, &source, NULL);
+	qd_string_release(source_elem.value.s);
+	return 0;
+}
+
+// GetShaderCompileStatus( shader:i64 -- success:i64 )
+int GetShaderCompileStatus(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in GetShaderCompileStatus: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t shader_elem;
+	qd_stack_pop(ctx->st, &shader_elem);
+	if (shader_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in GetShaderCompileStatus: Type error\n");
+		abort();
+	}
+	GLint success;
+	glGetShaderiv((GLuint)shader_elem.value.i, GL_COMPILE_STATUS, &success);
+	qd_push_i(ctx, (int64_t)success);
+	return 0;
+}
+
+// GetShaderInfoLog( shader:i64 -- log:str )
+int GetShaderInfoLog(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in GetShaderInfoLog: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t shader_elem;
+	qd_stack_pop(ctx->st, &shader_elem);
+	if (shader_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in GetShaderInfoLog: Type error\n");
+		abort();
+	}
+	GLint length;
+	glGetShaderiv((GLuint)shader_elem.value.i, GL_INFO_LOG_LENGTH, &length);
+	char* log = malloc(length + 1);
+	glGetShaderInfoLog((GLuint)shader_elem.value.i, length, NULL, log);
+	log[length] = '\0';
+	qd_push_s(ctx, log);
+	free(log);
+	return 0;
+}
+
+// ============================================================================
+// Program Binary Cache
+// ============================================================================
+//
+// ProgramCacheBuild compiles and links a program from vertex and fragment
+// source, but first looks for a binary saved by an earlier run. Entries are
+// keyed by an FNV-1a hash of the sources and the driver's vendor, renderer
+// and version strings, so a driver update misses instead of loading a stale
+// binary. Binaries the driver rejects are rebuilt from source and replaced.
+//
+// The cache is off until SetProgramCacheDir names an existing directory.
+// Builds may run on several threads: the directory is only read under
+// program_cache_lock and the statistics are atomic.
+
+#define GL_PROGRAM_CACHE_MAGIC 0x42504451u // "QDPB"
+#define GL_PROGRAM_CACHE_VERSION 1u
+
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t key;
+	uint32_t format;
+	uint32_t length;
+} gl_program_cache_header;
+
+static pthread_rwlock_t program_cache_lock = PTHREAD_RWLOCK_INITIALIZER;
+static char* program_cache_dir = NULL;
+static atomic_int_least64_t program_cache_hits = 0;
+static atomic_int_least64_t program_cache_misses = 0;
+static atomic_int_least64_t program_cache_rejected = 0;
+static atomic_int_least64_t program_cache_nanoseconds = 0;
+
+static uint64_t program_cache_hash_string(const char* text, uint64_t hash) {
+	if (text == NULL) {
+		text = "";
+	}
+	// Include the terminator so ("ab", "c") and ("a", "bc") differ
+	return fnv1a64(text, strlen(text) + 1, hash);
+}
+
+static uint64_t program_cache_key(const char* const* sources, size_t count) {
+	uint64_t hash = FNV1A64_INIT;
+	hash = program_cache_hash_string((const char*)glGetString(GL_VENDOR), hash);
+	hash = program_cache_hash_string((const char*)glGetString(GL_RENDERER), hash);
+	hash = program_cache_hash_string((const char*)glGetString(GL_VERSION), hash);
+	for (size_t i = 0; i < count; i++) {
+		hash = program_cache_hash_string(sources[i], hash);
+	}
+	return hash;
+}
+
+// Returns the path of key's entry, or NULL if the cache was disabled meanwhile
+static char* program_cache_path(uint64_t key, const char* fn) {
+	pthread_rwlock_rdlock(&program_cache_lock);
+	char* path = NULL;
+	if (program_cache_dir != NULL) {
+		size_t length = strlen(program_cache_dir) + 32;
+		path = malloc(length);
+		if (path == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		snprintf(path, length, "%s/%016llx.bin", program_cache_dir, (unsigned long long)key);
+	}
+	pthread_rwlock_unlock(&program_cache_lock);
+	return path;
+}
+
+static int program_cache_enabled(void) {
+	pthread_rwlock_rdlock(&program_cache_lock);
+	int enabled = program_cache_dir != NULL;
+	pthread_rwlock_unlock(&program_cache_lock);
+	return enabled;
+}
+
+static int program_cache_supported(void) {
+	if (!GLAD_GL_VERSION_4_1 && !GLAD_GL_ARB_get_program_binary) {
+		return 0;
+	}
+	GLint formats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	return formats > 0;
+}
+
+// Loads the cached binary for key into program. Returns 1 when the driver
+// accepted it.
+static int program_cache_load(GLuint program, uint64_t key, const char* fn) {
+	char* path = program_cache_path(key, fn);
+	if (path == NULL) {
+		return 0;
+	}
+	FILE* file = fopen(path, "rb");
+	free(path);
+	if (file == NULL) {
+		return 0;
+	}
+	// The length in the header is only trusted if the file actually holds it
+	long file_size = -1;
+	if (fseek(file, 0, SEEK_END) == 0) {
+		file_size = ftell(file);
+		rewind(file);
+	}
+	gl_program_cache_header header;
+	void* binary = NULL;
+	int loaded = 0;
+	if (fread(&header, sizeof(header), 1, file) == 1 && header.magic == GL_PROGRAM_CACHE_MAGIC &&
+			header.version == GL_PROGRAM_CACHE_VERSION && header.key == key && header.length > 0 &&
+			header.length <= INT32_MAX && file_size >= 0 &&
+			(uint64_t)file_size == sizeof(header) + (uint64_t)header.length) {
+		binary = malloc(header.length);
+		if (binary != NULL && fread(binary, header.length, 1, file) == 1) {
+			glProgramBinary(program, (GLenum)header.format, binary, (GLsizei)header.length);
+			GLint success = GL_FALSE;
+			glGetProgramiv(program, GL_LINK_STATUS, &success);
+			loaded = success == GL_TRUE;
+		}
+	}
+	free(binary);
+	fclose(file);
+	if (!loaded) {
+		atomic_fetch_add(&program_cache_rejected, 1);
+	}
+	return loaded;
+}
+
+// Writes the linked program's binary under key. Failures only cost the next
+// run a compile, so they are ignored.
+static void program_cache_store(GLuint program, uint64_t key, const char* fn) {
+	GLint length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0) {
+		return;
+	}
+	void* binary = malloc((size_t)length);
+	if (binary == NULL) {
+		return;
+	}
+	gl_program_cache_header header = {GL_PROGRAM_CACHE_MAGIC, GL_PROGRAM_CACHE_VERSION, key, 0, 0};
+	GLenum format = 0;
+	GLsizei written = 0;
+	glGetProgramBinary(program, length, &written, &format, binary);
+	header.format = (uint32_t)format;
+	header.length = (uint32_t)written;
+	char* path = written > 0 ? program_cache_path(key, fn) : NULL;
+	if (path != NULL) {
+		// Write to a temporary file unique to this writer first, so concurrent
+		// or interrupted runs never see a partial entry
+		size_t tmp_length = strlen(path) + 8;
+		char* tmp = malloc(tmp_length);
+		if (tmp == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		snprintf(tmp, tmp_length, "%s.XXXXXX", path);
+		int fd = mkstemp(tmp);
+		FILE* file = fd >= 0 ? fdopen(fd, "wb") : NULL;
+		if (fd >= 0 && file == NULL) {
+			close(fd);
+			remove(tmp);
+		}
+		if (file != NULL) {
+			int ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+					fwrite(binary, (size_t)written, 1, file) == 1;
+			ok = fclose(file) == 0 && ok;
+			if (!ok || rename(tmp, path) != 0) {
+				remove(tmp);
+			}
+		}
+		free(tmp);
+		free(path);
+	}
+	free(binary);
+}
+
+// Compiles and links without querying any status, leaving the shaders
+// attached so a parallel compile can finish in the background
+static void program_cache_compile(GLuint program, const GLenum* types, const char* const* sources,
+		size_t count, GLuint* shaders) {
+	for (size_t i = 0; i < count; i++) {
+		shaders[i] = glCreateShader(types[i]);
+		glShaderSource(shaders[i], 1, &sources[i], NULL);
+		glCompileShader(shaders[i]);
+		glAttachShader(program, shaders[i]);
+	}
+	glLinkProgram(program);
+}
+
+// Releases the shaders of a finished link and caches the binary if it linked
+static void program_cache_finish(GLuint program, const GLuint* shaders, size_t count, int cached,
+		uint64_t key, const char* fn) {
+	for (size_t i = 0; i < count; i++) {
+		glDetachShader(program, shaders[i]);
+		glDeleteShader(shaders[i]);
+	}
+	GLint success = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (cached && success == GL_TRUE) {
+		program_cache_store(program, key, fn);
+	}
+}
+
+// Builds started by ProgramBuildAsync whose link has not been seen to finish
+typedef struct {
+	GLuint program;
+	GLuint shaders[2];
+	int cached;
+	uint64_t key;
+} gl_pending_program;
+
+static GLAD_THREAD_LOCAL gl_pending_program* pending_programs = NULL;
+static GLAD_THREAD_LOCAL size_t pending_program_count = 0;
+static GLAD_THREAD_LOCAL size_t pending_program_capacity = 0;
+
+static void pending_program_push(const gl_pending_program* pending, const char* fn) {
+	if (pending_program_count == pending_program_capacity) {
+		size_t capacity = pending_program_capacity ? pending_program_capacity * 2 : 16;
+		gl_pending_program* programs =
+				realloc(pending_programs, capacity * sizeof(gl_pending_program));
+		if (programs == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		pending_programs = programs;
+		pending_program_capacity = capacity;
+	}
+	pending_programs[pending_program_count++] = *pending;
+}
+
+static gl_pending_program* pending_program_find(GLuint program) {
+	for (size_t i = 0; i < pending_program_count; i++) {
+		if (pending_programs[i].program == program) {
+			return &pending_programs[i];
+		}
+	}
+	return NULL;
+}
+
+static void pending_program_remove(gl_pending_program* pending) {
+	*pending = pending_programs[--pending_program_count];
+}
+
+// Finishes the pending build of program, if any. Called once its link
+// status is known, so this never adds a wait.
+static void pending_program_finish(GLuint program, const char* fn) {
+	gl_pending_program* pending = pending_program_find(program);
+	if (pending != NULL) {
+		gl_pending_program done = *pending;
+		pending_program_remove(pending);
+		program_cache_finish(done.program, done.shaders, 2, done.cached, done.key, fn);
+	}
+}
+
+// Drops the pending build of a program that is being deleted
+static void pending_program_cancel(GLuint program) {
+	gl_pending_program* pending = pending_program_find(program);
+	if (pending != NULL) {
+		glDeleteShader(pending->shaders[0]);
+		glDeleteShader(pending->shaders[1]);
+		pending_program_remove(pending);
+	}
+}
+
+// Builds a vertex/fragment program, loading it from the program cache when
+// possible. Async builds return before the driver finishes the link.
+static GLuint program_build(const char* vertex, const char* fragment, int async, const char* fn) {
+	double start = gl_now();
+	const GLenum types[2] = {GL_VERTEX_SHADER, GL_FRAGMENT_SHADER};
+	const char* sources[2] = {vertex, fragment};
+	GLuint program = glCreateProgram();
+	int cached = program_cache_enabled() && program_cache_supported();
+	uint64_t key = 0;
+	int hit = 0;
+	if (cached) {
+		key = program_cache_key(sources, 2);
+		hit = program_cache_load(program, key, fn);
+	}
+	if (hit) {
+		atomic_fetch_add(&program_cache_hits, 1);
+	} else {
+		atomic_fetch_add(&program_cache_misses, 1);
+		if (cached) {
+			glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		}
+		GLuint shaders[2];
+		program_cache_compile(program, types, sources, 2, shaders);
+		if (async) {
+			gl_pending_program pending = {program, {shaders[0], shaders[1]}, cached, key};
+			pending_program_push(&pending, fn);
+		} else {
+			program_cache_finish(program, shaders, 2, cached, key, fn);
+		}
+	}
+	uniform_cache_forget(program);
+	atomic_fetch_add(&program_cache_nanoseconds, (int_least64_t)((gl_now() - start) * 1e9));
+	return program;
+}
+
+// SetProgramCacheDir( path:str -- )
+// An empty path disables the cache
+int SetProgramCacheDir(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in SetProgramCacheDir: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t path_elem;
+	qd_stack_pop(ctx->st, &path_elem);
+	if (path_elem.type != QD_STACK_TYPE_STR) {
+		fprintf(stderr, "Fatal error in SetProgramCacheDir: Type error\n");
+		abort();
+	}
+	const char* path = qd_string_data(path_elem.value.s);
+	char* dir = NULL;
+	if (path[0] != '\0') {
+		dir = malloc(strlen(path) + 1);
+		if (dir == NULL) {
+			fprintf(stderr, "Fatal error in SetProgramCacheDir: Out of memory\n");
+			abort();
+		}
+		strcpy(dir, path);
+	}
+	qd_string_release(path_elem.value.s);
+	pthread_rwlock_wrlock(&program_cache_lock);
+	char* previous = program_cache_dir;
+	program_cache_dir = dir;
+	pthread_rwlock_unlock(&program_cache_lock);
+	free(previous);
+	return 0;
+}
+
+// ProgramCacheBuild( vertex:str fragment:str -- program:i64 )
+// Returns a linked program, loaded from the cache when possible. Check
+// GetProgramLinkStatus as usual; failed links are never cached.
+int ProgramCacheBuild(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in ProgramCacheBuild: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t fragment_elem, vertex_elem;
+	qd_stack_pop(ctx->st, &fragment_elem);
+	qd_stack_pop(ctx->st, &vertex_elem);
+	if (vertex_elem.type != QD_STACK_TYPE_STR || fragment_elem.type != QD_STACK_TYPE_STR) {
+		fprintf(stderr, "Fatal error in ProgramCacheBuild: Type error\n");
+		abort();
+	}
+	GLuint program = program_build(qd_string_data(vertex_elem.value.s),
+			qd_string_data(fragment_elem.value.s), 0, "ProgramCacheBuild");
+	qd_string_release(vertex_elem.value.s);
+	qd_string_release(fragment_elem.value.s);
+	qd_push_i(ctx, (int64_t)program);
+	return 0;
+}
+
+// ProgramCacheStats( -- hits:i64 misses:i64 rejected:i64 seconds:f64 )
+// rejected counts cache files the driver refused; seconds is the total time
+// spent in ProgramCacheBuild
+int ProgramCacheStats(qd_context* ctx) {
+	qd_push_i(ctx, (int64_t)atomic_load(&program_cache_hits));
+	qd_push_i(ctx, (int64_t)atomic_load(&program_cache_misses));
+	qd_push_i(ctx, (int64_t)atomic_load(&program_cache_rejected));
+	qd_push_f(ctx, (double)atomic_load(&program_cache_nanoseconds) * 1e-9);
+	return 0;
+}
+
+// ============================================================================
+// Parallel Compilation
+// ============================================================================
+//
+// With GL_KHR_parallel_shader_compile or GL_ARB_parallel_shader_compile the
+// driver compiles and links on its own threads, and only a COMPILE_STATUS or
+// LINK_STATUS query waits for it. ProgramBuildAsync starts a build and returns
+// at once; IsProgramReady polls GL_COMPLETION_STATUS without blocking and,
+// once the link is done, releases the shaders and stores the binary cache
+// entry. Without either extension builds still work but finish synchronously
+// on the first status query, and the Is*Ready wrappers always report ready.
+
+static int parallel_compile_supported(void) {
+	return GLAD_GL_KHR_parallel_shader_compile || GLAD_GL_ARB_parallel_shader_compile;
+}
+
+// SetShaderCompilerThreads( count:i64 -- )
+// Hints how many threads the driver may compile on; -1 restores the default
+int SetShaderCompilerThreads(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in SetShaderCompilerThreads: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t count_elem;
+	qd_stack_pop(ctx->st, &count_elem);
+	if (count_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in SetShaderCompilerThreads: Type error\n");
+		abort();
+	}
+	GLuint count = count_elem.value.i < 0 ? 0xFFFFFFFFu : (GLuint)count_elem.value.i;
+	if (GLAD_GL_KHR_parallel_shader_compile) {
+		glMaxShaderCompilerThreadsKHR(count);
+	} else if (GLAD_GL_ARB_parallel_shader_compile) {
+		glMaxShaderCompilerThreadsARB(count);
+	}
+	return 0;
+}
+
+// IsShaderReady( shader:i64 -- ready:i64 )
+int IsShaderReady(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in IsShaderReady: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t shader_elem;
+	qd_stack_pop(ctx->st, &shader_elem);
+	if (shader_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in IsShaderReady: Type error\n");
+		abort();
+	}
+	GLint ready = GL_TRUE;
+	if (parallel_compile_supported()) {
+		glGetShaderiv((GLuint)shader_elem.value.i, GL_COMPLETION_STATUS_KHR, &ready);
+	}
+	qd_push_i(ctx, (int64_t)ready);
+	return 0;
+}
+
+// IsProgramReady( program:i64 -- ready:i64 )
+// Once ready, GetProgramLinkStatus returns without waiting
+int IsProgramReady(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in IsProgramReady: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t program_elem;
+	qd_stack_pop(ctx->st, &program_elem);
+	if (program_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in IsProgramReady: Type error\n");
+		abort();
+	}
+	GLuint program = (GLuint)program_elem.value.i;
+	GLint ready = GL_TRUE;
+	if (parallel_compile_supported()) {
+		glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &ready);
+	}
+	if (ready) {
+		pending_program_finish(program, "IsProgramReady");
+	}
+	qd_push_i(ctx, (int64_t)ready);
+	return 0;
+}
+
+// ProgramBuildAsync( vertex:str fragment:str -- program:i64 )
+// Starts building a program like ProgramCacheBuild without waiting for the
+// driver; poll IsProgramReady before using it
+int ProgramBuildAsync(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in ProgramBuildAsync: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t fragment_elem, vertex_elem;
+	qd_stack_pop(ctx->st, &fragment_elem);
+	qd_stack_pop(ctx->st, &vertex_elem);
+	if (vertex_elem.type != QD_STACK_TYPE_STR || fragment_elem.type != QD_STACK_TYPE_STR) {
+		fprintf(stderr, "Fatal error in ProgramBuildAsync: Type error\n");
+		abort();
+	}
+	GLuint program = program_build(qd_string_data(vertex_elem.value.s),
+			qd_string_data(fragment_elem.value.s), 1, "ProgramBuildAsync");
+	qd_string_release(vertex_elem.value.s);
+	qd_string_release(fragment_elem.value.s);
+	qd_push_i(ctx, (int64_t)program);
+	return 0;
+}
+
+// PendingProgramCount( -- count:i64 )
+int PendingProgramCount(qd_context* ctx) {
+	qd_push_i(ctx, (int64_t)pending_program_count);
+	return 0;
+}
+
+// ============================================================================
+// Programs
+// ============================================================================
+
+// DeleteProgram( program:i64 -- )
+int DeleteProgram(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in DeleteProgram: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t program_elem;
+	qd_stack_pop(ctx->st, &program_elem);
+	if (program_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in DeleteProgram: Type error\n");
+		abort();
+	}
+	GLuint program = (GLuint)program_elem.value.i;
+	pending_program_cancel(program);
+	if (deferred_delete_enabled) {
+		name_list_push(&delete_frames[delete_frame_current].programs, program, "DeleteProgram");
+	} else {
+		glDeleteProgram(program);
+		uniform_cache_forget(program);
+		state_forget_program(program);
+	}
+	return 0;
+}
+
+// LinkProgram( program:i64 -- )
+int LinkProgram(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in LinkProgram: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t program_elem;
+	qd_stack_pop(ctx->st, &program_elem);
+	if (program_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in LinkProgram: Type error\n");
+		abort();
+	}
+	glLinkProgram((GLuint)program_elem.value.i);
+	uniform_cache_forget((GLuint)program_elem.value.i);
+	return 0;
+}
+
+// GetProgramLinkStatus( program:i64 -- success:i64 )
+int GetProgramLinkStatus(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in GetProgramLinkStatus: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t program_elem;
+	qd_stack_pop(ctx->st, &program_elem);
+	if (program_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in GetProgramLinkStatus: Type error\n");
+		abort();
+	}
+	GLint success;
+	glGetProgramiv((GLuint)program_elem.value.i, GL_LINK_STATUS, &success);
+	pending_program_finish((GLuint)program_elem.value.i, "GetProgramLinkStatus");
+	qd_push_i(ctx, (int64_t)success);
+	return 0;
+}
+
+// GetProgramInfoLog( program:i64 -- log:str )
+int GetProgramInfoLog(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in GetProgramInfoLog: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t program_elem;
+	qd_stack_pop(ctx->st, &program_elem);
+	if (program_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in GetProgramInfoLog: Type error\n");
+		abort();
+	}
+	GLint length;
+	glGetProgramiv((GLuint)program_elem.value.i, GL_INFO_LOG_LENGTH, &length);
+	char* log = malloc(length + 1);
+	glGetProgramInfoLog((GLuint)program_elem.value.i, length, NULL, log);
+	log[length] = '\0';
+	qd_push_s(ctx, log);
+	free(log);
+	return 0;
+}
+
+// UseProgram( program:i64 -- )
+int UseProgram(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in UseProgram: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t program_elem;
+	qd_stack_pop(ctx->st, &program_elem);
+	if (program_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in UseProgram: Type error\n");
+		abort();
+	}
+	state_use_program((GLuint)program_elem.value.i);
+	return 0;
+}
+
+// GetUniformLocation( program:i64 name:str -- location:i64 )
+int GetUniformLocation(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in GetUniformLocation: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t name_elem, program_elem;
+	qd_stack_pop(ctx->st, &name_elem);
+	qd_stack_pop(ctx->st, &program_elem);
+	if (program_elem.type != QD_STACK_TYPE_INT || name_elem.type != QD_STACK_TYPE_STR) {
+		fprintf(stderr, "Fatal error in GetUniformLocation: Type error\n");
+		abort();
+	}
+	GLint location = uniform_cache_lookup_name((GLuint)program_elem.value.i,
+			qd_string_data(name_elem.value.s), "GetUniformLocation");
+	qd_string_release(name_elem.value.s);
+	qd_push_i(ctx, (int64_t)location);
+	return 0;
+}
+
+// GetUniformBlockIndex( program:i64 name:str -- index:i64 )
+int GetUniformBlockIndex(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in GetUniformBlockIndex: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t name_elem, program_elem;
+	qd_stack_pop(ctx->st, &name_elem);
+	qd_stack_pop(ctx->st, &program_elem);
+	if (program_elem.type != QD_STACK_TYPE_INT || name_elem.type != QD_STACK_TYPE_STR) {
+		fprintf(stderr, "Fatal error in GetUniformBlockIndex: Type error\n");
+		abort();
+	}
+	GLuint index = glGetUniformBlockIndex((GLuint)program_elem.value.i,
+			qd_string_data(name_elem.value.s));
+	qd_string_release(name_elem.value.s);
+	qd_push_i(ctx, (int64_t)index);
+	return 0;
+}
+
+// ============================================================================
+// Uniform Arrays
+// ============================================================================
+//
+// The *fv variants read count * components f64 values from data and the *iv
+// variants read i64 values; both are narrowed to 32 bits before upload.
+
+static const GLfloat* pop_uniform_floats(qd_context* ctx, const char* fn, size_t components,
+		GLint* location, GLsizei* count) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 3) {
+		fprintf(stderr, "Fatal error in %s: Stack underflow\n", fn);
+		abort();
+	}
+	qd_stack_element_t count_elem, data_elem, location_elem;
+	qd_stack_pop(ctx->st, &count_elem);
+	qd_stack_pop(ctx->st, &data_elem);
+	qd_stack_pop(ctx->st, &location_elem);
+	if (location_elem.type != QD_STACK_TYPE_INT || data_elem.type != QD_STACK_TYPE_PTR ||
+			count_elem.type != QD_STACK_TYPE_INT || count_elem.value.i < 0) {
+		fprintf(stderr, "Fatal error in %s: Type error\n", fn);
+		abort();
+	}
+	size_t n = (size_t)count_elem.value.i * components;
+	GLfloat* values = scratch_reserve(n * sizeof(GLfloat), fn);
+	convert_f64_to_f32(values, data_elem.value.p, n);
+	*location = (GLint)location_elem.value.i;
+	*count = (GLsizei)count_elem.value.i;
+	return values;
+}
+
+static const GLint* pop_uniform_ints(qd_context* ctx, const char* fn, size_t components,
+		GLint* location, GLsizei* count) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 3) {
+		fprintf(stderr, "Fatal error in %s: Stack underflow\n", fn);
+		abort();
+	}
+	qd_stack_element_t count_elem, data_elem, location_elem;
+	qd_stack_pop(ctx->st, &count_elem);
+	qd_stack_pop(ctx->st, &data_elem);
+	qd_stack_pop(ctx->st, &location_elem);
+	if (location_elem.type != QD_STACK_TYPE_INT || data_elem.type != QD_STACK_TYPE_PTR ||
+			count_elem.type != QD_STACK_TYPE_INT || count_elem.value.i < 0) {
+		fprintf(stderr, "Fatal error in %s: Type error\n", fn);
+		abort();
+	}
+	size_t n = (size_t)count_elem.value.i * components;
+	GLint* values = scratch_reserve(n * sizeof(GLint), fn);
+	convert_i64_to_i32(values, data_elem.value.p, n);
+	*location = (GLint)location_elem.value.i;
+	*count = (GLsizei)count_elem.value.i;
+	return values;
+}
+
+static GLboolean pop_transpose(qd_context* ctx, const char* fn) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 4) {
+		fprintf(stderr, "Fatal error in %s: Stack underflow\n", fn);
+		abort();
+	}
+	qd_stack_element_t transpose_elem;
+	qd_stack_pop(ctx->st, &transpose_elem);
+	if (transpose_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in %s: Type error\n", fn);
+		abort();
+	}
+	return transpose_elem.value.i ? GL_TRUE : GL_FALSE;
+}
+
+// Uniform1fv( location:i64 data:ptr count:i64 -- )
+int Uniform1fv(qd_context* ctx) {
+	GLint location;
+	GLsizei count;
+	const GLfloat* values = pop_uniform_floats(ctx, "Uniform1fv", 1, &location, &count);
+	glUniform1fv(location, count, values);
+	return 0;
+}
+
+// Uniform2fv( location:i64 data:ptr count:i64 -- )
+int Uniform2fv(qd_context* ctx) {
+	GLint location;
+	GLsizei count;
+	const GLfloat* values = pop_uniform_floats(ctx, "Uniform2fv", 2, &location, &count);
+	glUniform2fv(location, count, values);
+	return 0;
+}
+
+// Uniform3fv( location:i64 data:ptr count:i64 -- )
+int Uniform3fv(qd_context* ctx) {
+	GLint location;
+	GLsizei count;
+	const GLfloat* values = pop_uniform_floats(ctx, "Uniform3fv", 3, &location, &count);
+	glUniform3fv(location, count, values);
+	return 0;
+}
+
+// Uniform4fv( location:i64 data:ptr count:i64 -- )
+int Uniform4fv(qd_context* ctx) {
+	GLint location;
+	GLsizei count;
+	const GLfloat* values = pop_uniform_floats(ctx, "Uniform4fv", 4, &location, &count);
+	glUniform4fv(location, count, values);
+	return 0;
+}
+
+// Uniform1iv( location:i64 data:ptr count:i64 -- )
+int Uniform1iv(qd_context* ctx) {
+	GLint location;
+	GLsizei count;
+	const GLint* values = pop_uniform_ints(ctx, "Uniform1iv", 1, &location, &count);
+	glUniform1iv(location, count, values);
+	return 0;
+}
+
+// Uniform2iv( location:i64 data:ptr count:i64 -- )
+int Uniform2iv(qd_context* ctx) {
+	GLint location;
+	GLsizei count;
+	const GLint* values = pop_uniform_ints(ctx, "Uniform2iv", 2, &location, &count);
+	glUniform2iv(location, count, values);
+	return 0;
+}
+
+// Uniform3iv( location:i64 data:ptr count:i64 -- )
+int Uniform3iv(qd_context* ctx) {
+	GLint location;
+	GLsizei count;
+	const GLint* values = pop_uniform_ints(ctx, "Uniform3iv", 3, &location, &count);
+	glUniform3iv(location, count, values);
+	return 0;
+}
+
+// Uniform4iv( location:i64 data:ptr count:i64 -- )
+int Uniform4iv(qd_context* ctx) {
+	GLint location;
+	GLsizei count;
+	const GLint* values = pop_uniform_ints(ctx, "Uniform4iv", 4, &location, &count);
+	glUniform4iv(location, count, values);
+	return 0;
+}
+
+// UniformMatrix2fv( location:i64 data:ptr count:i64 transpose:i64 -- )
+int UniformMatrix2fv(qd_context* ctx) {
+	GLboolean transpose = pop_transpose(ctx, "UniformMatrix2fv");
+	GLint location;
+	GLsizei count;
+	const GLfloat* values = pop_uniform_floats(ctx, "UniformMatrix2fv", 4, &location, &count);
+	glUniformMatrix2fv(location, count, transpose, values);
+	return 0;
+}
+
+// UniformMatrix3fv( location:i64 data:ptr count:i64 transpose:i64 -- )
+int UniformMatrix3fv(qd_context* ctx) {
+	GLboolean transpose = pop_transpose(ctx, "UniformMatrix3fv");
+	GLint location;
+	GLsizei count;
+	const GLfloat* values = pop_uniform_floats(ctx, "UniformMatrix3fv", 9, &location, &count);
+	glUniformMatrix3fv(location, count, transpose, values);
+	return 0;
+}
+
+// UniformMatrix4fv( location:i64 data:ptr count:i64 transpose:i64 -- )
+int UniformMatrix4fv(qd_context* ctx) {
+	GLboolean transpose = pop_transpose(ctx, "UniformMatrix4fv");
+	GLint location;
+	GLsizei count;
+	const GLfloat* values = pop_uniform_floats(ctx, "UniformMatrix4fv", 16, &location, &count);
+	glUniformMatrix4fv(location, count, transpose, values);
+	return 0;
+}
+
+// ============================================================================
+// Uniform Blocks
+// ============================================================================
+//
+// A uniform block packs values natively following std140 or std430 layout
+// rules. UniformBlockBind copies the packed bytes into a shared stream buffer
+// and binds that range to a uniform buffer binding point, so per-draw uniform
+// state costs one memcpy and one glBindBufferRange.
+//
+// Values must be appended in the order the block declares its members. The
+// layouts differ wherever std140 rounds up to a vec4: the stride of every
+// array (so float, int and vec2 arrays take 16 bytes per element), the
+// column stride of every matrix (mat2 columns take 16 bytes instead of 8)
+// and the alignment and size of every struct. std430 keeps the natural
+// alignment of each type; vec3 members, vec3 arrays and mat3 columns take 16
+// bytes in both. Double-precision members are not supported.
+//
+// Structs are appended between UniformBlockStructBegin and
+// UniformBlockStructEnd, once per element for arrays of structs. Their
+// members are laid out from a vec4 boundary and moved into place by
+// StructEnd, once the alignment of the whole struct is known.
+
+#define GL_UNIFORM_STREAM_SIZE (4 * 1024 * 1024)
+#define GL_UNIFORM_STRUCT_DEPTH 8
+
+typedef struct {
+	unsigned char* data;
+	size_t size;
+	size_t capacity;
+	int std430;
+	// Open structs, innermost last: the block size when each was opened and
+	// the largest alignment among its members so far
+	size_t struct_depth;
+	size_t struct_outer[GL_UNIFORM_STRUCT_DEPTH];
+	size_t struct_align[GL_UNIFORM_STRUCT_DEPTH];
+} gl_uniform_block;
+
+static GLAD_THREAD_LOCAL gl_stream_buffer* uniform_stream = NULL;
+// Fallback without persistent mapping: a plain buffer filled with
+// glBufferSubData and orphaned whenever it wraps
+static GLAD_THREAD_LOCAL GLuint uniform_fallback_buffer = 0;
+static GLAD_THREAD_LOCAL size_t uniform_fallback_head = 0;
+static GLAD_THREAD_LOCAL size_t uniform_offset_alignment = 0;
+
+// The ring and the fallback buffer belong to the context they were created
+// in, so they can only be deleted (release) while that context is current.
+static void uniform_blocks_reset(int release) {
+	if (release) {
+		if (uniform_stream != NULL) {
+			stream_buffer_destroy(uniform_stream);
+		}
+		if (uniform_fallback_buffer != 0) {
+			glDeleteBuffers(1, &uniform_fallback_buffer);
+			state_forget_buffers(&uniform_fallback_buffer, 1);
+		}
+	}
+	uniform_stream = NULL;
+	uniform_fallback_buffer = 0;
+	uniform_fallback_head = 0;
+	uniform_offset_alignment = 0;
+}
+
+static gl_uniform_block* pop_uniform_block(qd_stack_element_t* elem, const char* fn) {
+	if (elem->type != QD_STACK_TYPE_PTR || elem->value.p == NULL) {
+		fprintf(stderr, "Fatal error in %s: Type error\n", fn);
+		abort();
+	}
+	return elem->value.p;
+}
+
+// Grows the block to end at start + size, zeroing the new bytes
+static unsigned char* uniform_block_extend(gl_uniform_block* ub, size_t start, size_t size,
+		const char* fn) {
+	if (start + size > ub->capacity) {
+		size_t capacity = ub->capacity ? ub->capacity * 2 : 256;
+		while (capacity < start + size) {
+			capacity *= 2;
+		}
+		unsigned char* data = realloc(ub->data, capacity);
+		if (data == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		ub->data = data;
+		ub->capacity = capacity;
+	}
+	memset(ub->data + ub->size, 0, start + size - ub->size);
+	ub->size = start + size;
+	return ub->data + start;
+}
+
+// Raises the alignment of the innermost open struct to align
+static void uniform_block_note_align(gl_uniform_block* ub, size_t align) {
+	if (ub->struct_depth > 0 && align > ub->struct_align[ub->struct_depth - 1]) {
+		ub->struct_align[ub->struct_depth - 1] = align;
+	}
+}
+
+// Pads the block to align and reserves size bytes, returning their address
+static unsigned char* uniform_block_put(gl_uniform_block* ub, size_t align, size_t size,
+		const char* fn) {
+	uniform_block_note_align(ub, align);
+	return uniform_block_extend(ub, (ub->size + align - 1) & ~(align - 1), size, fn);
+}
+
+// Appends components floats with the alignment of the matching vector type
+static void uniform_block_put_vector(qd_context* ctx, size_t components, const char* fn) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < components + 1) {
+		fprintf(stderr, "Fatal error in %s: Stack underflow\n", fn);
+		abort();
+	}
+	GLfloat values[4];
+	for (size_t i = components; i-- > 0;) {
+		qd_stack_element_t elem;
+		qd_stack_pop(ctx->st, &elem);
+		if (elem.type != QD_STACK_TYPE_FLOAT) {
+			fprintf(stderr, "Fatal error in %s: Type error\n", fn);
+			abort();
+		}
+		values[i] = (GLfloat)elem.value.f;
+	}
+	qd_stack_element_t ub_elem;
+	qd_stack_pop(ctx->st, &ub_elem);
+	gl_uniform_block* ub = pop_uniform_block(&ub_elem, fn);
+	size_t align = components == 1 ? 4 : components == 2 ? 8 : 16;
+	memcpy(uniform_block_put(ub, align, components * sizeof(GLfloat), fn), values,
+			components * sizeof(GLfloat));
+}
+
+// Appends an array of count elements of columns vectors of rows f64 values
+// each from data (column-major for matrices). Every vector starts a new slot,
+// which std140 rounds up to a vec4 and std430 only to the vector alignment.
+static void uniform_block_put_vectors(qd_context* ctx, size_t columns, size_t rows,
+		const char* fn) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 3) {
+		fprintf(stderr, "Fatal error in %s: Stack underflow\n", fn);
+		abort();
+	}
+	qd_stack_element_t count_elem, data_elem, ub_elem;
+	qd_stack_pop(ctx->st, &count_elem);
+	qd_stack_pop(ctx->st, &data_elem);
+	qd_stack_pop(ctx->st, &ub_elem);
+	if (data_elem.type != QD_STACK_TYPE_PTR || count_elem.type != QD_STACK_TYPE_INT ||
+			count_elem.value.i < 0) {
+		fprintf(stderr, "Fatal error in %s: Type error\n", fn);
+		abort();
+	}
+	gl_uniform_block* ub = pop_uniform_block(&ub_elem, fn);
+	const double* src = data_elem.value.p;
+	size_t vectors = (size_t)count_elem.value.i * columns;
+	size_t stride = !ub->std430 ? 16 : rows == 1 ? 4 : rows == 2 ? 8 : 16;
+	unsigned char* dst = uniform_block_put(ub, stride, vectors * stride, fn);
+	for (size_t v = 0; v < vectors; v++) {
+		convert_f64_to_f32((GLfloat*)(dst + v * stride), src + v * rows, rows);
+	}
+}
+
+static size_t uniform_block_alignment(void) {
+	if (uniform_offset_alignment == 0) {
+		GLint alignment = 0;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		// The ring allocator needs a power of two; every known driver reports one
+		size_t align = 16;
+		while (align < (size_t)alignment) {
+			align *= 2;
+		}
+		uniform_offset_alignment = align;
+	}
+	return uniform_offset_alignment;
+}
+
+// UniformBlockCreate( layout:i64 -- ub:ptr )
+// layout is 140 for std140 or 430 for std430
+int UniformBlockCreate(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in UniformBlockCreate: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t layout_elem;
+	qd_stack_pop(ctx->st, &layout_elem);
+	if (layout_elem.type != QD_STACK_TYPE_INT ||
+			(layout_elem.value.i != 140 && layout_elem.value.i != 430)) {
+		fprintf(stderr, "Fatal error in UniformBlockCreate: Type error\n");
+		abort();
+	}
+	gl_uniform_block* ub = calloc(1, sizeof(gl_uniform_block));
+	if (ub == NULL) {
+		fprintf(stderr, "Fatal error in UniformBlockCreate: Out of memory\n");
+		abort();
+	}
+	ub->std430 = layout_elem.value.i == 430;
+	qd_push_p(ctx, ub);
+	return 0;
+}
+
+// UniformBlockDestroy( ub:ptr -- )
+int UniformBlockDestroy(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in UniformBlockDestroy: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t ub_elem;
+	qd_stack_pop(ctx->st, &ub_elem);
+	if (ub_elem.type != QD_STACK_TYPE_PTR) {
+		fprintf(stderr, "Fatal error in UniformBlockDestroy: Type error\n");
+		abort();
+	}
+	gl_uniform_block* ub = ub_elem.value.p;
+	if (ub != NULL) {
+		free(ub->data);
+		free(ub);
+	}
+	return 0;
+}
+
+// UniformBlockReset( ub:ptr -- )
+int UniformBlockReset(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in UniformBlockReset: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t ub_elem;
+	qd_stack_pop(ctx->st, &ub_elem);
+	gl_uniform_block* ub = pop_uniform_block(&ub_elem, "UniformBlockReset");
+	ub->size = 0;
+	ub->struct_depth = 0;
+	return 0;
+}
+
+// UniformBlockSize( ub:ptr -- size:i64 )
+int UniformBlockSize(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in UniformBlockSize: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t ub_elem;
+	qd_stack_pop(ctx->st, &ub_elem);
+	qd_push_i(ctx, (int64_t)pop_uniform_block(&ub_elem, "UniformBlockSize")->size);
+	return 0;
+}
+
+// UniformBlockFloat( ub:ptr x:f64 -- )
+int UniformBlockFloat(qd_context* ctx) {
+	uniform_block_put_vector(ctx, 1, "UniformBlockFloat");
+	return 0;
+}
+
+// UniformBlockVec2( ub:ptr x:f64 y:f64 -- )
+int UniformBlockVec2(qd_context* ctx) {
+	uniform_block_put_vector(ctx, 2, "UniformBlockVec2");
+	return 0;
+}
+
+// UniformBlockVec3( ub:ptr x:f64 y:f64 z:f64 -- )
+int UniformBlockVec3(qd_context* ctx) {
+	uniform_block_put_vector(ctx, 3, "UniformBlockVec3");
+	return 0;
+}
+
+// UniformBlockVec4( ub:ptr x:f64 y:f64 z:f64 w:f64 -- )
+int UniformBlockVec4(qd_context* ctx) {
+	uniform_block_put_vector(ctx, 4, "UniformBlockVec4");
+	return 0;
+}
+
+// UniformBlockInt( ub:ptr x:i64 -- )
+// Also used for uint and bool members
+int UniformBlockInt(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in UniformBlockInt: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t x_elem, ub_elem;
+	qd_stack_pop(ctx->st, &x_elem);
+	qd_stack_pop(ctx->st, &ub_elem);
+	if (x_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in UniformBlockInt: Type error\n");
+		abort();
+	}
+	gl_uniform_block* ub = pop_uniform_block(&ub_elem, "UniformBlockInt");
+	GLint x = (GLint)x_elem.value.i;
+	memcpy(uniform_block_put(ub, 4, sizeof(x), "UniformBlockInt"), &x, sizeof(x));
+	return 0;
+}
+
+// UniformBlockInts( ub:ptr data:ptr count:i64 -- )
+// Appends an int[count] array from i64 data; also used for uint and bool
+// arrays
+int UniformBlockInts(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 3) {
+		fprintf(stderr, "Fatal error in UniformBlockInts: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t count_elem, data_elem, ub_elem;
+	qd_stack_pop(ctx->st, &count_elem);
+	qd_stack_pop(ctx->st, &data_elem);
+	qd_stack_pop(ctx->st, &ub_elem);
+	if (data_elem.type != QD_STACK_TYPE_PTR || count_elem.type != QD_STACK_TYPE_INT ||
+			count_elem.value.i < 0) {
+		fprintf(stderr, "Fatal error in UniformBlockInts: Type error\n");
+		abort();
+	}
+	gl_uniform_block* ub = pop_uniform_block(&ub_elem, "UniformBlockInts");
+	const int64_t* src = data_elem.value.p;
+	size_t count = (size_t)count_elem.value.i;
+	if (ub->std430) {
+		GLint* dst = (GLint*)uniform_block_put(ub, 4, count * sizeof(GLint), "UniformBlockInts");
+		convert_i64_to_i32(dst, src, count);
+	} else {
+		// std140 rounds the array stride up to a vec4
+		GLint* dst = (GLint*)uniform_block_put(ub, 16, count * 4 * sizeof(GLint),
+				"UniformBlockInts");
+		for (size_t i = 0; i < count; i++) {
+			dst[i * 4] = (GLint)src[i];
+		}
+	}
+	return 0;
+}
+
+// UniformBlockFloats( ub:ptr data:ptr count:i64 -- )
+// Appends a float[count] array from f64 data
+int UniformBlockFloats(qd_context* ctx) {
+	uniform_block_put_vectors(ctx, 1, 1, "UniformBlockFloats");
+	return 0;
+}
+
+// UniformBlockVec2s( ub:ptr data:ptr count:i64 -- )
+// Appends a vec2[count] array from count * 2 f64 values
+int UniformBlockVec2s(qd_context* ctx) {
+	uniform_block_put_vectors(ctx, 1, 2, "UniformBlockVec2s");
+	return 0;
+}
+
+// UniformBlockVec3s( ub:ptr data:ptr count:i64 -- )
+// Appends a vec3[count] array from count * 3 f64 values
+int UniformBlockVec3s(qd_context* ctx) {
+	uniform_block_put_vectors(ctx, 1, 3, "UniformBlockVec3s");
+	return 0;
+}
+
+// UniformBlockVec4s( ub:ptr data:ptr count:i64 -- )
+// Appends a vec4[count] array from count * 4 f64 values
+int UniformBlockVec4s(qd_context* ctx) {
+	uniform_block_put_vectors(ctx, 1, 4, "UniformBlockVec4s");
+	return 0;
+}
+
+// UniformBlockMat2( ub:ptr data:ptr count:i64 -- )
+// Appends a mat2[count] array from count * 4 column-major f64 values
+int UniformBlockMat2(qd_context* ctx) {
+	uniform_block_put_vectors(ctx, 2, 2, "UniformBlockMat2");
+	return 0;
+}
+
+// UniformBlockMat3( ub:ptr data:ptr count:i64 -- )
+// Appends a mat3[count] array from count * 9 column-major f64 values
+int UniformBlockMat3(qd_context* ctx) {
+	uniform_block_put_vectors(ctx, 3, 3, "UniformBlockMat3");
+	return 0;
+}
+
+// UniformBlockMat4( ub:ptr data:ptr count:i64 -- )
+// Appends a mat4[count] array from count * 16 column-major f64 values
+int UniformBlockMat4(qd_context* ctx) {
+	uniform_block_put_vectors(ctx, 4, 4, "UniformBlockMat4");
+	return 0;
+}
+
+// UniformBlockStructBegin( ub:ptr -- )
+// Opens a struct member; append its members, then UniformBlockStructEnd
+int UniformBlockStructBegin(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in UniformBlockStructBegin: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t ub_elem;
+	qd_stack_pop(ctx->st, &ub_elem);
+	gl_uniform_block* ub = pop_uniform_block(&ub_elem, "UniformBlockStructBegin");
+	if (ub->struct_depth == GL_UNIFORM_STRUCT_DEPTH) {
+		fprintf(stderr, "Fatal error in UniformBlockStructBegin: Structs nested too deeply\n");
+		abort();
+	}
+	size_t outer = ub->size;
+	// A vec4 boundary satisfies every member alignment
+	uniform_block_extend(ub, (outer + 15) & ~(size_t)15, 0, "UniformBlockStructBegin");
+	ub->struct_outer[ub->struct_depth] = outer;
+	ub->struct_align[ub->struct_depth] = ub->std430 ? 4 : 16;
+	ub->struct_depth++;
+	return 0;
+}
+
+// UniformBlockStructEnd( ub:ptr -- )
+int UniformBlockStructEnd(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in UniformBlockStructEnd: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t ub_elem;
+	qd_stack_pop(ctx->st, &ub_elem);
+	gl_uniform_block* ub = pop_uniform_block(&ub_elem, "UniformBlockStructEnd");
+	if (ub->struct_depth == 0) {
+		fprintf(stderr, "Fatal error in UniformBlockStructEnd: No struct open\n");
+		abort();
+	}
+	ub->struct_depth--;
+	size_t outer = ub->struct_outer[ub->struct_depth];
+	size_t align = ub->struct_align[ub->struct_depth];
+	size_t scratch = (outer + 15) & ~(size_t)15;
+	size_t start = (outer + align - 1) & ~(align - 1);
+	size_t packed = ub->size - scratch;
+	// The struct's size is padded to a multiple of its alignment
+	size_t size = (packed + align - 1) & ~(align - 1);
+	memmove(ub->data + start, ub->data + scratch, packed);
+	ub->size = start + packed;
+	uniform_block_extend(ub, start, size, "UniformBlockStructEnd");
+	uniform_block_note_align(ub, align);
+	return 0;
+}
+
+// UniformBlockBind( ub:ptr index:i64 -- )
+// Uploads the packed block and binds it to uniform buffer binding point index.
+// The stream is recycled by EndFrame; call it once per frame, or binds stall
+// on the GPU whenever the stream fills up. A bound range stays intact until
+// the next 4 MB of binds, so draw before binding that much more.
+int UniformBlockBind(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in UniformBlockBind: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t index_elem, ub_elem;
+	qd_stack_pop(ctx->st, &index_elem);
+	qd_stack_pop(ctx->st, &ub_elem);
+	if (index_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in UniformBlockBind: Type error\n");
+		abort();
+	}
+	gl_uniform_block* ub = pop_uniform_block(&ub_elem, "UniformBlockBind");
+	if (ub->struct_depth != 0) {
+		fprintf(stderr, "Fatal error in UniformBlockBind: Unterminated struct\n");
+		abort();
+	}
+	// Block sizes are rounded up to a vec4
+	size_t size = (ub->size + 15) & ~(size_t)15;
+	if (size == 0) {
+		size = 16;
+	}
+	size_t packed = ub->size;
+	uniform_block_put(ub, 1, size - packed, "UniformBlockBind");
+	ub->size = packed;
+	size_t align = uniform_block_alignment();
+
+	if (uniform_stream == NULL && uniform_fallback_buffer == 0) {
+		uniform_stream = stream_buffer_create(GL_UNIFORM_BUFFER, GL_UNIFORM_STREAM_SIZE,
+				"UniformBlockBind");
+		if (uniform_stream != NULL) {
+			uniform_stream->recycle = 1;
+		} else {
+			uniform_fallback_buffer = name_pool_take(&buffer_pool, glGenBuffers, "UniformBlockBind");
+			state_bind_buffer(GL_UNIFORM_BUFFER, uniform_fallback_buffer);
+			glBufferData(GL_UNIFORM_BUFFER, GL_UNIFORM_STREAM_SIZE, NULL, GL_STREAM_DRAW);
+		}
+	}
+
+	GLuint buffer;
+	size_t offset;
+	if (uniform_stream != NULL) {
+		void* data;
+		offset = stream_buffer_alloc(uniform_stream, size, align, &data, "UniformBlockBind");
+		memcpy(data, ub->data, size);
+		buffer = uniform_stream->buffer;
+	} else {
+		buffer = uniform_fallback_buffer;
+		offset = (uniform_fallback_head + align - 1) & ~(align - 1);
+		state_bind_buffer(GL_UNIFORM_BUFFER, buffer);
+		if (offset + size > GL_UNIFORM_STREAM_SIZE) {
+			glBufferData(GL_UNIFORM_BUFFER, GL_UNIFORM_STREAM_SIZE, NULL, GL_STREAM_DRAW);
+			offset = 0;
+		}
+		glBufferSubData(GL_UNIFORM_BUFFER, (GLintptr)offset, (GLsizeiptr)size, ub->data);
+		uniform_fallback_head = offset + size;
+	}
+	glBindBufferRange(GL_UNIFORM_BUFFER, (GLuint)index_elem.value.i, buffer, (GLintptr)offset,
+			(GLsizeiptr)size);
+	state_note_indexed_buffer(GL_UNIFORM_BUFFER, buffer);
+	return 0;
+}
+
+// ============================================================================
+// Drawing
+// ============================================================================
+
+// ============================================================================
+// Indirect Draw Builders
+// ============================================================================
+//
+// A draw builder collects DrawElementsIndirectCommand records natively and
+// submits them all with one glMultiDrawElementsIndirect call from its own
+// GL_DRAW_INDIRECT_BUFFER. The records are only re-uploaded after they change,
+// so a static scene costs one call per frame.
+//
+// Without indirect draws (GL 3.x lacking GL_ARB_draw_indirect) the records are
+// drawn one by one from client memory instead. A record with a base instance
+// then also needs GL 4.2 or GL_ARB_base_instance.
+
+typedef struct {
+	GLuint count;
+	GLuint instance_count;
+	GLuint first_index;
+	GLint base_vertex;
+	GLuint base_instance;
+} gl_draw_elements_indirect;
+
+typedef struct {
+	gl_draw_elements_indirect* cmds;
+	size_t count;
+	size_t capacity;
+	GLuint buffer;
+	int dirty;
+} gl_draw_builder;
+
+// DrawBuilderCreate( -- db:ptr )
+int DrawBuilderCreate(qd_context* ctx) {
+	gl_draw_builder* db = calloc(1, sizeof(gl_draw_builder));
+	if (db == NULL) {
+		fprintf(stderr, "Fatal error in DrawBuilderCreate: Out of memory\n");
+		abort();
+	}
+	db->buffer = name_pool_take(&buffer_pool, glGenBuffers, "DrawBuilderCreate");
+	qd_push_p(ctx, db);
+	return 0;
+}
+
+// DrawBuilderDestroy( db:ptr -- )
+int DrawBuilderDestroy(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in DrawBuilderDestroy: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t db_elem;
+	qd_stack_pop(ctx->st, &db_elem);
+	if (db_elem.type != QD_STACK_TYPE_PTR) {
+		fprintf(stderr, "Fatal error in DrawBuilderDestroy: Type error\n");
+		abort();
+	}
+	gl_draw_builder* db = db_elem.value.p;
+	if (db != NULL) {
+		glDeleteBuffers(1, &db->buffer);
+		state_forget_buffers(&db->buffer, 1);
+		free(db->cmds);
+		free(db);
+	}
+	return 0;
+}
+
+// DrawBuilderReset( db:ptr -- )
+int DrawBuilderReset(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in DrawBuilderReset: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t db_elem;
+	qd_stack_pop(ctx->st, &db_elem);
+	if (db_elem.type != QD_STACK_TYPE_PTR || db_elem.value.p == NULL) {
+		fprintf(stderr, "Fatal error in DrawBuilderReset: Type error\n");
+		abort();
+	}
+	gl_draw_builder* db = db_elem.value.p;
+	db->count = 0;
+	db->dirty = 1;
+	return 0;
+}
+
+// DrawBuilderAdd( db:ptr count:i64 instance_count:i64 first_index:i64 base_vertex:i64 base_instance:i64 -- )
+int DrawBuilderAdd(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 6) {
+		fprintf(stderr, "Fatal error in DrawBuilderAdd: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t base_instance_elem, base_vertex_elem, first_index_elem, instance_count_elem,
+			count_elem, db_elem;
+	qd_stack_pop(ctx->st, &base_instance_elem);
+	qd_stack_pop(ctx->st, &base_vertex_elem);
+	qd_stack_pop(ctx->st, &first_index_elem);
+	qd_stack_pop(ctx->st, &instance_count_elem);
+	qd_stack_pop(ctx->st, &count_elem);
+	qd_stack_pop(ctx->st, &db_elem);
+	if (db_elem.type != QD_STACK_TYPE_PTR || db_elem.value.p == NULL ||
+			count_elem.type != QD_STACK_TYPE_INT || instance_count_elem.type != QD_STACK_TYPE_INT ||
+			first_index_elem.type != QD_STACK_TYPE_INT || base_vertex_elem.type != QD_STACK_TYPE_INT ||
+			base_instance_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in DrawBuilderAdd: Type error\n");
+		abort();
+	}
+	gl_draw_builder* db = db_elem.value.p;
+	if (db->count == db->capacity) {
+		size_t capacity = db->capacity ? db->capacity * 2 : 256;
+		gl_draw_elements_indirect* cmds = realloc(db->cmds, capacity * sizeof(gl_draw_elements_indirect));
+		if (cmds == NULL) {
+			fprintf(stderr, "Fatal error in DrawBuilderAdd: Out of memory\n");
+			abort();
+		}
+		db->cmds = cmds;
+		db->capacity = capacity;
+	}
+	gl_draw_elements_indirect* cmd = &db->cmds[db->count++];
+	cmd->count = (GLuint)count_elem.value.i;
+	cmd->instance_count = (GLuint)instance_count_elem.value.i;
+	cmd->first_index = (GLuint)first_index_elem.value.i;
+	cmd->base_vertex = (GLint)base_vertex_elem.value.i;
+	cmd->base_instance = (GLuint)base_instance_elem.value.i;
+	db->dirty = 1;
+	return 0;
+}
+
+// Draws the records one call each, reading them from client memory
+static void draw_builder_submit_direct(const gl_draw_builder* db, GLenum mode, GLenum type) {
+	size_t index_size;
+	switch (type) {
+	case GL_UNSIGNED_BYTE:
+		index_size = 1;
+		break;
+	case GL_UNSIGNED_SHORT:
+		index_size = 2;
+		break;
+	case GL_UNSIGNED_INT:
+		index_size = 4;
+		break;
+	default:
+		fprintf(stderr, "Fatal error in DrawBuilderSubmit: Invalid index type\n");
+		abort();
+	}
+	if (!GLAD_GL_VERSION_3_2 && !GLAD_GL_ARB_draw_elements_base_vertex) {
+		fprintf(stderr, "Fatal error in DrawBuilderSubmit: Requires GL 3.2 or "
+				"GL_ARB_draw_elements_base_vertex\n");
+		abort();
+	}
+	int base_instance = GLAD_GL_VERSION_4_2 || GLAD_GL_ARB_base_instance;
+	for (size_t i = 0; i < db->count; i++) {
+		const gl_draw_elements_indirect* cmd = &db->cmds[i];
+		const void* indices = (const void*)(uintptr_t)(cmd->first_index * index_size);
+		if (base_instance) {
+			glDrawElementsInstancedBaseVertexBaseInstance(mode, (GLsizei)cmd->count, type, indices,
+					(GLsizei)cmd->instance_count, cmd->base_vertex, cmd->base_instance);
+		} else if (cmd->base_instance == 0) {
+			glDrawElementsInstancedBaseVertex(mode, (GLsizei)cmd->count, type, indices,
+					(GLsizei)cmd->instance_count, cmd->base_vertex);
+		} else {
+			fprintf(stderr, "Fatal error in DrawBuilderSubmit: Base instance requires GL 4.2 or "
+					"GL_ARB_base_instance\n");
+			abort();
+		}
+	}
+}
+
+// DrawBuilderSubmit( db:ptr mode:i64 type:i64 -- )
+// Draws every recorded command with the currently bound vertex array
+int DrawBuilderSubmit(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 3) {
+		fprintf(stderr, "Fatal error in DrawBuilderSubmit: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t type_elem, mode_elem, db_elem;
+	qd_stack_pop(ctx->st, &type_elem);
+	qd_stack_pop(ctx->st, &mode_elem);
+	qd_stack_pop(ctx->st, &db_elem);
+	if (db_elem.type != QD_STACK_TYPE_PTR || db_elem.value.p == NULL ||
+			mode_elem.type != QD_STACK_TYPE_INT || type_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in DrawBuilderSubmit: Type error\n");
+		abort();
+	}
+	gl_draw_builder* db = db_elem.value.p;
+	if (db->count == 0) {
+		return 0;
+	}
+	GLenum mode = (GLenum)mode_elem.value.i;
+	GLenum type = (GLenum)type_elem.value.i;
+	if (!GLAD_GL_VERSION_4_0 && !GLAD_GL_ARB_draw_indirect) {
+		draw_builder_submit_direct(db, mode, type);
+		return 0;
+	}
+	state_bind_buffer(GL_DRAW_INDIRECT_BUFFER, db->buffer);
+	if (db->dirty) {
+		glBufferData(GL_DRAW_INDIRECT_BUFFER, (GLsizeiptr)(db->count * sizeof(gl_draw_elements_indirect)),
+				db->cmds, GL_STREAM_DRAW);
+		db->dirty = 0;
+	}
+	if (GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_multi_draw_indirect) {
+		glMultiDrawElementsIndirect(mode, type, NULL, (GLsizei)db->count, 0);
+	} else {
+		// GL 4.0-4.2: one indirect draw per record, still without CPU readback
+		for (size_t i = 0; i < db->count; i++) {
+			glDrawElementsIndirect(mode, type,
+					(const void*)(uintptr_t)(i * sizeof(gl_draw_elements_indirect)));
+		}
+	}
+	return 0;
+}
+
+// ============================================================================
+// Textures
+// ============================================================================
+//
+// TexStorage2D/3D allocate immutable storage, so the driver never has to
+// revalidate mip completeness on bind. TexSubImage2D/3D upload tightly packed
+// pixels. The Region variants upload a sub-rectangle of a larger image given
+// its row stride in bytes (and rows per slice in 3D), which GL reads in place
+// through GL_UNPACK_ROW_LENGTH, the skip parameters and the largest
+// GL_UNPACK_ALIGNMENT that matches the stride. Every upload sets each unpack
+// parameter it depends on, so earlier PixelStorei calls cannot skew it.
+
+// GenTexture( -- texture:i64 )
+int GenTexture(qd_context* ctx) {
+	GLuint texture = name_pool_take(&texture_pool, glGenTextures, "GenTexture");
+	qd_push_i(ctx, (int64_t)texture);
+	return 0;
+}
+
+// DeleteTexture( texture:i64 -- )
+int DeleteTexture(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in DeleteTexture: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t texture_elem;
+	qd_stack_pop(ctx->st, &texture_elem);
+	if (texture_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in DeleteTexture: Type error\n");
+		abort();
+	}
+	GLuint texture = (GLuint)texture_elem.value.i;
+	if (deferred_delete_enabled) {
+		name_list_push(&delete_frames[delete_frame_current].textures, texture, "DeleteTexture");
+	} else {
+		glDeleteTextures(1, &texture);
+		state_forget_textures(&texture, 1);
+	}
+	return 0;
+}
+
+// BindTexture( target:i64 texture:i64 -- )
+int BindTexture(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in BindTexture: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t texture_elem, target_elem;
+	qd_stack_pop(ctx->st, &texture_elem);
+	qd_stack_pop(ctx->st, &target_elem);
+	if (target_elem.type != QD_STACK_TYPE_INT || texture_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in BindTexture: Type error\n");
+		abort();
+	}
+	state_bind_texture((GLenum)target_elem.value.i, (GLuint)texture_elem.value.i);
+	return 0;
+}
+
+// ActiveTexture( texture:i64 -- )
+int ActiveTexture(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in ActiveTexture: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t texture_elem;
+	qd_stack_pop(ctx->st, &texture_elem);
+	if (texture_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in ActiveTexture: Type error\n");
+		abort();
+	}
+	state_active_texture((GLenum)texture_elem.value.i);
+	return 0;
+}
+
+// Bytes per pixel of format/type, or 0 if unsupported
+static size_t texture_pixel_size(GLenum format, GLenum type) {
+	switch (type) {
+	case GL_UNSIGNED_BYTE_3_3_2:
+	case GL_UNSIGNED_BYTE_2_3_3_REV:
+		return 1;
+	case GL_UNSIGNED_SHORT_5_6_5:
+	case GL_UNSIGNED_SHORT_5_6_5_REV:
+	case GL_UNSIGNED_SHORT_4_4_4_4:
+	case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+	case GL_UNSIGNED_SHORT_5_5_5_1:
+	case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+		return 2;
+	case GL_UNSIGNED_INT_8_8_8_8:
+	case GL_UNSIGNED_INT_8_8_8_8_REV:
+	case GL_UNSIGNED_INT_10_10_10_2:
+	case GL_UNSIGNED_INT_2_10_10_10_REV:
+	case GL_UNSIGNED_INT_24_8:
+	case GL_UNSIGNED_INT_10F_11F_11F_REV:
+	case GL_UNSIGNED_INT_5_9_9_9_REV:
+		return 4;
+	case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+		return 8;
+	}
+	size_t component;
+	switch (type) {
+	case GL_BYTE:
+	case GL_UNSIGNED_BYTE:
+		component = 1;
+		break;
+	case GL_SHORT:
+	case GL_UNSIGNED_SHORT:
+	case GL_HALF_FLOAT:
+		component = 2;
+		break;
+	case GL_INT:
+	case GL_UNSIGNED_INT:
+	case GL_FLOAT:
+		component = 4;
+		break;
+	default:
+		return 0;
+	}
+	switch (format) {
+	case GL_RED:
+	case GL_RED_INTEGER:
+	case GL_DEPTH_COMPONENT:
+	case GL_STENCIL_INDEX:
+		return component;
+	case GL_RG:
+	case GL_RG_INTEGER:
+		return component * 2;
+	case GL_RGB:
+	case GL_BGR:
+	case GL_RGB_INTEGER:
+	case GL_BGR_INTEGER:
+		return component * 3;
+	case GL_RGBA:
+	case GL_BGRA:
+	case GL_RGBA_INTEGER:
+	case GL_BGRA_INTEGER:
+		return component * 4;
+	}
+	return 0;
+}
+
+// Pops count integer arguments in declaration order, except the pixels
+// pointer at index pixels_index
+static const void* pop_texture_upload(qd_context* ctx, const char* fn, size_t count,
+		size_t pixels_index, int64_t* args) {
+	if (qd_stack_size(ctx->st) < count) {
+		fprintf(stderr, "Fatal error in %s: Stack underflow\n", fn);
+		abort();
+	}
+	const void* pixels = NULL;
+	int mismatch = 0;
+	for (size_t i = count; i-- > 0;) {
+		qd_stack_element_t elem;
+		qd_stack_pop(ctx->st, &elem);
+		if (i == pixels_index) {
+			mismatch |= elem.type != QD_STACK_TYPE_PTR;
+			pixels = elem.value.p;
+		} else {
+			mismatch |= elem.type != QD_STACK_TYPE_INT;
+			args[i] = elem.value.i;
+		}
+	}
+	if (mismatch) {
+		fprintf(stderr, "Fatal error in %s: Type error\n", fn);
+		abort();
+	}
+	return pixels;
+}
+
+// Uploads a width x height x depth box (depth 0 for 2D) read from pixels,
+// whose rows are stride bytes apart and slices image_height rows apart, at
+// offset (src_x, src_y, src_z) in that image. A stride or image_height of 0
+// means tightly packed.
+static void texture_upload(const char* fn, GLenum target, GLint level, GLint x, GLint y, GLint z,
+		GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels,
+		int64_t stride, int64_t image_height, int64_t src_x, int64_t src_y, int64_t src_z) {
+	size_t pixel_size = texture_pixel_size(format, type);
+	if (pixel_size == 0) {
+		fprintf(stderr, "Fatal error in %s: Unsupported format or type\n", fn);
+		abort();
+	}
+	if (width < 0 || height < 0 || depth < 0 || src_x < 0 || src_y < 0 || src_z < 0 ||
+			stride < 0 || image_height < 0) {
+		fprintf(stderr, "Fatal error in %s: Negative size or offset\n", fn);
+		abort();
+	}
+	if (width == 0 || height == 0) {
+		return;
+	}
+	if (stride == 0) {
+		stride = (int64_t)((size_t)(src_x + width) * pixel_size);
+	}
+	if (image_height == 0) {
+		image_height = src_y + height;
+	}
+
+	// Rows of row_length pixels padded to the alignment must land exactly on
+	// the stride; that also covers strides padded past the last whole pixel
+	int64_t row_length = stride / (int64_t)pixel_size;
+	GLint alignment = 0;
+	for (GLint candidate = 8; candidate >= 1; candidate /= 2) {
+		int64_t padded = (row_length * (int64_t)pixel_size + candidate - 1) / candidate * candidate;
+		if (stride % candidate == 0 && padded == stride) {
+			alignment = candidate;
+			break;
+		}
+	}
+	if (alignment == 0 || row_length < src_x + width || image_height < src_y + height) {
+		fprintf(stderr, "Fatal error in %s: Stride does not fit the region\n", fn);
+		abort();
+	}
+
+	state_pixel_store(GL_UNPACK_ALIGNMENT, alignment);
+	state_pixel_store(GL_UNPACK_ROW_LENGTH, row_length == width ? 0 : (GLint)row_length);
+	state_pixel_store(GL_UNPACK_SKIP_PIXELS, (GLint)src_x);
+	state_pixel_store(GL_UNPACK_SKIP_ROWS, (GLint)src_y);
+	if (depth == 0) {
+		glTexSubImage2D(target, level, x, y, width, height, format, type, pixels);
+		return;
+	}
+	state_pixel_store(GL_UNPACK_IMAGE_HEIGHT, image_height == height ? 0 : (GLint)image_height);
+	state_pixel_store(GL_UNPACK_SKIP_IMAGES, (GLint)src_z);
+	glTexSubImage3D(target, level, x, y, z, width, height, depth, format, type, pixels);
+}
+
+// TexSubImage2D( target:i64 level:i64 x:i64 y:i64 width:i64 height:i64 format:i64 type:i64 pixels:ptr -- )
+// pixels holds tightly packed rows
+int TexSubImage2D(qd_context* ctx) {
+	int64_t a[9];
+	const void* pixels = pop_texture_upload(ctx, "TexSubImage2D", 9, 8, a);
+	texture_upload("TexSubImage2D", (GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLint)a[3], 0,
+			(GLsizei)a[4], (GLsizei)a[5], 0, (GLenum)a[6], (GLenum)a[7], pixels, 0, 0, 0, 0, 0);
+	return 0;
+}
+
+// TexSubImage3D( target:i64 level:i64 x:i64 y:i64 z:i64 width:i64 height:i64 depth:i64 format:i64 type:i64 pixels:ptr -- )
+// pixels holds tightly packed rows and slices
+int TexSubImage3D(qd_context* ctx) {
+	int64_t a[11];
+	const void* pixels = pop_texture_upload(ctx, "TexSubImage3D", 11, 10, a);
+	// Depth 0 would select the 2D path below; an empty box uploads nothing
+	if (a[7] == 0) {
+		return 0;
+	}
+	texture_upload("TexSubImage3D", (GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLint)a[3], (GLint)a[4],
+			(GLsizei)a[5], (GLsizei)a[6], (GLsizei)a[7], (GLenum)a[8], (GLenum)a[9], pixels, 0, 0, 0, 0,
+			0);
+	return 0;
+}
+
+// TexSubImage2DRegion( target:i64 level:i64 x:i64 y:i64 width:i64 height:i64 format:i64 type:i64 pixels:ptr stride:i64 src_x:i64 src_y:i64 -- )
+// Uploads the width x height rectangle at (src_x, src_y) of an image whose
+// rows are stride bytes apart, without repacking it
+int TexSubImage2DRegion(qd_context* ctx) {
+	int64_t a[12];
+	const void* pixels = pop_texture_upload(ctx, "TexSubImage2DRegion", 12, 8, a);
+	texture_upload("TexSubImage2DRegion", (GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLint)a[3], 0,
+			(GLsizei)a[4], (GLsizei)a[5], 0, (GLenum)a[6], (GLenum)a[7], pixels, a[9], 0, a[10], a[11], 0);
+	return 0;
+}
+
+// TexSubImage3DRegion( target:i64 level:i64 x:i64 y:i64 z:i64 width:i64 height:i64 depth:i64 format:i64 type:i64 pixels:ptr stride:i64 image_height:i64 src_x:i64 src_y:i64 src_z:i64 -- )
+// Like TexSubImage2DRegion for a box of a volume whose slices are
+// image_height rows apart
+int TexSubImage3DRegion(qd_context* ctx) {
+	int64_t a[16];
+	const void* pixels = pop_texture_upload(ctx, "TexSubImage3DRegion", 16, 10, a);
+	if (a[7] == 0) {
+		return 0;
+	}
+	texture_upload("TexSubImage3DRegion", (GLenum)a[0], (GLint)a[1], (GLint)a[2], (GLint)a[3],
+			(GLint)a[4], (GLsizei)a[5], (GLsizei)a[6], (GLsizei)a[7], (GLenum)a[8], (GLenum)a[9], pixels,
+			a[11], a[12], a[13], a[14], a[15]);
+	return 0;
+}
+
+// ============================================================================
+// Upload Queue
+// ============================================================================
+//
+// An upload queue stages pixels in a ring of slots inside one
+// GL_PIXEL_UNPACK_BUFFER and issues the TexSubImage from the slot's offset,
+// so the driver copies from buffer memory on the GPU timeline instead of
+// blocking on client memory. Each slot is mapped unsynchronized and fenced
+// after its upload; a slot is only rewritten once its fence has signaled.
+// Images taller than a slot are split into bands of rows across slots, which
+// lets large uploads overlap with rendering. A queue belongs to the context
+// it was created in.
+
+typedef struct {
+	GLuint buffer;
+	size_t slot_size;
+	size_t slot_count;
+	size_t next;
+	GLsync* fences;
+	int64_t bytes;
+	int64_t waits;
+	double seconds;
+} gl_upload_queue;
+
+static gl_upload_queue* upload_queue_create(size_t slot_size, size_t slot_count, const char* fn) {
+	if (!GLAD_GL_VERSION_3_2 && !GLAD_GL_ARB_sync) {
+		return NULL;
+	}
+	gl_upload_queue* queue = calloc(1, sizeof(gl_upload_queue));
+	GLsync* fences = calloc(slot_count, sizeof(GLsync));
+	if (queue == NULL || fences == NULL) {
+		fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+		abort();
+	}
+	// Keep every slot offset aligned for any pixel type
+	queue->slot_size = (slot_size + 15) & ~(size_t)15;
+	queue->slot_count = slot_count;
+	queue->fences = fences;
+	queue->buffer = name_pool_take(&buffer_pool, glGenBuffers, fn);
+	state_bind_buffer(GL_PIXEL_UNPACK_BUFFER, queue->buffer);
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)(queue->slot_size * slot_count), NULL,
+			GL_STREAM_DRAW);
+	state_bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	return queue;
+}
+
+// Returns the next slot, waiting for the GPU to finish reading it if needed
+static size_t upload_queue_acquire(gl_upload_queue* queue) {
+	size_t slot = queue->next;
+	queue->next = (slot + 1) % queue->slot_count;
+	GLsync fence = queue->fences[slot];
+	if (fence != NULL) {
+		GLenum status = glClientWaitSync(fence, 0, 0);
+		if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+			queue->waits++;
+			glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, UINT64_MAX);
+		}
+		glDeleteSync(fence);
+		queue->fences[slot] = NULL;
+	}
+	return slot;
+}
+
+// Uploads a width x height x depth box (depth 0 for 2D) from pixels, whose
+// rows are stride bytes apart and slices image_height rows apart (0 for
+// tightly packed), through the staging slots.
+static void upload_queue_push(gl_upload_queue* queue, const char* fn, GLenum target, GLint level,
+		GLint x, GLint y, GLint z, GLsizei width, GLsizei height, GLsizei depth, GLenum format,
+		GLenum type, const unsigned char* pixels, int64_t stride, int64_t image_height) {
+	double start = gl_now();
+	size_t pixel_size = texture_pixel_size(format, type);
+	if (pixel_size == 0) {
+		fprintf(stderr, "Fatal error in %s: Unsupported format or type\n", fn);
+		abort();
+	}
+	if (width < 0 || height < 0 || depth < 0 || stride < 0 || image_height < 0) {
+		fprintf(stderr, "Fatal error in %s: Negative size or offset\n", fn);
+		abort();
+	}
+	size_t row_bytes = (size_t)width * pixel_size;
+	size_t src_stride = stride == 0 ? row_bytes : (size_t)stride;
+	size_t src_rows = image_height == 0 ? (size_t)height : (size_t)image_height;
+	if (src_stride < row_bytes || src_rows < (size_t)height) {
+		fprintf(stderr, "Fatal error in %s: Stride does not fit the region\n", fn);
+		abort();
+	}
+	if (row_bytes > queue->slot_size) {
+		fprintf(stderr, "Fatal error in %s: Row larger than a staging slot\n", fn);
+		abort();
+	}
+	if (row_bytes == 0 || height == 0) {
+		return;
+	}
+
+	size_t band_rows = queue->slot_size / row_bytes;
+	GLsizei slices = depth == 0 ? 1 : depth;
+	state_bind_buffer(GL_PIXEL_UNPACK_BUFFER, queue->buffer);
+	for (GLsizei slice = 0; slice < slices; slice++) {
+		for (GLsizei row = 0; row < height;) {
+			GLsizei rows = (GLsizei)band_rows < height - row ? (GLsizei)band_rows : height - row;
+			size_t size = (size_t)rows * row_bytes;
+			size_t offset = upload_queue_acquire(queue) * queue->slot_size;
+			// The fence guarantees the GPU is done with the slot, so skip
+			// the driver's own synchronization
+			unsigned char* dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, (GLintptr)offset,
+					(GLsizeiptr)size,
+					GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+			if (dst == NULL) {
+				fprintf(stderr, "Fatal error in %s: Could not map staging buffer\n", fn);
+				abort();
+			}
+			const unsigned char* src = pixels + ((size_t)slice * src_rows + (size_t)row) * src_stride;
+			if (src_stride == row_bytes) {
+				memcpy(dst, src, size);
+			} else {
+				for (GLsizei i = 0; i < rows; i++) {
+					memcpy(dst + (size_t)i * row_bytes, src + (size_t)i * src_stride, row_bytes);
+				}
+			}
+			glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+			texture_upload(fn, target, level, x, y + row, z + slice, width, rows, depth == 0 ? 0 : 1,
+					format, type, (const void*)(uintptr_t)offset, 0, 0, 0, 0, 0);
+			queue->fences[offset / queue->slot_size] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			queue->bytes += (int64_t)size;
+			row += rows;
+		}
+	}
+	// Later uploads from client memory must not read from the queue
+	state_bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	queue->seconds += gl_now() - start;
+}
+
+static void upload_queue_destroy(gl_upload_queue* queue) {
+	for (size_t slot = 0; slot < queue->slot_count; slot++) {
+		if (queue->fences[slot] != NULL) {
+			glDeleteSync(queue->fences[slot]);
+		}
+	}
+	// Uploads already issued keep the buffer's storage alive until they finish
+	glDeleteBuffers(1, &queue->buffer);
+	state_forget_buffers(&queue->buffer, 1);
+	free(queue->fences);
+	free(queue);
+}
+
+static gl_upload_queue* pop_upload_queue(qd_context* ctx, const char* fn) {
+	qd_stack_element_t queue_elem;
+	qd_stack_pop(ctx->st, &queue_elem);
+	if (queue_elem.type != QD_STACK_TYPE_PTR || queue_elem.value.p == NULL) {
+		fprintf(stderr, "Fatal error in %s: Type error\n", fn);
+		abort();
+	}
+	return queue_elem.value.p;
+}
+
+// UploadQueueCreate( slot_size:i64 slots:i64 -- queue:ptr )
+// Returns a null pointer when fences (GL 3.2 or GL_ARB_sync) are unavailable
+int UploadQueueCreate(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in UploadQueueCreate: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t slots_elem, slot_size_elem;
+	qd_stack_pop(ctx->st, &slots_elem);
+	qd_stack_pop(ctx->st, &slot_size_elem);
+	if (slot_size_elem.type != QD_STACK_TYPE_INT || slots_elem.type != QD_STACK_TYPE_INT ||
+			slot_size_elem.value.i <= 0 || slots_elem.value.i <= 0) {
+		fprintf(stderr, "Fatal error in UploadQueueCreate: Type error\n");
+		abort();
+	}
+	gl_upload_queue* queue = upload_queue_create((size_t)slot_size_elem.value.i,
+			(size_t)slots_elem.value.i, "UploadQueueCreate");
+	qd_push_p(ctx, queue);
+	return 0;
+}
+
+// UploadQueueDestroy( queue:ptr -- )
+int UploadQueueDestroy(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in UploadQueueDestroy: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t queue_elem;
+	qd_stack_pop(ctx->st, &queue_elem);
+	if (queue_elem.type != QD_STACK_TYPE_PTR) {
+		fprintf(stderr, "Fatal error in UploadQueueDestroy: Type error\n");
+		abort();
+	}
+	if (queue_elem.value.p != NULL) {
+		upload_queue_destroy(queue_elem.value.p);
+	}
+	return 0;
+}
+
+// UploadQueueTexSubImage2D( queue:ptr target:i64 level:i64 x:i64 y:i64 width:i64 height:i64 format:i64 type:i64 pixels:ptr stride:i64 -- )
+// pixels may be reused as soon as this returns; stride is the byte distance
+// between its rows, or 0 if they are tightly packed
+int UploadQueueTexSubImage2D(qd_context* ctx) {
+	if (qd_stack_size(ctx->st) < 11) {
+		fprintf(stderr, "Fatal error in UploadQueueTexSubImage2D: Stack underflow\n");
+		abort();
+	}
+	int64_t a[10];
+	const void* pixels = pop_texture_upload(ctx, "UploadQueueTexSubImage2D", 10, 8, a);
+	gl_upload_queue* queue = pop_upload_queue(ctx, "UploadQueueTexSubImage2D");
+	upload_queue_push(queue, "UploadQueueTexSubImage2D", (GLenum)a[0], (GLint)a[1], (GLint)a[2],
+			(GLint)a[3], 0, (GLsizei)a[4], (GLsizei)a[5], 0, (GLenum)a[6], (GLenum)a[7], pixels, a[9], 0);
+	return 0;
+}
+
+// UploadQueueTexSubImage3D( queue:ptr target:i64 level:i64 x:i64 y:i64 z:i64 width:i64 height:i64 depth:i64 format:i64 type:i64 pixels:ptr stride:i64 image_height:i64 -- )
+// Like UploadQueueTexSubImage2D, one slice at a time; image_height is the
+// number of rows between slices, or 0 if they are tightly packed
+int UploadQueueTexSubImage3D(qd_context* ctx) {
+	if (qd_stack_size(ctx->st) < 14) {
+		fprintf(stderr, "Fatal error in UploadQueueTexSubImage3D: Stack underflow\n");
+		abort();
+	}
+	int64_t a[13];
+	const void* pixels = pop_texture_upload(ctx, "UploadQueueTexSubImage3D", 13, 10, a);
+	gl_upload_queue* queue = pop_upload_queue(ctx, "UploadQueueTexSubImage3D");
+	if (a[7] == 0) {
+		return 0;
+	}
+	upload_queue_push(queue, "UploadQueueTexSubImage3D", (GLenum)a[0], (GLint)a[1], (GLint)a[2],
+			(GLint)a[3], (GLint)a[4], (GLsizei)a[5], (GLsizei)a[6], (GLsizei)a[7], (GLenum)a[8],
+			(GLenum)a[9], pixels, a[11], a[12]);
+	return 0;
+}
+
+// UploadQueueStats( queue:ptr -- bytes:i64 waits:i64 bytes_per_second:f64 )
+// bytes_per_second is measured over the time the calling thread spent in
+// the queue's uploads; waits counts slots that were still in use by the GPU
+int UploadQueueStats(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in UploadQueueStats: Stack underflow\n");
+		abort();
+	}
+	const gl_upload_queue* queue = pop_upload_queue(ctx, "UploadQueueStats");
+	qd_push_i(ctx, queue->bytes);
+	qd_push_i(ctx, queue->waits);
+	qd_push_f(ctx, queue->seconds > 0.0 ? (double)queue->bytes / queue->seconds : 0.0);
+	return 0;
+}
+
+// ============================================================================
+// Sprite Batching
+// ============================================================================
+//
+// BatchPushQuad appends textured quads to a native arena. BatchEnd streams the
+// vertices into one buffer and draws each run of consecutive quads sharing a
+// program and texture with a single glDrawElements. Quads are drawn in
+// submission order, so overlapping blended sprites composite correctly.
+// BatchSort lets BatchEnd first sort the quads by (program, texture), which
+// merges more runs but is only correct when draw order does not matter, e.g.
+// for opaque sprites under depth testing or sprites that never overlap.
+//
+// Vertex layout seen by the batch program:
+//   location 0: vec2 position
+//   location 1: vec2 texcoord
+//   location 2: vec4 color (normalized RGBA8)
+// The texture is bound to unit 0. The batch's vertex array stays bound after
+// BatchEnd.
+
+#define GL_BATCH_STREAM_SIZE (4 * 1024 * 1024)
+
+typedef struct {
+	GLfloat x, y, u, v;
+	GLuint color;
+} gl_batch_vertex;
+
+typedef struct {
+	uint64_t key;
+	uint32_t seq;
+	gl_batch_vertex vertices[4];
+} gl_batch_quad;
+
+typedef struct {
+	gl_batch_quad* quads;
+	size_t count;
+	size_t capacity;
+	int active;
+	GLuint vao;
+	GLuint vbo;
+	GLuint ibo;
+	size_t index_quads;
+	gl_stream_buffer* stream;
+	gl_batch_vertex* staging;
+	int sort;
+	int64_t last_quads;
+	int64_t last_draws;
+} gl_batcher;
+
+static GLAD_THREAD_LOCAL gl_batcher batcher = {0};
+
+static int batch_quad_compare(const void* a, const void* b) {
+	const gl_batch_quad* qa = a;
+	const gl_batch_quad* qb = b;
+	if (qa->key != qb->key) {
+		return qa->key < qb->key ? -1 : 1;
+	}
+	return qa->seq < qb->seq ? -1 : qa->seq > qb->seq;
+}
+
+static void batch_create_objects(void) {
+	batcher.vao = name_pool_take(&vertex_array_pool, glGenVertexArrays, "BatchBegin");
+	batcher.ibo = name_pool_take(&buffer_pool, glGenBuffers, "BatchBegin");
+	batcher.stream = stream_buffer_create(GL_ARRAY_BUFFER, GL_BATCH_STREAM_SIZE, "BatchBegin");
+	if (batcher.stream == NULL) {
+		// No persistent mapping: orphan a plain buffer per chunk instead
+		batcher.vbo = name_pool_take(&buffer_pool, glGenBuffers, "BatchBegin");
+		batcher.staging = malloc(GL_BATCH_STREAM_SIZE);
+		if (batcher.staging == NULL) {
+			fprintf(stderr, "Fatal error in BatchBegin: Out of memory\n");
+			abort();
+		}
+	} else {
+		batcher.vbo = batcher.stream->buffer;
+		batcher.stream->recycle = 1;
+	}
+	state_bind_vertex_array(batcher.vao);
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glEnableVertexAttribArray(2);
+}
+
+// The batch objects belong to the context they were created in, so they can
+// only be deleted (release) while that context is current. The quad arena
+// is plain memory and survives.
+static void batcher_reset(int release) {
+	if (release && batcher.vao != 0) {
+		if (batcher.stream != NULL) {
+			stream_buffer_destroy(batcher.stream);
+		} else {
+			glDeleteBuffers(1, &batcher.vbo);
+			state_forget_buffers(&batcher.vbo, 1);
+		}
+		glDeleteBuffers(1, &batcher.ibo);
+		state_forget_buffers(&batcher.ibo, 1);
+		glDeleteVertexArrays(1, &batcher.vao);
+		state_forget_vertex_arrays(&batcher.vao, 1);
+	}
+	free(batcher.staging);
+	batcher.staging = NULL;
+	batcher.stream = NULL;
+	batcher.vao = 0;
+	batcher.vbo = 0;
+	batcher.ibo = 0;
+	batcher.index_quads = 0;
+}
+
+// Grows the shared quad index buffer to cover at least quads quads.
+static void batch_reserve_indices(size_t quads) {
+	if (quads <= batcher.index_quads) {
+		return;
+	}
+	size_t capacity = batcher.index_quads ? batcher.index_quads : 1024;
+	while (capacity < quads) {
+		capacity *= 2;
+	}
+	GLuint* indices = malloc(capacity * 6 * sizeof(GLuint));
+	if (indices == NULL) {
+		fprintf(stderr, "Fatal error in BatchEnd: Out of memory\n");
+		abort();
+	}
+	for (size_t q = 0; q < capacity; q++) {
+		GLuint base = (GLuint)(q * 4);
+		indices[q * 6 + 0] = base;
+		indices[q * 6 + 1] = base + 1;
+		indices[q * 6 + 2] = base + 2;
+		indices[q * 6 + 3] = base + 2;
+		indices[q * 6 + 4] = base + 3;
+		indices[q * 6 + 5] = base;
+	}
+	// The element array binding is vertex array state; the batch VAO is bound
+	state_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, batcher.ibo);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)(capacity * 6 * sizeof(GLuint)), indices,
+			GL_STATIC_DRAW);
+	free(indices);
+	batcher.index_quads = capacity;
+}
+
+// BatchSort( enabled:i64 -- )
+// Sorts the quads of each following BatchEnd by program and texture; off by
+// default
+int BatchSort(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in BatchSort: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t enabled_elem;
+	qd_stack_pop(ctx->st, &enabled_elem);
+	if (enabled_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in BatchSort: Type error\n");
+		abort();
+	}
+	batcher.sort = enabled_elem.value.i != 0;
+	return 0;
+}
+
+// BatchBegin( -- )
+// Vertices stream through a ring that EndFrame recycles; call EndFrame once
+// per frame, or BatchEnd stalls on the GPU whenever the ring fills up
+int BatchBegin(qd_context* ctx) {
+	(void)ctx;
+	if (batcher.active) {
+		fprintf(stderr, "Fatal error in BatchBegin: Batch already active\n");
+		abort();
+	}
+	if (batcher.vao == 0) {
+		batch_create_objects();
+	}
+	batcher.count = 0;
+	batcher.active = 1;
+	return 0;
+}
+
+// BatchPushQuad( program:i64 texture:i64 x0:f64 y0:f64 x1:f64 y1:f64 u0:f64 v0:f64 u1:f64 v1:f64 color:i64 -- )
+// color is packed 0xRRGGBBAA
+int BatchPushQuad(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 11) {
+		fprintf(stderr, "Fatal error in BatchPushQuad: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t color_elem, v1_elem, u1_elem, v0_elem, u0_elem, y1_elem, x1_elem, y0_elem,
+			x0_elem, texture_elem, program_elem;
+	qd_stack_pop(ctx->st, &color_elem);
+	qd_stack_pop(ctx->st, &v1_elem);
+	qd_stack_pop(ctx->st, &u1_elem);
+	qd_stack_pop(ctx->st, &v0_elem);
+	qd_stack_pop(ctx->st, &u0_elem);
+	qd_stack_pop(ctx->st, &y1_elem);
+	qd_stack_pop(ctx->st, &x1_elem);
+	qd_stack_pop(ctx->st, &y0_elem);
+	qd_stack_pop(ctx->st, &x0_elem);
+	qd_stack_pop(ctx->st, &texture_elem);
+	qd_stack_pop(ctx->st, &program_elem);
+	if (program_elem.type != QD_STACK_TYPE_INT || texture_elem.type != QD_STACK_TYPE_INT ||
+			x0_elem.type != QD_STACK_TYPE_FLOAT || y0_elem.type != QD_STACK_TYPE_FLOAT ||
+			x1_elem.type != QD_STACK_TYPE_FLOAT || y1_elem.type != QD_STACK_TYPE_FLOAT ||
+			u0_elem.type != QD_STACK_TYPE_FLOAT || v0_elem.type != QD_STACK_TYPE_FLOAT ||
+			u1_elem.type != QD_STACK_TYPE_FLOAT || v1_elem.type != QD_STACK_TYPE_FLOAT ||
+			color_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in BatchPushQuad: Type error\n");
+		abort();
+	}
+	if (!batcher.active) {
+		fprintf(stderr, "Fatal error in BatchPushQuad: No active batch\n");
+		abort();
+	}
+	if (batcher.count == batcher.capacity) {
+		size_t capacity = batcher.capacity ? batcher.capacity * 2 : 1024;
+		gl_batch_quad* quads = realloc(batcher.quads, capacity * sizeof(gl_batch_quad));
+		if (quads == NULL) {
+			fprintf(stderr, "Fatal error in BatchPushQuad: Out of memory\n");
+			abort();
+		}
+		batcher.quads = quads;
+		batcher.capacity = capacity;
+	}
+	gl_batch_quad* quad = &batcher.quads[batcher.count];
+	quad->key = ((uint64_t)(GLuint)program_elem.value.i << 32) | (GLuint)texture_elem.value.i;
+	quad->seq = (uint32_t)batcher.count++;
+	GLfloat x0 = (GLfloat)x0_elem.value.f, y0 = (GLfloat)y0_elem.value.f;
+	GLfloat x1 = (GLfloat)x1_elem.value.f, y1 = (GLfloat)y1_elem.value.f;
+	GLfloat u0 = (GLfloat)u0_elem.value.f, v0 = (GLfloat)v0_elem.value.f;
+	GLfloat u1 = (GLfloat)u1_elem.value.f, v1 = (GLfloat)v1_elem.value.f;
+	uint32_t rgba = (uint32_t)color_elem.value.i;
+	// Store as R, G, B, A bytes in memory regardless of host endianness
+	unsigned char bytes[4] = {(unsigned char)(rgba >> 24), (unsigned char)(rgba >> 16),
+			(unsigned char)(rgba >> 8), (unsigned char)rgba};
+	GLuint color;
+	memcpy(&color, bytes, sizeof(color));
+	quad->vertices[0] = (gl_batch_vertex){x0, y0, u0, v0, color};
+	quad->vertices[1] = (gl_batch_vertex){x1, y0, u1, v0, color};
+	quad->vertices[2] = (gl_batch_vertex){x1, y1, u1, v1, color};
+	quad->vertices[3] = (gl_batch_vertex){x0, y1, u0, v1, color};
+	return 0;
+}
+
+// BatchEnd( -- )
+// Draws the batch; see BatchBegin for the EndFrame requirement
+int BatchEnd(qd_context* ctx) {
+	(void)ctx;
+	if (!batcher.active) {
+		fprintf(stderr, "Fatal error in BatchEnd: No active batch\n");
+		abort();
+	}
+	batcher.active = 0;
+	batcher.last_quads = (int64_t)batcher.count;
+	batcher.last_draws = 0;
+	if (batcher.count == 0) {
+		return 0;
+	}
+	if (batcher.sort) {
+		qsort(batcher.quads, batcher.count, sizeof(gl_batch_quad), batch_quad_compare);
+	}
+
+	const size_t quad_bytes = 4 * sizeof(gl_batch_vertex);
+	const size_t chunk_quads = GL_BATCH_STREAM_SIZE / quad_bytes;
+	state_bind_vertex_array(batcher.vao);
+	batch_reserve_indices(batcher.count < chunk_quads ? batcher.count : chunk_quads);
+	state_active_texture(GL_TEXTURE0);
+
+	for (size_t first = 0; first < batcher.count; first += chunk_quads) {
+		size_t n = batcher.count - first < chunk_quads ? batcher.count - first : chunk_quads;
+		size_t offset = 0;
+		gl_batch_vertex* dst;
+		if (batcher.stream != NULL) {
+			void* data;
+			offset = stream_buffer_alloc(batcher.stream, n * quad_bytes, 16, &data, "BatchEnd");
+			dst = data;
+		} else {
+			dst = batcher.staging;
+		}
+		for (size_t q = 0; q < n; q++) {
+			memcpy(dst + q * 4, batcher.quads[first + q].vertices, quad_bytes);
+		}
+		state_bind_buffer(GL_ARRAY_BUFFER, batcher.vbo);
+		if (batcher.stream == NULL) {
+			glBufferData(GL_ARRAY_BUFFER, GL_BATCH_STREAM_SIZE, NULL, GL_STREAM_DRAW);
+			glBufferSubData(GL_ARRAY_BUFFER, 0, (GLsizeiptr)(n * quad_bytes), batcher.staging);
+		}
+		const GLsizei stride = sizeof(gl_batch_vertex);
+		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, (const void*)(uintptr_t)offset);
+		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride,
+				(const void*)(uintptr_t)(offset + offsetof(gl_batch_vertex, u)));
+		glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride,
+				(const void*)(uintptr_t)(offset + offsetof(gl_batch_vertex, color)));
+
+		size_t run = 0;
+		while (run < n) {
+			uint64_t key = batcher.quads[first + run].key;
+			size_t end = run + 1;
+			while (end < n && batcher.quads[first + end].key == key) {
+				end++;
+			}
+			state_use_program((GLuint)(key >> 32));
+			state_bind_texture(GL_TEXTURE_2D, (GLuint)key);
+			glDrawElements(GL_TRIANGLES, (GLsizei)((end - run) * 6), GL_UNSIGNED_INT,
+					(const void*)(uintptr_t)(run * 6 * sizeof(GLuint)));
+			batcher.last_draws++;
+			run = end;
+		}
+	}
+	return 0;
+}
+
+// BatchStats( -- quads:i64 draws:i64 )
+// Reports the quads and draw calls of the last BatchEnd
+int BatchStats(qd_context* ctx) {
+	qd_push_i(ctx, batcher.last_quads);
+	qd_push_i(ctx, batcher.last_draws);
+	return 0;
+}
+
+// ============================================================================
+// Command Buffers
+// ============================================================================
+//
+// A command buffer records bind/state/uniform/draw commands into native
+// memory so a whole pass can be replayed with a single FFI call. Buffers are
+// not consumed by CmdBufferSubmit; a static pass can be recorded once and
+// submitted every frame.
+
+enum {
+	GL_CMD_ENABLE,
+	GL_CMD_DISABLE,
+	GL_CMD_CLEAR_COLOR,
+	GL_CMD_CLEAR,
+	GL_CMD_VIEWPORT,
+	GL_CMD_BIND_BUFFER,
+	GL_CMD_BIND_VERTEX_ARRAY,
+	GL_CMD_USE_PROGRAM,
+	GL_CMD_UNIFORM1F,
+	GL_CMD_UNIFORM1I,
+	GL_CMD_UNIFORM3F,
+	GL_CMD_UNIFORM4F,
+	GL_CMD_DRAW_ARRAYS,
+	GL_CMD_DRAW_ELEMENTS,
+	GL_CMD_BIND_TEXTURE,
+	GL_CMD_ACTIVE_TEXTURE,
+	GL_CMD_DRAW_ARRAYS_INSTANCED,
+};
+
+typedef struct {
+	uint32_t op;
+	int64_t i[4];
+	GLfloat f[4];
+} gl_cmd;
+
+typedef struct {
+	gl_cmd* cmds;
+	size_t count;
+	size_t capacity;
+} gl_cmd_buffer;
+
+static gl_cmd* cmd_buffer_append(gl_cmd_buffer* cb, uint32_t op, const char* fn) {
+	if (cb == NULL) {
+		fprintf(stderr, "Fatal error in %s: Null command buffer\n", fn);
+		abort();
+	}
+	if (cb->count == cb->capacity) {
+		size_t capacity = cb->capacity ? cb->capacity * 2 : 64;
+		gl_cmd* cmds = realloc(cb->cmds, capacity * sizeof(gl_cmd));
+		if (cmds == NULL) {
+			fprintf(stderr, "Fatal error in %s: Out of memory\n", fn);
+			abort();
+		}
+		cb->cmds = cmds;
+		cb->capacity = capacity;
+	}
+	gl_cmd* cmd = &cb->cmds[cb->count++];
+	memset(cmd, 0, sizeof(*cmd));
+	cmd->op = op;
+	return cmd;
+}
+
+// CmdBufferCreate( -- cb:ptr )
+int CmdBufferCreate(qd_context* ctx) {
+	gl_cmd_buffer* cb = calloc(1, sizeof(gl_cmd_buffer));
+	if (cb == NULL) {
+		fprintf(stderr, "Fatal error in CmdBufferCreate: Out of memory\n");
+		abort();
+	}
+	qd_push_p(ctx, cb);
+	return 0;
+}
+
+// CmdBufferDestroy( cb:ptr -- )
+int CmdBufferDestroy(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in CmdBufferDestroy: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t cb_elem;
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR) {
+		fprintf(stderr, "Fatal error in CmdBufferDestroy: Type error\n");
+		abort();
+	}
+	gl_cmd_buffer* cb = cb_elem.value.p;
+	if (cb != NULL) {
+		free(cb->cmds);
+		free(cb);
+	}
+	return 0;
+}
+
+// CmdBufferReset( cb:ptr -- )
+int CmdBufferReset(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in CmdBufferReset: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t cb_elem;
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || cb_elem.value.p == NULL) {
+		fprintf(stderr, "Fatal error in CmdBufferReset: Type error\n");
+		abort();
+	}
+	((gl_cmd_buffer*)cb_elem.value.p)->count = 0;
+	return 0;
+}
+
+// CmdBufferCount( cb:ptr -- count:i64 )
+int CmdBufferCount(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in CmdBufferCount: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t cb_elem;
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || cb_elem.value.p == NULL) {
+		fprintf(stderr, "Fatal error in CmdBufferCount: Type error\n");
+		abort();
+	}
+	qd_push_i(ctx, (int64_t)((gl_cmd_buffer*)cb_elem.value.p)->count);
+	return 0;
+}
+
+// Replays a command buffer on the calling thread's context
+// Set on render farm workers, which run jobs on their own copy of each program
+static GLAD_THREAD_LOCAL struct gl_program_instances* program_instances = NULL;
+static GLuint program_instance(struct gl_program_instances* instances, GLuint program);
+
+static void cmd_buffer_run(const gl_cmd_buffer* cb) {
+	const gl_cmd* cmd = cb->cmds;
+	const gl_cmd* end = cb->cmds + cb->count;
+	for (; cmd != end; cmd++) {
+		switch (cmd->op) {
+		case GL_CMD_ENABLE:
+			state_set_cap((GLenum)cmd->i[0], 1);
+			break;
+		case GL_CMD_DISABLE:
+			state_set_cap((GLenum)cmd->i[0], 0);
+			break;
+		case GL_CMD_CLEAR_COLOR:
+			glClearColor(cmd->f[0], cmd->f[1], cmd->f[2], cmd->f[3]);
+			break;
+		case GL_CMD_CLEAR:
+			glClear((GLbitfield)cmd->i[0]);
+			break;
+		case GL_CMD_VIEWPORT:
+			glViewport((GLint)cmd->i[0], (GLint)cmd->i[1], (GLsizei)cmd->i[2], (GLsizei)cmd->i[3]);
+			break;
+		case GL_CMD_BIND_BUFFER:
+			state_bind_buffer((GLenum)cmd->i[0], (GLuint)cmd->i[1]);
+			break;
+		case GL_CMD_BIND_VERTEX_ARRAY:
+			// Vertex arrays are not shared with render farm workers
+			if (program_instances != NULL) {
+				fprintf(stderr, "Fatal error in RenderFarm: Render jobs cannot bind vertex arrays\n");
+				abort();
+			}
+			state_bind_vertex_array((GLuint)cmd->i[0]);
+			break;
+		case GL_CMD_USE_PROGRAM:
+			if (program_instances != NULL) {
+				state_use_program(program_instance(program_instances, (GLuint)cmd->i[0]));
+			} else {
+				state_use_program((GLuint)cmd->i[0]);
+			}
+			break;
+		case GL_CMD_UNIFORM1F:
+			glUniform1f((GLint)cmd->i[0], cmd->f[0]);
+			break;
+		case GL_CMD_UNIFORM1I:
+			glUniform1i((GLint)cmd->i[0], (GLint)cmd->i[1]);
+			break;
+		case GL_CMD_UNIFORM3F:
+			glUniform3f((GLint)cmd->i[0], cmd->f[0], cmd->f[1], cmd->f[2]);
+			break;
+		case GL_CMD_UNIFORM4F:
+			glUniform4f((GLint)cmd->i[0], cmd->f[0], cmd->f[1], cmd->f[2], cmd->f[3]);
+			break;
+		case GL_CMD_DRAW_ARRAYS:
+			glDrawArrays((GLenum)cmd->i[0], (GLint)cmd->i[1], (GLsizei)cmd->i[2]);
+			break;
+		case GL_CMD_DRAW_ELEMENTS:
+			glDrawElements((GLenum)cmd->i[0], (GLsizei)cmd->i[1], (GLenum)cmd->i[2],
+					(const void*)(intptr_t)cmd->i[3]);
+			break;
+		case GL_CMD_BIND_TEXTURE:
+			state_bind_texture((GLenum)cmd->i[0], (GLuint)cmd->i[1]);
+			break;
+		case GL_CMD_ACTIVE_TEXTURE:
+			state_active_texture((GLenum)cmd->i[0]);
+			break;
+		case GL_CMD_DRAW_ARRAYS_INSTANCED:
+			glDrawArraysInstanced((GLenum)cmd->i[0], (GLint)cmd->i[1], (GLsizei)cmd->i[2],
+					(GLsizei)cmd->i[3]);
+			break;
+		}
+	}
+}
+
+// CmdBufferSubmit( cb:ptr -- )
+int CmdBufferSubmit(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in CmdBufferSubmit: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t cb_elem;
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || cb_elem.value.p == NULL) {
+		fprintf(stderr, "Fatal error in CmdBufferSubmit: Type error\n");
+		abort();
+	}
+	cmd_buffer_run(cb_elem.value.p);
+	return 0;
+}
+
+// CmdEnable( cb:ptr cap:i64 -- )
+int CmdEnable(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in Enable: Stack underflow\n");
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in CmdEnable: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t cap_elem;
+	qd_stack_element_t cap_elem, cb_elem;
 	qd_stack_pop(ctx->st, &cap_elem);
-	if (cap_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in Enable: Type error\n");
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || cap_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in CmdEnable: Type error\n");
 		abort();
 	}
-	glEnable((GLenum)cap_elem.value.i);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_ENABLE, "CmdEnable");
+	cmd->i[0] = cap_elem.value.i;
 	return 0;
 }
 
-// Disable( cap:i64 -- )
-int Disable(qd_context* ctx) {
+// CmdDisable( cb:ptr cap:i64 -- )
+int CmdDisable(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in Disable: Stack underflow\n");
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in CmdDisable: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t cap_elem;
+	qd_stack_element_t cap_elem, cb_elem;
 	qd_stack_pop(ctx->st, &cap_elem);
-	if (cap_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in Disable: Type error\n");
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || cap_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in CmdDisable: Type error\n");
 		abort();
 	}
-	glDisable((GLenum)cap_elem.value.i);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_DISABLE, "CmdDisable");
+	cmd->i[0] = cap_elem.value.i;
 	return 0;
 }
 
-// ClearColor( r:f64 g:f64 b:f64 a:f64 -- )
-int ClearColor(qd_context* ctx) {
+// CmdClearColor( cb:ptr r:f64 g:f64 b:f64 a:f64 -- )
+int CmdClearColor(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 4) {
-		fprintf(stderr, "Fatal error in ClearColor: Stack underflow\n");
+	if (stack_size < 5) {
+		fprintf(stderr, "Fatal error in CmdClearColor: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t a_elem, b_elem, g_elem, r_elem;
+	qd_stack_element_t a_elem, b_elem, g_elem, r_elem, cb_elem;
 	qd_stack_pop(ctx->st, &a_elem);
 	qd_stack_pop(ctx->st, &b_elem);
 	qd_stack_pop(ctx->st, &g_elem);
 	qd_stack_pop(ctx->st, &r_elem);
-	if (r_elem.type != QD_STACK_TYPE_FLOAT || g_elem.type != QD_STACK_TYPE_FLOAT ||
-			b_elem.type != QD_STACK_TYPE_FLOAT || a_elem.type != QD_STACK_TYPE_FLOAT) {
-		fprintf(stderr, "Fatal error in ClearColor: Type error\n");
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || r_elem.type != QD_STACK_TYPE_FLOAT ||
+			g_elem.type != QD_STACK_TYPE_FLOAT || b_elem.type != QD_STACK_TYPE_FLOAT ||
+			a_elem.type != QD_STACK_TYPE_FLOAT) {
+		fprintf(stderr, "Fatal error in CmdClearColor: Type error\n");
 		abort();
 	}
-	glClearColor((GLfloat)r_elem.value.f, (GLfloat)g_elem.value.f, (GLfloat)b_elem.value.f,
-			(GLfloat)a_elem.value.f);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_CLEAR_COLOR, "CmdClearColor");
+	cmd->f[0] = (GLfloat)r_elem.value.f;
+	cmd->f[1] = (GLfloat)g_elem.value.f;
+	cmd->f[2] = (GLfloat)b_elem.value.f;
+	cmd->f[3] = (GLfloat)a_elem.value.f;
 	return 0;
 }
 
-// Clear( mask:i64 -- )
-int Clear(qd_context* ctx) {
+// CmdClear( cb:ptr mask:i64 -- )
+int CmdClear(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in Clear: Stack underflow\n");
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in CmdClear: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t mask_elem;
+	qd_stack_element_t mask_elem, cb_elem;
 	qd_stack_pop(ctx->st, &mask_elem);
-	if (mask_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in Clear: Type error\n");
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || mask_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in CmdClear: Type error\n");
 		abort();
 	}
-	glClear((GLbitfield)mask_elem.value.i);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_CLEAR, "CmdClear");
+	cmd->i[0] = mask_elem.value.i;
 	return 0;
 }
 
-// Viewport( x:i64 y:i64 width:i64 height:i64 -- )
-int Viewport(qd_context* ctx) {
+// CmdViewport( cb:ptr x:i64 y:i64 width:i64 height:i64 -- )
+int CmdViewport(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 4) {
-		fprintf(stderr, "Fatal error in Viewport: Stack underflow\n");
+	if (stack_size < 5) {
+		fprintf(stderr, "Fatal error in CmdViewport: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t height_elem, width_elem, y_elem, x_elem;
+	qd_stack_element_t height_elem, width_elem, y_elem, x_elem, cb_elem;
 	qd_stack_pop(ctx->st, &height_elem);
 	qd_stack_pop(ctx->st, &width_elem);
 	qd_stack_pop(ctx->st, &y_elem);
 	qd_stack_pop(ctx->st, &x_elem);
-	if (x_elem.type != QD_STACK_TYPE_INT || y_elem.type != QD_STACK_TYPE_INT ||
-			width_elem.type != QD_STACK_TYPE_INT || height_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in Viewport: Type error\n");
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || x_elem.type != QD_STACK_TYPE_INT ||
+			y_elem.type != QD_STACK_TYPE_INT || width_elem.type != QD_STACK_TYPE_INT ||
+			height_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in CmdViewport: Type error\n");
 		abort();
 	}
-	glViewport((GLint)x_elem.value.i, (GLint)y_elem.value.i, (GLsizei)width_elem.value.i,
-			(GLsizei)height_elem.value.i);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_VIEWPORT, "CmdViewport");
+	cmd->i[0] = x_elem.value.i;
+	cmd->i[1] = y_elem.value.i;
+	cmd->i[2] = width_elem.value.i;
+	cmd->i[3] = height_elem.value.i;
 	return 0;
 }
 
-// ============================================================================
-// Buffer Objects
-// ============================================================================
-
-// GenBuffer( -- buffer:i64 )
-int GenBuffer(qd_context* ctx) {
-	GLuint buffer;
-	glGenBuffers(1, &buffer);
-	qd_push_i(ctx, (int64_t)buffer);
+// CmdBindBuffer( cb:ptr target:i64 buffer:i64 -- )
+int CmdBindBuffer(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 3) {
+		fprintf(stderr, "Fatal error in CmdBindBuffer: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t buffer_elem, target_elem, cb_elem;
+	qd_stack_pop(ctx->st, &buffer_elem);
+	qd_stack_pop(ctx->st, &target_elem);
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || target_elem.type != QD_STACK_TYPE_INT ||
+			buffer_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in CmdBindBuffer: Type error\n");
+		abort();
+	}
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_BIND_BUFFER, "CmdBindBuffer");
+	cmd->i[0] = target_elem.value.i;
+	cmd->i[1] = buffer_elem.value.i;
 	return 0;
 }
 
-// DeleteBuffer( buffer:i64 -- )
-int DeleteBuffer(qd_context* ctx) {
+// CmdBindVertexArray( cb:ptr vao:i64 -- )
+int CmdBindVertexArray(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in DeleteBuffer: Stack underflow\n");
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in CmdBindVertexArray: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t buffer_elem;
-	qd_stack_pop(ctx->st, &buffer_elem);
-	if (buffer_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in DeleteBuffer: Type error\n");
+	qd_stack_element_t vao_elem, cb_elem;
+	qd_stack_pop(ctx->st, &vao_elem);
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || vao_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in CmdBindVertexArray: Type error\n");
 		abort();
 	}
-	GLuint buffer = (GLuint)buffer_elem.value.i;
-	glDeleteBuffers(1, &buffer);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_BIND_VERTEX_ARRAY, "CmdBindVertexArray");
+	cmd->i[0] = vao_elem.value.i;
 	return 0;
 }
 
-// BindBuffer( target:i64 buffer:i64 -- )
-int BindBuffer(qd_context* ctx) {
+// CmdUseProgram( cb:ptr program:i64 -- )
+int CmdUseProgram(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
 	if (stack_size < 2) {
-		fprintf(stderr, "Fatal error in BindBuffer: Stack underflow\n");
+		fprintf(stderr, "Fatal error in CmdUseProgram: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t buffer_elem, target_elem;
-	qd_stack_pop(ctx->st, &buffer_elem);
-	qd_stack_pop(ctx->st, &target_elem);
-	if (target_elem.type != QD_STACK_TYPE_INT || buffer_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in BindBuffer: Type error\n");
+	qd_stack_element_t program_elem, cb_elem;
+	qd_stack_pop(ctx->st, &program_elem);
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || program_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in CmdUseProgram: Type error\n");
 		abort();
 	}
-	glBindBuffer((GLenum)target_elem.value.i, (GLuint)buffer_elem.value.i);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_USE_PROGRAM, "CmdUseProgram");
+	cmd->i[0] = program_elem.value.i;
 	return 0;
 }
 
-// BufferDataFloats( target:i64 data:ptr count:i64 usage:i64 -- )
-int BufferDataFloats(qd_context* ctx) {
+// CmdUniform1f( cb:ptr location:i64 v0:f64 -- )
+int CmdUniform1f(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 4) {
-		fprintf(stderr, "Fatal error in BufferDataFloats: Stack underflow\n");
+	if (stack_size < 3) {
+		fprintf(stderr, "Fatal error in CmdUniform1f: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t usage_elem, count_elem, data_elem, target_elem;
-	qd_stack_pop(ctx->st, &usage_elem);
-	qd_stack_pop(ctx->st, &count_elem);
-	qd_stack_pop(ctx->st, &data_elem);
-	qd_stack_pop(ctx->st, &target_elem);
-	if (target_elem.type != QD_STACK_TYPE_INT || data_elem.type != QD_STACK_TYPE_PTR ||
-			count_elem.type != QD_STACK_TYPE_INT || usage_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in BufferDataFloats: Type error\n");
+	qd_stack_element_t v0_elem, location_elem, cb_elem;
+	qd_stack_pop(ctx->st, &v0_elem);
+	qd_stack_pop(ctx->st, &location_elem);
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || location_elem.type != QD_STACK_TYPE_INT ||
+			v0_elem.type != QD_STACK_TYPE_FLOAT) {
+		fprintf(stderr, "Fatal error in CmdUniform1f: Type error\n");
 		abort();
 	}
-	glBufferData((GLenum)target_elem.value.i, (GLsizeiptr)(count_elem.value.i * sizeof(float)),
-			data_elem.value.p, (GLenum)usage_elem.value.i);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_UNIFORM1F, "CmdUniform1f");
+	cmd->i[0] = location_elem.value.i;
+	cmd->f[0] = (GLfloat)v0_elem.value.f;
 	return 0;
 }
 
-// ============================================================================
-// Vertex Arrays
-// ============================================================================
-
-// GenVertexArray( -- vao:i64 )
-int GenVertexArray(qd_context* ctx) {
-	GLuint vao;
-	glGenVertexArrays(1, &vao);
-	qd_push_i(ctx, (int64_t)vao);
+// CmdUniform1i( cb:ptr location:i64 v0:i64 -- )
+int CmdUniform1i(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 3) {
+		fprintf(stderr, "Fatal error in CmdUniform1i: Stack underflow\n");
+		abort();
+	}
+	qd_stack_element_t v0_elem, location_elem, cb_elem;
+	qd_stack_pop(ctx->st, &v0_elem);
+	qd_stack_pop(ctx->st, &location_elem);
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || location_elem.type != QD_STACK_TYPE_INT ||
+			v0_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in CmdUniform1i: Type error\n");
+		abort();
+	}
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_UNIFORM1I, "CmdUniform1i");
+	cmd->i[0] = location_elem.value.i;
+	cmd->i[1] = v0_elem.value.i;
 	return 0;
 }
 
-// DeleteVertexArray( vao:i64 -- )
-int DeleteVertexArray(qd_context* ctx) {
+// CmdUniform3f( cb:ptr location:i64 v0:f64 v1:f64 v2:f64 -- )
+int CmdUniform3f(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in DeleteVertexArray: Stack underflow\n");
+	if (stack_size < 5) {
+		fprintf(stderr, "Fatal error in CmdUniform3f: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t vao_elem;
-	qd_stack_pop(ctx->st, &vao_elem);
-	if (vao_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in DeleteVertexArray: Type error\n");
+	qd_stack_element_t v2_elem, v1_elem, v0_elem, location_elem, cb_elem;
+	qd_stack_pop(ctx->st, &v2_elem);
+	qd_stack_pop(ctx->st, &v1_elem);
+	qd_stack_pop(ctx->st, &v0_elem);
+	qd_stack_pop(ctx->st, &location_elem);
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || location_elem.type != QD_STACK_TYPE_INT ||
+			v0_elem.type != QD_STACK_TYPE_FLOAT || v1_elem.type != QD_STACK_TYPE_FLOAT ||
+			v2_elem.type != QD_STACK_TYPE_FLOAT) {
+		fprintf(stderr, "Fatal error in CmdUniform3f: Type error\n");
 		abort();
 	}
-	GLuint vao = (GLuint)vao_elem.value.i;
-	glDeleteVertexArrays(1, &vao);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_UNIFORM3F, "CmdUniform3f");
+	cmd->i[0] = location_elem.value.i;
+	cmd->f[0] = (GLfloat)v0_elem.value.f;
+	cmd->f[1] = (GLfloat)v1_elem.value.f;
+	cmd->f[2] = (GLfloat)v2_elem.value.f;
 	return 0;
 }
 
-// BindVertexArray( vao:i64 -- )
-int BindVertexArray(qd_context* ctx) {
+// CmdUniform4f( cb:ptr location:i64 v0:f64 v1:f64 v2:f64 v3:f64 -- )
+int CmdUniform4f(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in BindVertexArray: Stack underflow\n");
+	if (stack_size < 6) {
+		fprintf(stderr, "Fatal error in CmdUniform4f: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t vao_elem;
-	qd_stack_pop(ctx->st, &vao_elem);
-	if (vao_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in BindVertexArray: Type error\n");
+	qd_stack_element_t v3_elem, v2_elem, v1_elem, v0_elem, location_elem, cb_elem;
+	qd_stack_pop(ctx->st, &v3_elem);
+	qd_stack_pop(ctx->st, &v2_elem);
+	qd_stack_pop(ctx->st, &v1_elem);
+	qd_stack_pop(ctx->st, &v0_elem);
+	qd_stack_pop(ctx->st, &location_elem);
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || location_elem.type != QD_STACK_TYPE_INT ||
+			v0_elem.type != QD_STACK_TYPE_FLOAT || v1_elem.type != QD_STACK_TYPE_FLOAT ||
+			v2_elem.type != QD_STACK_TYPE_FLOAT || v3_elem.type != QD_STACK_TYPE_FLOAT) {
+		fprintf(stderr, "Fatal error in CmdUniform4f: Type error\n");
 		abort();
 	}
-	glBindVertexArray((GLuint)vao_elem.value.i);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_UNIFORM4F, "CmdUniform4f");
+	cmd->i[0] = location_elem.value.i;
+	cmd->f[0] = (GLfloat)v0_elem.value.f;
+	cmd->f[1] = (GLfloat)v1_elem.value.f;
+	cmd->f[2] = (GLfloat)v2_elem.value.f;
+	cmd->f[3] = (GLfloat)v3_elem.value.f;
 	return 0;
 }
 
-// EnableVertexAttribArray( index:i64 -- )
-int EnableVertexAttribArray(qd_context* ctx) {
+// CmdDrawArrays( cb:ptr mode:i64 first:i64 count:i64 -- )
+int CmdDrawArrays(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in EnableVertexAttribArray: Stack underflow\n");
+	if (stack_size < 4) {
+		fprintf(stderr, "Fatal error in CmdDrawArrays: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t index_elem;
-	qd_stack_pop(ctx->st, &index_elem);
-	if (index_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in EnableVertexAttribArray: Type error\n");
+	qd_stack_element_t count_elem, first_elem, mode_elem, cb_elem;
+	qd_stack_pop(ctx->st, &count_elem);
+	qd_stack_pop(ctx->st, &first_elem);
+	qd_stack_pop(ctx->st, &mode_elem);
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || mode_elem.type != QD_STACK_TYPE_INT ||
+			first_elem.type != QD_STACK_TYPE_INT || count_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in CmdDrawArrays: Type error\n");
 		abort();
 	}
-	glEnableVertexAttribArray((GLuint)index_elem.value.i);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_DRAW_ARRAYS, "CmdDrawArrays");
+	cmd->i[0] = mode_elem.value.i;
+	cmd->i[1] = first_elem.value.i;
+	cmd->i[2] = count_elem.value.i;
 	return 0;
 }
 
-// VertexAttribPointer( index:i64 size:i64 type:i64 normalized:i64 stride:i64 offset:i64 -- )
-int VertexAttribPointer(qd_context* ctx) {
+// CmdDrawElements( cb:ptr mode:i64 count:i64 type:i64 offset:i64 -- )
+int CmdDrawElements(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 6) {
-		fprintf(stderr, "Fatal error in VertexAttribPointer: Stack underflow\n");
+	if (stack_size < 5) {
+		fprintf(stderr, "Fatal error in CmdDrawElements: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t offset_elem, stride_elem, normalized_elem, type_elem, size_elem, index_elem;
+	qd_stack_element_t offset_elem, type_elem, count_elem, mode_elem, cb_elem;
 	qd_stack_pop(ctx->st, &offset_elem);
-	qd_stack_pop(ctx->st, &stride_elem);
-	qd_stack_pop(ctx->st, &normalized_elem);
 	qd_stack_pop(ctx->st, &type_elem);
-	qd_stack_pop(ctx->st, &size_elem);
-	qd_stack_pop(ctx->st, &index_elem);
-	if (index_elem.type != QD_STACK_TYPE_INT || size_elem.type != QD_STACK_TYPE_INT ||
-			type_elem.type != QD_STACK_TYPE_INT || normalized_elem.type != QD_STACK_TYPE_INT ||
-			stride_elem.type != QD_STACK_TYPE_INT || offset_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in VertexAttribPointer: Type error\n");
+	qd_stack_pop(ctx->st, &count_elem);
+	qd_stack_pop(ctx->st, &mode_elem);
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || mode_elem.type != QD_STACK_TYPE_INT ||
+			count_elem.type != QD_STACK_TYPE_INT || type_elem.type != QD_STACK_TYPE_INT ||
+			offset_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in CmdDrawElements: Type error\n");
 		abort();
 	}
-	glVertexAttribPointer((GLuint)index_elem.value.i, (GLint)size_elem.value.i,
-			(GLenum)type_elem.value.i, (GLboolean)normalized_elem.value.i, (GLsizei)stride_elem.value.i,
-			(const void*)(intptr_t)offset_elem.value.i);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_DRAW_ELEMENTS, "CmdDrawElements");
+	cmd->i[0] = mode_elem.value.i;
+	cmd->i[1] = count_elem.value.i;
+	cmd->i[2] = type_elem.value.i;
+	cmd->i[3] = offset_elem.value.i;
 	return 0;
 }
 
-// ============================================================================
-// Shaders
-// ============================================================================
-
-// CreateShader( type:i64 -- shader:i64 )
-int CreateShader(qd_context* ctx) {
+// CmdBindTexture( cb:ptr target:i64 texture:i64 -- )
+int CmdBindTexture(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in CreateShader: Stack underflow\n");
+	if (stack_size < 3) {
+		fprintf(stderr, "Fatal error in CmdBindTexture: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t type_elem;
-	qd_stack_pop(ctx->st, &type_elem);
-	if (type_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in CreateShader: Type error\n");
+	qd_stack_element_t texture_elem, target_elem, cb_elem;
+	qd_stack_pop(ctx->st, &texture_elem);
+	qd_stack_pop(ctx->st, &target_elem);
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || target_elem.type != QD_STACK_TYPE_INT ||
+			texture_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in CmdBindTexture: Type error\n");
 		abort();
 	}
-	GLuint shader = glCreateShader((GLenum)type_elem.value.i);
-	qd_push_i(ctx, (int64_t)shader);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_BIND_TEXTURE, "CmdBindTexture");
+	cmd->i[0] = target_elem.value.i;
+	cmd->i[1] = texture_elem.value.i;
 	return 0;
 }
 
-// DeleteShader( shader:i64 -- )
-int DeleteShader(qd_context* ctx) {
+// CmdActiveTexture( cb:ptr texture:i64 -- )
+int CmdActiveTexture(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in DeleteShader: Stack underflow\n");
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in CmdActiveTexture: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t shader_elem;
-	qd_stack_pop(ctx->st, &shader_elem);
-	if (shader_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in DeleteShader: Type error\n");
+	qd_stack_element_t texture_elem, cb_elem;
+	qd_stack_pop(ctx->st, &texture_elem);
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || texture_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in CmdActiveTexture: Type error\n");
 		abort();
 	}
-	glDeleteShader((GLuint)shader_elem.value.i);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_ACTIVE_TEXTURE, "CmdActiveTexture");
+	cmd->i[0] = texture_elem.value.i;
 	return 0;
 }
 
-// ShaderSource( shader:i64 source:str -- )
-int ShaderSource(qd_context* ctx) {
+// CmdDrawArraysInstanced( cb:ptr mode:i64 first:i64 count:i64 instances:i64 -- )
+int CmdDrawArraysInstanced(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 2) {
-		fprintf(stderr, "Fatal error in ShaderSource: Stack underflow\n");
+	if (stack_size < 5) {
+		fprintf(stderr, "Fatal error in CmdDrawArraysInstanced: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t source_elem, shader_elem;
-	qd_stack_pop(ctx->st, &source_elem);
-	qd_stack_pop(ctx->st, &shader_elem);
-	if (shader_elem.type != QD_STACK_TYPE_INT || source_elem.type != QD_STACK_TYPE_STR) {
-		fprintf(stderr, "Fatal error in ShaderSource: Type error\n");
+	qd_stack_element_t instances_elem, count_elem, first_elem, mode_elem, cb_elem;
+	qd_stack_pop(ctx->st, &instances_elem);
+	qd_stack_pop(ctx->st, &count_elem);
+	qd_stack_pop(ctx->st, &first_elem);
+	qd_stack_pop(ctx->st, &mode_elem);
+	qd_stack_pop(ctx->st, &cb_elem);
+	if (cb_elem.type != QD_STACK_TYPE_PTR || mode_elem.type != QD_STACK_TYPE_INT ||
+			first_elem.type != QD_STACK_TYPE_INT || count_elem.type != QD_STACK_TYPE_INT ||
+			instances_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in CmdDrawArraysInstanced: Type error\n");
 		abort();
 	}
-	const char* source = qd_string_data(source_elem.value.s);
-	glShaderSource((GLuint)shader_elem.value.i, 1, &source, NULL);
-	qd_string_release(source_elem.value.s);
+	gl_cmd* cmd = cmd_buffer_append(cb_elem.value.p, GL_CMD_DRAW_ARRAYS_INSTANCED,
+			"CmdDrawArraysInstanced");
+	cmd->i[0] = mode_elem.value.i;
+	cmd->i[1] = first_elem.value.i;
+	cmd->i[2] = count_elem.value.i;
+	cmd->i[3] = instances_elem.value.i;
 	return 0;
 }
 
-// CompileShader( shader:i64 -- )
-int CompileShader(qd_context* ctx) {
+// ============================================================================
+// Contexts
+// ============================================================================
+//
+// Every thread dispatches through the default table until it selects
+// another. LoadGLContext gives each GL context its own table, and
+// MakeContextCurrent selects one for the calling thread after the window
+// system made the matching GL context current there. The wrappers then
+// dispatch through that thread's table, so threads can drive contexts on
+// different drivers at the same time. LoadGL (re)loads whichever table the
+// calling thread has selected, which is the default table only until
+// MakeContextCurrent picks another.
+//
+// The caches tied to a context (name pools, state shadow, uniform locations,
+// stream buffers, deferred deletes, shared shaders, pending builds, uniform
+// blocks and the sprite batcher) are thread-local and are saved into and
+// restored from the context on every switch. DestroyGLContext deletes the
+// objects they hold when their GL context is still current. Interned names,
+// the shader file table and defines, and the program cache settings and
+// statistics are shared by all threads behind locks or atomics.
+
+typedef struct {
+	gl_name_pool buffer_pool;
+	gl_name_pool texture_pool;
+	gl_name_pool vertex_array_pool;
+	gl_program_uniforms* uniform_cache;
+	size_t uniform_cache_size;
+	gl_shared_shader* shared_shaders;
+	size_t shared_shader_count;
+	size_t shared_shader_capacity;
+	int64_t shared_shader_reuses;
+	gl_state_shadow state;
+	gl_stream_buffer* stream_buffers;
+	int deferred_delete_enabled;
+	gl_delete_frame delete_frames[GL_DELETE_FRAMES];
+	size_t delete_frame_current;
+	int64_t deferred_deleted;
+	gl_pending_program* pending_programs;
+	size_t pending_program_count;
+	size_t pending_program_capacity;
+	gl_stream_buffer* uniform_stream;
+	GLuint uniform_fallback_buffer;
+	size_t uniform_fallback_head;
+	size_t uniform_offset_alignment;
+	gl_batcher batcher;
+	void* native_context;
+} gl_context_caches;
+
+// Caches of the default table while this thread has another one selected
+static GLAD_THREAD_LOCAL gl_context_caches default_caches;
+
+static gl_context_caches* context_caches(struct gladGLContext* context) {
+	return context == &glad_gl_default ? &default_caches : context->user;
+}
+
+#define GL_CONTEXT_CACHE_FIELDS(X) \
+	X(buffer_pool) \
+	X(texture_pool) \
+	X(vertex_array_pool) \
+	X(uniform_cache) \
+	X(uniform_cache_size) \
+	X(shared_shaders) \
+	X(shared_shader_count) \
+	X(shared_shader_capacity) \
+	X(shared_shader_reuses) \
+	X(state) \
+	X(stream_buffers) \
+	X(deferred_delete_enabled) \
+	X(delete_frames) \
+	X(delete_frame_current) \
+	X(deferred_deleted) \
+	X(pending_programs) \
+	X(pending_program_count) \
+	X(pending_program_capacity) \
+	X(uniform_stream) \
+	X(uniform_fallback_buffer) \
+	X(uniform_fallback_head) \
+	X(uniform_offset_alignment) \
+	X(batcher) \
+	X(native_context)
+
+static void context_caches_save(gl_context_caches* caches) {
+#define GL_CONTEXT_SAVE(field) memcpy(&caches->field, &field, sizeof(caches->field));
+	GL_CONTEXT_CACHE_FIELDS(GL_CONTEXT_SAVE)
+#undef GL_CONTEXT_SAVE
+}
+
+static void context_caches_restore(const gl_context_caches* caches) {
+#define GL_CONTEXT_RESTORE(field) memcpy(&field, &caches->field, sizeof(caches->field));
+	GL_CONTEXT_CACHE_FIELDS(GL_CONTEXT_RESTORE)
+#undef GL_CONTEXT_RESTORE
+}
+
+// Releases the memory of a context's caches. Any GL objects still listed in
+// them were not released with context_objects_release and are left to the
+// GL context.
+static void context_caches_free(gl_context_caches* caches) {
+	free(caches->buffer_pool.names);
+	free(caches->texture_pool.names);
+	free(caches->vertex_array_pool.names);
+	for (size_t program = 0; program < caches->uniform_cache_size; program++) {
+		free(caches->uniform_cache[program].locations);
+	}
+	free(caches->uniform_cache);
+	for (size_t i = 0; i < caches->shared_shader_count; i++) {
+		free(caches->shared_shaders[i].source);
+	}
+	free(caches->shared_shaders);
+	while (caches->stream_buffers != NULL) {
+		gl_stream_buffer* next = caches->stream_buffers->next;
+		free(caches->stream_buffers);
+		caches->stream_buffers = next;
+	}
+	for (size_t i = 0; i < GL_DELETE_FRAMES; i++) {
+		gl_delete_frame* frame = &caches->delete_frames[i];
+		free(frame->buffers.names);
+		free(frame->textures.names);
+		free(frame->vertex_arrays.names);
+		free(frame->shaders.names);
+		free(frame->programs.names);
+	}
+	free(caches->pending_programs);
+	free(caches->batcher.quads);
+	free(caches->batcher.staging);
+}
+
+static void context_caches_init(gl_context_caches* caches) {
+	caches->buffer_pool.batch = GL_NAME_POOL_DEFAULT_BATCH;
+	caches->texture_pool.batch = GL_NAME_POOL_DEFAULT_BATCH;
+	caches->vertex_array_pool.batch = GL_NAME_POOL_DEFAULT_BATCH;
+}
+
+static void context_switch(struct gladGLContext* next) {
+	struct gladGLContext* current = gladGetGLContext();
+	if (current == next) {
+		return;
+	}
+	context_caches_save(context_caches(current));
+	gladMakeGLContextCurrent(next);
+	context_caches_restore(context_caches(next));
+}
+
+// LoadGLContext( lazy:i64 -- context:ptr )
+// Loads a dispatch table for the GL context current on this thread and
+// selects it; lazy resolves functions on first call like LoadGLLazy. Resolves
+// through EGL once HeadlessCreate or LoadGLEGL was used. Returns null on
+// failure.
+int LoadGLContext(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
 	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in CompileShader: Stack underflow\n");
+		fprintf(stderr, "Fatal error in LoadGLContext: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t shader_elem;
-	qd_stack_pop(ctx->st, &shader_elem);
-	if (shader_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in CompileShader: Type error\n");
+	qd_stack_element_t lazy_elem;
+	qd_stack_pop(ctx->st, &lazy_elem);
+	if (lazy_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in LoadGLContext: Type error\n");
+		abort();
+	}
+	gl_context_caches* caches = calloc(1, sizeof(gl_context_caches));
+	if (caches == NULL) {
+		fprintf(stderr, "Fatal error in LoadGLContext: Out of memory\n");
 		abort();
 	}
-	glCompileShader((GLuint)shader_elem.value.i);
+	context_caches_init(caches);
+	struct gladGLContext* previous = gladGetGLContext();
+	double start = gl_now();
+	int lazy = lazy_elem.value.i != 0;
+	struct gladGLContext* context = load_through_egl
+		? gladCreateGLContextLoader(&gladGetProcAddressEGL, lazy)
+		: gladCreateGLContext(lazy);
+	load_seconds = gl_now() - start;
+	if (context == NULL) {
+		free(caches);
+		qd_push_p(ctx, NULL);
+		return 0;
+	}
+	context->user = caches;
+	context_caches_save(context_caches(previous));
+	context_caches_restore(caches);
+	gl_loaded();
+	qd_push_p(ctx, context);
 	return 0;
 }
 
-// GetShaderCompileStatus( shader:i64 -- success:i64 )
-int GetShaderCompileStatus(qd_context* ctx) {
+// MakeContextCurrent( context:ptr -- )
+// Selects the dispatch table and caches used by this thread; null selects
+// the default table loaded by LoadGL
+int MakeContextCurrent(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
 	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in GetShaderCompileStatus: Stack underflow\n");
+		fprintf(stderr, "Fatal error in MakeContextCurrent: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t shader_elem;
-	qd_stack_pop(ctx->st, &shader_elem);
-	if (shader_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in GetShaderCompileStatus: Type error\n");
+	qd_stack_element_t context_elem;
+	qd_stack_pop(ctx->st, &context_elem);
+	if (context_elem.type != QD_STACK_TYPE_PTR) {
+		fprintf(stderr, "Fatal error in MakeContextCurrent: Type error\n");
 		abort();
 	}
-	GLint success;
-	glGetShaderiv((GLuint)shader_elem.value.i, GL_COMPILE_STATUS, &success);
-	qd_push_i(ctx, (int64_t)success);
+	struct gladGLContext* context = context_elem.value.p;
+	context_switch(context != NULL ? context : &glad_gl_default);
 	return 0;
 }
 
-// GetShaderInfoLog( shader:i64 -- log:str )
-int GetShaderInfoLog(qd_context* ctx) {
+// DestroyGLContext( context:ptr -- )
+// Frees a table from LoadGLContext; the thread falls back to the default
+// table if it was selected. Call it while the GL context is still current on
+// this thread to delete the pooled names, stream buffers and queued deletes
+// its caches hold; otherwise they go away with the GL context, or stay
+// allocated in the contexts sharing objects with it.
+int DestroyGLContext(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
 	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in GetShaderInfoLog: Stack underflow\n");
+		fprintf(stderr, "Fatal error in DestroyGLContext: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t shader_elem;
-	qd_stack_pop(ctx->st, &shader_elem);
-	if (shader_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in GetShaderInfoLog: Type error\n");
+	qd_stack_element_t context_elem;
+	qd_stack_pop(ctx->st, &context_elem);
+	if (context_elem.type != QD_STACK_TYPE_PTR || context_elem.value.p == NULL) {
+		fprintf(stderr, "Fatal error in DestroyGLContext: Type error\n");
 		abort();
 	}
-	GLint length;
-	glGetShaderiv((GLuint)shader_elem.value.i, GL_INFO_LOG_LENGTH, &length);
-	char* log = malloc(length + 1);
-	glGetShaderInfoLog((GLuint)shader_elem.value.i, length, NULL, log);
-	log[length] = '\0';
-	qd_push_s(ctx, log);
-	free(log);
+	struct gladGLContext* context = context_elem.value.p;
+	struct gladGLContext* previous = gladGetGLContext();
+	context_switch(context);
+	context_objects_release();
+	context_switch(previous != context ? previous : &glad_gl_default);
+	gl_context_caches* caches = context->user;
+	context_caches_free(caches);
+	free(caches);
+	gladDestroyGLContext(context);
 	return 0;
 }
 
 // ============================================================================
-// Programs
+// Headless Contexts
 // ============================================================================
+//
+// HeadlessCreate makes an OpenGL context through EGL with no window, X server
+// or SDL, so the package can render on servers with Mesa llvmpipe or a GPU
+// render node. Given a size it renders into a pbuffer of that size; given 0 0
+// it is surfaceless and renders only into framebuffer objects. The EGL types
+// below are declared here and every entry point is resolved at run time via
+// gladGetProcAddressEGL, so building needs neither EGL headers nor libEGL.
+// The display is opened by the first HeadlessCreate, which must not race
+// with another thread's first call.
 
-// CreateProgram( -- program:i64 )
-int CreateProgram(qd_context* ctx) {
-	GLuint program = glCreateProgram();
-	qd_push_i(ctx, (int64_t)program);
+typedef int32_t gl_egl_int;
+
+#define GL_EGL_NONE 0x3038
+#define GL_EGL_EXTENSIONS 0x3055
+#define GL_EGL_SURFACE_TYPE 0x3033
+#define GL_EGL_PBUFFER_BIT 0x0001
+#define GL_EGL_RENDERABLE_TYPE 0x3040
+#define GL_EGL_OPENGL_BIT 0x0008
+#define GL_EGL_RED_SIZE 0x3024
+#define GL_EGL_GREEN_SIZE 0x3023
+#define GL_EGL_BLUE_SIZE 0x3022
+#define GL_EGL_ALPHA_SIZE 0x3021
+#define GL_EGL_DEPTH_SIZE 0x3025
+#define GL_EGL_WIDTH 0x3057
+#define GL_EGL_HEIGHT 0x3056
+#define GL_EGL_OPENGL_API 0x30A2
+#define GL_EGL_CONTEXT_MAJOR_VERSION 0x3098
+#define GL_EGL_CONTEXT_MINOR_VERSION 0x30FB
+#define GL_EGL_CONTEXT_OPENGL_PROFILE_MASK 0x30FD
+#define GL_EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT 0x0001
+#define GL_EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT 0x0002
+#define GL_EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+
+typedef struct {
+	void* (APIENTRY* GetPlatformDisplayEXT)(unsigned int platform, void* native, const gl_egl_int* attribs);
+	void* (APIENTRY* GetDisplay)(void* native);
+	unsigned int (APIENTRY* Initialize)(void* display, gl_egl_int* major, gl_egl_int* minor);
+	const char* (APIENTRY* QueryString)(void* display, gl_egl_int name);
+	unsigned int (APIENTRY* BindAPI)(unsigned int api);
+	unsigned int (APIENTRY* ChooseConfig)(void* display, const gl_egl_int* attribs, void** configs, gl_egl_int size, gl_egl_int* count);
+	void* (APIENTRY* CreateContext)(void* display, void* config, void* share, const gl_egl_int* attribs);
+	void* (APIENTRY* CreatePbufferSurface)(void* display, void* config, const gl_egl_int* attribs);
+	unsigned int (APIENTRY* MakeCurrent)(void* display, void* draw, void* read, void* context);
+	void* (APIENTRY* GetCurrentContext)(void);
+	unsigned int (APIENTRY* DestroyContext)(void* display, void* context);
+	unsigned int (APIENTRY* DestroySurface)(void* display, void* surface);
+	void* display;
+	int surfaceless; // EGL_KHR_surfaceless_context
+	int no_config;   // EGL_KHR_no_config_context
+	int state;       // 0 untried, 1 ready, -1 unavailable
+} gl_egl;
+
+typedef struct {
+	void* context;
+	void* surface;
+	int width;
+	int height;
+} gl_headless;
+
+static gl_egl egl;
+
+static int egl_has_extension(const char* list, const char* name) {
+	size_t length = strlen(name);
+	while (list != NULL && *list != '\0') {
+		const char* end = strchr(list, ' ');
+		size_t token = end != NULL ? (size_t)(end - list) : strlen(list);
+		if (token == length && memcmp(list, name, length) == 0) {
+			return 1;
+		}
+		list = end != NULL ? end + 1 : NULL;
+	}
 	return 0;
 }
 
-// DeleteProgram( program:i64 -- )
-int DeleteProgram(qd_context* ctx) {
-	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in DeleteProgram: Stack underflow\n");
-		abort();
+static int egl_load(void) {
+	if (egl.state != 0) {
+		return egl.state > 0;
+	}
+	egl.state = -1;
+	if (!gladOpenEGL()) {
+		return 0;
+	}
+#define GL_EGL_RESOLVE(name) *(void**)&egl.name = gladGetProcAddressEGL("egl" #name);
+	GL_EGL_RESOLVE(GetPlatformDisplayEXT)
+	GL_EGL_RESOLVE(GetDisplay)
+	GL_EGL_RESOLVE(Initialize)
+	GL_EGL_RESOLVE(QueryString)
+	GL_EGL_RESOLVE(BindAPI)
+	GL_EGL_RESOLVE(ChooseConfig)
+	GL_EGL_RESOLVE(CreateContext)
+	GL_EGL_RESOLVE(CreatePbufferSurface)
+	GL_EGL_RESOLVE(MakeCurrent)
+	GL_EGL_RESOLVE(GetCurrentContext)
+	GL_EGL_RESOLVE(DestroyContext)
+	GL_EGL_RESOLVE(DestroySurface)
+#undef GL_EGL_RESOLVE
+	if (egl.GetDisplay == NULL || egl.Initialize == NULL || egl.QueryString == NULL ||
+		egl.BindAPI == NULL || egl.ChooseConfig == NULL || egl.CreateContext == NULL ||
+		egl.CreatePbufferSurface == NULL || egl.MakeCurrent == NULL ||
+		egl.GetCurrentContext == NULL || egl.DestroyContext == NULL || egl.DestroySurface == NULL) {
+		return 0;
+	}
+
+	// Prefer Mesa's surfaceless platform, which needs no display server; the
+	// default display may try X11 or Wayland first
+	const char* client = egl.QueryString(NULL, GL_EGL_EXTENSIONS);
+	if (egl.GetPlatformDisplayEXT != NULL && egl_has_extension(client, "EGL_MESA_platform_surfaceless")) {
+		egl.display = egl.GetPlatformDisplayEXT(GL_EGL_PLATFORM_SURFACELESS_MESA, NULL, NULL);
+	}
+	if (egl.display == NULL) {
+		egl.display = egl.GetDisplay(NULL);
+	}
+	if (egl.display == NULL || !egl.Initialize(egl.display, NULL, NULL)) {
+		return 0;
+	}
+	const char* extensions = egl.QueryString(egl.display, GL_EGL_EXTENSIONS);
+	egl.surfaceless = egl_has_extension(extensions, "EGL_KHR_surfaceless_context");
+	egl.no_config = egl_has_extension(extensions, "EGL_KHR_no_config_context");
+	egl.state = 1;
+	load_through_egl = 1;
+	return 1;
+}
+
+// Creates a 4.5 context (any version if the driver refuses 4.5), sharing
+// objects with share if given, and makes it current on this thread
+static gl_headless* headless_create(int width, int height, gl_headless* share) {
+	if (!egl_load()) {
+		return NULL;
+	}
+	int pbuffer = width > 0 && height > 0;
+	if (!pbuffer && !egl.surfaceless) {
+		return NULL;
+	}
+	// The bound API is per thread
+	if (!egl.BindAPI(GL_EGL_OPENGL_API)) {
+		return NULL;
+	}
+
+	const gl_egl_int config_attribs[] = {
+		GL_EGL_SURFACE_TYPE, pbuffer ? GL_EGL_PBUFFER_BIT : 0,
+		GL_EGL_RENDERABLE_TYPE, GL_EGL_OPENGL_BIT,
+		GL_EGL_RED_SIZE, 8, GL_EGL_GREEN_SIZE, 8, GL_EGL_BLUE_SIZE, 8, GL_EGL_ALPHA_SIZE, 8,
+		GL_EGL_DEPTH_SIZE, 24,
+		GL_EGL_NONE
+	};
+	void* config = NULL;
+	gl_egl_int count = 0;
+	if (!egl.ChooseConfig(egl.display, config_attribs, &config, 1, &count) || count < 1) {
+		if (pbuffer || !egl.no_config) {
+			return NULL;
+		}
+		config = NULL;
+	}
+
+#ifdef GLAD_CORE_PROFILE
+	const gl_egl_int profile = GL_EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT;
+#else
+	const gl_egl_int profile = GL_EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT;
+#endif
+	const gl_egl_int context_attribs[] = {
+		GL_EGL_CONTEXT_MAJOR_VERSION, 4,
+		GL_EGL_CONTEXT_MINOR_VERSION, 5,
+		GL_EGL_CONTEXT_OPENGL_PROFILE_MASK, profile,
+		GL_EGL_NONE
+	};
+	const gl_egl_int default_attribs[] = {GL_EGL_NONE};
+	void* share_context = share != NULL ? share->context : NULL;
+	void* context = egl.CreateContext(egl.display, config, share_context, context_attribs);
+	if (context == NULL) {
+		context = egl.CreateContext(egl.display, config, share_context, default_attribs);
+	}
+	if (context == NULL) {
+		return NULL;
+	}
+
+	void* surface = NULL;
+	if (pbuffer) {
+		const gl_egl_int surface_attribs[] = {GL_EGL_WIDTH, width, GL_EGL_HEIGHT, height, GL_EGL_NONE};
+		surface = egl.CreatePbufferSurface(egl.display, config, surface_attribs);
+		if (surface == NULL) {
+			egl.DestroyContext(egl.display, context);
+			return NULL;
+		}
+	}
+	if (!egl.MakeCurrent(egl.display, surface, surface, context)) {
+		if (surface != NULL) {
+			egl.DestroySurface(egl.display, surface);
+		}
+		egl.DestroyContext(egl.display, context);
+		return NULL;
+	}
+
+	gl_headless* headless = malloc(sizeof(gl_headless));
+	if (headless == NULL) {
+		fprintf(stderr, "Fatal error in HeadlessCreate: Out of memory\n");
+		abort();
+	}
+	headless->context = context;
+	headless->surface = surface;
+	headless->width = width;
+	headless->height = height;
+	return headless;
+}
+
+// Null releases the calling thread's current context
+static int headless_make_current(gl_headless* headless) {
+	if (headless == NULL) {
+		return egl.state > 0 && egl.MakeCurrent(egl.display, NULL, NULL, NULL);
+	}
+	return egl.MakeCurrent(egl.display, headless->surface, headless->surface, headless->context) != 0;
+}
+
+static void headless_destroy(gl_headless* headless) {
+	if (egl.GetCurrentContext() == headless->context) {
+		egl.MakeCurrent(egl.display, NULL, NULL, NULL);
 	}
-	qd_stack_element_t program_elem;
-	qd_stack_pop(ctx->st, &program_elem);
-	if (program_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in DeleteProgram: Type error\n");
-		abort();
+	if (headless->surface != NULL) {
+		egl.DestroySurface(egl.display, headless->surface);
 	}
-	glDeleteProgram((GLuint)program_elem.value.i);
-	return 0;
+	egl.DestroyContext(egl.display, headless->context);
+	free(headless);
 }
 
-// AttachShader( program:i64 shader:i64 -- )
-int AttachShader(qd_context* ctx) {
+// HeadlessCreate( width:i64 height:i64 -- headless:ptr )
+// Creates an EGL context with a width x height pbuffer, or surfaceless for
+// 0 0, and makes it current on this thread. Load it with LoadGLEGL or
+// LoadGLContext. Returns null if EGL or the context is unavailable.
+int HeadlessCreate(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
 	if (stack_size < 2) {
-		fprintf(stderr, "Fatal error in AttachShader: Stack underflow\n");
+		fprintf(stderr, "Fatal error in HeadlessCreate: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t shader_elem, program_elem;
-	qd_stack_pop(ctx->st, &shader_elem);
-	qd_stack_pop(ctx->st, &program_elem);
-	if (program_elem.type != QD_STACK_TYPE_INT || shader_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in AttachShader: Type error\n");
+	qd_stack_element_t height_elem, width_elem;
+	qd_stack_pop(ctx->st, &height_elem);
+	qd_stack_pop(ctx->st, &width_elem);
+	if (width_elem.type != QD_STACK_TYPE_INT || height_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in HeadlessCreate: Type error\n");
 		abort();
 	}
-	glAttachShader((GLuint)program_elem.value.i, (GLuint)shader_elem.value.i);
+	qd_push_p(ctx, headless_create((int)width_elem.value.i, (int)height_elem.value.i, NULL));
 	return 0;
 }
 
-// LinkProgram( program:i64 -- )
-int LinkProgram(qd_context* ctx) {
+// HeadlessMakeCurrent( headless:ptr -- success:i64 )
+// Makes a headless context current on this thread; null releases the
+// current one
+int HeadlessMakeCurrent(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
 	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in LinkProgram: Stack underflow\n");
+		fprintf(stderr, "Fatal error in HeadlessMakeCurrent: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t program_elem;
-	qd_stack_pop(ctx->st, &program_elem);
-	if (program_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in LinkProgram: Type error\n");
+	qd_stack_element_t headless_elem;
+	qd_stack_pop(ctx->st, &headless_elem);
+	if (headless_elem.type != QD_STACK_TYPE_PTR) {
+		fprintf(stderr, "Fatal error in HeadlessMakeCurrent: Type error\n");
 		abort();
 	}
-	glLinkProgram((GLuint)program_elem.value.i);
+	qd_push_i(ctx, headless_make_current(headless_elem.value.p) ? 1 : 0);
 	return 0;
 }
 
-// GetProgramLinkStatus( program:i64 -- success:i64 )
-int GetProgramLinkStatus(qd_context* ctx) {
+// HeadlessDestroy( headless:ptr -- )
+int HeadlessDestroy(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
 	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in GetProgramLinkStatus: Stack underflow\n");
+		fprintf(stderr, "Fatal error in HeadlessDestroy: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t program_elem;
-	qd_stack_pop(ctx->st, &program_elem);
-	if (program_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in GetProgramLinkStatus: Type error\n");
+	qd_stack_element_t headless_elem;
+	qd_stack_pop(ctx->st, &headless_elem);
+	if (headless_elem.type != QD_STACK_TYPE_PTR || headless_elem.value.p == NULL) {
+		fprintf(stderr, "Fatal error in HeadlessDestroy: Type error\n");
 		abort();
 	}
-	GLint success;
-	glGetProgramiv((GLuint)program_elem.value.i, GL_LINK_STATUS, &success);
-	qd_push_i(ctx, (int64_t)success);
+	headless_destroy(headless_elem.value.p);
 	return 0;
 }
 
-// GetProgramInfoLog( program:i64 -- log:str )
-int GetProgramInfoLog(qd_context* ctx) {
-	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in GetProgramInfoLog: Stack underflow\n");
+// ============================================================================
+// Render Farm
+// ============================================================================
+//
+// A render farm runs jobs on a pool of worker threads, each owning a headless
+// context and pinned to one CPU, so llvmpipe or a GPU render node works on
+// several frames at once instead of one per process. A job replays a command
+// buffer into the worker's framebuffer at the job's size and reads the result
+// back as RGBA8 rows, bottom row first.
+//
+// Worker contexts share objects with the headless context given to
+// RenderFarmCreate, so programs, buffers and textures made there can be used
+// by jobs once Finish completed them. Vertex arrays and framebuffers are not
+// shared: a job describes its vertex input with RenderJobVertices,
+// RenderJobAttrib and RenderJobIndices, and a command buffer that binds a
+// vertex array aborts when a worker runs it.
+//
+// After each job the worker returns the capabilities, clear color, buffer,
+// program and texture bindings and active texture unit its command buffer
+// changed to the GL defaults, so a job sees the same state whichever jobs the
+// worker ran before it.
+//
+// Uniform values are program state, so workers running jobs with the same
+// shared program would overwrite each other's CmdUniform* values between a
+// job's uniforms and its draws. Each worker therefore runs jobs on a private
+// instance of every program it is handed, restored from the program binary
+// with the shared program's uniform values copied over when first used.
+// Instances are rebuilt after a program is relinked or deleted through this
+// package; values set on the shared program after that are not seen by
+// workers, so per-job values belong in the job's command buffer. Without
+// program binaries (GL 4.1 or GL_ARB_get_program_binary) workers fall back to
+// the shared programs, and concurrent jobs must then not set uniforms on the
+// same program.
+
+#define GL_RENDER_JOB_ATTRIBS 8
+
+enum {
+	GL_RENDER_JOB_IDLE,
+	GL_RENDER_JOB_QUEUED,
+	GL_RENDER_JOB_DONE,
+};
+
+struct gl_render_farm;
+
+typedef struct gl_render_job {
+	const gl_cmd_buffer* commands;
+	int width;
+	int height;
+	GLuint vertex_buffer;
+	GLsizei stride;
+	GLint attrib_size[GL_RENDER_JOB_ATTRIBS]; // 0 leaves the attribute disabled
+	size_t attrib_offset[GL_RENDER_JOB_ATTRIBS];
+	GLuint index_buffer;
+	unsigned char* pixels;
+	size_t pixels_size;
+	// Written under the farm lock; read without it so a finished job never
+	// touches its farm again
+	atomic_int status;
+	struct gl_render_farm* farm;
+	struct gl_render_job* next;
+} gl_render_job;
+
+typedef struct {
+	struct gl_render_farm* farm;
+	size_t index;
+	pthread_t thread;
+} gl_render_worker;
+
+typedef struct gl_render_farm {
+	pthread_mutex_t lock;
+	pthread_cond_t work; // a job was queued or the farm is stopping
+	pthread_cond_t done; // a job finished or a worker came up
+	gl_render_job* head;
+	gl_render_job* tail;
+	size_t outstanding; // queued or running
+	int stopping;
+	gl_headless* share;
+	gl_render_worker* workers;
+	size_t worker_count;
+	size_t started;
+	size_t failed;
+} gl_render_farm;
+
+// A worker's framebuffer and vertex array, grown to each job's size
+typedef struct {
+	GLuint framebuffer;
+	GLuint color;
+	GLuint depth;
+	GLuint vertex_array;
+	int width;
+	int height;
+} gl_render_target;
+
+static void render_worker_pin(size_t index) {
+#ifdef __linux__
+	cpu_set_t allowed;
+	if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0 || CPU_COUNT(&allowed) == 0) {
+		return;
+	}
+	int target = (int)(index % (size_t)CPU_COUNT(&allowed));
+	for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+		if (CPU_ISSET(cpu, &allowed) && target-- == 0) {
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			CPU_SET(cpu, &set);
+			pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+			return;
+		}
+	}
+#else
+	(void)index;
+#endif
+}
+
+static void render_target_resize(gl_render_target* target, int width, int height) {
+	if (target->framebuffer == 0) {
+		glGenFramebuffers(1, &target->framebuffer);
+		glGenRenderbuffers(1, &target->color);
+		glGenRenderbuffers(1, &target->depth);
+		glGenVertexArrays(1, &target->vertex_array);
+	}
+	glBindFramebuffer(GL_FRAMEBUFFER, target->framebuffer);
+	if (target->width == width && target->height == height) {
+		return;
+	}
+	glBindRenderbuffer(GL_RENDERBUFFER, target->color);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+	glBindRenderbuffer(GL_RENDERBUFFER, target->depth);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, target->color);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, target->depth);
+	target->width = width;
+	target->height = height;
+}
+
+static void render_target_destroy(gl_render_target* target) {
+	if (target->framebuffer == 0) {
+		return;
+	}
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	glDeleteFramebuffers(1, &target->framebuffer);
+	glDeleteRenderbuffers(1, &target->color);
+	glDeleteRenderbuffers(1, &target->depth);
+	glDeleteVertexArrays(1, &target->vertex_array);
+}
+
+typedef struct {
+	GLuint shared;
+	GLuint local; // the shared program itself if it could not be copied
+} gl_program_instance;
+
+typedef struct gl_program_instances {
+	gl_program_instance* programs;
+	size_t count;
+	size_t capacity;
+	unsigned generation;
+} gl_program_instances;
+
+// Copies the value of one uniform of from into the current program
+static void program_copy_uniform(GLuint from, GLint src, GLint dst, GLenum type) {
+	GLfloat f[16];
+	GLint i[4];
+	GLuint u[4];
+	GLdouble d[4];
+	switch (type) {
+	case GL_FLOAT:
+	case GL_FLOAT_VEC2:
+	case GL_FLOAT_VEC3:
+	case GL_FLOAT_VEC4:
+	case GL_FLOAT_MAT2:
+	case GL_FLOAT_MAT3:
+	case GL_FLOAT_MAT4:
+	case GL_FLOAT_MAT2x3:
+	case GL_FLOAT_MAT2x4:
+	case GL_FLOAT_MAT3x2:
+	case GL_FLOAT_MAT3x4:
+	case GL_FLOAT_MAT4x2:
+	case GL_FLOAT_MAT4x3:
+		glGetUniformfv(from, src, f);
+		break;
+	case GL_UNSIGNED_INT:
+	case GL_UNSIGNED_INT_VEC2:
+	case GL_UNSIGNED_INT_VEC3:
+	case GL_UNSIGNED_INT_VEC4:
+		glGetUniformuiv(from, src, u);
+		break;
+	case GL_DOUBLE:
+	case GL_DOUBLE_VEC2:
+	case GL_DOUBLE_VEC3:
+	case GL_DOUBLE_VEC4:
+		glGetUniformdv(from, src, d);
+		break;
+	case GL_INT:
+	case GL_INT_VEC2:
+	case GL_INT_VEC3:
+	case GL_INT_VEC4:
+	case GL_BOOL:
+	case GL_BOOL_VEC2:
+	case GL_BOOL_VEC3:
+	case GL_BOOL_VEC4:
+		glGetUniformiv(from, src, i);
+		break;
+	default:
+		// Double matrices keep their initial values; everything else left
+		// is a sampler or image unit
+		if (type >= GL_DOUBLE_MAT2 && type <= GL_DOUBLE_MAT4x3) {
+			return;
+		}
+		glGetUniformiv(from, src, i);
+		glUniform1iv(dst, 1, i);
+		return;
+	}
+	switch (type) {
+	case GL_FLOAT:
+		glUniform1fv(dst, 1, f);
+		return;
+	case GL_FLOAT_VEC2:
+		glUniform2fv(dst, 1, f);
+		return;
+	case GL_FLOAT_VEC3:
+		glUniform3fv(dst, 1, f);
+		return;
+	case GL_FLOAT_VEC4:
+		glUniform4fv(dst, 1, f);
+		return;
+	case GL_FLOAT_MAT2:
+		glUniformMatrix2fv(dst, 1, GL_FALSE, f);
+		return;
+	case GL_FLOAT_MAT3:
+		glUniformMatrix3fv(dst, 1, GL_FALSE, f);
+		return;
+	case GL_FLOAT_MAT4:
+		glUniformMatrix4fv(dst, 1, GL_FALSE, f);
+		return;
+	case GL_FLOAT_MAT2x3:
+		glUniformMatrix2x3fv(dst, 1, GL_FALSE, f);
+		return;
+	case GL_FLOAT_MAT2x4:
+		glUniformMatrix2x4fv(dst, 1, GL_FALSE, f);
+		return;
+	case GL_FLOAT_MAT3x2:
+		glUniformMatrix3x2fv(dst, 1, GL_FALSE, f);
+		return;
+	case GL_FLOAT_MAT3x4:
+		glUniformMatrix3x4fv(dst, 1, GL_FALSE, f);
+		return;
+	case GL_FLOAT_MAT4x2:
+		glUniformMatrix4x2fv(dst, 1, GL_FALSE, f);
+		return;
+	case GL_FLOAT_MAT4x3:
+		glUniformMatrix4x3fv(dst, 1, GL_FALSE, f);
+		return;
+	case GL_UNSIGNED_INT:
+		glUniform1uiv(dst, 1, u);
+		return;
+	case GL_UNSIGNED_INT_VEC2:
+		glUniform2uiv(dst, 1, u);
+		return;
+	case GL_UNSIGNED_INT_VEC3:
+		glUniform3uiv(dst, 1, u);
+		return;
+	case GL_UNSIGNED_INT_VEC4:
+		glUniform4uiv(dst, 1, u);
+		return;
+	case GL_DOUBLE:
+		glUniform1dv(dst, 1, d);
+		return;
+	case GL_DOUBLE_VEC2:
+		glUniform2dv(dst, 1, d);
+		return;
+	case GL_DOUBLE_VEC3:
+		glUniform3dv(dst, 1, d);
+		return;
+	case GL_DOUBLE_VEC4:
+		glUniform4dv(dst, 1, d);
+		return;
+	case GL_INT:
+	case GL_BOOL:
+		glUniform1iv(dst, 1, i);
+		return;
+	case GL_INT_VEC2:
+	case GL_BOOL_VEC2:
+		glUniform2iv(dst, 1, i);
+		return;
+	case GL_INT_VEC3:
+	case GL_BOOL_VEC3:
+		glUniform3iv(dst, 1, i);
+		return;
+	case GL_INT_VEC4:
+	case GL_BOOL_VEC4:
+		glUniform4iv(dst, 1, i);
+		return;
+	}
+}
+
+// Copies the default block uniform values of from into the current program
+// to, element by element for arrays
+static void program_copy_uniforms(GLuint from, GLuint to) {
+	GLint active = 0, max_length = 0;
+	glGetProgramiv(from, GL_ACTIVE_UNIFORMS, &active);
+	glGetProgramiv(from, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length);
+	if (active <= 0 || max_length <= 0) {
+		return;
+	}
+	// Room for the name plus an element index
+	size_t capacity = (size_t)max_length + 24;
+	char* name = malloc(capacity);
+	if (name == NULL) {
+		fprintf(stderr, "Fatal error in RenderFarm: Out of memory\n");
 		abort();
 	}
-	qd_stack_element_t program_elem;
-	qd_stack_pop(ctx->st, &program_elem);
-	if (program_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in GetProgramInfoLog: Type error\n");
+	for (GLint index = 0; index < active; index++) {
+		GLsizei length = 0;
+		GLint size;
+		GLenum type;
+		glGetActiveUniform(from, (GLuint)index, max_length, &length, &size, &type, name);
+		name[length] = '\0';
+		if (strncmp(name, "gl_", 3) == 0) {
+			continue;
+		}
+		if (length > 3 && strcmp(name + length - 3, "[0]") == 0) {
+			length -= 3;
+		}
+		for (GLint element = 0; element < size; element++) {
+			if (size > 1) {
+				snprintf(name + length, capacity - (size_t)length, "[%d]", element);
+			}
+			// Uniform block members have no location and are skipped
+			GLint src = glGetUniformLocation(from, name);
+			GLint dst = glGetUniformLocation(to, name);
+			if (src >= 0 && dst >= 0) {
+				program_copy_uniform(from, src, dst, type);
+			}
+		}
+	}
+	free(name);
+}
+
+// Restores shared into a new program made in the calling worker's context,
+// or returns 0 if the driver cannot hand out or accept its binary
+static GLuint program_instance_create(GLuint shared) {
+	if (!program_cache_supported()) {
+		return 0;
+	}
+	GLint length = 0;
+	glGetProgramiv(shared, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0) {
+		return 0;
+	}
+	void* binary = malloc((size_t)length);
+	if (binary == NULL) {
+		fprintf(stderr, "Fatal error in RenderFarm: Out of memory\n");
 		abort();
 	}
-	GLint length;
-	glGetProgramiv((GLuint)program_elem.value.i, GL_INFO_LOG_LENGTH, &length);
-	char* log = malloc(length + 1);
-	glGetProgramInfoLog((GLuint)program_elem.value.i, length, NULL, log);
-	log[length] = '\0';
-	qd_push_s(ctx, log);
-	free(log);
-	return 0;
+	GLenum format = 0;
+	GLsizei written = 0;
+	glGetProgramBinary(shared, length, &written, &format, binary);
+	GLuint local = glCreateProgram();
+	glProgramBinary(local, format, binary, written);
+	free(binary);
+	GLint success = GL_FALSE;
+	glGetProgramiv(local, GL_LINK_STATUS, &success);
+	if (success != GL_TRUE) {
+		glDeleteProgram(local);
+		return 0;
+	}
+	state_use_program(local);
+	program_copy_uniforms(shared, local);
+	return local;
 }
 
-// UseProgram( program:i64 -- )
-int UseProgram(qd_context* ctx) {
-	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in UseProgram: Stack underflow\n");
+static void program_instances_clear(gl_program_instances* instances) {
+	for (size_t i = 0; i < instances->count; i++) {
+		gl_program_instance* instance = &instances->programs[i];
+		if (instance->local != instance->shared) {
+			state_forget_program(instance->local);
+			glDeleteProgram(instance->local);
+		}
+	}
+	instances->count = 0;
+}
+
+static GLuint program_instance(gl_program_instances* instances, GLuint program) {
+	if (program == 0) {
+		return 0;
+	}
+	unsigned generation = atomic_load(&program_generation);
+	if (instances->generation != generation) {
+		program_instances_clear(instances);
+		instances->generation = generation;
+	}
+	for (size_t i = 0; i < instances->count; i++) {
+		if (instances->programs[i].shared == program) {
+			return instances->programs[i].local;
+		}
+	}
+	if (instances->count == instances->capacity) {
+		size_t capacity = instances->capacity ? instances->capacity * 2 : 8;
+		gl_program_instance* programs =
+				realloc(instances->programs, capacity * sizeof(gl_program_instance));
+		if (programs == NULL) {
+			fprintf(stderr, "Fatal error in RenderFarm: Out of memory\n");
+			abort();
+		}
+		instances->programs = programs;
+		instances->capacity = capacity;
+	}
+	GLuint local = program_instance_create(program);
+	gl_program_instance* instance = &instances->programs[instances->count++];
+	instance->shared = program;
+	instance->local = local != 0 ? local : program;
+	return instance->local;
+}
+
+// Returns the state a job's commands changed to the GL defaults, so the next
+// job on the worker starts from the same state whatever ran before it
+static void render_job_reset(const gl_cmd_buffer* cb) {
+	GLenum unit = GL_TEXTURE0;
+	for (size_t i = 0; i < cb->count; i++) {
+		const gl_cmd* cmd = &cb->cmds[i];
+		switch (cmd->op) {
+		case GL_CMD_ENABLE:
+		case GL_CMD_DISABLE: {
+			GLenum cap = (GLenum)cmd->i[0];
+			state_set_cap(cap, cap == GL_DITHER || cap == GL_MULTISAMPLE);
+			break;
+		}
+		case GL_CMD_CLEAR_COLOR:
+			glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+			break;
+		case GL_CMD_BIND_BUFFER:
+			state_bind_buffer((GLenum)cmd->i[0], 0);
+			break;
+		case GL_CMD_USE_PROGRAM:
+			state_use_program(0);
+			break;
+		case GL_CMD_ACTIVE_TEXTURE:
+			unit = (GLenum)cmd->i[0];
+			break;
+		case GL_CMD_BIND_TEXTURE:
+			state_active_texture(unit);
+			state_bind_texture((GLenum)cmd->i[0], 0);
+			break;
+		}
+	}
+	state_active_texture(GL_TEXTURE0);
+}
+
+static void render_job_run(gl_render_job* job, gl_render_target* target) {
+	render_target_resize(target, job->width, job->height);
+	glViewport(0, 0, job->width, job->height);
+	state_bind_vertex_array(target->vertex_array);
+	if (job->vertex_buffer != 0) {
+		state_bind_buffer(GL_ARRAY_BUFFER, job->vertex_buffer);
+	}
+	for (GLuint i = 0; i < GL_RENDER_JOB_ATTRIBS; i++) {
+		if (job->attrib_size[i] > 0 && job->vertex_buffer != 0) {
+			glVertexAttribPointer(i, job->attrib_size[i], GL_FLOAT, GL_FALSE, job->stride,
+					(const void*)(uintptr_t)job->attrib_offset[i]);
+			glEnableVertexAttribArray(i);
+		} else {
+			glDisableVertexAttribArray(i);
+		}
+	}
+	state_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, job->index_buffer);
+	cmd_buffer_run(job->commands);
+
+	size_t size = (size_t)job->width * (size_t)job->height * 4;
+	if (job->pixels_size != size) {
+		unsigned char* pixels = realloc(job->pixels, size);
+		if (pixels == NULL) {
+			fprintf(stderr, "Fatal error in RenderFarm: Out of memory\n");
+			abort();
+		}
+		job->pixels = pixels;
+		job->pixels_size = size;
+	}
+	glReadPixels(0, 0, job->width, job->height, GL_RGBA, GL_UNSIGNED_BYTE, job->pixels);
+	render_job_reset(job->commands);
+}
+
+static void* render_worker_main(void* arg) {
+	gl_render_worker* worker = arg;
+	gl_render_farm* farm = worker->farm;
+	render_worker_pin(worker->index);
+
+	// Surfaceless if the driver allows it; the framebuffer is ours anyway
+	gl_headless* headless = headless_create(0, 0, farm->share);
+	if (headless == NULL) {
+		headless = headless_create(1, 1, farm->share);
+	}
+	struct gladGLContext* context = NULL;
+	if (headless != NULL) {
+		context = gladCreateGLContextLoader(&gladGetProcAddressEGL, 0);
+	}
+	pthread_mutex_lock(&farm->lock);
+	if (context != NULL) {
+		farm->started++;
+	} else {
+		farm->failed++;
+	}
+	pthread_cond_broadcast(&farm->done);
+	pthread_mutex_unlock(&farm->lock);
+	if (context == NULL) {
+		if (headless != NULL) {
+			headless_destroy(headless);
+		}
+		return NULL;
+	}
+
+	gl_context_caches caches;
+	memset(&caches, 0, sizeof(caches));
+	context_caches_init(&caches);
+	context_caches_restore(&caches);
+	gl_loaded();
+	gl_render_target target;
+	memset(&target, 0, sizeof(target));
+	gl_program_instances instances = {NULL, 0, 0, atomic_load(&program_generation)};
+	program_instances = &instances;
+
+	pthread_mutex_lock(&farm->lock);
+	for (;;) {
+		while (farm->head == NULL && !farm->stopping) {
+			pthread_cond_wait(&farm->work, &farm->lock);
+		}
+		gl_render_job* job = farm->head;
+		if (job == NULL) {
+			break;
+		}
+		farm->head = job->next;
+		if (farm->head == NULL) {
+			farm->tail = NULL;
+		}
+		pthread_mutex_unlock(&farm->lock);
+		render_job_run(job, &target);
+		pthread_mutex_lock(&farm->lock);
+		atomic_store(&job->status, GL_RENDER_JOB_DONE);
+		farm->outstanding--;
+		pthread_cond_broadcast(&farm->done);
+	}
+	pthread_mutex_unlock(&farm->lock);
+
+	program_instances = NULL;
+	program_instances_clear(&instances);
+	free(instances.programs);
+	render_target_destroy(&target);
+	// The context shares objects with the application's, so they would
+	// outlive it
+	context_objects_release();
+	context_caches_save(&caches);
+	context_caches_free(&caches);
+	gladDestroyGLContext(context);
+	headless_destroy(headless);
+	return NULL;
+}
+
+static void render_farm_destroy(gl_render_farm* farm, size_t spawned) {
+	pthread_mutex_lock(&farm->lock);
+	farm->stopping = 1;
+	pthread_cond_broadcast(&farm->work);
+	pthread_mutex_unlock(&farm->lock);
+	for (size_t i = 0; i < spawned; i++) {
+		pthread_join(farm->workers[i].thread, NULL);
+	}
+	pthread_mutex_destroy(&farm->lock);
+	pthread_cond_destroy(&farm->work);
+	pthread_cond_destroy(&farm->done);
+	free(farm->workers);
+	free(farm);
+}
+
+// Starts workers (one per online CPU for 0) and waits until each has its
+// context; returns NULL if EGL or any worker context is unavailable
+static gl_render_farm* render_farm_create(gl_headless* share, size_t workers) {
+	// Opens the EGL display before the workers race for it
+	if (!egl_load()) {
+		return NULL;
+	}
+	if (workers == 0) {
+		long online = sysconf(_SC_NPROCESSORS_ONLN);
+		workers = online > 0 ? (size_t)online : 1;
+	}
+	gl_render_farm* farm = calloc(1, sizeof(gl_render_farm));
+	gl_render_worker* worker_list = calloc(workers, sizeof(gl_render_worker));
+	if (farm == NULL || worker_list == NULL) {
+		fprintf(stderr, "Fatal error in RenderFarmCreate: Out of memory\n");
 		abort();
 	}
-	qd_stack_element_t program_elem;
-	qd_stack_pop(ctx->st, &program_elem);
-	if (program_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in UseProgram: Type error\n");
+	pthread_mutex_init(&farm->lock, NULL);
+	pthread_cond_init(&farm->work, NULL);
+	pthread_cond_init(&farm->done, NULL);
+	farm->share = share;
+	farm->workers = worker_list;
+	farm->worker_count = workers;
+
+	size_t spawned = 0;
+	for (; spawned < workers; spawned++) {
+		worker_list[spawned].farm = farm;
+		worker_list[spawned].index = spawned;
+		if (pthread_create(&worker_list[spawned].thread, NULL, render_worker_main, &worker_list[spawned]) != 0) {
+			break;
+		}
+	}
+	pthread_mutex_lock(&farm->lock);
+	while (farm->started + farm->failed < spawned) {
+		pthread_cond_wait(&farm->done, &farm->lock);
+	}
+	int ok = spawned == workers && farm->failed == 0;
+	pthread_mutex_unlock(&farm->lock);
+	if (!ok) {
+		render_farm_destroy(farm, spawned);
+		return NULL;
+	}
+	return farm;
+}
+
+static void render_farm_submit(gl_render_farm* farm, gl_render_job* job, const char* fn) {
+	pthread_mutex_lock(&farm->lock);
+	if (atomic_load(&job->status) == GL_RENDER_JOB_QUEUED) {
+		fprintf(stderr, "Fatal error in %s: Job already queued\n", fn);
 		abort();
 	}
-	glUseProgram((GLuint)program_elem.value.i);
-	return 0;
+	atomic_store(&job->status, GL_RENDER_JOB_QUEUED);
+	job->farm = farm;
+	job->next = NULL;
+	if (farm->tail != NULL) {
+		farm->tail->next = job;
+	} else {
+		farm->head = job;
+	}
+	farm->tail = job;
+	farm->outstanding++;
+	pthread_cond_signal(&farm->work);
+	pthread_mutex_unlock(&farm->lock);
 }
 
-// GetUniformLocation( program:i64 name:str -- location:i64 )
-int GetUniformLocation(qd_context* ctx) {
-	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 2) {
-		fprintf(stderr, "Fatal error in GetUniformLocation: Stack underflow\n");
+static void render_farm_wait(gl_render_farm* farm) {
+	pthread_mutex_lock(&farm->lock);
+	while (farm->outstanding > 0) {
+		pthread_cond_wait(&farm->done, &farm->lock);
+	}
+	pthread_mutex_unlock(&farm->lock);
+}
+
+static gl_render_job* pop_render_job(qd_context* ctx, const char* fn) {
+	qd_stack_element_t job_elem;
+	qd_stack_pop(ctx->st, &job_elem);
+	if (job_elem.type != QD_STACK_TYPE_PTR || job_elem.value.p == NULL) {
+		fprintf(stderr, "Fatal error in %s: Type error\n", fn);
 		abort();
 	}
-	qd_stack_element_t name_elem, program_elem;
-	qd_stack_pop(ctx->st, &name_elem);
-	qd_stack_pop(ctx->st, &program_elem);
-	if (program_elem.type != QD_STACK_TYPE_INT || name_elem.type != QD_STACK_TYPE_STR) {
-		fprintf(stderr, "Fatal error in GetUniformLocation: Type error\n");
+	return job_elem.value.p;
+}
+
+static gl_render_farm* pop_render_farm(qd_context* ctx, const char* fn) {
+	qd_stack_element_t farm_elem;
+	qd_stack_pop(ctx->st, &farm_elem);
+	if (farm_elem.type != QD_STACK_TYPE_PTR || farm_elem.value.p == NULL) {
+		fprintf(stderr, "Fatal error in %s: Type error\n", fn);
 		abort();
 	}
-	const char* name = qd_string_data(name_elem.value.s);
-	GLint location = glGetUniformLocation((GLuint)program_elem.value.i, name);
-	qd_string_release(name_elem.value.s);
-	qd_push_i(ctx, (int64_t)location);
-	return 0;
+	return farm_elem.value.p;
 }
 
-// Uniform1f( location:i64 v0:f64 -- )
-int Uniform1f(qd_context* ctx) {
+// RenderFarmCreate( share:ptr workers:i64 -- farm:ptr )
+// Starts workers (0 for one per CPU) whose contexts share objects with the
+// headless context share (null for none). Returns null if a worker context
+// cannot be created.
+int RenderFarmCreate(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
 	if (stack_size < 2) {
-		fprintf(stderr, "Fatal error in Uniform1f: Stack underflow\n");
+		fprintf(stderr, "Fatal error in RenderFarmCreate: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t v0_elem, location_elem;
-	qd_stack_pop(ctx->st, &v0_elem);
-	qd_stack_pop(ctx->st, &location_elem);
-	if (location_elem.type != QD_STACK_TYPE_INT || v0_elem.type != QD_STACK_TYPE_FLOAT) {
-		fprintf(stderr, "Fatal error in Uniform1f: Type error\n");
+	qd_stack_element_t workers_elem, share_elem;
+	qd_stack_pop(ctx->st, &workers_elem);
+	qd_stack_pop(ctx->st, &share_elem);
+	if (share_elem.type != QD_STACK_TYPE_PTR || workers_elem.type != QD_STACK_TYPE_INT ||
+		workers_elem.value.i < 0) {
+		fprintf(stderr, "Fatal error in RenderFarmCreate: Type error\n");
 		abort();
 	}
-	glUniform1f((GLint)location_elem.value.i, (GLfloat)v0_elem.value.f);
+	qd_push_p(ctx, render_farm_create(share_elem.value.p, (size_t)workers_elem.value.i));
 	return 0;
 }
 
-// Uniform1i( location:i64 v0:i64 -- )
-int Uniform1i(qd_context* ctx) {
+// RenderFarmDestroy( farm:ptr -- )
+// Finishes the queued jobs and stops the workers
+int RenderFarmDestroy(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 2) {
-		fprintf(stderr, "Fatal error in Uniform1i: Stack underflow\n");
-		abort();
-	}
-	qd_stack_element_t v0_elem, location_elem;
-	qd_stack_pop(ctx->st, &v0_elem);
-	qd_stack_pop(ctx->st, &location_elem);
-	if (location_elem.type != QD_STACK_TYPE_INT || v0_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in Uniform1i: Type error\n");
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in RenderFarmDestroy: Stack underflow\n");
 		abort();
 	}
-	glUniform1i((GLint)location_elem.value.i, (GLint)v0_elem.value.i);
+	gl_render_farm* farm = pop_render_farm(ctx, "RenderFarmDestroy");
+	render_farm_destroy(farm, farm->worker_count);
 	return 0;
 }
 
-// Uniform3f( location:i64 v0:f64 v1:f64 v2:f64 -- )
-int Uniform3f(qd_context* ctx) {
+// RenderFarmSubmit( farm:ptr job:ptr -- )
+// Queues a job; it must not be queued already
+int RenderFarmSubmit(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 4) {
-		fprintf(stderr, "Fatal error in Uniform3f: Stack underflow\n");
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in RenderFarmSubmit: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t v2_elem, v1_elem, v0_elem, location_elem;
-	qd_stack_pop(ctx->st, &v2_elem);
-	qd_stack_pop(ctx->st, &v1_elem);
-	qd_stack_pop(ctx->st, &v0_elem);
-	qd_stack_pop(ctx->st, &location_elem);
-	if (location_elem.type != QD_STACK_TYPE_INT || v0_elem.type != QD_STACK_TYPE_FLOAT ||
-			v1_elem.type != QD_STACK_TYPE_FLOAT || v2_elem.type != QD_STACK_TYPE_FLOAT) {
-		fprintf(stderr, "Fatal error in Uniform3f: Type error\n");
+	gl_render_job* job = pop_render_job(ctx, "RenderFarmSubmit");
+	gl_render_farm* farm = pop_render_farm(ctx, "RenderFarmSubmit");
+	render_farm_submit(farm, job, "RenderFarmSubmit");
+	return 0;
+}
+
+// RenderFarmWait( farm:ptr -- )
+// Blocks until every submitted job is done
+int RenderFarmWait(qd_context* ctx) {
+	size_t stack_size = qd_stack_size(ctx->st);
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in RenderFarmWait: Stack underflow\n");
 		abort();
 	}
-	glUniform3f((GLint)location_elem.value.i, (GLfloat)v0_elem.value.f, (GLfloat)v1_elem.value.f,
-			(GLfloat)v2_elem.value.f);
+	render_farm_wait(pop_render_farm(ctx, "RenderFarmWait"));
 	return 0;
 }
 
-// Uniform4f( location:i64 v0:f64 v1:f64 v2:f64 v3:f64 -- )
-int Uniform4f(qd_context* ctx) {
+// RenderFarmBenchmark( share:ptr job:ptr frames:i64 workers:i64 -- fps:f64 )
+// Renders frames copies of job on a new farm of workers and reports frames
+// per second, excluding worker startup; 0 if the farm cannot start
+int RenderFarmBenchmark(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 5) {
-		fprintf(stderr, "Fatal error in Uniform4f: Stack underflow\n");
+	if (stack_size < 4) {
+		fprintf(stderr, "Fatal error in RenderFarmBenchmark: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t v3_elem, v2_elem, v1_elem, v0_elem, location_elem;
-	qd_stack_pop(ctx->st, &v3_elem);
-	qd_stack_pop(ctx->st, &v2_elem);
-	qd_stack_pop(ctx->st, &v1_elem);
-	qd_stack_pop(ctx->st, &v0_elem);
-	qd_stack_pop(ctx->st, &location_elem);
-	if (location_elem.type != QD_STACK_TYPE_INT || v0_elem.type != QD_STACK_TYPE_FLOAT ||
-			v1_elem.type != QD_STACK_TYPE_FLOAT || v2_elem.type != QD_STACK_TYPE_FLOAT ||
-			v3_elem.type != QD_STACK_TYPE_FLOAT) {
-		fprintf(stderr, "Fatal error in Uniform4f: Type error\n");
+	qd_stack_element_t workers_elem, frames_elem, job_elem, share_elem;
+	qd_stack_pop(ctx->st, &workers_elem);
+	qd_stack_pop(ctx->st, &frames_elem);
+	qd_stack_pop(ctx->st, &job_elem);
+	qd_stack_pop(ctx->st, &share_elem);
+	if (share_elem.type != QD_STACK_TYPE_PTR || job_elem.type != QD_STACK_TYPE_PTR ||
+		job_elem.value.p == NULL || frames_elem.type != QD_STACK_TYPE_INT ||
+		frames_elem.value.i < 1 || workers_elem.type != QD_STACK_TYPE_INT || workers_elem.value.i < 0) {
+		fprintf(stderr, "Fatal error in RenderFarmBenchmark: Type error\n");
+		abort();
+	}
+	gl_render_farm* farm = render_farm_create(share_elem.value.p, (size_t)workers_elem.value.i);
+	if (farm == NULL) {
+		qd_push_f(ctx, 0.0);
+		return 0;
+	}
+	size_t frames = (size_t)frames_elem.value.i;
+	gl_render_job* copies = malloc(frames * sizeof(gl_render_job));
+	if (copies == NULL) {
+		fprintf(stderr, "Fatal error in RenderFarmBenchmark: Out of memory\n");
 		abort();
 	}
-	glUniform4f((GLint)location_elem.value.i, (GLfloat)v0_elem.value.f, (GLfloat)v1_elem.value.f,
-			(GLfloat)v2_elem.value.f, (GLfloat)v3_elem.value.f);
+	for (size_t i = 0; i < frames; i++) {
+		memcpy(&copies[i], job_elem.value.p, sizeof(gl_render_job));
+		copies[i].pixels = NULL;
+		copies[i].pixels_size = 0;
+		atomic_init(&copies[i].status, GL_RENDER_JOB_IDLE);
+	}
+	double start = gl_now();
+	for (size_t i = 0; i < frames; i++) {
+		render_farm_submit(farm, &copies[i], "RenderFarmBenchmark");
+	}
+	render_farm_wait(farm);
+	double seconds = gl_now() - start;
+	render_farm_destroy(farm, farm->worker_count);
+	for (size_t i = 0; i < frames; i++) {
+		free(copies[i].pixels);
+	}
+	free(copies);
+	qd_push_f(ctx, seconds > 0.0 ? (double)frames / seconds : 0.0);
 	return 0;
 }
 
-// ============================================================================
-// Drawing
-// ============================================================================
-
-// DrawArrays( mode:i64 first:i64 count:i64 -- )
-int DrawArrays(qd_context* ctx) {
+// RenderJobCreate( commands:ptr width:i64 height:i64 -- job:ptr )
+// The command buffer is replayed by a worker and must outlive the job
+int RenderJobCreate(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
 	if (stack_size < 3) {
-		fprintf(stderr, "Fatal error in DrawArrays: Stack underflow\n");
+		fprintf(stderr, "Fatal error in RenderJobCreate: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t count_elem, first_elem, mode_elem;
-	qd_stack_pop(ctx->st, &count_elem);
-	qd_stack_pop(ctx->st, &first_elem);
-	qd_stack_pop(ctx->st, &mode_elem);
-	if (mode_elem.type != QD_STACK_TYPE_INT || first_elem.type != QD_STACK_TYPE_INT ||
-			count_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in DrawArrays: Type error\n");
+	qd_stack_element_t height_elem, width_elem, commands_elem;
+	qd_stack_pop(ctx->st, &height_elem);
+	qd_stack_pop(ctx->st, &width_elem);
+	qd_stack_pop(ctx->st, &commands_elem);
+	if (commands_elem.type != QD_STACK_TYPE_PTR || commands_elem.value.p == NULL ||
+		width_elem.type != QD_STACK_TYPE_INT || height_elem.type != QD_STACK_TYPE_INT ||
+		width_elem.value.i < 1 || height_elem.value.i < 1) {
+		fprintf(stderr, "Fatal error in RenderJobCreate: Type error\n");
+		abort();
+	}
+	gl_render_job* job = calloc(1, sizeof(gl_render_job));
+	if (job == NULL) {
+		fprintf(stderr, "Fatal error in RenderJobCreate: Out of memory\n");
 		abort();
 	}
-	glDrawArrays((GLenum)mode_elem.value.i, (GLint)first_elem.value.i, (GLsizei)count_elem.value.i);
+	atomic_init(&job->status, GL_RENDER_JOB_IDLE);
+	job->commands = commands_elem.value.p;
+	job->width = (int)width_elem.value.i;
+	job->height = (int)height_elem.value.i;
+	qd_push_p(ctx, job);
 	return 0;
 }
 
-// DrawElements( mode:i64 count:i64 type:i64 offset:i64 -- )
-int DrawElements(qd_context* ctx) {
+// RenderJobDestroy( job:ptr -- )
+// Frees the job and its pixels; the job must not be queued
+int RenderJobDestroy(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 4) {
-		fprintf(stderr, "Fatal error in DrawElements: Stack underflow\n");
+	if (stack_size < 1) {
+		fprintf(stderr, "Fatal error in RenderJobDestroy: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t offset_elem, type_elem, count_elem, mode_elem;
-	qd_stack_pop(ctx->st, &offset_elem);
-	qd_stack_pop(ctx->st, &type_elem);
-	qd_stack_pop(ctx->st, &count_elem);
-	qd_stack_pop(ctx->st, &mode_elem);
-	if (mode_elem.type != QD_STACK_TYPE_INT || count_elem.type != QD_STACK_TYPE_INT ||
-			type_elem.type != QD_STACK_TYPE_INT || offset_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in DrawElements: Type error\n");
+	gl_render_job* job = pop_render_job(ctx, "RenderJobDestroy");
+	if (atomic_load(&job->status) == GL_RENDER_JOB_QUEUED) {
+		fprintf(stderr, "Fatal error in RenderJobDestroy: Job still queued\n");
 		abort();
 	}
-	glDrawElements((GLenum)mode_elem.value.i, (GLsizei)count_elem.value.i, (GLenum)type_elem.value.i,
-			(const void*)(intptr_t)offset_elem.value.i);
-	return 0;
-}
-
-// ============================================================================
-// Textures
-// ============================================================================
-
-// GenTexture( -- texture:i64 )
-int GenTexture(qd_context* ctx) {
-	GLuint texture;
-	glGenTextures(1, &texture);
-	qd_push_i(ctx, (int64_t)texture);
+	free(job->pixels);
+	free(job);
 	return 0;
 }
 
-// DeleteTexture( texture:i64 -- )
-int DeleteTexture(qd_context* ctx) {
+// RenderJobVertices( job:ptr buffer:i64 stride:i64 -- )
+// Vertex buffer the job's attributes read from
+int RenderJobVertices(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in DeleteTexture: Stack underflow\n");
+	if (stack_size < 3) {
+		fprintf(stderr, "Fatal error in RenderJobVertices: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t texture_elem;
-	qd_stack_pop(ctx->st, &texture_elem);
-	if (texture_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in DeleteTexture: Type error\n");
+	qd_stack_element_t stride_elem, buffer_elem;
+	qd_stack_pop(ctx->st, &stride_elem);
+	qd_stack_pop(ctx->st, &buffer_elem);
+	gl_render_job* job = pop_render_job(ctx, "RenderJobVertices");
+	if (buffer_elem.type != QD_STACK_TYPE_INT || stride_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in RenderJobVertices: Type error\n");
 		abort();
 	}
-	GLuint texture = (GLuint)texture_elem.value.i;
-	glDeleteTextures(1, &texture);
+	job->vertex_buffer = (GLuint)buffer_elem.value.i;
+	job->stride = (GLsizei)stride_elem.value.i;
 	return 0;
 }
 
-// BindTexture( target:i64 texture:i64 -- )
-int BindTexture(qd_context* ctx) {
+// RenderJobAttrib( job:ptr location:i64 size:i64 offset:i64 -- )
+// Float attribute of size components at a byte offset into each vertex;
+// size 0 disables the location
+int RenderJobAttrib(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 2) {
-		fprintf(stderr, "Fatal error in BindTexture: Stack underflow\n");
+	if (stack_size < 4) {
+		fprintf(stderr, "Fatal error in RenderJobAttrib: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t texture_elem, target_elem;
-	qd_stack_pop(ctx->st, &texture_elem);
-	qd_stack_pop(ctx->st, &target_elem);
-	if (target_elem.type != QD_STACK_TYPE_INT || texture_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in BindTexture: Type error\n");
+	qd_stack_element_t offset_elem, size_elem, location_elem;
+	qd_stack_pop(ctx->st, &offset_elem);
+	qd_stack_pop(ctx->st, &size_elem);
+	qd_stack_pop(ctx->st, &location_elem);
+	gl_render_job* job = pop_render_job(ctx, "RenderJobAttrib");
+	if (location_elem.type != QD_STACK_TYPE_INT || size_elem.type != QD_STACK_TYPE_INT ||
+		offset_elem.type != QD_STACK_TYPE_INT || location_elem.value.i < 0 ||
+		location_elem.value.i >= GL_RENDER_JOB_ATTRIBS || size_elem.value.i < 0 ||
+		size_elem.value.i > 4 || offset_elem.value.i < 0) {
+		fprintf(stderr, "Fatal error in RenderJobAttrib: Type error\n");
 		abort();
 	}
-	glBindTexture((GLenum)target_elem.value.i, (GLuint)texture_elem.value.i);
+	job->attrib_size[location_elem.value.i] = (GLint)size_elem.value.i;
+	job->attrib_offset[location_elem.value.i] = (size_t)offset_elem.value.i;
 	return 0;
 }
 
-// TexParameteri( target:i64 pname:i64 param:i64 -- )
-int TexParameteri(qd_context* ctx) {
+// RenderJobIndices( job:ptr buffer:i64 -- )
+// Element array buffer for the job's DrawElements commands
+int RenderJobIndices(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
-	if (stack_size < 3) {
-		fprintf(stderr, "Fatal error in TexParameteri: Stack underflow\n");
+	if (stack_size < 2) {
+		fprintf(stderr, "Fatal error in RenderJobIndices: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t param_elem, pname_elem, target_elem;
-	qd_stack_pop(ctx->st, &param_elem);
-	qd_stack_pop(ctx->st, &pname_elem);
-	qd_stack_pop(ctx->st, &target_elem);
-	if (target_elem.type != QD_STACK_TYPE_INT || pname_elem.type != QD_STACK_TYPE_INT ||
-			param_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in TexParameteri: Type error\n");
+	qd_stack_element_t buffer_elem;
+	qd_stack_pop(ctx->st, &buffer_elem);
+	gl_render_job* job = pop_render_job(ctx, "RenderJobIndices");
+	if (buffer_elem.type != QD_STACK_TYPE_INT) {
+		fprintf(stderr, "Fatal error in RenderJobIndices: Type error\n");
 		abort();
 	}
-	glTexParameteri((GLenum)target_elem.value.i, (GLenum)pname_elem.value.i, (GLint)param_elem.value.i);
+	job->index_buffer = (GLuint)buffer_elem.value.i;
 	return 0;
 }
 
-// ActiveTexture( texture:i64 -- )
-int ActiveTexture(qd_context* ctx) {
+// RenderJobWait( job:ptr -- pixels:ptr )
+// Blocks until a submitted job is done and returns its width * height RGBA8
+// pixels, bottom row first, valid until the job is resubmitted or destroyed
+int RenderJobWait(qd_context* ctx) {
 	size_t stack_size = qd_stack_size(ctx->st);
 	if (stack_size < 1) {
-		fprintf(stderr, "Fatal error in ActiveTexture: Stack underflow\n");
+		fprintf(stderr, "Fatal error in RenderJobWait: Stack underflow\n");
 		abort();
 	}
-	qd_stack_element_t texture_elem;
-	qd_stack_pop(ctx->st, &texture_elem);
-	if (texture_elem.type != QD_STACK_TYPE_INT) {
-		fprintf(stderr, "Fatal error in ActiveTexture: Type error\n");
-		abort();
+	gl_render_job* job = pop_render_job(ctx, "RenderJobWait");
+	if (atomic_load(&job->status) == GL_RENDER_JOB_QUEUED) {
+		pthread_mutex_lock(&job->farm->lock);
+		while (atomic_load(&job->status) == GL_RENDER_JOB_QUEUED) {
+			pthread_cond_wait(&job->farm->done, &job->farm->lock);
+		}
+		pthread_mutex_unlock(&job->farm->lock);
 	}
-	glActiveTexture((GLenum)texture_elem.value.i);
+	qd_push_p(ctx, atomic_load(&job->status) == GL_RENDER_JOB_DONE ? job->pixels : NULL);
 	return 0;
 }
@@ -0,0 +1,5564 @@
+// Code generated by tools/glgen.py from src/glad/glad.h and tools/bindings.txt.
+// DO NOT EDIT: add the function to tools/bindings.txt and re-run the generator.
+
+#include <glad/glad.h>
+#include <qdrt/ffi.h>
+#include <qdrt/runtime.h>
+#include <qdrt/stack.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Pops n arguments into args[0..n) (declaration order) and validates them
+// against sig with a single bounds check and a single type branch.
+static void gl_pop_args(qd_context* ctx, const char* fn, const int* sig, size_t n,
+		qd_stack_element_t* args) {
+	if (qd_stack_size(ctx->st) < n) {
+		fprintf(stderr, "Fatal error in %s: Stack underflow\n", fn);
+		abort();
+	}
+	int mismatch = 0;
+	for (size_t i = n; i-- > 0;) {
+		qd_stack_pop(ctx->st, &args[i]);
+		mismatch |= (int)args[i].type ^ sig[i];
+	}
+	if (mismatch) {
+		fprintf(stderr, "Fatal error in %s: Type error\n", fn);
+		abort();
+	}
+}
+
+// ClearColor( red:f64 green:f64 blue:f64 alpha:f64 -- )
+int ClearColor(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ClearColor", sig, 4, args);
+	glClearColor((GLfloat)args[0].value.f, (GLfloat)args[1].value.f, (GLfloat)args[2].value.f, (GLfloat)args[3].value.f);
+	return 0;
+}
+
+// Clear( mask:i64 -- )
+int Clear(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "Clear", sig, 1, args);
+	glClear((GLbitfield)args[0].value.i);
+	return 0;
+}
+
+// Viewport( x:i64 y:i64 width:i64 height:i64 -- )
+int Viewport(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "Viewport", sig, 4, args);
+	glViewport((GLint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei)args[3].value.i);
+	return 0;
+}
+
+// BlendFunc( sfactor:i64 dfactor:i64 -- )
+int BlendFunc(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "BlendFunc", sig, 2, args);
+	glBlendFunc((GLenum)args[0].value.i, (GLenum)args[1].value.i);
+	return 0;
+}
+
+// BlendFuncSeparate( sfactorRGB:i64 dfactorRGB:i64 sfactorAlpha:i64 dfactorAlpha:i64 -- )
+int BlendFuncSeparate(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "BlendFuncSeparate", sig, 4, args);
+	glBlendFuncSeparate((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLenum)args[3].value.i);
+	return 0;
+}
+
+// BlendEquation( mode:i64 -- )
+int BlendEquation(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "BlendEquation", sig, 1, args);
+	glBlendEquation((GLenum)args[0].value.i);
+	return 0;
+}
+
+// BlendColor( red:f64 green:f64 blue:f64 alpha:f64 -- )
+int BlendColor(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "BlendColor", sig, 4, args);
+	glBlendColor((GLfloat)args[0].value.f, (GLfloat)args[1].value.f, (GLfloat)args[2].value.f, (GLfloat)args[3].value.f);
+	return 0;
+}
+
+// DepthFunc( func:i64 -- )
+int DepthFunc(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "DepthFunc", sig, 1, args);
+	glDepthFunc((GLenum)args[0].value.i);
+	return 0;
+}
+
+// DepthMask( flag:i64 -- )
+int DepthMask(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "DepthMask", sig, 1, args);
+	glDepthMask((GLboolean)args[0].value.i);
+	return 0;
+}
+
+// DepthRange( n:f64 f:f64 -- )
+int DepthRange(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DepthRange", sig, 2, args);
+	glDepthRange((GLdouble)args[0].value.f, (GLdouble)args[1].value.f);
+	return 0;
+}
+
+// ClearDepth( depth:f64 -- )
+int ClearDepth(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "ClearDepth", sig, 1, args);
+	glClearDepth((GLdouble)args[0].value.f);
+	return 0;
+}
+
+// ClearStencil( s:i64 -- )
+int ClearStencil(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "ClearStencil", sig, 1, args);
+	glClearStencil((GLint)args[0].value.i);
+	return 0;
+}
+
+// CullFace( mode:i64 -- )
+int CullFace(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "CullFace", sig, 1, args);
+	glCullFace((GLenum)args[0].value.i);
+	return 0;
+}
+
+// FrontFace( mode:i64 -- )
+int FrontFace(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "FrontFace", sig, 1, args);
+	glFrontFace((GLenum)args[0].value.i);
+	return 0;
+}
+
+// PolygonMode( face:i64 mode:i64 -- )
+int PolygonMode(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "PolygonMode", sig, 2, args);
+	glPolygonMode((GLenum)args[0].value.i, (GLenum)args[1].value.i);
+	return 0;
+}
+
+// LineWidth( width:f64 -- )
+int LineWidth(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "LineWidth", sig, 1, args);
+	glLineWidth((GLfloat)args[0].value.f);
+	return 0;
+}
+
+// PointSize( size:f64 -- )
+int PointSize(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "PointSize", sig, 1, args);
+	glPointSize((GLfloat)args[0].value.f);
+	return 0;
+}
+
+// Scissor( x:i64 y:i64 width:i64 height:i64 -- )
+int Scissor(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "Scissor", sig, 4, args);
+	glScissor((GLint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei)args[3].value.i);
+	return 0;
+}
+
+// ColorMask( red:i64 green:i64 blue:i64 alpha:i64 -- )
+int ColorMask(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ColorMask", sig, 4, args);
+	glColorMask((GLboolean)args[0].value.i, (GLboolean)args[1].value.i, (GLboolean)args[2].value.i, (GLboolean)args[3].value.i);
+	return 0;
+}
+
+// StencilFunc( func:i64 ref:i64 mask:i64 -- )
+int StencilFunc(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "StencilFunc", sig, 3, args);
+	glStencilFunc((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// StencilOp( fail:i64 zfail:i64 zpass:i64 -- )
+int StencilOp(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "StencilOp", sig, 3, args);
+	glStencilOp((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i);
+	return 0;
+}
+
+// StencilMask( mask:i64 -- )
+int StencilMask(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "StencilMask", sig, 1, args);
+	glStencilMask((GLuint)args[0].value.i);
+	return 0;
+}
+
+// IsEnabled( cap:i64 -- result:i64 )
+int IsEnabled(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "IsEnabled", sig, 1, args);
+	GLboolean result = glIsEnabled((GLenum)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// GetError( -- result:i64 )
+int GetError(qd_context* ctx) {
+	GLenum result = glGetError();
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// Finish( -- )
+int Finish(qd_context* ctx) {
+	(void)ctx;
+	glFinish();
+	return 0;
+}
+
+// Flush( -- )
+int Flush(qd_context* ctx) {
+	(void)ctx;
+	glFlush();
+	return 0;
+}
+
+// BufferSubData( target:i64 offset:i64 size:i64 data:ptr -- )
+int BufferSubData(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "BufferSubData", sig, 4, args);
+	glBufferSubData((GLenum)args[0].value.i, (GLintptr)args[1].value.i, (GLsizeiptr)args[2].value.i, (const void *)args[3].value.p);
+	return 0;
+}
+
+// MapBufferRange( target:i64 offset:i64 length:i64 access:i64 -- result:ptr )
+int MapBufferRange(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "MapBufferRange", sig, 4, args);
+	void * result = glMapBufferRange((GLenum)args[0].value.i, (GLintptr)args[1].value.i, (GLsizeiptr)args[2].value.i, (GLbitfield)args[3].value.i);
+	qd_push_p(ctx, (void*)result);
+	return 0;
+}
+
+// FlushMappedBufferRange( target:i64 offset:i64 length:i64 -- )
+int FlushMappedBufferRange(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "FlushMappedBufferRange", sig, 3, args);
+	glFlushMappedBufferRange((GLenum)args[0].value.i, (GLintptr)args[1].value.i, (GLsizeiptr)args[2].value.i);
+	return 0;
+}
+
+// UnmapBuffer( target:i64 -- result:i64 )
+int UnmapBuffer(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "UnmapBuffer", sig, 1, args);
+	GLboolean result = glUnmapBuffer((GLenum)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// CopyBufferSubData( readTarget:i64 writeTarget:i64 readOffset:i64 writeOffset:i64 size:i64 -- )
+int CopyBufferSubData(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "CopyBufferSubData", sig, 5, args);
+	glCopyBufferSubData((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLintptr)args[2].value.i, (GLintptr)args[3].value.i, (GLsizeiptr)args[4].value.i);
+	return 0;
+}
+
+// EnableVertexAttribArray( index:i64 -- )
+int EnableVertexAttribArray(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "EnableVertexAttribArray", sig, 1, args);
+	glEnableVertexAttribArray((GLuint)args[0].value.i);
+	return 0;
+}
+
+// VertexAttribPointer( index:i64 size:i64 type:i64 normalized:i64 stride:i64 pointer:i64 -- )
+int VertexAttribPointer(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "VertexAttribPointer", sig, 6, args);
+	glVertexAttribPointer((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLboolean)args[3].value.i, (GLsizei)args[4].value.i, (const void *)(intptr_t)args[5].value.i);
+	return 0;
+}
+
+// DisableVertexAttribArray( index:i64 -- )
+int DisableVertexAttribArray(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "DisableVertexAttribArray", sig, 1, args);
+	glDisableVertexAttribArray((GLuint)args[0].value.i);
+	return 0;
+}
+
+// VertexAttribIPointer( index:i64 size:i64 type:i64 stride:i64 pointer:i64 -- )
+int VertexAttribIPointer(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "VertexAttribIPointer", sig, 5, args);
+	glVertexAttribIPointer((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (const void *)(intptr_t)args[4].value.i);
+	return 0;
+}
+
+// VertexAttribDivisor( index:i64 divisor:i64 -- )
+int VertexAttribDivisor(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribDivisor", sig, 2, args);
+	glVertexAttribDivisor((GLuint)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// CreateShader( type:i64 -- result:i64 )
+int CreateShader(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "CreateShader", sig, 1, args);
+	GLuint result = glCreateShader((GLenum)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// CompileShader( shader:i64 -- )
+int CompileShader(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "CompileShader", sig, 1, args);
+	glCompileShader((GLuint)args[0].value.i);
+	return 0;
+}
+
+// CreateProgram( -- result:i64 )
+int CreateProgram(qd_context* ctx) {
+	GLuint result = glCreateProgram();
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// AttachShader( program:i64 shader:i64 -- )
+int AttachShader(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "AttachShader", sig, 2, args);
+	glAttachShader((GLuint)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// Uniform1f( location:i64 v0:f64 -- )
+int Uniform1f(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "Uniform1f", sig, 2, args);
+	glUniform1f((GLint)args[0].value.i, (GLfloat)args[1].value.f);
+	return 0;
+}
+
+// Uniform1i( location:i64 v0:i64 -- )
+int Uniform1i(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "Uniform1i", sig, 2, args);
+	glUniform1i((GLint)args[0].value.i, (GLint)args[1].value.i);
+	return 0;
+}
+
+// Uniform3f( location:i64 v0:f64 v1:f64 v2:f64 -- )
+int Uniform3f(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "Uniform3f", sig, 4, args);
+	glUniform3f((GLint)args[0].value.i, (GLfloat)args[1].value.f, (GLfloat)args[2].value.f, (GLfloat)args[3].value.f);
+	return 0;
+}
+
+// Uniform4f( location:i64 v0:f64 v1:f64 v2:f64 v3:f64 -- )
+int Uniform4f(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "Uniform4f", sig, 5, args);
+	glUniform4f((GLint)args[0].value.i, (GLfloat)args[1].value.f, (GLfloat)args[2].value.f, (GLfloat)args[3].value.f, (GLfloat)args[4].value.f);
+	return 0;
+}
+
+// Uniform2f( location:i64 v0:f64 v1:f64 -- )
+int Uniform2f(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "Uniform2f", sig, 3, args);
+	glUniform2f((GLint)args[0].value.i, (GLfloat)args[1].value.f, (GLfloat)args[2].value.f);
+	return 0;
+}
+
+// Uniform1ui( location:i64 v0:i64 -- )
+int Uniform1ui(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "Uniform1ui", sig, 2, args);
+	glUniform1ui((GLint)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// Uniform2i( location:i64 v0:i64 v1:i64 -- )
+int Uniform2i(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "Uniform2i", sig, 3, args);
+	glUniform2i((GLint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i);
+	return 0;
+}
+
+// Uniform3i( location:i64 v0:i64 v1:i64 v2:i64 -- )
+int Uniform3i(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "Uniform3i", sig, 4, args);
+	glUniform3i((GLint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i);
+	return 0;
+}
+
+// Uniform4i( location:i64 v0:i64 v1:i64 v2:i64 v3:i64 -- )
+int Uniform4i(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "Uniform4i", sig, 5, args);
+	glUniform4i((GLint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i);
+	return 0;
+}
+
+// UniformBlockBinding( program:i64 uniformBlockIndex:i64 uniformBlockBinding:i64 -- )
+int UniformBlockBinding(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "UniformBlockBinding", sig, 3, args);
+	glUniformBlockBinding((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// DrawArrays( mode:i64 first:i64 count:i64 -- )
+int DrawArrays(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "DrawArrays", sig, 3, args);
+	glDrawArrays((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i);
+	return 0;
+}
+
+// DrawElements( mode:i64 count:i64 type:i64 indices:i64 -- )
+int DrawElements(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "DrawElements", sig, 4, args);
+	glDrawElements((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (const void *)(intptr_t)args[3].value.i);
+	return 0;
+}
+
+// DrawElementsBaseVertex( mode:i64 count:i64 type:i64 indices:i64 basevertex:i64 -- )
+int DrawElementsBaseVertex(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "DrawElementsBaseVertex", sig, 5, args);
+	glDrawElementsBaseVertex((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (const void *)(intptr_t)args[3].value.i, (GLint)args[4].value.i);
+	return 0;
+}
+
+// DrawArraysInstanced( mode:i64 first:i64 count:i64 instancecount:i64 -- )
+int DrawArraysInstanced(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "DrawArraysInstanced", sig, 4, args);
+	glDrawArraysInstanced((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei)args[3].value.i);
+	return 0;
+}
+
+// DrawElementsInstanced( mode:i64 count:i64 type:i64 indices:i64 instancecount:i64 -- )
+int DrawElementsInstanced(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "DrawElementsInstanced", sig, 5, args);
+	glDrawElementsInstanced((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (const void *)(intptr_t)args[3].value.i, (GLsizei)args[4].value.i);
+	return 0;
+}
+
+// DrawArraysInstancedBaseInstance( mode:i64 first:i64 count:i64 instancecount:i64 baseinstance:i64 -- )
+int DrawArraysInstancedBaseInstance(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "DrawArraysInstancedBaseInstance", sig, 5, args);
+	glDrawArraysInstancedBaseInstance((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei)args[3].value.i, (GLuint)args[4].value.i);
+	return 0;
+}
+
+// DrawElementsInstancedBaseVertexBaseInstance( mode:i64 count:i64 type:i64 indices:i64 instancecount:i64 basevertex:i64 baseinstance:i64 -- )
+int DrawElementsInstancedBaseVertexBaseInstance(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "DrawElementsInstancedBaseVertexBaseInstance", sig, 7, args);
+	glDrawElementsInstancedBaseVertexBaseInstance((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (const void *)(intptr_t)args[3].value.i, (GLsizei)args[4].value.i, (GLint)args[5].value.i, (GLuint)args[6].value.i);
+	return 0;
+}
+
+// DrawArraysIndirect( mode:i64 indirect:i64 -- )
+int DrawArraysIndirect(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DrawArraysIndirect", sig, 2, args);
+	glDrawArraysIndirect((GLenum)args[0].value.i, (const void *)(intptr_t)args[1].value.i);
+	return 0;
+}
+
+// DrawElementsIndirect( mode:i64 type:i64 indirect:i64 -- )
+int DrawElementsIndirect(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "DrawElementsIndirect", sig, 3, args);
+	glDrawElementsIndirect((GLenum)args[0].value.i, (GLenum)args[1].value.i, (const void *)(intptr_t)args[2].value.i);
+	return 0;
+}
+
+// MultiDrawArraysIndirect( mode:i64 indirect:i64 drawcount:i64 stride:i64 -- )
+int MultiDrawArraysIndirect(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "MultiDrawArraysIndirect", sig, 4, args);
+	glMultiDrawArraysIndirect((GLenum)args[0].value.i, (const void *)(intptr_t)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei)args[3].value.i);
+	return 0;
+}
+
+// MultiDrawElementsIndirect( mode:i64 type:i64 indirect:i64 drawcount:i64 stride:i64 -- )
+int MultiDrawElementsIndirect(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "MultiDrawElementsIndirect", sig, 5, args);
+	glMultiDrawElementsIndirect((GLenum)args[0].value.i, (GLenum)args[1].value.i, (const void *)(intptr_t)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i);
+	return 0;
+}
+
+// BindFramebuffer( target:i64 framebuffer:i64 -- )
+int BindFramebuffer(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "BindFramebuffer", sig, 2, args);
+	glBindFramebuffer((GLenum)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// BindRenderbuffer( target:i64 renderbuffer:i64 -- )
+int BindRenderbuffer(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "BindRenderbuffer", sig, 2, args);
+	glBindRenderbuffer((GLenum)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// FramebufferTexture2D( target:i64 attachment:i64 textarget:i64 texture:i64 level:i64 -- )
+int FramebufferTexture2D(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "FramebufferTexture2D", sig, 5, args);
+	glFramebufferTexture2D((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLuint)args[3].value.i, (GLint)args[4].value.i);
+	return 0;
+}
+
+// FramebufferRenderbuffer( target:i64 attachment:i64 renderbuffertarget:i64 renderbuffer:i64 -- )
+int FramebufferRenderbuffer(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "FramebufferRenderbuffer", sig, 4, args);
+	glFramebufferRenderbuffer((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLuint)args[3].value.i);
+	return 0;
+}
+
+// RenderbufferStorage( target:i64 internalformat:i64 width:i64 height:i64 -- )
+int RenderbufferStorage(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "RenderbufferStorage", sig, 4, args);
+	glRenderbufferStorage((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei)args[3].value.i);
+	return 0;
+}
+
+// CheckFramebufferStatus( target:i64 -- result:i64 )
+int CheckFramebufferStatus(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "CheckFramebufferStatus", sig, 1, args);
+	GLenum result = glCheckFramebufferStatus((GLenum)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// DrawBuffer( buf:i64 -- )
+int DrawBuffer(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "DrawBuffer", sig, 1, args);
+	glDrawBuffer((GLenum)args[0].value.i);
+	return 0;
+}
+
+// ReadBuffer( src:i64 -- )
+int ReadBuffer(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "ReadBuffer", sig, 1, args);
+	glReadBuffer((GLenum)args[0].value.i);
+	return 0;
+}
+
+// ReadPixels( x:i64 y:i64 width:i64 height:i64 format:i64 type:i64 pixels:ptr -- )
+int ReadPixels(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "ReadPixels", sig, 7, args);
+	glReadPixels((GLint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei)args[3].value.i, (GLenum)args[4].value.i, (GLenum)args[5].value.i, (void *)args[6].value.p);
+	return 0;
+}
+
+// TexParameteri( target:i64 pname:i64 param:i64 -- )
+int TexParameteri(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TexParameteri", sig, 3, args);
+	glTexParameteri((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLint)args[2].value.i);
+	return 0;
+}
+
+// GenerateMipmap( target:i64 -- )
+int GenerateMipmap(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "GenerateMipmap", sig, 1, args);
+	glGenerateMipmap((GLenum)args[0].value.i);
+	return 0;
+}
+
+// TexStorage2D( target:i64 levels:i64 internalformat:i64 width:i64 height:i64 -- )
+int TexStorage2D(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "TexStorage2D", sig, 5, args);
+	glTexStorage2D((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i);
+	return 0;
+}
+
+// TexStorage3D( target:i64 levels:i64 internalformat:i64 width:i64 height:i64 depth:i64 -- )
+int TexStorage3D(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "TexStorage3D", sig, 6, args);
+	glTexStorage3D((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i, (GLsizei)args[5].value.i);
+	return 0;
+}
+
+// Hint( target:i64 mode:i64 -- )
+int Hint(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "Hint", sig, 2, args);
+	glHint((GLenum)args[0].value.i, (GLenum)args[1].value.i);
+	return 0;
+}
+
+// TexParameterf( target:i64 pname:i64 param:f64 -- )
+int TexParameterf(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TexParameterf", sig, 3, args);
+	glTexParameterf((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLfloat)args[2].value.f);
+	return 0;
+}
+
+// TexParameterfv( target:i64 pname:i64 params:ptr -- )
+int TexParameterfv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TexParameterfv", sig, 3, args);
+	glTexParameterfv((GLenum)args[0].value.i, (GLenum)args[1].value.i, (const GLfloat *)args[2].value.p);
+	return 0;
+}
+
+// TexParameteriv( target:i64 pname:i64 params:ptr -- )
+int TexParameteriv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TexParameteriv", sig, 3, args);
+	glTexParameteriv((GLenum)args[0].value.i, (GLenum)args[1].value.i, (const GLint *)args[2].value.p);
+	return 0;
+}
+
+// TexImage1D( target:i64 level:i64 internalformat:i64 width:i64 border:i64 format:i64 type:i64 pixels:ptr -- )
+int TexImage1D(qd_context* ctx) {
+	static const int sig[8] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[8];
+	gl_pop_args(ctx, "TexImage1D", sig, 8, args);
+	glTexImage1D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLsizei)args[3].value.i, (GLint)args[4].value.i, (GLenum)args[5].value.i, (GLenum)args[6].value.i, (const void *)args[7].value.p);
+	return 0;
+}
+
+// TexImage2D( target:i64 level:i64 internalformat:i64 width:i64 height:i64 border:i64 format:i64 type:i64 pixels:ptr -- )
+int TexImage2D(qd_context* ctx) {
+	static const int sig[9] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[9];
+	gl_pop_args(ctx, "TexImage2D", sig, 9, args);
+	glTexImage2D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i, (GLint)args[5].value.i, (GLenum)args[6].value.i, (GLenum)args[7].value.i, (const void *)args[8].value.p);
+	return 0;
+}
+
+// LogicOp( opcode:i64 -- )
+int LogicOp(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "LogicOp", sig, 1, args);
+	glLogicOp((GLenum)args[0].value.i);
+	return 0;
+}
+
+// PixelStoref( pname:i64 param:f64 -- )
+int PixelStoref(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "PixelStoref", sig, 2, args);
+	glPixelStoref((GLenum)args[0].value.i, (GLfloat)args[1].value.f);
+	return 0;
+}
+
+// GetBooleanv( pname:i64 data:ptr -- )
+int GetBooleanv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GetBooleanv", sig, 2, args);
+	glGetBooleanv((GLenum)args[0].value.i, (GLboolean *)args[1].value.p);
+	return 0;
+}
+
+// GetDoublev( pname:i64 data:ptr -- )
+int GetDoublev(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GetDoublev", sig, 2, args);
+	glGetDoublev((GLenum)args[0].value.i, (GLdouble *)args[1].value.p);
+	return 0;
+}
+
+// GetFloatv( pname:i64 data:ptr -- )
+int GetFloatv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GetFloatv", sig, 2, args);
+	glGetFloatv((GLenum)args[0].value.i, (GLfloat *)args[1].value.p);
+	return 0;
+}
+
+// GetIntegerv( pname:i64 data:ptr -- )
+int GetIntegerv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GetIntegerv", sig, 2, args);
+	glGetIntegerv((GLenum)args[0].value.i, (GLint *)args[1].value.p);
+	return 0;
+}
+
+// GetString( name:i64 -- result:str )
+int GetString(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "GetString", sig, 1, args);
+	const GLubyte * result = glGetString((GLenum)args[0].value.i);
+	qd_push_s(ctx, result ? (const char*)result : "");
+	return 0;
+}
+
+// GetTexImage( target:i64 level:i64 format:i64 type:i64 pixels:ptr -- )
+int GetTexImage(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "GetTexImage", sig, 5, args);
+	glGetTexImage((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLenum)args[3].value.i, (void *)args[4].value.p);
+	return 0;
+}
+
+// GetTexParameterfv( target:i64 pname:i64 params:ptr -- )
+int GetTexParameterfv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetTexParameterfv", sig, 3, args);
+	glGetTexParameterfv((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLfloat *)args[2].value.p);
+	return 0;
+}
+
+// GetTexParameteriv( target:i64 pname:i64 params:ptr -- )
+int GetTexParameteriv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetTexParameteriv", sig, 3, args);
+	glGetTexParameteriv((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetTexLevelParameterfv( target:i64 level:i64 pname:i64 params:ptr -- )
+int GetTexLevelParameterfv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetTexLevelParameterfv", sig, 4, args);
+	glGetTexLevelParameterfv((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLfloat *)args[3].value.p);
+	return 0;
+}
+
+// GetTexLevelParameteriv( target:i64 level:i64 pname:i64 params:ptr -- )
+int GetTexLevelParameteriv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetTexLevelParameteriv", sig, 4, args);
+	glGetTexLevelParameteriv((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLint *)args[3].value.p);
+	return 0;
+}
+
+// PolygonOffset( factor:f64 units:f64 -- )
+int PolygonOffset(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "PolygonOffset", sig, 2, args);
+	glPolygonOffset((GLfloat)args[0].value.f, (GLfloat)args[1].value.f);
+	return 0;
+}
+
+// CopyTexImage1D( target:i64 level:i64 internalformat:i64 x:i64 y:i64 width:i64 border:i64 -- )
+int CopyTexImage1D(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "CopyTexImage1D", sig, 7, args);
+	glCopyTexImage1D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLsizei)args[5].value.i, (GLint)args[6].value.i);
+	return 0;
+}
+
+// CopyTexImage2D( target:i64 level:i64 internalformat:i64 x:i64 y:i64 width:i64 height:i64 border:i64 -- )
+int CopyTexImage2D(qd_context* ctx) {
+	static const int sig[8] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[8];
+	gl_pop_args(ctx, "CopyTexImage2D", sig, 8, args);
+	glCopyTexImage2D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLsizei)args[5].value.i, (GLsizei)args[6].value.i, (GLint)args[7].value.i);
+	return 0;
+}
+
+// CopyTexSubImage1D( target:i64 level:i64 xoffset:i64 x:i64 y:i64 width:i64 -- )
+int CopyTexSubImage1D(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "CopyTexSubImage1D", sig, 6, args);
+	glCopyTexSubImage1D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLsizei)args[5].value.i);
+	return 0;
+}
+
+// CopyTexSubImage2D( target:i64 level:i64 xoffset:i64 yoffset:i64 x:i64 y:i64 width:i64 height:i64 -- )
+int CopyTexSubImage2D(qd_context* ctx) {
+	static const int sig[8] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[8];
+	gl_pop_args(ctx, "CopyTexSubImage2D", sig, 8, args);
+	glCopyTexSubImage2D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLint)args[5].value.i, (GLsizei)args[6].value.i, (GLsizei)args[7].value.i);
+	return 0;
+}
+
+// TexSubImage1D( target:i64 level:i64 xoffset:i64 width:i64 format:i64 type:i64 pixels:ptr -- )
+int TexSubImage1D(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "TexSubImage1D", sig, 7, args);
+	glTexSubImage1D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLsizei)args[3].value.i, (GLenum)args[4].value.i, (GLenum)args[5].value.i, (const void *)args[6].value.p);
+	return 0;
+}
+
+// DeleteTextures( n:i64 textures:ptr -- )
+int DeleteTextures(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DeleteTextures", sig, 2, args);
+	glDeleteTextures((GLsizei)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// GenTextures( n:i64 textures:ptr -- )
+int GenTextures(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GenTextures", sig, 2, args);
+	glGenTextures((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// IsTexture( texture:i64 -- result:i64 )
+int IsTexture(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "IsTexture", sig, 1, args);
+	GLboolean result = glIsTexture((GLuint)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// DrawRangeElements( mode:i64 start:i64 end:i64 count:i64 type:i64 indices:i64 -- )
+int DrawRangeElements(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "DrawRangeElements", sig, 6, args);
+	glDrawRangeElements((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i, (GLsizei)args[3].value.i, (GLenum)args[4].value.i, (const void *)(intptr_t)args[5].value.i);
+	return 0;
+}
+
+// TexImage3D( target:i64 level:i64 internalformat:i64 width:i64 height:i64 depth:i64 border:i64 format:i64 type:i64 pixels:ptr -- )
+int TexImage3D(qd_context* ctx) {
+	static const int sig[10] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[10];
+	gl_pop_args(ctx, "TexImage3D", sig, 10, args);
+	glTexImage3D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i, (GLsizei)args[5].value.i, (GLint)args[6].value.i, (GLenum)args[7].value.i, (GLenum)args[8].value.i, (const void *)args[9].value.p);
+	return 0;
+}
+
+// CopyTexSubImage3D( target:i64 level:i64 xoffset:i64 yoffset:i64 zoffset:i64 x:i64 y:i64 width:i64 height:i64 -- )
+int CopyTexSubImage3D(qd_context* ctx) {
+	static const int sig[9] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[9];
+	gl_pop_args(ctx, "CopyTexSubImage3D", sig, 9, args);
+	glCopyTexSubImage3D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLint)args[5].value.i, (GLint)args[6].value.i, (GLsizei)args[7].value.i, (GLsizei)args[8].value.i);
+	return 0;
+}
+
+// SampleCoverage( value:f64 invert:i64 -- )
+int SampleCoverage(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "SampleCoverage", sig, 2, args);
+	glSampleCoverage((GLfloat)args[0].value.f, (GLboolean)args[1].value.i);
+	return 0;
+}
+
+// CompressedTexImage3D( target:i64 level:i64 internalformat:i64 width:i64 height:i64 depth:i64 border:i64 imageSize:i64 data:ptr -- )
+int CompressedTexImage3D(qd_context* ctx) {
+	static const int sig[9] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[9];
+	gl_pop_args(ctx, "CompressedTexImage3D", sig, 9, args);
+	glCompressedTexImage3D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i, (GLsizei)args[5].value.i, (GLint)args[6].value.i, (GLsizei)args[7].value.i, (const void *)args[8].value.p);
+	return 0;
+}
+
+// CompressedTexImage2D( target:i64 level:i64 internalformat:i64 width:i64 height:i64 border:i64 imageSize:i64 data:ptr -- )
+int CompressedTexImage2D(qd_context* ctx) {
+	static const int sig[8] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[8];
+	gl_pop_args(ctx, "CompressedTexImage2D", sig, 8, args);
+	glCompressedTexImage2D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i, (GLint)args[5].value.i, (GLsizei)args[6].value.i, (const void *)args[7].value.p);
+	return 0;
+}
+
+// CompressedTexImage1D( target:i64 level:i64 internalformat:i64 width:i64 border:i64 imageSize:i64 data:ptr -- )
+int CompressedTexImage1D(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "CompressedTexImage1D", sig, 7, args);
+	glCompressedTexImage1D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLint)args[4].value.i, (GLsizei)args[5].value.i, (const void *)args[6].value.p);
+	return 0;
+}
+
+// CompressedTexSubImage3D( target:i64 level:i64 xoffset:i64 yoffset:i64 zoffset:i64 width:i64 height:i64 depth:i64 format:i64 imageSize:i64 data:ptr -- )
+int CompressedTexSubImage3D(qd_context* ctx) {
+	static const int sig[11] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[11];
+	gl_pop_args(ctx, "CompressedTexSubImage3D", sig, 11, args);
+	glCompressedTexSubImage3D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLsizei)args[5].value.i, (GLsizei)args[6].value.i, (GLsizei)args[7].value.i, (GLenum)args[8].value.i, (GLsizei)args[9].value.i, (const void *)args[10].value.p);
+	return 0;
+}
+
+// CompressedTexSubImage2D( target:i64 level:i64 xoffset:i64 yoffset:i64 width:i64 height:i64 format:i64 imageSize:i64 data:ptr -- )
+int CompressedTexSubImage2D(qd_context* ctx) {
+	static const int sig[9] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[9];
+	gl_pop_args(ctx, "CompressedTexSubImage2D", sig, 9, args);
+	glCompressedTexSubImage2D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLsizei)args[4].value.i, (GLsizei)args[5].value.i, (GLenum)args[6].value.i, (GLsizei)args[7].value.i, (const void *)args[8].value.p);
+	return 0;
+}
+
+// CompressedTexSubImage1D( target:i64 level:i64 xoffset:i64 width:i64 format:i64 imageSize:i64 data:ptr -- )
+int CompressedTexSubImage1D(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "CompressedTexSubImage1D", sig, 7, args);
+	glCompressedTexSubImage1D((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLsizei)args[3].value.i, (GLenum)args[4].value.i, (GLsizei)args[5].value.i, (const void *)args[6].value.p);
+	return 0;
+}
+
+// GetCompressedTexImage( target:i64 level:i64 img:ptr -- )
+int GetCompressedTexImage(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetCompressedTexImage", sig, 3, args);
+	glGetCompressedTexImage((GLenum)args[0].value.i, (GLint)args[1].value.i, (void *)args[2].value.p);
+	return 0;
+}
+
+// MultiDrawArrays( mode:i64 first:ptr count:ptr drawcount:i64 -- )
+int MultiDrawArrays(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "MultiDrawArrays", sig, 4, args);
+	glMultiDrawArrays((GLenum)args[0].value.i, (const GLint *)args[1].value.p, (const GLsizei *)args[2].value.p, (GLsizei)args[3].value.i);
+	return 0;
+}
+
+// PointParameterf( pname:i64 param:f64 -- )
+int PointParameterf(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "PointParameterf", sig, 2, args);
+	glPointParameterf((GLenum)args[0].value.i, (GLfloat)args[1].value.f);
+	return 0;
+}
+
+// PointParameterfv( pname:i64 params:ptr -- )
+int PointParameterfv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "PointParameterfv", sig, 2, args);
+	glPointParameterfv((GLenum)args[0].value.i, (const GLfloat *)args[1].value.p);
+	return 0;
+}
+
+// PointParameteri( pname:i64 param:i64 -- )
+int PointParameteri(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "PointParameteri", sig, 2, args);
+	glPointParameteri((GLenum)args[0].value.i, (GLint)args[1].value.i);
+	return 0;
+}
+
+// PointParameteriv( pname:i64 params:ptr -- )
+int PointParameteriv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "PointParameteriv", sig, 2, args);
+	glPointParameteriv((GLenum)args[0].value.i, (const GLint *)args[1].value.p);
+	return 0;
+}
+
+// GenQueries( n:i64 ids:ptr -- )
+int GenQueries(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GenQueries", sig, 2, args);
+	glGenQueries((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// DeleteQueries( n:i64 ids:ptr -- )
+int DeleteQueries(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DeleteQueries", sig, 2, args);
+	glDeleteQueries((GLsizei)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// IsQuery( id:i64 -- result:i64 )
+int IsQuery(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "IsQuery", sig, 1, args);
+	GLboolean result = glIsQuery((GLuint)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// BeginQuery( target:i64 id:i64 -- )
+int BeginQuery(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "BeginQuery", sig, 2, args);
+	glBeginQuery((GLenum)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// EndQuery( target:i64 -- )
+int EndQuery(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "EndQuery", sig, 1, args);
+	glEndQuery((GLenum)args[0].value.i);
+	return 0;
+}
+
+// GetQueryiv( target:i64 pname:i64 params:ptr -- )
+int GetQueryiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetQueryiv", sig, 3, args);
+	glGetQueryiv((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetQueryObjectiv( id:i64 pname:i64 params:ptr -- )
+int GetQueryObjectiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetQueryObjectiv", sig, 3, args);
+	glGetQueryObjectiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetQueryObjectuiv( id:i64 pname:i64 params:ptr -- )
+int GetQueryObjectuiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetQueryObjectuiv", sig, 3, args);
+	glGetQueryObjectuiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint *)args[2].value.p);
+	return 0;
+}
+
+// DeleteBuffers( n:i64 buffers:ptr -- )
+int DeleteBuffers(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DeleteBuffers", sig, 2, args);
+	glDeleteBuffers((GLsizei)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// GenBuffers( n:i64 buffers:ptr -- )
+int GenBuffers(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GenBuffers", sig, 2, args);
+	glGenBuffers((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// IsBuffer( buffer:i64 -- result:i64 )
+int IsBuffer(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "IsBuffer", sig, 1, args);
+	GLboolean result = glIsBuffer((GLuint)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// BufferData( target:i64 size:i64 data:ptr usage:i64 -- )
+int BufferData(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "BufferData", sig, 4, args);
+	glBufferData((GLenum)args[0].value.i, (GLsizeiptr)args[1].value.i, (const void *)args[2].value.p, (GLenum)args[3].value.i);
+	return 0;
+}
+
+// GetBufferSubData( target:i64 offset:i64 size:i64 data:ptr -- )
+int GetBufferSubData(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetBufferSubData", sig, 4, args);
+	glGetBufferSubData((GLenum)args[0].value.i, (GLintptr)args[1].value.i, (GLsizeiptr)args[2].value.i, (void *)args[3].value.p);
+	return 0;
+}
+
+// MapBuffer( target:i64 access:i64 -- result:ptr )
+int MapBuffer(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "MapBuffer", sig, 2, args);
+	void * result = glMapBuffer((GLenum)args[0].value.i, (GLenum)args[1].value.i);
+	qd_push_p(ctx, (void*)result);
+	return 0;
+}
+
+// GetBufferParameteriv( target:i64 pname:i64 params:ptr -- )
+int GetBufferParameteriv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetBufferParameteriv", sig, 3, args);
+	glGetBufferParameteriv((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// BlendEquationSeparate( modeRGB:i64 modeAlpha:i64 -- )
+int BlendEquationSeparate(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "BlendEquationSeparate", sig, 2, args);
+	glBlendEquationSeparate((GLenum)args[0].value.i, (GLenum)args[1].value.i);
+	return 0;
+}
+
+// DrawBuffers( n:i64 bufs:ptr -- )
+int DrawBuffers(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DrawBuffers", sig, 2, args);
+	glDrawBuffers((GLsizei)args[0].value.i, (const GLenum *)args[1].value.p);
+	return 0;
+}
+
+// StencilOpSeparate( face:i64 sfail:i64 dpfail:i64 dppass:i64 -- )
+int StencilOpSeparate(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "StencilOpSeparate", sig, 4, args);
+	glStencilOpSeparate((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLenum)args[3].value.i);
+	return 0;
+}
+
+// StencilFuncSeparate( face:i64 func:i64 ref:i64 mask:i64 -- )
+int StencilFuncSeparate(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "StencilFuncSeparate", sig, 4, args);
+	glStencilFuncSeparate((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLint)args[2].value.i, (GLuint)args[3].value.i);
+	return 0;
+}
+
+// StencilMaskSeparate( face:i64 mask:i64 -- )
+int StencilMaskSeparate(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "StencilMaskSeparate", sig, 2, args);
+	glStencilMaskSeparate((GLenum)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// BindAttribLocation( program:i64 index:i64 name:str -- )
+int BindAttribLocation(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "BindAttribLocation", sig, 3, args);
+	glBindAttribLocation((GLuint)args[0].value.i, (GLuint)args[1].value.i, qd_string_data(args[2].value.s));
+	qd_string_release(args[2].value.s);
+	return 0;
+}
+
+// DetachShader( program:i64 shader:i64 -- )
+int DetachShader(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DetachShader", sig, 2, args);
+	glDetachShader((GLuint)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// GetActiveAttrib( program:i64 index:i64 bufSize:i64 length:ptr size:ptr type:ptr name:ptr -- )
+int GetActiveAttrib(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "GetActiveAttrib", sig, 7, args);
+	glGetActiveAttrib((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei *)args[3].value.p, (GLint *)args[4].value.p, (GLenum *)args[5].value.p, (GLchar *)args[6].value.p);
+	return 0;
+}
+
+// GetActiveUniform( program:i64 index:i64 bufSize:i64 length:ptr size:ptr type:ptr name:ptr -- )
+int GetActiveUniform(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "GetActiveUniform", sig, 7, args);
+	glGetActiveUniform((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei *)args[3].value.p, (GLint *)args[4].value.p, (GLenum *)args[5].value.p, (GLchar *)args[6].value.p);
+	return 0;
+}
+
+// GetAttachedShaders( program:i64 maxCount:i64 count:ptr shaders:ptr -- )
+int GetAttachedShaders(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetAttachedShaders", sig, 4, args);
+	glGetAttachedShaders((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (GLsizei *)args[2].value.p, (GLuint *)args[3].value.p);
+	return 0;
+}
+
+// GetAttribLocation( program:i64 name:str -- result:i64 )
+int GetAttribLocation(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GetAttribLocation", sig, 2, args);
+	GLint result = glGetAttribLocation((GLuint)args[0].value.i, qd_string_data(args[1].value.s));
+	qd_string_release(args[1].value.s);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// GetProgramiv( program:i64 pname:i64 params:ptr -- )
+int GetProgramiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetProgramiv", sig, 3, args);
+	glGetProgramiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetShaderiv( shader:i64 pname:i64 params:ptr -- )
+int GetShaderiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetShaderiv", sig, 3, args);
+	glGetShaderiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetShaderSource( shader:i64 bufSize:i64 length:ptr source:ptr -- )
+int GetShaderSource(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetShaderSource", sig, 4, args);
+	glGetShaderSource((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (GLsizei *)args[2].value.p, (GLchar *)args[3].value.p);
+	return 0;
+}
+
+// GetUniformfv( program:i64 location:i64 params:ptr -- )
+int GetUniformfv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetUniformfv", sig, 3, args);
+	glGetUniformfv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLfloat *)args[2].value.p);
+	return 0;
+}
+
+// GetUniformiv( program:i64 location:i64 params:ptr -- )
+int GetUniformiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetUniformiv", sig, 3, args);
+	glGetUniformiv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetVertexAttribdv( index:i64 pname:i64 params:ptr -- )
+int GetVertexAttribdv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetVertexAttribdv", sig, 3, args);
+	glGetVertexAttribdv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLdouble *)args[2].value.p);
+	return 0;
+}
+
+// GetVertexAttribfv( index:i64 pname:i64 params:ptr -- )
+int GetVertexAttribfv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetVertexAttribfv", sig, 3, args);
+	glGetVertexAttribfv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLfloat *)args[2].value.p);
+	return 0;
+}
+
+// GetVertexAttribiv( index:i64 pname:i64 params:ptr -- )
+int GetVertexAttribiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetVertexAttribiv", sig, 3, args);
+	glGetVertexAttribiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// IsProgram( program:i64 -- result:i64 )
+int IsProgram(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "IsProgram", sig, 1, args);
+	GLboolean result = glIsProgram((GLuint)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// IsShader( shader:i64 -- result:i64 )
+int IsShader(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "IsShader", sig, 1, args);
+	GLboolean result = glIsShader((GLuint)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// ValidateProgram( program:i64 -- )
+int ValidateProgram(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "ValidateProgram", sig, 1, args);
+	glValidateProgram((GLuint)args[0].value.i);
+	return 0;
+}
+
+// VertexAttrib1d( index:i64 x:f64 -- )
+int VertexAttrib1d(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib1d", sig, 2, args);
+	glVertexAttrib1d((GLuint)args[0].value.i, (GLdouble)args[1].value.f);
+	return 0;
+}
+
+// VertexAttrib1dv( index:i64 v:ptr -- )
+int VertexAttrib1dv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib1dv", sig, 2, args);
+	glVertexAttrib1dv((GLuint)args[0].value.i, (const GLdouble *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib1f( index:i64 x:f64 -- )
+int VertexAttrib1f(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib1f", sig, 2, args);
+	glVertexAttrib1f((GLuint)args[0].value.i, (GLfloat)args[1].value.f);
+	return 0;
+}
+
+// VertexAttrib1fv( index:i64 v:ptr -- )
+int VertexAttrib1fv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib1fv", sig, 2, args);
+	glVertexAttrib1fv((GLuint)args[0].value.i, (const GLfloat *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib1s( index:i64 x:i64 -- )
+int VertexAttrib1s(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib1s", sig, 2, args);
+	glVertexAttrib1s((GLuint)args[0].value.i, (GLshort)args[1].value.i);
+	return 0;
+}
+
+// VertexAttrib1sv( index:i64 v:ptr -- )
+int VertexAttrib1sv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib1sv", sig, 2, args);
+	glVertexAttrib1sv((GLuint)args[0].value.i, (const GLshort *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib2d( index:i64 x:f64 y:f64 -- )
+int VertexAttrib2d(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "VertexAttrib2d", sig, 3, args);
+	glVertexAttrib2d((GLuint)args[0].value.i, (GLdouble)args[1].value.f, (GLdouble)args[2].value.f);
+	return 0;
+}
+
+// VertexAttrib2dv( index:i64 v:ptr -- )
+int VertexAttrib2dv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib2dv", sig, 2, args);
+	glVertexAttrib2dv((GLuint)args[0].value.i, (const GLdouble *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib2f( index:i64 x:f64 y:f64 -- )
+int VertexAttrib2f(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "VertexAttrib2f", sig, 3, args);
+	glVertexAttrib2f((GLuint)args[0].value.i, (GLfloat)args[1].value.f, (GLfloat)args[2].value.f);
+	return 0;
+}
+
+// VertexAttrib2fv( index:i64 v:ptr -- )
+int VertexAttrib2fv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib2fv", sig, 2, args);
+	glVertexAttrib2fv((GLuint)args[0].value.i, (const GLfloat *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib2s( index:i64 x:i64 y:i64 -- )
+int VertexAttrib2s(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "VertexAttrib2s", sig, 3, args);
+	glVertexAttrib2s((GLuint)args[0].value.i, (GLshort)args[1].value.i, (GLshort)args[2].value.i);
+	return 0;
+}
+
+// VertexAttrib2sv( index:i64 v:ptr -- )
+int VertexAttrib2sv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib2sv", sig, 2, args);
+	glVertexAttrib2sv((GLuint)args[0].value.i, (const GLshort *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib3d( index:i64 x:f64 y:f64 z:f64 -- )
+int VertexAttrib3d(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttrib3d", sig, 4, args);
+	glVertexAttrib3d((GLuint)args[0].value.i, (GLdouble)args[1].value.f, (GLdouble)args[2].value.f, (GLdouble)args[3].value.f);
+	return 0;
+}
+
+// VertexAttrib3dv( index:i64 v:ptr -- )
+int VertexAttrib3dv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib3dv", sig, 2, args);
+	glVertexAttrib3dv((GLuint)args[0].value.i, (const GLdouble *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib3f( index:i64 x:f64 y:f64 z:f64 -- )
+int VertexAttrib3f(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttrib3f", sig, 4, args);
+	glVertexAttrib3f((GLuint)args[0].value.i, (GLfloat)args[1].value.f, (GLfloat)args[2].value.f, (GLfloat)args[3].value.f);
+	return 0;
+}
+
+// VertexAttrib3fv( index:i64 v:ptr -- )
+int VertexAttrib3fv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib3fv", sig, 2, args);
+	glVertexAttrib3fv((GLuint)args[0].value.i, (const GLfloat *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib3s( index:i64 x:i64 y:i64 z:i64 -- )
+int VertexAttrib3s(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttrib3s", sig, 4, args);
+	glVertexAttrib3s((GLuint)args[0].value.i, (GLshort)args[1].value.i, (GLshort)args[2].value.i, (GLshort)args[3].value.i);
+	return 0;
+}
+
+// VertexAttrib3sv( index:i64 v:ptr -- )
+int VertexAttrib3sv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib3sv", sig, 2, args);
+	glVertexAttrib3sv((GLuint)args[0].value.i, (const GLshort *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib4Nbv( index:i64 v:ptr -- )
+int VertexAttrib4Nbv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib4Nbv", sig, 2, args);
+	glVertexAttrib4Nbv((GLuint)args[0].value.i, (const GLbyte *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib4Niv( index:i64 v:ptr -- )
+int VertexAttrib4Niv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib4Niv", sig, 2, args);
+	glVertexAttrib4Niv((GLuint)args[0].value.i, (const GLint *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib4Nsv( index:i64 v:ptr -- )
+int VertexAttrib4Nsv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib4Nsv", sig, 2, args);
+	glVertexAttrib4Nsv((GLuint)args[0].value.i, (const GLshort *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib4Nub( index:i64 x:i64 y:i64 z:i64 w:i64 -- )
+int VertexAttrib4Nub(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "VertexAttrib4Nub", sig, 5, args);
+	glVertexAttrib4Nub((GLuint)args[0].value.i, (GLubyte)args[1].value.i, (GLubyte)args[2].value.i, (GLubyte)args[3].value.i, (GLubyte)args[4].value.i);
+	return 0;
+}
+
+// VertexAttrib4Nubv( index:i64 v:ptr -- )
+int VertexAttrib4Nubv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib4Nubv", sig, 2, args);
+	glVertexAttrib4Nubv((GLuint)args[0].value.i, (const GLubyte *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib4Nuiv( index:i64 v:ptr -- )
+int VertexAttrib4Nuiv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib4Nuiv", sig, 2, args);
+	glVertexAttrib4Nuiv((GLuint)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib4Nusv( index:i64 v:ptr -- )
+int VertexAttrib4Nusv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib4Nusv", sig, 2, args);
+	glVertexAttrib4Nusv((GLuint)args[0].value.i, (const GLushort *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib4bv( index:i64 v:ptr -- )
+int VertexAttrib4bv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib4bv", sig, 2, args);
+	glVertexAttrib4bv((GLuint)args[0].value.i, (const GLbyte *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib4d( index:i64 x:f64 y:f64 z:f64 w:f64 -- )
+int VertexAttrib4d(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "VertexAttrib4d", sig, 5, args);
+	glVertexAttrib4d((GLuint)args[0].value.i, (GLdouble)args[1].value.f, (GLdouble)args[2].value.f, (GLdouble)args[3].value.f, (GLdouble)args[4].value.f);
+	return 0;
+}
+
+// VertexAttrib4dv( index:i64 v:ptr -- )
+int VertexAttrib4dv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib4dv", sig, 2, args);
+	glVertexAttrib4dv((GLuint)args[0].value.i, (const GLdouble *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib4f( index:i64 x:f64 y:f64 z:f64 w:f64 -- )
+int VertexAttrib4f(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "VertexAttrib4f", sig, 5, args);
+	glVertexAttrib4f((GLuint)args[0].value.i, (GLfloat)args[1].value.f, (GLfloat)args[2].value.f, (GLfloat)args[3].value.f, (GLfloat)args[4].value.f);
+	return 0;
+}
+
+// VertexAttrib4fv( index:i64 v:ptr -- )
+int VertexAttrib4fv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib4fv", sig, 2, args);
+	glVertexAttrib4fv((GLuint)args[0].value.i, (const GLfloat *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib4iv( index:i64 v:ptr -- )
+int VertexAttrib4iv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib4iv", sig, 2, args);
+	glVertexAttrib4iv((GLuint)args[0].value.i, (const GLint *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib4s( index:i64 x:i64 y:i64 z:i64 w:i64 -- )
+int VertexAttrib4s(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "VertexAttrib4s", sig, 5, args);
+	glVertexAttrib4s((GLuint)args[0].value.i, (GLshort)args[1].value.i, (GLshort)args[2].value.i, (GLshort)args[3].value.i, (GLshort)args[4].value.i);
+	return 0;
+}
+
+// VertexAttrib4sv( index:i64 v:ptr -- )
+int VertexAttrib4sv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib4sv", sig, 2, args);
+	glVertexAttrib4sv((GLuint)args[0].value.i, (const GLshort *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib4ubv( index:i64 v:ptr -- )
+int VertexAttrib4ubv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib4ubv", sig, 2, args);
+	glVertexAttrib4ubv((GLuint)args[0].value.i, (const GLubyte *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib4uiv( index:i64 v:ptr -- )
+int VertexAttrib4uiv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib4uiv", sig, 2, args);
+	glVertexAttrib4uiv((GLuint)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttrib4usv( index:i64 v:ptr -- )
+int VertexAttrib4usv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttrib4usv", sig, 2, args);
+	glVertexAttrib4usv((GLuint)args[0].value.i, (const GLushort *)args[1].value.p);
+	return 0;
+}
+
+// UniformMatrix2x3fv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix2x3fv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix2x3fv", sig, 4, args);
+	glUniformMatrix2x3fv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLfloat *)args[3].value.p);
+	return 0;
+}
+
+// UniformMatrix3x2fv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix3x2fv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix3x2fv", sig, 4, args);
+	glUniformMatrix3x2fv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLfloat *)args[3].value.p);
+	return 0;
+}
+
+// UniformMatrix2x4fv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix2x4fv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix2x4fv", sig, 4, args);
+	glUniformMatrix2x4fv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLfloat *)args[3].value.p);
+	return 0;
+}
+
+// UniformMatrix4x2fv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix4x2fv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix4x2fv", sig, 4, args);
+	glUniformMatrix4x2fv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLfloat *)args[3].value.p);
+	return 0;
+}
+
+// UniformMatrix3x4fv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix3x4fv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix3x4fv", sig, 4, args);
+	glUniformMatrix3x4fv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLfloat *)args[3].value.p);
+	return 0;
+}
+
+// UniformMatrix4x3fv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix4x3fv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix4x3fv", sig, 4, args);
+	glUniformMatrix4x3fv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLfloat *)args[3].value.p);
+	return 0;
+}
+
+// ColorMaski( index:i64 r:i64 g:i64 b:i64 a:i64 -- )
+int ColorMaski(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ColorMaski", sig, 5, args);
+	glColorMaski((GLuint)args[0].value.i, (GLboolean)args[1].value.i, (GLboolean)args[2].value.i, (GLboolean)args[3].value.i, (GLboolean)args[4].value.i);
+	return 0;
+}
+
+// GetBooleani_v( target:i64 index:i64 data:ptr -- )
+int GetBooleani_v(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetBooleani_v", sig, 3, args);
+	glGetBooleani_v((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLboolean *)args[2].value.p);
+	return 0;
+}
+
+// GetIntegeri_v( target:i64 index:i64 data:ptr -- )
+int GetIntegeri_v(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetIntegeri_v", sig, 3, args);
+	glGetIntegeri_v((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// Enablei( target:i64 index:i64 -- )
+int Enablei(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "Enablei", sig, 2, args);
+	glEnablei((GLenum)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// Disablei( target:i64 index:i64 -- )
+int Disablei(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "Disablei", sig, 2, args);
+	glDisablei((GLenum)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// IsEnabledi( target:i64 index:i64 -- result:i64 )
+int IsEnabledi(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "IsEnabledi", sig, 2, args);
+	GLboolean result = glIsEnabledi((GLenum)args[0].value.i, (GLuint)args[1].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// BeginTransformFeedback( primitiveMode:i64 -- )
+int BeginTransformFeedback(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "BeginTransformFeedback", sig, 1, args);
+	glBeginTransformFeedback((GLenum)args[0].value.i);
+	return 0;
+}
+
+// EndTransformFeedback( -- )
+int EndTransformFeedback(qd_context* ctx) {
+	(void)ctx;
+	glEndTransformFeedback();
+	return 0;
+}
+
+// GetTransformFeedbackVarying( program:i64 index:i64 bufSize:i64 length:ptr size:ptr type:ptr name:ptr -- )
+int GetTransformFeedbackVarying(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "GetTransformFeedbackVarying", sig, 7, args);
+	glGetTransformFeedbackVarying((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei *)args[3].value.p, (GLsizei *)args[4].value.p, (GLenum *)args[5].value.p, (GLchar *)args[6].value.p);
+	return 0;
+}
+
+// ClampColor( target:i64 clamp:i64 -- )
+int ClampColor(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "ClampColor", sig, 2, args);
+	glClampColor((GLenum)args[0].value.i, (GLenum)args[1].value.i);
+	return 0;
+}
+
+// BeginConditionalRender( id:i64 mode:i64 -- )
+int BeginConditionalRender(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "BeginConditionalRender", sig, 2, args);
+	glBeginConditionalRender((GLuint)args[0].value.i, (GLenum)args[1].value.i);
+	return 0;
+}
+
+// EndConditionalRender( -- )
+int EndConditionalRender(qd_context* ctx) {
+	(void)ctx;
+	glEndConditionalRender();
+	return 0;
+}
+
+// GetVertexAttribIiv( index:i64 pname:i64 params:ptr -- )
+int GetVertexAttribIiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetVertexAttribIiv", sig, 3, args);
+	glGetVertexAttribIiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetVertexAttribIuiv( index:i64 pname:i64 params:ptr -- )
+int GetVertexAttribIuiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetVertexAttribIuiv", sig, 3, args);
+	glGetVertexAttribIuiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint *)args[2].value.p);
+	return 0;
+}
+
+// VertexAttribI1i( index:i64 x:i64 -- )
+int VertexAttribI1i(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribI1i", sig, 2, args);
+	glVertexAttribI1i((GLuint)args[0].value.i, (GLint)args[1].value.i);
+	return 0;
+}
+
+// VertexAttribI2i( index:i64 x:i64 y:i64 -- )
+int VertexAttribI2i(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "VertexAttribI2i", sig, 3, args);
+	glVertexAttribI2i((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i);
+	return 0;
+}
+
+// VertexAttribI3i( index:i64 x:i64 y:i64 z:i64 -- )
+int VertexAttribI3i(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttribI3i", sig, 4, args);
+	glVertexAttribI3i((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i);
+	return 0;
+}
+
+// VertexAttribI4i( index:i64 x:i64 y:i64 z:i64 w:i64 -- )
+int VertexAttribI4i(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "VertexAttribI4i", sig, 5, args);
+	glVertexAttribI4i((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i);
+	return 0;
+}
+
+// VertexAttribI1ui( index:i64 x:i64 -- )
+int VertexAttribI1ui(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribI1ui", sig, 2, args);
+	glVertexAttribI1ui((GLuint)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// VertexAttribI2ui( index:i64 x:i64 y:i64 -- )
+int VertexAttribI2ui(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "VertexAttribI2ui", sig, 3, args);
+	glVertexAttribI2ui((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// VertexAttribI3ui( index:i64 x:i64 y:i64 z:i64 -- )
+int VertexAttribI3ui(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttribI3ui", sig, 4, args);
+	glVertexAttribI3ui((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i, (GLuint)args[3].value.i);
+	return 0;
+}
+
+// VertexAttribI4ui( index:i64 x:i64 y:i64 z:i64 w:i64 -- )
+int VertexAttribI4ui(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "VertexAttribI4ui", sig, 5, args);
+	glVertexAttribI4ui((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i, (GLuint)args[3].value.i, (GLuint)args[4].value.i);
+	return 0;
+}
+
+// VertexAttribI1iv( index:i64 v:ptr -- )
+int VertexAttribI1iv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribI1iv", sig, 2, args);
+	glVertexAttribI1iv((GLuint)args[0].value.i, (const GLint *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribI2iv( index:i64 v:ptr -- )
+int VertexAttribI2iv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribI2iv", sig, 2, args);
+	glVertexAttribI2iv((GLuint)args[0].value.i, (const GLint *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribI3iv( index:i64 v:ptr -- )
+int VertexAttribI3iv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribI3iv", sig, 2, args);
+	glVertexAttribI3iv((GLuint)args[0].value.i, (const GLint *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribI4iv( index:i64 v:ptr -- )
+int VertexAttribI4iv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribI4iv", sig, 2, args);
+	glVertexAttribI4iv((GLuint)args[0].value.i, (const GLint *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribI1uiv( index:i64 v:ptr -- )
+int VertexAttribI1uiv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribI1uiv", sig, 2, args);
+	glVertexAttribI1uiv((GLuint)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribI2uiv( index:i64 v:ptr -- )
+int VertexAttribI2uiv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribI2uiv", sig, 2, args);
+	glVertexAttribI2uiv((GLuint)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribI3uiv( index:i64 v:ptr -- )
+int VertexAttribI3uiv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribI3uiv", sig, 2, args);
+	glVertexAttribI3uiv((GLuint)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribI4uiv( index:i64 v:ptr -- )
+int VertexAttribI4uiv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribI4uiv", sig, 2, args);
+	glVertexAttribI4uiv((GLuint)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribI4bv( index:i64 v:ptr -- )
+int VertexAttribI4bv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribI4bv", sig, 2, args);
+	glVertexAttribI4bv((GLuint)args[0].value.i, (const GLbyte *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribI4sv( index:i64 v:ptr -- )
+int VertexAttribI4sv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribI4sv", sig, 2, args);
+	glVertexAttribI4sv((GLuint)args[0].value.i, (const GLshort *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribI4ubv( index:i64 v:ptr -- )
+int VertexAttribI4ubv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribI4ubv", sig, 2, args);
+	glVertexAttribI4ubv((GLuint)args[0].value.i, (const GLubyte *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribI4usv( index:i64 v:ptr -- )
+int VertexAttribI4usv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribI4usv", sig, 2, args);
+	glVertexAttribI4usv((GLuint)args[0].value.i, (const GLushort *)args[1].value.p);
+	return 0;
+}
+
+// GetUniformuiv( program:i64 location:i64 params:ptr -- )
+int GetUniformuiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetUniformuiv", sig, 3, args);
+	glGetUniformuiv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLuint *)args[2].value.p);
+	return 0;
+}
+
+// BindFragDataLocation( program:i64 color:i64 name:str -- )
+int BindFragDataLocation(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "BindFragDataLocation", sig, 3, args);
+	glBindFragDataLocation((GLuint)args[0].value.i, (GLuint)args[1].value.i, qd_string_data(args[2].value.s));
+	qd_string_release(args[2].value.s);
+	return 0;
+}
+
+// GetFragDataLocation( program:i64 name:str -- result:i64 )
+int GetFragDataLocation(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GetFragDataLocation", sig, 2, args);
+	GLint result = glGetFragDataLocation((GLuint)args[0].value.i, qd_string_data(args[1].value.s));
+	qd_string_release(args[1].value.s);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// Uniform2ui( location:i64 v0:i64 v1:i64 -- )
+int Uniform2ui(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "Uniform2ui", sig, 3, args);
+	glUniform2ui((GLint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// Uniform3ui( location:i64 v0:i64 v1:i64 v2:i64 -- )
+int Uniform3ui(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "Uniform3ui", sig, 4, args);
+	glUniform3ui((GLint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i, (GLuint)args[3].value.i);
+	return 0;
+}
+
+// Uniform4ui( location:i64 v0:i64 v1:i64 v2:i64 v3:i64 -- )
+int Uniform4ui(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "Uniform4ui", sig, 5, args);
+	glUniform4ui((GLint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i, (GLuint)args[3].value.i, (GLuint)args[4].value.i);
+	return 0;
+}
+
+// Uniform1uiv( location:i64 count:i64 value:ptr -- )
+int Uniform1uiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "Uniform1uiv", sig, 3, args);
+	glUniform1uiv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (const GLuint *)args[2].value.p);
+	return 0;
+}
+
+// Uniform2uiv( location:i64 count:i64 value:ptr -- )
+int Uniform2uiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "Uniform2uiv", sig, 3, args);
+	glUniform2uiv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (const GLuint *)args[2].value.p);
+	return 0;
+}
+
+// Uniform3uiv( location:i64 count:i64 value:ptr -- )
+int Uniform3uiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "Uniform3uiv", sig, 3, args);
+	glUniform3uiv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (const GLuint *)args[2].value.p);
+	return 0;
+}
+
+// Uniform4uiv( location:i64 count:i64 value:ptr -- )
+int Uniform4uiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "Uniform4uiv", sig, 3, args);
+	glUniform4uiv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (const GLuint *)args[2].value.p);
+	return 0;
+}
+
+// TexParameterIiv( target:i64 pname:i64 params:ptr -- )
+int TexParameterIiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TexParameterIiv", sig, 3, args);
+	glTexParameterIiv((GLenum)args[0].value.i, (GLenum)args[1].value.i, (const GLint *)args[2].value.p);
+	return 0;
+}
+
+// TexParameterIuiv( target:i64 pname:i64 params:ptr -- )
+int TexParameterIuiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TexParameterIuiv", sig, 3, args);
+	glTexParameterIuiv((GLenum)args[0].value.i, (GLenum)args[1].value.i, (const GLuint *)args[2].value.p);
+	return 0;
+}
+
+// GetTexParameterIiv( target:i64 pname:i64 params:ptr -- )
+int GetTexParameterIiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetTexParameterIiv", sig, 3, args);
+	glGetTexParameterIiv((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetTexParameterIuiv( target:i64 pname:i64 params:ptr -- )
+int GetTexParameterIuiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetTexParameterIuiv", sig, 3, args);
+	glGetTexParameterIuiv((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLuint *)args[2].value.p);
+	return 0;
+}
+
+// ClearBufferiv( buffer:i64 drawbuffer:i64 value:ptr -- )
+int ClearBufferiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "ClearBufferiv", sig, 3, args);
+	glClearBufferiv((GLenum)args[0].value.i, (GLint)args[1].value.i, (const GLint *)args[2].value.p);
+	return 0;
+}
+
+// ClearBufferuiv( buffer:i64 drawbuffer:i64 value:ptr -- )
+int ClearBufferuiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "ClearBufferuiv", sig, 3, args);
+	glClearBufferuiv((GLenum)args[0].value.i, (GLint)args[1].value.i, (const GLuint *)args[2].value.p);
+	return 0;
+}
+
+// ClearBufferfv( buffer:i64 drawbuffer:i64 value:ptr -- )
+int ClearBufferfv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "ClearBufferfv", sig, 3, args);
+	glClearBufferfv((GLenum)args[0].value.i, (GLint)args[1].value.i, (const GLfloat *)args[2].value.p);
+	return 0;
+}
+
+// ClearBufferfi( buffer:i64 drawbuffer:i64 depth:f64 stencil:i64 -- )
+int ClearBufferfi(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ClearBufferfi", sig, 4, args);
+	glClearBufferfi((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLfloat)args[2].value.f, (GLint)args[3].value.i);
+	return 0;
+}
+
+// GetStringi( name:i64 index:i64 -- result:str )
+int GetStringi(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GetStringi", sig, 2, args);
+	const GLubyte * result = glGetStringi((GLenum)args[0].value.i, (GLuint)args[1].value.i);
+	qd_push_s(ctx, result ? (const char*)result : "");
+	return 0;
+}
+
+// IsRenderbuffer( renderbuffer:i64 -- result:i64 )
+int IsRenderbuffer(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "IsRenderbuffer", sig, 1, args);
+	GLboolean result = glIsRenderbuffer((GLuint)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// DeleteRenderbuffers( n:i64 renderbuffers:ptr -- )
+int DeleteRenderbuffers(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DeleteRenderbuffers", sig, 2, args);
+	glDeleteRenderbuffers((GLsizei)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// GenRenderbuffers( n:i64 renderbuffers:ptr -- )
+int GenRenderbuffers(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GenRenderbuffers", sig, 2, args);
+	glGenRenderbuffers((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// GetRenderbufferParameteriv( target:i64 pname:i64 params:ptr -- )
+int GetRenderbufferParameteriv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetRenderbufferParameteriv", sig, 3, args);
+	glGetRenderbufferParameteriv((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// IsFramebuffer( framebuffer:i64 -- result:i64 )
+int IsFramebuffer(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "IsFramebuffer", sig, 1, args);
+	GLboolean result = glIsFramebuffer((GLuint)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// DeleteFramebuffers( n:i64 framebuffers:ptr -- )
+int DeleteFramebuffers(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DeleteFramebuffers", sig, 2, args);
+	glDeleteFramebuffers((GLsizei)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// GenFramebuffers( n:i64 framebuffers:ptr -- )
+int GenFramebuffers(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GenFramebuffers", sig, 2, args);
+	glGenFramebuffers((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// FramebufferTexture1D( target:i64 attachment:i64 textarget:i64 texture:i64 level:i64 -- )
+int FramebufferTexture1D(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "FramebufferTexture1D", sig, 5, args);
+	glFramebufferTexture1D((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLuint)args[3].value.i, (GLint)args[4].value.i);
+	return 0;
+}
+
+// FramebufferTexture3D( target:i64 attachment:i64 textarget:i64 texture:i64 level:i64 zoffset:i64 -- )
+int FramebufferTexture3D(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "FramebufferTexture3D", sig, 6, args);
+	glFramebufferTexture3D((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLuint)args[3].value.i, (GLint)args[4].value.i, (GLint)args[5].value.i);
+	return 0;
+}
+
+// GetFramebufferAttachmentParameteriv( target:i64 attachment:i64 pname:i64 params:ptr -- )
+int GetFramebufferAttachmentParameteriv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetFramebufferAttachmentParameteriv", sig, 4, args);
+	glGetFramebufferAttachmentParameteriv((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLint *)args[3].value.p);
+	return 0;
+}
+
+// BlitFramebuffer( srcX0:i64 srcY0:i64 srcX1:i64 srcY1:i64 dstX0:i64 dstY0:i64 dstX1:i64 dstY1:i64 mask:i64 filter:i64 -- )
+int BlitFramebuffer(qd_context* ctx) {
+	static const int sig[10] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[10];
+	gl_pop_args(ctx, "BlitFramebuffer", sig, 10, args);
+	glBlitFramebuffer((GLint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLint)args[5].value.i, (GLint)args[6].value.i, (GLint)args[7].value.i, (GLbitfield)args[8].value.i, (GLenum)args[9].value.i);
+	return 0;
+}
+
+// RenderbufferStorageMultisample( target:i64 samples:i64 internalformat:i64 width:i64 height:i64 -- )
+int RenderbufferStorageMultisample(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "RenderbufferStorageMultisample", sig, 5, args);
+	glRenderbufferStorageMultisample((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i);
+	return 0;
+}
+
+// FramebufferTextureLayer( target:i64 attachment:i64 texture:i64 level:i64 layer:i64 -- )
+int FramebufferTextureLayer(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "FramebufferTextureLayer", sig, 5, args);
+	glFramebufferTextureLayer((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i);
+	return 0;
+}
+
+// DeleteVertexArrays( n:i64 arrays:ptr -- )
+int DeleteVertexArrays(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DeleteVertexArrays", sig, 2, args);
+	glDeleteVertexArrays((GLsizei)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// GenVertexArrays( n:i64 arrays:ptr -- )
+int GenVertexArrays(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GenVertexArrays", sig, 2, args);
+	glGenVertexArrays((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// IsVertexArray( array:i64 -- result:i64 )
+int IsVertexArray(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "IsVertexArray", sig, 1, args);
+	GLboolean result = glIsVertexArray((GLuint)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// TexBuffer( target:i64 internalformat:i64 buffer:i64 -- )
+int TexBuffer(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TexBuffer", sig, 3, args);
+	glTexBuffer((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// PrimitiveRestartIndex( index:i64 -- )
+int PrimitiveRestartIndex(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "PrimitiveRestartIndex", sig, 1, args);
+	glPrimitiveRestartIndex((GLuint)args[0].value.i);
+	return 0;
+}
+
+// GetActiveUniformsiv( program:i64 uniformCount:i64 uniformIndices:ptr pname:i64 params:ptr -- )
+int GetActiveUniformsiv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "GetActiveUniformsiv", sig, 5, args);
+	glGetActiveUniformsiv((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (const GLuint *)args[2].value.p, (GLenum)args[3].value.i, (GLint *)args[4].value.p);
+	return 0;
+}
+
+// GetActiveUniformName( program:i64 uniformIndex:i64 bufSize:i64 length:ptr uniformName:ptr -- )
+int GetActiveUniformName(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "GetActiveUniformName", sig, 5, args);
+	glGetActiveUniformName((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei *)args[3].value.p, (GLchar *)args[4].value.p);
+	return 0;
+}
+
+// GetActiveUniformBlockiv( program:i64 uniformBlockIndex:i64 pname:i64 params:ptr -- )
+int GetActiveUniformBlockiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetActiveUniformBlockiv", sig, 4, args);
+	glGetActiveUniformBlockiv((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLenum)args[2].value.i, (GLint *)args[3].value.p);
+	return 0;
+}
+
+// GetActiveUniformBlockName( program:i64 uniformBlockIndex:i64 bufSize:i64 length:ptr uniformBlockName:ptr -- )
+int GetActiveUniformBlockName(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "GetActiveUniformBlockName", sig, 5, args);
+	glGetActiveUniformBlockName((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei *)args[3].value.p, (GLchar *)args[4].value.p);
+	return 0;
+}
+
+// DrawRangeElementsBaseVertex( mode:i64 start:i64 end:i64 count:i64 type:i64 indices:i64 basevertex:i64 -- )
+int DrawRangeElementsBaseVertex(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "DrawRangeElementsBaseVertex", sig, 7, args);
+	glDrawRangeElementsBaseVertex((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i, (GLsizei)args[3].value.i, (GLenum)args[4].value.i, (const void *)(intptr_t)args[5].value.i, (GLint)args[6].value.i);
+	return 0;
+}
+
+// DrawElementsInstancedBaseVertex( mode:i64 count:i64 type:i64 indices:i64 instancecount:i64 basevertex:i64 -- )
+int DrawElementsInstancedBaseVertex(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "DrawElementsInstancedBaseVertex", sig, 6, args);
+	glDrawElementsInstancedBaseVertex((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (const void *)(intptr_t)args[3].value.i, (GLsizei)args[4].value.i, (GLint)args[5].value.i);
+	return 0;
+}
+
+// ProvokingVertex( mode:i64 -- )
+int ProvokingVertex(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "ProvokingVertex", sig, 1, args);
+	glProvokingVertex((GLenum)args[0].value.i);
+	return 0;
+}
+
+// FenceSync( condition:i64 flags:i64 -- result:ptr )
+int FenceSync(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "FenceSync", sig, 2, args);
+	GLsync result = glFenceSync((GLenum)args[0].value.i, (GLbitfield)args[1].value.i);
+	qd_push_p(ctx, (void*)result);
+	return 0;
+}
+
+// IsSync( sync:ptr -- result:i64 )
+int IsSync(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "IsSync", sig, 1, args);
+	GLboolean result = glIsSync((GLsync)args[0].value.p);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// DeleteSync( sync:ptr -- )
+int DeleteSync(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "DeleteSync", sig, 1, args);
+	glDeleteSync((GLsync)args[0].value.p);
+	return 0;
+}
+
+// ClientWaitSync( sync:ptr flags:i64 timeout:i64 -- result:i64 )
+int ClientWaitSync(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "ClientWaitSync", sig, 3, args);
+	GLenum result = glClientWaitSync((GLsync)args[0].value.p, (GLbitfield)args[1].value.i, (GLuint64)args[2].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// WaitSync( sync:ptr flags:i64 timeout:i64 -- )
+int WaitSync(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "WaitSync", sig, 3, args);
+	glWaitSync((GLsync)args[0].value.p, (GLbitfield)args[1].value.i, (GLuint64)args[2].value.i);
+	return 0;
+}
+
+// GetInteger64v( pname:i64 data:ptr -- )
+int GetInteger64v(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GetInteger64v", sig, 2, args);
+	glGetInteger64v((GLenum)args[0].value.i, (GLint64 *)args[1].value.p);
+	return 0;
+}
+
+// GetSynciv( sync:ptr pname:i64 count:i64 length:ptr values:ptr -- )
+int GetSynciv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "GetSynciv", sig, 5, args);
+	glGetSynciv((GLsync)args[0].value.p, (GLenum)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei *)args[3].value.p, (GLint *)args[4].value.p);
+	return 0;
+}
+
+// GetInteger64i_v( target:i64 index:i64 data:ptr -- )
+int GetInteger64i_v(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetInteger64i_v", sig, 3, args);
+	glGetInteger64i_v((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLint64 *)args[2].value.p);
+	return 0;
+}
+
+// GetBufferParameteri64v( target:i64 pname:i64 params:ptr -- )
+int GetBufferParameteri64v(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetBufferParameteri64v", sig, 3, args);
+	glGetBufferParameteri64v((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLint64 *)args[2].value.p);
+	return 0;
+}
+
+// FramebufferTexture( target:i64 attachment:i64 texture:i64 level:i64 -- )
+int FramebufferTexture(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "FramebufferTexture", sig, 4, args);
+	glFramebufferTexture((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLint)args[3].value.i);
+	return 0;
+}
+
+// TexImage2DMultisample( target:i64 samples:i64 internalformat:i64 width:i64 height:i64 fixedsamplelocations:i64 -- )
+int TexImage2DMultisample(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "TexImage2DMultisample", sig, 6, args);
+	glTexImage2DMultisample((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i, (GLboolean)args[5].value.i);
+	return 0;
+}
+
+// TexImage3DMultisample( target:i64 samples:i64 internalformat:i64 width:i64 height:i64 depth:i64 fixedsamplelocations:i64 -- )
+int TexImage3DMultisample(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "TexImage3DMultisample", sig, 7, args);
+	glTexImage3DMultisample((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i, (GLsizei)args[5].value.i, (GLboolean)args[6].value.i);
+	return 0;
+}
+
+// GetMultisamplefv( pname:i64 index:i64 val:ptr -- )
+int GetMultisamplefv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetMultisamplefv", sig, 3, args);
+	glGetMultisamplefv((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLfloat *)args[2].value.p);
+	return 0;
+}
+
+// SampleMaski( maskNumber:i64 mask:i64 -- )
+int SampleMaski(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "SampleMaski", sig, 2, args);
+	glSampleMaski((GLuint)args[0].value.i, (GLbitfield)args[1].value.i);
+	return 0;
+}
+
+// BindFragDataLocationIndexed( program:i64 colorNumber:i64 index:i64 name:str -- )
+int BindFragDataLocationIndexed(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "BindFragDataLocationIndexed", sig, 4, args);
+	glBindFragDataLocationIndexed((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i, qd_string_data(args[3].value.s));
+	qd_string_release(args[3].value.s);
+	return 0;
+}
+
+// GetFragDataIndex( program:i64 name:str -- result:i64 )
+int GetFragDataIndex(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GetFragDataIndex", sig, 2, args);
+	GLint result = glGetFragDataIndex((GLuint)args[0].value.i, qd_string_data(args[1].value.s));
+	qd_string_release(args[1].value.s);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// GenSamplers( count:i64 samplers:ptr -- )
+int GenSamplers(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GenSamplers", sig, 2, args);
+	glGenSamplers((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// DeleteSamplers( count:i64 samplers:ptr -- )
+int DeleteSamplers(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DeleteSamplers", sig, 2, args);
+	glDeleteSamplers((GLsizei)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// IsSampler( sampler:i64 -- result:i64 )
+int IsSampler(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "IsSampler", sig, 1, args);
+	GLboolean result = glIsSampler((GLuint)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// BindSampler( unit:i64 sampler:i64 -- )
+int BindSampler(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "BindSampler", sig, 2, args);
+	glBindSampler((GLuint)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// SamplerParameteri( sampler:i64 pname:i64 param:i64 -- )
+int SamplerParameteri(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "SamplerParameteri", sig, 3, args);
+	glSamplerParameteri((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint)args[2].value.i);
+	return 0;
+}
+
+// SamplerParameteriv( sampler:i64 pname:i64 param:ptr -- )
+int SamplerParameteriv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "SamplerParameteriv", sig, 3, args);
+	glSamplerParameteriv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (const GLint *)args[2].value.p);
+	return 0;
+}
+
+// SamplerParameterf( sampler:i64 pname:i64 param:f64 -- )
+int SamplerParameterf(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "SamplerParameterf", sig, 3, args);
+	glSamplerParameterf((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLfloat)args[2].value.f);
+	return 0;
+}
+
+// SamplerParameterfv( sampler:i64 pname:i64 param:ptr -- )
+int SamplerParameterfv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "SamplerParameterfv", sig, 3, args);
+	glSamplerParameterfv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (const GLfloat *)args[2].value.p);
+	return 0;
+}
+
+// SamplerParameterIiv( sampler:i64 pname:i64 param:ptr -- )
+int SamplerParameterIiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "SamplerParameterIiv", sig, 3, args);
+	glSamplerParameterIiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (const GLint *)args[2].value.p);
+	return 0;
+}
+
+// SamplerParameterIuiv( sampler:i64 pname:i64 param:ptr -- )
+int SamplerParameterIuiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "SamplerParameterIuiv", sig, 3, args);
+	glSamplerParameterIuiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (const GLuint *)args[2].value.p);
+	return 0;
+}
+
+// GetSamplerParameteriv( sampler:i64 pname:i64 params:ptr -- )
+int GetSamplerParameteriv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetSamplerParameteriv", sig, 3, args);
+	glGetSamplerParameteriv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetSamplerParameterIiv( sampler:i64 pname:i64 params:ptr -- )
+int GetSamplerParameterIiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetSamplerParameterIiv", sig, 3, args);
+	glGetSamplerParameterIiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetSamplerParameterfv( sampler:i64 pname:i64 params:ptr -- )
+int GetSamplerParameterfv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetSamplerParameterfv", sig, 3, args);
+	glGetSamplerParameterfv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLfloat *)args[2].value.p);
+	return 0;
+}
+
+// GetSamplerParameterIuiv( sampler:i64 pname:i64 params:ptr -- )
+int GetSamplerParameterIuiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetSamplerParameterIuiv", sig, 3, args);
+	glGetSamplerParameterIuiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint *)args[2].value.p);
+	return 0;
+}
+
+// QueryCounter( id:i64 target:i64 -- )
+int QueryCounter(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "QueryCounter", sig, 2, args);
+	glQueryCounter((GLuint)args[0].value.i, (GLenum)args[1].value.i);
+	return 0;
+}
+
+// GetQueryObjecti64v( id:i64 pname:i64 params:ptr -- )
+int GetQueryObjecti64v(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetQueryObjecti64v", sig, 3, args);
+	glGetQueryObjecti64v((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint64 *)args[2].value.p);
+	return 0;
+}
+
+// GetQueryObjectui64v( id:i64 pname:i64 params:ptr -- )
+int GetQueryObjectui64v(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetQueryObjectui64v", sig, 3, args);
+	glGetQueryObjectui64v((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint64 *)args[2].value.p);
+	return 0;
+}
+
+// VertexAttribP1ui( index:i64 type:i64 normalized:i64 value:i64 -- )
+int VertexAttribP1ui(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttribP1ui", sig, 4, args);
+	glVertexAttribP1ui((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLboolean)args[2].value.i, (GLuint)args[3].value.i);
+	return 0;
+}
+
+// VertexAttribP1uiv( index:i64 type:i64 normalized:i64 value:ptr -- )
+int VertexAttribP1uiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttribP1uiv", sig, 4, args);
+	glVertexAttribP1uiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLboolean)args[2].value.i, (const GLuint *)args[3].value.p);
+	return 0;
+}
+
+// VertexAttribP2ui( index:i64 type:i64 normalized:i64 value:i64 -- )
+int VertexAttribP2ui(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttribP2ui", sig, 4, args);
+	glVertexAttribP2ui((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLboolean)args[2].value.i, (GLuint)args[3].value.i);
+	return 0;
+}
+
+// VertexAttribP2uiv( index:i64 type:i64 normalized:i64 value:ptr -- )
+int VertexAttribP2uiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttribP2uiv", sig, 4, args);
+	glVertexAttribP2uiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLboolean)args[2].value.i, (const GLuint *)args[3].value.p);
+	return 0;
+}
+
+// VertexAttribP3ui( index:i64 type:i64 normalized:i64 value:i64 -- )
+int VertexAttribP3ui(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttribP3ui", sig, 4, args);
+	glVertexAttribP3ui((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLboolean)args[2].value.i, (GLuint)args[3].value.i);
+	return 0;
+}
+
+// VertexAttribP3uiv( index:i64 type:i64 normalized:i64 value:ptr -- )
+int VertexAttribP3uiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttribP3uiv", sig, 4, args);
+	glVertexAttribP3uiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLboolean)args[2].value.i, (const GLuint *)args[3].value.p);
+	return 0;
+}
+
+// VertexAttribP4ui( index:i64 type:i64 normalized:i64 value:i64 -- )
+int VertexAttribP4ui(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttribP4ui", sig, 4, args);
+	glVertexAttribP4ui((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLboolean)args[2].value.i, (GLuint)args[3].value.i);
+	return 0;
+}
+
+// VertexAttribP4uiv( index:i64 type:i64 normalized:i64 value:ptr -- )
+int VertexAttribP4uiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttribP4uiv", sig, 4, args);
+	glVertexAttribP4uiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLboolean)args[2].value.i, (const GLuint *)args[3].value.p);
+	return 0;
+}
+
+// MinSampleShading( value:f64 -- )
+int MinSampleShading(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "MinSampleShading", sig, 1, args);
+	glMinSampleShading((GLfloat)args[0].value.f);
+	return 0;
+}
+
+// BlendEquationi( buf:i64 mode:i64 -- )
+int BlendEquationi(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "BlendEquationi", sig, 2, args);
+	glBlendEquationi((GLuint)args[0].value.i, (GLenum)args[1].value.i);
+	return 0;
+}
+
+// BlendEquationSeparatei( buf:i64 modeRGB:i64 modeAlpha:i64 -- )
+int BlendEquationSeparatei(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "BlendEquationSeparatei", sig, 3, args);
+	glBlendEquationSeparatei((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i);
+	return 0;
+}
+
+// BlendFunci( buf:i64 src:i64 dst:i64 -- )
+int BlendFunci(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "BlendFunci", sig, 3, args);
+	glBlendFunci((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i);
+	return 0;
+}
+
+// BlendFuncSeparatei( buf:i64 srcRGB:i64 dstRGB:i64 srcAlpha:i64 dstAlpha:i64 -- )
+int BlendFuncSeparatei(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "BlendFuncSeparatei", sig, 5, args);
+	glBlendFuncSeparatei((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLenum)args[3].value.i, (GLenum)args[4].value.i);
+	return 0;
+}
+
+// Uniform1d( location:i64 x:f64 -- )
+int Uniform1d(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "Uniform1d", sig, 2, args);
+	glUniform1d((GLint)args[0].value.i, (GLdouble)args[1].value.f);
+	return 0;
+}
+
+// Uniform2d( location:i64 x:f64 y:f64 -- )
+int Uniform2d(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "Uniform2d", sig, 3, args);
+	glUniform2d((GLint)args[0].value.i, (GLdouble)args[1].value.f, (GLdouble)args[2].value.f);
+	return 0;
+}
+
+// Uniform3d( location:i64 x:f64 y:f64 z:f64 -- )
+int Uniform3d(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "Uniform3d", sig, 4, args);
+	glUniform3d((GLint)args[0].value.i, (GLdouble)args[1].value.f, (GLdouble)args[2].value.f, (GLdouble)args[3].value.f);
+	return 0;
+}
+
+// Uniform4d( location:i64 x:f64 y:f64 z:f64 w:f64 -- )
+int Uniform4d(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "Uniform4d", sig, 5, args);
+	glUniform4d((GLint)args[0].value.i, (GLdouble)args[1].value.f, (GLdouble)args[2].value.f, (GLdouble)args[3].value.f, (GLdouble)args[4].value.f);
+	return 0;
+}
+
+// Uniform1dv( location:i64 count:i64 value:ptr -- )
+int Uniform1dv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "Uniform1dv", sig, 3, args);
+	glUniform1dv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (const GLdouble *)args[2].value.p);
+	return 0;
+}
+
+// Uniform2dv( location:i64 count:i64 value:ptr -- )
+int Uniform2dv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "Uniform2dv", sig, 3, args);
+	glUniform2dv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (const GLdouble *)args[2].value.p);
+	return 0;
+}
+
+// Uniform3dv( location:i64 count:i64 value:ptr -- )
+int Uniform3dv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "Uniform3dv", sig, 3, args);
+	glUniform3dv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (const GLdouble *)args[2].value.p);
+	return 0;
+}
+
+// Uniform4dv( location:i64 count:i64 value:ptr -- )
+int Uniform4dv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "Uniform4dv", sig, 3, args);
+	glUniform4dv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (const GLdouble *)args[2].value.p);
+	return 0;
+}
+
+// UniformMatrix2dv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix2dv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix2dv", sig, 4, args);
+	glUniformMatrix2dv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLdouble *)args[3].value.p);
+	return 0;
+}
+
+// UniformMatrix3dv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix3dv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix3dv", sig, 4, args);
+	glUniformMatrix3dv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLdouble *)args[3].value.p);
+	return 0;
+}
+
+// UniformMatrix4dv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix4dv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix4dv", sig, 4, args);
+	glUniformMatrix4dv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLdouble *)args[3].value.p);
+	return 0;
+}
+
+// UniformMatrix2x3dv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix2x3dv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix2x3dv", sig, 4, args);
+	glUniformMatrix2x3dv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLdouble *)args[3].value.p);
+	return 0;
+}
+
+// UniformMatrix2x4dv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix2x4dv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix2x4dv", sig, 4, args);
+	glUniformMatrix2x4dv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLdouble *)args[3].value.p);
+	return 0;
+}
+
+// UniformMatrix3x2dv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix3x2dv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix3x2dv", sig, 4, args);
+	glUniformMatrix3x2dv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLdouble *)args[3].value.p);
+	return 0;
+}
+
+// UniformMatrix3x4dv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix3x4dv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix3x4dv", sig, 4, args);
+	glUniformMatrix3x4dv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLdouble *)args[3].value.p);
+	return 0;
+}
+
+// UniformMatrix4x2dv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix4x2dv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix4x2dv", sig, 4, args);
+	glUniformMatrix4x2dv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLdouble *)args[3].value.p);
+	return 0;
+}
+
+// UniformMatrix4x3dv( location:i64 count:i64 transpose:i64 value:ptr -- )
+int UniformMatrix4x3dv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "UniformMatrix4x3dv", sig, 4, args);
+	glUniformMatrix4x3dv((GLint)args[0].value.i, (GLsizei)args[1].value.i, (GLboolean)args[2].value.i, (const GLdouble *)args[3].value.p);
+	return 0;
+}
+
+// GetUniformdv( program:i64 location:i64 params:ptr -- )
+int GetUniformdv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetUniformdv", sig, 3, args);
+	glGetUniformdv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLdouble *)args[2].value.p);
+	return 0;
+}
+
+// GetSubroutineUniformLocation( program:i64 shadertype:i64 name:str -- result:i64 )
+int GetSubroutineUniformLocation(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetSubroutineUniformLocation", sig, 3, args);
+	GLint result = glGetSubroutineUniformLocation((GLuint)args[0].value.i, (GLenum)args[1].value.i, qd_string_data(args[2].value.s));
+	qd_string_release(args[2].value.s);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// GetSubroutineIndex( program:i64 shadertype:i64 name:str -- result:i64 )
+int GetSubroutineIndex(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetSubroutineIndex", sig, 3, args);
+	GLuint result = glGetSubroutineIndex((GLuint)args[0].value.i, (GLenum)args[1].value.i, qd_string_data(args[2].value.s));
+	qd_string_release(args[2].value.s);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// GetActiveSubroutineUniformiv( program:i64 shadertype:i64 index:i64 pname:i64 values:ptr -- )
+int GetActiveSubroutineUniformiv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "GetActiveSubroutineUniformiv", sig, 5, args);
+	glGetActiveSubroutineUniformiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLenum)args[3].value.i, (GLint *)args[4].value.p);
+	return 0;
+}
+
+// GetActiveSubroutineUniformName( program:i64 shadertype:i64 index:i64 bufSize:i64 length:ptr name:ptr -- )
+int GetActiveSubroutineUniformName(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "GetActiveSubroutineUniformName", sig, 6, args);
+	glGetActiveSubroutineUniformName((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei *)args[4].value.p, (GLchar *)args[5].value.p);
+	return 0;
+}
+
+// GetActiveSubroutineName( program:i64 shadertype:i64 index:i64 bufSize:i64 length:ptr name:ptr -- )
+int GetActiveSubroutineName(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "GetActiveSubroutineName", sig, 6, args);
+	glGetActiveSubroutineName((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei *)args[4].value.p, (GLchar *)args[5].value.p);
+	return 0;
+}
+
+// UniformSubroutinesuiv( shadertype:i64 count:i64 indices:ptr -- )
+int UniformSubroutinesuiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "UniformSubroutinesuiv", sig, 3, args);
+	glUniformSubroutinesuiv((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (const GLuint *)args[2].value.p);
+	return 0;
+}
+
+// GetUniformSubroutineuiv( shadertype:i64 location:i64 params:ptr -- )
+int GetUniformSubroutineuiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetUniformSubroutineuiv", sig, 3, args);
+	glGetUniformSubroutineuiv((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLuint *)args[2].value.p);
+	return 0;
+}
+
+// GetProgramStageiv( program:i64 shadertype:i64 pname:i64 values:ptr -- )
+int GetProgramStageiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetProgramStageiv", sig, 4, args);
+	glGetProgramStageiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLint *)args[3].value.p);
+	return 0;
+}
+
+// PatchParameteri( pname:i64 value:i64 -- )
+int PatchParameteri(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "PatchParameteri", sig, 2, args);
+	glPatchParameteri((GLenum)args[0].value.i, (GLint)args[1].value.i);
+	return 0;
+}
+
+// PatchParameterfv( pname:i64 values:ptr -- )
+int PatchParameterfv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "PatchParameterfv", sig, 2, args);
+	glPatchParameterfv((GLenum)args[0].value.i, (const GLfloat *)args[1].value.p);
+	return 0;
+}
+
+// BindTransformFeedback( target:i64 id:i64 -- )
+int BindTransformFeedback(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "BindTransformFeedback", sig, 2, args);
+	glBindTransformFeedback((GLenum)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// DeleteTransformFeedbacks( n:i64 ids:ptr -- )
+int DeleteTransformFeedbacks(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DeleteTransformFeedbacks", sig, 2, args);
+	glDeleteTransformFeedbacks((GLsizei)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// GenTransformFeedbacks( n:i64 ids:ptr -- )
+int GenTransformFeedbacks(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GenTransformFeedbacks", sig, 2, args);
+	glGenTransformFeedbacks((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// IsTransformFeedback( id:i64 -- result:i64 )
+int IsTransformFeedback(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "IsTransformFeedback", sig, 1, args);
+	GLboolean result = glIsTransformFeedback((GLuint)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// PauseTransformFeedback( -- )
+int PauseTransformFeedback(qd_context* ctx) {
+	(void)ctx;
+	glPauseTransformFeedback();
+	return 0;
+}
+
+// ResumeTransformFeedback( -- )
+int ResumeTransformFeedback(qd_context* ctx) {
+	(void)ctx;
+	glResumeTransformFeedback();
+	return 0;
+}
+
+// DrawTransformFeedback( mode:i64 id:i64 -- )
+int DrawTransformFeedback(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DrawTransformFeedback", sig, 2, args);
+	glDrawTransformFeedback((GLenum)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// DrawTransformFeedbackStream( mode:i64 id:i64 stream:i64 -- )
+int DrawTransformFeedbackStream(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "DrawTransformFeedbackStream", sig, 3, args);
+	glDrawTransformFeedbackStream((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// BeginQueryIndexed( target:i64 index:i64 id:i64 -- )
+int BeginQueryIndexed(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "BeginQueryIndexed", sig, 3, args);
+	glBeginQueryIndexed((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// EndQueryIndexed( target:i64 index:i64 -- )
+int EndQueryIndexed(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "EndQueryIndexed", sig, 2, args);
+	glEndQueryIndexed((GLenum)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// GetQueryIndexediv( target:i64 index:i64 pname:i64 params:ptr -- )
+int GetQueryIndexediv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetQueryIndexediv", sig, 4, args);
+	glGetQueryIndexediv((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLenum)args[2].value.i, (GLint *)args[3].value.p);
+	return 0;
+}
+
+// ReleaseShaderCompiler( -- )
+int ReleaseShaderCompiler(qd_context* ctx) {
+	(void)ctx;
+	glReleaseShaderCompiler();
+	return 0;
+}
+
+// ShaderBinary( count:i64 shaders:ptr binaryFormat:i64 binary:ptr length:i64 -- )
+int ShaderBinary(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ShaderBinary", sig, 5, args);
+	glShaderBinary((GLsizei)args[0].value.i, (const GLuint *)args[1].value.p, (GLenum)args[2].value.i, (const void *)args[3].value.p, (GLsizei)args[4].value.i);
+	return 0;
+}
+
+// GetShaderPrecisionFormat( shadertype:i64 precisiontype:i64 range:ptr precision:ptr -- )
+int GetShaderPrecisionFormat(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetShaderPrecisionFormat", sig, 4, args);
+	glGetShaderPrecisionFormat((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p, (GLint *)args[3].value.p);
+	return 0;
+}
+
+// DepthRangef( n:f64 f:f64 -- )
+int DepthRangef(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DepthRangef", sig, 2, args);
+	glDepthRangef((GLfloat)args[0].value.f, (GLfloat)args[1].value.f);
+	return 0;
+}
+
+// ClearDepthf( d:f64 -- )
+int ClearDepthf(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "ClearDepthf", sig, 1, args);
+	glClearDepthf((GLfloat)args[0].value.f);
+	return 0;
+}
+
+// GetProgramBinary( program:i64 bufSize:i64 length:ptr binaryFormat:ptr binary:ptr -- )
+int GetProgramBinary(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "GetProgramBinary", sig, 5, args);
+	glGetProgramBinary((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (GLsizei *)args[2].value.p, (GLenum *)args[3].value.p, (void *)args[4].value.p);
+	return 0;
+}
+
+// ProgramBinary( program:i64 binaryFormat:i64 binary:ptr length:i64 -- )
+int ProgramBinary(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramBinary", sig, 4, args);
+	glProgramBinary((GLuint)args[0].value.i, (GLenum)args[1].value.i, (const void *)args[2].value.p, (GLsizei)args[3].value.i);
+	return 0;
+}
+
+// ProgramParameteri( program:i64 pname:i64 value:i64 -- )
+int ProgramParameteri(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "ProgramParameteri", sig, 3, args);
+	glProgramParameteri((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint)args[2].value.i);
+	return 0;
+}
+
+// UseProgramStages( pipeline:i64 stages:i64 program:i64 -- )
+int UseProgramStages(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "UseProgramStages", sig, 3, args);
+	glUseProgramStages((GLuint)args[0].value.i, (GLbitfield)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// ActiveShaderProgram( pipeline:i64 program:i64 -- )
+int ActiveShaderProgram(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "ActiveShaderProgram", sig, 2, args);
+	glActiveShaderProgram((GLuint)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// BindProgramPipeline( pipeline:i64 -- )
+int BindProgramPipeline(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "BindProgramPipeline", sig, 1, args);
+	glBindProgramPipeline((GLuint)args[0].value.i);
+	return 0;
+}
+
+// DeleteProgramPipelines( n:i64 pipelines:ptr -- )
+int DeleteProgramPipelines(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DeleteProgramPipelines", sig, 2, args);
+	glDeleteProgramPipelines((GLsizei)args[0].value.i, (const GLuint *)args[1].value.p);
+	return 0;
+}
+
+// GenProgramPipelines( n:i64 pipelines:ptr -- )
+int GenProgramPipelines(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "GenProgramPipelines", sig, 2, args);
+	glGenProgramPipelines((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// IsProgramPipeline( pipeline:i64 -- result:i64 )
+int IsProgramPipeline(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "IsProgramPipeline", sig, 1, args);
+	GLboolean result = glIsProgramPipeline((GLuint)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// GetProgramPipelineiv( pipeline:i64 pname:i64 params:ptr -- )
+int GetProgramPipelineiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetProgramPipelineiv", sig, 3, args);
+	glGetProgramPipelineiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// ProgramUniform1i( program:i64 location:i64 v0:i64 -- )
+int ProgramUniform1i(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "ProgramUniform1i", sig, 3, args);
+	glProgramUniform1i((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i);
+	return 0;
+}
+
+// ProgramUniform1iv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform1iv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform1iv", sig, 4, args);
+	glProgramUniform1iv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLint *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform1f( program:i64 location:i64 v0:f64 -- )
+int ProgramUniform1f(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "ProgramUniform1f", sig, 3, args);
+	glProgramUniform1f((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLfloat)args[2].value.f);
+	return 0;
+}
+
+// ProgramUniform1fv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform1fv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform1fv", sig, 4, args);
+	glProgramUniform1fv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLfloat *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform1d( program:i64 location:i64 v0:f64 -- )
+int ProgramUniform1d(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "ProgramUniform1d", sig, 3, args);
+	glProgramUniform1d((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLdouble)args[2].value.f);
+	return 0;
+}
+
+// ProgramUniform1dv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform1dv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform1dv", sig, 4, args);
+	glProgramUniform1dv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLdouble *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform1ui( program:i64 location:i64 v0:i64 -- )
+int ProgramUniform1ui(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "ProgramUniform1ui", sig, 3, args);
+	glProgramUniform1ui((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// ProgramUniform1uiv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform1uiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform1uiv", sig, 4, args);
+	glProgramUniform1uiv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLuint *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform2i( program:i64 location:i64 v0:i64 v1:i64 -- )
+int ProgramUniform2i(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform2i", sig, 4, args);
+	glProgramUniform2i((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i);
+	return 0;
+}
+
+// ProgramUniform2iv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform2iv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform2iv", sig, 4, args);
+	glProgramUniform2iv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLint *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform2f( program:i64 location:i64 v0:f64 v1:f64 -- )
+int ProgramUniform2f(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform2f", sig, 4, args);
+	glProgramUniform2f((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLfloat)args[2].value.f, (GLfloat)args[3].value.f);
+	return 0;
+}
+
+// ProgramUniform2fv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform2fv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform2fv", sig, 4, args);
+	glProgramUniform2fv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLfloat *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform2d( program:i64 location:i64 v0:f64 v1:f64 -- )
+int ProgramUniform2d(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform2d", sig, 4, args);
+	glProgramUniform2d((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLdouble)args[2].value.f, (GLdouble)args[3].value.f);
+	return 0;
+}
+
+// ProgramUniform2dv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform2dv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform2dv", sig, 4, args);
+	glProgramUniform2dv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLdouble *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform2ui( program:i64 location:i64 v0:i64 v1:i64 -- )
+int ProgramUniform2ui(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform2ui", sig, 4, args);
+	glProgramUniform2ui((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLuint)args[2].value.i, (GLuint)args[3].value.i);
+	return 0;
+}
+
+// ProgramUniform2uiv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform2uiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform2uiv", sig, 4, args);
+	glProgramUniform2uiv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLuint *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform3i( program:i64 location:i64 v0:i64 v1:i64 v2:i64 -- )
+int ProgramUniform3i(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniform3i", sig, 5, args);
+	glProgramUniform3i((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i);
+	return 0;
+}
+
+// ProgramUniform3iv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform3iv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform3iv", sig, 4, args);
+	glProgramUniform3iv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLint *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform3f( program:i64 location:i64 v0:f64 v1:f64 v2:f64 -- )
+int ProgramUniform3f(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniform3f", sig, 5, args);
+	glProgramUniform3f((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLfloat)args[2].value.f, (GLfloat)args[3].value.f, (GLfloat)args[4].value.f);
+	return 0;
+}
+
+// ProgramUniform3fv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform3fv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform3fv", sig, 4, args);
+	glProgramUniform3fv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLfloat *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform3d( program:i64 location:i64 v0:f64 v1:f64 v2:f64 -- )
+int ProgramUniform3d(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniform3d", sig, 5, args);
+	glProgramUniform3d((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLdouble)args[2].value.f, (GLdouble)args[3].value.f, (GLdouble)args[4].value.f);
+	return 0;
+}
+
+// ProgramUniform3dv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform3dv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform3dv", sig, 4, args);
+	glProgramUniform3dv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLdouble *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform3ui( program:i64 location:i64 v0:i64 v1:i64 v2:i64 -- )
+int ProgramUniform3ui(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniform3ui", sig, 5, args);
+	glProgramUniform3ui((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLuint)args[2].value.i, (GLuint)args[3].value.i, (GLuint)args[4].value.i);
+	return 0;
+}
+
+// ProgramUniform3uiv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform3uiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform3uiv", sig, 4, args);
+	glProgramUniform3uiv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLuint *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform4i( program:i64 location:i64 v0:i64 v1:i64 v2:i64 v3:i64 -- )
+int ProgramUniform4i(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "ProgramUniform4i", sig, 6, args);
+	glProgramUniform4i((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLint)args[5].value.i);
+	return 0;
+}
+
+// ProgramUniform4iv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform4iv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform4iv", sig, 4, args);
+	glProgramUniform4iv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLint *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform4f( program:i64 location:i64 v0:f64 v1:f64 v2:f64 v3:f64 -- )
+int ProgramUniform4f(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "ProgramUniform4f", sig, 6, args);
+	glProgramUniform4f((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLfloat)args[2].value.f, (GLfloat)args[3].value.f, (GLfloat)args[4].value.f, (GLfloat)args[5].value.f);
+	return 0;
+}
+
+// ProgramUniform4fv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform4fv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform4fv", sig, 4, args);
+	glProgramUniform4fv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLfloat *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform4d( program:i64 location:i64 v0:f64 v1:f64 v2:f64 v3:f64 -- )
+int ProgramUniform4d(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "ProgramUniform4d", sig, 6, args);
+	glProgramUniform4d((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLdouble)args[2].value.f, (GLdouble)args[3].value.f, (GLdouble)args[4].value.f, (GLdouble)args[5].value.f);
+	return 0;
+}
+
+// ProgramUniform4dv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform4dv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform4dv", sig, 4, args);
+	glProgramUniform4dv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLdouble *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniform4ui( program:i64 location:i64 v0:i64 v1:i64 v2:i64 v3:i64 -- )
+int ProgramUniform4ui(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "ProgramUniform4ui", sig, 6, args);
+	glProgramUniform4ui((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLuint)args[2].value.i, (GLuint)args[3].value.i, (GLuint)args[4].value.i, (GLuint)args[5].value.i);
+	return 0;
+}
+
+// ProgramUniform4uiv( program:i64 location:i64 count:i64 value:ptr -- )
+int ProgramUniform4uiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ProgramUniform4uiv", sig, 4, args);
+	glProgramUniform4uiv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (const GLuint *)args[3].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix2fv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix2fv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix2fv", sig, 5, args);
+	glProgramUniformMatrix2fv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLfloat *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix3fv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix3fv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix3fv", sig, 5, args);
+	glProgramUniformMatrix3fv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLfloat *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix4fv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix4fv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix4fv", sig, 5, args);
+	glProgramUniformMatrix4fv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLfloat *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix2dv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix2dv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix2dv", sig, 5, args);
+	glProgramUniformMatrix2dv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLdouble *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix3dv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix3dv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix3dv", sig, 5, args);
+	glProgramUniformMatrix3dv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLdouble *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix4dv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix4dv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix4dv", sig, 5, args);
+	glProgramUniformMatrix4dv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLdouble *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix2x3fv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix2x3fv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix2x3fv", sig, 5, args);
+	glProgramUniformMatrix2x3fv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLfloat *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix3x2fv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix3x2fv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix3x2fv", sig, 5, args);
+	glProgramUniformMatrix3x2fv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLfloat *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix2x4fv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix2x4fv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix2x4fv", sig, 5, args);
+	glProgramUniformMatrix2x4fv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLfloat *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix4x2fv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix4x2fv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix4x2fv", sig, 5, args);
+	glProgramUniformMatrix4x2fv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLfloat *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix3x4fv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix3x4fv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix3x4fv", sig, 5, args);
+	glProgramUniformMatrix3x4fv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLfloat *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix4x3fv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix4x3fv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix4x3fv", sig, 5, args);
+	glProgramUniformMatrix4x3fv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLfloat *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix2x3dv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix2x3dv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix2x3dv", sig, 5, args);
+	glProgramUniformMatrix2x3dv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLdouble *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix3x2dv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix3x2dv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix3x2dv", sig, 5, args);
+	glProgramUniformMatrix3x2dv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLdouble *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix2x4dv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix2x4dv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix2x4dv", sig, 5, args);
+	glProgramUniformMatrix2x4dv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLdouble *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix4x2dv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix4x2dv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix4x2dv", sig, 5, args);
+	glProgramUniformMatrix4x2dv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLdouble *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix3x4dv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix3x4dv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix3x4dv", sig, 5, args);
+	glProgramUniformMatrix3x4dv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLdouble *)args[4].value.p);
+	return 0;
+}
+
+// ProgramUniformMatrix4x3dv( program:i64 location:i64 count:i64 transpose:i64 value:ptr -- )
+int ProgramUniformMatrix4x3dv(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ProgramUniformMatrix4x3dv", sig, 5, args);
+	glProgramUniformMatrix4x3dv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLboolean)args[3].value.i, (const GLdouble *)args[4].value.p);
+	return 0;
+}
+
+// ValidateProgramPipeline( pipeline:i64 -- )
+int ValidateProgramPipeline(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "ValidateProgramPipeline", sig, 1, args);
+	glValidateProgramPipeline((GLuint)args[0].value.i);
+	return 0;
+}
+
+// GetProgramPipelineInfoLog( pipeline:i64 bufSize:i64 length:ptr infoLog:ptr -- )
+int GetProgramPipelineInfoLog(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetProgramPipelineInfoLog", sig, 4, args);
+	glGetProgramPipelineInfoLog((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (GLsizei *)args[2].value.p, (GLchar *)args[3].value.p);
+	return 0;
+}
+
+// VertexAttribL1d( index:i64 x:f64 -- )
+int VertexAttribL1d(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribL1d", sig, 2, args);
+	glVertexAttribL1d((GLuint)args[0].value.i, (GLdouble)args[1].value.f);
+	return 0;
+}
+
+// VertexAttribL2d( index:i64 x:f64 y:f64 -- )
+int VertexAttribL2d(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "VertexAttribL2d", sig, 3, args);
+	glVertexAttribL2d((GLuint)args[0].value.i, (GLdouble)args[1].value.f, (GLdouble)args[2].value.f);
+	return 0;
+}
+
+// VertexAttribL3d( index:i64 x:f64 y:f64 z:f64 -- )
+int VertexAttribL3d(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttribL3d", sig, 4, args);
+	glVertexAttribL3d((GLuint)args[0].value.i, (GLdouble)args[1].value.f, (GLdouble)args[2].value.f, (GLdouble)args[3].value.f);
+	return 0;
+}
+
+// VertexAttribL4d( index:i64 x:f64 y:f64 z:f64 w:f64 -- )
+int VertexAttribL4d(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "VertexAttribL4d", sig, 5, args);
+	glVertexAttribL4d((GLuint)args[0].value.i, (GLdouble)args[1].value.f, (GLdouble)args[2].value.f, (GLdouble)args[3].value.f, (GLdouble)args[4].value.f);
+	return 0;
+}
+
+// VertexAttribL1dv( index:i64 v:ptr -- )
+int VertexAttribL1dv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribL1dv", sig, 2, args);
+	glVertexAttribL1dv((GLuint)args[0].value.i, (const GLdouble *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribL2dv( index:i64 v:ptr -- )
+int VertexAttribL2dv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribL2dv", sig, 2, args);
+	glVertexAttribL2dv((GLuint)args[0].value.i, (const GLdouble *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribL3dv( index:i64 v:ptr -- )
+int VertexAttribL3dv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribL3dv", sig, 2, args);
+	glVertexAttribL3dv((GLuint)args[0].value.i, (const GLdouble *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribL4dv( index:i64 v:ptr -- )
+int VertexAttribL4dv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribL4dv", sig, 2, args);
+	glVertexAttribL4dv((GLuint)args[0].value.i, (const GLdouble *)args[1].value.p);
+	return 0;
+}
+
+// VertexAttribLPointer( index:i64 size:i64 type:i64 stride:i64 pointer:i64 -- )
+int VertexAttribLPointer(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "VertexAttribLPointer", sig, 5, args);
+	glVertexAttribLPointer((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (const void *)(intptr_t)args[4].value.i);
+	return 0;
+}
+
+// GetVertexAttribLdv( index:i64 pname:i64 params:ptr -- )
+int GetVertexAttribLdv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetVertexAttribLdv", sig, 3, args);
+	glGetVertexAttribLdv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLdouble *)args[2].value.p);
+	return 0;
+}
+
+// ViewportArrayv( first:i64 count:i64 v:ptr -- )
+int ViewportArrayv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "ViewportArrayv", sig, 3, args);
+	glViewportArrayv((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (const GLfloat *)args[2].value.p);
+	return 0;
+}
+
+// ViewportIndexedf( index:i64 x:f64 y:f64 w:f64 h:f64 -- )
+int ViewportIndexedf(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ViewportIndexedf", sig, 5, args);
+	glViewportIndexedf((GLuint)args[0].value.i, (GLfloat)args[1].value.f, (GLfloat)args[2].value.f, (GLfloat)args[3].value.f, (GLfloat)args[4].value.f);
+	return 0;
+}
+
+// ViewportIndexedfv( index:i64 v:ptr -- )
+int ViewportIndexedfv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "ViewportIndexedfv", sig, 2, args);
+	glViewportIndexedfv((GLuint)args[0].value.i, (const GLfloat *)args[1].value.p);
+	return 0;
+}
+
+// ScissorArrayv( first:i64 count:i64 v:ptr -- )
+int ScissorArrayv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "ScissorArrayv", sig, 3, args);
+	glScissorArrayv((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (const GLint *)args[2].value.p);
+	return 0;
+}
+
+// ScissorIndexed( index:i64 left:i64 bottom:i64 width:i64 height:i64 -- )
+int ScissorIndexed(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ScissorIndexed", sig, 5, args);
+	glScissorIndexed((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i);
+	return 0;
+}
+
+// ScissorIndexedv( index:i64 v:ptr -- )
+int ScissorIndexedv(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "ScissorIndexedv", sig, 2, args);
+	glScissorIndexedv((GLuint)args[0].value.i, (const GLint *)args[1].value.p);
+	return 0;
+}
+
+// DepthRangeArrayv( first:i64 count:i64 v:ptr -- )
+int DepthRangeArrayv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "DepthRangeArrayv", sig, 3, args);
+	glDepthRangeArrayv((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (const GLdouble *)args[2].value.p);
+	return 0;
+}
+
+// DepthRangeIndexed( index:i64 n:f64 f:f64 -- )
+int DepthRangeIndexed(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "DepthRangeIndexed", sig, 3, args);
+	glDepthRangeIndexed((GLuint)args[0].value.i, (GLdouble)args[1].value.f, (GLdouble)args[2].value.f);
+	return 0;
+}
+
+// GetFloati_v( target:i64 index:i64 data:ptr -- )
+int GetFloati_v(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetFloati_v", sig, 3, args);
+	glGetFloati_v((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLfloat *)args[2].value.p);
+	return 0;
+}
+
+// GetDoublei_v( target:i64 index:i64 data:ptr -- )
+int GetDoublei_v(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetDoublei_v", sig, 3, args);
+	glGetDoublei_v((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLdouble *)args[2].value.p);
+	return 0;
+}
+
+// DrawElementsInstancedBaseInstance( mode:i64 count:i64 type:i64 indices:i64 instancecount:i64 baseinstance:i64 -- )
+int DrawElementsInstancedBaseInstance(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "DrawElementsInstancedBaseInstance", sig, 6, args);
+	glDrawElementsInstancedBaseInstance((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (const void *)(intptr_t)args[3].value.i, (GLsizei)args[4].value.i, (GLuint)args[5].value.i);
+	return 0;
+}
+
+// GetInternalformativ( target:i64 internalformat:i64 pname:i64 count:i64 params:ptr -- )
+int GetInternalformativ(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "GetInternalformativ", sig, 5, args);
+	glGetInternalformativ((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLint *)args[4].value.p);
+	return 0;
+}
+
+// GetActiveAtomicCounterBufferiv( program:i64 bufferIndex:i64 pname:i64 params:ptr -- )
+int GetActiveAtomicCounterBufferiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetActiveAtomicCounterBufferiv", sig, 4, args);
+	glGetActiveAtomicCounterBufferiv((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLenum)args[2].value.i, (GLint *)args[3].value.p);
+	return 0;
+}
+
+// BindImageTexture( unit:i64 texture:i64 level:i64 layered:i64 layer:i64 access:i64 format:i64 -- )
+int BindImageTexture(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "BindImageTexture", sig, 7, args);
+	glBindImageTexture((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLint)args[2].value.i, (GLboolean)args[3].value.i, (GLint)args[4].value.i, (GLenum)args[5].value.i, (GLenum)args[6].value.i);
+	return 0;
+}
+
+// MemoryBarrier( barriers:i64 -- )
+int MemoryBarrier(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "MemoryBarrier", sig, 1, args);
+	glMemoryBarrier((GLbitfield)args[0].value.i);
+	return 0;
+}
+
+// TexStorage1D( target:i64 levels:i64 internalformat:i64 width:i64 -- )
+int TexStorage1D(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "TexStorage1D", sig, 4, args);
+	glTexStorage1D((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i);
+	return 0;
+}
+
+// DrawTransformFeedbackInstanced( mode:i64 id:i64 instancecount:i64 -- )
+int DrawTransformFeedbackInstanced(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "DrawTransformFeedbackInstanced", sig, 3, args);
+	glDrawTransformFeedbackInstanced((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLsizei)args[2].value.i);
+	return 0;
+}
+
+// DrawTransformFeedbackStreamInstanced( mode:i64 id:i64 stream:i64 instancecount:i64 -- )
+int DrawTransformFeedbackStreamInstanced(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "DrawTransformFeedbackStreamInstanced", sig, 4, args);
+	glDrawTransformFeedbackStreamInstanced((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i, (GLsizei)args[3].value.i);
+	return 0;
+}
+
+// ClearBufferData( target:i64 internalformat:i64 format:i64 type:i64 data:ptr -- )
+int ClearBufferData(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ClearBufferData", sig, 5, args);
+	glClearBufferData((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLenum)args[3].value.i, (const void *)args[4].value.p);
+	return 0;
+}
+
+// ClearBufferSubData( target:i64 internalformat:i64 offset:i64 size:i64 format:i64 type:i64 data:ptr -- )
+int ClearBufferSubData(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "ClearBufferSubData", sig, 7, args);
+	glClearBufferSubData((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLintptr)args[2].value.i, (GLsizeiptr)args[3].value.i, (GLenum)args[4].value.i, (GLenum)args[5].value.i, (const void *)args[6].value.p);
+	return 0;
+}
+
+// DispatchCompute( num_groups_x:i64 num_groups_y:i64 num_groups_z:i64 -- )
+int DispatchCompute(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "DispatchCompute", sig, 3, args);
+	glDispatchCompute((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// DispatchComputeIndirect( indirect:i64 -- )
+int DispatchComputeIndirect(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "DispatchComputeIndirect", sig, 1, args);
+	glDispatchComputeIndirect((GLintptr)args[0].value.i);
+	return 0;
+}
+
+// CopyImageSubData( srcName:i64 srcTarget:i64 srcLevel:i64 srcX:i64 srcY:i64 srcZ:i64 dstName:i64 dstTarget:i64 dstLevel:i64 dstX:i64 dstY:i64 dstZ:i64 srcWidth:i64 srcHeight:i64 srcDepth:i64 -- )
+int CopyImageSubData(qd_context* ctx) {
+	static const int sig[15] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[15];
+	gl_pop_args(ctx, "CopyImageSubData", sig, 15, args);
+	glCopyImageSubData((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLint)args[5].value.i, (GLuint)args[6].value.i, (GLenum)args[7].value.i, (GLint)args[8].value.i, (GLint)args[9].value.i, (GLint)args[10].value.i, (GLint)args[11].value.i, (GLsizei)args[12].value.i, (GLsizei)args[13].value.i, (GLsizei)args[14].value.i);
+	return 0;
+}
+
+// FramebufferParameteri( target:i64 pname:i64 param:i64 -- )
+int FramebufferParameteri(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "FramebufferParameteri", sig, 3, args);
+	glFramebufferParameteri((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLint)args[2].value.i);
+	return 0;
+}
+
+// GetFramebufferParameteriv( target:i64 pname:i64 params:ptr -- )
+int GetFramebufferParameteriv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetFramebufferParameteriv", sig, 3, args);
+	glGetFramebufferParameteriv((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetInternalformati64v( target:i64 internalformat:i64 pname:i64 count:i64 params:ptr -- )
+int GetInternalformati64v(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "GetInternalformati64v", sig, 5, args);
+	glGetInternalformati64v((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLint64 *)args[4].value.p);
+	return 0;
+}
+
+// InvalidateTexSubImage( texture:i64 level:i64 xoffset:i64 yoffset:i64 zoffset:i64 width:i64 height:i64 depth:i64 -- )
+int InvalidateTexSubImage(qd_context* ctx) {
+	static const int sig[8] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[8];
+	gl_pop_args(ctx, "InvalidateTexSubImage", sig, 8, args);
+	glInvalidateTexSubImage((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLsizei)args[5].value.i, (GLsizei)args[6].value.i, (GLsizei)args[7].value.i);
+	return 0;
+}
+
+// InvalidateTexImage( texture:i64 level:i64 -- )
+int InvalidateTexImage(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "InvalidateTexImage", sig, 2, args);
+	glInvalidateTexImage((GLuint)args[0].value.i, (GLint)args[1].value.i);
+	return 0;
+}
+
+// InvalidateBufferSubData( buffer:i64 offset:i64 length:i64 -- )
+int InvalidateBufferSubData(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "InvalidateBufferSubData", sig, 3, args);
+	glInvalidateBufferSubData((GLuint)args[0].value.i, (GLintptr)args[1].value.i, (GLsizeiptr)args[2].value.i);
+	return 0;
+}
+
+// InvalidateBufferData( buffer:i64 -- )
+int InvalidateBufferData(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "InvalidateBufferData", sig, 1, args);
+	glInvalidateBufferData((GLuint)args[0].value.i);
+	return 0;
+}
+
+// InvalidateFramebuffer( target:i64 numAttachments:i64 attachments:ptr -- )
+int InvalidateFramebuffer(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "InvalidateFramebuffer", sig, 3, args);
+	glInvalidateFramebuffer((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (const GLenum *)args[2].value.p);
+	return 0;
+}
+
+// InvalidateSubFramebuffer( target:i64 numAttachments:i64 attachments:ptr x:i64 y:i64 width:i64 height:i64 -- )
+int InvalidateSubFramebuffer(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "InvalidateSubFramebuffer", sig, 7, args);
+	glInvalidateSubFramebuffer((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (const GLenum *)args[2].value.p, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLsizei)args[5].value.i, (GLsizei)args[6].value.i);
+	return 0;
+}
+
+// GetProgramInterfaceiv( program:i64 programInterface:i64 pname:i64 params:ptr -- )
+int GetProgramInterfaceiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetProgramInterfaceiv", sig, 4, args);
+	glGetProgramInterfaceiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLint *)args[3].value.p);
+	return 0;
+}
+
+// GetProgramResourceIndex( program:i64 programInterface:i64 name:str -- result:i64 )
+int GetProgramResourceIndex(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetProgramResourceIndex", sig, 3, args);
+	GLuint result = glGetProgramResourceIndex((GLuint)args[0].value.i, (GLenum)args[1].value.i, qd_string_data(args[2].value.s));
+	qd_string_release(args[2].value.s);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// GetProgramResourceName( program:i64 programInterface:i64 index:i64 bufSize:i64 length:ptr name:ptr -- )
+int GetProgramResourceName(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "GetProgramResourceName", sig, 6, args);
+	glGetProgramResourceName((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei *)args[4].value.p, (GLchar *)args[5].value.p);
+	return 0;
+}
+
+// GetProgramResourceiv( program:i64 programInterface:i64 index:i64 propCount:i64 props:ptr count:i64 length:ptr params:ptr -- )
+int GetProgramResourceiv(qd_context* ctx) {
+	static const int sig[8] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[8];
+	gl_pop_args(ctx, "GetProgramResourceiv", sig, 8, args);
+	glGetProgramResourceiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLsizei)args[3].value.i, (const GLenum *)args[4].value.p, (GLsizei)args[5].value.i, (GLsizei *)args[6].value.p, (GLint *)args[7].value.p);
+	return 0;
+}
+
+// GetProgramResourceLocation( program:i64 programInterface:i64 name:str -- result:i64 )
+int GetProgramResourceLocation(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetProgramResourceLocation", sig, 3, args);
+	GLint result = glGetProgramResourceLocation((GLuint)args[0].value.i, (GLenum)args[1].value.i, qd_string_data(args[2].value.s));
+	qd_string_release(args[2].value.s);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// GetProgramResourceLocationIndex( program:i64 programInterface:i64 name:str -- result:i64 )
+int GetProgramResourceLocationIndex(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetProgramResourceLocationIndex", sig, 3, args);
+	GLint result = glGetProgramResourceLocationIndex((GLuint)args[0].value.i, (GLenum)args[1].value.i, qd_string_data(args[2].value.s));
+	qd_string_release(args[2].value.s);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// ShaderStorageBlockBinding( program:i64 storageBlockIndex:i64 storageBlockBinding:i64 -- )
+int ShaderStorageBlockBinding(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "ShaderStorageBlockBinding", sig, 3, args);
+	glShaderStorageBlockBinding((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// TexBufferRange( target:i64 internalformat:i64 buffer:i64 offset:i64 size:i64 -- )
+int TexBufferRange(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "TexBufferRange", sig, 5, args);
+	glTexBufferRange((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLintptr)args[3].value.i, (GLsizeiptr)args[4].value.i);
+	return 0;
+}
+
+// TexStorage2DMultisample( target:i64 samples:i64 internalformat:i64 width:i64 height:i64 fixedsamplelocations:i64 -- )
+int TexStorage2DMultisample(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "TexStorage2DMultisample", sig, 6, args);
+	glTexStorage2DMultisample((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i, (GLboolean)args[5].value.i);
+	return 0;
+}
+
+// TexStorage3DMultisample( target:i64 samples:i64 internalformat:i64 width:i64 height:i64 depth:i64 fixedsamplelocations:i64 -- )
+int TexStorage3DMultisample(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "TexStorage3DMultisample", sig, 7, args);
+	glTexStorage3DMultisample((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i, (GLsizei)args[5].value.i, (GLboolean)args[6].value.i);
+	return 0;
+}
+
+// TextureView( texture:i64 target:i64 origtexture:i64 internalformat:i64 minlevel:i64 numlevels:i64 minlayer:i64 numlayers:i64 -- )
+int TextureView(qd_context* ctx) {
+	static const int sig[8] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[8];
+	gl_pop_args(ctx, "TextureView", sig, 8, args);
+	glTextureView((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLenum)args[3].value.i, (GLuint)args[4].value.i, (GLuint)args[5].value.i, (GLuint)args[6].value.i, (GLuint)args[7].value.i);
+	return 0;
+}
+
+// BindVertexBuffer( bindingindex:i64 buffer:i64 offset:i64 stride:i64 -- )
+int BindVertexBuffer(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "BindVertexBuffer", sig, 4, args);
+	glBindVertexBuffer((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLintptr)args[2].value.i, (GLsizei)args[3].value.i);
+	return 0;
+}
+
+// VertexAttribFormat( attribindex:i64 size:i64 type:i64 normalized:i64 relativeoffset:i64 -- )
+int VertexAttribFormat(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "VertexAttribFormat", sig, 5, args);
+	glVertexAttribFormat((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLboolean)args[3].value.i, (GLuint)args[4].value.i);
+	return 0;
+}
+
+// VertexAttribIFormat( attribindex:i64 size:i64 type:i64 relativeoffset:i64 -- )
+int VertexAttribIFormat(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttribIFormat", sig, 4, args);
+	glVertexAttribIFormat((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLuint)args[3].value.i);
+	return 0;
+}
+
+// VertexAttribLFormat( attribindex:i64 size:i64 type:i64 relativeoffset:i64 -- )
+int VertexAttribLFormat(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "VertexAttribLFormat", sig, 4, args);
+	glVertexAttribLFormat((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLuint)args[3].value.i);
+	return 0;
+}
+
+// VertexAttribBinding( attribindex:i64 bindingindex:i64 -- )
+int VertexAttribBinding(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexAttribBinding", sig, 2, args);
+	glVertexAttribBinding((GLuint)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// VertexBindingDivisor( bindingindex:i64 divisor:i64 -- )
+int VertexBindingDivisor(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexBindingDivisor", sig, 2, args);
+	glVertexBindingDivisor((GLuint)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// DebugMessageControl( source:i64 type:i64 severity:i64 count:i64 ids:ptr enabled:i64 -- )
+int DebugMessageControl(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "DebugMessageControl", sig, 6, args);
+	glDebugMessageControl((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (const GLuint *)args[4].value.p, (GLboolean)args[5].value.i);
+	return 0;
+}
+
+// DebugMessageInsert( source:i64 type:i64 id:i64 severity:i64 length:i64 buf:str -- )
+int DebugMessageInsert(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "DebugMessageInsert", sig, 6, args);
+	glDebugMessageInsert((GLenum)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLenum)args[3].value.i, (GLsizei)args[4].value.i, qd_string_data(args[5].value.s));
+	qd_string_release(args[5].value.s);
+	return 0;
+}
+
+// GetDebugMessageLog( count:i64 bufSize:i64 sources:ptr types:ptr ids:ptr severities:ptr lengths:ptr messageLog:ptr -- result:i64 )
+int GetDebugMessageLog(qd_context* ctx) {
+	static const int sig[8] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[8];
+	gl_pop_args(ctx, "GetDebugMessageLog", sig, 8, args);
+	GLuint result = glGetDebugMessageLog((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (GLenum *)args[2].value.p, (GLenum *)args[3].value.p, (GLuint *)args[4].value.p, (GLenum *)args[5].value.p, (GLsizei *)args[6].value.p, (GLchar *)args[7].value.p);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// PushDebugGroup( source:i64 id:i64 length:i64 message:str -- )
+int PushDebugGroup(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "PushDebugGroup", sig, 4, args);
+	glPushDebugGroup((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLsizei)args[2].value.i, qd_string_data(args[3].value.s));
+	qd_string_release(args[3].value.s);
+	return 0;
+}
+
+// PopDebugGroup( -- )
+int PopDebugGroup(qd_context* ctx) {
+	(void)ctx;
+	glPopDebugGroup();
+	return 0;
+}
+
+// ObjectLabel( identifier:i64 name:i64 length:i64 label:str -- )
+int ObjectLabel(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ObjectLabel", sig, 4, args);
+	glObjectLabel((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLsizei)args[2].value.i, qd_string_data(args[3].value.s));
+	qd_string_release(args[3].value.s);
+	return 0;
+}
+
+// GetObjectLabel( identifier:i64 name:i64 bufSize:i64 length:ptr label:ptr -- )
+int GetObjectLabel(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "GetObjectLabel", sig, 5, args);
+	glGetObjectLabel((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei *)args[3].value.p, (GLchar *)args[4].value.p);
+	return 0;
+}
+
+// ObjectPtrLabel( ptr:ptr length:i64 label:str -- )
+int ObjectPtrLabel(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT, QD_STACK_TYPE_STR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "ObjectPtrLabel", sig, 3, args);
+	glObjectPtrLabel((const void *)args[0].value.p, (GLsizei)args[1].value.i, qd_string_data(args[2].value.s));
+	qd_string_release(args[2].value.s);
+	return 0;
+}
+
+// GetObjectPtrLabel( ptr:ptr bufSize:i64 length:ptr label:ptr -- )
+int GetObjectPtrLabel(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetObjectPtrLabel", sig, 4, args);
+	glGetObjectPtrLabel((const void *)args[0].value.p, (GLsizei)args[1].value.i, (GLsizei *)args[2].value.p, (GLchar *)args[3].value.p);
+	return 0;
+}
+
+// BufferStorage( target:i64 size:i64 data:ptr flags:i64 -- )
+int BufferStorage(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "BufferStorage", sig, 4, args);
+	glBufferStorage((GLenum)args[0].value.i, (GLsizeiptr)args[1].value.i, (const void *)args[2].value.p, (GLbitfield)args[3].value.i);
+	return 0;
+}
+
+// ClearTexImage( texture:i64 level:i64 format:i64 type:i64 data:ptr -- )
+int ClearTexImage(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ClearTexImage", sig, 5, args);
+	glClearTexImage((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLenum)args[3].value.i, (const void *)args[4].value.p);
+	return 0;
+}
+
+// ClearTexSubImage( texture:i64 level:i64 xoffset:i64 yoffset:i64 zoffset:i64 width:i64 height:i64 depth:i64 format:i64 type:i64 data:ptr -- )
+int ClearTexSubImage(qd_context* ctx) {
+	static const int sig[11] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[11];
+	gl_pop_args(ctx, "ClearTexSubImage", sig, 11, args);
+	glClearTexSubImage((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLsizei)args[5].value.i, (GLsizei)args[6].value.i, (GLsizei)args[7].value.i, (GLenum)args[8].value.i, (GLenum)args[9].value.i, (const void *)args[10].value.p);
+	return 0;
+}
+
+// BindBuffersBase( target:i64 first:i64 count:i64 buffers:ptr -- )
+int BindBuffersBase(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "BindBuffersBase", sig, 4, args);
+	glBindBuffersBase((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLsizei)args[2].value.i, (const GLuint *)args[3].value.p);
+	return 0;
+}
+
+// BindBuffersRange( target:i64 first:i64 count:i64 buffers:ptr offsets:ptr sizes:ptr -- )
+int BindBuffersRange(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "BindBuffersRange", sig, 6, args);
+	glBindBuffersRange((GLenum)args[0].value.i, (GLuint)args[1].value.i, (GLsizei)args[2].value.i, (const GLuint *)args[3].value.p, (const GLintptr *)args[4].value.p, (const GLsizeiptr *)args[5].value.p);
+	return 0;
+}
+
+// BindTextures( first:i64 count:i64 textures:ptr -- )
+int BindTextures(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "BindTextures", sig, 3, args);
+	glBindTextures((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (const GLuint *)args[2].value.p);
+	return 0;
+}
+
+// BindSamplers( first:i64 count:i64 samplers:ptr -- )
+int BindSamplers(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "BindSamplers", sig, 3, args);
+	glBindSamplers((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (const GLuint *)args[2].value.p);
+	return 0;
+}
+
+// BindImageTextures( first:i64 count:i64 textures:ptr -- )
+int BindImageTextures(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "BindImageTextures", sig, 3, args);
+	glBindImageTextures((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (const GLuint *)args[2].value.p);
+	return 0;
+}
+
+// BindVertexBuffers( first:i64 count:i64 buffers:ptr offsets:ptr strides:ptr -- )
+int BindVertexBuffers(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "BindVertexBuffers", sig, 5, args);
+	glBindVertexBuffers((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (const GLuint *)args[2].value.p, (const GLintptr *)args[3].value.p, (const GLsizei *)args[4].value.p);
+	return 0;
+}
+
+// ClipControl( origin:i64 depth:i64 -- )
+int ClipControl(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "ClipControl", sig, 2, args);
+	glClipControl((GLenum)args[0].value.i, (GLenum)args[1].value.i);
+	return 0;
+}
+
+// CreateTransformFeedbacks( n:i64 ids:ptr -- )
+int CreateTransformFeedbacks(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "CreateTransformFeedbacks", sig, 2, args);
+	glCreateTransformFeedbacks((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// TransformFeedbackBufferBase( xfb:i64 index:i64 buffer:i64 -- )
+int TransformFeedbackBufferBase(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TransformFeedbackBufferBase", sig, 3, args);
+	glTransformFeedbackBufferBase((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// TransformFeedbackBufferRange( xfb:i64 index:i64 buffer:i64 offset:i64 size:i64 -- )
+int TransformFeedbackBufferRange(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "TransformFeedbackBufferRange", sig, 5, args);
+	glTransformFeedbackBufferRange((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i, (GLintptr)args[3].value.i, (GLsizeiptr)args[4].value.i);
+	return 0;
+}
+
+// GetTransformFeedbackiv( xfb:i64 pname:i64 param:ptr -- )
+int GetTransformFeedbackiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetTransformFeedbackiv", sig, 3, args);
+	glGetTransformFeedbackiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetTransformFeedbacki_v( xfb:i64 pname:i64 index:i64 param:ptr -- )
+int GetTransformFeedbacki_v(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetTransformFeedbacki_v", sig, 4, args);
+	glGetTransformFeedbacki_v((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLint *)args[3].value.p);
+	return 0;
+}
+
+// GetTransformFeedbacki64_v( xfb:i64 pname:i64 index:i64 param:ptr -- )
+int GetTransformFeedbacki64_v(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetTransformFeedbacki64_v", sig, 4, args);
+	glGetTransformFeedbacki64_v((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLint64 *)args[3].value.p);
+	return 0;
+}
+
+// CreateBuffers( n:i64 buffers:ptr -- )
+int CreateBuffers(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "CreateBuffers", sig, 2, args);
+	glCreateBuffers((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// NamedBufferStorage( buffer:i64 size:i64 data:ptr flags:i64 -- )
+int NamedBufferStorage(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "NamedBufferStorage", sig, 4, args);
+	glNamedBufferStorage((GLuint)args[0].value.i, (GLsizeiptr)args[1].value.i, (const void *)args[2].value.p, (GLbitfield)args[3].value.i);
+	return 0;
+}
+
+// NamedBufferData( buffer:i64 size:i64 data:ptr usage:i64 -- )
+int NamedBufferData(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "NamedBufferData", sig, 4, args);
+	glNamedBufferData((GLuint)args[0].value.i, (GLsizeiptr)args[1].value.i, (const void *)args[2].value.p, (GLenum)args[3].value.i);
+	return 0;
+}
+
+// NamedBufferSubData( buffer:i64 offset:i64 size:i64 data:ptr -- )
+int NamedBufferSubData(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "NamedBufferSubData", sig, 4, args);
+	glNamedBufferSubData((GLuint)args[0].value.i, (GLintptr)args[1].value.i, (GLsizeiptr)args[2].value.i, (const void *)args[3].value.p);
+	return 0;
+}
+
+// CopyNamedBufferSubData( readBuffer:i64 writeBuffer:i64 readOffset:i64 writeOffset:i64 size:i64 -- )
+int CopyNamedBufferSubData(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "CopyNamedBufferSubData", sig, 5, args);
+	glCopyNamedBufferSubData((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLintptr)args[2].value.i, (GLintptr)args[3].value.i, (GLsizeiptr)args[4].value.i);
+	return 0;
+}
+
+// ClearNamedBufferData( buffer:i64 internalformat:i64 format:i64 type:i64 data:ptr -- )
+int ClearNamedBufferData(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ClearNamedBufferData", sig, 5, args);
+	glClearNamedBufferData((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLenum)args[3].value.i, (const void *)args[4].value.p);
+	return 0;
+}
+
+// ClearNamedBufferSubData( buffer:i64 internalformat:i64 offset:i64 size:i64 format:i64 type:i64 data:ptr -- )
+int ClearNamedBufferSubData(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "ClearNamedBufferSubData", sig, 7, args);
+	glClearNamedBufferSubData((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLintptr)args[2].value.i, (GLsizeiptr)args[3].value.i, (GLenum)args[4].value.i, (GLenum)args[5].value.i, (const void *)args[6].value.p);
+	return 0;
+}
+
+// MapNamedBuffer( buffer:i64 access:i64 -- result:ptr )
+int MapNamedBuffer(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "MapNamedBuffer", sig, 2, args);
+	void * result = glMapNamedBuffer((GLuint)args[0].value.i, (GLenum)args[1].value.i);
+	qd_push_p(ctx, (void*)result);
+	return 0;
+}
+
+// MapNamedBufferRange( buffer:i64 offset:i64 length:i64 access:i64 -- result:ptr )
+int MapNamedBufferRange(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "MapNamedBufferRange", sig, 4, args);
+	void * result = glMapNamedBufferRange((GLuint)args[0].value.i, (GLintptr)args[1].value.i, (GLsizeiptr)args[2].value.i, (GLbitfield)args[3].value.i);
+	qd_push_p(ctx, (void*)result);
+	return 0;
+}
+
+// UnmapNamedBuffer( buffer:i64 -- result:i64 )
+int UnmapNamedBuffer(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "UnmapNamedBuffer", sig, 1, args);
+	GLboolean result = glUnmapNamedBuffer((GLuint)args[0].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// FlushMappedNamedBufferRange( buffer:i64 offset:i64 length:i64 -- )
+int FlushMappedNamedBufferRange(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "FlushMappedNamedBufferRange", sig, 3, args);
+	glFlushMappedNamedBufferRange((GLuint)args[0].value.i, (GLintptr)args[1].value.i, (GLsizeiptr)args[2].value.i);
+	return 0;
+}
+
+// GetNamedBufferParameteriv( buffer:i64 pname:i64 params:ptr -- )
+int GetNamedBufferParameteriv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetNamedBufferParameteriv", sig, 3, args);
+	glGetNamedBufferParameteriv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetNamedBufferParameteri64v( buffer:i64 pname:i64 params:ptr -- )
+int GetNamedBufferParameteri64v(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetNamedBufferParameteri64v", sig, 3, args);
+	glGetNamedBufferParameteri64v((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint64 *)args[2].value.p);
+	return 0;
+}
+
+// GetNamedBufferSubData( buffer:i64 offset:i64 size:i64 data:ptr -- )
+int GetNamedBufferSubData(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetNamedBufferSubData", sig, 4, args);
+	glGetNamedBufferSubData((GLuint)args[0].value.i, (GLintptr)args[1].value.i, (GLsizeiptr)args[2].value.i, (void *)args[3].value.p);
+	return 0;
+}
+
+// CreateFramebuffers( n:i64 framebuffers:ptr -- )
+int CreateFramebuffers(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "CreateFramebuffers", sig, 2, args);
+	glCreateFramebuffers((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// NamedFramebufferRenderbuffer( framebuffer:i64 attachment:i64 renderbuffertarget:i64 renderbuffer:i64 -- )
+int NamedFramebufferRenderbuffer(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "NamedFramebufferRenderbuffer", sig, 4, args);
+	glNamedFramebufferRenderbuffer((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLuint)args[3].value.i);
+	return 0;
+}
+
+// NamedFramebufferParameteri( framebuffer:i64 pname:i64 param:i64 -- )
+int NamedFramebufferParameteri(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "NamedFramebufferParameteri", sig, 3, args);
+	glNamedFramebufferParameteri((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint)args[2].value.i);
+	return 0;
+}
+
+// NamedFramebufferTexture( framebuffer:i64 attachment:i64 texture:i64 level:i64 -- )
+int NamedFramebufferTexture(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "NamedFramebufferTexture", sig, 4, args);
+	glNamedFramebufferTexture((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLint)args[3].value.i);
+	return 0;
+}
+
+// NamedFramebufferTextureLayer( framebuffer:i64 attachment:i64 texture:i64 level:i64 layer:i64 -- )
+int NamedFramebufferTextureLayer(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "NamedFramebufferTextureLayer", sig, 5, args);
+	glNamedFramebufferTextureLayer((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i);
+	return 0;
+}
+
+// NamedFramebufferDrawBuffer( framebuffer:i64 buf:i64 -- )
+int NamedFramebufferDrawBuffer(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "NamedFramebufferDrawBuffer", sig, 2, args);
+	glNamedFramebufferDrawBuffer((GLuint)args[0].value.i, (GLenum)args[1].value.i);
+	return 0;
+}
+
+// NamedFramebufferDrawBuffers( framebuffer:i64 n:i64 bufs:ptr -- )
+int NamedFramebufferDrawBuffers(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "NamedFramebufferDrawBuffers", sig, 3, args);
+	glNamedFramebufferDrawBuffers((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (const GLenum *)args[2].value.p);
+	return 0;
+}
+
+// NamedFramebufferReadBuffer( framebuffer:i64 src:i64 -- )
+int NamedFramebufferReadBuffer(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "NamedFramebufferReadBuffer", sig, 2, args);
+	glNamedFramebufferReadBuffer((GLuint)args[0].value.i, (GLenum)args[1].value.i);
+	return 0;
+}
+
+// InvalidateNamedFramebufferData( framebuffer:i64 numAttachments:i64 attachments:ptr -- )
+int InvalidateNamedFramebufferData(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "InvalidateNamedFramebufferData", sig, 3, args);
+	glInvalidateNamedFramebufferData((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (const GLenum *)args[2].value.p);
+	return 0;
+}
+
+// InvalidateNamedFramebufferSubData( framebuffer:i64 numAttachments:i64 attachments:ptr x:i64 y:i64 width:i64 height:i64 -- )
+int InvalidateNamedFramebufferSubData(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "InvalidateNamedFramebufferSubData", sig, 7, args);
+	glInvalidateNamedFramebufferSubData((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (const GLenum *)args[2].value.p, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLsizei)args[5].value.i, (GLsizei)args[6].value.i);
+	return 0;
+}
+
+// ClearNamedFramebufferiv( framebuffer:i64 buffer:i64 drawbuffer:i64 value:ptr -- )
+int ClearNamedFramebufferiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ClearNamedFramebufferiv", sig, 4, args);
+	glClearNamedFramebufferiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint)args[2].value.i, (const GLint *)args[3].value.p);
+	return 0;
+}
+
+// ClearNamedFramebufferuiv( framebuffer:i64 buffer:i64 drawbuffer:i64 value:ptr -- )
+int ClearNamedFramebufferuiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ClearNamedFramebufferuiv", sig, 4, args);
+	glClearNamedFramebufferuiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint)args[2].value.i, (const GLuint *)args[3].value.p);
+	return 0;
+}
+
+// ClearNamedFramebufferfv( framebuffer:i64 buffer:i64 drawbuffer:i64 value:ptr -- )
+int ClearNamedFramebufferfv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "ClearNamedFramebufferfv", sig, 4, args);
+	glClearNamedFramebufferfv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint)args[2].value.i, (const GLfloat *)args[3].value.p);
+	return 0;
+}
+
+// ClearNamedFramebufferfi( framebuffer:i64 buffer:i64 drawbuffer:i64 depth:f64 stencil:i64 -- )
+int ClearNamedFramebufferfi(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "ClearNamedFramebufferfi", sig, 5, args);
+	glClearNamedFramebufferfi((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint)args[2].value.i, (GLfloat)args[3].value.f, (GLint)args[4].value.i);
+	return 0;
+}
+
+// BlitNamedFramebuffer( readFramebuffer:i64 drawFramebuffer:i64 srcX0:i64 srcY0:i64 srcX1:i64 srcY1:i64 dstX0:i64 dstY0:i64 dstX1:i64 dstY1:i64 mask:i64 filter:i64 -- )
+int BlitNamedFramebuffer(qd_context* ctx) {
+	static const int sig[12] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[12];
+	gl_pop_args(ctx, "BlitNamedFramebuffer", sig, 12, args);
+	glBlitNamedFramebuffer((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLint)args[5].value.i, (GLint)args[6].value.i, (GLint)args[7].value.i, (GLint)args[8].value.i, (GLint)args[9].value.i, (GLbitfield)args[10].value.i, (GLenum)args[11].value.i);
+	return 0;
+}
+
+// CheckNamedFramebufferStatus( framebuffer:i64 target:i64 -- result:i64 )
+int CheckNamedFramebufferStatus(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "CheckNamedFramebufferStatus", sig, 2, args);
+	GLenum result = glCheckNamedFramebufferStatus((GLuint)args[0].value.i, (GLenum)args[1].value.i);
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// GetNamedFramebufferParameteriv( framebuffer:i64 pname:i64 param:ptr -- )
+int GetNamedFramebufferParameteriv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetNamedFramebufferParameteriv", sig, 3, args);
+	glGetNamedFramebufferParameteriv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetNamedFramebufferAttachmentParameteriv( framebuffer:i64 attachment:i64 pname:i64 params:ptr -- )
+int GetNamedFramebufferAttachmentParameteriv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetNamedFramebufferAttachmentParameteriv", sig, 4, args);
+	glGetNamedFramebufferAttachmentParameteriv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLenum)args[2].value.i, (GLint *)args[3].value.p);
+	return 0;
+}
+
+// CreateRenderbuffers( n:i64 renderbuffers:ptr -- )
+int CreateRenderbuffers(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "CreateRenderbuffers", sig, 2, args);
+	glCreateRenderbuffers((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// NamedRenderbufferStorage( renderbuffer:i64 internalformat:i64 width:i64 height:i64 -- )
+int NamedRenderbufferStorage(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "NamedRenderbufferStorage", sig, 4, args);
+	glNamedRenderbufferStorage((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei)args[3].value.i);
+	return 0;
+}
+
+// NamedRenderbufferStorageMultisample( renderbuffer:i64 samples:i64 internalformat:i64 width:i64 height:i64 -- )
+int NamedRenderbufferStorageMultisample(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "NamedRenderbufferStorageMultisample", sig, 5, args);
+	glNamedRenderbufferStorageMultisample((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i);
+	return 0;
+}
+
+// GetNamedRenderbufferParameteriv( renderbuffer:i64 pname:i64 params:ptr -- )
+int GetNamedRenderbufferParameteriv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetNamedRenderbufferParameteriv", sig, 3, args);
+	glGetNamedRenderbufferParameteriv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// CreateTextures( target:i64 n:i64 textures:ptr -- )
+int CreateTextures(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "CreateTextures", sig, 3, args);
+	glCreateTextures((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLuint *)args[2].value.p);
+	return 0;
+}
+
+// TextureBuffer( texture:i64 internalformat:i64 buffer:i64 -- )
+int TextureBuffer(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TextureBuffer", sig, 3, args);
+	glTextureBuffer((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// TextureBufferRange( texture:i64 internalformat:i64 buffer:i64 offset:i64 size:i64 -- )
+int TextureBufferRange(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "TextureBufferRange", sig, 5, args);
+	glTextureBufferRange((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint)args[2].value.i, (GLintptr)args[3].value.i, (GLsizeiptr)args[4].value.i);
+	return 0;
+}
+
+// TextureStorage1D( texture:i64 levels:i64 internalformat:i64 width:i64 -- )
+int TextureStorage1D(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "TextureStorage1D", sig, 4, args);
+	glTextureStorage1D((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i);
+	return 0;
+}
+
+// TextureStorage2D( texture:i64 levels:i64 internalformat:i64 width:i64 height:i64 -- )
+int TextureStorage2D(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "TextureStorage2D", sig, 5, args);
+	glTextureStorage2D((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i);
+	return 0;
+}
+
+// TextureStorage3D( texture:i64 levels:i64 internalformat:i64 width:i64 height:i64 depth:i64 -- )
+int TextureStorage3D(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "TextureStorage3D", sig, 6, args);
+	glTextureStorage3D((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i, (GLsizei)args[5].value.i);
+	return 0;
+}
+
+// TextureStorage2DMultisample( texture:i64 samples:i64 internalformat:i64 width:i64 height:i64 fixedsamplelocations:i64 -- )
+int TextureStorage2DMultisample(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "TextureStorage2DMultisample", sig, 6, args);
+	glTextureStorage2DMultisample((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i, (GLboolean)args[5].value.i);
+	return 0;
+}
+
+// TextureStorage3DMultisample( texture:i64 samples:i64 internalformat:i64 width:i64 height:i64 depth:i64 fixedsamplelocations:i64 -- )
+int TextureStorage3DMultisample(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "TextureStorage3DMultisample", sig, 7, args);
+	glTextureStorage3DMultisample((GLuint)args[0].value.i, (GLsizei)args[1].value.i, (GLenum)args[2].value.i, (GLsizei)args[3].value.i, (GLsizei)args[4].value.i, (GLsizei)args[5].value.i, (GLboolean)args[6].value.i);
+	return 0;
+}
+
+// TextureSubImage1D( texture:i64 level:i64 xoffset:i64 width:i64 format:i64 type:i64 pixels:ptr -- )
+int TextureSubImage1D(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "TextureSubImage1D", sig, 7, args);
+	glTextureSubImage1D((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLsizei)args[3].value.i, (GLenum)args[4].value.i, (GLenum)args[5].value.i, (const void *)args[6].value.p);
+	return 0;
+}
+
+// TextureSubImage2D( texture:i64 level:i64 xoffset:i64 yoffset:i64 width:i64 height:i64 format:i64 type:i64 pixels:ptr -- )
+int TextureSubImage2D(qd_context* ctx) {
+	static const int sig[9] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[9];
+	gl_pop_args(ctx, "TextureSubImage2D", sig, 9, args);
+	glTextureSubImage2D((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLsizei)args[4].value.i, (GLsizei)args[5].value.i, (GLenum)args[6].value.i, (GLenum)args[7].value.i, (const void *)args[8].value.p);
+	return 0;
+}
+
+// TextureSubImage3D( texture:i64 level:i64 xoffset:i64 yoffset:i64 zoffset:i64 width:i64 height:i64 depth:i64 format:i64 type:i64 pixels:ptr -- )
+int TextureSubImage3D(qd_context* ctx) {
+	static const int sig[11] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[11];
+	gl_pop_args(ctx, "TextureSubImage3D", sig, 11, args);
+	glTextureSubImage3D((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLsizei)args[5].value.i, (GLsizei)args[6].value.i, (GLsizei)args[7].value.i, (GLenum)args[8].value.i, (GLenum)args[9].value.i, (const void *)args[10].value.p);
+	return 0;
+}
+
+// CompressedTextureSubImage1D( texture:i64 level:i64 xoffset:i64 width:i64 format:i64 imageSize:i64 data:ptr -- )
+int CompressedTextureSubImage1D(qd_context* ctx) {
+	static const int sig[7] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[7];
+	gl_pop_args(ctx, "CompressedTextureSubImage1D", sig, 7, args);
+	glCompressedTextureSubImage1D((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLsizei)args[3].value.i, (GLenum)args[4].value.i, (GLsizei)args[5].value.i, (const void *)args[6].value.p);
+	return 0;
+}
+
+// CompressedTextureSubImage2D( texture:i64 level:i64 xoffset:i64 yoffset:i64 width:i64 height:i64 format:i64 imageSize:i64 data:ptr -- )
+int CompressedTextureSubImage2D(qd_context* ctx) {
+	static const int sig[9] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[9];
+	gl_pop_args(ctx, "CompressedTextureSubImage2D", sig, 9, args);
+	glCompressedTextureSubImage2D((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLsizei)args[4].value.i, (GLsizei)args[5].value.i, (GLenum)args[6].value.i, (GLsizei)args[7].value.i, (const void *)args[8].value.p);
+	return 0;
+}
+
+// CompressedTextureSubImage3D( texture:i64 level:i64 xoffset:i64 yoffset:i64 zoffset:i64 width:i64 height:i64 depth:i64 format:i64 imageSize:i64 data:ptr -- )
+int CompressedTextureSubImage3D(qd_context* ctx) {
+	static const int sig[11] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[11];
+	gl_pop_args(ctx, "CompressedTextureSubImage3D", sig, 11, args);
+	glCompressedTextureSubImage3D((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLsizei)args[5].value.i, (GLsizei)args[6].value.i, (GLsizei)args[7].value.i, (GLenum)args[8].value.i, (GLsizei)args[9].value.i, (const void *)args[10].value.p);
+	return 0;
+}
+
+// CopyTextureSubImage1D( texture:i64 level:i64 xoffset:i64 x:i64 y:i64 width:i64 -- )
+int CopyTextureSubImage1D(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "CopyTextureSubImage1D", sig, 6, args);
+	glCopyTextureSubImage1D((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLsizei)args[5].value.i);
+	return 0;
+}
+
+// CopyTextureSubImage2D( texture:i64 level:i64 xoffset:i64 yoffset:i64 x:i64 y:i64 width:i64 height:i64 -- )
+int CopyTextureSubImage2D(qd_context* ctx) {
+	static const int sig[8] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[8];
+	gl_pop_args(ctx, "CopyTextureSubImage2D", sig, 8, args);
+	glCopyTextureSubImage2D((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLint)args[5].value.i, (GLsizei)args[6].value.i, (GLsizei)args[7].value.i);
+	return 0;
+}
+
+// CopyTextureSubImage3D( texture:i64 level:i64 xoffset:i64 yoffset:i64 zoffset:i64 x:i64 y:i64 width:i64 height:i64 -- )
+int CopyTextureSubImage3D(qd_context* ctx) {
+	static const int sig[9] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[9];
+	gl_pop_args(ctx, "CopyTextureSubImage3D", sig, 9, args);
+	glCopyTextureSubImage3D((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLint)args[5].value.i, (GLint)args[6].value.i, (GLsizei)args[7].value.i, (GLsizei)args[8].value.i);
+	return 0;
+}
+
+// TextureParameterf( texture:i64 pname:i64 param:f64 -- )
+int TextureParameterf(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_FLOAT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TextureParameterf", sig, 3, args);
+	glTextureParameterf((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLfloat)args[2].value.f);
+	return 0;
+}
+
+// TextureParameterfv( texture:i64 pname:i64 param:ptr -- )
+int TextureParameterfv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TextureParameterfv", sig, 3, args);
+	glTextureParameterfv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (const GLfloat *)args[2].value.p);
+	return 0;
+}
+
+// TextureParameteri( texture:i64 pname:i64 param:i64 -- )
+int TextureParameteri(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TextureParameteri", sig, 3, args);
+	glTextureParameteri((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint)args[2].value.i);
+	return 0;
+}
+
+// TextureParameterIiv( texture:i64 pname:i64 params:ptr -- )
+int TextureParameterIiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TextureParameterIiv", sig, 3, args);
+	glTextureParameterIiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (const GLint *)args[2].value.p);
+	return 0;
+}
+
+// TextureParameterIuiv( texture:i64 pname:i64 params:ptr -- )
+int TextureParameterIuiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TextureParameterIuiv", sig, 3, args);
+	glTextureParameterIuiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (const GLuint *)args[2].value.p);
+	return 0;
+}
+
+// TextureParameteriv( texture:i64 pname:i64 param:ptr -- )
+int TextureParameteriv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "TextureParameteriv", sig, 3, args);
+	glTextureParameteriv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (const GLint *)args[2].value.p);
+	return 0;
+}
+
+// GenerateTextureMipmap( texture:i64 -- )
+int GenerateTextureMipmap(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "GenerateTextureMipmap", sig, 1, args);
+	glGenerateTextureMipmap((GLuint)args[0].value.i);
+	return 0;
+}
+
+// BindTextureUnit( unit:i64 texture:i64 -- )
+int BindTextureUnit(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "BindTextureUnit", sig, 2, args);
+	glBindTextureUnit((GLuint)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// GetTextureImage( texture:i64 level:i64 format:i64 type:i64 bufSize:i64 pixels:ptr -- )
+int GetTextureImage(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "GetTextureImage", sig, 6, args);
+	glGetTextureImage((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLenum)args[3].value.i, (GLsizei)args[4].value.i, (void *)args[5].value.p);
+	return 0;
+}
+
+// GetCompressedTextureImage( texture:i64 level:i64 bufSize:i64 pixels:ptr -- )
+int GetCompressedTextureImage(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetCompressedTextureImage", sig, 4, args);
+	glGetCompressedTextureImage((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (void *)args[3].value.p);
+	return 0;
+}
+
+// GetTextureLevelParameterfv( texture:i64 level:i64 pname:i64 params:ptr -- )
+int GetTextureLevelParameterfv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetTextureLevelParameterfv", sig, 4, args);
+	glGetTextureLevelParameterfv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLfloat *)args[3].value.p);
+	return 0;
+}
+
+// GetTextureLevelParameteriv( texture:i64 level:i64 pname:i64 params:ptr -- )
+int GetTextureLevelParameteriv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetTextureLevelParameteriv", sig, 4, args);
+	glGetTextureLevelParameteriv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLint *)args[3].value.p);
+	return 0;
+}
+
+// GetTextureParameterfv( texture:i64 pname:i64 params:ptr -- )
+int GetTextureParameterfv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetTextureParameterfv", sig, 3, args);
+	glGetTextureParameterfv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLfloat *)args[2].value.p);
+	return 0;
+}
+
+// GetTextureParameterIiv( texture:i64 pname:i64 params:ptr -- )
+int GetTextureParameterIiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetTextureParameterIiv", sig, 3, args);
+	glGetTextureParameterIiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetTextureParameterIuiv( texture:i64 pname:i64 params:ptr -- )
+int GetTextureParameterIuiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetTextureParameterIuiv", sig, 3, args);
+	glGetTextureParameterIuiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLuint *)args[2].value.p);
+	return 0;
+}
+
+// GetTextureParameteriv( texture:i64 pname:i64 params:ptr -- )
+int GetTextureParameteriv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetTextureParameteriv", sig, 3, args);
+	glGetTextureParameteriv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// CreateVertexArrays( n:i64 arrays:ptr -- )
+int CreateVertexArrays(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "CreateVertexArrays", sig, 2, args);
+	glCreateVertexArrays((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// DisableVertexArrayAttrib( vaobj:i64 index:i64 -- )
+int DisableVertexArrayAttrib(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "DisableVertexArrayAttrib", sig, 2, args);
+	glDisableVertexArrayAttrib((GLuint)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// EnableVertexArrayAttrib( vaobj:i64 index:i64 -- )
+int EnableVertexArrayAttrib(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "EnableVertexArrayAttrib", sig, 2, args);
+	glEnableVertexArrayAttrib((GLuint)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// VertexArrayElementBuffer( vaobj:i64 buffer:i64 -- )
+int VertexArrayElementBuffer(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "VertexArrayElementBuffer", sig, 2, args);
+	glVertexArrayElementBuffer((GLuint)args[0].value.i, (GLuint)args[1].value.i);
+	return 0;
+}
+
+// VertexArrayVertexBuffer( vaobj:i64 bindingindex:i64 buffer:i64 offset:i64 stride:i64 -- )
+int VertexArrayVertexBuffer(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "VertexArrayVertexBuffer", sig, 5, args);
+	glVertexArrayVertexBuffer((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i, (GLintptr)args[3].value.i, (GLsizei)args[4].value.i);
+	return 0;
+}
+
+// VertexArrayVertexBuffers( vaobj:i64 first:i64 count:i64 buffers:ptr offsets:ptr strides:ptr -- )
+int VertexArrayVertexBuffers(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "VertexArrayVertexBuffers", sig, 6, args);
+	glVertexArrayVertexBuffers((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLsizei)args[2].value.i, (const GLuint *)args[3].value.p, (const GLintptr *)args[4].value.p, (const GLsizei *)args[5].value.p);
+	return 0;
+}
+
+// VertexArrayAttribBinding( vaobj:i64 attribindex:i64 bindingindex:i64 -- )
+int VertexArrayAttribBinding(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "VertexArrayAttribBinding", sig, 3, args);
+	glVertexArrayAttribBinding((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// VertexArrayAttribFormat( vaobj:i64 attribindex:i64 size:i64 type:i64 normalized:i64 relativeoffset:i64 -- )
+int VertexArrayAttribFormat(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "VertexArrayAttribFormat", sig, 6, args);
+	glVertexArrayAttribFormat((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLint)args[2].value.i, (GLenum)args[3].value.i, (GLboolean)args[4].value.i, (GLuint)args[5].value.i);
+	return 0;
+}
+
+// VertexArrayAttribIFormat( vaobj:i64 attribindex:i64 size:i64 type:i64 relativeoffset:i64 -- )
+int VertexArrayAttribIFormat(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "VertexArrayAttribIFormat", sig, 5, args);
+	glVertexArrayAttribIFormat((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLint)args[2].value.i, (GLenum)args[3].value.i, (GLuint)args[4].value.i);
+	return 0;
+}
+
+// VertexArrayAttribLFormat( vaobj:i64 attribindex:i64 size:i64 type:i64 relativeoffset:i64 -- )
+int VertexArrayAttribLFormat(qd_context* ctx) {
+	static const int sig[5] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[5];
+	gl_pop_args(ctx, "VertexArrayAttribLFormat", sig, 5, args);
+	glVertexArrayAttribLFormat((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLint)args[2].value.i, (GLenum)args[3].value.i, (GLuint)args[4].value.i);
+	return 0;
+}
+
+// VertexArrayBindingDivisor( vaobj:i64 bindingindex:i64 divisor:i64 -- )
+int VertexArrayBindingDivisor(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "VertexArrayBindingDivisor", sig, 3, args);
+	glVertexArrayBindingDivisor((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLuint)args[2].value.i);
+	return 0;
+}
+
+// GetVertexArrayiv( vaobj:i64 pname:i64 param:ptr -- )
+int GetVertexArrayiv(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "GetVertexArrayiv", sig, 3, args);
+	glGetVertexArrayiv((GLuint)args[0].value.i, (GLenum)args[1].value.i, (GLint *)args[2].value.p);
+	return 0;
+}
+
+// GetVertexArrayIndexediv( vaobj:i64 index:i64 pname:i64 param:ptr -- )
+int GetVertexArrayIndexediv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetVertexArrayIndexediv", sig, 4, args);
+	glGetVertexArrayIndexediv((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLenum)args[2].value.i, (GLint *)args[3].value.p);
+	return 0;
+}
+
+// GetVertexArrayIndexed64iv( vaobj:i64 index:i64 pname:i64 param:ptr -- )
+int GetVertexArrayIndexed64iv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetVertexArrayIndexed64iv", sig, 4, args);
+	glGetVertexArrayIndexed64iv((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLenum)args[2].value.i, (GLint64 *)args[3].value.p);
+	return 0;
+}
+
+// CreateSamplers( n:i64 samplers:ptr -- )
+int CreateSamplers(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "CreateSamplers", sig, 2, args);
+	glCreateSamplers((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// CreateProgramPipelines( n:i64 pipelines:ptr -- )
+int CreateProgramPipelines(qd_context* ctx) {
+	static const int sig[2] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[2];
+	gl_pop_args(ctx, "CreateProgramPipelines", sig, 2, args);
+	glCreateProgramPipelines((GLsizei)args[0].value.i, (GLuint *)args[1].value.p);
+	return 0;
+}
+
+// CreateQueries( target:i64 n:i64 ids:ptr -- )
+int CreateQueries(qd_context* ctx) {
+	static const int sig[3] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[3];
+	gl_pop_args(ctx, "CreateQueries", sig, 3, args);
+	glCreateQueries((GLenum)args[0].value.i, (GLsizei)args[1].value.i, (GLuint *)args[2].value.p);
+	return 0;
+}
+
+// GetQueryBufferObjecti64v( id:i64 buffer:i64 pname:i64 offset:i64 -- )
+int GetQueryBufferObjecti64v(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetQueryBufferObjecti64v", sig, 4, args);
+	glGetQueryBufferObjecti64v((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLenum)args[2].value.i, (GLintptr)args[3].value.i);
+	return 0;
+}
+
+// GetQueryBufferObjectiv( id:i64 buffer:i64 pname:i64 offset:i64 -- )
+int GetQueryBufferObjectiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetQueryBufferObjectiv", sig, 4, args);
+	glGetQueryBufferObjectiv((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLenum)args[2].value.i, (GLintptr)args[3].value.i);
+	return 0;
+}
+
+// GetQueryBufferObjectui64v( id:i64 buffer:i64 pname:i64 offset:i64 -- )
+int GetQueryBufferObjectui64v(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetQueryBufferObjectui64v", sig, 4, args);
+	glGetQueryBufferObjectui64v((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLenum)args[2].value.i, (GLintptr)args[3].value.i);
+	return 0;
+}
+
+// GetQueryBufferObjectuiv( id:i64 buffer:i64 pname:i64 offset:i64 -- )
+int GetQueryBufferObjectuiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetQueryBufferObjectuiv", sig, 4, args);
+	glGetQueryBufferObjectuiv((GLuint)args[0].value.i, (GLuint)args[1].value.i, (GLenum)args[2].value.i, (GLintptr)args[3].value.i);
+	return 0;
+}
+
+// MemoryBarrierByRegion( barriers:i64 -- )
+int MemoryBarrierByRegion(qd_context* ctx) {
+	static const int sig[1] = {QD_STACK_TYPE_INT};
+	qd_stack_element_t args[1];
+	gl_pop_args(ctx, "MemoryBarrierByRegion", sig, 1, args);
+	glMemoryBarrierByRegion((GLbitfield)args[0].value.i);
+	return 0;
+}
+
+// GetTextureSubImage( texture:i64 level:i64 xoffset:i64 yoffset:i64 zoffset:i64 width:i64 height:i64 depth:i64 format:i64 type:i64 bufSize:i64 pixels:ptr -- )
+int GetTextureSubImage(qd_context* ctx) {
+	static const int sig[12] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[12];
+	gl_pop_args(ctx, "GetTextureSubImage", sig, 12, args);
+	glGetTextureSubImage((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLsizei)args[5].value.i, (GLsizei)args[6].value.i, (GLsizei)args[7].value.i, (GLenum)args[8].value.i, (GLenum)args[9].value.i, (GLsizei)args[10].value.i, (void *)args[11].value.p);
+	return 0;
+}
+
+// GetCompressedTextureSubImage( texture:i64 level:i64 xoffset:i64 yoffset:i64 zoffset:i64 width:i64 height:i64 depth:i64 bufSize:i64 pixels:ptr -- )
+int GetCompressedTextureSubImage(qd_context* ctx) {
+	static const int sig[10] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[10];
+	gl_pop_args(ctx, "GetCompressedTextureSubImage", sig, 10, args);
+	glGetCompressedTextureSubImage((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLint)args[2].value.i, (GLint)args[3].value.i, (GLint)args[4].value.i, (GLsizei)args[5].value.i, (GLsizei)args[6].value.i, (GLsizei)args[7].value.i, (GLsizei)args[8].value.i, (void *)args[9].value.p);
+	return 0;
+}
+
+// GetGraphicsResetStatus( -- result:i64 )
+int GetGraphicsResetStatus(qd_context* ctx) {
+	GLenum result = glGetGraphicsResetStatus();
+	qd_push_i(ctx, (int64_t)result);
+	return 0;
+}
+
+// GetnCompressedTexImage( target:i64 lod:i64 bufSize:i64 pixels:ptr -- )
+int GetnCompressedTexImage(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetnCompressedTexImage", sig, 4, args);
+	glGetnCompressedTexImage((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (void *)args[3].value.p);
+	return 0;
+}
+
+// GetnTexImage( target:i64 level:i64 format:i64 type:i64 bufSize:i64 pixels:ptr -- )
+int GetnTexImage(qd_context* ctx) {
+	static const int sig[6] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[6];
+	gl_pop_args(ctx, "GetnTexImage", sig, 6, args);
+	glGetnTexImage((GLenum)args[0].value.i, (GLint)args[1].value.i, (GLenum)args[2].value.i, (GLenum)args[3].value.i, (GLsizei)args[4].value.i, (void *)args[5].value.p);
+	return 0;
+}
+
+// GetnUniformdv( program:i64 location:i64 bufSize:i64 params:ptr -- )
+int GetnUniformdv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetnUniformdv", sig, 4, args);
+	glGetnUniformdv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLdouble *)args[3].value.p);
+	return 0;
+}
+
+// GetnUniformfv( program:i64 location:i64 bufSize:i64 params:ptr -- )
+int GetnUniformfv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetnUniformfv", sig, 4, args);
+	glGetnUniformfv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLfloat *)args[3].value.p);
+	return 0;
+}
+
+// GetnUniformiv( program:i64 location:i64 bufSize:i64 params:ptr -- )
+int GetnUniformiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetnUniformiv", sig, 4, args);
+	glGetnUniformiv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLint *)args[3].value.p);
+	return 0;
+}
+
+// GetnUniformuiv( program:i64 location:i64 bufSize:i64 params:ptr -- )
+int GetnUniformuiv(qd_context* ctx) {
+	static const int sig[4] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[4];
+	gl_pop_args(ctx, "GetnUniformuiv", sig, 4, args);
+	glGetnUniformuiv((GLuint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLuint *)args[3].value.p);
+	return 0;
+}
+
+// ReadnPixels( x:i64 y:i64 width:i64 height:i64 format:i64 type:i64 bufSize:i64 data:ptr -- )
+int ReadnPixels(qd_context* ctx) {
+	static const int sig[8] = {QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_INT, QD_STACK_TYPE_PTR};
+	qd_stack_element_t args[8];
+	gl_pop_args(ctx, "ReadnPixels", sig, 8, args);
+	glReadnPixels((GLint)args[0].value.i, (GLint)args[1].value.i, (GLsizei)args[2].value.i, (GLsizei)args[3].value.i, (GLenum)args[4].value.i, (GLenum)args[5].value.i, (GLsizei)args[6].value.i, (void *)args[7].value.p);
+	return 0;
+}
+
+// TextureBarrier( -- )
+int TextureBarrier(qd_context* ctx) {
+	(void)ctx;
+	glTextureBarrier();
+	return 0;
+}
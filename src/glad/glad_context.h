@@ -0,0 +1,7993 @@
+/* Generated by tools/gladgen.py from src/glad/glad.h. Do not edit. */
+
+#ifndef __glad_context_h_
+#define __glad_context_h_
+
+#include <stddef.h>
+
+#if defined(__cplusplus)
+#define GLAD_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+#define GLAD_THREAD_LOCAL __declspec(thread)
+#else
+#define GLAD_THREAD_LOCAL _Thread_local
+#endif
+
+/* One dispatch table per GL context. Flags and the version come first,
+   then the entry points in header order, so the core functions share
+   the leading cache lines. */
+struct gladGLContext {
+    struct gladGLversionStruct GLVersion;
+    int GLAD_GL_VERSION_1_0;
+    int GLAD_GL_VERSION_1_1;
+    int GLAD_GL_VERSION_1_2;
+    int GLAD_GL_VERSION_1_3;
+    int GLAD_GL_VERSION_1_4;
+    int GLAD_GL_VERSION_1_5;
+    int GLAD_GL_VERSION_2_0;
+    int GLAD_GL_VERSION_2_1;
+    int GLAD_GL_VERSION_3_0;
+    int GLAD_GL_VERSION_3_1;
+    int GLAD_GL_VERSION_3_2;
+    int GLAD_GL_VERSION_3_3;
+    int GLAD_GL_VERSION_4_0;
+    int GLAD_GL_VERSION_4_1;
+    int GLAD_GL_VERSION_4_2;
+    int GLAD_GL_VERSION_4_3;
+    int GLAD_GL_VERSION_4_4;
+    int GLAD_GL_VERSION_4_5;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_3DFX_multisample;
+    int GLAD_GL_3DFX_tbuffer;
+    int GLAD_GL_3DFX_texture_compression_FXT1;
+    int GLAD_GL_AMD_blend_minmax_factor;
+    int GLAD_GL_AMD_conservative_depth;
+    int GLAD_GL_AMD_debug_output;
+    int GLAD_GL_AMD_depth_clamp_separate;
+    int GLAD_GL_AMD_draw_buffers_blend;
+    int GLAD_GL_AMD_framebuffer_multisample_advanced;
+    int GLAD_GL_AMD_framebuffer_sample_positions;
+    int GLAD_GL_AMD_gcn_shader;
+    int GLAD_GL_AMD_gpu_shader_half_float;
+    int GLAD_GL_AMD_gpu_shader_int16;
+    int GLAD_GL_AMD_gpu_shader_int64;
+    int GLAD_GL_AMD_interleaved_elements;
+    int GLAD_GL_AMD_multi_draw_indirect;
+    int GLAD_GL_AMD_name_gen_delete;
+    int GLAD_GL_AMD_occlusion_query_event;
+    int GLAD_GL_AMD_performance_monitor;
+    int GLAD_GL_AMD_pinned_memory;
+    int GLAD_GL_AMD_query_buffer_object;
+    int GLAD_GL_AMD_sample_positions;
+    int GLAD_GL_AMD_seamless_cubemap_per_texture;
+    int GLAD_GL_AMD_shader_atomic_counter_ops;
+    int GLAD_GL_AMD_shader_ballot;
+    int GLAD_GL_AMD_shader_explicit_vertex_parameter;
+    int GLAD_GL_AMD_shader_gpu_shader_half_float_fetch;
+    int GLAD_GL_AMD_shader_image_load_store_lod;
+    int GLAD_GL_AMD_shader_stencil_export;
+    int GLAD_GL_AMD_shader_trinary_minmax;
+    int GLAD_GL_AMD_sparse_texture;
+    int GLAD_GL_AMD_stencil_operation_extended;
+    int GLAD_GL_AMD_texture_gather_bias_lod;
+    int GLAD_GL_AMD_texture_texture4;
+    int GLAD_GL_AMD_transform_feedback3_lines_triangles;
+    int GLAD_GL_AMD_transform_feedback4;
+    int GLAD_GL_AMD_vertex_shader_layer;
+    int GLAD_GL_AMD_vertex_shader_tessellator;
+    int GLAD_GL_AMD_vertex_shader_viewport_index;
+    int GLAD_GL_APPLE_aux_depth_stencil;
+    int GLAD_GL_APPLE_client_storage;
+    int GLAD_GL_APPLE_element_array;
+    int GLAD_GL_APPLE_fence;
+    int GLAD_GL_APPLE_float_pixels;
+    int GLAD_GL_APPLE_flush_buffer_range;
+    int GLAD_GL_APPLE_object_purgeable;
+    int GLAD_GL_APPLE_rgb_422;
+    int GLAD_GL_APPLE_row_bytes;
+    int GLAD_GL_APPLE_specular_vector;
+    int GLAD_GL_APPLE_texture_range;
+    int GLAD_GL_APPLE_transform_hint;
+    int GLAD_GL_APPLE_vertex_array_object;
+    int GLAD_GL_APPLE_vertex_array_range;
+    int GLAD_GL_APPLE_vertex_program_evaluators;
+    int GLAD_GL_APPLE_ycbcr_422;
+    int GLAD_GL_ARB_ES2_compatibility;
+    int GLAD_GL_ARB_ES3_1_compatibility;
+    int GLAD_GL_ARB_ES3_2_compatibility;
+    int GLAD_GL_ARB_ES3_compatibility;
+    int GLAD_GL_ARB_arrays_of_arrays;
+    int GLAD_GL_ARB_base_instance;
+#endif
+    int GLAD_GL_ARB_bindless_texture;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_ARB_blend_func_extended;
+#endif
+    int GLAD_GL_ARB_buffer_storage;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_ARB_cl_event;
+    int GLAD_GL_ARB_clear_buffer_object;
+    int GLAD_GL_ARB_clear_texture;
+    int GLAD_GL_ARB_clip_control;
+    int GLAD_GL_ARB_color_buffer_float;
+    int GLAD_GL_ARB_compatibility;
+    int GLAD_GL_ARB_compressed_texture_pixel_storage;
+    int GLAD_GL_ARB_compute_shader;
+    int GLAD_GL_ARB_compute_variable_group_size;
+    int GLAD_GL_ARB_conditional_render_inverted;
+    int GLAD_GL_ARB_conservative_depth;
+    int GLAD_GL_ARB_copy_buffer;
+    int GLAD_GL_ARB_copy_image;
+    int GLAD_GL_ARB_cull_distance;
+    int GLAD_GL_ARB_debug_output;
+    int GLAD_GL_ARB_depth_buffer_float;
+    int GLAD_GL_ARB_depth_clamp;
+    int GLAD_GL_ARB_depth_texture;
+    int GLAD_GL_ARB_derivative_control;
+    int GLAD_GL_ARB_direct_state_access;
+    int GLAD_GL_ARB_draw_buffers;
+    int GLAD_GL_ARB_draw_buffers_blend;
+    int GLAD_GL_ARB_draw_elements_base_vertex;
+    int GLAD_GL_ARB_draw_indirect;
+    int GLAD_GL_ARB_draw_instanced;
+    int GLAD_GL_ARB_enhanced_layouts;
+    int GLAD_GL_ARB_explicit_attrib_location;
+    int GLAD_GL_ARB_explicit_uniform_location;
+    int GLAD_GL_ARB_fragment_coord_conventions;
+    int GLAD_GL_ARB_fragment_layer_viewport;
+    int GLAD_GL_ARB_fragment_program;
+    int GLAD_GL_ARB_fragment_program_shadow;
+    int GLAD_GL_ARB_fragment_shader;
+    int GLAD_GL_ARB_fragment_shader_interlock;
+    int GLAD_GL_ARB_framebuffer_no_attachments;
+    int GLAD_GL_ARB_framebuffer_object;
+    int GLAD_GL_ARB_framebuffer_sRGB;
+    int GLAD_GL_ARB_geometry_shader4;
+#endif
+    int GLAD_GL_ARB_get_program_binary;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_ARB_get_texture_sub_image;
+#endif
+    int GLAD_GL_ARB_gl_spirv;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_ARB_gpu_shader5;
+    int GLAD_GL_ARB_gpu_shader_fp64;
+    int GLAD_GL_ARB_gpu_shader_int64;
+    int GLAD_GL_ARB_half_float_pixel;
+    int GLAD_GL_ARB_half_float_vertex;
+    int GLAD_GL_ARB_imaging;
+#endif
+    int GLAD_GL_ARB_indirect_parameters;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_ARB_instanced_arrays;
+    int GLAD_GL_ARB_internalformat_query;
+    int GLAD_GL_ARB_internalformat_query2;
+    int GLAD_GL_ARB_invalidate_subdata;
+    int GLAD_GL_ARB_map_buffer_alignment;
+    int GLAD_GL_ARB_map_buffer_range;
+    int GLAD_GL_ARB_matrix_palette;
+    int GLAD_GL_ARB_multi_bind;
+#endif
+    int GLAD_GL_ARB_multi_draw_indirect;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_ARB_multisample;
+    int GLAD_GL_ARB_multitexture;
+    int GLAD_GL_ARB_occlusion_query;
+    int GLAD_GL_ARB_occlusion_query2;
+#endif
+    int GLAD_GL_ARB_parallel_shader_compile;
+    int GLAD_GL_ARB_pipeline_statistics_query;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_ARB_pixel_buffer_object;
+    int GLAD_GL_ARB_point_parameters;
+    int GLAD_GL_ARB_point_sprite;
+#endif
+    int GLAD_GL_ARB_polygon_offset_clamp;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_ARB_post_depth_coverage;
+    int GLAD_GL_ARB_program_interface_query;
+    int GLAD_GL_ARB_provoking_vertex;
+    int GLAD_GL_ARB_query_buffer_object;
+    int GLAD_GL_ARB_robust_buffer_access_behavior;
+    int GLAD_GL_ARB_robustness;
+    int GLAD_GL_ARB_robustness_isolation;
+    int GLAD_GL_ARB_sample_locations;
+    int GLAD_GL_ARB_sample_shading;
+    int GLAD_GL_ARB_sampler_objects;
+    int GLAD_GL_ARB_seamless_cube_map;
+    int GLAD_GL_ARB_seamless_cubemap_per_texture;
+    int GLAD_GL_ARB_separate_shader_objects;
+    int GLAD_GL_ARB_shader_atomic_counter_ops;
+    int GLAD_GL_ARB_shader_atomic_counters;
+    int GLAD_GL_ARB_shader_ballot;
+    int GLAD_GL_ARB_shader_bit_encoding;
+    int GLAD_GL_ARB_shader_clock;
+#endif
+    int GLAD_GL_ARB_shader_draw_parameters;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_ARB_shader_group_vote;
+    int GLAD_GL_ARB_shader_image_load_store;
+    int GLAD_GL_ARB_shader_image_size;
+    int GLAD_GL_ARB_shader_objects;
+    int GLAD_GL_ARB_shader_precision;
+    int GLAD_GL_ARB_shader_stencil_export;
+    int GLAD_GL_ARB_shader_storage_buffer_object;
+    int GLAD_GL_ARB_shader_subroutine;
+    int GLAD_GL_ARB_shader_texture_image_samples;
+    int GLAD_GL_ARB_shader_texture_lod;
+    int GLAD_GL_ARB_shader_viewport_layer_array;
+    int GLAD_GL_ARB_shading_language_100;
+    int GLAD_GL_ARB_shading_language_420pack;
+    int GLAD_GL_ARB_shading_language_include;
+    int GLAD_GL_ARB_shading_language_packing;
+    int GLAD_GL_ARB_shadow;
+    int GLAD_GL_ARB_shadow_ambient;
+#endif
+    int GLAD_GL_ARB_sparse_buffer;
+    int GLAD_GL_ARB_sparse_texture;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_ARB_sparse_texture2;
+    int GLAD_GL_ARB_sparse_texture_clamp;
+#endif
+    int GLAD_GL_ARB_spirv_extensions;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_ARB_stencil_texturing;
+#endif
+    int GLAD_GL_ARB_sync;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_ARB_tessellation_shader;
+    int GLAD_GL_ARB_texture_barrier;
+    int GLAD_GL_ARB_texture_border_clamp;
+    int GLAD_GL_ARB_texture_buffer_object;
+    int GLAD_GL_ARB_texture_buffer_object_rgb32;
+    int GLAD_GL_ARB_texture_buffer_range;
+    int GLAD_GL_ARB_texture_compression;
+    int GLAD_GL_ARB_texture_compression_bptc;
+    int GLAD_GL_ARB_texture_compression_rgtc;
+    int GLAD_GL_ARB_texture_cube_map;
+    int GLAD_GL_ARB_texture_cube_map_array;
+    int GLAD_GL_ARB_texture_env_add;
+    int GLAD_GL_ARB_texture_env_combine;
+    int GLAD_GL_ARB_texture_env_crossbar;
+    int GLAD_GL_ARB_texture_env_dot3;
+#endif
+    int GLAD_GL_ARB_texture_filter_anisotropic;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_ARB_texture_filter_minmax;
+    int GLAD_GL_ARB_texture_float;
+    int GLAD_GL_ARB_texture_gather;
+    int GLAD_GL_ARB_texture_mirror_clamp_to_edge;
+    int GLAD_GL_ARB_texture_mirrored_repeat;
+    int GLAD_GL_ARB_texture_multisample;
+    int GLAD_GL_ARB_texture_non_power_of_two;
+    int GLAD_GL_ARB_texture_query_levels;
+    int GLAD_GL_ARB_texture_query_lod;
+    int GLAD_GL_ARB_texture_rectangle;
+    int GLAD_GL_ARB_texture_rg;
+    int GLAD_GL_ARB_texture_rgb10_a2ui;
+    int GLAD_GL_ARB_texture_stencil8;
+    int GLAD_GL_ARB_texture_storage;
+    int GLAD_GL_ARB_texture_storage_multisample;
+    int GLAD_GL_ARB_texture_swizzle;
+    int GLAD_GL_ARB_texture_view;
+    int GLAD_GL_ARB_timer_query;
+    int GLAD_GL_ARB_transform_feedback2;
+    int GLAD_GL_ARB_transform_feedback3;
+    int GLAD_GL_ARB_transform_feedback_instanced;
+    int GLAD_GL_ARB_transform_feedback_overflow_query;
+    int GLAD_GL_ARB_transpose_matrix;
+    int GLAD_GL_ARB_uniform_buffer_object;
+    int GLAD_GL_ARB_vertex_array_bgra;
+    int GLAD_GL_ARB_vertex_array_object;
+    int GLAD_GL_ARB_vertex_attrib_64bit;
+    int GLAD_GL_ARB_vertex_attrib_binding;
+    int GLAD_GL_ARB_vertex_blend;
+    int GLAD_GL_ARB_vertex_buffer_object;
+    int GLAD_GL_ARB_vertex_program;
+    int GLAD_GL_ARB_vertex_shader;
+    int GLAD_GL_ARB_vertex_type_10f_11f_11f_rev;
+    int GLAD_GL_ARB_vertex_type_2_10_10_10_rev;
+    int GLAD_GL_ARB_viewport_array;
+    int GLAD_GL_ARB_window_pos;
+    int GLAD_GL_ATI_draw_buffers;
+    int GLAD_GL_ATI_element_array;
+    int GLAD_GL_ATI_envmap_bumpmap;
+    int GLAD_GL_ATI_fragment_shader;
+    int GLAD_GL_ATI_map_object_buffer;
+    int GLAD_GL_ATI_meminfo;
+    int GLAD_GL_ATI_pixel_format_float;
+    int GLAD_GL_ATI_pn_triangles;
+    int GLAD_GL_ATI_separate_stencil;
+    int GLAD_GL_ATI_text_fragment_shader;
+    int GLAD_GL_ATI_texture_env_combine3;
+    int GLAD_GL_ATI_texture_float;
+    int GLAD_GL_ATI_texture_mirror_once;
+    int GLAD_GL_ATI_vertex_array_object;
+    int GLAD_GL_ATI_vertex_attrib_array_object;
+    int GLAD_GL_ATI_vertex_streams;
+    int GLAD_GL_EXT_422_pixels;
+    int GLAD_GL_EXT_EGL_image_storage;
+    int GLAD_GL_EXT_EGL_sync;
+    int GLAD_GL_EXT_abgr;
+    int GLAD_GL_EXT_bgra;
+    int GLAD_GL_EXT_bindable_uniform;
+    int GLAD_GL_EXT_blend_color;
+    int GLAD_GL_EXT_blend_equation_separate;
+    int GLAD_GL_EXT_blend_func_separate;
+    int GLAD_GL_EXT_blend_logic_op;
+    int GLAD_GL_EXT_blend_minmax;
+    int GLAD_GL_EXT_blend_subtract;
+    int GLAD_GL_EXT_clip_volume_hint;
+    int GLAD_GL_EXT_cmyka;
+    int GLAD_GL_EXT_color_subtable;
+    int GLAD_GL_EXT_compiled_vertex_array;
+    int GLAD_GL_EXT_convolution;
+    int GLAD_GL_EXT_coordinate_frame;
+    int GLAD_GL_EXT_copy_texture;
+    int GLAD_GL_EXT_cull_vertex;
+    int GLAD_GL_EXT_debug_label;
+    int GLAD_GL_EXT_debug_marker;
+    int GLAD_GL_EXT_depth_bounds_test;
+    int GLAD_GL_EXT_direct_state_access;
+    int GLAD_GL_EXT_draw_buffers2;
+    int GLAD_GL_EXT_draw_instanced;
+    int GLAD_GL_EXT_draw_range_elements;
+    int GLAD_GL_EXT_external_buffer;
+    int GLAD_GL_EXT_fog_coord;
+    int GLAD_GL_EXT_framebuffer_blit;
+    int GLAD_GL_EXT_framebuffer_blit_layers;
+    int GLAD_GL_EXT_framebuffer_multisample;
+    int GLAD_GL_EXT_framebuffer_multisample_blit_scaled;
+    int GLAD_GL_EXT_framebuffer_object;
+    int GLAD_GL_EXT_framebuffer_sRGB;
+    int GLAD_GL_EXT_geometry_shader4;
+    int GLAD_GL_EXT_gpu_program_parameters;
+    int GLAD_GL_EXT_gpu_shader4;
+    int GLAD_GL_EXT_histogram;
+    int GLAD_GL_EXT_index_array_formats;
+    int GLAD_GL_EXT_index_func;
+    int GLAD_GL_EXT_index_material;
+    int GLAD_GL_EXT_index_texture;
+    int GLAD_GL_EXT_light_texture;
+    int GLAD_GL_EXT_memory_object;
+    int GLAD_GL_EXT_memory_object_fd;
+    int GLAD_GL_EXT_memory_object_win32;
+    int GLAD_GL_EXT_misc_attribute;
+    int GLAD_GL_EXT_multi_draw_arrays;
+    int GLAD_GL_EXT_multisample;
+    int GLAD_GL_EXT_multiview_tessellation_geometry_shader;
+    int GLAD_GL_EXT_multiview_texture_multisample;
+    int GLAD_GL_EXT_multiview_timer_query;
+    int GLAD_GL_EXT_packed_depth_stencil;
+    int GLAD_GL_EXT_packed_float;
+    int GLAD_GL_EXT_packed_pixels;
+    int GLAD_GL_EXT_paletted_texture;
+    int GLAD_GL_EXT_pixel_buffer_object;
+    int GLAD_GL_EXT_pixel_transform;
+    int GLAD_GL_EXT_pixel_transform_color_table;
+    int GLAD_GL_EXT_point_parameters;
+    int GLAD_GL_EXT_polygon_offset;
+    int GLAD_GL_EXT_polygon_offset_clamp;
+    int GLAD_GL_EXT_post_depth_coverage;
+    int GLAD_GL_EXT_provoking_vertex;
+    int GLAD_GL_EXT_raster_multisample;
+    int GLAD_GL_EXT_rescale_normal;
+    int GLAD_GL_EXT_secondary_color;
+    int GLAD_GL_EXT_semaphore;
+    int GLAD_GL_EXT_semaphore_fd;
+    int GLAD_GL_EXT_semaphore_win32;
+    int GLAD_GL_EXT_separate_shader_objects;
+    int GLAD_GL_EXT_separate_specular_color;
+    int GLAD_GL_EXT_shader_framebuffer_fetch;
+    int GLAD_GL_EXT_shader_framebuffer_fetch_non_coherent;
+    int GLAD_GL_EXT_shader_image_load_formatted;
+    int GLAD_GL_EXT_shader_image_load_store;
+    int GLAD_GL_EXT_shader_integer_mix;
+    int GLAD_GL_EXT_shader_samples_identical;
+    int GLAD_GL_EXT_shadow_funcs;
+    int GLAD_GL_EXT_shared_texture_palette;
+    int GLAD_GL_EXT_sparse_texture2;
+    int GLAD_GL_EXT_stencil_clear_tag;
+    int GLAD_GL_EXT_stencil_two_side;
+    int GLAD_GL_EXT_stencil_wrap;
+    int GLAD_GL_EXT_subtexture;
+    int GLAD_GL_EXT_texture;
+    int GLAD_GL_EXT_texture3D;
+    int GLAD_GL_EXT_texture_array;
+    int GLAD_GL_EXT_texture_buffer_object;
+    int GLAD_GL_EXT_texture_compression_latc;
+    int GLAD_GL_EXT_texture_compression_rgtc;
+#endif
+    int GLAD_GL_EXT_texture_compression_s3tc;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_EXT_texture_cube_map;
+    int GLAD_GL_EXT_texture_env_add;
+    int GLAD_GL_EXT_texture_env_combine;
+    int GLAD_GL_EXT_texture_env_dot3;
+#endif
+    int GLAD_GL_EXT_texture_filter_anisotropic;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_EXT_texture_filter_minmax;
+    int GLAD_GL_EXT_texture_integer;
+    int GLAD_GL_EXT_texture_lod_bias;
+    int GLAD_GL_EXT_texture_mirror_clamp;
+    int GLAD_GL_EXT_texture_object;
+    int GLAD_GL_EXT_texture_perturb_normal;
+    int GLAD_GL_EXT_texture_sRGB;
+    int GLAD_GL_EXT_texture_sRGB_R8;
+    int GLAD_GL_EXT_texture_sRGB_RG8;
+    int GLAD_GL_EXT_texture_sRGB_decode;
+    int GLAD_GL_EXT_texture_shadow_lod;
+    int GLAD_GL_EXT_texture_shared_exponent;
+    int GLAD_GL_EXT_texture_snorm;
+    int GLAD_GL_EXT_texture_storage;
+    int GLAD_GL_EXT_texture_swizzle;
+    int GLAD_GL_EXT_timer_query;
+    int GLAD_GL_EXT_transform_feedback;
+    int GLAD_GL_EXT_vertex_array;
+    int GLAD_GL_EXT_vertex_array_bgra;
+    int GLAD_GL_EXT_vertex_attrib_64bit;
+    int GLAD_GL_EXT_vertex_shader;
+    int GLAD_GL_EXT_vertex_weighting;
+    int GLAD_GL_EXT_win32_keyed_mutex;
+    int GLAD_GL_EXT_window_rectangles;
+    int GLAD_GL_EXT_x11_sync_object;
+    int GLAD_GL_GREMEDY_frame_terminator;
+    int GLAD_GL_GREMEDY_string_marker;
+    int GLAD_GL_HP_convolution_border_modes;
+    int GLAD_GL_HP_image_transform;
+    int GLAD_GL_HP_occlusion_test;
+    int GLAD_GL_HP_texture_lighting;
+    int GLAD_GL_IBM_cull_vertex;
+    int GLAD_GL_IBM_multimode_draw_arrays;
+    int GLAD_GL_IBM_rasterpos_clip;
+    int GLAD_GL_IBM_static_data;
+    int GLAD_GL_IBM_texture_mirrored_repeat;
+    int GLAD_GL_IBM_vertex_array_lists;
+    int GLAD_GL_INGR_blend_func_separate;
+    int GLAD_GL_INGR_color_clamp;
+    int GLAD_GL_INGR_interlace_read;
+    int GLAD_GL_INTEL_blackhole_render;
+    int GLAD_GL_INTEL_conservative_rasterization;
+    int GLAD_GL_INTEL_fragment_shader_ordering;
+    int GLAD_GL_INTEL_framebuffer_CMAA;
+    int GLAD_GL_INTEL_map_texture;
+    int GLAD_GL_INTEL_parallel_arrays;
+    int GLAD_GL_INTEL_performance_query;
+    int GLAD_GL_KHR_blend_equation_advanced;
+    int GLAD_GL_KHR_blend_equation_advanced_coherent;
+    int GLAD_GL_KHR_context_flush_control;
+#endif
+    int GLAD_GL_KHR_debug;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_KHR_no_error;
+#endif
+    int GLAD_GL_KHR_parallel_shader_compile;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_KHR_robust_buffer_access_behavior;
+    int GLAD_GL_KHR_robustness;
+    int GLAD_GL_KHR_shader_subgroup;
+    int GLAD_GL_KHR_texture_compression_astc_hdr;
+#endif
+    int GLAD_GL_KHR_texture_compression_astc_ldr;
+#ifndef GLAD_CORE_PROFILE
+    int GLAD_GL_KHR_texture_compression_astc_sliced_3d;
+    int GLAD_GL_MESAX_texture_stack;
+    int GLAD_GL_MESA_framebuffer_flip_x;
+    int GLAD_GL_MESA_framebuffer_flip_y;
+    int GLAD_GL_MESA_framebuffer_swap_xy;
+    int GLAD_GL_MESA_pack_invert;
+    int GLAD_GL_MESA_program_binary_formats;
+    int GLAD_GL_MESA_resize_buffers;
+    int GLAD_GL_MESA_shader_integer_functions;
+    int GLAD_GL_MESA_tile_raster_order;
+    int GLAD_GL_MESA_window_pos;
+    int GLAD_GL_MESA_ycbcr_texture;
+    int GLAD_GL_NVX_blend_equation_advanced_multi_draw_buffers;
+    int GLAD_GL_NVX_conditional_render;
+    int GLAD_GL_NVX_gpu_memory_info;
+    int GLAD_GL_NVX_gpu_multicast2;
+    int GLAD_GL_NVX_linked_gpu_multicast;
+    int GLAD_GL_NVX_progress_fence;
+    int GLAD_GL_NV_alpha_to_coverage_dither_control;
+    int GLAD_GL_NV_bindless_multi_draw_indirect;
+    int GLAD_GL_NV_bindless_multi_draw_indirect_count;
+    int GLAD_GL_NV_bindless_texture;
+    int GLAD_GL_NV_blend_equation_advanced;
+    int GLAD_GL_NV_blend_equation_advanced_coherent;
+    int GLAD_GL_NV_blend_minmax_factor;
+    int GLAD_GL_NV_blend_square;
+    int GLAD_GL_NV_clip_space_w_scaling;
+    int GLAD_GL_NV_command_list;
+    int GLAD_GL_NV_compute_program5;
+    int GLAD_GL_NV_compute_shader_derivatives;
+    int GLAD_GL_NV_conditional_render;
+    int GLAD_GL_NV_conservative_raster;
+    int GLAD_GL_NV_conservative_raster_dilate;
+    int GLAD_GL_NV_conservative_raster_pre_snap;
+    int GLAD_GL_NV_conservative_raster_pre_snap_triangles;
+    int GLAD_GL_NV_conservative_raster_underestimation;
+    int GLAD_GL_NV_copy_depth_to_color;
+    int GLAD_GL_NV_copy_image;
+    int GLAD_GL_NV_deep_texture3D;
+    int GLAD_GL_NV_depth_buffer_float;
+    int GLAD_GL_NV_depth_clamp;
+    int GLAD_GL_NV_draw_texture;
+    int GLAD_GL_NV_draw_vulkan_image;
+    int GLAD_GL_NV_evaluators;
+    int GLAD_GL_NV_explicit_multisample;
+    int GLAD_GL_NV_fence;
+    int GLAD_GL_NV_fill_rectangle;
+    int GLAD_GL_NV_float_buffer;
+    int GLAD_GL_NV_fog_distance;
+    int GLAD_GL_NV_fragment_coverage_to_color;
+    int GLAD_GL_NV_fragment_program;
+    int GLAD_GL_NV_fragment_program2;
+    int GLAD_GL_NV_fragment_program4;
+    int GLAD_GL_NV_fragment_program_option;
+    int GLAD_GL_NV_fragment_shader_barycentric;
+    int GLAD_GL_NV_fragment_shader_interlock;
+    int GLAD_GL_NV_framebuffer_mixed_samples;
+    int GLAD_GL_NV_framebuffer_multisample_coverage;
+    int GLAD_GL_NV_geometry_program4;
+    int GLAD_GL_NV_geometry_shader4;
+    int GLAD_GL_NV_geometry_shader_passthrough;
+    int GLAD_GL_NV_gpu_multicast;
+    int GLAD_GL_NV_gpu_program4;
+    int GLAD_GL_NV_gpu_program5;
+    int GLAD_GL_NV_gpu_program5_mem_extended;
+    int GLAD_GL_NV_gpu_shader5;
+    int GLAD_GL_NV_half_float;
+    int GLAD_GL_NV_internalformat_sample_query;
+    int GLAD_GL_NV_light_max_exponent;
+    int GLAD_GL_NV_memory_attachment;
+    int GLAD_GL_NV_memory_object_sparse;
+    int GLAD_GL_NV_mesh_shader;
+    int GLAD_GL_NV_multisample_coverage;
+    int GLAD_GL_NV_multisample_filter_hint;
+    int GLAD_GL_NV_occlusion_query;
+    int GLAD_GL_NV_packed_depth_stencil;
+    int GLAD_GL_NV_parameter_buffer_object;
+    int GLAD_GL_NV_parameter_buffer_object2;
+    int GLAD_GL_NV_path_rendering;
+    int GLAD_GL_NV_path_rendering_shared_edge;
+    int GLAD_GL_NV_pixel_data_range;
+    int GLAD_GL_NV_point_sprite;
+    int GLAD_GL_NV_present_video;
+    int GLAD_GL_NV_primitive_restart;
+    int GLAD_GL_NV_primitive_shading_rate;
+    int GLAD_GL_NV_query_resource;
+    int GLAD_GL_NV_query_resource_tag;
+    int GLAD_GL_NV_register_combiners;
+    int GLAD_GL_NV_register_combiners2;
+    int GLAD_GL_NV_representative_fragment_test;
+    int GLAD_GL_NV_robustness_video_memory_purge;
+    int GLAD_GL_NV_sample_locations;
+    int GLAD_GL_NV_sample_mask_override_coverage;
+    int GLAD_GL_NV_scissor_exclusive;
+    int GLAD_GL_NV_shader_atomic_counters;
+    int GLAD_GL_NV_shader_atomic_float;
+    int GLAD_GL_NV_shader_atomic_float64;
+    int GLAD_GL_NV_shader_atomic_fp16_vector;
+    int GLAD_GL_NV_shader_atomic_int64;
+    int GLAD_GL_NV_shader_buffer_load;
+    int GLAD_GL_NV_shader_buffer_store;
+    int GLAD_GL_NV_shader_storage_buffer_object;
+    int GLAD_GL_NV_shader_subgroup_partitioned;
+    int GLAD_GL_NV_shader_texture_footprint;
+    int GLAD_GL_NV_shader_thread_group;
+    int GLAD_GL_NV_shader_thread_shuffle;
+    int GLAD_GL_NV_shading_rate_image;
+    int GLAD_GL_NV_stereo_view_rendering;
+    int GLAD_GL_NV_tessellation_program5;
+    int GLAD_GL_NV_texgen_emboss;
+    int GLAD_GL_NV_texgen_reflection;
+    int GLAD_GL_NV_texture_barrier;
+    int GLAD_GL_NV_texture_compression_vtc;
+    int GLAD_GL_NV_texture_env_combine4;
+    int GLAD_GL_NV_texture_expand_normal;
+    int GLAD_GL_NV_texture_multisample;
+    int GLAD_GL_NV_texture_rectangle;
+    int GLAD_GL_NV_texture_rectangle_compressed;
+    int GLAD_GL_NV_texture_shader;
+    int GLAD_GL_NV_texture_shader2;
+    int GLAD_GL_NV_texture_shader3;
+    int GLAD_GL_NV_timeline_semaphore;
+    int GLAD_GL_NV_transform_feedback;
+    int GLAD_GL_NV_transform_feedback2;
+    int GLAD_GL_NV_uniform_buffer_std430_layout;
+    int GLAD_GL_NV_uniform_buffer_unified_memory;
+    int GLAD_GL_NV_vdpau_interop;
+    int GLAD_GL_NV_vdpau_interop2;
+    int GLAD_GL_NV_vertex_array_range;
+    int GLAD_GL_NV_vertex_array_range2;
+    int GLAD_GL_NV_vertex_attrib_integer_64bit;
+    int GLAD_GL_NV_vertex_buffer_unified_memory;
+    int GLAD_GL_NV_vertex_program;
+    int GLAD_GL_NV_vertex_program1_1;
+    int GLAD_GL_NV_vertex_program2;
+    int GLAD_GL_NV_vertex_program2_option;
+    int GLAD_GL_NV_vertex_program3;
+    int GLAD_GL_NV_vertex_program4;
+    int GLAD_GL_NV_video_capture;
+    int GLAD_GL_NV_viewport_array2;
+    int GLAD_GL_NV_viewport_swizzle;
+    int GLAD_GL_OES_byte_coordinates;
+    int GLAD_GL_OES_compressed_paletted_texture;
+    int GLAD_GL_OES_fixed_point;
+    int GLAD_GL_OES_query_matrix;
+    int GLAD_GL_OES_read_format;
+    int GLAD_GL_OES_single_precision;
+    int GLAD_GL_OML_interlace;
+    int GLAD_GL_OML_resample;
+    int GLAD_GL_OML_subsample;
+    int GLAD_GL_OVR_multiview;
+    int GLAD_GL_OVR_multiview2;
+    int GLAD_GL_PGI_misc_hints;
+    int GLAD_GL_PGI_vertex_hints;
+    int GLAD_GL_REND_screen_coordinates;
+    int GLAD_GL_S3_s3tc;
+    int GLAD_GL_SGIS_detail_texture;
+    int GLAD_GL_SGIS_fog_function;
+    int GLAD_GL_SGIS_generate_mipmap;
+    int GLAD_GL_SGIS_multisample;
+    int GLAD_GL_SGIS_pixel_texture;
+    int GLAD_GL_SGIS_point_line_texgen;
+    int GLAD_GL_SGIS_point_parameters;
+    int GLAD_GL_SGIS_sharpen_texture;
+    int GLAD_GL_SGIS_texture4D;
+    int GLAD_GL_SGIS_texture_border_clamp;
+    int GLAD_GL_SGIS_texture_color_mask;
+    int GLAD_GL_SGIS_texture_edge_clamp;
+    int GLAD_GL_SGIS_texture_filter4;
+    int GLAD_GL_SGIS_texture_lod;
+    int GLAD_GL_SGIS_texture_select;
+    int GLAD_GL_SGIX_async;
+    int GLAD_GL_SGIX_async_histogram;
+    int GLAD_GL_SGIX_async_pixel;
+    int GLAD_GL_SGIX_blend_alpha_minmax;
+    int GLAD_GL_SGIX_calligraphic_fragment;
+    int GLAD_GL_SGIX_clipmap;
+    int GLAD_GL_SGIX_convolution_accuracy;
+    int GLAD_GL_SGIX_depth_pass_instrument;
+    int GLAD_GL_SGIX_depth_texture;
+    int GLAD_GL_SGIX_flush_raster;
+    int GLAD_GL_SGIX_fog_offset;
+    int GLAD_GL_SGIX_fragment_lighting;
+    int GLAD_GL_SGIX_framezoom;
+    int GLAD_GL_SGIX_igloo_interface;
+    int GLAD_GL_SGIX_instruments;
+    int GLAD_GL_SGIX_interlace;
+    int GLAD_GL_SGIX_ir_instrument1;
+    int GLAD_GL_SGIX_list_priority;
+    int GLAD_GL_SGIX_pixel_texture;
+    int GLAD_GL_SGIX_pixel_tiles;
+    int GLAD_GL_SGIX_polynomial_ffd;
+    int GLAD_GL_SGIX_reference_plane;
+    int GLAD_GL_SGIX_resample;
+    int GLAD_GL_SGIX_scalebias_hint;
+    int GLAD_GL_SGIX_shadow;
+    int GLAD_GL_SGIX_shadow_ambient;
+    int GLAD_GL_SGIX_sprite;
+    int GLAD_GL_SGIX_subsample;
+    int GLAD_GL_SGIX_tag_sample_buffer;
+    int GLAD_GL_SGIX_texture_add_env;
+    int GLAD_GL_SGIX_texture_coordinate_clamp;
+    int GLAD_GL_SGIX_texture_lod_bias;
+    int GLAD_GL_SGIX_texture_multi_buffer;
+    int GLAD_GL_SGIX_texture_scale_bias;
+    int GLAD_GL_SGIX_vertex_preclip;
+    int GLAD_GL_SGIX_ycrcb;
+    int GLAD_GL_SGIX_ycrcb_subsample;
+    int GLAD_GL_SGIX_ycrcba;
+    int GLAD_GL_SGI_color_matrix;
+    int GLAD_GL_SGI_color_table;
+    int GLAD_GL_SGI_texture_color_table;
+    int GLAD_GL_SUNX_constant_data;
+    int GLAD_GL_SUN_convolution_border_modes;
+    int GLAD_GL_SUN_global_alpha;
+    int GLAD_GL_SUN_mesh_array;
+    int GLAD_GL_SUN_slice_accum;
+    int GLAD_GL_SUN_triangle_list;
+    int GLAD_GL_SUN_vertex;
+    int GLAD_GL_WIN_phong_shading;
+    int GLAD_GL_WIN_specular_fog;
+#endif
+    PFNGLCULLFACEPROC glad_glCullFace;
+    PFNGLFRONTFACEPROC glad_glFrontFace;
+    PFNGLHINTPROC glad_glHint;
+    PFNGLLINEWIDTHPROC glad_glLineWidth;
+    PFNGLPOINTSIZEPROC glad_glPointSize;
+    PFNGLPOLYGONMODEPROC glad_glPolygonMode;
+    PFNGLSCISSORPROC glad_glScissor;
+    PFNGLTEXPARAMETERFPROC glad_glTexParameterf;
+    PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv;
+    PFNGLTEXPARAMETERIPROC glad_glTexParameteri;
+    PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv;
+    PFNGLTEXIMAGE1DPROC glad_glTexImage1D;
+    PFNGLTEXIMAGE2DPROC glad_glTexImage2D;
+    PFNGLDRAWBUFFERPROC glad_glDrawBuffer;
+    PFNGLCLEARPROC glad_glClear;
+    PFNGLCLEARCOLORPROC glad_glClearColor;
+    PFNGLCLEARSTENCILPROC glad_glClearStencil;
+    PFNGLCLEARDEPTHPROC glad_glClearDepth;
+    PFNGLSTENCILMASKPROC glad_glStencilMask;
+    PFNGLCOLORMASKPROC glad_glColorMask;
+    PFNGLDEPTHMASKPROC glad_glDepthMask;
+    PFNGLDISABLEPROC glad_glDisable;
+    PFNGLENABLEPROC glad_glEnable;
+    PFNGLFINISHPROC glad_glFinish;
+    PFNGLFLUSHPROC glad_glFlush;
+    PFNGLBLENDFUNCPROC glad_glBlendFunc;
+    PFNGLLOGICOPPROC glad_glLogicOp;
+    PFNGLSTENCILFUNCPROC glad_glStencilFunc;
+    PFNGLSTENCILOPPROC glad_glStencilOp;
+    PFNGLDEPTHFUNCPROC glad_glDepthFunc;
+    PFNGLPIXELSTOREFPROC glad_glPixelStoref;
+    PFNGLPIXELSTOREIPROC glad_glPixelStorei;
+    PFNGLREADBUFFERPROC glad_glReadBuffer;
+    PFNGLREADPIXELSPROC glad_glReadPixels;
+    PFNGLGETBOOLEANVPROC glad_glGetBooleanv;
+    PFNGLGETDOUBLEVPROC glad_glGetDoublev;
+    PFNGLGETERRORPROC glad_glGetError;
+    PFNGLGETFLOATVPROC glad_glGetFloatv;
+    PFNGLGETINTEGERVPROC glad_glGetIntegerv;
+    PFNGLGETSTRINGPROC glad_glGetString;
+    PFNGLGETTEXIMAGEPROC glad_glGetTexImage;
+    PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv;
+    PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv;
+    PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv;
+    PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv;
+    PFNGLISENABLEDPROC glad_glIsEnabled;
+    PFNGLDEPTHRANGEPROC glad_glDepthRange;
+    PFNGLVIEWPORTPROC glad_glViewport;
+#ifndef GLAD_CORE_PROFILE
+    PFNGLNEWLISTPROC glad_glNewList;
+    PFNGLENDLISTPROC glad_glEndList;
+    PFNGLCALLLISTPROC glad_glCallList;
+    PFNGLCALLLISTSPROC glad_glCallLists;
+    PFNGLDELETELISTSPROC glad_glDeleteLists;
+    PFNGLGENLISTSPROC glad_glGenLists;
+    PFNGLLISTBASEPROC glad_glListBase;
+    PFNGLBEGINPROC glad_glBegin;
+    PFNGLBITMAPPROC glad_glBitmap;
+    PFNGLCOLOR3BPROC glad_glColor3b;
+    PFNGLCOLOR3BVPROC glad_glColor3bv;
+    PFNGLCOLOR3DPROC glad_glColor3d;
+    PFNGLCOLOR3DVPROC glad_glColor3dv;
+    PFNGLCOLOR3FPROC glad_glColor3f;
+    PFNGLCOLOR3FVPROC glad_glColor3fv;
+    PFNGLCOLOR3IPROC glad_glColor3i;
+    PFNGLCOLOR3IVPROC glad_glColor3iv;
+    PFNGLCOLOR3SPROC glad_glColor3s;
+    PFNGLCOLOR3SVPROC glad_glColor3sv;
+    PFNGLCOLOR3UBPROC glad_glColor3ub;
+    PFNGLCOLOR3UBVPROC glad_glColor3ubv;
+    PFNGLCOLOR3UIPROC glad_glColor3ui;
+    PFNGLCOLOR3UIVPROC glad_glColor3uiv;
+    PFNGLCOLOR3USPROC glad_glColor3us;
+    PFNGLCOLOR3USVPROC glad_glColor3usv;
+    PFNGLCOLOR4BPROC glad_glColor4b;
+    PFNGLCOLOR4BVPROC glad_glColor4bv;
+    PFNGLCOLOR4DPROC glad_glColor4d;
+    PFNGLCOLOR4DVPROC glad_glColor4dv;
+    PFNGLCOLOR4FPROC glad_glColor4f;
+    PFNGLCOLOR4FVPROC glad_glColor4fv;
+    PFNGLCOLOR4IPROC glad_glColor4i;
+    PFNGLCOLOR4IVPROC glad_glColor4iv;
+    PFNGLCOLOR4SPROC glad_glColor4s;
+    PFNGLCOLOR4SVPROC glad_glColor4sv;
+    PFNGLCOLOR4UBPROC glad_glColor4ub;
+    PFNGLCOLOR4UBVPROC glad_glColor4ubv;
+    PFNGLCOLOR4UIPROC glad_glColor4ui;
+    PFNGLCOLOR4UIVPROC glad_glColor4uiv;
+    PFNGLCOLOR4USPROC glad_glColor4us;
+    PFNGLCOLOR4USVPROC glad_glColor4usv;
+    PFNGLEDGEFLAGPROC glad_glEdgeFlag;
+    PFNGLEDGEFLAGVPROC glad_glEdgeFlagv;
+    PFNGLENDPROC glad_glEnd;
+    PFNGLINDEXDPROC glad_glIndexd;
+    PFNGLINDEXDVPROC glad_glIndexdv;
+    PFNGLINDEXFPROC glad_glIndexf;
+    PFNGLINDEXFVPROC glad_glIndexfv;
+    PFNGLINDEXIPROC glad_glIndexi;
+    PFNGLINDEXIVPROC glad_glIndexiv;
+    PFNGLINDEXSPROC glad_glIndexs;
+    PFNGLINDEXSVPROC glad_glIndexsv;
+    PFNGLNORMAL3BPROC glad_glNormal3b;
+    PFNGLNORMAL3BVPROC glad_glNormal3bv;
+    PFNGLNORMAL3DPROC glad_glNormal3d;
+    PFNGLNORMAL3DVPROC glad_glNormal3dv;
+    PFNGLNORMAL3FPROC glad_glNormal3f;
+    PFNGLNORMAL3FVPROC glad_glNormal3fv;
+    PFNGLNORMAL3IPROC glad_glNormal3i;
+    PFNGLNORMAL3IVPROC glad_glNormal3iv;
+    PFNGLNORMAL3SPROC glad_glNormal3s;
+    PFNGLNORMAL3SVPROC glad_glNormal3sv;
+    PFNGLRASTERPOS2DPROC glad_glRasterPos2d;
+    PFNGLRASTERPOS2DVPROC glad_glRasterPos2dv;
+    PFNGLRASTERPOS2FPROC glad_glRasterPos2f;
+    PFNGLRASTERPOS2FVPROC glad_glRasterPos2fv;
+    PFNGLRASTERPOS2IPROC glad_glRasterPos2i;
+    PFNGLRASTERPOS2IVPROC glad_glRasterPos2iv;
+    PFNGLRASTERPOS2SPROC glad_glRasterPos2s;
+    PFNGLRASTERPOS2SVPROC glad_glRasterPos2sv;
+    PFNGLRASTERPOS3DPROC glad_glRasterPos3d;
+    PFNGLRASTERPOS3DVPROC glad_glRasterPos3dv;
+    PFNGLRASTERPOS3FPROC glad_glRasterPos3f;
+    PFNGLRASTERPOS3FVPROC glad_glRasterPos3fv;
+    PFNGLRASTERPOS3IPROC glad_glRasterPos3i;
+    PFNGLRASTERPOS3IVPROC glad_glRasterPos3iv;
+    PFNGLRASTERPOS3SPROC glad_glRasterPos3s;
+    PFNGLRASTERPOS3SVPROC glad_glRasterPos3sv;
+    PFNGLRASTERPOS4DPROC glad_glRasterPos4d;
+    PFNGLRASTERPOS4DVPROC glad_glRasterPos4dv;
+    PFNGLRASTERPOS4FPROC glad_glRasterPos4f;
+    PFNGLRASTERPOS4FVPROC glad_glRasterPos4fv;
+    PFNGLRASTERPOS4IPROC glad_glRasterPos4i;
+    PFNGLRASTERPOS4IVPROC glad_glRasterPos4iv;
+    PFNGLRASTERPOS4SPROC glad_glRasterPos4s;
+    PFNGLRASTERPOS4SVPROC glad_glRasterPos4sv;
+    PFNGLRECTDPROC glad_glRectd;
+    PFNGLRECTDVPROC glad_glRectdv;
+    PFNGLRECTFPROC glad_glRectf;
+    PFNGLRECTFVPROC glad_glRectfv;
+    PFNGLRECTIPROC glad_glRecti;
+    PFNGLRECTIVPROC glad_glRectiv;
+    PFNGLRECTSPROC glad_glRects;
+    PFNGLRECTSVPROC glad_glRectsv;
+    PFNGLTEXCOORD1DPROC glad_glTexCoord1d;
+    PFNGLTEXCOORD1DVPROC glad_glTexCoord1dv;
+    PFNGLTEXCOORD1FPROC glad_glTexCoord1f;
+    PFNGLTEXCOORD1FVPROC glad_glTexCoord1fv;
+    PFNGLTEXCOORD1IPROC glad_glTexCoord1i;
+    PFNGLTEXCOORD1IVPROC glad_glTexCoord1iv;
+    PFNGLTEXCOORD1SPROC glad_glTexCoord1s;
+    PFNGLTEXCOORD1SVPROC glad_glTexCoord1sv;
+    PFNGLTEXCOORD2DPROC glad_glTexCoord2d;
+    PFNGLTEXCOORD2DVPROC glad_glTexCoord2dv;
+    PFNGLTEXCOORD2FPROC glad_glTexCoord2f;
+    PFNGLTEXCOORD2FVPROC glad_glTexCoord2fv;
+    PFNGLTEXCOORD2IPROC glad_glTexCoord2i;
+    PFNGLTEXCOORD2IVPROC glad_glTexCoord2iv;
+    PFNGLTEXCOORD2SPROC glad_glTexCoord2s;
+    PFNGLTEXCOORD2SVPROC glad_glTexCoord2sv;
+    PFNGLTEXCOORD3DPROC glad_glTexCoord3d;
+    PFNGLTEXCOORD3DVPROC glad_glTexCoord3dv;
+    PFNGLTEXCOORD3FPROC glad_glTexCoord3f;
+    PFNGLTEXCOORD3FVPROC glad_glTexCoord3fv;
+    PFNGLTEXCOORD3IPROC glad_glTexCoord3i;
+    PFNGLTEXCOORD3IVPROC glad_glTexCoord3iv;
+    PFNGLTEXCOORD3SPROC glad_glTexCoord3s;
+    PFNGLTEXCOORD3SVPROC glad_glTexCoord3sv;
+    PFNGLTEXCOORD4DPROC glad_glTexCoord4d;
+    PFNGLTEXCOORD4DVPROC glad_glTexCoord4dv;
+    PFNGLTEXCOORD4FPROC glad_glTexCoord4f;
+    PFNGLTEXCOORD4FVPROC glad_glTexCoord4fv;
+    PFNGLTEXCOORD4IPROC glad_glTexCoord4i;
+    PFNGLTEXCOORD4IVPROC glad_glTexCoord4iv;
+    PFNGLTEXCOORD4SPROC glad_glTexCoord4s;
+    PFNGLTEXCOORD4SVPROC glad_glTexCoord4sv;
+    PFNGLVERTEX2DPROC glad_glVertex2d;
+    PFNGLVERTEX2DVPROC glad_glVertex2dv;
+    PFNGLVERTEX2FPROC glad_glVertex2f;
+    PFNGLVERTEX2FVPROC glad_glVertex2fv;
+    PFNGLVERTEX2IPROC glad_glVertex2i;
+    PFNGLVERTEX2IVPROC glad_glVertex2iv;
+    PFNGLVERTEX2SPROC glad_glVertex2s;
+    PFNGLVERTEX2SVPROC glad_glVertex2sv;
+    PFNGLVERTEX3DPROC glad_glVertex3d;
+    PFNGLVERTEX3DVPROC glad_glVertex3dv;
+    PFNGLVERTEX3FPROC glad_glVertex3f;
+    PFNGLVERTEX3FVPROC glad_glVertex3fv;
+    PFNGLVERTEX3IPROC glad_glVertex3i;
+    PFNGLVERTEX3IVPROC glad_glVertex3iv;
+    PFNGLVERTEX3SPROC glad_glVertex3s;
+    PFNGLVERTEX3SVPROC glad_glVertex3sv;
+    PFNGLVERTEX4DPROC glad_glVertex4d;
+    PFNGLVERTEX4DVPROC glad_glVertex4dv;
+    PFNGLVERTEX4FPROC glad_glVertex4f;
+    PFNGLVERTEX4FVPROC glad_glVertex4fv;
+    PFNGLVERTEX4IPROC glad_glVertex4i;
+    PFNGLVERTEX4IVPROC glad_glVertex4iv;
+    PFNGLVERTEX4SPROC glad_glVertex4s;
+    PFNGLVERTEX4SVPROC glad_glVertex4sv;
+    PFNGLCLIPPLANEPROC glad_glClipPlane;
+    PFNGLCOLORMATERIALPROC glad_glColorMaterial;
+    PFNGLFOGFPROC glad_glFogf;
+    PFNGLFOGFVPROC glad_glFogfv;
+    PFNGLFOGIPROC glad_glFogi;
+    PFNGLFOGIVPROC glad_glFogiv;
+    PFNGLLIGHTFPROC glad_glLightf;
+    PFNGLLIGHTFVPROC glad_glLightfv;
+    PFNGLLIGHTIPROC glad_glLighti;
+    PFNGLLIGHTIVPROC glad_glLightiv;
+    PFNGLLIGHTMODELFPROC glad_glLightModelf;
+    PFNGLLIGHTMODELFVPROC glad_glLightModelfv;
+    PFNGLLIGHTMODELIPROC glad_glLightModeli;
+    PFNGLLIGHTMODELIVPROC glad_glLightModeliv;
+    PFNGLLINESTIPPLEPROC glad_glLineStipple;
+    PFNGLMATERIALFPROC glad_glMaterialf;
+    PFNGLMATERIALFVPROC glad_glMaterialfv;
+    PFNGLMATERIALIPROC glad_glMateriali;
+    PFNGLMATERIALIVPROC glad_glMaterialiv;
+    PFNGLPOLYGONSTIPPLEPROC glad_glPolygonStipple;
+    PFNGLSHADEMODELPROC glad_glShadeModel;
+    PFNGLTEXENVFPROC glad_glTexEnvf;
+    PFNGLTEXENVFVPROC glad_glTexEnvfv;
+    PFNGLTEXENVIPROC glad_glTexEnvi;
+    PFNGLTEXENVIVPROC glad_glTexEnviv;
+    PFNGLTEXGENDPROC glad_glTexGend;
+    PFNGLTEXGENDVPROC glad_glTexGendv;
+    PFNGLTEXGENFPROC glad_glTexGenf;
+    PFNGLTEXGENFVPROC glad_glTexGenfv;
+    PFNGLTEXGENIPROC glad_glTexGeni;
+    PFNGLTEXGENIVPROC glad_glTexGeniv;
+    PFNGLFEEDBACKBUFFERPROC glad_glFeedbackBuffer;
+    PFNGLSELECTBUFFERPROC glad_glSelectBuffer;
+    PFNGLRENDERMODEPROC glad_glRenderMode;
+    PFNGLINITNAMESPROC glad_glInitNames;
+    PFNGLLOADNAMEPROC glad_glLoadName;
+    PFNGLPASSTHROUGHPROC glad_glPassThrough;
+    PFNGLPOPNAMEPROC glad_glPopName;
+    PFNGLPUSHNAMEPROC glad_glPushName;
+    PFNGLCLEARACCUMPROC glad_glClearAccum;
+    PFNGLCLEARINDEXPROC glad_glClearIndex;
+    PFNGLINDEXMASKPROC glad_glIndexMask;
+    PFNGLACCUMPROC glad_glAccum;
+    PFNGLPOPATTRIBPROC glad_glPopAttrib;
+    PFNGLPUSHATTRIBPROC glad_glPushAttrib;
+    PFNGLMAP1DPROC glad_glMap1d;
+    PFNGLMAP1FPROC glad_glMap1f;
+    PFNGLMAP2DPROC glad_glMap2d;
+    PFNGLMAP2FPROC glad_glMap2f;
+    PFNGLMAPGRID1DPROC glad_glMapGrid1d;
+    PFNGLMAPGRID1FPROC glad_glMapGrid1f;
+    PFNGLMAPGRID2DPROC glad_glMapGrid2d;
+    PFNGLMAPGRID2FPROC glad_glMapGrid2f;
+    PFNGLEVALCOORD1DPROC glad_glEvalCoord1d;
+    PFNGLEVALCOORD1DVPROC glad_glEvalCoord1dv;
+    PFNGLEVALCOORD1FPROC glad_glEvalCoord1f;
+    PFNGLEVALCOORD1FVPROC glad_glEvalCoord1fv;
+    PFNGLEVALCOORD2DPROC glad_glEvalCoord2d;
+    PFNGLEVALCOORD2DVPROC glad_glEvalCoord2dv;
+    PFNGLEVALCOORD2FPROC glad_glEvalCoord2f;
+    PFNGLEVALCOORD2FVPROC glad_glEvalCoord2fv;
+    PFNGLEVALMESH1PROC glad_glEvalMesh1;
+    PFNGLEVALPOINT1PROC glad_glEvalPoint1;
+    PFNGLEVALMESH2PROC glad_glEvalMesh2;
+    PFNGLEVALPOINT2PROC glad_glEvalPoint2;
+    PFNGLALPHAFUNCPROC glad_glAlphaFunc;
+    PFNGLPIXELZOOMPROC glad_glPixelZoom;
+    PFNGLPIXELTRANSFERFPROC glad_glPixelTransferf;
+    PFNGLPIXELTRANSFERIPROC glad_glPixelTransferi;
+    PFNGLPIXELMAPFVPROC glad_glPixelMapfv;
+    PFNGLPIXELMAPUIVPROC glad_glPixelMapuiv;
+    PFNGLPIXELMAPUSVPROC glad_glPixelMapusv;
+    PFNGLCOPYPIXELSPROC glad_glCopyPixels;
+    PFNGLDRAWPIXELSPROC glad_glDrawPixels;
+    PFNGLGETCLIPPLANEPROC glad_glGetClipPlane;
+    PFNGLGETLIGHTFVPROC glad_glGetLightfv;
+    PFNGLGETLIGHTIVPROC glad_glGetLightiv;
+    PFNGLGETMAPDVPROC glad_glGetMapdv;
+    PFNGLGETMAPFVPROC glad_glGetMapfv;
+    PFNGLGETMAPIVPROC glad_glGetMapiv;
+    PFNGLGETMATERIALFVPROC glad_glGetMaterialfv;
+    PFNGLGETMATERIALIVPROC glad_glGetMaterialiv;
+    PFNGLGETPIXELMAPFVPROC glad_glGetPixelMapfv;
+    PFNGLGETPIXELMAPUIVPROC glad_glGetPixelMapuiv;
+    PFNGLGETPIXELMAPUSVPROC glad_glGetPixelMapusv;
+    PFNGLGETPOLYGONSTIPPLEPROC glad_glGetPolygonStipple;
+    PFNGLGETTEXENVFVPROC glad_glGetTexEnvfv;
+    PFNGLGETTEXENVIVPROC glad_glGetTexEnviv;
+    PFNGLGETTEXGENDVPROC glad_glGetTexGendv;
+    PFNGLGETTEXGENFVPROC glad_glGetTexGenfv;
+    PFNGLGETTEXGENIVPROC glad_glGetTexGeniv;
+    PFNGLISLISTPROC glad_glIsList;
+    PFNGLFRUSTUMPROC glad_glFrustum;
+    PFNGLLOADIDENTITYPROC glad_glLoadIdentity;
+    PFNGLLOADMATRIXFPROC glad_glLoadMatrixf;
+    PFNGLLOADMATRIXDPROC glad_glLoadMatrixd;
+    PFNGLMATRIXMODEPROC glad_glMatrixMode;
+    PFNGLMULTMATRIXFPROC glad_glMultMatrixf;
+    PFNGLMULTMATRIXDPROC glad_glMultMatrixd;
+    PFNGLORTHOPROC glad_glOrtho;
+    PFNGLPOPMATRIXPROC glad_glPopMatrix;
+    PFNGLPUSHMATRIXPROC glad_glPushMatrix;
+    PFNGLROTATEDPROC glad_glRotated;
+    PFNGLROTATEFPROC glad_glRotatef;
+    PFNGLSCALEDPROC glad_glScaled;
+    PFNGLSCALEFPROC glad_glScalef;
+    PFNGLTRANSLATEDPROC glad_glTranslated;
+    PFNGLTRANSLATEFPROC glad_glTranslatef;
+#endif
+    PFNGLDRAWARRAYSPROC glad_glDrawArrays;
+    PFNGLDRAWELEMENTSPROC glad_glDrawElements;
+    PFNGLGETPOINTERVPROC glad_glGetPointerv;
+    PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset;
+    PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D;
+    PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D;
+    PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D;
+    PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D;
+    PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D;
+    PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D;
+    PFNGLBINDTEXTUREPROC glad_glBindTexture;
+    PFNGLDELETETEXTURESPROC glad_glDeleteTextures;
+    PFNGLGENTEXTURESPROC glad_glGenTextures;
+    PFNGLISTEXTUREPROC glad_glIsTexture;
+#ifndef GLAD_CORE_PROFILE
+    PFNGLARRAYELEMENTPROC glad_glArrayElement;
+    PFNGLCOLORPOINTERPROC glad_glColorPointer;
+    PFNGLDISABLECLIENTSTATEPROC glad_glDisableClientState;
+    PFNGLEDGEFLAGPOINTERPROC glad_glEdgeFlagPointer;
+    PFNGLENABLECLIENTSTATEPROC glad_glEnableClientState;
+    PFNGLINDEXPOINTERPROC glad_glIndexPointer;
+    PFNGLINTERLEAVEDARRAYSPROC glad_glInterleavedArrays;
+    PFNGLNORMALPOINTERPROC glad_glNormalPointer;
+    PFNGLTEXCOORDPOINTERPROC glad_glTexCoordPointer;
+    PFNGLVERTEXPOINTERPROC glad_glVertexPointer;
+    PFNGLARETEXTURESRESIDENTPROC glad_glAreTexturesResident;
+    PFNGLPRIORITIZETEXTURESPROC glad_glPrioritizeTextures;
+    PFNGLINDEXUBPROC glad_glIndexub;
+    PFNGLINDEXUBVPROC glad_glIndexubv;
+    PFNGLPOPCLIENTATTRIBPROC glad_glPopClientAttrib;
+    PFNGLPUSHCLIENTATTRIBPROC glad_glPushClientAttrib;
+#endif
+    PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements;
+    PFNGLTEXIMAGE3DPROC glad_glTexImage3D;
+    PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D;
+    PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D;
+    PFNGLACTIVETEXTUREPROC glad_glActiveTexture;
+    PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage;
+    PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D;
+    PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D;
+    PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D;
+    PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D;
+    PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage;
+#ifndef GLAD_CORE_PROFILE
+    PFNGLCLIENTACTIVETEXTUREPROC glad_glClientActiveTexture;
+    PFNGLMULTITEXCOORD1DPROC glad_glMultiTexCoord1d;
+    PFNGLMULTITEXCOORD1DVPROC glad_glMultiTexCoord1dv;
+    PFNGLMULTITEXCOORD1FPROC glad_glMultiTexCoord1f;
+    PFNGLMULTITEXCOORD1FVPROC glad_glMultiTexCoord1fv;
+    PFNGLMULTITEXCOORD1IPROC glad_glMultiTexCoord1i;
+    PFNGLMULTITEXCOORD1IVPROC glad_glMultiTexCoord1iv;
+    PFNGLMULTITEXCOORD1SPROC glad_glMultiTexCoord1s;
+    PFNGLMULTITEXCOORD1SVPROC glad_glMultiTexCoord1sv;
+    PFNGLMULTITEXCOORD2DPROC glad_glMultiTexCoord2d;
+    PFNGLMULTITEXCOORD2DVPROC glad_glMultiTexCoord2dv;
+    PFNGLMULTITEXCOORD2FPROC glad_glMultiTexCoord2f;
+    PFNGLMULTITEXCOORD2FVPROC glad_glMultiTexCoord2fv;
+    PFNGLMULTITEXCOORD2IPROC glad_glMultiTexCoord2i;
+    PFNGLMULTITEXCOORD2IVPROC glad_glMultiTexCoord2iv;
+    PFNGLMULTITEXCOORD2SPROC glad_glMultiTexCoord2s;
+    PFNGLMULTITEXCOORD2SVPROC glad_glMultiTexCoord2sv;
+    PFNGLMULTITEXCOORD3DPROC glad_glMultiTexCoord3d;
+    PFNGLMULTITEXCOORD3DVPROC glad_glMultiTexCoord3dv;
+    PFNGLMULTITEXCOORD3FPROC glad_glMultiTexCoord3f;
+    PFNGLMULTITEXCOORD3FVPROC glad_glMultiTexCoord3fv;
+    PFNGLMULTITEXCOORD3IPROC glad_glMultiTexCoord3i;
+    PFNGLMULTITEXCOORD3IVPROC glad_glMultiTexCoord3iv;
+    PFNGLMULTITEXCOORD3SPROC glad_glMultiTexCoord3s;
+    PFNGLMULTITEXCOORD3SVPROC glad_glMultiTexCoord3sv;
+    PFNGLMULTITEXCOORD4DPROC glad_glMultiTexCoord4d;
+    PFNGLMULTITEXCOORD4DVPROC glad_glMultiTexCoord4dv;
+    PFNGLMULTITEXCOORD4FPROC glad_glMultiTexCoord4f;
+    PFNGLMULTITEXCOORD4FVPROC glad_glMultiTexCoord4fv;
+    PFNGLMULTITEXCOORD4IPROC glad_glMultiTexCoord4i;
+    PFNGLMULTITEXCOORD4IVPROC glad_glMultiTexCoord4iv;
+    PFNGLMULTITEXCOORD4SPROC glad_glMultiTexCoord4s;
+    PFNGLMULTITEXCOORD4SVPROC glad_glMultiTexCoord4sv;
+    PFNGLLOADTRANSPOSEMATRIXFPROC glad_glLoadTransposeMatrixf;
+    PFNGLLOADTRANSPOSEMATRIXDPROC glad_glLoadTransposeMatrixd;
+    PFNGLMULTTRANSPOSEMATRIXFPROC glad_glMultTransposeMatrixf;
+    PFNGLMULTTRANSPOSEMATRIXDPROC glad_glMultTransposeMatrixd;
+#endif
+    PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate;
+    PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays;
+    PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements;
+    PFNGLPOINTPARAMETERFPROC glad_glPointParameterf;
+    PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv;
+    PFNGLPOINTPARAMETERIPROC glad_glPointParameteri;
+    PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv;
+#ifndef GLAD_CORE_PROFILE
+    PFNGLFOGCOORDFPROC glad_glFogCoordf;
+    PFNGLFOGCOORDFVPROC glad_glFogCoordfv;
+    PFNGLFOGCOORDDPROC glad_glFogCoordd;
+    PFNGLFOGCOORDDVPROC glad_glFogCoorddv;
+    PFNGLFOGCOORDPOINTERPROC glad_glFogCoordPointer;
+    PFNGLSECONDARYCOLOR3BPROC glad_glSecondaryColor3b;
+    PFNGLSECONDARYCOLOR3BVPROC glad_glSecondaryColor3bv;
+    PFNGLSECONDARYCOLOR3DPROC glad_glSecondaryColor3d;
+    PFNGLSECONDARYCOLOR3DVPROC glad_glSecondaryColor3dv;
+    PFNGLSECONDARYCOLOR3FPROC glad_glSecondaryColor3f;
+    PFNGLSECONDARYCOLOR3FVPROC glad_glSecondaryColor3fv;
+    PFNGLSECONDARYCOLOR3IPROC glad_glSecondaryColor3i;
+    PFNGLSECONDARYCOLOR3IVPROC glad_glSecondaryColor3iv;
+    PFNGLSECONDARYCOLOR3SPROC glad_glSecondaryColor3s;
+    PFNGLSECONDARYCOLOR3SVPROC glad_glSecondaryColor3sv;
+    PFNGLSECONDARYCOLOR3UBPROC glad_glSecondaryColor3ub;
+    PFNGLSECONDARYCOLOR3UBVPROC glad_glSecondaryColor3ubv;
+    PFNGLSECONDARYCOLOR3UIPROC glad_glSecondaryColor3ui;
+    PFNGLSECONDARYCOLOR3UIVPROC glad_glSecondaryColor3uiv;
+    PFNGLSECONDARYCOLOR3USPROC glad_glSecondaryColor3us;
+    PFNGLSECONDARYCOLOR3USVPROC glad_glSecondaryColor3usv;
+    PFNGLSECONDARYCOLORPOINTERPROC glad_glSecondaryColorPointer;
+    PFNGLWINDOWPOS2DPROC glad_glWindowPos2d;
+    PFNGLWINDOWPOS2DVPROC glad_glWindowPos2dv;
+    PFNGLWINDOWPOS2FPROC glad_glWindowPos2f;
+    PFNGLWINDOWPOS2FVPROC glad_glWindowPos2fv;
+    PFNGLWINDOWPOS2IPROC glad_glWindowPos2i;
+    PFNGLWINDOWPOS2IVPROC glad_glWindowPos2iv;
+    PFNGLWINDOWPOS2SPROC glad_glWindowPos2s;
+    PFNGLWINDOWPOS2SVPROC glad_glWindowPos2sv;
+    PFNGLWINDOWPOS3DPROC glad_glWindowPos3d;
+    PFNGLWINDOWPOS3DVPROC glad_glWindowPos3dv;
+    PFNGLWINDOWPOS3FPROC glad_glWindowPos3f;
+    PFNGLWINDOWPOS3FVPROC glad_glWindowPos3fv;
+    PFNGLWINDOWPOS3IPROC glad_glWindowPos3i;
+    PFNGLWINDOWPOS3IVPROC glad_glWindowPos3iv;
+    PFNGLWINDOWPOS3SPROC glad_glWindowPos3s;
+    PFNGLWINDOWPOS3SVPROC glad_glWindowPos3sv;
+#endif
+    PFNGLBLENDCOLORPROC glad_glBlendColor;
+    PFNGLBLENDEQUATIONPROC glad_glBlendEquation;
+    PFNGLGENQUERIESPROC glad_glGenQueries;
+    PFNGLDELETEQUERIESPROC glad_glDeleteQueries;
+    PFNGLISQUERYPROC glad_glIsQuery;
+    PFNGLBEGINQUERYPROC glad_glBeginQuery;
+    PFNGLENDQUERYPROC glad_glEndQuery;
+    PFNGLGETQUERYIVPROC glad_glGetQueryiv;
+    PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv;
+    PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv;
+    PFNGLBINDBUFFERPROC glad_glBindBuffer;
+    PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers;
+    PFNGLGENBUFFERSPROC glad_glGenBuffers;
+    PFNGLISBUFFERPROC glad_glIsBuffer;
+    PFNGLBUFFERDATAPROC glad_glBufferData;
+    PFNGLBUFFERSUBDATAPROC glad_glBufferSubData;
+    PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData;
+    PFNGLMAPBUFFERPROC glad_glMapBuffer;
+    PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer;
+    PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv;
+    PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv;
+    PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate;
+    PFNGLDRAWBUFFERSPROC glad_glDrawBuffers;
+    PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate;
+    PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate;
+    PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate;
+    PFNGLATTACHSHADERPROC glad_glAttachShader;
+    PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation;
+    PFNGLCOMPILESHADERPROC glad_glCompileShader;
+    PFNGLCREATEPROGRAMPROC glad_glCreateProgram;
+    PFNGLCREATESHADERPROC glad_glCreateShader;
+    PFNGLDELETEPROGRAMPROC glad_glDeleteProgram;
+    PFNGLDELETESHADERPROC glad_glDeleteShader;
+    PFNGLDETACHSHADERPROC glad_glDetachShader;
+    PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray;
+    PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray;
+    PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib;
+    PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform;
+    PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders;
+    PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation;
+    PFNGLGETPROGRAMIVPROC glad_glGetProgramiv;
+    PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog;
+    PFNGLGETSHADERIVPROC glad_glGetShaderiv;
+    PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog;
+    PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource;
+    PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation;
+    PFNGLGETUNIFORMFVPROC glad_glGetUniformfv;
+    PFNGLGETUNIFORMIVPROC glad_glGetUniformiv;
+    PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv;
+    PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv;
+    PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv;
+    PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv;
+    PFNGLISPROGRAMPROC glad_glIsProgram;
+    PFNGLISSHADERPROC glad_glIsShader;
+    PFNGLLINKPROGRAMPROC glad_glLinkProgram;
+    PFNGLSHADERSOURCEPROC glad_glShaderSource;
+    PFNGLUSEPROGRAMPROC glad_glUseProgram;
+    PFNGLUNIFORM1FPROC glad_glUniform1f;
+    PFNGLUNIFORM2FPROC glad_glUniform2f;
+    PFNGLUNIFORM3FPROC glad_glUniform3f;
+    PFNGLUNIFORM4FPROC glad_glUniform4f;
+    PFNGLUNIFORM1IPROC glad_glUniform1i;
+    PFNGLUNIFORM2IPROC glad_glUniform2i;
+    PFNGLUNIFORM3IPROC glad_glUniform3i;
+    PFNGLUNIFORM4IPROC glad_glUniform4i;
+    PFNGLUNIFORM1FVPROC glad_glUniform1fv;
+    PFNGLUNIFORM2FVPROC glad_glUniform2fv;
+    PFNGLUNIFORM3FVPROC glad_glUniform3fv;
+    PFNGLUNIFORM4FVPROC glad_glUniform4fv;
+    PFNGLUNIFORM1IVPROC glad_glUniform1iv;
+    PFNGLUNIFORM2IVPROC glad_glUniform2iv;
+    PFNGLUNIFORM3IVPROC glad_glUniform3iv;
+    PFNGLUNIFORM4IVPROC glad_glUniform4iv;
+    PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv;
+    PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv;
+    PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv;
+    PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram;
+    PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d;
+    PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv;
+    PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f;
+    PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv;
+    PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s;
+    PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv;
+    PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d;
+    PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv;
+    PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f;
+    PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv;
+    PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s;
+    PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv;
+    PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d;
+    PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv;
+    PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f;
+    PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv;
+    PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s;
+    PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv;
+    PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv;
+    PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv;
+    PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv;
+    PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub;
+    PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv;
+    PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv;
+    PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv;
+    PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv;
+    PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d;
+    PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv;
+    PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f;
+    PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv;
+    PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv;
+    PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s;
+    PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv;
+    PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv;
+    PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv;
+    PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv;
+    PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer;
+    PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv;
+    PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv;
+    PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv;
+    PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv;
+    PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv;
+    PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv;
+    PFNGLCOLORMASKIPROC glad_glColorMaski;
+    PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v;
+    PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v;
+    PFNGLENABLEIPROC glad_glEnablei;
+    PFNGLDISABLEIPROC glad_glDisablei;
+    PFNGLISENABLEDIPROC glad_glIsEnabledi;
+    PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback;
+    PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback;
+    PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange;
+    PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase;
+    PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings;
+    PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying;
+    PFNGLCLAMPCOLORPROC glad_glClampColor;
+    PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender;
+    PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender;
+    PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer;
+    PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv;
+    PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv;
+    PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i;
+    PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i;
+    PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i;
+    PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i;
+    PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui;
+    PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui;
+    PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui;
+    PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui;
+    PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv;
+    PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv;
+    PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv;
+    PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv;
+    PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv;
+    PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv;
+    PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv;
+    PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv;
+    PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv;
+    PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv;
+    PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv;
+    PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv;
+    PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv;
+    PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation;
+    PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation;
+    PFNGLUNIFORM1UIPROC glad_glUniform1ui;
+    PFNGLUNIFORM2UIPROC glad_glUniform2ui;
+    PFNGLUNIFORM3UIPROC glad_glUniform3ui;
+    PFNGLUNIFORM4UIPROC glad_glUniform4ui;
+    PFNGLUNIFORM1UIVPROC glad_glUniform1uiv;
+    PFNGLUNIFORM2UIVPROC glad_glUniform2uiv;
+    PFNGLUNIFORM3UIVPROC glad_glUniform3uiv;
+    PFNGLUNIFORM4UIVPROC glad_glUniform4uiv;
+    PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv;
+    PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv;
+    PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv;
+    PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv;
+    PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv;
+    PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv;
+    PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv;
+    PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi;
+    PFNGLGETSTRINGIPROC glad_glGetStringi;
+    PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer;
+    PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer;
+    PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers;
+    PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers;
+    PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage;
+    PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv;
+    PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer;
+    PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer;
+    PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers;
+    PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers;
+    PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus;
+    PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D;
+    PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D;
+    PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D;
+    PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer;
+    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv;
+    PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap;
+    PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer;
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample;
+    PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer;
+    PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange;
+    PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange;
+    PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray;
+    PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays;
+    PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays;
+    PFNGLISVERTEXARRAYPROC glad_glIsVertexArray;
+    PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced;
+    PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced;
+    PFNGLTEXBUFFERPROC glad_glTexBuffer;
+    PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex;
+    PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData;
+    PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices;
+    PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv;
+    PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName;
+    PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex;
+    PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv;
+    PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName;
+    PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding;
+    PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex;
+    PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex;
+    PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex;
+    PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex;
+    PFNGLFENCESYNCPROC glad_glFenceSync;
+    PFNGLISSYNCPROC glad_glIsSync;
+    PFNGLDELETESYNCPROC glad_glDeleteSync;
+    PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync;
+    PFNGLWAITSYNCPROC glad_glWaitSync;
+    PFNGLGETINTEGER64VPROC glad_glGetInteger64v;
+    PFNGLGETSYNCIVPROC glad_glGetSynciv;
+    PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v;
+    PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v;
+    PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture;
+    PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample;
+    PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample;
+    PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv;
+    PFNGLSAMPLEMASKIPROC glad_glSampleMaski;
+    PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed;
+    PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex;
+    PFNGLGENSAMPLERSPROC glad_glGenSamplers;
+    PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers;
+    PFNGLISSAMPLERPROC glad_glIsSampler;
+    PFNGLBINDSAMPLERPROC glad_glBindSampler;
+    PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri;
+    PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv;
+    PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf;
+    PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv;
+    PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv;
+    PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv;
+    PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv;
+    PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv;
+    PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv;
+    PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv;
+    PFNGLQUERYCOUNTERPROC glad_glQueryCounter;
+    PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v;
+    PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v;
+    PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor;
+    PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui;
+    PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv;
+    PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui;
+    PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv;
+    PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui;
+    PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv;
+    PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui;
+    PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv;
+#ifndef GLAD_CORE_PROFILE
+    PFNGLVERTEXP2UIPROC glad_glVertexP2ui;
+    PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv;
+    PFNGLVERTEXP3UIPROC glad_glVertexP3ui;
+    PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv;
+    PFNGLVERTEXP4UIPROC glad_glVertexP4ui;
+    PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv;
+    PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui;
+    PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv;
+    PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui;
+    PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv;
+    PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui;
+    PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv;
+    PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui;
+    PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv;
+    PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui;
+    PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv;
+    PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui;
+    PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv;
+    PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui;
+    PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv;
+    PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui;
+    PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv;
+    PFNGLNORMALP3UIPROC glad_glNormalP3ui;
+    PFNGLNORMALP3UIVPROC glad_glNormalP3uiv;
+    PFNGLCOLORP3UIPROC glad_glColorP3ui;
+    PFNGLCOLORP3UIVPROC glad_glColorP3uiv;
+    PFNGLCOLORP4UIPROC glad_glColorP4ui;
+    PFNGLCOLORP4UIVPROC glad_glColorP4uiv;
+    PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui;
+    PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv;
+#endif
+    PFNGLMINSAMPLESHADINGPROC glad_glMinSampleShading;
+    PFNGLBLENDEQUATIONIPROC glad_glBlendEquationi;
+    PFNGLBLENDEQUATIONSEPARATEIPROC glad_glBlendEquationSeparatei;
+    PFNGLBLENDFUNCIPROC glad_glBlendFunci;
+    PFNGLBLENDFUNCSEPARATEIPROC glad_glBlendFuncSeparatei;
+    PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect;
+    PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect;
+    PFNGLUNIFORM1DPROC glad_glUniform1d;
+    PFNGLUNIFORM2DPROC glad_glUniform2d;
+    PFNGLUNIFORM3DPROC glad_glUniform3d;
+    PFNGLUNIFORM4DPROC glad_glUniform4d;
+    PFNGLUNIFORM1DVPROC glad_glUniform1dv;
+    PFNGLUNIFORM2DVPROC glad_glUniform2dv;
+    PFNGLUNIFORM3DVPROC glad_glUniform3dv;
+    PFNGLUNIFORM4DVPROC glad_glUniform4dv;
+    PFNGLUNIFORMMATRIX2DVPROC glad_glUniformMatrix2dv;
+    PFNGLUNIFORMMATRIX3DVPROC glad_glUniformMatrix3dv;
+    PFNGLUNIFORMMATRIX4DVPROC glad_glUniformMatrix4dv;
+    PFNGLUNIFORMMATRIX2X3DVPROC glad_glUniformMatrix2x3dv;
+    PFNGLUNIFORMMATRIX2X4DVPROC glad_glUniformMatrix2x4dv;
+    PFNGLUNIFORMMATRIX3X2DVPROC glad_glUniformMatrix3x2dv;
+    PFNGLUNIFORMMATRIX3X4DVPROC glad_glUniformMatrix3x4dv;
+    PFNGLUNIFORMMATRIX4X2DVPROC glad_glUniformMatrix4x2dv;
+    PFNGLUNIFORMMATRIX4X3DVPROC glad_glUniformMatrix4x3dv;
+    PFNGLGETUNIFORMDVPROC glad_glGetUniformdv;
+    PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_glGetSubroutineUniformLocation;
+    PFNGLGETSUBROUTINEINDEXPROC glad_glGetSubroutineIndex;
+    PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_glGetActiveSubroutineUniformiv;
+    PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_glGetActiveSubroutineUniformName;
+    PFNGLGETACTIVESUBROUTINENAMEPROC glad_glGetActiveSubroutineName;
+    PFNGLUNIFORMSUBROUTINESUIVPROC glad_glUniformSubroutinesuiv;
+    PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_glGetUniformSubroutineuiv;
+    PFNGLGETPROGRAMSTAGEIVPROC glad_glGetProgramStageiv;
+    PFNGLPATCHPARAMETERIPROC glad_glPatchParameteri;
+    PFNGLPATCHPARAMETERFVPROC glad_glPatchParameterfv;
+    PFNGLBINDTRANSFORMFEEDBACKPROC glad_glBindTransformFeedback;
+    PFNGLDELETETRANSFORMFEEDBACKSPROC glad_glDeleteTransformFeedbacks;
+    PFNGLGENTRANSFORMFEEDBACKSPROC glad_glGenTransformFeedbacks;
+    PFNGLISTRANSFORMFEEDBACKPROC glad_glIsTransformFeedback;
+    PFNGLPAUSETRANSFORMFEEDBACKPROC glad_glPauseTransformFeedback;
+    PFNGLRESUMETRANSFORMFEEDBACKPROC glad_glResumeTransformFeedback;
+    PFNGLDRAWTRANSFORMFEEDBACKPROC glad_glDrawTransformFeedback;
+    PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_glDrawTransformFeedbackStream;
+    PFNGLBEGINQUERYINDEXEDPROC glad_glBeginQueryIndexed;
+    PFNGLENDQUERYINDEXEDPROC glad_glEndQueryIndexed;
+    PFNGLGETQUERYINDEXEDIVPROC glad_glGetQueryIndexediv;
+    PFNGLRELEASESHADERCOMPILERPROC glad_glReleaseShaderCompiler;
+    PFNGLSHADERBINARYPROC glad_glShaderBinary;
+    PFNGLGETSHADERPRECISIONFORMATPROC glad_glGetShaderPrecisionFormat;
+    PFNGLDEPTHRANGEFPROC glad_glDepthRangef;
+    PFNGLCLEARDEPTHFPROC glad_glClearDepthf;
+    PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary;
+    PFNGLPROGRAMBINARYPROC glad_glProgramBinary;
+    PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri;
+    PFNGLUSEPROGRAMSTAGESPROC glad_glUseProgramStages;
+    PFNGLACTIVESHADERPROGRAMPROC glad_glActiveShaderProgram;
+    PFNGLCREATESHADERPROGRAMVPROC glad_glCreateShaderProgramv;
+    PFNGLBINDPROGRAMPIPELINEPROC glad_glBindProgramPipeline;
+    PFNGLDELETEPROGRAMPIPELINESPROC glad_glDeleteProgramPipelines;
+    PFNGLGENPROGRAMPIPELINESPROC glad_glGenProgramPipelines;
+    PFNGLISPROGRAMPIPELINEPROC glad_glIsProgramPipeline;
+    PFNGLGETPROGRAMPIPELINEIVPROC glad_glGetProgramPipelineiv;
+    PFNGLPROGRAMUNIFORM1IPROC glad_glProgramUniform1i;
+    PFNGLPROGRAMUNIFORM1IVPROC glad_glProgramUniform1iv;
+    PFNGLPROGRAMUNIFORM1FPROC glad_glProgramUniform1f;
+    PFNGLPROGRAMUNIFORM1FVPROC glad_glProgramUniform1fv;
+    PFNGLPROGRAMUNIFORM1DPROC glad_glProgramUniform1d;
+    PFNGLPROGRAMUNIFORM1DVPROC glad_glProgramUniform1dv;
+    PFNGLPROGRAMUNIFORM1UIPROC glad_glProgramUniform1ui;
+    PFNGLPROGRAMUNIFORM1UIVPROC glad_glProgramUniform1uiv;
+    PFNGLPROGRAMUNIFORM2IPROC glad_glProgramUniform2i;
+    PFNGLPROGRAMUNIFORM2IVPROC glad_glProgramUniform2iv;
+    PFNGLPROGRAMUNIFORM2FPROC glad_glProgramUniform2f;
+    PFNGLPROGRAMUNIFORM2FVPROC glad_glProgramUniform2fv;
+    PFNGLPROGRAMUNIFORM2DPROC glad_glProgramUniform2d;
+    PFNGLPROGRAMUNIFORM2DVPROC glad_glProgramUniform2dv;
+    PFNGLPROGRAMUNIFORM2UIPROC glad_glProgramUniform2ui;
+    PFNGLPROGRAMUNIFORM2UIVPROC glad_glProgramUniform2uiv;
+    PFNGLPROGRAMUNIFORM3IPROC glad_glProgramUniform3i;
+    PFNGLPROGRAMUNIFORM3IVPROC glad_glProgramUniform3iv;
+    PFNGLPROGRAMUNIFORM3FPROC glad_glProgramUniform3f;
+    PFNGLPROGRAMUNIFORM3FVPROC glad_glProgramUniform3fv;
+    PFNGLPROGRAMUNIFORM3DPROC glad_glProgramUniform3d;
+    PFNGLPROGRAMUNIFORM3DVPROC glad_glProgramUniform3dv;
+    PFNGLPROGRAMUNIFORM3UIPROC glad_glProgramUniform3ui;
+    PFNGLPROGRAMUNIFORM3UIVPROC glad_glProgramUniform3uiv;
+    PFNGLPROGRAMUNIFORM4IPROC glad_glProgramUniform4i;
+    PFNGLPROGRAMUNIFORM4IVPROC glad_glProgramUniform4iv;
+    PFNGLPROGRAMUNIFORM4FPROC glad_glProgramUniform4f;
+    PFNGLPROGRAMUNIFORM4FVPROC glad_glProgramUniform4fv;
+    PFNGLPROGRAMUNIFORM4DPROC glad_glProgramUniform4d;
+    PFNGLPROGRAMUNIFORM4DVPROC glad_glProgramUniform4dv;
+    PFNGLPROGRAMUNIFORM4UIPROC glad_glProgramUniform4ui;
+    PFNGLPROGRAMUNIFORM4UIVPROC glad_glProgramUniform4uiv;
+    PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_glProgramUniformMatrix2fv;
+    PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_glProgramUniformMatrix3fv;
+    PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_glProgramUniformMatrix4fv;
+    PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_glProgramUniformMatrix2dv;
+    PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_glProgramUniformMatrix3dv;
+    PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_glProgramUniformMatrix4dv;
+    PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_glProgramUniformMatrix2x3fv;
+    PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_glProgramUniformMatrix3x2fv;
+    PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_glProgramUniformMatrix2x4fv;
+    PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_glProgramUniformMatrix4x2fv;
+    PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_glProgramUniformMatrix3x4fv;
+    PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_glProgramUniformMatrix4x3fv;
+    PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_glProgramUniformMatrix2x3dv;
+    PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_glProgramUniformMatrix3x2dv;
+    PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_glProgramUniformMatrix2x4dv;
+    PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_glProgramUniformMatrix4x2dv;
+    PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_glProgramUniformMatrix3x4dv;
+    PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_glProgramUniformMatrix4x3dv;
+    PFNGLVALIDATEPROGRAMPIPELINEPROC glad_glValidateProgramPipeline;
+    PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_glGetProgramPipelineInfoLog;
+    PFNGLVERTEXATTRIBL1DPROC glad_glVertexAttribL1d;
+    PFNGLVERTEXATTRIBL2DPROC glad_glVertexAttribL2d;
+    PFNGLVERTEXATTRIBL3DPROC glad_glVertexAttribL3d;
+    PFNGLVERTEXATTRIBL4DPROC glad_glVertexAttribL4d;
+    PFNGLVERTEXATTRIBL1DVPROC glad_glVertexAttribL1dv;
+    PFNGLVERTEXATTRIBL2DVPROC glad_glVertexAttribL2dv;
+    PFNGLVERTEXATTRIBL3DVPROC glad_glVertexAttribL3dv;
+    PFNGLVERTEXATTRIBL4DVPROC glad_glVertexAttribL4dv;
+    PFNGLVERTEXATTRIBLPOINTERPROC glad_glVertexAttribLPointer;
+    PFNGLGETVERTEXATTRIBLDVPROC glad_glGetVertexAttribLdv;
+    PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv;
+    PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf;
+    PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv;
+    PFNGLSCISSORARRAYVPROC glad_glScissorArrayv;
+    PFNGLSCISSORINDEXEDPROC glad_glScissorIndexed;
+    PFNGLSCISSORINDEXEDVPROC glad_glScissorIndexedv;
+    PFNGLDEPTHRANGEARRAYVPROC glad_glDepthRangeArrayv;
+    PFNGLDEPTHRANGEINDEXEDPROC glad_glDepthRangeIndexed;
+    PFNGLGETFLOATI_VPROC glad_glGetFloati_v;
+    PFNGLGETDOUBLEI_VPROC glad_glGetDoublei_v;
+    PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance;
+    PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_glDrawElementsInstancedBaseInstance;
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_glDrawElementsInstancedBaseVertexBaseInstance;
+    PFNGLGETINTERNALFORMATIVPROC glad_glGetInternalformativ;
+    PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_glGetActiveAtomicCounterBufferiv;
+    PFNGLBINDIMAGETEXTUREPROC glad_glBindImageTexture;
+    PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier;
+    PFNGLTEXSTORAGE1DPROC glad_glTexStorage1D;
+    PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D;
+    PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D;
+    PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_glDrawTransformFeedbackInstanced;
+    PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_glDrawTransformFeedbackStreamInstanced;
+    PFNGLCLEARBUFFERDATAPROC glad_glClearBufferData;
+    PFNGLCLEARBUFFERSUBDATAPROC glad_glClearBufferSubData;
+    PFNGLDISPATCHCOMPUTEPROC glad_glDispatchCompute;
+    PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_glDispatchComputeIndirect;
+    PFNGLCOPYIMAGESUBDATAPROC glad_glCopyImageSubData;
+    PFNGLFRAMEBUFFERPARAMETERIPROC glad_glFramebufferParameteri;
+    PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_glGetFramebufferParameteriv;
+    PFNGLGETINTERNALFORMATI64VPROC glad_glGetInternalformati64v;
+    PFNGLINVALIDATETEXSUBIMAGEPROC glad_glInvalidateTexSubImage;
+    PFNGLINVALIDATETEXIMAGEPROC glad_glInvalidateTexImage;
+    PFNGLINVALIDATEBUFFERSUBDATAPROC glad_glInvalidateBufferSubData;
+    PFNGLINVALIDATEBUFFERDATAPROC glad_glInvalidateBufferData;
+    PFNGLINVALIDATEFRAMEBUFFERPROC glad_glInvalidateFramebuffer;
+    PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_glInvalidateSubFramebuffer;
+    PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect;
+    PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect;
+    PFNGLGETPROGRAMINTERFACEIVPROC glad_glGetProgramInterfaceiv;
+    PFNGLGETPROGRAMRESOURCEINDEXPROC glad_glGetProgramResourceIndex;
+    PFNGLGETPROGRAMRESOURCENAMEPROC glad_glGetProgramResourceName;
+    PFNGLGETPROGRAMRESOURCEIVPROC glad_glGetProgramResourceiv;
+    PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_glGetProgramResourceLocation;
+    PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_glGetProgramResourceLocationIndex;
+    PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_glShaderStorageBlockBinding;
+    PFNGLTEXBUFFERRANGEPROC glad_glTexBufferRange;
+    PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_glTexStorage2DMultisample;
+    PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_glTexStorage3DMultisample;
+    PFNGLTEXTUREVIEWPROC glad_glTextureView;
+    PFNGLBINDVERTEXBUFFERPROC glad_glBindVertexBuffer;
+    PFNGLVERTEXATTRIBFORMATPROC glad_glVertexAttribFormat;
+    PFNGLVERTEXATTRIBIFORMATPROC glad_glVertexAttribIFormat;
+    PFNGLVERTEXATTRIBLFORMATPROC glad_glVertexAttribLFormat;
+    PFNGLVERTEXATTRIBBINDINGPROC glad_glVertexAttribBinding;
+    PFNGLVERTEXBINDINGDIVISORPROC glad_glVertexBindingDivisor;
+    PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl;
+    PFNGLDEBUGMESSAGEINSERTPROC glad_glDebugMessageInsert;
+    PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback;
+    PFNGLGETDEBUGMESSAGELOGPROC glad_glGetDebugMessageLog;
+    PFNGLPUSHDEBUGGROUPPROC glad_glPushDebugGroup;
+    PFNGLPOPDEBUGGROUPPROC glad_glPopDebugGroup;
+    PFNGLOBJECTLABELPROC glad_glObjectLabel;
+    PFNGLGETOBJECTLABELPROC glad_glGetObjectLabel;
+    PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel;
+    PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel;
+    PFNGLBUFFERSTORAGEPROC glad_glBufferStorage;
+    PFNGLCLEARTEXIMAGEPROC glad_glClearTexImage;
+    PFNGLCLEARTEXSUBIMAGEPROC glad_glClearTexSubImage;
+    PFNGLBINDBUFFERSBASEPROC glad_glBindBuffersBase;
+    PFNGLBINDBUFFERSRANGEPROC glad_glBindBuffersRange;
+    PFNGLBINDTEXTURESPROC glad_glBindTextures;
+    PFNGLBINDSAMPLERSPROC glad_glBindSamplers;
+    PFNGLBINDIMAGETEXTURESPROC glad_glBindImageTextures;
+    PFNGLBINDVERTEXBUFFERSPROC glad_glBindVertexBuffers;
+    PFNGLCLIPCONTROLPROC glad_glClipControl;
+    PFNGLCREATETRANSFORMFEEDBACKSPROC glad_glCreateTransformFeedbacks;
+    PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_glTransformFeedbackBufferBase;
+    PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_glTransformFeedbackBufferRange;
+    PFNGLGETTRANSFORMFEEDBACKIVPROC glad_glGetTransformFeedbackiv;
+    PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_glGetTransformFeedbacki_v;
+    PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_glGetTransformFeedbacki64_v;
+    PFNGLCREATEBUFFERSPROC glad_glCreateBuffers;
+    PFNGLNAMEDBUFFERSTORAGEPROC glad_glNamedBufferStorage;
+    PFNGLNAMEDBUFFERDATAPROC glad_glNamedBufferData;
+    PFNGLNAMEDBUFFERSUBDATAPROC glad_glNamedBufferSubData;
+    PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_glCopyNamedBufferSubData;
+    PFNGLCLEARNAMEDBUFFERDATAPROC glad_glClearNamedBufferData;
+    PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_glClearNamedBufferSubData;
+    PFNGLMAPNAMEDBUFFERPROC glad_glMapNamedBuffer;
+    PFNGLMAPNAMEDBUFFERRANGEPROC glad_glMapNamedBufferRange;
+    PFNGLUNMAPNAMEDBUFFERPROC glad_glUnmapNamedBuffer;
+    PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_glFlushMappedNamedBufferRange;
+    PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_glGetNamedBufferParameteriv;
+    PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_glGetNamedBufferParameteri64v;
+    PFNGLGETNAMEDBUFFERPOINTERVPROC glad_glGetNamedBufferPointerv;
+    PFNGLGETNAMEDBUFFERSUBDATAPROC glad_glGetNamedBufferSubData;
+    PFNGLCREATEFRAMEBUFFERSPROC glad_glCreateFramebuffers;
+    PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_glNamedFramebufferRenderbuffer;
+    PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_glNamedFramebufferParameteri;
+    PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_glNamedFramebufferTexture;
+    PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_glNamedFramebufferTextureLayer;
+    PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_glNamedFramebufferDrawBuffer;
+    PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_glNamedFramebufferDrawBuffers;
+    PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_glNamedFramebufferReadBuffer;
+    PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_glInvalidateNamedFramebufferData;
+    PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_glInvalidateNamedFramebufferSubData;
+    PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_glClearNamedFramebufferiv;
+    PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_glClearNamedFramebufferuiv;
+    PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_glClearNamedFramebufferfv;
+    PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_glClearNamedFramebufferfi;
+    PFNGLBLITNAMEDFRAMEBUFFERPROC glad_glBlitNamedFramebuffer;
+    PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_glCheckNamedFramebufferStatus;
+    PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_glGetNamedFramebufferParameteriv;
+    PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetNamedFramebufferAttachmentParameteriv;
+    PFNGLCREATERENDERBUFFERSPROC glad_glCreateRenderbuffers;
+    PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_glNamedRenderbufferStorage;
+    PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glNamedRenderbufferStorageMultisample;
+    PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_glGetNamedRenderbufferParameteriv;
+    PFNGLCREATETEXTURESPROC glad_glCreateTextures;
+    PFNGLTEXTUREBUFFERPROC glad_glTextureBuffer;
+    PFNGLTEXTUREBUFFERRANGEPROC glad_glTextureBufferRange;
+    PFNGLTEXTURESTORAGE1DPROC glad_glTextureStorage1D;
+    PFNGLTEXTURESTORAGE2DPROC glad_glTextureStorage2D;
+    PFNGLTEXTURESTORAGE3DPROC glad_glTextureStorage3D;
+    PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_glTextureStorage2DMultisample;
+    PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_glTextureStorage3DMultisample;
+    PFNGLTEXTURESUBIMAGE1DPROC glad_glTextureSubImage1D;
+    PFNGLTEXTURESUBIMAGE2DPROC glad_glTextureSubImage2D;
+    PFNGLTEXTURESUBIMAGE3DPROC glad_glTextureSubImage3D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_glCompressedTextureSubImage1D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_glCompressedTextureSubImage2D;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_glCompressedTextureSubImage3D;
+    PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_glCopyTextureSubImage1D;
+    PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_glCopyTextureSubImage2D;
+    PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_glCopyTextureSubImage3D;
+    PFNGLTEXTUREPARAMETERFPROC glad_glTextureParameterf;
+    PFNGLTEXTUREPARAMETERFVPROC glad_glTextureParameterfv;
+    PFNGLTEXTUREPARAMETERIPROC glad_glTextureParameteri;
+    PFNGLTEXTUREPARAMETERIIVPROC glad_glTextureParameterIiv;
+    PFNGLTEXTUREPARAMETERIUIVPROC glad_glTextureParameterIuiv;
+    PFNGLTEXTUREPARAMETERIVPROC glad_glTextureParameteriv;
+    PFNGLGENERATETEXTUREMIPMAPPROC glad_glGenerateTextureMipmap;
+    PFNGLBINDTEXTUREUNITPROC glad_glBindTextureUnit;
+    PFNGLGETTEXTUREIMAGEPROC glad_glGetTextureImage;
+    PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_glGetCompressedTextureImage;
+    PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_glGetTextureLevelParameterfv;
+    PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_glGetTextureLevelParameteriv;
+    PFNGLGETTEXTUREPARAMETERFVPROC glad_glGetTextureParameterfv;
+    PFNGLGETTEXTUREPARAMETERIIVPROC glad_glGetTextureParameterIiv;
+    PFNGLGETTEXTUREPARAMETERIUIVPROC glad_glGetTextureParameterIuiv;
+    PFNGLGETTEXTUREPARAMETERIVPROC glad_glGetTextureParameteriv;
+    PFNGLCREATEVERTEXARRAYSPROC glad_glCreateVertexArrays;
+    PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_glDisableVertexArrayAttrib;
+    PFNGLENABLEVERTEXARRAYATTRIBPROC glad_glEnableVertexArrayAttrib;
+    PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_glVertexArrayElementBuffer;
+    PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_glVertexArrayVertexBuffer;
+    PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_glVertexArrayVertexBuffers;
+    PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_glVertexArrayAttribBinding;
+    PFNGLVERTEXARRAYATTRIBFORMATPROC glad_glVertexArrayAttribFormat;
+    PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_glVertexArrayAttribIFormat;
+    PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_glVertexArrayAttribLFormat;
+    PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_glVertexArrayBindingDivisor;
+    PFNGLGETVERTEXARRAYIVPROC glad_glGetVertexArrayiv;
+    PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_glGetVertexArrayIndexediv;
+    PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_glGetVertexArrayIndexed64iv;
+    PFNGLCREATESAMPLERSPROC glad_glCreateSamplers;
+    PFNGLCREATEPROGRAMPIPELINESPROC glad_glCreateProgramPipelines;
+    PFNGLCREATEQUERIESPROC glad_glCreateQueries;
+    PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_glGetQueryBufferObjecti64v;
+    PFNGLGETQUERYBUFFEROBJECTIVPROC glad_glGetQueryBufferObjectiv;
+    PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_glGetQueryBufferObjectui64v;
+    PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_glGetQueryBufferObjectuiv;
+    PFNGLMEMORYBARRIERBYREGIONPROC glad_glMemoryBarrierByRegion;
+    PFNGLGETTEXTURESUBIMAGEPROC glad_glGetTextureSubImage;
+    PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_glGetCompressedTextureSubImage;
+    PFNGLGETGRAPHICSRESETSTATUSPROC glad_glGetGraphicsResetStatus;
+    PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_glGetnCompressedTexImage;
+    PFNGLGETNTEXIMAGEPROC glad_glGetnTexImage;
+    PFNGLGETNUNIFORMDVPROC glad_glGetnUniformdv;
+    PFNGLGETNUNIFORMFVPROC glad_glGetnUniformfv;
+    PFNGLGETNUNIFORMIVPROC glad_glGetnUniformiv;
+    PFNGLGETNUNIFORMUIVPROC glad_glGetnUniformuiv;
+    PFNGLREADNPIXELSPROC glad_glReadnPixels;
+#ifndef GLAD_CORE_PROFILE
+    PFNGLGETNMAPDVPROC glad_glGetnMapdv;
+    PFNGLGETNMAPFVPROC glad_glGetnMapfv;
+    PFNGLGETNMAPIVPROC glad_glGetnMapiv;
+    PFNGLGETNPIXELMAPFVPROC glad_glGetnPixelMapfv;
+    PFNGLGETNPIXELMAPUIVPROC glad_glGetnPixelMapuiv;
+    PFNGLGETNPIXELMAPUSVPROC glad_glGetnPixelMapusv;
+    PFNGLGETNPOLYGONSTIPPLEPROC glad_glGetnPolygonStipple;
+    PFNGLGETNCOLORTABLEPROC glad_glGetnColorTable;
+    PFNGLGETNCONVOLUTIONFILTERPROC glad_glGetnConvolutionFilter;
+    PFNGLGETNSEPARABLEFILTERPROC glad_glGetnSeparableFilter;
+    PFNGLGETNHISTOGRAMPROC glad_glGetnHistogram;
+    PFNGLGETNMINMAXPROC glad_glGetnMinmax;
+#endif
+    PFNGLTEXTUREBARRIERPROC glad_glTextureBarrier;
+#ifndef GLAD_CORE_PROFILE
+    PFNGLTBUFFERMASK3DFXPROC glad_glTbufferMask3DFX;
+    PFNGLDEBUGMESSAGEENABLEAMDPROC glad_glDebugMessageEnableAMD;
+    PFNGLDEBUGMESSAGEINSERTAMDPROC glad_glDebugMessageInsertAMD;
+    PFNGLDEBUGMESSAGECALLBACKAMDPROC glad_glDebugMessageCallbackAMD;
+    PFNGLGETDEBUGMESSAGELOGAMDPROC glad_glGetDebugMessageLogAMD;
+    PFNGLBLENDFUNCINDEXEDAMDPROC glad_glBlendFuncIndexedAMD;
+    PFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC glad_glBlendFuncSeparateIndexedAMD;
+    PFNGLBLENDEQUATIONINDEXEDAMDPROC glad_glBlendEquationIndexedAMD;
+    PFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC glad_glBlendEquationSeparateIndexedAMD;
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC glad_glRenderbufferStorageMultisampleAdvancedAMD;
+    PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC glad_glNamedRenderbufferStorageMultisampleAdvancedAMD;
+    PFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC glad_glFramebufferSamplePositionsfvAMD;
+    PFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC glad_glNamedFramebufferSamplePositionsfvAMD;
+    PFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC glad_glGetFramebufferParameterfvAMD;
+    PFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC glad_glGetNamedFramebufferParameterfvAMD;
+    PFNGLUNIFORM1I64NVPROC glad_glUniform1i64NV;
+    PFNGLUNIFORM2I64NVPROC glad_glUniform2i64NV;
+    PFNGLUNIFORM3I64NVPROC glad_glUniform3i64NV;
+    PFNGLUNIFORM4I64NVPROC glad_glUniform4i64NV;
+    PFNGLUNIFORM1I64VNVPROC glad_glUniform1i64vNV;
+    PFNGLUNIFORM2I64VNVPROC glad_glUniform2i64vNV;
+    PFNGLUNIFORM3I64VNVPROC glad_glUniform3i64vNV;
+    PFNGLUNIFORM4I64VNVPROC glad_glUniform4i64vNV;
+    PFNGLUNIFORM1UI64NVPROC glad_glUniform1ui64NV;
+    PFNGLUNIFORM2UI64NVPROC glad_glUniform2ui64NV;
+    PFNGLUNIFORM3UI64NVPROC glad_glUniform3ui64NV;
+    PFNGLUNIFORM4UI64NVPROC glad_glUniform4ui64NV;
+    PFNGLUNIFORM1UI64VNVPROC glad_glUniform1ui64vNV;
+    PFNGLUNIFORM2UI64VNVPROC glad_glUniform2ui64vNV;
+    PFNGLUNIFORM3UI64VNVPROC glad_glUniform3ui64vNV;
+    PFNGLUNIFORM4UI64VNVPROC glad_glUniform4ui64vNV;
+    PFNGLGETUNIFORMI64VNVPROC glad_glGetUniformi64vNV;
+    PFNGLGETUNIFORMUI64VNVPROC glad_glGetUniformui64vNV;
+    PFNGLPROGRAMUNIFORM1I64NVPROC glad_glProgramUniform1i64NV;
+    PFNGLPROGRAMUNIFORM2I64NVPROC glad_glProgramUniform2i64NV;
+    PFNGLPROGRAMUNIFORM3I64NVPROC glad_glProgramUniform3i64NV;
+    PFNGLPROGRAMUNIFORM4I64NVPROC glad_glProgramUniform4i64NV;
+    PFNGLPROGRAMUNIFORM1I64VNVPROC glad_glProgramUniform1i64vNV;
+    PFNGLPROGRAMUNIFORM2I64VNVPROC glad_glProgramUniform2i64vNV;
+    PFNGLPROGRAMUNIFORM3I64VNVPROC glad_glProgramUniform3i64vNV;
+    PFNGLPROGRAMUNIFORM4I64VNVPROC glad_glProgramUniform4i64vNV;
+    PFNGLPROGRAMUNIFORM1UI64NVPROC glad_glProgramUniform1ui64NV;
+    PFNGLPROGRAMUNIFORM2UI64NVPROC glad_glProgramUniform2ui64NV;
+    PFNGLPROGRAMUNIFORM3UI64NVPROC glad_glProgramUniform3ui64NV;
+    PFNGLPROGRAMUNIFORM4UI64NVPROC glad_glProgramUniform4ui64NV;
+    PFNGLPROGRAMUNIFORM1UI64VNVPROC glad_glProgramUniform1ui64vNV;
+    PFNGLPROGRAMUNIFORM2UI64VNVPROC glad_glProgramUniform2ui64vNV;
+    PFNGLPROGRAMUNIFORM3UI64VNVPROC glad_glProgramUniform3ui64vNV;
+    PFNGLPROGRAMUNIFORM4UI64VNVPROC glad_glProgramUniform4ui64vNV;
+    PFNGLVERTEXATTRIBPARAMETERIAMDPROC glad_glVertexAttribParameteriAMD;
+    PFNGLMULTIDRAWARRAYSINDIRECTAMDPROC glad_glMultiDrawArraysIndirectAMD;
+    PFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC glad_glMultiDrawElementsIndirectAMD;
+    PFNGLGENNAMESAMDPROC glad_glGenNamesAMD;
+    PFNGLDELETENAMESAMDPROC glad_glDeleteNamesAMD;
+    PFNGLISNAMEAMDPROC glad_glIsNameAMD;
+    PFNGLQUERYOBJECTPARAMETERUIAMDPROC glad_glQueryObjectParameteruiAMD;
+    PFNGLGETPERFMONITORGROUPSAMDPROC glad_glGetPerfMonitorGroupsAMD;
+    PFNGLGETPERFMONITORCOUNTERSAMDPROC glad_glGetPerfMonitorCountersAMD;
+    PFNGLGETPERFMONITORGROUPSTRINGAMDPROC glad_glGetPerfMonitorGroupStringAMD;
+    PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC glad_glGetPerfMonitorCounterStringAMD;
+    PFNGLGETPERFMONITORCOUNTERINFOAMDPROC glad_glGetPerfMonitorCounterInfoAMD;
+    PFNGLGENPERFMONITORSAMDPROC glad_glGenPerfMonitorsAMD;
+    PFNGLDELETEPERFMONITORSAMDPROC glad_glDeletePerfMonitorsAMD;
+    PFNGLSELECTPERFMONITORCOUNTERSAMDPROC glad_glSelectPerfMonitorCountersAMD;
+    PFNGLBEGINPERFMONITORAMDPROC glad_glBeginPerfMonitorAMD;
+    PFNGLENDPERFMONITORAMDPROC glad_glEndPerfMonitorAMD;
+    PFNGLGETPERFMONITORCOUNTERDATAAMDPROC glad_glGetPerfMonitorCounterDataAMD;
+    PFNGLSETMULTISAMPLEFVAMDPROC glad_glSetMultisamplefvAMD;
+    PFNGLTEXSTORAGESPARSEAMDPROC glad_glTexStorageSparseAMD;
+    PFNGLTEXTURESTORAGESPARSEAMDPROC glad_glTextureStorageSparseAMD;
+    PFNGLSTENCILOPVALUEAMDPROC glad_glStencilOpValueAMD;
+    PFNGLTESSELLATIONFACTORAMDPROC glad_glTessellationFactorAMD;
+    PFNGLTESSELLATIONMODEAMDPROC glad_glTessellationModeAMD;
+    PFNGLELEMENTPOINTERAPPLEPROC glad_glElementPointerAPPLE;
+    PFNGLDRAWELEMENTARRAYAPPLEPROC glad_glDrawElementArrayAPPLE;
+    PFNGLDRAWRANGEELEMENTARRAYAPPLEPROC glad_glDrawRangeElementArrayAPPLE;
+    PFNGLMULTIDRAWELEMENTARRAYAPPLEPROC glad_glMultiDrawElementArrayAPPLE;
+    PFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC glad_glMultiDrawRangeElementArrayAPPLE;
+    PFNGLGENFENCESAPPLEPROC glad_glGenFencesAPPLE;
+    PFNGLDELETEFENCESAPPLEPROC glad_glDeleteFencesAPPLE;
+    PFNGLSETFENCEAPPLEPROC glad_glSetFenceAPPLE;
+    PFNGLISFENCEAPPLEPROC glad_glIsFenceAPPLE;
+    PFNGLTESTFENCEAPPLEPROC glad_glTestFenceAPPLE;
+    PFNGLFINISHFENCEAPPLEPROC glad_glFinishFenceAPPLE;
+    PFNGLTESTOBJECTAPPLEPROC glad_glTestObjectAPPLE;
+    PFNGLFINISHOBJECTAPPLEPROC glad_glFinishObjectAPPLE;
+    PFNGLBUFFERPARAMETERIAPPLEPROC glad_glBufferParameteriAPPLE;
+    PFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC glad_glFlushMappedBufferRangeAPPLE;
+    PFNGLOBJECTPURGEABLEAPPLEPROC glad_glObjectPurgeableAPPLE;
+    PFNGLOBJECTUNPURGEABLEAPPLEPROC glad_glObjectUnpurgeableAPPLE;
+    PFNGLGETOBJECTPARAMETERIVAPPLEPROC glad_glGetObjectParameterivAPPLE;
+    PFNGLTEXTURERANGEAPPLEPROC glad_glTextureRangeAPPLE;
+    PFNGLGETTEXPARAMETERPOINTERVAPPLEPROC glad_glGetTexParameterPointervAPPLE;
+    PFNGLBINDVERTEXARRAYAPPLEPROC glad_glBindVertexArrayAPPLE;
+    PFNGLDELETEVERTEXARRAYSAPPLEPROC glad_glDeleteVertexArraysAPPLE;
+    PFNGLGENVERTEXARRAYSAPPLEPROC glad_glGenVertexArraysAPPLE;
+    PFNGLISVERTEXARRAYAPPLEPROC glad_glIsVertexArrayAPPLE;
+    PFNGLVERTEXARRAYRANGEAPPLEPROC glad_glVertexArrayRangeAPPLE;
+    PFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC glad_glFlushVertexArrayRangeAPPLE;
+    PFNGLVERTEXARRAYPARAMETERIAPPLEPROC glad_glVertexArrayParameteriAPPLE;
+    PFNGLENABLEVERTEXATTRIBAPPLEPROC glad_glEnableVertexAttribAPPLE;
+    PFNGLDISABLEVERTEXATTRIBAPPLEPROC glad_glDisableVertexAttribAPPLE;
+    PFNGLISVERTEXATTRIBENABLEDAPPLEPROC glad_glIsVertexAttribEnabledAPPLE;
+    PFNGLMAPVERTEXATTRIB1DAPPLEPROC glad_glMapVertexAttrib1dAPPLE;
+    PFNGLMAPVERTEXATTRIB1FAPPLEPROC glad_glMapVertexAttrib1fAPPLE;
+    PFNGLMAPVERTEXATTRIB2DAPPLEPROC glad_glMapVertexAttrib2dAPPLE;
+    PFNGLMAPVERTEXATTRIB2FAPPLEPROC glad_glMapVertexAttrib2fAPPLE;
+    PFNGLPRIMITIVEBOUNDINGBOXARBPROC glad_glPrimitiveBoundingBoxARB;
+#endif
+    PFNGLGETTEXTUREHANDLEARBPROC glad_glGetTextureHandleARB;
+    PFNGLGETTEXTURESAMPLERHANDLEARBPROC glad_glGetTextureSamplerHandleARB;
+    PFNGLMAKETEXTUREHANDLERESIDENTARBPROC glad_glMakeTextureHandleResidentARB;
+    PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC glad_glMakeTextureHandleNonResidentARB;
+    PFNGLGETIMAGEHANDLEARBPROC glad_glGetImageHandleARB;
+    PFNGLMAKEIMAGEHANDLERESIDENTARBPROC glad_glMakeImageHandleResidentARB;
+    PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC glad_glMakeImageHandleNonResidentARB;
+    PFNGLUNIFORMHANDLEUI64ARBPROC glad_glUniformHandleui64ARB;
+    PFNGLUNIFORMHANDLEUI64VARBPROC glad_glUniformHandleui64vARB;
+    PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC glad_glProgramUniformHandleui64ARB;
+    PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC glad_glProgramUniformHandleui64vARB;
+    PFNGLISTEXTUREHANDLERESIDENTARBPROC glad_glIsTextureHandleResidentARB;
+    PFNGLISIMAGEHANDLERESIDENTARBPROC glad_glIsImageHandleResidentARB;
+    PFNGLVERTEXATTRIBL1UI64ARBPROC glad_glVertexAttribL1ui64ARB;
+    PFNGLVERTEXATTRIBL1UI64VARBPROC glad_glVertexAttribL1ui64vARB;
+    PFNGLGETVERTEXATTRIBLUI64VARBPROC glad_glGetVertexAttribLui64vARB;
+#ifndef GLAD_CORE_PROFILE
+    PFNGLCREATESYNCFROMCLEVENTARBPROC glad_glCreateSyncFromCLeventARB;
+    PFNGLCLAMPCOLORARBPROC glad_glClampColorARB;
+    PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC glad_glDispatchComputeGroupSizeARB;
+    PFNGLDEBUGMESSAGECONTROLARBPROC glad_glDebugMessageControlARB;
+    PFNGLDEBUGMESSAGEINSERTARBPROC glad_glDebugMessageInsertARB;
+    PFNGLDEBUGMESSAGECALLBACKARBPROC glad_glDebugMessageCallbackARB;
+    PFNGLGETDEBUGMESSAGELOGARBPROC glad_glGetDebugMessageLogARB;
+    PFNGLDRAWBUFFERSARBPROC glad_glDrawBuffersARB;
+    PFNGLBLENDEQUATIONIARBPROC glad_glBlendEquationiARB;
+    PFNGLBLENDEQUATIONSEPARATEIARBPROC glad_glBlendEquationSeparateiARB;
+    PFNGLBLENDFUNCIARBPROC glad_glBlendFunciARB;
+    PFNGLBLENDFUNCSEPARATEIARBPROC glad_glBlendFuncSeparateiARB;
+    PFNGLDRAWARRAYSINSTANCEDARBPROC glad_glDrawArraysInstancedARB;
+    PFNGLDRAWELEMENTSINSTANCEDARBPROC glad_glDrawElementsInstancedARB;
+    PFNGLPROGRAMSTRINGARBPROC glad_glProgramStringARB;
+    PFNGLBINDPROGRAMARBPROC glad_glBindProgramARB;
+    PFNGLDELETEPROGRAMSARBPROC glad_glDeleteProgramsARB;
+    PFNGLGENPROGRAMSARBPROC glad_glGenProgramsARB;
+    PFNGLPROGRAMENVPARAMETER4DARBPROC glad_glProgramEnvParameter4dARB;
+    PFNGLPROGRAMENVPARAMETER4DVARBPROC glad_glProgramEnvParameter4dvARB;
+    PFNGLPROGRAMENVPARAMETER4FARBPROC glad_glProgramEnvParameter4fARB;
+    PFNGLPROGRAMENVPARAMETER4FVARBPROC glad_glProgramEnvParameter4fvARB;
+    PFNGLPROGRAMLOCALPARAMETER4DARBPROC glad_glProgramLocalParameter4dARB;
+    PFNGLPROGRAMLOCALPARAMETER4DVARBPROC glad_glProgramLocalParameter4dvARB;
+    PFNGLPROGRAMLOCALPARAMETER4FARBPROC glad_glProgramLocalParameter4fARB;
+    PFNGLPROGRAMLOCALPARAMETER4FVARBPROC glad_glProgramLocalParameter4fvARB;
+    PFNGLGETPROGRAMENVPARAMETERDVARBPROC glad_glGetProgramEnvParameterdvARB;
+    PFNGLGETPROGRAMENVPARAMETERFVARBPROC glad_glGetProgramEnvParameterfvARB;
+    PFNGLGETPROGRAMLOCALPARAMETERDVARBPROC glad_glGetProgramLocalParameterdvARB;
+    PFNGLGETPROGRAMLOCALPARAMETERFVARBPROC glad_glGetProgramLocalParameterfvARB;
+    PFNGLGETPROGRAMIVARBPROC glad_glGetProgramivARB;
+    PFNGLGETPROGRAMSTRINGARBPROC glad_glGetProgramStringARB;
+    PFNGLISPROGRAMARBPROC glad_glIsProgramARB;
+    PFNGLPROGRAMPARAMETERIARBPROC glad_glProgramParameteriARB;
+    PFNGLFRAMEBUFFERTEXTUREARBPROC glad_glFramebufferTextureARB;
+    PFNGLFRAMEBUFFERTEXTURELAYERARBPROC glad_glFramebufferTextureLayerARB;
+    PFNGLFRAMEBUFFERTEXTUREFACEARBPROC glad_glFramebufferTextureFaceARB;
+#endif
+    PFNGLSPECIALIZESHADERARBPROC glad_glSpecializeShaderARB;
+#ifndef GLAD_CORE_PROFILE
+    PFNGLUNIFORM1I64ARBPROC glad_glUniform1i64ARB;
+    PFNGLUNIFORM2I64ARBPROC glad_glUniform2i64ARB;
+    PFNGLUNIFORM3I64ARBPROC glad_glUniform3i64ARB;
+    PFNGLUNIFORM4I64ARBPROC glad_glUniform4i64ARB;
+    PFNGLUNIFORM1I64VARBPROC glad_glUniform1i64vARB;
+    PFNGLUNIFORM2I64VARBPROC glad_glUniform2i64vARB;
+    PFNGLUNIFORM3I64VARBPROC glad_glUniform3i64vARB;
+    PFNGLUNIFORM4I64VARBPROC glad_glUniform4i64vARB;
+    PFNGLUNIFORM1UI64ARBPROC glad_glUniform1ui64ARB;
+    PFNGLUNIFORM2UI64ARBPROC glad_glUniform2ui64ARB;
+    PFNGLUNIFORM3UI64ARBPROC glad_glUniform3ui64ARB;
+    PFNGLUNIFORM4UI64ARBPROC glad_glUniform4ui64ARB;
+    PFNGLUNIFORM1UI64VARBPROC glad_glUniform1ui64vARB;
+    PFNGLUNIFORM2UI64VARBPROC glad_glUniform2ui64vARB;
+    PFNGLUNIFORM3UI64VARBPROC glad_glUniform3ui64vARB;
+    PFNGLUNIFORM4UI64VARBPROC glad_glUniform4ui64vARB;
+    PFNGLGETUNIFORMI64VARBPROC glad_glGetUniformi64vARB;
+    PFNGLGETUNIFORMUI64VARBPROC glad_glGetUniformui64vARB;
+    PFNGLGETNUNIFORMI64VARBPROC glad_glGetnUniformi64vARB;
+    PFNGLGETNUNIFORMUI64VARBPROC glad_glGetnUniformui64vARB;
+    PFNGLPROGRAMUNIFORM1I64ARBPROC glad_glProgramUniform1i64ARB;
+    PFNGLPROGRAMUNIFORM2I64ARBPROC glad_glProgramUniform2i64ARB;
+    PFNGLPROGRAMUNIFORM3I64ARBPROC glad_glProgramUniform3i64ARB;
+    PFNGLPROGRAMUNIFORM4I64ARBPROC glad_glProgramUniform4i64ARB;
+    PFNGLPROGRAMUNIFORM1I64VARBPROC glad_glProgramUniform1i64vARB;
+    PFNGLPROGRAMUNIFORM2I64VARBPROC glad_glProgramUniform2i64vARB;
+    PFNGLPROGRAMUNIFORM3I64VARBPROC glad_glProgramUniform3i64vARB;
+    PFNGLPROGRAMUNIFORM4I64VARBPROC glad_glProgramUniform4i64vARB;
+    PFNGLPROGRAMUNIFORM1UI64ARBPROC glad_glProgramUniform1ui64ARB;
+    PFNGLPROGRAMUNIFORM2UI64ARBPROC glad_glProgramUniform2ui64ARB;
+    PFNGLPROGRAMUNIFORM3UI64ARBPROC glad_glProgramUniform3ui64ARB;
+    PFNGLPROGRAMUNIFORM4UI64ARBPROC glad_glProgramUniform4ui64ARB;
+    PFNGLPROGRAMUNIFORM1UI64VARBPROC glad_glProgramUniform1ui64vARB;
+    PFNGLPROGRAMUNIFORM2UI64VARBPROC glad_glProgramUniform2ui64vARB;
+    PFNGLPROGRAMUNIFORM3UI64VARBPROC glad_glProgramUniform3ui64vARB;
+    PFNGLPROGRAMUNIFORM4UI64VARBPROC glad_glProgramUniform4ui64vARB;
+    PFNGLCOLORTABLEPROC glad_glColorTable;
+    PFNGLCOLORTABLEPARAMETERFVPROC glad_glColorTableParameterfv;
+    PFNGLCOLORTABLEPARAMETERIVPROC glad_glColorTableParameteriv;
+    PFNGLCOPYCOLORTABLEPROC glad_glCopyColorTable;
+    PFNGLGETCOLORTABLEPROC glad_glGetColorTable;
+    PFNGLGETCOLORTABLEPARAMETERFVPROC glad_glGetColorTableParameterfv;
+    PFNGLGETCOLORTABLEPARAMETERIVPROC glad_glGetColorTableParameteriv;
+    PFNGLCOLORSUBTABLEPROC glad_glColorSubTable;
+    PFNGLCOPYCOLORSUBTABLEPROC glad_glCopyColorSubTable;
+    PFNGLCONVOLUTIONFILTER1DPROC glad_glConvolutionFilter1D;
+    PFNGLCONVOLUTIONFILTER2DPROC glad_glConvolutionFilter2D;
+    PFNGLCONVOLUTIONPARAMETERFPROC glad_glConvolutionParameterf;
+    PFNGLCONVOLUTIONPARAMETERFVPROC glad_glConvolutionParameterfv;
+    PFNGLCONVOLUTIONPARAMETERIPROC glad_glConvolutionParameteri;
+    PFNGLCONVOLUTIONPARAMETERIVPROC glad_glConvolutionParameteriv;
+    PFNGLCOPYCONVOLUTIONFILTER1DPROC glad_glCopyConvolutionFilter1D;
+    PFNGLCOPYCONVOLUTIONFILTER2DPROC glad_glCopyConvolutionFilter2D;
+    PFNGLGETCONVOLUTIONFILTERPROC glad_glGetConvolutionFilter;
+    PFNGLGETCONVOLUTIONPARAMETERFVPROC glad_glGetConvolutionParameterfv;
+    PFNGLGETCONVOLUTIONPARAMETERIVPROC glad_glGetConvolutionParameteriv;
+    PFNGLGETSEPARABLEFILTERPROC glad_glGetSeparableFilter;
+    PFNGLSEPARABLEFILTER2DPROC glad_glSeparableFilter2D;
+    PFNGLGETHISTOGRAMPROC glad_glGetHistogram;
+    PFNGLGETHISTOGRAMPARAMETERFVPROC glad_glGetHistogramParameterfv;
+    PFNGLGETHISTOGRAMPARAMETERIVPROC glad_glGetHistogramParameteriv;
+    PFNGLGETMINMAXPROC glad_glGetMinmax;
+    PFNGLGETMINMAXPARAMETERFVPROC glad_glGetMinmaxParameterfv;
+    PFNGLGETMINMAXPARAMETERIVPROC glad_glGetMinmaxParameteriv;
+    PFNGLHISTOGRAMPROC glad_glHistogram;
+    PFNGLMINMAXPROC glad_glMinmax;
+    PFNGLRESETHISTOGRAMPROC glad_glResetHistogram;
+    PFNGLRESETMINMAXPROC glad_glResetMinmax;
+#endif
+    PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC glad_glMultiDrawArraysIndirectCountARB;
+    PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC glad_glMultiDrawElementsIndirectCountARB;
+#ifndef GLAD_CORE_PROFILE
+    PFNGLVERTEXATTRIBDIVISORARBPROC glad_glVertexAttribDivisorARB;
+    PFNGLCURRENTPALETTEMATRIXARBPROC glad_glCurrentPaletteMatrixARB;
+    PFNGLMATRIXINDEXUBVARBPROC glad_glMatrixIndexubvARB;
+    PFNGLMATRIXINDEXUSVARBPROC glad_glMatrixIndexusvARB;
+    PFNGLMATRIXINDEXUIVARBPROC glad_glMatrixIndexuivARB;
+    PFNGLMATRIXINDEXPOINTERARBPROC glad_glMatrixIndexPointerARB;
+    PFNGLSAMPLECOVERAGEARBPROC glad_glSampleCoverageARB;
+    PFNGLACTIVETEXTUREARBPROC glad_glActiveTextureARB;
+    PFNGLCLIENTACTIVETEXTUREARBPROC glad_glClientActiveTextureARB;
+    PFNGLMULTITEXCOORD1DARBPROC glad_glMultiTexCoord1dARB;
+    PFNGLMULTITEXCOORD1DVARBPROC glad_glMultiTexCoord1dvARB;
+    PFNGLMULTITEXCOORD1FARBPROC glad_glMultiTexCoord1fARB;
+    PFNGLMULTITEXCOORD1FVARBPROC glad_glMultiTexCoord1fvARB;
+    PFNGLMULTITEXCOORD1IARBPROC glad_glMultiTexCoord1iARB;
+    PFNGLMULTITEXCOORD1IVARBPROC glad_glMultiTexCoord1ivARB;
+    PFNGLMULTITEXCOORD1SARBPROC glad_glMultiTexCoord1sARB;
+    PFNGLMULTITEXCOORD1SVARBPROC glad_glMultiTexCoord1svARB;
+    PFNGLMULTITEXCOORD2DARBPROC glad_glMultiTexCoord2dARB;
+    PFNGLMULTITEXCOORD2DVARBPROC glad_glMultiTexCoord2dvARB;
+    PFNGLMULTITEXCOORD2FARBPROC glad_glMultiTexCoord2fARB;
+    PFNGLMULTITEXCOORD2FVARBPROC glad_glMultiTexCoord2fvARB;
+    PFNGLMULTITEXCOORD2IARBPROC glad_glMultiTexCoord2iARB;
+    PFNGLMULTITEXCOORD2IVARBPROC glad_glMultiTexCoord2ivARB;
+    PFNGLMULTITEXCOORD2SARBPROC glad_glMultiTexCoord2sARB;
+    PFNGLMULTITEXCOORD2SVARBPROC glad_glMultiTexCoord2svARB;
+    PFNGLMULTITEXCOORD3DARBPROC glad_glMultiTexCoord3dARB;
+    PFNGLMULTITEXCOORD3DVARBPROC glad_glMultiTexCoord3dvARB;
+    PFNGLMULTITEXCOORD3FARBPROC glad_glMultiTexCoord3fARB;
+    PFNGLMULTITEXCOORD3FVARBPROC glad_glMultiTexCoord3fvARB;
+    PFNGLMULTITEXCOORD3IARBPROC glad_glMultiTexCoord3iARB;
+    PFNGLMULTITEXCOORD3IVARBPROC glad_glMultiTexCoord3ivARB;
+    PFNGLMULTITEXCOORD3SARBPROC glad_glMultiTexCoord3sARB;
+    PFNGLMULTITEXCOORD3SVARBPROC glad_glMultiTexCoord3svARB;
+    PFNGLMULTITEXCOORD4DARBPROC glad_glMultiTexCoord4dARB;
+    PFNGLMULTITEXCOORD4DVARBPROC glad_glMultiTexCoord4dvARB;
+    PFNGLMULTITEXCOORD4FARBPROC glad_glMultiTexCoord4fARB;
+    PFNGLMULTITEXCOORD4FVARBPROC glad_glMultiTexCoord4fvARB;
+    PFNGLMULTITEXCOORD4IARBPROC glad_glMultiTexCoord4iARB;
+    PFNGLMULTITEXCOORD4IVARBPROC glad_glMultiTexCoord4ivARB;
+    PFNGLMULTITEXCOORD4SARBPROC glad_glMultiTexCoord4sARB;
+    PFNGLMULTITEXCOORD4SVARBPROC glad_glMultiTexCoord4svARB;
+    PFNGLGENQUERIESARBPROC glad_glGenQueriesARB;
+    PFNGLDELETEQUERIESARBPROC glad_glDeleteQueriesARB;
+    PFNGLISQUERYARBPROC glad_glIsQueryARB;
+    PFNGLBEGINQUERYARBPROC glad_glBeginQueryARB;
+    PFNGLENDQUERYARBPROC glad_glEndQueryARB;
+    PFNGLGETQUERYIVARBPROC glad_glGetQueryivARB;
+    PFNGLGETQUERYOBJECTIVARBPROC glad_glGetQueryObjectivARB;
+    PFNGLGETQUERYOBJECTUIVARBPROC glad_glGetQueryObjectuivARB;
+#endif
+    PFNGLMAXSHADERCOMPILERTHREADSARBPROC glad_glMaxShaderCompilerThreadsARB;
+#ifndef GLAD_CORE_PROFILE
+    PFNGLPOINTPARAMETERFARBPROC glad_glPointParameterfARB;
+    PFNGLPOINTPARAMETERFVARBPROC glad_glPointParameterfvARB;
+#endif
+    PFNGLPOLYGONOFFSETCLAMPPROC glad_glPolygonOffsetClamp;
+#ifndef GLAD_CORE_PROFILE
+    PFNGLGETGRAPHICSRESETSTATUSARBPROC glad_glGetGraphicsResetStatusARB;
+    PFNGLGETNTEXIMAGEARBPROC glad_glGetnTexImageARB;
+    PFNGLREADNPIXELSARBPROC glad_glReadnPixelsARB;
+    PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC glad_glGetnCompressedTexImageARB;
+    PFNGLGETNUNIFORMFVARBPROC glad_glGetnUniformfvARB;
+    PFNGLGETNUNIFORMIVARBPROC glad_glGetnUniformivARB;
+    PFNGLGETNUNIFORMUIVARBPROC glad_glGetnUniformuivARB;
+    PFNGLGETNUNIFORMDVARBPROC glad_glGetnUniformdvARB;
+    PFNGLGETNMAPDVARBPROC glad_glGetnMapdvARB;
+    PFNGLGETNMAPFVARBPROC glad_glGetnMapfvARB;
+    PFNGLGETNMAPIVARBPROC glad_glGetnMapivARB;
+    PFNGLGETNPIXELMAPFVARBPROC glad_glGetnPixelMapfvARB;
+    PFNGLGETNPIXELMAPUIVARBPROC glad_glGetnPixelMapuivARB;
+    PFNGLGETNPIXELMAPUSVARBPROC glad_glGetnPixelMapusvARB;
+    PFNGLGETNPOLYGONSTIPPLEARBPROC glad_glGetnPolygonStippleARB;
+    PFNGLGETNCOLORTABLEARBPROC glad_glGetnColorTableARB;
+    PFNGLGETNCONVOLUTIONFILTERARBPROC glad_glGetnConvolutionFilterARB;
+    PFNGLGETNSEPARABLEFILTERARBPROC glad_glGetnSeparableFilterARB;
+    PFNGLGETNHISTOGRAMARBPROC glad_glGetnHistogramARB;
+    PFNGLGETNMINMAXARBPROC glad_glGetnMinmaxARB;
+    PFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC glad_glFramebufferSampleLocationsfvARB;
+    PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC glad_glNamedFramebufferSampleLocationsfvARB;
+    PFNGLEVALUATEDEPTHVALUESARBPROC glad_glEvaluateDepthValuesARB;
+    PFNGLMINSAMPLESHADINGARBPROC glad_glMinSampleShadingARB;
+    PFNGLDELETEOBJECTARBPROC glad_glDeleteObjectARB;
+    PFNGLGETHANDLEARBPROC glad_glGetHandleARB;
+    PFNGLDETACHOBJECTARBPROC glad_glDetachObjectARB;
+    PFNGLCREATESHADEROBJECTARBPROC glad_glCreateShaderObjectARB;
+    PFNGLSHADERSOURCEARBPROC glad_glShaderSourceARB;
+    PFNGLCOMPILESHADERARBPROC glad_glCompileShaderARB;
+    PFNGLCREATEPROGRAMOBJECTARBPROC glad_glCreateProgramObjectARB;
+    PFNGLATTACHOBJECTARBPROC glad_glAttachObjectARB;
+    PFNGLLINKPROGRAMARBPROC glad_glLinkProgramARB;
+    PFNGLUSEPROGRAMOBJECTARBPROC glad_glUseProgramObjectARB;
+    PFNGLVALIDATEPROGRAMARBPROC glad_glValidateProgramARB;
+    PFNGLUNIFORM1FARBPROC glad_glUniform1fARB;
+    PFNGLUNIFORM2FARBPROC glad_glUniform2fARB;
+    PFNGLUNIFORM3FARBPROC glad_glUniform3fARB;
+    PFNGLUNIFORM4FARBPROC glad_glUniform4fARB;
+    PFNGLUNIFORM1IARBPROC glad_glUniform1iARB;
+    PFNGLUNIFORM2IARBPROC glad_glUniform2iARB;
+    PFNGLUNIFORM3IARBPROC glad_glUniform3iARB;
+    PFNGLUNIFORM4IARBPROC glad_glUniform4iARB;
+    PFNGLUNIFORM1FVARBPROC glad_glUniform1fvARB;
+    PFNGLUNIFORM2FVARBPROC glad_glUniform2fvARB;
+    PFNGLUNIFORM3FVARBPROC glad_glUniform3fvARB;
+    PFNGLUNIFORM4FVARBPROC glad_glUniform4fvARB;
+    PFNGLUNIFORM1IVARBPROC glad_glUniform1ivARB;
+    PFNGLUNIFORM2IVARBPROC glad_glUniform2ivARB;
+    PFNGLUNIFORM3IVARBPROC glad_glUniform3ivARB;
+    PFNGLUNIFORM4IVARBPROC glad_glUniform4ivARB;
+    PFNGLUNIFORMMATRIX2FVARBPROC glad_glUniformMatrix2fvARB;
+    PFNGLUNIFORMMATRIX3FVARBPROC glad_glUniformMatrix3fvARB;
+    PFNGLUNIFORMMATRIX4FVARBPROC glad_glUniformMatrix4fvARB;
+    PFNGLGETOBJECTPARAMETERFVARBPROC glad_glGetObjectParameterfvARB;
+    PFNGLGETOBJECTPARAMETERIVARBPROC glad_glGetObjectParameterivARB;
+    PFNGLGETINFOLOGARBPROC glad_glGetInfoLogARB;
+    PFNGLGETATTACHEDOBJECTSARBPROC glad_glGetAttachedObjectsARB;
+    PFNGLGETUNIFORMLOCATIONARBPROC glad_glGetUniformLocationARB;
+    PFNGLGETACTIVEUNIFORMARBPROC glad_glGetActiveUniformARB;
+    PFNGLGETUNIFORMFVARBPROC glad_glGetUniformfvARB;
+    PFNGLGETUNIFORMIVARBPROC glad_glGetUniformivARB;
+    PFNGLGETSHADERSOURCEARBPROC glad_glGetShaderSourceARB;
+    PFNGLNAMEDSTRINGARBPROC glad_glNamedStringARB;
+    PFNGLDELETENAMEDSTRINGARBPROC glad_glDeleteNamedStringARB;
+    PFNGLCOMPILESHADERINCLUDEARBPROC glad_glCompileShaderIncludeARB;
+    PFNGLISNAMEDSTRINGARBPROC glad_glIsNamedStringARB;
+    PFNGLGETNAMEDSTRINGARBPROC glad_glGetNamedStringARB;
+    PFNGLGETNAMEDSTRINGIVARBPROC glad_glGetNamedStringivARB;
+#endif
+    PFNGLBUFFERPAGECOMMITMENTARBPROC glad_glBufferPageCommitmentARB;
+    PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC glad_glNamedBufferPageCommitmentEXT;
+    PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC glad_glNamedBufferPageCommitmentARB;
+    PFNGLTEXPAGECOMMITMENTARBPROC glad_glTexPageCommitmentARB;
+#ifndef GLAD_CORE_PROFILE
+    PFNGLTEXBUFFERARBPROC glad_glTexBufferARB;
+    PFNGLCOMPRESSEDTEXIMAGE3DARBPROC glad_glCompressedTexImage3DARB;
+    PFNGLCOMPRESSEDTEXIMAGE2DARBPROC glad_glCompressedTexImage2DARB;
+    PFNGLCOMPRESSEDTEXIMAGE1DARBPROC glad_glCompressedTexImage1DARB;
+    PFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC glad_glCompressedTexSubImage3DARB;
+    PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC glad_glCompressedTexSubImage2DARB;
+    PFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC glad_glCompressedTexSubImage1DARB;
+    PFNGLGETCOMPRESSEDTEXIMAGEARBPROC glad_glGetCompressedTexImageARB;
+    PFNGLLOADTRANSPOSEMATRIXFARBPROC glad_glLoadTransposeMatrixfARB;
+    PFNGLLOADTRANSPOSEMATRIXDARBPROC glad_glLoadTransposeMatrixdARB;
+    PFNGLMULTTRANSPOSEMATRIXFARBPROC glad_glMultTransposeMatrixfARB;
+    PFNGLMULTTRANSPOSEMATRIXDARBPROC glad_glMultTransposeMatrixdARB;
+    PFNGLWEIGHTBVARBPROC glad_glWeightbvARB;
+    PFNGLWEIGHTSVARBPROC glad_glWeightsvARB;
+    PFNGLWEIGHTIVARBPROC glad_glWeightivARB;
+    PFNGLWEIGHTFVARBPROC glad_glWeightfvARB;
+    PFNGLWEIGHTDVARBPROC glad_glWeightdvARB;
+    PFNGLWEIGHTUBVARBPROC glad_glWeightubvARB;
+    PFNGLWEIGHTUSVARBPROC glad_glWeightusvARB;
+    PFNGLWEIGHTUIVARBPROC glad_glWeightuivARB;
+    PFNGLWEIGHTPOINTERARBPROC glad_glWeightPointerARB;
+    PFNGLVERTEXBLENDARBPROC glad_glVertexBlendARB;
+    PFNGLBINDBUFFERARBPROC glad_glBindBufferARB;
+    PFNGLDELETEBUFFERSARBPROC glad_glDeleteBuffersARB;
+    PFNGLGENBUFFERSARBPROC glad_glGenBuffersARB;
+    PFNGLISBUFFERARBPROC glad_glIsBufferARB;
+    PFNGLBUFFERDATAARBPROC glad_glBufferDataARB;
+    PFNGLBUFFERSUBDATAARBPROC glad_glBufferSubDataARB;
+    PFNGLGETBUFFERSUBDATAARBPROC glad_glGetBufferSubDataARB;
+    PFNGLMAPBUFFERARBPROC glad_glMapBufferARB;
+    PFNGLUNMAPBUFFERARBPROC glad_glUnmapBufferARB;
+    PFNGLGETBUFFERPARAMETERIVARBPROC glad_glGetBufferParameterivARB;
+    PFNGLGETBUFFERPOINTERVARBPROC glad_glGetBufferPointervARB;
+    PFNGLVERTEXATTRIB1DARBPROC glad_glVertexAttrib1dARB;
+    PFNGLVERTEXATTRIB1DVARBPROC glad_glVertexAttrib1dvARB;
+    PFNGLVERTEXATTRIB1FARBPROC glad_glVertexAttrib1fARB;
+    PFNGLVERTEXATTRIB1FVARBPROC glad_glVertexAttrib1fvARB;
+    PFNGLVERTEXATTRIB1SARBPROC glad_glVertexAttrib1sARB;
+    PFNGLVERTEXATTRIB1SVARBPROC glad_glVertexAttrib1svARB;
+    PFNGLVERTEXATTRIB2DARBPROC glad_glVertexAttrib2dARB;
+    PFNGLVERTEXATTRIB2DVARBPROC glad_glVertexAttrib2dvARB;
+    PFNGLVERTEXATTRIB2FARBPROC glad_glVertexAttrib2fARB;
+    PFNGLVERTEXATTRIB2FVARBPROC glad_glVertexAttrib2fvARB;
+    PFNGLVERTEXATTRIB2SARBPROC glad_glVertexAttrib2sARB;
+    PFNGLVERTEXATTRIB2SVARBPROC glad_glVertexAttrib2svARB;
+    PFNGLVERTEXATTRIB3DARBPROC glad_glVertexAttrib3dARB;
+    PFNGLVERTEXATTRIB3DVARBPROC glad_glVertexAttrib3dvARB;
+    PFNGLVERTEXATTRIB3FARBPROC glad_glVertexAttrib3fARB;
+    PFNGLVERTEXATTRIB3FVARBPROC glad_glVertexAttrib3fvARB;
+    PFNGLVERTEXATTRIB3SARBPROC glad_glVertexAttrib3sARB;
+    PFNGLVERTEXATTRIB3SVARBPROC glad_glVertexAttrib3svARB;
+    PFNGLVERTEXATTRIB4NBVARBPROC glad_glVertexAttrib4NbvARB;
+    PFNGLVERTEXATTRIB4NIVARBPROC glad_glVertexAttrib4NivARB;
+    PFNGLVERTEXATTRIB4NSVARBPROC glad_glVertexAttrib4NsvARB;
+    PFNGLVERTEXATTRIB4NUBARBPROC glad_glVertexAttrib4NubARB;
+    PFNGLVERTEXATTRIB4NUBVARBPROC glad_glVertexAttrib4NubvARB;
+    PFNGLVERTEXATTRIB4NUIVARBPROC glad_glVertexAttrib4NuivARB;
+    PFNGLVERTEXATTRIB4NUSVARBPROC glad_glVertexAttrib4NusvARB;
+    PFNGLVERTEXATTRIB4BVARBPROC glad_glVertexAttrib4bvARB;
+    PFNGLVERTEXATTRIB4DARBPROC glad_glVertexAttrib4dARB;
+    PFNGLVERTEXATTRIB4DVARBPROC glad_glVertexAttrib4dvARB;
+    PFNGLVERTEXATTRIB4FARBPROC glad_glVertexAttrib4fARB;
+    PFNGLVERTEXATTRIB4FVARBPROC glad_glVertexAttrib4fvARB;
+    PFNGLVERTEXATTRIB4IVARBPROC glad_glVertexAttrib4ivARB;
+    PFNGLVERTEXATTRIB4SARBPROC glad_glVertexAttrib4sARB;
+    PFNGLVERTEXATTRIB4SVARBPROC glad_glVertexAttrib4svARB;
+    PFNGLVERTEXATTRIB4UBVARBPROC glad_glVertexAttrib4ubvARB;
+    PFNGLVERTEXATTRIB4UIVARBPROC glad_glVertexAttrib4uivARB;
+    PFNGLVERTEXATTRIB4USVARBPROC glad_glVertexAttrib4usvARB;
+    PFNGLVERTEXATTRIBPOINTERARBPROC glad_glVertexAttribPointerARB;
+    PFNGLENABLEVERTEXATTRIBARRAYARBPROC glad_glEnableVertexAttribArrayARB;
+    PFNGLDISABLEVERTEXATTRIBARRAYARBPROC glad_glDisableVertexAttribArrayARB;
+    PFNGLGETVERTEXATTRIBDVARBPROC glad_glGetVertexAttribdvARB;
+    PFNGLGETVERTEXATTRIBFVARBPROC glad_glGetVertexAttribfvARB;
+    PFNGLGETVERTEXATTRIBIVARBPROC glad_glGetVertexAttribivARB;
+    PFNGLGETVERTEXATTRIBPOINTERVARBPROC glad_glGetVertexAttribPointervARB;
+    PFNGLBINDATTRIBLOCATIONARBPROC glad_glBindAttribLocationARB;
+    PFNGLGETACTIVEATTRIBARBPROC glad_glGetActiveAttribARB;
+    PFNGLGETATTRIBLOCATIONARBPROC glad_glGetAttribLocationARB;
+    PFNGLDEPTHRANGEARRAYDVNVPROC glad_glDepthRangeArraydvNV;
+    PFNGLDEPTHRANGEINDEXEDDNVPROC glad_glDepthRangeIndexeddNV;
+    PFNGLWINDOWPOS2DARBPROC glad_glWindowPos2dARB;
+    PFNGLWINDOWPOS2DVARBPROC glad_glWindowPos2dvARB;
+    PFNGLWINDOWPOS2FARBPROC glad_glWindowPos2fARB;
+    PFNGLWINDOWPOS2FVARBPROC glad_glWindowPos2fvARB;
+    PFNGLWINDOWPOS2IARBPROC glad_glWindowPos2iARB;
+    PFNGLWINDOWPOS2IVARBPROC glad_glWindowPos2ivARB;
+    PFNGLWINDOWPOS2SARBPROC glad_glWindowPos2sARB;
+    PFNGLWINDOWPOS2SVARBPROC glad_glWindowPos2svARB;
+    PFNGLWINDOWPOS3DARBPROC glad_glWindowPos3dARB;
+    PFNGLWINDOWPOS3DVARBPROC glad_glWindowPos3dvARB;
+    PFNGLWINDOWPOS3FARBPROC glad_glWindowPos3fARB;
+    PFNGLWINDOWPOS3FVARBPROC glad_glWindowPos3fvARB;
+    PFNGLWINDOWPOS3IARBPROC glad_glWindowPos3iARB;
+    PFNGLWINDOWPOS3IVARBPROC glad_glWindowPos3ivARB;
+    PFNGLWINDOWPOS3SARBPROC glad_glWindowPos3sARB;
+    PFNGLWINDOWPOS3SVARBPROC glad_glWindowPos3svARB;
+    PFNGLDRAWBUFFERSATIPROC glad_glDrawBuffersATI;
+    PFNGLELEMENTPOINTERATIPROC glad_glElementPointerATI;
+    PFNGLDRAWELEMENTARRAYATIPROC glad_glDrawElementArrayATI;
+    PFNGLDRAWRANGEELEMENTARRAYATIPROC glad_glDrawRangeElementArrayATI;
+    PFNGLTEXBUMPPARAMETERIVATIPROC glad_glTexBumpParameterivATI;
+    PFNGLTEXBUMPPARAMETERFVATIPROC glad_glTexBumpParameterfvATI;
+    PFNGLGETTEXBUMPPARAMETERIVATIPROC glad_glGetTexBumpParameterivATI;
+    PFNGLGETTEXBUMPPARAMETERFVATIPROC glad_glGetTexBumpParameterfvATI;
+    PFNGLGENFRAGMENTSHADERSATIPROC glad_glGenFragmentShadersATI;
+    PFNGLBINDFRAGMENTSHADERATIPROC glad_glBindFragmentShaderATI;
+    PFNGLDELETEFRAGMENTSHADERATIPROC glad_glDeleteFragmentShaderATI;
+    PFNGLBEGINFRAGMENTSHADERATIPROC glad_glBeginFragmentShaderATI;
+    PFNGLENDFRAGMENTSHADERATIPROC glad_glEndFragmentShaderATI;
+    PFNGLPASSTEXCOORDATIPROC glad_glPassTexCoordATI;
+    PFNGLSAMPLEMAPATIPROC glad_glSampleMapATI;
+    PFNGLCOLORFRAGMENTOP1ATIPROC glad_glColorFragmentOp1ATI;
+    PFNGLCOLORFRAGMENTOP2ATIPROC glad_glColorFragmentOp2ATI;
+    PFNGLCOLORFRAGMENTOP3ATIPROC glad_glColorFragmentOp3ATI;
+    PFNGLALPHAFRAGMENTOP1ATIPROC glad_glAlphaFragmentOp1ATI;
+    PFNGLALPHAFRAGMENTOP2ATIPROC glad_glAlphaFragmentOp2ATI;
+    PFNGLALPHAFRAGMENTOP3ATIPROC glad_glAlphaFragmentOp3ATI;
+    PFNGLSETFRAGMENTSHADERCONSTANTATIPROC glad_glSetFragmentShaderConstantATI;
+    PFNGLMAPOBJECTBUFFERATIPROC glad_glMapObjectBufferATI;
+    PFNGLUNMAPOBJECTBUFFERATIPROC glad_glUnmapObjectBufferATI;
+    PFNGLPNTRIANGLESIATIPROC glad_glPNTrianglesiATI;
+    PFNGLPNTRIANGLESFATIPROC glad_glPNTrianglesfATI;
+    PFNGLSTENCILOPSEPARATEATIPROC glad_glStencilOpSeparateATI;
+    PFNGLSTENCILFUNCSEPARATEATIPROC glad_glStencilFuncSeparateATI;
+    PFNGLNEWOBJECTBUFFERATIPROC glad_glNewObjectBufferATI;
+    PFNGLISOBJECTBUFFERATIPROC glad_glIsObjectBufferATI;
+    PFNGLUPDATEOBJECTBUFFERATIPROC glad_glUpdateObjectBufferATI;
+    PFNGLGETOBJECTBUFFERFVATIPROC glad_glGetObjectBufferfvATI;
+    PFNGLGETOBJECTBUFFERIVATIPROC glad_glGetObjectBufferivATI;
+    PFNGLFREEOBJECTBUFFERATIPROC glad_glFreeObjectBufferATI;
+    PFNGLARRAYOBJECTATIPROC glad_glArrayObjectATI;
+    PFNGLGETARRAYOBJECTFVATIPROC glad_glGetArrayObjectfvATI;
+    PFNGLGETARRAYOBJECTIVATIPROC glad_glGetArrayObjectivATI;
+    PFNGLVARIANTARRAYOBJECTATIPROC glad_glVariantArrayObjectATI;
+    PFNGLGETVARIANTARRAYOBJECTFVATIPROC glad_glGetVariantArrayObjectfvATI;
+    PFNGLGETVARIANTARRAYOBJECTIVATIPROC glad_glGetVariantArrayObjectivATI;
+    PFNGLVERTEXATTRIBARRAYOBJECTATIPROC glad_glVertexAttribArrayObjectATI;
+    PFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC glad_glGetVertexAttribArrayObjectfvATI;
+    PFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC glad_glGetVertexAttribArrayObjectivATI;
+    PFNGLVERTEXSTREAM1SATIPROC glad_glVertexStream1sATI;
+    PFNGLVERTEXSTREAM1SVATIPROC glad_glVertexStream1svATI;
+    PFNGLVERTEXSTREAM1IATIPROC glad_glVertexStream1iATI;
+    PFNGLVERTEXSTREAM1IVATIPROC glad_glVertexStream1ivATI;
+    PFNGLVERTEXSTREAM1FATIPROC glad_glVertexStream1fATI;
+    PFNGLVERTEXSTREAM1FVATIPROC glad_glVertexStream1fvATI;
+    PFNGLVERTEXSTREAM1DATIPROC glad_glVertexStream1dATI;
+    PFNGLVERTEXSTREAM1DVATIPROC glad_glVertexStream1dvATI;
+    PFNGLVERTEXSTREAM2SATIPROC glad_glVertexStream2sATI;
+    PFNGLVERTEXSTREAM2SVATIPROC glad_glVertexStream2svATI;
+    PFNGLVERTEXSTREAM2IATIPROC glad_glVertexStream2iATI;
+    PFNGLVERTEXSTREAM2IVATIPROC glad_glVertexStream2ivATI;
+    PFNGLVERTEXSTREAM2FATIPROC glad_glVertexStream2fATI;
+    PFNGLVERTEXSTREAM2FVATIPROC glad_glVertexStream2fvATI;
+    PFNGLVERTEXSTREAM2DATIPROC glad_glVertexStream2dATI;
+    PFNGLVERTEXSTREAM2DVATIPROC glad_glVertexStream2dvATI;
+    PFNGLVERTEXSTREAM3SATIPROC glad_glVertexStream3sATI;
+    PFNGLVERTEXSTREAM3SVATIPROC glad_glVertexStream3svATI;
+    PFNGLVERTEXSTREAM3IATIPROC glad_glVertexStream3iATI;
+    PFNGLVERTEXSTREAM3IVATIPROC glad_glVertexStream3ivATI;
+    PFNGLVERTEXSTREAM3FATIPROC glad_glVertexStream3fATI;
+    PFNGLVERTEXSTREAM3FVATIPROC glad_glVertexStream3fvATI;
+    PFNGLVERTEXSTREAM3DATIPROC glad_glVertexStream3dATI;
+    PFNGLVERTEXSTREAM3DVATIPROC glad_glVertexStream3dvATI;
+    PFNGLVERTEXSTREAM4SATIPROC glad_glVertexStream4sATI;
+    PFNGLVERTEXSTREAM4SVATIPROC glad_glVertexStream4svATI;
+    PFNGLVERTEXSTREAM4IATIPROC glad_glVertexStream4iATI;
+    PFNGLVERTEXSTREAM4IVATIPROC glad_glVertexStream4ivATI;
+    PFNGLVERTEXSTREAM4FATIPROC glad_glVertexStream4fATI;
+    PFNGLVERTEXSTREAM4FVATIPROC glad_glVertexStream4fvATI;
+    PFNGLVERTEXSTREAM4DATIPROC glad_glVertexStream4dATI;
+    PFNGLVERTEXSTREAM4DVATIPROC glad_glVertexStream4dvATI;
+    PFNGLNORMALSTREAM3BATIPROC glad_glNormalStream3bATI;
+    PFNGLNORMALSTREAM3BVATIPROC glad_glNormalStream3bvATI;
+    PFNGLNORMALSTREAM3SATIPROC glad_glNormalStream3sATI;
+    PFNGLNORMALSTREAM3SVATIPROC glad_glNormalStream3svATI;
+    PFNGLNORMALSTREAM3IATIPROC glad_glNormalStream3iATI;
+    PFNGLNORMALSTREAM3IVATIPROC glad_glNormalStream3ivATI;
+    PFNGLNORMALSTREAM3FATIPROC glad_glNormalStream3fATI;
+    PFNGLNORMALSTREAM3FVATIPROC glad_glNormalStream3fvATI;
+    PFNGLNORMALSTREAM3DATIPROC glad_glNormalStream3dATI;
+    PFNGLNORMALSTREAM3DVATIPROC glad_glNormalStream3dvATI;
+    PFNGLCLIENTACTIVEVERTEXSTREAMATIPROC glad_glClientActiveVertexStreamATI;
+    PFNGLVERTEXBLENDENVIATIPROC glad_glVertexBlendEnviATI;
+    PFNGLVERTEXBLENDENVFATIPROC glad_glVertexBlendEnvfATI;
+    PFNGLEGLIMAGETARGETTEXSTORAGEEXTPROC glad_glEGLImageTargetTexStorageEXT;
+    PFNGLEGLIMAGETARGETTEXTURESTORAGEEXTPROC glad_glEGLImageTargetTextureStorageEXT;
+    PFNGLUNIFORMBUFFEREXTPROC glad_glUniformBufferEXT;
+    PFNGLGETUNIFORMBUFFERSIZEEXTPROC glad_glGetUniformBufferSizeEXT;
+    PFNGLGETUNIFORMOFFSETEXTPROC glad_glGetUniformOffsetEXT;
+    PFNGLBLENDCOLOREXTPROC glad_glBlendColorEXT;
+    PFNGLBLENDEQUATIONSEPARATEEXTPROC glad_glBlendEquationSeparateEXT;
+    PFNGLBLENDFUNCSEPARATEEXTPROC glad_glBlendFuncSeparateEXT;
+    PFNGLBLENDEQUATIONEXTPROC glad_glBlendEquationEXT;
+    PFNGLCOLORSUBTABLEEXTPROC glad_glColorSubTableEXT;
+    PFNGLCOPYCOLORSUBTABLEEXTPROC glad_glCopyColorSubTableEXT;
+    PFNGLLOCKARRAYSEXTPROC glad_glLockArraysEXT;
+    PFNGLUNLOCKARRAYSEXTPROC glad_glUnlockArraysEXT;
+    PFNGLCONVOLUTIONFILTER1DEXTPROC glad_glConvolutionFilter1DEXT;
+    PFNGLCONVOLUTIONFILTER2DEXTPROC glad_glConvolutionFilter2DEXT;
+    PFNGLCONVOLUTIONPARAMETERFEXTPROC glad_glConvolutionParameterfEXT;
+    PFNGLCONVOLUTIONPARAMETERFVEXTPROC glad_glConvolutionParameterfvEXT;
+    PFNGLCONVOLUTIONPARAMETERIEXTPROC glad_glConvolutionParameteriEXT;
+    PFNGLCONVOLUTIONPARAMETERIVEXTPROC glad_glConvolutionParameterivEXT;
+    PFNGLCOPYCONVOLUTIONFILTER1DEXTPROC glad_glCopyConvolutionFilter1DEXT;
+    PFNGLCOPYCONVOLUTIONFILTER2DEXTPROC glad_glCopyConvolutionFilter2DEXT;
+    PFNGLGETCONVOLUTIONFILTEREXTPROC glad_glGetConvolutionFilterEXT;
+    PFNGLGETCONVOLUTIONPARAMETERFVEXTPROC glad_glGetConvolutionParameterfvEXT;
+    PFNGLGETCONVOLUTIONPARAMETERIVEXTPROC glad_glGetConvolutionParameterivEXT;
+    PFNGLGETSEPARABLEFILTEREXTPROC glad_glGetSeparableFilterEXT;
+    PFNGLSEPARABLEFILTER2DEXTPROC glad_glSeparableFilter2DEXT;
+    PFNGLTANGENT3BEXTPROC glad_glTangent3bEXT;
+    PFNGLTANGENT3BVEXTPROC glad_glTangent3bvEXT;
+    PFNGLTANGENT3DEXTPROC glad_glTangent3dEXT;
+    PFNGLTANGENT3DVEXTPROC glad_glTangent3dvEXT;
+    PFNGLTANGENT3FEXTPROC glad_glTangent3fEXT;
+    PFNGLTANGENT3FVEXTPROC glad_glTangent3fvEXT;
+    PFNGLTANGENT3IEXTPROC glad_glTangent3iEXT;
+    PFNGLTANGENT3IVEXTPROC glad_glTangent3ivEXT;
+    PFNGLTANGENT3SEXTPROC glad_glTangent3sEXT;
+    PFNGLTANGENT3SVEXTPROC glad_glTangent3svEXT;
+    PFNGLBINORMAL3BEXTPROC glad_glBinormal3bEXT;
+    PFNGLBINORMAL3BVEXTPROC glad_glBinormal3bvEXT;
+    PFNGLBINORMAL3DEXTPROC glad_glBinormal3dEXT;
+    PFNGLBINORMAL3DVEXTPROC glad_glBinormal3dvEXT;
+    PFNGLBINORMAL3FEXTPROC glad_glBinormal3fEXT;
+    PFNGLBINORMAL3FVEXTPROC glad_glBinormal3fvEXT;
+    PFNGLBINORMAL3IEXTPROC glad_glBinormal3iEXT;
+    PFNGLBINORMAL3IVEXTPROC glad_glBinormal3ivEXT;
+    PFNGLBINORMAL3SEXTPROC glad_glBinormal3sEXT;
+    PFNGLBINORMAL3SVEXTPROC glad_glBinormal3svEXT;
+    PFNGLTANGENTPOINTEREXTPROC glad_glTangentPointerEXT;
+    PFNGLBINORMALPOINTEREXTPROC glad_glBinormalPointerEXT;
+    PFNGLCOPYTEXIMAGE1DEXTPROC glad_glCopyTexImage1DEXT;
+    PFNGLCOPYTEXIMAGE2DEXTPROC glad_glCopyTexImage2DEXT;
+    PFNGLCOPYTEXSUBIMAGE1DEXTPROC glad_glCopyTexSubImage1DEXT;
+    PFNGLCOPYTEXSUBIMAGE2DEXTPROC glad_glCopyTexSubImage2DEXT;
+    PFNGLCOPYTEXSUBIMAGE3DEXTPROC glad_glCopyTexSubImage3DEXT;
+    PFNGLCULLPARAMETERDVEXTPROC glad_glCullParameterdvEXT;
+    PFNGLCULLPARAMETERFVEXTPROC glad_glCullParameterfvEXT;
+    PFNGLLABELOBJECTEXTPROC glad_glLabelObjectEXT;
+    PFNGLGETOBJECTLABELEXTPROC glad_glGetObjectLabelEXT;
+    PFNGLINSERTEVENTMARKEREXTPROC glad_glInsertEventMarkerEXT;
+    PFNGLPUSHGROUPMARKEREXTPROC glad_glPushGroupMarkerEXT;
+    PFNGLPOPGROUPMARKEREXTPROC glad_glPopGroupMarkerEXT;
+    PFNGLDEPTHBOUNDSEXTPROC glad_glDepthBoundsEXT;
+    PFNGLMATRIXLOADFEXTPROC glad_glMatrixLoadfEXT;
+    PFNGLMATRIXLOADDEXTPROC glad_glMatrixLoaddEXT;
+    PFNGLMATRIXMULTFEXTPROC glad_glMatrixMultfEXT;
+    PFNGLMATRIXMULTDEXTPROC glad_glMatrixMultdEXT;
+    PFNGLMATRIXLOADIDENTITYEXTPROC glad_glMatrixLoadIdentityEXT;
+    PFNGLMATRIXROTATEFEXTPROC glad_glMatrixRotatefEXT;
+    PFNGLMATRIXROTATEDEXTPROC glad_glMatrixRotatedEXT;
+    PFNGLMATRIXSCALEFEXTPROC glad_glMatrixScalefEXT;
+    PFNGLMATRIXSCALEDEXTPROC glad_glMatrixScaledEXT;
+    PFNGLMATRIXTRANSLATEFEXTPROC glad_glMatrixTranslatefEXT;
+    PFNGLMATRIXTRANSLATEDEXTPROC glad_glMatrixTranslatedEXT;
+    PFNGLMATRIXFRUSTUMEXTPROC glad_glMatrixFrustumEXT;
+    PFNGLMATRIXORTHOEXTPROC glad_glMatrixOrthoEXT;
+    PFNGLMATRIXPOPEXTPROC glad_glMatrixPopEXT;
+    PFNGLMATRIXPUSHEXTPROC glad_glMatrixPushEXT;
+    PFNGLCLIENTATTRIBDEFAULTEXTPROC glad_glClientAttribDefaultEXT;
+    PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC glad_glPushClientAttribDefaultEXT;
+    PFNGLTEXTUREPARAMETERFEXTPROC glad_glTextureParameterfEXT;
+    PFNGLTEXTUREPARAMETERFVEXTPROC glad_glTextureParameterfvEXT;
+    PFNGLTEXTUREPARAMETERIEXTPROC glad_glTextureParameteriEXT;
+    PFNGLTEXTUREPARAMETERIVEXTPROC glad_glTextureParameterivEXT;
+    PFNGLTEXTUREIMAGE1DEXTPROC glad_glTextureImage1DEXT;
+    PFNGLTEXTUREIMAGE2DEXTPROC glad_glTextureImage2DEXT;
+    PFNGLTEXTURESUBIMAGE1DEXTPROC glad_glTextureSubImage1DEXT;
+    PFNGLTEXTURESUBIMAGE2DEXTPROC glad_glTextureSubImage2DEXT;
+    PFNGLCOPYTEXTUREIMAGE1DEXTPROC glad_glCopyTextureImage1DEXT;
+    PFNGLCOPYTEXTUREIMAGE2DEXTPROC glad_glCopyTextureImage2DEXT;
+    PFNGLCOPYTEXTURESUBIMAGE1DEXTPROC glad_glCopyTextureSubImage1DEXT;
+    PFNGLCOPYTEXTURESUBIMAGE2DEXTPROC glad_glCopyTextureSubImage2DEXT;
+    PFNGLGETTEXTUREIMAGEEXTPROC glad_glGetTextureImageEXT;
+    PFNGLGETTEXTUREPARAMETERFVEXTPROC glad_glGetTextureParameterfvEXT;
+    PFNGLGETTEXTUREPARAMETERIVEXTPROC glad_glGetTextureParameterivEXT;
+    PFNGLGETTEXTURELEVELPARAMETERFVEXTPROC glad_glGetTextureLevelParameterfvEXT;
+    PFNGLGETTEXTURELEVELPARAMETERIVEXTPROC glad_glGetTextureLevelParameterivEXT;
+    PFNGLTEXTUREIMAGE3DEXTPROC glad_glTextureImage3DEXT;
+    PFNGLTEXTURESUBIMAGE3DEXTPROC glad_glTextureSubImage3DEXT;
+    PFNGLCOPYTEXTURESUBIMAGE3DEXTPROC glad_glCopyTextureSubImage3DEXT;
+    PFNGLBINDMULTITEXTUREEXTPROC glad_glBindMultiTextureEXT;
+    PFNGLMULTITEXCOORDPOINTEREXTPROC glad_glMultiTexCoordPointerEXT;
+    PFNGLMULTITEXENVFEXTPROC glad_glMultiTexEnvfEXT;
+    PFNGLMULTITEXENVFVEXTPROC glad_glMultiTexEnvfvEXT;
+    PFNGLMULTITEXENVIEXTPROC glad_glMultiTexEnviEXT;
+    PFNGLMULTITEXENVIVEXTPROC glad_glMultiTexEnvivEXT;
+    PFNGLMULTITEXGENDEXTPROC glad_glMultiTexGendEXT;
+    PFNGLMULTITEXGENDVEXTPROC glad_glMultiTexGendvEXT;
+    PFNGLMULTITEXGENFEXTPROC glad_glMultiTexGenfEXT;
+    PFNGLMULTITEXGENFVEXTPROC glad_glMultiTexGenfvEXT;
+    PFNGLMULTITEXGENIEXTPROC glad_glMultiTexGeniEXT;
+    PFNGLMULTITEXGENIVEXTPROC glad_glMultiTexGenivEXT;
+    PFNGLGETMULTITEXENVFVEXTPROC glad_glGetMultiTexEnvfvEXT;
+    PFNGLGETMULTITEXENVIVEXTPROC glad_glGetMultiTexEnvivEXT;
+    PFNGLGETMULTITEXGENDVEXTPROC glad_glGetMultiTexGendvEXT;
+    PFNGLGETMULTITEXGENFVEXTPROC glad_glGetMultiTexGenfvEXT;
+    PFNGLGETMULTITEXGENIVEXTPROC glad_glGetMultiTexGenivEXT;
+    PFNGLMULTITEXPARAMETERIEXTPROC glad_glMultiTexParameteriEXT;
+    PFNGLMULTITEXPARAMETERIVEXTPROC glad_glMultiTexParameterivEXT;
+    PFNGLMULTITEXPARAMETERFEXTPROC glad_glMultiTexParameterfEXT;
+    PFNGLMULTITEXPARAMETERFVEXTPROC glad_glMultiTexParameterfvEXT;
+    PFNGLMULTITEXIMAGE1DEXTPROC glad_glMultiTexImage1DEXT;
+    PFNGLMULTITEXIMAGE2DEXTPROC glad_glMultiTexImage2DEXT;
+    PFNGLMULTITEXSUBIMAGE1DEXTPROC glad_glMultiTexSubImage1DEXT;
+    PFNGLMULTITEXSUBIMAGE2DEXTPROC glad_glMultiTexSubImage2DEXT;
+    PFNGLCOPYMULTITEXIMAGE1DEXTPROC glad_glCopyMultiTexImage1DEXT;
+    PFNGLCOPYMULTITEXIMAGE2DEXTPROC glad_glCopyMultiTexImage2DEXT;
+    PFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC glad_glCopyMultiTexSubImage1DEXT;
+    PFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC glad_glCopyMultiTexSubImage2DEXT;
+    PFNGLGETMULTITEXIMAGEEXTPROC glad_glGetMultiTexImageEXT;
+    PFNGLGETMULTITEXPARAMETERFVEXTPROC glad_glGetMultiTexParameterfvEXT;
+    PFNGLGETMULTITEXPARAMETERIVEXTPROC glad_glGetMultiTexParameterivEXT;
+    PFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC glad_glGetMultiTexLevelParameterfvEXT;
+    PFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC glad_glGetMultiTexLevelParameterivEXT;
+    PFNGLMULTITEXIMAGE3DEXTPROC glad_glMultiTexImage3DEXT;
+    PFNGLMULTITEXSUBIMAGE3DEXTPROC glad_glMultiTexSubImage3DEXT;
+    PFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC glad_glCopyMultiTexSubImage3DEXT;
+    PFNGLENABLECLIENTSTATEINDEXEDEXTPROC glad_glEnableClientStateIndexedEXT;
+    PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC glad_glDisableClientStateIndexedEXT;
+    PFNGLGETFLOATINDEXEDVEXTPROC glad_glGetFloatIndexedvEXT;
+    PFNGLGETDOUBLEINDEXEDVEXTPROC glad_glGetDoubleIndexedvEXT;
+    PFNGLGETPOINTERINDEXEDVEXTPROC glad_glGetPointerIndexedvEXT;
+    PFNGLENABLEINDEXEDEXTPROC glad_glEnableIndexedEXT;
+    PFNGLDISABLEINDEXEDEXTPROC glad_glDisableIndexedEXT;
+    PFNGLISENABLEDINDEXEDEXTPROC glad_glIsEnabledIndexedEXT;
+    PFNGLGETINTEGERINDEXEDVEXTPROC glad_glGetIntegerIndexedvEXT;
+    PFNGLGETBOOLEANINDEXEDVEXTPROC glad_glGetBooleanIndexedvEXT;
+    PFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC glad_glCompressedTextureImage3DEXT;
+    PFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC glad_glCompressedTextureImage2DEXT;
+    PFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC glad_glCompressedTextureImage1DEXT;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC glad_glCompressedTextureSubImage3DEXT;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC glad_glCompressedTextureSubImage2DEXT;
+    PFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC glad_glCompressedTextureSubImage1DEXT;
+    PFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC glad_glGetCompressedTextureImageEXT;
+    PFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC glad_glCompressedMultiTexImage3DEXT;
+    PFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC glad_glCompressedMultiTexImage2DEXT;
+    PFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC glad_glCompressedMultiTexImage1DEXT;
+    PFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC glad_glCompressedMultiTexSubImage3DEXT;
+    PFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC glad_glCompressedMultiTexSubImage2DEXT;
+    PFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC glad_glCompressedMultiTexSubImage1DEXT;
+    PFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC glad_glGetCompressedMultiTexImageEXT;
+    PFNGLMATRIXLOADTRANSPOSEFEXTPROC glad_glMatrixLoadTransposefEXT;
+    PFNGLMATRIXLOADTRANSPOSEDEXTPROC glad_glMatrixLoadTransposedEXT;
+    PFNGLMATRIXMULTTRANSPOSEFEXTPROC glad_glMatrixMultTransposefEXT;
+    PFNGLMATRIXMULTTRANSPOSEDEXTPROC glad_glMatrixMultTransposedEXT;
+    PFNGLNAMEDBUFFERDATAEXTPROC glad_glNamedBufferDataEXT;
+    PFNGLNAMEDBUFFERSUBDATAEXTPROC glad_glNamedBufferSubDataEXT;
+    PFNGLMAPNAMEDBUFFEREXTPROC glad_glMapNamedBufferEXT;
+    PFNGLUNMAPNAMEDBUFFEREXTPROC glad_glUnmapNamedBufferEXT;
+    PFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC glad_glGetNamedBufferParameterivEXT;
+    PFNGLGETNAMEDBUFFERPOINTERVEXTPROC glad_glGetNamedBufferPointervEXT;
+    PFNGLGETNAMEDBUFFERSUBDATAEXTPROC glad_glGetNamedBufferSubDataEXT;
+    PFNGLPROGRAMUNIFORM1FEXTPROC glad_glProgramUniform1fEXT;
+    PFNGLPROGRAMUNIFORM2FEXTPROC glad_glProgramUniform2fEXT;
+    PFNGLPROGRAMUNIFORM3FEXTPROC glad_glProgramUniform3fEXT;
+    PFNGLPROGRAMUNIFORM4FEXTPROC glad_glProgramUniform4fEXT;
+    PFNGLPROGRAMUNIFORM1IEXTPROC glad_glProgramUniform1iEXT;
+    PFNGLPROGRAMUNIFORM2IEXTPROC glad_glProgramUniform2iEXT;
+    PFNGLPROGRAMUNIFORM3IEXTPROC glad_glProgramUniform3iEXT;
+    PFNGLPROGRAMUNIFORM4IEXTPROC glad_glProgramUniform4iEXT;
+    PFNGLPROGRAMUNIFORM1FVEXTPROC glad_glProgramUniform1fvEXT;
+    PFNGLPROGRAMUNIFORM2FVEXTPROC glad_glProgramUniform2fvEXT;
+    PFNGLPROGRAMUNIFORM3FVEXTPROC glad_glProgramUniform3fvEXT;
+    PFNGLPROGRAMUNIFORM4FVEXTPROC glad_glProgramUniform4fvEXT;
+    PFNGLPROGRAMUNIFORM1IVEXTPROC glad_glProgramUniform1ivEXT;
+    PFNGLPROGRAMUNIFORM2IVEXTPROC glad_glProgramUniform2ivEXT;
+    PFNGLPROGRAMUNIFORM3IVEXTPROC glad_glProgramUniform3ivEXT;
+    PFNGLPROGRAMUNIFORM4IVEXTPROC glad_glProgramUniform4ivEXT;
+    PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC glad_glProgramUniformMatrix2fvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC glad_glProgramUniformMatrix3fvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC glad_glProgramUniformMatrix4fvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC glad_glProgramUniformMatrix2x3fvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC glad_glProgramUniformMatrix3x2fvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC glad_glProgramUniformMatrix2x4fvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC glad_glProgramUniformMatrix4x2fvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC glad_glProgramUniformMatrix3x4fvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC glad_glProgramUniformMatrix4x3fvEXT;
+    PFNGLTEXTUREBUFFEREXTPROC glad_glTextureBufferEXT;
+    PFNGLMULTITEXBUFFEREXTPROC glad_glMultiTexBufferEXT;
+    PFNGLTEXTUREPARAMETERIIVEXTPROC glad_glTextureParameterIivEXT;
+    PFNGLTEXTUREPARAMETERIUIVEXTPROC glad_glTextureParameterIuivEXT;
+    PFNGLGETTEXTUREPARAMETERIIVEXTPROC glad_glGetTextureParameterIivEXT;
+    PFNGLGETTEXTUREPARAMETERIUIVEXTPROC glad_glGetTextureParameterIuivEXT;
+    PFNGLMULTITEXPARAMETERIIVEXTPROC glad_glMultiTexParameterIivEXT;
+    PFNGLMULTITEXPARAMETERIUIVEXTPROC glad_glMultiTexParameterIuivEXT;
+    PFNGLGETMULTITEXPARAMETERIIVEXTPROC glad_glGetMultiTexParameterIivEXT;
+    PFNGLGETMULTITEXPARAMETERIUIVEXTPROC glad_glGetMultiTexParameterIuivEXT;
+    PFNGLPROGRAMUNIFORM1UIEXTPROC glad_glProgramUniform1uiEXT;
+    PFNGLPROGRAMUNIFORM2UIEXTPROC glad_glProgramUniform2uiEXT;
+    PFNGLPROGRAMUNIFORM3UIEXTPROC glad_glProgramUniform3uiEXT;
+    PFNGLPROGRAMUNIFORM4UIEXTPROC glad_glProgramUniform4uiEXT;
+    PFNGLPROGRAMUNIFORM1UIVEXTPROC glad_glProgramUniform1uivEXT;
+    PFNGLPROGRAMUNIFORM2UIVEXTPROC glad_glProgramUniform2uivEXT;
+    PFNGLPROGRAMUNIFORM3UIVEXTPROC glad_glProgramUniform3uivEXT;
+    PFNGLPROGRAMUNIFORM4UIVEXTPROC glad_glProgramUniform4uivEXT;
+    PFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC glad_glNamedProgramLocalParameters4fvEXT;
+    PFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC glad_glNamedProgramLocalParameterI4iEXT;
+    PFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC glad_glNamedProgramLocalParameterI4ivEXT;
+    PFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC glad_glNamedProgramLocalParametersI4ivEXT;
+    PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC glad_glNamedProgramLocalParameterI4uiEXT;
+    PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC glad_glNamedProgramLocalParameterI4uivEXT;
+    PFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC glad_glNamedProgramLocalParametersI4uivEXT;
+    PFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC glad_glGetNamedProgramLocalParameterIivEXT;
+    PFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC glad_glGetNamedProgramLocalParameterIuivEXT;
+    PFNGLENABLECLIENTSTATEIEXTPROC glad_glEnableClientStateiEXT;
+    PFNGLDISABLECLIENTSTATEIEXTPROC glad_glDisableClientStateiEXT;
+    PFNGLGETFLOATI_VEXTPROC glad_glGetFloati_vEXT;
+    PFNGLGETDOUBLEI_VEXTPROC glad_glGetDoublei_vEXT;
+    PFNGLGETPOINTERI_VEXTPROC glad_glGetPointeri_vEXT;
+    PFNGLNAMEDPROGRAMSTRINGEXTPROC glad_glNamedProgramStringEXT;
+    PFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC glad_glNamedProgramLocalParameter4dEXT;
+    PFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC glad_glNamedProgramLocalParameter4dvEXT;
+    PFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC glad_glNamedProgramLocalParameter4fEXT;
+    PFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC glad_glNamedProgramLocalParameter4fvEXT;
+    PFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC glad_glGetNamedProgramLocalParameterdvEXT;
+    PFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC glad_glGetNamedProgramLocalParameterfvEXT;
+    PFNGLGETNAMEDPROGRAMIVEXTPROC glad_glGetNamedProgramivEXT;
+    PFNGLGETNAMEDPROGRAMSTRINGEXTPROC glad_glGetNamedProgramStringEXT;
+    PFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC glad_glNamedRenderbufferStorageEXT;
+    PFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC glad_glGetNamedRenderbufferParameterivEXT;
+    PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC glad_glNamedRenderbufferStorageMultisampleEXT;
+    PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC glad_glNamedRenderbufferStorageMultisampleCoverageEXT;
+    PFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC glad_glCheckNamedFramebufferStatusEXT;
+    PFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC glad_glNamedFramebufferTexture1DEXT;
+    PFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC glad_glNamedFramebufferTexture2DEXT;
+    PFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC glad_glNamedFramebufferTexture3DEXT;
+    PFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC glad_glNamedFramebufferRenderbufferEXT;
+    PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC glad_glGetNamedFramebufferAttachmentParameterivEXT;
+    PFNGLGENERATETEXTUREMIPMAPEXTPROC glad_glGenerateTextureMipmapEXT;
+    PFNGLGENERATEMULTITEXMIPMAPEXTPROC glad_glGenerateMultiTexMipmapEXT;
+    PFNGLFRAMEBUFFERDRAWBUFFEREXTPROC glad_glFramebufferDrawBufferEXT;
+    PFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC glad_glFramebufferDrawBuffersEXT;
+    PFNGLFRAMEBUFFERREADBUFFEREXTPROC glad_glFramebufferReadBufferEXT;
+    PFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC glad_glGetFramebufferParameterivEXT;
+    PFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC glad_glNamedCopyBufferSubDataEXT;
+    PFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC glad_glNamedFramebufferTextureEXT;
+    PFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC glad_glNamedFramebufferTextureLayerEXT;
+    PFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC glad_glNamedFramebufferTextureFaceEXT;
+    PFNGLTEXTURERENDERBUFFEREXTPROC glad_glTextureRenderbufferEXT;
+    PFNGLMULTITEXRENDERBUFFEREXTPROC glad_glMultiTexRenderbufferEXT;
+    PFNGLVERTEXARRAYVERTEXOFFSETEXTPROC glad_glVertexArrayVertexOffsetEXT;
+    PFNGLVERTEXARRAYCOLOROFFSETEXTPROC glad_glVertexArrayColorOffsetEXT;
+    PFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC glad_glVertexArrayEdgeFlagOffsetEXT;
+    PFNGLVERTEXARRAYINDEXOFFSETEXTPROC glad_glVertexArrayIndexOffsetEXT;
+    PFNGLVERTEXARRAYNORMALOFFSETEXTPROC glad_glVertexArrayNormalOffsetEXT;
+    PFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC glad_glVertexArrayTexCoordOffsetEXT;
+    PFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC glad_glVertexArrayMultiTexCoordOffsetEXT;
+    PFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC glad_glVertexArrayFogCoordOffsetEXT;
+    PFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC glad_glVertexArraySecondaryColorOffsetEXT;
+    PFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC glad_glVertexArrayVertexAttribOffsetEXT;
+    PFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC glad_glVertexArrayVertexAttribIOffsetEXT;
+    PFNGLENABLEVERTEXARRAYEXTPROC glad_glEnableVertexArrayEXT;
+    PFNGLDISABLEVERTEXARRAYEXTPROC glad_glDisableVertexArrayEXT;
+    PFNGLENABLEVERTEXARRAYATTRIBEXTPROC glad_glEnableVertexArrayAttribEXT;
+    PFNGLDISABLEVERTEXARRAYATTRIBEXTPROC glad_glDisableVertexArrayAttribEXT;
+    PFNGLGETVERTEXARRAYINTEGERVEXTPROC glad_glGetVertexArrayIntegervEXT;
+    PFNGLGETVERTEXARRAYPOINTERVEXTPROC glad_glGetVertexArrayPointervEXT;
+    PFNGLGETVERTEXARRAYINTEGERI_VEXTPROC glad_glGetVertexArrayIntegeri_vEXT;
+    PFNGLGETVERTEXARRAYPOINTERI_VEXTPROC glad_glGetVertexArrayPointeri_vEXT;
+    PFNGLMAPNAMEDBUFFERRANGEEXTPROC glad_glMapNamedBufferRangeEXT;
+    PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC glad_glFlushMappedNamedBufferRangeEXT;
+    PFNGLNAMEDBUFFERSTORAGEEXTPROC glad_glNamedBufferStorageEXT;
+    PFNGLCLEARNAMEDBUFFERDATAEXTPROC glad_glClearNamedBufferDataEXT;
+    PFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC glad_glClearNamedBufferSubDataEXT;
+    PFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC glad_glNamedFramebufferParameteriEXT;
+    PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC glad_glGetNamedFramebufferParameterivEXT;
+    PFNGLPROGRAMUNIFORM1DEXTPROC glad_glProgramUniform1dEXT;
+    PFNGLPROGRAMUNIFORM2DEXTPROC glad_glProgramUniform2dEXT;
+    PFNGLPROGRAMUNIFORM3DEXTPROC glad_glProgramUniform3dEXT;
+    PFNGLPROGRAMUNIFORM4DEXTPROC glad_glProgramUniform4dEXT;
+    PFNGLPROGRAMUNIFORM1DVEXTPROC glad_glProgramUniform1dvEXT;
+    PFNGLPROGRAMUNIFORM2DVEXTPROC glad_glProgramUniform2dvEXT;
+    PFNGLPROGRAMUNIFORM3DVEXTPROC glad_glProgramUniform3dvEXT;
+    PFNGLPROGRAMUNIFORM4DVEXTPROC glad_glProgramUniform4dvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC glad_glProgramUniformMatrix2dvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC glad_glProgramUniformMatrix3dvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC glad_glProgramUniformMatrix4dvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC glad_glProgramUniformMatrix2x3dvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC glad_glProgramUniformMatrix2x4dvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC glad_glProgramUniformMatrix3x2dvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC glad_glProgramUniformMatrix3x4dvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC glad_glProgramUniformMatrix4x2dvEXT;
+    PFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC glad_glProgramUniformMatrix4x3dvEXT;
+    PFNGLTEXTUREBUFFERRANGEEXTPROC glad_glTextureBufferRangeEXT;
+    PFNGLTEXTURESTORAGE1DEXTPROC glad_glTextureStorage1DEXT;
+    PFNGLTEXTURESTORAGE2DEXTPROC glad_glTextureStorage2DEXT;
+    PFNGLTEXTURESTORAGE3DEXTPROC glad_glTextureStorage3DEXT;
+    PFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC glad_glTextureStorage2DMultisampleEXT;
+    PFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC glad_glTextureStorage3DMultisampleEXT;
+    PFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC glad_glVertexArrayBindVertexBufferEXT;
+    PFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC glad_glVertexArrayVertexAttribFormatEXT;
+    PFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC glad_glVertexArrayVertexAttribIFormatEXT;
+    PFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC glad_glVertexArrayVertexAttribLFormatEXT;
+    PFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC glad_glVertexArrayVertexAttribBindingEXT;
+    PFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC glad_glVertexArrayVertexBindingDivisorEXT;
+    PFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC glad_glVertexArrayVertexAttribLOffsetEXT;
+    PFNGLTEXTUREPAGECOMMITMENTEXTPROC glad_glTexturePageCommitmentEXT;
+    PFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC glad_glVertexArrayVertexAttribDivisorEXT;
+    PFNGLCOLORMASKINDEXEDEXTPROC glad_glColorMaskIndexedEXT;
+    PFNGLDRAWARRAYSINSTANCEDEXTPROC glad_glDrawArraysInstancedEXT;
+    PFNGLDRAWELEMENTSINSTANCEDEXTPROC glad_glDrawElementsInstancedEXT;
+    PFNGLDRAWRANGEELEMENTSEXTPROC glad_glDrawRangeElementsEXT;
+    PFNGLBUFFERSTORAGEEXTERNALEXTPROC glad_glBufferStorageExternalEXT;
+    PFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC glad_glNamedBufferStorageExternalEXT;
+    PFNGLFOGCOORDFEXTPROC glad_glFogCoordfEXT;
+    PFNGLFOGCOORDFVEXTPROC glad_glFogCoordfvEXT;
+    PFNGLFOGCOORDDEXTPROC glad_glFogCoorddEXT;
+    PFNGLFOGCOORDDVEXTPROC glad_glFogCoorddvEXT;
+    PFNGLFOGCOORDPOINTEREXTPROC glad_glFogCoordPointerEXT;
+    PFNGLBLITFRAMEBUFFEREXTPROC glad_glBlitFramebufferEXT;
+    PFNGLBLITFRAMEBUFFERLAYERSEXTPROC glad_glBlitFramebufferLayersEXT;
+    PFNGLBLITFRAMEBUFFERLAYEREXTPROC glad_glBlitFramebufferLayerEXT;
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC glad_glRenderbufferStorageMultisampleEXT;
+    PFNGLISRENDERBUFFEREXTPROC glad_glIsRenderbufferEXT;
+    PFNGLBINDRENDERBUFFEREXTPROC glad_glBindRenderbufferEXT;
+    PFNGLDELETERENDERBUFFERSEXTPROC glad_glDeleteRenderbuffersEXT;
+    PFNGLGENRENDERBUFFERSEXTPROC glad_glGenRenderbuffersEXT;
+    PFNGLRENDERBUFFERSTORAGEEXTPROC glad_glRenderbufferStorageEXT;
+    PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC glad_glGetRenderbufferParameterivEXT;
+    PFNGLISFRAMEBUFFEREXTPROC glad_glIsFramebufferEXT;
+    PFNGLBINDFRAMEBUFFEREXTPROC glad_glBindFramebufferEXT;
+    PFNGLDELETEFRAMEBUFFERSEXTPROC glad_glDeleteFramebuffersEXT;
+    PFNGLGENFRAMEBUFFERSEXTPROC glad_glGenFramebuffersEXT;
+    PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glad_glCheckFramebufferStatusEXT;
+    PFNGLFRAMEBUFFERTEXTURE1DEXTPROC glad_glFramebufferTexture1DEXT;
+    PFNGLFRAMEBUFFERTEXTURE2DEXTPROC glad_glFramebufferTexture2DEXT;
+    PFNGLFRAMEBUFFERTEXTURE3DEXTPROC glad_glFramebufferTexture3DEXT;
+    PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC glad_glFramebufferRenderbufferEXT;
+    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC glad_glGetFramebufferAttachmentParameterivEXT;
+    PFNGLGENERATEMIPMAPEXTPROC glad_glGenerateMipmapEXT;
+    PFNGLPROGRAMPARAMETERIEXTPROC glad_glProgramParameteriEXT;
+    PFNGLPROGRAMENVPARAMETERS4FVEXTPROC glad_glProgramEnvParameters4fvEXT;
+    PFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC glad_glProgramLocalParameters4fvEXT;
+    PFNGLGETUNIFORMUIVEXTPROC glad_glGetUniformuivEXT;
+    PFNGLBINDFRAGDATALOCATIONEXTPROC glad_glBindFragDataLocationEXT;
+    PFNGLGETFRAGDATALOCATIONEXTPROC glad_glGetFragDataLocationEXT;
+    PFNGLUNIFORM1UIEXTPROC glad_glUniform1uiEXT;
+    PFNGLUNIFORM2UIEXTPROC glad_glUniform2uiEXT;
+    PFNGLUNIFORM3UIEXTPROC glad_glUniform3uiEXT;
+    PFNGLUNIFORM4UIEXTPROC glad_glUniform4uiEXT;
+    PFNGLUNIFORM1UIVEXTPROC glad_glUniform1uivEXT;
+    PFNGLUNIFORM2UIVEXTPROC glad_glUniform2uivEXT;
+    PFNGLUNIFORM3UIVEXTPROC glad_glUniform3uivEXT;
+    PFNGLUNIFORM4UIVEXTPROC glad_glUniform4uivEXT;
+    PFNGLVERTEXATTRIBI1IEXTPROC glad_glVertexAttribI1iEXT;
+    PFNGLVERTEXATTRIBI2IEXTPROC glad_glVertexAttribI2iEXT;
+    PFNGLVERTEXATTRIBI3IEXTPROC glad_glVertexAttribI3iEXT;
+    PFNGLVERTEXATTRIBI4IEXTPROC glad_glVertexAttribI4iEXT;
+    PFNGLVERTEXATTRIBI1UIEXTPROC glad_glVertexAttribI1uiEXT;
+    PFNGLVERTEXATTRIBI2UIEXTPROC glad_glVertexAttribI2uiEXT;
+    PFNGLVERTEXATTRIBI3UIEXTPROC glad_glVertexAttribI3uiEXT;
+    PFNGLVERTEXATTRIBI4UIEXTPROC glad_glVertexAttribI4uiEXT;
+    PFNGLVERTEXATTRIBI1IVEXTPROC glad_glVertexAttribI1ivEXT;
+    PFNGLVERTEXATTRIBI2IVEXTPROC glad_glVertexAttribI2ivEXT;
+    PFNGLVERTEXATTRIBI3IVEXTPROC glad_glVertexAttribI3ivEXT;
+    PFNGLVERTEXATTRIBI4IVEXTPROC glad_glVertexAttribI4ivEXT;
+    PFNGLVERTEXATTRIBI1UIVEXTPROC glad_glVertexAttribI1uivEXT;
+    PFNGLVERTEXATTRIBI2UIVEXTPROC glad_glVertexAttribI2uivEXT;
+    PFNGLVERTEXATTRIBI3UIVEXTPROC glad_glVertexAttribI3uivEXT;
+    PFNGLVERTEXATTRIBI4UIVEXTPROC glad_glVertexAttribI4uivEXT;
+    PFNGLVERTEXATTRIBI4BVEXTPROC glad_glVertexAttribI4bvEXT;
+    PFNGLVERTEXATTRIBI4SVEXTPROC glad_glVertexAttribI4svEXT;
+    PFNGLVERTEXATTRIBI4UBVEXTPROC glad_glVertexAttribI4ubvEXT;
+    PFNGLVERTEXATTRIBI4USVEXTPROC glad_glVertexAttribI4usvEXT;
+    PFNGLVERTEXATTRIBIPOINTEREXTPROC glad_glVertexAttribIPointerEXT;
+    PFNGLGETVERTEXATTRIBIIVEXTPROC glad_glGetVertexAttribIivEXT;
+    PFNGLGETVERTEXATTRIBIUIVEXTPROC glad_glGetVertexAttribIuivEXT;
+    PFNGLGETHISTOGRAMEXTPROC glad_glGetHistogramEXT;
+    PFNGLGETHISTOGRAMPARAMETERFVEXTPROC glad_glGetHistogramParameterfvEXT;
+    PFNGLGETHISTOGRAMPARAMETERIVEXTPROC glad_glGetHistogramParameterivEXT;
+    PFNGLGETMINMAXEXTPROC glad_glGetMinmaxEXT;
+    PFNGLGETMINMAXPARAMETERFVEXTPROC glad_glGetMinmaxParameterfvEXT;
+    PFNGLGETMINMAXPARAMETERIVEXTPROC glad_glGetMinmaxParameterivEXT;
+    PFNGLHISTOGRAMEXTPROC glad_glHistogramEXT;
+    PFNGLMINMAXEXTPROC glad_glMinmaxEXT;
+    PFNGLRESETHISTOGRAMEXTPROC glad_glResetHistogramEXT;
+    PFNGLRESETMINMAXEXTPROC glad_glResetMinmaxEXT;
+    PFNGLINDEXFUNCEXTPROC glad_glIndexFuncEXT;
+    PFNGLINDEXMATERIALEXTPROC glad_glIndexMaterialEXT;
+    PFNGLAPPLYTEXTUREEXTPROC glad_glApplyTextureEXT;
+    PFNGLTEXTURELIGHTEXTPROC glad_glTextureLightEXT;
+    PFNGLTEXTUREMATERIALEXTPROC glad_glTextureMaterialEXT;
+    PFNGLGETUNSIGNEDBYTEVEXTPROC glad_glGetUnsignedBytevEXT;
+    PFNGLGETUNSIGNEDBYTEI_VEXTPROC glad_glGetUnsignedBytei_vEXT;
+    PFNGLDELETEMEMORYOBJECTSEXTPROC glad_glDeleteMemoryObjectsEXT;
+    PFNGLISMEMORYOBJECTEXTPROC glad_glIsMemoryObjectEXT;
+    PFNGLCREATEMEMORYOBJECTSEXTPROC glad_glCreateMemoryObjectsEXT;
+    PFNGLMEMORYOBJECTPARAMETERIVEXTPROC glad_glMemoryObjectParameterivEXT;
+    PFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC glad_glGetMemoryObjectParameterivEXT;
+    PFNGLTEXSTORAGEMEM2DEXTPROC glad_glTexStorageMem2DEXT;
+    PFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC glad_glTexStorageMem2DMultisampleEXT;
+    PFNGLTEXSTORAGEMEM3DEXTPROC glad_glTexStorageMem3DEXT;
+    PFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC glad_glTexStorageMem3DMultisampleEXT;
+    PFNGLBUFFERSTORAGEMEMEXTPROC glad_glBufferStorageMemEXT;
+    PFNGLTEXTURESTORAGEMEM2DEXTPROC glad_glTextureStorageMem2DEXT;
+    PFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC glad_glTextureStorageMem2DMultisampleEXT;
+    PFNGLTEXTURESTORAGEMEM3DEXTPROC glad_glTextureStorageMem3DEXT;
+    PFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC glad_glTextureStorageMem3DMultisampleEXT;
+    PFNGLNAMEDBUFFERSTORAGEMEMEXTPROC glad_glNamedBufferStorageMemEXT;
+    PFNGLTEXSTORAGEMEM1DEXTPROC glad_glTexStorageMem1DEXT;
+    PFNGLTEXTURESTORAGEMEM1DEXTPROC glad_glTextureStorageMem1DEXT;
+    PFNGLIMPORTMEMORYFDEXTPROC glad_glImportMemoryFdEXT;
+    PFNGLIMPORTMEMORYWIN32HANDLEEXTPROC glad_glImportMemoryWin32HandleEXT;
+    PFNGLIMPORTMEMORYWIN32NAMEEXTPROC glad_glImportMemoryWin32NameEXT;
+    PFNGLMULTIDRAWARRAYSEXTPROC glad_glMultiDrawArraysEXT;
+    PFNGLMULTIDRAWELEMENTSEXTPROC glad_glMultiDrawElementsEXT;
+    PFNGLSAMPLEMASKEXTPROC glad_glSampleMaskEXT;
+    PFNGLSAMPLEPATTERNEXTPROC glad_glSamplePatternEXT;
+    PFNGLCOLORTABLEEXTPROC glad_glColorTableEXT;
+    PFNGLGETCOLORTABLEEXTPROC glad_glGetColorTableEXT;
+    PFNGLGETCOLORTABLEPARAMETERIVEXTPROC glad_glGetColorTableParameterivEXT;
+    PFNGLGETCOLORTABLEPARAMETERFVEXTPROC glad_glGetColorTableParameterfvEXT;
+    PFNGLPIXELTRANSFORMPARAMETERIEXTPROC glad_glPixelTransformParameteriEXT;
+    PFNGLPIXELTRANSFORMPARAMETERFEXTPROC glad_glPixelTransformParameterfEXT;
+    PFNGLPIXELTRANSFORMPARAMETERIVEXTPROC glad_glPixelTransformParameterivEXT;
+    PFNGLPIXELTRANSFORMPARAMETERFVEXTPROC glad_glPixelTransformParameterfvEXT;
+    PFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC glad_glGetPixelTransformParameterivEXT;
+    PFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC glad_glGetPixelTransformParameterfvEXT;
+    PFNGLPOINTPARAMETERFEXTPROC glad_glPointParameterfEXT;
+    PFNGLPOINTPARAMETERFVEXTPROC glad_glPointParameterfvEXT;
+    PFNGLPOLYGONOFFSETEXTPROC glad_glPolygonOffsetEXT;
+    PFNGLPOLYGONOFFSETCLAMPEXTPROC glad_glPolygonOffsetClampEXT;
+    PFNGLPROVOKINGVERTEXEXTPROC glad_glProvokingVertexEXT;
+    PFNGLRASTERSAMPLESEXTPROC glad_glRasterSamplesEXT;
+    PFNGLSECONDARYCOLOR3BEXTPROC glad_glSecondaryColor3bEXT;
+    PFNGLSECONDARYCOLOR3BVEXTPROC glad_glSecondaryColor3bvEXT;
+    PFNGLSECONDARYCOLOR3DEXTPROC glad_glSecondaryColor3dEXT;
+    PFNGLSECONDARYCOLOR3DVEXTPROC glad_glSecondaryColor3dvEXT;
+    PFNGLSECONDARYCOLOR3FEXTPROC glad_glSecondaryColor3fEXT;
+    PFNGLSECONDARYCOLOR3FVEXTPROC glad_glSecondaryColor3fvEXT;
+    PFNGLSECONDARYCOLOR3IEXTPROC glad_glSecondaryColor3iEXT;
+    PFNGLSECONDARYCOLOR3IVEXTPROC glad_glSecondaryColor3ivEXT;
+    PFNGLSECONDARYCOLOR3SEXTPROC glad_glSecondaryColor3sEXT;
+    PFNGLSECONDARYCOLOR3SVEXTPROC glad_glSecondaryColor3svEXT;
+    PFNGLSECONDARYCOLOR3UBEXTPROC glad_glSecondaryColor3ubEXT;
+    PFNGLSECONDARYCOLOR3UBVEXTPROC glad_glSecondaryColor3ubvEXT;
+    PFNGLSECONDARYCOLOR3UIEXTPROC glad_glSecondaryColor3uiEXT;
+    PFNGLSECONDARYCOLOR3UIVEXTPROC glad_glSecondaryColor3uivEXT;
+    PFNGLSECONDARYCOLOR3USEXTPROC glad_glSecondaryColor3usEXT;
+    PFNGLSECONDARYCOLOR3USVEXTPROC glad_glSecondaryColor3usvEXT;
+    PFNGLSECONDARYCOLORPOINTEREXTPROC glad_glSecondaryColorPointerEXT;
+    PFNGLGENSEMAPHORESEXTPROC glad_glGenSemaphoresEXT;
+    PFNGLDELETESEMAPHORESEXTPROC glad_glDeleteSemaphoresEXT;
+    PFNGLISSEMAPHOREEXTPROC glad_glIsSemaphoreEXT;
+    PFNGLSEMAPHOREPARAMETERUI64VEXTPROC glad_glSemaphoreParameterui64vEXT;
+    PFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC glad_glGetSemaphoreParameterui64vEXT;
+    PFNGLWAITSEMAPHOREEXTPROC glad_glWaitSemaphoreEXT;
+    PFNGLSIGNALSEMAPHOREEXTPROC glad_glSignalSemaphoreEXT;
+    PFNGLIMPORTSEMAPHOREFDEXTPROC glad_glImportSemaphoreFdEXT;
+    PFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC glad_glImportSemaphoreWin32HandleEXT;
+    PFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC glad_glImportSemaphoreWin32NameEXT;
+    PFNGLUSESHADERPROGRAMEXTPROC glad_glUseShaderProgramEXT;
+    PFNGLACTIVEPROGRAMEXTPROC glad_glActiveProgramEXT;
+    PFNGLCREATESHADERPROGRAMEXTPROC glad_glCreateShaderProgramEXT;
+    PFNGLACTIVESHADERPROGRAMEXTPROC glad_glActiveShaderProgramEXT;
+    PFNGLBINDPROGRAMPIPELINEEXTPROC glad_glBindProgramPipelineEXT;
+    PFNGLCREATESHADERPROGRAMVEXTPROC glad_glCreateShaderProgramvEXT;
+    PFNGLDELETEPROGRAMPIPELINESEXTPROC glad_glDeleteProgramPipelinesEXT;
+    PFNGLGENPROGRAMPIPELINESEXTPROC glad_glGenProgramPipelinesEXT;
+    PFNGLGETPROGRAMPIPELINEINFOLOGEXTPROC glad_glGetProgramPipelineInfoLogEXT;
+    PFNGLGETPROGRAMPIPELINEIVEXTPROC glad_glGetProgramPipelineivEXT;
+    PFNGLISPROGRAMPIPELINEEXTPROC glad_glIsProgramPipelineEXT;
+    PFNGLUSEPROGRAMSTAGESEXTPROC glad_glUseProgramStagesEXT;
+    PFNGLVALIDATEPROGRAMPIPELINEEXTPROC glad_glValidateProgramPipelineEXT;
+    PFNGLFRAMEBUFFERFETCHBARRIEREXTPROC glad_glFramebufferFetchBarrierEXT;
+    PFNGLBINDIMAGETEXTUREEXTPROC glad_glBindImageTextureEXT;
+    PFNGLMEMORYBARRIEREXTPROC glad_glMemoryBarrierEXT;
+    PFNGLSTENCILCLEARTAGEXTPROC glad_glStencilClearTagEXT;
+    PFNGLACTIVESTENCILFACEEXTPROC glad_glActiveStencilFaceEXT;
+    PFNGLTEXSUBIMAGE1DEXTPROC glad_glTexSubImage1DEXT;
+    PFNGLTEXSUBIMAGE2DEXTPROC glad_glTexSubImage2DEXT;
+    PFNGLTEXIMAGE3DEXTPROC glad_glTexImage3DEXT;
+    PFNGLTEXSUBIMAGE3DEXTPROC glad_glTexSubImage3DEXT;
+    PFNGLFRAMEBUFFERTEXTURELAYEREXTPROC glad_glFramebufferTextureLayerEXT;
+    PFNGLTEXBUFFEREXTPROC glad_glTexBufferEXT;
+    PFNGLTEXPARAMETERIIVEXTPROC glad_glTexParameterIivEXT;
+    PFNGLTEXPARAMETERIUIVEXTPROC glad_glTexParameterIuivEXT;
+    PFNGLGETTEXPARAMETERIIVEXTPROC glad_glGetTexParameterIivEXT;
+    PFNGLGETTEXPARAMETERIUIVEXTPROC glad_glGetTexParameterIuivEXT;
+    PFNGLCLEARCOLORIIEXTPROC glad_glClearColorIiEXT;
+    PFNGLCLEARCOLORIUIEXTPROC glad_glClearColorIuiEXT;
+    PFNGLARETEXTURESRESIDENTEXTPROC glad_glAreTexturesResidentEXT;
+    PFNGLBINDTEXTUREEXTPROC glad_glBindTextureEXT;
+    PFNGLDELETETEXTURESEXTPROC glad_glDeleteTexturesEXT;
+    PFNGLGENTEXTURESEXTPROC glad_glGenTexturesEXT;
+    PFNGLISTEXTUREEXTPROC glad_glIsTextureEXT;
+    PFNGLPRIORITIZETEXTURESEXTPROC glad_glPrioritizeTexturesEXT;
+    PFNGLTEXTURENORMALEXTPROC glad_glTextureNormalEXT;
+    PFNGLTEXSTORAGE1DEXTPROC glad_glTexStorage1DEXT;
+    PFNGLTEXSTORAGE2DEXTPROC glad_glTexStorage2DEXT;
+    PFNGLTEXSTORAGE3DEXTPROC glad_glTexStorage3DEXT;
+    PFNGLGETQUERYOBJECTI64VEXTPROC glad_glGetQueryObjecti64vEXT;
+    PFNGLGETQUERYOBJECTUI64VEXTPROC glad_glGetQueryObjectui64vEXT;
+    PFNGLBEGINTRANSFORMFEEDBACKEXTPROC glad_glBeginTransformFeedbackEXT;
+    PFNGLENDTRANSFORMFEEDBACKEXTPROC glad_glEndTransformFeedbackEXT;
+    PFNGLBINDBUFFERRANGEEXTPROC glad_glBindBufferRangeEXT;
+    PFNGLBINDBUFFEROFFSETEXTPROC glad_glBindBufferOffsetEXT;
+    PFNGLBINDBUFFERBASEEXTPROC glad_glBindBufferBaseEXT;
+    PFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC glad_glTransformFeedbackVaryingsEXT;
+    PFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC glad_glGetTransformFeedbackVaryingEXT;
+    PFNGLARRAYELEMENTEXTPROC glad_glArrayElementEXT;
+    PFNGLCOLORPOINTEREXTPROC glad_glColorPointerEXT;
+    PFNGLDRAWARRAYSEXTPROC glad_glDrawArraysEXT;
+    PFNGLEDGEFLAGPOINTEREXTPROC glad_glEdgeFlagPointerEXT;
+    PFNGLGETPOINTERVEXTPROC glad_glGetPointervEXT;
+    PFNGLINDEXPOINTEREXTPROC glad_glIndexPointerEXT;
+    PFNGLNORMALPOINTEREXTPROC glad_glNormalPointerEXT;
+    PFNGLTEXCOORDPOINTEREXTPROC glad_glTexCoordPointerEXT;
+    PFNGLVERTEXPOINTEREXTPROC glad_glVertexPointerEXT;
+    PFNGLVERTEXATTRIBL1DEXTPROC glad_glVertexAttribL1dEXT;
+    PFNGLVERTEXATTRIBL2DEXTPROC glad_glVertexAttribL2dEXT;
+    PFNGLVERTEXATTRIBL3DEXTPROC glad_glVertexAttribL3dEXT;
+    PFNGLVERTEXATTRIBL4DEXTPROC glad_glVertexAttribL4dEXT;
+    PFNGLVERTEXATTRIBL1DVEXTPROC glad_glVertexAttribL1dvEXT;
+    PFNGLVERTEXATTRIBL2DVEXTPROC glad_glVertexAttribL2dvEXT;
+    PFNGLVERTEXATTRIBL3DVEXTPROC glad_glVertexAttribL3dvEXT;
+    PFNGLVERTEXATTRIBL4DVEXTPROC glad_glVertexAttribL4dvEXT;
+    PFNGLVERTEXATTRIBLPOINTEREXTPROC glad_glVertexAttribLPointerEXT;
+    PFNGLGETVERTEXATTRIBLDVEXTPROC glad_glGetVertexAttribLdvEXT;
+    PFNGLBEGINVERTEXSHADEREXTPROC glad_glBeginVertexShaderEXT;
+    PFNGLENDVERTEXSHADEREXTPROC glad_glEndVertexShaderEXT;
+    PFNGLBINDVERTEXSHADEREXTPROC glad_glBindVertexShaderEXT;
+    PFNGLGENVERTEXSHADERSEXTPROC glad_glGenVertexShadersEXT;
+    PFNGLDELETEVERTEXSHADEREXTPROC glad_glDeleteVertexShaderEXT;
+    PFNGLSHADEROP1EXTPROC glad_glShaderOp1EXT;
+    PFNGLSHADEROP2EXTPROC glad_glShaderOp2EXT;
+    PFNGLSHADEROP3EXTPROC glad_glShaderOp3EXT;
+    PFNGLSWIZZLEEXTPROC glad_glSwizzleEXT;
+    PFNGLWRITEMASKEXTPROC glad_glWriteMaskEXT;
+    PFNGLINSERTCOMPONENTEXTPROC glad_glInsertComponentEXT;
+    PFNGLEXTRACTCOMPONENTEXTPROC glad_glExtractComponentEXT;
+    PFNGLGENSYMBOLSEXTPROC glad_glGenSymbolsEXT;
+    PFNGLSETINVARIANTEXTPROC glad_glSetInvariantEXT;
+    PFNGLSETLOCALCONSTANTEXTPROC glad_glSetLocalConstantEXT;
+    PFNGLVARIANTBVEXTPROC glad_glVariantbvEXT;
+    PFNGLVARIANTSVEXTPROC glad_glVariantsvEXT;
+    PFNGLVARIANTIVEXTPROC glad_glVariantivEXT;
+    PFNGLVARIANTFVEXTPROC glad_glVariantfvEXT;
+    PFNGLVARIANTDVEXTPROC glad_glVariantdvEXT;
+    PFNGLVARIANTUBVEXTPROC glad_glVariantubvEXT;
+    PFNGLVARIANTUSVEXTPROC glad_glVariantusvEXT;
+    PFNGLVARIANTUIVEXTPROC glad_glVariantuivEXT;
+    PFNGLVARIANTPOINTEREXTPROC glad_glVariantPointerEXT;
+    PFNGLENABLEVARIANTCLIENTSTATEEXTPROC glad_glEnableVariantClientStateEXT;
+    PFNGLDISABLEVARIANTCLIENTSTATEEXTPROC glad_glDisableVariantClientStateEXT;
+    PFNGLBINDLIGHTPARAMETEREXTPROC glad_glBindLightParameterEXT;
+    PFNGLBINDMATERIALPARAMETEREXTPROC glad_glBindMaterialParameterEXT;
+    PFNGLBINDTEXGENPARAMETEREXTPROC glad_glBindTexGenParameterEXT;
+    PFNGLBINDTEXTUREUNITPARAMETEREXTPROC glad_glBindTextureUnitParameterEXT;
+    PFNGLBINDPARAMETEREXTPROC glad_glBindParameterEXT;
+    PFNGLISVARIANTENABLEDEXTPROC glad_glIsVariantEnabledEXT;
+    PFNGLGETVARIANTBOOLEANVEXTPROC glad_glGetVariantBooleanvEXT;
+    PFNGLGETVARIANTINTEGERVEXTPROC glad_glGetVariantIntegervEXT;
+    PFNGLGETVARIANTFLOATVEXTPROC glad_glGetVariantFloatvEXT;
+    PFNGLGETVARIANTPOINTERVEXTPROC glad_glGetVariantPointervEXT;
+    PFNGLGETINVARIANTBOOLEANVEXTPROC glad_glGetInvariantBooleanvEXT;
+    PFNGLGETINVARIANTINTEGERVEXTPROC glad_glGetInvariantIntegervEXT;
+    PFNGLGETINVARIANTFLOATVEXTPROC glad_glGetInvariantFloatvEXT;
+    PFNGLGETLOCALCONSTANTBOOLEANVEXTPROC glad_glGetLocalConstantBooleanvEXT;
+    PFNGLGETLOCALCONSTANTINTEGERVEXTPROC glad_glGetLocalConstantIntegervEXT;
+    PFNGLGETLOCALCONSTANTFLOATVEXTPROC glad_glGetLocalConstantFloatvEXT;
+    PFNGLVERTEXWEIGHTFEXTPROC glad_glVertexWeightfEXT;
+    PFNGLVERTEXWEIGHTFVEXTPROC glad_glVertexWeightfvEXT;
+    PFNGLVERTEXWEIGHTPOINTEREXTPROC glad_glVertexWeightPointerEXT;
+    PFNGLACQUIREKEYEDMUTEXWIN32EXTPROC glad_glAcquireKeyedMutexWin32EXT;
+    PFNGLRELEASEKEYEDMUTEXWIN32EXTPROC glad_glReleaseKeyedMutexWin32EXT;
+    PFNGLWINDOWRECTANGLESEXTPROC glad_glWindowRectanglesEXT;
+    PFNGLIMPORTSYNCEXTPROC glad_glImportSyncEXT;
+    PFNGLFRAMETERMINATORGREMEDYPROC glad_glFrameTerminatorGREMEDY;
+    PFNGLSTRINGMARKERGREMEDYPROC glad_glStringMarkerGREMEDY;
+    PFNGLIMAGETRANSFORMPARAMETERIHPPROC glad_glImageTransformParameteriHP;
+    PFNGLIMAGETRANSFORMPARAMETERFHPPROC glad_glImageTransformParameterfHP;
+    PFNGLIMAGETRANSFORMPARAMETERIVHPPROC glad_glImageTransformParameterivHP;
+    PFNGLIMAGETRANSFORMPARAMETERFVHPPROC glad_glImageTransformParameterfvHP;
+    PFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC glad_glGetImageTransformParameterivHP;
+    PFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC glad_glGetImageTransformParameterfvHP;
+    PFNGLMULTIMODEDRAWARRAYSIBMPROC glad_glMultiModeDrawArraysIBM;
+    PFNGLMULTIMODEDRAWELEMENTSIBMPROC glad_glMultiModeDrawElementsIBM;
+    PFNGLFLUSHSTATICDATAIBMPROC glad_glFlushStaticDataIBM;
+    PFNGLCOLORPOINTERLISTIBMPROC glad_glColorPointerListIBM;
+    PFNGLSECONDARYCOLORPOINTERLISTIBMPROC glad_glSecondaryColorPointerListIBM;
+    PFNGLEDGEFLAGPOINTERLISTIBMPROC glad_glEdgeFlagPointerListIBM;
+    PFNGLFOGCOORDPOINTERLISTIBMPROC glad_glFogCoordPointerListIBM;
+    PFNGLINDEXPOINTERLISTIBMPROC glad_glIndexPointerListIBM;
+    PFNGLNORMALPOINTERLISTIBMPROC glad_glNormalPointerListIBM;
+    PFNGLTEXCOORDPOINTERLISTIBMPROC glad_glTexCoordPointerListIBM;
+    PFNGLVERTEXPOINTERLISTIBMPROC glad_glVertexPointerListIBM;
+    PFNGLBLENDFUNCSEPARATEINGRPROC glad_glBlendFuncSeparateINGR;
+    PFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC glad_glApplyFramebufferAttachmentCMAAINTEL;
+    PFNGLSYNCTEXTUREINTELPROC glad_glSyncTextureINTEL;
+    PFNGLUNMAPTEXTURE2DINTELPROC glad_glUnmapTexture2DINTEL;
+    PFNGLMAPTEXTURE2DINTELPROC glad_glMapTexture2DINTEL;
+    PFNGLVERTEXPOINTERVINTELPROC glad_glVertexPointervINTEL;
+    PFNGLNORMALPOINTERVINTELPROC glad_glNormalPointervINTEL;
+    PFNGLCOLORPOINTERVINTELPROC glad_glColorPointervINTEL;
+    PFNGLTEXCOORDPOINTERVINTELPROC glad_glTexCoordPointervINTEL;
+    PFNGLBEGINPERFQUERYINTELPROC glad_glBeginPerfQueryINTEL;
+    PFNGLCREATEPERFQUERYINTELPROC glad_glCreatePerfQueryINTEL;
+    PFNGLDELETEPERFQUERYINTELPROC glad_glDeletePerfQueryINTEL;
+    PFNGLENDPERFQUERYINTELPROC glad_glEndPerfQueryINTEL;
+    PFNGLGETFIRSTPERFQUERYIDINTELPROC glad_glGetFirstPerfQueryIdINTEL;
+    PFNGLGETNEXTPERFQUERYIDINTELPROC glad_glGetNextPerfQueryIdINTEL;
+    PFNGLGETPERFCOUNTERINFOINTELPROC glad_glGetPerfCounterInfoINTEL;
+    PFNGLGETPERFQUERYDATAINTELPROC glad_glGetPerfQueryDataINTEL;
+    PFNGLGETPERFQUERYIDBYNAMEINTELPROC glad_glGetPerfQueryIdByNameINTEL;
+    PFNGLGETPERFQUERYINFOINTELPROC glad_glGetPerfQueryInfoINTEL;
+    PFNGLBLENDBARRIERKHRPROC glad_glBlendBarrierKHR;
+#endif
+    PFNGLDEBUGMESSAGECONTROLKHRPROC glad_glDebugMessageControlKHR;
+    PFNGLDEBUGMESSAGEINSERTKHRPROC glad_glDebugMessageInsertKHR;
+    PFNGLDEBUGMESSAGECALLBACKKHRPROC glad_glDebugMessageCallbackKHR;
+    PFNGLGETDEBUGMESSAGELOGKHRPROC glad_glGetDebugMessageLogKHR;
+    PFNGLPUSHDEBUGGROUPKHRPROC glad_glPushDebugGroupKHR;
+    PFNGLPOPDEBUGGROUPKHRPROC glad_glPopDebugGroupKHR;
+    PFNGLOBJECTLABELKHRPROC glad_glObjectLabelKHR;
+    PFNGLGETOBJECTLABELKHRPROC glad_glGetObjectLabelKHR;
+    PFNGLOBJECTPTRLABELKHRPROC glad_glObjectPtrLabelKHR;
+    PFNGLGETOBJECTPTRLABELKHRPROC glad_glGetObjectPtrLabelKHR;
+    PFNGLGETPOINTERVKHRPROC glad_glGetPointervKHR;
+    PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR;
+#ifndef GLAD_CORE_PROFILE
+    PFNGLGETGRAPHICSRESETSTATUSKHRPROC glad_glGetGraphicsResetStatusKHR;
+    PFNGLREADNPIXELSKHRPROC glad_glReadnPixelsKHR;
+    PFNGLGETNUNIFORMFVKHRPROC glad_glGetnUniformfvKHR;
+    PFNGLGETNUNIFORMIVKHRPROC glad_glGetnUniformivKHR;
+    PFNGLGETNUNIFORMUIVKHRPROC glad_glGetnUniformuivKHR;
+    PFNGLFRAMEBUFFERPARAMETERIMESAPROC glad_glFramebufferParameteriMESA;
+    PFNGLGETFRAMEBUFFERPARAMETERIVMESAPROC glad_glGetFramebufferParameterivMESA;
+    PFNGLRESIZEBUFFERSMESAPROC glad_glResizeBuffersMESA;
+    PFNGLWINDOWPOS2DMESAPROC glad_glWindowPos2dMESA;
+    PFNGLWINDOWPOS2DVMESAPROC glad_glWindowPos2dvMESA;
+    PFNGLWINDOWPOS2FMESAPROC glad_glWindowPos2fMESA;
+    PFNGLWINDOWPOS2FVMESAPROC glad_glWindowPos2fvMESA;
+    PFNGLWINDOWPOS2IMESAPROC glad_glWindowPos2iMESA;
+    PFNGLWINDOWPOS2IVMESAPROC glad_glWindowPos2ivMESA;
+    PFNGLWINDOWPOS2SMESAPROC glad_glWindowPos2sMESA;
+    PFNGLWINDOWPOS2SVMESAPROC glad_glWindowPos2svMESA;
+    PFNGLWINDOWPOS3DMESAPROC glad_glWindowPos3dMESA;
+    PFNGLWINDOWPOS3DVMESAPROC glad_glWindowPos3dvMESA;
+    PFNGLWINDOWPOS3FMESAPROC glad_glWindowPos3fMESA;
+    PFNGLWINDOWPOS3FVMESAPROC glad_glWindowPos3fvMESA;
+    PFNGLWINDOWPOS3IMESAPROC glad_glWindowPos3iMESA;
+    PFNGLWINDOWPOS3IVMESAPROC glad_glWindowPos3ivMESA;
+    PFNGLWINDOWPOS3SMESAPROC glad_glWindowPos3sMESA;
+    PFNGLWINDOWPOS3SVMESAPROC glad_glWindowPos3svMESA;
+    PFNGLWINDOWPOS4DMESAPROC glad_glWindowPos4dMESA;
+    PFNGLWINDOWPOS4DVMESAPROC glad_glWindowPos4dvMESA;
+    PFNGLWINDOWPOS4FMESAPROC glad_glWindowPos4fMESA;
+    PFNGLWINDOWPOS4FVMESAPROC glad_glWindowPos4fvMESA;
+    PFNGLWINDOWPOS4IMESAPROC glad_glWindowPos4iMESA;
+    PFNGLWINDOWPOS4IVMESAPROC glad_glWindowPos4ivMESA;
+    PFNGLWINDOWPOS4SMESAPROC glad_glWindowPos4sMESA;
+    PFNGLWINDOWPOS4SVMESAPROC glad_glWindowPos4svMESA;
+    PFNGLBEGINCONDITIONALRENDERNVXPROC glad_glBeginConditionalRenderNVX;
+    PFNGLENDCONDITIONALRENDERNVXPROC glad_glEndConditionalRenderNVX;
+    PFNGLUPLOADGPUMASKNVXPROC glad_glUploadGpuMaskNVX;
+    PFNGLMULTICASTVIEWPORTARRAYVNVXPROC glad_glMulticastViewportArrayvNVX;
+    PFNGLMULTICASTVIEWPORTPOSITIONWSCALENVXPROC glad_glMulticastViewportPositionWScaleNVX;
+    PFNGLMULTICASTSCISSORARRAYVNVXPROC glad_glMulticastScissorArrayvNVX;
+    PFNGLASYNCCOPYBUFFERSUBDATANVXPROC glad_glAsyncCopyBufferSubDataNVX;
+    PFNGLASYNCCOPYIMAGESUBDATANVXPROC glad_glAsyncCopyImageSubDataNVX;
+    PFNGLLGPUNAMEDBUFFERSUBDATANVXPROC glad_glLGPUNamedBufferSubDataNVX;
+    PFNGLLGPUCOPYIMAGESUBDATANVXPROC glad_glLGPUCopyImageSubDataNVX;
+    PFNGLLGPUINTERLOCKNVXPROC glad_glLGPUInterlockNVX;
+    PFNGLCREATEPROGRESSFENCENVXPROC glad_glCreateProgressFenceNVX;
+    PFNGLSIGNALSEMAPHOREUI64NVXPROC glad_glSignalSemaphoreui64NVX;
+    PFNGLWAITSEMAPHOREUI64NVXPROC glad_glWaitSemaphoreui64NVX;
+    PFNGLCLIENTWAITSEMAPHOREUI64NVXPROC glad_glClientWaitSemaphoreui64NVX;
+    PFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC glad_glAlphaToCoverageDitherControlNV;
+    PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC glad_glMultiDrawArraysIndirectBindlessNV;
+    PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC glad_glMultiDrawElementsIndirectBindlessNV;
+    PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC glad_glMultiDrawArraysIndirectBindlessCountNV;
+    PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC glad_glMultiDrawElementsIndirectBindlessCountNV;
+    PFNGLGETTEXTUREHANDLENVPROC glad_glGetTextureHandleNV;
+    PFNGLGETTEXTURESAMPLERHANDLENVPROC glad_glGetTextureSamplerHandleNV;
+    PFNGLMAKETEXTUREHANDLERESIDENTNVPROC glad_glMakeTextureHandleResidentNV;
+    PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC glad_glMakeTextureHandleNonResidentNV;
+    PFNGLGETIMAGEHANDLENVPROC glad_glGetImageHandleNV;
+    PFNGLMAKEIMAGEHANDLERESIDENTNVPROC glad_glMakeImageHandleResidentNV;
+    PFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC glad_glMakeImageHandleNonResidentNV;
+    PFNGLUNIFORMHANDLEUI64NVPROC glad_glUniformHandleui64NV;
+    PFNGLUNIFORMHANDLEUI64VNVPROC glad_glUniformHandleui64vNV;
+    PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC glad_glProgramUniformHandleui64NV;
+    PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC glad_glProgramUniformHandleui64vNV;
+    PFNGLISTEXTUREHANDLERESIDENTNVPROC glad_glIsTextureHandleResidentNV;
+    PFNGLISIMAGEHANDLERESIDENTNVPROC glad_glIsImageHandleResidentNV;
+    PFNGLBLENDPARAMETERINVPROC glad_glBlendParameteriNV;
+    PFNGLBLENDBARRIERNVPROC glad_glBlendBarrierNV;
+    PFNGLVIEWPORTPOSITIONWSCALENVPROC glad_glViewportPositionWScaleNV;
+    PFNGLCREATESTATESNVPROC glad_glCreateStatesNV;
+    PFNGLDELETESTATESNVPROC glad_glDeleteStatesNV;
+    PFNGLISSTATENVPROC glad_glIsStateNV;
+    PFNGLSTATECAPTURENVPROC glad_glStateCaptureNV;
+    PFNGLGETCOMMANDHEADERNVPROC glad_glGetCommandHeaderNV;
+    PFNGLGETSTAGEINDEXNVPROC glad_glGetStageIndexNV;
+    PFNGLDRAWCOMMANDSNVPROC glad_glDrawCommandsNV;
+    PFNGLDRAWCOMMANDSADDRESSNVPROC glad_glDrawCommandsAddressNV;
+    PFNGLDRAWCOMMANDSSTATESNVPROC glad_glDrawCommandsStatesNV;
+    PFNGLDRAWCOMMANDSSTATESADDRESSNVPROC glad_glDrawCommandsStatesAddressNV;
+    PFNGLCREATECOMMANDLISTSNVPROC glad_glCreateCommandListsNV;
+    PFNGLDELETECOMMANDLISTSNVPROC glad_glDeleteCommandListsNV;
+    PFNGLISCOMMANDLISTNVPROC glad_glIsCommandListNV;
+    PFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC glad_glListDrawCommandsStatesClientNV;
+    PFNGLCOMMANDLISTSEGMENTSNVPROC glad_glCommandListSegmentsNV;
+    PFNGLCOMPILECOMMANDLISTNVPROC glad_glCompileCommandListNV;
+    PFNGLCALLCOMMANDLISTNVPROC glad_glCallCommandListNV;
+    PFNGLBEGINCONDITIONALRENDERNVPROC glad_glBeginConditionalRenderNV;
+    PFNGLENDCONDITIONALRENDERNVPROC glad_glEndConditionalRenderNV;
+    PFNGLSUBPIXELPRECISIONBIASNVPROC glad_glSubpixelPrecisionBiasNV;
+    PFNGLCONSERVATIVERASTERPARAMETERFNVPROC glad_glConservativeRasterParameterfNV;
+    PFNGLCONSERVATIVERASTERPARAMETERINVPROC glad_glConservativeRasterParameteriNV;
+    PFNGLCOPYIMAGESUBDATANVPROC glad_glCopyImageSubDataNV;
+    PFNGLDEPTHRANGEDNVPROC glad_glDepthRangedNV;
+    PFNGLCLEARDEPTHDNVPROC glad_glClearDepthdNV;
+    PFNGLDEPTHBOUNDSDNVPROC glad_glDepthBoundsdNV;
+    PFNGLDRAWTEXTURENVPROC glad_glDrawTextureNV;
+    PFNGLDRAWVKIMAGENVPROC glad_glDrawVkImageNV;
+    PFNGLGETVKPROCADDRNVPROC glad_glGetVkProcAddrNV;
+    PFNGLWAITVKSEMAPHORENVPROC glad_glWaitVkSemaphoreNV;
+    PFNGLSIGNALVKSEMAPHORENVPROC glad_glSignalVkSemaphoreNV;
+    PFNGLSIGNALVKFENCENVPROC glad_glSignalVkFenceNV;
+    PFNGLMAPCONTROLPOINTSNVPROC glad_glMapControlPointsNV;
+    PFNGLMAPPARAMETERIVNVPROC glad_glMapParameterivNV;
+    PFNGLMAPPARAMETERFVNVPROC glad_glMapParameterfvNV;
+    PFNGLGETMAPCONTROLPOINTSNVPROC glad_glGetMapControlPointsNV;
+    PFNGLGETMAPPARAMETERIVNVPROC glad_glGetMapParameterivNV;
+    PFNGLGETMAPPARAMETERFVNVPROC glad_glGetMapParameterfvNV;
+    PFNGLGETMAPATTRIBPARAMETERIVNVPROC glad_glGetMapAttribParameterivNV;
+    PFNGLGETMAPATTRIBPARAMETERFVNVPROC glad_glGetMapAttribParameterfvNV;
+    PFNGLEVALMAPSNVPROC glad_glEvalMapsNV;
+    PFNGLGETMULTISAMPLEFVNVPROC glad_glGetMultisamplefvNV;
+    PFNGLSAMPLEMASKINDEXEDNVPROC glad_glSampleMaskIndexedNV;
+    PFNGLTEXRENDERBUFFERNVPROC glad_glTexRenderbufferNV;
+    PFNGLDELETEFENCESNVPROC glad_glDeleteFencesNV;
+    PFNGLGENFENCESNVPROC glad_glGenFencesNV;
+    PFNGLISFENCENVPROC glad_glIsFenceNV;
+    PFNGLTESTFENCENVPROC glad_glTestFenceNV;
+    PFNGLGETFENCEIVNVPROC glad_glGetFenceivNV;
+    PFNGLFINISHFENCENVPROC glad_glFinishFenceNV;
+    PFNGLSETFENCENVPROC glad_glSetFenceNV;
+    PFNGLFRAGMENTCOVERAGECOLORNVPROC glad_glFragmentCoverageColorNV;
+    PFNGLPROGRAMNAMEDPARAMETER4FNVPROC glad_glProgramNamedParameter4fNV;
+    PFNGLPROGRAMNAMEDPARAMETER4FVNVPROC glad_glProgramNamedParameter4fvNV;
+    PFNGLPROGRAMNAMEDPARAMETER4DNVPROC glad_glProgramNamedParameter4dNV;
+    PFNGLPROGRAMNAMEDPARAMETER4DVNVPROC glad_glProgramNamedParameter4dvNV;
+    PFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC glad_glGetProgramNamedParameterfvNV;
+    PFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC glad_glGetProgramNamedParameterdvNV;
+    PFNGLCOVERAGEMODULATIONTABLENVPROC glad_glCoverageModulationTableNV;
+    PFNGLGETCOVERAGEMODULATIONTABLENVPROC glad_glGetCoverageModulationTableNV;
+    PFNGLCOVERAGEMODULATIONNVPROC glad_glCoverageModulationNV;
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC glad_glRenderbufferStorageMultisampleCoverageNV;
+    PFNGLPROGRAMVERTEXLIMITNVPROC glad_glProgramVertexLimitNV;
+    PFNGLFRAMEBUFFERTEXTUREEXTPROC glad_glFramebufferTextureEXT;
+    PFNGLFRAMEBUFFERTEXTUREFACEEXTPROC glad_glFramebufferTextureFaceEXT;
+    PFNGLRENDERGPUMASKNVPROC glad_glRenderGpuMaskNV;
+    PFNGLMULTICASTBUFFERSUBDATANVPROC glad_glMulticastBufferSubDataNV;
+    PFNGLMULTICASTCOPYBUFFERSUBDATANVPROC glad_glMulticastCopyBufferSubDataNV;
+    PFNGLMULTICASTCOPYIMAGESUBDATANVPROC glad_glMulticastCopyImageSubDataNV;
+    PFNGLMULTICASTBLITFRAMEBUFFERNVPROC glad_glMulticastBlitFramebufferNV;
+    PFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC glad_glMulticastFramebufferSampleLocationsfvNV;
+    PFNGLMULTICASTBARRIERNVPROC glad_glMulticastBarrierNV;
+    PFNGLMULTICASTWAITSYNCNVPROC glad_glMulticastWaitSyncNV;
+    PFNGLMULTICASTGETQUERYOBJECTIVNVPROC glad_glMulticastGetQueryObjectivNV;
+    PFNGLMULTICASTGETQUERYOBJECTUIVNVPROC glad_glMulticastGetQueryObjectuivNV;
+    PFNGLMULTICASTGETQUERYOBJECTI64VNVPROC glad_glMulticastGetQueryObjecti64vNV;
+    PFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC glad_glMulticastGetQueryObjectui64vNV;
+    PFNGLPROGRAMLOCALPARAMETERI4INVPROC glad_glProgramLocalParameterI4iNV;
+    PFNGLPROGRAMLOCALPARAMETERI4IVNVPROC glad_glProgramLocalParameterI4ivNV;
+    PFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC glad_glProgramLocalParametersI4ivNV;
+    PFNGLPROGRAMLOCALPARAMETERI4UINVPROC glad_glProgramLocalParameterI4uiNV;
+    PFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC glad_glProgramLocalParameterI4uivNV;
+    PFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC glad_glProgramLocalParametersI4uivNV;
+    PFNGLPROGRAMENVPARAMETERI4INVPROC glad_glProgramEnvParameterI4iNV;
+    PFNGLPROGRAMENVPARAMETERI4IVNVPROC glad_glProgramEnvParameterI4ivNV;
+    PFNGLPROGRAMENVPARAMETERSI4IVNVPROC glad_glProgramEnvParametersI4ivNV;
+    PFNGLPROGRAMENVPARAMETERI4UINVPROC glad_glProgramEnvParameterI4uiNV;
+    PFNGLPROGRAMENVPARAMETERI4UIVNVPROC glad_glProgramEnvParameterI4uivNV;
+    PFNGLPROGRAMENVPARAMETERSI4UIVNVPROC glad_glProgramEnvParametersI4uivNV;
+    PFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC glad_glGetProgramLocalParameterIivNV;
+    PFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC glad_glGetProgramLocalParameterIuivNV;
+    PFNGLGETPROGRAMENVPARAMETERIIVNVPROC glad_glGetProgramEnvParameterIivNV;
+    PFNGLGETPROGRAMENVPARAMETERIUIVNVPROC glad_glGetProgramEnvParameterIuivNV;
+    PFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC glad_glProgramSubroutineParametersuivNV;
+    PFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC glad_glGetProgramSubroutineParameteruivNV;
+    PFNGLVERTEX2HNVPROC glad_glVertex2hNV;
+    PFNGLVERTEX2HVNVPROC glad_glVertex2hvNV;
+    PFNGLVERTEX3HNVPROC glad_glVertex3hNV;
+    PFNGLVERTEX3HVNVPROC glad_glVertex3hvNV;
+    PFNGLVERTEX4HNVPROC glad_glVertex4hNV;
+    PFNGLVERTEX4HVNVPROC glad_glVertex4hvNV;
+    PFNGLNORMAL3HNVPROC glad_glNormal3hNV;
+    PFNGLNORMAL3HVNVPROC glad_glNormal3hvNV;
+    PFNGLCOLOR3HNVPROC glad_glColor3hNV;
+    PFNGLCOLOR3HVNVPROC glad_glColor3hvNV;
+    PFNGLCOLOR4HNVPROC glad_glColor4hNV;
+    PFNGLCOLOR4HVNVPROC glad_glColor4hvNV;
+    PFNGLTEXCOORD1HNVPROC glad_glTexCoord1hNV;
+    PFNGLTEXCOORD1HVNVPROC glad_glTexCoord1hvNV;
+    PFNGLTEXCOORD2HNVPROC glad_glTexCoord2hNV;
+    PFNGLTEXCOORD2HVNVPROC glad_glTexCoord2hvNV;
+    PFNGLTEXCOORD3HNVPROC glad_glTexCoord3hNV;
+    PFNGLTEXCOORD3HVNVPROC glad_glTexCoord3hvNV;
+    PFNGLTEXCOORD4HNVPROC glad_glTexCoord4hNV;
+    PFNGLTEXCOORD4HVNVPROC glad_glTexCoord4hvNV;
+    PFNGLMULTITEXCOORD1HNVPROC glad_glMultiTexCoord1hNV;
+    PFNGLMULTITEXCOORD1HVNVPROC glad_glMultiTexCoord1hvNV;
+    PFNGLMULTITEXCOORD2HNVPROC glad_glMultiTexCoord2hNV;
+    PFNGLMULTITEXCOORD2HVNVPROC glad_glMultiTexCoord2hvNV;
+    PFNGLMULTITEXCOORD3HNVPROC glad_glMultiTexCoord3hNV;
+    PFNGLMULTITEXCOORD3HVNVPROC glad_glMultiTexCoord3hvNV;
+    PFNGLMULTITEXCOORD4HNVPROC glad_glMultiTexCoord4hNV;
+    PFNGLMULTITEXCOORD4HVNVPROC glad_glMultiTexCoord4hvNV;
+    PFNGLVERTEXATTRIB1HNVPROC glad_glVertexAttrib1hNV;
+    PFNGLVERTEXATTRIB1HVNVPROC glad_glVertexAttrib1hvNV;
+    PFNGLVERTEXATTRIB2HNVPROC glad_glVertexAttrib2hNV;
+    PFNGLVERTEXATTRIB2HVNVPROC glad_glVertexAttrib2hvNV;
+    PFNGLVERTEXATTRIB3HNVPROC glad_glVertexAttrib3hNV;
+    PFNGLVERTEXATTRIB3HVNVPROC glad_glVertexAttrib3hvNV;
+    PFNGLVERTEXATTRIB4HNVPROC glad_glVertexAttrib4hNV;
+    PFNGLVERTEXATTRIB4HVNVPROC glad_glVertexAttrib4hvNV;
+    PFNGLVERTEXATTRIBS1HVNVPROC glad_glVertexAttribs1hvNV;
+    PFNGLVERTEXATTRIBS2HVNVPROC glad_glVertexAttribs2hvNV;
+    PFNGLVERTEXATTRIBS3HVNVPROC glad_glVertexAttribs3hvNV;
+    PFNGLVERTEXATTRIBS4HVNVPROC glad_glVertexAttribs4hvNV;
+    PFNGLFOGCOORDHNVPROC glad_glFogCoordhNV;
+    PFNGLFOGCOORDHVNVPROC glad_glFogCoordhvNV;
+    PFNGLSECONDARYCOLOR3HNVPROC glad_glSecondaryColor3hNV;
+    PFNGLSECONDARYCOLOR3HVNVPROC glad_glSecondaryColor3hvNV;
+    PFNGLVERTEXWEIGHTHNVPROC glad_glVertexWeighthNV;
+    PFNGLVERTEXWEIGHTHVNVPROC glad_glVertexWeighthvNV;
+    PFNGLGETINTERNALFORMATSAMPLEIVNVPROC glad_glGetInternalformatSampleivNV;
+    PFNGLGETMEMORYOBJECTDETACHEDRESOURCESUIVNVPROC glad_glGetMemoryObjectDetachedResourcesuivNV;
+    PFNGLRESETMEMORYOBJECTPARAMETERNVPROC glad_glResetMemoryObjectParameterNV;
+    PFNGLTEXATTACHMEMORYNVPROC glad_glTexAttachMemoryNV;
+    PFNGLBUFFERATTACHMEMORYNVPROC glad_glBufferAttachMemoryNV;
+    PFNGLTEXTUREATTACHMEMORYNVPROC glad_glTextureAttachMemoryNV;
+    PFNGLNAMEDBUFFERATTACHMEMORYNVPROC glad_glNamedBufferAttachMemoryNV;
+    PFNGLBUFFERPAGECOMMITMENTMEMNVPROC glad_glBufferPageCommitmentMemNV;
+    PFNGLTEXPAGECOMMITMENTMEMNVPROC glad_glTexPageCommitmentMemNV;
+    PFNGLNAMEDBUFFERPAGECOMMITMENTMEMNVPROC glad_glNamedBufferPageCommitmentMemNV;
+    PFNGLTEXTUREPAGECOMMITMENTMEMNVPROC glad_glTexturePageCommitmentMemNV;
+    PFNGLDRAWMESHTASKSNVPROC glad_glDrawMeshTasksNV;
+    PFNGLDRAWMESHTASKSINDIRECTNVPROC glad_glDrawMeshTasksIndirectNV;
+    PFNGLMULTIDRAWMESHTASKSINDIRECTNVPROC glad_glMultiDrawMeshTasksIndirectNV;
+    PFNGLMULTIDRAWMESHTASKSINDIRECTCOUNTNVPROC glad_glMultiDrawMeshTasksIndirectCountNV;
+    PFNGLGENOCCLUSIONQUERIESNVPROC glad_glGenOcclusionQueriesNV;
+    PFNGLDELETEOCCLUSIONQUERIESNVPROC glad_glDeleteOcclusionQueriesNV;
+    PFNGLISOCCLUSIONQUERYNVPROC glad_glIsOcclusionQueryNV;
+    PFNGLBEGINOCCLUSIONQUERYNVPROC glad_glBeginOcclusionQueryNV;
+    PFNGLENDOCCLUSIONQUERYNVPROC glad_glEndOcclusionQueryNV;
+    PFNGLGETOCCLUSIONQUERYIVNVPROC glad_glGetOcclusionQueryivNV;
+    PFNGLGETOCCLUSIONQUERYUIVNVPROC glad_glGetOcclusionQueryuivNV;
+    PFNGLPROGRAMBUFFERPARAMETERSFVNVPROC glad_glProgramBufferParametersfvNV;
+    PFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC glad_glProgramBufferParametersIivNV;
+    PFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC glad_glProgramBufferParametersIuivNV;
+    PFNGLGENPATHSNVPROC glad_glGenPathsNV;
+    PFNGLDELETEPATHSNVPROC glad_glDeletePathsNV;
+    PFNGLISPATHNVPROC glad_glIsPathNV;
+    PFNGLPATHCOMMANDSNVPROC glad_glPathCommandsNV;
+    PFNGLPATHCOORDSNVPROC glad_glPathCoordsNV;
+    PFNGLPATHSUBCOMMANDSNVPROC glad_glPathSubCommandsNV;
+    PFNGLPATHSUBCOORDSNVPROC glad_glPathSubCoordsNV;
+    PFNGLPATHSTRINGNVPROC glad_glPathStringNV;
+    PFNGLPATHGLYPHSNVPROC glad_glPathGlyphsNV;
+    PFNGLPATHGLYPHRANGENVPROC glad_glPathGlyphRangeNV;
+    PFNGLWEIGHTPATHSNVPROC glad_glWeightPathsNV;
+    PFNGLCOPYPATHNVPROC glad_glCopyPathNV;
+    PFNGLINTERPOLATEPATHSNVPROC glad_glInterpolatePathsNV;
+    PFNGLTRANSFORMPATHNVPROC glad_glTransformPathNV;
+    PFNGLPATHPARAMETERIVNVPROC glad_glPathParameterivNV;
+    PFNGLPATHPARAMETERINVPROC glad_glPathParameteriNV;
+    PFNGLPATHPARAMETERFVNVPROC glad_glPathParameterfvNV;
+    PFNGLPATHPARAMETERFNVPROC glad_glPathParameterfNV;
+    PFNGLPATHDASHARRAYNVPROC glad_glPathDashArrayNV;
+    PFNGLPATHSTENCILFUNCNVPROC glad_glPathStencilFuncNV;
+    PFNGLPATHSTENCILDEPTHOFFSETNVPROC glad_glPathStencilDepthOffsetNV;
+    PFNGLSTENCILFILLPATHNVPROC glad_glStencilFillPathNV;
+    PFNGLSTENCILSTROKEPATHNVPROC glad_glStencilStrokePathNV;
+    PFNGLSTENCILFILLPATHINSTANCEDNVPROC glad_glStencilFillPathInstancedNV;
+    PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC glad_glStencilStrokePathInstancedNV;
+    PFNGLPATHCOVERDEPTHFUNCNVPROC glad_glPathCoverDepthFuncNV;
+    PFNGLCOVERFILLPATHNVPROC glad_glCoverFillPathNV;
+    PFNGLCOVERSTROKEPATHNVPROC glad_glCoverStrokePathNV;
+    PFNGLCOVERFILLPATHINSTANCEDNVPROC glad_glCoverFillPathInstancedNV;
+    PFNGLCOVERSTROKEPATHINSTANCEDNVPROC glad_glCoverStrokePathInstancedNV;
+    PFNGLGETPATHPARAMETERIVNVPROC glad_glGetPathParameterivNV;
+    PFNGLGETPATHPARAMETERFVNVPROC glad_glGetPathParameterfvNV;
+    PFNGLGETPATHCOMMANDSNVPROC glad_glGetPathCommandsNV;
+    PFNGLGETPATHCOORDSNVPROC glad_glGetPathCoordsNV;
+    PFNGLGETPATHDASHARRAYNVPROC glad_glGetPathDashArrayNV;
+    PFNGLGETPATHMETRICSNVPROC glad_glGetPathMetricsNV;
+    PFNGLGETPATHMETRICRANGENVPROC glad_glGetPathMetricRangeNV;
+    PFNGLGETPATHSPACINGNVPROC glad_glGetPathSpacingNV;
+    PFNGLISPOINTINFILLPATHNVPROC glad_glIsPointInFillPathNV;
+    PFNGLISPOINTINSTROKEPATHNVPROC glad_glIsPointInStrokePathNV;
+    PFNGLGETPATHLENGTHNVPROC glad_glGetPathLengthNV;
+    PFNGLPOINTALONGPATHNVPROC glad_glPointAlongPathNV;
+    PFNGLMATRIXLOAD3X2FNVPROC glad_glMatrixLoad3x2fNV;
+    PFNGLMATRIXLOAD3X3FNVPROC glad_glMatrixLoad3x3fNV;
+    PFNGLMATRIXLOADTRANSPOSE3X3FNVPROC glad_glMatrixLoadTranspose3x3fNV;
+    PFNGLMATRIXMULT3X2FNVPROC glad_glMatrixMult3x2fNV;
+    PFNGLMATRIXMULT3X3FNVPROC glad_glMatrixMult3x3fNV;
+    PFNGLMATRIXMULTTRANSPOSE3X3FNVPROC glad_glMatrixMultTranspose3x3fNV;
+    PFNGLSTENCILTHENCOVERFILLPATHNVPROC glad_glStencilThenCoverFillPathNV;
+    PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC glad_glStencilThenCoverStrokePathNV;
+    PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC glad_glStencilThenCoverFillPathInstancedNV;
+    PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC glad_glStencilThenCoverStrokePathInstancedNV;
+    PFNGLPATHGLYPHINDEXRANGENVPROC glad_glPathGlyphIndexRangeNV;
+    PFNGLPATHGLYPHINDEXARRAYNVPROC glad_glPathGlyphIndexArrayNV;
+    PFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC glad_glPathMemoryGlyphIndexArrayNV;
+    PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC glad_glProgramPathFragmentInputGenNV;
+    PFNGLGETPROGRAMRESOURCEFVNVPROC glad_glGetProgramResourcefvNV;
+    PFNGLPATHCOLORGENNVPROC glad_glPathColorGenNV;
+    PFNGLPATHTEXGENNVPROC glad_glPathTexGenNV;
+    PFNGLPATHFOGGENNVPROC glad_glPathFogGenNV;
+    PFNGLGETPATHCOLORGENIVNVPROC glad_glGetPathColorGenivNV;
+    PFNGLGETPATHCOLORGENFVNVPROC glad_glGetPathColorGenfvNV;
+    PFNGLGETPATHTEXGENIVNVPROC glad_glGetPathTexGenivNV;
+    PFNGLGETPATHTEXGENFVNVPROC glad_glGetPathTexGenfvNV;
+    PFNGLPIXELDATARANGENVPROC glad_glPixelDataRangeNV;
+    PFNGLFLUSHPIXELDATARANGENVPROC glad_glFlushPixelDataRangeNV;
+    PFNGLPOINTPARAMETERINVPROC glad_glPointParameteriNV;
+    PFNGLPOINTPARAMETERIVNVPROC glad_glPointParameterivNV;
+    PFNGLPRESENTFRAMEKEYEDNVPROC glad_glPresentFrameKeyedNV;
+    PFNGLPRESENTFRAMEDUALFILLNVPROC glad_glPresentFrameDualFillNV;
+    PFNGLGETVIDEOIVNVPROC glad_glGetVideoivNV;
+    PFNGLGETVIDEOUIVNVPROC glad_glGetVideouivNV;
+    PFNGLGETVIDEOI64VNVPROC glad_glGetVideoi64vNV;
+    PFNGLGETVIDEOUI64VNVPROC glad_glGetVideoui64vNV;
+    PFNGLPRIMITIVERESTARTNVPROC glad_glPrimitiveRestartNV;
+    PFNGLPRIMITIVERESTARTINDEXNVPROC glad_glPrimitiveRestartIndexNV;
+    PFNGLQUERYRESOURCENVPROC glad_glQueryResourceNV;
+    PFNGLGENQUERYRESOURCETAGNVPROC glad_glGenQueryResourceTagNV;
+    PFNGLDELETEQUERYRESOURCETAGNVPROC glad_glDeleteQueryResourceTagNV;
+    PFNGLQUERYRESOURCETAGNVPROC glad_glQueryResourceTagNV;
+    PFNGLCOMBINERPARAMETERFVNVPROC glad_glCombinerParameterfvNV;
+    PFNGLCOMBINERPARAMETERFNVPROC glad_glCombinerParameterfNV;
+    PFNGLCOMBINERPARAMETERIVNVPROC glad_glCombinerParameterivNV;
+    PFNGLCOMBINERPARAMETERINVPROC glad_glCombinerParameteriNV;
+    PFNGLCOMBINERINPUTNVPROC glad_glCombinerInputNV;
+    PFNGLCOMBINEROUTPUTNVPROC glad_glCombinerOutputNV;
+    PFNGLFINALCOMBINERINPUTNVPROC glad_glFinalCombinerInputNV;
+    PFNGLGETCOMBINERINPUTPARAMETERFVNVPROC glad_glGetCombinerInputParameterfvNV;
+    PFNGLGETCOMBINERINPUTPARAMETERIVNVPROC glad_glGetCombinerInputParameterivNV;
+    PFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC glad_glGetCombinerOutputParameterfvNV;
+    PFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC glad_glGetCombinerOutputParameterivNV;
+    PFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC glad_glGetFinalCombinerInputParameterfvNV;
+    PFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC glad_glGetFinalCombinerInputParameterivNV;
+    PFNGLCOMBINERSTAGEPARAMETERFVNVPROC glad_glCombinerStageParameterfvNV;
+    PFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC glad_glGetCombinerStageParameterfvNV;
+    PFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC glad_glFramebufferSampleLocationsfvNV;
+    PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC glad_glNamedFramebufferSampleLocationsfvNV;
+    PFNGLRESOLVEDEPTHVALUESNVPROC glad_glResolveDepthValuesNV;
+    PFNGLSCISSOREXCLUSIVENVPROC glad_glScissorExclusiveNV;
+    PFNGLSCISSOREXCLUSIVEARRAYVNVPROC glad_glScissorExclusiveArrayvNV;
+    PFNGLMAKEBUFFERRESIDENTNVPROC glad_glMakeBufferResidentNV;
+    PFNGLMAKEBUFFERNONRESIDENTNVPROC glad_glMakeBufferNonResidentNV;
+    PFNGLISBUFFERRESIDENTNVPROC glad_glIsBufferResidentNV;
+    PFNGLMAKENAMEDBUFFERRESIDENTNVPROC glad_glMakeNamedBufferResidentNV;
+    PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC glad_glMakeNamedBufferNonResidentNV;
+    PFNGLISNAMEDBUFFERRESIDENTNVPROC glad_glIsNamedBufferResidentNV;
+    PFNGLGETBUFFERPARAMETERUI64VNVPROC glad_glGetBufferParameterui64vNV;
+    PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC glad_glGetNamedBufferParameterui64vNV;
+    PFNGLGETINTEGERUI64VNVPROC glad_glGetIntegerui64vNV;
+    PFNGLUNIFORMUI64NVPROC glad_glUniformui64NV;
+    PFNGLUNIFORMUI64VNVPROC glad_glUniformui64vNV;
+    PFNGLPROGRAMUNIFORMUI64NVPROC glad_glProgramUniformui64NV;
+    PFNGLPROGRAMUNIFORMUI64VNVPROC glad_glProgramUniformui64vNV;
+    PFNGLBINDSHADINGRATEIMAGENVPROC glad_glBindShadingRateImageNV;
+    PFNGLGETSHADINGRATEIMAGEPALETTENVPROC glad_glGetShadingRateImagePaletteNV;
+    PFNGLGETSHADINGRATESAMPLELOCATIONIVNVPROC glad_glGetShadingRateSampleLocationivNV;
+    PFNGLSHADINGRATEIMAGEBARRIERNVPROC glad_glShadingRateImageBarrierNV;
+    PFNGLSHADINGRATEIMAGEPALETTENVPROC glad_glShadingRateImagePaletteNV;
+    PFNGLSHADINGRATESAMPLEORDERNVPROC glad_glShadingRateSampleOrderNV;
+    PFNGLSHADINGRATESAMPLEORDERCUSTOMNVPROC glad_glShadingRateSampleOrderCustomNV;
+    PFNGLTEXTUREBARRIERNVPROC glad_glTextureBarrierNV;
+    PFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC glad_glTexImage2DMultisampleCoverageNV;
+    PFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC glad_glTexImage3DMultisampleCoverageNV;
+    PFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC glad_glTextureImage2DMultisampleNV;
+    PFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC glad_glTextureImage3DMultisampleNV;
+    PFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC glad_glTextureImage2DMultisampleCoverageNV;
+    PFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC glad_glTextureImage3DMultisampleCoverageNV;
+    PFNGLCREATESEMAPHORESNVPROC glad_glCreateSemaphoresNV;
+    PFNGLSEMAPHOREPARAMETERIVNVPROC glad_glSemaphoreParameterivNV;
+    PFNGLGETSEMAPHOREPARAMETERIVNVPROC glad_glGetSemaphoreParameterivNV;
+    PFNGLBEGINTRANSFORMFEEDBACKNVPROC glad_glBeginTransformFeedbackNV;
+    PFNGLENDTRANSFORMFEEDBACKNVPROC glad_glEndTransformFeedbackNV;
+    PFNGLTRANSFORMFEEDBACKATTRIBSNVPROC glad_glTransformFeedbackAttribsNV;
+    PFNGLBINDBUFFERRANGENVPROC glad_glBindBufferRangeNV;
+    PFNGLBINDBUFFEROFFSETNVPROC glad_glBindBufferOffsetNV;
+    PFNGLBINDBUFFERBASENVPROC glad_glBindBufferBaseNV;
+    PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC glad_glTransformFeedbackVaryingsNV;
+    PFNGLACTIVEVARYINGNVPROC glad_glActiveVaryingNV;
+    PFNGLGETVARYINGLOCATIONNVPROC glad_glGetVaryingLocationNV;
+    PFNGLGETACTIVEVARYINGNVPROC glad_glGetActiveVaryingNV;
+    PFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC glad_glGetTransformFeedbackVaryingNV;
+    PFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC glad_glTransformFeedbackStreamAttribsNV;
+    PFNGLBINDTRANSFORMFEEDBACKNVPROC glad_glBindTransformFeedbackNV;
+    PFNGLDELETETRANSFORMFEEDBACKSNVPROC glad_glDeleteTransformFeedbacksNV;
+    PFNGLGENTRANSFORMFEEDBACKSNVPROC glad_glGenTransformFeedbacksNV;
+    PFNGLISTRANSFORMFEEDBACKNVPROC glad_glIsTransformFeedbackNV;
+    PFNGLPAUSETRANSFORMFEEDBACKNVPROC glad_glPauseTransformFeedbackNV;
+    PFNGLRESUMETRANSFORMFEEDBACKNVPROC glad_glResumeTransformFeedbackNV;
+    PFNGLDRAWTRANSFORMFEEDBACKNVPROC glad_glDrawTransformFeedbackNV;
+    PFNGLVDPAUINITNVPROC glad_glVDPAUInitNV;
+    PFNGLVDPAUFININVPROC glad_glVDPAUFiniNV;
+    PFNGLVDPAUREGISTERVIDEOSURFACENVPROC glad_glVDPAURegisterVideoSurfaceNV;
+    PFNGLVDPAUREGISTEROUTPUTSURFACENVPROC glad_glVDPAURegisterOutputSurfaceNV;
+    PFNGLVDPAUISSURFACENVPROC glad_glVDPAUIsSurfaceNV;
+    PFNGLVDPAUUNREGISTERSURFACENVPROC glad_glVDPAUUnregisterSurfaceNV;
+    PFNGLVDPAUGETSURFACEIVNVPROC glad_glVDPAUGetSurfaceivNV;
+    PFNGLVDPAUSURFACEACCESSNVPROC glad_glVDPAUSurfaceAccessNV;
+    PFNGLVDPAUMAPSURFACESNVPROC glad_glVDPAUMapSurfacesNV;
+    PFNGLVDPAUUNMAPSURFACESNVPROC glad_glVDPAUUnmapSurfacesNV;
+    PFNGLVDPAUREGISTERVIDEOSURFACEWITHPICTURESTRUCTURENVPROC glad_glVDPAURegisterVideoSurfaceWithPictureStructureNV;
+    PFNGLFLUSHVERTEXARRAYRANGENVPROC glad_glFlushVertexArrayRangeNV;
+    PFNGLVERTEXARRAYRANGENVPROC glad_glVertexArrayRangeNV;
+    PFNGLVERTEXATTRIBL1I64NVPROC glad_glVertexAttribL1i64NV;
+    PFNGLVERTEXATTRIBL2I64NVPROC glad_glVertexAttribL2i64NV;
+    PFNGLVERTEXATTRIBL3I64NVPROC glad_glVertexAttribL3i64NV;
+    PFNGLVERTEXATTRIBL4I64NVPROC glad_glVertexAttribL4i64NV;
+    PFNGLVERTEXATTRIBL1I64VNVPROC glad_glVertexAttribL1i64vNV;
+    PFNGLVERTEXATTRIBL2I64VNVPROC glad_glVertexAttribL2i64vNV;
+    PFNGLVERTEXATTRIBL3I64VNVPROC glad_glVertexAttribL3i64vNV;
+    PFNGLVERTEXATTRIBL4I64VNVPROC glad_glVertexAttribL4i64vNV;
+    PFNGLVERTEXATTRIBL1UI64NVPROC glad_glVertexAttribL1ui64NV;
+    PFNGLVERTEXATTRIBL2UI64NVPROC glad_glVertexAttribL2ui64NV;
+    PFNGLVERTEXATTRIBL3UI64NVPROC glad_glVertexAttribL3ui64NV;
+    PFNGLVERTEXATTRIBL4UI64NVPROC glad_glVertexAttribL4ui64NV;
+    PFNGLVERTEXATTRIBL1UI64VNVPROC glad_glVertexAttribL1ui64vNV;
+    PFNGLVERTEXATTRIBL2UI64VNVPROC glad_glVertexAttribL2ui64vNV;
+    PFNGLVERTEXATTRIBL3UI64VNVPROC glad_glVertexAttribL3ui64vNV;
+    PFNGLVERTEXATTRIBL4UI64VNVPROC glad_glVertexAttribL4ui64vNV;
+    PFNGLGETVERTEXATTRIBLI64VNVPROC glad_glGetVertexAttribLi64vNV;
+    PFNGLGETVERTEXATTRIBLUI64VNVPROC glad_glGetVertexAttribLui64vNV;
+    PFNGLVERTEXATTRIBLFORMATNVPROC glad_glVertexAttribLFormatNV;
+    PFNGLBUFFERADDRESSRANGENVPROC glad_glBufferAddressRangeNV;
+    PFNGLVERTEXFORMATNVPROC glad_glVertexFormatNV;
+    PFNGLNORMALFORMATNVPROC glad_glNormalFormatNV;
+    PFNGLCOLORFORMATNVPROC glad_glColorFormatNV;
+    PFNGLINDEXFORMATNVPROC glad_glIndexFormatNV;
+    PFNGLTEXCOORDFORMATNVPROC glad_glTexCoordFormatNV;
+    PFNGLEDGEFLAGFORMATNVPROC glad_glEdgeFlagFormatNV;
+    PFNGLSECONDARYCOLORFORMATNVPROC glad_glSecondaryColorFormatNV;
+    PFNGLFOGCOORDFORMATNVPROC glad_glFogCoordFormatNV;
+    PFNGLVERTEXATTRIBFORMATNVPROC glad_glVertexAttribFormatNV;
+    PFNGLVERTEXATTRIBIFORMATNVPROC glad_glVertexAttribIFormatNV;
+    PFNGLGETINTEGERUI64I_VNVPROC glad_glGetIntegerui64i_vNV;
+    PFNGLAREPROGRAMSRESIDENTNVPROC glad_glAreProgramsResidentNV;
+    PFNGLBINDPROGRAMNVPROC glad_glBindProgramNV;
+    PFNGLDELETEPROGRAMSNVPROC glad_glDeleteProgramsNV;
+    PFNGLEXECUTEPROGRAMNVPROC glad_glExecuteProgramNV;
+    PFNGLGENPROGRAMSNVPROC glad_glGenProgramsNV;
+    PFNGLGETPROGRAMPARAMETERDVNVPROC glad_glGetProgramParameterdvNV;
+    PFNGLGETPROGRAMPARAMETERFVNVPROC glad_glGetProgramParameterfvNV;
+    PFNGLGETPROGRAMIVNVPROC glad_glGetProgramivNV;
+    PFNGLGETPROGRAMSTRINGNVPROC glad_glGetProgramStringNV;
+    PFNGLGETTRACKMATRIXIVNVPROC glad_glGetTrackMatrixivNV;
+    PFNGLGETVERTEXATTRIBDVNVPROC glad_glGetVertexAttribdvNV;
+    PFNGLGETVERTEXATTRIBFVNVPROC glad_glGetVertexAttribfvNV;
+    PFNGLGETVERTEXATTRIBIVNVPROC glad_glGetVertexAttribivNV;
+    PFNGLGETVERTEXATTRIBPOINTERVNVPROC glad_glGetVertexAttribPointervNV;
+    PFNGLISPROGRAMNVPROC glad_glIsProgramNV;
+    PFNGLLOADPROGRAMNVPROC glad_glLoadProgramNV;
+    PFNGLPROGRAMPARAMETER4DNVPROC glad_glProgramParameter4dNV;
+    PFNGLPROGRAMPARAMETER4DVNVPROC glad_glProgramParameter4dvNV;
+    PFNGLPROGRAMPARAMETER4FNVPROC glad_glProgramParameter4fNV;
+    PFNGLPROGRAMPARAMETER4FVNVPROC glad_glProgramParameter4fvNV;
+    PFNGLPROGRAMPARAMETERS4DVNVPROC glad_glProgramParameters4dvNV;
+    PFNGLPROGRAMPARAMETERS4FVNVPROC glad_glProgramParameters4fvNV;
+    PFNGLREQUESTRESIDENTPROGRAMSNVPROC glad_glRequestResidentProgramsNV;
+    PFNGLTRACKMATRIXNVPROC glad_glTrackMatrixNV;
+    PFNGLVERTEXATTRIBPOINTERNVPROC glad_glVertexAttribPointerNV;
+    PFNGLVERTEXATTRIB1DNVPROC glad_glVertexAttrib1dNV;
+    PFNGLVERTEXATTRIB1DVNVPROC glad_glVertexAttrib1dvNV;
+    PFNGLVERTEXATTRIB1FNVPROC glad_glVertexAttrib1fNV;
+    PFNGLVERTEXATTRIB1FVNVPROC glad_glVertexAttrib1fvNV;
+    PFNGLVERTEXATTRIB1SNVPROC glad_glVertexAttrib1sNV;
+    PFNGLVERTEXATTRIB1SVNVPROC glad_glVertexAttrib1svNV;
+    PFNGLVERTEXATTRIB2DNVPROC glad_glVertexAttrib2dNV;
+    PFNGLVERTEXATTRIB2DVNVPROC glad_glVertexAttrib2dvNV;
+    PFNGLVERTEXATTRIB2FNVPROC glad_glVertexAttrib2fNV;
+    PFNGLVERTEXATTRIB2FVNVPROC glad_glVertexAttrib2fvNV;
+    PFNGLVERTEXATTRIB2SNVPROC glad_glVertexAttrib2sNV;
+    PFNGLVERTEXATTRIB2SVNVPROC glad_glVertexAttrib2svNV;
+    PFNGLVERTEXATTRIB3DNVPROC glad_glVertexAttrib3dNV;
+    PFNGLVERTEXATTRIB3DVNVPROC glad_glVertexAttrib3dvNV;
+    PFNGLVERTEXATTRIB3FNVPROC glad_glVertexAttrib3fNV;
+    PFNGLVERTEXATTRIB3FVNVPROC glad_glVertexAttrib3fvNV;
+    PFNGLVERTEXATTRIB3SNVPROC glad_glVertexAttrib3sNV;
+    PFNGLVERTEXATTRIB3SVNVPROC glad_glVertexAttrib3svNV;
+    PFNGLVERTEXATTRIB4DNVPROC glad_glVertexAttrib4dNV;
+    PFNGLVERTEXATTRIB4DVNVPROC glad_glVertexAttrib4dvNV;
+    PFNGLVERTEXATTRIB4FNVPROC glad_glVertexAttrib4fNV;
+    PFNGLVERTEXATTRIB4FVNVPROC glad_glVertexAttrib4fvNV;
+    PFNGLVERTEXATTRIB4SNVPROC glad_glVertexAttrib4sNV;
+    PFNGLVERTEXATTRIB4SVNVPROC glad_glVertexAttrib4svNV;
+    PFNGLVERTEXATTRIB4UBNVPROC glad_glVertexAttrib4ubNV;
+    PFNGLVERTEXATTRIB4UBVNVPROC glad_glVertexAttrib4ubvNV;
+    PFNGLVERTEXATTRIBS1DVNVPROC glad_glVertexAttribs1dvNV;
+    PFNGLVERTEXATTRIBS1FVNVPROC glad_glVertexAttribs1fvNV;
+    PFNGLVERTEXATTRIBS1SVNVPROC glad_glVertexAttribs1svNV;
+    PFNGLVERTEXATTRIBS2DVNVPROC glad_glVertexAttribs2dvNV;
+    PFNGLVERTEXATTRIBS2FVNVPROC glad_glVertexAttribs2fvNV;
+    PFNGLVERTEXATTRIBS2SVNVPROC glad_glVertexAttribs2svNV;
+    PFNGLVERTEXATTRIBS3DVNVPROC glad_glVertexAttribs3dvNV;
+    PFNGLVERTEXATTRIBS3FVNVPROC glad_glVertexAttribs3fvNV;
+    PFNGLVERTEXATTRIBS3SVNVPROC glad_glVertexAttribs3svNV;
+    PFNGLVERTEXATTRIBS4DVNVPROC glad_glVertexAttribs4dvNV;
+    PFNGLVERTEXATTRIBS4FVNVPROC glad_glVertexAttribs4fvNV;
+    PFNGLVERTEXATTRIBS4SVNVPROC glad_glVertexAttribs4svNV;
+    PFNGLVERTEXATTRIBS4UBVNVPROC glad_glVertexAttribs4ubvNV;
+    PFNGLBEGINVIDEOCAPTURENVPROC glad_glBeginVideoCaptureNV;
+    PFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC glad_glBindVideoCaptureStreamBufferNV;
+    PFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC glad_glBindVideoCaptureStreamTextureNV;
+    PFNGLENDVIDEOCAPTURENVPROC glad_glEndVideoCaptureNV;
+    PFNGLGETVIDEOCAPTUREIVNVPROC glad_glGetVideoCaptureivNV;
+    PFNGLGETVIDEOCAPTURESTREAMIVNVPROC glad_glGetVideoCaptureStreamivNV;
+    PFNGLGETVIDEOCAPTURESTREAMFVNVPROC glad_glGetVideoCaptureStreamfvNV;
+    PFNGLGETVIDEOCAPTURESTREAMDVNVPROC glad_glGetVideoCaptureStreamdvNV;
+    PFNGLVIDEOCAPTURENVPROC glad_glVideoCaptureNV;
+    PFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC glad_glVideoCaptureStreamParameterivNV;
+    PFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC glad_glVideoCaptureStreamParameterfvNV;
+    PFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC glad_glVideoCaptureStreamParameterdvNV;
+    PFNGLVIEWPORTSWIZZLENVPROC glad_glViewportSwizzleNV;
+    PFNGLMULTITEXCOORD1BOESPROC glad_glMultiTexCoord1bOES;
+    PFNGLMULTITEXCOORD1BVOESPROC glad_glMultiTexCoord1bvOES;
+    PFNGLMULTITEXCOORD2BOESPROC glad_glMultiTexCoord2bOES;
+    PFNGLMULTITEXCOORD2BVOESPROC glad_glMultiTexCoord2bvOES;
+    PFNGLMULTITEXCOORD3BOESPROC glad_glMultiTexCoord3bOES;
+    PFNGLMULTITEXCOORD3BVOESPROC glad_glMultiTexCoord3bvOES;
+    PFNGLMULTITEXCOORD4BOESPROC glad_glMultiTexCoord4bOES;
+    PFNGLMULTITEXCOORD4BVOESPROC glad_glMultiTexCoord4bvOES;
+    PFNGLTEXCOORD1BOESPROC glad_glTexCoord1bOES;
+    PFNGLTEXCOORD1BVOESPROC glad_glTexCoord1bvOES;
+    PFNGLTEXCOORD2BOESPROC glad_glTexCoord2bOES;
+    PFNGLTEXCOORD2BVOESPROC glad_glTexCoord2bvOES;
+    PFNGLTEXCOORD3BOESPROC glad_glTexCoord3bOES;
+    PFNGLTEXCOORD3BVOESPROC glad_glTexCoord3bvOES;
+    PFNGLTEXCOORD4BOESPROC glad_glTexCoord4bOES;
+    PFNGLTEXCOORD4BVOESPROC glad_glTexCoord4bvOES;
+    PFNGLVERTEX2BOESPROC glad_glVertex2bOES;
+    PFNGLVERTEX2BVOESPROC glad_glVertex2bvOES;
+    PFNGLVERTEX3BOESPROC glad_glVertex3bOES;
+    PFNGLVERTEX3BVOESPROC glad_glVertex3bvOES;
+    PFNGLVERTEX4BOESPROC glad_glVertex4bOES;
+    PFNGLVERTEX4BVOESPROC glad_glVertex4bvOES;
+    PFNGLALPHAFUNCXOESPROC glad_glAlphaFuncxOES;
+    PFNGLCLEARCOLORXOESPROC glad_glClearColorxOES;
+    PFNGLCLEARDEPTHXOESPROC glad_glClearDepthxOES;
+    PFNGLCLIPPLANEXOESPROC glad_glClipPlanexOES;
+    PFNGLCOLOR4XOESPROC glad_glColor4xOES;
+    PFNGLDEPTHRANGEXOESPROC glad_glDepthRangexOES;
+    PFNGLFOGXOESPROC glad_glFogxOES;
+    PFNGLFOGXVOESPROC glad_glFogxvOES;
+    PFNGLFRUSTUMXOESPROC glad_glFrustumxOES;
+    PFNGLGETCLIPPLANEXOESPROC glad_glGetClipPlanexOES;
+    PFNGLGETFIXEDVOESPROC glad_glGetFixedvOES;
+    PFNGLGETTEXENVXVOESPROC glad_glGetTexEnvxvOES;
+    PFNGLGETTEXPARAMETERXVOESPROC glad_glGetTexParameterxvOES;
+    PFNGLLIGHTMODELXOESPROC glad_glLightModelxOES;
+    PFNGLLIGHTMODELXVOESPROC glad_glLightModelxvOES;
+    PFNGLLIGHTXOESPROC glad_glLightxOES;
+    PFNGLLIGHTXVOESPROC glad_glLightxvOES;
+    PFNGLLINEWIDTHXOESPROC glad_glLineWidthxOES;
+    PFNGLLOADMATRIXXOESPROC glad_glLoadMatrixxOES;
+    PFNGLMATERIALXOESPROC glad_glMaterialxOES;
+    PFNGLMATERIALXVOESPROC glad_glMaterialxvOES;
+    PFNGLMULTMATRIXXOESPROC glad_glMultMatrixxOES;
+    PFNGLMULTITEXCOORD4XOESPROC glad_glMultiTexCoord4xOES;
+    PFNGLNORMAL3XOESPROC glad_glNormal3xOES;
+    PFNGLORTHOXOESPROC glad_glOrthoxOES;
+    PFNGLPOINTPARAMETERXVOESPROC glad_glPointParameterxvOES;
+    PFNGLPOINTSIZEXOESPROC glad_glPointSizexOES;
+    PFNGLPOLYGONOFFSETXOESPROC glad_glPolygonOffsetxOES;
+    PFNGLROTATEXOESPROC glad_glRotatexOES;
+    PFNGLSCALEXOESPROC glad_glScalexOES;
+    PFNGLTEXENVXOESPROC glad_glTexEnvxOES;
+    PFNGLTEXENVXVOESPROC glad_glTexEnvxvOES;
+    PFNGLTEXPARAMETERXOESPROC glad_glTexParameterxOES;
+    PFNGLTEXPARAMETERXVOESPROC glad_glTexParameterxvOES;
+    PFNGLTRANSLATEXOESPROC glad_glTranslatexOES;
+    PFNGLGETLIGHTXVOESPROC glad_glGetLightxvOES;
+    PFNGLGETMATERIALXVOESPROC glad_glGetMaterialxvOES;
+    PFNGLPOINTPARAMETERXOESPROC glad_glPointParameterxOES;
+    PFNGLSAMPLECOVERAGEXOESPROC glad_glSampleCoveragexOES;
+    PFNGLACCUMXOESPROC glad_glAccumxOES;
+    PFNGLBITMAPXOESPROC glad_glBitmapxOES;
+    PFNGLBLENDCOLORXOESPROC glad_glBlendColorxOES;
+    PFNGLCLEARACCUMXOESPROC glad_glClearAccumxOES;
+    PFNGLCOLOR3XOESPROC glad_glColor3xOES;
+    PFNGLCOLOR3XVOESPROC glad_glColor3xvOES;
+    PFNGLCOLOR4XVOESPROC glad_glColor4xvOES;
+    PFNGLCONVOLUTIONPARAMETERXOESPROC glad_glConvolutionParameterxOES;
+    PFNGLCONVOLUTIONPARAMETERXVOESPROC glad_glConvolutionParameterxvOES;
+    PFNGLEVALCOORD1XOESPROC glad_glEvalCoord1xOES;
+    PFNGLEVALCOORD1XVOESPROC glad_glEvalCoord1xvOES;
+    PFNGLEVALCOORD2XOESPROC glad_glEvalCoord2xOES;
+    PFNGLEVALCOORD2XVOESPROC glad_glEvalCoord2xvOES;
+    PFNGLFEEDBACKBUFFERXOESPROC glad_glFeedbackBufferxOES;
+    PFNGLGETCONVOLUTIONPARAMETERXVOESPROC glad_glGetConvolutionParameterxvOES;
+    PFNGLGETHISTOGRAMPARAMETERXVOESPROC glad_glGetHistogramParameterxvOES;
+    PFNGLGETLIGHTXOESPROC glad_glGetLightxOES;
+    PFNGLGETMAPXVOESPROC glad_glGetMapxvOES;
+    PFNGLGETMATERIALXOESPROC glad_glGetMaterialxOES;
+    PFNGLGETPIXELMAPXVPROC glad_glGetPixelMapxv;
+    PFNGLGETTEXGENXVOESPROC glad_glGetTexGenxvOES;
+    PFNGLGETTEXLEVELPARAMETERXVOESPROC glad_glGetTexLevelParameterxvOES;
+    PFNGLINDEXXOESPROC glad_glIndexxOES;
+    PFNGLINDEXXVOESPROC glad_glIndexxvOES;
+    PFNGLLOADTRANSPOSEMATRIXXOESPROC glad_glLoadTransposeMatrixxOES;
+    PFNGLMAP1XOESPROC glad_glMap1xOES;
+    PFNGLMAP2XOESPROC glad_glMap2xOES;
+    PFNGLMAPGRID1XOESPROC glad_glMapGrid1xOES;
+    PFNGLMAPGRID2XOESPROC glad_glMapGrid2xOES;
+    PFNGLMULTTRANSPOSEMATRIXXOESPROC glad_glMultTransposeMatrixxOES;
+    PFNGLMULTITEXCOORD1XOESPROC glad_glMultiTexCoord1xOES;
+    PFNGLMULTITEXCOORD1XVOESPROC glad_glMultiTexCoord1xvOES;
+    PFNGLMULTITEXCOORD2XOESPROC glad_glMultiTexCoord2xOES;
+    PFNGLMULTITEXCOORD2XVOESPROC glad_glMultiTexCoord2xvOES;
+    PFNGLMULTITEXCOORD3XOESPROC glad_glMultiTexCoord3xOES;
+    PFNGLMULTITEXCOORD3XVOESPROC glad_glMultiTexCoord3xvOES;
+    PFNGLMULTITEXCOORD4XVOESPROC glad_glMultiTexCoord4xvOES;
+    PFNGLNORMAL3XVOESPROC glad_glNormal3xvOES;
+    PFNGLPASSTHROUGHXOESPROC glad_glPassThroughxOES;
+    PFNGLPIXELMAPXPROC glad_glPixelMapx;
+    PFNGLPIXELSTOREXPROC glad_glPixelStorex;
+    PFNGLPIXELTRANSFERXOESPROC glad_glPixelTransferxOES;
+    PFNGLPIXELZOOMXOESPROC glad_glPixelZoomxOES;
+    PFNGLPRIORITIZETEXTURESXOESPROC glad_glPrioritizeTexturesxOES;
+    PFNGLRASTERPOS2XOESPROC glad_glRasterPos2xOES;
+    PFNGLRASTERPOS2XVOESPROC glad_glRasterPos2xvOES;
+    PFNGLRASTERPOS3XOESPROC glad_glRasterPos3xOES;
+    PFNGLRASTERPOS3XVOESPROC glad_glRasterPos3xvOES;
+    PFNGLRASTERPOS4XOESPROC glad_glRasterPos4xOES;
+    PFNGLRASTERPOS4XVOESPROC glad_glRasterPos4xvOES;
+    PFNGLRECTXOESPROC glad_glRectxOES;
+    PFNGLRECTXVOESPROC glad_glRectxvOES;
+    PFNGLTEXCOORD1XOESPROC glad_glTexCoord1xOES;
+    PFNGLTEXCOORD1XVOESPROC glad_glTexCoord1xvOES;
+    PFNGLTEXCOORD2XOESPROC glad_glTexCoord2xOES;
+    PFNGLTEXCOORD2XVOESPROC glad_glTexCoord2xvOES;
+    PFNGLTEXCOORD3XOESPROC glad_glTexCoord3xOES;
+    PFNGLTEXCOORD3XVOESPROC glad_glTexCoord3xvOES;
+    PFNGLTEXCOORD4XOESPROC glad_glTexCoord4xOES;
+    PFNGLTEXCOORD4XVOESPROC glad_glTexCoord4xvOES;
+    PFNGLTEXGENXOESPROC glad_glTexGenxOES;
+    PFNGLTEXGENXVOESPROC glad_glTexGenxvOES;
+    PFNGLVERTEX2XOESPROC glad_glVertex2xOES;
+    PFNGLVERTEX2XVOESPROC glad_glVertex2xvOES;
+    PFNGLVERTEX3XOESPROC glad_glVertex3xOES;
+    PFNGLVERTEX3XVOESPROC glad_glVertex3xvOES;
+    PFNGLVERTEX4XOESPROC glad_glVertex4xOES;
+    PFNGLVERTEX4XVOESPROC glad_glVertex4xvOES;
+    PFNGLQUERYMATRIXXOESPROC glad_glQueryMatrixxOES;
+    PFNGLCLEARDEPTHFOESPROC glad_glClearDepthfOES;
+    PFNGLCLIPPLANEFOESPROC glad_glClipPlanefOES;
+    PFNGLDEPTHRANGEFOESPROC glad_glDepthRangefOES;
+    PFNGLFRUSTUMFOESPROC glad_glFrustumfOES;
+    PFNGLGETCLIPPLANEFOESPROC glad_glGetClipPlanefOES;
+    PFNGLORTHOFOESPROC glad_glOrthofOES;
+    PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC glad_glFramebufferTextureMultiviewOVR;
+    PFNGLHINTPGIPROC glad_glHintPGI;
+    PFNGLDETAILTEXFUNCSGISPROC glad_glDetailTexFuncSGIS;
+    PFNGLGETDETAILTEXFUNCSGISPROC glad_glGetDetailTexFuncSGIS;
+    PFNGLFOGFUNCSGISPROC glad_glFogFuncSGIS;
+    PFNGLGETFOGFUNCSGISPROC glad_glGetFogFuncSGIS;
+    PFNGLSAMPLEMASKSGISPROC glad_glSampleMaskSGIS;
+    PFNGLSAMPLEPATTERNSGISPROC glad_glSamplePatternSGIS;
+    PFNGLPIXELTEXGENPARAMETERISGISPROC glad_glPixelTexGenParameteriSGIS;
+    PFNGLPIXELTEXGENPARAMETERIVSGISPROC glad_glPixelTexGenParameterivSGIS;
+    PFNGLPIXELTEXGENPARAMETERFSGISPROC glad_glPixelTexGenParameterfSGIS;
+    PFNGLPIXELTEXGENPARAMETERFVSGISPROC glad_glPixelTexGenParameterfvSGIS;
+    PFNGLGETPIXELTEXGENPARAMETERIVSGISPROC glad_glGetPixelTexGenParameterivSGIS;
+    PFNGLGETPIXELTEXGENPARAMETERFVSGISPROC glad_glGetPixelTexGenParameterfvSGIS;
+    PFNGLPOINTPARAMETERFSGISPROC glad_glPointParameterfSGIS;
+    PFNGLPOINTPARAMETERFVSGISPROC glad_glPointParameterfvSGIS;
+    PFNGLSHARPENTEXFUNCSGISPROC glad_glSharpenTexFuncSGIS;
+    PFNGLGETSHARPENTEXFUNCSGISPROC glad_glGetSharpenTexFuncSGIS;
+    PFNGLTEXIMAGE4DSGISPROC glad_glTexImage4DSGIS;
+    PFNGLTEXSUBIMAGE4DSGISPROC glad_glTexSubImage4DSGIS;
+    PFNGLTEXTURECOLORMASKSGISPROC glad_glTextureColorMaskSGIS;
+    PFNGLGETTEXFILTERFUNCSGISPROC glad_glGetTexFilterFuncSGIS;
+    PFNGLTEXFILTERFUNCSGISPROC glad_glTexFilterFuncSGIS;
+    PFNGLASYNCMARKERSGIXPROC glad_glAsyncMarkerSGIX;
+    PFNGLFINISHASYNCSGIXPROC glad_glFinishAsyncSGIX;
+    PFNGLPOLLASYNCSGIXPROC glad_glPollAsyncSGIX;
+    PFNGLGENASYNCMARKERSSGIXPROC glad_glGenAsyncMarkersSGIX;
+    PFNGLDELETEASYNCMARKERSSGIXPROC glad_glDeleteAsyncMarkersSGIX;
+    PFNGLISASYNCMARKERSGIXPROC glad_glIsAsyncMarkerSGIX;
+    PFNGLFLUSHRASTERSGIXPROC glad_glFlushRasterSGIX;
+    PFNGLFRAGMENTCOLORMATERIALSGIXPROC glad_glFragmentColorMaterialSGIX;
+    PFNGLFRAGMENTLIGHTFSGIXPROC glad_glFragmentLightfSGIX;
+    PFNGLFRAGMENTLIGHTFVSGIXPROC glad_glFragmentLightfvSGIX;
+    PFNGLFRAGMENTLIGHTISGIXPROC glad_glFragmentLightiSGIX;
+    PFNGLFRAGMENTLIGHTIVSGIXPROC glad_glFragmentLightivSGIX;
+    PFNGLFRAGMENTLIGHTMODELFSGIXPROC glad_glFragmentLightModelfSGIX;
+    PFNGLFRAGMENTLIGHTMODELFVSGIXPROC glad_glFragmentLightModelfvSGIX;
+    PFNGLFRAGMENTLIGHTMODELISGIXPROC glad_glFragmentLightModeliSGIX;
+    PFNGLFRAGMENTLIGHTMODELIVSGIXPROC glad_glFragmentLightModelivSGIX;
+    PFNGLFRAGMENTMATERIALFSGIXPROC glad_glFragmentMaterialfSGIX;
+    PFNGLFRAGMENTMATERIALFVSGIXPROC glad_glFragmentMaterialfvSGIX;
+    PFNGLFRAGMENTMATERIALISGIXPROC glad_glFragmentMaterialiSGIX;
+    PFNGLFRAGMENTMATERIALIVSGIXPROC glad_glFragmentMaterialivSGIX;
+    PFNGLGETFRAGMENTLIGHTFVSGIXPROC glad_glGetFragmentLightfvSGIX;
+    PFNGLGETFRAGMENTLIGHTIVSGIXPROC glad_glGetFragmentLightivSGIX;
+    PFNGLGETFRAGMENTMATERIALFVSGIXPROC glad_glGetFragmentMaterialfvSGIX;
+    PFNGLGETFRAGMENTMATERIALIVSGIXPROC glad_glGetFragmentMaterialivSGIX;
+    PFNGLLIGHTENVISGIXPROC glad_glLightEnviSGIX;
+    PFNGLFRAMEZOOMSGIXPROC glad_glFrameZoomSGIX;
+    PFNGLIGLOOINTERFACESGIXPROC glad_glIglooInterfaceSGIX;
+    PFNGLGETINSTRUMENTSSGIXPROC glad_glGetInstrumentsSGIX;
+    PFNGLINSTRUMENTSBUFFERSGIXPROC glad_glInstrumentsBufferSGIX;
+    PFNGLPOLLINSTRUMENTSSGIXPROC glad_glPollInstrumentsSGIX;
+    PFNGLREADINSTRUMENTSSGIXPROC glad_glReadInstrumentsSGIX;
+    PFNGLSTARTINSTRUMENTSSGIXPROC glad_glStartInstrumentsSGIX;
+    PFNGLSTOPINSTRUMENTSSGIXPROC glad_glStopInstrumentsSGIX;
+    PFNGLGETLISTPARAMETERFVSGIXPROC glad_glGetListParameterfvSGIX;
+    PFNGLGETLISTPARAMETERIVSGIXPROC glad_glGetListParameterivSGIX;
+    PFNGLLISTPARAMETERFSGIXPROC glad_glListParameterfSGIX;
+    PFNGLLISTPARAMETERFVSGIXPROC glad_glListParameterfvSGIX;
+    PFNGLLISTPARAMETERISGIXPROC glad_glListParameteriSGIX;
+    PFNGLLISTPARAMETERIVSGIXPROC glad_glListParameterivSGIX;
+    PFNGLPIXELTEXGENSGIXPROC glad_glPixelTexGenSGIX;
+    PFNGLDEFORMATIONMAP3DSGIXPROC glad_glDeformationMap3dSGIX;
+    PFNGLDEFORMATIONMAP3FSGIXPROC glad_glDeformationMap3fSGIX;
+    PFNGLDEFORMSGIXPROC glad_glDeformSGIX;
+    PFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC glad_glLoadIdentityDeformationMapSGIX;
+    PFNGLREFERENCEPLANESGIXPROC glad_glReferencePlaneSGIX;
+    PFNGLSPRITEPARAMETERFSGIXPROC glad_glSpriteParameterfSGIX;
+    PFNGLSPRITEPARAMETERFVSGIXPROC glad_glSpriteParameterfvSGIX;
+    PFNGLSPRITEPARAMETERISGIXPROC glad_glSpriteParameteriSGIX;
+    PFNGLSPRITEPARAMETERIVSGIXPROC glad_glSpriteParameterivSGIX;
+    PFNGLTAGSAMPLEBUFFERSGIXPROC glad_glTagSampleBufferSGIX;
+    PFNGLCOLORTABLESGIPROC glad_glColorTableSGI;
+    PFNGLCOLORTABLEPARAMETERFVSGIPROC glad_glColorTableParameterfvSGI;
+    PFNGLCOLORTABLEPARAMETERIVSGIPROC glad_glColorTableParameterivSGI;
+    PFNGLCOPYCOLORTABLESGIPROC glad_glCopyColorTableSGI;
+    PFNGLGETCOLORTABLESGIPROC glad_glGetColorTableSGI;
+    PFNGLGETCOLORTABLEPARAMETERFVSGIPROC glad_glGetColorTableParameterfvSGI;
+    PFNGLGETCOLORTABLEPARAMETERIVSGIPROC glad_glGetColorTableParameterivSGI;
+    PFNGLFINISHTEXTURESUNXPROC glad_glFinishTextureSUNX;
+    PFNGLGLOBALALPHAFACTORBSUNPROC glad_glGlobalAlphaFactorbSUN;
+    PFNGLGLOBALALPHAFACTORSSUNPROC glad_glGlobalAlphaFactorsSUN;
+    PFNGLGLOBALALPHAFACTORISUNPROC glad_glGlobalAlphaFactoriSUN;
+    PFNGLGLOBALALPHAFACTORFSUNPROC glad_glGlobalAlphaFactorfSUN;
+    PFNGLGLOBALALPHAFACTORDSUNPROC glad_glGlobalAlphaFactordSUN;
+    PFNGLGLOBALALPHAFACTORUBSUNPROC glad_glGlobalAlphaFactorubSUN;
+    PFNGLGLOBALALPHAFACTORUSSUNPROC glad_glGlobalAlphaFactorusSUN;
+    PFNGLGLOBALALPHAFACTORUISUNPROC glad_glGlobalAlphaFactoruiSUN;
+    PFNGLDRAWMESHARRAYSSUNPROC glad_glDrawMeshArraysSUN;
+    PFNGLREPLACEMENTCODEUISUNPROC glad_glReplacementCodeuiSUN;
+    PFNGLREPLACEMENTCODEUSSUNPROC glad_glReplacementCodeusSUN;
+    PFNGLREPLACEMENTCODEUBSUNPROC glad_glReplacementCodeubSUN;
+    PFNGLREPLACEMENTCODEUIVSUNPROC glad_glReplacementCodeuivSUN;
+    PFNGLREPLACEMENTCODEUSVSUNPROC glad_glReplacementCodeusvSUN;
+    PFNGLREPLACEMENTCODEUBVSUNPROC glad_glReplacementCodeubvSUN;
+    PFNGLREPLACEMENTCODEPOINTERSUNPROC glad_glReplacementCodePointerSUN;
+    PFNGLCOLOR4UBVERTEX2FSUNPROC glad_glColor4ubVertex2fSUN;
+    PFNGLCOLOR4UBVERTEX2FVSUNPROC glad_glColor4ubVertex2fvSUN;
+    PFNGLCOLOR4UBVERTEX3FSUNPROC glad_glColor4ubVertex3fSUN;
+    PFNGLCOLOR4UBVERTEX3FVSUNPROC glad_glColor4ubVertex3fvSUN;
+    PFNGLCOLOR3FVERTEX3FSUNPROC glad_glColor3fVertex3fSUN;
+    PFNGLCOLOR3FVERTEX3FVSUNPROC glad_glColor3fVertex3fvSUN;
+    PFNGLNORMAL3FVERTEX3FSUNPROC glad_glNormal3fVertex3fSUN;
+    PFNGLNORMAL3FVERTEX3FVSUNPROC glad_glNormal3fVertex3fvSUN;
+    PFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC glad_glColor4fNormal3fVertex3fSUN;
+    PFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC glad_glColor4fNormal3fVertex3fvSUN;
+    PFNGLTEXCOORD2FVERTEX3FSUNPROC glad_glTexCoord2fVertex3fSUN;
+    PFNGLTEXCOORD2FVERTEX3FVSUNPROC glad_glTexCoord2fVertex3fvSUN;
+    PFNGLTEXCOORD4FVERTEX4FSUNPROC glad_glTexCoord4fVertex4fSUN;
+    PFNGLTEXCOORD4FVERTEX4FVSUNPROC glad_glTexCoord4fVertex4fvSUN;
+    PFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC glad_glTexCoord2fColor4ubVertex3fSUN;
+    PFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC glad_glTexCoord2fColor4ubVertex3fvSUN;
+    PFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC glad_glTexCoord2fColor3fVertex3fSUN;
+    PFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC glad_glTexCoord2fColor3fVertex3fvSUN;
+    PFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC glad_glTexCoord2fNormal3fVertex3fSUN;
+    PFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC glad_glTexCoord2fNormal3fVertex3fvSUN;
+    PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC glad_glTexCoord2fColor4fNormal3fVertex3fSUN;
+    PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC glad_glTexCoord2fColor4fNormal3fVertex3fvSUN;
+    PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC glad_glTexCoord4fColor4fNormal3fVertex4fSUN;
+    PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC glad_glTexCoord4fColor4fNormal3fVertex4fvSUN;
+    PFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC glad_glReplacementCodeuiVertex3fSUN;
+    PFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC glad_glReplacementCodeuiVertex3fvSUN;
+    PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC glad_glReplacementCodeuiColor4ubVertex3fSUN;
+    PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC glad_glReplacementCodeuiColor4ubVertex3fvSUN;
+    PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC glad_glReplacementCodeuiColor3fVertex3fSUN;
+    PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC glad_glReplacementCodeuiColor3fVertex3fvSUN;
+    PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC glad_glReplacementCodeuiNormal3fVertex3fSUN;
+    PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC glad_glReplacementCodeuiNormal3fVertex3fvSUN;
+    PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC glad_glReplacementCodeuiColor4fNormal3fVertex3fSUN;
+    PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC glad_glReplacementCodeuiColor4fNormal3fVertex3fvSUN;
+    PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC glad_glReplacementCodeuiTexCoord2fVertex3fSUN;
+    PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC glad_glReplacementCodeuiTexCoord2fVertex3fvSUN;
+    PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC glad_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN;
+    PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC glad_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN;
+    PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC glad_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN;
+    PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC glad_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN;
+#endif
+    /* Extension set built by the loader */
+    char **ext_names;
+    unsigned int *ext_hashes;
+    size_t ext_mask;
+    /* Resolver used by lazy entries */
+    GLADloadproc load;
+    /* Owned by the code embedding glad */
+    void *user;
+};
+
+/* Used by threads that never select a context */
+GLAPI struct gladGLContext glad_gl_default;
+GLAPI GLAD_THREAD_LOCAL struct gladGLContext *glad_gl_current;
+
+/* Loads a new context's table from the GL context current on this
+   thread and selects it. Returns NULL (leaving the selection alone)
+   on failure. */
+GLAPI struct gladGLContext *gladCreateGLContext(int lazy);
+/* The same, resolving through load (e.g. gladGetProcAddressEGL). */
+GLAPI struct gladGLContext *gladCreateGLContextLoader(GLADloadproc load, int lazy);
+/* Selects the table used by GL calls on this thread; NULL selects
+   glad_gl_default. */
+GLAPI void gladMakeGLContextCurrent(struct gladGLContext *context);
+GLAPI struct gladGLContext *gladGetGLContext(void);
+GLAPI void gladDestroyGLContext(struct gladGLContext *context);
+
+#define GLVersion (glad_gl_current->GLVersion)
+#define GLAD_GL_VERSION_1_0 (glad_gl_current->GLAD_GL_VERSION_1_0)
+#define GLAD_GL_VERSION_1_1 (glad_gl_current->GLAD_GL_VERSION_1_1)
+#define GLAD_GL_VERSION_1_2 (glad_gl_current->GLAD_GL_VERSION_1_2)
+#define GLAD_GL_VERSION_1_3 (glad_gl_current->GLAD_GL_VERSION_1_3)
+#define GLAD_GL_VERSION_1_4 (glad_gl_current->GLAD_GL_VERSION_1_4)
+#define GLAD_GL_VERSION_1_5 (glad_gl_current->GLAD_GL_VERSION_1_5)
+#define GLAD_GL_VERSION_2_0 (glad_gl_current->GLAD_GL_VERSION_2_0)
+#define GLAD_GL_VERSION_2_1 (glad_gl_current->GLAD_GL_VERSION_2_1)
+#define GLAD_GL_VERSION_3_0 (glad_gl_current->GLAD_GL_VERSION_3_0)
+#define GLAD_GL_VERSION_3_1 (glad_gl_current->GLAD_GL_VERSION_3_1)
+#define GLAD_GL_VERSION_3_2 (glad_gl_current->GLAD_GL_VERSION_3_2)
+#define GLAD_GL_VERSION_3_3 (glad_gl_current->GLAD_GL_VERSION_3_3)
+#define GLAD_GL_VERSION_4_0 (glad_gl_current->GLAD_GL_VERSION_4_0)
+#define GLAD_GL_VERSION_4_1 (glad_gl_current->GLAD_GL_VERSION_4_1)
+#define GLAD_GL_VERSION_4_2 (glad_gl_current->GLAD_GL_VERSION_4_2)
+#define GLAD_GL_VERSION_4_3 (glad_gl_current->GLAD_GL_VERSION_4_3)
+#define GLAD_GL_VERSION_4_4 (glad_gl_current->GLAD_GL_VERSION_4_4)
+#define GLAD_GL_VERSION_4_5 (glad_gl_current->GLAD_GL_VERSION_4_5)
+#define GLAD_GL_ARB_bindless_texture (glad_gl_current->GLAD_GL_ARB_bindless_texture)
+#define GLAD_GL_ARB_buffer_storage (glad_gl_current->GLAD_GL_ARB_buffer_storage)
+#define GLAD_GL_ARB_get_program_binary (glad_gl_current->GLAD_GL_ARB_get_program_binary)
+#define GLAD_GL_ARB_gl_spirv (glad_gl_current->GLAD_GL_ARB_gl_spirv)
+#define GLAD_GL_ARB_indirect_parameters (glad_gl_current->GLAD_GL_ARB_indirect_parameters)
+#define GLAD_GL_ARB_multi_draw_indirect (glad_gl_current->GLAD_GL_ARB_multi_draw_indirect)
+#define GLAD_GL_ARB_parallel_shader_compile (glad_gl_current->GLAD_GL_ARB_parallel_shader_compile)
+#define GLAD_GL_ARB_pipeline_statistics_query (glad_gl_current->GLAD_GL_ARB_pipeline_statistics_query)
+#define GLAD_GL_ARB_polygon_offset_clamp (glad_gl_current->GLAD_GL_ARB_polygon_offset_clamp)
+#define GLAD_GL_ARB_shader_draw_parameters (glad_gl_current->GLAD_GL_ARB_shader_draw_parameters)
+#define GLAD_GL_ARB_sparse_buffer (glad_gl_current->GLAD_GL_ARB_sparse_buffer)
+#define GLAD_GL_ARB_sparse_texture (glad_gl_current->GLAD_GL_ARB_sparse_texture)
+#define GLAD_GL_ARB_spirv_extensions (glad_gl_current->GLAD_GL_ARB_spirv_extensions)
+#define GLAD_GL_ARB_sync (glad_gl_current->GLAD_GL_ARB_sync)
+#define GLAD_GL_ARB_texture_filter_anisotropic (glad_gl_current->GLAD_GL_ARB_texture_filter_anisotropic)
+#define GLAD_GL_EXT_texture_compression_s3tc (glad_gl_current->GLAD_GL_EXT_texture_compression_s3tc)
+#define GLAD_GL_EXT_texture_filter_anisotropic (glad_gl_current->GLAD_GL_EXT_texture_filter_anisotropic)
+#define GLAD_GL_KHR_debug (glad_gl_current->GLAD_GL_KHR_debug)
+#define GLAD_GL_KHR_parallel_shader_compile (glad_gl_current->GLAD_GL_KHR_parallel_shader_compile)
+#define GLAD_GL_KHR_texture_compression_astc_ldr (glad_gl_current->GLAD_GL_KHR_texture_compression_astc_ldr)
+#ifdef GLAD_CORE_PROFILE
+#define GLAD_GL_3DFX_multisample 0
+#define GLAD_GL_3DFX_tbuffer 0
+#define GLAD_GL_3DFX_texture_compression_FXT1 0
+#define GLAD_GL_AMD_blend_minmax_factor 0
+#define GLAD_GL_AMD_conservative_depth 0
+#define GLAD_GL_AMD_debug_output 0
+#define GLAD_GL_AMD_depth_clamp_separate 0
+#define GLAD_GL_AMD_draw_buffers_blend 0
+#define GLAD_GL_AMD_framebuffer_multisample_advanced 0
+#define GLAD_GL_AMD_framebuffer_sample_positions 0
+#define GLAD_GL_AMD_gcn_shader 0
+#define GLAD_GL_AMD_gpu_shader_half_float 0
+#define GLAD_GL_AMD_gpu_shader_int16 0
+#define GLAD_GL_AMD_gpu_shader_int64 0
+#define GLAD_GL_AMD_interleaved_elements 0
+#define GLAD_GL_AMD_multi_draw_indirect 0
+#define GLAD_GL_AMD_name_gen_delete 0
+#define GLAD_GL_AMD_occlusion_query_event 0
+#define GLAD_GL_AMD_performance_monitor 0
+#define GLAD_GL_AMD_pinned_memory 0
+#define GLAD_GL_AMD_query_buffer_object 0
+#define GLAD_GL_AMD_sample_positions 0
+#define GLAD_GL_AMD_seamless_cubemap_per_texture 0
+#define GLAD_GL_AMD_shader_atomic_counter_ops 0
+#define GLAD_GL_AMD_shader_ballot 0
+#define GLAD_GL_AMD_shader_explicit_vertex_parameter 0
+#define GLAD_GL_AMD_shader_gpu_shader_half_float_fetch 0
+#define GLAD_GL_AMD_shader_image_load_store_lod 0
+#define GLAD_GL_AMD_shader_stencil_export 0
+#define GLAD_GL_AMD_shader_trinary_minmax 0
+#define GLAD_GL_AMD_sparse_texture 0
+#define GLAD_GL_AMD_stencil_operation_extended 0
+#define GLAD_GL_AMD_texture_gather_bias_lod 0
+#define GLAD_GL_AMD_texture_texture4 0
+#define GLAD_GL_AMD_transform_feedback3_lines_triangles 0
+#define GLAD_GL_AMD_transform_feedback4 0
+#define GLAD_GL_AMD_vertex_shader_layer 0
+#define GLAD_GL_AMD_vertex_shader_tessellator 0
+#define GLAD_GL_AMD_vertex_shader_viewport_index 0
+#define GLAD_GL_APPLE_aux_depth_stencil 0
+#define GLAD_GL_APPLE_client_storage 0
+#define GLAD_GL_APPLE_element_array 0
+#define GLAD_GL_APPLE_fence 0
+#define GLAD_GL_APPLE_float_pixels 0
+#define GLAD_GL_APPLE_flush_buffer_range 0
+#define GLAD_GL_APPLE_object_purgeable 0
+#define GLAD_GL_APPLE_rgb_422 0
+#define GLAD_GL_APPLE_row_bytes 0
+#define GLAD_GL_APPLE_specular_vector 0
+#define GLAD_GL_APPLE_texture_range 0
+#define GLAD_GL_APPLE_transform_hint 0
+#define GLAD_GL_APPLE_vertex_array_object 0
+#define GLAD_GL_APPLE_vertex_array_range 0
+#define GLAD_GL_APPLE_vertex_program_evaluators 0
+#define GLAD_GL_APPLE_ycbcr_422 0
+#define GLAD_GL_ARB_ES2_compatibility 0
+#define GLAD_GL_ARB_ES3_1_compatibility 0
+#define GLAD_GL_ARB_ES3_2_compatibility 0
+#define GLAD_GL_ARB_ES3_compatibility 0
+#define GLAD_GL_ARB_arrays_of_arrays 0
+#define GLAD_GL_ARB_base_instance 0
+#define GLAD_GL_ARB_blend_func_extended 0
+#define GLAD_GL_ARB_cl_event 0
+#define GLAD_GL_ARB_clear_buffer_object 0
+#define GLAD_GL_ARB_clear_texture 0
+#define GLAD_GL_ARB_clip_control 0
+#define GLAD_GL_ARB_color_buffer_float 0
+#define GLAD_GL_ARB_compatibility 0
+#define GLAD_GL_ARB_compressed_texture_pixel_storage 0
+#define GLAD_GL_ARB_compute_shader 0
+#define GLAD_GL_ARB_compute_variable_group_size 0
+#define GLAD_GL_ARB_conditional_render_inverted 0
+#define GLAD_GL_ARB_conservative_depth 0
+#define GLAD_GL_ARB_copy_buffer 0
+#define GLAD_GL_ARB_copy_image 0
+#define GLAD_GL_ARB_cull_distance 0
+#define GLAD_GL_ARB_debug_output 0
+#define GLAD_GL_ARB_depth_buffer_float 0
+#define GLAD_GL_ARB_depth_clamp 0
+#define GLAD_GL_ARB_depth_texture 0
+#define GLAD_GL_ARB_derivative_control 0
+#define GLAD_GL_ARB_direct_state_access 0
+#define GLAD_GL_ARB_draw_buffers 0
+#define GLAD_GL_ARB_draw_buffers_blend 0
+#define GLAD_GL_ARB_draw_elements_base_vertex 0
+#define GLAD_GL_ARB_draw_indirect 0
+#define GLAD_GL_ARB_draw_instanced 0
+#define GLAD_GL_ARB_enhanced_layouts 0
+#define GLAD_GL_ARB_explicit_attrib_location 0
+#define GLAD_GL_ARB_explicit_uniform_location 0
+#define GLAD_GL_ARB_fragment_coord_conventions 0
+#define GLAD_GL_ARB_fragment_layer_viewport 0
+#define GLAD_GL_ARB_fragment_program 0
+#define GLAD_GL_ARB_fragment_program_shadow 0
+#define GLAD_GL_ARB_fragment_shader 0
+#define GLAD_GL_ARB_fragment_shader_interlock 0
+#define GLAD_GL_ARB_framebuffer_no_attachments 0
+#define GLAD_GL_ARB_framebuffer_object 0
+#define GLAD_GL_ARB_framebuffer_sRGB 0
+#define GLAD_GL_ARB_geometry_shader4 0
+#define GLAD_GL_ARB_get_texture_sub_image 0
+#define GLAD_GL_ARB_gpu_shader5 0
+#define GLAD_GL_ARB_gpu_shader_fp64 0
+#define GLAD_GL_ARB_gpu_shader_int64 0
+#define GLAD_GL_ARB_half_float_pixel 0
+#define GLAD_GL_ARB_half_float_vertex 0
+#define GLAD_GL_ARB_imaging 0
+#define GLAD_GL_ARB_instanced_arrays 0
+#define GLAD_GL_ARB_internalformat_query 0
+#define GLAD_GL_ARB_internalformat_query2 0
+#define GLAD_GL_ARB_invalidate_subdata 0
+#define GLAD_GL_ARB_map_buffer_alignment 0
+#define GLAD_GL_ARB_map_buffer_range 0
+#define GLAD_GL_ARB_matrix_palette 0
+#define GLAD_GL_ARB_multi_bind 0
+#define GLAD_GL_ARB_multisample 0
+#define GLAD_GL_ARB_multitexture 0
+#define GLAD_GL_ARB_occlusion_query 0
+#define GLAD_GL_ARB_occlusion_query2 0
+#define GLAD_GL_ARB_pixel_buffer_object 0
+#define GLAD_GL_ARB_point_parameters 0
+#define GLAD_GL_ARB_point_sprite 0
+#define GLAD_GL_ARB_post_depth_coverage 0
+#define GLAD_GL_ARB_program_interface_query 0
+#define GLAD_GL_ARB_provoking_vertex 0
+#define GLAD_GL_ARB_query_buffer_object 0
+#define GLAD_GL_ARB_robust_buffer_access_behavior 0
+#define GLAD_GL_ARB_robustness 0
+#define GLAD_GL_ARB_robustness_isolation 0
+#define GLAD_GL_ARB_sample_locations 0
+#define GLAD_GL_ARB_sample_shading 0
+#define GLAD_GL_ARB_sampler_objects 0
+#define GLAD_GL_ARB_seamless_cube_map 0
+#define GLAD_GL_ARB_seamless_cubemap_per_texture 0
+#define GLAD_GL_ARB_separate_shader_objects 0
+#define GLAD_GL_ARB_shader_atomic_counter_ops 0
+#define GLAD_GL_ARB_shader_atomic_counters 0
+#define GLAD_GL_ARB_shader_ballot 0
+#define GLAD_GL_ARB_shader_bit_encoding 0
+#define GLAD_GL_ARB_shader_clock 0
+#define GLAD_GL_ARB_shader_group_vote 0
+#define GLAD_GL_ARB_shader_image_load_store 0
+#define GLAD_GL_ARB_shader_image_size 0
+#define GLAD_GL_ARB_shader_objects 0
+#define GLAD_GL_ARB_shader_precision 0
+#define GLAD_GL_ARB_shader_stencil_export 0
+#define GLAD_GL_ARB_shader_storage_buffer_object 0
+#define GLAD_GL_ARB_shader_subroutine 0
+#define GLAD_GL_ARB_shader_texture_image_samples 0
+#define GLAD_GL_ARB_shader_texture_lod 0
+#define GLAD_GL_ARB_shader_viewport_layer_array 0
+#define GLAD_GL_ARB_shading_language_100 0
+#define GLAD_GL_ARB_shading_language_420pack 0
+#define GLAD_GL_ARB_shading_language_include 0
+#define GLAD_GL_ARB_shading_language_packing 0
+#define GLAD_GL_ARB_shadow 0
+#define GLAD_GL_ARB_shadow_ambient 0
+#define GLAD_GL_ARB_sparse_texture2 0
+#define GLAD_GL_ARB_sparse_texture_clamp 0
+#define GLAD_GL_ARB_stencil_texturing 0
+#define GLAD_GL_ARB_tessellation_shader 0
+#define GLAD_GL_ARB_texture_barrier 0
+#define GLAD_GL_ARB_texture_border_clamp 0
+#define GLAD_GL_ARB_texture_buffer_object 0
+#define GLAD_GL_ARB_texture_buffer_object_rgb32 0
+#define GLAD_GL_ARB_texture_buffer_range 0
+#define GLAD_GL_ARB_texture_compression 0
+#define GLAD_GL_ARB_texture_compression_bptc 0
+#define GLAD_GL_ARB_texture_compression_rgtc 0
+#define GLAD_GL_ARB_texture_cube_map 0
+#define GLAD_GL_ARB_texture_cube_map_array 0
+#define GLAD_GL_ARB_texture_env_add 0
+#define GLAD_GL_ARB_texture_env_combine 0
+#define GLAD_GL_ARB_texture_env_crossbar 0
+#define GLAD_GL_ARB_texture_env_dot3 0
+#define GLAD_GL_ARB_texture_filter_minmax 0
+#define GLAD_GL_ARB_texture_float 0
+#define GLAD_GL_ARB_texture_gather 0
+#define GLAD_GL_ARB_texture_mirror_clamp_to_edge 0
+#define GLAD_GL_ARB_texture_mirrored_repeat 0
+#define GLAD_GL_ARB_texture_multisample 0
+#define GLAD_GL_ARB_texture_non_power_of_two 0
+#define GLAD_GL_ARB_texture_query_levels 0
+#define GLAD_GL_ARB_texture_query_lod 0
+#define GLAD_GL_ARB_texture_rectangle 0
+#define GLAD_GL_ARB_texture_rg 0
+#define GLAD_GL_ARB_texture_rgb10_a2ui 0
+#define GLAD_GL_ARB_texture_stencil8 0
+#define GLAD_GL_ARB_texture_storage 0
+#define GLAD_GL_ARB_texture_storage_multisample 0
+#define GLAD_GL_ARB_texture_swizzle 0
+#define GLAD_GL_ARB_texture_view 0
+#define GLAD_GL_ARB_timer_query 0
+#define GLAD_GL_ARB_transform_feedback2 0
+#define GLAD_GL_ARB_transform_feedback3 0
+#define GLAD_GL_ARB_transform_feedback_instanced 0
+#define GLAD_GL_ARB_transform_feedback_overflow_query 0
+#define GLAD_GL_ARB_transpose_matrix 0
+#define GLAD_GL_ARB_uniform_buffer_object 0
+#define GLAD_GL_ARB_vertex_array_bgra 0
+#define GLAD_GL_ARB_vertex_array_object 0
+#define GLAD_GL_ARB_vertex_attrib_64bit 0
+#define GLAD_GL_ARB_vertex_attrib_binding 0
+#define GLAD_GL_ARB_vertex_blend 0
+#define GLAD_GL_ARB_vertex_buffer_object 0
+#define GLAD_GL_ARB_vertex_program 0
+#define GLAD_GL_ARB_vertex_shader 0
+#define GLAD_GL_ARB_vertex_type_10f_11f_11f_rev 0
+#define GLAD_GL_ARB_vertex_type_2_10_10_10_rev 0
+#define GLAD_GL_ARB_viewport_array 0
+#define GLAD_GL_ARB_window_pos 0
+#define GLAD_GL_ATI_draw_buffers 0
+#define GLAD_GL_ATI_element_array 0
+#define GLAD_GL_ATI_envmap_bumpmap 0
+#define GLAD_GL_ATI_fragment_shader 0
+#define GLAD_GL_ATI_map_object_buffer 0
+#define GLAD_GL_ATI_meminfo 0
+#define GLAD_GL_ATI_pixel_format_float 0
+#define GLAD_GL_ATI_pn_triangles 0
+#define GLAD_GL_ATI_separate_stencil 0
+#define GLAD_GL_ATI_text_fragment_shader 0
+#define GLAD_GL_ATI_texture_env_combine3 0
+#define GLAD_GL_ATI_texture_float 0
+#define GLAD_GL_ATI_texture_mirror_once 0
+#define GLAD_GL_ATI_vertex_array_object 0
+#define GLAD_GL_ATI_vertex_attrib_array_object 0
+#define GLAD_GL_ATI_vertex_streams 0
+#define GLAD_GL_EXT_422_pixels 0
+#define GLAD_GL_EXT_EGL_image_storage 0
+#define GLAD_GL_EXT_EGL_sync 0
+#define GLAD_GL_EXT_abgr 0
+#define GLAD_GL_EXT_bgra 0
+#define GLAD_GL_EXT_bindable_uniform 0
+#define GLAD_GL_EXT_blend_color 0
+#define GLAD_GL_EXT_blend_equation_separate 0
+#define GLAD_GL_EXT_blend_func_separate 0
+#define GLAD_GL_EXT_blend_logic_op 0
+#define GLAD_GL_EXT_blend_minmax 0
+#define GLAD_GL_EXT_blend_subtract 0
+#define GLAD_GL_EXT_clip_volume_hint 0
+#define GLAD_GL_EXT_cmyka 0
+#define GLAD_GL_EXT_color_subtable 0
+#define GLAD_GL_EXT_compiled_vertex_array 0
+#define GLAD_GL_EXT_convolution 0
+#define GLAD_GL_EXT_coordinate_frame 0
+#define GLAD_GL_EXT_copy_texture 0
+#define GLAD_GL_EXT_cull_vertex 0
+#define GLAD_GL_EXT_debug_label 0
+#define GLAD_GL_EXT_debug_marker 0
+#define GLAD_GL_EXT_depth_bounds_test 0
+#define GLAD_GL_EXT_direct_state_access 0
+#define GLAD_GL_EXT_draw_buffers2 0
+#define GLAD_GL_EXT_draw_instanced 0
+#define GLAD_GL_EXT_draw_range_elements 0
+#define GLAD_GL_EXT_external_buffer 0
+#define GLAD_GL_EXT_fog_coord 0
+#define GLAD_GL_EXT_framebuffer_blit 0
+#define GLAD_GL_EXT_framebuffer_blit_layers 0
+#define GLAD_GL_EXT_framebuffer_multisample 0
+#define GLAD_GL_EXT_framebuffer_multisample_blit_scaled 0
+#define GLAD_GL_EXT_framebuffer_object 0
+#define GLAD_GL_EXT_framebuffer_sRGB 0
+#define GLAD_GL_EXT_geometry_shader4 0
+#define GLAD_GL_EXT_gpu_program_parameters 0
+#define GLAD_GL_EXT_gpu_shader4 0
+#define GLAD_GL_EXT_histogram 0
+#define GLAD_GL_EXT_index_array_formats 0
+#define GLAD_GL_EXT_index_func 0
+#define GLAD_GL_EXT_index_material 0
+#define GLAD_GL_EXT_index_texture 0
+#define GLAD_GL_EXT_light_texture 0
+#define GLAD_GL_EXT_memory_object 0
+#define GLAD_GL_EXT_memory_object_fd 0
+#define GLAD_GL_EXT_memory_object_win32 0
+#define GLAD_GL_EXT_misc_attribute 0
+#define GLAD_GL_EXT_multi_draw_arrays 0
+#define GLAD_GL_EXT_multisample 0
+#define GLAD_GL_EXT_multiview_tessellation_geometry_shader 0
+#define GLAD_GL_EXT_multiview_texture_multisample 0
+#define GLAD_GL_EXT_multiview_timer_query 0
+#define GLAD_GL_EXT_packed_depth_stencil 0
+#define GLAD_GL_EXT_packed_float 0
+#define GLAD_GL_EXT_packed_pixels 0
+#define GLAD_GL_EXT_paletted_texture 0
+#define GLAD_GL_EXT_pixel_buffer_object 0
+#define GLAD_GL_EXT_pixel_transform 0
+#define GLAD_GL_EXT_pixel_transform_color_table 0
+#define GLAD_GL_EXT_point_parameters 0
+#define GLAD_GL_EXT_polygon_offset 0
+#define GLAD_GL_EXT_polygon_offset_clamp 0
+#define GLAD_GL_EXT_post_depth_coverage 0
+#define GLAD_GL_EXT_provoking_vertex 0
+#define GLAD_GL_EXT_raster_multisample 0
+#define GLAD_GL_EXT_rescale_normal 0
+#define GLAD_GL_EXT_secondary_color 0
+#define GLAD_GL_EXT_semaphore 0
+#define GLAD_GL_EXT_semaphore_fd 0
+#define GLAD_GL_EXT_semaphore_win32 0
+#define GLAD_GL_EXT_separate_shader_objects 0
+#define GLAD_GL_EXT_separate_specular_color 0
+#define GLAD_GL_EXT_shader_framebuffer_fetch 0
+#define GLAD_GL_EXT_shader_framebuffer_fetch_non_coherent 0
+#define GLAD_GL_EXT_shader_image_load_formatted 0
+#define GLAD_GL_EXT_shader_image_load_store 0
+#define GLAD_GL_EXT_shader_integer_mix 0
+#define GLAD_GL_EXT_shader_samples_identical 0
+#define GLAD_GL_EXT_shadow_funcs 0
+#define GLAD_GL_EXT_shared_texture_palette 0
+#define GLAD_GL_EXT_sparse_texture2 0
+#define GLAD_GL_EXT_stencil_clear_tag 0
+#define GLAD_GL_EXT_stencil_two_side 0
+#define GLAD_GL_EXT_stencil_wrap 0
+#define GLAD_GL_EXT_subtexture 0
+#define GLAD_GL_EXT_texture 0
+#define GLAD_GL_EXT_texture3D 0
+#define GLAD_GL_EXT_texture_array 0
+#define GLAD_GL_EXT_texture_buffer_object 0
+#define GLAD_GL_EXT_texture_compression_latc 0
+#define GLAD_GL_EXT_texture_compression_rgtc 0
+#define GLAD_GL_EXT_texture_cube_map 0
+#define GLAD_GL_EXT_texture_env_add 0
+#define GLAD_GL_EXT_texture_env_combine 0
+#define GLAD_GL_EXT_texture_env_dot3 0
+#define GLAD_GL_EXT_texture_filter_minmax 0
+#define GLAD_GL_EXT_texture_integer 0
+#define GLAD_GL_EXT_texture_lod_bias 0
+#define GLAD_GL_EXT_texture_mirror_clamp 0
+#define GLAD_GL_EXT_texture_object 0
+#define GLAD_GL_EXT_texture_perturb_normal 0
+#define GLAD_GL_EXT_texture_sRGB 0
+#define GLAD_GL_EXT_texture_sRGB_R8 0
+#define GLAD_GL_EXT_texture_sRGB_RG8 0
+#define GLAD_GL_EXT_texture_sRGB_decode 0
+#define GLAD_GL_EXT_texture_shadow_lod 0
+#define GLAD_GL_EXT_texture_shared_exponent 0
+#define GLAD_GL_EXT_texture_snorm 0
+#define GLAD_GL_EXT_texture_storage 0
+#define GLAD_GL_EXT_texture_swizzle 0
+#define GLAD_GL_EXT_timer_query 0
+#define GLAD_GL_EXT_transform_feedback 0
+#define GLAD_GL_EXT_vertex_array 0
+#define GLAD_GL_EXT_vertex_array_bgra 0
+#define GLAD_GL_EXT_vertex_attrib_64bit 0
+#define GLAD_GL_EXT_vertex_shader 0
+#define GLAD_GL_EXT_vertex_weighting 0
+#define GLAD_GL_EXT_win32_keyed_mutex 0
+#define GLAD_GL_EXT_window_rectangles 0
+#define GLAD_GL_EXT_x11_sync_object 0
+#define GLAD_GL_GREMEDY_frame_terminator 0
+#define GLAD_GL_GREMEDY_string_marker 0
+#define GLAD_GL_HP_convolution_border_modes 0
+#define GLAD_GL_HP_image_transform 0
+#define GLAD_GL_HP_occlusion_test 0
+#define GLAD_GL_HP_texture_lighting 0
+#define GLAD_GL_IBM_cull_vertex 0
+#define GLAD_GL_IBM_multimode_draw_arrays 0
+#define GLAD_GL_IBM_rasterpos_clip 0
+#define GLAD_GL_IBM_static_data 0
+#define GLAD_GL_IBM_texture_mirrored_repeat 0
+#define GLAD_GL_IBM_vertex_array_lists 0
+#define GLAD_GL_INGR_blend_func_separate 0
+#define GLAD_GL_INGR_color_clamp 0
+#define GLAD_GL_INGR_interlace_read 0
+#define GLAD_GL_INTEL_blackhole_render 0
+#define GLAD_GL_INTEL_conservative_rasterization 0
+#define GLAD_GL_INTEL_fragment_shader_ordering 0
+#define GLAD_GL_INTEL_framebuffer_CMAA 0
+#define GLAD_GL_INTEL_map_texture 0
+#define GLAD_GL_INTEL_parallel_arrays 0
+#define GLAD_GL_INTEL_performance_query 0
+#define GLAD_GL_KHR_blend_equation_advanced 0
+#define GLAD_GL_KHR_blend_equation_advanced_coherent 0
+#define GLAD_GL_KHR_context_flush_control 0
+#define GLAD_GL_KHR_no_error 0
+#define GLAD_GL_KHR_robust_buffer_access_behavior 0
+#define GLAD_GL_KHR_robustness 0
+#define GLAD_GL_KHR_shader_subgroup 0
+#define GLAD_GL_KHR_texture_compression_astc_hdr 0
+#define GLAD_GL_KHR_texture_compression_astc_sliced_3d 0
+#define GLAD_GL_MESAX_texture_stack 0
+#define GLAD_GL_MESA_framebuffer_flip_x 0
+#define GLAD_GL_MESA_framebuffer_flip_y 0
+#define GLAD_GL_MESA_framebuffer_swap_xy 0
+#define GLAD_GL_MESA_pack_invert 0
+#define GLAD_GL_MESA_program_binary_formats 0
+#define GLAD_GL_MESA_resize_buffers 0
+#define GLAD_GL_MESA_shader_integer_functions 0
+#define GLAD_GL_MESA_tile_raster_order 0
+#define GLAD_GL_MESA_window_pos 0
+#define GLAD_GL_MESA_ycbcr_texture 0
+#define GLAD_GL_NVX_blend_equation_advanced_multi_draw_buffers 0
+#define GLAD_GL_NVX_conditional_render 0
+#define GLAD_GL_NVX_gpu_memory_info 0
+#define GLAD_GL_NVX_gpu_multicast2 0
+#define GLAD_GL_NVX_linked_gpu_multicast 0
+#define GLAD_GL_NVX_progress_fence 0
+#define GLAD_GL_NV_alpha_to_coverage_dither_control 0
+#define GLAD_GL_NV_bindless_multi_draw_indirect 0
+#define GLAD_GL_NV_bindless_multi_draw_indirect_count 0
+#define GLAD_GL_NV_bindless_texture 0
+#define GLAD_GL_NV_blend_equation_advanced 0
+#define GLAD_GL_NV_blend_equation_advanced_coherent 0
+#define GLAD_GL_NV_blend_minmax_factor 0
+#define GLAD_GL_NV_blend_square 0
+#define GLAD_GL_NV_clip_space_w_scaling 0
+#define GLAD_GL_NV_command_list 0
+#define GLAD_GL_NV_compute_program5 0
+#define GLAD_GL_NV_compute_shader_derivatives 0
+#define GLAD_GL_NV_conditional_render 0
+#define GLAD_GL_NV_conservative_raster 0
+#define GLAD_GL_NV_conservative_raster_dilate 0
+#define GLAD_GL_NV_conservative_raster_pre_snap 0
+#define GLAD_GL_NV_conservative_raster_pre_snap_triangles 0
+#define GLAD_GL_NV_conservative_raster_underestimation 0
+#define GLAD_GL_NV_copy_depth_to_color 0
+#define GLAD_GL_NV_copy_image 0
+#define GLAD_GL_NV_deep_texture3D 0
+#define GLAD_GL_NV_depth_buffer_float 0
+#define GLAD_GL_NV_depth_clamp 0
+#define GLAD_GL_NV_draw_texture 0
+#define GLAD_GL_NV_draw_vulkan_image 0
+#define GLAD_GL_NV_evaluators 0
+#define GLAD_GL_NV_explicit_multisample 0
+#define GLAD_GL_NV_fence 0
+#define GLAD_GL_NV_fill_rectangle 0
+#define GLAD_GL_NV_float_buffer 0
+#define GLAD_GL_NV_fog_distance 0
+#define GLAD_GL_NV_fragment_coverage_to_color 0
+#define GLAD_GL_NV_fragment_program 0
+#define GLAD_GL_NV_fragment_program2 0
+#define GLAD_GL_NV_fragment_program4 0
+#define GLAD_GL_NV_fragment_program_option 0
+#define GLAD_GL_NV_fragment_shader_barycentric 0
+#define GLAD_GL_NV_fragment_shader_interlock 0
+#define GLAD_GL_NV_framebuffer_mixed_samples 0
+#define GLAD_GL_NV_framebuffer_multisample_coverage 0
+#define GLAD_GL_NV_geometry_program4 0
+#define GLAD_GL_NV_geometry_shader4 0
+#define GLAD_GL_NV_geometry_shader_passthrough 0
+#define GLAD_GL_NV_gpu_multicast 0
+#define GLAD_GL_NV_gpu_program4 0
+#define GLAD_GL_NV_gpu_program5 0
+#define GLAD_GL_NV_gpu_program5_mem_extended 0
+#define GLAD_GL_NV_gpu_shader5 0
+#define GLAD_GL_NV_half_float 0
+#define GLAD_GL_NV_internalformat_sample_query 0
+#define GLAD_GL_NV_light_max_exponent 0
+#define GLAD_GL_NV_memory_attachment 0
+#define GLAD_GL_NV_memory_object_sparse 0
+#define GLAD_GL_NV_mesh_shader 0
+#define GLAD_GL_NV_multisample_coverage 0
+#define GLAD_GL_NV_multisample_filter_hint 0
+#define GLAD_GL_NV_occlusion_query 0
+#define GLAD_GL_NV_packed_depth_stencil 0
+#define GLAD_GL_NV_parameter_buffer_object 0
+#define GLAD_GL_NV_parameter_buffer_object2 0
+#define GLAD_GL_NV_path_rendering 0
+#define GLAD_GL_NV_path_rendering_shared_edge 0
+#define GLAD_GL_NV_pixel_data_range 0
+#define GLAD_GL_NV_point_sprite 0
+#define GLAD_GL_NV_present_video 0
+#define GLAD_GL_NV_primitive_restart 0
+#define GLAD_GL_NV_primitive_shading_rate 0
+#define GLAD_GL_NV_query_resource 0
+#define GLAD_GL_NV_query_resource_tag 0
+#define GLAD_GL_NV_register_combiners 0
+#define GLAD_GL_NV_register_combiners2 0
+#define GLAD_GL_NV_representative_fragment_test 0
+#define GLAD_GL_NV_robustness_video_memory_purge 0
+#define GLAD_GL_NV_sample_locations 0
+#define GLAD_GL_NV_sample_mask_override_coverage 0
+#define GLAD_GL_NV_scissor_exclusive 0
+#define GLAD_GL_NV_shader_atomic_counters 0
+#define GLAD_GL_NV_shader_atomic_float 0
+#define GLAD_GL_NV_shader_atomic_float64 0
+#define GLAD_GL_NV_shader_atomic_fp16_vector 0
+#define GLAD_GL_NV_shader_atomic_int64 0
+#define GLAD_GL_NV_shader_buffer_load 0
+#define GLAD_GL_NV_shader_buffer_store 0
+#define GLAD_GL_NV_shader_storage_buffer_object 0
+#define GLAD_GL_NV_shader_subgroup_partitioned 0
+#define GLAD_GL_NV_shader_texture_footprint 0
+#define GLAD_GL_NV_shader_thread_group 0
+#define GLAD_GL_NV_shader_thread_shuffle 0
+#define GLAD_GL_NV_shading_rate_image 0
+#define GLAD_GL_NV_stereo_view_rendering 0
+#define GLAD_GL_NV_tessellation_program5 0
+#define GLAD_GL_NV_texgen_emboss 0
+#define GLAD_GL_NV_texgen_reflection 0
+#define GLAD_GL_NV_texture_barrier 0
+#define GLAD_GL_NV_texture_compression_vtc 0
+#define GLAD_GL_NV_texture_env_combine4 0
+#define GLAD_GL_NV_texture_expand_normal 0
+#define GLAD_GL_NV_texture_multisample 0
+#define GLAD_GL_NV_texture_rectangle 0
+#define GLAD_GL_NV_texture_rectangle_compressed 0
+#define GLAD_GL_NV_texture_shader 0
+#define GLAD_GL_NV_texture_shader2 0
+#define GLAD_GL_NV_texture_shader3 0
+#define GLAD_GL_NV_timeline_semaphore 0
+#define GLAD_GL_NV_transform_feedback 0
+#define GLAD_GL_NV_transform_feedback2 0
+#define GLAD_GL_NV_uniform_buffer_std430_layout 0
+#define GLAD_GL_NV_uniform_buffer_unified_memory 0
+#define GLAD_GL_NV_vdpau_interop 0
+#define GLAD_GL_NV_vdpau_interop2 0
+#define GLAD_GL_NV_vertex_array_range 0
+#define GLAD_GL_NV_vertex_array_range2 0
+#define GLAD_GL_NV_vertex_attrib_integer_64bit 0
+#define GLAD_GL_NV_vertex_buffer_unified_memory 0
+#define GLAD_GL_NV_vertex_program 0
+#define GLAD_GL_NV_vertex_program1_1 0
+#define GLAD_GL_NV_vertex_program2 0
+#define GLAD_GL_NV_vertex_program2_option 0
+#define GLAD_GL_NV_vertex_program3 0
+#define GLAD_GL_NV_vertex_program4 0
+#define GLAD_GL_NV_video_capture 0
+#define GLAD_GL_NV_viewport_array2 0
+#define GLAD_GL_NV_viewport_swizzle 0
+#define GLAD_GL_OES_byte_coordinates 0
+#define GLAD_GL_OES_compressed_paletted_texture 0
+#define GLAD_GL_OES_fixed_point 0
+#define GLAD_GL_OES_query_matrix 0
+#define GLAD_GL_OES_read_format 0
+#define GLAD_GL_OES_single_precision 0
+#define GLAD_GL_OML_interlace 0
+#define GLAD_GL_OML_resample 0
+#define GLAD_GL_OML_subsample 0
+#define GLAD_GL_OVR_multiview 0
+#define GLAD_GL_OVR_multiview2 0
+#define GLAD_GL_PGI_misc_hints 0
+#define GLAD_GL_PGI_vertex_hints 0
+#define GLAD_GL_REND_screen_coordinates 0
+#define GLAD_GL_S3_s3tc 0
+#define GLAD_GL_SGIS_detail_texture 0
+#define GLAD_GL_SGIS_fog_function 0
+#define GLAD_GL_SGIS_generate_mipmap 0
+#define GLAD_GL_SGIS_multisample 0
+#define GLAD_GL_SGIS_pixel_texture 0
+#define GLAD_GL_SGIS_point_line_texgen 0
+#define GLAD_GL_SGIS_point_parameters 0
+#define GLAD_GL_SGIS_sharpen_texture 0
+#define GLAD_GL_SGIS_texture4D 0
+#define GLAD_GL_SGIS_texture_border_clamp 0
+#define GLAD_GL_SGIS_texture_color_mask 0
+#define GLAD_GL_SGIS_texture_edge_clamp 0
+#define GLAD_GL_SGIS_texture_filter4 0
+#define GLAD_GL_SGIS_texture_lod 0
+#define GLAD_GL_SGIS_texture_select 0
+#define GLAD_GL_SGIX_async 0
+#define GLAD_GL_SGIX_async_histogram 0
+#define GLAD_GL_SGIX_async_pixel 0
+#define GLAD_GL_SGIX_blend_alpha_minmax 0
+#define GLAD_GL_SGIX_calligraphic_fragment 0
+#define GLAD_GL_SGIX_clipmap 0
+#define GLAD_GL_SGIX_convolution_accuracy 0
+#define GLAD_GL_SGIX_depth_pass_instrument 0
+#define GLAD_GL_SGIX_depth_texture 0
+#define GLAD_GL_SGIX_flush_raster 0
+#define GLAD_GL_SGIX_fog_offset 0
+#define GLAD_GL_SGIX_fragment_lighting 0
+#define GLAD_GL_SGIX_framezoom 0
+#define GLAD_GL_SGIX_igloo_interface 0
+#define GLAD_GL_SGIX_instruments 0
+#define GLAD_GL_SGIX_interlace 0
+#define GLAD_GL_SGIX_ir_instrument1 0
+#define GLAD_GL_SGIX_list_priority 0
+#define GLAD_GL_SGIX_pixel_texture 0
+#define GLAD_GL_SGIX_pixel_tiles 0
+#define GLAD_GL_SGIX_polynomial_ffd 0
+#define GLAD_GL_SGIX_reference_plane 0
+#define GLAD_GL_SGIX_resample 0
+#define GLAD_GL_SGIX_scalebias_hint 0
+#define GLAD_GL_SGIX_shadow 0
+#define GLAD_GL_SGIX_shadow_ambient 0
+#define GLAD_GL_SGIX_sprite 0
+#define GLAD_GL_SGIX_subsample 0
+#define GLAD_GL_SGIX_tag_sample_buffer 0
+#define GLAD_GL_SGIX_texture_add_env 0
+#define GLAD_GL_SGIX_texture_coordinate_clamp 0
+#define GLAD_GL_SGIX_texture_lod_bias 0
+#define GLAD_GL_SGIX_texture_multi_buffer 0
+#define GLAD_GL_SGIX_texture_scale_bias 0
+#define GLAD_GL_SGIX_vertex_preclip 0
+#define GLAD_GL_SGIX_ycrcb 0
+#define GLAD_GL_SGIX_ycrcb_subsample 0
+#define GLAD_GL_SGIX_ycrcba 0
+#define GLAD_GL_SGI_color_matrix 0
+#define GLAD_GL_SGI_color_table 0
+#define GLAD_GL_SGI_texture_color_table 0
+#define GLAD_GL_SUNX_constant_data 0
+#define GLAD_GL_SUN_convolution_border_modes 0
+#define GLAD_GL_SUN_global_alpha 0
+#define GLAD_GL_SUN_mesh_array 0
+#define GLAD_GL_SUN_slice_accum 0
+#define GLAD_GL_SUN_triangle_list 0
+#define GLAD_GL_SUN_vertex 0
+#define GLAD_GL_WIN_phong_shading 0
+#define GLAD_GL_WIN_specular_fog 0
+#else
+#define GLAD_GL_3DFX_multisample (glad_gl_current->GLAD_GL_3DFX_multisample)
+#define GLAD_GL_3DFX_tbuffer (glad_gl_current->GLAD_GL_3DFX_tbuffer)
+#define GLAD_GL_3DFX_texture_compression_FXT1 (glad_gl_current->GLAD_GL_3DFX_texture_compression_FXT1)
+#define GLAD_GL_AMD_blend_minmax_factor (glad_gl_current->GLAD_GL_AMD_blend_minmax_factor)
+#define GLAD_GL_AMD_conservative_depth (glad_gl_current->GLAD_GL_AMD_conservative_depth)
+#define GLAD_GL_AMD_debug_output (glad_gl_current->GLAD_GL_AMD_debug_output)
+#define GLAD_GL_AMD_depth_clamp_separate (glad_gl_current->GLAD_GL_AMD_depth_clamp_separate)
+#define GLAD_GL_AMD_draw_buffers_blend (glad_gl_current->GLAD_GL_AMD_draw_buffers_blend)
+#define GLAD_GL_AMD_framebuffer_multisample_advanced (glad_gl_current->GLAD_GL_AMD_framebuffer_multisample_advanced)
+#define GLAD_GL_AMD_framebuffer_sample_positions (glad_gl_current->GLAD_GL_AMD_framebuffer_sample_positions)
+#define GLAD_GL_AMD_gcn_shader (glad_gl_current->GLAD_GL_AMD_gcn_shader)
+#define GLAD_GL_AMD_gpu_shader_half_float (glad_gl_current->GLAD_GL_AMD_gpu_shader_half_float)
+#define GLAD_GL_AMD_gpu_shader_int16 (glad_gl_current->GLAD_GL_AMD_gpu_shader_int16)
+#define GLAD_GL_AMD_gpu_shader_int64 (glad_gl_current->GLAD_GL_AMD_gpu_shader_int64)
+#define GLAD_GL_AMD_interleaved_elements (glad_gl_current->GLAD_GL_AMD_interleaved_elements)
+#define GLAD_GL_AMD_multi_draw_indirect (glad_gl_current->GLAD_GL_AMD_multi_draw_indirect)
+#define GLAD_GL_AMD_name_gen_delete (glad_gl_current->GLAD_GL_AMD_name_gen_delete)
+#define GLAD_GL_AMD_occlusion_query_event (glad_gl_current->GLAD_GL_AMD_occlusion_query_event)
+#define GLAD_GL_AMD_performance_monitor (glad_gl_current->GLAD_GL_AMD_performance_monitor)
+#define GLAD_GL_AMD_pinned_memory (glad_gl_current->GLAD_GL_AMD_pinned_memory)
+#define GLAD_GL_AMD_query_buffer_object (glad_gl_current->GLAD_GL_AMD_query_buffer_object)
+#define GLAD_GL_AMD_sample_positions (glad_gl_current->GLAD_GL_AMD_sample_positions)
+#define GLAD_GL_AMD_seamless_cubemap_per_texture (glad_gl_current->GLAD_GL_AMD_seamless_cubemap_per_texture)
+#define GLAD_GL_AMD_shader_atomic_counter_ops (glad_gl_current->GLAD_GL_AMD_shader_atomic_counter_ops)
+#define GLAD_GL_AMD_shader_ballot (glad_gl_current->GLAD_GL_AMD_shader_ballot)
+#define GLAD_GL_AMD_shader_explicit_vertex_parameter (glad_gl_current->GLAD_GL_AMD_shader_explicit_vertex_parameter)
+#define GLAD_GL_AMD_shader_gpu_shader_half_float_fetch (glad_gl_current->GLAD_GL_AMD_shader_gpu_shader_half_float_fetch)
+#define GLAD_GL_AMD_shader_image_load_store_lod (glad_gl_current->GLAD_GL_AMD_shader_image_load_store_lod)
+#define GLAD_GL_AMD_shader_stencil_export (glad_gl_current->GLAD_GL_AMD_shader_stencil_export)
+#define GLAD_GL_AMD_shader_trinary_minmax (glad_gl_current->GLAD_GL_AMD_shader_trinary_minmax)
+#define GLAD_GL_AMD_sparse_texture (glad_gl_current->GLAD_GL_AMD_sparse_texture)
+#define GLAD_GL_AMD_stencil_operation_extended (glad_gl_current->GLAD_GL_AMD_stencil_operation_extended)
+#define GLAD_GL_AMD_texture_gather_bias_lod (glad_gl_current->GLAD_GL_AMD_texture_gather_bias_lod)
+#define GLAD_GL_AMD_texture_texture4 (glad_gl_current->GLAD_GL_AMD_texture_texture4)
+#define GLAD_GL_AMD_transform_feedback3_lines_triangles (glad_gl_current->GLAD_GL_AMD_transform_feedback3_lines_triangles)
+#define GLAD_GL_AMD_transform_feedback4 (glad_gl_current->GLAD_GL_AMD_transform_feedback4)
+#define GLAD_GL_AMD_vertex_shader_layer (glad_gl_current->GLAD_GL_AMD_vertex_shader_layer)
+#define GLAD_GL_AMD_vertex_shader_tessellator (glad_gl_current->GLAD_GL_AMD_vertex_shader_tessellator)
+#define GLAD_GL_AMD_vertex_shader_viewport_index (glad_gl_current->GLAD_GL_AMD_vertex_shader_viewport_index)
+#define GLAD_GL_APPLE_aux_depth_stencil (glad_gl_current->GLAD_GL_APPLE_aux_depth_stencil)
+#define GLAD_GL_APPLE_client_storage (glad_gl_current->GLAD_GL_APPLE_client_storage)
+#define GLAD_GL_APPLE_element_array (glad_gl_current->GLAD_GL_APPLE_element_array)
+#define GLAD_GL_APPLE_fence (glad_gl_current->GLAD_GL_APPLE_fence)
+#define GLAD_GL_APPLE_float_pixels (glad_gl_current->GLAD_GL_APPLE_float_pixels)
+#define GLAD_GL_APPLE_flush_buffer_range (glad_gl_current->GLAD_GL_APPLE_flush_buffer_range)
+#define GLAD_GL_APPLE_object_purgeable (glad_gl_current->GLAD_GL_APPLE_object_purgeable)
+#define GLAD_GL_APPLE_rgb_422 (glad_gl_current->GLAD_GL_APPLE_rgb_422)
+#define GLAD_GL_APPLE_row_bytes (glad_gl_current->GLAD_GL_APPLE_row_bytes)
+#define GLAD_GL_APPLE_specular_vector (glad_gl_current->GLAD_GL_APPLE_specular_vector)
+#define GLAD_GL_APPLE_texture_range (glad_gl_current->GLAD_GL_APPLE_texture_range)
+#define GLAD_GL_APPLE_transform_hint (glad_gl_current->GLAD_GL_APPLE_transform_hint)
+#define GLAD_GL_APPLE_vertex_array_object (glad_gl_current->GLAD_GL_APPLE_vertex_array_object)
+#define GLAD_GL_APPLE_vertex_array_range (glad_gl_current->GLAD_GL_APPLE_vertex_array_range)
+#define GLAD_GL_APPLE_vertex_program_evaluators (glad_gl_current->GLAD_GL_APPLE_vertex_program_evaluators)
+#define GLAD_GL_APPLE_ycbcr_422 (glad_gl_current->GLAD_GL_APPLE_ycbcr_422)
+#define GLAD_GL_ARB_ES2_compatibility (glad_gl_current->GLAD_GL_ARB_ES2_compatibility)
+#define GLAD_GL_ARB_ES3_1_compatibility (glad_gl_current->GLAD_GL_ARB_ES3_1_compatibility)
+#define GLAD_GL_ARB_ES3_2_compatibility (glad_gl_current->GLAD_GL_ARB_ES3_2_compatibility)
+#define GLAD_GL_ARB_ES3_compatibility (glad_gl_current->GLAD_GL_ARB_ES3_compatibility)
+#define GLAD_GL_ARB_arrays_of_arrays (glad_gl_current->GLAD_GL_ARB_arrays_of_arrays)
+#define GLAD_GL_ARB_base_instance (glad_gl_current->GLAD_GL_ARB_base_instance)
+#define GLAD_GL_ARB_blend_func_extended (glad_gl_current->GLAD_GL_ARB_blend_func_extended)
+#define GLAD_GL_ARB_cl_event (glad_gl_current->GLAD_GL_ARB_cl_event)
+#define GLAD_GL_ARB_clear_buffer_object (glad_gl_current->GLAD_GL_ARB_clear_buffer_object)
+#define GLAD_GL_ARB_clear_texture (glad_gl_current->GLAD_GL_ARB_clear_texture)
+#define GLAD_GL_ARB_clip_control (glad_gl_current->GLAD_GL_ARB_clip_control)
+#define GLAD_GL_ARB_color_buffer_float (glad_gl_current->GLAD_GL_ARB_color_buffer_float)
+#define GLAD_GL_ARB_compatibility (glad_gl_current->GLAD_GL_ARB_compatibility)
+#define GLAD_GL_ARB_compressed_texture_pixel_storage (glad_gl_current->GLAD_GL_ARB_compressed_texture_pixel_storage)
+#define GLAD_GL_ARB_compute_shader (glad_gl_current->GLAD_GL_ARB_compute_shader)
+#define GLAD_GL_ARB_compute_variable_group_size (glad_gl_current->GLAD_GL_ARB_compute_variable_group_size)
+#define GLAD_GL_ARB_conditional_render_inverted (glad_gl_current->GLAD_GL_ARB_conditional_render_inverted)
+#define GLAD_GL_ARB_conservative_depth (glad_gl_current->GLAD_GL_ARB_conservative_depth)
+#define GLAD_GL_ARB_copy_buffer (glad_gl_current->GLAD_GL_ARB_copy_buffer)
+#define GLAD_GL_ARB_copy_image (glad_gl_current->GLAD_GL_ARB_copy_image)
+#define GLAD_GL_ARB_cull_distance (glad_gl_current->GLAD_GL_ARB_cull_distance)
+#define GLAD_GL_ARB_debug_output (glad_gl_current->GLAD_GL_ARB_debug_output)
+#define GLAD_GL_ARB_depth_buffer_float (glad_gl_current->GLAD_GL_ARB_depth_buffer_float)
+#define GLAD_GL_ARB_depth_clamp (glad_gl_current->GLAD_GL_ARB_depth_clamp)
+#define GLAD_GL_ARB_depth_texture (glad_gl_current->GLAD_GL_ARB_depth_texture)
+#define GLAD_GL_ARB_derivative_control (glad_gl_current->GLAD_GL_ARB_derivative_control)
+#define GLAD_GL_ARB_direct_state_access (glad_gl_current->GLAD_GL_ARB_direct_state_access)
+#define GLAD_GL_ARB_draw_buffers (glad_gl_current->GLAD_GL_ARB_draw_buffers)
+#define GLAD_GL_ARB_draw_buffers_blend (glad_gl_current->GLAD_GL_ARB_draw_buffers_blend)
+#define GLAD_GL_ARB_draw_elements_base_vertex (glad_gl_current->GLAD_GL_ARB_draw_elements_base_vertex)
+#define GLAD_GL_ARB_draw_indirect (glad_gl_current->GLAD_GL_ARB_draw_indirect)
+#define GLAD_GL_ARB_draw_instanced (glad_gl_current->GLAD_GL_ARB_draw_instanced)
+#define GLAD_GL_ARB_enhanced_layouts (glad_gl_current->GLAD_GL_ARB_enhanced_layouts)
+#define GLAD_GL_ARB_explicit_attrib_location (glad_gl_current->GLAD_GL_ARB_explicit_attrib_location)
+#define GLAD_GL_ARB_explicit_uniform_location (glad_gl_current->GLAD_GL_ARB_explicit_uniform_location)
+#define GLAD_GL_ARB_fragment_coord_conventions (glad_gl_current->GLAD_GL_ARB_fragment_coord_conventions)
+#define GLAD_GL_ARB_fragment_layer_viewport (glad_gl_current->GLAD_GL_ARB_fragment_layer_viewport)
+#define GLAD_GL_ARB_fragment_program (glad_gl_current->GLAD_GL_ARB_fragment_program)
+#define GLAD_GL_ARB_fragment_program_shadow (glad_gl_current->GLAD_GL_ARB_fragment_program_shadow)
+#define GLAD_GL_ARB_fragment_shader (glad_gl_current->GLAD_GL_ARB_fragment_shader)
+#define GLAD_GL_ARB_fragment_shader_interlock (glad_gl_current->GLAD_GL_ARB_fragment_shader_interlock)
+#define GLAD_GL_ARB_framebuffer_no_attachments (glad_gl_current->GLAD_GL_ARB_framebuffer_no_attachments)
+#define GLAD_GL_ARB_framebuffer_object (glad_gl_current->GLAD_GL_ARB_framebuffer_object)
+#define GLAD_GL_ARB_framebuffer_sRGB (glad_gl_current->GLAD_GL_ARB_framebuffer_sRGB)
+#define GLAD_GL_ARB_geometry_shader4 (glad_gl_current->GLAD_GL_ARB_geometry_shader4)
+#define GLAD_GL_ARB_get_texture_sub_image (glad_gl_current->GLAD_GL_ARB_get_texture_sub_image)
+#define GLAD_GL_ARB_gpu_shader5 (glad_gl_current->GLAD_GL_ARB_gpu_shader5)
+#define GLAD_GL_ARB_gpu_shader_fp64 (glad_gl_current->GLAD_GL_ARB_gpu_shader_fp64)
+#define GLAD_GL_ARB_gpu_shader_int64 (glad_gl_current->GLAD_GL_ARB_gpu_shader_int64)
+#define GLAD_GL_ARB_half_float_pixel (glad_gl_current->GLAD_GL_ARB_half_float_pixel)
+#define GLAD_GL_ARB_half_float_vertex (glad_gl_current->GLAD_GL_ARB_half_float_vertex)
+#define GLAD_GL_ARB_imaging (glad_gl_current->GLAD_GL_ARB_imaging)
+#define GLAD_GL_ARB_instanced_arrays (glad_gl_current->GLAD_GL_ARB_instanced_arrays)
+#define GLAD_GL_ARB_internalformat_query (glad_gl_current->GLAD_GL_ARB_internalformat_query)
+#define GLAD_GL_ARB_internalformat_query2 (glad_gl_current->GLAD_GL_ARB_internalformat_query2)
+#define GLAD_GL_ARB_invalidate_subdata (glad_gl_current->GLAD_GL_ARB_invalidate_subdata)
+#define GLAD_GL_ARB_map_buffer_alignment (glad_gl_current->GLAD_GL_ARB_map_buffer_alignment)
+#define GLAD_GL_ARB_map_buffer_range (glad_gl_current->GLAD_GL_ARB_map_buffer_range)
+#define GLAD_GL_ARB_matrix_palette (glad_gl_current->GLAD_GL_ARB_matrix_palette)
+#define GLAD_GL_ARB_multi_bind (glad_gl_current->GLAD_GL_ARB_multi_bind)
+#define GLAD_GL_ARB_multisample (glad_gl_current->GLAD_GL_ARB_multisample)
+#define GLAD_GL_ARB_multitexture (glad_gl_current->GLAD_GL_ARB_multitexture)
+#define GLAD_GL_ARB_occlusion_query (glad_gl_current->GLAD_GL_ARB_occlusion_query)
+#define GLAD_GL_ARB_occlusion_query2 (glad_gl_current->GLAD_GL_ARB_occlusion_query2)
+#define GLAD_GL_ARB_pixel_buffer_object (glad_gl_current->GLAD_GL_ARB_pixel_buffer_object)
+#define GLAD_GL_ARB_point_parameters (glad_gl_current->GLAD_GL_ARB_point_parameters)
+#define GLAD_GL_ARB_point_sprite (glad_gl_current->GLAD_GL_ARB_point_sprite)
+#define GLAD_GL_ARB_post_depth_coverage (glad_gl_current->GLAD_GL_ARB_post_depth_coverage)
+#define GLAD_GL_ARB_program_interface_query (glad_gl_current->GLAD_GL_ARB_program_interface_query)
+#define GLAD_GL_ARB_provoking_vertex (glad_gl_current->GLAD_GL_ARB_provoking_vertex)
+#define GLAD_GL_ARB_query_buffer_object (glad_gl_current->GLAD_GL_ARB_query_buffer_object)
+#define GLAD_GL_ARB_robust_buffer_access_behavior (glad_gl_current->GLAD_GL_ARB_robust_buffer_access_behavior)
+#define GLAD_GL_ARB_robustness (glad_gl_current->GLAD_GL_ARB_robustness)
+#define GLAD_GL_ARB_robustness_isolation (glad_gl_current->GLAD_GL_ARB_robustness_isolation)
+#define GLAD_GL_ARB_sample_locations (glad_gl_current->GLAD_GL_ARB_sample_locations)
+#define GLAD_GL_ARB_sample_shading (glad_gl_current->GLAD_GL_ARB_sample_shading)
+#define GLAD_GL_ARB_sampler_objects (glad_gl_current->GLAD_GL_ARB_sampler_objects)
+#define GLAD_GL_ARB_seamless_cube_map (glad_gl_current->GLAD_GL_ARB_seamless_cube_map)
+#define GLAD_GL_ARB_seamless_cubemap_per_texture (glad_gl_current->GLAD_GL_ARB_seamless_cubemap_per_texture)
+#define GLAD_GL_ARB_separate_shader_objects (glad_gl_current->GLAD_GL_ARB_separate_shader_objects)
+#define GLAD_GL_ARB_shader_atomic_counter_ops (glad_gl_current->GLAD_GL_ARB_shader_atomic_counter_ops)
+#define GLAD_GL_ARB_shader_atomic_counters (glad_gl_current->GLAD_GL_ARB_shader_atomic_counters)
+#define GLAD_GL_ARB_shader_ballot (glad_gl_current->GLAD_GL_ARB_shader_ballot)
+#define GLAD_GL_ARB_shader_bit_encoding (glad_gl_current->GLAD_GL_ARB_shader_bit_encoding)
+#define GLAD_GL_ARB_shader_clock (glad_gl_current->GLAD_GL_ARB_shader_clock)
+#define GLAD_GL_ARB_shader_group_vote (glad_gl_current->GLAD_GL_ARB_shader_group_vote)
+#define GLAD_GL_ARB_shader_image_load_store (glad_gl_current->GLAD_GL_ARB_shader_image_load_store)
+#define GLAD_GL_ARB_shader_image_size (glad_gl_current->GLAD_GL_ARB_shader_image_size)
+#define GLAD_GL_ARB_shader_objects (glad_gl_current->GLAD_GL_ARB_shader_objects)
+#define GLAD_GL_ARB_shader_precision (glad_gl_current->GLAD_GL_ARB_shader_precision)
+#define GLAD_GL_ARB_shader_stencil_export (glad_gl_current->GLAD_GL_ARB_shader_stencil_export)
+#define GLAD_GL_ARB_shader_storage_buffer_object (glad_gl_current->GLAD_GL_ARB_shader_storage_buffer_object)
+#define GLAD_GL_ARB_shader_subroutine (glad_gl_current->GLAD_GL_ARB_shader_subroutine)
+#define GLAD_GL_ARB_shader_texture_image_samples (glad_gl_current->GLAD_GL_ARB_shader_texture_image_samples)
+#define GLAD_GL_ARB_shader_texture_lod (glad_gl_current->GLAD_GL_ARB_shader_texture_lod)
+#define GLAD_GL_ARB_shader_viewport_layer_array (glad_gl_current->GLAD_GL_ARB_shader_viewport_layer_array)
+#define GLAD_GL_ARB_shading_language_100 (glad_gl_current->GLAD_GL_ARB_shading_language_100)
+#define GLAD_GL_ARB_shading_language_420pack (glad_gl_current->GLAD_GL_ARB_shading_language_420pack)
+#define GLAD_GL_ARB_shading_language_include (glad_gl_current->GLAD_GL_ARB_shading_language_include)
+#define GLAD_GL_ARB_shading_language_packing (glad_gl_current->GLAD_GL_ARB_shading_language_packing)
+#define GLAD_GL_ARB_shadow (glad_gl_current->GLAD_GL_ARB_shadow)
+#define GLAD_GL_ARB_shadow_ambient (glad_gl_current->GLAD_GL_ARB_shadow_ambient)
+#define GLAD_GL_ARB_sparse_texture2 (glad_gl_current->GLAD_GL_ARB_sparse_texture2)
+#define GLAD_GL_ARB_sparse_texture_clamp (glad_gl_current->GLAD_GL_ARB_sparse_texture_clamp)
+#define GLAD_GL_ARB_stencil_texturing (glad_gl_current->GLAD_GL_ARB_stencil_texturing)
+#define GLAD_GL_ARB_tessellation_shader (glad_gl_current->GLAD_GL_ARB_tessellation_shader)
+#define GLAD_GL_ARB_texture_barrier (glad_gl_current->GLAD_GL_ARB_texture_barrier)
+#define GLAD_GL_ARB_texture_border_clamp (glad_gl_current->GLAD_GL_ARB_texture_border_clamp)
+#define GLAD_GL_ARB_texture_buffer_object (glad_gl_current->GLAD_GL_ARB_texture_buffer_object)
+#define GLAD_GL_ARB_texture_buffer_object_rgb32 (glad_gl_current->GLAD_GL_ARB_texture_buffer_object_rgb32)
+#define GLAD_GL_ARB_texture_buffer_range (glad_gl_current->GLAD_GL_ARB_texture_buffer_range)
+#define GLAD_GL_ARB_texture_compression (glad_gl_current->GLAD_GL_ARB_texture_compression)
+#define GLAD_GL_ARB_texture_compression_bptc (glad_gl_current->GLAD_GL_ARB_texture_compression_bptc)
+#define GLAD_GL_ARB_texture_compression_rgtc (glad_gl_current->GLAD_GL_ARB_texture_compression_rgtc)
+#define GLAD_GL_ARB_texture_cube_map (glad_gl_current->GLAD_GL_ARB_texture_cube_map)
+#define GLAD_GL_ARB_texture_cube_map_array (glad_gl_current->GLAD_GL_ARB_texture_cube_map_array)
+#define GLAD_GL_ARB_texture_env_add (glad_gl_current->GLAD_GL_ARB_texture_env_add)
+#define GLAD_GL_ARB_texture_env_combine (glad_gl_current->GLAD_GL_ARB_texture_env_combine)
+#define GLAD_GL_ARB_texture_env_crossbar (glad_gl_current->GLAD_GL_ARB_texture_env_crossbar)
+#define GLAD_GL_ARB_texture_env_dot3 (glad_gl_current->GLAD_GL_ARB_texture_env_dot3)
+#define GLAD_GL_ARB_texture_filter_minmax (glad_gl_current->GLAD_GL_ARB_texture_filter_minmax)
+#define GLAD_GL_ARB_texture_float (glad_gl_current->GLAD_GL_ARB_texture_float)
+#define GLAD_GL_ARB_texture_gather (glad_gl_current->GLAD_GL_ARB_texture_gather)
+#define GLAD_GL_ARB_texture_mirror_clamp_to_edge (glad_gl_current->GLAD_GL_ARB_texture_mirror_clamp_to_edge)
+#define GLAD_GL_ARB_texture_mirrored_repeat (glad_gl_current->GLAD_GL_ARB_texture_mirrored_repeat)
+#define GLAD_GL_ARB_texture_multisample (glad_gl_current->GLAD_GL_ARB_texture_multisample)
+#define GLAD_GL_ARB_texture_non_power_of_two (glad_gl_current->GLAD_GL_ARB_texture_non_power_of_two)
+#define GLAD_GL_ARB_texture_query_levels (glad_gl_current->GLAD_GL_ARB_texture_query_levels)
+#define GLAD_GL_ARB_texture_query_lod (glad_gl_current->GLAD_GL_ARB_texture_query_lod)
+#define GLAD_GL_ARB_texture_rectangle (glad_gl_current->GLAD_GL_ARB_texture_rectangle)
+#define GLAD_GL_ARB_texture_rg (glad_gl_current->GLAD_GL_ARB_texture_rg)
+#define GLAD_GL_ARB_texture_rgb10_a2ui (glad_gl_current->GLAD_GL_ARB_texture_rgb10_a2ui)
+#define GLAD_GL_ARB_texture_stencil8 (glad_gl_current->GLAD_GL_ARB_texture_stencil8)
+#define GLAD_GL_ARB_texture_storage (glad_gl_current->GLAD_GL_ARB_texture_storage)
+#define GLAD_GL_ARB_texture_storage_multisample (glad_gl_current->GLAD_GL_ARB_texture_storage_multisample)
+#define GLAD_GL_ARB_texture_swizzle (glad_gl_current->GLAD_GL_ARB_texture_swizzle)
+#define GLAD_GL_ARB_texture_view (glad_gl_current->GLAD_GL_ARB_texture_view)
+#define GLAD_GL_ARB_timer_query (glad_gl_current->GLAD_GL_ARB_timer_query)
+#define GLAD_GL_ARB_transform_feedback2 (glad_gl_current->GLAD_GL_ARB_transform_feedback2)
+#define GLAD_GL_ARB_transform_feedback3 (glad_gl_current->GLAD_GL_ARB_transform_feedback3)
+#define GLAD_GL_ARB_transform_feedback_instanced (glad_gl_current->GLAD_GL_ARB_transform_feedback_instanced)
+#define GLAD_GL_ARB_transform_feedback_overflow_query (glad_gl_current->GLAD_GL_ARB_transform_feedback_overflow_query)
+#define GLAD_GL_ARB_transpose_matrix (glad_gl_current->GLAD_GL_ARB_transpose_matrix)
+#define GLAD_GL_ARB_uniform_buffer_object (glad_gl_current->GLAD_GL_ARB_uniform_buffer_object)
+#define GLAD_GL_ARB_vertex_array_bgra (glad_gl_current->GLAD_GL_ARB_vertex_array_bgra)
+#define GLAD_GL_ARB_vertex_array_object (glad_gl_current->GLAD_GL_ARB_vertex_array_object)
+#define GLAD_GL_ARB_vertex_attrib_64bit (glad_gl_current->GLAD_GL_ARB_vertex_attrib_64bit)
+#define GLAD_GL_ARB_vertex_attrib_binding (glad_gl_current->GLAD_GL_ARB_vertex_attrib_binding)
+#define GLAD_GL_ARB_vertex_blend (glad_gl_current->GLAD_GL_ARB_vertex_blend)
+#define GLAD_GL_ARB_vertex_buffer_object (glad_gl_current->GLAD_GL_ARB_vertex_buffer_object)
+#define GLAD_GL_ARB_vertex_program (glad_gl_current->GLAD_GL_ARB_vertex_program)
+#define GLAD_GL_ARB_vertex_shader (glad_gl_current->GLAD_GL_ARB_vertex_shader)
+#define GLAD_GL_ARB_vertex_type_10f_11f_11f_rev (glad_gl_current->GLAD_GL_ARB_vertex_type_10f_11f_11f_rev)
+#define GLAD_GL_ARB_vertex_type_2_10_10_10_rev (glad_gl_current->GLAD_GL_ARB_vertex_type_2_10_10_10_rev)
+#define GLAD_GL_ARB_viewport_array (glad_gl_current->GLAD_GL_ARB_viewport_array)
+#define GLAD_GL_ARB_window_pos (glad_gl_current->GLAD_GL_ARB_window_pos)
+#define GLAD_GL_ATI_draw_buffers (glad_gl_current->GLAD_GL_ATI_draw_buffers)
+#define GLAD_GL_ATI_element_array (glad_gl_current->GLAD_GL_ATI_element_array)
+#define GLAD_GL_ATI_envmap_bumpmap (glad_gl_current->GLAD_GL_ATI_envmap_bumpmap)
+#define GLAD_GL_ATI_fragment_shader (glad_gl_current->GLAD_GL_ATI_fragment_shader)
+#define GLAD_GL_ATI_map_object_buffer (glad_gl_current->GLAD_GL_ATI_map_object_buffer)
+#define GLAD_GL_ATI_meminfo (glad_gl_current->GLAD_GL_ATI_meminfo)
+#define GLAD_GL_ATI_pixel_format_float (glad_gl_current->GLAD_GL_ATI_pixel_format_float)
+#define GLAD_GL_ATI_pn_triangles (glad_gl_current->GLAD_GL_ATI_pn_triangles)
+#define GLAD_GL_ATI_separate_stencil (glad_gl_current->GLAD_GL_ATI_separate_stencil)
+#define GLAD_GL_ATI_text_fragment_shader (glad_gl_current->GLAD_GL_ATI_text_fragment_shader)
+#define GLAD_GL_ATI_texture_env_combine3 (glad_gl_current->GLAD_GL_ATI_texture_env_combine3)
+#define GLAD_GL_ATI_texture_float (glad_gl_current->GLAD_GL_ATI_texture_float)
+#define GLAD_GL_ATI_texture_mirror_once (glad_gl_current->GLAD_GL_ATI_texture_mirror_once)
+#define GLAD_GL_ATI_vertex_array_object (glad_gl_current->GLAD_GL_ATI_vertex_array_object)
+#define GLAD_GL_ATI_vertex_attrib_array_object (glad_gl_current->GLAD_GL_ATI_vertex_attrib_array_object)
+#define GLAD_GL_ATI_vertex_streams (glad_gl_current->GLAD_GL_ATI_vertex_streams)
+#define GLAD_GL_EXT_422_pixels (glad_gl_current->GLAD_GL_EXT_422_pixels)
+#define GLAD_GL_EXT_EGL_image_storage (glad_gl_current->GLAD_GL_EXT_EGL_image_storage)
+#define GLAD_GL_EXT_EGL_sync (glad_gl_current->GLAD_GL_EXT_EGL_sync)
+#define GLAD_GL_EXT_abgr (glad_gl_current->GLAD_GL_EXT_abgr)
+#define GLAD_GL_EXT_bgra (glad_gl_current->GLAD_GL_EXT_bgra)
+#define GLAD_GL_EXT_bindable_uniform (glad_gl_current->GLAD_GL_EXT_bindable_uniform)
+#define GLAD_GL_EXT_blend_color (glad_gl_current->GLAD_GL_EXT_blend_color)
+#define GLAD_GL_EXT_blend_equation_separate (glad_gl_current->GLAD_GL_EXT_blend_equation_separate)
+#define GLAD_GL_EXT_blend_func_separate (glad_gl_current->GLAD_GL_EXT_blend_func_separate)
+#define GLAD_GL_EXT_blend_logic_op (glad_gl_current->GLAD_GL_EXT_blend_logic_op)
+#define GLAD_GL_EXT_blend_minmax (glad_gl_current->GLAD_GL_EXT_blend_minmax)
+#define GLAD_GL_EXT_blend_subtract (glad_gl_current->GLAD_GL_EXT_blend_subtract)
+#define GLAD_GL_EXT_clip_volume_hint (glad_gl_current->GLAD_GL_EXT_clip_volume_hint)
+#define GLAD_GL_EXT_cmyka (glad_gl_current->GLAD_GL_EXT_cmyka)
+#define GLAD_GL_EXT_color_subtable (glad_gl_current->GLAD_GL_EXT_color_subtable)
+#define GLAD_GL_EXT_compiled_vertex_array (glad_gl_current->GLAD_GL_EXT_compiled_vertex_array)
+#define GLAD_GL_EXT_convolution (glad_gl_current->GLAD_GL_EXT_convolution)
+#define GLAD_GL_EXT_coordinate_frame (glad_gl_current->GLAD_GL_EXT_coordinate_frame)
+#define GLAD_GL_EXT_copy_texture (glad_gl_current->GLAD_GL_EXT_copy_texture)
+#define GLAD_GL_EXT_cull_vertex (glad_gl_current->GLAD_GL_EXT_cull_vertex)
+#define GLAD_GL_EXT_debug_label (glad_gl_current->GLAD_GL_EXT_debug_label)
+#define GLAD_GL_EXT_debug_marker (glad_gl_current->GLAD_GL_EXT_debug_marker)
+#define GLAD_GL_EXT_depth_bounds_test (glad_gl_current->GLAD_GL_EXT_depth_bounds_test)
+#define GLAD_GL_EXT_direct_state_access (glad_gl_current->GLAD_GL_EXT_direct_state_access)
+#define GLAD_GL_EXT_draw_buffers2 (glad_gl_current->GLAD_GL_EXT_draw_buffers2)
+#define GLAD_GL_EXT_draw_instanced (glad_gl_current->GLAD_GL_EXT_draw_instanced)
+#define GLAD_GL_EXT_draw_range_elements (glad_gl_current->GLAD_GL_EXT_draw_range_elements)
+#define GLAD_GL_EXT_external_buffer (glad_gl_current->GLAD_GL_EXT_external_buffer)
+#define GLAD_GL_EXT_fog_coord (glad_gl_current->GLAD_GL_EXT_fog_coord)
+#define GLAD_GL_EXT_framebuffer_blit (glad_gl_current->GLAD_GL_EXT_framebuffer_blit)
+#define GLAD_GL_EXT_framebuffer_blit_layers (glad_gl_current->GLAD_GL_EXT_framebuffer_blit_layers)
+#define GLAD_GL_EXT_framebuffer_multisample (glad_gl_current->GLAD_GL_EXT_framebuffer_multisample)
+#define GLAD_GL_EXT_framebuffer_multisample_blit_scaled (glad_gl_current->GLAD_GL_EXT_framebuffer_multisample_blit_scaled)
+#define GLAD_GL_EXT_framebuffer_object (glad_gl_current->GLAD_GL_EXT_framebuffer_object)
+#define GLAD_GL_EXT_framebuffer_sRGB (glad_gl_current->GLAD_GL_EXT_framebuffer_sRGB)
+#define GLAD_GL_EXT_geometry_shader4 (glad_gl_current->GLAD_GL_EXT_geometry_shader4)
+#define GLAD_GL_EXT_gpu_program_parameters (glad_gl_current->GLAD_GL_EXT_gpu_program_parameters)
+#define GLAD_GL_EXT_gpu_shader4 (glad_gl_current->GLAD_GL_EXT_gpu_shader4)
+#define GLAD_GL_EXT_histogram (glad_gl_current->GLAD_GL_EXT_histogram)
+#define GLAD_GL_EXT_index_array_formats (glad_gl_current->GLAD_GL_EXT_index_array_formats)
+#define GLAD_GL_EXT_index_func (glad_gl_current->GLAD_GL_EXT_index_func)
+#define GLAD_GL_EXT_index_material (glad_gl_current->GLAD_GL_EXT_index_material)
+#define GLAD_GL_EXT_index_texture (glad_gl_current->GLAD_GL_EXT_index_texture)
+#define GLAD_GL_EXT_light_texture (glad_gl_current->GLAD_GL_EXT_light_texture)
+#define GLAD_GL_EXT_memory_object (glad_gl_current->GLAD_GL_EXT_memory_object)
+#define GLAD_GL_EXT_memory_object_fd (glad_gl_current->GLAD_GL_EXT_memory_object_fd)
+#define GLAD_GL_EXT_memory_object_win32 (glad_gl_current->GLAD_GL_EXT_memory_object_win32)
+#define GLAD_GL_EXT_misc_attribute (glad_gl_current->GLAD_GL_EXT_misc_attribute)
+#define GLAD_GL_EXT_multi_draw_arrays (glad_gl_current->GLAD_GL_EXT_multi_draw_arrays)
+#define GLAD_GL_EXT_multisample (glad_gl_current->GLAD_GL_EXT_multisample)
+#define GLAD_GL_EXT_multiview_tessellation_geometry_shader (glad_gl_current->GLAD_GL_EXT_multiview_tessellation_geometry_shader)
+#define GLAD_GL_EXT_multiview_texture_multisample (glad_gl_current->GLAD_GL_EXT_multiview_texture_multisample)
+#define GLAD_GL_EXT_multiview_timer_query (glad_gl_current->GLAD_GL_EXT_multiview_timer_query)
+#define GLAD_GL_EXT_packed_depth_stencil (glad_gl_current->GLAD_GL_EXT_packed_depth_stencil)
+#define GLAD_GL_EXT_packed_float (glad_gl_current->GLAD_GL_EXT_packed_float)
+#define GLAD_GL_EXT_packed_pixels (glad_gl_current->GLAD_GL_EXT_packed_pixels)
+#define GLAD_GL_EXT_paletted_texture (glad_gl_current->GLAD_GL_EXT_paletted_texture)
+#define GLAD_GL_EXT_pixel_buffer_object (glad_gl_current->GLAD_GL_EXT_pixel_buffer_object)
+#define GLAD_GL_EXT_pixel_transform (glad_gl_current->GLAD_GL_EXT_pixel_transform)
+#define GLAD_GL_EXT_pixel_transform_color_table (glad_gl_current->GLAD_GL_EXT_pixel_transform_color_table)
+#define GLAD_GL_EXT_point_parameters (glad_gl_current->GLAD_GL_EXT_point_parameters)
+#define GLAD_GL_EXT_polygon_offset (glad_gl_current->GLAD_GL_EXT_polygon_offset)
+#define GLAD_GL_EXT_polygon_offset_clamp (glad_gl_current->GLAD_GL_EXT_polygon_offset_clamp)
+#define GLAD_GL_EXT_post_depth_coverage (glad_gl_current->GLAD_GL_EXT_post_depth_coverage)
+#define GLAD_GL_EXT_provoking_vertex (glad_gl_current->GLAD_GL_EXT_provoking_vertex)
+#define GLAD_GL_EXT_raster_multisample (glad_gl_current->GLAD_GL_EXT_raster_multisample)
+#define GLAD_GL_EXT_rescale_normal (glad_gl_current->GLAD_GL_EXT_rescale_normal)
+#define GLAD_GL_EXT_secondary_color (glad_gl_current->GLAD_GL_EXT_secondary_color)
+#define GLAD_GL_EXT_semaphore (glad_gl_current->GLAD_GL_EXT_semaphore)
+#define GLAD_GL_EXT_semaphore_fd (glad_gl_current->GLAD_GL_EXT_semaphore_fd)
+#define GLAD_GL_EXT_semaphore_win32 (glad_gl_current->GLAD_GL_EXT_semaphore_win32)
+#define GLAD_GL_EXT_separate_shader_objects (glad_gl_current->GLAD_GL_EXT_separate_shader_objects)
+#define GLAD_GL_EXT_separate_specular_color (glad_gl_current->GLAD_GL_EXT_separate_specular_color)
+#define GLAD_GL_EXT_shader_framebuffer_fetch (glad_gl_current->GLAD_GL_EXT_shader_framebuffer_fetch)
+#define GLAD_GL_EXT_shader_framebuffer_fetch_non_coherent (glad_gl_current->GLAD_GL_EXT_shader_framebuffer_fetch_non_coherent)
+#define GLAD_GL_EXT_shader_image_load_formatted (glad_gl_current->GLAD_GL_EXT_shader_image_load_formatted)
+#define GLAD_GL_EXT_shader_image_load_store (glad_gl_current->GLAD_GL_EXT_shader_image_load_store)
+#define GLAD_GL_EXT_shader_integer_mix (glad_gl_current->GLAD_GL_EXT_shader_integer_mix)
+#define GLAD_GL_EXT_shader_samples_identical (glad_gl_current->GLAD_GL_EXT_shader_samples_identical)
+#define GLAD_GL_EXT_shadow_funcs (glad_gl_current->GLAD_GL_EXT_shadow_funcs)
+#define GLAD_GL_EXT_shared_texture_palette (glad_gl_current->GLAD_GL_EXT_shared_texture_palette)
+#define GLAD_GL_EXT_sparse_texture2 (glad_gl_current->GLAD_GL_EXT_sparse_texture2)
+#define GLAD_GL_EXT_stencil_clear_tag (glad_gl_current->GLAD_GL_EXT_stencil_clear_tag)
+#define GLAD_GL_EXT_stencil_two_side (glad_gl_current->GLAD_GL_EXT_stencil_two_side)
+#define GLAD_GL_EXT_stencil_wrap (glad_gl_current->GLAD_GL_EXT_stencil_wrap)
+#define GLAD_GL_EXT_subtexture (glad_gl_current->GLAD_GL_EXT_subtexture)
+#define GLAD_GL_EXT_texture (glad_gl_current->GLAD_GL_EXT_texture)
+#define GLAD_GL_EXT_texture3D (glad_gl_current->GLAD_GL_EXT_texture3D)
+#define GLAD_GL_EXT_texture_array (glad_gl_current->GLAD_GL_EXT_texture_array)
+#define GLAD_GL_EXT_texture_buffer_object (glad_gl_current->GLAD_GL_EXT_texture_buffer_object)
+#define GLAD_GL_EXT_texture_compression_latc (glad_gl_current->GLAD_GL_EXT_texture_compression_latc)
+#define GLAD_GL_EXT_texture_compression_rgtc (glad_gl_current->GLAD_GL_EXT_texture_compression_rgtc)
+#define GLAD_GL_EXT_texture_cube_map (glad_gl_current->GLAD_GL_EXT_texture_cube_map)
+#define GLAD_GL_EXT_texture_env_add (glad_gl_current->GLAD_GL_EXT_texture_env_add)
+#define GLAD_GL_EXT_texture_env_combine (glad_gl_current->GLAD_GL_EXT_texture_env_combine)
+#define GLAD_GL_EXT_texture_env_dot3 (glad_gl_current->GLAD_GL_EXT_texture_env_dot3)
+#define GLAD_GL_EXT_texture_filter_minmax (glad_gl_current->GLAD_GL_EXT_texture_filter_minmax)
+#define GLAD_GL_EXT_texture_integer (glad_gl_current->GLAD_GL_EXT_texture_integer)
+#define GLAD_GL_EXT_texture_lod_bias (glad_gl_current->GLAD_GL_EXT_texture_lod_bias)
+#define GLAD_GL_EXT_texture_mirror_clamp (glad_gl_current->GLAD_GL_EXT_texture_mirror_clamp)
+#define GLAD_GL_EXT_texture_object (glad_gl_current->GLAD_GL_EXT_texture_object)
+#define GLAD_GL_EXT_texture_perturb_normal (glad_gl_current->GLAD_GL_EXT_texture_perturb_normal)
+#define GLAD_GL_EXT_texture_sRGB (glad_gl_current->GLAD_GL_EXT_texture_sRGB)
+#define GLAD_GL_EXT_texture_sRGB_R8 (glad_gl_current->GLAD_GL_EXT_texture_sRGB_R8)
+#define GLAD_GL_EXT_texture_sRGB_RG8 (glad_gl_current->GLAD_GL_EXT_texture_sRGB_RG8)
+#define GLAD_GL_EXT_texture_sRGB_decode (glad_gl_current->GLAD_GL_EXT_texture_sRGB_decode)
+#define GLAD_GL_EXT_texture_shadow_lod (glad_gl_current->GLAD_GL_EXT_texture_shadow_lod)
+#define GLAD_GL_EXT_texture_shared_exponent (glad_gl_current->GLAD_GL_EXT_texture_shared_exponent)
+#define GLAD_GL_EXT_texture_snorm (glad_gl_current->GLAD_GL_EXT_texture_snorm)
+#define GLAD_GL_EXT_texture_storage (glad_gl_current->GLAD_GL_EXT_texture_storage)
+#define GLAD_GL_EXT_texture_swizzle (glad_gl_current->GLAD_GL_EXT_texture_swizzle)
+#define GLAD_GL_EXT_timer_query (glad_gl_current->GLAD_GL_EXT_timer_query)
+#define GLAD_GL_EXT_transform_feedback (glad_gl_current->GLAD_GL_EXT_transform_feedback)
+#define GLAD_GL_EXT_vertex_array (glad_gl_current->GLAD_GL_EXT_vertex_array)
+#define GLAD_GL_EXT_vertex_array_bgra (glad_gl_current->GLAD_GL_EXT_vertex_array_bgra)
+#define GLAD_GL_EXT_vertex_attrib_64bit (glad_gl_current->GLAD_GL_EXT_vertex_attrib_64bit)
+#define GLAD_GL_EXT_vertex_shader (glad_gl_current->GLAD_GL_EXT_vertex_shader)
+#define GLAD_GL_EXT_vertex_weighting (glad_gl_current->GLAD_GL_EXT_vertex_weighting)
+#define GLAD_GL_EXT_win32_keyed_mutex (glad_gl_current->GLAD_GL_EXT_win32_keyed_mutex)
+#define GLAD_GL_EXT_window_rectangles (glad_gl_current->GLAD_GL_EXT_window_rectangles)
+#define GLAD_GL_EXT_x11_sync_object (glad_gl_current->GLAD_GL_EXT_x11_sync_object)
+#define GLAD_GL_GREMEDY_frame_terminator (glad_gl_current->GLAD_GL_GREMEDY_frame_terminator)
+#define GLAD_GL_GREMEDY_string_marker (glad_gl_current->GLAD_GL_GREMEDY_string_marker)
+#define GLAD_GL_HP_convolution_border_modes (glad_gl_current->GLAD_GL_HP_convolution_border_modes)
+#define GLAD_GL_HP_image_transform (glad_gl_current->GLAD_GL_HP_image_transform)
+#define GLAD_GL_HP_occlusion_test (glad_gl_current->GLAD_GL_HP_occlusion_test)
+#define GLAD_GL_HP_texture_lighting (glad_gl_current->GLAD_GL_HP_texture_lighting)
+#define GLAD_GL_IBM_cull_vertex (glad_gl_current->GLAD_GL_IBM_cull_vertex)
+#define GLAD_GL_IBM_multimode_draw_arrays (glad_gl_current->GLAD_GL_IBM_multimode_draw_arrays)
+#define GLAD_GL_IBM_rasterpos_clip (glad_gl_current->GLAD_GL_IBM_rasterpos_clip)
+#define GLAD_GL_IBM_static_data (glad_gl_current->GLAD_GL_IBM_static_data)
+#define GLAD_GL_IBM_texture_mirrored_repeat (glad_gl_current->GLAD_GL_IBM_texture_mirrored_repeat)
+#define GLAD_GL_IBM_vertex_array_lists (glad_gl_current->GLAD_GL_IBM_vertex_array_lists)
+#define GLAD_GL_INGR_blend_func_separate (glad_gl_current->GLAD_GL_INGR_blend_func_separate)
+#define GLAD_GL_INGR_color_clamp (glad_gl_current->GLAD_GL_INGR_color_clamp)
+#define GLAD_GL_INGR_interlace_read (glad_gl_current->GLAD_GL_INGR_interlace_read)
+#define GLAD_GL_INTEL_blackhole_render (glad_gl_current->GLAD_GL_INTEL_blackhole_render)
+#define GLAD_GL_INTEL_conservative_rasterization (glad_gl_current->GLAD_GL_INTEL_conservative_rasterization)
+#define GLAD_GL_INTEL_fragment_shader_ordering (glad_gl_current->GLAD_GL_INTEL_fragment_shader_ordering)
+#define GLAD_GL_INTEL_framebuffer_CMAA (glad_gl_current->GLAD_GL_INTEL_framebuffer_CMAA)
+#define GLAD_GL_INTEL_map_texture (glad_gl_current->GLAD_GL_INTEL_map_texture)
+#define GLAD_GL_INTEL_parallel_arrays (glad_gl_current->GLAD_GL_INTEL_parallel_arrays)
+#define GLAD_GL_INTEL_performance_query (glad_gl_current->GLAD_GL_INTEL_performance_query)
+#define GLAD_GL_KHR_blend_equation_advanced (glad_gl_current->GLAD_GL_KHR_blend_equation_advanced)
+#define GLAD_GL_KHR_blend_equation_advanced_coherent (glad_gl_current->GLAD_GL_KHR_blend_equation_advanced_coherent)
+#define GLAD_GL_KHR_context_flush_control (glad_gl_current->GLAD_GL_KHR_context_flush_control)
+#define GLAD_GL_KHR_no_error (glad_gl_current->GLAD_GL_KHR_no_error)
+#define GLAD_GL_KHR_robust_buffer_access_behavior (glad_gl_current->GLAD_GL_KHR_robust_buffer_access_behavior)
+#define GLAD_GL_KHR_robustness (glad_gl_current->GLAD_GL_KHR_robustness)
+#define GLAD_GL_KHR_shader_subgroup (glad_gl_current->GLAD_GL_KHR_shader_subgroup)
+#define GLAD_GL_KHR_texture_compression_astc_hdr (glad_gl_current->GLAD_GL_KHR_texture_compression_astc_hdr)
+#define GLAD_GL_KHR_texture_compression_astc_sliced_3d (glad_gl_current->GLAD_GL_KHR_texture_compression_astc_sliced_3d)
+#define GLAD_GL_MESAX_texture_stack (glad_gl_current->GLAD_GL_MESAX_texture_stack)
+#define GLAD_GL_MESA_framebuffer_flip_x (glad_gl_current->GLAD_GL_MESA_framebuffer_flip_x)
+#define GLAD_GL_MESA_framebuffer_flip_y (glad_gl_current->GLAD_GL_MESA_framebuffer_flip_y)
+#define GLAD_GL_MESA_framebuffer_swap_xy (glad_gl_current->GLAD_GL_MESA_framebuffer_swap_xy)
+#define GLAD_GL_MESA_pack_invert (glad_gl_current->GLAD_GL_MESA_pack_invert)
+#define GLAD_GL_MESA_program_binary_formats (glad_gl_current->GLAD_GL_MESA_program_binary_formats)
+#define GLAD_GL_MESA_resize_buffers (glad_gl_current->GLAD_GL_MESA_resize_buffers)
+#define GLAD_GL_MESA_shader_integer_functions (glad_gl_current->GLAD_GL_MESA_shader_integer_functions)
+#define GLAD_GL_MESA_tile_raster_order (glad_gl_current->GLAD_GL_MESA_tile_raster_order)
+#define GLAD_GL_MESA_window_pos (glad_gl_current->GLAD_GL_MESA_window_pos)
+#define GLAD_GL_MESA_ycbcr_texture (glad_gl_current->GLAD_GL_MESA_ycbcr_texture)
+#define GLAD_GL_NVX_blend_equation_advanced_multi_draw_buffers (glad_gl_current->GLAD_GL_NVX_blend_equation_advanced_multi_draw_buffers)
+#define GLAD_GL_NVX_conditional_render (glad_gl_current->GLAD_GL_NVX_conditional_render)
+#define GLAD_GL_NVX_gpu_memory_info (glad_gl_current->GLAD_GL_NVX_gpu_memory_info)
+#define GLAD_GL_NVX_gpu_multicast2 (glad_gl_current->GLAD_GL_NVX_gpu_multicast2)
+#define GLAD_GL_NVX_linked_gpu_multicast (glad_gl_current->GLAD_GL_NVX_linked_gpu_multicast)
+#define GLAD_GL_NVX_progress_fence (glad_gl_current->GLAD_GL_NVX_progress_fence)
+#define GLAD_GL_NV_alpha_to_coverage_dither_control (glad_gl_current->GLAD_GL_NV_alpha_to_coverage_dither_control)
+#define GLAD_GL_NV_bindless_multi_draw_indirect (glad_gl_current->GLAD_GL_NV_bindless_multi_draw_indirect)
+#define GLAD_GL_NV_bindless_multi_draw_indirect_count (glad_gl_current->GLAD_GL_NV_bindless_multi_draw_indirect_count)
+#define GLAD_GL_NV_bindless_texture (glad_gl_current->GLAD_GL_NV_bindless_texture)
+#define GLAD_GL_NV_blend_equation_advanced (glad_gl_current->GLAD_GL_NV_blend_equation_advanced)
+#define GLAD_GL_NV_blend_equation_advanced_coherent (glad_gl_current->GLAD_GL_NV_blend_equation_advanced_coherent)
+#define GLAD_GL_NV_blend_minmax_factor (glad_gl_current->GLAD_GL_NV_blend_minmax_factor)
+#define GLAD_GL_NV_blend_square (glad_gl_current->GLAD_GL_NV_blend_square)
+#define GLAD_GL_NV_clip_space_w_scaling (glad_gl_current->GLAD_GL_NV_clip_space_w_scaling)
+#define GLAD_GL_NV_command_list (glad_gl_current->GLAD_GL_NV_command_list)
+#define GLAD_GL_NV_compute_program5 (glad_gl_current->GLAD_GL_NV_compute_program5)
+#define GLAD_GL_NV_compute_shader_derivatives (glad_gl_current->GLAD_GL_NV_compute_shader_derivatives)
+#define GLAD_GL_NV_conditional_render (glad_gl_current->GLAD_GL_NV_conditional_render)
+#define GLAD_GL_NV_conservative_raster (glad_gl_current->GLAD_GL_NV_conservative_raster)
+#define GLAD_GL_NV_conservative_raster_dilate (glad_gl_current->GLAD_GL_NV_conservative_raster_dilate)
+#define GLAD_GL_NV_conservative_raster_pre_snap (glad_gl_current->GLAD_GL_NV_conservative_raster_pre_snap)
+#define GLAD_GL_NV_conservative_raster_pre_snap_triangles (glad_gl_current->GLAD_GL_NV_conservative_raster_pre_snap_triangles)
+#define GLAD_GL_NV_conservative_raster_underestimation (glad_gl_current->GLAD_GL_NV_conservative_raster_underestimation)
+#define GLAD_GL_NV_copy_depth_to_color (glad_gl_current->GLAD_GL_NV_copy_depth_to_color)
+#define GLAD_GL_NV_copy_image (glad_gl_current->GLAD_GL_NV_copy_image)
+#define GLAD_GL_NV_deep_texture3D (glad_gl_current->GLAD_GL_NV_deep_texture3D)
+#define GLAD_GL_NV_depth_buffer_float (glad_gl_current->GLAD_GL_NV_depth_buffer_float)
+#define GLAD_GL_NV_depth_clamp (glad_gl_current->GLAD_GL_NV_depth_clamp)
+#define GLAD_GL_NV_draw_texture (glad_gl_current->GLAD_GL_NV_draw_texture)
+#define GLAD_GL_NV_draw_vulkan_image (glad_gl_current->GLAD_GL_NV_draw_vulkan_image)
+#define GLAD_GL_NV_evaluators (glad_gl_current->GLAD_GL_NV_evaluators)
+#define GLAD_GL_NV_explicit_multisample (glad_gl_current->GLAD_GL_NV_explicit_multisample)
+#define GLAD_GL_NV_fence (glad_gl_current->GLAD_GL_NV_fence)
+#define GLAD_GL_NV_fill_rectangle (glad_gl_current->GLAD_GL_NV_fill_rectangle)
+#define GLAD_GL_NV_float_buffer (glad_gl_current->GLAD_GL_NV_float_buffer)
+#define GLAD_GL_NV_fog_distance (glad_gl_current->GLAD_GL_NV_fog_distance)
+#define GLAD_GL_NV_fragment_coverage_to_color (glad_gl_current->GLAD_GL_NV_fragment_coverage_to_color)
+#define GLAD_GL_NV_fragment_program (glad_gl_current->GLAD_GL_NV_fragment_program)
+#define GLAD_GL_NV_fragment_program2 (glad_gl_current->GLAD_GL_NV_fragment_program2)
+#define GLAD_GL_NV_fragment_program4 (glad_gl_current->GLAD_GL_NV_fragment_program4)
+#define GLAD_GL_NV_fragment_program_option (glad_gl_current->GLAD_GL_NV_fragment_program_option)
+#define GLAD_GL_NV_fragment_shader_barycentric (glad_gl_current->GLAD_GL_NV_fragment_shader_barycentric)
+#define GLAD_GL_NV_fragment_shader_interlock (glad_gl_current->GLAD_GL_NV_fragment_shader_interlock)
+#define GLAD_GL_NV_framebuffer_mixed_samples (glad_gl_current->GLAD_GL_NV_framebuffer_mixed_samples)
+#define GLAD_GL_NV_framebuffer_multisample_coverage (glad_gl_current->GLAD_GL_NV_framebuffer_multisample_coverage)
+#define GLAD_GL_NV_geometry_program4 (glad_gl_current->GLAD_GL_NV_geometry_program4)
+#define GLAD_GL_NV_geometry_shader4 (glad_gl_current->GLAD_GL_NV_geometry_shader4)
+#define GLAD_GL_NV_geometry_shader_passthrough (glad_gl_current->GLAD_GL_NV_geometry_shader_passthrough)
+#define GLAD_GL_NV_gpu_multicast (glad_gl_current->GLAD_GL_NV_gpu_multicast)
+#define GLAD_GL_NV_gpu_program4 (glad_gl_current->GLAD_GL_NV_gpu_program4)
+#define GLAD_GL_NV_gpu_program5 (glad_gl_current->GLAD_GL_NV_gpu_program5)
+#define GLAD_GL_NV_gpu_program5_mem_extended (glad_gl_current->GLAD_GL_NV_gpu_program5_mem_extended)
+#define GLAD_GL_NV_gpu_shader5 (glad_gl_current->GLAD_GL_NV_gpu_shader5)
+#define GLAD_GL_NV_half_float (glad_gl_current->GLAD_GL_NV_half_float)
+#define GLAD_GL_NV_internalformat_sample_query (glad_gl_current->GLAD_GL_NV_internalformat_sample_query)
+#define GLAD_GL_NV_light_max_exponent (glad_gl_current->GLAD_GL_NV_light_max_exponent)
+#define GLAD_GL_NV_memory_attachment (glad_gl_current->GLAD_GL_NV_memory_attachment)
+#define GLAD_GL_NV_memory_object_sparse (glad_gl_current->GLAD_GL_NV_memory_object_sparse)
+#define GLAD_GL_NV_mesh_shader (glad_gl_current->GLAD_GL_NV_mesh_shader)
+#define GLAD_GL_NV_multisample_coverage (glad_gl_current->GLAD_GL_NV_multisample_coverage)
+#define GLAD_GL_NV_multisample_filter_hint (glad_gl_current->GLAD_GL_NV_multisample_filter_hint)
+#define GLAD_GL_NV_occlusion_query (glad_gl_current->GLAD_GL_NV_occlusion_query)
+#define GLAD_GL_NV_packed_depth_stencil (glad_gl_current->GLAD_GL_NV_packed_depth_stencil)
+#define GLAD_GL_NV_parameter_buffer_object (glad_gl_current->GLAD_GL_NV_parameter_buffer_object)
+#define GLAD_GL_NV_parameter_buffer_object2 (glad_gl_current->GLAD_GL_NV_parameter_buffer_object2)
+#define GLAD_GL_NV_path_rendering (glad_gl_current->GLAD_GL_NV_path_rendering)
+#define GLAD_GL_NV_path_rendering_shared_edge (glad_gl_current->GLAD_GL_NV_path_rendering_shared_edge)
+#define GLAD_GL_NV_pixel_data_range (glad_gl_current->GLAD_GL_NV_pixel_data_range)
+#define GLAD_GL_NV_point_sprite (glad_gl_current->GLAD_GL_NV_point_sprite)
+#define GLAD_GL_NV_present_video (glad_gl_current->GLAD_GL_NV_present_video)
+#define GLAD_GL_NV_primitive_restart (glad_gl_current->GLAD_GL_NV_primitive_restart)
+#define GLAD_GL_NV_primitive_shading_rate (glad_gl_current->GLAD_GL_NV_primitive_shading_rate)
+#define GLAD_GL_NV_query_resource (glad_gl_current->GLAD_GL_NV_query_resource)
+#define GLAD_GL_NV_query_resource_tag (glad_gl_current->GLAD_GL_NV_query_resource_tag)
+#define GLAD_GL_NV_register_combiners (glad_gl_current->GLAD_GL_NV_register_combiners)
+#define GLAD_GL_NV_register_combiners2 (glad_gl_current->GLAD_GL_NV_register_combiners2)
+#define GLAD_GL_NV_representative_fragment_test (glad_gl_current->GLAD_GL_NV_representative_fragment_test)
+#define GLAD_GL_NV_robustness_video_memory_purge (glad_gl_current->GLAD_GL_NV_robustness_video_memory_purge)
+#define GLAD_GL_NV_sample_locations (glad_gl_current->GLAD_GL_NV_sample_locations)
+#define GLAD_GL_NV_sample_mask_override_coverage (glad_gl_current->GLAD_GL_NV_sample_mask_override_coverage)
+#define GLAD_GL_NV_scissor_exclusive (glad_gl_current->GLAD_GL_NV_scissor_exclusive)
+#define GLAD_GL_NV_shader_atomic_counters (glad_gl_current->GLAD_GL_NV_shader_atomic_counters)
+#define GLAD_GL_NV_shader_atomic_float (glad_gl_current->GLAD_GL_NV_shader_atomic_float)
+#define GLAD_GL_NV_shader_atomic_float64 (glad_gl_current->GLAD_GL_NV_shader_atomic_float64)
+#define GLAD_GL_NV_shader_atomic_fp16_vector (glad_gl_current->GLAD_GL_NV_shader_atomic_fp16_vector)
+#define GLAD_GL_NV_shader_atomic_int64 (glad_gl_current->GLAD_GL_NV_shader_atomic_int64)
+#define GLAD_GL_NV_shader_buffer_load (glad_gl_current->GLAD_GL_NV_shader_buffer_load)
+#define GLAD_GL_NV_shader_buffer_store (glad_gl_current->GLAD_GL_NV_shader_buffer_store)
+#define GLAD_GL_NV_shader_storage_buffer_object (glad_gl_current->GLAD_GL_NV_shader_storage_buffer_object)
+#define GLAD_GL_NV_shader_subgroup_partitioned (glad_gl_current->GLAD_GL_NV_shader_subgroup_partitioned)
+#define GLAD_GL_NV_shader_texture_footprint (glad_gl_current->GLAD_GL_NV_shader_texture_footprint)
+#define GLAD_GL_NV_shader_thread_group (glad_gl_current->GLAD_GL_NV_shader_thread_group)
+#define GLAD_GL_NV_shader_thread_shuffle (glad_gl_current->GLAD_GL_NV_shader_thread_shuffle)
+#define GLAD_GL_NV_shading_rate_image (glad_gl_current->GLAD_GL_NV_shading_rate_image)
+#define GLAD_GL_NV_stereo_view_rendering (glad_gl_current->GLAD_GL_NV_stereo_view_rendering)
+#define GLAD_GL_NV_tessellation_program5 (glad_gl_current->GLAD_GL_NV_tessellation_program5)
+#define GLAD_GL_NV_texgen_emboss (glad_gl_current->GLAD_GL_NV_texgen_emboss)
+#define GLAD_GL_NV_texgen_reflection (glad_gl_current->GLAD_GL_NV_texgen_reflection)
+#define GLAD_GL_NV_texture_barrier (glad_gl_current->GLAD_GL_NV_texture_barrier)
+#define GLAD_GL_NV_texture_compression_vtc (glad_gl_current->GLAD_GL_NV_texture_compression_vtc)
+#define GLAD_GL_NV_texture_env_combine4 (glad_gl_current->GLAD_GL_NV_texture_env_combine4)
+#define GLAD_GL_NV_texture_expand_normal (glad_gl_current->GLAD_GL_NV_texture_expand_normal)
+#define GLAD_GL_NV_texture_multisample (glad_gl_current->GLAD_GL_NV_texture_multisample)
+#define GLAD_GL_NV_texture_rectangle (glad_gl_current->GLAD_GL_NV_texture_rectangle)
+#define GLAD_GL_NV_texture_rectangle_compressed (glad_gl_current->GLAD_GL_NV_texture_rectangle_compressed)
+#define GLAD_GL_NV_texture_shader (glad_gl_current->GLAD_GL_NV_texture_shader)
+#define GLAD_GL_NV_texture_shader2 (glad_gl_current->GLAD_GL_NV_texture_shader2)
+#define GLAD_GL_NV_texture_shader3 (glad_gl_current->GLAD_GL_NV_texture_shader3)
+#define GLAD_GL_NV_timeline_semaphore (glad_gl_current->GLAD_GL_NV_timeline_semaphore)
+#define GLAD_GL_NV_transform_feedback (glad_gl_current->GLAD_GL_NV_transform_feedback)
+#define GLAD_GL_NV_transform_feedback2 (glad_gl_current->GLAD_GL_NV_transform_feedback2)
+#define GLAD_GL_NV_uniform_buffer_std430_layout (glad_gl_current->GLAD_GL_NV_uniform_buffer_std430_layout)
+#define GLAD_GL_NV_uniform_buffer_unified_memory (glad_gl_current->GLAD_GL_NV_uniform_buffer_unified_memory)
+#define GLAD_GL_NV_vdpau_interop (glad_gl_current->GLAD_GL_NV_vdpau_interop)
+#define GLAD_GL_NV_vdpau_interop2 (glad_gl_current->GLAD_GL_NV_vdpau_interop2)
+#define GLAD_GL_NV_vertex_array_range (glad_gl_current->GLAD_GL_NV_vertex_array_range)
+#define GLAD_GL_NV_vertex_array_range2 (glad_gl_current->GLAD_GL_NV_vertex_array_range2)
+#define GLAD_GL_NV_vertex_attrib_integer_64bit (glad_gl_current->GLAD_GL_NV_vertex_attrib_integer_64bit)
+#define GLAD_GL_NV_vertex_buffer_unified_memory (glad_gl_current->GLAD_GL_NV_vertex_buffer_unified_memory)
+#define GLAD_GL_NV_vertex_program (glad_gl_current->GLAD_GL_NV_vertex_program)
+#define GLAD_GL_NV_vertex_program1_1 (glad_gl_current->GLAD_GL_NV_vertex_program1_1)
+#define GLAD_GL_NV_vertex_program2 (glad_gl_current->GLAD_GL_NV_vertex_program2)
+#define GLAD_GL_NV_vertex_program2_option (glad_gl_current->GLAD_GL_NV_vertex_program2_option)
+#define GLAD_GL_NV_vertex_program3 (glad_gl_current->GLAD_GL_NV_vertex_program3)
+#define GLAD_GL_NV_vertex_program4 (glad_gl_current->GLAD_GL_NV_vertex_program4)
+#define GLAD_GL_NV_video_capture (glad_gl_current->GLAD_GL_NV_video_capture)
+#define GLAD_GL_NV_viewport_array2 (glad_gl_current->GLAD_GL_NV_viewport_array2)
+#define GLAD_GL_NV_viewport_swizzle (glad_gl_current->GLAD_GL_NV_viewport_swizzle)
+#define GLAD_GL_OES_byte_coordinates (glad_gl_current->GLAD_GL_OES_byte_coordinates)
+#define GLAD_GL_OES_compressed_paletted_texture (glad_gl_current->GLAD_GL_OES_compressed_paletted_texture)
+#define GLAD_GL_OES_fixed_point (glad_gl_current->GLAD_GL_OES_fixed_point)
+#define GLAD_GL_OES_query_matrix (glad_gl_current->GLAD_GL_OES_query_matrix)
+#define GLAD_GL_OES_read_format (glad_gl_current->GLAD_GL_OES_read_format)
+#define GLAD_GL_OES_single_precision (glad_gl_current->GLAD_GL_OES_single_precision)
+#define GLAD_GL_OML_interlace (glad_gl_current->GLAD_GL_OML_interlace)
+#define GLAD_GL_OML_resample (glad_gl_current->GLAD_GL_OML_resample)
+#define GLAD_GL_OML_subsample (glad_gl_current->GLAD_GL_OML_subsample)
+#define GLAD_GL_OVR_multiview (glad_gl_current->GLAD_GL_OVR_multiview)
+#define GLAD_GL_OVR_multiview2 (glad_gl_current->GLAD_GL_OVR_multiview2)
+#define GLAD_GL_PGI_misc_hints (glad_gl_current->GLAD_GL_PGI_misc_hints)
+#define GLAD_GL_PGI_vertex_hints (glad_gl_current->GLAD_GL_PGI_vertex_hints)
+#define GLAD_GL_REND_screen_coordinates (glad_gl_current->GLAD_GL_REND_screen_coordinates)
+#define GLAD_GL_S3_s3tc (glad_gl_current->GLAD_GL_S3_s3tc)
+#define GLAD_GL_SGIS_detail_texture (glad_gl_current->GLAD_GL_SGIS_detail_texture)
+#define GLAD_GL_SGIS_fog_function (glad_gl_current->GLAD_GL_SGIS_fog_function)
+#define GLAD_GL_SGIS_generate_mipmap (glad_gl_current->GLAD_GL_SGIS_generate_mipmap)
+#define GLAD_GL_SGIS_multisample (glad_gl_current->GLAD_GL_SGIS_multisample)
+#define GLAD_GL_SGIS_pixel_texture (glad_gl_current->GLAD_GL_SGIS_pixel_texture)
+#define GLAD_GL_SGIS_point_line_texgen (glad_gl_current->GLAD_GL_SGIS_point_line_texgen)
+#define GLAD_GL_SGIS_point_parameters (glad_gl_current->GLAD_GL_SGIS_point_parameters)
+#define GLAD_GL_SGIS_sharpen_texture (glad_gl_current->GLAD_GL_SGIS_sharpen_texture)
+#define GLAD_GL_SGIS_texture4D (glad_gl_current->GLAD_GL_SGIS_texture4D)
+#define GLAD_GL_SGIS_texture_border_clamp (glad_gl_current->GLAD_GL_SGIS_texture_border_clamp)
+#define GLAD_GL_SGIS_texture_color_mask (glad_gl_current->GLAD_GL_SGIS_texture_color_mask)
+#define GLAD_GL_SGIS_texture_edge_clamp (glad_gl_current->GLAD_GL_SGIS_texture_edge_clamp)
+#define GLAD_GL_SGIS_texture_filter4 (glad_gl_current->GLAD_GL_SGIS_texture_filter4)
+#define GLAD_GL_SGIS_texture_lod (glad_gl_current->GLAD_GL_SGIS_texture_lod)
+#define GLAD_GL_SGIS_texture_select (glad_gl_current->GLAD_GL_SGIS_texture_select)
+#define GLAD_GL_SGIX_async (glad_gl_current->GLAD_GL_SGIX_async)
+#define GLAD_GL_SGIX_async_histogram (glad_gl_current->GLAD_GL_SGIX_async_histogram)
+#define GLAD_GL_SGIX_async_pixel (glad_gl_current->GLAD_GL_SGIX_async_pixel)
+#define GLAD_GL_SGIX_blend_alpha_minmax (glad_gl_current->GLAD_GL_SGIX_blend_alpha_minmax)
+#define GLAD_GL_SGIX_calligraphic_fragment (glad_gl_current->GLAD_GL_SGIX_calligraphic_fragment)
+#define GLAD_GL_SGIX_clipmap (glad_gl_current->GLAD_GL_SGIX_clipmap)
+#define GLAD_GL_SGIX_convolution_accuracy (glad_gl_current->GLAD_GL_SGIX_convolution_accuracy)
+#define GLAD_GL_SGIX_depth_pass_instrument (glad_gl_current->GLAD_GL_SGIX_depth_pass_instrument)
+#define GLAD_GL_SGIX_depth_texture (glad_gl_current->GLAD_GL_SGIX_depth_texture)
+#define GLAD_GL_SGIX_flush_raster (glad_gl_current->GLAD_GL_SGIX_flush_raster)
+#define GLAD_GL_SGIX_fog_offset (glad_gl_current->GLAD_GL_SGIX_fog_offset)
+#define GLAD_GL_SGIX_fragment_lighting (glad_gl_current->GLAD_GL_SGIX_fragment_lighting)
+#define GLAD_GL_SGIX_framezoom (glad_gl_current->GLAD_GL_SGIX_framezoom)
+#define GLAD_GL_SGIX_igloo_interface (glad_gl_current->GLAD_GL_SGIX_igloo_interface)
+#define GLAD_GL_SGIX_instruments (glad_gl_current->GLAD_GL_SGIX_instruments)
+#define GLAD_GL_SGIX_interlace (glad_gl_current->GLAD_GL_SGIX_interlace)
+#define GLAD_GL_SGIX_ir_instrument1 (glad_gl_current->GLAD_GL_SGIX_ir_instrument1)
+#define GLAD_GL_SGIX_list_priority (glad_gl_current->GLAD_GL_SGIX_list_priority)
+#define GLAD_GL_SGIX_pixel_texture (glad_gl_current->GLAD_GL_SGIX_pixel_texture)
+#define GLAD_GL_SGIX_pixel_tiles (glad_gl_current->GLAD_GL_SGIX_pixel_tiles)
+#define GLAD_GL_SGIX_polynomial_ffd (glad_gl_current->GLAD_GL_SGIX_polynomial_ffd)
+#define GLAD_GL_SGIX_reference_plane (glad_gl_current->GLAD_GL_SGIX_reference_plane)
+#define GLAD_GL_SGIX_resample (glad_gl_current->GLAD_GL_SGIX_resample)
+#define GLAD_GL_SGIX_scalebias_hint (glad_gl_current->GLAD_GL_SGIX_scalebias_hint)
+#define GLAD_GL_SGIX_shadow (glad_gl_current->GLAD_GL_SGIX_shadow)
+#define GLAD_GL_SGIX_shadow_ambient (glad_gl_current->GLAD_GL_SGIX_shadow_ambient)
+#define GLAD_GL_SGIX_sprite (glad_gl_current->GLAD_GL_SGIX_sprite)
+#define GLAD_GL_SGIX_subsample (glad_gl_current->GLAD_GL_SGIX_subsample)
+#define GLAD_GL_SGIX_tag_sample_buffer (glad_gl_current->GLAD_GL_SGIX_tag_sample_buffer)
+#define GLAD_GL_SGIX_texture_add_env (glad_gl_current->GLAD_GL_SGIX_texture_add_env)
+#define GLAD_GL_SGIX_texture_coordinate_clamp (glad_gl_current->GLAD_GL_SGIX_texture_coordinate_clamp)
+#define GLAD_GL_SGIX_texture_lod_bias (glad_gl_current->GLAD_GL_SGIX_texture_lod_bias)
+#define GLAD_GL_SGIX_texture_multi_buffer (glad_gl_current->GLAD_GL_SGIX_texture_multi_buffer)
+#define GLAD_GL_SGIX_texture_scale_bias (glad_gl_current->GLAD_GL_SGIX_texture_scale_bias)
+#define GLAD_GL_SGIX_vertex_preclip (glad_gl_current->GLAD_GL_SGIX_vertex_preclip)
+#define GLAD_GL_SGIX_ycrcb (glad_gl_current->GLAD_GL_SGIX_ycrcb)
+#define GLAD_GL_SGIX_ycrcb_subsample (glad_gl_current->GLAD_GL_SGIX_ycrcb_subsample)
+#define GLAD_GL_SGIX_ycrcba (glad_gl_current->GLAD_GL_SGIX_ycrcba)
+#define GLAD_GL_SGI_color_matrix (glad_gl_current->GLAD_GL_SGI_color_matrix)
+#define GLAD_GL_SGI_color_table (glad_gl_current->GLAD_GL_SGI_color_table)
+#define GLAD_GL_SGI_texture_color_table (glad_gl_current->GLAD_GL_SGI_texture_color_table)
+#define GLAD_GL_SUNX_constant_data (glad_gl_current->GLAD_GL_SUNX_constant_data)
+#define GLAD_GL_SUN_convolution_border_modes (glad_gl_current->GLAD_GL_SUN_convolution_border_modes)
+#define GLAD_GL_SUN_global_alpha (glad_gl_current->GLAD_GL_SUN_global_alpha)
+#define GLAD_GL_SUN_mesh_array (glad_gl_current->GLAD_GL_SUN_mesh_array)
+#define GLAD_GL_SUN_slice_accum (glad_gl_current->GLAD_GL_SUN_slice_accum)
+#define GLAD_GL_SUN_triangle_list (glad_gl_current->GLAD_GL_SUN_triangle_list)
+#define GLAD_GL_SUN_vertex (glad_gl_current->GLAD_GL_SUN_vertex)
+#define GLAD_GL_WIN_phong_shading (glad_gl_current->GLAD_GL_WIN_phong_shading)
+#define GLAD_GL_WIN_specular_fog (glad_gl_current->GLAD_GL_WIN_specular_fog)
+#endif
+#define glad_glCullFace (glad_gl_current->glad_glCullFace)
+#define glad_glFrontFace (glad_gl_current->glad_glFrontFace)
+#define glad_glHint (glad_gl_current->glad_glHint)
+#define glad_glLineWidth (glad_gl_current->glad_glLineWidth)
+#define glad_glPointSize (glad_gl_current->glad_glPointSize)
+#define glad_glPolygonMode (glad_gl_current->glad_glPolygonMode)
+#define glad_glScissor (glad_gl_current->glad_glScissor)
+#define glad_glTexParameterf (glad_gl_current->glad_glTexParameterf)
+#define glad_glTexParameterfv (glad_gl_current->glad_glTexParameterfv)
+#define glad_glTexParameteri (glad_gl_current->glad_glTexParameteri)
+#define glad_glTexParameteriv (glad_gl_current->glad_glTexParameteriv)
+#define glad_glTexImage1D (glad_gl_current->glad_glTexImage1D)
+#define glad_glTexImage2D (glad_gl_current->glad_glTexImage2D)
+#define glad_glDrawBuffer (glad_gl_current->glad_glDrawBuffer)
+#define glad_glClear (glad_gl_current->glad_glClear)
+#define glad_glClearColor (glad_gl_current->glad_glClearColor)
+#define glad_glClearStencil (glad_gl_current->glad_glClearStencil)
+#define glad_glClearDepth (glad_gl_current->glad_glClearDepth)
+#define glad_glStencilMask (glad_gl_current->glad_glStencilMask)
+#define glad_glColorMask (glad_gl_current->glad_glColorMask)
+#define glad_glDepthMask (glad_gl_current->glad_glDepthMask)
+#define glad_glDisable (glad_gl_current->glad_glDisable)
+#define glad_glEnable (glad_gl_current->glad_glEnable)
+#define glad_glFinish (glad_gl_current->glad_glFinish)
+#define glad_glFlush (glad_gl_current->glad_glFlush)
+#define glad_glBlendFunc (glad_gl_current->glad_glBlendFunc)
+#define glad_glLogicOp (glad_gl_current->glad_glLogicOp)
+#define glad_glStencilFunc (glad_gl_current->glad_glStencilFunc)
+#define glad_glStencilOp (glad_gl_current->glad_glStencilOp)
+#define glad_glDepthFunc (glad_gl_current->glad_glDepthFunc)
+#define glad_glPixelStoref (glad_gl_current->glad_glPixelStoref)
+#define glad_glPixelStorei (glad_gl_current->glad_glPixelStorei)
+#define glad_glReadBuffer (glad_gl_current->glad_glReadBuffer)
+#define glad_glReadPixels (glad_gl_current->glad_glReadPixels)
+#define glad_glGetBooleanv (glad_gl_current->glad_glGetBooleanv)
+#define glad_glGetDoublev (glad_gl_current->glad_glGetDoublev)
+#define glad_glGetError (glad_gl_current->glad_glGetError)
+#define glad_glGetFloatv (glad_gl_current->glad_glGetFloatv)
+#define glad_glGetIntegerv (glad_gl_current->glad_glGetIntegerv)
+#define glad_glGetString (glad_gl_current->glad_glGetString)
+#define glad_glGetTexImage (glad_gl_current->glad_glGetTexImage)
+#define glad_glGetTexParameterfv (glad_gl_current->glad_glGetTexParameterfv)
+#define glad_glGetTexParameteriv (glad_gl_current->glad_glGetTexParameteriv)
+#define glad_glGetTexLevelParameterfv (glad_gl_current->glad_glGetTexLevelParameterfv)
+#define glad_glGetTexLevelParameteriv (glad_gl_current->glad_glGetTexLevelParameteriv)
+#define glad_glIsEnabled (glad_gl_current->glad_glIsEnabled)
+#define glad_glDepthRange (glad_gl_current->glad_glDepthRange)
+#define glad_glViewport (glad_gl_current->glad_glViewport)
+#define glad_glNewList (glad_gl_current->glad_glNewList)
+#define glad_glEndList (glad_gl_current->glad_glEndList)
+#define glad_glCallList (glad_gl_current->glad_glCallList)
+#define glad_glCallLists (glad_gl_current->glad_glCallLists)
+#define glad_glDeleteLists (glad_gl_current->glad_glDeleteLists)
+#define glad_glGenLists (glad_gl_current->glad_glGenLists)
+#define glad_glListBase (glad_gl_current->glad_glListBase)
+#define glad_glBegin (glad_gl_current->glad_glBegin)
+#define glad_glBitmap (glad_gl_current->glad_glBitmap)
+#define glad_glColor3b (glad_gl_current->glad_glColor3b)
+#define glad_glColor3bv (glad_gl_current->glad_glColor3bv)
+#define glad_glColor3d (glad_gl_current->glad_glColor3d)
+#define glad_glColor3dv (glad_gl_current->glad_glColor3dv)
+#define glad_glColor3f (glad_gl_current->glad_glColor3f)
+#define glad_glColor3fv (glad_gl_current->glad_glColor3fv)
+#define glad_glColor3i (glad_gl_current->glad_glColor3i)
+#define glad_glColor3iv (glad_gl_current->glad_glColor3iv)
+#define glad_glColor3s (glad_gl_current->glad_glColor3s)
+#define glad_glColor3sv (glad_gl_current->glad_glColor3sv)
+#define glad_glColor3ub (glad_gl_current->glad_glColor3ub)
+#define glad_glColor3ubv (glad_gl_current->glad_glColor3ubv)
+#define glad_glColor3ui (glad_gl_current->glad_glColor3ui)
+#define glad_glColor3uiv (glad_gl_current->glad_glColor3uiv)
+#define glad_glColor3us (glad_gl_current->glad_glColor3us)
+#define glad_glColor3usv (glad_gl_current->glad_glColor3usv)
+#define glad_glColor4b (glad_gl_current->glad_glColor4b)
+#define glad_glColor4bv (glad_gl_current->glad_glColor4bv)
+#define glad_glColor4d (glad_gl_current->glad_glColor4d)
+#define glad_glColor4dv (glad_gl_current->glad_glColor4dv)
+#define glad_glColor4f (glad_gl_current->glad_glColor4f)
+#define glad_glColor4fv (glad_gl_current->glad_glColor4fv)
+#define glad_glColor4i (glad_gl_current->glad_glColor4i)
+#define glad_glColor4iv (glad_gl_current->glad_glColor4iv)
+#define glad_glColor4s (glad_gl_current->glad_glColor4s)
+#define glad_glColor4sv (glad_gl_current->glad_glColor4sv)
+#define glad_glColor4ub (glad_gl_current->glad_glColor4ub)
+#define glad_glColor4ubv (glad_gl_current->glad_glColor4ubv)
+#define glad_glColor4ui (glad_gl_current->glad_glColor4ui)
+#define glad_glColor4uiv (glad_gl_current->glad_glColor4uiv)
+#define glad_glColor4us (glad_gl_current->glad_glColor4us)
+#define glad_glColor4usv (glad_gl_current->glad_glColor4usv)
+#define glad_glEdgeFlag (glad_gl_current->glad_glEdgeFlag)
+#define glad_glEdgeFlagv (glad_gl_current->glad_glEdgeFlagv)
+#define glad_glEnd (glad_gl_current->glad_glEnd)
+#define glad_glIndexd (glad_gl_current->glad_glIndexd)
+#define glad_glIndexdv (glad_gl_current->glad_glIndexdv)
+#define glad_glIndexf (glad_gl_current->glad_glIndexf)
+#define glad_glIndexfv (glad_gl_current->glad_glIndexfv)
+#define glad_glIndexi (glad_gl_current->glad_glIndexi)
+#define glad_glIndexiv (glad_gl_current->glad_glIndexiv)
+#define glad_glIndexs (glad_gl_current->glad_glIndexs)
+#define glad_glIndexsv (glad_gl_current->glad_glIndexsv)
+#define glad_glNormal3b (glad_gl_current->glad_glNormal3b)
+#define glad_glNormal3bv (glad_gl_current->glad_glNormal3bv)
+#define glad_glNormal3d (glad_gl_current->glad_glNormal3d)
+#define glad_glNormal3dv (glad_gl_current->glad_glNormal3dv)
+#define glad_glNormal3f (glad_gl_current->glad_glNormal3f)
+#define glad_glNormal3fv (glad_gl_current->glad_glNormal3fv)
+#define glad_glNormal3i (glad_gl_current->glad_glNormal3i)
+#define glad_glNormal3iv (glad_gl_current->glad_glNormal3iv)
+#define glad_glNormal3s (glad_gl_current->glad_glNormal3s)
+#define glad_glNormal3sv (glad_gl_current->glad_glNormal3sv)
+#define glad_glRasterPos2d (glad_gl_current->glad_glRasterPos2d)
+#define glad_glRasterPos2dv (glad_gl_current->glad_glRasterPos2dv)
+#define glad_glRasterPos2f (glad_gl_current->glad_glRasterPos2f)
+#define glad_glRasterPos2fv (glad_gl_current->glad_glRasterPos2fv)
+#define glad_glRasterPos2i (glad_gl_current->glad_glRasterPos2i)
+#define glad_glRasterPos2iv (glad_gl_current->glad_glRasterPos2iv)
+#define glad_glRasterPos2s (glad_gl_current->glad_glRasterPos2s)
+#define glad_glRasterPos2sv (glad_gl_current->glad_glRasterPos2sv)
+#define glad_glRasterPos3d (glad_gl_current->glad_glRasterPos3d)
+#define glad_glRasterPos3dv (glad_gl_current->glad_glRasterPos3dv)
+#define glad_glRasterPos3f (glad_gl_current->glad_glRasterPos3f)
+#define glad_glRasterPos3fv (glad_gl_current->glad_glRasterPos3fv)
+#define glad_glRasterPos3i (glad_gl_current->glad_glRasterPos3i)
+#define glad_glRasterPos3iv (glad_gl_current->glad_glRasterPos3iv)
+#define glad_glRasterPos3s (glad_gl_current->glad_glRasterPos3s)
+#define glad_glRasterPos3sv (glad_gl_current->glad_glRasterPos3sv)
+#define glad_glRasterPos4d (glad_gl_current->glad_glRasterPos4d)
+#define glad_glRasterPos4dv (glad_gl_current->glad_glRasterPos4dv)
+#define glad_glRasterPos4f (glad_gl_current->glad_glRasterPos4f)
+#define glad_glRasterPos4fv (glad_gl_current->glad_glRasterPos4fv)
+#define glad_glRasterPos4i (glad_gl_current->glad_glRasterPos4i)
+#define glad_glRasterPos4iv (glad_gl_current->glad_glRasterPos4iv)
+#define glad_glRasterPos4s (glad_gl_current->glad_glRasterPos4s)
+#define glad_glRasterPos4sv (glad_gl_current->glad_glRasterPos4sv)
+#define glad_glRectd (glad_gl_current->glad_glRectd)
+#define glad_glRectdv (glad_gl_current->glad_glRectdv)
+#define glad_glRectf (glad_gl_current->glad_glRectf)
+#define glad_glRectfv (glad_gl_current->glad_glRectfv)
+#define glad_glRecti (glad_gl_current->glad_glRecti)
+#define glad_glRectiv (glad_gl_current->glad_glRectiv)
+#define glad_glRects (glad_gl_current->glad_glRects)
+#define glad_glRectsv (glad_gl_current->glad_glRectsv)
+#define glad_glTexCoord1d (glad_gl_current->glad_glTexCoord1d)
+#define glad_glTexCoord1dv (glad_gl_current->glad_glTexCoord1dv)
+#define glad_glTexCoord1f (glad_gl_current->glad_glTexCoord1f)
+#define glad_glTexCoord1fv (glad_gl_current->glad_glTexCoord1fv)
+#define glad_glTexCoord1i (glad_gl_current->glad_glTexCoord1i)
+#define glad_glTexCoord1iv (glad_gl_current->glad_glTexCoord1iv)
+#define glad_glTexCoord1s (glad_gl_current->glad_glTexCoord1s)
+#define glad_glTexCoord1sv (glad_gl_current->glad_glTexCoord1sv)
+#define glad_glTexCoord2d (glad_gl_current->glad_glTexCoord2d)
+#define glad_glTexCoord2dv (glad_gl_current->glad_glTexCoord2dv)
+#define glad_glTexCoord2f (glad_gl_current->glad_glTexCoord2f)
+#define glad_glTexCoord2fv (glad_gl_current->glad_glTexCoord2fv)
+#define glad_glTexCoord2i (glad_gl_current->glad_glTexCoord2i)
+#define glad_glTexCoord2iv (glad_gl_current->glad_glTexCoord2iv)
+#define glad_glTexCoord2s (glad_gl_current->glad_glTexCoord2s)
+#define glad_glTexCoord2sv (glad_gl_current->glad_glTexCoord2sv)
+#define glad_glTexCoord3d (glad_gl_current->glad_glTexCoord3d)
+#define glad_glTexCoord3dv (glad_gl_current->glad_glTexCoord3dv)
+#define glad_glTexCoord3f (glad_gl_current->glad_glTexCoord3f)
+#define glad_glTexCoord3fv (glad_gl_current->glad_glTexCoord3fv)
+#define glad_glTexCoord3i (glad_gl_current->glad_glTexCoord3i)
+#define glad_glTexCoord3iv (glad_gl_current->glad_glTexCoord3iv)
+#define glad_glTexCoord3s (glad_gl_current->glad_glTexCoord3s)
+#define glad_glTexCoord3sv (glad_gl_current->glad_glTexCoord3sv)
+#define glad_glTexCoord4d (glad_gl_current->glad_glTexCoord4d)
+#define glad_glTexCoord4dv (glad_gl_current->glad_glTexCoord4dv)
+#define glad_glTexCoord4f (glad_gl_current->glad_glTexCoord4f)
+#define glad_glTexCoord4fv (glad_gl_current->glad_glTexCoord4fv)
+#define glad_glTexCoord4i (glad_gl_current->glad_glTexCoord4i)
+#define glad_glTexCoord4iv (glad_gl_current->glad_glTexCoord4iv)
+#define glad_glTexCoord4s (glad_gl_current->glad_glTexCoord4s)
+#define glad_glTexCoord4sv (glad_gl_current->glad_glTexCoord4sv)
+#define glad_glVertex2d (glad_gl_current->glad_glVertex2d)
+#define glad_glVertex2dv (glad_gl_current->glad_glVertex2dv)
+#define glad_glVertex2f (glad_gl_current->glad_glVertex2f)
+#define glad_glVertex2fv (glad_gl_current->glad_glVertex2fv)
+#define glad_glVertex2i (glad_gl_current->glad_glVertex2i)
+#define glad_glVertex2iv (glad_gl_current->glad_glVertex2iv)
+#define glad_glVertex2s (glad_gl_current->glad_glVertex2s)
+#define glad_glVertex2sv (glad_gl_current->glad_glVertex2sv)
+#define glad_glVertex3d (glad_gl_current->glad_glVertex3d)
+#define glad_glVertex3dv (glad_gl_current->glad_glVertex3dv)
+#define glad_glVertex3f (glad_gl_current->glad_glVertex3f)
+#define glad_glVertex3fv (glad_gl_current->glad_glVertex3fv)
+#define glad_glVertex3i (glad_gl_current->glad_glVertex3i)
+#define glad_glVertex3iv (glad_gl_current->glad_glVertex3iv)
+#define glad_glVertex3s (glad_gl_current->glad_glVertex3s)
+#define glad_glVertex3sv (glad_gl_current->glad_glVertex3sv)
+#define glad_glVertex4d (glad_gl_current->glad_glVertex4d)
+#define glad_glVertex4dv (glad_gl_current->glad_glVertex4dv)
+#define glad_glVertex4f (glad_gl_current->glad_glVertex4f)
+#define glad_glVertex4fv (glad_gl_current->glad_glVertex4fv)
+#define glad_glVertex4i (glad_gl_current->glad_glVertex4i)
+#define glad_glVertex4iv (glad_gl_current->glad_glVertex4iv)
+#define glad_glVertex4s (glad_gl_current->glad_glVertex4s)
+#define glad_glVertex4sv (glad_gl_current->glad_glVertex4sv)
+#define glad_glClipPlane (glad_gl_current->glad_glClipPlane)
+#define glad_glColorMaterial (glad_gl_current->glad_glColorMaterial)
+#define glad_glFogf (glad_gl_current->glad_glFogf)
+#define glad_glFogfv (glad_gl_current->glad_glFogfv)
+#define glad_glFogi (glad_gl_current->glad_glFogi)
+#define glad_glFogiv (glad_gl_current->glad_glFogiv)
+#define glad_glLightf (glad_gl_current->glad_glLightf)
+#define glad_glLightfv (glad_gl_current->glad_glLightfv)
+#define glad_glLighti (glad_gl_current->glad_glLighti)
+#define glad_glLightiv (glad_gl_current->glad_glLightiv)
+#define glad_glLightModelf (glad_gl_current->glad_glLightModelf)
+#define glad_glLightModelfv (glad_gl_current->glad_glLightModelfv)
+#define glad_glLightModeli (glad_gl_current->glad_glLightModeli)
+#define glad_glLightModeliv (glad_gl_current->glad_glLightModeliv)
+#define glad_glLineStipple (glad_gl_current->glad_glLineStipple)
+#define glad_glMaterialf (glad_gl_current->glad_glMaterialf)
+#define glad_glMaterialfv (glad_gl_current->glad_glMaterialfv)
+#define glad_glMateriali (glad_gl_current->glad_glMateriali)
+#define glad_glMaterialiv (glad_gl_current->glad_glMaterialiv)
+#define glad_glPolygonStipple (glad_gl_current->glad_glPolygonStipple)
+#define glad_glShadeModel (glad_gl_current->glad_glShadeModel)
+#define glad_glTexEnvf (glad_gl_current->glad_glTexEnvf)
+#define glad_glTexEnvfv (glad_gl_current->glad_glTexEnvfv)
+#define glad_glTexEnvi (glad_gl_current->glad_glTexEnvi)
+#define glad_glTexEnviv (glad_gl_current->glad_glTexEnviv)
+#define glad_glTexGend (glad_gl_current->glad_glTexGend)
+#define glad_glTexGendv (glad_gl_current->glad_glTexGendv)
+#define glad_glTexGenf (glad_gl_current->glad_glTexGenf)
+#define glad_glTexGenfv (glad_gl_current->glad_glTexGenfv)
+#define glad_glTexGeni (glad_gl_current->glad_glTexGeni)
+#define glad_glTexGeniv (glad_gl_current->glad_glTexGeniv)
+#define glad_glFeedbackBuffer (glad_gl_current->glad_glFeedbackBuffer)
+#define glad_glSelectBuffer (glad_gl_current->glad_glSelectBuffer)
+#define glad_glRenderMode (glad_gl_current->glad_glRenderMode)
+#define glad_glInitNames (glad_gl_current->glad_glInitNames)
+#define glad_glLoadName (glad_gl_current->glad_glLoadName)
+#define glad_glPassThrough (glad_gl_current->glad_glPassThrough)
+#define glad_glPopName (glad_gl_current->glad_glPopName)
+#define glad_glPushName (glad_gl_current->glad_glPushName)
+#define glad_glClearAccum (glad_gl_current->glad_glClearAccum)
+#define glad_glClearIndex (glad_gl_current->glad_glClearIndex)
+#define glad_glIndexMask (glad_gl_current->glad_glIndexMask)
+#define glad_glAccum (glad_gl_current->glad_glAccum)
+#define glad_glPopAttrib (glad_gl_current->glad_glPopAttrib)
+#define glad_glPushAttrib (glad_gl_current->glad_glPushAttrib)
+#define glad_glMap1d (glad_gl_current->glad_glMap1d)
+#define glad_glMap1f (glad_gl_current->glad_glMap1f)
+#define glad_glMap2d (glad_gl_current->glad_glMap2d)
+#define glad_glMap2f (glad_gl_current->glad_glMap2f)
+#define glad_glMapGrid1d (glad_gl_current->glad_glMapGrid1d)
+#define glad_glMapGrid1f (glad_gl_current->glad_glMapGrid1f)
+#define glad_glMapGrid2d (glad_gl_current->glad_glMapGrid2d)
+#define glad_glMapGrid2f (glad_gl_current->glad_glMapGrid2f)
+#define glad_glEvalCoord1d (glad_gl_current->glad_glEvalCoord1d)
+#define glad_glEvalCoord1dv (glad_gl_current->glad_glEvalCoord1dv)
+#define glad_glEvalCoord1f (glad_gl_current->glad_glEvalCoord1f)
+#define glad_glEvalCoord1fv (glad_gl_current->glad_glEvalCoord1fv)
+#define glad_glEvalCoord2d (glad_gl_current->glad_glEvalCoord2d)
+#define glad_glEvalCoord2dv (glad_gl_current->glad_glEvalCoord2dv)
+#define glad_glEvalCoord2f (glad_gl_current->glad_glEvalCoord2f)
+#define glad_glEvalCoord2fv (glad_gl_current->glad_glEvalCoord2fv)
+#define glad_glEvalMesh1 (glad_gl_current->glad_glEvalMesh1)
+#define glad_glEvalPoint1 (glad_gl_current->glad_glEvalPoint1)
+#define glad_glEvalMesh2 (glad_gl_current->glad_glEvalMesh2)
+#define glad_glEvalPoint2 (glad_gl_current->glad_glEvalPoint2)
+#define glad_glAlphaFunc (glad_gl_current->glad_glAlphaFunc)
+#define glad_glPixelZoom (glad_gl_current->glad_glPixelZoom)
+#define glad_glPixelTransferf (glad_gl_current->glad_glPixelTransferf)
+#define glad_glPixelTransferi (glad_gl_current->glad_glPixelTransferi)
+#define glad_glPixelMapfv (glad_gl_current->glad_glPixelMapfv)
+#define glad_glPixelMapuiv (glad_gl_current->glad_glPixelMapuiv)
+#define glad_glPixelMapusv (glad_gl_current->glad_glPixelMapusv)
+#define glad_glCopyPixels (glad_gl_current->glad_glCopyPixels)
+#define glad_glDrawPixels (glad_gl_current->glad_glDrawPixels)
+#define glad_glGetClipPlane (glad_gl_current->glad_glGetClipPlane)
+#define glad_glGetLightfv (glad_gl_current->glad_glGetLightfv)
+#define glad_glGetLightiv (glad_gl_current->glad_glGetLightiv)
+#define glad_glGetMapdv (glad_gl_current->glad_glGetMapdv)
+#define glad_glGetMapfv (glad_gl_current->glad_glGetMapfv)
+#define glad_glGetMapiv (glad_gl_current->glad_glGetMapiv)
+#define glad_glGetMaterialfv (glad_gl_current->glad_glGetMaterialfv)
+#define glad_glGetMaterialiv (glad_gl_current->glad_glGetMaterialiv)
+#define glad_glGetPixelMapfv (glad_gl_current->glad_glGetPixelMapfv)
+#define glad_glGetPixelMapuiv (glad_gl_current->glad_glGetPixelMapuiv)
+#define glad_glGetPixelMapusv (glad_gl_current->glad_glGetPixelMapusv)
+#define glad_glGetPolygonStipple (glad_gl_current->glad_glGetPolygonStipple)
+#define glad_glGetTexEnvfv (glad_gl_current->glad_glGetTexEnvfv)
+#define glad_glGetTexEnviv (glad_gl_current->glad_glGetTexEnviv)
+#define glad_glGetTexGendv (glad_gl_current->glad_glGetTexGendv)
+#define glad_glGetTexGenfv (glad_gl_current->glad_glGetTexGenfv)
+#define glad_glGetTexGeniv (glad_gl_current->glad_glGetTexGeniv)
+#define glad_glIsList (glad_gl_current->glad_glIsList)
+#define glad_glFrustum (glad_gl_current->glad_glFrustum)
+#define glad_glLoadIdentity (glad_gl_current->glad_glLoadIdentity)
+#define glad_glLoadMatrixf (glad_gl_current->glad_glLoadMatrixf)
+#define glad_glLoadMatrixd (glad_gl_current->glad_glLoadMatrixd)
+#define glad_glMatrixMode (glad_gl_current->glad_glMatrixMode)
+#define glad_glMultMatrixf (glad_gl_current->glad_glMultMatrixf)
+#define glad_glMultMatrixd (glad_gl_current->glad_glMultMatrixd)
+#define glad_glOrtho (glad_gl_current->glad_glOrtho)
+#define glad_glPopMatrix (glad_gl_current->glad_glPopMatrix)
+#define glad_glPushMatrix (glad_gl_current->glad_glPushMatrix)
+#define glad_glRotated (glad_gl_current->glad_glRotated)
+#define glad_glRotatef (glad_gl_current->glad_glRotatef)
+#define glad_glScaled (glad_gl_current->glad_glScaled)
+#define glad_glScalef (glad_gl_current->glad_glScalef)
+#define glad_glTranslated (glad_gl_current->glad_glTranslated)
+#define glad_glTranslatef (glad_gl_current->glad_glTranslatef)
+#define glad_glDrawArrays (glad_gl_current->glad_glDrawArrays)
+#define glad_glDrawElements (glad_gl_current->glad_glDrawElements)
+#define glad_glGetPointerv (glad_gl_current->glad_glGetPointerv)
+#define glad_glPolygonOffset (glad_gl_current->glad_glPolygonOffset)
+#define glad_glCopyTexImage1D (glad_gl_current->glad_glCopyTexImage1D)
+#define glad_glCopyTexImage2D (glad_gl_current->glad_glCopyTexImage2D)
+#define glad_glCopyTexSubImage1D (glad_gl_current->glad_glCopyTexSubImage1D)
+#define glad_glCopyTexSubImage2D (glad_gl_current->glad_glCopyTexSubImage2D)
+#define glad_glTexSubImage1D (glad_gl_current->glad_glTexSubImage1D)
+#define glad_glTexSubImage2D (glad_gl_current->glad_glTexSubImage2D)
+#define glad_glBindTexture (glad_gl_current->glad_glBindTexture)
+#define glad_glDeleteTextures (glad_gl_current->glad_glDeleteTextures)
+#define glad_glGenTextures (glad_gl_current->glad_glGenTextures)
+#define glad_glIsTexture (glad_gl_current->glad_glIsTexture)
+#define glad_glArrayElement (glad_gl_current->glad_glArrayElement)
+#define glad_glColorPointer (glad_gl_current->glad_glColorPointer)
+#define glad_glDisableClientState (glad_gl_current->glad_glDisableClientState)
+#define glad_glEdgeFlagPointer (glad_gl_current->glad_glEdgeFlagPointer)
+#define glad_glEnableClientState (glad_gl_current->glad_glEnableClientState)
+#define glad_glIndexPointer (glad_gl_current->glad_glIndexPointer)
+#define glad_glInterleavedArrays (glad_gl_current->glad_glInterleavedArrays)
+#define glad_glNormalPointer (glad_gl_current->glad_glNormalPointer)
+#define glad_glTexCoordPointer (glad_gl_current->glad_glTexCoordPointer)
+#define glad_glVertexPointer (glad_gl_current->glad_glVertexPointer)
+#define glad_glAreTexturesResident (glad_gl_current->glad_glAreTexturesResident)
+#define glad_glPrioritizeTextures (glad_gl_current->glad_glPrioritizeTextures)
+#define glad_glIndexub (glad_gl_current->glad_glIndexub)
+#define glad_glIndexubv (glad_gl_current->glad_glIndexubv)
+#define glad_glPopClientAttrib (glad_gl_current->glad_glPopClientAttrib)
+#define glad_glPushClientAttrib (glad_gl_current->glad_glPushClientAttrib)
+#define glad_glDrawRangeElements (glad_gl_current->glad_glDrawRangeElements)
+#define glad_glTexImage3D (glad_gl_current->glad_glTexImage3D)
+#define glad_glTexSubImage3D (glad_gl_current->glad_glTexSubImage3D)
+#define glad_glCopyTexSubImage3D (glad_gl_current->glad_glCopyTexSubImage3D)
+#define glad_glActiveTexture (glad_gl_current->glad_glActiveTexture)
+#define glad_glSampleCoverage (glad_gl_current->glad_glSampleCoverage)
+#define glad_glCompressedTexImage3D (glad_gl_current->glad_glCompressedTexImage3D)
+#define glad_glCompressedTexImage2D (glad_gl_current->glad_glCompressedTexImage2D)
+#define glad_glCompressedTexImage1D (glad_gl_current->glad_glCompressedTexImage1D)
+#define glad_glCompressedTexSubImage3D (glad_gl_current->glad_glCompressedTexSubImage3D)
+#define glad_glCompressedTexSubImage2D (glad_gl_current->glad_glCompressedTexSubImage2D)
+#define glad_glCompressedTexSubImage1D (glad_gl_current->glad_glCompressedTexSubImage1D)
+#define glad_glGetCompressedTexImage (glad_gl_current->glad_glGetCompressedTexImage)
+#define glad_glClientActiveTexture (glad_gl_current->glad_glClientActiveTexture)
+#define glad_glMultiTexCoord1d (glad_gl_current->glad_glMultiTexCoord1d)
+#define glad_glMultiTexCoord1dv (glad_gl_current->glad_glMultiTexCoord1dv)
+#define glad_glMultiTexCoord1f (glad_gl_current->glad_glMultiTexCoord1f)
+#define glad_glMultiTexCoord1fv (glad_gl_current->glad_glMultiTexCoord1fv)
+#define glad_glMultiTexCoord1i (glad_gl_current->glad_glMultiTexCoord1i)
+#define glad_glMultiTexCoord1iv (glad_gl_current->glad_glMultiTexCoord1iv)
+#define glad_glMultiTexCoord1s (glad_gl_current->glad_glMultiTexCoord1s)
+#define glad_glMultiTexCoord1sv (glad_gl_current->glad_glMultiTexCoord1sv)
+#define glad_glMultiTexCoord2d (glad_gl_current->glad_glMultiTexCoord2d)
+#define glad_glMultiTexCoord2dv (glad_gl_current->glad_glMultiTexCoord2dv)
+#define glad_glMultiTexCoord2f (glad_gl_current->glad_glMultiTexCoord2f)
+#define glad_glMultiTexCoord2fv (glad_gl_current->glad_glMultiTexCoord2fv)
+#define glad_glMultiTexCoord2i (glad_gl_current->glad_glMultiTexCoord2i)
+#define glad_glMultiTexCoord2iv (glad_gl_current->glad_glMultiTexCoord2iv)
+#define glad_glMultiTexCoord2s (glad_gl_current->glad_glMultiTexCoord2s)
+#define glad_glMultiTexCoord2sv (glad_gl_current->glad_glMultiTexCoord2sv)
+#define glad_glMultiTexCoord3d (glad_gl_current->glad_glMultiTexCoord3d)
+#define glad_glMultiTexCoord3dv (glad_gl_current->glad_glMultiTexCoord3dv)
+#define glad_glMultiTexCoord3f (glad_gl_current->glad_glMultiTexCoord3f)
+#define glad_glMultiTexCoord3fv (glad_gl_current->glad_glMultiTexCoord3fv)
+#define glad_glMultiTexCoord3i (glad_gl_current->glad_glMultiTexCoord3i)
+#define glad_glMultiTexCoord3iv (glad_gl_current->glad_glMultiTexCoord3iv)
+#define glad_glMultiTexCoord3s (glad_gl_current->glad_glMultiTexCoord3s)
+#define glad_glMultiTexCoord3sv (glad_gl_current->glad_glMultiTexCoord3sv)
+#define glad_glMultiTexCoord4d (glad_gl_current->glad_glMultiTexCoord4d)
+#define glad_glMultiTexCoord4dv (glad_gl_current->glad_glMultiTexCoord4dv)
+#define glad_glMultiTexCoord4f (glad_gl_current->glad_glMultiTexCoord4f)
+#define glad_glMultiTexCoord4fv (glad_gl_current->glad_glMultiTexCoord4fv)
+#define glad_glMultiTexCoord4i (glad_gl_current->glad_glMultiTexCoord4i)
+#define glad_glMultiTexCoord4iv (glad_gl_current->glad_glMultiTexCoord4iv)
+#define glad_glMultiTexCoord4s (glad_gl_current->glad_glMultiTexCoord4s)
+#define glad_glMultiTexCoord4sv (glad_gl_current->glad_glMultiTexCoord4sv)
+#define glad_glLoadTransposeMatrixf (glad_gl_current->glad_glLoadTransposeMatrixf)
+#define glad_glLoadTransposeMatrixd (glad_gl_current->glad_glLoadTransposeMatrixd)
+#define glad_glMultTransposeMatrixf (glad_gl_current->glad_glMultTransposeMatrixf)
+#define glad_glMultTransposeMatrixd (glad_gl_current->glad_glMultTransposeMatrixd)
+#define glad_glBlendFuncSeparate (glad_gl_current->glad_glBlendFuncSeparate)
+#define glad_glMultiDrawArrays (glad_gl_current->glad_glMultiDrawArrays)
+#define glad_glMultiDrawElements (glad_gl_current->glad_glMultiDrawElements)
+#define glad_glPointParameterf (glad_gl_current->glad_glPointParameterf)
+#define glad_glPointParameterfv (glad_gl_current->glad_glPointParameterfv)
+#define glad_glPointParameteri (glad_gl_current->glad_glPointParameteri)
+#define glad_glPointParameteriv (glad_gl_current->glad_glPointParameteriv)
+#define glad_glFogCoordf (glad_gl_current->glad_glFogCoordf)
+#define glad_glFogCoordfv (glad_gl_current->glad_glFogCoordfv)
+#define glad_glFogCoordd (glad_gl_current->glad_glFogCoordd)
+#define glad_glFogCoorddv (glad_gl_current->glad_glFogCoorddv)
+#define glad_glFogCoordPointer (glad_gl_current->glad_glFogCoordPointer)
+#define glad_glSecondaryColor3b (glad_gl_current->glad_glSecondaryColor3b)
+#define glad_glSecondaryColor3bv (glad_gl_current->glad_glSecondaryColor3bv)
+#define glad_glSecondaryColor3d (glad_gl_current->glad_glSecondaryColor3d)
+#define glad_glSecondaryColor3dv (glad_gl_current->glad_glSecondaryColor3dv)
+#define glad_glSecondaryColor3f (glad_gl_current->glad_glSecondaryColor3f)
+#define glad_glSecondaryColor3fv (glad_gl_current->glad_glSecondaryColor3fv)
+#define glad_glSecondaryColor3i (glad_gl_current->glad_glSecondaryColor3i)
+#define glad_glSecondaryColor3iv (glad_gl_current->glad_glSecondaryColor3iv)
+#define glad_glSecondaryColor3s (glad_gl_current->glad_glSecondaryColor3s)
+#define glad_glSecondaryColor3sv (glad_gl_current->glad_glSecondaryColor3sv)
+#define glad_glSecondaryColor3ub (glad_gl_current->glad_glSecondaryColor3ub)
+#define glad_glSecondaryColor3ubv (glad_gl_current->glad_glSecondaryColor3ubv)
+#define glad_glSecondaryColor3ui (glad_gl_current->glad_glSecondaryColor3ui)
+#define glad_glSecondaryColor3uiv (glad_gl_current->glad_glSecondaryColor3uiv)
+#define glad_glSecondaryColor3us (glad_gl_current->glad_glSecondaryColor3us)
+#define glad_glSecondaryColor3usv (glad_gl_current->glad_glSecondaryColor3usv)
+#define glad_glSecondaryColorPointer (glad_gl_current->glad_glSecondaryColorPointer)
+#define glad_glWindowPos2d (glad_gl_current->glad_glWindowPos2d)
+#define glad_glWindowPos2dv (glad_gl_current->glad_glWindowPos2dv)
+#define glad_glWindowPos2f (glad_gl_current->glad_glWindowPos2f)
+#define glad_glWindowPos2fv (glad_gl_current->glad_glWindowPos2fv)
+#define glad_glWindowPos2i (glad_gl_current->glad_glWindowPos2i)
+#define glad_glWindowPos2iv (glad_gl_current->glad_glWindowPos2iv)
+#define glad_glWindowPos2s (glad_gl_current->glad_glWindowPos2s)
+#define glad_glWindowPos2sv (glad_gl_current->glad_glWindowPos2sv)
+#define glad_glWindowPos3d (glad_gl_current->glad_glWindowPos3d)
+#define glad_glWindowPos3dv (glad_gl_current->glad_glWindowPos3dv)
+#define glad_glWindowPos3f (glad_gl_current->glad_glWindowPos3f)
+#define glad_glWindowPos3fv (glad_gl_current->glad_glWindowPos3fv)
+#define glad_glWindowPos3i (glad_gl_current->glad_glWindowPos3i)
+#define glad_glWindowPos3iv (glad_gl_current->glad_glWindowPos3iv)
+#define glad_glWindowPos3s (glad_gl_current->glad_glWindowPos3s)
+#define glad_glWindowPos3sv (glad_gl_current->glad_glWindowPos3sv)
+#define glad_glBlendColor (glad_gl_current->glad_glBlendColor)
+#define glad_glBlendEquation (glad_gl_current->glad_glBlendEquation)
+#define glad_glGenQueries (glad_gl_current->glad_glGenQueries)
+#define glad_glDeleteQueries (glad_gl_current->glad_glDeleteQueries)
+#define glad_glIsQuery (glad_gl_current->glad_glIsQuery)
+#define glad_glBeginQuery (glad_gl_current->glad_glBeginQuery)
+#define glad_glEndQuery (glad_gl_current->glad_glEndQuery)
+#define glad_glGetQueryiv (glad_gl_current->glad_glGetQueryiv)
+#define glad_glGetQueryObjectiv (glad_gl_current->glad_glGetQueryObjectiv)
+#define glad_glGetQueryObjectuiv (glad_gl_current->glad_glGetQueryObjectuiv)
+#define glad_glBindBuffer (glad_gl_current->glad_glBindBuffer)
+#define glad_glDeleteBuffers (glad_gl_current->glad_glDeleteBuffers)
+#define glad_glGenBuffers (glad_gl_current->glad_glGenBuffers)
+#define glad_glIsBuffer (glad_gl_current->glad_glIsBuffer)
+#define glad_glBufferData (glad_gl_current->glad_glBufferData)
+#define glad_glBufferSubData (glad_gl_current->glad_glBufferSubData)
+#define glad_glGetBufferSubData (glad_gl_current->glad_glGetBufferSubData)
+#define glad_glMapBuffer (glad_gl_current->glad_glMapBuffer)
+#define glad_glUnmapBuffer (glad_gl_current->glad_glUnmapBuffer)
+#define glad_glGetBufferParameteriv (glad_gl_current->glad_glGetBufferParameteriv)
+#define glad_glGetBufferPointerv (glad_gl_current->glad_glGetBufferPointerv)
+#define glad_glBlendEquationSeparate (glad_gl_current->glad_glBlendEquationSeparate)
+#define glad_glDrawBuffers (glad_gl_current->glad_glDrawBuffers)
+#define glad_glStencilOpSeparate (glad_gl_current->glad_glStencilOpSeparate)
+#define glad_glStencilFuncSeparate (glad_gl_current->glad_glStencilFuncSeparate)
+#define glad_glStencilMaskSeparate (glad_gl_current->glad_glStencilMaskSeparate)
+#define glad_glAttachShader (glad_gl_current->glad_glAttachShader)
+#define glad_glBindAttribLocation (glad_gl_current->glad_glBindAttribLocation)
+#define glad_glCompileShader (glad_gl_current->glad_glCompileShader)
+#define glad_glCreateProgram (glad_gl_current->glad_glCreateProgram)
+#define glad_glCreateShader (glad_gl_current->glad_glCreateShader)
+#define glad_glDeleteProgram (glad_gl_current->glad_glDeleteProgram)
+#define glad_glDeleteShader (glad_gl_current->glad_glDeleteShader)
+#define glad_glDetachShader (glad_gl_current->glad_glDetachShader)
+#define glad_glDisableVertexAttribArray (glad_gl_current->glad_glDisableVertexAttribArray)
+#define glad_glEnableVertexAttribArray (glad_gl_current->glad_glEnableVertexAttribArray)
+#define glad_glGetActiveAttrib (glad_gl_current->glad_glGetActiveAttrib)
+#define glad_glGetActiveUniform (glad_gl_current->glad_glGetActiveUniform)
+#define glad_glGetAttachedShaders (glad_gl_current->glad_glGetAttachedShaders)
+#define glad_glGetAttribLocation (glad_gl_current->glad_glGetAttribLocation)
+#define glad_glGetProgramiv (glad_gl_current->glad_glGetProgramiv)
+#define glad_glGetProgramInfoLog (glad_gl_current->glad_glGetProgramInfoLog)
+#define glad_glGetShaderiv (glad_gl_current->glad_glGetShaderiv)
+#define glad_glGetShaderInfoLog (glad_gl_current->glad_glGetShaderInfoLog)
+#define glad_glGetShaderSource (glad_gl_current->glad_glGetShaderSource)
+#define glad_glGetUniformLocation (glad_gl_current->glad_glGetUniformLocation)
+#define glad_glGetUniformfv (glad_gl_current->glad_glGetUniformfv)
+#define glad_glGetUniformiv (glad_gl_current->glad_glGetUniformiv)
+#define glad_glGetVertexAttribdv (glad_gl_current->glad_glGetVertexAttribdv)
+#define glad_glGetVertexAttribfv (glad_gl_current->glad_glGetVertexAttribfv)
+#define glad_glGetVertexAttribiv (glad_gl_current->glad_glGetVertexAttribiv)
+#define glad_glGetVertexAttribPointerv (glad_gl_current->glad_glGetVertexAttribPointerv)
+#define glad_glIsProgram (glad_gl_current->glad_glIsProgram)
+#define glad_glIsShader (glad_gl_current->glad_glIsShader)
+#define glad_glLinkProgram (glad_gl_current->glad_glLinkProgram)
+#define glad_glShaderSource (glad_gl_current->glad_glShaderSource)
+#define glad_glUseProgram (glad_gl_current->glad_glUseProgram)
+#define glad_glUniform1f (glad_gl_current->glad_glUniform1f)
+#define glad_glUniform2f (glad_gl_current->glad_glUniform2f)
+#define glad_glUniform3f (glad_gl_current->glad_glUniform3f)
+#define glad_glUniform4f (glad_gl_current->glad_glUniform4f)
+#define glad_glUniform1i (glad_gl_current->glad_glUniform1i)
+#define glad_glUniform2i (glad_gl_current->glad_glUniform2i)
+#define glad_glUniform3i (glad_gl_current->glad_glUniform3i)
+#define glad_glUniform4i (glad_gl_current->glad_glUniform4i)
+#define glad_glUniform1fv (glad_gl_current->glad_glUniform1fv)
+#define glad_glUniform2fv (glad_gl_current->glad_glUniform2fv)
+#define glad_glUniform3fv (glad_gl_current->glad_glUniform3fv)
+#define glad_glUniform4fv (glad_gl_current->glad_glUniform4fv)
+#define glad_glUniform1iv (glad_gl_current->glad_glUniform1iv)
+#define glad_glUniform2iv (glad_gl_current->glad_glUniform2iv)
+#define glad_glUniform3iv (glad_gl_current->glad_glUniform3iv)
+#define glad_glUniform4iv (glad_gl_current->glad_glUniform4iv)
+#define glad_glUniformMatrix2fv (glad_gl_current->glad_glUniformMatrix2fv)
+#define glad_glUniformMatrix3fv (glad_gl_current->glad_glUniformMatrix3fv)
+#define glad_glUniformMatrix4fv (glad_gl_current->glad_glUniformMatrix4fv)
+#define glad_glValidateProgram (glad_gl_current->glad_glValidateProgram)
+#define glad_glVertexAttrib1d (glad_gl_current->glad_glVertexAttrib1d)
+#define glad_glVertexAttrib1dv (glad_gl_current->glad_glVertexAttrib1dv)
+#define glad_glVertexAttrib1f (glad_gl_current->glad_glVertexAttrib1f)
+#define glad_glVertexAttrib1fv (glad_gl_current->glad_glVertexAttrib1fv)
+#define glad_glVertexAttrib1s (glad_gl_current->glad_glVertexAttrib1s)
+#define glad_glVertexAttrib1sv (glad_gl_current->glad_glVertexAttrib1sv)
+#define glad_glVertexAttrib2d (glad_gl_current->glad_glVertexAttrib2d)
+#define glad_glVertexAttrib2dv (glad_gl_current->glad_glVertexAttrib2dv)
+#define glad_glVertexAttrib2f (glad_gl_current->glad_glVertexAttrib2f)
+#define glad_glVertexAttrib2fv (glad_gl_current->glad_glVertexAttrib2fv)
+#define glad_glVertexAttrib2s (glad_gl_current->glad_glVertexAttrib2s)
+#define glad_glVertexAttrib2sv (glad_gl_current->glad_glVertexAttrib2sv)
+#define glad_glVertexAttrib3d (glad_gl_current->glad_glVertexAttrib3d)
+#define glad_glVertexAttrib3dv (glad_gl_current->glad_glVertexAttrib3dv)
+#define glad_glVertexAttrib3f (glad_gl_current->glad_glVertexAttrib3f)
+#define glad_glVertexAttrib3fv (glad_gl_current->glad_glVertexAttrib3fv)
+#define glad_glVertexAttrib3s (glad_gl_current->glad_glVertexAttrib3s)
+#define glad_glVertexAttrib3sv (glad_gl_current->glad_glVertexAttrib3sv)
+#define glad_glVertexAttrib4Nbv (glad_gl_current->glad_glVertexAttrib4Nbv)
+#define glad_glVertexAttrib4Niv (glad_gl_current->glad_glVertexAttrib4Niv)
+#define glad_glVertexAttrib4Nsv (glad_gl_current->glad_glVertexAttrib4Nsv)
+#define glad_glVertexAttrib4Nub (glad_gl_current->glad_glVertexAttrib4Nub)
+#define glad_glVertexAttrib4Nubv (glad_gl_current->glad_glVertexAttrib4Nubv)
+#define glad_glVertexAttrib4Nuiv (glad_gl_current->glad_glVertexAttrib4Nuiv)
+#define glad_glVertexAttrib4Nusv (glad_gl_current->glad_glVertexAttrib4Nusv)
+#define glad_glVertexAttrib4bv (glad_gl_current->glad_glVertexAttrib4bv)
+#define glad_glVertexAttrib4d (glad_gl_current->glad_glVertexAttrib4d)
+#define glad_glVertexAttrib4dv (glad_gl_current->glad_glVertexAttrib4dv)
+#define glad_glVertexAttrib4f (glad_gl_current->glad_glVertexAttrib4f)
+#define glad_glVertexAttrib4fv (glad_gl_current->glad_glVertexAttrib4fv)
+#define glad_glVertexAttrib4iv (glad_gl_current->glad_glVertexAttrib4iv)
+#define glad_glVertexAttrib4s (glad_gl_current->glad_glVertexAttrib4s)
+#define glad_glVertexAttrib4sv (glad_gl_current->glad_glVertexAttrib4sv)
+#define glad_glVertexAttrib4ubv (glad_gl_current->glad_glVertexAttrib4ubv)
+#define glad_glVertexAttrib4uiv (glad_gl_current->glad_glVertexAttrib4uiv)
+#define glad_glVertexAttrib4usv (glad_gl_current->glad_glVertexAttrib4usv)
+#define glad_glVertexAttribPointer (glad_gl_current->glad_glVertexAttribPointer)
+#define glad_glUniformMatrix2x3fv (glad_gl_current->glad_glUniformMatrix2x3fv)
+#define glad_glUniformMatrix3x2fv (glad_gl_current->glad_glUniformMatrix3x2fv)
+#define glad_glUniformMatrix2x4fv (glad_gl_current->glad_glUniformMatrix2x4fv)
+#define glad_glUniformMatrix4x2fv (glad_gl_current->glad_glUniformMatrix4x2fv)
+#define glad_glUniformMatrix3x4fv (glad_gl_current->glad_glUniformMatrix3x4fv)
+#define glad_glUniformMatrix4x3fv (glad_gl_current->glad_glUniformMatrix4x3fv)
+#define glad_glColorMaski (glad_gl_current->glad_glColorMaski)
+#define glad_glGetBooleani_v (glad_gl_current->glad_glGetBooleani_v)
+#define glad_glGetIntegeri_v (glad_gl_current->glad_glGetIntegeri_v)
+#define glad_glEnablei (glad_gl_current->glad_glEnablei)
+#define glad_glDisablei (glad_gl_current->glad_glDisablei)
+#define glad_glIsEnabledi (glad_gl_current->glad_glIsEnabledi)
+#define glad_glBeginTransformFeedback (glad_gl_current->glad_glBeginTransformFeedback)
+#define glad_glEndTransformFeedback (glad_gl_current->glad_glEndTransformFeedback)
+#define glad_glBindBufferRange (glad_gl_current->glad_glBindBufferRange)
+#define glad_glBindBufferBase (glad_gl_current->glad_glBindBufferBase)
+#define glad_glTransformFeedbackVaryings (glad_gl_current->glad_glTransformFeedbackVaryings)
+#define glad_glGetTransformFeedbackVarying (glad_gl_current->glad_glGetTransformFeedbackVarying)
+#define glad_glClampColor (glad_gl_current->glad_glClampColor)
+#define glad_glBeginConditionalRender (glad_gl_current->glad_glBeginConditionalRender)
+#define glad_glEndConditionalRender (glad_gl_current->glad_glEndConditionalRender)
+#define glad_glVertexAttribIPointer (glad_gl_current->glad_glVertexAttribIPointer)
+#define glad_glGetVertexAttribIiv (glad_gl_current->glad_glGetVertexAttribIiv)
+#define glad_glGetVertexAttribIuiv (glad_gl_current->glad_glGetVertexAttribIuiv)
+#define glad_glVertexAttribI1i (glad_gl_current->glad_glVertexAttribI1i)
+#define glad_glVertexAttribI2i (glad_gl_current->glad_glVertexAttribI2i)
+#define glad_glVertexAttribI3i (glad_gl_current->glad_glVertexAttribI3i)
+#define glad_glVertexAttribI4i (glad_gl_current->glad_glVertexAttribI4i)
+#define glad_glVertexAttribI1ui (glad_gl_current->glad_glVertexAttribI1ui)
+#define glad_glVertexAttribI2ui (glad_gl_current->glad_glVertexAttribI2ui)
+#define glad_glVertexAttribI3ui (glad_gl_current->glad_glVertexAttribI3ui)
+#define glad_glVertexAttribI4ui (glad_gl_current->glad_glVertexAttribI4ui)
+#define glad_glVertexAttribI1iv (glad_gl_current->glad_glVertexAttribI1iv)
+#define glad_glVertexAttribI2iv (glad_gl_current->glad_glVertexAttribI2iv)
+#define glad_glVertexAttribI3iv (glad_gl_current->glad_glVertexAttribI3iv)
+#define glad_glVertexAttribI4iv (glad_gl_current->glad_glVertexAttribI4iv)
+#define glad_glVertexAttribI1uiv (glad_gl_current->glad_glVertexAttribI1uiv)
+#define glad_glVertexAttribI2uiv (glad_gl_current->glad_glVertexAttribI2uiv)
+#define glad_glVertexAttribI3uiv (glad_gl_current->glad_glVertexAttribI3uiv)
+#define glad_glVertexAttribI4uiv (glad_gl_current->glad_glVertexAttribI4uiv)
+#define glad_glVertexAttribI4bv (glad_gl_current->glad_glVertexAttribI4bv)
+#define glad_glVertexAttribI4sv (glad_gl_current->glad_glVertexAttribI4sv)
+#define glad_glVertexAttribI4ubv (glad_gl_current->glad_glVertexAttribI4ubv)
+#define glad_glVertexAttribI4usv (glad_gl_current->glad_glVertexAttribI4usv)
+#define glad_glGetUniformuiv (glad_gl_current->glad_glGetUniformuiv)
+#define glad_glBindFragDataLocation (glad_gl_current->glad_glBindFragDataLocation)
+#define glad_glGetFragDataLocation (glad_gl_current->glad_glGetFragDataLocation)
+#define glad_glUniform1ui (glad_gl_current->glad_glUniform1ui)
+#define glad_glUniform2ui (glad_gl_current->glad_glUniform2ui)
+#define glad_glUniform3ui (glad_gl_current->glad_glUniform3ui)
+#define glad_glUniform4ui (glad_gl_current->glad_glUniform4ui)
+#define glad_glUniform1uiv (glad_gl_current->glad_glUniform1uiv)
+#define glad_glUniform2uiv (glad_gl_current->glad_glUniform2uiv)
+#define glad_glUniform3uiv (glad_gl_current->glad_glUniform3uiv)
+#define glad_glUniform4uiv (glad_gl_current->glad_glUniform4uiv)
+#define glad_glTexParameterIiv (glad_gl_current->glad_glTexParameterIiv)
+#define glad_glTexParameterIuiv (glad_gl_current->glad_glTexParameterIuiv)
+#define glad_glGetTexParameterIiv (glad_gl_current->glad_glGetTexParameterIiv)
+#define glad_glGetTexParameterIuiv (glad_gl_current->glad_glGetTexParameterIuiv)
+#define glad_glClearBufferiv (glad_gl_current->glad_glClearBufferiv)
+#define glad_glClearBufferuiv (glad_gl_current->glad_glClearBufferuiv)
+#define glad_glClearBufferfv (glad_gl_current->glad_glClearBufferfv)
+#define glad_glClearBufferfi (glad_gl_current->glad_glClearBufferfi)
+#define glad_glGetStringi (glad_gl_current->glad_glGetStringi)
+#define glad_glIsRenderbuffer (glad_gl_current->glad_glIsRenderbuffer)
+#define glad_glBindRenderbuffer (glad_gl_current->glad_glBindRenderbuffer)
+#define glad_glDeleteRenderbuffers (glad_gl_current->glad_glDeleteRenderbuffers)
+#define glad_glGenRenderbuffers (glad_gl_current->glad_glGenRenderbuffers)
+#define glad_glRenderbufferStorage (glad_gl_current->glad_glRenderbufferStorage)
+#define glad_glGetRenderbufferParameteriv (glad_gl_current->glad_glGetRenderbufferParameteriv)
+#define glad_glIsFramebuffer (glad_gl_current->glad_glIsFramebuffer)
+#define glad_glBindFramebuffer (glad_gl_current->glad_glBindFramebuffer)
+#define glad_glDeleteFramebuffers (glad_gl_current->glad_glDeleteFramebuffers)
+#define glad_glGenFramebuffers (glad_gl_current->glad_glGenFramebuffers)
+#define glad_glCheckFramebufferStatus (glad_gl_current->glad_glCheckFramebufferStatus)
+#define glad_glFramebufferTexture1D (glad_gl_current->glad_glFramebufferTexture1D)
+#define glad_glFramebufferTexture2D (glad_gl_current->glad_glFramebufferTexture2D)
+#define glad_glFramebufferTexture3D (glad_gl_current->glad_glFramebufferTexture3D)
+#define glad_glFramebufferRenderbuffer (glad_gl_current->glad_glFramebufferRenderbuffer)
+#define glad_glGetFramebufferAttachmentParameteriv (glad_gl_current->glad_glGetFramebufferAttachmentParameteriv)
+#define glad_glGenerateMipmap (glad_gl_current->glad_glGenerateMipmap)
+#define glad_glBlitFramebuffer (glad_gl_current->glad_glBlitFramebuffer)
+#define glad_glRenderbufferStorageMultisample (glad_gl_current->glad_glRenderbufferStorageMultisample)
+#define glad_glFramebufferTextureLayer (glad_gl_current->glad_glFramebufferTextureLayer)
+#define glad_glMapBufferRange (glad_gl_current->glad_glMapBufferRange)
+#define glad_glFlushMappedBufferRange (glad_gl_current->glad_glFlushMappedBufferRange)
+#define glad_glBindVertexArray (glad_gl_current->glad_glBindVertexArray)
+#define glad_glDeleteVertexArrays (glad_gl_current->glad_glDeleteVertexArrays)
+#define glad_glGenVertexArrays (glad_gl_current->glad_glGenVertexArrays)
+#define glad_glIsVertexArray (glad_gl_current->glad_glIsVertexArray)
+#define glad_glDrawArraysInstanced (glad_gl_current->glad_glDrawArraysInstanced)
+#define glad_glDrawElementsInstanced (glad_gl_current->glad_glDrawElementsInstanced)
+#define glad_glTexBuffer (glad_gl_current->glad_glTexBuffer)
+#define glad_glPrimitiveRestartIndex (glad_gl_current->glad_glPrimitiveRestartIndex)
+#define glad_glCopyBufferSubData (glad_gl_current->glad_glCopyBufferSubData)
+#define glad_glGetUniformIndices (glad_gl_current->glad_glGetUniformIndices)
+#define glad_glGetActiveUniformsiv (glad_gl_current->glad_glGetActiveUniformsiv)
+#define glad_glGetActiveUniformName (glad_gl_current->glad_glGetActiveUniformName)
+#define glad_glGetUniformBlockIndex (glad_gl_current->glad_glGetUniformBlockIndex)
+#define glad_glGetActiveUniformBlockiv (glad_gl_current->glad_glGetActiveUniformBlockiv)
+#define glad_glGetActiveUniformBlockName (glad_gl_current->glad_glGetActiveUniformBlockName)
+#define glad_glUniformBlockBinding (glad_gl_current->glad_glUniformBlockBinding)
+#define glad_glDrawElementsBaseVertex (glad_gl_current->glad_glDrawElementsBaseVertex)
+#define glad_glDrawRangeElementsBaseVertex (glad_gl_current->glad_glDrawRangeElementsBaseVertex)
+#define glad_glDrawElementsInstancedBaseVertex (glad_gl_current->glad_glDrawElementsInstancedBaseVertex)
+#define glad_glMultiDrawElementsBaseVertex (glad_gl_current->glad_glMultiDrawElementsBaseVertex)
+#define glad_glProvokingVertex (glad_gl_current->glad_glProvokingVertex)
+#define glad_glFenceSync (glad_gl_current->glad_glFenceSync)
+#define glad_glIsSync (glad_gl_current->glad_glIsSync)
+#define glad_glDeleteSync (glad_gl_current->glad_glDeleteSync)
+#define glad_glClientWaitSync (glad_gl_current->glad_glClientWaitSync)
+#define glad_glWaitSync (glad_gl_current->glad_glWaitSync)
+#define glad_glGetInteger64v (glad_gl_current->glad_glGetInteger64v)
+#define glad_glGetSynciv (glad_gl_current->glad_glGetSynciv)
+#define glad_glGetInteger64i_v (glad_gl_current->glad_glGetInteger64i_v)
+#define glad_glGetBufferParameteri64v (glad_gl_current->glad_glGetBufferParameteri64v)
+#define glad_glFramebufferTexture (glad_gl_current->glad_glFramebufferTexture)
+#define glad_glTexImage2DMultisample (glad_gl_current->glad_glTexImage2DMultisample)
+#define glad_glTexImage3DMultisample (glad_gl_current->glad_glTexImage3DMultisample)
+#define glad_glGetMultisamplefv (glad_gl_current->glad_glGetMultisamplefv)
+#define glad_glSampleMaski (glad_gl_current->glad_glSampleMaski)
+#define glad_glBindFragDataLocationIndexed (glad_gl_current->glad_glBindFragDataLocationIndexed)
+#define glad_glGetFragDataIndex (glad_gl_current->glad_glGetFragDataIndex)
+#define glad_glGenSamplers (glad_gl_current->glad_glGenSamplers)
+#define glad_glDeleteSamplers (glad_gl_current->glad_glDeleteSamplers)
+#define glad_glIsSampler (glad_gl_current->glad_glIsSampler)
+#define glad_glBindSampler (glad_gl_current->glad_glBindSampler)
+#define glad_glSamplerParameteri (glad_gl_current->glad_glSamplerParameteri)
+#define glad_glSamplerParameteriv (glad_gl_current->glad_glSamplerParameteriv)
+#define glad_glSamplerParameterf (glad_gl_current->glad_glSamplerParameterf)
+#define glad_glSamplerParameterfv (glad_gl_current->glad_glSamplerParameterfv)
+#define glad_glSamplerParameterIiv (glad_gl_current->glad_glSamplerParameterIiv)
+#define glad_glSamplerParameterIuiv (glad_gl_current->glad_glSamplerParameterIuiv)
+#define glad_glGetSamplerParameteriv (glad_gl_current->glad_glGetSamplerParameteriv)
+#define glad_glGetSamplerParameterIiv (glad_gl_current->glad_glGetSamplerParameterIiv)
+#define glad_glGetSamplerParameterfv (glad_gl_current->glad_glGetSamplerParameterfv)
+#define glad_glGetSamplerParameterIuiv (glad_gl_current->glad_glGetSamplerParameterIuiv)
+#define glad_glQueryCounter (glad_gl_current->glad_glQueryCounter)
+#define glad_glGetQueryObjecti64v (glad_gl_current->glad_glGetQueryObjecti64v)
+#define glad_glGetQueryObjectui64v (glad_gl_current->glad_glGetQueryObjectui64v)
+#define glad_glVertexAttribDivisor (glad_gl_current->glad_glVertexAttribDivisor)
+#define glad_glVertexAttribP1ui (glad_gl_current->glad_glVertexAttribP1ui)
+#define glad_glVertexAttribP1uiv (glad_gl_current->glad_glVertexAttribP1uiv)
+#define glad_glVertexAttribP2ui (glad_gl_current->glad_glVertexAttribP2ui)
+#define glad_glVertexAttribP2uiv (glad_gl_current->glad_glVertexAttribP2uiv)
+#define glad_glVertexAttribP3ui (glad_gl_current->glad_glVertexAttribP3ui)
+#define glad_glVertexAttribP3uiv (glad_gl_current->glad_glVertexAttribP3uiv)
+#define glad_glVertexAttribP4ui (glad_gl_current->glad_glVertexAttribP4ui)
+#define glad_glVertexAttribP4uiv (glad_gl_current->glad_glVertexAttribP4uiv)
+#define glad_glVertexP2ui (glad_gl_current->glad_glVertexP2ui)
+#define glad_glVertexP2uiv (glad_gl_current->glad_glVertexP2uiv)
+#define glad_glVertexP3ui (glad_gl_current->glad_glVertexP3ui)
+#define glad_glVertexP3uiv (glad_gl_current->glad_glVertexP3uiv)
+#define glad_glVertexP4ui (glad_gl_current->glad_glVertexP4ui)
+#define glad_glVertexP4uiv (glad_gl_current->glad_glVertexP4uiv)
+#define glad_glTexCoordP1ui (glad_gl_current->glad_glTexCoordP1ui)
+#define glad_glTexCoordP1uiv (glad_gl_current->glad_glTexCoordP1uiv)
+#define glad_glTexCoordP2ui (glad_gl_current->glad_glTexCoordP2ui)
+#define glad_glTexCoordP2uiv (glad_gl_current->glad_glTexCoordP2uiv)
+#define glad_glTexCoordP3ui (glad_gl_current->glad_glTexCoordP3ui)
+#define glad_glTexCoordP3uiv (glad_gl_current->glad_glTexCoordP3uiv)
+#define glad_glTexCoordP4ui (glad_gl_current->glad_glTexCoordP4ui)
+#define glad_glTexCoordP4uiv (glad_gl_current->glad_glTexCoordP4uiv)
+#define glad_glMultiTexCoordP1ui (glad_gl_current->glad_glMultiTexCoordP1ui)
+#define glad_glMultiTexCoordP1uiv (glad_gl_current->glad_glMultiTexCoordP1uiv)
+#define glad_glMultiTexCoordP2ui (glad_gl_current->glad_glMultiTexCoordP2ui)
+#define glad_glMultiTexCoordP2uiv (glad_gl_current->glad_glMultiTexCoordP2uiv)
+#define glad_glMultiTexCoordP3ui (glad_gl_current->glad_glMultiTexCoordP3ui)
+#define glad_glMultiTexCoordP3uiv (glad_gl_current->glad_glMultiTexCoordP3uiv)
+#define glad_glMultiTexCoordP4ui (glad_gl_current->glad_glMultiTexCoordP4ui)
+#define glad_glMultiTexCoordP4uiv (glad_gl_current->glad_glMultiTexCoordP4uiv)
+#define glad_glNormalP3ui (glad_gl_current->glad_glNormalP3ui)
+#define glad_glNormalP3uiv (glad_gl_current->glad_glNormalP3uiv)
+#define glad_glColorP3ui (glad_gl_current->glad_glColorP3ui)
+#define glad_glColorP3uiv (glad_gl_current->glad_glColorP3uiv)
+#define glad_glColorP4ui (glad_gl_current->glad_glColorP4ui)
+#define glad_glColorP4uiv (glad_gl_current->glad_glColorP4uiv)
+#define glad_glSecondaryColorP3ui (glad_gl_current->glad_glSecondaryColorP3ui)
+#define glad_glSecondaryColorP3uiv (glad_gl_current->glad_glSecondaryColorP3uiv)
+#define glad_glMinSampleShading (glad_gl_current->glad_glMinSampleShading)
+#define glad_glBlendEquationi (glad_gl_current->glad_glBlendEquationi)
+#define glad_glBlendEquationSeparatei (glad_gl_current->glad_glBlendEquationSeparatei)
+#define glad_glBlendFunci (glad_gl_current->glad_glBlendFunci)
+#define glad_glBlendFuncSeparatei (glad_gl_current->glad_glBlendFuncSeparatei)
+#define glad_glDrawArraysIndirect (glad_gl_current->glad_glDrawArraysIndirect)
+#define glad_glDrawElementsIndirect (glad_gl_current->glad_glDrawElementsIndirect)
+#define glad_glUniform1d (glad_gl_current->glad_glUniform1d)
+#define glad_glUniform2d (glad_gl_current->glad_glUniform2d)
+#define glad_glUniform3d (glad_gl_current->glad_glUniform3d)
+#define glad_glUniform4d (glad_gl_current->glad_glUniform4d)
+#define glad_glUniform1dv (glad_gl_current->glad_glUniform1dv)
+#define glad_glUniform2dv (glad_gl_current->glad_glUniform2dv)
+#define glad_glUniform3dv (glad_gl_current->glad_glUniform3dv)
+#define glad_glUniform4dv (glad_gl_current->glad_glUniform4dv)
+#define glad_glUniformMatrix2dv (glad_gl_current->glad_glUniformMatrix2dv)
+#define glad_glUniformMatrix3dv (glad_gl_current->glad_glUniformMatrix3dv)
+#define glad_glUniformMatrix4dv (glad_gl_current->glad_glUniformMatrix4dv)
+#define glad_glUniformMatrix2x3dv (glad_gl_current->glad_glUniformMatrix2x3dv)
+#define glad_glUniformMatrix2x4dv (glad_gl_current->glad_glUniformMatrix2x4dv)
+#define glad_glUniformMatrix3x2dv (glad_gl_current->glad_glUniformMatrix3x2dv)
+#define glad_glUniformMatrix3x4dv (glad_gl_current->glad_glUniformMatrix3x4dv)
+#define glad_glUniformMatrix4x2dv (glad_gl_current->glad_glUniformMatrix4x2dv)
+#define glad_glUniformMatrix4x3dv (glad_gl_current->glad_glUniformMatrix4x3dv)
+#define glad_glGetUniformdv (glad_gl_current->glad_glGetUniformdv)
+#define glad_glGetSubroutineUniformLocation (glad_gl_current->glad_glGetSubroutineUniformLocation)
+#define glad_glGetSubroutineIndex (glad_gl_current->glad_glGetSubroutineIndex)
+#define glad_glGetActiveSubroutineUniformiv (glad_gl_current->glad_glGetActiveSubroutineUniformiv)
+#define glad_glGetActiveSubroutineUniformName (glad_gl_current->glad_glGetActiveSubroutineUniformName)
+#define glad_glGetActiveSubroutineName (glad_gl_current->glad_glGetActiveSubroutineName)
+#define glad_glUniformSubroutinesuiv (glad_gl_current->glad_glUniformSubroutinesuiv)
+#define glad_glGetUniformSubroutineuiv (glad_gl_current->glad_glGetUniformSubroutineuiv)
+#define glad_glGetProgramStageiv (glad_gl_current->glad_glGetProgramStageiv)
+#define glad_glPatchParameteri (glad_gl_current->glad_glPatchParameteri)
+#define glad_glPatchParameterfv (glad_gl_current->glad_glPatchParameterfv)
+#define glad_glBindTransformFeedback (glad_gl_current->glad_glBindTransformFeedback)
+#define glad_glDeleteTransformFeedbacks (glad_gl_current->glad_glDeleteTransformFeedbacks)
+#define glad_glGenTransformFeedbacks (glad_gl_current->glad_glGenTransformFeedbacks)
+#define glad_glIsTransformFeedback (glad_gl_current->glad_glIsTransformFeedback)
+#define glad_glPauseTransformFeedback (glad_gl_current->glad_glPauseTransformFeedback)
+#define glad_glResumeTransformFeedback (glad_gl_current->glad_glResumeTransformFeedback)
+#define glad_glDrawTransformFeedback (glad_gl_current->glad_glDrawTransformFeedback)
+#define glad_glDrawTransformFeedbackStream (glad_gl_current->glad_glDrawTransformFeedbackStream)
+#define glad_glBeginQueryIndexed (glad_gl_current->glad_glBeginQueryIndexed)
+#define glad_glEndQueryIndexed (glad_gl_current->glad_glEndQueryIndexed)
+#define glad_glGetQueryIndexediv (glad_gl_current->glad_glGetQueryIndexediv)
+#define glad_glReleaseShaderCompiler (glad_gl_current->glad_glReleaseShaderCompiler)
+#define glad_glShaderBinary (glad_gl_current->glad_glShaderBinary)
+#define glad_glGetShaderPrecisionFormat (glad_gl_current->glad_glGetShaderPrecisionFormat)
+#define glad_glDepthRangef (glad_gl_current->glad_glDepthRangef)
+#define glad_glClearDepthf (glad_gl_current->glad_glClearDepthf)
+#define glad_glGetProgramBinary (glad_gl_current->glad_glGetProgramBinary)
+#define glad_glProgramBinary (glad_gl_current->glad_glProgramBinary)
+#define glad_glProgramParameteri (glad_gl_current->glad_glProgramParameteri)
+#define glad_glUseProgramStages (glad_gl_current->glad_glUseProgramStages)
+#define glad_glActiveShaderProgram (glad_gl_current->glad_glActiveShaderProgram)
+#define glad_glCreateShaderProgramv (glad_gl_current->glad_glCreateShaderProgramv)
+#define glad_glBindProgramPipeline (glad_gl_current->glad_glBindProgramPipeline)
+#define glad_glDeleteProgramPipelines (glad_gl_current->glad_glDeleteProgramPipelines)
+#define glad_glGenProgramPipelines (glad_gl_current->glad_glGenProgramPipelines)
+#define glad_glIsProgramPipeline (glad_gl_current->glad_glIsProgramPipeline)
+#define glad_glGetProgramPipelineiv (glad_gl_current->glad_glGetProgramPipelineiv)
+#define glad_glProgramUniform1i (glad_gl_current->glad_glProgramUniform1i)
+#define glad_glProgramUniform1iv (glad_gl_current->glad_glProgramUniform1iv)
+#define glad_glProgramUniform1f (glad_gl_current->glad_glProgramUniform1f)
+#define glad_glProgramUniform1fv (glad_gl_current->glad_glProgramUniform1fv)
+#define glad_glProgramUniform1d (glad_gl_current->glad_glProgramUniform1d)
+#define glad_glProgramUniform1dv (glad_gl_current->glad_glProgramUniform1dv)
+#define glad_glProgramUniform1ui (glad_gl_current->glad_glProgramUniform1ui)
+#define glad_glProgramUniform1uiv (glad_gl_current->glad_glProgramUniform1uiv)
+#define glad_glProgramUniform2i (glad_gl_current->glad_glProgramUniform2i)
+#define glad_glProgramUniform2iv (glad_gl_current->glad_glProgramUniform2iv)
+#define glad_glProgramUniform2f (glad_gl_current->glad_glProgramUniform2f)
+#define glad_glProgramUniform2fv (glad_gl_current->glad_glProgramUniform2fv)
+#define glad_glProgramUniform2d (glad_gl_current->glad_glProgramUniform2d)
+#define glad_glProgramUniform2dv (glad_gl_current->glad_glProgramUniform2dv)
+#define glad_glProgramUniform2ui (glad_gl_current->glad_glProgramUniform2ui)
+#define glad_glProgramUniform2uiv (glad_gl_current->glad_glProgramUniform2uiv)
+#define glad_glProgramUniform3i (glad_gl_current->glad_glProgramUniform3i)
+#define glad_glProgramUniform3iv (glad_gl_current->glad_glProgramUniform3iv)
+#define glad_glProgramUniform3f (glad_gl_current->glad_glProgramUniform3f)
+#define glad_glProgramUniform3fv (glad_gl_current->glad_glProgramUniform3fv)
+#define glad_glProgramUniform3d (glad_gl_current->glad_glProgramUniform3d)
+#define glad_glProgramUniform3dv (glad_gl_current->glad_glProgramUniform3dv)
+#define glad_glProgramUniform3ui (glad_gl_current->glad_glProgramUniform3ui)
+#define glad_glProgramUniform3uiv (glad_gl_current->glad_glProgramUniform3uiv)
+#define glad_glProgramUniform4i (glad_gl_current->glad_glProgramUniform4i)
+#define glad_glProgramUniform4iv (glad_gl_current->glad_glProgramUniform4iv)
+#define glad_glProgramUniform4f (glad_gl_current->glad_glProgramUniform4f)
+#define glad_glProgramUniform4fv (glad_gl_current->glad_glProgramUniform4fv)
+#define glad_glProgramUniform4d (glad_gl_current->glad_glProgramUniform4d)
+#define glad_glProgramUniform4dv (glad_gl_current->glad_glProgramUniform4dv)
+#define glad_glProgramUniform4ui (glad_gl_current->glad_glProgramUniform4ui)
+#define glad_glProgramUniform4uiv (glad_gl_current->glad_glProgramUniform4uiv)
+#define glad_glProgramUniformMatrix2fv (glad_gl_current->glad_glProgramUniformMatrix2fv)
+#define glad_glProgramUniformMatrix3fv (glad_gl_current->glad_glProgramUniformMatrix3fv)
+#define glad_glProgramUniformMatrix4fv (glad_gl_current->glad_glProgramUniformMatrix4fv)
+#define glad_glProgramUniformMatrix2dv (glad_gl_current->glad_glProgramUniformMatrix2dv)
+#define glad_glProgramUniformMatrix3dv (glad_gl_current->glad_glProgramUniformMatrix3dv)
+#define glad_glProgramUniformMatrix4dv (glad_gl_current->glad_glProgramUniformMatrix4dv)
+#define glad_glProgramUniformMatrix2x3fv (glad_gl_current->glad_glProgramUniformMatrix2x3fv)
+#define glad_glProgramUniformMatrix3x2fv (glad_gl_current->glad_glProgramUniformMatrix3x2fv)
+#define glad_glProgramUniformMatrix2x4fv (glad_gl_current->glad_glProgramUniformMatrix2x4fv)
+#define glad_glProgramUniformMatrix4x2fv (glad_gl_current->glad_glProgramUniformMatrix4x2fv)
+#define glad_glProgramUniformMatrix3x4fv (glad_gl_current->glad_glProgramUniformMatrix3x4fv)
+#define glad_glProgramUniformMatrix4x3fv (glad_gl_current->glad_glProgramUniformMatrix4x3fv)
+#define glad_glProgramUniformMatrix2x3dv (glad_gl_current->glad_glProgramUniformMatrix2x3dv)
+#define glad_glProgramUniformMatrix3x2dv (glad_gl_current->glad_glProgramUniformMatrix3x2dv)
+#define glad_glProgramUniformMatrix2x4dv (glad_gl_current->glad_glProgramUniformMatrix2x4dv)
+#define glad_glProgramUniformMatrix4x2dv (glad_gl_current->glad_glProgramUniformMatrix4x2dv)
+#define glad_glProgramUniformMatrix3x4dv (glad_gl_current->glad_glProgramUniformMatrix3x4dv)
+#define glad_glProgramUniformMatrix4x3dv (glad_gl_current->glad_glProgramUniformMatrix4x3dv)
+#define glad_glValidateProgramPipeline (glad_gl_current->glad_glValidateProgramPipeline)
+#define glad_glGetProgramPipelineInfoLog (glad_gl_current->glad_glGetProgramPipelineInfoLog)
+#define glad_glVertexAttribL1d (glad_gl_current->glad_glVertexAttribL1d)
+#define glad_glVertexAttribL2d (glad_gl_current->glad_glVertexAttribL2d)
+#define glad_glVertexAttribL3d (glad_gl_current->glad_glVertexAttribL3d)
+#define glad_glVertexAttribL4d (glad_gl_current->glad_glVertexAttribL4d)
+#define glad_glVertexAttribL1dv (glad_gl_current->glad_glVertexAttribL1dv)
+#define glad_glVertexAttribL2dv (glad_gl_current->glad_glVertexAttribL2dv)
+#define glad_glVertexAttribL3dv (glad_gl_current->glad_glVertexAttribL3dv)
+#define glad_glVertexAttribL4dv (glad_gl_current->glad_glVertexAttribL4dv)
+#define glad_glVertexAttribLPointer (glad_gl_current->glad_glVertexAttribLPointer)
+#define glad_glGetVertexAttribLdv (glad_gl_current->glad_glGetVertexAttribLdv)
+#define glad_glViewportArrayv (glad_gl_current->glad_glViewportArrayv)
+#define glad_glViewportIndexedf (glad_gl_current->glad_glViewportIndexedf)
+#define glad_glViewportIndexedfv (glad_gl_current->glad_glViewportIndexedfv)
+#define glad_glScissorArrayv (glad_gl_current->glad_glScissorArrayv)
+#define glad_glScissorIndexed (glad_gl_current->glad_glScissorIndexed)
+#define glad_glScissorIndexedv (glad_gl_current->glad_glScissorIndexedv)
+#define glad_glDepthRangeArrayv (glad_gl_current->glad_glDepthRangeArrayv)
+#define glad_glDepthRangeIndexed (glad_gl_current->glad_glDepthRangeIndexed)
+#define glad_glGetFloati_v (glad_gl_current->glad_glGetFloati_v)
+#define glad_glGetDoublei_v (glad_gl_current->glad_glGetDoublei_v)
+#define glad_glDrawArraysInstancedBaseInstance (glad_gl_current->glad_glDrawArraysInstancedBaseInstance)
+#define glad_glDrawElementsInstancedBaseInstance (glad_gl_current->glad_glDrawElementsInstancedBaseInstance)
+#define glad_glDrawElementsInstancedBaseVertexBaseInstance (glad_gl_current->glad_glDrawElementsInstancedBaseVertexBaseInstance)
+#define glad_glGetInternalformativ (glad_gl_current->glad_glGetInternalformativ)
+#define glad_glGetActiveAtomicCounterBufferiv (glad_gl_current->glad_glGetActiveAtomicCounterBufferiv)
+#define glad_glBindImageTexture (glad_gl_current->glad_glBindImageTexture)
+#define glad_glMemoryBarrier (glad_gl_current->glad_glMemoryBarrier)
+#define glad_glTexStorage1D (glad_gl_current->glad_glTexStorage1D)
+#define glad_glTexStorage2D (glad_gl_current->glad_glTexStorage2D)
+#define glad_glTexStorage3D (glad_gl_current->glad_glTexStorage3D)
+#define glad_glDrawTransformFeedbackInstanced (glad_gl_current->glad_glDrawTransformFeedbackInstanced)
+#define glad_glDrawTransformFeedbackStreamInstanced (glad_gl_current->glad_glDrawTransformFeedbackStreamInstanced)
+#define glad_glClearBufferData (glad_gl_current->glad_glClearBufferData)
+#define glad_glClearBufferSubData (glad_gl_current->glad_glClearBufferSubData)
+#define glad_glDispatchCompute (glad_gl_current->glad_glDispatchCompute)
+#define glad_glDispatchComputeIndirect (glad_gl_current->glad_glDispatchComputeIndirect)
+#define glad_glCopyImageSubData (glad_gl_current->glad_glCopyImageSubData)
+#define glad_glFramebufferParameteri (glad_gl_current->glad_glFramebufferParameteri)
+#define glad_glGetFramebufferParameteriv (glad_gl_current->glad_glGetFramebufferParameteriv)
+#define glad_glGetInternalformati64v (glad_gl_current->glad_glGetInternalformati64v)
+#define glad_glInvalidateTexSubImage (glad_gl_current->glad_glInvalidateTexSubImage)
+#define glad_glInvalidateTexImage (glad_gl_current->glad_glInvalidateTexImage)
+#define glad_glInvalidateBufferSubData (glad_gl_current->glad_glInvalidateBufferSubData)
+#define glad_glInvalidateBufferData (glad_gl_current->glad_glInvalidateBufferData)
+#define glad_glInvalidateFramebuffer (glad_gl_current->glad_glInvalidateFramebuffer)
+#define glad_glInvalidateSubFramebuffer (glad_gl_current->glad_glInvalidateSubFramebuffer)
+#define glad_glMultiDrawArraysIndirect (glad_gl_current->glad_glMultiDrawArraysIndirect)
+#define glad_glMultiDrawElementsIndirect (glad_gl_current->glad_glMultiDrawElementsIndirect)
+#define glad_glGetProgramInterfaceiv (glad_gl_current->glad_glGetProgramInterfaceiv)
+#define glad_glGetProgramResourceIndex (glad_gl_current->glad_glGetProgramResourceIndex)
+#define glad_glGetProgramResourceName (glad_gl_current->glad_glGetProgramResourceName)
+#define glad_glGetProgramResourceiv (glad_gl_current->glad_glGetProgramResourceiv)
+#define glad_glGetProgramResourceLocation (glad_gl_current->glad_glGetProgramResourceLocation)
+#define glad_glGetProgramResourceLocationIndex (glad_gl_current->glad_glGetProgramResourceLocationIndex)
+#define glad_glShaderStorageBlockBinding (glad_gl_current->glad_glShaderStorageBlockBinding)
+#define glad_glTexBufferRange (glad_gl_current->glad_glTexBufferRange)
+#define glad_glTexStorage2DMultisample (glad_gl_current->glad_glTexStorage2DMultisample)
+#define glad_glTexStorage3DMultisample (glad_gl_current->glad_glTexStorage3DMultisample)
+#define glad_glTextureView (glad_gl_current->glad_glTextureView)
+#define glad_glBindVertexBuffer (glad_gl_current->glad_glBindVertexBuffer)
+#define glad_glVertexAttribFormat (glad_gl_current->glad_glVertexAttribFormat)
+#define glad_glVertexAttribIFormat (glad_gl_current->glad_glVertexAttribIFormat)
+#define glad_glVertexAttribLFormat (glad_gl_current->glad_glVertexAttribLFormat)
+#define glad_glVertexAttribBinding (glad_gl_current->glad_glVertexAttribBinding)
+#define glad_glVertexBindingDivisor (glad_gl_current->glad_glVertexBindingDivisor)
+#define glad_glDebugMessageControl (glad_gl_current->glad_glDebugMessageControl)
+#define glad_glDebugMessageInsert (glad_gl_current->glad_glDebugMessageInsert)
+#define glad_glDebugMessageCallback (glad_gl_current->glad_glDebugMessageCallback)
+#define glad_glGetDebugMessageLog (glad_gl_current->glad_glGetDebugMessageLog)
+#define glad_glPushDebugGroup (glad_gl_current->glad_glPushDebugGroup)
+#define glad_glPopDebugGroup (glad_gl_current->glad_glPopDebugGroup)
+#define glad_glObjectLabel (glad_gl_current->glad_glObjectLabel)
+#define glad_glGetObjectLabel (glad_gl_current->glad_glGetObjectLabel)
+#define glad_glObjectPtrLabel (glad_gl_current->glad_glObjectPtrLabel)
+#define glad_glGetObjectPtrLabel (glad_gl_current->glad_glGetObjectPtrLabel)
+#define glad_glBufferStorage (glad_gl_current->glad_glBufferStorage)
+#define glad_glClearTexImage (glad_gl_current->glad_glClearTexImage)
+#define glad_glClearTexSubImage (glad_gl_current->glad_glClearTexSubImage)
+#define glad_glBindBuffersBase (glad_gl_current->glad_glBindBuffersBase)
+#define glad_glBindBuffersRange (glad_gl_current->glad_glBindBuffersRange)
+#define glad_glBindTextures (glad_gl_current->glad_glBindTextures)
+#define glad_glBindSamplers (glad_gl_current->glad_glBindSamplers)
+#define glad_glBindImageTextures (glad_gl_current->glad_glBindImageTextures)
+#define glad_glBindVertexBuffers (glad_gl_current->glad_glBindVertexBuffers)
+#define glad_glClipControl (glad_gl_current->glad_glClipControl)
+#define glad_glCreateTransformFeedbacks (glad_gl_current->glad_glCreateTransformFeedbacks)
+#define glad_glTransformFeedbackBufferBase (glad_gl_current->glad_glTransformFeedbackBufferBase)
+#define glad_glTransformFeedbackBufferRange (glad_gl_current->glad_glTransformFeedbackBufferRange)
+#define glad_glGetTransformFeedbackiv (glad_gl_current->glad_glGetTransformFeedbackiv)
+#define glad_glGetTransformFeedbacki_v (glad_gl_current->glad_glGetTransformFeedbacki_v)
+#define glad_glGetTransformFeedbacki64_v (glad_gl_current->glad_glGetTransformFeedbacki64_v)
+#define glad_glCreateBuffers (glad_gl_current->glad_glCreateBuffers)
+#define glad_glNamedBufferStorage (glad_gl_current->glad_glNamedBufferStorage)
+#define glad_glNamedBufferData (glad_gl_current->glad_glNamedBufferData)
+#define glad_glNamedBufferSubData (glad_gl_current->glad_glNamedBufferSubData)
+#define glad_glCopyNamedBufferSubData (glad_gl_current->glad_glCopyNamedBufferSubData)
+#define glad_glClearNamedBufferData (glad_gl_current->glad_glClearNamedBufferData)
+#define glad_glClearNamedBufferSubData (glad_gl_current->glad_glClearNamedBufferSubData)
+#define glad_glMapNamedBuffer (glad_gl_current->glad_glMapNamedBuffer)
+#define glad_glMapNamedBufferRange (glad_gl_current->glad_glMapNamedBufferRange)
+#define glad_glUnmapNamedBuffer (glad_gl_current->glad_glUnmapNamedBuffer)
+#define glad_glFlushMappedNamedBufferRange (glad_gl_current->glad_glFlushMappedNamedBufferRange)
+#define glad_glGetNamedBufferParameteriv (glad_gl_current->glad_glGetNamedBufferParameteriv)
+#define glad_glGetNamedBufferParameteri64v (glad_gl_current->glad_glGetNamedBufferParameteri64v)
+#define glad_glGetNamedBufferPointerv (glad_gl_current->glad_glGetNamedBufferPointerv)
+#define glad_glGetNamedBufferSubData (glad_gl_current->glad_glGetNamedBufferSubData)
+#define glad_glCreateFramebuffers (glad_gl_current->glad_glCreateFramebuffers)
+#define glad_glNamedFramebufferRenderbuffer (glad_gl_current->glad_glNamedFramebufferRenderbuffer)
+#define glad_glNamedFramebufferParameteri (glad_gl_current->glad_glNamedFramebufferParameteri)
+#define glad_glNamedFramebufferTexture (glad_gl_current->glad_glNamedFramebufferTexture)
+#define glad_glNamedFramebufferTextureLayer (glad_gl_current->glad_glNamedFramebufferTextureLayer)
+#define glad_glNamedFramebufferDrawBuffer (glad_gl_current->glad_glNamedFramebufferDrawBuffer)
+#define glad_glNamedFramebufferDrawBuffers (glad_gl_current->glad_glNamedFramebufferDrawBuffers)
+#define glad_glNamedFramebufferReadBuffer (glad_gl_current->glad_glNamedFramebufferReadBuffer)
+#define glad_glInvalidateNamedFramebufferData (glad_gl_current->glad_glInvalidateNamedFramebufferData)
+#define glad_glInvalidateNamedFramebufferSubData (glad_gl_current->glad_glInvalidateNamedFramebufferSubData)
+#define glad_glClearNamedFramebufferiv (glad_gl_current->glad_glClearNamedFramebufferiv)
+#define glad_glClearNamedFramebufferuiv (glad_gl_current->glad_glClearNamedFramebufferuiv)
+#define glad_glClearNamedFramebufferfv (glad_gl_current->glad_glClearNamedFramebufferfv)
+#define glad_glClearNamedFramebufferfi (glad_gl_current->glad_glClearNamedFramebufferfi)
+#define glad_glBlitNamedFramebuffer (glad_gl_current->glad_glBlitNamedFramebuffer)
+#define glad_glCheckNamedFramebufferStatus (glad_gl_current->glad_glCheckNamedFramebufferStatus)
+#define glad_glGetNamedFramebufferParameteriv (glad_gl_current->glad_glGetNamedFramebufferParameteriv)
+#define glad_glGetNamedFramebufferAttachmentParameteriv (glad_gl_current->glad_glGetNamedFramebufferAttachmentParameteriv)
+#define glad_glCreateRenderbuffers (glad_gl_current->glad_glCreateRenderbuffers)
+#define glad_glNamedRenderbufferStorage (glad_gl_current->glad_glNamedRenderbufferStorage)
+#define glad_glNamedRenderbufferStorageMultisample (glad_gl_current->glad_glNamedRenderbufferStorageMultisample)
+#define glad_glGetNamedRenderbufferParameteriv (glad_gl_current->glad_glGetNamedRenderbufferParameteriv)
+#define glad_glCreateTextures (glad_gl_current->glad_glCreateTextures)
+#define glad_glTextureBuffer (glad_gl_current->glad_glTextureBuffer)
+#define glad_glTextureBufferRange (glad_gl_current->glad_glTextureBufferRange)
+#define glad_glTextureStorage1D (glad_gl_current->glad_glTextureStorage1D)
+#define glad_glTextureStorage2D (glad_gl_current->glad_glTextureStorage2D)
+#define glad_glTextureStorage3D (glad_gl_current->glad_glTextureStorage3D)
+#define glad_glTextureStorage2DMultisample (glad_gl_current->glad_glTextureStorage2DMultisample)
+#define glad_glTextureStorage3DMultisample (glad_gl_current->glad_glTextureStorage3DMultisample)
+#define glad_glTextureSubImage1D (glad_gl_current->glad_glTextureSubImage1D)
+#define glad_glTextureSubImage2D (glad_gl_current->glad_glTextureSubImage2D)
+#define glad_glTextureSubImage3D (glad_gl_current->glad_glTextureSubImage3D)
+#define glad_glCompressedTextureSubImage1D (glad_gl_current->glad_glCompressedTextureSubImage1D)
+#define glad_glCompressedTextureSubImage2D (glad_gl_current->glad_glCompressedTextureSubImage2D)
+#define glad_glCompressedTextureSubImage3D (glad_gl_current->glad_glCompressedTextureSubImage3D)
+#define glad_glCopyTextureSubImage1D (glad_gl_current->glad_glCopyTextureSubImage1D)
+#define glad_glCopyTextureSubImage2D (glad_gl_current->glad_glCopyTextureSubImage2D)
+#define glad_glCopyTextureSubImage3D (glad_gl_current->glad_glCopyTextureSubImage3D)
+#define glad_glTextureParameterf (glad_gl_current->glad_glTextureParameterf)
+#define glad_glTextureParameterfv (glad_gl_current->glad_glTextureParameterfv)
+#define glad_glTextureParameteri (glad_gl_current->glad_glTextureParameteri)
+#define glad_glTextureParameterIiv (glad_gl_current->glad_glTextureParameterIiv)
+#define glad_glTextureParameterIuiv (glad_gl_current->glad_glTextureParameterIuiv)
+#define glad_glTextureParameteriv (glad_gl_current->glad_glTextureParameteriv)
+#define glad_glGenerateTextureMipmap (glad_gl_current->glad_glGenerateTextureMipmap)
+#define glad_glBindTextureUnit (glad_gl_current->glad_glBindTextureUnit)
+#define glad_glGetTextureImage (glad_gl_current->glad_glGetTextureImage)
+#define glad_glGetCompressedTextureImage (glad_gl_current->glad_glGetCompressedTextureImage)
+#define glad_glGetTextureLevelParameterfv (glad_gl_current->glad_glGetTextureLevelParameterfv)
+#define glad_glGetTextureLevelParameteriv (glad_gl_current->glad_glGetTextureLevelParameteriv)
+#define glad_glGetTextureParameterfv (glad_gl_current->glad_glGetTextureParameterfv)
+#define glad_glGetTextureParameterIiv (glad_gl_current->glad_glGetTextureParameterIiv)
+#define glad_glGetTextureParameterIuiv (glad_gl_current->glad_glGetTextureParameterIuiv)
+#define glad_glGetTextureParameteriv (glad_gl_current->glad_glGetTextureParameteriv)
+#define glad_glCreateVertexArrays (glad_gl_current->glad_glCreateVertexArrays)
+#define glad_glDisableVertexArrayAttrib (glad_gl_current->glad_glDisableVertexArrayAttrib)
+#define glad_glEnableVertexArrayAttrib (glad_gl_current->glad_glEnableVertexArrayAttrib)
+#define glad_glVertexArrayElementBuffer (glad_gl_current->glad_glVertexArrayElementBuffer)
+#define glad_glVertexArrayVertexBuffer (glad_gl_current->glad_glVertexArrayVertexBuffer)
+#define glad_glVertexArrayVertexBuffers (glad_gl_current->glad_glVertexArrayVertexBuffers)
+#define glad_glVertexArrayAttribBinding (glad_gl_current->glad_glVertexArrayAttribBinding)
+#define glad_glVertexArrayAttribFormat (glad_gl_current->glad_glVertexArrayAttribFormat)
+#define glad_glVertexArrayAttribIFormat (glad_gl_current->glad_glVertexArrayAttribIFormat)
+#define glad_glVertexArrayAttribLFormat (glad_gl_current->glad_glVertexArrayAttribLFormat)
+#define glad_glVertexArrayBindingDivisor (glad_gl_current->glad_glVertexArrayBindingDivisor)
+#define glad_glGetVertexArrayiv (glad_gl_current->glad_glGetVertexArrayiv)
+#define glad_glGetVertexArrayIndexediv (glad_gl_current->glad_glGetVertexArrayIndexediv)
+#define glad_glGetVertexArrayIndexed64iv (glad_gl_current->glad_glGetVertexArrayIndexed64iv)
+#define glad_glCreateSamplers (glad_gl_current->glad_glCreateSamplers)
+#define glad_glCreateProgramPipelines (glad_gl_current->glad_glCreateProgramPipelines)
+#define glad_glCreateQueries (glad_gl_current->glad_glCreateQueries)
+#define glad_glGetQueryBufferObjecti64v (glad_gl_current->glad_glGetQueryBufferObjecti64v)
+#define glad_glGetQueryBufferObjectiv (glad_gl_current->glad_glGetQueryBufferObjectiv)
+#define glad_glGetQueryBufferObjectui64v (glad_gl_current->glad_glGetQueryBufferObjectui64v)
+#define glad_glGetQueryBufferObjectuiv (glad_gl_current->glad_glGetQueryBufferObjectuiv)
+#define glad_glMemoryBarrierByRegion (glad_gl_current->glad_glMemoryBarrierByRegion)
+#define glad_glGetTextureSubImage (glad_gl_current->glad_glGetTextureSubImage)
+#define glad_glGetCompressedTextureSubImage (glad_gl_current->glad_glGetCompressedTextureSubImage)
+#define glad_glGetGraphicsResetStatus (glad_gl_current->glad_glGetGraphicsResetStatus)
+#define glad_glGetnCompressedTexImage (glad_gl_current->glad_glGetnCompressedTexImage)
+#define glad_glGetnTexImage (glad_gl_current->glad_glGetnTexImage)
+#define glad_glGetnUniformdv (glad_gl_current->glad_glGetnUniformdv)
+#define glad_glGetnUniformfv (glad_gl_current->glad_glGetnUniformfv)
+#define glad_glGetnUniformiv (glad_gl_current->glad_glGetnUniformiv)
+#define glad_glGetnUniformuiv (glad_gl_current->glad_glGetnUniformuiv)
+#define glad_glReadnPixels (glad_gl_current->glad_glReadnPixels)
+#define glad_glGetnMapdv (glad_gl_current->glad_glGetnMapdv)
+#define glad_glGetnMapfv (glad_gl_current->glad_glGetnMapfv)
+#define glad_glGetnMapiv (glad_gl_current->glad_glGetnMapiv)
+#define glad_glGetnPixelMapfv (glad_gl_current->glad_glGetnPixelMapfv)
+#define glad_glGetnPixelMapuiv (glad_gl_current->glad_glGetnPixelMapuiv)
+#define glad_glGetnPixelMapusv (glad_gl_current->glad_glGetnPixelMapusv)
+#define glad_glGetnPolygonStipple (glad_gl_current->glad_glGetnPolygonStipple)
+#define glad_glGetnColorTable (glad_gl_current->glad_glGetnColorTable)
+#define glad_glGetnConvolutionFilter (glad_gl_current->glad_glGetnConvolutionFilter)
+#define glad_glGetnSeparableFilter (glad_gl_current->glad_glGetnSeparableFilter)
+#define glad_glGetnHistogram (glad_gl_current->glad_glGetnHistogram)
+#define glad_glGetnMinmax (glad_gl_current->glad_glGetnMinmax)
+#define glad_glTextureBarrier (glad_gl_current->glad_glTextureBarrier)
+#define glad_glTbufferMask3DFX (glad_gl_current->glad_glTbufferMask3DFX)
+#define glad_glDebugMessageEnableAMD (glad_gl_current->glad_glDebugMessageEnableAMD)
+#define glad_glDebugMessageInsertAMD (glad_gl_current->glad_glDebugMessageInsertAMD)
+#define glad_glDebugMessageCallbackAMD (glad_gl_current->glad_glDebugMessageCallbackAMD)
+#define glad_glGetDebugMessageLogAMD (glad_gl_current->glad_glGetDebugMessageLogAMD)
+#define glad_glBlendFuncIndexedAMD (glad_gl_current->glad_glBlendFuncIndexedAMD)
+#define glad_glBlendFuncSeparateIndexedAMD (glad_gl_current->glad_glBlendFuncSeparateIndexedAMD)
+#define glad_glBlendEquationIndexedAMD (glad_gl_current->glad_glBlendEquationIndexedAMD)
+#define glad_glBlendEquationSeparateIndexedAMD (glad_gl_current->glad_glBlendEquationSeparateIndexedAMD)
+#define glad_glRenderbufferStorageMultisampleAdvancedAMD (glad_gl_current->glad_glRenderbufferStorageMultisampleAdvancedAMD)
+#define glad_glNamedRenderbufferStorageMultisampleAdvancedAMD (glad_gl_current->glad_glNamedRenderbufferStorageMultisampleAdvancedAMD)
+#define glad_glFramebufferSamplePositionsfvAMD (glad_gl_current->glad_glFramebufferSamplePositionsfvAMD)
+#define glad_glNamedFramebufferSamplePositionsfvAMD (glad_gl_current->glad_glNamedFramebufferSamplePositionsfvAMD)
+#define glad_glGetFramebufferParameterfvAMD (glad_gl_current->glad_glGetFramebufferParameterfvAMD)
+#define glad_glGetNamedFramebufferParameterfvAMD (glad_gl_current->glad_glGetNamedFramebufferParameterfvAMD)
+#define glad_glUniform1i64NV (glad_gl_current->glad_glUniform1i64NV)
+#define glad_glUniform2i64NV (glad_gl_current->glad_glUniform2i64NV)
+#define glad_glUniform3i64NV (glad_gl_current->glad_glUniform3i64NV)
+#define glad_glUniform4i64NV (glad_gl_current->glad_glUniform4i64NV)
+#define glad_glUniform1i64vNV (glad_gl_current->glad_glUniform1i64vNV)
+#define glad_glUniform2i64vNV (glad_gl_current->glad_glUniform2i64vNV)
+#define glad_glUniform3i64vNV (glad_gl_current->glad_glUniform3i64vNV)
+#define glad_glUniform4i64vNV (glad_gl_current->glad_glUniform4i64vNV)
+#define glad_glUniform1ui64NV (glad_gl_current->glad_glUniform1ui64NV)
+#define glad_glUniform2ui64NV (glad_gl_current->glad_glUniform2ui64NV)
+#define glad_glUniform3ui64NV (glad_gl_current->glad_glUniform3ui64NV)
+#define glad_glUniform4ui64NV (glad_gl_current->glad_glUniform4ui64NV)
+#define glad_glUniform1ui64vNV (glad_gl_current->glad_glUniform1ui64vNV)
+#define glad_glUniform2ui64vNV (glad_gl_current->glad_glUniform2ui64vNV)
+#define glad_glUniform3ui64vNV (glad_gl_current->glad_glUniform3ui64vNV)
+#define glad_glUniform4ui64vNV (glad_gl_current->glad_glUniform4ui64vNV)
+#define glad_glGetUniformi64vNV (glad_gl_current->glad_glGetUniformi64vNV)
+#define glad_glGetUniformui64vNV (glad_gl_current->glad_glGetUniformui64vNV)
+#define glad_glProgramUniform1i64NV (glad_gl_current->glad_glProgramUniform1i64NV)
+#define glad_glProgramUniform2i64NV (glad_gl_current->glad_glProgramUniform2i64NV)
+#define glad_glProgramUniform3i64NV (glad_gl_current->glad_glProgramUniform3i64NV)
+#define glad_glProgramUniform4i64NV (glad_gl_current->glad_glProgramUniform4i64NV)
+#define glad_glProgramUniform1i64vNV (glad_gl_current->glad_glProgramUniform1i64vNV)
+#define glad_glProgramUniform2i64vNV (glad_gl_current->glad_glProgramUniform2i64vNV)
+#define glad_glProgramUniform3i64vNV (glad_gl_current->glad_glProgramUniform3i64vNV)
+#define glad_glProgramUniform4i64vNV (glad_gl_current->glad_glProgramUniform4i64vNV)
+#define glad_glProgramUniform1ui64NV (glad_gl_current->glad_glProgramUniform1ui64NV)
+#define glad_glProgramUniform2ui64NV (glad_gl_current->glad_glProgramUniform2ui64NV)
+#define glad_glProgramUniform3ui64NV (glad_gl_current->glad_glProgramUniform3ui64NV)
+#define glad_glProgramUniform4ui64NV (glad_gl_current->glad_glProgramUniform4ui64NV)
+#define glad_glProgramUniform1ui64vNV (glad_gl_current->glad_glProgramUniform1ui64vNV)
+#define glad_glProgramUniform2ui64vNV (glad_gl_current->glad_glProgramUniform2ui64vNV)
+#define glad_glProgramUniform3ui64vNV (glad_gl_current->glad_glProgramUniform3ui64vNV)
+#define glad_glProgramUniform4ui64vNV (glad_gl_current->glad_glProgramUniform4ui64vNV)
+#define glad_glVertexAttribParameteriAMD (glad_gl_current->glad_glVertexAttribParameteriAMD)
+#define glad_glMultiDrawArraysIndirectAMD (glad_gl_current->glad_glMultiDrawArraysIndirectAMD)
+#define glad_glMultiDrawElementsIndirectAMD (glad_gl_current->glad_glMultiDrawElementsIndirectAMD)
+#define glad_glGenNamesAMD (glad_gl_current->glad_glGenNamesAMD)
+#define glad_glDeleteNamesAMD (glad_gl_current->glad_glDeleteNamesAMD)
+#define glad_glIsNameAMD (glad_gl_current->glad_glIsNameAMD)
+#define glad_glQueryObjectParameteruiAMD (glad_gl_current->glad_glQueryObjectParameteruiAMD)
+#define glad_glGetPerfMonitorGroupsAMD (glad_gl_current->glad_glGetPerfMonitorGroupsAMD)
+#define glad_glGetPerfMonitorCountersAMD (glad_gl_current->glad_glGetPerfMonitorCountersAMD)
+#define glad_glGetPerfMonitorGroupStringAMD (glad_gl_current->glad_glGetPerfMonitorGroupStringAMD)
+#define glad_glGetPerfMonitorCounterStringAMD (glad_gl_current->glad_glGetPerfMonitorCounterStringAMD)
+#define glad_glGetPerfMonitorCounterInfoAMD (glad_gl_current->glad_glGetPerfMonitorCounterInfoAMD)
+#define glad_glGenPerfMonitorsAMD (glad_gl_current->glad_glGenPerfMonitorsAMD)
+#define glad_glDeletePerfMonitorsAMD (glad_gl_current->glad_glDeletePerfMonitorsAMD)
+#define glad_glSelectPerfMonitorCountersAMD (glad_gl_current->glad_glSelectPerfMonitorCountersAMD)
+#define glad_glBeginPerfMonitorAMD (glad_gl_current->glad_glBeginPerfMonitorAMD)
+#define glad_glEndPerfMonitorAMD (glad_gl_current->glad_glEndPerfMonitorAMD)
+#define glad_glGetPerfMonitorCounterDataAMD (glad_gl_current->glad_glGetPerfMonitorCounterDataAMD)
+#define glad_glSetMultisamplefvAMD (glad_gl_current->glad_glSetMultisamplefvAMD)
+#define glad_glTexStorageSparseAMD (glad_gl_current->glad_glTexStorageSparseAMD)
+#define glad_glTextureStorageSparseAMD (glad_gl_current->glad_glTextureStorageSparseAMD)
+#define glad_glStencilOpValueAMD (glad_gl_current->glad_glStencilOpValueAMD)
+#define glad_glTessellationFactorAMD (glad_gl_current->glad_glTessellationFactorAMD)
+#define glad_glTessellationModeAMD (glad_gl_current->glad_glTessellationModeAMD)
+#define glad_glElementPointerAPPLE (glad_gl_current->glad_glElementPointerAPPLE)
+#define glad_glDrawElementArrayAPPLE (glad_gl_current->glad_glDrawElementArrayAPPLE)
+#define glad_glDrawRangeElementArrayAPPLE (glad_gl_current->glad_glDrawRangeElementArrayAPPLE)
+#define glad_glMultiDrawElementArrayAPPLE (glad_gl_current->glad_glMultiDrawElementArrayAPPLE)
+#define glad_glMultiDrawRangeElementArrayAPPLE (glad_gl_current->glad_glMultiDrawRangeElementArrayAPPLE)
+#define glad_glGenFencesAPPLE (glad_gl_current->glad_glGenFencesAPPLE)
+#define glad_glDeleteFencesAPPLE (glad_gl_current->glad_glDeleteFencesAPPLE)
+#define glad_glSetFenceAPPLE (glad_gl_current->glad_glSetFenceAPPLE)
+#define glad_glIsFenceAPPLE (glad_gl_current->glad_glIsFenceAPPLE)
+#define glad_glTestFenceAPPLE (glad_gl_current->glad_glTestFenceAPPLE)
+#define glad_glFinishFenceAPPLE (glad_gl_current->glad_glFinishFenceAPPLE)
+#define glad_glTestObjectAPPLE (glad_gl_current->glad_glTestObjectAPPLE)
+#define glad_glFinishObjectAPPLE (glad_gl_current->glad_glFinishObjectAPPLE)
+#define glad_glBufferParameteriAPPLE (glad_gl_current->glad_glBufferParameteriAPPLE)
+#define glad_glFlushMappedBufferRangeAPPLE (glad_gl_current->glad_glFlushMappedBufferRangeAPPLE)
+#define glad_glObjectPurgeableAPPLE (glad_gl_current->glad_glObjectPurgeableAPPLE)
+#define glad_glObjectUnpurgeableAPPLE (glad_gl_current->glad_glObjectUnpurgeableAPPLE)
+#define glad_glGetObjectParameterivAPPLE (glad_gl_current->glad_glGetObjectParameterivAPPLE)
+#define glad_glTextureRangeAPPLE (glad_gl_current->glad_glTextureRangeAPPLE)
+#define glad_glGetTexParameterPointervAPPLE (glad_gl_current->glad_glGetTexParameterPointervAPPLE)
+#define glad_glBindVertexArrayAPPLE (glad_gl_current->glad_glBindVertexArrayAPPLE)
+#define glad_glDeleteVertexArraysAPPLE (glad_gl_current->glad_glDeleteVertexArraysAPPLE)
+#define glad_glGenVertexArraysAPPLE (glad_gl_current->glad_glGenVertexArraysAPPLE)
+#define glad_glIsVertexArrayAPPLE (glad_gl_current->glad_glIsVertexArrayAPPLE)
+#define glad_glVertexArrayRangeAPPLE (glad_gl_current->glad_glVertexArrayRangeAPPLE)
+#define glad_glFlushVertexArrayRangeAPPLE (glad_gl_current->glad_glFlushVertexArrayRangeAPPLE)
+#define glad_glVertexArrayParameteriAPPLE (glad_gl_current->glad_glVertexArrayParameteriAPPLE)
+#define glad_glEnableVertexAttribAPPLE (glad_gl_current->glad_glEnableVertexAttribAPPLE)
+#define glad_glDisableVertexAttribAPPLE (glad_gl_current->glad_glDisableVertexAttribAPPLE)
+#define glad_glIsVertexAttribEnabledAPPLE (glad_gl_current->glad_glIsVertexAttribEnabledAPPLE)
+#define glad_glMapVertexAttrib1dAPPLE (glad_gl_current->glad_glMapVertexAttrib1dAPPLE)
+#define glad_glMapVertexAttrib1fAPPLE (glad_gl_current->glad_glMapVertexAttrib1fAPPLE)
+#define glad_glMapVertexAttrib2dAPPLE (glad_gl_current->glad_glMapVertexAttrib2dAPPLE)
+#define glad_glMapVertexAttrib2fAPPLE (glad_gl_current->glad_glMapVertexAttrib2fAPPLE)
+#define glad_glPrimitiveBoundingBoxARB (glad_gl_current->glad_glPrimitiveBoundingBoxARB)
+#define glad_glGetTextureHandleARB (glad_gl_current->glad_glGetTextureHandleARB)
+#define glad_glGetTextureSamplerHandleARB (glad_gl_current->glad_glGetTextureSamplerHandleARB)
+#define glad_glMakeTextureHandleResidentARB (glad_gl_current->glad_glMakeTextureHandleResidentARB)
+#define glad_glMakeTextureHandleNonResidentARB (glad_gl_current->glad_glMakeTextureHandleNonResidentARB)
+#define glad_glGetImageHandleARB (glad_gl_current->glad_glGetImageHandleARB)
+#define glad_glMakeImageHandleResidentARB (glad_gl_current->glad_glMakeImageHandleResidentARB)
+#define glad_glMakeImageHandleNonResidentARB (glad_gl_current->glad_glMakeImageHandleNonResidentARB)
+#define glad_glUniformHandleui64ARB (glad_gl_current->glad_glUniformHandleui64ARB)
+#define glad_glUniformHandleui64vARB (glad_gl_current->glad_glUniformHandleui64vARB)
+#define glad_glProgramUniformHandleui64ARB (glad_gl_current->glad_glProgramUniformHandleui64ARB)
+#define glad_glProgramUniformHandleui64vARB (glad_gl_current->glad_glProgramUniformHandleui64vARB)
+#define glad_glIsTextureHandleResidentARB (glad_gl_current->glad_glIsTextureHandleResidentARB)
+#define glad_glIsImageHandleResidentARB (glad_gl_current->glad_glIsImageHandleResidentARB)
+#define glad_glVertexAttribL1ui64ARB (glad_gl_current->glad_glVertexAttribL1ui64ARB)
+#define glad_glVertexAttribL1ui64vARB (glad_gl_current->glad_glVertexAttribL1ui64vARB)
+#define glad_glGetVertexAttribLui64vARB (glad_gl_current->glad_glGetVertexAttribLui64vARB)
+#define glad_glCreateSyncFromCLeventARB (glad_gl_current->glad_glCreateSyncFromCLeventARB)
+#define glad_glClampColorARB (glad_gl_current->glad_glClampColorARB)
+#define glad_glDispatchComputeGroupSizeARB (glad_gl_current->glad_glDispatchComputeGroupSizeARB)
+#define glad_glDebugMessageControlARB (glad_gl_current->glad_glDebugMessageControlARB)
+#define glad_glDebugMessageInsertARB (glad_gl_current->glad_glDebugMessageInsertARB)
+#define glad_glDebugMessageCallbackARB (glad_gl_current->glad_glDebugMessageCallbackARB)
+#define glad_glGetDebugMessageLogARB (glad_gl_current->glad_glGetDebugMessageLogARB)
+#define glad_glDrawBuffersARB (glad_gl_current->glad_glDrawBuffersARB)
+#define glad_glBlendEquationiARB (glad_gl_current->glad_glBlendEquationiARB)
+#define glad_glBlendEquationSeparateiARB (glad_gl_current->glad_glBlendEquationSeparateiARB)
+#define glad_glBlendFunciARB (glad_gl_current->glad_glBlendFunciARB)
+#define glad_glBlendFuncSeparateiARB (glad_gl_current->glad_glBlendFuncSeparateiARB)
+#define glad_glDrawArraysInstancedARB (glad_gl_current->glad_glDrawArraysInstancedARB)
+#define glad_glDrawElementsInstancedARB (glad_gl_current->glad_glDrawElementsInstancedARB)
+#define glad_glProgramStringARB (glad_gl_current->glad_glProgramStringARB)
+#define glad_glBindProgramARB (glad_gl_current->glad_glBindProgramARB)
+#define glad_glDeleteProgramsARB (glad_gl_current->glad_glDeleteProgramsARB)
+#define glad_glGenProgramsARB (glad_gl_current->glad_glGenProgramsARB)
+#define glad_glProgramEnvParameter4dARB (glad_gl_current->glad_glProgramEnvParameter4dARB)
+#define glad_glProgramEnvParameter4dvARB (glad_gl_current->glad_glProgramEnvParameter4dvARB)
+#define glad_glProgramEnvParameter4fARB (glad_gl_current->glad_glProgramEnvParameter4fARB)
+#define glad_glProgramEnvParameter4fvARB (glad_gl_current->glad_glProgramEnvParameter4fvARB)
+#define glad_glProgramLocalParameter4dARB (glad_gl_current->glad_glProgramLocalParameter4dARB)
+#define glad_glProgramLocalParameter4dvARB (glad_gl_current->glad_glProgramLocalParameter4dvARB)
+#define glad_glProgramLocalParameter4fARB (glad_gl_current->glad_glProgramLocalParameter4fARB)
+#define glad_glProgramLocalParameter4fvARB (glad_gl_current->glad_glProgramLocalParameter4fvARB)
+#define glad_glGetProgramEnvParameterdvARB (glad_gl_current->glad_glGetProgramEnvParameterdvARB)
+#define glad_glGetProgramEnvParameterfvARB (glad_gl_current->glad_glGetProgramEnvParameterfvARB)
+#define glad_glGetProgramLocalParameterdvARB (glad_gl_current->glad_glGetProgramLocalParameterdvARB)
+#define glad_glGetProgramLocalParameterfvARB (glad_gl_current->glad_glGetProgramLocalParameterfvARB)
+#define glad_glGetProgramivARB (glad_gl_current->glad_glGetProgramivARB)
+#define glad_glGetProgramStringARB (glad_gl_current->glad_glGetProgramStringARB)
+#define glad_glIsProgramARB (glad_gl_current->glad_glIsProgramARB)
+#define glad_glProgramParameteriARB (glad_gl_current->glad_glProgramParameteriARB)
+#define glad_glFramebufferTextureARB (glad_gl_current->glad_glFramebufferTextureARB)
+#define glad_glFramebufferTextureLayerARB (glad_gl_current->glad_glFramebufferTextureLayerARB)
+#define glad_glFramebufferTextureFaceARB (glad_gl_current->glad_glFramebufferTextureFaceARB)
+#define glad_glSpecializeShaderARB (glad_gl_current->glad_glSpecializeShaderARB)
+#define glad_glUniform1i64ARB (glad_gl_current->glad_glUniform1i64ARB)
+#define glad_glUniform2i64ARB (glad_gl_current->glad_glUniform2i64ARB)
+#define glad_glUniform3i64ARB (glad_gl_current->glad_glUniform3i64ARB)
+#define glad_glUniform4i64ARB (glad_gl_current->glad_glUniform4i64ARB)
+#define glad_glUniform1i64vARB (glad_gl_current->glad_glUniform1i64vARB)
+#define glad_glUniform2i64vARB (glad_gl_current->glad_glUniform2i64vARB)
+#define glad_glUniform3i64vARB (glad_gl_current->glad_glUniform3i64vARB)
+#define glad_glUniform4i64vARB (glad_gl_current->glad_glUniform4i64vARB)
+#define glad_glUniform1ui64ARB (glad_gl_current->glad_glUniform1ui64ARB)
+#define glad_glUniform2ui64ARB (glad_gl_current->glad_glUniform2ui64ARB)
+#define glad_glUniform3ui64ARB (glad_gl_current->glad_glUniform3ui64ARB)
+#define glad_glUniform4ui64ARB (glad_gl_current->glad_glUniform4ui64ARB)
+#define glad_glUniform1ui64vARB (glad_gl_current->glad_glUniform1ui64vARB)
+#define glad_glUniform2ui64vARB (glad_gl_current->glad_glUniform2ui64vARB)
+#define glad_glUniform3ui64vARB (glad_gl_current->glad_glUniform3ui64vARB)
+#define glad_glUniform4ui64vARB (glad_gl_current->glad_glUniform4ui64vARB)
+#define glad_glGetUniformi64vARB (glad_gl_current->glad_glGetUniformi64vARB)
+#define glad_glGetUniformui64vARB (glad_gl_current->glad_glGetUniformui64vARB)
+#define glad_glGetnUniformi64vARB (glad_gl_current->glad_glGetnUniformi64vARB)
+#define glad_glGetnUniformui64vARB (glad_gl_current->glad_glGetnUniformui64vARB)
+#define glad_glProgramUniform1i64ARB (glad_gl_current->glad_glProgramUniform1i64ARB)
+#define glad_glProgramUniform2i64ARB (glad_gl_current->glad_glProgramUniform2i64ARB)
+#define glad_glProgramUniform3i64ARB (glad_gl_current->glad_glProgramUniform3i64ARB)
+#define glad_glProgramUniform4i64ARB (glad_gl_current->glad_glProgramUniform4i64ARB)
+#define glad_glProgramUniform1i64vARB (glad_gl_current->glad_glProgramUniform1i64vARB)
+#define glad_glProgramUniform2i64vARB (glad_gl_current->glad_glProgramUniform2i64vARB)
+#define glad_glProgramUniform3i64vARB (glad_gl_current->glad_glProgramUniform3i64vARB)
+#define glad_glProgramUniform4i64vARB (glad_gl_current->glad_glProgramUniform4i64vARB)
+#define glad_glProgramUniform1ui64ARB (glad_gl_current->glad_glProgramUniform1ui64ARB)
+#define glad_glProgramUniform2ui64ARB (glad_gl_current->glad_glProgramUniform2ui64ARB)
+#define glad_glProgramUniform3ui64ARB (glad_gl_current->glad_glProgramUniform3ui64ARB)
+#define glad_glProgramUniform4ui64ARB (glad_gl_current->glad_glProgramUniform4ui64ARB)
+#define glad_glProgramUniform1ui64vARB (glad_gl_current->glad_glProgramUniform1ui64vARB)
+#define glad_glProgramUniform2ui64vARB (glad_gl_current->glad_glProgramUniform2ui64vARB)
+#define glad_glProgramUniform3ui64vARB (glad_gl_current->glad_glProgramUniform3ui64vARB)
+#define glad_glProgramUniform4ui64vARB (glad_gl_current->glad_glProgramUniform4ui64vARB)
+#define glad_glColorTable (glad_gl_current->glad_glColorTable)
+#define glad_glColorTableParameterfv (glad_gl_current->glad_glColorTableParameterfv)
+#define glad_glColorTableParameteriv (glad_gl_current->glad_glColorTableParameteriv)
+#define glad_glCopyColorTable (glad_gl_current->glad_glCopyColorTable)
+#define glad_glGetColorTable (glad_gl_current->glad_glGetColorTable)
+#define glad_glGetColorTableParameterfv (glad_gl_current->glad_glGetColorTableParameterfv)
+#define glad_glGetColorTableParameteriv (glad_gl_current->glad_glGetColorTableParameteriv)
+#define glad_glColorSubTable (glad_gl_current->glad_glColorSubTable)
+#define glad_glCopyColorSubTable (glad_gl_current->glad_glCopyColorSubTable)
+#define glad_glConvolutionFilter1D (glad_gl_current->glad_glConvolutionFilter1D)
+#define glad_glConvolutionFilter2D (glad_gl_current->glad_glConvolutionFilter2D)
+#define glad_glConvolutionParameterf (glad_gl_current->glad_glConvolutionParameterf)
+#define glad_glConvolutionParameterfv (glad_gl_current->glad_glConvolutionParameterfv)
+#define glad_glConvolutionParameteri (glad_gl_current->glad_glConvolutionParameteri)
+#define glad_glConvolutionParameteriv (glad_gl_current->glad_glConvolutionParameteriv)
+#define glad_glCopyConvolutionFilter1D (glad_gl_current->glad_glCopyConvolutionFilter1D)
+#define glad_glCopyConvolutionFilter2D (glad_gl_current->glad_glCopyConvolutionFilter2D)
+#define glad_glGetConvolutionFilter (glad_gl_current->glad_glGetConvolutionFilter)
+#define glad_glGetConvolutionParameterfv (glad_gl_current->glad_glGetConvolutionParameterfv)
+#define glad_glGetConvolutionParameteriv (glad_gl_current->glad_glGetConvolutionParameteriv)
+#define glad_glGetSeparableFilter (glad_gl_current->glad_glGetSeparableFilter)
+#define glad_glSeparableFilter2D (glad_gl_current->glad_glSeparableFilter2D)
+#define glad_glGetHistogram (glad_gl_current->glad_glGetHistogram)
+#define glad_glGetHistogramParameterfv (glad_gl_current->glad_glGetHistogramParameterfv)
+#define glad_glGetHistogramParameteriv (glad_gl_current->glad_glGetHistogramParameteriv)
+#define glad_glGetMinmax (glad_gl_current->glad_glGetMinmax)
+#define glad_glGetMinmaxParameterfv (glad_gl_current->glad_glGetMinmaxParameterfv)
+#define glad_glGetMinmaxParameteriv (glad_gl_current->glad_glGetMinmaxParameteriv)
+#define glad_glHistogram (glad_gl_current->glad_glHistogram)
+#define glad_glMinmax (glad_gl_current->glad_glMinmax)
+#define glad_glResetHistogram (glad_gl_current->glad_glResetHistogram)
+#define glad_glResetMinmax (glad_gl_current->glad_glResetMinmax)
+#define glad_glMultiDrawArraysIndirectCountARB (glad_gl_current->glad_glMultiDrawArraysIndirectCountARB)
+#define glad_glMultiDrawElementsIndirectCountARB (glad_gl_current->glad_glMultiDrawElementsIndirectCountARB)
+#define glad_glVertexAttribDivisorARB (glad_gl_current->glad_glVertexAttribDivisorARB)
+#define glad_glCurrentPaletteMatrixARB (glad_gl_current->glad_glCurrentPaletteMatrixARB)
+#define glad_glMatrixIndexubvARB (glad_gl_current->glad_glMatrixIndexubvARB)
+#define glad_glMatrixIndexusvARB (glad_gl_current->glad_glMatrixIndexusvARB)
+#define glad_glMatrixIndexuivARB (glad_gl_current->glad_glMatrixIndexuivARB)
+#define glad_glMatrixIndexPointerARB (glad_gl_current->glad_glMatrixIndexPointerARB)
+#define glad_glSampleCoverageARB (glad_gl_current->glad_glSampleCoverageARB)
+#define glad_glActiveTextureARB (glad_gl_current->glad_glActiveTextureARB)
+#define glad_glClientActiveTextureARB (glad_gl_current->glad_glClientActiveTextureARB)
+#define glad_glMultiTexCoord1dARB (glad_gl_current->glad_glMultiTexCoord1dARB)
+#define glad_glMultiTexCoord1dvARB (glad_gl_current->glad_glMultiTexCoord1dvARB)
+#define glad_glMultiTexCoord1fARB (glad_gl_current->glad_glMultiTexCoord1fARB)
+#define glad_glMultiTexCoord1fvARB (glad_gl_current->glad_glMultiTexCoord1fvARB)
+#define glad_glMultiTexCoord1iARB (glad_gl_current->glad_glMultiTexCoord1iARB)
+#define glad_glMultiTexCoord1ivARB (glad_gl_current->glad_glMultiTexCoord1ivARB)
+#define glad_glMultiTexCoord1sARB (glad_gl_current->glad_glMultiTexCoord1sARB)
+#define glad_glMultiTexCoord1svARB (glad_gl_current->glad_glMultiTexCoord1svARB)
+#define glad_glMultiTexCoord2dARB (glad_gl_current->glad_glMultiTexCoord2dARB)
+#define glad_glMultiTexCoord2dvARB (glad_gl_current->glad_glMultiTexCoord2dvARB)
+#define glad_glMultiTexCoord2fARB (glad_gl_current->glad_glMultiTexCoord2fARB)
+#define glad_glMultiTexCoord2fvARB (glad_gl_current->glad_glMultiTexCoord2fvARB)
+#define glad_glMultiTexCoord2iARB (glad_gl_current->glad_glMultiTexCoord2iARB)
+#define glad_glMultiTexCoord2ivARB (glad_gl_current->glad_glMultiTexCoord2ivARB)
+#define glad_glMultiTexCoord2sARB (glad_gl_current->glad_glMultiTexCoord2sARB)
+#define glad_glMultiTexCoord2svARB (glad_gl_current->glad_glMultiTexCoord2svARB)
+#define glad_glMultiTexCoord3dARB (glad_gl_current->glad_glMultiTexCoord3dARB)
+#define glad_glMultiTexCoord3dvARB (glad_gl_current->glad_glMultiTexCoord3dvARB)
+#define glad_glMultiTexCoord3fARB (glad_gl_current->glad_glMultiTexCoord3fARB)
+#define glad_glMultiTexCoord3fvARB (glad_gl_current->glad_glMultiTexCoord3fvARB)
+#define glad_glMultiTexCoord3iARB (glad_gl_current->glad_glMultiTexCoord3iARB)
+#define glad_glMultiTexCoord3ivARB (glad_gl_current->glad_glMultiTexCoord3ivARB)
+#define glad_glMultiTexCoord3sARB (glad_gl_current->glad_glMultiTexCoord3sARB)
+#define glad_glMultiTexCoord3svARB (glad_gl_current->glad_glMultiTexCoord3svARB)
+#define glad_glMultiTexCoord4dARB (glad_gl_current->glad_glMultiTexCoord4dARB)
+#define glad_glMultiTexCoord4dvARB (glad_gl_current->glad_glMultiTexCoord4dvARB)
+#define glad_glMultiTexCoord4fARB (glad_gl_current->glad_glMultiTexCoord4fARB)
+#define glad_glMultiTexCoord4fvARB (glad_gl_current->glad_glMultiTexCoord4fvARB)
+#define glad_glMultiTexCoord4iARB (glad_gl_current->glad_glMultiTexCoord4iARB)
+#define glad_glMultiTexCoord4ivARB (glad_gl_current->glad_glMultiTexCoord4ivARB)
+#define glad_glMultiTexCoord4sARB (glad_gl_current->glad_glMultiTexCoord4sARB)
+#define glad_glMultiTexCoord4svARB (glad_gl_current->glad_glMultiTexCoord4svARB)
+#define glad_glGenQueriesARB (glad_gl_current->glad_glGenQueriesARB)
+#define glad_glDeleteQueriesARB (glad_gl_current->glad_glDeleteQueriesARB)
+#define glad_glIsQueryARB (glad_gl_current->glad_glIsQueryARB)
+#define glad_glBeginQueryARB (glad_gl_current->glad_glBeginQueryARB)
+#define glad_glEndQueryARB (glad_gl_current->glad_glEndQueryARB)
+#define glad_glGetQueryivARB (glad_gl_current->glad_glGetQueryivARB)
+#define glad_glGetQueryObjectivARB (glad_gl_current->glad_glGetQueryObjectivARB)
+#define glad_glGetQueryObjectuivARB (glad_gl_current->glad_glGetQueryObjectuivARB)
+#define glad_glMaxShaderCompilerThreadsARB (glad_gl_current->glad_glMaxShaderCompilerThreadsARB)
+#define glad_glPointParameterfARB (glad_gl_current->glad_glPointParameterfARB)
+#define glad_glPointParameterfvARB (glad_gl_current->glad_glPointParameterfvARB)
+#define glad_glPolygonOffsetClamp (glad_gl_current->glad_glPolygonOffsetClamp)
+#define glad_glGetGraphicsResetStatusARB (glad_gl_current->glad_glGetGraphicsResetStatusARB)
+#define glad_glGetnTexImageARB (glad_gl_current->glad_glGetnTexImageARB)
+#define glad_glReadnPixelsARB (glad_gl_current->glad_glReadnPixelsARB)
+#define glad_glGetnCompressedTexImageARB (glad_gl_current->glad_glGetnCompressedTexImageARB)
+#define glad_glGetnUniformfvARB (glad_gl_current->glad_glGetnUniformfvARB)
+#define glad_glGetnUniformivARB (glad_gl_current->glad_glGetnUniformivARB)
+#define glad_glGetnUniformuivARB (glad_gl_current->glad_glGetnUniformuivARB)
+#define glad_glGetnUniformdvARB (glad_gl_current->glad_glGetnUniformdvARB)
+#define glad_glGetnMapdvARB (glad_gl_current->glad_glGetnMapdvARB)
+#define glad_glGetnMapfvARB (glad_gl_current->glad_glGetnMapfvARB)
+#define glad_glGetnMapivARB (glad_gl_current->glad_glGetnMapivARB)
+#define glad_glGetnPixelMapfvARB (glad_gl_current->glad_glGetnPixelMapfvARB)
+#define glad_glGetnPixelMapuivARB (glad_gl_current->glad_glGetnPixelMapuivARB)
+#define glad_glGetnPixelMapusvARB (glad_gl_current->glad_glGetnPixelMapusvARB)
+#define glad_glGetnPolygonStippleARB (glad_gl_current->glad_glGetnPolygonStippleARB)
+#define glad_glGetnColorTableARB (glad_gl_current->glad_glGetnColorTableARB)
+#define glad_glGetnConvolutionFilterARB (glad_gl_current->glad_glGetnConvolutionFilterARB)
+#define glad_glGetnSeparableFilterARB (glad_gl_current->glad_glGetnSeparableFilterARB)
+#define glad_glGetnHistogramARB (glad_gl_current->glad_glGetnHistogramARB)
+#define glad_glGetnMinmaxARB (glad_gl_current->glad_glGetnMinmaxARB)
+#define glad_glFramebufferSampleLocationsfvARB (glad_gl_current->glad_glFramebufferSampleLocationsfvARB)
+#define glad_glNamedFramebufferSampleLocationsfvARB (glad_gl_current->glad_glNamedFramebufferSampleLocationsfvARB)
+#define glad_glEvaluateDepthValuesARB (glad_gl_current->glad_glEvaluateDepthValuesARB)
+#define glad_glMinSampleShadingARB (glad_gl_current->glad_glMinSampleShadingARB)
+#define glad_glDeleteObjectARB (glad_gl_current->glad_glDeleteObjectARB)
+#define glad_glGetHandleARB (glad_gl_current->glad_glGetHandleARB)
+#define glad_glDetachObjectARB (glad_gl_current->glad_glDetachObjectARB)
+#define glad_glCreateShaderObjectARB (glad_gl_current->glad_glCreateShaderObjectARB)
+#define glad_glShaderSourceARB (glad_gl_current->glad_glShaderSourceARB)
+#define glad_glCompileShaderARB (glad_gl_current->glad_glCompileShaderARB)
+#define glad_glCreateProgramObjectARB (glad_gl_current->glad_glCreateProgramObjectARB)
+#define glad_glAttachObjectARB (glad_gl_current->glad_glAttachObjectARB)
+#define glad_glLinkProgramARB (glad_gl_current->glad_glLinkProgramARB)
+#define glad_glUseProgramObjectARB (glad_gl_current->glad_glUseProgramObjectARB)
+#define glad_glValidateProgramARB (glad_gl_current->glad_glValidateProgramARB)
+#define glad_glUniform1fARB (glad_gl_current->glad_glUniform1fARB)
+#define glad_glUniform2fARB (glad_gl_current->glad_glUniform2fARB)
+#define glad_glUniform3fARB (glad_gl_current->glad_glUniform3fARB)
+#define glad_glUniform4fARB (glad_gl_current->glad_glUniform4fARB)
+#define glad_glUniform1iARB (glad_gl_current->glad_glUniform1iARB)
+#define glad_glUniform2iARB (glad_gl_current->glad_glUniform2iARB)
+#define glad_glUniform3iARB (glad_gl_current->glad_glUniform3iARB)
+#define glad_glUniform4iARB (glad_gl_current->glad_glUniform4iARB)
+#define glad_glUniform1fvARB (glad_gl_current->glad_glUniform1fvARB)
+#define glad_glUniform2fvARB (glad_gl_current->glad_glUniform2fvARB)
+#define glad_glUniform3fvARB (glad_gl_current->glad_glUniform3fvARB)
+#define glad_glUniform4fvARB (glad_gl_current->glad_glUniform4fvARB)
+#define glad_glUniform1ivARB (glad_gl_current->glad_glUniform1ivARB)
+#define glad_glUniform2ivARB (glad_gl_current->glad_glUniform2ivARB)
+#define glad_glUniform3ivARB (glad_gl_current->glad_glUniform3ivARB)
+#define glad_glUniform4ivARB (glad_gl_current->glad_glUniform4ivARB)
+#define glad_glUniformMatrix2fvARB (glad_gl_current->glad_glUniformMatrix2fvARB)
+#define glad_glUniformMatrix3fvARB (glad_gl_current->glad_glUniformMatrix3fvARB)
+#define glad_glUniformMatrix4fvARB (glad_gl_current->glad_glUniformMatrix4fvARB)
+#define glad_glGetObjectParameterfvARB (glad_gl_current->glad_glGetObjectParameterfvARB)
+#define glad_glGetObjectParameterivARB (glad_gl_current->glad_glGetObjectParameterivARB)
+#define glad_glGetInfoLogARB (glad_gl_current->glad_glGetInfoLogARB)
+#define glad_glGetAttachedObjectsARB (glad_gl_current->glad_glGetAttachedObjectsARB)
+#define glad_glGetUniformLocationARB (glad_gl_current->glad_glGetUniformLocationARB)
+#define glad_glGetActiveUniformARB (glad_gl_current->glad_glGetActiveUniformARB)
+#define glad_glGetUniformfvARB (glad_gl_current->glad_glGetUniformfvARB)
+#define glad_glGetUniformivARB (glad_gl_current->glad_glGetUniformivARB)
+#define glad_glGetShaderSourceARB (glad_gl_current->glad_glGetShaderSourceARB)
+#define glad_glNamedStringARB (glad_gl_current->glad_glNamedStringARB)
+#define glad_glDeleteNamedStringARB (glad_gl_current->glad_glDeleteNamedStringARB)
+#define glad_glCompileShaderIncludeARB (glad_gl_current->glad_glCompileShaderIncludeARB)
+#define glad_glIsNamedStringARB (glad_gl_current->glad_glIsNamedStringARB)
+#define glad_glGetNamedStringARB (glad_gl_current->glad_glGetNamedStringARB)
+#define glad_glGetNamedStringivARB (glad_gl_current->glad_glGetNamedStringivARB)
+#define glad_glBufferPageCommitmentARB (glad_gl_current->glad_glBufferPageCommitmentARB)
+#define glad_glNamedBufferPageCommitmentEXT (glad_gl_current->glad_glNamedBufferPageCommitmentEXT)
+#define glad_glNamedBufferPageCommitmentARB (glad_gl_current->glad_glNamedBufferPageCommitmentARB)
+#define glad_glTexPageCommitmentARB (glad_gl_current->glad_glTexPageCommitmentARB)
+#define glad_glTexBufferARB (glad_gl_current->glad_glTexBufferARB)
+#define glad_glCompressedTexImage3DARB (glad_gl_current->glad_glCompressedTexImage3DARB)
+#define glad_glCompressedTexImage2DARB (glad_gl_current->glad_glCompressedTexImage2DARB)
+#define glad_glCompressedTexImage1DARB (glad_gl_current->glad_glCompressedTexImage1DARB)
+#define glad_glCompressedTexSubImage3DARB (glad_gl_current->glad_glCompressedTexSubImage3DARB)
+#define glad_glCompressedTexSubImage2DARB (glad_gl_current->glad_glCompressedTexSubImage2DARB)
+#define glad_glCompressedTexSubImage1DARB (glad_gl_current->glad_glCompressedTexSubImage1DARB)
+#define glad_glGetCompressedTexImageARB (glad_gl_current->glad_glGetCompressedTexImageARB)
+#define glad_glLoadTransposeMatrixfARB (glad_gl_current->glad_glLoadTransposeMatrixfARB)
+#define glad_glLoadTransposeMatrixdARB (glad_gl_current->glad_glLoadTransposeMatrixdARB)
+#define glad_glMultTransposeMatrixfARB (glad_gl_current->glad_glMultTransposeMatrixfARB)
+#define glad_glMultTransposeMatrixdARB (glad_gl_current->glad_glMultTransposeMatrixdARB)
+#define glad_glWeightbvARB (glad_gl_current->glad_glWeightbvARB)
+#define glad_glWeightsvARB (glad_gl_current->glad_glWeightsvARB)
+#define glad_glWeightivARB (glad_gl_current->glad_glWeightivARB)
+#define glad_glWeightfvARB (glad_gl_current->glad_glWeightfvARB)
+#define glad_glWeightdvARB (glad_gl_current->glad_glWeightdvARB)
+#define glad_glWeightubvARB (glad_gl_current->glad_glWeightubvARB)
+#define glad_glWeightusvARB (glad_gl_current->glad_glWeightusvARB)
+#define glad_glWeightuivARB (glad_gl_current->glad_glWeightuivARB)
+#define glad_glWeightPointerARB (glad_gl_current->glad_glWeightPointerARB)
+#define glad_glVertexBlendARB (glad_gl_current->glad_glVertexBlendARB)
+#define glad_glBindBufferARB (glad_gl_current->glad_glBindBufferARB)
+#define glad_glDeleteBuffersARB (glad_gl_current->glad_glDeleteBuffersARB)
+#define glad_glGenBuffersARB (glad_gl_current->glad_glGenBuffersARB)
+#define glad_glIsBufferARB (glad_gl_current->glad_glIsBufferARB)
+#define glad_glBufferDataARB (glad_gl_current->glad_glBufferDataARB)
+#define glad_glBufferSubDataARB (glad_gl_current->glad_glBufferSubDataARB)
+#define glad_glGetBufferSubDataARB (glad_gl_current->glad_glGetBufferSubDataARB)
+#define glad_glMapBufferARB (glad_gl_current->glad_glMapBufferARB)
+#define glad_glUnmapBufferARB (glad_gl_current->glad_glUnmapBufferARB)
+#define glad_glGetBufferParameterivARB (glad_gl_current->glad_glGetBufferParameterivARB)
+#define glad_glGetBufferPointervARB (glad_gl_current->glad_glGetBufferPointervARB)
+#define glad_glVertexAttrib1dARB (glad_gl_current->glad_glVertexAttrib1dARB)
+#define glad_glVertexAttrib1dvARB (glad_gl_current->glad_glVertexAttrib1dvARB)
+#define glad_glVertexAttrib1fARB (glad_gl_current->glad_glVertexAttrib1fARB)
+#define glad_glVertexAttrib1fvARB (glad_gl_current->glad_glVertexAttrib1fvARB)
+#define glad_glVertexAttrib1sARB (glad_gl_current->glad_glVertexAttrib1sARB)
+#define glad_glVertexAttrib1svARB (glad_gl_current->glad_glVertexAttrib1svARB)
+#define glad_glVertexAttrib2dARB (glad_gl_current->glad_glVertexAttrib2dARB)
+#define glad_glVertexAttrib2dvARB (glad_gl_current->glad_glVertexAttrib2dvARB)
+#define glad_glVertexAttrib2fARB (glad_gl_current->glad_glVertexAttrib2fARB)
+#define glad_glVertexAttrib2fvARB (glad_gl_current->glad_glVertexAttrib2fvARB)
+#define glad_glVertexAttrib2sARB (glad_gl_current->glad_glVertexAttrib2sARB)
+#define glad_glVertexAttrib2svARB (glad_gl_current->glad_glVertexAttrib2svARB)
+#define glad_glVertexAttrib3dARB (glad_gl_current->glad_glVertexAttrib3dARB)
+#define glad_glVertexAttrib3dvARB (glad_gl_current->glad_glVertexAttrib3dvARB)
+#define glad_glVertexAttrib3fARB (glad_gl_current->glad_glVertexAttrib3fARB)
+#define glad_glVertexAttrib3fvARB (glad_gl_current->glad_glVertexAttrib3fvARB)
+#define glad_glVertexAttrib3sARB (glad_gl_current->glad_glVertexAttrib3sARB)
+#define glad_glVertexAttrib3svARB (glad_gl_current->glad_glVertexAttrib3svARB)
+#define glad_glVertexAttrib4NbvARB (glad_gl_current->glad_glVertexAttrib4NbvARB)
+#define glad_glVertexAttrib4NivARB (glad_gl_current->glad_glVertexAttrib4NivARB)
+#define glad_glVertexAttrib4NsvARB (glad_gl_current->glad_glVertexAttrib4NsvARB)
+#define glad_glVertexAttrib4NubARB (glad_gl_current->glad_glVertexAttrib4NubARB)
+#define glad_glVertexAttrib4NubvARB (glad_gl_current->glad_glVertexAttrib4NubvARB)
+#define glad_glVertexAttrib4NuivARB (glad_gl_current->glad_glVertexAttrib4NuivARB)
+#define glad_glVertexAttrib4NusvARB (glad_gl_current->glad_glVertexAttrib4NusvARB)
+#define glad_glVertexAttrib4bvARB (glad_gl_current->glad_glVertexAttrib4bvARB)
+#define glad_glVertexAttrib4dARB (glad_gl_current->glad_glVertexAttrib4dARB)
+#define glad_glVertexAttrib4dvARB (glad_gl_current->glad_glVertexAttrib4dvARB)
+#define glad_glVertexAttrib4fARB (glad_gl_current->glad_glVertexAttrib4fARB)
+#define glad_glVertexAttrib4fvARB (glad_gl_current->glad_glVertexAttrib4fvARB)
+#define glad_glVertexAttrib4ivARB (glad_gl_current->glad_glVertexAttrib4ivARB)
+#define glad_glVertexAttrib4sARB (glad_gl_current->glad_glVertexAttrib4sARB)
+#define glad_glVertexAttrib4svARB (glad_gl_current->glad_glVertexAttrib4svARB)
+#define glad_glVertexAttrib4ubvARB (glad_gl_current->glad_glVertexAttrib4ubvARB)
+#define glad_glVertexAttrib4uivARB (glad_gl_current->glad_glVertexAttrib4uivARB)
+#define glad_glVertexAttrib4usvARB (glad_gl_current->glad_glVertexAttrib4usvARB)
+#define glad_glVertexAttribPointerARB (glad_gl_current->glad_glVertexAttribPointerARB)
+#define glad_glEnableVertexAttribArrayARB (glad_gl_current->glad_glEnableVertexAttribArrayARB)
+#define glad_glDisableVertexAttribArrayARB (glad_gl_current->glad_glDisableVertexAttribArrayARB)
+#define glad_glGetVertexAttribdvARB (glad_gl_current->glad_glGetVertexAttribdvARB)
+#define glad_glGetVertexAttribfvARB (glad_gl_current->glad_glGetVertexAttribfvARB)
+#define glad_glGetVertexAttribivARB (glad_gl_current->glad_glGetVertexAttribivARB)
+#define glad_glGetVertexAttribPointervARB (glad_gl_current->glad_glGetVertexAttribPointervARB)
+#define glad_glBindAttribLocationARB (glad_gl_current->glad_glBindAttribLocationARB)
+#define glad_glGetActiveAttribARB (glad_gl_current->glad_glGetActiveAttribARB)
+#define glad_glGetAttribLocationARB (glad_gl_current->glad_glGetAttribLocationARB)
+#define glad_glDepthRangeArraydvNV (glad_gl_current->glad_glDepthRangeArraydvNV)
+#define glad_glDepthRangeIndexeddNV (glad_gl_current->glad_glDepthRangeIndexeddNV)
+#define glad_glWindowPos2dARB (glad_gl_current->glad_glWindowPos2dARB)
+#define glad_glWindowPos2dvARB (glad_gl_current->glad_glWindowPos2dvARB)
+#define glad_glWindowPos2fARB (glad_gl_current->glad_glWindowPos2fARB)
+#define glad_glWindowPos2fvARB (glad_gl_current->glad_glWindowPos2fvARB)
+#define glad_glWindowPos2iARB (glad_gl_current->glad_glWindowPos2iARB)
+#define glad_glWindowPos2ivARB (glad_gl_current->glad_glWindowPos2ivARB)
+#define glad_glWindowPos2sARB (glad_gl_current->glad_glWindowPos2sARB)
+#define glad_glWindowPos2svARB (glad_gl_current->glad_glWindowPos2svARB)
+#define glad_glWindowPos3dARB (glad_gl_current->glad_glWindowPos3dARB)
+#define glad_glWindowPos3dvARB (glad_gl_current->glad_glWindowPos3dvARB)
+#define glad_glWindowPos3fARB (glad_gl_current->glad_glWindowPos3fARB)
+#define glad_glWindowPos3fvARB (glad_gl_current->glad_glWindowPos3fvARB)
+#define glad_glWindowPos3iARB (glad_gl_current->glad_glWindowPos3iARB)
+#define glad_glWindowPos3ivARB (glad_gl_current->glad_glWindowPos3ivARB)
+#define glad_glWindowPos3sARB (glad_gl_current->glad_glWindowPos3sARB)
+#define glad_glWindowPos3svARB (glad_gl_current->glad_glWindowPos3svARB)
+#define glad_glDrawBuffersATI (glad_gl_current->glad_glDrawBuffersATI)
+#define glad_glElementPointerATI (glad_gl_current->glad_glElementPointerATI)
+#define glad_glDrawElementArrayATI (glad_gl_current->glad_glDrawElementArrayATI)
+#define glad_glDrawRangeElementArrayATI (glad_gl_current->glad_glDrawRangeElementArrayATI)
+#define glad_glTexBumpParameterivATI (glad_gl_current->glad_glTexBumpParameterivATI)
+#define glad_glTexBumpParameterfvATI (glad_gl_current->glad_glTexBumpParameterfvATI)
+#define glad_glGetTexBumpParameterivATI (glad_gl_current->glad_glGetTexBumpParameterivATI)
+#define glad_glGetTexBumpParameterfvATI (glad_gl_current->glad_glGetTexBumpParameterfvATI)
+#define glad_glGenFragmentShadersATI (glad_gl_current->glad_glGenFragmentShadersATI)
+#define glad_glBindFragmentShaderATI (glad_gl_current->glad_glBindFragmentShaderATI)
+#define glad_glDeleteFragmentShaderATI (glad_gl_current->glad_glDeleteFragmentShaderATI)
+#define glad_glBeginFragmentShaderATI (glad_gl_current->glad_glBeginFragmentShaderATI)
+#define glad_glEndFragmentShaderATI (glad_gl_current->glad_glEndFragmentShaderATI)
+#define glad_glPassTexCoordATI (glad_gl_current->glad_glPassTexCoordATI)
+#define glad_glSampleMapATI (glad_gl_current->glad_glSampleMapATI)
+#define glad_glColorFragmentOp1ATI (glad_gl_current->glad_glColorFragmentOp1ATI)
+#define glad_glColorFragmentOp2ATI (glad_gl_current->glad_glColorFragmentOp2ATI)
+#define glad_glColorFragmentOp3ATI (glad_gl_current->glad_glColorFragmentOp3ATI)
+#define glad_glAlphaFragmentOp1ATI (glad_gl_current->glad_glAlphaFragmentOp1ATI)
+#define glad_glAlphaFragmentOp2ATI (glad_gl_current->glad_glAlphaFragmentOp2ATI)
+#define glad_glAlphaFragmentOp3ATI (glad_gl_current->glad_glAlphaFragmentOp3ATI)
+#define glad_glSetFragmentShaderConstantATI (glad_gl_current->glad_glSetFragmentShaderConstantATI)
+#define glad_glMapObjectBufferATI (glad_gl_current->glad_glMapObjectBufferATI)
+#define glad_glUnmapObjectBufferATI (glad_gl_current->glad_glUnmapObjectBufferATI)
+#define glad_glPNTrianglesiATI (glad_gl_current->glad_glPNTrianglesiATI)
+#define glad_glPNTrianglesfATI (glad_gl_current->glad_glPNTrianglesfATI)
+#define glad_glStencilOpSeparateATI (glad_gl_current->glad_glStencilOpSeparateATI)
+#define glad_glStencilFuncSeparateATI (glad_gl_current->glad_glStencilFuncSeparateATI)
+#define glad_glNewObjectBufferATI (glad_gl_current->glad_glNewObjectBufferATI)
+#define glad_glIsObjectBufferATI (glad_gl_current->glad_glIsObjectBufferATI)
+#define glad_glUpdateObjectBufferATI (glad_gl_current->glad_glUpdateObjectBufferATI)
+#define glad_glGetObjectBufferfvATI (glad_gl_current->glad_glGetObjectBufferfvATI)
+#define glad_glGetObjectBufferivATI (glad_gl_current->glad_glGetObjectBufferivATI)
+#define glad_glFreeObjectBufferATI (glad_gl_current->glad_glFreeObjectBufferATI)
+#define glad_glArrayObjectATI (glad_gl_current->glad_glArrayObjectATI)
+#define glad_glGetArrayObjectfvATI (glad_gl_current->glad_glGetArrayObjectfvATI)
+#define glad_glGetArrayObjectivATI (glad_gl_current->glad_glGetArrayObjectivATI)
+#define glad_glVariantArrayObjectATI (glad_gl_current->glad_glVariantArrayObjectATI)
+#define glad_glGetVariantArrayObjectfvATI (glad_gl_current->glad_glGetVariantArrayObjectfvATI)
+#define glad_glGetVariantArrayObjectivATI (glad_gl_current->glad_glGetVariantArrayObjectivATI)
+#define glad_glVertexAttribArrayObjectATI (glad_gl_current->glad_glVertexAttribArrayObjectATI)
+#define glad_glGetVertexAttribArrayObjectfvATI (glad_gl_current->glad_glGetVertexAttribArrayObjectfvATI)
+#define glad_glGetVertexAttribArrayObjectivATI (glad_gl_current->glad_glGetVertexAttribArrayObjectivATI)
+#define glad_glVertexStream1sATI (glad_gl_current->glad_glVertexStream1sATI)
+#define glad_glVertexStream1svATI (glad_gl_current->glad_glVertexStream1svATI)
+#define glad_glVertexStream1iATI (glad_gl_current->glad_glVertexStream1iATI)
+#define glad_glVertexStream1ivATI (glad_gl_current->glad_glVertexStream1ivATI)
+#define glad_glVertexStream1fATI (glad_gl_current->glad_glVertexStream1fATI)
+#define glad_glVertexStream1fvATI (glad_gl_current->glad_glVertexStream1fvATI)
+#define glad_glVertexStream1dATI (glad_gl_current->glad_glVertexStream1dATI)
+#define glad_glVertexStream1dvATI (glad_gl_current->glad_glVertexStream1dvATI)
+#define glad_glVertexStream2sATI (glad_gl_current->glad_glVertexStream2sATI)
+#define glad_glVertexStream2svATI (glad_gl_current->glad_glVertexStream2svATI)
+#define glad_glVertexStream2iATI (glad_gl_current->glad_glVertexStream2iATI)
+#define glad_glVertexStream2ivATI (glad_gl_current->glad_glVertexStream2ivATI)
+#define glad_glVertexStream2fATI (glad_gl_current->glad_glVertexStream2fATI)
+#define glad_glVertexStream2fvATI (glad_gl_current->glad_glVertexStream2fvATI)
+#define glad_glVertexStream2dATI (glad_gl_current->glad_glVertexStream2dATI)
+#define glad_glVertexStream2dvATI (glad_gl_current->glad_glVertexStream2dvATI)
+#define glad_glVertexStream3sATI (glad_gl_current->glad_glVertexStream3sATI)
+#define glad_glVertexStream3svATI (glad_gl_current->glad_glVertexStream3svATI)
+#define glad_glVertexStream3iATI (glad_gl_current->glad_glVertexStream3iATI)
+#define glad_glVertexStream3ivATI (glad_gl_current->glad_glVertexStream3ivATI)
+#define glad_glVertexStream3fATI (glad_gl_current->glad_glVertexStream3fATI)
+#define glad_glVertexStream3fvATI (glad_gl_current->glad_glVertexStream3fvATI)
+#define glad_glVertexStream3dATI (glad_gl_current->glad_glVertexStream3dATI)
+#define glad_glVertexStream3dvATI (glad_gl_current->glad_glVertexStream3dvATI)
+#define glad_glVertexStream4sATI (glad_gl_current->glad_glVertexStream4sATI)
+#define glad_glVertexStream4svATI (glad_gl_current->glad_glVertexStream4svATI)
+#define glad_glVertexStream4iATI (glad_gl_current->glad_glVertexStream4iATI)
+#define glad_glVertexStream4ivATI (glad_gl_current->glad_glVertexStream4ivATI)
+#define glad_glVertexStream4fATI (glad_gl_current->glad_glVertexStream4fATI)
+#define glad_glVertexStream4fvATI (glad_gl_current->glad_glVertexStream4fvATI)
+#define glad_glVertexStream4dATI (glad_gl_current->glad_glVertexStream4dATI)
+#define glad_glVertexStream4dvATI (glad_gl_current->glad_glVertexStream4dvATI)
+#define glad_glNormalStream3bATI (glad_gl_current->glad_glNormalStream3bATI)
+#define glad_glNormalStream3bvATI (glad_gl_current->glad_glNormalStream3bvATI)
+#define glad_glNormalStream3sATI (glad_gl_current->glad_glNormalStream3sATI)
+#define glad_glNormalStream3svATI (glad_gl_current->glad_glNormalStream3svATI)
+#define glad_glNormalStream3iATI (glad_gl_current->glad_glNormalStream3iATI)
+#define glad_glNormalStream3ivATI (glad_gl_current->glad_glNormalStream3ivATI)
+#define glad_glNormalStream3fATI (glad_gl_current->glad_glNormalStream3fATI)
+#define glad_glNormalStream3fvATI (glad_gl_current->glad_glNormalStream3fvATI)
+#define glad_glNormalStream3dATI (glad_gl_current->glad_glNormalStream3dATI)
+#define glad_glNormalStream3dvATI (glad_gl_current->glad_glNormalStream3dvATI)
+#define glad_glClientActiveVertexStreamATI (glad_gl_current->glad_glClientActiveVertexStreamATI)
+#define glad_glVertexBlendEnviATI (glad_gl_current->glad_glVertexBlendEnviATI)
+#define glad_glVertexBlendEnvfATI (glad_gl_current->glad_glVertexBlendEnvfATI)
+#define glad_glEGLImageTargetTexStorageEXT (glad_gl_current->glad_glEGLImageTargetTexStorageEXT)
+#define glad_glEGLImageTargetTextureStorageEXT (glad_gl_current->glad_glEGLImageTargetTextureStorageEXT)
+#define glad_glUniformBufferEXT (glad_gl_current->glad_glUniformBufferEXT)
+#define glad_glGetUniformBufferSizeEXT (glad_gl_current->glad_glGetUniformBufferSizeEXT)
+#define glad_glGetUniformOffsetEXT (glad_gl_current->glad_glGetUniformOffsetEXT)
+#define glad_glBlendColorEXT (glad_gl_current->glad_glBlendColorEXT)
+#define glad_glBlendEquationSeparateEXT (glad_gl_current->glad_glBlendEquationSeparateEXT)
+#define glad_glBlendFuncSeparateEXT (glad_gl_current->glad_glBlendFuncSeparateEXT)
+#define glad_glBlendEquationEXT (glad_gl_current->glad_glBlendEquationEXT)
+#define glad_glColorSubTableEXT (glad_gl_current->glad_glColorSubTableEXT)
+#define glad_glCopyColorSubTableEXT (glad_gl_current->glad_glCopyColorSubTableEXT)
+#define glad_glLockArraysEXT (glad_gl_current->glad_glLockArraysEXT)
+#define glad_glUnlockArraysEXT (glad_gl_current->glad_glUnlockArraysEXT)
+#define glad_glConvolutionFilter1DEXT (glad_gl_current->glad_glConvolutionFilter1DEXT)
+#define glad_glConvolutionFilter2DEXT (glad_gl_current->glad_glConvolutionFilter2DEXT)
+#define glad_glConvolutionParameterfEXT (glad_gl_current->glad_glConvolutionParameterfEXT)
+#define glad_glConvolutionParameterfvEXT (glad_gl_current->glad_glConvolutionParameterfvEXT)
+#define glad_glConvolutionParameteriEXT (glad_gl_current->glad_glConvolutionParameteriEXT)
+#define glad_glConvolutionParameterivEXT (glad_gl_current->glad_glConvolutionParameterivEXT)
+#define glad_glCopyConvolutionFilter1DEXT (glad_gl_current->glad_glCopyConvolutionFilter1DEXT)
+#define glad_glCopyConvolutionFilter2DEXT (glad_gl_current->glad_glCopyConvolutionFilter2DEXT)
+#define glad_glGetConvolutionFilterEXT (glad_gl_current->glad_glGetConvolutionFilterEXT)
+#define glad_glGetConvolutionParameterfvEXT (glad_gl_current->glad_glGetConvolutionParameterfvEXT)
+#define glad_glGetConvolutionParameterivEXT (glad_gl_current->glad_glGetConvolutionParameterivEXT)
+#define glad_glGetSeparableFilterEXT (glad_gl_current->glad_glGetSeparableFilterEXT)
+#define glad_glSeparableFilter2DEXT (glad_gl_current->glad_glSeparableFilter2DEXT)
+#define glad_glTangent3bEXT (glad_gl_current->glad_glTangent3bEXT)
+#define glad_glTangent3bvEXT (glad_gl_current->glad_glTangent3bvEXT)
+#define glad_glTangent3dEXT (glad_gl_current->glad_glTangent3dEXT)
+#define glad_glTangent3dvEXT (glad_gl_current->glad_glTangent3dvEXT)
+#define glad_glTangent3fEXT (glad_gl_current->glad_glTangent3fEXT)
+#define glad_glTangent3fvEXT (glad_gl_current->glad_glTangent3fvEXT)
+#define glad_glTangent3iEXT (glad_gl_current->glad_glTangent3iEXT)
+#define glad_glTangent3ivEXT (glad_gl_current->glad_glTangent3ivEXT)
+#define glad_glTangent3sEXT (glad_gl_current->glad_glTangent3sEXT)
+#define glad_glTangent3svEXT (glad_gl_current->glad_glTangent3svEXT)
+#define glad_glBinormal3bEXT (glad_gl_current->glad_glBinormal3bEXT)
+#define glad_glBinormal3bvEXT (glad_gl_current->glad_glBinormal3bvEXT)
+#define glad_glBinormal3dEXT (glad_gl_current->glad_glBinormal3dEXT)
+#define glad_glBinormal3dvEXT (glad_gl_current->glad_glBinormal3dvEXT)
+#define glad_glBinormal3fEXT (glad_gl_current->glad_glBinormal3fEXT)
+#define glad_glBinormal3fvEXT (glad_gl_current->glad_glBinormal3fvEXT)
+#define glad_glBinormal3iEXT (glad_gl_current->glad_glBinormal3iEXT)
+#define glad_glBinormal3ivEXT (glad_gl_current->glad_glBinormal3ivEXT)
+#define glad_glBinormal3sEXT (glad_gl_current->glad_glBinormal3sEXT)
+#define glad_glBinormal3svEXT (glad_gl_current->glad_glBinormal3svEXT)
+#define glad_glTangentPointerEXT (glad_gl_current->glad_glTangentPointerEXT)
+#define glad_glBinormalPointerEXT (glad_gl_current->glad_glBinormalPointerEXT)
+#define glad_glCopyTexImage1DEXT (glad_gl_current->glad_glCopyTexImage1DEXT)
+#define glad_glCopyTexImage2DEXT (glad_gl_current->glad_glCopyTexImage2DEXT)
+#define glad_glCopyTexSubImage1DEXT (glad_gl_current->glad_glCopyTexSubImage1DEXT)
+#define glad_glCopyTexSubImage2DEXT (glad_gl_current->glad_glCopyTexSubImage2DEXT)
+#define glad_glCopyTexSubImage3DEXT (glad_gl_current->glad_glCopyTexSubImage3DEXT)
+#define glad_glCullParameterdvEXT (glad_gl_current->glad_glCullParameterdvEXT)
+#define glad_glCullParameterfvEXT (glad_gl_current->glad_glCullParameterfvEXT)
+#define glad_glLabelObjectEXT (glad_gl_current->glad_glLabelObjectEXT)
+#define glad_glGetObjectLabelEXT (glad_gl_current->glad_glGetObjectLabelEXT)
+#define glad_glInsertEventMarkerEXT (glad_gl_current->glad_glInsertEventMarkerEXT)
+#define glad_glPushGroupMarkerEXT (glad_gl_current->glad_glPushGroupMarkerEXT)
+#define glad_glPopGroupMarkerEXT (glad_gl_current->glad_glPopGroupMarkerEXT)
+#define glad_glDepthBoundsEXT (glad_gl_current->glad_glDepthBoundsEXT)
+#define glad_glMatrixLoadfEXT (glad_gl_current->glad_glMatrixLoadfEXT)
+#define glad_glMatrixLoaddEXT (glad_gl_current->glad_glMatrixLoaddEXT)
+#define glad_glMatrixMultfEXT (glad_gl_current->glad_glMatrixMultfEXT)
+#define glad_glMatrixMultdEXT (glad_gl_current->glad_glMatrixMultdEXT)
+#define glad_glMatrixLoadIdentityEXT (glad_gl_current->glad_glMatrixLoadIdentityEXT)
+#define glad_glMatrixRotatefEXT (glad_gl_current->glad_glMatrixRotatefEXT)
+#define glad_glMatrixRotatedEXT (glad_gl_current->glad_glMatrixRotatedEXT)
+#define glad_glMatrixScalefEXT (glad_gl_current->glad_glMatrixScalefEXT)
+#define glad_glMatrixScaledEXT (glad_gl_current->glad_glMatrixScaledEXT)
+#define glad_glMatrixTranslatefEXT (glad_gl_current->glad_glMatrixTranslatefEXT)
+#define glad_glMatrixTranslatedEXT (glad_gl_current->glad_glMatrixTranslatedEXT)
+#define glad_glMatrixFrustumEXT (glad_gl_current->glad_glMatrixFrustumEXT)
+#define glad_glMatrixOrthoEXT (glad_gl_current->glad_glMatrixOrthoEXT)
+#define glad_glMatrixPopEXT (glad_gl_current->glad_glMatrixPopEXT)
+#define glad_glMatrixPushEXT (glad_gl_current->glad_glMatrixPushEXT)
+#define glad_glClientAttribDefaultEXT (glad_gl_current->glad_glClientAttribDefaultEXT)
+#define glad_glPushClientAttribDefaultEXT (glad_gl_current->glad_glPushClientAttribDefaultEXT)
+#define glad_glTextureParameterfEXT (glad_gl_current->glad_glTextureParameterfEXT)
+#define glad_glTextureParameterfvEXT (glad_gl_current->glad_glTextureParameterfvEXT)
+#define glad_glTextureParameteriEXT (glad_gl_current->glad_glTextureParameteriEXT)
+#define glad_glTextureParameterivEXT (glad_gl_current->glad_glTextureParameterivEXT)
+#define glad_glTextureImage1DEXT (glad_gl_current->glad_glTextureImage1DEXT)
+#define glad_glTextureImage2DEXT (glad_gl_current->glad_glTextureImage2DEXT)
+#define glad_glTextureSubImage1DEXT (glad_gl_current->glad_glTextureSubImage1DEXT)
+#define glad_glTextureSubImage2DEXT (glad_gl_current->glad_glTextureSubImage2DEXT)
+#define glad_glCopyTextureImage1DEXT (glad_gl_current->glad_glCopyTextureImage1DEXT)
+#define glad_glCopyTextureImage2DEXT (glad_gl_current->glad_glCopyTextureImage2DEXT)
+#define glad_glCopyTextureSubImage1DEXT (glad_gl_current->glad_glCopyTextureSubImage1DEXT)
+#define glad_glCopyTextureSubImage2DEXT (glad_gl_current->glad_glCopyTextureSubImage2DEXT)
+#define glad_glGetTextureImageEXT (glad_gl_current->glad_glGetTextureImageEXT)
+#define glad_glGetTextureParameterfvEXT (glad_gl_current->glad_glGetTextureParameterfvEXT)
+#define glad_glGetTextureParameterivEXT (glad_gl_current->glad_glGetTextureParameterivEXT)
+#define glad_glGetTextureLevelParameterfvEXT (glad_gl_current->glad_glGetTextureLevelParameterfvEXT)
+#define glad_glGetTextureLevelParameterivEXT (glad_gl_current->glad_glGetTextureLevelParameterivEXT)
+#define glad_glTextureImage3DEXT (glad_gl_current->glad_glTextureImage3DEXT)
+#define glad_glTextureSubImage3DEXT (glad_gl_current->glad_glTextureSubImage3DEXT)
+#define glad_glCopyTextureSubImage3DEXT (glad_gl_current->glad_glCopyTextureSubImage3DEXT)
+#define glad_glBindMultiTextureEXT (glad_gl_current->glad_glBindMultiTextureEXT)
+#define glad_glMultiTexCoordPointerEXT (glad_gl_current->glad_glMultiTexCoordPointerEXT)
+#define glad_glMultiTexEnvfEXT (glad_gl_current->glad_glMultiTexEnvfEXT)
+#define glad_glMultiTexEnvfvEXT (glad_gl_current->glad_glMultiTexEnvfvEXT)
+#define glad_glMultiTexEnviEXT (glad_gl_current->glad_glMultiTexEnviEXT)
+#define glad_glMultiTexEnvivEXT (glad_gl_current->glad_glMultiTexEnvivEXT)
+#define glad_glMultiTexGendEXT (glad_gl_current->glad_glMultiTexGendEXT)
+#define glad_glMultiTexGendvEXT (glad_gl_current->glad_glMultiTexGendvEXT)
+#define glad_glMultiTexGenfEXT (glad_gl_current->glad_glMultiTexGenfEXT)
+#define glad_glMultiTexGenfvEXT (glad_gl_current->glad_glMultiTexGenfvEXT)
+#define glad_glMultiTexGeniEXT (glad_gl_current->glad_glMultiTexGeniEXT)
+#define glad_glMultiTexGenivEXT (glad_gl_current->glad_glMultiTexGenivEXT)
+#define glad_glGetMultiTexEnvfvEXT (glad_gl_current->glad_glGetMultiTexEnvfvEXT)
+#define glad_glGetMultiTexEnvivEXT (glad_gl_current->glad_glGetMultiTexEnvivEXT)
+#define glad_glGetMultiTexGendvEXT (glad_gl_current->glad_glGetMultiTexGendvEXT)
+#define glad_glGetMultiTexGenfvEXT (glad_gl_current->glad_glGetMultiTexGenfvEXT)
+#define glad_glGetMultiTexGenivEXT (glad_gl_current->glad_glGetMultiTexGenivEXT)
+#define glad_glMultiTexParameteriEXT (glad_gl_current->glad_glMultiTexParameteriEXT)
+#define glad_glMultiTexParameterivEXT (glad_gl_current->glad_glMultiTexParameterivEXT)
+#define glad_glMultiTexParameterfEXT (glad_gl_current->glad_glMultiTexParameterfEXT)
+#define glad_glMultiTexParameterfvEXT (glad_gl_current->glad_glMultiTexParameterfvEXT)
+#define glad_glMultiTexImage1DEXT (glad_gl_current->glad_glMultiTexImage1DEXT)
+#define glad_glMultiTexImage2DEXT (glad_gl_current->glad_glMultiTexImage2DEXT)
+#define glad_glMultiTexSubImage1DEXT (glad_gl_current->glad_glMultiTexSubImage1DEXT)
+#define glad_glMultiTexSubImage2DEXT (glad_gl_current->glad_glMultiTexSubImage2DEXT)
+#define glad_glCopyMultiTexImage1DEXT (glad_gl_current->glad_glCopyMultiTexImage1DEXT)
+#define glad_glCopyMultiTexImage2DEXT (glad_gl_current->glad_glCopyMultiTexImage2DEXT)
+#define glad_glCopyMultiTexSubImage1DEXT (glad_gl_current->glad_glCopyMultiTexSubImage1DEXT)
+#define glad_glCopyMultiTexSubImage2DEXT (glad_gl_current->glad_glCopyMultiTexSubImage2DEXT)
+#define glad_glGetMultiTexImageEXT (glad_gl_current->glad_glGetMultiTexImageEXT)
+#define glad_glGetMultiTexParameterfvEXT (glad_gl_current->glad_glGetMultiTexParameterfvEXT)
+#define glad_glGetMultiTexParameterivEXT (glad_gl_current->glad_glGetMultiTexParameterivEXT)
+#define glad_glGetMultiTexLevelParameterfvEXT (glad_gl_current->glad_glGetMultiTexLevelParameterfvEXT)
+#define glad_glGetMultiTexLevelParameterivEXT (glad_gl_current->glad_glGetMultiTexLevelParameterivEXT)
+#define glad_glMultiTexImage3DEXT (glad_gl_current->glad_glMultiTexImage3DEXT)
+#define glad_glMultiTexSubImage3DEXT (glad_gl_current->glad_glMultiTexSubImage3DEXT)
+#define glad_glCopyMultiTexSubImage3DEXT (glad_gl_current->glad_glCopyMultiTexSubImage3DEXT)
+#define glad_glEnableClientStateIndexedEXT (glad_gl_current->glad_glEnableClientStateIndexedEXT)
+#define glad_glDisableClientStateIndexedEXT (glad_gl_current->glad_glDisableClientStateIndexedEXT)
+#define glad_glGetFloatIndexedvEXT (glad_gl_current->glad_glGetFloatIndexedvEXT)
+#define glad_glGetDoubleIndexedvEXT (glad_gl_current->glad_glGetDoubleIndexedvEXT)
+#define glad_glGetPointerIndexedvEXT (glad_gl_current->glad_glGetPointerIndexedvEXT)
+#define glad_glEnableIndexedEXT (glad_gl_current->glad_glEnableIndexedEXT)
+#define glad_glDisableIndexedEXT (glad_gl_current->glad_glDisableIndexedEXT)
+#define glad_glIsEnabledIndexedEXT (glad_gl_current->glad_glIsEnabledIndexedEXT)
+#define glad_glGetIntegerIndexedvEXT (glad_gl_current->glad_glGetIntegerIndexedvEXT)
+#define glad_glGetBooleanIndexedvEXT (glad_gl_current->glad_glGetBooleanIndexedvEXT)
+#define glad_glCompressedTextureImage3DEXT (glad_gl_current->glad_glCompressedTextureImage3DEXT)
+#define glad_glCompressedTextureImage2DEXT (glad_gl_current->glad_glCompressedTextureImage2DEXT)
+#define glad_glCompressedTextureImage1DEXT (glad_gl_current->glad_glCompressedTextureImage1DEXT)
+#define glad_glCompressedTextureSubImage3DEXT (glad_gl_current->glad_glCompressedTextureSubImage3DEXT)
+#define glad_glCompressedTextureSubImage2DEXT (glad_gl_current->glad_glCompressedTextureSubImage2DEXT)
+#define glad_glCompressedTextureSubImage1DEXT (glad_gl_current->glad_glCompressedTextureSubImage1DEXT)
+#define glad_glGetCompressedTextureImageEXT (glad_gl_current->glad_glGetCompressedTextureImageEXT)
+#define glad_glCompressedMultiTexImage3DEXT (glad_gl_current->glad_glCompressedMultiTexImage3DEXT)
+#define glad_glCompressedMultiTexImage2DEXT (glad_gl_current->glad_glCompressedMultiTexImage2DEXT)
+#define glad_glCompressedMultiTexImage1DEXT (glad_gl_current->glad_glCompressedMultiTexImage1DEXT)
+#define glad_glCompressedMultiTexSubImage3DEXT (glad_gl_current->glad_glCompressedMultiTexSubImage3DEXT)
+#define glad_glCompressedMultiTexSubImage2DEXT (glad_gl_current->glad_glCompressedMultiTexSubImage2DEXT)
+#define glad_glCompressedMultiTexSubImage1DEXT (glad_gl_current->glad_glCompressedMultiTexSubImage1DEXT)
+#define glad_glGetCompressedMultiTexImageEXT (glad_gl_current->glad_glGetCompressedMultiTexImageEXT)
+#define glad_glMatrixLoadTransposefEXT (glad_gl_current->glad_glMatrixLoadTransposefEXT)
+#define glad_glMatrixLoadTransposedEXT (glad_gl_current->glad_glMatrixLoadTransposedEXT)
+#define glad_glMatrixMultTransposefEXT (glad_gl_current->glad_glMatrixMultTransposefEXT)
+#define glad_glMatrixMultTransposedEXT (glad_gl_current->glad_glMatrixMultTransposedEXT)
+#define glad_glNamedBufferDataEXT (glad_gl_current->glad_glNamedBufferDataEXT)
+#define glad_glNamedBufferSubDataEXT (glad_gl_current->glad_glNamedBufferSubDataEXT)
+#define glad_glMapNamedBufferEXT (glad_gl_current->glad_glMapNamedBufferEXT)
+#define glad_glUnmapNamedBufferEXT (glad_gl_current->glad_glUnmapNamedBufferEXT)
+#define glad_glGetNamedBufferParameterivEXT (glad_gl_current->glad_glGetNamedBufferParameterivEXT)
+#define glad_glGetNamedBufferPointervEXT (glad_gl_current->glad_glGetNamedBufferPointervEXT)
+#define glad_glGetNamedBufferSubDataEXT (glad_gl_current->glad_glGetNamedBufferSubDataEXT)
+#define glad_glProgramUniform1fEXT (glad_gl_current->glad_glProgramUniform1fEXT)
+#define glad_glProgramUniform2fEXT (glad_gl_current->glad_glProgramUniform2fEXT)
+#define glad_glProgramUniform3fEXT (glad_gl_current->glad_glProgramUniform3fEXT)
+#define glad_glProgramUniform4fEXT (glad_gl_current->glad_glProgramUniform4fEXT)
+#define glad_glProgramUniform1iEXT (glad_gl_current->glad_glProgramUniform1iEXT)
+#define glad_glProgramUniform2iEXT (glad_gl_current->glad_glProgramUniform2iEXT)
+#define glad_glProgramUniform3iEXT (glad_gl_current->glad_glProgramUniform3iEXT)
+#define glad_glProgramUniform4iEXT (glad_gl_current->glad_glProgramUniform4iEXT)
+#define glad_glProgramUniform1fvEXT (glad_gl_current->glad_glProgramUniform1fvEXT)
+#define glad_glProgramUniform2fvEXT (glad_gl_current->glad_glProgramUniform2fvEXT)
+#define glad_glProgramUniform3fvEXT (glad_gl_current->glad_glProgramUniform3fvEXT)
+#define glad_glProgramUniform4fvEXT (glad_gl_current->glad_glProgramUniform4fvEXT)
+#define glad_glProgramUniform1ivEXT (glad_gl_current->glad_glProgramUniform1ivEXT)
+#define glad_glProgramUniform2ivEXT (glad_gl_current->glad_glProgramUniform2ivEXT)
+#define glad_glProgramUniform3ivEXT (glad_gl_current->glad_glProgramUniform3ivEXT)
+#define glad_glProgramUniform4ivEXT (glad_gl_current->glad_glProgramUniform4ivEXT)
+#define glad_glProgramUniformMatrix2fvEXT (glad_gl_current->glad_glProgramUniformMatrix2fvEXT)
+#define glad_glProgramUniformMatrix3fvEXT (glad_gl_current->glad_glProgramUniformMatrix3fvEXT)
+#define glad_glProgramUniformMatrix4fvEXT (glad_gl_current->glad_glProgramUniformMatrix4fvEXT)
+#define glad_glProgramUniformMatrix2x3fvEXT (glad_gl_current->glad_glProgramUniformMatrix2x3fvEXT)
+#define glad_glProgramUniformMatrix3x2fvEXT (glad_gl_current->glad_glProgramUniformMatrix3x2fvEXT)
+#define glad_glProgramUniformMatrix2x4fvEXT (glad_gl_current->glad_glProgramUniformMatrix2x4fvEXT)
+#define glad_glProgramUniformMatrix4x2fvEXT (glad_gl_current->glad_glProgramUniformMatrix4x2fvEXT)
+#define glad_glProgramUniformMatrix3x4fvEXT (glad_gl_current->glad_glProgramUniformMatrix3x4fvEXT)
+#define glad_glProgramUniformMatrix4x3fvEXT (glad_gl_current->glad_glProgramUniformMatrix4x3fvEXT)
+#define glad_glTextureBufferEXT (glad_gl_current->glad_glTextureBufferEXT)
+#define glad_glMultiTexBufferEXT (glad_gl_current->glad_glMultiTexBufferEXT)
+#define glad_glTextureParameterIivEXT (glad_gl_current->glad_glTextureParameterIivEXT)
+#define glad_glTextureParameterIuivEXT (glad_gl_current->glad_glTextureParameterIuivEXT)
+#define glad_glGetTextureParameterIivEXT (glad_gl_current->glad_glGetTextureParameterIivEXT)
+#define glad_glGetTextureParameterIuivEXT (glad_gl_current->glad_glGetTextureParameterIuivEXT)
+#define glad_glMultiTexParameterIivEXT (glad_gl_current->glad_glMultiTexParameterIivEXT)
+#define glad_glMultiTexParameterIuivEXT (glad_gl_current->glad_glMultiTexParameterIuivEXT)
+#define glad_glGetMultiTexParameterIivEXT (glad_gl_current->glad_glGetMultiTexParameterIivEXT)
+#define glad_glGetMultiTexParameterIuivEXT (glad_gl_current->glad_glGetMultiTexParameterIuivEXT)
+#define glad_glProgramUniform1uiEXT (glad_gl_current->glad_glProgramUniform1uiEXT)
+#define glad_glProgramUniform2uiEXT (glad_gl_current->glad_glProgramUniform2uiEXT)
+#define glad_glProgramUniform3uiEXT (glad_gl_current->glad_glProgramUniform3uiEXT)
+#define glad_glProgramUniform4uiEXT (glad_gl_current->glad_glProgramUniform4uiEXT)
+#define glad_glProgramUniform1uivEXT (glad_gl_current->glad_glProgramUniform1uivEXT)
+#define glad_glProgramUniform2uivEXT (glad_gl_current->glad_glProgramUniform2uivEXT)
+#define glad_glProgramUniform3uivEXT (glad_gl_current->glad_glProgramUniform3uivEXT)
+#define glad_glProgramUniform4uivEXT (glad_gl_current->glad_glProgramUniform4uivEXT)
+#define glad_glNamedProgramLocalParameters4fvEXT (glad_gl_current->glad_glNamedProgramLocalParameters4fvEXT)
+#define glad_glNamedProgramLocalParameterI4iEXT (glad_gl_current->glad_glNamedProgramLocalParameterI4iEXT)
+#define glad_glNamedProgramLocalParameterI4ivEXT (glad_gl_current->glad_glNamedProgramLocalParameterI4ivEXT)
+#define glad_glNamedProgramLocalParametersI4ivEXT (glad_gl_current->glad_glNamedProgramLocalParametersI4ivEXT)
+#define glad_glNamedProgramLocalParameterI4uiEXT (glad_gl_current->glad_glNamedProgramLocalParameterI4uiEXT)
+#define glad_glNamedProgramLocalParameterI4uivEXT (glad_gl_current->glad_glNamedProgramLocalParameterI4uivEXT)
+#define glad_glNamedProgramLocalParametersI4uivEXT (glad_gl_current->glad_glNamedProgramLocalParametersI4uivEXT)
+#define glad_glGetNamedProgramLocalParameterIivEXT (glad_gl_current->glad_glGetNamedProgramLocalParameterIivEXT)
+#define glad_glGetNamedProgramLocalParameterIuivEXT (glad_gl_current->glad_glGetNamedProgramLocalParameterIuivEXT)
+#define glad_glEnableClientStateiEXT (glad_gl_current->glad_glEnableClientStateiEXT)
+#define glad_glDisableClientStateiEXT (glad_gl_current->glad_glDisableClientStateiEXT)
+#define glad_glGetFloati_vEXT (glad_gl_current->glad_glGetFloati_vEXT)
+#define glad_glGetDoublei_vEXT (glad_gl_current->glad_glGetDoublei_vEXT)
+#define glad_glGetPointeri_vEXT (glad_gl_current->glad_glGetPointeri_vEXT)
+#define glad_glNamedProgramStringEXT (glad_gl_current->glad_glNamedProgramStringEXT)
+#define glad_glNamedProgramLocalParameter4dEXT (glad_gl_current->glad_glNamedProgramLocalParameter4dEXT)
+#define glad_glNamedProgramLocalParameter4dvEXT (glad_gl_current->glad_glNamedProgramLocalParameter4dvEXT)
+#define glad_glNamedProgramLocalParameter4fEXT (glad_gl_current->glad_glNamedProgramLocalParameter4fEXT)
+#define glad_glNamedProgramLocalParameter4fvEXT (glad_gl_current->glad_glNamedProgramLocalParameter4fvEXT)
+#define glad_glGetNamedProgramLocalParameterdvEXT (glad_gl_current->glad_glGetNamedProgramLocalParameterdvEXT)
+#define glad_glGetNamedProgramLocalParameterfvEXT (glad_gl_current->glad_glGetNamedProgramLocalParameterfvEXT)
+#define glad_glGetNamedProgramivEXT (glad_gl_current->glad_glGetNamedProgramivEXT)
+#define glad_glGetNamedProgramStringEXT (glad_gl_current->glad_glGetNamedProgramStringEXT)
+#define glad_glNamedRenderbufferStorageEXT (glad_gl_current->glad_glNamedRenderbufferStorageEXT)
+#define glad_glGetNamedRenderbufferParameterivEXT (glad_gl_current->glad_glGetNamedRenderbufferParameterivEXT)
+#define glad_glNamedRenderbufferStorageMultisampleEXT (glad_gl_current->glad_glNamedRenderbufferStorageMultisampleEXT)
+#define glad_glNamedRenderbufferStorageMultisampleCoverageEXT (glad_gl_current->glad_glNamedRenderbufferStorageMultisampleCoverageEXT)
+#define glad_glCheckNamedFramebufferStatusEXT (glad_gl_current->glad_glCheckNamedFramebufferStatusEXT)
+#define glad_glNamedFramebufferTexture1DEXT (glad_gl_current->glad_glNamedFramebufferTexture1DEXT)
+#define glad_glNamedFramebufferTexture2DEXT (glad_gl_current->glad_glNamedFramebufferTexture2DEXT)
+#define glad_glNamedFramebufferTexture3DEXT (glad_gl_current->glad_glNamedFramebufferTexture3DEXT)
+#define glad_glNamedFramebufferRenderbufferEXT (glad_gl_current->glad_glNamedFramebufferRenderbufferEXT)
+#define glad_glGetNamedFramebufferAttachmentParameterivEXT (glad_gl_current->glad_glGetNamedFramebufferAttachmentParameterivEXT)
+#define glad_glGenerateTextureMipmapEXT (glad_gl_current->glad_glGenerateTextureMipmapEXT)
+#define glad_glGenerateMultiTexMipmapEXT (glad_gl_current->glad_glGenerateMultiTexMipmapEXT)
+#define glad_glFramebufferDrawBufferEXT (glad_gl_current->glad_glFramebufferDrawBufferEXT)
+#define glad_glFramebufferDrawBuffersEXT (glad_gl_current->glad_glFramebufferDrawBuffersEXT)
+#define glad_glFramebufferReadBufferEXT (glad_gl_current->glad_glFramebufferReadBufferEXT)
+#define glad_glGetFramebufferParameterivEXT (glad_gl_current->glad_glGetFramebufferParameterivEXT)
+#define glad_glNamedCopyBufferSubDataEXT (glad_gl_current->glad_glNamedCopyBufferSubDataEXT)
+#define glad_glNamedFramebufferTextureEXT (glad_gl_current->glad_glNamedFramebufferTextureEXT)
+#define glad_glNamedFramebufferTextureLayerEXT (glad_gl_current->glad_glNamedFramebufferTextureLayerEXT)
+#define glad_glNamedFramebufferTextureFaceEXT (glad_gl_current->glad_glNamedFramebufferTextureFaceEXT)
+#define glad_glTextureRenderbufferEXT (glad_gl_current->glad_glTextureRenderbufferEXT)
+#define glad_glMultiTexRenderbufferEXT (glad_gl_current->glad_glMultiTexRenderbufferEXT)
+#define glad_glVertexArrayVertexOffsetEXT (glad_gl_current->glad_glVertexArrayVertexOffsetEXT)
+#define glad_glVertexArrayColorOffsetEXT (glad_gl_current->glad_glVertexArrayColorOffsetEXT)
+#define glad_glVertexArrayEdgeFlagOffsetEXT (glad_gl_current->glad_glVertexArrayEdgeFlagOffsetEXT)
+#define glad_glVertexArrayIndexOffsetEXT (glad_gl_current->glad_glVertexArrayIndexOffsetEXT)
+#define glad_glVertexArrayNormalOffsetEXT (glad_gl_current->glad_glVertexArrayNormalOffsetEXT)
+#define glad_glVertexArrayTexCoordOffsetEXT (glad_gl_current->glad_glVertexArrayTexCoordOffsetEXT)
+#define glad_glVertexArrayMultiTexCoordOffsetEXT (glad_gl_current->glad_glVertexArrayMultiTexCoordOffsetEXT)
+#define glad_glVertexArrayFogCoordOffsetEXT (glad_gl_current->glad_glVertexArrayFogCoordOffsetEXT)
+#define glad_glVertexArraySecondaryColorOffsetEXT (glad_gl_current->glad_glVertexArraySecondaryColorOffsetEXT)
+#define glad_glVertexArrayVertexAttribOffsetEXT (glad_gl_current->glad_glVertexArrayVertexAttribOffsetEXT)
+#define glad_glVertexArrayVertexAttribIOffsetEXT (glad_gl_current->glad_glVertexArrayVertexAttribIOffsetEXT)
+#define glad_glEnableVertexArrayEXT (glad_gl_current->glad_glEnableVertexArrayEXT)
+#define glad_glDisableVertexArrayEXT (glad_gl_current->glad_glDisableVertexArrayEXT)
+#define glad_glEnableVertexArrayAttribEXT (glad_gl_current->glad_glEnableVertexArrayAttribEXT)
+#define glad_glDisableVertexArrayAttribEXT (glad_gl_current->glad_glDisableVertexArrayAttribEXT)
+#define glad_glGetVertexArrayIntegervEXT (glad_gl_current->glad_glGetVertexArrayIntegervEXT)
+#define glad_glGetVertexArrayPointervEXT (glad_gl_current->glad_glGetVertexArrayPointervEXT)
+#define glad_glGetVertexArrayIntegeri_vEXT (glad_gl_current->glad_glGetVertexArrayIntegeri_vEXT)
+#define glad_glGetVertexArrayPointeri_vEXT (glad_gl_current->glad_glGetVertexArrayPointeri_vEXT)
+#define glad_glMapNamedBufferRangeEXT (glad_gl_current->glad_glMapNamedBufferRangeEXT)
+#define glad_glFlushMappedNamedBufferRangeEXT (glad_gl_current->glad_glFlushMappedNamedBufferRangeEXT)
+#define glad_glNamedBufferStorageEXT (glad_gl_current->glad_glNamedBufferStorageEXT)
+#define glad_glClearNamedBufferDataEXT (glad_gl_current->glad_glClearNamedBufferDataEXT)
+#define glad_glClearNamedBufferSubDataEXT (glad_gl_current->glad_glClearNamedBufferSubDataEXT)
+#define glad_glNamedFramebufferParameteriEXT (glad_gl_current->glad_glNamedFramebufferParameteriEXT)
+#define glad_glGetNamedFramebufferParameterivEXT (glad_gl_current->glad_glGetNamedFramebufferParameterivEXT)
+#define glad_glProgramUniform1dEXT (glad_gl_current->glad_glProgramUniform1dEXT)
+#define glad_glProgramUniform2dEXT (glad_gl_current->glad_glProgramUniform2dEXT)
+#define glad_glProgramUniform3dEXT (glad_gl_current->glad_glProgramUniform3dEXT)
+#define glad_glProgramUniform4dEXT (glad_gl_current->glad_glProgramUniform4dEXT)
+#define glad_glProgramUniform1dvEXT (glad_gl_current->glad_glProgramUniform1dvEXT)
+#define glad_glProgramUniform2dvEXT (glad_gl_current->glad_glProgramUniform2dvEXT)
+#define glad_glProgramUniform3dvEXT (glad_gl_current->glad_glProgramUniform3dvEXT)
+#define glad_glProgramUniform4dvEXT (glad_gl_current->glad_glProgramUniform4dvEXT)
+#define glad_glProgramUniformMatrix2dvEXT (glad_gl_current->glad_glProgramUniformMatrix2dvEXT)
+#define glad_glProgramUniformMatrix3dvEXT (glad_gl_current->glad_glProgramUniformMatrix3dvEXT)
+#define glad_glProgramUniformMatrix4dvEXT (glad_gl_current->glad_glProgramUniformMatrix4dvEXT)
+#define glad_glProgramUniformMatrix2x3dvEXT (glad_gl_current->glad_glProgramUniformMatrix2x3dvEXT)
+#define glad_glProgramUniformMatrix2x4dvEXT (glad_gl_current->glad_glProgramUniformMatrix2x4dvEXT)
+#define glad_glProgramUniformMatrix3x2dvEXT (glad_gl_current->glad_glProgramUniformMatrix3x2dvEXT)
+#define glad_glProgramUniformMatrix3x4dvEXT (glad_gl_current->glad_glProgramUniformMatrix3x4dvEXT)
+#define glad_glProgramUniformMatrix4x2dvEXT (glad_gl_current->glad_glProgramUniformMatrix4x2dvEXT)
+#define glad_glProgramUniformMatrix4x3dvEXT (glad_gl_current->glad_glProgramUniformMatrix4x3dvEXT)
+#define glad_glTextureBufferRangeEXT (glad_gl_current->glad_glTextureBufferRangeEXT)
+#define glad_glTextureStorage1DEXT (glad_gl_current->glad_glTextureStorage1DEXT)
+#define glad_glTextureStorage2DEXT (glad_gl_current->glad_glTextureStorage2DEXT)
+#define glad_glTextureStorage3DEXT (glad_gl_current->glad_glTextureStorage3DEXT)
+#define glad_glTextureStorage2DMultisampleEXT (glad_gl_current->glad_glTextureStorage2DMultisampleEXT)
+#define glad_glTextureStorage3DMultisampleEXT (glad_gl_current->glad_glTextureStorage3DMultisampleEXT)
+#define glad_glVertexArrayBindVertexBufferEXT (glad_gl_current->glad_glVertexArrayBindVertexBufferEXT)
+#define glad_glVertexArrayVertexAttribFormatEXT (glad_gl_current->glad_glVertexArrayVertexAttribFormatEXT)
+#define glad_glVertexArrayVertexAttribIFormatEXT (glad_gl_current->glad_glVertexArrayVertexAttribIFormatEXT)
+#define glad_glVertexArrayVertexAttribLFormatEXT (glad_gl_current->glad_glVertexArrayVertexAttribLFormatEXT)
+#define glad_glVertexArrayVertexAttribBindingEXT (glad_gl_current->glad_glVertexArrayVertexAttribBindingEXT)
+#define glad_glVertexArrayVertexBindingDivisorEXT (glad_gl_current->glad_glVertexArrayVertexBindingDivisorEXT)
+#define glad_glVertexArrayVertexAttribLOffsetEXT (glad_gl_current->glad_glVertexArrayVertexAttribLOffsetEXT)
+#define glad_glTexturePageCommitmentEXT (glad_gl_current->glad_glTexturePageCommitmentEXT)
+#define glad_glVertexArrayVertexAttribDivisorEXT (glad_gl_current->glad_glVertexArrayVertexAttribDivisorEXT)
+#define glad_glColorMaskIndexedEXT (glad_gl_current->glad_glColorMaskIndexedEXT)
+#define glad_glDrawArraysInstancedEXT (glad_gl_current->glad_glDrawArraysInstancedEXT)
+#define glad_glDrawElementsInstancedEXT (glad_gl_current->glad_glDrawElementsInstancedEXT)
+#define glad_glDrawRangeElementsEXT (glad_gl_current->glad_glDrawRangeElementsEXT)
+#define glad_glBufferStorageExternalEXT (glad_gl_current->glad_glBufferStorageExternalEXT)
+#define glad_glNamedBufferStorageExternalEXT (glad_gl_current->glad_glNamedBufferStorageExternalEXT)
+#define glad_glFogCoordfEXT (glad_gl_current->glad_glFogCoordfEXT)
+#define glad_glFogCoordfvEXT (glad_gl_current->glad_glFogCoordfvEXT)
+#define glad_glFogCoorddEXT (glad_gl_current->glad_glFogCoorddEXT)
+#define glad_glFogCoorddvEXT (glad_gl_current->glad_glFogCoorddvEXT)
+#define glad_glFogCoordPointerEXT (glad_gl_current->glad_glFogCoordPointerEXT)
+#define glad_glBlitFramebufferEXT (glad_gl_current->glad_glBlitFramebufferEXT)
+#define glad_glBlitFramebufferLayersEXT (glad_gl_current->glad_glBlitFramebufferLayersEXT)
+#define glad_glBlitFramebufferLayerEXT (glad_gl_current->glad_glBlitFramebufferLayerEXT)
+#define glad_glRenderbufferStorageMultisampleEXT (glad_gl_current->glad_glRenderbufferStorageMultisampleEXT)
+#define glad_glIsRenderbufferEXT (glad_gl_current->glad_glIsRenderbufferEXT)
+#define glad_glBindRenderbufferEXT (glad_gl_current->glad_glBindRenderbufferEXT)
+#define glad_glDeleteRenderbuffersEXT (glad_gl_current->glad_glDeleteRenderbuffersEXT)
+#define glad_glGenRenderbuffersEXT (glad_gl_current->glad_glGenRenderbuffersEXT)
+#define glad_glRenderbufferStorageEXT (glad_gl_current->glad_glRenderbufferStorageEXT)
+#define glad_glGetRenderbufferParameterivEXT (glad_gl_current->glad_glGetRenderbufferParameterivEXT)
+#define glad_glIsFramebufferEXT (glad_gl_current->glad_glIsFramebufferEXT)
+#define glad_glBindFramebufferEXT (glad_gl_current->glad_glBindFramebufferEXT)
+#define glad_glDeleteFramebuffersEXT (glad_gl_current->glad_glDeleteFramebuffersEXT)
+#define glad_glGenFramebuffersEXT (glad_gl_current->glad_glGenFramebuffersEXT)
+#define glad_glCheckFramebufferStatusEXT (glad_gl_current->glad_glCheckFramebufferStatusEXT)
+#define glad_glFramebufferTexture1DEXT (glad_gl_current->glad_glFramebufferTexture1DEXT)
+#define glad_glFramebufferTexture2DEXT (glad_gl_current->glad_glFramebufferTexture2DEXT)
+#define glad_glFramebufferTexture3DEXT (glad_gl_current->glad_glFramebufferTexture3DEXT)
+#define glad_glFramebufferRenderbufferEXT (glad_gl_current->glad_glFramebufferRenderbufferEXT)
+#define glad_glGetFramebufferAttachmentParameterivEXT (glad_gl_current->glad_glGetFramebufferAttachmentParameterivEXT)
+#define glad_glGenerateMipmapEXT (glad_gl_current->glad_glGenerateMipmapEXT)
+#define glad_glProgramParameteriEXT (glad_gl_current->glad_glProgramParameteriEXT)
+#define glad_glProgramEnvParameters4fvEXT (glad_gl_current->glad_glProgramEnvParameters4fvEXT)
+#define glad_glProgramLocalParameters4fvEXT (glad_gl_current->glad_glProgramLocalParameters4fvEXT)
+#define glad_glGetUniformuivEXT (glad_gl_current->glad_glGetUniformuivEXT)
+#define glad_glBindFragDataLocationEXT (glad_gl_current->glad_glBindFragDataLocationEXT)
+#define glad_glGetFragDataLocationEXT (glad_gl_current->glad_glGetFragDataLocationEXT)
+#define glad_glUniform1uiEXT (glad_gl_current->glad_glUniform1uiEXT)
+#define glad_glUniform2uiEXT (glad_gl_current->glad_glUniform2uiEXT)
+#define glad_glUniform3uiEXT (glad_gl_current->glad_glUniform3uiEXT)
+#define glad_glUniform4uiEXT (glad_gl_current->glad_glUniform4uiEXT)
+#define glad_glUniform1uivEXT (glad_gl_current->glad_glUniform1uivEXT)
+#define glad_glUniform2uivEXT (glad_gl_current->glad_glUniform2uivEXT)
+#define glad_glUniform3uivEXT (glad_gl_current->glad_glUniform3uivEXT)
+#define glad_glUniform4uivEXT (glad_gl_current->glad_glUniform4uivEXT)
+#define glad_glVertexAttribI1iEXT (glad_gl_current->glad_glVertexAttribI1iEXT)
+#define glad_glVertexAttribI2iEXT (glad_gl_current->glad_glVertexAttribI2iEXT)
+#define glad_glVertexAttribI3iEXT (glad_gl_current->glad_glVertexAttribI3iEXT)
+#define glad_glVertexAttribI4iEXT (glad_gl_current->glad_glVertexAttribI4iEXT)
+#define glad_glVertexAttribI1uiEXT (glad_gl_current->glad_glVertexAttribI1uiEXT)
+#define glad_glVertexAttribI2uiEXT (glad_gl_current->glad_glVertexAttribI2uiEXT)
+#define glad_glVertexAttribI3uiEXT (glad_gl_current->glad_glVertexAttribI3uiEXT)
+#define glad_glVertexAttribI4uiEXT (glad_gl_current->glad_glVertexAttribI4uiEXT)
+#define glad_glVertexAttribI1ivEXT (glad_gl_current->glad_glVertexAttribI1ivEXT)
+#define glad_glVertexAttribI2ivEXT (glad_gl_current->glad_glVertexAttribI2ivEXT)
+#define glad_glVertexAttribI3ivEXT (glad_gl_current->glad_glVertexAttribI3ivEXT)
+#define glad_glVertexAttribI4ivEXT (glad_gl_current->glad_glVertexAttribI4ivEXT)
+#define glad_glVertexAttribI1uivEXT (glad_gl_current->glad_glVertexAttribI1uivEXT)
+#define glad_glVertexAttribI2uivEXT (glad_gl_current->glad_glVertexAttribI2uivEXT)
+#define glad_glVertexAttribI3uivEXT (glad_gl_current->glad_glVertexAttribI3uivEXT)
+#define glad_glVertexAttribI4uivEXT (glad_gl_current->glad_glVertexAttribI4uivEXT)
+#define glad_glVertexAttribI4bvEXT (glad_gl_current->glad_glVertexAttribI4bvEXT)
+#define glad_glVertexAttribI4svEXT (glad_gl_current->glad_glVertexAttribI4svEXT)
+#define glad_glVertexAttribI4ubvEXT (glad_gl_current->glad_glVertexAttribI4ubvEXT)
+#define glad_glVertexAttribI4usvEXT (glad_gl_current->glad_glVertexAttribI4usvEXT)
+#define glad_glVertexAttribIPointerEXT (glad_gl_current->glad_glVertexAttribIPointerEXT)
+#define glad_glGetVertexAttribIivEXT (glad_gl_current->glad_glGetVertexAttribIivEXT)
+#define glad_glGetVertexAttribIuivEXT (glad_gl_current->glad_glGetVertexAttribIuivEXT)
+#define glad_glGetHistogramEXT (glad_gl_current->glad_glGetHistogramEXT)
+#define glad_glGetHistogramParameterfvEXT (glad_gl_current->glad_glGetHistogramParameterfvEXT)
+#define glad_glGetHistogramParameterivEXT (glad_gl_current->glad_glGetHistogramParameterivEXT)
+#define glad_glGetMinmaxEXT (glad_gl_current->glad_glGetMinmaxEXT)
+#define glad_glGetMinmaxParameterfvEXT (glad_gl_current->glad_glGetMinmaxParameterfvEXT)
+#define glad_glGetMinmaxParameterivEXT (glad_gl_current->glad_glGetMinmaxParameterivEXT)
+#define glad_glHistogramEXT (glad_gl_current->glad_glHistogramEXT)
+#define glad_glMinmaxEXT (glad_gl_current->glad_glMinmaxEXT)
+#define glad_glResetHistogramEXT (glad_gl_current->glad_glResetHistogramEXT)
+#define glad_glResetMinmaxEXT (glad_gl_current->glad_glResetMinmaxEXT)
+#define glad_glIndexFuncEXT (glad_gl_current->glad_glIndexFuncEXT)
+#define glad_glIndexMaterialEXT (glad_gl_current->glad_glIndexMaterialEXT)
+#define glad_glApplyTextureEXT (glad_gl_current->glad_glApplyTextureEXT)
+#define glad_glTextureLightEXT (glad_gl_current->glad_glTextureLightEXT)
+#define glad_glTextureMaterialEXT (glad_gl_current->glad_glTextureMaterialEXT)
+#define glad_glGetUnsignedBytevEXT (glad_gl_current->glad_glGetUnsignedBytevEXT)
+#define glad_glGetUnsignedBytei_vEXT (glad_gl_current->glad_glGetUnsignedBytei_vEXT)
+#define glad_glDeleteMemoryObjectsEXT (glad_gl_current->glad_glDeleteMemoryObjectsEXT)
+#define glad_glIsMemoryObjectEXT (glad_gl_current->glad_glIsMemoryObjectEXT)
+#define glad_glCreateMemoryObjectsEXT (glad_gl_current->glad_glCreateMemoryObjectsEXT)
+#define glad_glMemoryObjectParameterivEXT (glad_gl_current->glad_glMemoryObjectParameterivEXT)
+#define glad_glGetMemoryObjectParameterivEXT (glad_gl_current->glad_glGetMemoryObjectParameterivEXT)
+#define glad_glTexStorageMem2DEXT (glad_gl_current->glad_glTexStorageMem2DEXT)
+#define glad_glTexStorageMem2DMultisampleEXT (glad_gl_current->glad_glTexStorageMem2DMultisampleEXT)
+#define glad_glTexStorageMem3DEXT (glad_gl_current->glad_glTexStorageMem3DEXT)
+#define glad_glTexStorageMem3DMultisampleEXT (glad_gl_current->glad_glTexStorageMem3DMultisampleEXT)
+#define glad_glBufferStorageMemEXT (glad_gl_current->glad_glBufferStorageMemEXT)
+#define glad_glTextureStorageMem2DEXT (glad_gl_current->glad_glTextureStorageMem2DEXT)
+#define glad_glTextureStorageMem2DMultisampleEXT (glad_gl_current->glad_glTextureStorageMem2DMultisampleEXT)
+#define glad_glTextureStorageMem3DEXT (glad_gl_current->glad_glTextureStorageMem3DEXT)
+#define glad_glTextureStorageMem3DMultisampleEXT (glad_gl_current->glad_glTextureStorageMem3DMultisampleEXT)
+#define glad_glNamedBufferStorageMemEXT (glad_gl_current->glad_glNamedBufferStorageMemEXT)
+#define glad_glTexStorageMem1DEXT (glad_gl_current->glad_glTexStorageMem1DEXT)
+#define glad_glTextureStorageMem1DEXT (glad_gl_current->glad_glTextureStorageMem1DEXT)
+#define glad_glImportMemoryFdEXT (glad_gl_current->glad_glImportMemoryFdEXT)
+#define glad_glImportMemoryWin32HandleEXT (glad_gl_current->glad_glImportMemoryWin32HandleEXT)
+#define glad_glImportMemoryWin32NameEXT (glad_gl_current->glad_glImportMemoryWin32NameEXT)
+#define glad_glMultiDrawArraysEXT (glad_gl_current->glad_glMultiDrawArraysEXT)
+#define glad_glMultiDrawElementsEXT (glad_gl_current->glad_glMultiDrawElementsEXT)
+#define glad_glSampleMaskEXT (glad_gl_current->glad_glSampleMaskEXT)
+#define glad_glSamplePatternEXT (glad_gl_current->glad_glSamplePatternEXT)
+#define glad_glColorTableEXT (glad_gl_current->glad_glColorTableEXT)
+#define glad_glGetColorTableEXT (glad_gl_current->glad_glGetColorTableEXT)
+#define glad_glGetColorTableParameterivEXT (glad_gl_current->glad_glGetColorTableParameterivEXT)
+#define glad_glGetColorTableParameterfvEXT (glad_gl_current->glad_glGetColorTableParameterfvEXT)
+#define glad_glPixelTransformParameteriEXT (glad_gl_current->glad_glPixelTransformParameteriEXT)
+#define glad_glPixelTransformParameterfEXT (glad_gl_current->glad_glPixelTransformParameterfEXT)
+#define glad_glPixelTransformParameterivEXT (glad_gl_current->glad_glPixelTransformParameterivEXT)
+#define glad_glPixelTransformParameterfvEXT (glad_gl_current->glad_glPixelTransformParameterfvEXT)
+#define glad_glGetPixelTransformParameterivEXT (glad_gl_current->glad_glGetPixelTransformParameterivEXT)
+#define glad_glGetPixelTransformParameterfvEXT (glad_gl_current->glad_glGetPixelTransformParameterfvEXT)
+#define glad_glPointParameterfEXT (glad_gl_current->glad_glPointParameterfEXT)
+#define glad_glPointParameterfvEXT (glad_gl_current->glad_glPointParameterfvEXT)
+#define glad_glPolygonOffsetEXT (glad_gl_current->glad_glPolygonOffsetEXT)
+#define glad_glPolygonOffsetClampEXT (glad_gl_current->glad_glPolygonOffsetClampEXT)
+#define glad_glProvokingVertexEXT (glad_gl_current->glad_glProvokingVertexEXT)
+#define glad_glRasterSamplesEXT (glad_gl_current->glad_glRasterSamplesEXT)
+#define glad_glSecondaryColor3bEXT (glad_gl_current->glad_glSecondaryColor3bEXT)
+#define glad_glSecondaryColor3bvEXT (glad_gl_current->glad_glSecondaryColor3bvEXT)
+#define glad_glSecondaryColor3dEXT (glad_gl_current->glad_glSecondaryColor3dEXT)
+#define glad_glSecondaryColor3dvEXT (glad_gl_current->glad_glSecondaryColor3dvEXT)
+#define glad_glSecondaryColor3fEXT (glad_gl_current->glad_glSecondaryColor3fEXT)
+#define glad_glSecondaryColor3fvEXT (glad_gl_current->glad_glSecondaryColor3fvEXT)
+#define glad_glSecondaryColor3iEXT (glad_gl_current->glad_glSecondaryColor3iEXT)
+#define glad_glSecondaryColor3ivEXT (glad_gl_current->glad_glSecondaryColor3ivEXT)
+#define glad_glSecondaryColor3sEXT (glad_gl_current->glad_glSecondaryColor3sEXT)
+#define glad_glSecondaryColor3svEXT (glad_gl_current->glad_glSecondaryColor3svEXT)
+#define glad_glSecondaryColor3ubEXT (glad_gl_current->glad_glSecondaryColor3ubEXT)
+#define glad_glSecondaryColor3ubvEXT (glad_gl_current->glad_glSecondaryColor3ubvEXT)
+#define glad_glSecondaryColor3uiEXT (glad_gl_current->glad_glSecondaryColor3uiEXT)
+#define glad_glSecondaryColor3uivEXT (glad_gl_current->glad_glSecondaryColor3uivEXT)
+#define glad_glSecondaryColor3usEXT (glad_gl_current->glad_glSecondaryColor3usEXT)
+#define glad_glSecondaryColor3usvEXT (glad_gl_current->glad_glSecondaryColor3usvEXT)
+#define glad_glSecondaryColorPointerEXT (glad_gl_current->glad_glSecondaryColorPointerEXT)
+#define glad_glGenSemaphoresEXT (glad_gl_current->glad_glGenSemaphoresEXT)
+#define glad_glDeleteSemaphoresEXT (glad_gl_current->glad_glDeleteSemaphoresEXT)
+#define glad_glIsSemaphoreEXT (glad_gl_current->glad_glIsSemaphoreEXT)
+#define glad_glSemaphoreParameterui64vEXT (glad_gl_current->glad_glSemaphoreParameterui64vEXT)
+#define glad_glGetSemaphoreParameterui64vEXT (glad_gl_current->glad_glGetSemaphoreParameterui64vEXT)
+#define glad_glWaitSemaphoreEXT (glad_gl_current->glad_glWaitSemaphoreEXT)
+#define glad_glSignalSemaphoreEXT (glad_gl_current->glad_glSignalSemaphoreEXT)
+#define glad_glImportSemaphoreFdEXT (glad_gl_current->glad_glImportSemaphoreFdEXT)
+#define glad_glImportSemaphoreWin32HandleEXT (glad_gl_current->glad_glImportSemaphoreWin32HandleEXT)
+#define glad_glImportSemaphoreWin32NameEXT (glad_gl_current->glad_glImportSemaphoreWin32NameEXT)
+#define glad_glUseShaderProgramEXT (glad_gl_current->glad_glUseShaderProgramEXT)
+#define glad_glActiveProgramEXT (glad_gl_current->glad_glActiveProgramEXT)
+#define glad_glCreateShaderProgramEXT (glad_gl_current->glad_glCreateShaderProgramEXT)
+#define glad_glActiveShaderProgramEXT (glad_gl_current->glad_glActiveShaderProgramEXT)
+#define glad_glBindProgramPipelineEXT (glad_gl_current->glad_glBindProgramPipelineEXT)
+#define glad_glCreateShaderProgramvEXT (glad_gl_current->glad_glCreateShaderProgramvEXT)
+#define glad_glDeleteProgramPipelinesEXT (glad_gl_current->glad_glDeleteProgramPipelinesEXT)
+#define glad_glGenProgramPipelinesEXT (glad_gl_current->glad_glGenProgramPipelinesEXT)
+#define glad_glGetProgramPipelineInfoLogEXT (glad_gl_current->glad_glGetProgramPipelineInfoLogEXT)
+#define glad_glGetProgramPipelineivEXT (glad_gl_current->glad_glGetProgramPipelineivEXT)
+#define glad_glIsProgramPipelineEXT (glad_gl_current->glad_glIsProgramPipelineEXT)
+#define glad_glUseProgramStagesEXT (glad_gl_current->glad_glUseProgramStagesEXT)
+#define glad_glValidateProgramPipelineEXT (glad_gl_current->glad_glValidateProgramPipelineEXT)
+#define glad_glFramebufferFetchBarrierEXT (glad_gl_current->glad_glFramebufferFetchBarrierEXT)
+#define glad_glBindImageTextureEXT (glad_gl_current->glad_glBindImageTextureEXT)
+#define glad_glMemoryBarrierEXT (glad_gl_current->glad_glMemoryBarrierEXT)
+#define glad_glStencilClearTagEXT (glad_gl_current->glad_glStencilClearTagEXT)
+#define glad_glActiveStencilFaceEXT (glad_gl_current->glad_glActiveStencilFaceEXT)
+#define glad_glTexSubImage1DEXT (glad_gl_current->glad_glTexSubImage1DEXT)
+#define glad_glTexSubImage2DEXT (glad_gl_current->glad_glTexSubImage2DEXT)
+#define glad_glTexImage3DEXT (glad_gl_current->glad_glTexImage3DEXT)
+#define glad_glTexSubImage3DEXT (glad_gl_current->glad_glTexSubImage3DEXT)
+#define glad_glFramebufferTextureLayerEXT (glad_gl_current->glad_glFramebufferTextureLayerEXT)
+#define glad_glTexBufferEXT (glad_gl_current->glad_glTexBufferEXT)
+#define glad_glTexParameterIivEXT (glad_gl_current->glad_glTexParameterIivEXT)
+#define glad_glTexParameterIuivEXT (glad_gl_current->glad_glTexParameterIuivEXT)
+#define glad_glGetTexParameterIivEXT (glad_gl_current->glad_glGetTexParameterIivEXT)
+#define glad_glGetTexParameterIuivEXT (glad_gl_current->glad_glGetTexParameterIuivEXT)
+#define glad_glClearColorIiEXT (glad_gl_current->glad_glClearColorIiEXT)
+#define glad_glClearColorIuiEXT (glad_gl_current->glad_glClearColorIuiEXT)
+#define glad_glAreTexturesResidentEXT (glad_gl_current->glad_glAreTexturesResidentEXT)
+#define glad_glBindTextureEXT (glad_gl_current->glad_glBindTextureEXT)
+#define glad_glDeleteTexturesEXT (glad_gl_current->glad_glDeleteTexturesEXT)
+#define glad_glGenTexturesEXT (glad_gl_current->glad_glGenTexturesEXT)
+#define glad_glIsTextureEXT (glad_gl_current->glad_glIsTextureEXT)
+#define glad_glPrioritizeTexturesEXT (glad_gl_current->glad_glPrioritizeTexturesEXT)
+#define glad_glTextureNormalEXT (glad_gl_current->glad_glTextureNormalEXT)
+#define glad_glTexStorage1DEXT (glad_gl_current->glad_glTexStorage1DEXT)
+#define glad_glTexStorage2DEXT (glad_gl_current->glad_glTexStorage2DEXT)
+#define glad_glTexStorage3DEXT (glad_gl_current->glad_glTexStorage3DEXT)
+#define glad_glGetQueryObjecti64vEXT (glad_gl_current->glad_glGetQueryObjecti64vEXT)
+#define glad_glGetQueryObjectui64vEXT (glad_gl_current->glad_glGetQueryObjectui64vEXT)
+#define glad_glBeginTransformFeedbackEXT (glad_gl_current->glad_glBeginTransformFeedbackEXT)
+#define glad_glEndTransformFeedbackEXT (glad_gl_current->glad_glEndTransformFeedbackEXT)
+#define glad_glBindBufferRangeEXT (glad_gl_current->glad_glBindBufferRangeEXT)
+#define glad_glBindBufferOffsetEXT (glad_gl_current->glad_glBindBufferOffsetEXT)
+#define glad_glBindBufferBaseEXT (glad_gl_current->glad_glBindBufferBaseEXT)
+#define glad_glTransformFeedbackVaryingsEXT (glad_gl_current->glad_glTransformFeedbackVaryingsEXT)
+#define glad_glGetTransformFeedbackVaryingEXT (glad_gl_current->glad_glGetTransformFeedbackVaryingEXT)
+#define glad_glArrayElementEXT (glad_gl_current->glad_glArrayElementEXT)
+#define glad_glColorPointerEXT (glad_gl_current->glad_glColorPointerEXT)
+#define glad_glDrawArraysEXT (glad_gl_current->glad_glDrawArraysEXT)
+#define glad_glEdgeFlagPointerEXT (glad_gl_current->glad_glEdgeFlagPointerEXT)
+#define glad_glGetPointervEXT (glad_gl_current->glad_glGetPointervEXT)
+#define glad_glIndexPointerEXT (glad_gl_current->glad_glIndexPointerEXT)
+#define glad_glNormalPointerEXT (glad_gl_current->glad_glNormalPointerEXT)
+#define glad_glTexCoordPointerEXT (glad_gl_current->glad_glTexCoordPointerEXT)
+#define glad_glVertexPointerEXT (glad_gl_current->glad_glVertexPointerEXT)
+#define glad_glVertexAttribL1dEXT (glad_gl_current->glad_glVertexAttribL1dEXT)
+#define glad_glVertexAttribL2dEXT (glad_gl_current->glad_glVertexAttribL2dEXT)
+#define glad_glVertexAttribL3dEXT (glad_gl_current->glad_glVertexAttribL3dEXT)
+#define glad_glVertexAttribL4dEXT (glad_gl_current->glad_glVertexAttribL4dEXT)
+#define glad_glVertexAttribL1dvEXT (glad_gl_current->glad_glVertexAttribL1dvEXT)
+#define glad_glVertexAttribL2dvEXT (glad_gl_current->glad_glVertexAttribL2dvEXT)
+#define glad_glVertexAttribL3dvEXT (glad_gl_current->glad_glVertexAttribL3dvEXT)
+#define glad_glVertexAttribL4dvEXT (glad_gl_current->glad_glVertexAttribL4dvEXT)
+#define glad_glVertexAttribLPointerEXT (glad_gl_current->glad_glVertexAttribLPointerEXT)
+#define glad_glGetVertexAttribLdvEXT (glad_gl_current->glad_glGetVertexAttribLdvEXT)
+#define glad_glBeginVertexShaderEXT (glad_gl_current->glad_glBeginVertexShaderEXT)
+#define glad_glEndVertexShaderEXT (glad_gl_current->glad_glEndVertexShaderEXT)
+#define glad_glBindVertexShaderEXT (glad_gl_current->glad_glBindVertexShaderEXT)
+#define glad_glGenVertexShadersEXT (glad_gl_current->glad_glGenVertexShadersEXT)
+#define glad_glDeleteVertexShaderEXT (glad_gl_current->glad_glDeleteVertexShaderEXT)
+#define glad_glShaderOp1EXT (glad_gl_current->glad_glShaderOp1EXT)
+#define glad_glShaderOp2EXT (glad_gl_current->glad_glShaderOp2EXT)
+#define glad_glShaderOp3EXT (glad_gl_current->glad_glShaderOp3EXT)
+#define glad_glSwizzleEXT (glad_gl_current->glad_glSwizzleEXT)
+#define glad_glWriteMaskEXT (glad_gl_current->glad_glWriteMaskEXT)
+#define glad_glInsertComponentEXT (glad_gl_current->glad_glInsertComponentEXT)
+#define glad_glExtractComponentEXT (glad_gl_current->glad_glExtractComponentEXT)
+#define glad_glGenSymbolsEXT (glad_gl_current->glad_glGenSymbolsEXT)
+#define glad_glSetInvariantEXT (glad_gl_current->glad_glSetInvariantEXT)
+#define glad_glSetLocalConstantEXT (glad_gl_current->glad_glSetLocalConstantEXT)
+#define glad_glVariantbvEXT (glad_gl_current->glad_glVariantbvEXT)
+#define glad_glVariantsvEXT (glad_gl_current->glad_glVariantsvEXT)
+#define glad_glVariantivEXT (glad_gl_current->glad_glVariantivEXT)
+#define glad_glVariantfvEXT (glad_gl_current->glad_glVariantfvEXT)
+#define glad_glVariantdvEXT (glad_gl_current->glad_glVariantdvEXT)
+#define glad_glVariantubvEXT (glad_gl_current->glad_glVariantubvEXT)
+#define glad_glVariantusvEXT (glad_gl_current->glad_glVariantusvEXT)
+#define glad_glVariantuivEXT (glad_gl_current->glad_glVariantuivEXT)
+#define glad_glVariantPointerEXT (glad_gl_current->glad_glVariantPointerEXT)
+#define glad_glEnableVariantClientStateEXT (glad_gl_current->glad_glEnableVariantClientStateEXT)
+#define glad_glDisableVariantClientStateEXT (glad_gl_current->glad_glDisableVariantClientStateEXT)
+#define glad_glBindLightParameterEXT (glad_gl_current->glad_glBindLightParameterEXT)
+#define glad_glBindMaterialParameterEXT (glad_gl_current->glad_glBindMaterialParameterEXT)
+#define glad_glBindTexGenParameterEXT (glad_gl_current->glad_glBindTexGenParameterEXT)
+#define glad_glBindTextureUnitParameterEXT (glad_gl_current->glad_glBindTextureUnitParameterEXT)
+#define glad_glBindParameterEXT (glad_gl_current->glad_glBindParameterEXT)
+#define glad_glIsVariantEnabledEXT (glad_gl_current->glad_glIsVariantEnabledEXT)
+#define glad_glGetVariantBooleanvEXT (glad_gl_current->glad_glGetVariantBooleanvEXT)
+#define glad_glGetVariantIntegervEXT (glad_gl_current->glad_glGetVariantIntegervEXT)
+#define glad_glGetVariantFloatvEXT (glad_gl_current->glad_glGetVariantFloatvEXT)
+#define glad_glGetVariantPointervEXT (glad_gl_current->glad_glGetVariantPointervEXT)
+#define glad_glGetInvariantBooleanvEXT (glad_gl_current->glad_glGetInvariantBooleanvEXT)
+#define glad_glGetInvariantIntegervEXT (glad_gl_current->glad_glGetInvariantIntegervEXT)
+#define glad_glGetInvariantFloatvEXT (glad_gl_current->glad_glGetInvariantFloatvEXT)
+#define glad_glGetLocalConstantBooleanvEXT (glad_gl_current->glad_glGetLocalConstantBooleanvEXT)
+#define glad_glGetLocalConstantIntegervEXT (glad_gl_current->glad_glGetLocalConstantIntegervEXT)
+#define glad_glGetLocalConstantFloatvEXT (glad_gl_current->glad_glGetLocalConstantFloatvEXT)
+#define glad_glVertexWeightfEXT (glad_gl_current->glad_glVertexWeightfEXT)
+#define glad_glVertexWeightfvEXT (glad_gl_current->glad_glVertexWeightfvEXT)
+#define glad_glVertexWeightPointerEXT (glad_gl_current->glad_glVertexWeightPointerEXT)
+#define glad_glAcquireKeyedMutexWin32EXT (glad_gl_current->glad_glAcquireKeyedMutexWin32EXT)
+#define glad_glReleaseKeyedMutexWin32EXT (glad_gl_current->glad_glReleaseKeyedMutexWin32EXT)
+#define glad_glWindowRectanglesEXT (glad_gl_current->glad_glWindowRectanglesEXT)
+#define glad_glImportSyncEXT (glad_gl_current->glad_glImportSyncEXT)
+#define glad_glFrameTerminatorGREMEDY (glad_gl_current->glad_glFrameTerminatorGREMEDY)
+#define glad_glStringMarkerGREMEDY (glad_gl_current->glad_glStringMarkerGREMEDY)
+#define glad_glImageTransformParameteriHP (glad_gl_current->glad_glImageTransformParameteriHP)
+#define glad_glImageTransformParameterfHP (glad_gl_current->glad_glImageTransformParameterfHP)
+#define glad_glImageTransformParameterivHP (glad_gl_current->glad_glImageTransformParameterivHP)
+#define glad_glImageTransformParameterfvHP (glad_gl_current->glad_glImageTransformParameterfvHP)
+#define glad_glGetImageTransformParameterivHP (glad_gl_current->glad_glGetImageTransformParameterivHP)
+#define glad_glGetImageTransformParameterfvHP (glad_gl_current->glad_glGetImageTransformParameterfvHP)
+#define glad_glMultiModeDrawArraysIBM (glad_gl_current->glad_glMultiModeDrawArraysIBM)
+#define glad_glMultiModeDrawElementsIBM (glad_gl_current->glad_glMultiModeDrawElementsIBM)
+#define glad_glFlushStaticDataIBM (glad_gl_current->glad_glFlushStaticDataIBM)
+#define glad_glColorPointerListIBM (glad_gl_current->glad_glColorPointerListIBM)
+#define glad_glSecondaryColorPointerListIBM (glad_gl_current->glad_glSecondaryColorPointerListIBM)
+#define glad_glEdgeFlagPointerListIBM (glad_gl_current->glad_glEdgeFlagPointerListIBM)
+#define glad_glFogCoordPointerListIBM (glad_gl_current->glad_glFogCoordPointerListIBM)
+#define glad_glIndexPointerListIBM (glad_gl_current->glad_glIndexPointerListIBM)
+#define glad_glNormalPointerListIBM (glad_gl_current->glad_glNormalPointerListIBM)
+#define glad_glTexCoordPointerListIBM (glad_gl_current->glad_glTexCoordPointerListIBM)
+#define glad_glVertexPointerListIBM (glad_gl_current->glad_glVertexPointerListIBM)
+#define glad_glBlendFuncSeparateINGR (glad_gl_current->glad_glBlendFuncSeparateINGR)
+#define glad_glApplyFramebufferAttachmentCMAAINTEL (glad_gl_current->glad_glApplyFramebufferAttachmentCMAAINTEL)
+#define glad_glSyncTextureINTEL (glad_gl_current->glad_glSyncTextureINTEL)
+#define glad_glUnmapTexture2DINTEL (glad_gl_current->glad_glUnmapTexture2DINTEL)
+#define glad_glMapTexture2DINTEL (glad_gl_current->glad_glMapTexture2DINTEL)
+#define glad_glVertexPointervINTEL (glad_gl_current->glad_glVertexPointervINTEL)
+#define glad_glNormalPointervINTEL (glad_gl_current->glad_glNormalPointervINTEL)
+#define glad_glColorPointervINTEL (glad_gl_current->glad_glColorPointervINTEL)
+#define glad_glTexCoordPointervINTEL (glad_gl_current->glad_glTexCoordPointervINTEL)
+#define glad_glBeginPerfQueryINTEL (glad_gl_current->glad_glBeginPerfQueryINTEL)
+#define glad_glCreatePerfQueryINTEL (glad_gl_current->glad_glCreatePerfQueryINTEL)
+#define glad_glDeletePerfQueryINTEL (glad_gl_current->glad_glDeletePerfQueryINTEL)
+#define glad_glEndPerfQueryINTEL (glad_gl_current->glad_glEndPerfQueryINTEL)
+#define glad_glGetFirstPerfQueryIdINTEL (glad_gl_current->glad_glGetFirstPerfQueryIdINTEL)
+#define glad_glGetNextPerfQueryIdINTEL (glad_gl_current->glad_glGetNextPerfQueryIdINTEL)
+#define glad_glGetPerfCounterInfoINTEL (glad_gl_current->glad_glGetPerfCounterInfoINTEL)
+#define glad_glGetPerfQueryDataINTEL (glad_gl_current->glad_glGetPerfQueryDataINTEL)
+#define glad_glGetPerfQueryIdByNameINTEL (glad_gl_current->glad_glGetPerfQueryIdByNameINTEL)
+#define glad_glGetPerfQueryInfoINTEL (glad_gl_current->glad_glGetPerfQueryInfoINTEL)
+#define glad_glBlendBarrierKHR (glad_gl_current->glad_glBlendBarrierKHR)
+#define glad_glDebugMessageControlKHR (glad_gl_current->glad_glDebugMessageControlKHR)
+#define glad_glDebugMessageInsertKHR (glad_gl_current->glad_glDebugMessageInsertKHR)
+#define glad_glDebugMessageCallbackKHR (glad_gl_current->glad_glDebugMessageCallbackKHR)
+#define glad_glGetDebugMessageLogKHR (glad_gl_current->glad_glGetDebugMessageLogKHR)
+#define glad_glPushDebugGroupKHR (glad_gl_current->glad_glPushDebugGroupKHR)
+#define glad_glPopDebugGroupKHR (glad_gl_current->glad_glPopDebugGroupKHR)
+#define glad_glObjectLabelKHR (glad_gl_current->glad_glObjectLabelKHR)
+#define glad_glGetObjectLabelKHR (glad_gl_current->glad_glGetObjectLabelKHR)
+#define glad_glObjectPtrLabelKHR (glad_gl_current->glad_glObjectPtrLabelKHR)
+#define glad_glGetObjectPtrLabelKHR (glad_gl_current->glad_glGetObjectPtrLabelKHR)
+#define glad_glGetPointervKHR (glad_gl_current->glad_glGetPointervKHR)
+#define glad_glMaxShaderCompilerThreadsKHR (glad_gl_current->glad_glMaxShaderCompilerThreadsKHR)
+#define glad_glGetGraphicsResetStatusKHR (glad_gl_current->glad_glGetGraphicsResetStatusKHR)
+#define glad_glReadnPixelsKHR (glad_gl_current->glad_glReadnPixelsKHR)
+#define glad_glGetnUniformfvKHR (glad_gl_current->glad_glGetnUniformfvKHR)
+#define glad_glGetnUniformivKHR (glad_gl_current->glad_glGetnUniformivKHR)
+#define glad_glGetnUniformuivKHR (glad_gl_current->glad_glGetnUniformuivKHR)
+#define glad_glFramebufferParameteriMESA (glad_gl_current->glad_glFramebufferParameteriMESA)
+#define glad_glGetFramebufferParameterivMESA (glad_gl_current->glad_glGetFramebufferParameterivMESA)
+#define glad_glResizeBuffersMESA (glad_gl_current->glad_glResizeBuffersMESA)
+#define glad_glWindowPos2dMESA (glad_gl_current->glad_glWindowPos2dMESA)
+#define glad_glWindowPos2dvMESA (glad_gl_current->glad_glWindowPos2dvMESA)
+#define glad_glWindowPos2fMESA (glad_gl_current->glad_glWindowPos2fMESA)
+#define glad_glWindowPos2fvMESA (glad_gl_current->glad_glWindowPos2fvMESA)
+#define glad_glWindowPos2iMESA (glad_gl_current->glad_glWindowPos2iMESA)
+#define glad_glWindowPos2ivMESA (glad_gl_current->glad_glWindowPos2ivMESA)
+#define glad_glWindowPos2sMESA (glad_gl_current->glad_glWindowPos2sMESA)
+#define glad_glWindowPos2svMESA (glad_gl_current->glad_glWindowPos2svMESA)
+#define glad_glWindowPos3dMESA (glad_gl_current->glad_glWindowPos3dMESA)
+#define glad_glWindowPos3dvMESA (glad_gl_current->glad_glWindowPos3dvMESA)
+#define glad_glWindowPos3fMESA (glad_gl_current->glad_glWindowPos3fMESA)
+#define glad_glWindowPos3fvMESA (glad_gl_current->glad_glWindowPos3fvMESA)
+#define glad_glWindowPos3iMESA (glad_gl_current->glad_glWindowPos3iMESA)
+#define glad_glWindowPos3ivMESA (glad_gl_current->glad_glWindowPos3ivMESA)
+#define glad_glWindowPos3sMESA (glad_gl_current->glad_glWindowPos3sMESA)
+#define glad_glWindowPos3svMESA (glad_gl_current->glad_glWindowPos3svMESA)
+#define glad_glWindowPos4dMESA (glad_gl_current->glad_glWindowPos4dMESA)
+#define glad_glWindowPos4dvMESA (glad_gl_current->glad_glWindowPos4dvMESA)
+#define glad_glWindowPos4fMESA (glad_gl_current->glad_glWindowPos4fMESA)
+#define glad_glWindowPos4fvMESA (glad_gl_current->glad_glWindowPos4fvMESA)
+#define glad_glWindowPos4iMESA (glad_gl_current->glad_glWindowPos4iMESA)
+#define glad_glWindowPos4ivMESA (glad_gl_current->glad_glWindowPos4ivMESA)
+#define glad_glWindowPos4sMESA (glad_gl_current->glad_glWindowPos4sMESA)
+#define glad_glWindowPos4svMESA (glad_gl_current->glad_glWindowPos4svMESA)
+#define glad_glBeginConditionalRenderNVX (glad_gl_current->glad_glBeginConditionalRenderNVX)
+#define glad_glEndConditionalRenderNVX (glad_gl_current->glad_glEndConditionalRenderNVX)
+#define glad_glUploadGpuMaskNVX (glad_gl_current->glad_glUploadGpuMaskNVX)
+#define glad_glMulticastViewportArrayvNVX (glad_gl_current->glad_glMulticastViewportArrayvNVX)
+#define glad_glMulticastViewportPositionWScaleNVX (glad_gl_current->glad_glMulticastViewportPositionWScaleNVX)
+#define glad_glMulticastScissorArrayvNVX (glad_gl_current->glad_glMulticastScissorArrayvNVX)
+#define glad_glAsyncCopyBufferSubDataNVX (glad_gl_current->glad_glAsyncCopyBufferSubDataNVX)
+#define glad_glAsyncCopyImageSubDataNVX (glad_gl_current->glad_glAsyncCopyImageSubDataNVX)
+#define glad_glLGPUNamedBufferSubDataNVX (glad_gl_current->glad_glLGPUNamedBufferSubDataNVX)
+#define glad_glLGPUCopyImageSubDataNVX (glad_gl_current->glad_glLGPUCopyImageSubDataNVX)
+#define glad_glLGPUInterlockNVX (glad_gl_current->glad_glLGPUInterlockNVX)
+#define glad_glCreateProgressFenceNVX (glad_gl_current->glad_glCreateProgressFenceNVX)
+#define glad_glSignalSemaphoreui64NVX (glad_gl_current->glad_glSignalSemaphoreui64NVX)
+#define glad_glWaitSemaphoreui64NVX (glad_gl_current->glad_glWaitSemaphoreui64NVX)
+#define glad_glClientWaitSemaphoreui64NVX (glad_gl_current->glad_glClientWaitSemaphoreui64NVX)
+#define glad_glAlphaToCoverageDitherControlNV (glad_gl_current->glad_glAlphaToCoverageDitherControlNV)
+#define glad_glMultiDrawArraysIndirectBindlessNV (glad_gl_current->glad_glMultiDrawArraysIndirectBindlessNV)
+#define glad_glMultiDrawElementsIndirectBindlessNV (glad_gl_current->glad_glMultiDrawElementsIndirectBindlessNV)
+#define glad_glMultiDrawArraysIndirectBindlessCountNV (glad_gl_current->glad_glMultiDrawArraysIndirectBindlessCountNV)
+#define glad_glMultiDrawElementsIndirectBindlessCountNV (glad_gl_current->glad_glMultiDrawElementsIndirectBindlessCountNV)
+#define glad_glGetTextureHandleNV (glad_gl_current->glad_glGetTextureHandleNV)
+#define glad_glGetTextureSamplerHandleNV (glad_gl_current->glad_glGetTextureSamplerHandleNV)
+#define glad_glMakeTextureHandleResidentNV (glad_gl_current->glad_glMakeTextureHandleResidentNV)
+#define glad_glMakeTextureHandleNonResidentNV (glad_gl_current->glad_glMakeTextureHandleNonResidentNV)
+#define glad_glGetImageHandleNV (glad_gl_current->glad_glGetImageHandleNV)
+#define glad_glMakeImageHandleResidentNV (glad_gl_current->glad_glMakeImageHandleResidentNV)
+#define glad_glMakeImageHandleNonResidentNV (glad_gl_current->glad_glMakeImageHandleNonResidentNV)
+#define glad_glUniformHandleui64NV (glad_gl_current->glad_glUniformHandleui64NV)
+#define glad_glUniformHandleui64vNV (glad_gl_current->glad_glUniformHandleui64vNV)
+#define glad_glProgramUniformHandleui64NV (glad_gl_current->glad_glProgramUniformHandleui64NV)
+#define glad_glProgramUniformHandleui64vNV (glad_gl_current->glad_glProgramUniformHandleui64vNV)
+#define glad_glIsTextureHandleResidentNV (glad_gl_current->glad_glIsTextureHandleResidentNV)
+#define glad_glIsImageHandleResidentNV (glad_gl_current->glad_glIsImageHandleResidentNV)
+#define glad_glBlendParameteriNV (glad_gl_current->glad_glBlendParameteriNV)
+#define glad_glBlendBarrierNV (glad_gl_current->glad_glBlendBarrierNV)
+#define glad_glViewportPositionWScaleNV (glad_gl_current->glad_glViewportPositionWScaleNV)
+#define glad_glCreateStatesNV (glad_gl_current->glad_glCreateStatesNV)
+#define glad_glDeleteStatesNV (glad_gl_current->glad_glDeleteStatesNV)
+#define glad_glIsStateNV (glad_gl_current->glad_glIsStateNV)
+#define glad_glStateCaptureNV (glad_gl_current->glad_glStateCaptureNV)
+#define glad_glGetCommandHeaderNV (glad_gl_current->glad_glGetCommandHeaderNV)
+#define glad_glGetStageIndexNV (glad_gl_current->glad_glGetStageIndexNV)
+#define glad_glDrawCommandsNV (glad_gl_current->glad_glDrawCommandsNV)
+#define glad_glDrawCommandsAddressNV (glad_gl_current->glad_glDrawCommandsAddressNV)
+#define glad_glDrawCommandsStatesNV (glad_gl_current->glad_glDrawCommandsStatesNV)
+#define glad_glDrawCommandsStatesAddressNV (glad_gl_current->glad_glDrawCommandsStatesAddressNV)
+#define glad_glCreateCommandListsNV (glad_gl_current->glad_glCreateCommandListsNV)
+#define glad_glDeleteCommandListsNV (glad_gl_current->glad_glDeleteCommandListsNV)
+#define glad_glIsCommandListNV (glad_gl_current->glad_glIsCommandListNV)
+#define glad_glListDrawCommandsStatesClientNV (glad_gl_current->glad_glListDrawCommandsStatesClientNV)
+#define glad_glCommandListSegmentsNV (glad_gl_current->glad_glCommandListSegmentsNV)
+#define glad_glCompileCommandListNV (glad_gl_current->glad_glCompileCommandListNV)
+#define glad_glCallCommandListNV (glad_gl_current->glad_glCallCommandListNV)
+#define glad_glBeginConditionalRenderNV (glad_gl_current->glad_glBeginConditionalRenderNV)
+#define glad_glEndConditionalRenderNV (glad_gl_current->glad_glEndConditionalRenderNV)
+#define glad_glSubpixelPrecisionBiasNV (glad_gl_current->glad_glSubpixelPrecisionBiasNV)
+#define glad_glConservativeRasterParameterfNV (glad_gl_current->glad_glConservativeRasterParameterfNV)
+#define glad_glConservativeRasterParameteriNV (glad_gl_current->glad_glConservativeRasterParameteriNV)
+#define glad_glCopyImageSubDataNV (glad_gl_current->glad_glCopyImageSubDataNV)
+#define glad_glDepthRangedNV (glad_gl_current->glad_glDepthRangedNV)
+#define glad_glClearDepthdNV (glad_gl_current->glad_glClearDepthdNV)
+#define glad_glDepthBoundsdNV (glad_gl_current->glad_glDepthBoundsdNV)
+#define glad_glDrawTextureNV (glad_gl_current->glad_glDrawTextureNV)
+#define glad_glDrawVkImageNV (glad_gl_current->glad_glDrawVkImageNV)
+#define glad_glGetVkProcAddrNV (glad_gl_current->glad_glGetVkProcAddrNV)
+#define glad_glWaitVkSemaphoreNV (glad_gl_current->glad_glWaitVkSemaphoreNV)
+#define glad_glSignalVkSemaphoreNV (glad_gl_current->glad_glSignalVkSemaphoreNV)
+#define glad_glSignalVkFenceNV (glad_gl_current->glad_glSignalVkFenceNV)
+#define glad_glMapControlPointsNV (glad_gl_current->glad_glMapControlPointsNV)
+#define glad_glMapParameterivNV (glad_gl_current->glad_glMapParameterivNV)
+#define glad_glMapParameterfvNV (glad_gl_current->glad_glMapParameterfvNV)
+#define glad_glGetMapControlPointsNV (glad_gl_current->glad_glGetMapControlPointsNV)
+#define glad_glGetMapParameterivNV (glad_gl_current->glad_glGetMapParameterivNV)
+#define glad_glGetMapParameterfvNV (glad_gl_current->glad_glGetMapParameterfvNV)
+#define glad_glGetMapAttribParameterivNV (glad_gl_current->glad_glGetMapAttribParameterivNV)
+#define glad_glGetMapAttribParameterfvNV (glad_gl_current->glad_glGetMapAttribParameterfvNV)
+#define glad_glEvalMapsNV (glad_gl_current->glad_glEvalMapsNV)
+#define glad_glGetMultisamplefvNV (glad_gl_current->glad_glGetMultisamplefvNV)
+#define glad_glSampleMaskIndexedNV (glad_gl_current->glad_glSampleMaskIndexedNV)
+#define glad_glTexRenderbufferNV (glad_gl_current->glad_glTexRenderbufferNV)
+#define glad_glDeleteFencesNV (glad_gl_current->glad_glDeleteFencesNV)
+#define glad_glGenFencesNV (glad_gl_current->glad_glGenFencesNV)
+#define glad_glIsFenceNV (glad_gl_current->glad_glIsFenceNV)
+#define glad_glTestFenceNV (glad_gl_current->glad_glTestFenceNV)
+#define glad_glGetFenceivNV (glad_gl_current->glad_glGetFenceivNV)
+#define glad_glFinishFenceNV (glad_gl_current->glad_glFinishFenceNV)
+#define glad_glSetFenceNV (glad_gl_current->glad_glSetFenceNV)
+#define glad_glFragmentCoverageColorNV (glad_gl_current->glad_glFragmentCoverageColorNV)
+#define glad_glProgramNamedParameter4fNV (glad_gl_current->glad_glProgramNamedParameter4fNV)
+#define glad_glProgramNamedParameter4fvNV (glad_gl_current->glad_glProgramNamedParameter4fvNV)
+#define glad_glProgramNamedParameter4dNV (glad_gl_current->glad_glProgramNamedParameter4dNV)
+#define glad_glProgramNamedParameter4dvNV (glad_gl_current->glad_glProgramNamedParameter4dvNV)
+#define glad_glGetProgramNamedParameterfvNV (glad_gl_current->glad_glGetProgramNamedParameterfvNV)
+#define glad_glGetProgramNamedParameterdvNV (glad_gl_current->glad_glGetProgramNamedParameterdvNV)
+#define glad_glCoverageModulationTableNV (glad_gl_current->glad_glCoverageModulationTableNV)
+#define glad_glGetCoverageModulationTableNV (glad_gl_current->glad_glGetCoverageModulationTableNV)
+#define glad_glCoverageModulationNV (glad_gl_current->glad_glCoverageModulationNV)
+#define glad_glRenderbufferStorageMultisampleCoverageNV (glad_gl_current->glad_glRenderbufferStorageMultisampleCoverageNV)
+#define glad_glProgramVertexLimitNV (glad_gl_current->glad_glProgramVertexLimitNV)
+#define glad_glFramebufferTextureEXT (glad_gl_current->glad_glFramebufferTextureEXT)
+#define glad_glFramebufferTextureFaceEXT (glad_gl_current->glad_glFramebufferTextureFaceEXT)
+#define glad_glRenderGpuMaskNV (glad_gl_current->glad_glRenderGpuMaskNV)
+#define glad_glMulticastBufferSubDataNV (glad_gl_current->glad_glMulticastBufferSubDataNV)
+#define glad_glMulticastCopyBufferSubDataNV (glad_gl_current->glad_glMulticastCopyBufferSubDataNV)
+#define glad_glMulticastCopyImageSubDataNV (glad_gl_current->glad_glMulticastCopyImageSubDataNV)
+#define glad_glMulticastBlitFramebufferNV (glad_gl_current->glad_glMulticastBlitFramebufferNV)
+#define glad_glMulticastFramebufferSampleLocationsfvNV (glad_gl_current->glad_glMulticastFramebufferSampleLocationsfvNV)
+#define glad_glMulticastBarrierNV (glad_gl_current->glad_glMulticastBarrierNV)
+#define glad_glMulticastWaitSyncNV (glad_gl_current->glad_glMulticastWaitSyncNV)
+#define glad_glMulticastGetQueryObjectivNV (glad_gl_current->glad_glMulticastGetQueryObjectivNV)
+#define glad_glMulticastGetQueryObjectuivNV (glad_gl_current->glad_glMulticastGetQueryObjectuivNV)
+#define glad_glMulticastGetQueryObjecti64vNV (glad_gl_current->glad_glMulticastGetQueryObjecti64vNV)
+#define glad_glMulticastGetQueryObjectui64vNV (glad_gl_current->glad_glMulticastGetQueryObjectui64vNV)
+#define glad_glProgramLocalParameterI4iNV (glad_gl_current->glad_glProgramLocalParameterI4iNV)
+#define glad_glProgramLocalParameterI4ivNV (glad_gl_current->glad_glProgramLocalParameterI4ivNV)
+#define glad_glProgramLocalParametersI4ivNV (glad_gl_current->glad_glProgramLocalParametersI4ivNV)
+#define glad_glProgramLocalParameterI4uiNV (glad_gl_current->glad_glProgramLocalParameterI4uiNV)
+#define glad_glProgramLocalParameterI4uivNV (glad_gl_current->glad_glProgramLocalParameterI4uivNV)
+#define glad_glProgramLocalParametersI4uivNV (glad_gl_current->glad_glProgramLocalParametersI4uivNV)
+#define glad_glProgramEnvParameterI4iNV (glad_gl_current->glad_glProgramEnvParameterI4iNV)
+#define glad_glProgramEnvParameterI4ivNV (glad_gl_current->glad_glProgramEnvParameterI4ivNV)
+#define glad_glProgramEnvParametersI4ivNV (glad_gl_current->glad_glProgramEnvParametersI4ivNV)
+#define glad_glProgramEnvParameterI4uiNV (glad_gl_current->glad_glProgramEnvParameterI4uiNV)
+#define glad_glProgramEnvParameterI4uivNV (glad_gl_current->glad_glProgramEnvParameterI4uivNV)
+#define glad_glProgramEnvParametersI4uivNV (glad_gl_current->glad_glProgramEnvParametersI4uivNV)
+#define glad_glGetProgramLocalParameterIivNV (glad_gl_current->glad_glGetProgramLocalParameterIivNV)
+#define glad_glGetProgramLocalParameterIuivNV (glad_gl_current->glad_glGetProgramLocalParameterIuivNV)
+#define glad_glGetProgramEnvParameterIivNV (glad_gl_current->glad_glGetProgramEnvParameterIivNV)
+#define glad_glGetProgramEnvParameterIuivNV (glad_gl_current->glad_glGetProgramEnvParameterIuivNV)
+#define glad_glProgramSubroutineParametersuivNV (glad_gl_current->glad_glProgramSubroutineParametersuivNV)
+#define glad_glGetProgramSubroutineParameteruivNV (glad_gl_current->glad_glGetProgramSubroutineParameteruivNV)
+#define glad_glVertex2hNV (glad_gl_current->glad_glVertex2hNV)
+#define glad_glVertex2hvNV (glad_gl_current->glad_glVertex2hvNV)
+#define glad_glVertex3hNV (glad_gl_current->glad_glVertex3hNV)
+#define glad_glVertex3hvNV (glad_gl_current->glad_glVertex3hvNV)
+#define glad_glVertex4hNV (glad_gl_current->glad_glVertex4hNV)
+#define glad_glVertex4hvNV (glad_gl_current->glad_glVertex4hvNV)
+#define glad_glNormal3hNV (glad_gl_current->glad_glNormal3hNV)
+#define glad_glNormal3hvNV (glad_gl_current->glad_glNormal3hvNV)
+#define glad_glColor3hNV (glad_gl_current->glad_glColor3hNV)
+#define glad_glColor3hvNV (glad_gl_current->glad_glColor3hvNV)
+#define glad_glColor4hNV (glad_gl_current->glad_glColor4hNV)
+#define glad_glColor4hvNV (glad_gl_current->glad_glColor4hvNV)
+#define glad_glTexCoord1hNV (glad_gl_current->glad_glTexCoord1hNV)
+#define glad_glTexCoord1hvNV (glad_gl_current->glad_glTexCoord1hvNV)
+#define glad_glTexCoord2hNV (glad_gl_current->glad_glTexCoord2hNV)
+#define glad_glTexCoord2hvNV (glad_gl_current->glad_glTexCoord2hvNV)
+#define glad_glTexCoord3hNV (glad_gl_current->glad_glTexCoord3hNV)
+#define glad_glTexCoord3hvNV (glad_gl_current->glad_glTexCoord3hvNV)
+#define glad_glTexCoord4hNV (glad_gl_current->glad_glTexCoord4hNV)
+#define glad_glTexCoord4hvNV (glad_gl_current->glad_glTexCoord4hvNV)
+#define glad_glMultiTexCoord1hNV (glad_gl_current->glad_glMultiTexCoord1hNV)
+#define glad_glMultiTexCoord1hvNV (glad_gl_current->glad_glMultiTexCoord1hvNV)
+#define glad_glMultiTexCoord2hNV (glad_gl_current->glad_glMultiTexCoord2hNV)
+#define glad_glMultiTexCoord2hvNV (glad_gl_current->glad_glMultiTexCoord2hvNV)
+#define glad_glMultiTexCoord3hNV (glad_gl_current->glad_glMultiTexCoord3hNV)
+#define glad_glMultiTexCoord3hvNV (glad_gl_current->glad_glMultiTexCoord3hvNV)
+#define glad_glMultiTexCoord4hNV (glad_gl_current->glad_glMultiTexCoord4hNV)
+#define glad_glMultiTexCoord4hvNV (glad_gl_current->glad_glMultiTexCoord4hvNV)
+#define glad_glVertexAttrib1hNV (glad_gl_current->glad_glVertexAttrib1hNV)
+#define glad_glVertexAttrib1hvNV (glad_gl_current->glad_glVertexAttrib1hvNV)
+#define glad_glVertexAttrib2hNV (glad_gl_current->glad_glVertexAttrib2hNV)
+#define glad_glVertexAttrib2hvNV (glad_gl_current->glad_glVertexAttrib2hvNV)
+#define glad_glVertexAttrib3hNV (glad_gl_current->glad_glVertexAttrib3hNV)
+#define glad_glVertexAttrib3hvNV (glad_gl_current->glad_glVertexAttrib3hvNV)
+#define glad_glVertexAttrib4hNV (glad_gl_current->glad_glVertexAttrib4hNV)
+#define glad_glVertexAttrib4hvNV (glad_gl_current->glad_glVertexAttrib4hvNV)
+#define glad_glVertexAttribs1hvNV (glad_gl_current->glad_glVertexAttribs1hvNV)
+#define glad_glVertexAttribs2hvNV (glad_gl_current->glad_glVertexAttribs2hvNV)
+#define glad_glVertexAttribs3hvNV (glad_gl_current->glad_glVertexAttribs3hvNV)
+#define glad_glVertexAttribs4hvNV (glad_gl_current->glad_glVertexAttribs4hvNV)
+#define glad_glFogCoordhNV (glad_gl_current->glad_glFogCoordhNV)
+#define glad_glFogCoordhvNV (glad_gl_current->glad_glFogCoordhvNV)
+#define glad_glSecondaryColor3hNV (glad_gl_current->glad_glSecondaryColor3hNV)
+#define glad_glSecondaryColor3hvNV (glad_gl_current->glad_glSecondaryColor3hvNV)
+#define glad_glVertexWeighthNV (glad_gl_current->glad_glVertexWeighthNV)
+#define glad_glVertexWeighthvNV (glad_gl_current->glad_glVertexWeighthvNV)
+#define glad_glGetInternalformatSampleivNV (glad_gl_current->glad_glGetInternalformatSampleivNV)
+#define glad_glGetMemoryObjectDetachedResourcesuivNV (glad_gl_current->glad_glGetMemoryObjectDetachedResourcesuivNV)
+#define glad_glResetMemoryObjectParameterNV (glad_gl_current->glad_glResetMemoryObjectParameterNV)
+#define glad_glTexAttachMemoryNV (glad_gl_current->glad_glTexAttachMemoryNV)
+#define glad_glBufferAttachMemoryNV (glad_gl_current->glad_glBufferAttachMemoryNV)
+#define glad_glTextureAttachMemoryNV (glad_gl_current->glad_glTextureAttachMemoryNV)
+#define glad_glNamedBufferAttachMemoryNV (glad_gl_current->glad_glNamedBufferAttachMemoryNV)
+#define glad_glBufferPageCommitmentMemNV (glad_gl_current->glad_glBufferPageCommitmentMemNV)
+#define glad_glTexPageCommitmentMemNV (glad_gl_current->glad_glTexPageCommitmentMemNV)
+#define glad_glNamedBufferPageCommitmentMemNV (glad_gl_current->glad_glNamedBufferPageCommitmentMemNV)
+#define glad_glTexturePageCommitmentMemNV (glad_gl_current->glad_glTexturePageCommitmentMemNV)
+#define glad_glDrawMeshTasksNV (glad_gl_current->glad_glDrawMeshTasksNV)
+#define glad_glDrawMeshTasksIndirectNV (glad_gl_current->glad_glDrawMeshTasksIndirectNV)
+#define glad_glMultiDrawMeshTasksIndirectNV (glad_gl_current->glad_glMultiDrawMeshTasksIndirectNV)
+#define glad_glMultiDrawMeshTasksIndirectCountNV (glad_gl_current->glad_glMultiDrawMeshTasksIndirectCountNV)
+#define glad_glGenOcclusionQueriesNV (glad_gl_current->glad_glGenOcclusionQueriesNV)
+#define glad_glDeleteOcclusionQueriesNV (glad_gl_current->glad_glDeleteOcclusionQueriesNV)
+#define glad_glIsOcclusionQueryNV (glad_gl_current->glad_glIsOcclusionQueryNV)
+#define glad_glBeginOcclusionQueryNV (glad_gl_current->glad_glBeginOcclusionQueryNV)
+#define glad_glEndOcclusionQueryNV (glad_gl_current->glad_glEndOcclusionQueryNV)
+#define glad_glGetOcclusionQueryivNV (glad_gl_current->glad_glGetOcclusionQueryivNV)
+#define glad_glGetOcclusionQueryuivNV (glad_gl_current->glad_glGetOcclusionQueryuivNV)
+#define glad_glProgramBufferParametersfvNV (glad_gl_current->glad_glProgramBufferParametersfvNV)
+#define glad_glProgramBufferParametersIivNV (glad_gl_current->glad_glProgramBufferParametersIivNV)
+#define glad_glProgramBufferParametersIuivNV (glad_gl_current->glad_glProgramBufferParametersIuivNV)
+#define glad_glGenPathsNV (glad_gl_current->glad_glGenPathsNV)
+#define glad_glDeletePathsNV (glad_gl_current->glad_glDeletePathsNV)
+#define glad_glIsPathNV (glad_gl_current->glad_glIsPathNV)
+#define glad_glPathCommandsNV (glad_gl_current->glad_glPathCommandsNV)
+#define glad_glPathCoordsNV (glad_gl_current->glad_glPathCoordsNV)
+#define glad_glPathSubCommandsNV (glad_gl_current->glad_glPathSubCommandsNV)
+#define glad_glPathSubCoordsNV (glad_gl_current->glad_glPathSubCoordsNV)
+#define glad_glPathStringNV (glad_gl_current->glad_glPathStringNV)
+#define glad_glPathGlyphsNV (glad_gl_current->glad_glPathGlyphsNV)
+#define glad_glPathGlyphRangeNV (glad_gl_current->glad_glPathGlyphRangeNV)
+#define glad_glWeightPathsNV (glad_gl_current->glad_glWeightPathsNV)
+#define glad_glCopyPathNV (glad_gl_current->glad_glCopyPathNV)
+#define glad_glInterpolatePathsNV (glad_gl_current->glad_glInterpolatePathsNV)
+#define glad_glTransformPathNV (glad_gl_current->glad_glTransformPathNV)
+#define glad_glPathParameterivNV (glad_gl_current->glad_glPathParameterivNV)
+#define glad_glPathParameteriNV (glad_gl_current->glad_glPathParameteriNV)
+#define glad_glPathParameterfvNV (glad_gl_current->glad_glPathParameterfvNV)
+#define glad_glPathParameterfNV (glad_gl_current->glad_glPathParameterfNV)
+#define glad_glPathDashArrayNV (glad_gl_current->glad_glPathDashArrayNV)
+#define glad_glPathStencilFuncNV (glad_gl_current->glad_glPathStencilFuncNV)
+#define glad_glPathStencilDepthOffsetNV (glad_gl_current->glad_glPathStencilDepthOffsetNV)
+#define glad_glStencilFillPathNV (glad_gl_current->glad_glStencilFillPathNV)
+#define glad_glStencilStrokePathNV (glad_gl_current->glad_glStencilStrokePathNV)
+#define glad_glStencilFillPathInstancedNV (glad_gl_current->glad_glStencilFillPathInstancedNV)
+#define glad_glStencilStrokePathInstancedNV (glad_gl_current->glad_glStencilStrokePathInstancedNV)
+#define glad_glPathCoverDepthFuncNV (glad_gl_current->glad_glPathCoverDepthFuncNV)
+#define glad_glCoverFillPathNV (glad_gl_current->glad_glCoverFillPathNV)
+#define glad_glCoverStrokePathNV (glad_gl_current->glad_glCoverStrokePathNV)
+#define glad_glCoverFillPathInstancedNV (glad_gl_current->glad_glCoverFillPathInstancedNV)
+#define glad_glCoverStrokePathInstancedNV (glad_gl_current->glad_glCoverStrokePathInstancedNV)
+#define glad_glGetPathParameterivNV (glad_gl_current->glad_glGetPathParameterivNV)
+#define glad_glGetPathParameterfvNV (glad_gl_current->glad_glGetPathParameterfvNV)
+#define glad_glGetPathCommandsNV (glad_gl_current->glad_glGetPathCommandsNV)
+#define glad_glGetPathCoordsNV (glad_gl_current->glad_glGetPathCoordsNV)
+#define glad_glGetPathDashArrayNV (glad_gl_current->glad_glGetPathDashArrayNV)
+#define glad_glGetPathMetricsNV (glad_gl_current->glad_glGetPathMetricsNV)
+#define glad_glGetPathMetricRangeNV (glad_gl_current->glad_glGetPathMetricRangeNV)
+#define glad_glGetPathSpacingNV (glad_gl_current->glad_glGetPathSpacingNV)
+#define glad_glIsPointInFillPathNV (glad_gl_current->glad_glIsPointInFillPathNV)
+#define glad_glIsPointInStrokePathNV (glad_gl_current->glad_glIsPointInStrokePathNV)
+#define glad_glGetPathLengthNV (glad_gl_current->glad_glGetPathLengthNV)
+#define glad_glPointAlongPathNV (glad_gl_current->glad_glPointAlongPathNV)
+#define glad_glMatrixLoad3x2fNV (glad_gl_current->glad_glMatrixLoad3x2fNV)
+#define glad_glMatrixLoad3x3fNV (glad_gl_current->glad_glMatrixLoad3x3fNV)
+#define glad_glMatrixLoadTranspose3x3fNV (glad_gl_current->glad_glMatrixLoadTranspose3x3fNV)
+#define glad_glMatrixMult3x2fNV (glad_gl_current->glad_glMatrixMult3x2fNV)
+#define glad_glMatrixMult3x3fNV (glad_gl_current->glad_glMatrixMult3x3fNV)
+#define glad_glMatrixMultTranspose3x3fNV (glad_gl_current->glad_glMatrixMultTranspose3x3fNV)
+#define glad_glStencilThenCoverFillPathNV (glad_gl_current->glad_glStencilThenCoverFillPathNV)
+#define glad_glStencilThenCoverStrokePathNV (glad_gl_current->glad_glStencilThenCoverStrokePathNV)
+#define glad_glStencilThenCoverFillPathInstancedNV (glad_gl_current->glad_glStencilThenCoverFillPathInstancedNV)
+#define glad_glStencilThenCoverStrokePathInstancedNV (glad_gl_current->glad_glStencilThenCoverStrokePathInstancedNV)
+#define glad_glPathGlyphIndexRangeNV (glad_gl_current->glad_glPathGlyphIndexRangeNV)
+#define glad_glPathGlyphIndexArrayNV (glad_gl_current->glad_glPathGlyphIndexArrayNV)
+#define glad_glPathMemoryGlyphIndexArrayNV (glad_gl_current->glad_glPathMemoryGlyphIndexArrayNV)
+#define glad_glProgramPathFragmentInputGenNV (glad_gl_current->glad_glProgramPathFragmentInputGenNV)
+#define glad_glGetProgramResourcefvNV (glad_gl_current->glad_glGetProgramResourcefvNV)
+#define glad_glPathColorGenNV (glad_gl_current->glad_glPathColorGenNV)
+#define glad_glPathTexGenNV (glad_gl_current->glad_glPathTexGenNV)
+#define glad_glPathFogGenNV (glad_gl_current->glad_glPathFogGenNV)
+#define glad_glGetPathColorGenivNV (glad_gl_current->glad_glGetPathColorGenivNV)
+#define glad_glGetPathColorGenfvNV (glad_gl_current->glad_glGetPathColorGenfvNV)
+#define glad_glGetPathTexGenivNV (glad_gl_current->glad_glGetPathTexGenivNV)
+#define glad_glGetPathTexGenfvNV (glad_gl_current->glad_glGetPathTexGenfvNV)
+#define glad_glPixelDataRangeNV (glad_gl_current->glad_glPixelDataRangeNV)
+#define glad_glFlushPixelDataRangeNV (glad_gl_current->glad_glFlushPixelDataRangeNV)
+#define glad_glPointParameteriNV (glad_gl_current->glad_glPointParameteriNV)
+#define glad_glPointParameterivNV (glad_gl_current->glad_glPointParameterivNV)
+#define glad_glPresentFrameKeyedNV (glad_gl_current->glad_glPresentFrameKeyedNV)
+#define glad_glPresentFrameDualFillNV (glad_gl_current->glad_glPresentFrameDualFillNV)
+#define glad_glGetVideoivNV (glad_gl_current->glad_glGetVideoivNV)
+#define glad_glGetVideouivNV (glad_gl_current->glad_glGetVideouivNV)
+#define glad_glGetVideoi64vNV (glad_gl_current->glad_glGetVideoi64vNV)
+#define glad_glGetVideoui64vNV (glad_gl_current->glad_glGetVideoui64vNV)
+#define glad_glPrimitiveRestartNV (glad_gl_current->glad_glPrimitiveRestartNV)
+#define glad_glPrimitiveRestartIndexNV (glad_gl_current->glad_glPrimitiveRestartIndexNV)
+#define glad_glQueryResourceNV (glad_gl_current->glad_glQueryResourceNV)
+#define glad_glGenQueryResourceTagNV (glad_gl_current->glad_glGenQueryResourceTagNV)
+#define glad_glDeleteQueryResourceTagNV (glad_gl_current->glad_glDeleteQueryResourceTagNV)
+#define glad_glQueryResourceTagNV (glad_gl_current->glad_glQueryResourceTagNV)
+#define glad_glCombinerParameterfvNV (glad_gl_current->glad_glCombinerParameterfvNV)
+#define glad_glCombinerParameterfNV (glad_gl_current->glad_glCombinerParameterfNV)
+#define glad_glCombinerParameterivNV (glad_gl_current->glad_glCombinerParameterivNV)
+#define glad_glCombinerParameteriNV (glad_gl_current->glad_glCombinerParameteriNV)
+#define glad_glCombinerInputNV (glad_gl_current->glad_glCombinerInputNV)
+#define glad_glCombinerOutputNV (glad_gl_current->glad_glCombinerOutputNV)
+#define glad_glFinalCombinerInputNV (glad_gl_current->glad_glFinalCombinerInputNV)
+#define glad_glGetCombinerInputParameterfvNV (glad_gl_current->glad_glGetCombinerInputParameterfvNV)
+#define glad_glGetCombinerInputParameterivNV (glad_gl_current->glad_glGetCombinerInputParameterivNV)
+#define glad_glGetCombinerOutputParameterfvNV (glad_gl_current->glad_glGetCombinerOutputParameterfvNV)
+#define glad_glGetCombinerOutputParameterivNV (glad_gl_current->glad_glGetCombinerOutputParameterivNV)
+#define glad_glGetFinalCombinerInputParameterfvNV (glad_gl_current->glad_glGetFinalCombinerInputParameterfvNV)
+#define glad_glGetFinalCombinerInputParameterivNV (glad_gl_current->glad_glGetFinalCombinerInputParameterivNV)
+#define glad_glCombinerStageParameterfvNV (glad_gl_current->glad_glCombinerStageParameterfvNV)
+#define glad_glGetCombinerStageParameterfvNV (glad_gl_current->glad_glGetCombinerStageParameterfvNV)
+#define glad_glFramebufferSampleLocationsfvNV (glad_gl_current->glad_glFramebufferSampleLocationsfvNV)
+#define glad_glNamedFramebufferSampleLocationsfvNV (glad_gl_current->glad_glNamedFramebufferSampleLocationsfvNV)
+#define glad_glResolveDepthValuesNV (glad_gl_current->glad_glResolveDepthValuesNV)
+#define glad_glScissorExclusiveNV (glad_gl_current->glad_glScissorExclusiveNV)
+#define glad_glScissorExclusiveArrayvNV (glad_gl_current->glad_glScissorExclusiveArrayvNV)
+#define glad_glMakeBufferResidentNV (glad_gl_current->glad_glMakeBufferResidentNV)
+#define glad_glMakeBufferNonResidentNV (glad_gl_current->glad_glMakeBufferNonResidentNV)
+#define glad_glIsBufferResidentNV (glad_gl_current->glad_glIsBufferResidentNV)
+#define glad_glMakeNamedBufferResidentNV (glad_gl_current->glad_glMakeNamedBufferResidentNV)
+#define glad_glMakeNamedBufferNonResidentNV (glad_gl_current->glad_glMakeNamedBufferNonResidentNV)
+#define glad_glIsNamedBufferResidentNV (glad_gl_current->glad_glIsNamedBufferResidentNV)
+#define glad_glGetBufferParameterui64vNV (glad_gl_current->glad_glGetBufferParameterui64vNV)
+#define glad_glGetNamedBufferParameterui64vNV (glad_gl_current->glad_glGetNamedBufferParameterui64vNV)
+#define glad_glGetIntegerui64vNV (glad_gl_current->glad_glGetIntegerui64vNV)
+#define glad_glUniformui64NV (glad_gl_current->glad_glUniformui64NV)
+#define glad_glUniformui64vNV (glad_gl_current->glad_glUniformui64vNV)
+#define glad_glProgramUniformui64NV (glad_gl_current->glad_glProgramUniformui64NV)
+#define glad_glProgramUniformui64vNV (glad_gl_current->glad_glProgramUniformui64vNV)
+#define glad_glBindShadingRateImageNV (glad_gl_current->glad_glBindShadingRateImageNV)
+#define glad_glGetShadingRateImagePaletteNV (glad_gl_current->glad_glGetShadingRateImagePaletteNV)
+#define glad_glGetShadingRateSampleLocationivNV (glad_gl_current->glad_glGetShadingRateSampleLocationivNV)
+#define glad_glShadingRateImageBarrierNV (glad_gl_current->glad_glShadingRateImageBarrierNV)
+#define glad_glShadingRateImagePaletteNV (glad_gl_current->glad_glShadingRateImagePaletteNV)
+#define glad_glShadingRateSampleOrderNV (glad_gl_current->glad_glShadingRateSampleOrderNV)
+#define glad_glShadingRateSampleOrderCustomNV (glad_gl_current->glad_glShadingRateSampleOrderCustomNV)
+#define glad_glTextureBarrierNV (glad_gl_current->glad_glTextureBarrierNV)
+#define glad_glTexImage2DMultisampleCoverageNV (glad_gl_current->glad_glTexImage2DMultisampleCoverageNV)
+#define glad_glTexImage3DMultisampleCoverageNV (glad_gl_current->glad_glTexImage3DMultisampleCoverageNV)
+#define glad_glTextureImage2DMultisampleNV (glad_gl_current->glad_glTextureImage2DMultisampleNV)
+#define glad_glTextureImage3DMultisampleNV (glad_gl_current->glad_glTextureImage3DMultisampleNV)
+#define glad_glTextureImage2DMultisampleCoverageNV (glad_gl_current->glad_glTextureImage2DMultisampleCoverageNV)
+#define glad_glTextureImage3DMultisampleCoverageNV (glad_gl_current->glad_glTextureImage3DMultisampleCoverageNV)
+#define glad_glCreateSemaphoresNV (glad_gl_current->glad_glCreateSemaphoresNV)
+#define glad_glSemaphoreParameterivNV (glad_gl_current->glad_glSemaphoreParameterivNV)
+#define glad_glGetSemaphoreParameterivNV (glad_gl_current->glad_glGetSemaphoreParameterivNV)
+#define glad_glBeginTransformFeedbackNV (glad_gl_current->glad_glBeginTransformFeedbackNV)
+#define glad_glEndTransformFeedbackNV (glad_gl_current->glad_glEndTransformFeedbackNV)
+#define glad_glTransformFeedbackAttribsNV (glad_gl_current->glad_glTransformFeedbackAttribsNV)
+#define glad_glBindBufferRangeNV (glad_gl_current->glad_glBindBufferRangeNV)
+#define glad_glBindBufferOffsetNV (glad_gl_current->glad_glBindBufferOffsetNV)
+#define glad_glBindBufferBaseNV (glad_gl_current->glad_glBindBufferBaseNV)
+#define glad_glTransformFeedbackVaryingsNV (glad_gl_current->glad_glTransformFeedbackVaryingsNV)
+#define glad_glActiveVaryingNV (glad_gl_current->glad_glActiveVaryingNV)
+#define glad_glGetVaryingLocationNV (glad_gl_current->glad_glGetVaryingLocationNV)
+#define glad_glGetActiveVaryingNV (glad_gl_current->glad_glGetActiveVaryingNV)
+#define glad_glGetTransformFeedbackVaryingNV (glad_gl_current->glad_glGetTransformFeedbackVaryingNV)
+#define glad_glTransformFeedbackStreamAttribsNV (glad_gl_current->glad_glTransformFeedbackStreamAttribsNV)
+#define glad_glBindTransformFeedbackNV (glad_gl_current->glad_glBindTransformFeedbackNV)
+#define glad_glDeleteTransformFeedbacksNV (glad_gl_current->glad_glDeleteTransformFeedbacksNV)
+#define glad_glGenTransformFeedbacksNV (glad_gl_current->glad_glGenTransformFeedbacksNV)
+#define glad_glIsTransformFeedbackNV (glad_gl_current->glad_glIsTransformFeedbackNV)
+#define glad_glPauseTransformFeedbackNV (glad_gl_current->glad_glPauseTransformFeedbackNV)
+#define glad_glResumeTransformFeedbackNV (glad_gl_current->glad_glResumeTransformFeedbackNV)
+#define glad_glDrawTransformFeedbackNV (glad_gl_current->glad_glDrawTransformFeedbackNV)
+#define glad_glVDPAUInitNV (glad_gl_current->glad_glVDPAUInitNV)
+#define glad_glVDPAUFiniNV (glad_gl_current->glad_glVDPAUFiniNV)
+#define glad_glVDPAURegisterVideoSurfaceNV (glad_gl_current->glad_glVDPAURegisterVideoSurfaceNV)
+#define glad_glVDPAURegisterOutputSurfaceNV (glad_gl_current->glad_glVDPAURegisterOutputSurfaceNV)
+#define glad_glVDPAUIsSurfaceNV (glad_gl_current->glad_glVDPAUIsSurfaceNV)
+#define glad_glVDPAUUnregisterSurfaceNV (glad_gl_current->glad_glVDPAUUnregisterSurfaceNV)
+#define glad_glVDPAUGetSurfaceivNV (glad_gl_current->glad_glVDPAUGetSurfaceivNV)
+#define glad_glVDPAUSurfaceAccessNV (glad_gl_current->glad_glVDPAUSurfaceAccessNV)
+#define glad_glVDPAUMapSurfacesNV (glad_gl_current->glad_glVDPAUMapSurfacesNV)
+#define glad_glVDPAUUnmapSurfacesNV (glad_gl_current->glad_glVDPAUUnmapSurfacesNV)
+#define glad_glVDPAURegisterVideoSurfaceWithPictureStructureNV (glad_gl_current->glad_glVDPAURegisterVideoSurfaceWithPictureStructureNV)
+#define glad_glFlushVertexArrayRangeNV (glad_gl_current->glad_glFlushVertexArrayRangeNV)
+#define glad_glVertexArrayRangeNV (glad_gl_current->glad_glVertexArrayRangeNV)
+#define glad_glVertexAttribL1i64NV (glad_gl_current->glad_glVertexAttribL1i64NV)
+#define glad_glVertexAttribL2i64NV (glad_gl_current->glad_glVertexAttribL2i64NV)
+#define glad_glVertexAttribL3i64NV (glad_gl_current->glad_glVertexAttribL3i64NV)
+#define glad_glVertexAttribL4i64NV (glad_gl_current->glad_glVertexAttribL4i64NV)
+#define glad_glVertexAttribL1i64vNV (glad_gl_current->glad_glVertexAttribL1i64vNV)
+#define glad_glVertexAttribL2i64vNV (glad_gl_current->glad_glVertexAttribL2i64vNV)
+#define glad_glVertexAttribL3i64vNV (glad_gl_current->glad_glVertexAttribL3i64vNV)
+#define glad_glVertexAttribL4i64vNV (glad_gl_current->glad_glVertexAttribL4i64vNV)
+#define glad_glVertexAttribL1ui64NV (glad_gl_current->glad_glVertexAttribL1ui64NV)
+#define glad_glVertexAttribL2ui64NV (glad_gl_current->glad_glVertexAttribL2ui64NV)
+#define glad_glVertexAttribL3ui64NV (glad_gl_current->glad_glVertexAttribL3ui64NV)
+#define glad_glVertexAttribL4ui64NV (glad_gl_current->glad_glVertexAttribL4ui64NV)
+#define glad_glVertexAttribL1ui64vNV (glad_gl_current->glad_glVertexAttribL1ui64vNV)
+#define glad_glVertexAttribL2ui64vNV (glad_gl_current->glad_glVertexAttribL2ui64vNV)
+#define glad_glVertexAttribL3ui64vNV (glad_gl_current->glad_glVertexAttribL3ui64vNV)
+#define glad_glVertexAttribL4ui64vNV (glad_gl_current->glad_glVertexAttribL4ui64vNV)
+#define glad_glGetVertexAttribLi64vNV (glad_gl_current->glad_glGetVertexAttribLi64vNV)
+#define glad_glGetVertexAttribLui64vNV (glad_gl_current->glad_glGetVertexAttribLui64vNV)
+#define glad_glVertexAttribLFormatNV (glad_gl_current->glad_glVertexAttribLFormatNV)
+#define glad_glBufferAddressRangeNV (glad_gl_current->glad_glBufferAddressRangeNV)
+#define glad_glVertexFormatNV (glad_gl_current->glad_glVertexFormatNV)
+#define glad_glNormalFormatNV (glad_gl_current->glad_glNormalFormatNV)
+#define glad_glColorFormatNV (glad_gl_current->glad_glColorFormatNV)
+#define glad_glIndexFormatNV (glad_gl_current->glad_glIndexFormatNV)
+#define glad_glTexCoordFormatNV (glad_gl_current->glad_glTexCoordFormatNV)
+#define glad_glEdgeFlagFormatNV (glad_gl_current->glad_glEdgeFlagFormatNV)
+#define glad_glSecondaryColorFormatNV (glad_gl_current->glad_glSecondaryColorFormatNV)
+#define glad_glFogCoordFormatNV (glad_gl_current->glad_glFogCoordFormatNV)
+#define glad_glVertexAttribFormatNV (glad_gl_current->glad_glVertexAttribFormatNV)
+#define glad_glVertexAttribIFormatNV (glad_gl_current->glad_glVertexAttribIFormatNV)
+#define glad_glGetIntegerui64i_vNV (glad_gl_current->glad_glGetIntegerui64i_vNV)
+#define glad_glAreProgramsResidentNV (glad_gl_current->glad_glAreProgramsResidentNV)
+#define glad_glBindProgramNV (glad_gl_current->glad_glBindProgramNV)
+#define glad_glDeleteProgramsNV (glad_gl_current->glad_glDeleteProgramsNV)
+#define glad_glExecuteProgramNV (glad_gl_current->glad_glExecuteProgramNV)
+#define glad_glGenProgramsNV (glad_gl_current->glad_glGenProgramsNV)
+#define glad_glGetProgramParameterdvNV (glad_gl_current->glad_glGetProgramParameterdvNV)
+#define glad_glGetProgramParameterfvNV (glad_gl_current->glad_glGetProgramParameterfvNV)
+#define glad_glGetProgramivNV (glad_gl_current->glad_glGetProgramivNV)
+#define glad_glGetProgramStringNV (glad_gl_current->glad_glGetProgramStringNV)
+#define glad_glGetTrackMatrixivNV (glad_gl_current->glad_glGetTrackMatrixivNV)
+#define glad_glGetVertexAttribdvNV (glad_gl_current->glad_glGetVertexAttribdvNV)
+#define glad_glGetVertexAttribfvNV (glad_gl_current->glad_glGetVertexAttribfvNV)
+#define glad_glGetVertexAttribivNV (glad_gl_current->glad_glGetVertexAttribivNV)
+#define glad_glGetVertexAttribPointervNV (glad_gl_current->glad_glGetVertexAttribPointervNV)
+#define glad_glIsProgramNV (glad_gl_current->glad_glIsProgramNV)
+#define glad_glLoadProgramNV (glad_gl_current->glad_glLoadProgramNV)
+#define glad_glProgramParameter4dNV (glad_gl_current->glad_glProgramParameter4dNV)
+#define glad_glProgramParameter4dvNV (glad_gl_current->glad_glProgramParameter4dvNV)
+#define glad_glProgramParameter4fNV (glad_gl_current->glad_glProgramParameter4fNV)
+#define glad_glProgramParameter4fvNV (glad_gl_current->glad_glProgramParameter4fvNV)
+#define glad_glProgramParameters4dvNV (glad_gl_current->glad_glProgramParameters4dvNV)
+#define glad_glProgramParameters4fvNV (glad_gl_current->glad_glProgramParameters4fvNV)
+#define glad_glRequestResidentProgramsNV (glad_gl_current->glad_glRequestResidentProgramsNV)
+#define glad_glTrackMatrixNV (glad_gl_current->glad_glTrackMatrixNV)
+#define glad_glVertexAttribPointerNV (glad_gl_current->glad_glVertexAttribPointerNV)
+#define glad_glVertexAttrib1dNV (glad_gl_current->glad_glVertexAttrib1dNV)
+#define glad_glVertexAttrib1dvNV (glad_gl_current->glad_glVertexAttrib1dvNV)
+#define glad_glVertexAttrib1fNV (glad_gl_current->glad_glVertexAttrib1fNV)
+#define glad_glVertexAttrib1fvNV (glad_gl_current->glad_glVertexAttrib1fvNV)
+#define glad_glVertexAttrib1sNV (glad_gl_current->glad_glVertexAttrib1sNV)
+#define glad_glVertexAttrib1svNV (glad_gl_current->glad_glVertexAttrib1svNV)
+#define glad_glVertexAttrib2dNV (glad_gl_current->glad_glVertexAttrib2dNV)
+#define glad_glVertexAttrib2dvNV (glad_gl_current->glad_glVertexAttrib2dvNV)
+#define glad_glVertexAttrib2fNV (glad_gl_current->glad_glVertexAttrib2fNV)
+#define glad_glVertexAttrib2fvNV (glad_gl_current->glad_glVertexAttrib2fvNV)
+#define glad_glVertexAttrib2sNV (glad_gl_current->glad_glVertexAttrib2sNV)
+#define glad_glVertexAttrib2svNV (glad_gl_current->glad_glVertexAttrib2svNV)
+#define glad_glVertexAttrib3dNV (glad_gl_current->glad_glVertexAttrib3dNV)
+#define glad_glVertexAttrib3dvNV (glad_gl_current->glad_glVertexAttrib3dvNV)
+#define glad_glVertexAttrib3fNV (glad_gl_current->glad_glVertexAttrib3fNV)
+#define glad_glVertexAttrib3fvNV (glad_gl_current->glad_glVertexAttrib3fvNV)
+#define glad_glVertexAttrib3sNV (glad_gl_current->glad_glVertexAttrib3sNV)
+#define glad_glVertexAttrib3svNV (glad_gl_current->glad_glVertexAttrib3svNV)
+#define glad_glVertexAttrib4dNV (glad_gl_current->glad_glVertexAttrib4dNV)
+#define glad_glVertexAttrib4dvNV (glad_gl_current->glad_glVertexAttrib4dvNV)
+#define glad_glVertexAttrib4fNV (glad_gl_current->glad_glVertexAttrib4fNV)
+#define glad_glVertexAttrib4fvNV (glad_gl_current->glad_glVertexAttrib4fvNV)
+#define glad_glVertexAttrib4sNV (glad_gl_current->glad_glVertexAttrib4sNV)
+#define glad_glVertexAttrib4svNV (glad_gl_current->glad_glVertexAttrib4svNV)
+#define glad_glVertexAttrib4ubNV (glad_gl_current->glad_glVertexAttrib4ubNV)
+#define glad_glVertexAttrib4ubvNV (glad_gl_current->glad_glVertexAttrib4ubvNV)
+#define glad_glVertexAttribs1dvNV (glad_gl_current->glad_glVertexAttribs1dvNV)
+#define glad_glVertexAttribs1fvNV (glad_gl_current->glad_glVertexAttribs1fvNV)
+#define glad_glVertexAttribs1svNV (glad_gl_current->glad_glVertexAttribs1svNV)
+#define glad_glVertexAttribs2dvNV (glad_gl_current->glad_glVertexAttribs2dvNV)
+#define glad_glVertexAttribs2fvNV (glad_gl_current->glad_glVertexAttribs2fvNV)
+#define glad_glVertexAttribs2svNV (glad_gl_current->glad_glVertexAttribs2svNV)
+#define glad_glVertexAttribs3dvNV (glad_gl_current->glad_glVertexAttribs3dvNV)
+#define glad_glVertexAttribs3fvNV (glad_gl_current->glad_glVertexAttribs3fvNV)
+#define glad_glVertexAttribs3svNV (glad_gl_current->glad_glVertexAttribs3svNV)
+#define glad_glVertexAttribs4dvNV (glad_gl_current->glad_glVertexAttribs4dvNV)
+#define glad_glVertexAttribs4fvNV (glad_gl_current->glad_glVertexAttribs4fvNV)
+#define glad_glVertexAttribs4svNV (glad_gl_current->glad_glVertexAttribs4svNV)
+#define glad_glVertexAttribs4ubvNV (glad_gl_current->glad_glVertexAttribs4ubvNV)
+#define glad_glBeginVideoCaptureNV (glad_gl_current->glad_glBeginVideoCaptureNV)
+#define glad_glBindVideoCaptureStreamBufferNV (glad_gl_current->glad_glBindVideoCaptureStreamBufferNV)
+#define glad_glBindVideoCaptureStreamTextureNV (glad_gl_current->glad_glBindVideoCaptureStreamTextureNV)
+#define glad_glEndVideoCaptureNV (glad_gl_current->glad_glEndVideoCaptureNV)
+#define glad_glGetVideoCaptureivNV (glad_gl_current->glad_glGetVideoCaptureivNV)
+#define glad_glGetVideoCaptureStreamivNV (glad_gl_current->glad_glGetVideoCaptureStreamivNV)
+#define glad_glGetVideoCaptureStreamfvNV (glad_gl_current->glad_glGetVideoCaptureStreamfvNV)
+#define glad_glGetVideoCaptureStreamdvNV (glad_gl_current->glad_glGetVideoCaptureStreamdvNV)
+#define glad_glVideoCaptureNV (glad_gl_current->glad_glVideoCaptureNV)
+#define glad_glVideoCaptureStreamParameterivNV (glad_gl_current->glad_glVideoCaptureStreamParameterivNV)
+#define glad_glVideoCaptureStreamParameterfvNV (glad_gl_current->glad_glVideoCaptureStreamParameterfvNV)
+#define glad_glVideoCaptureStreamParameterdvNV (glad_gl_current->glad_glVideoCaptureStreamParameterdvNV)
+#define glad_glViewportSwizzleNV (glad_gl_current->glad_glViewportSwizzleNV)
+#define glad_glMultiTexCoord1bOES (glad_gl_current->glad_glMultiTexCoord1bOES)
+#define glad_glMultiTexCoord1bvOES (glad_gl_current->glad_glMultiTexCoord1bvOES)
+#define glad_glMultiTexCoord2bOES (glad_gl_current->glad_glMultiTexCoord2bOES)
+#define glad_glMultiTexCoord2bvOES (glad_gl_current->glad_glMultiTexCoord2bvOES)
+#define glad_glMultiTexCoord3bOES (glad_gl_current->glad_glMultiTexCoord3bOES)
+#define glad_glMultiTexCoord3bvOES (glad_gl_current->glad_glMultiTexCoord3bvOES)
+#define glad_glMultiTexCoord4bOES (glad_gl_current->glad_glMultiTexCoord4bOES)
+#define glad_glMultiTexCoord4bvOES (glad_gl_current->glad_glMultiTexCoord4bvOES)
+#define glad_glTexCoord1bOES (glad_gl_current->glad_glTexCoord1bOES)
+#define glad_glTexCoord1bvOES (glad_gl_current->glad_glTexCoord1bvOES)
+#define glad_glTexCoord2bOES (glad_gl_current->glad_glTexCoord2bOES)
+#define glad_glTexCoord2bvOES (glad_gl_current->glad_glTexCoord2bvOES)
+#define glad_glTexCoord3bOES (glad_gl_current->glad_glTexCoord3bOES)
+#define glad_glTexCoord3bvOES (glad_gl_current->glad_glTexCoord3bvOES)
+#define glad_glTexCoord4bOES (glad_gl_current->glad_glTexCoord4bOES)
+#define glad_glTexCoord4bvOES (glad_gl_current->glad_glTexCoord4bvOES)
+#define glad_glVertex2bOES (glad_gl_current->glad_glVertex2bOES)
+#define glad_glVertex2bvOES (glad_gl_current->glad_glVertex2bvOES)
+#define glad_glVertex3bOES (glad_gl_current->glad_glVertex3bOES)
+#define glad_glVertex3bvOES (glad_gl_current->glad_glVertex3bvOES)
+#define glad_glVertex4bOES (glad_gl_current->glad_glVertex4bOES)
+#define glad_glVertex4bvOES (glad_gl_current->glad_glVertex4bvOES)
+#define glad_glAlphaFuncxOES (glad_gl_current->glad_glAlphaFuncxOES)
+#define glad_glClearColorxOES (glad_gl_current->glad_glClearColorxOES)
+#define glad_glClearDepthxOES (glad_gl_current->glad_glClearDepthxOES)
+#define glad_glClipPlanexOES (glad_gl_current->glad_glClipPlanexOES)
+#define glad_glColor4xOES (glad_gl_current->glad_glColor4xOES)
+#define glad_glDepthRangexOES (glad_gl_current->glad_glDepthRangexOES)
+#define glad_glFogxOES (glad_gl_current->glad_glFogxOES)
+#define glad_glFogxvOES (glad_gl_current->glad_glFogxvOES)
+#define glad_glFrustumxOES (glad_gl_current->glad_glFrustumxOES)
+#define glad_glGetClipPlanexOES (glad_gl_current->glad_glGetClipPlanexOES)
+#define glad_glGetFixedvOES (glad_gl_current->glad_glGetFixedvOES)
+#define glad_glGetTexEnvxvOES (glad_gl_current->glad_glGetTexEnvxvOES)
+#define glad_glGetTexParameterxvOES (glad_gl_current->glad_glGetTexParameterxvOES)
+#define glad_glLightModelxOES (glad_gl_current->glad_glLightModelxOES)
+#define glad_glLightModelxvOES (glad_gl_current->glad_glLightModelxvOES)
+#define glad_glLightxOES (glad_gl_current->glad_glLightxOES)
+#define glad_glLightxvOES (glad_gl_current->glad_glLightxvOES)
+#define glad_glLineWidthxOES (glad_gl_current->glad_glLineWidthxOES)
+#define glad_glLoadMatrixxOES (glad_gl_current->glad_glLoadMatrixxOES)
+#define glad_glMaterialxOES (glad_gl_current->glad_glMaterialxOES)
+#define glad_glMaterialxvOES (glad_gl_current->glad_glMaterialxvOES)
+#define glad_glMultMatrixxOES (glad_gl_current->glad_glMultMatrixxOES)
+#define glad_glMultiTexCoord4xOES (glad_gl_current->glad_glMultiTexCoord4xOES)
+#define glad_glNormal3xOES (glad_gl_current->glad_glNormal3xOES)
+#define glad_glOrthoxOES (glad_gl_current->glad_glOrthoxOES)
+#define glad_glPointParameterxvOES (glad_gl_current->glad_glPointParameterxvOES)
+#define glad_glPointSizexOES (glad_gl_current->glad_glPointSizexOES)
+#define glad_glPolygonOffsetxOES (glad_gl_current->glad_glPolygonOffsetxOES)
+#define glad_glRotatexOES (glad_gl_current->glad_glRotatexOES)
+#define glad_glScalexOES (glad_gl_current->glad_glScalexOES)
+#define glad_glTexEnvxOES (glad_gl_current->glad_glTexEnvxOES)
+#define glad_glTexEnvxvOES (glad_gl_current->glad_glTexEnvxvOES)
+#define glad_glTexParameterxOES (glad_gl_current->glad_glTexParameterxOES)
+#define glad_glTexParameterxvOES (glad_gl_current->glad_glTexParameterxvOES)
+#define glad_glTranslatexOES (glad_gl_current->glad_glTranslatexOES)
+#define glad_glGetLightxvOES (glad_gl_current->glad_glGetLightxvOES)
+#define glad_glGetMaterialxvOES (glad_gl_current->glad_glGetMaterialxvOES)
+#define glad_glPointParameterxOES (glad_gl_current->glad_glPointParameterxOES)
+#define glad_glSampleCoveragexOES (glad_gl_current->glad_glSampleCoveragexOES)
+#define glad_glAccumxOES (glad_gl_current->glad_glAccumxOES)
+#define glad_glBitmapxOES (glad_gl_current->glad_glBitmapxOES)
+#define glad_glBlendColorxOES (glad_gl_current->glad_glBlendColorxOES)
+#define glad_glClearAccumxOES (glad_gl_current->glad_glClearAccumxOES)
+#define glad_glColor3xOES (glad_gl_current->glad_glColor3xOES)
+#define glad_glColor3xvOES (glad_gl_current->glad_glColor3xvOES)
+#define glad_glColor4xvOES (glad_gl_current->glad_glColor4xvOES)
+#define glad_glConvolutionParameterxOES (glad_gl_current->glad_glConvolutionParameterxOES)
+#define glad_glConvolutionParameterxvOES (glad_gl_current->glad_glConvolutionParameterxvOES)
+#define glad_glEvalCoord1xOES (glad_gl_current->glad_glEvalCoord1xOES)
+#define glad_glEvalCoord1xvOES (glad_gl_current->glad_glEvalCoord1xvOES)
+#define glad_glEvalCoord2xOES (glad_gl_current->glad_glEvalCoord2xOES)
+#define glad_glEvalCoord2xvOES (glad_gl_current->glad_glEvalCoord2xvOES)
+#define glad_glFeedbackBufferxOES (glad_gl_current->glad_glFeedbackBufferxOES)
+#define glad_glGetConvolutionParameterxvOES (glad_gl_current->glad_glGetConvolutionParameterxvOES)
+#define glad_glGetHistogramParameterxvOES (glad_gl_current->glad_glGetHistogramParameterxvOES)
+#define glad_glGetLightxOES (glad_gl_current->glad_glGetLightxOES)
+#define glad_glGetMapxvOES (glad_gl_current->glad_glGetMapxvOES)
+#define glad_glGetMaterialxOES (glad_gl_current->glad_glGetMaterialxOES)
+#define glad_glGetPixelMapxv (glad_gl_current->glad_glGetPixelMapxv)
+#define glad_glGetTexGenxvOES (glad_gl_current->glad_glGetTexGenxvOES)
+#define glad_glGetTexLevelParameterxvOES (glad_gl_current->glad_glGetTexLevelParameterxvOES)
+#define glad_glIndexxOES (glad_gl_current->glad_glIndexxOES)
+#define glad_glIndexxvOES (glad_gl_current->glad_glIndexxvOES)
+#define glad_glLoadTransposeMatrixxOES (glad_gl_current->glad_glLoadTransposeMatrixxOES)
+#define glad_glMap1xOES (glad_gl_current->glad_glMap1xOES)
+#define glad_glMap2xOES (glad_gl_current->glad_glMap2xOES)
+#define glad_glMapGrid1xOES (glad_gl_current->glad_glMapGrid1xOES)
+#define glad_glMapGrid2xOES (glad_gl_current->glad_glMapGrid2xOES)
+#define glad_glMultTransposeMatrixxOES (glad_gl_current->glad_glMultTransposeMatrixxOES)
+#define glad_glMultiTexCoord1xOES (glad_gl_current->glad_glMultiTexCoord1xOES)
+#define glad_glMultiTexCoord1xvOES (glad_gl_current->glad_glMultiTexCoord1xvOES)
+#define glad_glMultiTexCoord2xOES (glad_gl_current->glad_glMultiTexCoord2xOES)
+#define glad_glMultiTexCoord2xvOES (glad_gl_current->glad_glMultiTexCoord2xvOES)
+#define glad_glMultiTexCoord3xOES (glad_gl_current->glad_glMultiTexCoord3xOES)
+#define glad_glMultiTexCoord3xvOES (glad_gl_current->glad_glMultiTexCoord3xvOES)
+#define glad_glMultiTexCoord4xvOES (glad_gl_current->glad_glMultiTexCoord4xvOES)
+#define glad_glNormal3xvOES (glad_gl_current->glad_glNormal3xvOES)
+#define glad_glPassThroughxOES (glad_gl_current->glad_glPassThroughxOES)
+#define glad_glPixelMapx (glad_gl_current->glad_glPixelMapx)
+#define glad_glPixelStorex (glad_gl_current->glad_glPixelStorex)
+#define glad_glPixelTransferxOES (glad_gl_current->glad_glPixelTransferxOES)
+#define glad_glPixelZoomxOES (glad_gl_current->glad_glPixelZoomxOES)
+#define glad_glPrioritizeTexturesxOES (glad_gl_current->glad_glPrioritizeTexturesxOES)
+#define glad_glRasterPos2xOES (glad_gl_current->glad_glRasterPos2xOES)
+#define glad_glRasterPos2xvOES (glad_gl_current->glad_glRasterPos2xvOES)
+#define glad_glRasterPos3xOES (glad_gl_current->glad_glRasterPos3xOES)
+#define glad_glRasterPos3xvOES (glad_gl_current->glad_glRasterPos3xvOES)
+#define glad_glRasterPos4xOES (glad_gl_current->glad_glRasterPos4xOES)
+#define glad_glRasterPos4xvOES (glad_gl_current->glad_glRasterPos4xvOES)
+#define glad_glRectxOES (glad_gl_current->glad_glRectxOES)
+#define glad_glRectxvOES (glad_gl_current->glad_glRectxvOES)
+#define glad_glTexCoord1xOES (glad_gl_current->glad_glTexCoord1xOES)
+#define glad_glTexCoord1xvOES (glad_gl_current->glad_glTexCoord1xvOES)
+#define glad_glTexCoord2xOES (glad_gl_current->glad_glTexCoord2xOES)
+#define glad_glTexCoord2xvOES (glad_gl_current->glad_glTexCoord2xvOES)
+#define glad_glTexCoord3xOES (glad_gl_current->glad_glTexCoord3xOES)
+#define glad_glTexCoord3xvOES (glad_gl_current->glad_glTexCoord3xvOES)
+#define glad_glTexCoord4xOES (glad_gl_current->glad_glTexCoord4xOES)
+#define glad_glTexCoord4xvOES (glad_gl_current->glad_glTexCoord4xvOES)
+#define glad_glTexGenxOES (glad_gl_current->glad_glTexGenxOES)
+#define glad_glTexGenxvOES (glad_gl_current->glad_glTexGenxvOES)
+#define glad_glVertex2xOES (glad_gl_current->glad_glVertex2xOES)
+#define glad_glVertex2xvOES (glad_gl_current->glad_glVertex2xvOES)
+#define glad_glVertex3xOES (glad_gl_current->glad_glVertex3xOES)
+#define glad_glVertex3xvOES (glad_gl_current->glad_glVertex3xvOES)
+#define glad_glVertex4xOES (glad_gl_current->glad_glVertex4xOES)
+#define glad_glVertex4xvOES (glad_gl_current->glad_glVertex4xvOES)
+#define glad_glQueryMatrixxOES (glad_gl_current->glad_glQueryMatrixxOES)
+#define glad_glClearDepthfOES (glad_gl_current->glad_glClearDepthfOES)
+#define glad_glClipPlanefOES (glad_gl_current->glad_glClipPlanefOES)
+#define glad_glDepthRangefOES (glad_gl_current->glad_glDepthRangefOES)
+#define glad_glFrustumfOES (glad_gl_current->glad_glFrustumfOES)
+#define glad_glGetClipPlanefOES (glad_gl_current->glad_glGetClipPlanefOES)
+#define glad_glOrthofOES (glad_gl_current->glad_glOrthofOES)
+#define glad_glFramebufferTextureMultiviewOVR (glad_gl_current->glad_glFramebufferTextureMultiviewOVR)
+#define glad_glHintPGI (glad_gl_current->glad_glHintPGI)
+#define glad_glDetailTexFuncSGIS (glad_gl_current->glad_glDetailTexFuncSGIS)
+#define glad_glGetDetailTexFuncSGIS (glad_gl_current->glad_glGetDetailTexFuncSGIS)
+#define glad_glFogFuncSGIS (glad_gl_current->glad_glFogFuncSGIS)
+#define glad_glGetFogFuncSGIS (glad_gl_current->glad_glGetFogFuncSGIS)
+#define glad_glSampleMaskSGIS (glad_gl_current->glad_glSampleMaskSGIS)
+#define glad_glSamplePatternSGIS (glad_gl_current->glad_glSamplePatternSGIS)
+#define glad_glPixelTexGenParameteriSGIS (glad_gl_current->glad_glPixelTexGenParameteriSGIS)
+#define glad_glPixelTexGenParameterivSGIS (glad_gl_current->glad_glPixelTexGenParameterivSGIS)
+#define glad_glPixelTexGenParameterfSGIS (glad_gl_current->glad_glPixelTexGenParameterfSGIS)
+#define glad_glPixelTexGenParameterfvSGIS (glad_gl_current->glad_glPixelTexGenParameterfvSGIS)
+#define glad_glGetPixelTexGenParameterivSGIS (glad_gl_current->glad_glGetPixelTexGenParameterivSGIS)
+#define glad_glGetPixelTexGenParameterfvSGIS (glad_gl_current->glad_glGetPixelTexGenParameterfvSGIS)
+#define glad_glPointParameterfSGIS (glad_gl_current->glad_glPointParameterfSGIS)
+#define glad_glPointParameterfvSGIS (glad_gl_current->glad_glPointParameterfvSGIS)
+#define glad_glSharpenTexFuncSGIS (glad_gl_current->glad_glSharpenTexFuncSGIS)
+#define glad_glGetSharpenTexFuncSGIS (glad_gl_current->glad_glGetSharpenTexFuncSGIS)
+#define glad_glTexImage4DSGIS (glad_gl_current->glad_glTexImage4DSGIS)
+#define glad_glTexSubImage4DSGIS (glad_gl_current->glad_glTexSubImage4DSGIS)
+#define glad_glTextureColorMaskSGIS (glad_gl_current->glad_glTextureColorMaskSGIS)
+#define glad_glGetTexFilterFuncSGIS (glad_gl_current->glad_glGetTexFilterFuncSGIS)
+#define glad_glTexFilterFuncSGIS (glad_gl_current->glad_glTexFilterFuncSGIS)
+#define glad_glAsyncMarkerSGIX (glad_gl_current->glad_glAsyncMarkerSGIX)
+#define glad_glFinishAsyncSGIX (glad_gl_current->glad_glFinishAsyncSGIX)
+#define glad_glPollAsyncSGIX (glad_gl_current->glad_glPollAsyncSGIX)
+#define glad_glGenAsyncMarkersSGIX (glad_gl_current->glad_glGenAsyncMarkersSGIX)
+#define glad_glDeleteAsyncMarkersSGIX (glad_gl_current->glad_glDeleteAsyncMarkersSGIX)
+#define glad_glIsAsyncMarkerSGIX (glad_gl_current->glad_glIsAsyncMarkerSGIX)
+#define glad_glFlushRasterSGIX (glad_gl_current->glad_glFlushRasterSGIX)
+#define glad_glFragmentColorMaterialSGIX (glad_gl_current->glad_glFragmentColorMaterialSGIX)
+#define glad_glFragmentLightfSGIX (glad_gl_current->glad_glFragmentLightfSGIX)
+#define glad_glFragmentLightfvSGIX (glad_gl_current->glad_glFragmentLightfvSGIX)
+#define glad_glFragmentLightiSGIX (glad_gl_current->glad_glFragmentLightiSGIX)
+#define glad_glFragmentLightivSGIX (glad_gl_current->glad_glFragmentLightivSGIX)
+#define glad_glFragmentLightModelfSGIX (glad_gl_current->glad_glFragmentLightModelfSGIX)
+#define glad_glFragmentLightModelfvSGIX (glad_gl_current->glad_glFragmentLightModelfvSGIX)
+#define glad_glFragmentLightModeliSGIX (glad_gl_current->glad_glFragmentLightModeliSGIX)
+#define glad_glFragmentLightModelivSGIX (glad_gl_current->glad_glFragmentLightModelivSGIX)
+#define glad_glFragmentMaterialfSGIX (glad_gl_current->glad_glFragmentMaterialfSGIX)
+#define glad_glFragmentMaterialfvSGIX (glad_gl_current->glad_glFragmentMaterialfvSGIX)
+#define glad_glFragmentMaterialiSGIX (glad_gl_current->glad_glFragmentMaterialiSGIX)
+#define glad_glFragmentMaterialivSGIX (glad_gl_current->glad_glFragmentMaterialivSGIX)
+#define glad_glGetFragmentLightfvSGIX (glad_gl_current->glad_glGetFragmentLightfvSGIX)
+#define glad_glGetFragmentLightivSGIX (glad_gl_current->glad_glGetFragmentLightivSGIX)
+#define glad_glGetFragmentMaterialfvSGIX (glad_gl_current->glad_glGetFragmentMaterialfvSGIX)
+#define glad_glGetFragmentMaterialivSGIX (glad_gl_current->glad_glGetFragmentMaterialivSGIX)
+#define glad_glLightEnviSGIX (glad_gl_current->glad_glLightEnviSGIX)
+#define glad_glFrameZoomSGIX (glad_gl_current->glad_glFrameZoomSGIX)
+#define glad_glIglooInterfaceSGIX (glad_gl_current->glad_glIglooInterfaceSGIX)
+#define glad_glGetInstrumentsSGIX (glad_gl_current->glad_glGetInstrumentsSGIX)
+#define glad_glInstrumentsBufferSGIX (glad_gl_current->glad_glInstrumentsBufferSGIX)
+#define glad_glPollInstrumentsSGIX (glad_gl_current->glad_glPollInstrumentsSGIX)
+#define glad_glReadInstrumentsSGIX (glad_gl_current->glad_glReadInstrumentsSGIX)
+#define glad_glStartInstrumentsSGIX (glad_gl_current->glad_glStartInstrumentsSGIX)
+#define glad_glStopInstrumentsSGIX (glad_gl_current->glad_glStopInstrumentsSGIX)
+#define glad_glGetListParameterfvSGIX (glad_gl_current->glad_glGetListParameterfvSGIX)
+#define glad_glGetListParameterivSGIX (glad_gl_current->glad_glGetListParameterivSGIX)
+#define glad_glListParameterfSGIX (glad_gl_current->glad_glListParameterfSGIX)
+#define glad_glListParameterfvSGIX (glad_gl_current->glad_glListParameterfvSGIX)
+#define glad_glListParameteriSGIX (glad_gl_current->glad_glListParameteriSGIX)
+#define glad_glListParameterivSGIX (glad_gl_current->glad_glListParameterivSGIX)
+#define glad_glPixelTexGenSGIX (glad_gl_current->glad_glPixelTexGenSGIX)
+#define glad_glDeformationMap3dSGIX (glad_gl_current->glad_glDeformationMap3dSGIX)
+#define glad_glDeformationMap3fSGIX (glad_gl_current->glad_glDeformationMap3fSGIX)
+#define glad_glDeformSGIX (glad_gl_current->glad_glDeformSGIX)
+#define glad_glLoadIdentityDeformationMapSGIX (glad_gl_current->glad_glLoadIdentityDeformationMapSGIX)
+#define glad_glReferencePlaneSGIX (glad_gl_current->glad_glReferencePlaneSGIX)
+#define glad_glSpriteParameterfSGIX (glad_gl_current->glad_glSpriteParameterfSGIX)
+#define glad_glSpriteParameterfvSGIX (glad_gl_current->glad_glSpriteParameterfvSGIX)
+#define glad_glSpriteParameteriSGIX (glad_gl_current->glad_glSpriteParameteriSGIX)
+#define glad_glSpriteParameterivSGIX (glad_gl_current->glad_glSpriteParameterivSGIX)
+#define glad_glTagSampleBufferSGIX (glad_gl_current->glad_glTagSampleBufferSGIX)
+#define glad_glColorTableSGI (glad_gl_current->glad_glColorTableSGI)
+#define glad_glColorTableParameterfvSGI (glad_gl_current->glad_glColorTableParameterfvSGI)
+#define glad_glColorTableParameterivSGI (glad_gl_current->glad_glColorTableParameterivSGI)
+#define glad_glCopyColorTableSGI (glad_gl_current->glad_glCopyColorTableSGI)
+#define glad_glGetColorTableSGI (glad_gl_current->glad_glGetColorTableSGI)
+#define glad_glGetColorTableParameterfvSGI (glad_gl_current->glad_glGetColorTableParameterfvSGI)
+#define glad_glGetColorTableParameterivSGI (glad_gl_current->glad_glGetColorTableParameterivSGI)
+#define glad_glFinishTextureSUNX (glad_gl_current->glad_glFinishTextureSUNX)
+#define glad_glGlobalAlphaFactorbSUN (glad_gl_current->glad_glGlobalAlphaFactorbSUN)
+#define glad_glGlobalAlphaFactorsSUN (glad_gl_current->glad_glGlobalAlphaFactorsSUN)
+#define glad_glGlobalAlphaFactoriSUN (glad_gl_current->glad_glGlobalAlphaFactoriSUN)
+#define glad_glGlobalAlphaFactorfSUN (glad_gl_current->glad_glGlobalAlphaFactorfSUN)
+#define glad_glGlobalAlphaFactordSUN (glad_gl_current->glad_glGlobalAlphaFactordSUN)
+#define glad_glGlobalAlphaFactorubSUN (glad_gl_current->glad_glGlobalAlphaFactorubSUN)
+#define glad_glGlobalAlphaFactorusSUN (glad_gl_current->glad_glGlobalAlphaFactorusSUN)
+#define glad_glGlobalAlphaFactoruiSUN (glad_gl_current->glad_glGlobalAlphaFactoruiSUN)
+#define glad_glDrawMeshArraysSUN (glad_gl_current->glad_glDrawMeshArraysSUN)
+#define glad_glReplacementCodeuiSUN (glad_gl_current->glad_glReplacementCodeuiSUN)
+#define glad_glReplacementCodeusSUN (glad_gl_current->glad_glReplacementCodeusSUN)
+#define glad_glReplacementCodeubSUN (glad_gl_current->glad_glReplacementCodeubSUN)
+#define glad_glReplacementCodeuivSUN (glad_gl_current->glad_glReplacementCodeuivSUN)
+#define glad_glReplacementCodeusvSUN (glad_gl_current->glad_glReplacementCodeusvSUN)
+#define glad_glReplacementCodeubvSUN (glad_gl_current->glad_glReplacementCodeubvSUN)
+#define glad_glReplacementCodePointerSUN (glad_gl_current->glad_glReplacementCodePointerSUN)
+#define glad_glColor4ubVertex2fSUN (glad_gl_current->glad_glColor4ubVertex2fSUN)
+#define glad_glColor4ubVertex2fvSUN (glad_gl_current->glad_glColor4ubVertex2fvSUN)
+#define glad_glColor4ubVertex3fSUN (glad_gl_current->glad_glColor4ubVertex3fSUN)
+#define glad_glColor4ubVertex3fvSUN (glad_gl_current->glad_glColor4ubVertex3fvSUN)
+#define glad_glColor3fVertex3fSUN (glad_gl_current->glad_glColor3fVertex3fSUN)
+#define glad_glColor3fVertex3fvSUN (glad_gl_current->glad_glColor3fVertex3fvSUN)
+#define glad_glNormal3fVertex3fSUN (glad_gl_current->glad_glNormal3fVertex3fSUN)
+#define glad_glNormal3fVertex3fvSUN (glad_gl_current->glad_glNormal3fVertex3fvSUN)
+#define glad_glColor4fNormal3fVertex3fSUN (glad_gl_current->glad_glColor4fNormal3fVertex3fSUN)
+#define glad_glColor4fNormal3fVertex3fvSUN (glad_gl_current->glad_glColor4fNormal3fVertex3fvSUN)
+#define glad_glTexCoord2fVertex3fSUN (glad_gl_current->glad_glTexCoord2fVertex3fSUN)
+#define glad_glTexCoord2fVertex3fvSUN (glad_gl_current->glad_glTexCoord2fVertex3fvSUN)
+#define glad_glTexCoord4fVertex4fSUN (glad_gl_current->glad_glTexCoord4fVertex4fSUN)
+#define glad_glTexCoord4fVertex4fvSUN (glad_gl_current->glad_glTexCoord4fVertex4fvSUN)
+#define glad_glTexCoord2fColor4ubVertex3fSUN (glad_gl_current->glad_glTexCoord2fColor4ubVertex3fSUN)
+#define glad_glTexCoord2fColor4ubVertex3fvSUN (glad_gl_current->glad_glTexCoord2fColor4ubVertex3fvSUN)
+#define glad_glTexCoord2fColor3fVertex3fSUN (glad_gl_current->glad_glTexCoord2fColor3fVertex3fSUN)
+#define glad_glTexCoord2fColor3fVertex3fvSUN (glad_gl_current->glad_glTexCoord2fColor3fVertex3fvSUN)
+#define glad_glTexCoord2fNormal3fVertex3fSUN (glad_gl_current->glad_glTexCoord2fNormal3fVertex3fSUN)
+#define glad_glTexCoord2fNormal3fVertex3fvSUN (glad_gl_current->glad_glTexCoord2fNormal3fVertex3fvSUN)
+#define glad_glTexCoord2fColor4fNormal3fVertex3fSUN (glad_gl_current->glad_glTexCoord2fColor4fNormal3fVertex3fSUN)
+#define glad_glTexCoord2fColor4fNormal3fVertex3fvSUN (glad_gl_current->glad_glTexCoord2fColor4fNormal3fVertex3fvSUN)
+#define glad_glTexCoord4fColor4fNormal3fVertex4fSUN (glad_gl_current->glad_glTexCoord4fColor4fNormal3fVertex4fSUN)
+#define glad_glTexCoord4fColor4fNormal3fVertex4fvSUN (glad_gl_current->glad_glTexCoord4fColor4fNormal3fVertex4fvSUN)
+#define glad_glReplacementCodeuiVertex3fSUN (glad_gl_current->glad_glReplacementCodeuiVertex3fSUN)
+#define glad_glReplacementCodeuiVertex3fvSUN (glad_gl_current->glad_glReplacementCodeuiVertex3fvSUN)
+#define glad_glReplacementCodeuiColor4ubVertex3fSUN (glad_gl_current->glad_glReplacementCodeuiColor4ubVertex3fSUN)
+#define glad_glReplacementCodeuiColor4ubVertex3fvSUN (glad_gl_current->glad_glReplacementCodeuiColor4ubVertex3fvSUN)
+#define glad_glReplacementCodeuiColor3fVertex3fSUN (glad_gl_current->glad_glReplacementCodeuiColor3fVertex3fSUN)
+#define glad_glReplacementCodeuiColor3fVertex3fvSUN (glad_gl_current->glad_glReplacementCodeuiColor3fVertex3fvSUN)
+#define glad_glReplacementCodeuiNormal3fVertex3fSUN (glad_gl_current->glad_glReplacementCodeuiNormal3fVertex3fSUN)
+#define glad_glReplacementCodeuiNormal3fVertex3fvSUN (glad_gl_current->glad_glReplacementCodeuiNormal3fVertex3fvSUN)
+#define glad_glReplacementCodeuiColor4fNormal3fVertex3fSUN (glad_gl_current->glad_glReplacementCodeuiColor4fNormal3fVertex3fSUN)
+#define glad_glReplacementCodeuiColor4fNormal3fVertex3fvSUN (glad_gl_current->glad_glReplacementCodeuiColor4fNormal3fVertex3fvSUN)
+#define glad_glReplacementCodeuiTexCoord2fVertex3fSUN (glad_gl_current->glad_glReplacementCodeuiTexCoord2fVertex3fSUN)
+#define glad_glReplacementCodeuiTexCoord2fVertex3fvSUN (glad_gl_current->glad_glReplacementCodeuiTexCoord2fVertex3fvSUN)
+#define glad_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN (glad_gl_current->glad_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN)
+#define glad_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN (glad_gl_current->glad_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN)
+#define glad_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN (glad_gl_current->glad_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN)
+#define glad_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN (glad_gl_current->glad_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN)
+
+#endif
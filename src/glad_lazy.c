@@ -0,0 +1,18074 @@
+// Generated by tools/gladgen.py from src/glad/glad.h. Do not edit.
+//
+// Each lazy_gl* trampoline resolves its entry point on first use, stores
+// it in the current context's glad_gl* entry and forwards the call.
+
+#include <glad/glad.h>
+
+void* gladLazyResolve(const char* name);
+void gladInstallLazyGL(void);
+
+static void APIENTRY lazy_glCullFace(GLenum mode) {
+	glad_glCullFace = (PFNGLCULLFACEPROC)gladLazyResolve("glCullFace");
+	glad_glCullFace(mode);
+}
+
+static void APIENTRY lazy_glFrontFace(GLenum mode) {
+	glad_glFrontFace = (PFNGLFRONTFACEPROC)gladLazyResolve("glFrontFace");
+	glad_glFrontFace(mode);
+}
+
+static void APIENTRY lazy_glHint(GLenum target, GLenum mode) {
+	glad_glHint = (PFNGLHINTPROC)gladLazyResolve("glHint");
+	glad_glHint(target, mode);
+}
+
+static void APIENTRY lazy_glLineWidth(GLfloat width) {
+	glad_glLineWidth = (PFNGLLINEWIDTHPROC)gladLazyResolve("glLineWidth");
+	glad_glLineWidth(width);
+}
+
+static void APIENTRY lazy_glPointSize(GLfloat size) {
+	glad_glPointSize = (PFNGLPOINTSIZEPROC)gladLazyResolve("glPointSize");
+	glad_glPointSize(size);
+}
+
+static void APIENTRY lazy_glPolygonMode(GLenum face, GLenum mode) {
+	glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)gladLazyResolve("glPolygonMode");
+	glad_glPolygonMode(face, mode);
+}
+
+static void APIENTRY lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glScissor = (PFNGLSCISSORPROC)gladLazyResolve("glScissor");
+	glad_glScissor(x, y, width, height);
+}
+
+static void APIENTRY lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)gladLazyResolve("glTexParameterf");
+	glad_glTexParameterf(target, pname, param);
+}
+
+static void APIENTRY lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)gladLazyResolve("glTexParameterfv");
+	glad_glTexParameterfv(target, pname, params);
+}
+
+static void APIENTRY lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)gladLazyResolve("glTexParameteri");
+	glad_glTexParameteri(target, pname, param);
+}
+
+static void APIENTRY lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)gladLazyResolve("glTexParameteriv");
+	glad_glTexParameteriv(target, pname, params);
+}
+
+static void APIENTRY lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)gladLazyResolve("glTexImage1D");
+	glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+
+static void APIENTRY lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)gladLazyResolve("glTexImage2D");
+	glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void APIENTRY lazy_glDrawBuffer(GLenum buf) {
+	glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)gladLazyResolve("glDrawBuffer");
+	glad_glDrawBuffer(buf);
+}
+
+static void APIENTRY lazy_glClear(GLbitfield mask) {
+	glad_glClear = (PFNGLCLEARPROC)gladLazyResolve("glClear");
+	glad_glClear(mask);
+}
+
+static void APIENTRY lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glClearColor = (PFNGLCLEARCOLORPROC)gladLazyResolve("glClearColor");
+	glad_glClearColor(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glClearStencil(GLint s) {
+	glad_glClearStencil = (PFNGLCLEARSTENCILPROC)gladLazyResolve("glClearStencil");
+	glad_glClearStencil(s);
+}
+
+static void APIENTRY lazy_glClearDepth(GLdouble depth) {
+	glad_glClearDepth = (PFNGLCLEARDEPTHPROC)gladLazyResolve("glClearDepth");
+	glad_glClearDepth(depth);
+}
+
+static void APIENTRY lazy_glStencilMask(GLuint mask) {
+	glad_glStencilMask = (PFNGLSTENCILMASKPROC)gladLazyResolve("glStencilMask");
+	glad_glStencilMask(mask);
+}
+
+static void APIENTRY lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	glad_glColorMask = (PFNGLCOLORMASKPROC)gladLazyResolve("glColorMask");
+	glad_glColorMask(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glDepthMask(GLboolean flag) {
+	glad_glDepthMask = (PFNGLDEPTHMASKPROC)gladLazyResolve("glDepthMask");
+	glad_glDepthMask(flag);
+}
+
+static void APIENTRY lazy_glDisable(GLenum cap) {
+	glad_glDisable = (PFNGLDISABLEPROC)gladLazyResolve("glDisable");
+	glad_glDisable(cap);
+}
+
+static void APIENTRY lazy_glEnable(GLenum cap) {
+	glad_glEnable = (PFNGLENABLEPROC)gladLazyResolve("glEnable");
+	glad_glEnable(cap);
+}
+
+static void APIENTRY lazy_glFinish(void) {
+	glad_glFinish = (PFNGLFINISHPROC)gladLazyResolve("glFinish");
+	glad_glFinish();
+}
+
+static void APIENTRY lazy_glFlush(void) {
+	glad_glFlush = (PFNGLFLUSHPROC)gladLazyResolve("glFlush");
+	glad_glFlush();
+}
+
+static void APIENTRY lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	glad_glBlendFunc = (PFNGLBLENDFUNCPROC)gladLazyResolve("glBlendFunc");
+	glad_glBlendFunc(sfactor, dfactor);
+}
+
+static void APIENTRY lazy_glLogicOp(GLenum opcode) {
+	glad_glLogicOp = (PFNGLLOGICOPPROC)gladLazyResolve("glLogicOp");
+	glad_glLogicOp(opcode);
+}
+
+static void APIENTRY lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)gladLazyResolve("glStencilFunc");
+	glad_glStencilFunc(func, ref, mask);
+}
+
+static void APIENTRY lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	glad_glStencilOp = (PFNGLSTENCILOPPROC)gladLazyResolve("glStencilOp");
+	glad_glStencilOp(fail, zfail, zpass);
+}
+
+static void APIENTRY lazy_glDepthFunc(GLenum func) {
+	glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)gladLazyResolve("glDepthFunc");
+	glad_glDepthFunc(func);
+}
+
+static void APIENTRY lazy_glPixelStoref(GLenum pname, GLfloat param) {
+	glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)gladLazyResolve("glPixelStoref");
+	glad_glPixelStoref(pname, param);
+}
+
+static void APIENTRY lazy_glPixelStorei(GLenum pname, GLint param) {
+	glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)gladLazyResolve("glPixelStorei");
+	glad_glPixelStorei(pname, param);
+}
+
+static void APIENTRY lazy_glReadBuffer(GLenum src) {
+	glad_glReadBuffer = (PFNGLREADBUFFERPROC)gladLazyResolve("glReadBuffer");
+	glad_glReadBuffer(src);
+}
+
+static void APIENTRY lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	glad_glReadPixels = (PFNGLREADPIXELSPROC)gladLazyResolve("glReadPixels");
+	glad_glReadPixels(x, y, width, height, format, type, pixels);
+}
+
+static void APIENTRY lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+	glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)gladLazyResolve("glGetBooleanv");
+	glad_glGetBooleanv(pname, data);
+}
+
+static void APIENTRY lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+	glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)gladLazyResolve("glGetDoublev");
+	glad_glGetDoublev(pname, data);
+}
+
+static GLenum APIENTRY lazy_glGetError(void) {
+	glad_glGetError = (PFNGLGETERRORPROC)gladLazyResolve("glGetError");
+	return glad_glGetError();
+}
+
+static void APIENTRY lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+	glad_glGetFloatv = (PFNGLGETFLOATVPROC)gladLazyResolve("glGetFloatv");
+	glad_glGetFloatv(pname, data);
+}
+
+static void APIENTRY lazy_glGetIntegerv(GLenum pname, GLint *data) {
+	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)gladLazyResolve("glGetIntegerv");
+	glad_glGetIntegerv(pname, data);
+}
+
+static const GLubyte * APIENTRY lazy_glGetString(GLenum name) {
+	glad_glGetString = (PFNGLGETSTRINGPROC)gladLazyResolve("glGetString");
+	return glad_glGetString(name);
+}
+
+static void APIENTRY lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)gladLazyResolve("glGetTexImage");
+	glad_glGetTexImage(target, level, format, type, pixels);
+}
+
+static void APIENTRY lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)gladLazyResolve("glGetTexParameterfv");
+	glad_glGetTexParameterfv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)gladLazyResolve("glGetTexParameteriv");
+	glad_glGetTexParameteriv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)gladLazyResolve("glGetTexLevelParameterfv");
+	glad_glGetTexLevelParameterfv(target, level, pname, params);
+}
+
+static void APIENTRY lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)gladLazyResolve("glGetTexLevelParameteriv");
+	glad_glGetTexLevelParameteriv(target, level, pname, params);
+}
+
+static GLboolean APIENTRY lazy_glIsEnabled(GLenum cap) {
+	glad_glIsEnabled = (PFNGLISENABLEDPROC)gladLazyResolve("glIsEnabled");
+	return glad_glIsEnabled(cap);
+}
+
+static void APIENTRY lazy_glDepthRange(GLdouble n, GLdouble f) {
+	glad_glDepthRange = (PFNGLDEPTHRANGEPROC)gladLazyResolve("glDepthRange");
+	glad_glDepthRange(n, f);
+}
+
+static void APIENTRY lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glViewport = (PFNGLVIEWPORTPROC)gladLazyResolve("glViewport");
+	glad_glViewport(x, y, width, height);
+}
+
+#ifndef GLAD_CORE_PROFILE
+static void APIENTRY lazy_glNewList(GLuint list, GLenum mode) {
+	glad_glNewList = (PFNGLNEWLISTPROC)gladLazyResolve("glNewList");
+	glad_glNewList(list, mode);
+}
+
+static void APIENTRY lazy_glEndList(void) {
+	glad_glEndList = (PFNGLENDLISTPROC)gladLazyResolve("glEndList");
+	glad_glEndList();
+}
+
+static void APIENTRY lazy_glCallList(GLuint list) {
+	glad_glCallList = (PFNGLCALLLISTPROC)gladLazyResolve("glCallList");
+	glad_glCallList(list);
+}
+
+static void APIENTRY lazy_glCallLists(GLsizei n, GLenum type, const void *lists) {
+	glad_glCallLists = (PFNGLCALLLISTSPROC)gladLazyResolve("glCallLists");
+	glad_glCallLists(n, type, lists);
+}
+
+static void APIENTRY lazy_glDeleteLists(GLuint list, GLsizei range) {
+	glad_glDeleteLists = (PFNGLDELETELISTSPROC)gladLazyResolve("glDeleteLists");
+	glad_glDeleteLists(list, range);
+}
+
+static GLuint APIENTRY lazy_glGenLists(GLsizei range) {
+	glad_glGenLists = (PFNGLGENLISTSPROC)gladLazyResolve("glGenLists");
+	return glad_glGenLists(range);
+}
+
+static void APIENTRY lazy_glListBase(GLuint base) {
+	glad_glListBase = (PFNGLLISTBASEPROC)gladLazyResolve("glListBase");
+	glad_glListBase(base);
+}
+
+static void APIENTRY lazy_glBegin(GLenum mode) {
+	glad_glBegin = (PFNGLBEGINPROC)gladLazyResolve("glBegin");
+	glad_glBegin(mode);
+}
+
+static void APIENTRY lazy_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+	glad_glBitmap = (PFNGLBITMAPPROC)gladLazyResolve("glBitmap");
+	glad_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+
+static void APIENTRY lazy_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	glad_glColor3b = (PFNGLCOLOR3BPROC)gladLazyResolve("glColor3b");
+	glad_glColor3b(red, green, blue);
+}
+
+static void APIENTRY lazy_glColor3bv(const GLbyte *v) {
+	glad_glColor3bv = (PFNGLCOLOR3BVPROC)gladLazyResolve("glColor3bv");
+	glad_glColor3bv(v);
+}
+
+static void APIENTRY lazy_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	glad_glColor3d = (PFNGLCOLOR3DPROC)gladLazyResolve("glColor3d");
+	glad_glColor3d(red, green, blue);
+}
+
+static void APIENTRY lazy_glColor3dv(const GLdouble *v) {
+	glad_glColor3dv = (PFNGLCOLOR3DVPROC)gladLazyResolve("glColor3dv");
+	glad_glColor3dv(v);
+}
+
+static void APIENTRY lazy_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	glad_glColor3f = (PFNGLCOLOR3FPROC)gladLazyResolve("glColor3f");
+	glad_glColor3f(red, green, blue);
+}
+
+static void APIENTRY lazy_glColor3fv(const GLfloat *v) {
+	glad_glColor3fv = (PFNGLCOLOR3FVPROC)gladLazyResolve("glColor3fv");
+	glad_glColor3fv(v);
+}
+
+static void APIENTRY lazy_glColor3i(GLint red, GLint green, GLint blue) {
+	glad_glColor3i = (PFNGLCOLOR3IPROC)gladLazyResolve("glColor3i");
+	glad_glColor3i(red, green, blue);
+}
+
+static void APIENTRY lazy_glColor3iv(const GLint *v) {
+	glad_glColor3iv = (PFNGLCOLOR3IVPROC)gladLazyResolve("glColor3iv");
+	glad_glColor3iv(v);
+}
+
+static void APIENTRY lazy_glColor3s(GLshort red, GLshort green, GLshort blue) {
+	glad_glColor3s = (PFNGLCOLOR3SPROC)gladLazyResolve("glColor3s");
+	glad_glColor3s(red, green, blue);
+}
+
+static void APIENTRY lazy_glColor3sv(const GLshort *v) {
+	glad_glColor3sv = (PFNGLCOLOR3SVPROC)gladLazyResolve("glColor3sv");
+	glad_glColor3sv(v);
+}
+
+static void APIENTRY lazy_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	glad_glColor3ub = (PFNGLCOLOR3UBPROC)gladLazyResolve("glColor3ub");
+	glad_glColor3ub(red, green, blue);
+}
+
+static void APIENTRY lazy_glColor3ubv(const GLubyte *v) {
+	glad_glColor3ubv = (PFNGLCOLOR3UBVPROC)gladLazyResolve("glColor3ubv");
+	glad_glColor3ubv(v);
+}
+
+static void APIENTRY lazy_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+	glad_glColor3ui = (PFNGLCOLOR3UIPROC)gladLazyResolve("glColor3ui");
+	glad_glColor3ui(red, green, blue);
+}
+
+static void APIENTRY lazy_glColor3uiv(const GLuint *v) {
+	glad_glColor3uiv = (PFNGLCOLOR3UIVPROC)gladLazyResolve("glColor3uiv");
+	glad_glColor3uiv(v);
+}
+
+static void APIENTRY lazy_glColor3us(GLushort red, GLushort green, GLushort blue) {
+	glad_glColor3us = (PFNGLCOLOR3USPROC)gladLazyResolve("glColor3us");
+	glad_glColor3us(red, green, blue);
+}
+
+static void APIENTRY lazy_glColor3usv(const GLushort *v) {
+	glad_glColor3usv = (PFNGLCOLOR3USVPROC)gladLazyResolve("glColor3usv");
+	glad_glColor3usv(v);
+}
+
+static void APIENTRY lazy_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+	glad_glColor4b = (PFNGLCOLOR4BPROC)gladLazyResolve("glColor4b");
+	glad_glColor4b(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glColor4bv(const GLbyte *v) {
+	glad_glColor4bv = (PFNGLCOLOR4BVPROC)gladLazyResolve("glColor4bv");
+	glad_glColor4bv(v);
+}
+
+static void APIENTRY lazy_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+	glad_glColor4d = (PFNGLCOLOR4DPROC)gladLazyResolve("glColor4d");
+	glad_glColor4d(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glColor4dv(const GLdouble *v) {
+	glad_glColor4dv = (PFNGLCOLOR4DVPROC)gladLazyResolve("glColor4dv");
+	glad_glColor4dv(v);
+}
+
+static void APIENTRY lazy_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glColor4f = (PFNGLCOLOR4FPROC)gladLazyResolve("glColor4f");
+	glad_glColor4f(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glColor4fv(const GLfloat *v) {
+	glad_glColor4fv = (PFNGLCOLOR4FVPROC)gladLazyResolve("glColor4fv");
+	glad_glColor4fv(v);
+}
+
+static void APIENTRY lazy_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+	glad_glColor4i = (PFNGLCOLOR4IPROC)gladLazyResolve("glColor4i");
+	glad_glColor4i(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glColor4iv(const GLint *v) {
+	glad_glColor4iv = (PFNGLCOLOR4IVPROC)gladLazyResolve("glColor4iv");
+	glad_glColor4iv(v);
+}
+
+static void APIENTRY lazy_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+	glad_glColor4s = (PFNGLCOLOR4SPROC)gladLazyResolve("glColor4s");
+	glad_glColor4s(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glColor4sv(const GLshort *v) {
+	glad_glColor4sv = (PFNGLCOLOR4SVPROC)gladLazyResolve("glColor4sv");
+	glad_glColor4sv(v);
+}
+
+static void APIENTRY lazy_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+	glad_glColor4ub = (PFNGLCOLOR4UBPROC)gladLazyResolve("glColor4ub");
+	glad_glColor4ub(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glColor4ubv(const GLubyte *v) {
+	glad_glColor4ubv = (PFNGLCOLOR4UBVPROC)gladLazyResolve("glColor4ubv");
+	glad_glColor4ubv(v);
+}
+
+static void APIENTRY lazy_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+	glad_glColor4ui = (PFNGLCOLOR4UIPROC)gladLazyResolve("glColor4ui");
+	glad_glColor4ui(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glColor4uiv(const GLuint *v) {
+	glad_glColor4uiv = (PFNGLCOLOR4UIVPROC)gladLazyResolve("glColor4uiv");
+	glad_glColor4uiv(v);
+}
+
+static void APIENTRY lazy_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+	glad_glColor4us = (PFNGLCOLOR4USPROC)gladLazyResolve("glColor4us");
+	glad_glColor4us(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glColor4usv(const GLushort *v) {
+	glad_glColor4usv = (PFNGLCOLOR4USVPROC)gladLazyResolve("glColor4usv");
+	glad_glColor4usv(v);
+}
+
+static void APIENTRY lazy_glEdgeFlag(GLboolean flag) {
+	glad_glEdgeFlag = (PFNGLEDGEFLAGPROC)gladLazyResolve("glEdgeFlag");
+	glad_glEdgeFlag(flag);
+}
+
+static void APIENTRY lazy_glEdgeFlagv(const GLboolean *flag) {
+	glad_glEdgeFlagv = (PFNGLEDGEFLAGVPROC)gladLazyResolve("glEdgeFlagv");
+	glad_glEdgeFlagv(flag);
+}
+
+static void APIENTRY lazy_glEnd(void) {
+	glad_glEnd = (PFNGLENDPROC)gladLazyResolve("glEnd");
+	glad_glEnd();
+}
+
+static void APIENTRY lazy_glIndexd(GLdouble c) {
+	glad_glIndexd = (PFNGLINDEXDPROC)gladLazyResolve("glIndexd");
+	glad_glIndexd(c);
+}
+
+static void APIENTRY lazy_glIndexdv(const GLdouble *c) {
+	glad_glIndexdv = (PFNGLINDEXDVPROC)gladLazyResolve("glIndexdv");
+	glad_glIndexdv(c);
+}
+
+static void APIENTRY lazy_glIndexf(GLfloat c) {
+	glad_glIndexf = (PFNGLINDEXFPROC)gladLazyResolve("glIndexf");
+	glad_glIndexf(c);
+}
+
+static void APIENTRY lazy_glIndexfv(const GLfloat *c) {
+	glad_glIndexfv = (PFNGLINDEXFVPROC)gladLazyResolve("glIndexfv");
+	glad_glIndexfv(c);
+}
+
+static void APIENTRY lazy_glIndexi(GLint c) {
+	glad_glIndexi = (PFNGLINDEXIPROC)gladLazyResolve("glIndexi");
+	glad_glIndexi(c);
+}
+
+static void APIENTRY lazy_glIndexiv(const GLint *c) {
+	glad_glIndexiv = (PFNGLINDEXIVPROC)gladLazyResolve("glIndexiv");
+	glad_glIndexiv(c);
+}
+
+static void APIENTRY lazy_glIndexs(GLshort c) {
+	glad_glIndexs = (PFNGLINDEXSPROC)gladLazyResolve("glIndexs");
+	glad_glIndexs(c);
+}
+
+static void APIENTRY lazy_glIndexsv(const GLshort *c) {
+	glad_glIndexsv = (PFNGLINDEXSVPROC)gladLazyResolve("glIndexsv");
+	glad_glIndexsv(c);
+}
+
+static void APIENTRY lazy_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+	glad_glNormal3b = (PFNGLNORMAL3BPROC)gladLazyResolve("glNormal3b");
+	glad_glNormal3b(nx, ny, nz);
+}
+
+static void APIENTRY lazy_glNormal3bv(const GLbyte *v) {
+	glad_glNormal3bv = (PFNGLNORMAL3BVPROC)gladLazyResolve("glNormal3bv");
+	glad_glNormal3bv(v);
+}
+
+static void APIENTRY lazy_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+	glad_glNormal3d = (PFNGLNORMAL3DPROC)gladLazyResolve("glNormal3d");
+	glad_glNormal3d(nx, ny, nz);
+}
+
+static void APIENTRY lazy_glNormal3dv(const GLdouble *v) {
+	glad_glNormal3dv = (PFNGLNORMAL3DVPROC)gladLazyResolve("glNormal3dv");
+	glad_glNormal3dv(v);
+}
+
+static void APIENTRY lazy_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+	glad_glNormal3f = (PFNGLNORMAL3FPROC)gladLazyResolve("glNormal3f");
+	glad_glNormal3f(nx, ny, nz);
+}
+
+static void APIENTRY lazy_glNormal3fv(const GLfloat *v) {
+	glad_glNormal3fv = (PFNGLNORMAL3FVPROC)gladLazyResolve("glNormal3fv");
+	glad_glNormal3fv(v);
+}
+
+static void APIENTRY lazy_glNormal3i(GLint nx, GLint ny, GLint nz) {
+	glad_glNormal3i = (PFNGLNORMAL3IPROC)gladLazyResolve("glNormal3i");
+	glad_glNormal3i(nx, ny, nz);
+}
+
+static void APIENTRY lazy_glNormal3iv(const GLint *v) {
+	glad_glNormal3iv = (PFNGLNORMAL3IVPROC)gladLazyResolve("glNormal3iv");
+	glad_glNormal3iv(v);
+}
+
+static void APIENTRY lazy_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+	glad_glNormal3s = (PFNGLNORMAL3SPROC)gladLazyResolve("glNormal3s");
+	glad_glNormal3s(nx, ny, nz);
+}
+
+static void APIENTRY lazy_glNormal3sv(const GLshort *v) {
+	glad_glNormal3sv = (PFNGLNORMAL3SVPROC)gladLazyResolve("glNormal3sv");
+	glad_glNormal3sv(v);
+}
+
+static void APIENTRY lazy_glRasterPos2d(GLdouble x, GLdouble y) {
+	glad_glRasterPos2d = (PFNGLRASTERPOS2DPROC)gladLazyResolve("glRasterPos2d");
+	glad_glRasterPos2d(x, y);
+}
+
+static void APIENTRY lazy_glRasterPos2dv(const GLdouble *v) {
+	glad_glRasterPos2dv = (PFNGLRASTERPOS2DVPROC)gladLazyResolve("glRasterPos2dv");
+	glad_glRasterPos2dv(v);
+}
+
+static void APIENTRY lazy_glRasterPos2f(GLfloat x, GLfloat y) {
+	glad_glRasterPos2f = (PFNGLRASTERPOS2FPROC)gladLazyResolve("glRasterPos2f");
+	glad_glRasterPos2f(x, y);
+}
+
+static void APIENTRY lazy_glRasterPos2fv(const GLfloat *v) {
+	glad_glRasterPos2fv = (PFNGLRASTERPOS2FVPROC)gladLazyResolve("glRasterPos2fv");
+	glad_glRasterPos2fv(v);
+}
+
+static void APIENTRY lazy_glRasterPos2i(GLint x, GLint y) {
+	glad_glRasterPos2i = (PFNGLRASTERPOS2IPROC)gladLazyResolve("glRasterPos2i");
+	glad_glRasterPos2i(x, y);
+}
+
+static void APIENTRY lazy_glRasterPos2iv(const GLint *v) {
+	glad_glRasterPos2iv = (PFNGLRASTERPOS2IVPROC)gladLazyResolve("glRasterPos2iv");
+	glad_glRasterPos2iv(v);
+}
+
+static void APIENTRY lazy_glRasterPos2s(GLshort x, GLshort y) {
+	glad_glRasterPos2s = (PFNGLRASTERPOS2SPROC)gladLazyResolve("glRasterPos2s");
+	glad_glRasterPos2s(x, y);
+}
+
+static void APIENTRY lazy_glRasterPos2sv(const GLshort *v) {
+	glad_glRasterPos2sv = (PFNGLRASTERPOS2SVPROC)gladLazyResolve("glRasterPos2sv");
+	glad_glRasterPos2sv(v);
+}
+
+static void APIENTRY lazy_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glRasterPos3d = (PFNGLRASTERPOS3DPROC)gladLazyResolve("glRasterPos3d");
+	glad_glRasterPos3d(x, y, z);
+}
+
+static void APIENTRY lazy_glRasterPos3dv(const GLdouble *v) {
+	glad_glRasterPos3dv = (PFNGLRASTERPOS3DVPROC)gladLazyResolve("glRasterPos3dv");
+	glad_glRasterPos3dv(v);
+}
+
+static void APIENTRY lazy_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glRasterPos3f = (PFNGLRASTERPOS3FPROC)gladLazyResolve("glRasterPos3f");
+	glad_glRasterPos3f(x, y, z);
+}
+
+static void APIENTRY lazy_glRasterPos3fv(const GLfloat *v) {
+	glad_glRasterPos3fv = (PFNGLRASTERPOS3FVPROC)gladLazyResolve("glRasterPos3fv");
+	glad_glRasterPos3fv(v);
+}
+
+static void APIENTRY lazy_glRasterPos3i(GLint x, GLint y, GLint z) {
+	glad_glRasterPos3i = (PFNGLRASTERPOS3IPROC)gladLazyResolve("glRasterPos3i");
+	glad_glRasterPos3i(x, y, z);
+}
+
+static void APIENTRY lazy_glRasterPos3iv(const GLint *v) {
+	glad_glRasterPos3iv = (PFNGLRASTERPOS3IVPROC)gladLazyResolve("glRasterPos3iv");
+	glad_glRasterPos3iv(v);
+}
+
+static void APIENTRY lazy_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+	glad_glRasterPos3s = (PFNGLRASTERPOS3SPROC)gladLazyResolve("glRasterPos3s");
+	glad_glRasterPos3s(x, y, z);
+}
+
+static void APIENTRY lazy_glRasterPos3sv(const GLshort *v) {
+	glad_glRasterPos3sv = (PFNGLRASTERPOS3SVPROC)gladLazyResolve("glRasterPos3sv");
+	glad_glRasterPos3sv(v);
+}
+
+static void APIENTRY lazy_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glRasterPos4d = (PFNGLRASTERPOS4DPROC)gladLazyResolve("glRasterPos4d");
+	glad_glRasterPos4d(x, y, z, w);
+}
+
+static void APIENTRY lazy_glRasterPos4dv(const GLdouble *v) {
+	glad_glRasterPos4dv = (PFNGLRASTERPOS4DVPROC)gladLazyResolve("glRasterPos4dv");
+	glad_glRasterPos4dv(v);
+}
+
+static void APIENTRY lazy_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glRasterPos4f = (PFNGLRASTERPOS4FPROC)gladLazyResolve("glRasterPos4f");
+	glad_glRasterPos4f(x, y, z, w);
+}
+
+static void APIENTRY lazy_glRasterPos4fv(const GLfloat *v) {
+	glad_glRasterPos4fv = (PFNGLRASTERPOS4FVPROC)gladLazyResolve("glRasterPos4fv");
+	glad_glRasterPos4fv(v);
+}
+
+static void APIENTRY lazy_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+	glad_glRasterPos4i = (PFNGLRASTERPOS4IPROC)gladLazyResolve("glRasterPos4i");
+	glad_glRasterPos4i(x, y, z, w);
+}
+
+static void APIENTRY lazy_glRasterPos4iv(const GLint *v) {
+	glad_glRasterPos4iv = (PFNGLRASTERPOS4IVPROC)gladLazyResolve("glRasterPos4iv");
+	glad_glRasterPos4iv(v);
+}
+
+static void APIENTRY lazy_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glRasterPos4s = (PFNGLRASTERPOS4SPROC)gladLazyResolve("glRasterPos4s");
+	glad_glRasterPos4s(x, y, z, w);
+}
+
+static void APIENTRY lazy_glRasterPos4sv(const GLshort *v) {
+	glad_glRasterPos4sv = (PFNGLRASTERPOS4SVPROC)gladLazyResolve("glRasterPos4sv");
+	glad_glRasterPos4sv(v);
+}
+
+static void APIENTRY lazy_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+	glad_glRectd = (PFNGLRECTDPROC)gladLazyResolve("glRectd");
+	glad_glRectd(x1, y1, x2, y2);
+}
+
+static void APIENTRY lazy_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+	glad_glRectdv = (PFNGLRECTDVPROC)gladLazyResolve("glRectdv");
+	glad_glRectdv(v1, v2);
+}
+
+static void APIENTRY lazy_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+	glad_glRectf = (PFNGLRECTFPROC)gladLazyResolve("glRectf");
+	glad_glRectf(x1, y1, x2, y2);
+}
+
+static void APIENTRY lazy_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+	glad_glRectfv = (PFNGLRECTFVPROC)gladLazyResolve("glRectfv");
+	glad_glRectfv(v1, v2);
+}
+
+static void APIENTRY lazy_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+	glad_glRecti = (PFNGLRECTIPROC)gladLazyResolve("glRecti");
+	glad_glRecti(x1, y1, x2, y2);
+}
+
+static void APIENTRY lazy_glRectiv(const GLint *v1, const GLint *v2) {
+	glad_glRectiv = (PFNGLRECTIVPROC)gladLazyResolve("glRectiv");
+	glad_glRectiv(v1, v2);
+}
+
+static void APIENTRY lazy_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+	glad_glRects = (PFNGLRECTSPROC)gladLazyResolve("glRects");
+	glad_glRects(x1, y1, x2, y2);
+}
+
+static void APIENTRY lazy_glRectsv(const GLshort *v1, const GLshort *v2) {
+	glad_glRectsv = (PFNGLRECTSVPROC)gladLazyResolve("glRectsv");
+	glad_glRectsv(v1, v2);
+}
+
+static void APIENTRY lazy_glTexCoord1d(GLdouble s) {
+	glad_glTexCoord1d = (PFNGLTEXCOORD1DPROC)gladLazyResolve("glTexCoord1d");
+	glad_glTexCoord1d(s);
+}
+
+static void APIENTRY lazy_glTexCoord1dv(const GLdouble *v) {
+	glad_glTexCoord1dv = (PFNGLTEXCOORD1DVPROC)gladLazyResolve("glTexCoord1dv");
+	glad_glTexCoord1dv(v);
+}
+
+static void APIENTRY lazy_glTexCoord1f(GLfloat s) {
+	glad_glTexCoord1f = (PFNGLTEXCOORD1FPROC)gladLazyResolve("glTexCoord1f");
+	glad_glTexCoord1f(s);
+}
+
+static void APIENTRY lazy_glTexCoord1fv(const GLfloat *v) {
+	glad_glTexCoord1fv = (PFNGLTEXCOORD1FVPROC)gladLazyResolve("glTexCoord1fv");
+	glad_glTexCoord1fv(v);
+}
+
+static void APIENTRY lazy_glTexCoord1i(GLint s) {
+	glad_glTexCoord1i = (PFNGLTEXCOORD1IPROC)gladLazyResolve("glTexCoord1i");
+	glad_glTexCoord1i(s);
+}
+
+static void APIENTRY lazy_glTexCoord1iv(const GLint *v) {
+	glad_glTexCoord1iv = (PFNGLTEXCOORD1IVPROC)gladLazyResolve("glTexCoord1iv");
+	glad_glTexCoord1iv(v);
+}
+
+static void APIENTRY lazy_glTexCoord1s(GLshort s) {
+	glad_glTexCoord1s = (PFNGLTEXCOORD1SPROC)gladLazyResolve("glTexCoord1s");
+	glad_glTexCoord1s(s);
+}
+
+static void APIENTRY lazy_glTexCoord1sv(const GLshort *v) {
+	glad_glTexCoord1sv = (PFNGLTEXCOORD1SVPROC)gladLazyResolve("glTexCoord1sv");
+	glad_glTexCoord1sv(v);
+}
+
+static void APIENTRY lazy_glTexCoord2d(GLdouble s, GLdouble t) {
+	glad_glTexCoord2d = (PFNGLTEXCOORD2DPROC)gladLazyResolve("glTexCoord2d");
+	glad_glTexCoord2d(s, t);
+}
+
+static void APIENTRY lazy_glTexCoord2dv(const GLdouble *v) {
+	glad_glTexCoord2dv = (PFNGLTEXCOORD2DVPROC)gladLazyResolve("glTexCoord2dv");
+	glad_glTexCoord2dv(v);
+}
+
+static void APIENTRY lazy_glTexCoord2f(GLfloat s, GLfloat t) {
+	glad_glTexCoord2f = (PFNGLTEXCOORD2FPROC)gladLazyResolve("glTexCoord2f");
+	glad_glTexCoord2f(s, t);
+}
+
+static void APIENTRY lazy_glTexCoord2fv(const GLfloat *v) {
+	glad_glTexCoord2fv = (PFNGLTEXCOORD2FVPROC)gladLazyResolve("glTexCoord2fv");
+	glad_glTexCoord2fv(v);
+}
+
+static void APIENTRY lazy_glTexCoord2i(GLint s, GLint t) {
+	glad_glTexCoord2i = (PFNGLTEXCOORD2IPROC)gladLazyResolve("glTexCoord2i");
+	glad_glTexCoord2i(s, t);
+}
+
+static void APIENTRY lazy_glTexCoord2iv(const GLint *v) {
+	glad_glTexCoord2iv = (PFNGLTEXCOORD2IVPROC)gladLazyResolve("glTexCoord2iv");
+	glad_glTexCoord2iv(v);
+}
+
+static void APIENTRY lazy_glTexCoord2s(GLshort s, GLshort t) {
+	glad_glTexCoord2s = (PFNGLTEXCOORD2SPROC)gladLazyResolve("glTexCoord2s");
+	glad_glTexCoord2s(s, t);
+}
+
+static void APIENTRY lazy_glTexCoord2sv(const GLshort *v) {
+	glad_glTexCoord2sv = (PFNGLTEXCOORD2SVPROC)gladLazyResolve("glTexCoord2sv");
+	glad_glTexCoord2sv(v);
+}
+
+static void APIENTRY lazy_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+	glad_glTexCoord3d = (PFNGLTEXCOORD3DPROC)gladLazyResolve("glTexCoord3d");
+	glad_glTexCoord3d(s, t, r);
+}
+
+static void APIENTRY lazy_glTexCoord3dv(const GLdouble *v) {
+	glad_glTexCoord3dv = (PFNGLTEXCOORD3DVPROC)gladLazyResolve("glTexCoord3dv");
+	glad_glTexCoord3dv(v);
+}
+
+static void APIENTRY lazy_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+	glad_glTexCoord3f = (PFNGLTEXCOORD3FPROC)gladLazyResolve("glTexCoord3f");
+	glad_glTexCoord3f(s, t, r);
+}
+
+static void APIENTRY lazy_glTexCoord3fv(const GLfloat *v) {
+	glad_glTexCoord3fv = (PFNGLTEXCOORD3FVPROC)gladLazyResolve("glTexCoord3fv");
+	glad_glTexCoord3fv(v);
+}
+
+static void APIENTRY lazy_glTexCoord3i(GLint s, GLint t, GLint r) {
+	glad_glTexCoord3i = (PFNGLTEXCOORD3IPROC)gladLazyResolve("glTexCoord3i");
+	glad_glTexCoord3i(s, t, r);
+}
+
+static void APIENTRY lazy_glTexCoord3iv(const GLint *v) {
+	glad_glTexCoord3iv = (PFNGLTEXCOORD3IVPROC)gladLazyResolve("glTexCoord3iv");
+	glad_glTexCoord3iv(v);
+}
+
+static void APIENTRY lazy_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+	glad_glTexCoord3s = (PFNGLTEXCOORD3SPROC)gladLazyResolve("glTexCoord3s");
+	glad_glTexCoord3s(s, t, r);
+}
+
+static void APIENTRY lazy_glTexCoord3sv(const GLshort *v) {
+	glad_glTexCoord3sv = (PFNGLTEXCOORD3SVPROC)gladLazyResolve("glTexCoord3sv");
+	glad_glTexCoord3sv(v);
+}
+
+static void APIENTRY lazy_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	glad_glTexCoord4d = (PFNGLTEXCOORD4DPROC)gladLazyResolve("glTexCoord4d");
+	glad_glTexCoord4d(s, t, r, q);
+}
+
+static void APIENTRY lazy_glTexCoord4dv(const GLdouble *v) {
+	glad_glTexCoord4dv = (PFNGLTEXCOORD4DVPROC)gladLazyResolve("glTexCoord4dv");
+	glad_glTexCoord4dv(v);
+}
+
+static void APIENTRY lazy_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	glad_glTexCoord4f = (PFNGLTEXCOORD4FPROC)gladLazyResolve("glTexCoord4f");
+	glad_glTexCoord4f(s, t, r, q);
+}
+
+static void APIENTRY lazy_glTexCoord4fv(const GLfloat *v) {
+	glad_glTexCoord4fv = (PFNGLTEXCOORD4FVPROC)gladLazyResolve("glTexCoord4fv");
+	glad_glTexCoord4fv(v);
+}
+
+static void APIENTRY lazy_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+	glad_glTexCoord4i = (PFNGLTEXCOORD4IPROC)gladLazyResolve("glTexCoord4i");
+	glad_glTexCoord4i(s, t, r, q);
+}
+
+static void APIENTRY lazy_glTexCoord4iv(const GLint *v) {
+	glad_glTexCoord4iv = (PFNGLTEXCOORD4IVPROC)gladLazyResolve("glTexCoord4iv");
+	glad_glTexCoord4iv(v);
+}
+
+static void APIENTRY lazy_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+	glad_glTexCoord4s = (PFNGLTEXCOORD4SPROC)gladLazyResolve("glTexCoord4s");
+	glad_glTexCoord4s(s, t, r, q);
+}
+
+static void APIENTRY lazy_glTexCoord4sv(const GLshort *v) {
+	glad_glTexCoord4sv = (PFNGLTEXCOORD4SVPROC)gladLazyResolve("glTexCoord4sv");
+	glad_glTexCoord4sv(v);
+}
+
+static void APIENTRY lazy_glVertex2d(GLdouble x, GLdouble y) {
+	glad_glVertex2d = (PFNGLVERTEX2DPROC)gladLazyResolve("glVertex2d");
+	glad_glVertex2d(x, y);
+}
+
+static void APIENTRY lazy_glVertex2dv(const GLdouble *v) {
+	glad_glVertex2dv = (PFNGLVERTEX2DVPROC)gladLazyResolve("glVertex2dv");
+	glad_glVertex2dv(v);
+}
+
+static void APIENTRY lazy_glVertex2f(GLfloat x, GLfloat y) {
+	glad_glVertex2f = (PFNGLVERTEX2FPROC)gladLazyResolve("glVertex2f");
+	glad_glVertex2f(x, y);
+}
+
+static void APIENTRY lazy_glVertex2fv(const GLfloat *v) {
+	glad_glVertex2fv = (PFNGLVERTEX2FVPROC)gladLazyResolve("glVertex2fv");
+	glad_glVertex2fv(v);
+}
+
+static void APIENTRY lazy_glVertex2i(GLint x, GLint y) {
+	glad_glVertex2i = (PFNGLVERTEX2IPROC)gladLazyResolve("glVertex2i");
+	glad_glVertex2i(x, y);
+}
+
+static void APIENTRY lazy_glVertex2iv(const GLint *v) {
+	glad_glVertex2iv = (PFNGLVERTEX2IVPROC)gladLazyResolve("glVertex2iv");
+	glad_glVertex2iv(v);
+}
+
+static void APIENTRY lazy_glVertex2s(GLshort x, GLshort y) {
+	glad_glVertex2s = (PFNGLVERTEX2SPROC)gladLazyResolve("glVertex2s");
+	glad_glVertex2s(x, y);
+}
+
+static void APIENTRY lazy_glVertex2sv(const GLshort *v) {
+	glad_glVertex2sv = (PFNGLVERTEX2SVPROC)gladLazyResolve("glVertex2sv");
+	glad_glVertex2sv(v);
+}
+
+static void APIENTRY lazy_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertex3d = (PFNGLVERTEX3DPROC)gladLazyResolve("glVertex3d");
+	glad_glVertex3d(x, y, z);
+}
+
+static void APIENTRY lazy_glVertex3dv(const GLdouble *v) {
+	glad_glVertex3dv = (PFNGLVERTEX3DVPROC)gladLazyResolve("glVertex3dv");
+	glad_glVertex3dv(v);
+}
+
+static void APIENTRY lazy_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertex3f = (PFNGLVERTEX3FPROC)gladLazyResolve("glVertex3f");
+	glad_glVertex3f(x, y, z);
+}
+
+static void APIENTRY lazy_glVertex3fv(const GLfloat *v) {
+	glad_glVertex3fv = (PFNGLVERTEX3FVPROC)gladLazyResolve("glVertex3fv");
+	glad_glVertex3fv(v);
+}
+
+static void APIENTRY lazy_glVertex3i(GLint x, GLint y, GLint z) {
+	glad_glVertex3i = (PFNGLVERTEX3IPROC)gladLazyResolve("glVertex3i");
+	glad_glVertex3i(x, y, z);
+}
+
+static void APIENTRY lazy_glVertex3iv(const GLint *v) {
+	glad_glVertex3iv = (PFNGLVERTEX3IVPROC)gladLazyResolve("glVertex3iv");
+	glad_glVertex3iv(v);
+}
+
+static void APIENTRY lazy_glVertex3s(GLshort x, GLshort y, GLshort z) {
+	glad_glVertex3s = (PFNGLVERTEX3SPROC)gladLazyResolve("glVertex3s");
+	glad_glVertex3s(x, y, z);
+}
+
+static void APIENTRY lazy_glVertex3sv(const GLshort *v) {
+	glad_glVertex3sv = (PFNGLVERTEX3SVPROC)gladLazyResolve("glVertex3sv");
+	glad_glVertex3sv(v);
+}
+
+static void APIENTRY lazy_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertex4d = (PFNGLVERTEX4DPROC)gladLazyResolve("glVertex4d");
+	glad_glVertex4d(x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertex4dv(const GLdouble *v) {
+	glad_glVertex4dv = (PFNGLVERTEX4DVPROC)gladLazyResolve("glVertex4dv");
+	glad_glVertex4dv(v);
+}
+
+static void APIENTRY lazy_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertex4f = (PFNGLVERTEX4FPROC)gladLazyResolve("glVertex4f");
+	glad_glVertex4f(x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertex4fv(const GLfloat *v) {
+	glad_glVertex4fv = (PFNGLVERTEX4FVPROC)gladLazyResolve("glVertex4fv");
+	glad_glVertex4fv(v);
+}
+
+static void APIENTRY lazy_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+	glad_glVertex4i = (PFNGLVERTEX4IPROC)gladLazyResolve("glVertex4i");
+	glad_glVertex4i(x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertex4iv(const GLint *v) {
+	glad_glVertex4iv = (PFNGLVERTEX4IVPROC)gladLazyResolve("glVertex4iv");
+	glad_glVertex4iv(v);
+}
+
+static void APIENTRY lazy_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertex4s = (PFNGLVERTEX4SPROC)gladLazyResolve("glVertex4s");
+	glad_glVertex4s(x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertex4sv(const GLshort *v) {
+	glad_glVertex4sv = (PFNGLVERTEX4SVPROC)gladLazyResolve("glVertex4sv");
+	glad_glVertex4sv(v);
+}
+
+static void APIENTRY lazy_glClipPlane(GLenum plane, const GLdouble *equation) {
+	glad_glClipPlane = (PFNGLCLIPPLANEPROC)gladLazyResolve("glClipPlane");
+	glad_glClipPlane(plane, equation);
+}
+
+static void APIENTRY lazy_glColorMaterial(GLenum face, GLenum mode) {
+	glad_glColorMaterial = (PFNGLCOLORMATERIALPROC)gladLazyResolve("glColorMaterial");
+	glad_glColorMaterial(face, mode);
+}
+
+static void APIENTRY lazy_glFogf(GLenum pname, GLfloat param) {
+	glad_glFogf = (PFNGLFOGFPROC)gladLazyResolve("glFogf");
+	glad_glFogf(pname, param);
+}
+
+static void APIENTRY lazy_glFogfv(GLenum pname, const GLfloat *params) {
+	glad_glFogfv = (PFNGLFOGFVPROC)gladLazyResolve("glFogfv");
+	glad_glFogfv(pname, params);
+}
+
+static void APIENTRY lazy_glFogi(GLenum pname, GLint param) {
+	glad_glFogi = (PFNGLFOGIPROC)gladLazyResolve("glFogi");
+	glad_glFogi(pname, param);
+}
+
+static void APIENTRY lazy_glFogiv(GLenum pname, const GLint *params) {
+	glad_glFogiv = (PFNGLFOGIVPROC)gladLazyResolve("glFogiv");
+	glad_glFogiv(pname, params);
+}
+
+static void APIENTRY lazy_glLightf(GLenum light, GLenum pname, GLfloat param) {
+	glad_glLightf = (PFNGLLIGHTFPROC)gladLazyResolve("glLightf");
+	glad_glLightf(light, pname, param);
+}
+
+static void APIENTRY lazy_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+	glad_glLightfv = (PFNGLLIGHTFVPROC)gladLazyResolve("glLightfv");
+	glad_glLightfv(light, pname, params);
+}
+
+static void APIENTRY lazy_glLighti(GLenum light, GLenum pname, GLint param) {
+	glad_glLighti = (PFNGLLIGHTIPROC)gladLazyResolve("glLighti");
+	glad_glLighti(light, pname, param);
+}
+
+static void APIENTRY lazy_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+	glad_glLightiv = (PFNGLLIGHTIVPROC)gladLazyResolve("glLightiv");
+	glad_glLightiv(light, pname, params);
+}
+
+static void APIENTRY lazy_glLightModelf(GLenum pname, GLfloat param) {
+	glad_glLightModelf = (PFNGLLIGHTMODELFPROC)gladLazyResolve("glLightModelf");
+	glad_glLightModelf(pname, param);
+}
+
+static void APIENTRY lazy_glLightModelfv(GLenum pname, const GLfloat *params) {
+	glad_glLightModelfv = (PFNGLLIGHTMODELFVPROC)gladLazyResolve("glLightModelfv");
+	glad_glLightModelfv(pname, params);
+}
+
+static void APIENTRY lazy_glLightModeli(GLenum pname, GLint param) {
+	glad_glLightModeli = (PFNGLLIGHTMODELIPROC)gladLazyResolve("glLightModeli");
+	glad_glLightModeli(pname, param);
+}
+
+static void APIENTRY lazy_glLightModeliv(GLenum pname, const GLint *params) {
+	glad_glLightModeliv = (PFNGLLIGHTMODELIVPROC)gladLazyResolve("glLightModeliv");
+	glad_glLightModeliv(pname, params);
+}
+
+static void APIENTRY lazy_glLineStipple(GLint factor, GLushort pattern) {
+	glad_glLineStipple = (PFNGLLINESTIPPLEPROC)gladLazyResolve("glLineStipple");
+	glad_glLineStipple(factor, pattern);
+}
+
+static void APIENTRY lazy_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+	glad_glMaterialf = (PFNGLMATERIALFPROC)gladLazyResolve("glMaterialf");
+	glad_glMaterialf(face, pname, param);
+}
+
+static void APIENTRY lazy_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+	glad_glMaterialfv = (PFNGLMATERIALFVPROC)gladLazyResolve("glMaterialfv");
+	glad_glMaterialfv(face, pname, params);
+}
+
+static void APIENTRY lazy_glMateriali(GLenum face, GLenum pname, GLint param) {
+	glad_glMateriali = (PFNGLMATERIALIPROC)gladLazyResolve("glMateriali");
+	glad_glMateriali(face, pname, param);
+}
+
+static void APIENTRY lazy_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+	glad_glMaterialiv = (PFNGLMATERIALIVPROC)gladLazyResolve("glMaterialiv");
+	glad_glMaterialiv(face, pname, params);
+}
+
+static void APIENTRY lazy_glPolygonStipple(const GLubyte *mask) {
+	glad_glPolygonStipple = (PFNGLPOLYGONSTIPPLEPROC)gladLazyResolve("glPolygonStipple");
+	glad_glPolygonStipple(mask);
+}
+
+static void APIENTRY lazy_glShadeModel(GLenum mode) {
+	glad_glShadeModel = (PFNGLSHADEMODELPROC)gladLazyResolve("glShadeModel");
+	glad_glShadeModel(mode);
+}
+
+static void APIENTRY lazy_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+	glad_glTexEnvf = (PFNGLTEXENVFPROC)gladLazyResolve("glTexEnvf");
+	glad_glTexEnvf(target, pname, param);
+}
+
+static void APIENTRY lazy_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glTexEnvfv = (PFNGLTEXENVFVPROC)gladLazyResolve("glTexEnvfv");
+	glad_glTexEnvfv(target, pname, params);
+}
+
+static void APIENTRY lazy_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+	glad_glTexEnvi = (PFNGLTEXENVIPROC)gladLazyResolve("glTexEnvi");
+	glad_glTexEnvi(target, pname, param);
+}
+
+static void APIENTRY lazy_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexEnviv = (PFNGLTEXENVIVPROC)gladLazyResolve("glTexEnviv");
+	glad_glTexEnviv(target, pname, params);
+}
+
+static void APIENTRY lazy_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+	glad_glTexGend = (PFNGLTEXGENDPROC)gladLazyResolve("glTexGend");
+	glad_glTexGend(coord, pname, param);
+}
+
+static void APIENTRY lazy_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+	glad_glTexGendv = (PFNGLTEXGENDVPROC)gladLazyResolve("glTexGendv");
+	glad_glTexGendv(coord, pname, params);
+}
+
+static void APIENTRY lazy_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+	glad_glTexGenf = (PFNGLTEXGENFPROC)gladLazyResolve("glTexGenf");
+	glad_glTexGenf(coord, pname, param);
+}
+
+static void APIENTRY lazy_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+	glad_glTexGenfv = (PFNGLTEXGENFVPROC)gladLazyResolve("glTexGenfv");
+	glad_glTexGenfv(coord, pname, params);
+}
+
+static void APIENTRY lazy_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+	glad_glTexGeni = (PFNGLTEXGENIPROC)gladLazyResolve("glTexGeni");
+	glad_glTexGeni(coord, pname, param);
+}
+
+static void APIENTRY lazy_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+	glad_glTexGeniv = (PFNGLTEXGENIVPROC)gladLazyResolve("glTexGeniv");
+	glad_glTexGeniv(coord, pname, params);
+}
+
+static void APIENTRY lazy_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) {
+	glad_glFeedbackBuffer = (PFNGLFEEDBACKBUFFERPROC)gladLazyResolve("glFeedbackBuffer");
+	glad_glFeedbackBuffer(size, type, buffer);
+}
+
+static void APIENTRY lazy_glSelectBuffer(GLsizei size, GLuint *buffer) {
+	glad_glSelectBuffer = (PFNGLSELECTBUFFERPROC)gladLazyResolve("glSelectBuffer");
+	glad_glSelectBuffer(size, buffer);
+}
+
+static GLint APIENTRY lazy_glRenderMode(GLenum mode) {
+	glad_glRenderMode = (PFNGLRENDERMODEPROC)gladLazyResolve("glRenderMode");
+	return glad_glRenderMode(mode);
+}
+
+static void APIENTRY lazy_glInitNames(void) {
+	glad_glInitNames = (PFNGLINITNAMESPROC)gladLazyResolve("glInitNames");
+	glad_glInitNames();
+}
+
+static void APIENTRY lazy_glLoadName(GLuint name) {
+	glad_glLoadName = (PFNGLLOADNAMEPROC)gladLazyResolve("glLoadName");
+	glad_glLoadName(name);
+}
+
+static void APIENTRY lazy_glPassThrough(GLfloat token) {
+	glad_glPassThrough = (PFNGLPASSTHROUGHPROC)gladLazyResolve("glPassThrough");
+	glad_glPassThrough(token);
+}
+
+static void APIENTRY lazy_glPopName(void) {
+	glad_glPopName = (PFNGLPOPNAMEPROC)gladLazyResolve("glPopName");
+	glad_glPopName();
+}
+
+static void APIENTRY lazy_glPushName(GLuint name) {
+	glad_glPushName = (PFNGLPUSHNAMEPROC)gladLazyResolve("glPushName");
+	glad_glPushName(name);
+}
+
+static void APIENTRY lazy_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glClearAccum = (PFNGLCLEARACCUMPROC)gladLazyResolve("glClearAccum");
+	glad_glClearAccum(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glClearIndex(GLfloat c) {
+	glad_glClearIndex = (PFNGLCLEARINDEXPROC)gladLazyResolve("glClearIndex");
+	glad_glClearIndex(c);
+}
+
+static void APIENTRY lazy_glIndexMask(GLuint mask) {
+	glad_glIndexMask = (PFNGLINDEXMASKPROC)gladLazyResolve("glIndexMask");
+	glad_glIndexMask(mask);
+}
+
+static void APIENTRY lazy_glAccum(GLenum op, GLfloat value) {
+	glad_glAccum = (PFNGLACCUMPROC)gladLazyResolve("glAccum");
+	glad_glAccum(op, value);
+}
+
+static void APIENTRY lazy_glPopAttrib(void) {
+	glad_glPopAttrib = (PFNGLPOPATTRIBPROC)gladLazyResolve("glPopAttrib");
+	glad_glPopAttrib();
+}
+
+static void APIENTRY lazy_glPushAttrib(GLbitfield mask) {
+	glad_glPushAttrib = (PFNGLPUSHATTRIBPROC)gladLazyResolve("glPushAttrib");
+	glad_glPushAttrib(mask);
+}
+
+static void APIENTRY lazy_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+	glad_glMap1d = (PFNGLMAP1DPROC)gladLazyResolve("glMap1d");
+	glad_glMap1d(target, u1, u2, stride, order, points);
+}
+
+static void APIENTRY lazy_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+	glad_glMap1f = (PFNGLMAP1FPROC)gladLazyResolve("glMap1f");
+	glad_glMap1f(target, u1, u2, stride, order, points);
+}
+
+static void APIENTRY lazy_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+	glad_glMap2d = (PFNGLMAP2DPROC)gladLazyResolve("glMap2d");
+	glad_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+static void APIENTRY lazy_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+	glad_glMap2f = (PFNGLMAP2FPROC)gladLazyResolve("glMap2f");
+	glad_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+static void APIENTRY lazy_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+	glad_glMapGrid1d = (PFNGLMAPGRID1DPROC)gladLazyResolve("glMapGrid1d");
+	glad_glMapGrid1d(un, u1, u2);
+}
+
+static void APIENTRY lazy_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+	glad_glMapGrid1f = (PFNGLMAPGRID1FPROC)gladLazyResolve("glMapGrid1f");
+	glad_glMapGrid1f(un, u1, u2);
+}
+
+static void APIENTRY lazy_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+	glad_glMapGrid2d = (PFNGLMAPGRID2DPROC)gladLazyResolve("glMapGrid2d");
+	glad_glMapGrid2d(un, u1, u2, vn, v1, v2);
+}
+
+static void APIENTRY lazy_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+	glad_glMapGrid2f = (PFNGLMAPGRID2FPROC)gladLazyResolve("glMapGrid2f");
+	glad_glMapGrid2f(un, u1, u2, vn, v1, v2);
+}
+
+static void APIENTRY lazy_glEvalCoord1d(GLdouble u) {
+	glad_glEvalCoord1d = (PFNGLEVALCOORD1DPROC)gladLazyResolve("glEvalCoord1d");
+	glad_glEvalCoord1d(u);
+}
+
+static void APIENTRY lazy_glEvalCoord1dv(const GLdouble *u) {
+	glad_glEvalCoord1dv = (PFNGLEVALCOORD1DVPROC)gladLazyResolve("glEvalCoord1dv");
+	glad_glEvalCoord1dv(u);
+}
+
+static void APIENTRY lazy_glEvalCoord1f(GLfloat u) {
+	glad_glEvalCoord1f = (PFNGLEVALCOORD1FPROC)gladLazyResolve("glEvalCoord1f");
+	glad_glEvalCoord1f(u);
+}
+
+static void APIENTRY lazy_glEvalCoord1fv(const GLfloat *u) {
+	glad_glEvalCoord1fv = (PFNGLEVALCOORD1FVPROC)gladLazyResolve("glEvalCoord1fv");
+	glad_glEvalCoord1fv(u);
+}
+
+static void APIENTRY lazy_glEvalCoord2d(GLdouble u, GLdouble v) {
+	glad_glEvalCoord2d = (PFNGLEVALCOORD2DPROC)gladLazyResolve("glEvalCoord2d");
+	glad_glEvalCoord2d(u, v);
+}
+
+static void APIENTRY lazy_glEvalCoord2dv(const GLdouble *u) {
+	glad_glEvalCoord2dv = (PFNGLEVALCOORD2DVPROC)gladLazyResolve("glEvalCoord2dv");
+	glad_glEvalCoord2dv(u);
+}
+
+static void APIENTRY lazy_glEvalCoord2f(GLfloat u, GLfloat v) {
+	glad_glEvalCoord2f = (PFNGLEVALCOORD2FPROC)gladLazyResolve("glEvalCoord2f");
+	glad_glEvalCoord2f(u, v);
+}
+
+static void APIENTRY lazy_glEvalCoord2fv(const GLfloat *u) {
+	glad_glEvalCoord2fv = (PFNGLEVALCOORD2FVPROC)gladLazyResolve("glEvalCoord2fv");
+	glad_glEvalCoord2fv(u);
+}
+
+static void APIENTRY lazy_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+	glad_glEvalMesh1 = (PFNGLEVALMESH1PROC)gladLazyResolve("glEvalMesh1");
+	glad_glEvalMesh1(mode, i1, i2);
+}
+
+static void APIENTRY lazy_glEvalPoint1(GLint i) {
+	glad_glEvalPoint1 = (PFNGLEVALPOINT1PROC)gladLazyResolve("glEvalPoint1");
+	glad_glEvalPoint1(i);
+}
+
+static void APIENTRY lazy_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+	glad_glEvalMesh2 = (PFNGLEVALMESH2PROC)gladLazyResolve("glEvalMesh2");
+	glad_glEvalMesh2(mode, i1, i2, j1, j2);
+}
+
+static void APIENTRY lazy_glEvalPoint2(GLint i, GLint j) {
+	glad_glEvalPoint2 = (PFNGLEVALPOINT2PROC)gladLazyResolve("glEvalPoint2");
+	glad_glEvalPoint2(i, j);
+}
+
+static void APIENTRY lazy_glAlphaFunc(GLenum func, GLfloat ref) {
+	glad_glAlphaFunc = (PFNGLALPHAFUNCPROC)gladLazyResolve("glAlphaFunc");
+	glad_glAlphaFunc(func, ref);
+}
+
+static void APIENTRY lazy_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+	glad_glPixelZoom = (PFNGLPIXELZOOMPROC)gladLazyResolve("glPixelZoom");
+	glad_glPixelZoom(xfactor, yfactor);
+}
+
+static void APIENTRY lazy_glPixelTransferf(GLenum pname, GLfloat param) {
+	glad_glPixelTransferf = (PFNGLPIXELTRANSFERFPROC)gladLazyResolve("glPixelTransferf");
+	glad_glPixelTransferf(pname, param);
+}
+
+static void APIENTRY lazy_glPixelTransferi(GLenum pname, GLint param) {
+	glad_glPixelTransferi = (PFNGLPIXELTRANSFERIPROC)gladLazyResolve("glPixelTransferi");
+	glad_glPixelTransferi(pname, param);
+}
+
+static void APIENTRY lazy_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+	glad_glPixelMapfv = (PFNGLPIXELMAPFVPROC)gladLazyResolve("glPixelMapfv");
+	glad_glPixelMapfv(map, mapsize, values);
+}
+
+static void APIENTRY lazy_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+	glad_glPixelMapuiv = (PFNGLPIXELMAPUIVPROC)gladLazyResolve("glPixelMapuiv");
+	glad_glPixelMapuiv(map, mapsize, values);
+}
+
+static void APIENTRY lazy_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+	glad_glPixelMapusv = (PFNGLPIXELMAPUSVPROC)gladLazyResolve("glPixelMapusv");
+	glad_glPixelMapusv(map, mapsize, values);
+}
+
+static void APIENTRY lazy_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+	glad_glCopyPixels = (PFNGLCOPYPIXELSPROC)gladLazyResolve("glCopyPixels");
+	glad_glCopyPixels(x, y, width, height, type);
+}
+
+static void APIENTRY lazy_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glDrawPixels = (PFNGLDRAWPIXELSPROC)gladLazyResolve("glDrawPixels");
+	glad_glDrawPixels(width, height, format, type, pixels);
+}
+
+static void APIENTRY lazy_glGetClipPlane(GLenum plane, GLdouble *equation) {
+	glad_glGetClipPlane = (PFNGLGETCLIPPLANEPROC)gladLazyResolve("glGetClipPlane");
+	glad_glGetClipPlane(plane, equation);
+}
+
+static void APIENTRY lazy_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) {
+	glad_glGetLightfv = (PFNGLGETLIGHTFVPROC)gladLazyResolve("glGetLightfv");
+	glad_glGetLightfv(light, pname, params);
+}
+
+static void APIENTRY lazy_glGetLightiv(GLenum light, GLenum pname, GLint *params) {
+	glad_glGetLightiv = (PFNGLGETLIGHTIVPROC)gladLazyResolve("glGetLightiv");
+	glad_glGetLightiv(light, pname, params);
+}
+
+static void APIENTRY lazy_glGetMapdv(GLenum target, GLenum query, GLdouble *v) {
+	glad_glGetMapdv = (PFNGLGETMAPDVPROC)gladLazyResolve("glGetMapdv");
+	glad_glGetMapdv(target, query, v);
+}
+
+static void APIENTRY lazy_glGetMapfv(GLenum target, GLenum query, GLfloat *v) {
+	glad_glGetMapfv = (PFNGLGETMAPFVPROC)gladLazyResolve("glGetMapfv");
+	glad_glGetMapfv(target, query, v);
+}
+
+static void APIENTRY lazy_glGetMapiv(GLenum target, GLenum query, GLint *v) {
+	glad_glGetMapiv = (PFNGLGETMAPIVPROC)gladLazyResolve("glGetMapiv");
+	glad_glGetMapiv(target, query, v);
+}
+
+static void APIENTRY lazy_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) {
+	glad_glGetMaterialfv = (PFNGLGETMATERIALFVPROC)gladLazyResolve("glGetMaterialfv");
+	glad_glGetMaterialfv(face, pname, params);
+}
+
+static void APIENTRY lazy_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) {
+	glad_glGetMaterialiv = (PFNGLGETMATERIALIVPROC)gladLazyResolve("glGetMaterialiv");
+	glad_glGetMaterialiv(face, pname, params);
+}
+
+static void APIENTRY lazy_glGetPixelMapfv(GLenum map, GLfloat *values) {
+	glad_glGetPixelMapfv = (PFNGLGETPIXELMAPFVPROC)gladLazyResolve("glGetPixelMapfv");
+	glad_glGetPixelMapfv(map, values);
+}
+
+static void APIENTRY lazy_glGetPixelMapuiv(GLenum map, GLuint *values) {
+	glad_glGetPixelMapuiv = (PFNGLGETPIXELMAPUIVPROC)gladLazyResolve("glGetPixelMapuiv");
+	glad_glGetPixelMapuiv(map, values);
+}
+
+static void APIENTRY lazy_glGetPixelMapusv(GLenum map, GLushort *values) {
+	glad_glGetPixelMapusv = (PFNGLGETPIXELMAPUSVPROC)gladLazyResolve("glGetPixelMapusv");
+	glad_glGetPixelMapusv(map, values);
+}
+
+static void APIENTRY lazy_glGetPolygonStipple(GLubyte *mask) {
+	glad_glGetPolygonStipple = (PFNGLGETPOLYGONSTIPPLEPROC)gladLazyResolve("glGetPolygonStipple");
+	glad_glGetPolygonStipple(mask);
+}
+
+static void APIENTRY lazy_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetTexEnvfv = (PFNGLGETTEXENVFVPROC)gladLazyResolve("glGetTexEnvfv");
+	glad_glGetTexEnvfv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexEnviv = (PFNGLGETTEXENVIVPROC)gladLazyResolve("glGetTexEnviv");
+	glad_glGetTexEnviv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) {
+	glad_glGetTexGendv = (PFNGLGETTEXGENDVPROC)gladLazyResolve("glGetTexGendv");
+	glad_glGetTexGendv(coord, pname, params);
+}
+
+static void APIENTRY lazy_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) {
+	glad_glGetTexGenfv = (PFNGLGETTEXGENFVPROC)gladLazyResolve("glGetTexGenfv");
+	glad_glGetTexGenfv(coord, pname, params);
+}
+
+static void APIENTRY lazy_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) {
+	glad_glGetTexGeniv = (PFNGLGETTEXGENIVPROC)gladLazyResolve("glGetTexGeniv");
+	glad_glGetTexGeniv(coord, pname, params);
+}
+
+static GLboolean APIENTRY lazy_glIsList(GLuint list) {
+	glad_glIsList = (PFNGLISLISTPROC)gladLazyResolve("glIsList");
+	return glad_glIsList(list);
+}
+
+static void APIENTRY lazy_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	glad_glFrustum = (PFNGLFRUSTUMPROC)gladLazyResolve("glFrustum");
+	glad_glFrustum(left, right, bottom, top, zNear, zFar);
+}
+
+static void APIENTRY lazy_glLoadIdentity(void) {
+	glad_glLoadIdentity = (PFNGLLOADIDENTITYPROC)gladLazyResolve("glLoadIdentity");
+	glad_glLoadIdentity();
+}
+
+static void APIENTRY lazy_glLoadMatrixf(const GLfloat *m) {
+	glad_glLoadMatrixf = (PFNGLLOADMATRIXFPROC)gladLazyResolve("glLoadMatrixf");
+	glad_glLoadMatrixf(m);
+}
+
+static void APIENTRY lazy_glLoadMatrixd(const GLdouble *m) {
+	glad_glLoadMatrixd = (PFNGLLOADMATRIXDPROC)gladLazyResolve("glLoadMatrixd");
+	glad_glLoadMatrixd(m);
+}
+
+static void APIENTRY lazy_glMatrixMode(GLenum mode) {
+	glad_glMatrixMode = (PFNGLMATRIXMODEPROC)gladLazyResolve("glMatrixMode");
+	glad_glMatrixMode(mode);
+}
+
+static void APIENTRY lazy_glMultMatrixf(const GLfloat *m) {
+	glad_glMultMatrixf = (PFNGLMULTMATRIXFPROC)gladLazyResolve("glMultMatrixf");
+	glad_glMultMatrixf(m);
+}
+
+static void APIENTRY lazy_glMultMatrixd(const GLdouble *m) {
+	glad_glMultMatrixd = (PFNGLMULTMATRIXDPROC)gladLazyResolve("glMultMatrixd");
+	glad_glMultMatrixd(m);
+}
+
+static void APIENTRY lazy_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	glad_glOrtho = (PFNGLORTHOPROC)gladLazyResolve("glOrtho");
+	glad_glOrtho(left, right, bottom, top, zNear, zFar);
+}
+
+static void APIENTRY lazy_glPopMatrix(void) {
+	glad_glPopMatrix = (PFNGLPOPMATRIXPROC)gladLazyResolve("glPopMatrix");
+	glad_glPopMatrix();
+}
+
+static void APIENTRY lazy_glPushMatrix(void) {
+	glad_glPushMatrix = (PFNGLPUSHMATRIXPROC)gladLazyResolve("glPushMatrix");
+	glad_glPushMatrix();
+}
+
+static void APIENTRY lazy_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glRotated = (PFNGLROTATEDPROC)gladLazyResolve("glRotated");
+	glad_glRotated(angle, x, y, z);
+}
+
+static void APIENTRY lazy_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glRotatef = (PFNGLROTATEFPROC)gladLazyResolve("glRotatef");
+	glad_glRotatef(angle, x, y, z);
+}
+
+static void APIENTRY lazy_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glScaled = (PFNGLSCALEDPROC)gladLazyResolve("glScaled");
+	glad_glScaled(x, y, z);
+}
+
+static void APIENTRY lazy_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glScalef = (PFNGLSCALEFPROC)gladLazyResolve("glScalef");
+	glad_glScalef(x, y, z);
+}
+
+static void APIENTRY lazy_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glTranslated = (PFNGLTRANSLATEDPROC)gladLazyResolve("glTranslated");
+	glad_glTranslated(x, y, z);
+}
+
+static void APIENTRY lazy_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glTranslatef = (PFNGLTRANSLATEFPROC)gladLazyResolve("glTranslatef");
+	glad_glTranslatef(x, y, z);
+}
+
+#endif
+static void APIENTRY lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)gladLazyResolve("glDrawArrays");
+	glad_glDrawArrays(mode, first, count);
+}
+
+static void APIENTRY lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)gladLazyResolve("glDrawElements");
+	glad_glDrawElements(mode, count, type, indices);
+}
+
+static void APIENTRY lazy_glGetPointerv(GLenum pname, void **params) {
+	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)gladLazyResolve("glGetPointerv");
+	glad_glGetPointerv(pname, params);
+}
+
+static void APIENTRY lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+	glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)gladLazyResolve("glPolygonOffset");
+	glad_glPolygonOffset(factor, units);
+}
+
+static void APIENTRY lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)gladLazyResolve("glCopyTexImage1D");
+	glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+
+static void APIENTRY lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)gladLazyResolve("glCopyTexImage2D");
+	glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+
+static void APIENTRY lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)gladLazyResolve("glCopyTexSubImage1D");
+	glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+
+static void APIENTRY lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)gladLazyResolve("glCopyTexSubImage2D");
+	glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void APIENTRY lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)gladLazyResolve("glTexSubImage1D");
+	glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+
+static void APIENTRY lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)gladLazyResolve("glTexSubImage2D");
+	glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY lazy_glBindTexture(GLenum target, GLuint texture) {
+	glad_glBindTexture = (PFNGLBINDTEXTUREPROC)gladLazyResolve("glBindTexture");
+	glad_glBindTexture(target, texture);
+}
+
+static void APIENTRY lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)gladLazyResolve("glDeleteTextures");
+	glad_glDeleteTextures(n, textures);
+}
+
+static void APIENTRY lazy_glGenTextures(GLsizei n, GLuint *textures) {
+	glad_glGenTextures = (PFNGLGENTEXTURESPROC)gladLazyResolve("glGenTextures");
+	glad_glGenTextures(n, textures);
+}
+
+static GLboolean APIENTRY lazy_glIsTexture(GLuint texture) {
+	glad_glIsTexture = (PFNGLISTEXTUREPROC)gladLazyResolve("glIsTexture");
+	return glad_glIsTexture(texture);
+}
+
+#ifndef GLAD_CORE_PROFILE
+static void APIENTRY lazy_glArrayElement(GLint i) {
+	glad_glArrayElement = (PFNGLARRAYELEMENTPROC)gladLazyResolve("glArrayElement");
+	glad_glArrayElement(i);
+}
+
+static void APIENTRY lazy_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glColorPointer = (PFNGLCOLORPOINTERPROC)gladLazyResolve("glColorPointer");
+	glad_glColorPointer(size, type, stride, pointer);
+}
+
+static void APIENTRY lazy_glDisableClientState(GLenum array) {
+	glad_glDisableClientState = (PFNGLDISABLECLIENTSTATEPROC)gladLazyResolve("glDisableClientState");
+	glad_glDisableClientState(array);
+}
+
+static void APIENTRY lazy_glEdgeFlagPointer(GLsizei stride, const void *pointer) {
+	glad_glEdgeFlagPointer = (PFNGLEDGEFLAGPOINTERPROC)gladLazyResolve("glEdgeFlagPointer");
+	glad_glEdgeFlagPointer(stride, pointer);
+}
+
+static void APIENTRY lazy_glEnableClientState(GLenum array) {
+	glad_glEnableClientState = (PFNGLENABLECLIENTSTATEPROC)gladLazyResolve("glEnableClientState");
+	glad_glEnableClientState(array);
+}
+
+static void APIENTRY lazy_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glIndexPointer = (PFNGLINDEXPOINTERPROC)gladLazyResolve("glIndexPointer");
+	glad_glIndexPointer(type, stride, pointer);
+}
+
+static void APIENTRY lazy_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+	glad_glInterleavedArrays = (PFNGLINTERLEAVEDARRAYSPROC)gladLazyResolve("glInterleavedArrays");
+	glad_glInterleavedArrays(format, stride, pointer);
+}
+
+static void APIENTRY lazy_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glNormalPointer = (PFNGLNORMALPOINTERPROC)gladLazyResolve("glNormalPointer");
+	glad_glNormalPointer(type, stride, pointer);
+}
+
+static void APIENTRY lazy_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glTexCoordPointer = (PFNGLTEXCOORDPOINTERPROC)gladLazyResolve("glTexCoordPointer");
+	glad_glTexCoordPointer(size, type, stride, pointer);
+}
+
+static void APIENTRY lazy_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexPointer = (PFNGLVERTEXPOINTERPROC)gladLazyResolve("glVertexPointer");
+	glad_glVertexPointer(size, type, stride, pointer);
+}
+
+static GLboolean APIENTRY lazy_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) {
+	glad_glAreTexturesResident = (PFNGLARETEXTURESRESIDENTPROC)gladLazyResolve("glAreTexturesResident");
+	return glad_glAreTexturesResident(n, textures, residences);
+}
+
+static void APIENTRY lazy_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) {
+	glad_glPrioritizeTextures = (PFNGLPRIORITIZETEXTURESPROC)gladLazyResolve("glPrioritizeTextures");
+	glad_glPrioritizeTextures(n, textures, priorities);
+}
+
+static void APIENTRY lazy_glIndexub(GLubyte c) {
+	glad_glIndexub = (PFNGLINDEXUBPROC)gladLazyResolve("glIndexub");
+	glad_glIndexub(c);
+}
+
+static void APIENTRY lazy_glIndexubv(const GLubyte *c) {
+	glad_glIndexubv = (PFNGLINDEXUBVPROC)gladLazyResolve("glIndexubv");
+	glad_glIndexubv(c);
+}
+
+static void APIENTRY lazy_glPopClientAttrib(void) {
+	glad_glPopClientAttrib = (PFNGLPOPCLIENTATTRIBPROC)gladLazyResolve("glPopClientAttrib");
+	glad_glPopClientAttrib();
+}
+
+static void APIENTRY lazy_glPushClientAttrib(GLbitfield mask) {
+	glad_glPushClientAttrib = (PFNGLPUSHCLIENTATTRIBPROC)gladLazyResolve("glPushClientAttrib");
+	glad_glPushClientAttrib(mask);
+}
+
+#endif
+static void APIENTRY lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)gladLazyResolve("glDrawRangeElements");
+	glad_glDrawRangeElements(mode, start, end, count, type, indices);
+}
+
+static void APIENTRY lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)gladLazyResolve("glTexImage3D");
+	glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static void APIENTRY lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)gladLazyResolve("glTexSubImage3D");
+	glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void APIENTRY lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)gladLazyResolve("glCopyTexSubImage3D");
+	glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void APIENTRY lazy_glActiveTexture(GLenum texture) {
+	glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)gladLazyResolve("glActiveTexture");
+	glad_glActiveTexture(texture);
+}
+
+static void APIENTRY lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+	glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)gladLazyResolve("glSampleCoverage");
+	glad_glSampleCoverage(value, invert);
+}
+
+static void APIENTRY lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)gladLazyResolve("glCompressedTexImage3D");
+	glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void APIENTRY lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)gladLazyResolve("glCompressedTexImage2D");
+	glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static void APIENTRY lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)gladLazyResolve("glCompressedTexImage1D");
+	glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+
+static void APIENTRY lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)gladLazyResolve("glCompressedTexSubImage3D");
+	glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void APIENTRY lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)gladLazyResolve("glCompressedTexSubImage2D");
+	glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void APIENTRY lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)gladLazyResolve("glCompressedTexSubImage1D");
+	glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+
+static void APIENTRY lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)gladLazyResolve("glGetCompressedTexImage");
+	glad_glGetCompressedTexImage(target, level, img);
+}
+
+#ifndef GLAD_CORE_PROFILE
+static void APIENTRY lazy_glClientActiveTexture(GLenum texture) {
+	glad_glClientActiveTexture = (PFNGLCLIENTACTIVETEXTUREPROC)gladLazyResolve("glClientActiveTexture");
+	glad_glClientActiveTexture(texture);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1d(GLenum target, GLdouble s) {
+	glad_glMultiTexCoord1d = (PFNGLMULTITEXCOORD1DPROC)gladLazyResolve("glMultiTexCoord1d");
+	glad_glMultiTexCoord1d(target, s);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord1dv = (PFNGLMULTITEXCOORD1DVPROC)gladLazyResolve("glMultiTexCoord1dv");
+	glad_glMultiTexCoord1dv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1f(GLenum target, GLfloat s) {
+	glad_glMultiTexCoord1f = (PFNGLMULTITEXCOORD1FPROC)gladLazyResolve("glMultiTexCoord1f");
+	glad_glMultiTexCoord1f(target, s);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord1fv = (PFNGLMULTITEXCOORD1FVPROC)gladLazyResolve("glMultiTexCoord1fv");
+	glad_glMultiTexCoord1fv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1i(GLenum target, GLint s) {
+	glad_glMultiTexCoord1i = (PFNGLMULTITEXCOORD1IPROC)gladLazyResolve("glMultiTexCoord1i");
+	glad_glMultiTexCoord1i(target, s);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord1iv = (PFNGLMULTITEXCOORD1IVPROC)gladLazyResolve("glMultiTexCoord1iv");
+	glad_glMultiTexCoord1iv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1s(GLenum target, GLshort s) {
+	glad_glMultiTexCoord1s = (PFNGLMULTITEXCOORD1SPROC)gladLazyResolve("glMultiTexCoord1s");
+	glad_glMultiTexCoord1s(target, s);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord1sv = (PFNGLMULTITEXCOORD1SVPROC)gladLazyResolve("glMultiTexCoord1sv");
+	glad_glMultiTexCoord1sv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+	glad_glMultiTexCoord2d = (PFNGLMULTITEXCOORD2DPROC)gladLazyResolve("glMultiTexCoord2d");
+	glad_glMultiTexCoord2d(target, s, t);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord2dv = (PFNGLMULTITEXCOORD2DVPROC)gladLazyResolve("glMultiTexCoord2dv");
+	glad_glMultiTexCoord2dv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+	glad_glMultiTexCoord2f = (PFNGLMULTITEXCOORD2FPROC)gladLazyResolve("glMultiTexCoord2f");
+	glad_glMultiTexCoord2f(target, s, t);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord2fv = (PFNGLMULTITEXCOORD2FVPROC)gladLazyResolve("glMultiTexCoord2fv");
+	glad_glMultiTexCoord2fv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+	glad_glMultiTexCoord2i = (PFNGLMULTITEXCOORD2IPROC)gladLazyResolve("glMultiTexCoord2i");
+	glad_glMultiTexCoord2i(target, s, t);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord2iv = (PFNGLMULTITEXCOORD2IVPROC)gladLazyResolve("glMultiTexCoord2iv");
+	glad_glMultiTexCoord2iv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+	glad_glMultiTexCoord2s = (PFNGLMULTITEXCOORD2SPROC)gladLazyResolve("glMultiTexCoord2s");
+	glad_glMultiTexCoord2s(target, s, t);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord2sv = (PFNGLMULTITEXCOORD2SVPROC)gladLazyResolve("glMultiTexCoord2sv");
+	glad_glMultiTexCoord2sv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+	glad_glMultiTexCoord3d = (PFNGLMULTITEXCOORD3DPROC)gladLazyResolve("glMultiTexCoord3d");
+	glad_glMultiTexCoord3d(target, s, t, r);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord3dv = (PFNGLMULTITEXCOORD3DVPROC)gladLazyResolve("glMultiTexCoord3dv");
+	glad_glMultiTexCoord3dv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+	glad_glMultiTexCoord3f = (PFNGLMULTITEXCOORD3FPROC)gladLazyResolve("glMultiTexCoord3f");
+	glad_glMultiTexCoord3f(target, s, t, r);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord3fv = (PFNGLMULTITEXCOORD3FVPROC)gladLazyResolve("glMultiTexCoord3fv");
+	glad_glMultiTexCoord3fv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+	glad_glMultiTexCoord3i = (PFNGLMULTITEXCOORD3IPROC)gladLazyResolve("glMultiTexCoord3i");
+	glad_glMultiTexCoord3i(target, s, t, r);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord3iv = (PFNGLMULTITEXCOORD3IVPROC)gladLazyResolve("glMultiTexCoord3iv");
+	glad_glMultiTexCoord3iv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+	glad_glMultiTexCoord3s = (PFNGLMULTITEXCOORD3SPROC)gladLazyResolve("glMultiTexCoord3s");
+	glad_glMultiTexCoord3s(target, s, t, r);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord3sv = (PFNGLMULTITEXCOORD3SVPROC)gladLazyResolve("glMultiTexCoord3sv");
+	glad_glMultiTexCoord3sv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	glad_glMultiTexCoord4d = (PFNGLMULTITEXCOORD4DPROC)gladLazyResolve("glMultiTexCoord4d");
+	glad_glMultiTexCoord4d(target, s, t, r, q);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord4dv = (PFNGLMULTITEXCOORD4DVPROC)gladLazyResolve("glMultiTexCoord4dv");
+	glad_glMultiTexCoord4dv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	glad_glMultiTexCoord4f = (PFNGLMULTITEXCOORD4FPROC)gladLazyResolve("glMultiTexCoord4f");
+	glad_glMultiTexCoord4f(target, s, t, r, q);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord4fv = (PFNGLMULTITEXCOORD4FVPROC)gladLazyResolve("glMultiTexCoord4fv");
+	glad_glMultiTexCoord4fv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+	glad_glMultiTexCoord4i = (PFNGLMULTITEXCOORD4IPROC)gladLazyResolve("glMultiTexCoord4i");
+	glad_glMultiTexCoord4i(target, s, t, r, q);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord4iv = (PFNGLMULTITEXCOORD4IVPROC)gladLazyResolve("glMultiTexCoord4iv");
+	glad_glMultiTexCoord4iv(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+	glad_glMultiTexCoord4s = (PFNGLMULTITEXCOORD4SPROC)gladLazyResolve("glMultiTexCoord4s");
+	glad_glMultiTexCoord4s(target, s, t, r, q);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord4sv = (PFNGLMULTITEXCOORD4SVPROC)gladLazyResolve("glMultiTexCoord4sv");
+	glad_glMultiTexCoord4sv(target, v);
+}
+
+static void APIENTRY lazy_glLoadTransposeMatrixf(const GLfloat *m) {
+	glad_glLoadTransposeMatrixf = (PFNGLLOADTRANSPOSEMATRIXFPROC)gladLazyResolve("glLoadTransposeMatrixf");
+	glad_glLoadTransposeMatrixf(m);
+}
+
+static void APIENTRY lazy_glLoadTransposeMatrixd(const GLdouble *m) {
+	glad_glLoadTransposeMatrixd = (PFNGLLOADTRANSPOSEMATRIXDPROC)gladLazyResolve("glLoadTransposeMatrixd");
+	glad_glLoadTransposeMatrixd(m);
+}
+
+static void APIENTRY lazy_glMultTransposeMatrixf(const GLfloat *m) {
+	glad_glMultTransposeMatrixf = (PFNGLMULTTRANSPOSEMATRIXFPROC)gladLazyResolve("glMultTransposeMatrixf");
+	glad_glMultTransposeMatrixf(m);
+}
+
+static void APIENTRY lazy_glMultTransposeMatrixd(const GLdouble *m) {
+	glad_glMultTransposeMatrixd = (PFNGLMULTTRANSPOSEMATRIXDPROC)gladLazyResolve("glMultTransposeMatrixd");
+	glad_glMultTransposeMatrixd(m);
+}
+
+#endif
+static void APIENTRY lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)gladLazyResolve("glBlendFuncSeparate");
+	glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void APIENTRY lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)gladLazyResolve("glMultiDrawArrays");
+	glad_glMultiDrawArrays(mode, first, count, drawcount);
+}
+
+static void APIENTRY lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)gladLazyResolve("glMultiDrawElements");
+	glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+
+static void APIENTRY lazy_glPointParameterf(GLenum pname, GLfloat param) {
+	glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)gladLazyResolve("glPointParameterf");
+	glad_glPointParameterf(pname, param);
+}
+
+static void APIENTRY lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)gladLazyResolve("glPointParameterfv");
+	glad_glPointParameterfv(pname, params);
+}
+
+static void APIENTRY lazy_glPointParameteri(GLenum pname, GLint param) {
+	glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)gladLazyResolve("glPointParameteri");
+	glad_glPointParameteri(pname, param);
+}
+
+static void APIENTRY lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+	glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)gladLazyResolve("glPointParameteriv");
+	glad_glPointParameteriv(pname, params);
+}
+
+#ifndef GLAD_CORE_PROFILE
+static void APIENTRY lazy_glFogCoordf(GLfloat coord) {
+	glad_glFogCoordf = (PFNGLFOGCOORDFPROC)gladLazyResolve("glFogCoordf");
+	glad_glFogCoordf(coord);
+}
+
+static void APIENTRY lazy_glFogCoordfv(const GLfloat *coord) {
+	glad_glFogCoordfv = (PFNGLFOGCOORDFVPROC)gladLazyResolve("glFogCoordfv");
+	glad_glFogCoordfv(coord);
+}
+
+static void APIENTRY lazy_glFogCoordd(GLdouble coord) {
+	glad_glFogCoordd = (PFNGLFOGCOORDDPROC)gladLazyResolve("glFogCoordd");
+	glad_glFogCoordd(coord);
+}
+
+static void APIENTRY lazy_glFogCoorddv(const GLdouble *coord) {
+	glad_glFogCoorddv = (PFNGLFOGCOORDDVPROC)gladLazyResolve("glFogCoorddv");
+	glad_glFogCoorddv(coord);
+}
+
+static void APIENTRY lazy_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glFogCoordPointer = (PFNGLFOGCOORDPOINTERPROC)gladLazyResolve("glFogCoordPointer");
+	glad_glFogCoordPointer(type, stride, pointer);
+}
+
+static void APIENTRY lazy_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	glad_glSecondaryColor3b = (PFNGLSECONDARYCOLOR3BPROC)gladLazyResolve("glSecondaryColor3b");
+	glad_glSecondaryColor3b(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3bv(const GLbyte *v) {
+	glad_glSecondaryColor3bv = (PFNGLSECONDARYCOLOR3BVPROC)gladLazyResolve("glSecondaryColor3bv");
+	glad_glSecondaryColor3bv(v);
+}
+
+static void APIENTRY lazy_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	glad_glSecondaryColor3d = (PFNGLSECONDARYCOLOR3DPROC)gladLazyResolve("glSecondaryColor3d");
+	glad_glSecondaryColor3d(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3dv(const GLdouble *v) {
+	glad_glSecondaryColor3dv = (PFNGLSECONDARYCOLOR3DVPROC)gladLazyResolve("glSecondaryColor3dv");
+	glad_glSecondaryColor3dv(v);
+}
+
+static void APIENTRY lazy_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	glad_glSecondaryColor3f = (PFNGLSECONDARYCOLOR3FPROC)gladLazyResolve("glSecondaryColor3f");
+	glad_glSecondaryColor3f(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3fv(const GLfloat *v) {
+	glad_glSecondaryColor3fv = (PFNGLSECONDARYCOLOR3FVPROC)gladLazyResolve("glSecondaryColor3fv");
+	glad_glSecondaryColor3fv(v);
+}
+
+static void APIENTRY lazy_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+	glad_glSecondaryColor3i = (PFNGLSECONDARYCOLOR3IPROC)gladLazyResolve("glSecondaryColor3i");
+	glad_glSecondaryColor3i(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3iv(const GLint *v) {
+	glad_glSecondaryColor3iv = (PFNGLSECONDARYCOLOR3IVPROC)gladLazyResolve("glSecondaryColor3iv");
+	glad_glSecondaryColor3iv(v);
+}
+
+static void APIENTRY lazy_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+	glad_glSecondaryColor3s = (PFNGLSECONDARYCOLOR3SPROC)gladLazyResolve("glSecondaryColor3s");
+	glad_glSecondaryColor3s(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3sv(const GLshort *v) {
+	glad_glSecondaryColor3sv = (PFNGLSECONDARYCOLOR3SVPROC)gladLazyResolve("glSecondaryColor3sv");
+	glad_glSecondaryColor3sv(v);
+}
+
+static void APIENTRY lazy_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	glad_glSecondaryColor3ub = (PFNGLSECONDARYCOLOR3UBPROC)gladLazyResolve("glSecondaryColor3ub");
+	glad_glSecondaryColor3ub(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3ubv(const GLubyte *v) {
+	glad_glSecondaryColor3ubv = (PFNGLSECONDARYCOLOR3UBVPROC)gladLazyResolve("glSecondaryColor3ubv");
+	glad_glSecondaryColor3ubv(v);
+}
+
+static void APIENTRY lazy_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+	glad_glSecondaryColor3ui = (PFNGLSECONDARYCOLOR3UIPROC)gladLazyResolve("glSecondaryColor3ui");
+	glad_glSecondaryColor3ui(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3uiv(const GLuint *v) {
+	glad_glSecondaryColor3uiv = (PFNGLSECONDARYCOLOR3UIVPROC)gladLazyResolve("glSecondaryColor3uiv");
+	glad_glSecondaryColor3uiv(v);
+}
+
+static void APIENTRY lazy_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+	glad_glSecondaryColor3us = (PFNGLSECONDARYCOLOR3USPROC)gladLazyResolve("glSecondaryColor3us");
+	glad_glSecondaryColor3us(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3usv(const GLushort *v) {
+	glad_glSecondaryColor3usv = (PFNGLSECONDARYCOLOR3USVPROC)gladLazyResolve("glSecondaryColor3usv");
+	glad_glSecondaryColor3usv(v);
+}
+
+static void APIENTRY lazy_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glSecondaryColorPointer = (PFNGLSECONDARYCOLORPOINTERPROC)gladLazyResolve("glSecondaryColorPointer");
+	glad_glSecondaryColorPointer(size, type, stride, pointer);
+}
+
+static void APIENTRY lazy_glWindowPos2d(GLdouble x, GLdouble y) {
+	glad_glWindowPos2d = (PFNGLWINDOWPOS2DPROC)gladLazyResolve("glWindowPos2d");
+	glad_glWindowPos2d(x, y);
+}
+
+static void APIENTRY lazy_glWindowPos2dv(const GLdouble *v) {
+	glad_glWindowPos2dv = (PFNGLWINDOWPOS2DVPROC)gladLazyResolve("glWindowPos2dv");
+	glad_glWindowPos2dv(v);
+}
+
+static void APIENTRY lazy_glWindowPos2f(GLfloat x, GLfloat y) {
+	glad_glWindowPos2f = (PFNGLWINDOWPOS2FPROC)gladLazyResolve("glWindowPos2f");
+	glad_glWindowPos2f(x, y);
+}
+
+static void APIENTRY lazy_glWindowPos2fv(const GLfloat *v) {
+	glad_glWindowPos2fv = (PFNGLWINDOWPOS2FVPROC)gladLazyResolve("glWindowPos2fv");
+	glad_glWindowPos2fv(v);
+}
+
+static void APIENTRY lazy_glWindowPos2i(GLint x, GLint y) {
+	glad_glWindowPos2i = (PFNGLWINDOWPOS2IPROC)gladLazyResolve("glWindowPos2i");
+	glad_glWindowPos2i(x, y);
+}
+
+static void APIENTRY lazy_glWindowPos2iv(const GLint *v) {
+	glad_glWindowPos2iv = (PFNGLWINDOWPOS2IVPROC)gladLazyResolve("glWindowPos2iv");
+	glad_glWindowPos2iv(v);
+}
+
+static void APIENTRY lazy_glWindowPos2s(GLshort x, GLshort y) {
+	glad_glWindowPos2s = (PFNGLWINDOWPOS2SPROC)gladLazyResolve("glWindowPos2s");
+	glad_glWindowPos2s(x, y);
+}
+
+static void APIENTRY lazy_glWindowPos2sv(const GLshort *v) {
+	glad_glWindowPos2sv = (PFNGLWINDOWPOS2SVPROC)gladLazyResolve("glWindowPos2sv");
+	glad_glWindowPos2sv(v);
+}
+
+static void APIENTRY lazy_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glWindowPos3d = (PFNGLWINDOWPOS3DPROC)gladLazyResolve("glWindowPos3d");
+	glad_glWindowPos3d(x, y, z);
+}
+
+static void APIENTRY lazy_glWindowPos3dv(const GLdouble *v) {
+	glad_glWindowPos3dv = (PFNGLWINDOWPOS3DVPROC)gladLazyResolve("glWindowPos3dv");
+	glad_glWindowPos3dv(v);
+}
+
+static void APIENTRY lazy_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glWindowPos3f = (PFNGLWINDOWPOS3FPROC)gladLazyResolve("glWindowPos3f");
+	glad_glWindowPos3f(x, y, z);
+}
+
+static void APIENTRY lazy_glWindowPos3fv(const GLfloat *v) {
+	glad_glWindowPos3fv = (PFNGLWINDOWPOS3FVPROC)gladLazyResolve("glWindowPos3fv");
+	glad_glWindowPos3fv(v);
+}
+
+static void APIENTRY lazy_glWindowPos3i(GLint x, GLint y, GLint z) {
+	glad_glWindowPos3i = (PFNGLWINDOWPOS3IPROC)gladLazyResolve("glWindowPos3i");
+	glad_glWindowPos3i(x, y, z);
+}
+
+static void APIENTRY lazy_glWindowPos3iv(const GLint *v) {
+	glad_glWindowPos3iv = (PFNGLWINDOWPOS3IVPROC)gladLazyResolve("glWindowPos3iv");
+	glad_glWindowPos3iv(v);
+}
+
+static void APIENTRY lazy_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+	glad_glWindowPos3s = (PFNGLWINDOWPOS3SPROC)gladLazyResolve("glWindowPos3s");
+	glad_glWindowPos3s(x, y, z);
+}
+
+static void APIENTRY lazy_glWindowPos3sv(const GLshort *v) {
+	glad_glWindowPos3sv = (PFNGLWINDOWPOS3SVPROC)gladLazyResolve("glWindowPos3sv");
+	glad_glWindowPos3sv(v);
+}
+
+#endif
+static void APIENTRY lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glBlendColor = (PFNGLBLENDCOLORPROC)gladLazyResolve("glBlendColor");
+	glad_glBlendColor(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glBlendEquation(GLenum mode) {
+	glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)gladLazyResolve("glBlendEquation");
+	glad_glBlendEquation(mode);
+}
+
+static void APIENTRY lazy_glGenQueries(GLsizei n, GLuint *ids) {
+	glad_glGenQueries = (PFNGLGENQUERIESPROC)gladLazyResolve("glGenQueries");
+	glad_glGenQueries(n, ids);
+}
+
+static void APIENTRY lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)gladLazyResolve("glDeleteQueries");
+	glad_glDeleteQueries(n, ids);
+}
+
+static GLboolean APIENTRY lazy_glIsQuery(GLuint id) {
+	glad_glIsQuery = (PFNGLISQUERYPROC)gladLazyResolve("glIsQuery");
+	return glad_glIsQuery(id);
+}
+
+static void APIENTRY lazy_glBeginQuery(GLenum target, GLuint id) {
+	glad_glBeginQuery = (PFNGLBEGINQUERYPROC)gladLazyResolve("glBeginQuery");
+	glad_glBeginQuery(target, id);
+}
+
+static void APIENTRY lazy_glEndQuery(GLenum target) {
+	glad_glEndQuery = (PFNGLENDQUERYPROC)gladLazyResolve("glEndQuery");
+	glad_glEndQuery(target);
+}
+
+static void APIENTRY lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)gladLazyResolve("glGetQueryiv");
+	glad_glGetQueryiv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)gladLazyResolve("glGetQueryObjectiv");
+	glad_glGetQueryObjectiv(id, pname, params);
+}
+
+static void APIENTRY lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)gladLazyResolve("glGetQueryObjectuiv");
+	glad_glGetQueryObjectuiv(id, pname, params);
+}
+
+static void APIENTRY lazy_glBindBuffer(GLenum target, GLuint buffer) {
+	glad_glBindBuffer = (PFNGLBINDBUFFERPROC)gladLazyResolve("glBindBuffer");
+	glad_glBindBuffer(target, buffer);
+}
+
+static void APIENTRY lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)gladLazyResolve("glDeleteBuffers");
+	glad_glDeleteBuffers(n, buffers);
+}
+
+static void APIENTRY lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+	glad_glGenBuffers = (PFNGLGENBUFFERSPROC)gladLazyResolve("glGenBuffers");
+	glad_glGenBuffers(n, buffers);
+}
+
+static GLboolean APIENTRY lazy_glIsBuffer(GLuint buffer) {
+	glad_glIsBuffer = (PFNGLISBUFFERPROC)gladLazyResolve("glIsBuffer");
+	return glad_glIsBuffer(buffer);
+}
+
+static void APIENTRY lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_glBufferData = (PFNGLBUFFERDATAPROC)gladLazyResolve("glBufferData");
+	glad_glBufferData(target, size, data, usage);
+}
+
+static void APIENTRY lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)gladLazyResolve("glBufferSubData");
+	glad_glBufferSubData(target, offset, size, data);
+}
+
+static void APIENTRY lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)gladLazyResolve("glGetBufferSubData");
+	glad_glGetBufferSubData(target, offset, size, data);
+}
+
+static void * APIENTRY lazy_glMapBuffer(GLenum target, GLenum access) {
+	glad_glMapBuffer = (PFNGLMAPBUFFERPROC)gladLazyResolve("glMapBuffer");
+	return glad_glMapBuffer(target, access);
+}
+
+static GLboolean APIENTRY lazy_glUnmapBuffer(GLenum target) {
+	glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)gladLazyResolve("glUnmapBuffer");
+	return glad_glUnmapBuffer(target);
+}
+
+static void APIENTRY lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)gladLazyResolve("glGetBufferParameteriv");
+	glad_glGetBufferParameteriv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)gladLazyResolve("glGetBufferPointerv");
+	glad_glGetBufferPointerv(target, pname, params);
+}
+
+static void APIENTRY lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)gladLazyResolve("glBlendEquationSeparate");
+	glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+
+static void APIENTRY lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)gladLazyResolve("glDrawBuffers");
+	glad_glDrawBuffers(n, bufs);
+}
+
+static void APIENTRY lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)gladLazyResolve("glStencilOpSeparate");
+	glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+
+static void APIENTRY lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)gladLazyResolve("glStencilFuncSeparate");
+	glad_glStencilFuncSeparate(face, func, ref, mask);
+}
+
+static void APIENTRY lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)gladLazyResolve("glStencilMaskSeparate");
+	glad_glStencilMaskSeparate(face, mask);
+}
+
+static void APIENTRY lazy_glAttachShader(GLuint program, GLuint shader) {
+	glad_glAttachShader = (PFNGLATTACHSHADERPROC)gladLazyResolve("glAttachShader");
+	glad_glAttachShader(program, shader);
+}
+
+static void APIENTRY lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)gladLazyResolve("glBindAttribLocation");
+	glad_glBindAttribLocation(program, index, name);
+}
+
+static void APIENTRY lazy_glCompileShader(GLuint shader) {
+	glad_glCompileShader = (PFNGLCOMPILESHADERPROC)gladLazyResolve("glCompileShader");
+	glad_glCompileShader(shader);
+}
+
+static GLuint APIENTRY lazy_glCreateProgram(void) {
+	glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)gladLazyResolve("glCreateProgram");
+	return glad_glCreateProgram();
+}
+
+static GLuint APIENTRY lazy_glCreateShader(GLenum type) {
+	glad_glCreateShader = (PFNGLCREATESHADERPROC)gladLazyResolve("glCreateShader");
+	return glad_glCreateShader(type);
+}
+
+static void APIENTRY lazy_glDeleteProgram(GLuint program) {
+	glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)gladLazyResolve("glDeleteProgram");
+	glad_glDeleteProgram(program);
+}
+
+static void APIENTRY lazy_glDeleteShader(GLuint shader) {
+	glad_glDeleteShader = (PFNGLDELETESHADERPROC)gladLazyResolve("glDeleteShader");
+	glad_glDeleteShader(shader);
+}
+
+static void APIENTRY lazy_glDetachShader(GLuint program, GLuint shader) {
+	glad_glDetachShader = (PFNGLDETACHSHADERPROC)gladLazyResolve("glDetachShader");
+	glad_glDetachShader(program, shader);
+}
+
+static void APIENTRY lazy_glDisableVertexAttribArray(GLuint index) {
+	glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)gladLazyResolve("glDisableVertexAttribArray");
+	glad_glDisableVertexAttribArray(index);
+}
+
+static void APIENTRY lazy_glEnableVertexAttribArray(GLuint index) {
+	glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)gladLazyResolve("glEnableVertexAttribArray");
+	glad_glEnableVertexAttribArray(index);
+}
+
+static void APIENTRY lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)gladLazyResolve("glGetActiveAttrib");
+	glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+
+static void APIENTRY lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)gladLazyResolve("glGetActiveUniform");
+	glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+
+static void APIENTRY lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)gladLazyResolve("glGetAttachedShaders");
+	glad_glGetAttachedShaders(program, maxCount, count, shaders);
+}
+
+static GLint APIENTRY lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+	glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)gladLazyResolve("glGetAttribLocation");
+	return glad_glGetAttribLocation(program, name);
+}
+
+static void APIENTRY lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)gladLazyResolve("glGetProgramiv");
+	glad_glGetProgramiv(program, pname, params);
+}
+
+static void APIENTRY lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)gladLazyResolve("glGetProgramInfoLog");
+	glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+
+static void APIENTRY lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)gladLazyResolve("glGetShaderiv");
+	glad_glGetShaderiv(shader, pname, params);
+}
+
+static void APIENTRY lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)gladLazyResolve("glGetShaderInfoLog");
+	glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+
+static void APIENTRY lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)gladLazyResolve("glGetShaderSource");
+	glad_glGetShaderSource(shader, bufSize, length, source);
+}
+
+static GLint APIENTRY lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+	glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)gladLazyResolve("glGetUniformLocation");
+	return glad_glGetUniformLocation(program, name);
+}
+
+static void APIENTRY lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)gladLazyResolve("glGetUniformfv");
+	glad_glGetUniformfv(program, location, params);
+}
+
+static void APIENTRY lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)gladLazyResolve("glGetUniformiv");
+	glad_glGetUniformiv(program, location, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)gladLazyResolve("glGetVertexAttribdv");
+	glad_glGetVertexAttribdv(index, pname, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)gladLazyResolve("glGetVertexAttribfv");
+	glad_glGetVertexAttribfv(index, pname, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)gladLazyResolve("glGetVertexAttribiv");
+	glad_glGetVertexAttribiv(index, pname, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)gladLazyResolve("glGetVertexAttribPointerv");
+	glad_glGetVertexAttribPointerv(index, pname, pointer);
+}
+
+static GLboolean APIENTRY lazy_glIsProgram(GLuint program) {
+	glad_glIsProgram = (PFNGLISPROGRAMPROC)gladLazyResolve("glIsProgram");
+	return glad_glIsProgram(program);
+}
+
+static GLboolean APIENTRY lazy_glIsShader(GLuint shader) {
+	glad_glIsShader = (PFNGLISSHADERPROC)gladLazyResolve("glIsShader");
+	return glad_glIsShader(shader);
+}
+
+static void APIENTRY lazy_glLinkProgram(GLuint program) {
+	glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)gladLazyResolve("glLinkProgram");
+	glad_glLinkProgram(program);
+}
+
+static void APIENTRY lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	glad_glShaderSource = (PFNGLSHADERSOURCEPROC)gladLazyResolve("glShaderSource");
+	glad_glShaderSource(shader, count, string, length);
+}
+
+static void APIENTRY lazy_glUseProgram(GLuint program) {
+	glad_glUseProgram = (PFNGLUSEPROGRAMPROC)gladLazyResolve("glUseProgram");
+	glad_glUseProgram(program);
+}
+
+static void APIENTRY lazy_glUniform1f(GLint location, GLfloat v0) {
+	glad_glUniform1f = (PFNGLUNIFORM1FPROC)gladLazyResolve("glUniform1f");
+	glad_glUniform1f(location, v0);
+}
+
+static void APIENTRY lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	glad_glUniform2f = (PFNGLUNIFORM2FPROC)gladLazyResolve("glUniform2f");
+	glad_glUniform2f(location, v0, v1);
+}
+
+static void APIENTRY lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_glUniform3f = (PFNGLUNIFORM3FPROC)gladLazyResolve("glUniform3f");
+	glad_glUniform3f(location, v0, v1, v2);
+}
+
+static void APIENTRY lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_glUniform4f = (PFNGLUNIFORM4FPROC)gladLazyResolve("glUniform4f");
+	glad_glUniform4f(location, v0, v1, v2, v3);
+}
+
+static void APIENTRY lazy_glUniform1i(GLint location, GLint v0) {
+	glad_glUniform1i = (PFNGLUNIFORM1IPROC)gladLazyResolve("glUniform1i");
+	glad_glUniform1i(location, v0);
+}
+
+static void APIENTRY lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+	glad_glUniform2i = (PFNGLUNIFORM2IPROC)gladLazyResolve("glUniform2i");
+	glad_glUniform2i(location, v0, v1);
+}
+
+static void APIENTRY lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_glUniform3i = (PFNGLUNIFORM3IPROC)gladLazyResolve("glUniform3i");
+	glad_glUniform3i(location, v0, v1, v2);
+}
+
+static void APIENTRY lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_glUniform4i = (PFNGLUNIFORM4IPROC)gladLazyResolve("glUniform4i");
+	glad_glUniform4i(location, v0, v1, v2, v3);
+}
+
+static void APIENTRY lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)gladLazyResolve("glUniform1fv");
+	glad_glUniform1fv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)gladLazyResolve("glUniform2fv");
+	glad_glUniform2fv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)gladLazyResolve("glUniform3fv");
+	glad_glUniform3fv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)gladLazyResolve("glUniform4fv");
+	glad_glUniform4fv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)gladLazyResolve("glUniform1iv");
+	glad_glUniform1iv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)gladLazyResolve("glUniform2iv");
+	glad_glUniform2iv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)gladLazyResolve("glUniform3iv");
+	glad_glUniform3iv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)gladLazyResolve("glUniform4iv");
+	glad_glUniform4iv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)gladLazyResolve("glUniformMatrix2fv");
+	glad_glUniformMatrix2fv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)gladLazyResolve("glUniformMatrix3fv");
+	glad_glUniformMatrix3fv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)gladLazyResolve("glUniformMatrix4fv");
+	glad_glUniformMatrix4fv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glValidateProgram(GLuint program) {
+	glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)gladLazyResolve("glValidateProgram");
+	glad_glValidateProgram(program);
+}
+
+static void APIENTRY lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+	glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)gladLazyResolve("glVertexAttrib1d");
+	glad_glVertexAttrib1d(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)gladLazyResolve("glVertexAttrib1dv");
+	glad_glVertexAttrib1dv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+	glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)gladLazyResolve("glVertexAttrib1f");
+	glad_glVertexAttrib1f(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)gladLazyResolve("glVertexAttrib1fv");
+	glad_glVertexAttrib1fv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+	glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)gladLazyResolve("glVertexAttrib1s");
+	glad_glVertexAttrib1s(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)gladLazyResolve("glVertexAttrib1sv");
+	glad_glVertexAttrib1sv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)gladLazyResolve("glVertexAttrib2d");
+	glad_glVertexAttrib2d(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)gladLazyResolve("glVertexAttrib2dv");
+	glad_glVertexAttrib2dv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)gladLazyResolve("glVertexAttrib2f");
+	glad_glVertexAttrib2f(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)gladLazyResolve("glVertexAttrib2fv");
+	glad_glVertexAttrib2fv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)gladLazyResolve("glVertexAttrib2s");
+	glad_glVertexAttrib2s(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)gladLazyResolve("glVertexAttrib2sv");
+	glad_glVertexAttrib2sv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)gladLazyResolve("glVertexAttrib3d");
+	glad_glVertexAttrib3d(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)gladLazyResolve("glVertexAttrib3dv");
+	glad_glVertexAttrib3dv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)gladLazyResolve("glVertexAttrib3f");
+	glad_glVertexAttrib3f(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)gladLazyResolve("glVertexAttrib3fv");
+	glad_glVertexAttrib3fv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)gladLazyResolve("glVertexAttrib3s");
+	glad_glVertexAttrib3s(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)gladLazyResolve("glVertexAttrib3sv");
+	glad_glVertexAttrib3sv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)gladLazyResolve("glVertexAttrib4Nbv");
+	glad_glVertexAttrib4Nbv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)gladLazyResolve("glVertexAttrib4Niv");
+	glad_glVertexAttrib4Niv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)gladLazyResolve("glVertexAttrib4Nsv");
+	glad_glVertexAttrib4Nsv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)gladLazyResolve("glVertexAttrib4Nub");
+	glad_glVertexAttrib4Nub(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)gladLazyResolve("glVertexAttrib4Nubv");
+	glad_glVertexAttrib4Nubv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)gladLazyResolve("glVertexAttrib4Nuiv");
+	glad_glVertexAttrib4Nuiv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)gladLazyResolve("glVertexAttrib4Nusv");
+	glad_glVertexAttrib4Nusv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)gladLazyResolve("glVertexAttrib4bv");
+	glad_glVertexAttrib4bv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)gladLazyResolve("glVertexAttrib4d");
+	glad_glVertexAttrib4d(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)gladLazyResolve("glVertexAttrib4dv");
+	glad_glVertexAttrib4dv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)gladLazyResolve("glVertexAttrib4f");
+	glad_glVertexAttrib4f(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)gladLazyResolve("glVertexAttrib4fv");
+	glad_glVertexAttrib4fv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)gladLazyResolve("glVertexAttrib4iv");
+	glad_glVertexAttrib4iv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)gladLazyResolve("glVertexAttrib4s");
+	glad_glVertexAttrib4s(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)gladLazyResolve("glVertexAttrib4sv");
+	glad_glVertexAttrib4sv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)gladLazyResolve("glVertexAttrib4ubv");
+	glad_glVertexAttrib4ubv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)gladLazyResolve("glVertexAttrib4uiv");
+	glad_glVertexAttrib4uiv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)gladLazyResolve("glVertexAttrib4usv");
+	glad_glVertexAttrib4usv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)gladLazyResolve("glVertexAttribPointer");
+	glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+static void APIENTRY lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)gladLazyResolve("glUniformMatrix2x3fv");
+	glad_glUniformMatrix2x3fv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)gladLazyResolve("glUniformMatrix3x2fv");
+	glad_glUniformMatrix3x2fv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)gladLazyResolve("glUniformMatrix2x4fv");
+	glad_glUniformMatrix2x4fv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)gladLazyResolve("glUniformMatrix4x2fv");
+	glad_glUniformMatrix4x2fv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)gladLazyResolve("glUniformMatrix3x4fv");
+	glad_glUniformMatrix3x4fv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)gladLazyResolve("glUniformMatrix4x3fv");
+	glad_glUniformMatrix4x3fv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	glad_glColorMaski = (PFNGLCOLORMASKIPROC)gladLazyResolve("glColorMaski");
+	glad_glColorMaski(index, r, g, b, a);
+}
+
+static void APIENTRY lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)gladLazyResolve("glGetBooleani_v");
+	glad_glGetBooleani_v(target, index, data);
+}
+
+static void APIENTRY lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)gladLazyResolve("glGetIntegeri_v");
+	glad_glGetIntegeri_v(target, index, data);
+}
+
+static void APIENTRY lazy_glEnablei(GLenum target, GLuint index) {
+	glad_glEnablei = (PFNGLENABLEIPROC)gladLazyResolve("glEnablei");
+	glad_glEnablei(target, index);
+}
+
+static void APIENTRY lazy_glDisablei(GLenum target, GLuint index) {
+	glad_glDisablei = (PFNGLDISABLEIPROC)gladLazyResolve("glDisablei");
+	glad_glDisablei(target, index);
+}
+
+static GLboolean APIENTRY lazy_glIsEnabledi(GLenum target, GLuint index) {
+	glad_glIsEnabledi = (PFNGLISENABLEDIPROC)gladLazyResolve("glIsEnabledi");
+	return glad_glIsEnabledi(target, index);
+}
+
+static void APIENTRY lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+	glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)gladLazyResolve("glBeginTransformFeedback");
+	glad_glBeginTransformFeedback(primitiveMode);
+}
+
+static void APIENTRY lazy_glEndTransformFeedback(void) {
+	glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)gladLazyResolve("glEndTransformFeedback");
+	glad_glEndTransformFeedback();
+}
+
+static void APIENTRY lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)gladLazyResolve("glBindBufferRange");
+	glad_glBindBufferRange(target, index, buffer, offset, size);
+}
+
+static void APIENTRY lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)gladLazyResolve("glBindBufferBase");
+	glad_glBindBufferBase(target, index, buffer);
+}
+
+static void APIENTRY lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)gladLazyResolve("glTransformFeedbackVaryings");
+	glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+
+static void APIENTRY lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)gladLazyResolve("glGetTransformFeedbackVarying");
+	glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+
+static void APIENTRY lazy_glClampColor(GLenum target, GLenum clamp) {
+	glad_glClampColor = (PFNGLCLAMPCOLORPROC)gladLazyResolve("glClampColor");
+	glad_glClampColor(target, clamp);
+}
+
+static void APIENTRY lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+	glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)gladLazyResolve("glBeginConditionalRender");
+	glad_glBeginConditionalRender(id, mode);
+}
+
+static void APIENTRY lazy_glEndConditionalRender(void) {
+	glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)gladLazyResolve("glEndConditionalRender");
+	glad_glEndConditionalRender();
+}
+
+static void APIENTRY lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)gladLazyResolve("glVertexAttribIPointer");
+	glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+
+static void APIENTRY lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)gladLazyResolve("glGetVertexAttribIiv");
+	glad_glGetVertexAttribIiv(index, pname, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)gladLazyResolve("glGetVertexAttribIuiv");
+	glad_glGetVertexAttribIuiv(index, pname, params);
+}
+
+static void APIENTRY lazy_glVertexAttribI1i(GLuint index, GLint x) {
+	glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)gladLazyResolve("glVertexAttribI1i");
+	glad_glVertexAttribI1i(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)gladLazyResolve("glVertexAttribI2i");
+	glad_glVertexAttribI2i(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)gladLazyResolve("glVertexAttribI3i");
+	glad_glVertexAttribI3i(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)gladLazyResolve("glVertexAttribI4i");
+	glad_glVertexAttribI4i(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+	glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)gladLazyResolve("glVertexAttribI1ui");
+	glad_glVertexAttribI1ui(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)gladLazyResolve("glVertexAttribI2ui");
+	glad_glVertexAttribI2ui(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)gladLazyResolve("glVertexAttribI3ui");
+	glad_glVertexAttribI3ui(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)gladLazyResolve("glVertexAttribI4ui");
+	glad_glVertexAttribI4ui(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)gladLazyResolve("glVertexAttribI1iv");
+	glad_glVertexAttribI1iv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)gladLazyResolve("glVertexAttribI2iv");
+	glad_glVertexAttribI2iv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)gladLazyResolve("glVertexAttribI3iv");
+	glad_glVertexAttribI3iv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)gladLazyResolve("glVertexAttribI4iv");
+	glad_glVertexAttribI4iv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)gladLazyResolve("glVertexAttribI1uiv");
+	glad_glVertexAttribI1uiv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)gladLazyResolve("glVertexAttribI2uiv");
+	glad_glVertexAttribI2uiv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)gladLazyResolve("glVertexAttribI3uiv");
+	glad_glVertexAttribI3uiv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)gladLazyResolve("glVertexAttribI4uiv");
+	glad_glVertexAttribI4uiv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)gladLazyResolve("glVertexAttribI4bv");
+	glad_glVertexAttribI4bv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)gladLazyResolve("glVertexAttribI4sv");
+	glad_glVertexAttribI4sv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)gladLazyResolve("glVertexAttribI4ubv");
+	glad_glVertexAttribI4ubv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)gladLazyResolve("glVertexAttribI4usv");
+	glad_glVertexAttribI4usv(index, v);
+}
+
+static void APIENTRY lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)gladLazyResolve("glGetUniformuiv");
+	glad_glGetUniformuiv(program, location, params);
+}
+
+static void APIENTRY lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)gladLazyResolve("glBindFragDataLocation");
+	glad_glBindFragDataLocation(program, color, name);
+}
+
+static GLint APIENTRY lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)gladLazyResolve("glGetFragDataLocation");
+	return glad_glGetFragDataLocation(program, name);
+}
+
+static void APIENTRY lazy_glUniform1ui(GLint location, GLuint v0) {
+	glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)gladLazyResolve("glUniform1ui");
+	glad_glUniform1ui(location, v0);
+}
+
+static void APIENTRY lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)gladLazyResolve("glUniform2ui");
+	glad_glUniform2ui(location, v0, v1);
+}
+
+static void APIENTRY lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)gladLazyResolve("glUniform3ui");
+	glad_glUniform3ui(location, v0, v1, v2);
+}
+
+static void APIENTRY lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)gladLazyResolve("glUniform4ui");
+	glad_glUniform4ui(location, v0, v1, v2, v3);
+}
+
+static void APIENTRY lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)gladLazyResolve("glUniform1uiv");
+	glad_glUniform1uiv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)gladLazyResolve("glUniform2uiv");
+	glad_glUniform2uiv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)gladLazyResolve("glUniform3uiv");
+	glad_glUniform3uiv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)gladLazyResolve("glUniform4uiv");
+	glad_glUniform4uiv(location, count, value);
+}
+
+static void APIENTRY lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)gladLazyResolve("glTexParameterIiv");
+	glad_glTexParameterIiv(target, pname, params);
+}
+
+static void APIENTRY lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)gladLazyResolve("glTexParameterIuiv");
+	glad_glTexParameterIuiv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)gladLazyResolve("glGetTexParameterIiv");
+	glad_glGetTexParameterIiv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)gladLazyResolve("glGetTexParameterIuiv");
+	glad_glGetTexParameterIuiv(target, pname, params);
+}
+
+static void APIENTRY lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)gladLazyResolve("glClearBufferiv");
+	glad_glClearBufferiv(buffer, drawbuffer, value);
+}
+
+static void APIENTRY lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)gladLazyResolve("glClearBufferuiv");
+	glad_glClearBufferuiv(buffer, drawbuffer, value);
+}
+
+static void APIENTRY lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)gladLazyResolve("glClearBufferfv");
+	glad_glClearBufferfv(buffer, drawbuffer, value);
+}
+
+static void APIENTRY lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)gladLazyResolve("glClearBufferfi");
+	glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+
+static const GLubyte * APIENTRY lazy_glGetStringi(GLenum name, GLuint index) {
+	glad_glGetStringi = (PFNGLGETSTRINGIPROC)gladLazyResolve("glGetStringi");
+	return glad_glGetStringi(name, index);
+}
+
+static GLboolean APIENTRY lazy_glIsRenderbuffer(GLuint renderbuffer) {
+	glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)gladLazyResolve("glIsRenderbuffer");
+	return glad_glIsRenderbuffer(renderbuffer);
+}
+
+static void APIENTRY lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)gladLazyResolve("glBindRenderbuffer");
+	glad_glBindRenderbuffer(target, renderbuffer);
+}
+
+static void APIENTRY lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)gladLazyResolve("glDeleteRenderbuffers");
+	glad_glDeleteRenderbuffers(n, renderbuffers);
+}
+
+static void APIENTRY lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)gladLazyResolve("glGenRenderbuffers");
+	glad_glGenRenderbuffers(n, renderbuffers);
+}
+
+static void APIENTRY lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)gladLazyResolve("glRenderbufferStorage");
+	glad_glRenderbufferStorage(target, internalformat, width, height);
+}
+
+static void APIENTRY lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)gladLazyResolve("glGetRenderbufferParameteriv");
+	glad_glGetRenderbufferParameteriv(target, pname, params);
+}
+
+static GLboolean APIENTRY lazy_glIsFramebuffer(GLuint framebuffer) {
+	glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)gladLazyResolve("glIsFramebuffer");
+	return glad_glIsFramebuffer(framebuffer);
+}
+
+static void APIENTRY lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)gladLazyResolve("glBindFramebuffer");
+	glad_glBindFramebuffer(target, framebuffer);
+}
+
+static void APIENTRY lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)gladLazyResolve("glDeleteFramebuffers");
+	glad_glDeleteFramebuffers(n, framebuffers);
+}
+
+static void APIENTRY lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)gladLazyResolve("glGenFramebuffers");
+	glad_glGenFramebuffers(n, framebuffers);
+}
+
+static GLenum APIENTRY lazy_glCheckFramebufferStatus(GLenum target) {
+	glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)gladLazyResolve("glCheckFramebufferStatus");
+	return glad_glCheckFramebufferStatus(target);
+}
+
+static void APIENTRY lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)gladLazyResolve("glFramebufferTexture1D");
+	glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+
+static void APIENTRY lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)gladLazyResolve("glFramebufferTexture2D");
+	glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+static void APIENTRY lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)gladLazyResolve("glFramebufferTexture3D");
+	glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+
+static void APIENTRY lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)gladLazyResolve("glFramebufferRenderbuffer");
+	glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void APIENTRY lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)gladLazyResolve("glGetFramebufferAttachmentParameteriv");
+	glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+
+static void APIENTRY lazy_glGenerateMipmap(GLenum target) {
+	glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)gladLazyResolve("glGenerateMipmap");
+	glad_glGenerateMipmap(target);
+}
+
+static void APIENTRY lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)gladLazyResolve("glBlitFramebuffer");
+	glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static void APIENTRY lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)gladLazyResolve("glRenderbufferStorageMultisample");
+	glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+
+static void APIENTRY lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)gladLazyResolve("glFramebufferTextureLayer");
+	glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+
+static void * APIENTRY lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)gladLazyResolve("glMapBufferRange");
+	return glad_glMapBufferRange(target, offset, length, access);
+}
+
+static void APIENTRY lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)gladLazyResolve("glFlushMappedBufferRange");
+	glad_glFlushMappedBufferRange(target, offset, length);
+}
+
+static void APIENTRY lazy_glBindVertexArray(GLuint array) {
+	glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)gladLazyResolve("glBindVertexArray");
+	glad_glBindVertexArray(array);
+}
+
+static void APIENTRY lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)gladLazyResolve("glDeleteVertexArrays");
+	glad_glDeleteVertexArrays(n, arrays);
+}
+
+static void APIENTRY lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)gladLazyResolve("glGenVertexArrays");
+	glad_glGenVertexArrays(n, arrays);
+}
+
+static GLboolean APIENTRY lazy_glIsVertexArray(GLuint array) {
+	glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)gladLazyResolve("glIsVertexArray");
+	return glad_glIsVertexArray(array);
+}
+
+static void APIENTRY lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)gladLazyResolve("glDrawArraysInstanced");
+	glad_glDrawArraysInstanced(mode, first, count, instancecount);
+}
+
+static void APIENTRY lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)gladLazyResolve("glDrawElementsInstanced");
+	glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+
+static void APIENTRY lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	glad_glTexBuffer = (PFNGLTEXBUFFERPROC)gladLazyResolve("glTexBuffer");
+	glad_glTexBuffer(target, internalformat, buffer);
+}
+
+static void APIENTRY lazy_glPrimitiveRestartIndex(GLuint index) {
+	glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)gladLazyResolve("glPrimitiveRestartIndex");
+	glad_glPrimitiveRestartIndex(index);
+}
+
+static void APIENTRY lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)gladLazyResolve("glCopyBufferSubData");
+	glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+static void APIENTRY lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)gladLazyResolve("glGetUniformIndices");
+	glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+
+static void APIENTRY lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)gladLazyResolve("glGetActiveUniformsiv");
+	glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+
+static void APIENTRY lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)gladLazyResolve("glGetActiveUniformName");
+	glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+
+static GLuint APIENTRY lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)gladLazyResolve("glGetUniformBlockIndex");
+	return glad_glGetUniformBlockIndex(program, uniformBlockName);
+}
+
+static void APIENTRY lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)gladLazyResolve("glGetActiveUniformBlockiv");
+	glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+
+static void APIENTRY lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)gladLazyResolve("glGetActiveUniformBlockName");
+	glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+
+static void APIENTRY lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)gladLazyResolve("glUniformBlockBinding");
+	glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+
+static void APIENTRY lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)gladLazyResolve("glDrawElementsBaseVertex");
+	glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+
+static void APIENTRY lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)gladLazyResolve("glDrawRangeElementsBaseVertex");
+	glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+
+static void APIENTRY lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)gladLazyResolve("glDrawElementsInstancedBaseVertex");
+	glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+
+static void APIENTRY lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)gladLazyResolve("glMultiDrawElementsBaseVertex");
+	glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+
+static void APIENTRY lazy_glProvokingVertex(GLenum mode) {
+	glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)gladLazyResolve("glProvokingVertex");
+	glad_glProvokingVertex(mode);
+}
+
+static GLsync APIENTRY lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+	glad_glFenceSync = (PFNGLFENCESYNCPROC)gladLazyResolve("glFenceSync");
+	return glad_glFenceSync(condition, flags);
+}
+
+static GLboolean APIENTRY lazy_glIsSync(GLsync sync) {
+	glad_glIsSync = (PFNGLISSYNCPROC)gladLazyResolve("glIsSync");
+	return glad_glIsSync(sync);
+}
+
+static void APIENTRY lazy_glDeleteSync(GLsync sync) {
+	glad_glDeleteSync = (PFNGLDELETESYNCPROC)gladLazyResolve("glDeleteSync");
+	glad_glDeleteSync(sync);
+}
+
+static GLenum APIENTRY lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)gladLazyResolve("glClientWaitSync");
+	return glad_glClientWaitSync(sync, flags, timeout);
+}
+
+static void APIENTRY lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_glWaitSync = (PFNGLWAITSYNCPROC)gladLazyResolve("glWaitSync");
+	glad_glWaitSync(sync, flags, timeout);
+}
+
+static void APIENTRY lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+	glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)gladLazyResolve("glGetInteger64v");
+	glad_glGetInteger64v(pname, data);
+}
+
+static void APIENTRY lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	glad_glGetSynciv = (PFNGLGETSYNCIVPROC)gladLazyResolve("glGetSynciv");
+	glad_glGetSynciv(sync, pname, count, length, values);
+}
+
+static void APIENTRY lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)gladLazyResolve("glGetInteger64i_v");
+	glad_glGetInteger64i_v(target, index, data);
+}
+
+static void APIENTRY lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)gladLazyResolve("glGetBufferParameteri64v");
+	glad_glGetBufferParameteri64v(target, pname, params);
+}
+
+static void APIENTRY lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)gladLazyResolve("glFramebufferTexture");
+	glad_glFramebufferTexture(target, attachment, texture, level);
+}
+
+static void APIENTRY lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)gladLazyResolve("glTexImage2DMultisample");
+	glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void APIENTRY lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)gladLazyResolve("glTexImage3DMultisample");
+	glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void APIENTRY lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)gladLazyResolve("glGetMultisamplefv");
+	glad_glGetMultisamplefv(pname, index, val);
+}
+
+static void APIENTRY lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)gladLazyResolve("glSampleMaski");
+	glad_glSampleMaski(maskNumber, mask);
+}
+
+static void APIENTRY lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)gladLazyResolve("glBindFragDataLocationIndexed");
+	glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+
+static GLint APIENTRY lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)gladLazyResolve("glGetFragDataIndex");
+	return glad_glGetFragDataIndex(program, name);
+}
+
+static void APIENTRY lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+	glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)gladLazyResolve("glGenSamplers");
+	glad_glGenSamplers(count, samplers);
+}
+
+static void APIENTRY lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)gladLazyResolve("glDeleteSamplers");
+	glad_glDeleteSamplers(count, samplers);
+}
+
+static GLboolean APIENTRY lazy_glIsSampler(GLuint sampler) {
+	glad_glIsSampler = (PFNGLISSAMPLERPROC)gladLazyResolve("glIsSampler");
+	return glad_glIsSampler(sampler);
+}
+
+static void APIENTRY lazy_glBindSampler(GLuint unit, GLuint sampler) {
+	glad_glBindSampler = (PFNGLBINDSAMPLERPROC)gladLazyResolve("glBindSampler");
+	glad_glBindSampler(unit, sampler);
+}
+
+static void APIENTRY lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)gladLazyResolve("glSamplerParameteri");
+	glad_glSamplerParameteri(sampler, pname, param);
+}
+
+static void APIENTRY lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)gladLazyResolve("glSamplerParameteriv");
+	glad_glSamplerParameteriv(sampler, pname, param);
+}
+
+static void APIENTRY lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)gladLazyResolve("glSamplerParameterf");
+	glad_glSamplerParameterf(sampler, pname, param);
+}
+
+static void APIENTRY lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)gladLazyResolve("glSamplerParameterfv");
+	glad_glSamplerParameterfv(sampler, pname, param);
+}
+
+static void APIENTRY lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)gladLazyResolve("glSamplerParameterIiv");
+	glad_glSamplerParameterIiv(sampler, pname, param);
+}
+
+static void APIENTRY lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)gladLazyResolve("glSamplerParameterIuiv");
+	glad_glSamplerParameterIuiv(sampler, pname, param);
+}
+
+static void APIENTRY lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)gladLazyResolve("glGetSamplerParameteriv");
+	glad_glGetSamplerParameteriv(sampler, pname, params);
+}
+
+static void APIENTRY lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)gladLazyResolve("glGetSamplerParameterIiv");
+	glad_glGetSamplerParameterIiv(sampler, pname, params);
+}
+
+static void APIENTRY lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)gladLazyResolve("glGetSamplerParameterfv");
+	glad_glGetSamplerParameterfv(sampler, pname, params);
+}
+
+static void APIENTRY lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)gladLazyResolve("glGetSamplerParameterIuiv");
+	glad_glGetSamplerParameterIuiv(sampler, pname, params);
+}
+
+static void APIENTRY lazy_glQueryCounter(GLuint id, GLenum target) {
+	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)gladLazyResolve("glQueryCounter");
+	glad_glQueryCounter(id, target);
+}
+
+static void APIENTRY lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)gladLazyResolve("glGetQueryObjecti64v");
+	glad_glGetQueryObjecti64v(id, pname, params);
+}
+
+static void APIENTRY lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)gladLazyResolve("glGetQueryObjectui64v");
+	glad_glGetQueryObjectui64v(id, pname, params);
+}
+
+static void APIENTRY lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)gladLazyResolve("glVertexAttribDivisor");
+	glad_glVertexAttribDivisor(index, divisor);
+}
+
+static void APIENTRY lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)gladLazyResolve("glVertexAttribP1ui");
+	glad_glVertexAttribP1ui(index, type, normalized, value);
+}
+
+static void APIENTRY lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)gladLazyResolve("glVertexAttribP1uiv");
+	glad_glVertexAttribP1uiv(index, type, normalized, value);
+}
+
+static void APIENTRY lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)gladLazyResolve("glVertexAttribP2ui");
+	glad_glVertexAttribP2ui(index, type, normalized, value);
+}
+
+static void APIENTRY lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)gladLazyResolve("glVertexAttribP2uiv");
+	glad_glVertexAttribP2uiv(index, type, normalized, value);
+}
+
+static void APIENTRY lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)gladLazyResolve("glVertexAttribP3ui");
+	glad_glVertexAttribP3ui(index, type, normalized, value);
+}
+
+static void APIENTRY lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)gladLazyResolve("glVertexAttribP3uiv");
+	glad_glVertexAttribP3uiv(index, type, normalized, value);
+}
+
+static void APIENTRY lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)gladLazyResolve("glVertexAttribP4ui");
+	glad_glVertexAttribP4ui(index, type, normalized, value);
+}
+
+static void APIENTRY lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)gladLazyResolve("glVertexAttribP4uiv");
+	glad_glVertexAttribP4uiv(index, type, normalized, value);
+}
+
+#ifndef GLAD_CORE_PROFILE
+static void APIENTRY lazy_glVertexP2ui(GLenum type, GLuint value) {
+	glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)gladLazyResolve("glVertexP2ui");
+	glad_glVertexP2ui(type, value);
+}
+
+static void APIENTRY lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)gladLazyResolve("glVertexP2uiv");
+	glad_glVertexP2uiv(type, value);
+}
+
+static void APIENTRY lazy_glVertexP3ui(GLenum type, GLuint value) {
+	glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)gladLazyResolve("glVertexP3ui");
+	glad_glVertexP3ui(type, value);
+}
+
+static void APIENTRY lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)gladLazyResolve("glVertexP3uiv");
+	glad_glVertexP3uiv(type, value);
+}
+
+static void APIENTRY lazy_glVertexP4ui(GLenum type, GLuint value) {
+	glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)gladLazyResolve("glVertexP4ui");
+	glad_glVertexP4ui(type, value);
+}
+
+static void APIENTRY lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)gladLazyResolve("glVertexP4uiv");
+	glad_glVertexP4uiv(type, value);
+}
+
+static void APIENTRY lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)gladLazyResolve("glTexCoordP1ui");
+	glad_glTexCoordP1ui(type, coords);
+}
+
+static void APIENTRY lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)gladLazyResolve("glTexCoordP1uiv");
+	glad_glTexCoordP1uiv(type, coords);
+}
+
+static void APIENTRY lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)gladLazyResolve("glTexCoordP2ui");
+	glad_glTexCoordP2ui(type, coords);
+}
+
+static void APIENTRY lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)gladLazyResolve("glTexCoordP2uiv");
+	glad_glTexCoordP2uiv(type, coords);
+}
+
+static void APIENTRY lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)gladLazyResolve("glTexCoordP3ui");
+	glad_glTexCoordP3ui(type, coords);
+}
+
+static void APIENTRY lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)gladLazyResolve("glTexCoordP3uiv");
+	glad_glTexCoordP3uiv(type, coords);
+}
+
+static void APIENTRY lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)gladLazyResolve("glTexCoordP4ui");
+	glad_glTexCoordP4ui(type, coords);
+}
+
+static void APIENTRY lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)gladLazyResolve("glTexCoordP4uiv");
+	glad_glTexCoordP4uiv(type, coords);
+}
+
+static void APIENTRY lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)gladLazyResolve("glMultiTexCoordP1ui");
+	glad_glMultiTexCoordP1ui(texture, type, coords);
+}
+
+static void APIENTRY lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)gladLazyResolve("glMultiTexCoordP1uiv");
+	glad_glMultiTexCoordP1uiv(texture, type, coords);
+}
+
+static void APIENTRY lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)gladLazyResolve("glMultiTexCoordP2ui");
+	glad_glMultiTexCoordP2ui(texture, type, coords);
+}
+
+static void APIENTRY lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)gladLazyResolve("glMultiTexCoordP2uiv");
+	glad_glMultiTexCoordP2uiv(texture, type, coords);
+}
+
+static void APIENTRY lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)gladLazyResolve("glMultiTexCoordP3ui");
+	glad_glMultiTexCoordP3ui(texture, type, coords);
+}
+
+static void APIENTRY lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)gladLazyResolve("glMultiTexCoordP3uiv");
+	glad_glMultiTexCoordP3uiv(texture, type, coords);
+}
+
+static void APIENTRY lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)gladLazyResolve("glMultiTexCoordP4ui");
+	glad_glMultiTexCoordP4ui(texture, type, coords);
+}
+
+static void APIENTRY lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)gladLazyResolve("glMultiTexCoordP4uiv");
+	glad_glMultiTexCoordP4uiv(texture, type, coords);
+}
+
+static void APIENTRY lazy_glNormalP3ui(GLenum type, GLuint coords) {
+	glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)gladLazyResolve("glNormalP3ui");
+	glad_glNormalP3ui(type, coords);
+}
+
+static void APIENTRY lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)gladLazyResolve("glNormalP3uiv");
+	glad_glNormalP3uiv(type, coords);
+}
+
+static void APIENTRY lazy_glColorP3ui(GLenum type, GLuint color) {
+	glad_glColorP3ui = (PFNGLCOLORP3UIPROC)gladLazyResolve("glColorP3ui");
+	glad_glColorP3ui(type, color);
+}
+
+static void APIENTRY lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+	glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)gladLazyResolve("glColorP3uiv");
+	glad_glColorP3uiv(type, color);
+}
+
+static void APIENTRY lazy_glColorP4ui(GLenum type, GLuint color) {
+	glad_glColorP4ui = (PFNGLCOLORP4UIPROC)gladLazyResolve("glColorP4ui");
+	glad_glColorP4ui(type, color);
+}
+
+static void APIENTRY lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+	glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)gladLazyResolve("glColorP4uiv");
+	glad_glColorP4uiv(type, color);
+}
+
+static void APIENTRY lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)gladLazyResolve("glSecondaryColorP3ui");
+	glad_glSecondaryColorP3ui(type, color);
+}
+
+static void APIENTRY lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)gladLazyResolve("glSecondaryColorP3uiv");
+	glad_glSecondaryColorP3uiv(type, color);
+}
+
+#endif
+static void APIENTRY lazy_glMinSampleShading(GLfloat value) {
+	glad_glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)gladLazyResolve("glMinSampleShading");
+	glad_glMinSampleShading(value);
+}
+
+static void APIENTRY lazy_glBlendEquationi(GLuint buf, GLenum mode) {
+	glad_glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)gladLazyResolve("glBlendEquationi");
+	glad_glBlendEquationi(buf, mode);
+}
+
+static void APIENTRY lazy_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+	glad_glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)gladLazyResolve("glBlendEquationSeparatei");
+	glad_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+
+static void APIENTRY lazy_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+	glad_glBlendFunci = (PFNGLBLENDFUNCIPROC)gladLazyResolve("glBlendFunci");
+	glad_glBlendFunci(buf, src, dst);
+}
+
+static void APIENTRY lazy_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+	glad_glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)gladLazyResolve("glBlendFuncSeparatei");
+	glad_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void APIENTRY lazy_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)gladLazyResolve("glDrawArraysIndirect");
+	glad_glDrawArraysIndirect(mode, indirect);
+}
+
+static void APIENTRY lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)gladLazyResolve("glDrawElementsIndirect");
+	glad_glDrawElementsIndirect(mode, type, indirect);
+}
+
+static void APIENTRY lazy_glUniform1d(GLint location, GLdouble x) {
+	glad_glUniform1d = (PFNGLUNIFORM1DPROC)gladLazyResolve("glUniform1d");
+	glad_glUniform1d(location, x);
+}
+
+static void APIENTRY lazy_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+	glad_glUniform2d = (PFNGLUNIFORM2DPROC)gladLazyResolve("glUniform2d");
+	glad_glUniform2d(location, x, y);
+}
+
+static void APIENTRY lazy_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glUniform3d = (PFNGLUNIFORM3DPROC)gladLazyResolve("glUniform3d");
+	glad_glUniform3d(location, x, y, z);
+}
+
+static void APIENTRY lazy_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glUniform4d = (PFNGLUNIFORM4DPROC)gladLazyResolve("glUniform4d");
+	glad_glUniform4d(location, x, y, z, w);
+}
+
+static void APIENTRY lazy_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform1dv = (PFNGLUNIFORM1DVPROC)gladLazyResolve("glUniform1dv");
+	glad_glUniform1dv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform2dv = (PFNGLUNIFORM2DVPROC)gladLazyResolve("glUniform2dv");
+	glad_glUniform2dv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform3dv = (PFNGLUNIFORM3DVPROC)gladLazyResolve("glUniform3dv");
+	glad_glUniform3dv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform4dv = (PFNGLUNIFORM4DVPROC)gladLazyResolve("glUniform4dv");
+	glad_glUniform4dv(location, count, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)gladLazyResolve("glUniformMatrix2dv");
+	glad_glUniformMatrix2dv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)gladLazyResolve("glUniformMatrix3dv");
+	glad_glUniformMatrix3dv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)gladLazyResolve("glUniformMatrix4dv");
+	glad_glUniformMatrix4dv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)gladLazyResolve("glUniformMatrix2x3dv");
+	glad_glUniformMatrix2x3dv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)gladLazyResolve("glUniformMatrix2x4dv");
+	glad_glUniformMatrix2x4dv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)gladLazyResolve("glUniformMatrix3x2dv");
+	glad_glUniformMatrix3x2dv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)gladLazyResolve("glUniformMatrix3x4dv");
+	glad_glUniformMatrix3x4dv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)gladLazyResolve("glUniformMatrix4x2dv");
+	glad_glUniformMatrix4x2dv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)gladLazyResolve("glUniformMatrix4x3dv");
+	glad_glUniformMatrix4x3dv(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
+	glad_glGetUniformdv = (PFNGLGETUNIFORMDVPROC)gladLazyResolve("glGetUniformdv");
+	glad_glGetUniformdv(program, location, params);
+}
+
+static GLint APIENTRY lazy_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+	glad_glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)gladLazyResolve("glGetSubroutineUniformLocation");
+	return glad_glGetSubroutineUniformLocation(program, shadertype, name);
+}
+
+static GLuint APIENTRY lazy_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+	glad_glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)gladLazyResolve("glGetSubroutineIndex");
+	return glad_glGetSubroutineIndex(program, shadertype, name);
+}
+
+static void APIENTRY lazy_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) {
+	glad_glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)gladLazyResolve("glGetActiveSubroutineUniformiv");
+	glad_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+}
+
+static void APIENTRY lazy_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	glad_glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)gladLazyResolve("glGetActiveSubroutineUniformName");
+	glad_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+}
+
+static void APIENTRY lazy_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	glad_glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)gladLazyResolve("glGetActiveSubroutineName");
+	glad_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+}
+
+static void APIENTRY lazy_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+	glad_glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)gladLazyResolve("glUniformSubroutinesuiv");
+	glad_glUniformSubroutinesuiv(shadertype, count, indices);
+}
+
+static void APIENTRY lazy_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
+	glad_glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)gladLazyResolve("glGetUniformSubroutineuiv");
+	glad_glGetUniformSubroutineuiv(shadertype, location, params);
+}
+
+static void APIENTRY lazy_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) {
+	glad_glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)gladLazyResolve("glGetProgramStageiv");
+	glad_glGetProgramStageiv(program, shadertype, pname, values);
+}
+
+static void APIENTRY lazy_glPatchParameteri(GLenum pname, GLint value) {
+	glad_glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)gladLazyResolve("glPatchParameteri");
+	glad_glPatchParameteri(pname, value);
+}
+
+static void APIENTRY lazy_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+	glad_glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)gladLazyResolve("glPatchParameterfv");
+	glad_glPatchParameterfv(pname, values);
+}
+
+static void APIENTRY lazy_glBindTransformFeedback(GLenum target, GLuint id) {
+	glad_glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)gladLazyResolve("glBindTransformFeedback");
+	glad_glBindTransformFeedback(target, id);
+}
+
+static void APIENTRY lazy_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+	glad_glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)gladLazyResolve("glDeleteTransformFeedbacks");
+	glad_glDeleteTransformFeedbacks(n, ids);
+}
+
+static void APIENTRY lazy_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+	glad_glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)gladLazyResolve("glGenTransformFeedbacks");
+	glad_glGenTransformFeedbacks(n, ids);
+}
+
+static GLboolean APIENTRY lazy_glIsTransformFeedback(GLuint id) {
+	glad_glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)gladLazyResolve("glIsTransformFeedback");
+	return glad_glIsTransformFeedback(id);
+}
+
+static void APIENTRY lazy_glPauseTransformFeedback(void) {
+	glad_glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)gladLazyResolve("glPauseTransformFeedback");
+	glad_glPauseTransformFeedback();
+}
+
+static void APIENTRY lazy_glResumeTransformFeedback(void) {
+	glad_glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)gladLazyResolve("glResumeTransformFeedback");
+	glad_glResumeTransformFeedback();
+}
+
+static void APIENTRY lazy_glDrawTransformFeedback(GLenum mode, GLuint id) {
+	glad_glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)gladLazyResolve("glDrawTransformFeedback");
+	glad_glDrawTransformFeedback(mode, id);
+}
+
+static void APIENTRY lazy_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+	glad_glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)gladLazyResolve("glDrawTransformFeedbackStream");
+	glad_glDrawTransformFeedbackStream(mode, id, stream);
+}
+
+static void APIENTRY lazy_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+	glad_glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)gladLazyResolve("glBeginQueryIndexed");
+	glad_glBeginQueryIndexed(target, index, id);
+}
+
+static void APIENTRY lazy_glEndQueryIndexed(GLenum target, GLuint index) {
+	glad_glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)gladLazyResolve("glEndQueryIndexed");
+	glad_glEndQueryIndexed(target, index);
+}
+
+static void APIENTRY lazy_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) {
+	glad_glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)gladLazyResolve("glGetQueryIndexediv");
+	glad_glGetQueryIndexediv(target, index, pname, params);
+}
+
+static void APIENTRY lazy_glReleaseShaderCompiler(void) {
+	glad_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)gladLazyResolve("glReleaseShaderCompiler");
+	glad_glReleaseShaderCompiler();
+}
+
+static void APIENTRY lazy_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+	glad_glShaderBinary = (PFNGLSHADERBINARYPROC)gladLazyResolve("glShaderBinary");
+	glad_glShaderBinary(count, shaders, binaryFormat, binary, length);
+}
+
+static void APIENTRY lazy_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+	glad_glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)gladLazyResolve("glGetShaderPrecisionFormat");
+	glad_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+}
+
+static void APIENTRY lazy_glDepthRangef(GLfloat n, GLfloat f) {
+	glad_glDepthRangef = (PFNGLDEPTHRANGEFPROC)gladLazyResolve("glDepthRangef");
+	glad_glDepthRangef(n, f);
+}
+
+static void APIENTRY lazy_glClearDepthf(GLfloat d) {
+	glad_glClearDepthf = (PFNGLCLEARDEPTHFPROC)gladLazyResolve("glClearDepthf");
+	glad_glClearDepthf(d);
+}
+
+static void APIENTRY lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)gladLazyResolve("glGetProgramBinary");
+	glad_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+
+static void APIENTRY lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)gladLazyResolve("glProgramBinary");
+	glad_glProgramBinary(program, binaryFormat, binary, length);
+}
+
+static void APIENTRY lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)gladLazyResolve("glProgramParameteri");
+	glad_glProgramParameteri(program, pname, value);
+}
+
+static void APIENTRY lazy_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+	glad_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)gladLazyResolve("glUseProgramStages");
+	glad_glUseProgramStages(pipeline, stages, program);
+}
+
+static void APIENTRY lazy_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+	glad_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)gladLazyResolve("glActiveShaderProgram");
+	glad_glActiveShaderProgram(pipeline, program);
+}
+
+static GLuint APIENTRY lazy_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+	glad_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)gladLazyResolve("glCreateShaderProgramv");
+	return glad_glCreateShaderProgramv(type, count, strings);
+}
+
+static void APIENTRY lazy_glBindProgramPipeline(GLuint pipeline) {
+	glad_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)gladLazyResolve("glBindProgramPipeline");
+	glad_glBindProgramPipeline(pipeline);
+}
+
+static void APIENTRY lazy_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+	glad_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)gladLazyResolve("glDeleteProgramPipelines");
+	glad_glDeleteProgramPipelines(n, pipelines);
+}
+
+static void APIENTRY lazy_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+	glad_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)gladLazyResolve("glGenProgramPipelines");
+	glad_glGenProgramPipelines(n, pipelines);
+}
+
+static GLboolean APIENTRY lazy_glIsProgramPipeline(GLuint pipeline) {
+	glad_glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)gladLazyResolve("glIsProgramPipeline");
+	return glad_glIsProgramPipeline(pipeline);
+}
+
+static void APIENTRY lazy_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+	glad_glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)gladLazyResolve("glGetProgramPipelineiv");
+	glad_glGetProgramPipelineiv(pipeline, pname, params);
+}
+
+static void APIENTRY lazy_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+	glad_glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)gladLazyResolve("glProgramUniform1i");
+	glad_glProgramUniform1i(program, location, v0);
+}
+
+static void APIENTRY lazy_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)gladLazyResolve("glProgramUniform1iv");
+	glad_glProgramUniform1iv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+	glad_glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)gladLazyResolve("glProgramUniform1f");
+	glad_glProgramUniform1f(program, location, v0);
+}
+
+static void APIENTRY lazy_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)gladLazyResolve("glProgramUniform1fv");
+	glad_glProgramUniform1fv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+	glad_glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)gladLazyResolve("glProgramUniform1d");
+	glad_glProgramUniform1d(program, location, v0);
+}
+
+static void APIENTRY lazy_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)gladLazyResolve("glProgramUniform1dv");
+	glad_glProgramUniform1dv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+	glad_glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)gladLazyResolve("glProgramUniform1ui");
+	glad_glProgramUniform1ui(program, location, v0);
+}
+
+static void APIENTRY lazy_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)gladLazyResolve("glProgramUniform1uiv");
+	glad_glProgramUniform1uiv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+	glad_glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)gladLazyResolve("glProgramUniform2i");
+	glad_glProgramUniform2i(program, location, v0, v1);
+}
+
+static void APIENTRY lazy_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)gladLazyResolve("glProgramUniform2iv");
+	glad_glProgramUniform2iv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+	glad_glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)gladLazyResolve("glProgramUniform2f");
+	glad_glProgramUniform2f(program, location, v0, v1);
+}
+
+static void APIENTRY lazy_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)gladLazyResolve("glProgramUniform2fv");
+	glad_glProgramUniform2fv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+	glad_glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)gladLazyResolve("glProgramUniform2d");
+	glad_glProgramUniform2d(program, location, v0, v1);
+}
+
+static void APIENTRY lazy_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)gladLazyResolve("glProgramUniform2dv");
+	glad_glProgramUniform2dv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+	glad_glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)gladLazyResolve("glProgramUniform2ui");
+	glad_glProgramUniform2ui(program, location, v0, v1);
+}
+
+static void APIENTRY lazy_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)gladLazyResolve("glProgramUniform2uiv");
+	glad_glProgramUniform2uiv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)gladLazyResolve("glProgramUniform3i");
+	glad_glProgramUniform3i(program, location, v0, v1, v2);
+}
+
+static void APIENTRY lazy_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)gladLazyResolve("glProgramUniform3iv");
+	glad_glProgramUniform3iv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)gladLazyResolve("glProgramUniform3f");
+	glad_glProgramUniform3f(program, location, v0, v1, v2);
+}
+
+static void APIENTRY lazy_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)gladLazyResolve("glProgramUniform3fv");
+	glad_glProgramUniform3fv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+	glad_glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)gladLazyResolve("glProgramUniform3d");
+	glad_glProgramUniform3d(program, location, v0, v1, v2);
+}
+
+static void APIENTRY lazy_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)gladLazyResolve("glProgramUniform3dv");
+	glad_glProgramUniform3dv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)gladLazyResolve("glProgramUniform3ui");
+	glad_glProgramUniform3ui(program, location, v0, v1, v2);
+}
+
+static void APIENTRY lazy_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)gladLazyResolve("glProgramUniform3uiv");
+	glad_glProgramUniform3uiv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)gladLazyResolve("glProgramUniform4i");
+	glad_glProgramUniform4i(program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY lazy_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)gladLazyResolve("glProgramUniform4iv");
+	glad_glProgramUniform4iv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)gladLazyResolve("glProgramUniform4f");
+	glad_glProgramUniform4f(program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY lazy_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)gladLazyResolve("glProgramUniform4fv");
+	glad_glProgramUniform4fv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+	glad_glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)gladLazyResolve("glProgramUniform4d");
+	glad_glProgramUniform4d(program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY lazy_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)gladLazyResolve("glProgramUniform4dv");
+	glad_glProgramUniform4dv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)gladLazyResolve("glProgramUniform4ui");
+	glad_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY lazy_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)gladLazyResolve("glProgramUniform4uiv");
+	glad_glProgramUniform4uiv(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)gladLazyResolve("glProgramUniformMatrix2fv");
+	glad_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)gladLazyResolve("glProgramUniformMatrix3fv");
+	glad_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)gladLazyResolve("glProgramUniformMatrix4fv");
+	glad_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)gladLazyResolve("glProgramUniformMatrix2dv");
+	glad_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)gladLazyResolve("glProgramUniformMatrix3dv");
+	glad_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)gladLazyResolve("glProgramUniformMatrix4dv");
+	glad_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)gladLazyResolve("glProgramUniformMatrix2x3fv");
+	glad_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)gladLazyResolve("glProgramUniformMatrix3x2fv");
+	glad_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)gladLazyResolve("glProgramUniformMatrix2x4fv");
+	glad_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)gladLazyResolve("glProgramUniformMatrix4x2fv");
+	glad_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)gladLazyResolve("glProgramUniformMatrix3x4fv");
+	glad_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)gladLazyResolve("glProgramUniformMatrix4x3fv");
+	glad_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)gladLazyResolve("glProgramUniformMatrix2x3dv");
+	glad_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)gladLazyResolve("glProgramUniformMatrix3x2dv");
+	glad_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)gladLazyResolve("glProgramUniformMatrix2x4dv");
+	glad_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)gladLazyResolve("glProgramUniformMatrix4x2dv");
+	glad_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)gladLazyResolve("glProgramUniformMatrix3x4dv");
+	glad_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)gladLazyResolve("glProgramUniformMatrix4x3dv");
+	glad_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glValidateProgramPipeline(GLuint pipeline) {
+	glad_glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)gladLazyResolve("glValidateProgramPipeline");
+	glad_glValidateProgramPipeline(pipeline);
+}
+
+static void APIENTRY lazy_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)gladLazyResolve("glGetProgramPipelineInfoLog");
+	glad_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+}
+
+static void APIENTRY lazy_glVertexAttribL1d(GLuint index, GLdouble x) {
+	glad_glVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC)gladLazyResolve("glVertexAttribL1d");
+	glad_glVertexAttribL1d(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+	glad_glVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC)gladLazyResolve("glVertexAttribL2d");
+	glad_glVertexAttribL2d(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC)gladLazyResolve("glVertexAttribL3d");
+	glad_glVertexAttribL3d(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC)gladLazyResolve("glVertexAttribL4d");
+	glad_glVertexAttribL4d(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC)gladLazyResolve("glVertexAttribL1dv");
+	glad_glVertexAttribL1dv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC)gladLazyResolve("glVertexAttribL2dv");
+	glad_glVertexAttribL2dv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC)gladLazyResolve("glVertexAttribL3dv");
+	glad_glVertexAttribL3dv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC)gladLazyResolve("glVertexAttribL4dv");
+	glad_glVertexAttribL4dv(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC)gladLazyResolve("glVertexAttribLPointer");
+	glad_glVertexAttribLPointer(index, size, type, stride, pointer);
+}
+
+static void APIENTRY lazy_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC)gladLazyResolve("glGetVertexAttribLdv");
+	glad_glGetVertexAttribLdv(index, pname, params);
+}
+
+static void APIENTRY lazy_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+	glad_glViewportArrayv = (PFNGLVIEWPORTARRAYVPROC)gladLazyResolve("glViewportArrayv");
+	glad_glViewportArrayv(first, count, v);
+}
+
+static void APIENTRY lazy_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+	glad_glViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC)gladLazyResolve("glViewportIndexedf");
+	glad_glViewportIndexedf(index, x, y, w, h);
+}
+
+static void APIENTRY lazy_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+	glad_glViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC)gladLazyResolve("glViewportIndexedfv");
+	glad_glViewportIndexedfv(index, v);
+}
+
+static void APIENTRY lazy_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+	glad_glScissorArrayv = (PFNGLSCISSORARRAYVPROC)gladLazyResolve("glScissorArrayv");
+	glad_glScissorArrayv(first, count, v);
+}
+
+static void APIENTRY lazy_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+	glad_glScissorIndexed = (PFNGLSCISSORINDEXEDPROC)gladLazyResolve("glScissorIndexed");
+	glad_glScissorIndexed(index, left, bottom, width, height);
+}
+
+static void APIENTRY lazy_glScissorIndexedv(GLuint index, const GLint *v) {
+	glad_glScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC)gladLazyResolve("glScissorIndexedv");
+	glad_glScissorIndexedv(index, v);
+}
+
+static void APIENTRY lazy_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+	glad_glDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC)gladLazyResolve("glDepthRangeArrayv");
+	glad_glDepthRangeArrayv(first, count, v);
+}
+
+static void APIENTRY lazy_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+	glad_glDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC)gladLazyResolve("glDepthRangeIndexed");
+	glad_glDepthRangeIndexed(index, n, f);
+}
+
+static void APIENTRY lazy_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
+	glad_glGetFloati_v = (PFNGLGETFLOATI_VPROC)gladLazyResolve("glGetFloati_v");
+	glad_glGetFloati_v(target, index, data);
+}
+
+static void APIENTRY lazy_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) {
+	glad_glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC)gladLazyResolve("glGetDoublei_v");
+	glad_glGetDoublei_v(target, index, data);
+}
+
+static void APIENTRY lazy_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+	glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)gladLazyResolve("glDrawArraysInstancedBaseInstance");
+	glad_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+
+static void APIENTRY lazy_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+	glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)gladLazyResolve("glDrawElementsInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+
+static void APIENTRY lazy_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)gladLazyResolve("glDrawElementsInstancedBaseVertexBaseInstance");
+	glad_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+
+static void APIENTRY lazy_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+	glad_glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)gladLazyResolve("glGetInternalformativ");
+	glad_glGetInternalformativ(target, internalformat, pname, count, params);
+}
+
+static void APIENTRY lazy_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
+	glad_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)gladLazyResolve("glGetActiveAtomicCounterBufferiv");
+	glad_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+}
+
+static void APIENTRY lazy_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+	glad_glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)gladLazyResolve("glBindImageTexture");
+	glad_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+
+static void APIENTRY lazy_glMemoryBarrier(GLbitfield barriers) {
+	glad_glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)gladLazyResolve("glMemoryBarrier");
+	glad_glMemoryBarrier(barriers);
+}
+
+static void APIENTRY lazy_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+	glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)gladLazyResolve("glTexStorage1D");
+	glad_glTexStorage1D(target, levels, internalformat, width);
+}
+
+static void APIENTRY lazy_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)gladLazyResolve("glTexStorage2D");
+	glad_glTexStorage2D(target, levels, internalformat, width, height);
+}
+
+static void APIENTRY lazy_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)gladLazyResolve("glTexStorage3D");
+	glad_glTexStorage3D(target, levels, internalformat, width, height, depth);
+}
+
+static void APIENTRY lazy_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+	glad_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)gladLazyResolve("glDrawTransformFeedbackInstanced");
+	glad_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+}
+
+static void APIENTRY lazy_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+	glad_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)gladLazyResolve("glDrawTransformFeedbackStreamInstanced");
+	glad_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+}
+
+static void APIENTRY lazy_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	glad_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)gladLazyResolve("glClearBufferData");
+	glad_glClearBufferData(target, internalformat, format, type, data);
+}
+
+static void APIENTRY lazy_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	glad_glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)gladLazyResolve("glClearBufferSubData");
+	glad_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+}
+
+static void APIENTRY lazy_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+	glad_glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)gladLazyResolve("glDispatchCompute");
+	glad_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+
+static void APIENTRY lazy_glDispatchComputeIndirect(GLintptr indirect) {
+	glad_glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)gladLazyResolve("glDispatchComputeIndirect");
+	glad_glDispatchComputeIndirect(indirect);
+}
+
+static void APIENTRY lazy_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+	glad_glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)gladLazyResolve("glCopyImageSubData");
+	glad_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+
+static void APIENTRY lazy_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+	glad_glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)gladLazyResolve("glFramebufferParameteri");
+	glad_glFramebufferParameteri(target, pname, param);
+}
+
+static void APIENTRY lazy_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)gladLazyResolve("glGetFramebufferParameteriv");
+	glad_glGetFramebufferParameteriv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params) {
+	glad_glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)gladLazyResolve("glGetInternalformati64v");
+	glad_glGetInternalformati64v(target, internalformat, pname, count, params);
+}
+
+static void APIENTRY lazy_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)gladLazyResolve("glInvalidateTexSubImage");
+	glad_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+
+static void APIENTRY lazy_glInvalidateTexImage(GLuint texture, GLint level) {
+	glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)gladLazyResolve("glInvalidateTexImage");
+	glad_glInvalidateTexImage(texture, level);
+}
+
+static void APIENTRY lazy_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)gladLazyResolve("glInvalidateBufferSubData");
+	glad_glInvalidateBufferSubData(buffer, offset, length);
+}
+
+static void APIENTRY lazy_glInvalidateBufferData(GLuint buffer) {
+	glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)gladLazyResolve("glInvalidateBufferData");
+	glad_glInvalidateBufferData(buffer);
+}
+
+static void APIENTRY lazy_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+	glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)gladLazyResolve("glInvalidateFramebuffer");
+	glad_glInvalidateFramebuffer(target, numAttachments, attachments);
+}
+
+static void APIENTRY lazy_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)gladLazyResolve("glInvalidateSubFramebuffer");
+	glad_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+
+static void APIENTRY lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)gladLazyResolve("glMultiDrawArraysIndirect");
+	glad_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+
+static void APIENTRY lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)gladLazyResolve("glMultiDrawElementsIndirect");
+	glad_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+
+static void APIENTRY lazy_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+	glad_glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)gladLazyResolve("glGetProgramInterfaceiv");
+	glad_glGetProgramInterfaceiv(program, programInterface, pname, params);
+}
+
+static GLuint APIENTRY lazy_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	glad_glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)gladLazyResolve("glGetProgramResourceIndex");
+	return glad_glGetProgramResourceIndex(program, programInterface, name);
+}
+
+static void APIENTRY lazy_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	glad_glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)gladLazyResolve("glGetProgramResourceName");
+	glad_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+}
+
+static void APIENTRY lazy_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) {
+	glad_glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)gladLazyResolve("glGetProgramResourceiv");
+	glad_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+}
+
+static GLint APIENTRY lazy_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+	glad_glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)gladLazyResolve("glGetProgramResourceLocation");
+	return glad_glGetProgramResourceLocation(program, programInterface, name);
+}
+
+static GLint APIENTRY lazy_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	glad_glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)gladLazyResolve("glGetProgramResourceLocationIndex");
+	return glad_glGetProgramResourceLocationIndex(program, programInterface, name);
+}
+
+static void APIENTRY lazy_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+	glad_glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)gladLazyResolve("glShaderStorageBlockBinding");
+	glad_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+
+static void APIENTRY lazy_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)gladLazyResolve("glTexBufferRange");
+	glad_glTexBufferRange(target, internalformat, buffer, offset, size);
+}
+
+static void APIENTRY lazy_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)gladLazyResolve("glTexStorage2DMultisample");
+	glad_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void APIENTRY lazy_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)gladLazyResolve("glTexStorage3DMultisample");
+	glad_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void APIENTRY lazy_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+	glad_glTextureView = (PFNGLTEXTUREVIEWPROC)gladLazyResolve("glTextureView");
+	glad_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+
+static void APIENTRY lazy_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	glad_glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)gladLazyResolve("glBindVertexBuffer");
+	glad_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+
+static void APIENTRY lazy_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	glad_glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)gladLazyResolve("glVertexAttribFormat");
+	glad_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+
+static void APIENTRY lazy_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)gladLazyResolve("glVertexAttribIFormat");
+	glad_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY lazy_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)gladLazyResolve("glVertexAttribLFormat");
+	glad_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY lazy_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+	glad_glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)gladLazyResolve("glVertexAttribBinding");
+	glad_glVertexAttribBinding(attribindex, bindingindex);
+}
+
+static void APIENTRY lazy_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+	glad_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)gladLazyResolve("glVertexBindingDivisor");
+	glad_glVertexBindingDivisor(bindingindex, divisor);
+}
+
+static void APIENTRY lazy_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)gladLazyResolve("glDebugMessageControl");
+	glad_glDebugMessageControl(source, type, severity, count, ids, enabled);
+}
+
+static void APIENTRY lazy_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)gladLazyResolve("glDebugMessageInsert");
+	glad_glDebugMessageInsert(source, type, id, severity, length, buf);
+}
+
+static void APIENTRY lazy_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)gladLazyResolve("glDebugMessageCallback");
+	glad_glDebugMessageCallback(callback, userParam);
+}
+
+static GLuint APIENTRY lazy_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)gladLazyResolve("glGetDebugMessageLog");
+	return glad_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+
+static void APIENTRY lazy_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)gladLazyResolve("glPushDebugGroup");
+	glad_glPushDebugGroup(source, id, length, message);
+}
+
+static void APIENTRY lazy_glPopDebugGroup(void) {
+	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)gladLazyResolve("glPopDebugGroup");
+	glad_glPopDebugGroup();
+}
+
+static void APIENTRY lazy_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)gladLazyResolve("glObjectLabel");
+	glad_glObjectLabel(identifier, name, length, label);
+}
+
+static void APIENTRY lazy_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)gladLazyResolve("glGetObjectLabel");
+	glad_glGetObjectLabel(identifier, name, bufSize, length, label);
+}
+
+static void APIENTRY lazy_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)gladLazyResolve("glObjectPtrLabel");
+	glad_glObjectPtrLabel(ptr, length, label);
+}
+
+static void APIENTRY lazy_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)gladLazyResolve("glGetObjectPtrLabel");
+	glad_glGetObjectPtrLabel(ptr, bufSize, length, label);
+}
+
+static void APIENTRY lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)gladLazyResolve("glBufferStorage");
+	glad_glBufferStorage(target, size, data, flags);
+}
+
+static void APIENTRY lazy_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+	glad_glClearTexImage = (PFNGLCLEARTEXIMAGEPROC)gladLazyResolve("glClearTexImage");
+	glad_glClearTexImage(texture, level, format, type, data);
+}
+
+static void APIENTRY lazy_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+	glad_glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)gladLazyResolve("glClearTexSubImage");
+	glad_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+
+static void APIENTRY lazy_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+	glad_glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)gladLazyResolve("glBindBuffersBase");
+	glad_glBindBuffersBase(target, first, count, buffers);
+}
+
+static void APIENTRY lazy_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) {
+	glad_glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)gladLazyResolve("glBindBuffersRange");
+	glad_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+}
+
+static void APIENTRY lazy_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	glad_glBindTextures = (PFNGLBINDTEXTURESPROC)gladLazyResolve("glBindTextures");
+	glad_glBindTextures(first, count, textures);
+}
+
+static void APIENTRY lazy_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) {
+	glad_glBindSamplers = (PFNGLBINDSAMPLERSPROC)gladLazyResolve("glBindSamplers");
+	glad_glBindSamplers(first, count, samplers);
+}
+
+static void APIENTRY lazy_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	glad_glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)gladLazyResolve("glBindImageTextures");
+	glad_glBindImageTextures(first, count, textures);
+}
+
+static void APIENTRY lazy_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	glad_glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)gladLazyResolve("glBindVertexBuffers");
+	glad_glBindVertexBuffers(first, count, buffers, offsets, strides);
+}
+
+static void APIENTRY lazy_glClipControl(GLenum origin, GLenum depth) {
+	glad_glClipControl = (PFNGLCLIPCONTROLPROC)gladLazyResolve("glClipControl");
+	glad_glClipControl(origin, depth);
+}
+
+static void APIENTRY lazy_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)gladLazyResolve("glCreateTransformFeedbacks");
+	glad_glCreateTransformFeedbacks(n, ids);
+}
+
+static void APIENTRY lazy_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)gladLazyResolve("glTransformFeedbackBufferBase");
+	glad_glTransformFeedbackBufferBase(xfb, index, buffer);
+}
+
+static void APIENTRY lazy_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)gladLazyResolve("glTransformFeedbackBufferRange");
+	glad_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+}
+
+static void APIENTRY lazy_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) {
+	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)gladLazyResolve("glGetTransformFeedbackiv");
+	glad_glGetTransformFeedbackiv(xfb, pname, param);
+}
+
+static void APIENTRY lazy_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param) {
+	glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)gladLazyResolve("glGetTransformFeedbacki_v");
+	glad_glGetTransformFeedbacki_v(xfb, pname, index, param);
+}
+
+static void APIENTRY lazy_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param) {
+	glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)gladLazyResolve("glGetTransformFeedbacki64_v");
+	glad_glGetTransformFeedbacki64_v(xfb, pname, index, param);
+}
+
+static void APIENTRY lazy_glCreateBuffers(GLsizei n, GLuint *buffers) {
+	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)gladLazyResolve("glCreateBuffers");
+	glad_glCreateBuffers(n, buffers);
+}
+
+static void APIENTRY lazy_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)gladLazyResolve("glNamedBufferStorage");
+	glad_glNamedBufferStorage(buffer, size, data, flags);
+}
+
+static void APIENTRY lazy_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)gladLazyResolve("glNamedBufferData");
+	glad_glNamedBufferData(buffer, size, data, usage);
+}
+
+static void APIENTRY lazy_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)gladLazyResolve("glNamedBufferSubData");
+	glad_glNamedBufferSubData(buffer, offset, size, data);
+}
+
+static void APIENTRY lazy_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)gladLazyResolve("glCopyNamedBufferSubData");
+	glad_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+
+static void APIENTRY lazy_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)gladLazyResolve("glClearNamedBufferData");
+	glad_glClearNamedBufferData(buffer, internalformat, format, type, data);
+}
+
+static void APIENTRY lazy_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)gladLazyResolve("glClearNamedBufferSubData");
+	glad_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+}
+
+static void * APIENTRY lazy_glMapNamedBuffer(GLuint buffer, GLenum access) {
+	glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)gladLazyResolve("glMapNamedBuffer");
+	return glad_glMapNamedBuffer(buffer, access);
+}
+
+static void * APIENTRY lazy_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)gladLazyResolve("glMapNamedBufferRange");
+	return glad_glMapNamedBufferRange(buffer, offset, length, access);
+}
+
+static GLboolean APIENTRY lazy_glUnmapNamedBuffer(GLuint buffer) {
+	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)gladLazyResolve("glUnmapNamedBuffer");
+	return glad_glUnmapNamedBuffer(buffer);
+}
+
+static void APIENTRY lazy_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)gladLazyResolve("glFlushMappedNamedBufferRange");
+	glad_glFlushMappedNamedBufferRange(buffer, offset, length);
+}
+
+static void APIENTRY lazy_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) {
+	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)gladLazyResolve("glGetNamedBufferParameteriv");
+	glad_glGetNamedBufferParameteriv(buffer, pname, params);
+}
+
+static void APIENTRY lazy_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) {
+	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)gladLazyResolve("glGetNamedBufferParameteri64v");
+	glad_glGetNamedBufferParameteri64v(buffer, pname, params);
+}
+
+static void APIENTRY lazy_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) {
+	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)gladLazyResolve("glGetNamedBufferPointerv");
+	glad_glGetNamedBufferPointerv(buffer, pname, params);
+}
+
+static void APIENTRY lazy_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) {
+	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)gladLazyResolve("glGetNamedBufferSubData");
+	glad_glGetNamedBufferSubData(buffer, offset, size, data);
+}
+
+static void APIENTRY lazy_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)gladLazyResolve("glCreateFramebuffers");
+	glad_glCreateFramebuffers(n, framebuffers);
+}
+
+static void APIENTRY lazy_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)gladLazyResolve("glNamedFramebufferRenderbuffer");
+	glad_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void APIENTRY lazy_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)gladLazyResolve("glNamedFramebufferParameteri");
+	glad_glNamedFramebufferParameteri(framebuffer, pname, param);
+}
+
+static void APIENTRY lazy_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)gladLazyResolve("glNamedFramebufferTexture");
+	glad_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+}
+
+static void APIENTRY lazy_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)gladLazyResolve("glNamedFramebufferTextureLayer");
+	glad_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+}
+
+static void APIENTRY lazy_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)gladLazyResolve("glNamedFramebufferDrawBuffer");
+	glad_glNamedFramebufferDrawBuffer(framebuffer, buf);
+}
+
+static void APIENTRY lazy_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)gladLazyResolve("glNamedFramebufferDrawBuffers");
+	glad_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+}
+
+static void APIENTRY lazy_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)gladLazyResolve("glNamedFramebufferReadBuffer");
+	glad_glNamedFramebufferReadBuffer(framebuffer, src);
+}
+
+static void APIENTRY lazy_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) {
+	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)gladLazyResolve("glInvalidateNamedFramebufferData");
+	glad_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+}
+
+static void APIENTRY lazy_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)gladLazyResolve("glInvalidateNamedFramebufferSubData");
+	glad_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+}
+
+static void APIENTRY lazy_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)gladLazyResolve("glClearNamedFramebufferiv");
+	glad_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+}
+
+static void APIENTRY lazy_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)gladLazyResolve("glClearNamedFramebufferuiv");
+	glad_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+}
+
+static void APIENTRY lazy_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)gladLazyResolve("glClearNamedFramebufferfv");
+	glad_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+}
+
+static void APIENTRY lazy_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)gladLazyResolve("glClearNamedFramebufferfi");
+	glad_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+}
+
+static void APIENTRY lazy_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)gladLazyResolve("glBlitNamedFramebuffer");
+	glad_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static GLenum APIENTRY lazy_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)gladLazyResolve("glCheckNamedFramebufferStatus");
+	return glad_glCheckNamedFramebufferStatus(framebuffer, target);
+}
+
+static void APIENTRY lazy_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) {
+	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)gladLazyResolve("glGetNamedFramebufferParameteriv");
+	glad_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+}
+
+static void APIENTRY lazy_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) {
+	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)gladLazyResolve("glGetNamedFramebufferAttachmentParameteriv");
+	glad_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+}
+
+static void APIENTRY lazy_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)gladLazyResolve("glCreateRenderbuffers");
+	glad_glCreateRenderbuffers(n, renderbuffers);
+}
+
+static void APIENTRY lazy_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)gladLazyResolve("glNamedRenderbufferStorage");
+	glad_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+}
+
+static void APIENTRY lazy_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)gladLazyResolve("glNamedRenderbufferStorageMultisample");
+	glad_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+}
+
+static void APIENTRY lazy_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) {
+	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)gladLazyResolve("glGetNamedRenderbufferParameteriv");
+	glad_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+}
+
+static void APIENTRY lazy_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)gladLazyResolve("glCreateTextures");
+	glad_glCreateTextures(target, n, textures);
+}
+
+static void APIENTRY lazy_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)gladLazyResolve("glTextureBuffer");
+	glad_glTextureBuffer(texture, internalformat, buffer);
+}
+
+static void APIENTRY lazy_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)gladLazyResolve("glTextureBufferRange");
+	glad_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+}
+
+static void APIENTRY lazy_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)gladLazyResolve("glTextureStorage1D");
+	glad_glTextureStorage1D(texture, levels, internalformat, width);
+}
+
+static void APIENTRY lazy_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)gladLazyResolve("glTextureStorage2D");
+	glad_glTextureStorage2D(texture, levels, internalformat, width, height);
+}
+
+static void APIENTRY lazy_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)gladLazyResolve("glTextureStorage3D");
+	glad_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+}
+
+static void APIENTRY lazy_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)gladLazyResolve("glTextureStorage2DMultisample");
+	glad_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void APIENTRY lazy_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)gladLazyResolve("glTextureStorage3DMultisample");
+	glad_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void APIENTRY lazy_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)gladLazyResolve("glTextureSubImage1D");
+	glad_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+}
+
+static void APIENTRY lazy_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)gladLazyResolve("glTextureSubImage2D");
+	glad_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY lazy_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)gladLazyResolve("glTextureSubImage3D");
+	glad_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void APIENTRY lazy_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)gladLazyResolve("glCompressedTextureSubImage1D");
+	glad_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+}
+
+static void APIENTRY lazy_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)gladLazyResolve("glCompressedTextureSubImage2D");
+	glad_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void APIENTRY lazy_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)gladLazyResolve("glCompressedTextureSubImage3D");
+	glad_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void APIENTRY lazy_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)gladLazyResolve("glCopyTextureSubImage1D");
+	glad_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+}
+
+static void APIENTRY lazy_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)gladLazyResolve("glCopyTextureSubImage2D");
+	glad_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void APIENTRY lazy_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)gladLazyResolve("glCopyTextureSubImage3D");
+	glad_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void APIENTRY lazy_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)gladLazyResolve("glTextureParameterf");
+	glad_glTextureParameterf(texture, pname, param);
+}
+
+static void APIENTRY lazy_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
+	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)gladLazyResolve("glTextureParameterfv");
+	glad_glTextureParameterfv(texture, pname, param);
+}
+
+static void APIENTRY lazy_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)gladLazyResolve("glTextureParameteri");
+	glad_glTextureParameteri(texture, pname, param);
+}
+
+static void APIENTRY lazy_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
+	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)gladLazyResolve("glTextureParameterIiv");
+	glad_glTextureParameterIiv(texture, pname, params);
+}
+
+static void APIENTRY lazy_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
+	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)gladLazyResolve("glTextureParameterIuiv");
+	glad_glTextureParameterIuiv(texture, pname, params);
+}
+
+static void APIENTRY lazy_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
+	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)gladLazyResolve("glTextureParameteriv");
+	glad_glTextureParameteriv(texture, pname, param);
+}
+
+static void APIENTRY lazy_glGenerateTextureMipmap(GLuint texture) {
+	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)gladLazyResolve("glGenerateTextureMipmap");
+	glad_glGenerateTextureMipmap(texture);
+}
+
+static void APIENTRY lazy_glBindTextureUnit(GLuint unit, GLuint texture) {
+	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)gladLazyResolve("glBindTextureUnit");
+	glad_glBindTextureUnit(unit, texture);
+}
+
+static void APIENTRY lazy_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)gladLazyResolve("glGetTextureImage");
+	glad_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+}
+
+static void APIENTRY lazy_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) {
+	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)gladLazyResolve("glGetCompressedTextureImage");
+	glad_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+}
+
+static void APIENTRY lazy_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) {
+	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)gladLazyResolve("glGetTextureLevelParameterfv");
+	glad_glGetTextureLevelParameterfv(texture, level, pname, params);
+}
+
+static void APIENTRY lazy_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) {
+	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)gladLazyResolve("glGetTextureLevelParameteriv");
+	glad_glGetTextureLevelParameteriv(texture, level, pname, params);
+}
+
+static void APIENTRY lazy_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) {
+	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)gladLazyResolve("glGetTextureParameterfv");
+	glad_glGetTextureParameterfv(texture, pname, params);
+}
+
+static void APIENTRY lazy_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) {
+	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)gladLazyResolve("glGetTextureParameterIiv");
+	glad_glGetTextureParameterIiv(texture, pname, params);
+}
+
+static void APIENTRY lazy_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) {
+	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)gladLazyResolve("glGetTextureParameterIuiv");
+	glad_glGetTextureParameterIuiv(texture, pname, params);
+}
+
+static void APIENTRY lazy_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) {
+	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)gladLazyResolve("glGetTextureParameteriv");
+	glad_glGetTextureParameteriv(texture, pname, params);
+}
+
+static void APIENTRY lazy_glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)gladLazyResolve("glCreateVertexArrays");
+	glad_glCreateVertexArrays(n, arrays);
+}
+
+static void APIENTRY lazy_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)gladLazyResolve("glDisableVertexArrayAttrib");
+	glad_glDisableVertexArrayAttrib(vaobj, index);
+}
+
+static void APIENTRY lazy_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)gladLazyResolve("glEnableVertexArrayAttrib");
+	glad_glEnableVertexArrayAttrib(vaobj, index);
+}
+
+static void APIENTRY lazy_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)gladLazyResolve("glVertexArrayElementBuffer");
+	glad_glVertexArrayElementBuffer(vaobj, buffer);
+}
+
+static void APIENTRY lazy_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)gladLazyResolve("glVertexArrayVertexBuffer");
+	glad_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+}
+
+static void APIENTRY lazy_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)gladLazyResolve("glVertexArrayVertexBuffers");
+	glad_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+}
+
+static void APIENTRY lazy_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)gladLazyResolve("glVertexArrayAttribBinding");
+	glad_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+}
+
+static void APIENTRY lazy_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)gladLazyResolve("glVertexArrayAttribFormat");
+	glad_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+
+static void APIENTRY lazy_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)gladLazyResolve("glVertexArrayAttribIFormat");
+	glad_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY lazy_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)gladLazyResolve("glVertexArrayAttribLFormat");
+	glad_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY lazy_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)gladLazyResolve("glVertexArrayBindingDivisor");
+	glad_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+}
+
+static void APIENTRY lazy_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) {
+	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)gladLazyResolve("glGetVertexArrayiv");
+	glad_glGetVertexArrayiv(vaobj, pname, param);
+}
+
+static void APIENTRY lazy_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) {
+	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)gladLazyResolve("glGetVertexArrayIndexediv");
+	glad_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+}
+
+static void APIENTRY lazy_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) {
+	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)gladLazyResolve("glGetVertexArrayIndexed64iv");
+	glad_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+}
+
+static void APIENTRY lazy_glCreateSamplers(GLsizei n, GLuint *samplers) {
+	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)gladLazyResolve("glCreateSamplers");
+	glad_glCreateSamplers(n, samplers);
+}
+
+static void APIENTRY lazy_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)gladLazyResolve("glCreateProgramPipelines");
+	glad_glCreateProgramPipelines(n, pipelines);
+}
+
+static void APIENTRY lazy_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)gladLazyResolve("glCreateQueries");
+	glad_glCreateQueries(target, n, ids);
+}
+
+static void APIENTRY lazy_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)gladLazyResolve("glGetQueryBufferObjecti64v");
+	glad_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+}
+
+static void APIENTRY lazy_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)gladLazyResolve("glGetQueryBufferObjectiv");
+	glad_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+}
+
+static void APIENTRY lazy_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)gladLazyResolve("glGetQueryBufferObjectui64v");
+	glad_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+}
+
+static void APIENTRY lazy_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)gladLazyResolve("glGetQueryBufferObjectuiv");
+	glad_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+}
+
+static void APIENTRY lazy_glMemoryBarrierByRegion(GLbitfield barriers) {
+	glad_glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)gladLazyResolve("glMemoryBarrierByRegion");
+	glad_glMemoryBarrierByRegion(barriers);
+}
+
+static void APIENTRY lazy_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	glad_glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)gladLazyResolve("glGetTextureSubImage");
+	glad_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+}
+
+static void APIENTRY lazy_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels) {
+	glad_glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)gladLazyResolve("glGetCompressedTextureSubImage");
+	glad_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+}
+
+static GLenum APIENTRY lazy_glGetGraphicsResetStatus(void) {
+	glad_glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)gladLazyResolve("glGetGraphicsResetStatus");
+	return glad_glGetGraphicsResetStatus();
+}
+
+static void APIENTRY lazy_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels) {
+	glad_glGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)gladLazyResolve("glGetnCompressedTexImage");
+	glad_glGetnCompressedTexImage(target, lod, bufSize, pixels);
+}
+
+static void APIENTRY lazy_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	glad_glGetnTexImage = (PFNGLGETNTEXIMAGEPROC)gladLazyResolve("glGetnTexImage");
+	glad_glGetnTexImage(target, level, format, type, bufSize, pixels);
+}
+
+static void APIENTRY lazy_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) {
+	glad_glGetnUniformdv = (PFNGLGETNUNIFORMDVPROC)gladLazyResolve("glGetnUniformdv");
+	glad_glGetnUniformdv(program, location, bufSize, params);
+}
+
+static void APIENTRY lazy_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+	glad_glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC)gladLazyResolve("glGetnUniformfv");
+	glad_glGetnUniformfv(program, location, bufSize, params);
+}
+
+static void APIENTRY lazy_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+	glad_glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC)gladLazyResolve("glGetnUniformiv");
+	glad_glGetnUniformiv(program, location, bufSize, params);
+}
+
+static void APIENTRY lazy_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+	glad_glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)gladLazyResolve("glGetnUniformuiv");
+	glad_glGetnUniformuiv(program, location, bufSize, params);
+}
+
+static void APIENTRY lazy_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+	glad_glReadnPixels = (PFNGLREADNPIXELSPROC)gladLazyResolve("glReadnPixels");
+	glad_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+}
+
+#ifndef GLAD_CORE_PROFILE
+static void APIENTRY lazy_glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v) {
+	glad_glGetnMapdv = (PFNGLGETNMAPDVPROC)gladLazyResolve("glGetnMapdv");
+	glad_glGetnMapdv(target, query, bufSize, v);
+}
+
+static void APIENTRY lazy_glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v) {
+	glad_glGetnMapfv = (PFNGLGETNMAPFVPROC)gladLazyResolve("glGetnMapfv");
+	glad_glGetnMapfv(target, query, bufSize, v);
+}
+
+static void APIENTRY lazy_glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint *v) {
+	glad_glGetnMapiv = (PFNGLGETNMAPIVPROC)gladLazyResolve("glGetnMapiv");
+	glad_glGetnMapiv(target, query, bufSize, v);
+}
+
+static void APIENTRY lazy_glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values) {
+	glad_glGetnPixelMapfv = (PFNGLGETNPIXELMAPFVPROC)gladLazyResolve("glGetnPixelMapfv");
+	glad_glGetnPixelMapfv(map, bufSize, values);
+}
+
+static void APIENTRY lazy_glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values) {
+	glad_glGetnPixelMapuiv = (PFNGLGETNPIXELMAPUIVPROC)gladLazyResolve("glGetnPixelMapuiv");
+	glad_glGetnPixelMapuiv(map, bufSize, values);
+}
+
+static void APIENTRY lazy_glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *values) {
+	glad_glGetnPixelMapusv = (PFNGLGETNPIXELMAPUSVPROC)gladLazyResolve("glGetnPixelMapusv");
+	glad_glGetnPixelMapusv(map, bufSize, values);
+}
+
+static void APIENTRY lazy_glGetnPolygonStipple(GLsizei bufSize, GLubyte *pattern) {
+	glad_glGetnPolygonStipple = (PFNGLGETNPOLYGONSTIPPLEPROC)gladLazyResolve("glGetnPolygonStipple");
+	glad_glGetnPolygonStipple(bufSize, pattern);
+}
+
+static void APIENTRY lazy_glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table) {
+	glad_glGetnColorTable = (PFNGLGETNCOLORTABLEPROC)gladLazyResolve("glGetnColorTable");
+	glad_glGetnColorTable(target, format, type, bufSize, table);
+}
+
+static void APIENTRY lazy_glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image) {
+	glad_glGetnConvolutionFilter = (PFNGLGETNCONVOLUTIONFILTERPROC)gladLazyResolve("glGetnConvolutionFilter");
+	glad_glGetnConvolutionFilter(target, format, type, bufSize, image);
+}
+
+static void APIENTRY lazy_glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span) {
+	glad_glGetnSeparableFilter = (PFNGLGETNSEPARABLEFILTERPROC)gladLazyResolve("glGetnSeparableFilter");
+	glad_glGetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span);
+}
+
+static void APIENTRY lazy_glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+	glad_glGetnHistogram = (PFNGLGETNHISTOGRAMPROC)gladLazyResolve("glGetnHistogram");
+	glad_glGetnHistogram(target, reset, format, type, bufSize, values);
+}
+
+static void APIENTRY lazy_glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+	glad_glGetnMinmax = (PFNGLGETNMINMAXPROC)gladLazyResolve("glGetnMinmax");
+	glad_glGetnMinmax(target, reset, format, type, bufSize, values);
+}
+
+#endif
+static void APIENTRY lazy_glTextureBarrier(void) {
+	glad_glTextureBarrier = (PFNGLTEXTUREBARRIERPROC)gladLazyResolve("glTextureBarrier");
+	glad_glTextureBarrier();
+}
+
+#ifndef GLAD_CORE_PROFILE
+static void APIENTRY lazy_glTbufferMask3DFX(GLuint mask) {
+	glad_glTbufferMask3DFX = (PFNGLTBUFFERMASK3DFXPROC)gladLazyResolve("glTbufferMask3DFX");
+	glad_glTbufferMask3DFX(mask);
+}
+
+static void APIENTRY lazy_glDebugMessageEnableAMD(GLenum category, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	glad_glDebugMessageEnableAMD = (PFNGLDEBUGMESSAGEENABLEAMDPROC)gladLazyResolve("glDebugMessageEnableAMD");
+	glad_glDebugMessageEnableAMD(category, severity, count, ids, enabled);
+}
+
+static void APIENTRY lazy_glDebugMessageInsertAMD(GLenum category, GLenum severity, GLuint id, GLsizei length, const GLchar *buf) {
+	glad_glDebugMessageInsertAMD = (PFNGLDEBUGMESSAGEINSERTAMDPROC)gladLazyResolve("glDebugMessageInsertAMD");
+	glad_glDebugMessageInsertAMD(category, severity, id, length, buf);
+}
+
+static void APIENTRY lazy_glDebugMessageCallbackAMD(GLDEBUGPROCAMD callback, void *userParam) {
+	glad_glDebugMessageCallbackAMD = (PFNGLDEBUGMESSAGECALLBACKAMDPROC)gladLazyResolve("glDebugMessageCallbackAMD");
+	glad_glDebugMessageCallbackAMD(callback, userParam);
+}
+
+static GLuint APIENTRY lazy_glGetDebugMessageLogAMD(GLuint count, GLsizei bufSize, GLenum *categories, GLenum *severities, GLuint *ids, GLsizei *lengths, GLchar *message) {
+	glad_glGetDebugMessageLogAMD = (PFNGLGETDEBUGMESSAGELOGAMDPROC)gladLazyResolve("glGetDebugMessageLogAMD");
+	return glad_glGetDebugMessageLogAMD(count, bufSize, categories, severities, ids, lengths, message);
+}
+
+static void APIENTRY lazy_glBlendFuncIndexedAMD(GLuint buf, GLenum src, GLenum dst) {
+	glad_glBlendFuncIndexedAMD = (PFNGLBLENDFUNCINDEXEDAMDPROC)gladLazyResolve("glBlendFuncIndexedAMD");
+	glad_glBlendFuncIndexedAMD(buf, src, dst);
+}
+
+static void APIENTRY lazy_glBlendFuncSeparateIndexedAMD(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+	glad_glBlendFuncSeparateIndexedAMD = (PFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC)gladLazyResolve("glBlendFuncSeparateIndexedAMD");
+	glad_glBlendFuncSeparateIndexedAMD(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void APIENTRY lazy_glBlendEquationIndexedAMD(GLuint buf, GLenum mode) {
+	glad_glBlendEquationIndexedAMD = (PFNGLBLENDEQUATIONINDEXEDAMDPROC)gladLazyResolve("glBlendEquationIndexedAMD");
+	glad_glBlendEquationIndexedAMD(buf, mode);
+}
+
+static void APIENTRY lazy_glBlendEquationSeparateIndexedAMD(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+	glad_glBlendEquationSeparateIndexedAMD = (PFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC)gladLazyResolve("glBlendEquationSeparateIndexedAMD");
+	glad_glBlendEquationSeparateIndexedAMD(buf, modeRGB, modeAlpha);
+}
+
+static void APIENTRY lazy_glRenderbufferStorageMultisampleAdvancedAMD(GLenum target, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorageMultisampleAdvancedAMD = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC)gladLazyResolve("glRenderbufferStorageMultisampleAdvancedAMD");
+	glad_glRenderbufferStorageMultisampleAdvancedAMD(target, samples, storageSamples, internalformat, width, height);
+}
+
+static void APIENTRY lazy_glNamedRenderbufferStorageMultisampleAdvancedAMD(GLuint renderbuffer, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glNamedRenderbufferStorageMultisampleAdvancedAMD = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEADVANCEDAMDPROC)gladLazyResolve("glNamedRenderbufferStorageMultisampleAdvancedAMD");
+	glad_glNamedRenderbufferStorageMultisampleAdvancedAMD(renderbuffer, samples, storageSamples, internalformat, width, height);
+}
+
+static void APIENTRY lazy_glFramebufferSamplePositionsfvAMD(GLenum target, GLuint numsamples, GLuint pixelindex, const GLfloat *values) {
+	glad_glFramebufferSamplePositionsfvAMD = (PFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)gladLazyResolve("glFramebufferSamplePositionsfvAMD");
+	glad_glFramebufferSamplePositionsfvAMD(target, numsamples, pixelindex, values);
+}
+
+static void APIENTRY lazy_glNamedFramebufferSamplePositionsfvAMD(GLuint framebuffer, GLuint numsamples, GLuint pixelindex, const GLfloat *values) {
+	glad_glNamedFramebufferSamplePositionsfvAMD = (PFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)gladLazyResolve("glNamedFramebufferSamplePositionsfvAMD");
+	glad_glNamedFramebufferSamplePositionsfvAMD(framebuffer, numsamples, pixelindex, values);
+}
+
+static void APIENTRY lazy_glGetFramebufferParameterfvAMD(GLenum target, GLenum pname, GLuint numsamples, GLuint pixelindex, GLsizei size, GLfloat *values) {
+	glad_glGetFramebufferParameterfvAMD = (PFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC)gladLazyResolve("glGetFramebufferParameterfvAMD");
+	glad_glGetFramebufferParameterfvAMD(target, pname, numsamples, pixelindex, size, values);
+}
+
+static void APIENTRY lazy_glGetNamedFramebufferParameterfvAMD(GLuint framebuffer, GLenum pname, GLuint numsamples, GLuint pixelindex, GLsizei size, GLfloat *values) {
+	glad_glGetNamedFramebufferParameterfvAMD = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC)gladLazyResolve("glGetNamedFramebufferParameterfvAMD");
+	glad_glGetNamedFramebufferParameterfvAMD(framebuffer, pname, numsamples, pixelindex, size, values);
+}
+
+static void APIENTRY lazy_glUniform1i64NV(GLint location, GLint64EXT x) {
+	glad_glUniform1i64NV = (PFNGLUNIFORM1I64NVPROC)gladLazyResolve("glUniform1i64NV");
+	glad_glUniform1i64NV(location, x);
+}
+
+static void APIENTRY lazy_glUniform2i64NV(GLint location, GLint64EXT x, GLint64EXT y) {
+	glad_glUniform2i64NV = (PFNGLUNIFORM2I64NVPROC)gladLazyResolve("glUniform2i64NV");
+	glad_glUniform2i64NV(location, x, y);
+}
+
+static void APIENTRY lazy_glUniform3i64NV(GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z) {
+	glad_glUniform3i64NV = (PFNGLUNIFORM3I64NVPROC)gladLazyResolve("glUniform3i64NV");
+	glad_glUniform3i64NV(location, x, y, z);
+}
+
+static void APIENTRY lazy_glUniform4i64NV(GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w) {
+	glad_glUniform4i64NV = (PFNGLUNIFORM4I64NVPROC)gladLazyResolve("glUniform4i64NV");
+	glad_glUniform4i64NV(location, x, y, z, w);
+}
+
+static void APIENTRY lazy_glUniform1i64vNV(GLint location, GLsizei count, const GLint64EXT *value) {
+	glad_glUniform1i64vNV = (PFNGLUNIFORM1I64VNVPROC)gladLazyResolve("glUniform1i64vNV");
+	glad_glUniform1i64vNV(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform2i64vNV(GLint location, GLsizei count, const GLint64EXT *value) {
+	glad_glUniform2i64vNV = (PFNGLUNIFORM2I64VNVPROC)gladLazyResolve("glUniform2i64vNV");
+	glad_glUniform2i64vNV(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform3i64vNV(GLint location, GLsizei count, const GLint64EXT *value) {
+	glad_glUniform3i64vNV = (PFNGLUNIFORM3I64VNVPROC)gladLazyResolve("glUniform3i64vNV");
+	glad_glUniform3i64vNV(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform4i64vNV(GLint location, GLsizei count, const GLint64EXT *value) {
+	glad_glUniform4i64vNV = (PFNGLUNIFORM4I64VNVPROC)gladLazyResolve("glUniform4i64vNV");
+	glad_glUniform4i64vNV(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform1ui64NV(GLint location, GLuint64EXT x) {
+	glad_glUniform1ui64NV = (PFNGLUNIFORM1UI64NVPROC)gladLazyResolve("glUniform1ui64NV");
+	glad_glUniform1ui64NV(location, x);
+}
+
+static void APIENTRY lazy_glUniform2ui64NV(GLint location, GLuint64EXT x, GLuint64EXT y) {
+	glad_glUniform2ui64NV = (PFNGLUNIFORM2UI64NVPROC)gladLazyResolve("glUniform2ui64NV");
+	glad_glUniform2ui64NV(location, x, y);
+}
+
+static void APIENTRY lazy_glUniform3ui64NV(GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z) {
+	glad_glUniform3ui64NV = (PFNGLUNIFORM3UI64NVPROC)gladLazyResolve("glUniform3ui64NV");
+	glad_glUniform3ui64NV(location, x, y, z);
+}
+
+static void APIENTRY lazy_glUniform4ui64NV(GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w) {
+	glad_glUniform4ui64NV = (PFNGLUNIFORM4UI64NVPROC)gladLazyResolve("glUniform4ui64NV");
+	glad_glUniform4ui64NV(location, x, y, z, w);
+}
+
+static void APIENTRY lazy_glUniform1ui64vNV(GLint location, GLsizei count, const GLuint64EXT *value) {
+	glad_glUniform1ui64vNV = (PFNGLUNIFORM1UI64VNVPROC)gladLazyResolve("glUniform1ui64vNV");
+	glad_glUniform1ui64vNV(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform2ui64vNV(GLint location, GLsizei count, const GLuint64EXT *value) {
+	glad_glUniform2ui64vNV = (PFNGLUNIFORM2UI64VNVPROC)gladLazyResolve("glUniform2ui64vNV");
+	glad_glUniform2ui64vNV(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform3ui64vNV(GLint location, GLsizei count, const GLuint64EXT *value) {
+	glad_glUniform3ui64vNV = (PFNGLUNIFORM3UI64VNVPROC)gladLazyResolve("glUniform3ui64vNV");
+	glad_glUniform3ui64vNV(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform4ui64vNV(GLint location, GLsizei count, const GLuint64EXT *value) {
+	glad_glUniform4ui64vNV = (PFNGLUNIFORM4UI64VNVPROC)gladLazyResolve("glUniform4ui64vNV");
+	glad_glUniform4ui64vNV(location, count, value);
+}
+
+static void APIENTRY lazy_glGetUniformi64vNV(GLuint program, GLint location, GLint64EXT *params) {
+	glad_glGetUniformi64vNV = (PFNGLGETUNIFORMI64VNVPROC)gladLazyResolve("glGetUniformi64vNV");
+	glad_glGetUniformi64vNV(program, location, params);
+}
+
+static void APIENTRY lazy_glGetUniformui64vNV(GLuint program, GLint location, GLuint64EXT *params) {
+	glad_glGetUniformui64vNV = (PFNGLGETUNIFORMUI64VNVPROC)gladLazyResolve("glGetUniformui64vNV");
+	glad_glGetUniformui64vNV(program, location, params);
+}
+
+static void APIENTRY lazy_glProgramUniform1i64NV(GLuint program, GLint location, GLint64EXT x) {
+	glad_glProgramUniform1i64NV = (PFNGLPROGRAMUNIFORM1I64NVPROC)gladLazyResolve("glProgramUniform1i64NV");
+	glad_glProgramUniform1i64NV(program, location, x);
+}
+
+static void APIENTRY lazy_glProgramUniform2i64NV(GLuint program, GLint location, GLint64EXT x, GLint64EXT y) {
+	glad_glProgramUniform2i64NV = (PFNGLPROGRAMUNIFORM2I64NVPROC)gladLazyResolve("glProgramUniform2i64NV");
+	glad_glProgramUniform2i64NV(program, location, x, y);
+}
+
+static void APIENTRY lazy_glProgramUniform3i64NV(GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z) {
+	glad_glProgramUniform3i64NV = (PFNGLPROGRAMUNIFORM3I64NVPROC)gladLazyResolve("glProgramUniform3i64NV");
+	glad_glProgramUniform3i64NV(program, location, x, y, z);
+}
+
+static void APIENTRY lazy_glProgramUniform4i64NV(GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w) {
+	glad_glProgramUniform4i64NV = (PFNGLPROGRAMUNIFORM4I64NVPROC)gladLazyResolve("glProgramUniform4i64NV");
+	glad_glProgramUniform4i64NV(program, location, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramUniform1i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT *value) {
+	glad_glProgramUniform1i64vNV = (PFNGLPROGRAMUNIFORM1I64VNVPROC)gladLazyResolve("glProgramUniform1i64vNV");
+	glad_glProgramUniform1i64vNV(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform2i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT *value) {
+	glad_glProgramUniform2i64vNV = (PFNGLPROGRAMUNIFORM2I64VNVPROC)gladLazyResolve("glProgramUniform2i64vNV");
+	glad_glProgramUniform2i64vNV(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform3i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT *value) {
+	glad_glProgramUniform3i64vNV = (PFNGLPROGRAMUNIFORM3I64VNVPROC)gladLazyResolve("glProgramUniform3i64vNV");
+	glad_glProgramUniform3i64vNV(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform4i64vNV(GLuint program, GLint location, GLsizei count, const GLint64EXT *value) {
+	glad_glProgramUniform4i64vNV = (PFNGLPROGRAMUNIFORM4I64VNVPROC)gladLazyResolve("glProgramUniform4i64vNV");
+	glad_glProgramUniform4i64vNV(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform1ui64NV(GLuint program, GLint location, GLuint64EXT x) {
+	glad_glProgramUniform1ui64NV = (PFNGLPROGRAMUNIFORM1UI64NVPROC)gladLazyResolve("glProgramUniform1ui64NV");
+	glad_glProgramUniform1ui64NV(program, location, x);
+}
+
+static void APIENTRY lazy_glProgramUniform2ui64NV(GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y) {
+	glad_glProgramUniform2ui64NV = (PFNGLPROGRAMUNIFORM2UI64NVPROC)gladLazyResolve("glProgramUniform2ui64NV");
+	glad_glProgramUniform2ui64NV(program, location, x, y);
+}
+
+static void APIENTRY lazy_glProgramUniform3ui64NV(GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z) {
+	glad_glProgramUniform3ui64NV = (PFNGLPROGRAMUNIFORM3UI64NVPROC)gladLazyResolve("glProgramUniform3ui64NV");
+	glad_glProgramUniform3ui64NV(program, location, x, y, z);
+}
+
+static void APIENTRY lazy_glProgramUniform4ui64NV(GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w) {
+	glad_glProgramUniform4ui64NV = (PFNGLPROGRAMUNIFORM4UI64NVPROC)gladLazyResolve("glProgramUniform4ui64NV");
+	glad_glProgramUniform4ui64NV(program, location, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramUniform1ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT *value) {
+	glad_glProgramUniform1ui64vNV = (PFNGLPROGRAMUNIFORM1UI64VNVPROC)gladLazyResolve("glProgramUniform1ui64vNV");
+	glad_glProgramUniform1ui64vNV(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform2ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT *value) {
+	glad_glProgramUniform2ui64vNV = (PFNGLPROGRAMUNIFORM2UI64VNVPROC)gladLazyResolve("glProgramUniform2ui64vNV");
+	glad_glProgramUniform2ui64vNV(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform3ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT *value) {
+	glad_glProgramUniform3ui64vNV = (PFNGLPROGRAMUNIFORM3UI64VNVPROC)gladLazyResolve("glProgramUniform3ui64vNV");
+	glad_glProgramUniform3ui64vNV(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform4ui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT *value) {
+	glad_glProgramUniform4ui64vNV = (PFNGLPROGRAMUNIFORM4UI64VNVPROC)gladLazyResolve("glProgramUniform4ui64vNV");
+	glad_glProgramUniform4ui64vNV(program, location, count, value);
+}
+
+static void APIENTRY lazy_glVertexAttribParameteriAMD(GLuint index, GLenum pname, GLint param) {
+	glad_glVertexAttribParameteriAMD = (PFNGLVERTEXATTRIBPARAMETERIAMDPROC)gladLazyResolve("glVertexAttribParameteriAMD");
+	glad_glVertexAttribParameteriAMD(index, pname, param);
+}
+
+static void APIENTRY lazy_glMultiDrawArraysIndirectAMD(GLenum mode, const void *indirect, GLsizei primcount, GLsizei stride) {
+	glad_glMultiDrawArraysIndirectAMD = (PFNGLMULTIDRAWARRAYSINDIRECTAMDPROC)gladLazyResolve("glMultiDrawArraysIndirectAMD");
+	glad_glMultiDrawArraysIndirectAMD(mode, indirect, primcount, stride);
+}
+
+static void APIENTRY lazy_glMultiDrawElementsIndirectAMD(GLenum mode, GLenum type, const void *indirect, GLsizei primcount, GLsizei stride) {
+	glad_glMultiDrawElementsIndirectAMD = (PFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC)gladLazyResolve("glMultiDrawElementsIndirectAMD");
+	glad_glMultiDrawElementsIndirectAMD(mode, type, indirect, primcount, stride);
+}
+
+static void APIENTRY lazy_glGenNamesAMD(GLenum identifier, GLuint num, GLuint *names) {
+	glad_glGenNamesAMD = (PFNGLGENNAMESAMDPROC)gladLazyResolve("glGenNamesAMD");
+	glad_glGenNamesAMD(identifier, num, names);
+}
+
+static void APIENTRY lazy_glDeleteNamesAMD(GLenum identifier, GLuint num, const GLuint *names) {
+	glad_glDeleteNamesAMD = (PFNGLDELETENAMESAMDPROC)gladLazyResolve("glDeleteNamesAMD");
+	glad_glDeleteNamesAMD(identifier, num, names);
+}
+
+static GLboolean APIENTRY lazy_glIsNameAMD(GLenum identifier, GLuint name) {
+	glad_glIsNameAMD = (PFNGLISNAMEAMDPROC)gladLazyResolve("glIsNameAMD");
+	return glad_glIsNameAMD(identifier, name);
+}
+
+static void APIENTRY lazy_glQueryObjectParameteruiAMD(GLenum target, GLuint id, GLenum pname, GLuint param) {
+	glad_glQueryObjectParameteruiAMD = (PFNGLQUERYOBJECTPARAMETERUIAMDPROC)gladLazyResolve("glQueryObjectParameteruiAMD");
+	glad_glQueryObjectParameteruiAMD(target, id, pname, param);
+}
+
+static void APIENTRY lazy_glGetPerfMonitorGroupsAMD(GLint *numGroups, GLsizei groupsSize, GLuint *groups) {
+	glad_glGetPerfMonitorGroupsAMD = (PFNGLGETPERFMONITORGROUPSAMDPROC)gladLazyResolve("glGetPerfMonitorGroupsAMD");
+	glad_glGetPerfMonitorGroupsAMD(numGroups, groupsSize, groups);
+}
+
+static void APIENTRY lazy_glGetPerfMonitorCountersAMD(GLuint group, GLint *numCounters, GLint *maxActiveCounters, GLsizei counterSize, GLuint *counters) {
+	glad_glGetPerfMonitorCountersAMD = (PFNGLGETPERFMONITORCOUNTERSAMDPROC)gladLazyResolve("glGetPerfMonitorCountersAMD");
+	glad_glGetPerfMonitorCountersAMD(group, numCounters, maxActiveCounters, counterSize, counters);
+}
+
+static void APIENTRY lazy_glGetPerfMonitorGroupStringAMD(GLuint group, GLsizei bufSize, GLsizei *length, GLchar *groupString) {
+	glad_glGetPerfMonitorGroupStringAMD = (PFNGLGETPERFMONITORGROUPSTRINGAMDPROC)gladLazyResolve("glGetPerfMonitorGroupStringAMD");
+	glad_glGetPerfMonitorGroupStringAMD(group, bufSize, length, groupString);
+}
+
+static void APIENTRY lazy_glGetPerfMonitorCounterStringAMD(GLuint group, GLuint counter, GLsizei bufSize, GLsizei *length, GLchar *counterString) {
+	glad_glGetPerfMonitorCounterStringAMD = (PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC)gladLazyResolve("glGetPerfMonitorCounterStringAMD");
+	glad_glGetPerfMonitorCounterStringAMD(group, counter, bufSize, length, counterString);
+}
+
+static void APIENTRY lazy_glGetPerfMonitorCounterInfoAMD(GLuint group, GLuint counter, GLenum pname, void *data) {
+	glad_glGetPerfMonitorCounterInfoAMD = (PFNGLGETPERFMONITORCOUNTERINFOAMDPROC)gladLazyResolve("glGetPerfMonitorCounterInfoAMD");
+	glad_glGetPerfMonitorCounterInfoAMD(group, counter, pname, data);
+}
+
+static void APIENTRY lazy_glGenPerfMonitorsAMD(GLsizei n, GLuint *monitors) {
+	glad_glGenPerfMonitorsAMD = (PFNGLGENPERFMONITORSAMDPROC)gladLazyResolve("glGenPerfMonitorsAMD");
+	glad_glGenPerfMonitorsAMD(n, monitors);
+}
+
+static void APIENTRY lazy_glDeletePerfMonitorsAMD(GLsizei n, GLuint *monitors) {
+	glad_glDeletePerfMonitorsAMD = (PFNGLDELETEPERFMONITORSAMDPROC)gladLazyResolve("glDeletePerfMonitorsAMD");
+	glad_glDeletePerfMonitorsAMD(n, monitors);
+}
+
+static void APIENTRY lazy_glSelectPerfMonitorCountersAMD(GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint *counterList) {
+	glad_glSelectPerfMonitorCountersAMD = (PFNGLSELECTPERFMONITORCOUNTERSAMDPROC)gladLazyResolve("glSelectPerfMonitorCountersAMD");
+	glad_glSelectPerfMonitorCountersAMD(monitor, enable, group, numCounters, counterList);
+}
+
+static void APIENTRY lazy_glBeginPerfMonitorAMD(GLuint monitor) {
+	glad_glBeginPerfMonitorAMD = (PFNGLBEGINPERFMONITORAMDPROC)gladLazyResolve("glBeginPerfMonitorAMD");
+	glad_glBeginPerfMonitorAMD(monitor);
+}
+
+static void APIENTRY lazy_glEndPerfMonitorAMD(GLuint monitor) {
+	glad_glEndPerfMonitorAMD = (PFNGLENDPERFMONITORAMDPROC)gladLazyResolve("glEndPerfMonitorAMD");
+	glad_glEndPerfMonitorAMD(monitor);
+}
+
+static void APIENTRY lazy_glGetPerfMonitorCounterDataAMD(GLuint monitor, GLenum pname, GLsizei dataSize, GLuint *data, GLint *bytesWritten) {
+	glad_glGetPerfMonitorCounterDataAMD = (PFNGLGETPERFMONITORCOUNTERDATAAMDPROC)gladLazyResolve("glGetPerfMonitorCounterDataAMD");
+	glad_glGetPerfMonitorCounterDataAMD(monitor, pname, dataSize, data, bytesWritten);
+}
+
+static void APIENTRY lazy_glSetMultisamplefvAMD(GLenum pname, GLuint index, const GLfloat *val) {
+	glad_glSetMultisamplefvAMD = (PFNGLSETMULTISAMPLEFVAMDPROC)gladLazyResolve("glSetMultisamplefvAMD");
+	glad_glSetMultisamplefvAMD(pname, index, val);
+}
+
+static void APIENTRY lazy_glTexStorageSparseAMD(GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags) {
+	glad_glTexStorageSparseAMD = (PFNGLTEXSTORAGESPARSEAMDPROC)gladLazyResolve("glTexStorageSparseAMD");
+	glad_glTexStorageSparseAMD(target, internalFormat, width, height, depth, layers, flags);
+}
+
+static void APIENTRY lazy_glTextureStorageSparseAMD(GLuint texture, GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags) {
+	glad_glTextureStorageSparseAMD = (PFNGLTEXTURESTORAGESPARSEAMDPROC)gladLazyResolve("glTextureStorageSparseAMD");
+	glad_glTextureStorageSparseAMD(texture, target, internalFormat, width, height, depth, layers, flags);
+}
+
+static void APIENTRY lazy_glStencilOpValueAMD(GLenum face, GLuint value) {
+	glad_glStencilOpValueAMD = (PFNGLSTENCILOPVALUEAMDPROC)gladLazyResolve("glStencilOpValueAMD");
+	glad_glStencilOpValueAMD(face, value);
+}
+
+static void APIENTRY lazy_glTessellationFactorAMD(GLfloat factor) {
+	glad_glTessellationFactorAMD = (PFNGLTESSELLATIONFACTORAMDPROC)gladLazyResolve("glTessellationFactorAMD");
+	glad_glTessellationFactorAMD(factor);
+}
+
+static void APIENTRY lazy_glTessellationModeAMD(GLenum mode) {
+	glad_glTessellationModeAMD = (PFNGLTESSELLATIONMODEAMDPROC)gladLazyResolve("glTessellationModeAMD");
+	glad_glTessellationModeAMD(mode);
+}
+
+static void APIENTRY lazy_glElementPointerAPPLE(GLenum type, const void *pointer) {
+	glad_glElementPointerAPPLE = (PFNGLELEMENTPOINTERAPPLEPROC)gladLazyResolve("glElementPointerAPPLE");
+	glad_glElementPointerAPPLE(type, pointer);
+}
+
+static void APIENTRY lazy_glDrawElementArrayAPPLE(GLenum mode, GLint first, GLsizei count) {
+	glad_glDrawElementArrayAPPLE = (PFNGLDRAWELEMENTARRAYAPPLEPROC)gladLazyResolve("glDrawElementArrayAPPLE");
+	glad_glDrawElementArrayAPPLE(mode, first, count);
+}
+
+static void APIENTRY lazy_glDrawRangeElementArrayAPPLE(GLenum mode, GLuint start, GLuint end, GLint first, GLsizei count) {
+	glad_glDrawRangeElementArrayAPPLE = (PFNGLDRAWRANGEELEMENTARRAYAPPLEPROC)gladLazyResolve("glDrawRangeElementArrayAPPLE");
+	glad_glDrawRangeElementArrayAPPLE(mode, start, end, first, count);
+}
+
+static void APIENTRY lazy_glMultiDrawElementArrayAPPLE(GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount) {
+	glad_glMultiDrawElementArrayAPPLE = (PFNGLMULTIDRAWELEMENTARRAYAPPLEPROC)gladLazyResolve("glMultiDrawElementArrayAPPLE");
+	glad_glMultiDrawElementArrayAPPLE(mode, first, count, primcount);
+}
+
+static void APIENTRY lazy_glMultiDrawRangeElementArrayAPPLE(GLenum mode, GLuint start, GLuint end, const GLint *first, const GLsizei *count, GLsizei primcount) {
+	glad_glMultiDrawRangeElementArrayAPPLE = (PFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC)gladLazyResolve("glMultiDrawRangeElementArrayAPPLE");
+	glad_glMultiDrawRangeElementArrayAPPLE(mode, start, end, first, count, primcount);
+}
+
+static void APIENTRY lazy_glGenFencesAPPLE(GLsizei n, GLuint *fences) {
+	glad_glGenFencesAPPLE = (PFNGLGENFENCESAPPLEPROC)gladLazyResolve("glGenFencesAPPLE");
+	glad_glGenFencesAPPLE(n, fences);
+}
+
+static void APIENTRY lazy_glDeleteFencesAPPLE(GLsizei n, const GLuint *fences) {
+	glad_glDeleteFencesAPPLE = (PFNGLDELETEFENCESAPPLEPROC)gladLazyResolve("glDeleteFencesAPPLE");
+	glad_glDeleteFencesAPPLE(n, fences);
+}
+
+static void APIENTRY lazy_glSetFenceAPPLE(GLuint fence) {
+	glad_glSetFenceAPPLE = (PFNGLSETFENCEAPPLEPROC)gladLazyResolve("glSetFenceAPPLE");
+	glad_glSetFenceAPPLE(fence);
+}
+
+static GLboolean APIENTRY lazy_glIsFenceAPPLE(GLuint fence) {
+	glad_glIsFenceAPPLE = (PFNGLISFENCEAPPLEPROC)gladLazyResolve("glIsFenceAPPLE");
+	return glad_glIsFenceAPPLE(fence);
+}
+
+static GLboolean APIENTRY lazy_glTestFenceAPPLE(GLuint fence) {
+	glad_glTestFenceAPPLE = (PFNGLTESTFENCEAPPLEPROC)gladLazyResolve("glTestFenceAPPLE");
+	return glad_glTestFenceAPPLE(fence);
+}
+
+static void APIENTRY lazy_glFinishFenceAPPLE(GLuint fence) {
+	glad_glFinishFenceAPPLE = (PFNGLFINISHFENCEAPPLEPROC)gladLazyResolve("glFinishFenceAPPLE");
+	glad_glFinishFenceAPPLE(fence);
+}
+
+static GLboolean APIENTRY lazy_glTestObjectAPPLE(GLenum object, GLuint name) {
+	glad_glTestObjectAPPLE = (PFNGLTESTOBJECTAPPLEPROC)gladLazyResolve("glTestObjectAPPLE");
+	return glad_glTestObjectAPPLE(object, name);
+}
+
+static void APIENTRY lazy_glFinishObjectAPPLE(GLenum object, GLint name) {
+	glad_glFinishObjectAPPLE = (PFNGLFINISHOBJECTAPPLEPROC)gladLazyResolve("glFinishObjectAPPLE");
+	glad_glFinishObjectAPPLE(object, name);
+}
+
+static void APIENTRY lazy_glBufferParameteriAPPLE(GLenum target, GLenum pname, GLint param) {
+	glad_glBufferParameteriAPPLE = (PFNGLBUFFERPARAMETERIAPPLEPROC)gladLazyResolve("glBufferParameteriAPPLE");
+	glad_glBufferParameteriAPPLE(target, pname, param);
+}
+
+static void APIENTRY lazy_glFlushMappedBufferRangeAPPLE(GLenum target, GLintptr offset, GLsizeiptr size) {
+	glad_glFlushMappedBufferRangeAPPLE = (PFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC)gladLazyResolve("glFlushMappedBufferRangeAPPLE");
+	glad_glFlushMappedBufferRangeAPPLE(target, offset, size);
+}
+
+static GLenum APIENTRY lazy_glObjectPurgeableAPPLE(GLenum objectType, GLuint name, GLenum option) {
+	glad_glObjectPurgeableAPPLE = (PFNGLOBJECTPURGEABLEAPPLEPROC)gladLazyResolve("glObjectPurgeableAPPLE");
+	return glad_glObjectPurgeableAPPLE(objectType, name, option);
+}
+
+static GLenum APIENTRY lazy_glObjectUnpurgeableAPPLE(GLenum objectType, GLuint name, GLenum option) {
+	glad_glObjectUnpurgeableAPPLE = (PFNGLOBJECTUNPURGEABLEAPPLEPROC)gladLazyResolve("glObjectUnpurgeableAPPLE");
+	return glad_glObjectUnpurgeableAPPLE(objectType, name, option);
+}
+
+static void APIENTRY lazy_glGetObjectParameterivAPPLE(GLenum objectType, GLuint name, GLenum pname, GLint *params) {
+	glad_glGetObjectParameterivAPPLE = (PFNGLGETOBJECTPARAMETERIVAPPLEPROC)gladLazyResolve("glGetObjectParameterivAPPLE");
+	glad_glGetObjectParameterivAPPLE(objectType, name, pname, params);
+}
+
+static void APIENTRY lazy_glTextureRangeAPPLE(GLenum target, GLsizei length, const void *pointer) {
+	glad_glTextureRangeAPPLE = (PFNGLTEXTURERANGEAPPLEPROC)gladLazyResolve("glTextureRangeAPPLE");
+	glad_glTextureRangeAPPLE(target, length, pointer);
+}
+
+static void APIENTRY lazy_glGetTexParameterPointervAPPLE(GLenum target, GLenum pname, void **params) {
+	glad_glGetTexParameterPointervAPPLE = (PFNGLGETTEXPARAMETERPOINTERVAPPLEPROC)gladLazyResolve("glGetTexParameterPointervAPPLE");
+	glad_glGetTexParameterPointervAPPLE(target, pname, params);
+}
+
+static void APIENTRY lazy_glBindVertexArrayAPPLE(GLuint array) {
+	glad_glBindVertexArrayAPPLE = (PFNGLBINDVERTEXARRAYAPPLEPROC)gladLazyResolve("glBindVertexArrayAPPLE");
+	glad_glBindVertexArrayAPPLE(array);
+}
+
+static void APIENTRY lazy_glDeleteVertexArraysAPPLE(GLsizei n, const GLuint *arrays) {
+	glad_glDeleteVertexArraysAPPLE = (PFNGLDELETEVERTEXARRAYSAPPLEPROC)gladLazyResolve("glDeleteVertexArraysAPPLE");
+	glad_glDeleteVertexArraysAPPLE(n, arrays);
+}
+
+static void APIENTRY lazy_glGenVertexArraysAPPLE(GLsizei n, GLuint *arrays) {
+	glad_glGenVertexArraysAPPLE = (PFNGLGENVERTEXARRAYSAPPLEPROC)gladLazyResolve("glGenVertexArraysAPPLE");
+	glad_glGenVertexArraysAPPLE(n, arrays);
+}
+
+static GLboolean APIENTRY lazy_glIsVertexArrayAPPLE(GLuint array) {
+	glad_glIsVertexArrayAPPLE = (PFNGLISVERTEXARRAYAPPLEPROC)gladLazyResolve("glIsVertexArrayAPPLE");
+	return glad_glIsVertexArrayAPPLE(array);
+}
+
+static void APIENTRY lazy_glVertexArrayRangeAPPLE(GLsizei length, void *pointer) {
+	glad_glVertexArrayRangeAPPLE = (PFNGLVERTEXARRAYRANGEAPPLEPROC)gladLazyResolve("glVertexArrayRangeAPPLE");
+	glad_glVertexArrayRangeAPPLE(length, pointer);
+}
+
+static void APIENTRY lazy_glFlushVertexArrayRangeAPPLE(GLsizei length, void *pointer) {
+	glad_glFlushVertexArrayRangeAPPLE = (PFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC)gladLazyResolve("glFlushVertexArrayRangeAPPLE");
+	glad_glFlushVertexArrayRangeAPPLE(length, pointer);
+}
+
+static void APIENTRY lazy_glVertexArrayParameteriAPPLE(GLenum pname, GLint param) {
+	glad_glVertexArrayParameteriAPPLE = (PFNGLVERTEXARRAYPARAMETERIAPPLEPROC)gladLazyResolve("glVertexArrayParameteriAPPLE");
+	glad_glVertexArrayParameteriAPPLE(pname, param);
+}
+
+static void APIENTRY lazy_glEnableVertexAttribAPPLE(GLuint index, GLenum pname) {
+	glad_glEnableVertexAttribAPPLE = (PFNGLENABLEVERTEXATTRIBAPPLEPROC)gladLazyResolve("glEnableVertexAttribAPPLE");
+	glad_glEnableVertexAttribAPPLE(index, pname);
+}
+
+static void APIENTRY lazy_glDisableVertexAttribAPPLE(GLuint index, GLenum pname) {
+	glad_glDisableVertexAttribAPPLE = (PFNGLDISABLEVERTEXATTRIBAPPLEPROC)gladLazyResolve("glDisableVertexAttribAPPLE");
+	glad_glDisableVertexAttribAPPLE(index, pname);
+}
+
+static GLboolean APIENTRY lazy_glIsVertexAttribEnabledAPPLE(GLuint index, GLenum pname) {
+	glad_glIsVertexAttribEnabledAPPLE = (PFNGLISVERTEXATTRIBENABLEDAPPLEPROC)gladLazyResolve("glIsVertexAttribEnabledAPPLE");
+	return glad_glIsVertexAttribEnabledAPPLE(index, pname);
+}
+
+static void APIENTRY lazy_glMapVertexAttrib1dAPPLE(GLuint index, GLuint size, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+	glad_glMapVertexAttrib1dAPPLE = (PFNGLMAPVERTEXATTRIB1DAPPLEPROC)gladLazyResolve("glMapVertexAttrib1dAPPLE");
+	glad_glMapVertexAttrib1dAPPLE(index, size, u1, u2, stride, order, points);
+}
+
+static void APIENTRY lazy_glMapVertexAttrib1fAPPLE(GLuint index, GLuint size, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+	glad_glMapVertexAttrib1fAPPLE = (PFNGLMAPVERTEXATTRIB1FAPPLEPROC)gladLazyResolve("glMapVertexAttrib1fAPPLE");
+	glad_glMapVertexAttrib1fAPPLE(index, size, u1, u2, stride, order, points);
+}
+
+static void APIENTRY lazy_glMapVertexAttrib2dAPPLE(GLuint index, GLuint size, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+	glad_glMapVertexAttrib2dAPPLE = (PFNGLMAPVERTEXATTRIB2DAPPLEPROC)gladLazyResolve("glMapVertexAttrib2dAPPLE");
+	glad_glMapVertexAttrib2dAPPLE(index, size, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+static void APIENTRY lazy_glMapVertexAttrib2fAPPLE(GLuint index, GLuint size, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+	glad_glMapVertexAttrib2fAPPLE = (PFNGLMAPVERTEXATTRIB2FAPPLEPROC)gladLazyResolve("glMapVertexAttrib2fAPPLE");
+	glad_glMapVertexAttrib2fAPPLE(index, size, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+static void APIENTRY lazy_glPrimitiveBoundingBoxARB(GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW) {
+	glad_glPrimitiveBoundingBoxARB = (PFNGLPRIMITIVEBOUNDINGBOXARBPROC)gladLazyResolve("glPrimitiveBoundingBoxARB");
+	glad_glPrimitiveBoundingBoxARB(minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
+}
+
+#endif
+static GLuint64 APIENTRY lazy_glGetTextureHandleARB(GLuint texture) {
+	glad_glGetTextureHandleARB = (PFNGLGETTEXTUREHANDLEARBPROC)gladLazyResolve("glGetTextureHandleARB");
+	return glad_glGetTextureHandleARB(texture);
+}
+
+static GLuint64 APIENTRY lazy_glGetTextureSamplerHandleARB(GLuint texture, GLuint sampler) {
+	glad_glGetTextureSamplerHandleARB = (PFNGLGETTEXTURESAMPLERHANDLEARBPROC)gladLazyResolve("glGetTextureSamplerHandleARB");
+	return glad_glGetTextureSamplerHandleARB(texture, sampler);
+}
+
+static void APIENTRY lazy_glMakeTextureHandleResidentARB(GLuint64 handle) {
+	glad_glMakeTextureHandleResidentARB = (PFNGLMAKETEXTUREHANDLERESIDENTARBPROC)gladLazyResolve("glMakeTextureHandleResidentARB");
+	glad_glMakeTextureHandleResidentARB(handle);
+}
+
+static void APIENTRY lazy_glMakeTextureHandleNonResidentARB(GLuint64 handle) {
+	glad_glMakeTextureHandleNonResidentARB = (PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)gladLazyResolve("glMakeTextureHandleNonResidentARB");
+	glad_glMakeTextureHandleNonResidentARB(handle);
+}
+
+static GLuint64 APIENTRY lazy_glGetImageHandleARB(GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format) {
+	glad_glGetImageHandleARB = (PFNGLGETIMAGEHANDLEARBPROC)gladLazyResolve("glGetImageHandleARB");
+	return glad_glGetImageHandleARB(texture, level, layered, layer, format);
+}
+
+static void APIENTRY lazy_glMakeImageHandleResidentARB(GLuint64 handle, GLenum access) {
+	glad_glMakeImageHandleResidentARB = (PFNGLMAKEIMAGEHANDLERESIDENTARBPROC)gladLazyResolve("glMakeImageHandleResidentARB");
+	glad_glMakeImageHandleResidentARB(handle, access);
+}
+
+static void APIENTRY lazy_glMakeImageHandleNonResidentARB(GLuint64 handle) {
+	glad_glMakeImageHandleNonResidentARB = (PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC)gladLazyResolve("glMakeImageHandleNonResidentARB");
+	glad_glMakeImageHandleNonResidentARB(handle);
+}
+
+static void APIENTRY lazy_glUniformHandleui64ARB(GLint location, GLuint64 value) {
+	glad_glUniformHandleui64ARB = (PFNGLUNIFORMHANDLEUI64ARBPROC)gladLazyResolve("glUniformHandleui64ARB");
+	glad_glUniformHandleui64ARB(location, value);
+}
+
+static void APIENTRY lazy_glUniformHandleui64vARB(GLint location, GLsizei count, const GLuint64 *value) {
+	glad_glUniformHandleui64vARB = (PFNGLUNIFORMHANDLEUI64VARBPROC)gladLazyResolve("glUniformHandleui64vARB");
+	glad_glUniformHandleui64vARB(location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniformHandleui64ARB(GLuint program, GLint location, GLuint64 value) {
+	glad_glProgramUniformHandleui64ARB = (PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC)gladLazyResolve("glProgramUniformHandleui64ARB");
+	glad_glProgramUniformHandleui64ARB(program, location, value);
+}
+
+static void APIENTRY lazy_glProgramUniformHandleui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 *values) {
+	glad_glProgramUniformHandleui64vARB = (PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC)gladLazyResolve("glProgramUniformHandleui64vARB");
+	glad_glProgramUniformHandleui64vARB(program, location, count, values);
+}
+
+static GLboolean APIENTRY lazy_glIsTextureHandleResidentARB(GLuint64 handle) {
+	glad_glIsTextureHandleResidentARB = (PFNGLISTEXTUREHANDLERESIDENTARBPROC)gladLazyResolve("glIsTextureHandleResidentARB");
+	return glad_glIsTextureHandleResidentARB(handle);
+}
+
+static GLboolean APIENTRY lazy_glIsImageHandleResidentARB(GLuint64 handle) {
+	glad_glIsImageHandleResidentARB = (PFNGLISIMAGEHANDLERESIDENTARBPROC)gladLazyResolve("glIsImageHandleResidentARB");
+	return glad_glIsImageHandleResidentARB(handle);
+}
+
+static void APIENTRY lazy_glVertexAttribL1ui64ARB(GLuint index, GLuint64EXT x) {
+	glad_glVertexAttribL1ui64ARB = (PFNGLVERTEXATTRIBL1UI64ARBPROC)gladLazyResolve("glVertexAttribL1ui64ARB");
+	glad_glVertexAttribL1ui64ARB(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttribL1ui64vARB(GLuint index, const GLuint64EXT *v) {
+	glad_glVertexAttribL1ui64vARB = (PFNGLVERTEXATTRIBL1UI64VARBPROC)gladLazyResolve("glVertexAttribL1ui64vARB");
+	glad_glVertexAttribL1ui64vARB(index, v);
+}
+
+static void APIENTRY lazy_glGetVertexAttribLui64vARB(GLuint index, GLenum pname, GLuint64EXT *params) {
+	glad_glGetVertexAttribLui64vARB = (PFNGLGETVERTEXATTRIBLUI64VARBPROC)gladLazyResolve("glGetVertexAttribLui64vARB");
+	glad_glGetVertexAttribLui64vARB(index, pname, params);
+}
+
+#ifndef GLAD_CORE_PROFILE
+static GLsync APIENTRY lazy_glCreateSyncFromCLeventARB(struct _cl_context *context, struct _cl_event *event, GLbitfield flags) {
+	glad_glCreateSyncFromCLeventARB = (PFNGLCREATESYNCFROMCLEVENTARBPROC)gladLazyResolve("glCreateSyncFromCLeventARB");
+	return glad_glCreateSyncFromCLeventARB(context, event, flags);
+}
+
+static void APIENTRY lazy_glClampColorARB(GLenum target, GLenum clamp) {
+	glad_glClampColorARB = (PFNGLCLAMPCOLORARBPROC)gladLazyResolve("glClampColorARB");
+	glad_glClampColorARB(target, clamp);
+}
+
+static void APIENTRY lazy_glDispatchComputeGroupSizeARB(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z) {
+	glad_glDispatchComputeGroupSizeARB = (PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC)gladLazyResolve("glDispatchComputeGroupSizeARB");
+	glad_glDispatchComputeGroupSizeARB(num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z);
+}
+
+static void APIENTRY lazy_glDebugMessageControlARB(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	glad_glDebugMessageControlARB = (PFNGLDEBUGMESSAGECONTROLARBPROC)gladLazyResolve("glDebugMessageControlARB");
+	glad_glDebugMessageControlARB(source, type, severity, count, ids, enabled);
+}
+
+static void APIENTRY lazy_glDebugMessageInsertARB(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	glad_glDebugMessageInsertARB = (PFNGLDEBUGMESSAGEINSERTARBPROC)gladLazyResolve("glDebugMessageInsertARB");
+	glad_glDebugMessageInsertARB(source, type, id, severity, length, buf);
+}
+
+static void APIENTRY lazy_glDebugMessageCallbackARB(GLDEBUGPROCARB callback, const void *userParam) {
+	glad_glDebugMessageCallbackARB = (PFNGLDEBUGMESSAGECALLBACKARBPROC)gladLazyResolve("glDebugMessageCallbackARB");
+	glad_glDebugMessageCallbackARB(callback, userParam);
+}
+
+static GLuint APIENTRY lazy_glGetDebugMessageLogARB(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	glad_glGetDebugMessageLogARB = (PFNGLGETDEBUGMESSAGELOGARBPROC)gladLazyResolve("glGetDebugMessageLogARB");
+	return glad_glGetDebugMessageLogARB(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+
+static void APIENTRY lazy_glDrawBuffersARB(GLsizei n, const GLenum *bufs) {
+	glad_glDrawBuffersARB = (PFNGLDRAWBUFFERSARBPROC)gladLazyResolve("glDrawBuffersARB");
+	glad_glDrawBuffersARB(n, bufs);
+}
+
+static void APIENTRY lazy_glBlendEquationiARB(GLuint buf, GLenum mode) {
+	glad_glBlendEquationiARB = (PFNGLBLENDEQUATIONIARBPROC)gladLazyResolve("glBlendEquationiARB");
+	glad_glBlendEquationiARB(buf, mode);
+}
+
+static void APIENTRY lazy_glBlendEquationSeparateiARB(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+	glad_glBlendEquationSeparateiARB = (PFNGLBLENDEQUATIONSEPARATEIARBPROC)gladLazyResolve("glBlendEquationSeparateiARB");
+	glad_glBlendEquationSeparateiARB(buf, modeRGB, modeAlpha);
+}
+
+static void APIENTRY lazy_glBlendFunciARB(GLuint buf, GLenum src, GLenum dst) {
+	glad_glBlendFunciARB = (PFNGLBLENDFUNCIARBPROC)gladLazyResolve("glBlendFunciARB");
+	glad_glBlendFunciARB(buf, src, dst);
+}
+
+static void APIENTRY lazy_glBlendFuncSeparateiARB(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+	glad_glBlendFuncSeparateiARB = (PFNGLBLENDFUNCSEPARATEIARBPROC)gladLazyResolve("glBlendFuncSeparateiARB");
+	glad_glBlendFuncSeparateiARB(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void APIENTRY lazy_glDrawArraysInstancedARB(GLenum mode, GLint first, GLsizei count, GLsizei primcount) {
+	glad_glDrawArraysInstancedARB = (PFNGLDRAWARRAYSINSTANCEDARBPROC)gladLazyResolve("glDrawArraysInstancedARB");
+	glad_glDrawArraysInstancedARB(mode, first, count, primcount);
+}
+
+static void APIENTRY lazy_glDrawElementsInstancedARB(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount) {
+	glad_glDrawElementsInstancedARB = (PFNGLDRAWELEMENTSINSTANCEDARBPROC)gladLazyResolve("glDrawElementsInstancedARB");
+	glad_glDrawElementsInstancedARB(mode, count, type, indices, primcount);
+}
+
+static void APIENTRY lazy_glProgramStringARB(GLenum target, GLenum format, GLsizei len, const void *string) {
+	glad_glProgramStringARB = (PFNGLPROGRAMSTRINGARBPROC)gladLazyResolve("glProgramStringARB");
+	glad_glProgramStringARB(target, format, len, string);
+}
+
+static void APIENTRY lazy_glBindProgramARB(GLenum target, GLuint program) {
+	glad_glBindProgramARB = (PFNGLBINDPROGRAMARBPROC)gladLazyResolve("glBindProgramARB");
+	glad_glBindProgramARB(target, program);
+}
+
+static void APIENTRY lazy_glDeleteProgramsARB(GLsizei n, const GLuint *programs) {
+	glad_glDeleteProgramsARB = (PFNGLDELETEPROGRAMSARBPROC)gladLazyResolve("glDeleteProgramsARB");
+	glad_glDeleteProgramsARB(n, programs);
+}
+
+static void APIENTRY lazy_glGenProgramsARB(GLsizei n, GLuint *programs) {
+	glad_glGenProgramsARB = (PFNGLGENPROGRAMSARBPROC)gladLazyResolve("glGenProgramsARB");
+	glad_glGenProgramsARB(n, programs);
+}
+
+static void APIENTRY lazy_glProgramEnvParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glProgramEnvParameter4dARB = (PFNGLPROGRAMENVPARAMETER4DARBPROC)gladLazyResolve("glProgramEnvParameter4dARB");
+	glad_glProgramEnvParameter4dARB(target, index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramEnvParameter4dvARB(GLenum target, GLuint index, const GLdouble *params) {
+	glad_glProgramEnvParameter4dvARB = (PFNGLPROGRAMENVPARAMETER4DVARBPROC)gladLazyResolve("glProgramEnvParameter4dvARB");
+	glad_glProgramEnvParameter4dvARB(target, index, params);
+}
+
+static void APIENTRY lazy_glProgramEnvParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glProgramEnvParameter4fARB = (PFNGLPROGRAMENVPARAMETER4FARBPROC)gladLazyResolve("glProgramEnvParameter4fARB");
+	glad_glProgramEnvParameter4fARB(target, index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramEnvParameter4fvARB(GLenum target, GLuint index, const GLfloat *params) {
+	glad_glProgramEnvParameter4fvARB = (PFNGLPROGRAMENVPARAMETER4FVARBPROC)gladLazyResolve("glProgramEnvParameter4fvARB");
+	glad_glProgramEnvParameter4fvARB(target, index, params);
+}
+
+static void APIENTRY lazy_glProgramLocalParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glProgramLocalParameter4dARB = (PFNGLPROGRAMLOCALPARAMETER4DARBPROC)gladLazyResolve("glProgramLocalParameter4dARB");
+	glad_glProgramLocalParameter4dARB(target, index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramLocalParameter4dvARB(GLenum target, GLuint index, const GLdouble *params) {
+	glad_glProgramLocalParameter4dvARB = (PFNGLPROGRAMLOCALPARAMETER4DVARBPROC)gladLazyResolve("glProgramLocalParameter4dvARB");
+	glad_glProgramLocalParameter4dvARB(target, index, params);
+}
+
+static void APIENTRY lazy_glProgramLocalParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glProgramLocalParameter4fARB = (PFNGLPROGRAMLOCALPARAMETER4FARBPROC)gladLazyResolve("glProgramLocalParameter4fARB");
+	glad_glProgramLocalParameter4fARB(target, index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramLocalParameter4fvARB(GLenum target, GLuint index, const GLfloat *params) {
+	glad_glProgramLocalParameter4fvARB = (PFNGLPROGRAMLOCALPARAMETER4FVARBPROC)gladLazyResolve("glProgramLocalParameter4fvARB");
+	glad_glProgramLocalParameter4fvARB(target, index, params);
+}
+
+static void APIENTRY lazy_glGetProgramEnvParameterdvARB(GLenum target, GLuint index, GLdouble *params) {
+	glad_glGetProgramEnvParameterdvARB = (PFNGLGETPROGRAMENVPARAMETERDVARBPROC)gladLazyResolve("glGetProgramEnvParameterdvARB");
+	glad_glGetProgramEnvParameterdvARB(target, index, params);
+}
+
+static void APIENTRY lazy_glGetProgramEnvParameterfvARB(GLenum target, GLuint index, GLfloat *params) {
+	glad_glGetProgramEnvParameterfvARB = (PFNGLGETPROGRAMENVPARAMETERFVARBPROC)gladLazyResolve("glGetProgramEnvParameterfvARB");
+	glad_glGetProgramEnvParameterfvARB(target, index, params);
+}
+
+static void APIENTRY lazy_glGetProgramLocalParameterdvARB(GLenum target, GLuint index, GLdouble *params) {
+	glad_glGetProgramLocalParameterdvARB = (PFNGLGETPROGRAMLOCALPARAMETERDVARBPROC)gladLazyResolve("glGetProgramLocalParameterdvARB");
+	glad_glGetProgramLocalParameterdvARB(target, index, params);
+}
+
+static void APIENTRY lazy_glGetProgramLocalParameterfvARB(GLenum target, GLuint index, GLfloat *params) {
+	glad_glGetProgramLocalParameterfvARB = (PFNGLGETPROGRAMLOCALPARAMETERFVARBPROC)gladLazyResolve("glGetProgramLocalParameterfvARB");
+	glad_glGetProgramLocalParameterfvARB(target, index, params);
+}
+
+static void APIENTRY lazy_glGetProgramivARB(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetProgramivARB = (PFNGLGETPROGRAMIVARBPROC)gladLazyResolve("glGetProgramivARB");
+	glad_glGetProgramivARB(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetProgramStringARB(GLenum target, GLenum pname, void *string) {
+	glad_glGetProgramStringARB = (PFNGLGETPROGRAMSTRINGARBPROC)gladLazyResolve("glGetProgramStringARB");
+	glad_glGetProgramStringARB(target, pname, string);
+}
+
+static GLboolean APIENTRY lazy_glIsProgramARB(GLuint program) {
+	glad_glIsProgramARB = (PFNGLISPROGRAMARBPROC)gladLazyResolve("glIsProgramARB");
+	return glad_glIsProgramARB(program);
+}
+
+static void APIENTRY lazy_glProgramParameteriARB(GLuint program, GLenum pname, GLint value) {
+	glad_glProgramParameteriARB = (PFNGLPROGRAMPARAMETERIARBPROC)gladLazyResolve("glProgramParameteriARB");
+	glad_glProgramParameteriARB(program, pname, value);
+}
+
+static void APIENTRY lazy_glFramebufferTextureARB(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	glad_glFramebufferTextureARB = (PFNGLFRAMEBUFFERTEXTUREARBPROC)gladLazyResolve("glFramebufferTextureARB");
+	glad_glFramebufferTextureARB(target, attachment, texture, level);
+}
+
+static void APIENTRY lazy_glFramebufferTextureLayerARB(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glFramebufferTextureLayerARB = (PFNGLFRAMEBUFFERTEXTURELAYERARBPROC)gladLazyResolve("glFramebufferTextureLayerARB");
+	glad_glFramebufferTextureLayerARB(target, attachment, texture, level, layer);
+}
+
+static void APIENTRY lazy_glFramebufferTextureFaceARB(GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face) {
+	glad_glFramebufferTextureFaceARB = (PFNGLFRAMEBUFFERTEXTUREFACEARBPROC)gladLazyResolve("glFramebufferTextureFaceARB");
+	glad_glFramebufferTextureFaceARB(target, attachment, texture, level, face);
+}
+
+#endif
+static void APIENTRY lazy_glSpecializeShaderARB(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue) {
+	glad_glSpecializeShaderARB = (PFNGLSPECIALIZESHADERARBPROC)gladLazyResolve("glSpecializeShaderARB");
+	glad_glSpecializeShaderARB(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+}
+
+#ifndef GLAD_CORE_PROFILE
+static void APIENTRY lazy_glUniform1i64ARB(GLint location, GLint64 x) {
+	glad_glUniform1i64ARB = (PFNGLUNIFORM1I64ARBPROC)gladLazyResolve("glUniform1i64ARB");
+	glad_glUniform1i64ARB(location, x);
+}
+
+static void APIENTRY lazy_glUniform2i64ARB(GLint location, GLint64 x, GLint64 y) {
+	glad_glUniform2i64ARB = (PFNGLUNIFORM2I64ARBPROC)gladLazyResolve("glUniform2i64ARB");
+	glad_glUniform2i64ARB(location, x, y);
+}
+
+static void APIENTRY lazy_glUniform3i64ARB(GLint location, GLint64 x, GLint64 y, GLint64 z) {
+	glad_glUniform3i64ARB = (PFNGLUNIFORM3I64ARBPROC)gladLazyResolve("glUniform3i64ARB");
+	glad_glUniform3i64ARB(location, x, y, z);
+}
+
+static void APIENTRY lazy_glUniform4i64ARB(GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w) {
+	glad_glUniform4i64ARB = (PFNGLUNIFORM4I64ARBPROC)gladLazyResolve("glUniform4i64ARB");
+	glad_glUniform4i64ARB(location, x, y, z, w);
+}
+
+static void APIENTRY lazy_glUniform1i64vARB(GLint location, GLsizei count, const GLint64 *value) {
+	glad_glUniform1i64vARB = (PFNGLUNIFORM1I64VARBPROC)gladLazyResolve("glUniform1i64vARB");
+	glad_glUniform1i64vARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform2i64vARB(GLint location, GLsizei count, const GLint64 *value) {
+	glad_glUniform2i64vARB = (PFNGLUNIFORM2I64VARBPROC)gladLazyResolve("glUniform2i64vARB");
+	glad_glUniform2i64vARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform3i64vARB(GLint location, GLsizei count, const GLint64 *value) {
+	glad_glUniform3i64vARB = (PFNGLUNIFORM3I64VARBPROC)gladLazyResolve("glUniform3i64vARB");
+	glad_glUniform3i64vARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform4i64vARB(GLint location, GLsizei count, const GLint64 *value) {
+	glad_glUniform4i64vARB = (PFNGLUNIFORM4I64VARBPROC)gladLazyResolve("glUniform4i64vARB");
+	glad_glUniform4i64vARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform1ui64ARB(GLint location, GLuint64 x) {
+	glad_glUniform1ui64ARB = (PFNGLUNIFORM1UI64ARBPROC)gladLazyResolve("glUniform1ui64ARB");
+	glad_glUniform1ui64ARB(location, x);
+}
+
+static void APIENTRY lazy_glUniform2ui64ARB(GLint location, GLuint64 x, GLuint64 y) {
+	glad_glUniform2ui64ARB = (PFNGLUNIFORM2UI64ARBPROC)gladLazyResolve("glUniform2ui64ARB");
+	glad_glUniform2ui64ARB(location, x, y);
+}
+
+static void APIENTRY lazy_glUniform3ui64ARB(GLint location, GLuint64 x, GLuint64 y, GLuint64 z) {
+	glad_glUniform3ui64ARB = (PFNGLUNIFORM3UI64ARBPROC)gladLazyResolve("glUniform3ui64ARB");
+	glad_glUniform3ui64ARB(location, x, y, z);
+}
+
+static void APIENTRY lazy_glUniform4ui64ARB(GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w) {
+	glad_glUniform4ui64ARB = (PFNGLUNIFORM4UI64ARBPROC)gladLazyResolve("glUniform4ui64ARB");
+	glad_glUniform4ui64ARB(location, x, y, z, w);
+}
+
+static void APIENTRY lazy_glUniform1ui64vARB(GLint location, GLsizei count, const GLuint64 *value) {
+	glad_glUniform1ui64vARB = (PFNGLUNIFORM1UI64VARBPROC)gladLazyResolve("glUniform1ui64vARB");
+	glad_glUniform1ui64vARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform2ui64vARB(GLint location, GLsizei count, const GLuint64 *value) {
+	glad_glUniform2ui64vARB = (PFNGLUNIFORM2UI64VARBPROC)gladLazyResolve("glUniform2ui64vARB");
+	glad_glUniform2ui64vARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform3ui64vARB(GLint location, GLsizei count, const GLuint64 *value) {
+	glad_glUniform3ui64vARB = (PFNGLUNIFORM3UI64VARBPROC)gladLazyResolve("glUniform3ui64vARB");
+	glad_glUniform3ui64vARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform4ui64vARB(GLint location, GLsizei count, const GLuint64 *value) {
+	glad_glUniform4ui64vARB = (PFNGLUNIFORM4UI64VARBPROC)gladLazyResolve("glUniform4ui64vARB");
+	glad_glUniform4ui64vARB(location, count, value);
+}
+
+static void APIENTRY lazy_glGetUniformi64vARB(GLuint program, GLint location, GLint64 *params) {
+	glad_glGetUniformi64vARB = (PFNGLGETUNIFORMI64VARBPROC)gladLazyResolve("glGetUniformi64vARB");
+	glad_glGetUniformi64vARB(program, location, params);
+}
+
+static void APIENTRY lazy_glGetUniformui64vARB(GLuint program, GLint location, GLuint64 *params) {
+	glad_glGetUniformui64vARB = (PFNGLGETUNIFORMUI64VARBPROC)gladLazyResolve("glGetUniformui64vARB");
+	glad_glGetUniformui64vARB(program, location, params);
+}
+
+static void APIENTRY lazy_glGetnUniformi64vARB(GLuint program, GLint location, GLsizei bufSize, GLint64 *params) {
+	glad_glGetnUniformi64vARB = (PFNGLGETNUNIFORMI64VARBPROC)gladLazyResolve("glGetnUniformi64vARB");
+	glad_glGetnUniformi64vARB(program, location, bufSize, params);
+}
+
+static void APIENTRY lazy_glGetnUniformui64vARB(GLuint program, GLint location, GLsizei bufSize, GLuint64 *params) {
+	glad_glGetnUniformui64vARB = (PFNGLGETNUNIFORMUI64VARBPROC)gladLazyResolve("glGetnUniformui64vARB");
+	glad_glGetnUniformui64vARB(program, location, bufSize, params);
+}
+
+static void APIENTRY lazy_glProgramUniform1i64ARB(GLuint program, GLint location, GLint64 x) {
+	glad_glProgramUniform1i64ARB = (PFNGLPROGRAMUNIFORM1I64ARBPROC)gladLazyResolve("glProgramUniform1i64ARB");
+	glad_glProgramUniform1i64ARB(program, location, x);
+}
+
+static void APIENTRY lazy_glProgramUniform2i64ARB(GLuint program, GLint location, GLint64 x, GLint64 y) {
+	glad_glProgramUniform2i64ARB = (PFNGLPROGRAMUNIFORM2I64ARBPROC)gladLazyResolve("glProgramUniform2i64ARB");
+	glad_glProgramUniform2i64ARB(program, location, x, y);
+}
+
+static void APIENTRY lazy_glProgramUniform3i64ARB(GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z) {
+	glad_glProgramUniform3i64ARB = (PFNGLPROGRAMUNIFORM3I64ARBPROC)gladLazyResolve("glProgramUniform3i64ARB");
+	glad_glProgramUniform3i64ARB(program, location, x, y, z);
+}
+
+static void APIENTRY lazy_glProgramUniform4i64ARB(GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w) {
+	glad_glProgramUniform4i64ARB = (PFNGLPROGRAMUNIFORM4I64ARBPROC)gladLazyResolve("glProgramUniform4i64ARB");
+	glad_glProgramUniform4i64ARB(program, location, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramUniform1i64vARB(GLuint program, GLint location, GLsizei count, const GLint64 *value) {
+	glad_glProgramUniform1i64vARB = (PFNGLPROGRAMUNIFORM1I64VARBPROC)gladLazyResolve("glProgramUniform1i64vARB");
+	glad_glProgramUniform1i64vARB(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform2i64vARB(GLuint program, GLint location, GLsizei count, const GLint64 *value) {
+	glad_glProgramUniform2i64vARB = (PFNGLPROGRAMUNIFORM2I64VARBPROC)gladLazyResolve("glProgramUniform2i64vARB");
+	glad_glProgramUniform2i64vARB(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform3i64vARB(GLuint program, GLint location, GLsizei count, const GLint64 *value) {
+	glad_glProgramUniform3i64vARB = (PFNGLPROGRAMUNIFORM3I64VARBPROC)gladLazyResolve("glProgramUniform3i64vARB");
+	glad_glProgramUniform3i64vARB(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform4i64vARB(GLuint program, GLint location, GLsizei count, const GLint64 *value) {
+	glad_glProgramUniform4i64vARB = (PFNGLPROGRAMUNIFORM4I64VARBPROC)gladLazyResolve("glProgramUniform4i64vARB");
+	glad_glProgramUniform4i64vARB(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform1ui64ARB(GLuint program, GLint location, GLuint64 x) {
+	glad_glProgramUniform1ui64ARB = (PFNGLPROGRAMUNIFORM1UI64ARBPROC)gladLazyResolve("glProgramUniform1ui64ARB");
+	glad_glProgramUniform1ui64ARB(program, location, x);
+}
+
+static void APIENTRY lazy_glProgramUniform2ui64ARB(GLuint program, GLint location, GLuint64 x, GLuint64 y) {
+	glad_glProgramUniform2ui64ARB = (PFNGLPROGRAMUNIFORM2UI64ARBPROC)gladLazyResolve("glProgramUniform2ui64ARB");
+	glad_glProgramUniform2ui64ARB(program, location, x, y);
+}
+
+static void APIENTRY lazy_glProgramUniform3ui64ARB(GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z) {
+	glad_glProgramUniform3ui64ARB = (PFNGLPROGRAMUNIFORM3UI64ARBPROC)gladLazyResolve("glProgramUniform3ui64ARB");
+	glad_glProgramUniform3ui64ARB(program, location, x, y, z);
+}
+
+static void APIENTRY lazy_glProgramUniform4ui64ARB(GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w) {
+	glad_glProgramUniform4ui64ARB = (PFNGLPROGRAMUNIFORM4UI64ARBPROC)gladLazyResolve("glProgramUniform4ui64ARB");
+	glad_glProgramUniform4ui64ARB(program, location, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramUniform1ui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 *value) {
+	glad_glProgramUniform1ui64vARB = (PFNGLPROGRAMUNIFORM1UI64VARBPROC)gladLazyResolve("glProgramUniform1ui64vARB");
+	glad_glProgramUniform1ui64vARB(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform2ui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 *value) {
+	glad_glProgramUniform2ui64vARB = (PFNGLPROGRAMUNIFORM2UI64VARBPROC)gladLazyResolve("glProgramUniform2ui64vARB");
+	glad_glProgramUniform2ui64vARB(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform3ui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 *value) {
+	glad_glProgramUniform3ui64vARB = (PFNGLPROGRAMUNIFORM3UI64VARBPROC)gladLazyResolve("glProgramUniform3ui64vARB");
+	glad_glProgramUniform3ui64vARB(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform4ui64vARB(GLuint program, GLint location, GLsizei count, const GLuint64 *value) {
+	glad_glProgramUniform4ui64vARB = (PFNGLPROGRAMUNIFORM4UI64VARBPROC)gladLazyResolve("glProgramUniform4ui64vARB");
+	glad_glProgramUniform4ui64vARB(program, location, count, value);
+}
+
+static void APIENTRY lazy_glColorTable(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *table) {
+	glad_glColorTable = (PFNGLCOLORTABLEPROC)gladLazyResolve("glColorTable");
+	glad_glColorTable(target, internalformat, width, format, type, table);
+}
+
+static void APIENTRY lazy_glColorTableParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glColorTableParameterfv = (PFNGLCOLORTABLEPARAMETERFVPROC)gladLazyResolve("glColorTableParameterfv");
+	glad_glColorTableParameterfv(target, pname, params);
+}
+
+static void APIENTRY lazy_glColorTableParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glColorTableParameteriv = (PFNGLCOLORTABLEPARAMETERIVPROC)gladLazyResolve("glColorTableParameteriv");
+	glad_glColorTableParameteriv(target, pname, params);
+}
+
+static void APIENTRY lazy_glCopyColorTable(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width) {
+	glad_glCopyColorTable = (PFNGLCOPYCOLORTABLEPROC)gladLazyResolve("glCopyColorTable");
+	glad_glCopyColorTable(target, internalformat, x, y, width);
+}
+
+static void APIENTRY lazy_glGetColorTable(GLenum target, GLenum format, GLenum type, void *table) {
+	glad_glGetColorTable = (PFNGLGETCOLORTABLEPROC)gladLazyResolve("glGetColorTable");
+	glad_glGetColorTable(target, format, type, table);
+}
+
+static void APIENTRY lazy_glGetColorTableParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetColorTableParameterfv = (PFNGLGETCOLORTABLEPARAMETERFVPROC)gladLazyResolve("glGetColorTableParameterfv");
+	glad_glGetColorTableParameterfv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetColorTableParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetColorTableParameteriv = (PFNGLGETCOLORTABLEPARAMETERIVPROC)gladLazyResolve("glGetColorTableParameteriv");
+	glad_glGetColorTableParameteriv(target, pname, params);
+}
+
+static void APIENTRY lazy_glColorSubTable(GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const void *data) {
+	glad_glColorSubTable = (PFNGLCOLORSUBTABLEPROC)gladLazyResolve("glColorSubTable");
+	glad_glColorSubTable(target, start, count, format, type, data);
+}
+
+static void APIENTRY lazy_glCopyColorSubTable(GLenum target, GLsizei start, GLint x, GLint y, GLsizei width) {
+	glad_glCopyColorSubTable = (PFNGLCOPYCOLORSUBTABLEPROC)gladLazyResolve("glCopyColorSubTable");
+	glad_glCopyColorSubTable(target, start, x, y, width);
+}
+
+static void APIENTRY lazy_glConvolutionFilter1D(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *image) {
+	glad_glConvolutionFilter1D = (PFNGLCONVOLUTIONFILTER1DPROC)gladLazyResolve("glConvolutionFilter1D");
+	glad_glConvolutionFilter1D(target, internalformat, width, format, type, image);
+}
+
+static void APIENTRY lazy_glConvolutionFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *image) {
+	glad_glConvolutionFilter2D = (PFNGLCONVOLUTIONFILTER2DPROC)gladLazyResolve("glConvolutionFilter2D");
+	glad_glConvolutionFilter2D(target, internalformat, width, height, format, type, image);
+}
+
+static void APIENTRY lazy_glConvolutionParameterf(GLenum target, GLenum pname, GLfloat params) {
+	glad_glConvolutionParameterf = (PFNGLCONVOLUTIONPARAMETERFPROC)gladLazyResolve("glConvolutionParameterf");
+	glad_glConvolutionParameterf(target, pname, params);
+}
+
+static void APIENTRY lazy_glConvolutionParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glConvolutionParameterfv = (PFNGLCONVOLUTIONPARAMETERFVPROC)gladLazyResolve("glConvolutionParameterfv");
+	glad_glConvolutionParameterfv(target, pname, params);
+}
+
+static void APIENTRY lazy_glConvolutionParameteri(GLenum target, GLenum pname, GLint params) {
+	glad_glConvolutionParameteri = (PFNGLCONVOLUTIONPARAMETERIPROC)gladLazyResolve("glConvolutionParameteri");
+	glad_glConvolutionParameteri(target, pname, params);
+}
+
+static void APIENTRY lazy_glConvolutionParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glConvolutionParameteriv = (PFNGLCONVOLUTIONPARAMETERIVPROC)gladLazyResolve("glConvolutionParameteriv");
+	glad_glConvolutionParameteriv(target, pname, params);
+}
+
+static void APIENTRY lazy_glCopyConvolutionFilter1D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width) {
+	glad_glCopyConvolutionFilter1D = (PFNGLCOPYCONVOLUTIONFILTER1DPROC)gladLazyResolve("glCopyConvolutionFilter1D");
+	glad_glCopyConvolutionFilter1D(target, internalformat, x, y, width);
+}
+
+static void APIENTRY lazy_glCopyConvolutionFilter2D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyConvolutionFilter2D = (PFNGLCOPYCONVOLUTIONFILTER2DPROC)gladLazyResolve("glCopyConvolutionFilter2D");
+	glad_glCopyConvolutionFilter2D(target, internalformat, x, y, width, height);
+}
+
+static void APIENTRY lazy_glGetConvolutionFilter(GLenum target, GLenum format, GLenum type, void *image) {
+	glad_glGetConvolutionFilter = (PFNGLGETCONVOLUTIONFILTERPROC)gladLazyResolve("glGetConvolutionFilter");
+	glad_glGetConvolutionFilter(target, format, type, image);
+}
+
+static void APIENTRY lazy_glGetConvolutionParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetConvolutionParameterfv = (PFNGLGETCONVOLUTIONPARAMETERFVPROC)gladLazyResolve("glGetConvolutionParameterfv");
+	glad_glGetConvolutionParameterfv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetConvolutionParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetConvolutionParameteriv = (PFNGLGETCONVOLUTIONPARAMETERIVPROC)gladLazyResolve("glGetConvolutionParameteriv");
+	glad_glGetConvolutionParameteriv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetSeparableFilter(GLenum target, GLenum format, GLenum type, void *row, void *column, void *span) {
+	glad_glGetSeparableFilter = (PFNGLGETSEPARABLEFILTERPROC)gladLazyResolve("glGetSeparableFilter");
+	glad_glGetSeparableFilter(target, format, type, row, column, span);
+}
+
+static void APIENTRY lazy_glSeparableFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *row, const void *column) {
+	glad_glSeparableFilter2D = (PFNGLSEPARABLEFILTER2DPROC)gladLazyResolve("glSeparableFilter2D");
+	glad_glSeparableFilter2D(target, internalformat, width, height, format, type, row, column);
+}
+
+static void APIENTRY lazy_glGetHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, void *values) {
+	glad_glGetHistogram = (PFNGLGETHISTOGRAMPROC)gladLazyResolve("glGetHistogram");
+	glad_glGetHistogram(target, reset, format, type, values);
+}
+
+static void APIENTRY lazy_glGetHistogramParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetHistogramParameterfv = (PFNGLGETHISTOGRAMPARAMETERFVPROC)gladLazyResolve("glGetHistogramParameterfv");
+	glad_glGetHistogramParameterfv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetHistogramParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetHistogramParameteriv = (PFNGLGETHISTOGRAMPARAMETERIVPROC)gladLazyResolve("glGetHistogramParameteriv");
+	glad_glGetHistogramParameteriv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, void *values) {
+	glad_glGetMinmax = (PFNGLGETMINMAXPROC)gladLazyResolve("glGetMinmax");
+	glad_glGetMinmax(target, reset, format, type, values);
+}
+
+static void APIENTRY lazy_glGetMinmaxParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetMinmaxParameterfv = (PFNGLGETMINMAXPARAMETERFVPROC)gladLazyResolve("glGetMinmaxParameterfv");
+	glad_glGetMinmaxParameterfv(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetMinmaxParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetMinmaxParameteriv = (PFNGLGETMINMAXPARAMETERIVPROC)gladLazyResolve("glGetMinmaxParameteriv");
+	glad_glGetMinmaxParameteriv(target, pname, params);
+}
+
+static void APIENTRY lazy_glHistogram(GLenum target, GLsizei width, GLenum internalformat, GLboolean sink) {
+	glad_glHistogram = (PFNGLHISTOGRAMPROC)gladLazyResolve("glHistogram");
+	glad_glHistogram(target, width, internalformat, sink);
+}
+
+static void APIENTRY lazy_glMinmax(GLenum target, GLenum internalformat, GLboolean sink) {
+	glad_glMinmax = (PFNGLMINMAXPROC)gladLazyResolve("glMinmax");
+	glad_glMinmax(target, internalformat, sink);
+}
+
+static void APIENTRY lazy_glResetHistogram(GLenum target) {
+	glad_glResetHistogram = (PFNGLRESETHISTOGRAMPROC)gladLazyResolve("glResetHistogram");
+	glad_glResetHistogram(target);
+}
+
+static void APIENTRY lazy_glResetMinmax(GLenum target) {
+	glad_glResetMinmax = (PFNGLRESETMINMAXPROC)gladLazyResolve("glResetMinmax");
+	glad_glResetMinmax(target);
+}
+
+#endif
+static void APIENTRY lazy_glMultiDrawArraysIndirectCountARB(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+	glad_glMultiDrawArraysIndirectCountARB = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)gladLazyResolve("glMultiDrawArraysIndirectCountARB");
+	glad_glMultiDrawArraysIndirectCountARB(mode, indirect, drawcount, maxdrawcount, stride);
+}
+
+static void APIENTRY lazy_glMultiDrawElementsIndirectCountARB(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+	glad_glMultiDrawElementsIndirectCountARB = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)gladLazyResolve("glMultiDrawElementsIndirectCountARB");
+	glad_glMultiDrawElementsIndirectCountARB(mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+
+#ifndef GLAD_CORE_PROFILE
+static void APIENTRY lazy_glVertexAttribDivisorARB(GLuint index, GLuint divisor) {
+	glad_glVertexAttribDivisorARB = (PFNGLVERTEXATTRIBDIVISORARBPROC)gladLazyResolve("glVertexAttribDivisorARB");
+	glad_glVertexAttribDivisorARB(index, divisor);
+}
+
+static void APIENTRY lazy_glCurrentPaletteMatrixARB(GLint index) {
+	glad_glCurrentPaletteMatrixARB = (PFNGLCURRENTPALETTEMATRIXARBPROC)gladLazyResolve("glCurrentPaletteMatrixARB");
+	glad_glCurrentPaletteMatrixARB(index);
+}
+
+static void APIENTRY lazy_glMatrixIndexubvARB(GLint size, const GLubyte *indices) {
+	glad_glMatrixIndexubvARB = (PFNGLMATRIXINDEXUBVARBPROC)gladLazyResolve("glMatrixIndexubvARB");
+	glad_glMatrixIndexubvARB(size, indices);
+}
+
+static void APIENTRY lazy_glMatrixIndexusvARB(GLint size, const GLushort *indices) {
+	glad_glMatrixIndexusvARB = (PFNGLMATRIXINDEXUSVARBPROC)gladLazyResolve("glMatrixIndexusvARB");
+	glad_glMatrixIndexusvARB(size, indices);
+}
+
+static void APIENTRY lazy_glMatrixIndexuivARB(GLint size, const GLuint *indices) {
+	glad_glMatrixIndexuivARB = (PFNGLMATRIXINDEXUIVARBPROC)gladLazyResolve("glMatrixIndexuivARB");
+	glad_glMatrixIndexuivARB(size, indices);
+}
+
+static void APIENTRY lazy_glMatrixIndexPointerARB(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glMatrixIndexPointerARB = (PFNGLMATRIXINDEXPOINTERARBPROC)gladLazyResolve("glMatrixIndexPointerARB");
+	glad_glMatrixIndexPointerARB(size, type, stride, pointer);
+}
+
+static void APIENTRY lazy_glSampleCoverageARB(GLfloat value, GLboolean invert) {
+	glad_glSampleCoverageARB = (PFNGLSAMPLECOVERAGEARBPROC)gladLazyResolve("glSampleCoverageARB");
+	glad_glSampleCoverageARB(value, invert);
+}
+
+static void APIENTRY lazy_glActiveTextureARB(GLenum texture) {
+	glad_glActiveTextureARB = (PFNGLACTIVETEXTUREARBPROC)gladLazyResolve("glActiveTextureARB");
+	glad_glActiveTextureARB(texture);
+}
+
+static void APIENTRY lazy_glClientActiveTextureARB(GLenum texture) {
+	glad_glClientActiveTextureARB = (PFNGLCLIENTACTIVETEXTUREARBPROC)gladLazyResolve("glClientActiveTextureARB");
+	glad_glClientActiveTextureARB(texture);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1dARB(GLenum target, GLdouble s) {
+	glad_glMultiTexCoord1dARB = (PFNGLMULTITEXCOORD1DARBPROC)gladLazyResolve("glMultiTexCoord1dARB");
+	glad_glMultiTexCoord1dARB(target, s);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1dvARB(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord1dvARB = (PFNGLMULTITEXCOORD1DVARBPROC)gladLazyResolve("glMultiTexCoord1dvARB");
+	glad_glMultiTexCoord1dvARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1fARB(GLenum target, GLfloat s) {
+	glad_glMultiTexCoord1fARB = (PFNGLMULTITEXCOORD1FARBPROC)gladLazyResolve("glMultiTexCoord1fARB");
+	glad_glMultiTexCoord1fARB(target, s);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1fvARB(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord1fvARB = (PFNGLMULTITEXCOORD1FVARBPROC)gladLazyResolve("glMultiTexCoord1fvARB");
+	glad_glMultiTexCoord1fvARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1iARB(GLenum target, GLint s) {
+	glad_glMultiTexCoord1iARB = (PFNGLMULTITEXCOORD1IARBPROC)gladLazyResolve("glMultiTexCoord1iARB");
+	glad_glMultiTexCoord1iARB(target, s);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1ivARB(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord1ivARB = (PFNGLMULTITEXCOORD1IVARBPROC)gladLazyResolve("glMultiTexCoord1ivARB");
+	glad_glMultiTexCoord1ivARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1sARB(GLenum target, GLshort s) {
+	glad_glMultiTexCoord1sARB = (PFNGLMULTITEXCOORD1SARBPROC)gladLazyResolve("glMultiTexCoord1sARB");
+	glad_glMultiTexCoord1sARB(target, s);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1svARB(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord1svARB = (PFNGLMULTITEXCOORD1SVARBPROC)gladLazyResolve("glMultiTexCoord1svARB");
+	glad_glMultiTexCoord1svARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2dARB(GLenum target, GLdouble s, GLdouble t) {
+	glad_glMultiTexCoord2dARB = (PFNGLMULTITEXCOORD2DARBPROC)gladLazyResolve("glMultiTexCoord2dARB");
+	glad_glMultiTexCoord2dARB(target, s, t);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2dvARB(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord2dvARB = (PFNGLMULTITEXCOORD2DVARBPROC)gladLazyResolve("glMultiTexCoord2dvARB");
+	glad_glMultiTexCoord2dvARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2fARB(GLenum target, GLfloat s, GLfloat t) {
+	glad_glMultiTexCoord2fARB = (PFNGLMULTITEXCOORD2FARBPROC)gladLazyResolve("glMultiTexCoord2fARB");
+	glad_glMultiTexCoord2fARB(target, s, t);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2fvARB(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord2fvARB = (PFNGLMULTITEXCOORD2FVARBPROC)gladLazyResolve("glMultiTexCoord2fvARB");
+	glad_glMultiTexCoord2fvARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2iARB(GLenum target, GLint s, GLint t) {
+	glad_glMultiTexCoord2iARB = (PFNGLMULTITEXCOORD2IARBPROC)gladLazyResolve("glMultiTexCoord2iARB");
+	glad_glMultiTexCoord2iARB(target, s, t);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2ivARB(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord2ivARB = (PFNGLMULTITEXCOORD2IVARBPROC)gladLazyResolve("glMultiTexCoord2ivARB");
+	glad_glMultiTexCoord2ivARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2sARB(GLenum target, GLshort s, GLshort t) {
+	glad_glMultiTexCoord2sARB = (PFNGLMULTITEXCOORD2SARBPROC)gladLazyResolve("glMultiTexCoord2sARB");
+	glad_glMultiTexCoord2sARB(target, s, t);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2svARB(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord2svARB = (PFNGLMULTITEXCOORD2SVARBPROC)gladLazyResolve("glMultiTexCoord2svARB");
+	glad_glMultiTexCoord2svARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+	glad_glMultiTexCoord3dARB = (PFNGLMULTITEXCOORD3DARBPROC)gladLazyResolve("glMultiTexCoord3dARB");
+	glad_glMultiTexCoord3dARB(target, s, t, r);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3dvARB(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord3dvARB = (PFNGLMULTITEXCOORD3DVARBPROC)gladLazyResolve("glMultiTexCoord3dvARB");
+	glad_glMultiTexCoord3dvARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+	glad_glMultiTexCoord3fARB = (PFNGLMULTITEXCOORD3FARBPROC)gladLazyResolve("glMultiTexCoord3fARB");
+	glad_glMultiTexCoord3fARB(target, s, t, r);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3fvARB(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord3fvARB = (PFNGLMULTITEXCOORD3FVARBPROC)gladLazyResolve("glMultiTexCoord3fvARB");
+	glad_glMultiTexCoord3fvARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3iARB(GLenum target, GLint s, GLint t, GLint r) {
+	glad_glMultiTexCoord3iARB = (PFNGLMULTITEXCOORD3IARBPROC)gladLazyResolve("glMultiTexCoord3iARB");
+	glad_glMultiTexCoord3iARB(target, s, t, r);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3ivARB(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord3ivARB = (PFNGLMULTITEXCOORD3IVARBPROC)gladLazyResolve("glMultiTexCoord3ivARB");
+	glad_glMultiTexCoord3ivARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3sARB(GLenum target, GLshort s, GLshort t, GLshort r) {
+	glad_glMultiTexCoord3sARB = (PFNGLMULTITEXCOORD3SARBPROC)gladLazyResolve("glMultiTexCoord3sARB");
+	glad_glMultiTexCoord3sARB(target, s, t, r);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3svARB(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord3svARB = (PFNGLMULTITEXCOORD3SVARBPROC)gladLazyResolve("glMultiTexCoord3svARB");
+	glad_glMultiTexCoord3svARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	glad_glMultiTexCoord4dARB = (PFNGLMULTITEXCOORD4DARBPROC)gladLazyResolve("glMultiTexCoord4dARB");
+	glad_glMultiTexCoord4dARB(target, s, t, r, q);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4dvARB(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord4dvARB = (PFNGLMULTITEXCOORD4DVARBPROC)gladLazyResolve("glMultiTexCoord4dvARB");
+	glad_glMultiTexCoord4dvARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	glad_glMultiTexCoord4fARB = (PFNGLMULTITEXCOORD4FARBPROC)gladLazyResolve("glMultiTexCoord4fARB");
+	glad_glMultiTexCoord4fARB(target, s, t, r, q);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4fvARB(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord4fvARB = (PFNGLMULTITEXCOORD4FVARBPROC)gladLazyResolve("glMultiTexCoord4fvARB");
+	glad_glMultiTexCoord4fvARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4iARB(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+	glad_glMultiTexCoord4iARB = (PFNGLMULTITEXCOORD4IARBPROC)gladLazyResolve("glMultiTexCoord4iARB");
+	glad_glMultiTexCoord4iARB(target, s, t, r, q);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4ivARB(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord4ivARB = (PFNGLMULTITEXCOORD4IVARBPROC)gladLazyResolve("glMultiTexCoord4ivARB");
+	glad_glMultiTexCoord4ivARB(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4sARB(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+	glad_glMultiTexCoord4sARB = (PFNGLMULTITEXCOORD4SARBPROC)gladLazyResolve("glMultiTexCoord4sARB");
+	glad_glMultiTexCoord4sARB(target, s, t, r, q);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4svARB(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord4svARB = (PFNGLMULTITEXCOORD4SVARBPROC)gladLazyResolve("glMultiTexCoord4svARB");
+	glad_glMultiTexCoord4svARB(target, v);
+}
+
+static void APIENTRY lazy_glGenQueriesARB(GLsizei n, GLuint *ids) {
+	glad_glGenQueriesARB = (PFNGLGENQUERIESARBPROC)gladLazyResolve("glGenQueriesARB");
+	glad_glGenQueriesARB(n, ids);
+}
+
+static void APIENTRY lazy_glDeleteQueriesARB(GLsizei n, const GLuint *ids) {
+	glad_glDeleteQueriesARB = (PFNGLDELETEQUERIESARBPROC)gladLazyResolve("glDeleteQueriesARB");
+	glad_glDeleteQueriesARB(n, ids);
+}
+
+static GLboolean APIENTRY lazy_glIsQueryARB(GLuint id) {
+	glad_glIsQueryARB = (PFNGLISQUERYARBPROC)gladLazyResolve("glIsQueryARB");
+	return glad_glIsQueryARB(id);
+}
+
+static void APIENTRY lazy_glBeginQueryARB(GLenum target, GLuint id) {
+	glad_glBeginQueryARB = (PFNGLBEGINQUERYARBPROC)gladLazyResolve("glBeginQueryARB");
+	glad_glBeginQueryARB(target, id);
+}
+
+static void APIENTRY lazy_glEndQueryARB(GLenum target) {
+	glad_glEndQueryARB = (PFNGLENDQUERYARBPROC)gladLazyResolve("glEndQueryARB");
+	glad_glEndQueryARB(target);
+}
+
+static void APIENTRY lazy_glGetQueryivARB(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetQueryivARB = (PFNGLGETQUERYIVARBPROC)gladLazyResolve("glGetQueryivARB");
+	glad_glGetQueryivARB(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetQueryObjectivARB(GLuint id, GLenum pname, GLint *params) {
+	glad_glGetQueryObjectivARB = (PFNGLGETQUERYOBJECTIVARBPROC)gladLazyResolve("glGetQueryObjectivARB");
+	glad_glGetQueryObjectivARB(id, pname, params);
+}
+
+static void APIENTRY lazy_glGetQueryObjectuivARB(GLuint id, GLenum pname, GLuint *params) {
+	glad_glGetQueryObjectuivARB = (PFNGLGETQUERYOBJECTUIVARBPROC)gladLazyResolve("glGetQueryObjectuivARB");
+	glad_glGetQueryObjectuivARB(id, pname, params);
+}
+
+#endif
+static void APIENTRY lazy_glMaxShaderCompilerThreadsARB(GLuint count) {
+	glad_glMaxShaderCompilerThreadsARB = (PFNGLMAXSHADERCOMPILERTHREADSARBPROC)gladLazyResolve("glMaxShaderCompilerThreadsARB");
+	glad_glMaxShaderCompilerThreadsARB(count);
+}
+
+#ifndef GLAD_CORE_PROFILE
+static void APIENTRY lazy_glPointParameterfARB(GLenum pname, GLfloat param) {
+	glad_glPointParameterfARB = (PFNGLPOINTPARAMETERFARBPROC)gladLazyResolve("glPointParameterfARB");
+	glad_glPointParameterfARB(pname, param);
+}
+
+static void APIENTRY lazy_glPointParameterfvARB(GLenum pname, const GLfloat *params) {
+	glad_glPointParameterfvARB = (PFNGLPOINTPARAMETERFVARBPROC)gladLazyResolve("glPointParameterfvARB");
+	glad_glPointParameterfvARB(pname, params);
+}
+
+#endif
+static void APIENTRY lazy_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) {
+	glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)gladLazyResolve("glPolygonOffsetClamp");
+	glad_glPolygonOffsetClamp(factor, units, clamp);
+}
+
+#ifndef GLAD_CORE_PROFILE
+static GLenum APIENTRY lazy_glGetGraphicsResetStatusARB(void) {
+	glad_glGetGraphicsResetStatusARB = (PFNGLGETGRAPHICSRESETSTATUSARBPROC)gladLazyResolve("glGetGraphicsResetStatusARB");
+	return glad_glGetGraphicsResetStatusARB();
+}
+
+static void APIENTRY lazy_glGetnTexImageARB(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *img) {
+	glad_glGetnTexImageARB = (PFNGLGETNTEXIMAGEARBPROC)gladLazyResolve("glGetnTexImageARB");
+	glad_glGetnTexImageARB(target, level, format, type, bufSize, img);
+}
+
+static void APIENTRY lazy_glReadnPixelsARB(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+	glad_glReadnPixelsARB = (PFNGLREADNPIXELSARBPROC)gladLazyResolve("glReadnPixelsARB");
+	glad_glReadnPixelsARB(x, y, width, height, format, type, bufSize, data);
+}
+
+static void APIENTRY lazy_glGetnCompressedTexImageARB(GLenum target, GLint lod, GLsizei bufSize, void *img) {
+	glad_glGetnCompressedTexImageARB = (PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC)gladLazyResolve("glGetnCompressedTexImageARB");
+	glad_glGetnCompressedTexImageARB(target, lod, bufSize, img);
+}
+
+static void APIENTRY lazy_glGetnUniformfvARB(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+	glad_glGetnUniformfvARB = (PFNGLGETNUNIFORMFVARBPROC)gladLazyResolve("glGetnUniformfvARB");
+	glad_glGetnUniformfvARB(program, location, bufSize, params);
+}
+
+static void APIENTRY lazy_glGetnUniformivARB(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+	glad_glGetnUniformivARB = (PFNGLGETNUNIFORMIVARBPROC)gladLazyResolve("glGetnUniformivARB");
+	glad_glGetnUniformivARB(program, location, bufSize, params);
+}
+
+static void APIENTRY lazy_glGetnUniformuivARB(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+	glad_glGetnUniformuivARB = (PFNGLGETNUNIFORMUIVARBPROC)gladLazyResolve("glGetnUniformuivARB");
+	glad_glGetnUniformuivARB(program, location, bufSize, params);
+}
+
+static void APIENTRY lazy_glGetnUniformdvARB(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) {
+	glad_glGetnUniformdvARB = (PFNGLGETNUNIFORMDVARBPROC)gladLazyResolve("glGetnUniformdvARB");
+	glad_glGetnUniformdvARB(program, location, bufSize, params);
+}
+
+static void APIENTRY lazy_glGetnMapdvARB(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v) {
+	glad_glGetnMapdvARB = (PFNGLGETNMAPDVARBPROC)gladLazyResolve("glGetnMapdvARB");
+	glad_glGetnMapdvARB(target, query, bufSize, v);
+}
+
+static void APIENTRY lazy_glGetnMapfvARB(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v) {
+	glad_glGetnMapfvARB = (PFNGLGETNMAPFVARBPROC)gladLazyResolve("glGetnMapfvARB");
+	glad_glGetnMapfvARB(target, query, bufSize, v);
+}
+
+static void APIENTRY lazy_glGetnMapivARB(GLenum target, GLenum query, GLsizei bufSize, GLint *v) {
+	glad_glGetnMapivARB = (PFNGLGETNMAPIVARBPROC)gladLazyResolve("glGetnMapivARB");
+	glad_glGetnMapivARB(target, query, bufSize, v);
+}
+
+static void APIENTRY lazy_glGetnPixelMapfvARB(GLenum map, GLsizei bufSize, GLfloat *values) {
+	glad_glGetnPixelMapfvARB = (PFNGLGETNPIXELMAPFVARBPROC)gladLazyResolve("glGetnPixelMapfvARB");
+	glad_glGetnPixelMapfvARB(map, bufSize, values);
+}
+
+static void APIENTRY lazy_glGetnPixelMapuivARB(GLenum map, GLsizei bufSize, GLuint *values) {
+	glad_glGetnPixelMapuivARB = (PFNGLGETNPIXELMAPUIVARBPROC)gladLazyResolve("glGetnPixelMapuivARB");
+	glad_glGetnPixelMapuivARB(map, bufSize, values);
+}
+
+static void APIENTRY lazy_glGetnPixelMapusvARB(GLenum map, GLsizei bufSize, GLushort *values) {
+	glad_glGetnPixelMapusvARB = (PFNGLGETNPIXELMAPUSVARBPROC)gladLazyResolve("glGetnPixelMapusvARB");
+	glad_glGetnPixelMapusvARB(map, bufSize, values);
+}
+
+static void APIENTRY lazy_glGetnPolygonStippleARB(GLsizei bufSize, GLubyte *pattern) {
+	glad_glGetnPolygonStippleARB = (PFNGLGETNPOLYGONSTIPPLEARBPROC)gladLazyResolve("glGetnPolygonStippleARB");
+	glad_glGetnPolygonStippleARB(bufSize, pattern);
+}
+
+static void APIENTRY lazy_glGetnColorTableARB(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table) {
+	glad_glGetnColorTableARB = (PFNGLGETNCOLORTABLEARBPROC)gladLazyResolve("glGetnColorTableARB");
+	glad_glGetnColorTableARB(target, format, type, bufSize, table);
+}
+
+static void APIENTRY lazy_glGetnConvolutionFilterARB(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image) {
+	glad_glGetnConvolutionFilterARB = (PFNGLGETNCONVOLUTIONFILTERARBPROC)gladLazyResolve("glGetnConvolutionFilterARB");
+	glad_glGetnConvolutionFilterARB(target, format, type, bufSize, image);
+}
+
+static void APIENTRY lazy_glGetnSeparableFilterARB(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span) {
+	glad_glGetnSeparableFilterARB = (PFNGLGETNSEPARABLEFILTERARBPROC)gladLazyResolve("glGetnSeparableFilterARB");
+	glad_glGetnSeparableFilterARB(target, format, type, rowBufSize, row, columnBufSize, column, span);
+}
+
+static void APIENTRY lazy_glGetnHistogramARB(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+	glad_glGetnHistogramARB = (PFNGLGETNHISTOGRAMARBPROC)gladLazyResolve("glGetnHistogramARB");
+	glad_glGetnHistogramARB(target, reset, format, type, bufSize, values);
+}
+
+static void APIENTRY lazy_glGetnMinmaxARB(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+	glad_glGetnMinmaxARB = (PFNGLGETNMINMAXARBPROC)gladLazyResolve("glGetnMinmaxARB");
+	glad_glGetnMinmaxARB(target, reset, format, type, bufSize, values);
+}
+
+static void APIENTRY lazy_glFramebufferSampleLocationsfvARB(GLenum target, GLuint start, GLsizei count, const GLfloat *v) {
+	glad_glFramebufferSampleLocationsfvARB = (PFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)gladLazyResolve("glFramebufferSampleLocationsfvARB");
+	glad_glFramebufferSampleLocationsfvARB(target, start, count, v);
+}
+
+static void APIENTRY lazy_glNamedFramebufferSampleLocationsfvARB(GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v) {
+	glad_glNamedFramebufferSampleLocationsfvARB = (PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)gladLazyResolve("glNamedFramebufferSampleLocationsfvARB");
+	glad_glNamedFramebufferSampleLocationsfvARB(framebuffer, start, count, v);
+}
+
+static void APIENTRY lazy_glEvaluateDepthValuesARB(void) {
+	glad_glEvaluateDepthValuesARB = (PFNGLEVALUATEDEPTHVALUESARBPROC)gladLazyResolve("glEvaluateDepthValuesARB");
+	glad_glEvaluateDepthValuesARB();
+}
+
+static void APIENTRY lazy_glMinSampleShadingARB(GLfloat value) {
+	glad_glMinSampleShadingARB = (PFNGLMINSAMPLESHADINGARBPROC)gladLazyResolve("glMinSampleShadingARB");
+	glad_glMinSampleShadingARB(value);
+}
+
+static void APIENTRY lazy_glDeleteObjectARB(GLhandleARB obj) {
+	glad_glDeleteObjectARB = (PFNGLDELETEOBJECTARBPROC)gladLazyResolve("glDeleteObjectARB");
+	glad_glDeleteObjectARB(obj);
+}
+
+static GLhandleARB APIENTRY lazy_glGetHandleARB(GLenum pname) {
+	glad_glGetHandleARB = (PFNGLGETHANDLEARBPROC)gladLazyResolve("glGetHandleARB");
+	return glad_glGetHandleARB(pname);
+}
+
+static void APIENTRY lazy_glDetachObjectARB(GLhandleARB containerObj, GLhandleARB attachedObj) {
+	glad_glDetachObjectARB = (PFNGLDETACHOBJECTARBPROC)gladLazyResolve("glDetachObjectARB");
+	glad_glDetachObjectARB(containerObj, attachedObj);
+}
+
+static GLhandleARB APIENTRY lazy_glCreateShaderObjectARB(GLenum shaderType) {
+	glad_glCreateShaderObjectARB = (PFNGLCREATESHADEROBJECTARBPROC)gladLazyResolve("glCreateShaderObjectARB");
+	return glad_glCreateShaderObjectARB(shaderType);
+}
+
+static void APIENTRY lazy_glShaderSourceARB(GLhandleARB shaderObj, GLsizei count, const GLcharARB **string, const GLint *length) {
+	glad_glShaderSourceARB = (PFNGLSHADERSOURCEARBPROC)gladLazyResolve("glShaderSourceARB");
+	glad_glShaderSourceARB(shaderObj, count, string, length);
+}
+
+static void APIENTRY lazy_glCompileShaderARB(GLhandleARB shaderObj) {
+	glad_glCompileShaderARB = (PFNGLCOMPILESHADERARBPROC)gladLazyResolve("glCompileShaderARB");
+	glad_glCompileShaderARB(shaderObj);
+}
+
+static GLhandleARB APIENTRY lazy_glCreateProgramObjectARB(void) {
+	glad_glCreateProgramObjectARB = (PFNGLCREATEPROGRAMOBJECTARBPROC)gladLazyResolve("glCreateProgramObjectARB");
+	return glad_glCreateProgramObjectARB();
+}
+
+static void APIENTRY lazy_glAttachObjectARB(GLhandleARB containerObj, GLhandleARB obj) {
+	glad_glAttachObjectARB = (PFNGLATTACHOBJECTARBPROC)gladLazyResolve("glAttachObjectARB");
+	glad_glAttachObjectARB(containerObj, obj);
+}
+
+static void APIENTRY lazy_glLinkProgramARB(GLhandleARB programObj) {
+	glad_glLinkProgramARB = (PFNGLLINKPROGRAMARBPROC)gladLazyResolve("glLinkProgramARB");
+	glad_glLinkProgramARB(programObj);
+}
+
+static void APIENTRY lazy_glUseProgramObjectARB(GLhandleARB programObj) {
+	glad_glUseProgramObjectARB = (PFNGLUSEPROGRAMOBJECTARBPROC)gladLazyResolve("glUseProgramObjectARB");
+	glad_glUseProgramObjectARB(programObj);
+}
+
+static void APIENTRY lazy_glValidateProgramARB(GLhandleARB programObj) {
+	glad_glValidateProgramARB = (PFNGLVALIDATEPROGRAMARBPROC)gladLazyResolve("glValidateProgramARB");
+	glad_glValidateProgramARB(programObj);
+}
+
+static void APIENTRY lazy_glUniform1fARB(GLint location, GLfloat v0) {
+	glad_glUniform1fARB = (PFNGLUNIFORM1FARBPROC)gladLazyResolve("glUniform1fARB");
+	glad_glUniform1fARB(location, v0);
+}
+
+static void APIENTRY lazy_glUniform2fARB(GLint location, GLfloat v0, GLfloat v1) {
+	glad_glUniform2fARB = (PFNGLUNIFORM2FARBPROC)gladLazyResolve("glUniform2fARB");
+	glad_glUniform2fARB(location, v0, v1);
+}
+
+static void APIENTRY lazy_glUniform3fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_glUniform3fARB = (PFNGLUNIFORM3FARBPROC)gladLazyResolve("glUniform3fARB");
+	glad_glUniform3fARB(location, v0, v1, v2);
+}
+
+static void APIENTRY lazy_glUniform4fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_glUniform4fARB = (PFNGLUNIFORM4FARBPROC)gladLazyResolve("glUniform4fARB");
+	glad_glUniform4fARB(location, v0, v1, v2, v3);
+}
+
+static void APIENTRY lazy_glUniform1iARB(GLint location, GLint v0) {
+	glad_glUniform1iARB = (PFNGLUNIFORM1IARBPROC)gladLazyResolve("glUniform1iARB");
+	glad_glUniform1iARB(location, v0);
+}
+
+static void APIENTRY lazy_glUniform2iARB(GLint location, GLint v0, GLint v1) {
+	glad_glUniform2iARB = (PFNGLUNIFORM2IARBPROC)gladLazyResolve("glUniform2iARB");
+	glad_glUniform2iARB(location, v0, v1);
+}
+
+static void APIENTRY lazy_glUniform3iARB(GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_glUniform3iARB = (PFNGLUNIFORM3IARBPROC)gladLazyResolve("glUniform3iARB");
+	glad_glUniform3iARB(location, v0, v1, v2);
+}
+
+static void APIENTRY lazy_glUniform4iARB(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_glUniform4iARB = (PFNGLUNIFORM4IARBPROC)gladLazyResolve("glUniform4iARB");
+	glad_glUniform4iARB(location, v0, v1, v2, v3);
+}
+
+static void APIENTRY lazy_glUniform1fvARB(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform1fvARB = (PFNGLUNIFORM1FVARBPROC)gladLazyResolve("glUniform1fvARB");
+	glad_glUniform1fvARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform2fvARB(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform2fvARB = (PFNGLUNIFORM2FVARBPROC)gladLazyResolve("glUniform2fvARB");
+	glad_glUniform2fvARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform3fvARB(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform3fvARB = (PFNGLUNIFORM3FVARBPROC)gladLazyResolve("glUniform3fvARB");
+	glad_glUniform3fvARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform4fvARB(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform4fvARB = (PFNGLUNIFORM4FVARBPROC)gladLazyResolve("glUniform4fvARB");
+	glad_glUniform4fvARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform1ivARB(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform1ivARB = (PFNGLUNIFORM1IVARBPROC)gladLazyResolve("glUniform1ivARB");
+	glad_glUniform1ivARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform2ivARB(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform2ivARB = (PFNGLUNIFORM2IVARBPROC)gladLazyResolve("glUniform2ivARB");
+	glad_glUniform2ivARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform3ivARB(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform3ivARB = (PFNGLUNIFORM3IVARBPROC)gladLazyResolve("glUniform3ivARB");
+	glad_glUniform3ivARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform4ivARB(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform4ivARB = (PFNGLUNIFORM4IVARBPROC)gladLazyResolve("glUniform4ivARB");
+	glad_glUniform4ivARB(location, count, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix2fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2fvARB = (PFNGLUNIFORMMATRIX2FVARBPROC)gladLazyResolve("glUniformMatrix2fvARB");
+	glad_glUniformMatrix2fvARB(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix3fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3fvARB = (PFNGLUNIFORMMATRIX3FVARBPROC)gladLazyResolve("glUniformMatrix3fvARB");
+	glad_glUniformMatrix3fvARB(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glUniformMatrix4fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4fvARB = (PFNGLUNIFORMMATRIX4FVARBPROC)gladLazyResolve("glUniformMatrix4fvARB");
+	glad_glUniformMatrix4fvARB(location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glGetObjectParameterfvARB(GLhandleARB obj, GLenum pname, GLfloat *params) {
+	glad_glGetObjectParameterfvARB = (PFNGLGETOBJECTPARAMETERFVARBPROC)gladLazyResolve("glGetObjectParameterfvARB");
+	glad_glGetObjectParameterfvARB(obj, pname, params);
+}
+
+static void APIENTRY lazy_glGetObjectParameterivARB(GLhandleARB obj, GLenum pname, GLint *params) {
+	glad_glGetObjectParameterivARB = (PFNGLGETOBJECTPARAMETERIVARBPROC)gladLazyResolve("glGetObjectParameterivARB");
+	glad_glGetObjectParameterivARB(obj, pname, params);
+}
+
+static void APIENTRY lazy_glGetInfoLogARB(GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *infoLog) {
+	glad_glGetInfoLogARB = (PFNGLGETINFOLOGARBPROC)gladLazyResolve("glGetInfoLogARB");
+	glad_glGetInfoLogARB(obj, maxLength, length, infoLog);
+}
+
+static void APIENTRY lazy_glGetAttachedObjectsARB(GLhandleARB containerObj, GLsizei maxCount, GLsizei *count, GLhandleARB *obj) {
+	glad_glGetAttachedObjectsARB = (PFNGLGETATTACHEDOBJECTSARBPROC)gladLazyResolve("glGetAttachedObjectsARB");
+	glad_glGetAttachedObjectsARB(containerObj, maxCount, count, obj);
+}
+
+static GLint APIENTRY lazy_glGetUniformLocationARB(GLhandleARB programObj, const GLcharARB *name) {
+	glad_glGetUniformLocationARB = (PFNGLGETUNIFORMLOCATIONARBPROC)gladLazyResolve("glGetUniformLocationARB");
+	return glad_glGetUniformLocationARB(programObj, name);
+}
+
+static void APIENTRY lazy_glGetActiveUniformARB(GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei *length, GLint *size, GLenum *type, GLcharARB *name) {
+	glad_glGetActiveUniformARB = (PFNGLGETACTIVEUNIFORMARBPROC)gladLazyResolve("glGetActiveUniformARB");
+	glad_glGetActiveUniformARB(programObj, index, maxLength, length, size, type, name);
+}
+
+static void APIENTRY lazy_glGetUniformfvARB(GLhandleARB programObj, GLint location, GLfloat *params) {
+	glad_glGetUniformfvARB = (PFNGLGETUNIFORMFVARBPROC)gladLazyResolve("glGetUniformfvARB");
+	glad_glGetUniformfvARB(programObj, location, params);
+}
+
+static void APIENTRY lazy_glGetUniformivARB(GLhandleARB programObj, GLint location, GLint *params) {
+	glad_glGetUniformivARB = (PFNGLGETUNIFORMIVARBPROC)gladLazyResolve("glGetUniformivARB");
+	glad_glGetUniformivARB(programObj, location, params);
+}
+
+static void APIENTRY lazy_glGetShaderSourceARB(GLhandleARB obj, GLsizei maxLength, GLsizei *length, GLcharARB *source) {
+	glad_glGetShaderSourceARB = (PFNGLGETSHADERSOURCEARBPROC)gladLazyResolve("glGetShaderSourceARB");
+	glad_glGetShaderSourceARB(obj, maxLength, length, source);
+}
+
+static void APIENTRY lazy_glNamedStringARB(GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string) {
+	glad_glNamedStringARB = (PFNGLNAMEDSTRINGARBPROC)gladLazyResolve("glNamedStringARB");
+	glad_glNamedStringARB(type, namelen, name, stringlen, string);
+}
+
+static void APIENTRY lazy_glDeleteNamedStringARB(GLint namelen, const GLchar *name) {
+	glad_glDeleteNamedStringARB = (PFNGLDELETENAMEDSTRINGARBPROC)gladLazyResolve("glDeleteNamedStringARB");
+	glad_glDeleteNamedStringARB(namelen, name);
+}
+
+static void APIENTRY lazy_glCompileShaderIncludeARB(GLuint shader, GLsizei count, const GLchar *const*path, const GLint *length) {
+	glad_glCompileShaderIncludeARB = (PFNGLCOMPILESHADERINCLUDEARBPROC)gladLazyResolve("glCompileShaderIncludeARB");
+	glad_glCompileShaderIncludeARB(shader, count, path, length);
+}
+
+static GLboolean APIENTRY lazy_glIsNamedStringARB(GLint namelen, const GLchar *name) {
+	glad_glIsNamedStringARB = (PFNGLISNAMEDSTRINGARBPROC)gladLazyResolve("glIsNamedStringARB");
+	return glad_glIsNamedStringARB(namelen, name);
+}
+
+static void APIENTRY lazy_glGetNamedStringARB(GLint namelen, const GLchar *name, GLsizei bufSize, GLint *stringlen, GLchar *string) {
+	glad_glGetNamedStringARB = (PFNGLGETNAMEDSTRINGARBPROC)gladLazyResolve("glGetNamedStringARB");
+	glad_glGetNamedStringARB(namelen, name, bufSize, stringlen, string);
+}
+
+static void APIENTRY lazy_glGetNamedStringivARB(GLint namelen, const GLchar *name, GLenum pname, GLint *params) {
+	glad_glGetNamedStringivARB = (PFNGLGETNAMEDSTRINGIVARBPROC)gladLazyResolve("glGetNamedStringivARB");
+	glad_glGetNamedStringivARB(namelen, name, pname, params);
+}
+
+#endif
+static void APIENTRY lazy_glBufferPageCommitmentARB(GLenum target, GLintptr offset, GLsizeiptr size, GLboolean commit) {
+	glad_glBufferPageCommitmentARB = (PFNGLBUFFERPAGECOMMITMENTARBPROC)gladLazyResolve("glBufferPageCommitmentARB");
+	glad_glBufferPageCommitmentARB(target, offset, size, commit);
+}
+
+static void APIENTRY lazy_glNamedBufferPageCommitmentEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit) {
+	glad_glNamedBufferPageCommitmentEXT = (PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC)gladLazyResolve("glNamedBufferPageCommitmentEXT");
+	glad_glNamedBufferPageCommitmentEXT(buffer, offset, size, commit);
+}
+
+static void APIENTRY lazy_glNamedBufferPageCommitmentARB(GLuint buffer, GLintptr offset, GLsizeiptr size, GLboolean commit) {
+	glad_glNamedBufferPageCommitmentARB = (PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC)gladLazyResolve("glNamedBufferPageCommitmentARB");
+	glad_glNamedBufferPageCommitmentARB(buffer, offset, size, commit);
+}
+
+static void APIENTRY lazy_glTexPageCommitmentARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit) {
+	glad_glTexPageCommitmentARB = (PFNGLTEXPAGECOMMITMENTARBPROC)gladLazyResolve("glTexPageCommitmentARB");
+	glad_glTexPageCommitmentARB(target, level, xoffset, yoffset, zoffset, width, height, depth, commit);
+}
+
+#ifndef GLAD_CORE_PROFILE
+static void APIENTRY lazy_glTexBufferARB(GLenum target, GLenum internalformat, GLuint buffer) {
+	glad_glTexBufferARB = (PFNGLTEXBUFFERARBPROC)gladLazyResolve("glTexBufferARB");
+	glad_glTexBufferARB(target, internalformat, buffer);
+}
+
+static void APIENTRY lazy_glCompressedTexImage3DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage3DARB = (PFNGLCOMPRESSEDTEXIMAGE3DARBPROC)gladLazyResolve("glCompressedTexImage3DARB");
+	glad_glCompressedTexImage3DARB(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void APIENTRY lazy_glCompressedTexImage2DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage2DARB = (PFNGLCOMPRESSEDTEXIMAGE2DARBPROC)gladLazyResolve("glCompressedTexImage2DARB");
+	glad_glCompressedTexImage2DARB(target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static void APIENTRY lazy_glCompressedTexImage1DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage1DARB = (PFNGLCOMPRESSEDTEXIMAGE1DARBPROC)gladLazyResolve("glCompressedTexImage1DARB");
+	glad_glCompressedTexImage1DARB(target, level, internalformat, width, border, imageSize, data);
+}
+
+static void APIENTRY lazy_glCompressedTexSubImage3DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage3DARB = (PFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC)gladLazyResolve("glCompressedTexSubImage3DARB");
+	glad_glCompressedTexSubImage3DARB(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void APIENTRY lazy_glCompressedTexSubImage2DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage2DARB = (PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)gladLazyResolve("glCompressedTexSubImage2DARB");
+	glad_glCompressedTexSubImage2DARB(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void APIENTRY lazy_glCompressedTexSubImage1DARB(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage1DARB = (PFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC)gladLazyResolve("glCompressedTexSubImage1DARB");
+	glad_glCompressedTexSubImage1DARB(target, level, xoffset, width, format, imageSize, data);
+}
+
+static void APIENTRY lazy_glGetCompressedTexImageARB(GLenum target, GLint level, void *img) {
+	glad_glGetCompressedTexImageARB = (PFNGLGETCOMPRESSEDTEXIMAGEARBPROC)gladLazyResolve("glGetCompressedTexImageARB");
+	glad_glGetCompressedTexImageARB(target, level, img);
+}
+
+static void APIENTRY lazy_glLoadTransposeMatrixfARB(const GLfloat *m) {
+	glad_glLoadTransposeMatrixfARB = (PFNGLLOADTRANSPOSEMATRIXFARBPROC)gladLazyResolve("glLoadTransposeMatrixfARB");
+	glad_glLoadTransposeMatrixfARB(m);
+}
+
+static void APIENTRY lazy_glLoadTransposeMatrixdARB(const GLdouble *m) {
+	glad_glLoadTransposeMatrixdARB = (PFNGLLOADTRANSPOSEMATRIXDARBPROC)gladLazyResolve("glLoadTransposeMatrixdARB");
+	glad_glLoadTransposeMatrixdARB(m);
+}
+
+static void APIENTRY lazy_glMultTransposeMatrixfARB(const GLfloat *m) {
+	glad_glMultTransposeMatrixfARB = (PFNGLMULTTRANSPOSEMATRIXFARBPROC)gladLazyResolve("glMultTransposeMatrixfARB");
+	glad_glMultTransposeMatrixfARB(m);
+}
+
+static void APIENTRY lazy_glMultTransposeMatrixdARB(const GLdouble *m) {
+	glad_glMultTransposeMatrixdARB = (PFNGLMULTTRANSPOSEMATRIXDARBPROC)gladLazyResolve("glMultTransposeMatrixdARB");
+	glad_glMultTransposeMatrixdARB(m);
+}
+
+static void APIENTRY lazy_glWeightbvARB(GLint size, const GLbyte *weights) {
+	glad_glWeightbvARB = (PFNGLWEIGHTBVARBPROC)gladLazyResolve("glWeightbvARB");
+	glad_glWeightbvARB(size, weights);
+}
+
+static void APIENTRY lazy_glWeightsvARB(GLint size, const GLshort *weights) {
+	glad_glWeightsvARB = (PFNGLWEIGHTSVARBPROC)gladLazyResolve("glWeightsvARB");
+	glad_glWeightsvARB(size, weights);
+}
+
+static void APIENTRY lazy_glWeightivARB(GLint size, const GLint *weights) {
+	glad_glWeightivARB = (PFNGLWEIGHTIVARBPROC)gladLazyResolve("glWeightivARB");
+	glad_glWeightivARB(size, weights);
+}
+
+static void APIENTRY lazy_glWeightfvARB(GLint size, const GLfloat *weights) {
+	glad_glWeightfvARB = (PFNGLWEIGHTFVARBPROC)gladLazyResolve("glWeightfvARB");
+	glad_glWeightfvARB(size, weights);
+}
+
+static void APIENTRY lazy_glWeightdvARB(GLint size, const GLdouble *weights) {
+	glad_glWeightdvARB = (PFNGLWEIGHTDVARBPROC)gladLazyResolve("glWeightdvARB");
+	glad_glWeightdvARB(size, weights);
+}
+
+static void APIENTRY lazy_glWeightubvARB(GLint size, const GLubyte *weights) {
+	glad_glWeightubvARB = (PFNGLWEIGHTUBVARBPROC)gladLazyResolve("glWeightubvARB");
+	glad_glWeightubvARB(size, weights);
+}
+
+static void APIENTRY lazy_glWeightusvARB(GLint size, const GLushort *weights) {
+	glad_glWeightusvARB = (PFNGLWEIGHTUSVARBPROC)gladLazyResolve("glWeightusvARB");
+	glad_glWeightusvARB(size, weights);
+}
+
+static void APIENTRY lazy_glWeightuivARB(GLint size, const GLuint *weights) {
+	glad_glWeightuivARB = (PFNGLWEIGHTUIVARBPROC)gladLazyResolve("glWeightuivARB");
+	glad_glWeightuivARB(size, weights);
+}
+
+static void APIENTRY lazy_glWeightPointerARB(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glWeightPointerARB = (PFNGLWEIGHTPOINTERARBPROC)gladLazyResolve("glWeightPointerARB");
+	glad_glWeightPointerARB(size, type, stride, pointer);
+}
+
+static void APIENTRY lazy_glVertexBlendARB(GLint count) {
+	glad_glVertexBlendARB = (PFNGLVERTEXBLENDARBPROC)gladLazyResolve("glVertexBlendARB");
+	glad_glVertexBlendARB(count);
+}
+
+static void APIENTRY lazy_glBindBufferARB(GLenum target, GLuint buffer) {
+	glad_glBindBufferARB = (PFNGLBINDBUFFERARBPROC)gladLazyResolve("glBindBufferARB");
+	glad_glBindBufferARB(target, buffer);
+}
+
+static void APIENTRY lazy_glDeleteBuffersARB(GLsizei n, const GLuint *buffers) {
+	glad_glDeleteBuffersARB = (PFNGLDELETEBUFFERSARBPROC)gladLazyResolve("glDeleteBuffersARB");
+	glad_glDeleteBuffersARB(n, buffers);
+}
+
+static void APIENTRY lazy_glGenBuffersARB(GLsizei n, GLuint *buffers) {
+	glad_glGenBuffersARB = (PFNGLGENBUFFERSARBPROC)gladLazyResolve("glGenBuffersARB");
+	glad_glGenBuffersARB(n, buffers);
+}
+
+static GLboolean APIENTRY lazy_glIsBufferARB(GLuint buffer) {
+	glad_glIsBufferARB = (PFNGLISBUFFERARBPROC)gladLazyResolve("glIsBufferARB");
+	return glad_glIsBufferARB(buffer);
+}
+
+static void APIENTRY lazy_glBufferDataARB(GLenum target, GLsizeiptrARB size, const void *data, GLenum usage) {
+	glad_glBufferDataARB = (PFNGLBUFFERDATAARBPROC)gladLazyResolve("glBufferDataARB");
+	glad_glBufferDataARB(target, size, data, usage);
+}
+
+static void APIENTRY lazy_glBufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, const void *data) {
+	glad_glBufferSubDataARB = (PFNGLBUFFERSUBDATAARBPROC)gladLazyResolve("glBufferSubDataARB");
+	glad_glBufferSubDataARB(target, offset, size, data);
+}
+
+static void APIENTRY lazy_glGetBufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, void *data) {
+	glad_glGetBufferSubDataARB = (PFNGLGETBUFFERSUBDATAARBPROC)gladLazyResolve("glGetBufferSubDataARB");
+	glad_glGetBufferSubDataARB(target, offset, size, data);
+}
+
+static void * APIENTRY lazy_glMapBufferARB(GLenum target, GLenum access) {
+	glad_glMapBufferARB = (PFNGLMAPBUFFERARBPROC)gladLazyResolve("glMapBufferARB");
+	return glad_glMapBufferARB(target, access);
+}
+
+static GLboolean APIENTRY lazy_glUnmapBufferARB(GLenum target) {
+	glad_glUnmapBufferARB = (PFNGLUNMAPBUFFERARBPROC)gladLazyResolve("glUnmapBufferARB");
+	return glad_glUnmapBufferARB(target);
+}
+
+static void APIENTRY lazy_glGetBufferParameterivARB(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetBufferParameterivARB = (PFNGLGETBUFFERPARAMETERIVARBPROC)gladLazyResolve("glGetBufferParameterivARB");
+	glad_glGetBufferParameterivARB(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetBufferPointervARB(GLenum target, GLenum pname, void **params) {
+	glad_glGetBufferPointervARB = (PFNGLGETBUFFERPOINTERVARBPROC)gladLazyResolve("glGetBufferPointervARB");
+	glad_glGetBufferPointervARB(target, pname, params);
+}
+
+static void APIENTRY lazy_glVertexAttrib1dARB(GLuint index, GLdouble x) {
+	glad_glVertexAttrib1dARB = (PFNGLVERTEXATTRIB1DARBPROC)gladLazyResolve("glVertexAttrib1dARB");
+	glad_glVertexAttrib1dARB(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttrib1dvARB(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib1dvARB = (PFNGLVERTEXATTRIB1DVARBPROC)gladLazyResolve("glVertexAttrib1dvARB");
+	glad_glVertexAttrib1dvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib1fARB(GLuint index, GLfloat x) {
+	glad_glVertexAttrib1fARB = (PFNGLVERTEXATTRIB1FARBPROC)gladLazyResolve("glVertexAttrib1fARB");
+	glad_glVertexAttrib1fARB(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttrib1fvARB(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib1fvARB = (PFNGLVERTEXATTRIB1FVARBPROC)gladLazyResolve("glVertexAttrib1fvARB");
+	glad_glVertexAttrib1fvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib1sARB(GLuint index, GLshort x) {
+	glad_glVertexAttrib1sARB = (PFNGLVERTEXATTRIB1SARBPROC)gladLazyResolve("glVertexAttrib1sARB");
+	glad_glVertexAttrib1sARB(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttrib1svARB(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib1svARB = (PFNGLVERTEXATTRIB1SVARBPROC)gladLazyResolve("glVertexAttrib1svARB");
+	glad_glVertexAttrib1svARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib2dARB(GLuint index, GLdouble x, GLdouble y) {
+	glad_glVertexAttrib2dARB = (PFNGLVERTEXATTRIB2DARBPROC)gladLazyResolve("glVertexAttrib2dARB");
+	glad_glVertexAttrib2dARB(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttrib2dvARB(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib2dvARB = (PFNGLVERTEXATTRIB2DVARBPROC)gladLazyResolve("glVertexAttrib2dvARB");
+	glad_glVertexAttrib2dvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib2fARB(GLuint index, GLfloat x, GLfloat y) {
+	glad_glVertexAttrib2fARB = (PFNGLVERTEXATTRIB2FARBPROC)gladLazyResolve("glVertexAttrib2fARB");
+	glad_glVertexAttrib2fARB(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttrib2fvARB(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib2fvARB = (PFNGLVERTEXATTRIB2FVARBPROC)gladLazyResolve("glVertexAttrib2fvARB");
+	glad_glVertexAttrib2fvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib2sARB(GLuint index, GLshort x, GLshort y) {
+	glad_glVertexAttrib2sARB = (PFNGLVERTEXATTRIB2SARBPROC)gladLazyResolve("glVertexAttrib2sARB");
+	glad_glVertexAttrib2sARB(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttrib2svARB(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib2svARB = (PFNGLVERTEXATTRIB2SVARBPROC)gladLazyResolve("glVertexAttrib2svARB");
+	glad_glVertexAttrib2svARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib3dARB(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexAttrib3dARB = (PFNGLVERTEXATTRIB3DARBPROC)gladLazyResolve("glVertexAttrib3dARB");
+	glad_glVertexAttrib3dARB(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttrib3dvARB(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib3dvARB = (PFNGLVERTEXATTRIB3DVARBPROC)gladLazyResolve("glVertexAttrib3dvARB");
+	glad_glVertexAttrib3dvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib3fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertexAttrib3fARB = (PFNGLVERTEXATTRIB3FARBPROC)gladLazyResolve("glVertexAttrib3fARB");
+	glad_glVertexAttrib3fARB(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttrib3fvARB(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib3fvARB = (PFNGLVERTEXATTRIB3FVARBPROC)gladLazyResolve("glVertexAttrib3fvARB");
+	glad_glVertexAttrib3fvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib3sARB(GLuint index, GLshort x, GLshort y, GLshort z) {
+	glad_glVertexAttrib3sARB = (PFNGLVERTEXATTRIB3SARBPROC)gladLazyResolve("glVertexAttrib3sARB");
+	glad_glVertexAttrib3sARB(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttrib3svARB(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib3svARB = (PFNGLVERTEXATTRIB3SVARBPROC)gladLazyResolve("glVertexAttrib3svARB");
+	glad_glVertexAttrib3svARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4NbvARB(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4NbvARB = (PFNGLVERTEXATTRIB4NBVARBPROC)gladLazyResolve("glVertexAttrib4NbvARB");
+	glad_glVertexAttrib4NbvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4NivARB(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4NivARB = (PFNGLVERTEXATTRIB4NIVARBPROC)gladLazyResolve("glVertexAttrib4NivARB");
+	glad_glVertexAttrib4NivARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4NsvARB(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4NsvARB = (PFNGLVERTEXATTRIB4NSVARBPROC)gladLazyResolve("glVertexAttrib4NsvARB");
+	glad_glVertexAttrib4NsvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4NubARB(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	glad_glVertexAttrib4NubARB = (PFNGLVERTEXATTRIB4NUBARBPROC)gladLazyResolve("glVertexAttrib4NubARB");
+	glad_glVertexAttrib4NubARB(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttrib4NubvARB(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4NubvARB = (PFNGLVERTEXATTRIB4NUBVARBPROC)gladLazyResolve("glVertexAttrib4NubvARB");
+	glad_glVertexAttrib4NubvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4NuivARB(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4NuivARB = (PFNGLVERTEXATTRIB4NUIVARBPROC)gladLazyResolve("glVertexAttrib4NuivARB");
+	glad_glVertexAttrib4NuivARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4NusvARB(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4NusvARB = (PFNGLVERTEXATTRIB4NUSVARBPROC)gladLazyResolve("glVertexAttrib4NusvARB");
+	glad_glVertexAttrib4NusvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4bvARB(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4bvARB = (PFNGLVERTEXATTRIB4BVARBPROC)gladLazyResolve("glVertexAttrib4bvARB");
+	glad_glVertexAttrib4bvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4dARB(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexAttrib4dARB = (PFNGLVERTEXATTRIB4DARBPROC)gladLazyResolve("glVertexAttrib4dARB");
+	glad_glVertexAttrib4dARB(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttrib4dvARB(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib4dvARB = (PFNGLVERTEXATTRIB4DVARBPROC)gladLazyResolve("glVertexAttrib4dvARB");
+	glad_glVertexAttrib4dvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertexAttrib4fARB = (PFNGLVERTEXATTRIB4FARBPROC)gladLazyResolve("glVertexAttrib4fARB");
+	glad_glVertexAttrib4fARB(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttrib4fvARB(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib4fvARB = (PFNGLVERTEXATTRIB4FVARBPROC)gladLazyResolve("glVertexAttrib4fvARB");
+	glad_glVertexAttrib4fvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4ivARB(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4ivARB = (PFNGLVERTEXATTRIB4IVARBPROC)gladLazyResolve("glVertexAttrib4ivARB");
+	glad_glVertexAttrib4ivARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4sARB(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertexAttrib4sARB = (PFNGLVERTEXATTRIB4SARBPROC)gladLazyResolve("glVertexAttrib4sARB");
+	glad_glVertexAttrib4sARB(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttrib4svARB(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4svARB = (PFNGLVERTEXATTRIB4SVARBPROC)gladLazyResolve("glVertexAttrib4svARB");
+	glad_glVertexAttrib4svARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4ubvARB(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4ubvARB = (PFNGLVERTEXATTRIB4UBVARBPROC)gladLazyResolve("glVertexAttrib4ubvARB");
+	glad_glVertexAttrib4ubvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4uivARB(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4uivARB = (PFNGLVERTEXATTRIB4UIVARBPROC)gladLazyResolve("glVertexAttrib4uivARB");
+	glad_glVertexAttrib4uivARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4usvARB(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4usvARB = (PFNGLVERTEXATTRIB4USVARBPROC)gladLazyResolve("glVertexAttrib4usvARB");
+	glad_glVertexAttrib4usvARB(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribPointerARB(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribPointerARB = (PFNGLVERTEXATTRIBPOINTERARBPROC)gladLazyResolve("glVertexAttribPointerARB");
+	glad_glVertexAttribPointerARB(index, size, type, normalized, stride, pointer);
+}
+
+static void APIENTRY lazy_glEnableVertexAttribArrayARB(GLuint index) {
+	glad_glEnableVertexAttribArrayARB = (PFNGLENABLEVERTEXATTRIBARRAYARBPROC)gladLazyResolve("glEnableVertexAttribArrayARB");
+	glad_glEnableVertexAttribArrayARB(index);
+}
+
+static void APIENTRY lazy_glDisableVertexAttribArrayARB(GLuint index) {
+	glad_glDisableVertexAttribArrayARB = (PFNGLDISABLEVERTEXATTRIBARRAYARBPROC)gladLazyResolve("glDisableVertexAttribArrayARB");
+	glad_glDisableVertexAttribArrayARB(index);
+}
+
+static void APIENTRY lazy_glGetVertexAttribdvARB(GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetVertexAttribdvARB = (PFNGLGETVERTEXATTRIBDVARBPROC)gladLazyResolve("glGetVertexAttribdvARB");
+	glad_glGetVertexAttribdvARB(index, pname, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribfvARB(GLuint index, GLenum pname, GLfloat *params) {
+	glad_glGetVertexAttribfvARB = (PFNGLGETVERTEXATTRIBFVARBPROC)gladLazyResolve("glGetVertexAttribfvARB");
+	glad_glGetVertexAttribfvARB(index, pname, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribivARB(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribivARB = (PFNGLGETVERTEXATTRIBIVARBPROC)gladLazyResolve("glGetVertexAttribivARB");
+	glad_glGetVertexAttribivARB(index, pname, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribPointervARB(GLuint index, GLenum pname, void **pointer) {
+	glad_glGetVertexAttribPointervARB = (PFNGLGETVERTEXATTRIBPOINTERVARBPROC)gladLazyResolve("glGetVertexAttribPointervARB");
+	glad_glGetVertexAttribPointervARB(index, pname, pointer);
+}
+
+static void APIENTRY lazy_glBindAttribLocationARB(GLhandleARB programObj, GLuint index, const GLcharARB *name) {
+	glad_glBindAttribLocationARB = (PFNGLBINDATTRIBLOCATIONARBPROC)gladLazyResolve("glBindAttribLocationARB");
+	glad_glBindAttribLocationARB(programObj, index, name);
+}
+
+static void APIENTRY lazy_glGetActiveAttribARB(GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei *length, GLint *size, GLenum *type, GLcharARB *name) {
+	glad_glGetActiveAttribARB = (PFNGLGETACTIVEATTRIBARBPROC)gladLazyResolve("glGetActiveAttribARB");
+	glad_glGetActiveAttribARB(programObj, index, maxLength, length, size, type, name);
+}
+
+static GLint APIENTRY lazy_glGetAttribLocationARB(GLhandleARB programObj, const GLcharARB *name) {
+	glad_glGetAttribLocationARB = (PFNGLGETATTRIBLOCATIONARBPROC)gladLazyResolve("glGetAttribLocationARB");
+	return glad_glGetAttribLocationARB(programObj, name);
+}
+
+static void APIENTRY lazy_glDepthRangeArraydvNV(GLuint first, GLsizei count, const GLdouble *v) {
+	glad_glDepthRangeArraydvNV = (PFNGLDEPTHRANGEARRAYDVNVPROC)gladLazyResolve("glDepthRangeArraydvNV");
+	glad_glDepthRangeArraydvNV(first, count, v);
+}
+
+static void APIENTRY lazy_glDepthRangeIndexeddNV(GLuint index, GLdouble n, GLdouble f) {
+	glad_glDepthRangeIndexeddNV = (PFNGLDEPTHRANGEINDEXEDDNVPROC)gladLazyResolve("glDepthRangeIndexeddNV");
+	glad_glDepthRangeIndexeddNV(index, n, f);
+}
+
+static void APIENTRY lazy_glWindowPos2dARB(GLdouble x, GLdouble y) {
+	glad_glWindowPos2dARB = (PFNGLWINDOWPOS2DARBPROC)gladLazyResolve("glWindowPos2dARB");
+	glad_glWindowPos2dARB(x, y);
+}
+
+static void APIENTRY lazy_glWindowPos2dvARB(const GLdouble *v) {
+	glad_glWindowPos2dvARB = (PFNGLWINDOWPOS2DVARBPROC)gladLazyResolve("glWindowPos2dvARB");
+	glad_glWindowPos2dvARB(v);
+}
+
+static void APIENTRY lazy_glWindowPos2fARB(GLfloat x, GLfloat y) {
+	glad_glWindowPos2fARB = (PFNGLWINDOWPOS2FARBPROC)gladLazyResolve("glWindowPos2fARB");
+	glad_glWindowPos2fARB(x, y);
+}
+
+static void APIENTRY lazy_glWindowPos2fvARB(const GLfloat *v) {
+	glad_glWindowPos2fvARB = (PFNGLWINDOWPOS2FVARBPROC)gladLazyResolve("glWindowPos2fvARB");
+	glad_glWindowPos2fvARB(v);
+}
+
+static void APIENTRY lazy_glWindowPos2iARB(GLint x, GLint y) {
+	glad_glWindowPos2iARB = (PFNGLWINDOWPOS2IARBPROC)gladLazyResolve("glWindowPos2iARB");
+	glad_glWindowPos2iARB(x, y);
+}
+
+static void APIENTRY lazy_glWindowPos2ivARB(const GLint *v) {
+	glad_glWindowPos2ivARB = (PFNGLWINDOWPOS2IVARBPROC)gladLazyResolve("glWindowPos2ivARB");
+	glad_glWindowPos2ivARB(v);
+}
+
+static void APIENTRY lazy_glWindowPos2sARB(GLshort x, GLshort y) {
+	glad_glWindowPos2sARB = (PFNGLWINDOWPOS2SARBPROC)gladLazyResolve("glWindowPos2sARB");
+	glad_glWindowPos2sARB(x, y);
+}
+
+static void APIENTRY lazy_glWindowPos2svARB(const GLshort *v) {
+	glad_glWindowPos2svARB = (PFNGLWINDOWPOS2SVARBPROC)gladLazyResolve("glWindowPos2svARB");
+	glad_glWindowPos2svARB(v);
+}
+
+static void APIENTRY lazy_glWindowPos3dARB(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glWindowPos3dARB = (PFNGLWINDOWPOS3DARBPROC)gladLazyResolve("glWindowPos3dARB");
+	glad_glWindowPos3dARB(x, y, z);
+}
+
+static void APIENTRY lazy_glWindowPos3dvARB(const GLdouble *v) {
+	glad_glWindowPos3dvARB = (PFNGLWINDOWPOS3DVARBPROC)gladLazyResolve("glWindowPos3dvARB");
+	glad_glWindowPos3dvARB(v);
+}
+
+static void APIENTRY lazy_glWindowPos3fARB(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glWindowPos3fARB = (PFNGLWINDOWPOS3FARBPROC)gladLazyResolve("glWindowPos3fARB");
+	glad_glWindowPos3fARB(x, y, z);
+}
+
+static void APIENTRY lazy_glWindowPos3fvARB(const GLfloat *v) {
+	glad_glWindowPos3fvARB = (PFNGLWINDOWPOS3FVARBPROC)gladLazyResolve("glWindowPos3fvARB");
+	glad_glWindowPos3fvARB(v);
+}
+
+static void APIENTRY lazy_glWindowPos3iARB(GLint x, GLint y, GLint z) {
+	glad_glWindowPos3iARB = (PFNGLWINDOWPOS3IARBPROC)gladLazyResolve("glWindowPos3iARB");
+	glad_glWindowPos3iARB(x, y, z);
+}
+
+static void APIENTRY lazy_glWindowPos3ivARB(const GLint *v) {
+	glad_glWindowPos3ivARB = (PFNGLWINDOWPOS3IVARBPROC)gladLazyResolve("glWindowPos3ivARB");
+	glad_glWindowPos3ivARB(v);
+}
+
+static void APIENTRY lazy_glWindowPos3sARB(GLshort x, GLshort y, GLshort z) {
+	glad_glWindowPos3sARB = (PFNGLWINDOWPOS3SARBPROC)gladLazyResolve("glWindowPos3sARB");
+	glad_glWindowPos3sARB(x, y, z);
+}
+
+static void APIENTRY lazy_glWindowPos3svARB(const GLshort *v) {
+	glad_glWindowPos3svARB = (PFNGLWINDOWPOS3SVARBPROC)gladLazyResolve("glWindowPos3svARB");
+	glad_glWindowPos3svARB(v);
+}
+
+static void APIENTRY lazy_glDrawBuffersATI(GLsizei n, const GLenum *bufs) {
+	glad_glDrawBuffersATI = (PFNGLDRAWBUFFERSATIPROC)gladLazyResolve("glDrawBuffersATI");
+	glad_glDrawBuffersATI(n, bufs);
+}
+
+static void APIENTRY lazy_glElementPointerATI(GLenum type, const void *pointer) {
+	glad_glElementPointerATI = (PFNGLELEMENTPOINTERATIPROC)gladLazyResolve("glElementPointerATI");
+	glad_glElementPointerATI(type, pointer);
+}
+
+static void APIENTRY lazy_glDrawElementArrayATI(GLenum mode, GLsizei count) {
+	glad_glDrawElementArrayATI = (PFNGLDRAWELEMENTARRAYATIPROC)gladLazyResolve("glDrawElementArrayATI");
+	glad_glDrawElementArrayATI(mode, count);
+}
+
+static void APIENTRY lazy_glDrawRangeElementArrayATI(GLenum mode, GLuint start, GLuint end, GLsizei count) {
+	glad_glDrawRangeElementArrayATI = (PFNGLDRAWRANGEELEMENTARRAYATIPROC)gladLazyResolve("glDrawRangeElementArrayATI");
+	glad_glDrawRangeElementArrayATI(mode, start, end, count);
+}
+
+static void APIENTRY lazy_glTexBumpParameterivATI(GLenum pname, const GLint *param) {
+	glad_glTexBumpParameterivATI = (PFNGLTEXBUMPPARAMETERIVATIPROC)gladLazyResolve("glTexBumpParameterivATI");
+	glad_glTexBumpParameterivATI(pname, param);
+}
+
+static void APIENTRY lazy_glTexBumpParameterfvATI(GLenum pname, const GLfloat *param) {
+	glad_glTexBumpParameterfvATI = (PFNGLTEXBUMPPARAMETERFVATIPROC)gladLazyResolve("glTexBumpParameterfvATI");
+	glad_glTexBumpParameterfvATI(pname, param);
+}
+
+static void APIENTRY lazy_glGetTexBumpParameterivATI(GLenum pname, GLint *param) {
+	glad_glGetTexBumpParameterivATI = (PFNGLGETTEXBUMPPARAMETERIVATIPROC)gladLazyResolve("glGetTexBumpParameterivATI");
+	glad_glGetTexBumpParameterivATI(pname, param);
+}
+
+static void APIENTRY lazy_glGetTexBumpParameterfvATI(GLenum pname, GLfloat *param) {
+	glad_glGetTexBumpParameterfvATI = (PFNGLGETTEXBUMPPARAMETERFVATIPROC)gladLazyResolve("glGetTexBumpParameterfvATI");
+	glad_glGetTexBumpParameterfvATI(pname, param);
+}
+
+static GLuint APIENTRY lazy_glGenFragmentShadersATI(GLuint range) {
+	glad_glGenFragmentShadersATI = (PFNGLGENFRAGMENTSHADERSATIPROC)gladLazyResolve("glGenFragmentShadersATI");
+	return glad_glGenFragmentShadersATI(range);
+}
+
+static void APIENTRY lazy_glBindFragmentShaderATI(GLuint id) {
+	glad_glBindFragmentShaderATI = (PFNGLBINDFRAGMENTSHADERATIPROC)gladLazyResolve("glBindFragmentShaderATI");
+	glad_glBindFragmentShaderATI(id);
+}
+
+static void APIENTRY lazy_glDeleteFragmentShaderATI(GLuint id) {
+	glad_glDeleteFragmentShaderATI = (PFNGLDELETEFRAGMENTSHADERATIPROC)gladLazyResolve("glDeleteFragmentShaderATI");
+	glad_glDeleteFragmentShaderATI(id);
+}
+
+static void APIENTRY lazy_glBeginFragmentShaderATI(void) {
+	glad_glBeginFragmentShaderATI = (PFNGLBEGINFRAGMENTSHADERATIPROC)gladLazyResolve("glBeginFragmentShaderATI");
+	glad_glBeginFragmentShaderATI();
+}
+
+static void APIENTRY lazy_glEndFragmentShaderATI(void) {
+	glad_glEndFragmentShaderATI = (PFNGLENDFRAGMENTSHADERATIPROC)gladLazyResolve("glEndFragmentShaderATI");
+	glad_glEndFragmentShaderATI();
+}
+
+static void APIENTRY lazy_glPassTexCoordATI(GLuint dst, GLuint coord, GLenum swizzle) {
+	glad_glPassTexCoordATI = (PFNGLPASSTEXCOORDATIPROC)gladLazyResolve("glPassTexCoordATI");
+	glad_glPassTexCoordATI(dst, coord, swizzle);
+}
+
+static void APIENTRY lazy_glSampleMapATI(GLuint dst, GLuint interp, GLenum swizzle) {
+	glad_glSampleMapATI = (PFNGLSAMPLEMAPATIPROC)gladLazyResolve("glSampleMapATI");
+	glad_glSampleMapATI(dst, interp, swizzle);
+}
+
+static void APIENTRY lazy_glColorFragmentOp1ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod) {
+	glad_glColorFragmentOp1ATI = (PFNGLCOLORFRAGMENTOP1ATIPROC)gladLazyResolve("glColorFragmentOp1ATI");
+	glad_glColorFragmentOp1ATI(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod);
+}
+
+static void APIENTRY lazy_glColorFragmentOp2ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod) {
+	glad_glColorFragmentOp2ATI = (PFNGLCOLORFRAGMENTOP2ATIPROC)gladLazyResolve("glColorFragmentOp2ATI");
+	glad_glColorFragmentOp2ATI(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod);
+}
+
+static void APIENTRY lazy_glColorFragmentOp3ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod) {
+	glad_glColorFragmentOp3ATI = (PFNGLCOLORFRAGMENTOP3ATIPROC)gladLazyResolve("glColorFragmentOp3ATI");
+	glad_glColorFragmentOp3ATI(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod);
+}
+
+static void APIENTRY lazy_glAlphaFragmentOp1ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod) {
+	glad_glAlphaFragmentOp1ATI = (PFNGLALPHAFRAGMENTOP1ATIPROC)gladLazyResolve("glAlphaFragmentOp1ATI");
+	glad_glAlphaFragmentOp1ATI(op, dst, dstMod, arg1, arg1Rep, arg1Mod);
+}
+
+static void APIENTRY lazy_glAlphaFragmentOp2ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod) {
+	glad_glAlphaFragmentOp2ATI = (PFNGLALPHAFRAGMENTOP2ATIPROC)gladLazyResolve("glAlphaFragmentOp2ATI");
+	glad_glAlphaFragmentOp2ATI(op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod);
+}
+
+static void APIENTRY lazy_glAlphaFragmentOp3ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod) {
+	glad_glAlphaFragmentOp3ATI = (PFNGLALPHAFRAGMENTOP3ATIPROC)gladLazyResolve("glAlphaFragmentOp3ATI");
+	glad_glAlphaFragmentOp3ATI(op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod);
+}
+
+static void APIENTRY lazy_glSetFragmentShaderConstantATI(GLuint dst, const GLfloat *value) {
+	glad_glSetFragmentShaderConstantATI = (PFNGLSETFRAGMENTSHADERCONSTANTATIPROC)gladLazyResolve("glSetFragmentShaderConstantATI");
+	glad_glSetFragmentShaderConstantATI(dst, value);
+}
+
+static void * APIENTRY lazy_glMapObjectBufferATI(GLuint buffer) {
+	glad_glMapObjectBufferATI = (PFNGLMAPOBJECTBUFFERATIPROC)gladLazyResolve("glMapObjectBufferATI");
+	return glad_glMapObjectBufferATI(buffer);
+}
+
+static void APIENTRY lazy_glUnmapObjectBufferATI(GLuint buffer) {
+	glad_glUnmapObjectBufferATI = (PFNGLUNMAPOBJECTBUFFERATIPROC)gladLazyResolve("glUnmapObjectBufferATI");
+	glad_glUnmapObjectBufferATI(buffer);
+}
+
+static void APIENTRY lazy_glPNTrianglesiATI(GLenum pname, GLint param) {
+	glad_glPNTrianglesiATI = (PFNGLPNTRIANGLESIATIPROC)gladLazyResolve("glPNTrianglesiATI");
+	glad_glPNTrianglesiATI(pname, param);
+}
+
+static void APIENTRY lazy_glPNTrianglesfATI(GLenum pname, GLfloat param) {
+	glad_glPNTrianglesfATI = (PFNGLPNTRIANGLESFATIPROC)gladLazyResolve("glPNTrianglesfATI");
+	glad_glPNTrianglesfATI(pname, param);
+}
+
+static void APIENTRY lazy_glStencilOpSeparateATI(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	glad_glStencilOpSeparateATI = (PFNGLSTENCILOPSEPARATEATIPROC)gladLazyResolve("glStencilOpSeparateATI");
+	glad_glStencilOpSeparateATI(face, sfail, dpfail, dppass);
+}
+
+static void APIENTRY lazy_glStencilFuncSeparateATI(GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask) {
+	glad_glStencilFuncSeparateATI = (PFNGLSTENCILFUNCSEPARATEATIPROC)gladLazyResolve("glStencilFuncSeparateATI");
+	glad_glStencilFuncSeparateATI(frontfunc, backfunc, ref, mask);
+}
+
+static GLuint APIENTRY lazy_glNewObjectBufferATI(GLsizei size, const void *pointer, GLenum usage) {
+	glad_glNewObjectBufferATI = (PFNGLNEWOBJECTBUFFERATIPROC)gladLazyResolve("glNewObjectBufferATI");
+	return glad_glNewObjectBufferATI(size, pointer, usage);
+}
+
+static GLboolean APIENTRY lazy_glIsObjectBufferATI(GLuint buffer) {
+	glad_glIsObjectBufferATI = (PFNGLISOBJECTBUFFERATIPROC)gladLazyResolve("glIsObjectBufferATI");
+	return glad_glIsObjectBufferATI(buffer);
+}
+
+static void APIENTRY lazy_glUpdateObjectBufferATI(GLuint buffer, GLuint offset, GLsizei size, const void *pointer, GLenum preserve) {
+	glad_glUpdateObjectBufferATI = (PFNGLUPDATEOBJECTBUFFERATIPROC)gladLazyResolve("glUpdateObjectBufferATI");
+	glad_glUpdateObjectBufferATI(buffer, offset, size, pointer, preserve);
+}
+
+static void APIENTRY lazy_glGetObjectBufferfvATI(GLuint buffer, GLenum pname, GLfloat *params) {
+	glad_glGetObjectBufferfvATI = (PFNGLGETOBJECTBUFFERFVATIPROC)gladLazyResolve("glGetObjectBufferfvATI");
+	glad_glGetObjectBufferfvATI(buffer, pname, params);
+}
+
+static void APIENTRY lazy_glGetObjectBufferivATI(GLuint buffer, GLenum pname, GLint *params) {
+	glad_glGetObjectBufferivATI = (PFNGLGETOBJECTBUFFERIVATIPROC)gladLazyResolve("glGetObjectBufferivATI");
+	glad_glGetObjectBufferivATI(buffer, pname, params);
+}
+
+static void APIENTRY lazy_glFreeObjectBufferATI(GLuint buffer) {
+	glad_glFreeObjectBufferATI = (PFNGLFREEOBJECTBUFFERATIPROC)gladLazyResolve("glFreeObjectBufferATI");
+	glad_glFreeObjectBufferATI(buffer);
+}
+
+static void APIENTRY lazy_glArrayObjectATI(GLenum array, GLint size, GLenum type, GLsizei stride, GLuint buffer, GLuint offset) {
+	glad_glArrayObjectATI = (PFNGLARRAYOBJECTATIPROC)gladLazyResolve("glArrayObjectATI");
+	glad_glArrayObjectATI(array, size, type, stride, buffer, offset);
+}
+
+static void APIENTRY lazy_glGetArrayObjectfvATI(GLenum array, GLenum pname, GLfloat *params) {
+	glad_glGetArrayObjectfvATI = (PFNGLGETARRAYOBJECTFVATIPROC)gladLazyResolve("glGetArrayObjectfvATI");
+	glad_glGetArrayObjectfvATI(array, pname, params);
+}
+
+static void APIENTRY lazy_glGetArrayObjectivATI(GLenum array, GLenum pname, GLint *params) {
+	glad_glGetArrayObjectivATI = (PFNGLGETARRAYOBJECTIVATIPROC)gladLazyResolve("glGetArrayObjectivATI");
+	glad_glGetArrayObjectivATI(array, pname, params);
+}
+
+static void APIENTRY lazy_glVariantArrayObjectATI(GLuint id, GLenum type, GLsizei stride, GLuint buffer, GLuint offset) {
+	glad_glVariantArrayObjectATI = (PFNGLVARIANTARRAYOBJECTATIPROC)gladLazyResolve("glVariantArrayObjectATI");
+	glad_glVariantArrayObjectATI(id, type, stride, buffer, offset);
+}
+
+static void APIENTRY lazy_glGetVariantArrayObjectfvATI(GLuint id, GLenum pname, GLfloat *params) {
+	glad_glGetVariantArrayObjectfvATI = (PFNGLGETVARIANTARRAYOBJECTFVATIPROC)gladLazyResolve("glGetVariantArrayObjectfvATI");
+	glad_glGetVariantArrayObjectfvATI(id, pname, params);
+}
+
+static void APIENTRY lazy_glGetVariantArrayObjectivATI(GLuint id, GLenum pname, GLint *params) {
+	glad_glGetVariantArrayObjectivATI = (PFNGLGETVARIANTARRAYOBJECTIVATIPROC)gladLazyResolve("glGetVariantArrayObjectivATI");
+	glad_glGetVariantArrayObjectivATI(id, pname, params);
+}
+
+static void APIENTRY lazy_glVertexAttribArrayObjectATI(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLuint buffer, GLuint offset) {
+	glad_glVertexAttribArrayObjectATI = (PFNGLVERTEXATTRIBARRAYOBJECTATIPROC)gladLazyResolve("glVertexAttribArrayObjectATI");
+	glad_glVertexAttribArrayObjectATI(index, size, type, normalized, stride, buffer, offset);
+}
+
+static void APIENTRY lazy_glGetVertexAttribArrayObjectfvATI(GLuint index, GLenum pname, GLfloat *params) {
+	glad_glGetVertexAttribArrayObjectfvATI = (PFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC)gladLazyResolve("glGetVertexAttribArrayObjectfvATI");
+	glad_glGetVertexAttribArrayObjectfvATI(index, pname, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribArrayObjectivATI(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribArrayObjectivATI = (PFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC)gladLazyResolve("glGetVertexAttribArrayObjectivATI");
+	glad_glGetVertexAttribArrayObjectivATI(index, pname, params);
+}
+
+static void APIENTRY lazy_glVertexStream1sATI(GLenum stream, GLshort x) {
+	glad_glVertexStream1sATI = (PFNGLVERTEXSTREAM1SATIPROC)gladLazyResolve("glVertexStream1sATI");
+	glad_glVertexStream1sATI(stream, x);
+}
+
+static void APIENTRY lazy_glVertexStream1svATI(GLenum stream, const GLshort *coords) {
+	glad_glVertexStream1svATI = (PFNGLVERTEXSTREAM1SVATIPROC)gladLazyResolve("glVertexStream1svATI");
+	glad_glVertexStream1svATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream1iATI(GLenum stream, GLint x) {
+	glad_glVertexStream1iATI = (PFNGLVERTEXSTREAM1IATIPROC)gladLazyResolve("glVertexStream1iATI");
+	glad_glVertexStream1iATI(stream, x);
+}
+
+static void APIENTRY lazy_glVertexStream1ivATI(GLenum stream, const GLint *coords) {
+	glad_glVertexStream1ivATI = (PFNGLVERTEXSTREAM1IVATIPROC)gladLazyResolve("glVertexStream1ivATI");
+	glad_glVertexStream1ivATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream1fATI(GLenum stream, GLfloat x) {
+	glad_glVertexStream1fATI = (PFNGLVERTEXSTREAM1FATIPROC)gladLazyResolve("glVertexStream1fATI");
+	glad_glVertexStream1fATI(stream, x);
+}
+
+static void APIENTRY lazy_glVertexStream1fvATI(GLenum stream, const GLfloat *coords) {
+	glad_glVertexStream1fvATI = (PFNGLVERTEXSTREAM1FVATIPROC)gladLazyResolve("glVertexStream1fvATI");
+	glad_glVertexStream1fvATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream1dATI(GLenum stream, GLdouble x) {
+	glad_glVertexStream1dATI = (PFNGLVERTEXSTREAM1DATIPROC)gladLazyResolve("glVertexStream1dATI");
+	glad_glVertexStream1dATI(stream, x);
+}
+
+static void APIENTRY lazy_glVertexStream1dvATI(GLenum stream, const GLdouble *coords) {
+	glad_glVertexStream1dvATI = (PFNGLVERTEXSTREAM1DVATIPROC)gladLazyResolve("glVertexStream1dvATI");
+	glad_glVertexStream1dvATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream2sATI(GLenum stream, GLshort x, GLshort y) {
+	glad_glVertexStream2sATI = (PFNGLVERTEXSTREAM2SATIPROC)gladLazyResolve("glVertexStream2sATI");
+	glad_glVertexStream2sATI(stream, x, y);
+}
+
+static void APIENTRY lazy_glVertexStream2svATI(GLenum stream, const GLshort *coords) {
+	glad_glVertexStream2svATI = (PFNGLVERTEXSTREAM2SVATIPROC)gladLazyResolve("glVertexStream2svATI");
+	glad_glVertexStream2svATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream2iATI(GLenum stream, GLint x, GLint y) {
+	glad_glVertexStream2iATI = (PFNGLVERTEXSTREAM2IATIPROC)gladLazyResolve("glVertexStream2iATI");
+	glad_glVertexStream2iATI(stream, x, y);
+}
+
+static void APIENTRY lazy_glVertexStream2ivATI(GLenum stream, const GLint *coords) {
+	glad_glVertexStream2ivATI = (PFNGLVERTEXSTREAM2IVATIPROC)gladLazyResolve("glVertexStream2ivATI");
+	glad_glVertexStream2ivATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream2fATI(GLenum stream, GLfloat x, GLfloat y) {
+	glad_glVertexStream2fATI = (PFNGLVERTEXSTREAM2FATIPROC)gladLazyResolve("glVertexStream2fATI");
+	glad_glVertexStream2fATI(stream, x, y);
+}
+
+static void APIENTRY lazy_glVertexStream2fvATI(GLenum stream, const GLfloat *coords) {
+	glad_glVertexStream2fvATI = (PFNGLVERTEXSTREAM2FVATIPROC)gladLazyResolve("glVertexStream2fvATI");
+	glad_glVertexStream2fvATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream2dATI(GLenum stream, GLdouble x, GLdouble y) {
+	glad_glVertexStream2dATI = (PFNGLVERTEXSTREAM2DATIPROC)gladLazyResolve("glVertexStream2dATI");
+	glad_glVertexStream2dATI(stream, x, y);
+}
+
+static void APIENTRY lazy_glVertexStream2dvATI(GLenum stream, const GLdouble *coords) {
+	glad_glVertexStream2dvATI = (PFNGLVERTEXSTREAM2DVATIPROC)gladLazyResolve("glVertexStream2dvATI");
+	glad_glVertexStream2dvATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream3sATI(GLenum stream, GLshort x, GLshort y, GLshort z) {
+	glad_glVertexStream3sATI = (PFNGLVERTEXSTREAM3SATIPROC)gladLazyResolve("glVertexStream3sATI");
+	glad_glVertexStream3sATI(stream, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexStream3svATI(GLenum stream, const GLshort *coords) {
+	glad_glVertexStream3svATI = (PFNGLVERTEXSTREAM3SVATIPROC)gladLazyResolve("glVertexStream3svATI");
+	glad_glVertexStream3svATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream3iATI(GLenum stream, GLint x, GLint y, GLint z) {
+	glad_glVertexStream3iATI = (PFNGLVERTEXSTREAM3IATIPROC)gladLazyResolve("glVertexStream3iATI");
+	glad_glVertexStream3iATI(stream, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexStream3ivATI(GLenum stream, const GLint *coords) {
+	glad_glVertexStream3ivATI = (PFNGLVERTEXSTREAM3IVATIPROC)gladLazyResolve("glVertexStream3ivATI");
+	glad_glVertexStream3ivATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream3fATI(GLenum stream, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertexStream3fATI = (PFNGLVERTEXSTREAM3FATIPROC)gladLazyResolve("glVertexStream3fATI");
+	glad_glVertexStream3fATI(stream, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexStream3fvATI(GLenum stream, const GLfloat *coords) {
+	glad_glVertexStream3fvATI = (PFNGLVERTEXSTREAM3FVATIPROC)gladLazyResolve("glVertexStream3fvATI");
+	glad_glVertexStream3fvATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream3dATI(GLenum stream, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexStream3dATI = (PFNGLVERTEXSTREAM3DATIPROC)gladLazyResolve("glVertexStream3dATI");
+	glad_glVertexStream3dATI(stream, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexStream3dvATI(GLenum stream, const GLdouble *coords) {
+	glad_glVertexStream3dvATI = (PFNGLVERTEXSTREAM3DVATIPROC)gladLazyResolve("glVertexStream3dvATI");
+	glad_glVertexStream3dvATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream4sATI(GLenum stream, GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertexStream4sATI = (PFNGLVERTEXSTREAM4SATIPROC)gladLazyResolve("glVertexStream4sATI");
+	glad_glVertexStream4sATI(stream, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexStream4svATI(GLenum stream, const GLshort *coords) {
+	glad_glVertexStream4svATI = (PFNGLVERTEXSTREAM4SVATIPROC)gladLazyResolve("glVertexStream4svATI");
+	glad_glVertexStream4svATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream4iATI(GLenum stream, GLint x, GLint y, GLint z, GLint w) {
+	glad_glVertexStream4iATI = (PFNGLVERTEXSTREAM4IATIPROC)gladLazyResolve("glVertexStream4iATI");
+	glad_glVertexStream4iATI(stream, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexStream4ivATI(GLenum stream, const GLint *coords) {
+	glad_glVertexStream4ivATI = (PFNGLVERTEXSTREAM4IVATIPROC)gladLazyResolve("glVertexStream4ivATI");
+	glad_glVertexStream4ivATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream4fATI(GLenum stream, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertexStream4fATI = (PFNGLVERTEXSTREAM4FATIPROC)gladLazyResolve("glVertexStream4fATI");
+	glad_glVertexStream4fATI(stream, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexStream4fvATI(GLenum stream, const GLfloat *coords) {
+	glad_glVertexStream4fvATI = (PFNGLVERTEXSTREAM4FVATIPROC)gladLazyResolve("glVertexStream4fvATI");
+	glad_glVertexStream4fvATI(stream, coords);
+}
+
+static void APIENTRY lazy_glVertexStream4dATI(GLenum stream, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexStream4dATI = (PFNGLVERTEXSTREAM4DATIPROC)gladLazyResolve("glVertexStream4dATI");
+	glad_glVertexStream4dATI(stream, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexStream4dvATI(GLenum stream, const GLdouble *coords) {
+	glad_glVertexStream4dvATI = (PFNGLVERTEXSTREAM4DVATIPROC)gladLazyResolve("glVertexStream4dvATI");
+	glad_glVertexStream4dvATI(stream, coords);
+}
+
+static void APIENTRY lazy_glNormalStream3bATI(GLenum stream, GLbyte nx, GLbyte ny, GLbyte nz) {
+	glad_glNormalStream3bATI = (PFNGLNORMALSTREAM3BATIPROC)gladLazyResolve("glNormalStream3bATI");
+	glad_glNormalStream3bATI(stream, nx, ny, nz);
+}
+
+static void APIENTRY lazy_glNormalStream3bvATI(GLenum stream, const GLbyte *coords) {
+	glad_glNormalStream3bvATI = (PFNGLNORMALSTREAM3BVATIPROC)gladLazyResolve("glNormalStream3bvATI");
+	glad_glNormalStream3bvATI(stream, coords);
+}
+
+static void APIENTRY lazy_glNormalStream3sATI(GLenum stream, GLshort nx, GLshort ny, GLshort nz) {
+	glad_glNormalStream3sATI = (PFNGLNORMALSTREAM3SATIPROC)gladLazyResolve("glNormalStream3sATI");
+	glad_glNormalStream3sATI(stream, nx, ny, nz);
+}
+
+static void APIENTRY lazy_glNormalStream3svATI(GLenum stream, const GLshort *coords) {
+	glad_glNormalStream3svATI = (PFNGLNORMALSTREAM3SVATIPROC)gladLazyResolve("glNormalStream3svATI");
+	glad_glNormalStream3svATI(stream, coords);
+}
+
+static void APIENTRY lazy_glNormalStream3iATI(GLenum stream, GLint nx, GLint ny, GLint nz) {
+	glad_glNormalStream3iATI = (PFNGLNORMALSTREAM3IATIPROC)gladLazyResolve("glNormalStream3iATI");
+	glad_glNormalStream3iATI(stream, nx, ny, nz);
+}
+
+static void APIENTRY lazy_glNormalStream3ivATI(GLenum stream, const GLint *coords) {
+	glad_glNormalStream3ivATI = (PFNGLNORMALSTREAM3IVATIPROC)gladLazyResolve("glNormalStream3ivATI");
+	glad_glNormalStream3ivATI(stream, coords);
+}
+
+static void APIENTRY lazy_glNormalStream3fATI(GLenum stream, GLfloat nx, GLfloat ny, GLfloat nz) {
+	glad_glNormalStream3fATI = (PFNGLNORMALSTREAM3FATIPROC)gladLazyResolve("glNormalStream3fATI");
+	glad_glNormalStream3fATI(stream, nx, ny, nz);
+}
+
+static void APIENTRY lazy_glNormalStream3fvATI(GLenum stream, const GLfloat *coords) {
+	glad_glNormalStream3fvATI = (PFNGLNORMALSTREAM3FVATIPROC)gladLazyResolve("glNormalStream3fvATI");
+	glad_glNormalStream3fvATI(stream, coords);
+}
+
+static void APIENTRY lazy_glNormalStream3dATI(GLenum stream, GLdouble nx, GLdouble ny, GLdouble nz) {
+	glad_glNormalStream3dATI = (PFNGLNORMALSTREAM3DATIPROC)gladLazyResolve("glNormalStream3dATI");
+	glad_glNormalStream3dATI(stream, nx, ny, nz);
+}
+
+static void APIENTRY lazy_glNormalStream3dvATI(GLenum stream, const GLdouble *coords) {
+	glad_glNormalStream3dvATI = (PFNGLNORMALSTREAM3DVATIPROC)gladLazyResolve("glNormalStream3dvATI");
+	glad_glNormalStream3dvATI(stream, coords);
+}
+
+static void APIENTRY lazy_glClientActiveVertexStreamATI(GLenum stream) {
+	glad_glClientActiveVertexStreamATI = (PFNGLCLIENTACTIVEVERTEXSTREAMATIPROC)gladLazyResolve("glClientActiveVertexStreamATI");
+	glad_glClientActiveVertexStreamATI(stream);
+}
+
+static void APIENTRY lazy_glVertexBlendEnviATI(GLenum pname, GLint param) {
+	glad_glVertexBlendEnviATI = (PFNGLVERTEXBLENDENVIATIPROC)gladLazyResolve("glVertexBlendEnviATI");
+	glad_glVertexBlendEnviATI(pname, param);
+}
+
+static void APIENTRY lazy_glVertexBlendEnvfATI(GLenum pname, GLfloat param) {
+	glad_glVertexBlendEnvfATI = (PFNGLVERTEXBLENDENVFATIPROC)gladLazyResolve("glVertexBlendEnvfATI");
+	glad_glVertexBlendEnvfATI(pname, param);
+}
+
+static void APIENTRY lazy_glEGLImageTargetTexStorageEXT(GLenum target, GLeglImageOES image, const GLint* attrib_list) {
+	glad_glEGLImageTargetTexStorageEXT = (PFNGLEGLIMAGETARGETTEXSTORAGEEXTPROC)gladLazyResolve("glEGLImageTargetTexStorageEXT");
+	glad_glEGLImageTargetTexStorageEXT(target, image, attrib_list);
+}
+
+static void APIENTRY lazy_glEGLImageTargetTextureStorageEXT(GLuint texture, GLeglImageOES image, const GLint* attrib_list) {
+	glad_glEGLImageTargetTextureStorageEXT = (PFNGLEGLIMAGETARGETTEXTURESTORAGEEXTPROC)gladLazyResolve("glEGLImageTargetTextureStorageEXT");
+	glad_glEGLImageTargetTextureStorageEXT(texture, image, attrib_list);
+}
+
+static void APIENTRY lazy_glUniformBufferEXT(GLuint program, GLint location, GLuint buffer) {
+	glad_glUniformBufferEXT = (PFNGLUNIFORMBUFFEREXTPROC)gladLazyResolve("glUniformBufferEXT");
+	glad_glUniformBufferEXT(program, location, buffer);
+}
+
+static GLint APIENTRY lazy_glGetUniformBufferSizeEXT(GLuint program, GLint location) {
+	glad_glGetUniformBufferSizeEXT = (PFNGLGETUNIFORMBUFFERSIZEEXTPROC)gladLazyResolve("glGetUniformBufferSizeEXT");
+	return glad_glGetUniformBufferSizeEXT(program, location);
+}
+
+static GLintptr APIENTRY lazy_glGetUniformOffsetEXT(GLuint program, GLint location) {
+	glad_glGetUniformOffsetEXT = (PFNGLGETUNIFORMOFFSETEXTPROC)gladLazyResolve("glGetUniformOffsetEXT");
+	return glad_glGetUniformOffsetEXT(program, location);
+}
+
+static void APIENTRY lazy_glBlendColorEXT(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glBlendColorEXT = (PFNGLBLENDCOLOREXTPROC)gladLazyResolve("glBlendColorEXT");
+	glad_glBlendColorEXT(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glBlendEquationSeparateEXT(GLenum modeRGB, GLenum modeAlpha) {
+	glad_glBlendEquationSeparateEXT = (PFNGLBLENDEQUATIONSEPARATEEXTPROC)gladLazyResolve("glBlendEquationSeparateEXT");
+	glad_glBlendEquationSeparateEXT(modeRGB, modeAlpha);
+}
+
+static void APIENTRY lazy_glBlendFuncSeparateEXT(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	glad_glBlendFuncSeparateEXT = (PFNGLBLENDFUNCSEPARATEEXTPROC)gladLazyResolve("glBlendFuncSeparateEXT");
+	glad_glBlendFuncSeparateEXT(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void APIENTRY lazy_glBlendEquationEXT(GLenum mode) {
+	glad_glBlendEquationEXT = (PFNGLBLENDEQUATIONEXTPROC)gladLazyResolve("glBlendEquationEXT");
+	glad_glBlendEquationEXT(mode);
+}
+
+static void APIENTRY lazy_glColorSubTableEXT(GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const void *data) {
+	glad_glColorSubTableEXT = (PFNGLCOLORSUBTABLEEXTPROC)gladLazyResolve("glColorSubTableEXT");
+	glad_glColorSubTableEXT(target, start, count, format, type, data);
+}
+
+static void APIENTRY lazy_glCopyColorSubTableEXT(GLenum target, GLsizei start, GLint x, GLint y, GLsizei width) {
+	glad_glCopyColorSubTableEXT = (PFNGLCOPYCOLORSUBTABLEEXTPROC)gladLazyResolve("glCopyColorSubTableEXT");
+	glad_glCopyColorSubTableEXT(target, start, x, y, width);
+}
+
+static void APIENTRY lazy_glLockArraysEXT(GLint first, GLsizei count) {
+	glad_glLockArraysEXT = (PFNGLLOCKARRAYSEXTPROC)gladLazyResolve("glLockArraysEXT");
+	glad_glLockArraysEXT(first, count);
+}
+
+static void APIENTRY lazy_glUnlockArraysEXT(void) {
+	glad_glUnlockArraysEXT = (PFNGLUNLOCKARRAYSEXTPROC)gladLazyResolve("glUnlockArraysEXT");
+	glad_glUnlockArraysEXT();
+}
+
+static void APIENTRY lazy_glConvolutionFilter1DEXT(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *image) {
+	glad_glConvolutionFilter1DEXT = (PFNGLCONVOLUTIONFILTER1DEXTPROC)gladLazyResolve("glConvolutionFilter1DEXT");
+	glad_glConvolutionFilter1DEXT(target, internalformat, width, format, type, image);
+}
+
+static void APIENTRY lazy_glConvolutionFilter2DEXT(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *image) {
+	glad_glConvolutionFilter2DEXT = (PFNGLCONVOLUTIONFILTER2DEXTPROC)gladLazyResolve("glConvolutionFilter2DEXT");
+	glad_glConvolutionFilter2DEXT(target, internalformat, width, height, format, type, image);
+}
+
+static void APIENTRY lazy_glConvolutionParameterfEXT(GLenum target, GLenum pname, GLfloat params) {
+	glad_glConvolutionParameterfEXT = (PFNGLCONVOLUTIONPARAMETERFEXTPROC)gladLazyResolve("glConvolutionParameterfEXT");
+	glad_glConvolutionParameterfEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glConvolutionParameterfvEXT(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glConvolutionParameterfvEXT = (PFNGLCONVOLUTIONPARAMETERFVEXTPROC)gladLazyResolve("glConvolutionParameterfvEXT");
+	glad_glConvolutionParameterfvEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glConvolutionParameteriEXT(GLenum target, GLenum pname, GLint params) {
+	glad_glConvolutionParameteriEXT = (PFNGLCONVOLUTIONPARAMETERIEXTPROC)gladLazyResolve("glConvolutionParameteriEXT");
+	glad_glConvolutionParameteriEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glConvolutionParameterivEXT(GLenum target, GLenum pname, const GLint *params) {
+	glad_glConvolutionParameterivEXT = (PFNGLCONVOLUTIONPARAMETERIVEXTPROC)gladLazyResolve("glConvolutionParameterivEXT");
+	glad_glConvolutionParameterivEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glCopyConvolutionFilter1DEXT(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width) {
+	glad_glCopyConvolutionFilter1DEXT = (PFNGLCOPYCONVOLUTIONFILTER1DEXTPROC)gladLazyResolve("glCopyConvolutionFilter1DEXT");
+	glad_glCopyConvolutionFilter1DEXT(target, internalformat, x, y, width);
+}
+
+static void APIENTRY lazy_glCopyConvolutionFilter2DEXT(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyConvolutionFilter2DEXT = (PFNGLCOPYCONVOLUTIONFILTER2DEXTPROC)gladLazyResolve("glCopyConvolutionFilter2DEXT");
+	glad_glCopyConvolutionFilter2DEXT(target, internalformat, x, y, width, height);
+}
+
+static void APIENTRY lazy_glGetConvolutionFilterEXT(GLenum target, GLenum format, GLenum type, void *image) {
+	glad_glGetConvolutionFilterEXT = (PFNGLGETCONVOLUTIONFILTEREXTPROC)gladLazyResolve("glGetConvolutionFilterEXT");
+	glad_glGetConvolutionFilterEXT(target, format, type, image);
+}
+
+static void APIENTRY lazy_glGetConvolutionParameterfvEXT(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetConvolutionParameterfvEXT = (PFNGLGETCONVOLUTIONPARAMETERFVEXTPROC)gladLazyResolve("glGetConvolutionParameterfvEXT");
+	glad_glGetConvolutionParameterfvEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetConvolutionParameterivEXT(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetConvolutionParameterivEXT = (PFNGLGETCONVOLUTIONPARAMETERIVEXTPROC)gladLazyResolve("glGetConvolutionParameterivEXT");
+	glad_glGetConvolutionParameterivEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetSeparableFilterEXT(GLenum target, GLenum format, GLenum type, void *row, void *column, void *span) {
+	glad_glGetSeparableFilterEXT = (PFNGLGETSEPARABLEFILTEREXTPROC)gladLazyResolve("glGetSeparableFilterEXT");
+	glad_glGetSeparableFilterEXT(target, format, type, row, column, span);
+}
+
+static void APIENTRY lazy_glSeparableFilter2DEXT(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *row, const void *column) {
+	glad_glSeparableFilter2DEXT = (PFNGLSEPARABLEFILTER2DEXTPROC)gladLazyResolve("glSeparableFilter2DEXT");
+	glad_glSeparableFilter2DEXT(target, internalformat, width, height, format, type, row, column);
+}
+
+static void APIENTRY lazy_glTangent3bEXT(GLbyte tx, GLbyte ty, GLbyte tz) {
+	glad_glTangent3bEXT = (PFNGLTANGENT3BEXTPROC)gladLazyResolve("glTangent3bEXT");
+	glad_glTangent3bEXT(tx, ty, tz);
+}
+
+static void APIENTRY lazy_glTangent3bvEXT(const GLbyte *v) {
+	glad_glTangent3bvEXT = (PFNGLTANGENT3BVEXTPROC)gladLazyResolve("glTangent3bvEXT");
+	glad_glTangent3bvEXT(v);
+}
+
+static void APIENTRY lazy_glTangent3dEXT(GLdouble tx, GLdouble ty, GLdouble tz) {
+	glad_glTangent3dEXT = (PFNGLTANGENT3DEXTPROC)gladLazyResolve("glTangent3dEXT");
+	glad_glTangent3dEXT(tx, ty, tz);
+}
+
+static void APIENTRY lazy_glTangent3dvEXT(const GLdouble *v) {
+	glad_glTangent3dvEXT = (PFNGLTANGENT3DVEXTPROC)gladLazyResolve("glTangent3dvEXT");
+	glad_glTangent3dvEXT(v);
+}
+
+static void APIENTRY lazy_glTangent3fEXT(GLfloat tx, GLfloat ty, GLfloat tz) {
+	glad_glTangent3fEXT = (PFNGLTANGENT3FEXTPROC)gladLazyResolve("glTangent3fEXT");
+	glad_glTangent3fEXT(tx, ty, tz);
+}
+
+static void APIENTRY lazy_glTangent3fvEXT(const GLfloat *v) {
+	glad_glTangent3fvEXT = (PFNGLTANGENT3FVEXTPROC)gladLazyResolve("glTangent3fvEXT");
+	glad_glTangent3fvEXT(v);
+}
+
+static void APIENTRY lazy_glTangent3iEXT(GLint tx, GLint ty, GLint tz) {
+	glad_glTangent3iEXT = (PFNGLTANGENT3IEXTPROC)gladLazyResolve("glTangent3iEXT");
+	glad_glTangent3iEXT(tx, ty, tz);
+}
+
+static void APIENTRY lazy_glTangent3ivEXT(const GLint *v) {
+	glad_glTangent3ivEXT = (PFNGLTANGENT3IVEXTPROC)gladLazyResolve("glTangent3ivEXT");
+	glad_glTangent3ivEXT(v);
+}
+
+static void APIENTRY lazy_glTangent3sEXT(GLshort tx, GLshort ty, GLshort tz) {
+	glad_glTangent3sEXT = (PFNGLTANGENT3SEXTPROC)gladLazyResolve("glTangent3sEXT");
+	glad_glTangent3sEXT(tx, ty, tz);
+}
+
+static void APIENTRY lazy_glTangent3svEXT(const GLshort *v) {
+	glad_glTangent3svEXT = (PFNGLTANGENT3SVEXTPROC)gladLazyResolve("glTangent3svEXT");
+	glad_glTangent3svEXT(v);
+}
+
+static void APIENTRY lazy_glBinormal3bEXT(GLbyte bx, GLbyte by, GLbyte bz) {
+	glad_glBinormal3bEXT = (PFNGLBINORMAL3BEXTPROC)gladLazyResolve("glBinormal3bEXT");
+	glad_glBinormal3bEXT(bx, by, bz);
+}
+
+static void APIENTRY lazy_glBinormal3bvEXT(const GLbyte *v) {
+	glad_glBinormal3bvEXT = (PFNGLBINORMAL3BVEXTPROC)gladLazyResolve("glBinormal3bvEXT");
+	glad_glBinormal3bvEXT(v);
+}
+
+static void APIENTRY lazy_glBinormal3dEXT(GLdouble bx, GLdouble by, GLdouble bz) {
+	glad_glBinormal3dEXT = (PFNGLBINORMAL3DEXTPROC)gladLazyResolve("glBinormal3dEXT");
+	glad_glBinormal3dEXT(bx, by, bz);
+}
+
+static void APIENTRY lazy_glBinormal3dvEXT(const GLdouble *v) {
+	glad_glBinormal3dvEXT = (PFNGLBINORMAL3DVEXTPROC)gladLazyResolve("glBinormal3dvEXT");
+	glad_glBinormal3dvEXT(v);
+}
+
+static void APIENTRY lazy_glBinormal3fEXT(GLfloat bx, GLfloat by, GLfloat bz) {
+	glad_glBinormal3fEXT = (PFNGLBINORMAL3FEXTPROC)gladLazyResolve("glBinormal3fEXT");
+	glad_glBinormal3fEXT(bx, by, bz);
+}
+
+static void APIENTRY lazy_glBinormal3fvEXT(const GLfloat *v) {
+	glad_glBinormal3fvEXT = (PFNGLBINORMAL3FVEXTPROC)gladLazyResolve("glBinormal3fvEXT");
+	glad_glBinormal3fvEXT(v);
+}
+
+static void APIENTRY lazy_glBinormal3iEXT(GLint bx, GLint by, GLint bz) {
+	glad_glBinormal3iEXT = (PFNGLBINORMAL3IEXTPROC)gladLazyResolve("glBinormal3iEXT");
+	glad_glBinormal3iEXT(bx, by, bz);
+}
+
+static void APIENTRY lazy_glBinormal3ivEXT(const GLint *v) {
+	glad_glBinormal3ivEXT = (PFNGLBINORMAL3IVEXTPROC)gladLazyResolve("glBinormal3ivEXT");
+	glad_glBinormal3ivEXT(v);
+}
+
+static void APIENTRY lazy_glBinormal3sEXT(GLshort bx, GLshort by, GLshort bz) {
+	glad_glBinormal3sEXT = (PFNGLBINORMAL3SEXTPROC)gladLazyResolve("glBinormal3sEXT");
+	glad_glBinormal3sEXT(bx, by, bz);
+}
+
+static void APIENTRY lazy_glBinormal3svEXT(const GLshort *v) {
+	glad_glBinormal3svEXT = (PFNGLBINORMAL3SVEXTPROC)gladLazyResolve("glBinormal3svEXT");
+	glad_glBinormal3svEXT(v);
+}
+
+static void APIENTRY lazy_glTangentPointerEXT(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glTangentPointerEXT = (PFNGLTANGENTPOINTEREXTPROC)gladLazyResolve("glTangentPointerEXT");
+	glad_glTangentPointerEXT(type, stride, pointer);
+}
+
+static void APIENTRY lazy_glBinormalPointerEXT(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glBinormalPointerEXT = (PFNGLBINORMALPOINTEREXTPROC)gladLazyResolve("glBinormalPointerEXT");
+	glad_glBinormalPointerEXT(type, stride, pointer);
+}
+
+static void APIENTRY lazy_glCopyTexImage1DEXT(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	glad_glCopyTexImage1DEXT = (PFNGLCOPYTEXIMAGE1DEXTPROC)gladLazyResolve("glCopyTexImage1DEXT");
+	glad_glCopyTexImage1DEXT(target, level, internalformat, x, y, width, border);
+}
+
+static void APIENTRY lazy_glCopyTexImage2DEXT(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	glad_glCopyTexImage2DEXT = (PFNGLCOPYTEXIMAGE2DEXTPROC)gladLazyResolve("glCopyTexImage2DEXT");
+	glad_glCopyTexImage2DEXT(target, level, internalformat, x, y, width, height, border);
+}
+
+static void APIENTRY lazy_glCopyTexSubImage1DEXT(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyTexSubImage1DEXT = (PFNGLCOPYTEXSUBIMAGE1DEXTPROC)gladLazyResolve("glCopyTexSubImage1DEXT");
+	glad_glCopyTexSubImage1DEXT(target, level, xoffset, x, y, width);
+}
+
+static void APIENTRY lazy_glCopyTexSubImage2DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage2DEXT = (PFNGLCOPYTEXSUBIMAGE2DEXTPROC)gladLazyResolve("glCopyTexSubImage2DEXT");
+	glad_glCopyTexSubImage2DEXT(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void APIENTRY lazy_glCopyTexSubImage3DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage3DEXT = (PFNGLCOPYTEXSUBIMAGE3DEXTPROC)gladLazyResolve("glCopyTexSubImage3DEXT");
+	glad_glCopyTexSubImage3DEXT(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void APIENTRY lazy_glCullParameterdvEXT(GLenum pname, GLdouble *params) {
+	glad_glCullParameterdvEXT = (PFNGLCULLPARAMETERDVEXTPROC)gladLazyResolve("glCullParameterdvEXT");
+	glad_glCullParameterdvEXT(pname, params);
+}
+
+static void APIENTRY lazy_glCullParameterfvEXT(GLenum pname, GLfloat *params) {
+	glad_glCullParameterfvEXT = (PFNGLCULLPARAMETERFVEXTPROC)gladLazyResolve("glCullParameterfvEXT");
+	glad_glCullParameterfvEXT(pname, params);
+}
+
+static void APIENTRY lazy_glLabelObjectEXT(GLenum type, GLuint object, GLsizei length, const GLchar *label) {
+	glad_glLabelObjectEXT = (PFNGLLABELOBJECTEXTPROC)gladLazyResolve("glLabelObjectEXT");
+	glad_glLabelObjectEXT(type, object, length, label);
+}
+
+static void APIENTRY lazy_glGetObjectLabelEXT(GLenum type, GLuint object, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	glad_glGetObjectLabelEXT = (PFNGLGETOBJECTLABELEXTPROC)gladLazyResolve("glGetObjectLabelEXT");
+	glad_glGetObjectLabelEXT(type, object, bufSize, length, label);
+}
+
+static void APIENTRY lazy_glInsertEventMarkerEXT(GLsizei length, const GLchar *marker) {
+	glad_glInsertEventMarkerEXT = (PFNGLINSERTEVENTMARKEREXTPROC)gladLazyResolve("glInsertEventMarkerEXT");
+	glad_glInsertEventMarkerEXT(length, marker);
+}
+
+static void APIENTRY lazy_glPushGroupMarkerEXT(GLsizei length, const GLchar *marker) {
+	glad_glPushGroupMarkerEXT = (PFNGLPUSHGROUPMARKEREXTPROC)gladLazyResolve("glPushGroupMarkerEXT");
+	glad_glPushGroupMarkerEXT(length, marker);
+}
+
+static void APIENTRY lazy_glPopGroupMarkerEXT(void) {
+	glad_glPopGroupMarkerEXT = (PFNGLPOPGROUPMARKEREXTPROC)gladLazyResolve("glPopGroupMarkerEXT");
+	glad_glPopGroupMarkerEXT();
+}
+
+static void APIENTRY lazy_glDepthBoundsEXT(GLclampd zmin, GLclampd zmax) {
+	glad_glDepthBoundsEXT = (PFNGLDEPTHBOUNDSEXTPROC)gladLazyResolve("glDepthBoundsEXT");
+	glad_glDepthBoundsEXT(zmin, zmax);
+}
+
+static void APIENTRY lazy_glMatrixLoadfEXT(GLenum mode, const GLfloat *m) {
+	glad_glMatrixLoadfEXT = (PFNGLMATRIXLOADFEXTPROC)gladLazyResolve("glMatrixLoadfEXT");
+	glad_glMatrixLoadfEXT(mode, m);
+}
+
+static void APIENTRY lazy_glMatrixLoaddEXT(GLenum mode, const GLdouble *m) {
+	glad_glMatrixLoaddEXT = (PFNGLMATRIXLOADDEXTPROC)gladLazyResolve("glMatrixLoaddEXT");
+	glad_glMatrixLoaddEXT(mode, m);
+}
+
+static void APIENTRY lazy_glMatrixMultfEXT(GLenum mode, const GLfloat *m) {
+	glad_glMatrixMultfEXT = (PFNGLMATRIXMULTFEXTPROC)gladLazyResolve("glMatrixMultfEXT");
+	glad_glMatrixMultfEXT(mode, m);
+}
+
+static void APIENTRY lazy_glMatrixMultdEXT(GLenum mode, const GLdouble *m) {
+	glad_glMatrixMultdEXT = (PFNGLMATRIXMULTDEXTPROC)gladLazyResolve("glMatrixMultdEXT");
+	glad_glMatrixMultdEXT(mode, m);
+}
+
+static void APIENTRY lazy_glMatrixLoadIdentityEXT(GLenum mode) {
+	glad_glMatrixLoadIdentityEXT = (PFNGLMATRIXLOADIDENTITYEXTPROC)gladLazyResolve("glMatrixLoadIdentityEXT");
+	glad_glMatrixLoadIdentityEXT(mode);
+}
+
+static void APIENTRY lazy_glMatrixRotatefEXT(GLenum mode, GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glMatrixRotatefEXT = (PFNGLMATRIXROTATEFEXTPROC)gladLazyResolve("glMatrixRotatefEXT");
+	glad_glMatrixRotatefEXT(mode, angle, x, y, z);
+}
+
+static void APIENTRY lazy_glMatrixRotatedEXT(GLenum mode, GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glMatrixRotatedEXT = (PFNGLMATRIXROTATEDEXTPROC)gladLazyResolve("glMatrixRotatedEXT");
+	glad_glMatrixRotatedEXT(mode, angle, x, y, z);
+}
+
+static void APIENTRY lazy_glMatrixScalefEXT(GLenum mode, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glMatrixScalefEXT = (PFNGLMATRIXSCALEFEXTPROC)gladLazyResolve("glMatrixScalefEXT");
+	glad_glMatrixScalefEXT(mode, x, y, z);
+}
+
+static void APIENTRY lazy_glMatrixScaledEXT(GLenum mode, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glMatrixScaledEXT = (PFNGLMATRIXSCALEDEXTPROC)gladLazyResolve("glMatrixScaledEXT");
+	glad_glMatrixScaledEXT(mode, x, y, z);
+}
+
+static void APIENTRY lazy_glMatrixTranslatefEXT(GLenum mode, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glMatrixTranslatefEXT = (PFNGLMATRIXTRANSLATEFEXTPROC)gladLazyResolve("glMatrixTranslatefEXT");
+	glad_glMatrixTranslatefEXT(mode, x, y, z);
+}
+
+static void APIENTRY lazy_glMatrixTranslatedEXT(GLenum mode, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glMatrixTranslatedEXT = (PFNGLMATRIXTRANSLATEDEXTPROC)gladLazyResolve("glMatrixTranslatedEXT");
+	glad_glMatrixTranslatedEXT(mode, x, y, z);
+}
+
+static void APIENTRY lazy_glMatrixFrustumEXT(GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	glad_glMatrixFrustumEXT = (PFNGLMATRIXFRUSTUMEXTPROC)gladLazyResolve("glMatrixFrustumEXT");
+	glad_glMatrixFrustumEXT(mode, left, right, bottom, top, zNear, zFar);
+}
+
+static void APIENTRY lazy_glMatrixOrthoEXT(GLenum mode, GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	glad_glMatrixOrthoEXT = (PFNGLMATRIXORTHOEXTPROC)gladLazyResolve("glMatrixOrthoEXT");
+	glad_glMatrixOrthoEXT(mode, left, right, bottom, top, zNear, zFar);
+}
+
+static void APIENTRY lazy_glMatrixPopEXT(GLenum mode) {
+	glad_glMatrixPopEXT = (PFNGLMATRIXPOPEXTPROC)gladLazyResolve("glMatrixPopEXT");
+	glad_glMatrixPopEXT(mode);
+}
+
+static void APIENTRY lazy_glMatrixPushEXT(GLenum mode) {
+	glad_glMatrixPushEXT = (PFNGLMATRIXPUSHEXTPROC)gladLazyResolve("glMatrixPushEXT");
+	glad_glMatrixPushEXT(mode);
+}
+
+static void APIENTRY lazy_glClientAttribDefaultEXT(GLbitfield mask) {
+	glad_glClientAttribDefaultEXT = (PFNGLCLIENTATTRIBDEFAULTEXTPROC)gladLazyResolve("glClientAttribDefaultEXT");
+	glad_glClientAttribDefaultEXT(mask);
+}
+
+static void APIENTRY lazy_glPushClientAttribDefaultEXT(GLbitfield mask) {
+	glad_glPushClientAttribDefaultEXT = (PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)gladLazyResolve("glPushClientAttribDefaultEXT");
+	glad_glPushClientAttribDefaultEXT(mask);
+}
+
+static void APIENTRY lazy_glTextureParameterfEXT(GLuint texture, GLenum target, GLenum pname, GLfloat param) {
+	glad_glTextureParameterfEXT = (PFNGLTEXTUREPARAMETERFEXTPROC)gladLazyResolve("glTextureParameterfEXT");
+	glad_glTextureParameterfEXT(texture, target, pname, param);
+}
+
+static void APIENTRY lazy_glTextureParameterfvEXT(GLuint texture, GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glTextureParameterfvEXT = (PFNGLTEXTUREPARAMETERFVEXTPROC)gladLazyResolve("glTextureParameterfvEXT");
+	glad_glTextureParameterfvEXT(texture, target, pname, params);
+}
+
+static void APIENTRY lazy_glTextureParameteriEXT(GLuint texture, GLenum target, GLenum pname, GLint param) {
+	glad_glTextureParameteriEXT = (PFNGLTEXTUREPARAMETERIEXTPROC)gladLazyResolve("glTextureParameteriEXT");
+	glad_glTextureParameteriEXT(texture, target, pname, param);
+}
+
+static void APIENTRY lazy_glTextureParameterivEXT(GLuint texture, GLenum target, GLenum pname, const GLint *params) {
+	glad_glTextureParameterivEXT = (PFNGLTEXTUREPARAMETERIVEXTPROC)gladLazyResolve("glTextureParameterivEXT");
+	glad_glTextureParameterivEXT(texture, target, pname, params);
+}
+
+static void APIENTRY lazy_glTextureImage1DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureImage1DEXT = (PFNGLTEXTUREIMAGE1DEXTPROC)gladLazyResolve("glTextureImage1DEXT");
+	glad_glTextureImage1DEXT(texture, target, level, internalformat, width, border, format, type, pixels);
+}
+
+static void APIENTRY lazy_glTextureImage2DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureImage2DEXT = (PFNGLTEXTUREIMAGE2DEXTPROC)gladLazyResolve("glTextureImage2DEXT");
+	glad_glTextureImage2DEXT(texture, target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void APIENTRY lazy_glTextureSubImage1DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage1DEXT = (PFNGLTEXTURESUBIMAGE1DEXTPROC)gladLazyResolve("glTextureSubImage1DEXT");
+	glad_glTextureSubImage1DEXT(texture, target, level, xoffset, width, format, type, pixels);
+}
+
+static void APIENTRY lazy_glTextureSubImage2DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage2DEXT = (PFNGLTEXTURESUBIMAGE2DEXTPROC)gladLazyResolve("glTextureSubImage2DEXT");
+	glad_glTextureSubImage2DEXT(texture, target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY lazy_glCopyTextureImage1DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	glad_glCopyTextureImage1DEXT = (PFNGLCOPYTEXTUREIMAGE1DEXTPROC)gladLazyResolve("glCopyTextureImage1DEXT");
+	glad_glCopyTextureImage1DEXT(texture, target, level, internalformat, x, y, width, border);
+}
+
+static void APIENTRY lazy_glCopyTextureImage2DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	glad_glCopyTextureImage2DEXT = (PFNGLCOPYTEXTUREIMAGE2DEXTPROC)gladLazyResolve("glCopyTextureImage2DEXT");
+	glad_glCopyTextureImage2DEXT(texture, target, level, internalformat, x, y, width, height, border);
+}
+
+static void APIENTRY lazy_glCopyTextureSubImage1DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyTextureSubImage1DEXT = (PFNGLCOPYTEXTURESUBIMAGE1DEXTPROC)gladLazyResolve("glCopyTextureSubImage1DEXT");
+	glad_glCopyTextureSubImage1DEXT(texture, target, level, xoffset, x, y, width);
+}
+
+static void APIENTRY lazy_glCopyTextureSubImage2DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTextureSubImage2DEXT = (PFNGLCOPYTEXTURESUBIMAGE2DEXTPROC)gladLazyResolve("glCopyTextureSubImage2DEXT");
+	glad_glCopyTextureSubImage2DEXT(texture, target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void APIENTRY lazy_glGetTextureImageEXT(GLuint texture, GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	glad_glGetTextureImageEXT = (PFNGLGETTEXTUREIMAGEEXTPROC)gladLazyResolve("glGetTextureImageEXT");
+	glad_glGetTextureImageEXT(texture, target, level, format, type, pixels);
+}
+
+static void APIENTRY lazy_glGetTextureParameterfvEXT(GLuint texture, GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetTextureParameterfvEXT = (PFNGLGETTEXTUREPARAMETERFVEXTPROC)gladLazyResolve("glGetTextureParameterfvEXT");
+	glad_glGetTextureParameterfvEXT(texture, target, pname, params);
+}
+
+static void APIENTRY lazy_glGetTextureParameterivEXT(GLuint texture, GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTextureParameterivEXT = (PFNGLGETTEXTUREPARAMETERIVEXTPROC)gladLazyResolve("glGetTextureParameterivEXT");
+	glad_glGetTextureParameterivEXT(texture, target, pname, params);
+}
+
+static void APIENTRY lazy_glGetTextureLevelParameterfvEXT(GLuint texture, GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	glad_glGetTextureLevelParameterfvEXT = (PFNGLGETTEXTURELEVELPARAMETERFVEXTPROC)gladLazyResolve("glGetTextureLevelParameterfvEXT");
+	glad_glGetTextureLevelParameterfvEXT(texture, target, level, pname, params);
+}
+
+static void APIENTRY lazy_glGetTextureLevelParameterivEXT(GLuint texture, GLenum target, GLint level, GLenum pname, GLint *params) {
+	glad_glGetTextureLevelParameterivEXT = (PFNGLGETTEXTURELEVELPARAMETERIVEXTPROC)gladLazyResolve("glGetTextureLevelParameterivEXT");
+	glad_glGetTextureLevelParameterivEXT(texture, target, level, pname, params);
+}
+
+static void APIENTRY lazy_glTextureImage3DEXT(GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureImage3DEXT = (PFNGLTEXTUREIMAGE3DEXTPROC)gladLazyResolve("glTextureImage3DEXT");
+	glad_glTextureImage3DEXT(texture, target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static void APIENTRY lazy_glTextureSubImage3DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage3DEXT = (PFNGLTEXTURESUBIMAGE3DEXTPROC)gladLazyResolve("glTextureSubImage3DEXT");
+	glad_glTextureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void APIENTRY lazy_glCopyTextureSubImage3DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTextureSubImage3DEXT = (PFNGLCOPYTEXTURESUBIMAGE3DEXTPROC)gladLazyResolve("glCopyTextureSubImage3DEXT");
+	glad_glCopyTextureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void APIENTRY lazy_glBindMultiTextureEXT(GLenum texunit, GLenum target, GLuint texture) {
+	glad_glBindMultiTextureEXT = (PFNGLBINDMULTITEXTUREEXTPROC)gladLazyResolve("glBindMultiTextureEXT");
+	glad_glBindMultiTextureEXT(texunit, target, texture);
+}
+
+static void APIENTRY lazy_glMultiTexCoordPointerEXT(GLenum texunit, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glMultiTexCoordPointerEXT = (PFNGLMULTITEXCOORDPOINTEREXTPROC)gladLazyResolve("glMultiTexCoordPointerEXT");
+	glad_glMultiTexCoordPointerEXT(texunit, size, type, stride, pointer);
+}
+
+static void APIENTRY lazy_glMultiTexEnvfEXT(GLenum texunit, GLenum target, GLenum pname, GLfloat param) {
+	glad_glMultiTexEnvfEXT = (PFNGLMULTITEXENVFEXTPROC)gladLazyResolve("glMultiTexEnvfEXT");
+	glad_glMultiTexEnvfEXT(texunit, target, pname, param);
+}
+
+static void APIENTRY lazy_glMultiTexEnvfvEXT(GLenum texunit, GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glMultiTexEnvfvEXT = (PFNGLMULTITEXENVFVEXTPROC)gladLazyResolve("glMultiTexEnvfvEXT");
+	glad_glMultiTexEnvfvEXT(texunit, target, pname, params);
+}
+
+static void APIENTRY lazy_glMultiTexEnviEXT(GLenum texunit, GLenum target, GLenum pname, GLint param) {
+	glad_glMultiTexEnviEXT = (PFNGLMULTITEXENVIEXTPROC)gladLazyResolve("glMultiTexEnviEXT");
+	glad_glMultiTexEnviEXT(texunit, target, pname, param);
+}
+
+static void APIENTRY lazy_glMultiTexEnvivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint *params) {
+	glad_glMultiTexEnvivEXT = (PFNGLMULTITEXENVIVEXTPROC)gladLazyResolve("glMultiTexEnvivEXT");
+	glad_glMultiTexEnvivEXT(texunit, target, pname, params);
+}
+
+static void APIENTRY lazy_glMultiTexGendEXT(GLenum texunit, GLenum coord, GLenum pname, GLdouble param) {
+	glad_glMultiTexGendEXT = (PFNGLMULTITEXGENDEXTPROC)gladLazyResolve("glMultiTexGendEXT");
+	glad_glMultiTexGendEXT(texunit, coord, pname, param);
+}
+
+static void APIENTRY lazy_glMultiTexGendvEXT(GLenum texunit, GLenum coord, GLenum pname, const GLdouble *params) {
+	glad_glMultiTexGendvEXT = (PFNGLMULTITEXGENDVEXTPROC)gladLazyResolve("glMultiTexGendvEXT");
+	glad_glMultiTexGendvEXT(texunit, coord, pname, params);
+}
+
+static void APIENTRY lazy_glMultiTexGenfEXT(GLenum texunit, GLenum coord, GLenum pname, GLfloat param) {
+	glad_glMultiTexGenfEXT = (PFNGLMULTITEXGENFEXTPROC)gladLazyResolve("glMultiTexGenfEXT");
+	glad_glMultiTexGenfEXT(texunit, coord, pname, param);
+}
+
+static void APIENTRY lazy_glMultiTexGenfvEXT(GLenum texunit, GLenum coord, GLenum pname, const GLfloat *params) {
+	glad_glMultiTexGenfvEXT = (PFNGLMULTITEXGENFVEXTPROC)gladLazyResolve("glMultiTexGenfvEXT");
+	glad_glMultiTexGenfvEXT(texunit, coord, pname, params);
+}
+
+static void APIENTRY lazy_glMultiTexGeniEXT(GLenum texunit, GLenum coord, GLenum pname, GLint param) {
+	glad_glMultiTexGeniEXT = (PFNGLMULTITEXGENIEXTPROC)gladLazyResolve("glMultiTexGeniEXT");
+	glad_glMultiTexGeniEXT(texunit, coord, pname, param);
+}
+
+static void APIENTRY lazy_glMultiTexGenivEXT(GLenum texunit, GLenum coord, GLenum pname, const GLint *params) {
+	glad_glMultiTexGenivEXT = (PFNGLMULTITEXGENIVEXTPROC)gladLazyResolve("glMultiTexGenivEXT");
+	glad_glMultiTexGenivEXT(texunit, coord, pname, params);
+}
+
+static void APIENTRY lazy_glGetMultiTexEnvfvEXT(GLenum texunit, GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetMultiTexEnvfvEXT = (PFNGLGETMULTITEXENVFVEXTPROC)gladLazyResolve("glGetMultiTexEnvfvEXT");
+	glad_glGetMultiTexEnvfvEXT(texunit, target, pname, params);
+}
+
+static void APIENTRY lazy_glGetMultiTexEnvivEXT(GLenum texunit, GLenum target, GLenum pname, GLint *params) {
+	glad_glGetMultiTexEnvivEXT = (PFNGLGETMULTITEXENVIVEXTPROC)gladLazyResolve("glGetMultiTexEnvivEXT");
+	glad_glGetMultiTexEnvivEXT(texunit, target, pname, params);
+}
+
+static void APIENTRY lazy_glGetMultiTexGendvEXT(GLenum texunit, GLenum coord, GLenum pname, GLdouble *params) {
+	glad_glGetMultiTexGendvEXT = (PFNGLGETMULTITEXGENDVEXTPROC)gladLazyResolve("glGetMultiTexGendvEXT");
+	glad_glGetMultiTexGendvEXT(texunit, coord, pname, params);
+}
+
+static void APIENTRY lazy_glGetMultiTexGenfvEXT(GLenum texunit, GLenum coord, GLenum pname, GLfloat *params) {
+	glad_glGetMultiTexGenfvEXT = (PFNGLGETMULTITEXGENFVEXTPROC)gladLazyResolve("glGetMultiTexGenfvEXT");
+	glad_glGetMultiTexGenfvEXT(texunit, coord, pname, params);
+}
+
+static void APIENTRY lazy_glGetMultiTexGenivEXT(GLenum texunit, GLenum coord, GLenum pname, GLint *params) {
+	glad_glGetMultiTexGenivEXT = (PFNGLGETMULTITEXGENIVEXTPROC)gladLazyResolve("glGetMultiTexGenivEXT");
+	glad_glGetMultiTexGenivEXT(texunit, coord, pname, params);
+}
+
+static void APIENTRY lazy_glMultiTexParameteriEXT(GLenum texunit, GLenum target, GLenum pname, GLint param) {
+	glad_glMultiTexParameteriEXT = (PFNGLMULTITEXPARAMETERIEXTPROC)gladLazyResolve("glMultiTexParameteriEXT");
+	glad_glMultiTexParameteriEXT(texunit, target, pname, param);
+}
+
+static void APIENTRY lazy_glMultiTexParameterivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint *params) {
+	glad_glMultiTexParameterivEXT = (PFNGLMULTITEXPARAMETERIVEXTPROC)gladLazyResolve("glMultiTexParameterivEXT");
+	glad_glMultiTexParameterivEXT(texunit, target, pname, params);
+}
+
+static void APIENTRY lazy_glMultiTexParameterfEXT(GLenum texunit, GLenum target, GLenum pname, GLfloat param) {
+	glad_glMultiTexParameterfEXT = (PFNGLMULTITEXPARAMETERFEXTPROC)gladLazyResolve("glMultiTexParameterfEXT");
+	glad_glMultiTexParameterfEXT(texunit, target, pname, param);
+}
+
+static void APIENTRY lazy_glMultiTexParameterfvEXT(GLenum texunit, GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glMultiTexParameterfvEXT = (PFNGLMULTITEXPARAMETERFVEXTPROC)gladLazyResolve("glMultiTexParameterfvEXT");
+	glad_glMultiTexParameterfvEXT(texunit, target, pname, params);
+}
+
+static void APIENTRY lazy_glMultiTexImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glMultiTexImage1DEXT = (PFNGLMULTITEXIMAGE1DEXTPROC)gladLazyResolve("glMultiTexImage1DEXT");
+	glad_glMultiTexImage1DEXT(texunit, target, level, internalformat, width, border, format, type, pixels);
+}
+
+static void APIENTRY lazy_glMultiTexImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glMultiTexImage2DEXT = (PFNGLMULTITEXIMAGE2DEXTPROC)gladLazyResolve("glMultiTexImage2DEXT");
+	glad_glMultiTexImage2DEXT(texunit, target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void APIENTRY lazy_glMultiTexSubImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glMultiTexSubImage1DEXT = (PFNGLMULTITEXSUBIMAGE1DEXTPROC)gladLazyResolve("glMultiTexSubImage1DEXT");
+	glad_glMultiTexSubImage1DEXT(texunit, target, level, xoffset, width, format, type, pixels);
+}
+
+static void APIENTRY lazy_glMultiTexSubImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glMultiTexSubImage2DEXT = (PFNGLMULTITEXSUBIMAGE2DEXTPROC)gladLazyResolve("glMultiTexSubImage2DEXT");
+	glad_glMultiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY lazy_glCopyMultiTexImage1DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	glad_glCopyMultiTexImage1DEXT = (PFNGLCOPYMULTITEXIMAGE1DEXTPROC)gladLazyResolve("glCopyMultiTexImage1DEXT");
+	glad_glCopyMultiTexImage1DEXT(texunit, target, level, internalformat, x, y, width, border);
+}
+
+static void APIENTRY lazy_glCopyMultiTexImage2DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	glad_glCopyMultiTexImage2DEXT = (PFNGLCOPYMULTITEXIMAGE2DEXTPROC)gladLazyResolve("glCopyMultiTexImage2DEXT");
+	glad_glCopyMultiTexImage2DEXT(texunit, target, level, internalformat, x, y, width, height, border);
+}
+
+static void APIENTRY lazy_glCopyMultiTexSubImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyMultiTexSubImage1DEXT = (PFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC)gladLazyResolve("glCopyMultiTexSubImage1DEXT");
+	glad_glCopyMultiTexSubImage1DEXT(texunit, target, level, xoffset, x, y, width);
+}
+
+static void APIENTRY lazy_glCopyMultiTexSubImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyMultiTexSubImage2DEXT = (PFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC)gladLazyResolve("glCopyMultiTexSubImage2DEXT");
+	glad_glCopyMultiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void APIENTRY lazy_glGetMultiTexImageEXT(GLenum texunit, GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	glad_glGetMultiTexImageEXT = (PFNGLGETMULTITEXIMAGEEXTPROC)gladLazyResolve("glGetMultiTexImageEXT");
+	glad_glGetMultiTexImageEXT(texunit, target, level, format, type, pixels);
+}
+
+static void APIENTRY lazy_glGetMultiTexParameterfvEXT(GLenum texunit, GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetMultiTexParameterfvEXT = (PFNGLGETMULTITEXPARAMETERFVEXTPROC)gladLazyResolve("glGetMultiTexParameterfvEXT");
+	glad_glGetMultiTexParameterfvEXT(texunit, target, pname, params);
+}
+
+static void APIENTRY lazy_glGetMultiTexParameterivEXT(GLenum texunit, GLenum target, GLenum pname, GLint *params) {
+	glad_glGetMultiTexParameterivEXT = (PFNGLGETMULTITEXPARAMETERIVEXTPROC)gladLazyResolve("glGetMultiTexParameterivEXT");
+	glad_glGetMultiTexParameterivEXT(texunit, target, pname, params);
+}
+
+static void APIENTRY lazy_glGetMultiTexLevelParameterfvEXT(GLenum texunit, GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	glad_glGetMultiTexLevelParameterfvEXT = (PFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC)gladLazyResolve("glGetMultiTexLevelParameterfvEXT");
+	glad_glGetMultiTexLevelParameterfvEXT(texunit, target, level, pname, params);
+}
+
+static void APIENTRY lazy_glGetMultiTexLevelParameterivEXT(GLenum texunit, GLenum target, GLint level, GLenum pname, GLint *params) {
+	glad_glGetMultiTexLevelParameterivEXT = (PFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC)gladLazyResolve("glGetMultiTexLevelParameterivEXT");
+	glad_glGetMultiTexLevelParameterivEXT(texunit, target, level, pname, params);
+}
+
+static void APIENTRY lazy_glMultiTexImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glMultiTexImage3DEXT = (PFNGLMULTITEXIMAGE3DEXTPROC)gladLazyResolve("glMultiTexImage3DEXT");
+	glad_glMultiTexImage3DEXT(texunit, target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static void APIENTRY lazy_glMultiTexSubImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glMultiTexSubImage3DEXT = (PFNGLMULTITEXSUBIMAGE3DEXTPROC)gladLazyResolve("glMultiTexSubImage3DEXT");
+	glad_glMultiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void APIENTRY lazy_glCopyMultiTexSubImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyMultiTexSubImage3DEXT = (PFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC)gladLazyResolve("glCopyMultiTexSubImage3DEXT");
+	glad_glCopyMultiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void APIENTRY lazy_glEnableClientStateIndexedEXT(GLenum array, GLuint index) {
+	glad_glEnableClientStateIndexedEXT = (PFNGLENABLECLIENTSTATEINDEXEDEXTPROC)gladLazyResolve("glEnableClientStateIndexedEXT");
+	glad_glEnableClientStateIndexedEXT(array, index);
+}
+
+static void APIENTRY lazy_glDisableClientStateIndexedEXT(GLenum array, GLuint index) {
+	glad_glDisableClientStateIndexedEXT = (PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC)gladLazyResolve("glDisableClientStateIndexedEXT");
+	glad_glDisableClientStateIndexedEXT(array, index);
+}
+
+static void APIENTRY lazy_glGetFloatIndexedvEXT(GLenum target, GLuint index, GLfloat *data) {
+	glad_glGetFloatIndexedvEXT = (PFNGLGETFLOATINDEXEDVEXTPROC)gladLazyResolve("glGetFloatIndexedvEXT");
+	glad_glGetFloatIndexedvEXT(target, index, data);
+}
+
+static void APIENTRY lazy_glGetDoubleIndexedvEXT(GLenum target, GLuint index, GLdouble *data) {
+	glad_glGetDoubleIndexedvEXT = (PFNGLGETDOUBLEINDEXEDVEXTPROC)gladLazyResolve("glGetDoubleIndexedvEXT");
+	glad_glGetDoubleIndexedvEXT(target, index, data);
+}
+
+static void APIENTRY lazy_glGetPointerIndexedvEXT(GLenum target, GLuint index, void **data) {
+	glad_glGetPointerIndexedvEXT = (PFNGLGETPOINTERINDEXEDVEXTPROC)gladLazyResolve("glGetPointerIndexedvEXT");
+	glad_glGetPointerIndexedvEXT(target, index, data);
+}
+
+static void APIENTRY lazy_glEnableIndexedEXT(GLenum target, GLuint index) {
+	glad_glEnableIndexedEXT = (PFNGLENABLEINDEXEDEXTPROC)gladLazyResolve("glEnableIndexedEXT");
+	glad_glEnableIndexedEXT(target, index);
+}
+
+static void APIENTRY lazy_glDisableIndexedEXT(GLenum target, GLuint index) {
+	glad_glDisableIndexedEXT = (PFNGLDISABLEINDEXEDEXTPROC)gladLazyResolve("glDisableIndexedEXT");
+	glad_glDisableIndexedEXT(target, index);
+}
+
+static GLboolean APIENTRY lazy_glIsEnabledIndexedEXT(GLenum target, GLuint index) {
+	glad_glIsEnabledIndexedEXT = (PFNGLISENABLEDINDEXEDEXTPROC)gladLazyResolve("glIsEnabledIndexedEXT");
+	return glad_glIsEnabledIndexedEXT(target, index);
+}
+
+static void APIENTRY lazy_glGetIntegerIndexedvEXT(GLenum target, GLuint index, GLint *data) {
+	glad_glGetIntegerIndexedvEXT = (PFNGLGETINTEGERINDEXEDVEXTPROC)gladLazyResolve("glGetIntegerIndexedvEXT");
+	glad_glGetIntegerIndexedvEXT(target, index, data);
+}
+
+static void APIENTRY lazy_glGetBooleanIndexedvEXT(GLenum target, GLuint index, GLboolean *data) {
+	glad_glGetBooleanIndexedvEXT = (PFNGLGETBOOLEANINDEXEDVEXTPROC)gladLazyResolve("glGetBooleanIndexedvEXT");
+	glad_glGetBooleanIndexedvEXT(target, index, data);
+}
+
+static void APIENTRY lazy_glCompressedTextureImage3DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *bits) {
+	glad_glCompressedTextureImage3DEXT = (PFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC)gladLazyResolve("glCompressedTextureImage3DEXT");
+	glad_glCompressedTextureImage3DEXT(texture, target, level, internalformat, width, height, depth, border, imageSize, bits);
+}
+
+static void APIENTRY lazy_glCompressedTextureImage2DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *bits) {
+	glad_glCompressedTextureImage2DEXT = (PFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC)gladLazyResolve("glCompressedTextureImage2DEXT");
+	glad_glCompressedTextureImage2DEXT(texture, target, level, internalformat, width, height, border, imageSize, bits);
+}
+
+static void APIENTRY lazy_glCompressedTextureImage1DEXT(GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *bits) {
+	glad_glCompressedTextureImage1DEXT = (PFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC)gladLazyResolve("glCompressedTextureImage1DEXT");
+	glad_glCompressedTextureImage1DEXT(texture, target, level, internalformat, width, border, imageSize, bits);
+}
+
+static void APIENTRY lazy_glCompressedTextureSubImage3DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *bits) {
+	glad_glCompressedTextureSubImage3DEXT = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC)gladLazyResolve("glCompressedTextureSubImage3DEXT");
+	glad_glCompressedTextureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits);
+}
+
+static void APIENTRY lazy_glCompressedTextureSubImage2DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *bits) {
+	glad_glCompressedTextureSubImage2DEXT = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC)gladLazyResolve("glCompressedTextureSubImage2DEXT");
+	glad_glCompressedTextureSubImage2DEXT(texture, target, level, xoffset, yoffset, width, height, format, imageSize, bits);
+}
+
+static void APIENTRY lazy_glCompressedTextureSubImage1DEXT(GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *bits) {
+	glad_glCompressedTextureSubImage1DEXT = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC)gladLazyResolve("glCompressedTextureSubImage1DEXT");
+	glad_glCompressedTextureSubImage1DEXT(texture, target, level, xoffset, width, format, imageSize, bits);
+}
+
+static void APIENTRY lazy_glGetCompressedTextureImageEXT(GLuint texture, GLenum target, GLint lod, void *img) {
+	glad_glGetCompressedTextureImageEXT = (PFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC)gladLazyResolve("glGetCompressedTextureImageEXT");
+	glad_glGetCompressedTextureImageEXT(texture, target, lod, img);
+}
+
+static void APIENTRY lazy_glCompressedMultiTexImage3DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *bits) {
+	glad_glCompressedMultiTexImage3DEXT = (PFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC)gladLazyResolve("glCompressedMultiTexImage3DEXT");
+	glad_glCompressedMultiTexImage3DEXT(texunit, target, level, internalformat, width, height, depth, border, imageSize, bits);
+}
+
+static void APIENTRY lazy_glCompressedMultiTexImage2DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *bits) {
+	glad_glCompressedMultiTexImage2DEXT = (PFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC)gladLazyResolve("glCompressedMultiTexImage2DEXT");
+	glad_glCompressedMultiTexImage2DEXT(texunit, target, level, internalformat, width, height, border, imageSize, bits);
+}
+
+static void APIENTRY lazy_glCompressedMultiTexImage1DEXT(GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *bits) {
+	glad_glCompressedMultiTexImage1DEXT = (PFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC)gladLazyResolve("glCompressedMultiTexImage1DEXT");
+	glad_glCompressedMultiTexImage1DEXT(texunit, target, level, internalformat, width, border, imageSize, bits);
+}
+
+static void APIENTRY lazy_glCompressedMultiTexSubImage3DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *bits) {
+	glad_glCompressedMultiTexSubImage3DEXT = (PFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC)gladLazyResolve("glCompressedMultiTexSubImage3DEXT");
+	glad_glCompressedMultiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, bits);
+}
+
+static void APIENTRY lazy_glCompressedMultiTexSubImage2DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *bits) {
+	glad_glCompressedMultiTexSubImage2DEXT = (PFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC)gladLazyResolve("glCompressedMultiTexSubImage2DEXT");
+	glad_glCompressedMultiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, width, height, format, imageSize, bits);
+}
+
+static void APIENTRY lazy_glCompressedMultiTexSubImage1DEXT(GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *bits) {
+	glad_glCompressedMultiTexSubImage1DEXT = (PFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC)gladLazyResolve("glCompressedMultiTexSubImage1DEXT");
+	glad_glCompressedMultiTexSubImage1DEXT(texunit, target, level, xoffset, width, format, imageSize, bits);
+}
+
+static void APIENTRY lazy_glGetCompressedMultiTexImageEXT(GLenum texunit, GLenum target, GLint lod, void *img) {
+	glad_glGetCompressedMultiTexImageEXT = (PFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC)gladLazyResolve("glGetCompressedMultiTexImageEXT");
+	glad_glGetCompressedMultiTexImageEXT(texunit, target, lod, img);
+}
+
+static void APIENTRY lazy_glMatrixLoadTransposefEXT(GLenum mode, const GLfloat *m) {
+	glad_glMatrixLoadTransposefEXT = (PFNGLMATRIXLOADTRANSPOSEFEXTPROC)gladLazyResolve("glMatrixLoadTransposefEXT");
+	glad_glMatrixLoadTransposefEXT(mode, m);
+}
+
+static void APIENTRY lazy_glMatrixLoadTransposedEXT(GLenum mode, const GLdouble *m) {
+	glad_glMatrixLoadTransposedEXT = (PFNGLMATRIXLOADTRANSPOSEDEXTPROC)gladLazyResolve("glMatrixLoadTransposedEXT");
+	glad_glMatrixLoadTransposedEXT(mode, m);
+}
+
+static void APIENTRY lazy_glMatrixMultTransposefEXT(GLenum mode, const GLfloat *m) {
+	glad_glMatrixMultTransposefEXT = (PFNGLMATRIXMULTTRANSPOSEFEXTPROC)gladLazyResolve("glMatrixMultTransposefEXT");
+	glad_glMatrixMultTransposefEXT(mode, m);
+}
+
+static void APIENTRY lazy_glMatrixMultTransposedEXT(GLenum mode, const GLdouble *m) {
+	glad_glMatrixMultTransposedEXT = (PFNGLMATRIXMULTTRANSPOSEDEXTPROC)gladLazyResolve("glMatrixMultTransposedEXT");
+	glad_glMatrixMultTransposedEXT(mode, m);
+}
+
+static void APIENTRY lazy_glNamedBufferDataEXT(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_glNamedBufferDataEXT = (PFNGLNAMEDBUFFERDATAEXTPROC)gladLazyResolve("glNamedBufferDataEXT");
+	glad_glNamedBufferDataEXT(buffer, size, data, usage);
+}
+
+static void APIENTRY lazy_glNamedBufferSubDataEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glNamedBufferSubDataEXT = (PFNGLNAMEDBUFFERSUBDATAEXTPROC)gladLazyResolve("glNamedBufferSubDataEXT");
+	glad_glNamedBufferSubDataEXT(buffer, offset, size, data);
+}
+
+static void * APIENTRY lazy_glMapNamedBufferEXT(GLuint buffer, GLenum access) {
+	glad_glMapNamedBufferEXT = (PFNGLMAPNAMEDBUFFEREXTPROC)gladLazyResolve("glMapNamedBufferEXT");
+	return glad_glMapNamedBufferEXT(buffer, access);
+}
+
+static GLboolean APIENTRY lazy_glUnmapNamedBufferEXT(GLuint buffer) {
+	glad_glUnmapNamedBufferEXT = (PFNGLUNMAPNAMEDBUFFEREXTPROC)gladLazyResolve("glUnmapNamedBufferEXT");
+	return glad_glUnmapNamedBufferEXT(buffer);
+}
+
+static void APIENTRY lazy_glGetNamedBufferParameterivEXT(GLuint buffer, GLenum pname, GLint *params) {
+	glad_glGetNamedBufferParameterivEXT = (PFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC)gladLazyResolve("glGetNamedBufferParameterivEXT");
+	glad_glGetNamedBufferParameterivEXT(buffer, pname, params);
+}
+
+static void APIENTRY lazy_glGetNamedBufferPointervEXT(GLuint buffer, GLenum pname, void **params) {
+	glad_glGetNamedBufferPointervEXT = (PFNGLGETNAMEDBUFFERPOINTERVEXTPROC)gladLazyResolve("glGetNamedBufferPointervEXT");
+	glad_glGetNamedBufferPointervEXT(buffer, pname, params);
+}
+
+static void APIENTRY lazy_glGetNamedBufferSubDataEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) {
+	glad_glGetNamedBufferSubDataEXT = (PFNGLGETNAMEDBUFFERSUBDATAEXTPROC)gladLazyResolve("glGetNamedBufferSubDataEXT");
+	glad_glGetNamedBufferSubDataEXT(buffer, offset, size, data);
+}
+
+static void APIENTRY lazy_glProgramUniform1fEXT(GLuint program, GLint location, GLfloat v0) {
+	glad_glProgramUniform1fEXT = (PFNGLPROGRAMUNIFORM1FEXTPROC)gladLazyResolve("glProgramUniform1fEXT");
+	glad_glProgramUniform1fEXT(program, location, v0);
+}
+
+static void APIENTRY lazy_glProgramUniform2fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+	glad_glProgramUniform2fEXT = (PFNGLPROGRAMUNIFORM2FEXTPROC)gladLazyResolve("glProgramUniform2fEXT");
+	glad_glProgramUniform2fEXT(program, location, v0, v1);
+}
+
+static void APIENTRY lazy_glProgramUniform3fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_glProgramUniform3fEXT = (PFNGLPROGRAMUNIFORM3FEXTPROC)gladLazyResolve("glProgramUniform3fEXT");
+	glad_glProgramUniform3fEXT(program, location, v0, v1, v2);
+}
+
+static void APIENTRY lazy_glProgramUniform4fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_glProgramUniform4fEXT = (PFNGLPROGRAMUNIFORM4FEXTPROC)gladLazyResolve("glProgramUniform4fEXT");
+	glad_glProgramUniform4fEXT(program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY lazy_glProgramUniform1iEXT(GLuint program, GLint location, GLint v0) {
+	glad_glProgramUniform1iEXT = (PFNGLPROGRAMUNIFORM1IEXTPROC)gladLazyResolve("glProgramUniform1iEXT");
+	glad_glProgramUniform1iEXT(program, location, v0);
+}
+
+static void APIENTRY lazy_glProgramUniform2iEXT(GLuint program, GLint location, GLint v0, GLint v1) {
+	glad_glProgramUniform2iEXT = (PFNGLPROGRAMUNIFORM2IEXTPROC)gladLazyResolve("glProgramUniform2iEXT");
+	glad_glProgramUniform2iEXT(program, location, v0, v1);
+}
+
+static void APIENTRY lazy_glProgramUniform3iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_glProgramUniform3iEXT = (PFNGLPROGRAMUNIFORM3IEXTPROC)gladLazyResolve("glProgramUniform3iEXT");
+	glad_glProgramUniform3iEXT(program, location, v0, v1, v2);
+}
+
+static void APIENTRY lazy_glProgramUniform4iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_glProgramUniform4iEXT = (PFNGLPROGRAMUNIFORM4IEXTPROC)gladLazyResolve("glProgramUniform4iEXT");
+	glad_glProgramUniform4iEXT(program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY lazy_glProgramUniform1fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform1fvEXT = (PFNGLPROGRAMUNIFORM1FVEXTPROC)gladLazyResolve("glProgramUniform1fvEXT");
+	glad_glProgramUniform1fvEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform2fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform2fvEXT = (PFNGLPROGRAMUNIFORM2FVEXTPROC)gladLazyResolve("glProgramUniform2fvEXT");
+	glad_glProgramUniform2fvEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform3fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform3fvEXT = (PFNGLPROGRAMUNIFORM3FVEXTPROC)gladLazyResolve("glProgramUniform3fvEXT");
+	glad_glProgramUniform3fvEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform4fvEXT(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform4fvEXT = (PFNGLPROGRAMUNIFORM4FVEXTPROC)gladLazyResolve("glProgramUniform4fvEXT");
+	glad_glProgramUniform4fvEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform1ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform1ivEXT = (PFNGLPROGRAMUNIFORM1IVEXTPROC)gladLazyResolve("glProgramUniform1ivEXT");
+	glad_glProgramUniform1ivEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform2ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform2ivEXT = (PFNGLPROGRAMUNIFORM2IVEXTPROC)gladLazyResolve("glProgramUniform2ivEXT");
+	glad_glProgramUniform2ivEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform3ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform3ivEXT = (PFNGLPROGRAMUNIFORM3IVEXTPROC)gladLazyResolve("glProgramUniform3ivEXT");
+	glad_glProgramUniform3ivEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform4ivEXT(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform4ivEXT = (PFNGLPROGRAMUNIFORM4IVEXTPROC)gladLazyResolve("glProgramUniform4ivEXT");
+	glad_glProgramUniform4ivEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2fvEXT = (PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC)gladLazyResolve("glProgramUniformMatrix2fvEXT");
+	glad_glProgramUniformMatrix2fvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3fvEXT = (PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC)gladLazyResolve("glProgramUniformMatrix3fvEXT");
+	glad_glProgramUniformMatrix3fvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4fvEXT = (PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC)gladLazyResolve("glProgramUniformMatrix4fvEXT");
+	glad_glProgramUniformMatrix4fvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix2x3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2x3fvEXT = (PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC)gladLazyResolve("glProgramUniformMatrix2x3fvEXT");
+	glad_glProgramUniformMatrix2x3fvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix3x2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3x2fvEXT = (PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC)gladLazyResolve("glProgramUniformMatrix3x2fvEXT");
+	glad_glProgramUniformMatrix3x2fvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix2x4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2x4fvEXT = (PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC)gladLazyResolve("glProgramUniformMatrix2x4fvEXT");
+	glad_glProgramUniformMatrix2x4fvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix4x2fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4x2fvEXT = (PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC)gladLazyResolve("glProgramUniformMatrix4x2fvEXT");
+	glad_glProgramUniformMatrix4x2fvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix3x4fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3x4fvEXT = (PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC)gladLazyResolve("glProgramUniformMatrix3x4fvEXT");
+	glad_glProgramUniformMatrix3x4fvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix4x3fvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4x3fvEXT = (PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC)gladLazyResolve("glProgramUniformMatrix4x3fvEXT");
+	glad_glProgramUniformMatrix4x3fvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glTextureBufferEXT(GLuint texture, GLenum target, GLenum internalformat, GLuint buffer) {
+	glad_glTextureBufferEXT = (PFNGLTEXTUREBUFFEREXTPROC)gladLazyResolve("glTextureBufferEXT");
+	glad_glTextureBufferEXT(texture, target, internalformat, buffer);
+}
+
+static void APIENTRY lazy_glMultiTexBufferEXT(GLenum texunit, GLenum target, GLenum internalformat, GLuint buffer) {
+	glad_glMultiTexBufferEXT = (PFNGLMULTITEXBUFFEREXTPROC)gladLazyResolve("glMultiTexBufferEXT");
+	glad_glMultiTexBufferEXT(texunit, target, internalformat, buffer);
+}
+
+static void APIENTRY lazy_glTextureParameterIivEXT(GLuint texture, GLenum target, GLenum pname, const GLint *params) {
+	glad_glTextureParameterIivEXT = (PFNGLTEXTUREPARAMETERIIVEXTPROC)gladLazyResolve("glTextureParameterIivEXT");
+	glad_glTextureParameterIivEXT(texture, target, pname, params);
+}
+
+static void APIENTRY lazy_glTextureParameterIuivEXT(GLuint texture, GLenum target, GLenum pname, const GLuint *params) {
+	glad_glTextureParameterIuivEXT = (PFNGLTEXTUREPARAMETERIUIVEXTPROC)gladLazyResolve("glTextureParameterIuivEXT");
+	glad_glTextureParameterIuivEXT(texture, target, pname, params);
+}
+
+static void APIENTRY lazy_glGetTextureParameterIivEXT(GLuint texture, GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTextureParameterIivEXT = (PFNGLGETTEXTUREPARAMETERIIVEXTPROC)gladLazyResolve("glGetTextureParameterIivEXT");
+	glad_glGetTextureParameterIivEXT(texture, target, pname, params);
+}
+
+static void APIENTRY lazy_glGetTextureParameterIuivEXT(GLuint texture, GLenum target, GLenum pname, GLuint *params) {
+	glad_glGetTextureParameterIuivEXT = (PFNGLGETTEXTUREPARAMETERIUIVEXTPROC)gladLazyResolve("glGetTextureParameterIuivEXT");
+	glad_glGetTextureParameterIuivEXT(texture, target, pname, params);
+}
+
+static void APIENTRY lazy_glMultiTexParameterIivEXT(GLenum texunit, GLenum target, GLenum pname, const GLint *params) {
+	glad_glMultiTexParameterIivEXT = (PFNGLMULTITEXPARAMETERIIVEXTPROC)gladLazyResolve("glMultiTexParameterIivEXT");
+	glad_glMultiTexParameterIivEXT(texunit, target, pname, params);
+}
+
+static void APIENTRY lazy_glMultiTexParameterIuivEXT(GLenum texunit, GLenum target, GLenum pname, const GLuint *params) {
+	glad_glMultiTexParameterIuivEXT = (PFNGLMULTITEXPARAMETERIUIVEXTPROC)gladLazyResolve("glMultiTexParameterIuivEXT");
+	glad_glMultiTexParameterIuivEXT(texunit, target, pname, params);
+}
+
+static void APIENTRY lazy_glGetMultiTexParameterIivEXT(GLenum texunit, GLenum target, GLenum pname, GLint *params) {
+	glad_glGetMultiTexParameterIivEXT = (PFNGLGETMULTITEXPARAMETERIIVEXTPROC)gladLazyResolve("glGetMultiTexParameterIivEXT");
+	glad_glGetMultiTexParameterIivEXT(texunit, target, pname, params);
+}
+
+static void APIENTRY lazy_glGetMultiTexParameterIuivEXT(GLenum texunit, GLenum target, GLenum pname, GLuint *params) {
+	glad_glGetMultiTexParameterIuivEXT = (PFNGLGETMULTITEXPARAMETERIUIVEXTPROC)gladLazyResolve("glGetMultiTexParameterIuivEXT");
+	glad_glGetMultiTexParameterIuivEXT(texunit, target, pname, params);
+}
+
+static void APIENTRY lazy_glProgramUniform1uiEXT(GLuint program, GLint location, GLuint v0) {
+	glad_glProgramUniform1uiEXT = (PFNGLPROGRAMUNIFORM1UIEXTPROC)gladLazyResolve("glProgramUniform1uiEXT");
+	glad_glProgramUniform1uiEXT(program, location, v0);
+}
+
+static void APIENTRY lazy_glProgramUniform2uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1) {
+	glad_glProgramUniform2uiEXT = (PFNGLPROGRAMUNIFORM2UIEXTPROC)gladLazyResolve("glProgramUniform2uiEXT");
+	glad_glProgramUniform2uiEXT(program, location, v0, v1);
+}
+
+static void APIENTRY lazy_glProgramUniform3uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_glProgramUniform3uiEXT = (PFNGLPROGRAMUNIFORM3UIEXTPROC)gladLazyResolve("glProgramUniform3uiEXT");
+	glad_glProgramUniform3uiEXT(program, location, v0, v1, v2);
+}
+
+static void APIENTRY lazy_glProgramUniform4uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_glProgramUniform4uiEXT = (PFNGLPROGRAMUNIFORM4UIEXTPROC)gladLazyResolve("glProgramUniform4uiEXT");
+	glad_glProgramUniform4uiEXT(program, location, v0, v1, v2, v3);
+}
+
+static void APIENTRY lazy_glProgramUniform1uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform1uivEXT = (PFNGLPROGRAMUNIFORM1UIVEXTPROC)gladLazyResolve("glProgramUniform1uivEXT");
+	glad_glProgramUniform1uivEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform2uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform2uivEXT = (PFNGLPROGRAMUNIFORM2UIVEXTPROC)gladLazyResolve("glProgramUniform2uivEXT");
+	glad_glProgramUniform2uivEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform3uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform3uivEXT = (PFNGLPROGRAMUNIFORM3UIVEXTPROC)gladLazyResolve("glProgramUniform3uivEXT");
+	glad_glProgramUniform3uivEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform4uivEXT(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform4uivEXT = (PFNGLPROGRAMUNIFORM4UIVEXTPROC)gladLazyResolve("glProgramUniform4uivEXT");
+	glad_glProgramUniform4uivEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glNamedProgramLocalParameters4fvEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLfloat *params) {
+	glad_glNamedProgramLocalParameters4fvEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC)gladLazyResolve("glNamedProgramLocalParameters4fvEXT");
+	glad_glNamedProgramLocalParameters4fvEXT(program, target, index, count, params);
+}
+
+static void APIENTRY lazy_glNamedProgramLocalParameterI4iEXT(GLuint program, GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glad_glNamedProgramLocalParameterI4iEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC)gladLazyResolve("glNamedProgramLocalParameterI4iEXT");
+	glad_glNamedProgramLocalParameterI4iEXT(program, target, index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glNamedProgramLocalParameterI4ivEXT(GLuint program, GLenum target, GLuint index, const GLint *params) {
+	glad_glNamedProgramLocalParameterI4ivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC)gladLazyResolve("glNamedProgramLocalParameterI4ivEXT");
+	glad_glNamedProgramLocalParameterI4ivEXT(program, target, index, params);
+}
+
+static void APIENTRY lazy_glNamedProgramLocalParametersI4ivEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLint *params) {
+	glad_glNamedProgramLocalParametersI4ivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC)gladLazyResolve("glNamedProgramLocalParametersI4ivEXT");
+	glad_glNamedProgramLocalParametersI4ivEXT(program, target, index, count, params);
+}
+
+static void APIENTRY lazy_glNamedProgramLocalParameterI4uiEXT(GLuint program, GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glad_glNamedProgramLocalParameterI4uiEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC)gladLazyResolve("glNamedProgramLocalParameterI4uiEXT");
+	glad_glNamedProgramLocalParameterI4uiEXT(program, target, index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glNamedProgramLocalParameterI4uivEXT(GLuint program, GLenum target, GLuint index, const GLuint *params) {
+	glad_glNamedProgramLocalParameterI4uivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC)gladLazyResolve("glNamedProgramLocalParameterI4uivEXT");
+	glad_glNamedProgramLocalParameterI4uivEXT(program, target, index, params);
+}
+
+static void APIENTRY lazy_glNamedProgramLocalParametersI4uivEXT(GLuint program, GLenum target, GLuint index, GLsizei count, const GLuint *params) {
+	glad_glNamedProgramLocalParametersI4uivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC)gladLazyResolve("glNamedProgramLocalParametersI4uivEXT");
+	glad_glNamedProgramLocalParametersI4uivEXT(program, target, index, count, params);
+}
+
+static void APIENTRY lazy_glGetNamedProgramLocalParameterIivEXT(GLuint program, GLenum target, GLuint index, GLint *params) {
+	glad_glGetNamedProgramLocalParameterIivEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC)gladLazyResolve("glGetNamedProgramLocalParameterIivEXT");
+	glad_glGetNamedProgramLocalParameterIivEXT(program, target, index, params);
+}
+
+static void APIENTRY lazy_glGetNamedProgramLocalParameterIuivEXT(GLuint program, GLenum target, GLuint index, GLuint *params) {
+	glad_glGetNamedProgramLocalParameterIuivEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC)gladLazyResolve("glGetNamedProgramLocalParameterIuivEXT");
+	glad_glGetNamedProgramLocalParameterIuivEXT(program, target, index, params);
+}
+
+static void APIENTRY lazy_glEnableClientStateiEXT(GLenum array, GLuint index) {
+	glad_glEnableClientStateiEXT = (PFNGLENABLECLIENTSTATEIEXTPROC)gladLazyResolve("glEnableClientStateiEXT");
+	glad_glEnableClientStateiEXT(array, index);
+}
+
+static void APIENTRY lazy_glDisableClientStateiEXT(GLenum array, GLuint index) {
+	glad_glDisableClientStateiEXT = (PFNGLDISABLECLIENTSTATEIEXTPROC)gladLazyResolve("glDisableClientStateiEXT");
+	glad_glDisableClientStateiEXT(array, index);
+}
+
+static void APIENTRY lazy_glGetFloati_vEXT(GLenum pname, GLuint index, GLfloat *params) {
+	glad_glGetFloati_vEXT = (PFNGLGETFLOATI_VEXTPROC)gladLazyResolve("glGetFloati_vEXT");
+	glad_glGetFloati_vEXT(pname, index, params);
+}
+
+static void APIENTRY lazy_glGetDoublei_vEXT(GLenum pname, GLuint index, GLdouble *params) {
+	glad_glGetDoublei_vEXT = (PFNGLGETDOUBLEI_VEXTPROC)gladLazyResolve("glGetDoublei_vEXT");
+	glad_glGetDoublei_vEXT(pname, index, params);
+}
+
+static void APIENTRY lazy_glGetPointeri_vEXT(GLenum pname, GLuint index, void **params) {
+	glad_glGetPointeri_vEXT = (PFNGLGETPOINTERI_VEXTPROC)gladLazyResolve("glGetPointeri_vEXT");
+	glad_glGetPointeri_vEXT(pname, index, params);
+}
+
+static void APIENTRY lazy_glNamedProgramStringEXT(GLuint program, GLenum target, GLenum format, GLsizei len, const void *string) {
+	glad_glNamedProgramStringEXT = (PFNGLNAMEDPROGRAMSTRINGEXTPROC)gladLazyResolve("glNamedProgramStringEXT");
+	glad_glNamedProgramStringEXT(program, target, format, len, string);
+}
+
+static void APIENTRY lazy_glNamedProgramLocalParameter4dEXT(GLuint program, GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glNamedProgramLocalParameter4dEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC)gladLazyResolve("glNamedProgramLocalParameter4dEXT");
+	glad_glNamedProgramLocalParameter4dEXT(program, target, index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glNamedProgramLocalParameter4dvEXT(GLuint program, GLenum target, GLuint index, const GLdouble *params) {
+	glad_glNamedProgramLocalParameter4dvEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC)gladLazyResolve("glNamedProgramLocalParameter4dvEXT");
+	glad_glNamedProgramLocalParameter4dvEXT(program, target, index, params);
+}
+
+static void APIENTRY lazy_glNamedProgramLocalParameter4fEXT(GLuint program, GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glNamedProgramLocalParameter4fEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC)gladLazyResolve("glNamedProgramLocalParameter4fEXT");
+	glad_glNamedProgramLocalParameter4fEXT(program, target, index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glNamedProgramLocalParameter4fvEXT(GLuint program, GLenum target, GLuint index, const GLfloat *params) {
+	glad_glNamedProgramLocalParameter4fvEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC)gladLazyResolve("glNamedProgramLocalParameter4fvEXT");
+	glad_glNamedProgramLocalParameter4fvEXT(program, target, index, params);
+}
+
+static void APIENTRY lazy_glGetNamedProgramLocalParameterdvEXT(GLuint program, GLenum target, GLuint index, GLdouble *params) {
+	glad_glGetNamedProgramLocalParameterdvEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC)gladLazyResolve("glGetNamedProgramLocalParameterdvEXT");
+	glad_glGetNamedProgramLocalParameterdvEXT(program, target, index, params);
+}
+
+static void APIENTRY lazy_glGetNamedProgramLocalParameterfvEXT(GLuint program, GLenum target, GLuint index, GLfloat *params) {
+	glad_glGetNamedProgramLocalParameterfvEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC)gladLazyResolve("glGetNamedProgramLocalParameterfvEXT");
+	glad_glGetNamedProgramLocalParameterfvEXT(program, target, index, params);
+}
+
+static void APIENTRY lazy_glGetNamedProgramivEXT(GLuint program, GLenum target, GLenum pname, GLint *params) {
+	glad_glGetNamedProgramivEXT = (PFNGLGETNAMEDPROGRAMIVEXTPROC)gladLazyResolve("glGetNamedProgramivEXT");
+	glad_glGetNamedProgramivEXT(program, target, pname, params);
+}
+
+static void APIENTRY lazy_glGetNamedProgramStringEXT(GLuint program, GLenum target, GLenum pname, void *string) {
+	glad_glGetNamedProgramStringEXT = (PFNGLGETNAMEDPROGRAMSTRINGEXTPROC)gladLazyResolve("glGetNamedProgramStringEXT");
+	glad_glGetNamedProgramStringEXT(program, target, pname, string);
+}
+
+static void APIENTRY lazy_glNamedRenderbufferStorageEXT(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glNamedRenderbufferStorageEXT = (PFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC)gladLazyResolve("glNamedRenderbufferStorageEXT");
+	glad_glNamedRenderbufferStorageEXT(renderbuffer, internalformat, width, height);
+}
+
+static void APIENTRY lazy_glGetNamedRenderbufferParameterivEXT(GLuint renderbuffer, GLenum pname, GLint *params) {
+	glad_glGetNamedRenderbufferParameterivEXT = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC)gladLazyResolve("glGetNamedRenderbufferParameterivEXT");
+	glad_glGetNamedRenderbufferParameterivEXT(renderbuffer, pname, params);
+}
+
+static void APIENTRY lazy_glNamedRenderbufferStorageMultisampleEXT(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glNamedRenderbufferStorageMultisampleEXT = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)gladLazyResolve("glNamedRenderbufferStorageMultisampleEXT");
+	glad_glNamedRenderbufferStorageMultisampleEXT(renderbuffer, samples, internalformat, width, height);
+}
+
+static void APIENTRY lazy_glNamedRenderbufferStorageMultisampleCoverageEXT(GLuint renderbuffer, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glNamedRenderbufferStorageMultisampleCoverageEXT = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC)gladLazyResolve("glNamedRenderbufferStorageMultisampleCoverageEXT");
+	glad_glNamedRenderbufferStorageMultisampleCoverageEXT(renderbuffer, coverageSamples, colorSamples, internalformat, width, height);
+}
+
+static GLenum APIENTRY lazy_glCheckNamedFramebufferStatusEXT(GLuint framebuffer, GLenum target) {
+	glad_glCheckNamedFramebufferStatusEXT = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC)gladLazyResolve("glCheckNamedFramebufferStatusEXT");
+	return glad_glCheckNamedFramebufferStatusEXT(framebuffer, target);
+}
+
+static void APIENTRY lazy_glNamedFramebufferTexture1DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glNamedFramebufferTexture1DEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC)gladLazyResolve("glNamedFramebufferTexture1DEXT");
+	glad_glNamedFramebufferTexture1DEXT(framebuffer, attachment, textarget, texture, level);
+}
+
+static void APIENTRY lazy_glNamedFramebufferTexture2DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glNamedFramebufferTexture2DEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC)gladLazyResolve("glNamedFramebufferTexture2DEXT");
+	glad_glNamedFramebufferTexture2DEXT(framebuffer, attachment, textarget, texture, level);
+}
+
+static void APIENTRY lazy_glNamedFramebufferTexture3DEXT(GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	glad_glNamedFramebufferTexture3DEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC)gladLazyResolve("glNamedFramebufferTexture3DEXT");
+	glad_glNamedFramebufferTexture3DEXT(framebuffer, attachment, textarget, texture, level, zoffset);
+}
+
+static void APIENTRY lazy_glNamedFramebufferRenderbufferEXT(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_glNamedFramebufferRenderbufferEXT = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC)gladLazyResolve("glNamedFramebufferRenderbufferEXT");
+	glad_glNamedFramebufferRenderbufferEXT(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void APIENTRY lazy_glGetNamedFramebufferAttachmentParameterivEXT(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) {
+	glad_glGetNamedFramebufferAttachmentParameterivEXT = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)gladLazyResolve("glGetNamedFramebufferAttachmentParameterivEXT");
+	glad_glGetNamedFramebufferAttachmentParameterivEXT(framebuffer, attachment, pname, params);
+}
+
+static void APIENTRY lazy_glGenerateTextureMipmapEXT(GLuint texture, GLenum target) {
+	glad_glGenerateTextureMipmapEXT = (PFNGLGENERATETEXTUREMIPMAPEXTPROC)gladLazyResolve("glGenerateTextureMipmapEXT");
+	glad_glGenerateTextureMipmapEXT(texture, target);
+}
+
+static void APIENTRY lazy_glGenerateMultiTexMipmapEXT(GLenum texunit, GLenum target) {
+	glad_glGenerateMultiTexMipmapEXT = (PFNGLGENERATEMULTITEXMIPMAPEXTPROC)gladLazyResolve("glGenerateMultiTexMipmapEXT");
+	glad_glGenerateMultiTexMipmapEXT(texunit, target);
+}
+
+static void APIENTRY lazy_glFramebufferDrawBufferEXT(GLuint framebuffer, GLenum mode) {
+	glad_glFramebufferDrawBufferEXT = (PFNGLFRAMEBUFFERDRAWBUFFEREXTPROC)gladLazyResolve("glFramebufferDrawBufferEXT");
+	glad_glFramebufferDrawBufferEXT(framebuffer, mode);
+}
+
+static void APIENTRY lazy_glFramebufferDrawBuffersEXT(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+	glad_glFramebufferDrawBuffersEXT = (PFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC)gladLazyResolve("glFramebufferDrawBuffersEXT");
+	glad_glFramebufferDrawBuffersEXT(framebuffer, n, bufs);
+}
+
+static void APIENTRY lazy_glFramebufferReadBufferEXT(GLuint framebuffer, GLenum mode) {
+	glad_glFramebufferReadBufferEXT = (PFNGLFRAMEBUFFERREADBUFFEREXTPROC)gladLazyResolve("glFramebufferReadBufferEXT");
+	glad_glFramebufferReadBufferEXT(framebuffer, mode);
+}
+
+static void APIENTRY lazy_glGetFramebufferParameterivEXT(GLuint framebuffer, GLenum pname, GLint *params) {
+	glad_glGetFramebufferParameterivEXT = (PFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC)gladLazyResolve("glGetFramebufferParameterivEXT");
+	glad_glGetFramebufferParameterivEXT(framebuffer, pname, params);
+}
+
+static void APIENTRY lazy_glNamedCopyBufferSubDataEXT(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_glNamedCopyBufferSubDataEXT = (PFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC)gladLazyResolve("glNamedCopyBufferSubDataEXT");
+	glad_glNamedCopyBufferSubDataEXT(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+
+static void APIENTRY lazy_glNamedFramebufferTextureEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+	glad_glNamedFramebufferTextureEXT = (PFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC)gladLazyResolve("glNamedFramebufferTextureEXT");
+	glad_glNamedFramebufferTextureEXT(framebuffer, attachment, texture, level);
+}
+
+static void APIENTRY lazy_glNamedFramebufferTextureLayerEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glNamedFramebufferTextureLayerEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC)gladLazyResolve("glNamedFramebufferTextureLayerEXT");
+	glad_glNamedFramebufferTextureLayerEXT(framebuffer, attachment, texture, level, layer);
+}
+
+static void APIENTRY lazy_glNamedFramebufferTextureFaceEXT(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLenum face) {
+	glad_glNamedFramebufferTextureFaceEXT = (PFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC)gladLazyResolve("glNamedFramebufferTextureFaceEXT");
+	glad_glNamedFramebufferTextureFaceEXT(framebuffer, attachment, texture, level, face);
+}
+
+static void APIENTRY lazy_glTextureRenderbufferEXT(GLuint texture, GLenum target, GLuint renderbuffer) {
+	glad_glTextureRenderbufferEXT = (PFNGLTEXTURERENDERBUFFEREXTPROC)gladLazyResolve("glTextureRenderbufferEXT");
+	glad_glTextureRenderbufferEXT(texture, target, renderbuffer);
+}
+
+static void APIENTRY lazy_glMultiTexRenderbufferEXT(GLenum texunit, GLenum target, GLuint renderbuffer) {
+	glad_glMultiTexRenderbufferEXT = (PFNGLMULTITEXRENDERBUFFEREXTPROC)gladLazyResolve("glMultiTexRenderbufferEXT");
+	glad_glMultiTexRenderbufferEXT(texunit, target, renderbuffer);
+}
+
+static void APIENTRY lazy_glVertexArrayVertexOffsetEXT(GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset) {
+	glad_glVertexArrayVertexOffsetEXT = (PFNGLVERTEXARRAYVERTEXOFFSETEXTPROC)gladLazyResolve("glVertexArrayVertexOffsetEXT");
+	glad_glVertexArrayVertexOffsetEXT(vaobj, buffer, size, type, stride, offset);
+}
+
+static void APIENTRY lazy_glVertexArrayColorOffsetEXT(GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset) {
+	glad_glVertexArrayColorOffsetEXT = (PFNGLVERTEXARRAYCOLOROFFSETEXTPROC)gladLazyResolve("glVertexArrayColorOffsetEXT");
+	glad_glVertexArrayColorOffsetEXT(vaobj, buffer, size, type, stride, offset);
+}
+
+static void APIENTRY lazy_glVertexArrayEdgeFlagOffsetEXT(GLuint vaobj, GLuint buffer, GLsizei stride, GLintptr offset) {
+	glad_glVertexArrayEdgeFlagOffsetEXT = (PFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC)gladLazyResolve("glVertexArrayEdgeFlagOffsetEXT");
+	glad_glVertexArrayEdgeFlagOffsetEXT(vaobj, buffer, stride, offset);
+}
+
+static void APIENTRY lazy_glVertexArrayIndexOffsetEXT(GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset) {
+	glad_glVertexArrayIndexOffsetEXT = (PFNGLVERTEXARRAYINDEXOFFSETEXTPROC)gladLazyResolve("glVertexArrayIndexOffsetEXT");
+	glad_glVertexArrayIndexOffsetEXT(vaobj, buffer, type, stride, offset);
+}
+
+static void APIENTRY lazy_glVertexArrayNormalOffsetEXT(GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset) {
+	glad_glVertexArrayNormalOffsetEXT = (PFNGLVERTEXARRAYNORMALOFFSETEXTPROC)gladLazyResolve("glVertexArrayNormalOffsetEXT");
+	glad_glVertexArrayNormalOffsetEXT(vaobj, buffer, type, stride, offset);
+}
+
+static void APIENTRY lazy_glVertexArrayTexCoordOffsetEXT(GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset) {
+	glad_glVertexArrayTexCoordOffsetEXT = (PFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC)gladLazyResolve("glVertexArrayTexCoordOffsetEXT");
+	glad_glVertexArrayTexCoordOffsetEXT(vaobj, buffer, size, type, stride, offset);
+}
+
+static void APIENTRY lazy_glVertexArrayMultiTexCoordOffsetEXT(GLuint vaobj, GLuint buffer, GLenum texunit, GLint size, GLenum type, GLsizei stride, GLintptr offset) {
+	glad_glVertexArrayMultiTexCoordOffsetEXT = (PFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC)gladLazyResolve("glVertexArrayMultiTexCoordOffsetEXT");
+	glad_glVertexArrayMultiTexCoordOffsetEXT(vaobj, buffer, texunit, size, type, stride, offset);
+}
+
+static void APIENTRY lazy_glVertexArrayFogCoordOffsetEXT(GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset) {
+	glad_glVertexArrayFogCoordOffsetEXT = (PFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC)gladLazyResolve("glVertexArrayFogCoordOffsetEXT");
+	glad_glVertexArrayFogCoordOffsetEXT(vaobj, buffer, type, stride, offset);
+}
+
+static void APIENTRY lazy_glVertexArraySecondaryColorOffsetEXT(GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset) {
+	glad_glVertexArraySecondaryColorOffsetEXT = (PFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC)gladLazyResolve("glVertexArraySecondaryColorOffsetEXT");
+	glad_glVertexArraySecondaryColorOffsetEXT(vaobj, buffer, size, type, stride, offset);
+}
+
+static void APIENTRY lazy_glVertexArrayVertexAttribOffsetEXT(GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLintptr offset) {
+	glad_glVertexArrayVertexAttribOffsetEXT = (PFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC)gladLazyResolve("glVertexArrayVertexAttribOffsetEXT");
+	glad_glVertexArrayVertexAttribOffsetEXT(vaobj, buffer, index, size, type, normalized, stride, offset);
+}
+
+static void APIENTRY lazy_glVertexArrayVertexAttribIOffsetEXT(GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset) {
+	glad_glVertexArrayVertexAttribIOffsetEXT = (PFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC)gladLazyResolve("glVertexArrayVertexAttribIOffsetEXT");
+	glad_glVertexArrayVertexAttribIOffsetEXT(vaobj, buffer, index, size, type, stride, offset);
+}
+
+static void APIENTRY lazy_glEnableVertexArrayEXT(GLuint vaobj, GLenum array) {
+	glad_glEnableVertexArrayEXT = (PFNGLENABLEVERTEXARRAYEXTPROC)gladLazyResolve("glEnableVertexArrayEXT");
+	glad_glEnableVertexArrayEXT(vaobj, array);
+}
+
+static void APIENTRY lazy_glDisableVertexArrayEXT(GLuint vaobj, GLenum array) {
+	glad_glDisableVertexArrayEXT = (PFNGLDISABLEVERTEXARRAYEXTPROC)gladLazyResolve("glDisableVertexArrayEXT");
+	glad_glDisableVertexArrayEXT(vaobj, array);
+}
+
+static void APIENTRY lazy_glEnableVertexArrayAttribEXT(GLuint vaobj, GLuint index) {
+	glad_glEnableVertexArrayAttribEXT = (PFNGLENABLEVERTEXARRAYATTRIBEXTPROC)gladLazyResolve("glEnableVertexArrayAttribEXT");
+	glad_glEnableVertexArrayAttribEXT(vaobj, index);
+}
+
+static void APIENTRY lazy_glDisableVertexArrayAttribEXT(GLuint vaobj, GLuint index) {
+	glad_glDisableVertexArrayAttribEXT = (PFNGLDISABLEVERTEXARRAYATTRIBEXTPROC)gladLazyResolve("glDisableVertexArrayAttribEXT");
+	glad_glDisableVertexArrayAttribEXT(vaobj, index);
+}
+
+static void APIENTRY lazy_glGetVertexArrayIntegervEXT(GLuint vaobj, GLenum pname, GLint *param) {
+	glad_glGetVertexArrayIntegervEXT = (PFNGLGETVERTEXARRAYINTEGERVEXTPROC)gladLazyResolve("glGetVertexArrayIntegervEXT");
+	glad_glGetVertexArrayIntegervEXT(vaobj, pname, param);
+}
+
+static void APIENTRY lazy_glGetVertexArrayPointervEXT(GLuint vaobj, GLenum pname, void **param) {
+	glad_glGetVertexArrayPointervEXT = (PFNGLGETVERTEXARRAYPOINTERVEXTPROC)gladLazyResolve("glGetVertexArrayPointervEXT");
+	glad_glGetVertexArrayPointervEXT(vaobj, pname, param);
+}
+
+static void APIENTRY lazy_glGetVertexArrayIntegeri_vEXT(GLuint vaobj, GLuint index, GLenum pname, GLint *param) {
+	glad_glGetVertexArrayIntegeri_vEXT = (PFNGLGETVERTEXARRAYINTEGERI_VEXTPROC)gladLazyResolve("glGetVertexArrayIntegeri_vEXT");
+	glad_glGetVertexArrayIntegeri_vEXT(vaobj, index, pname, param);
+}
+
+static void APIENTRY lazy_glGetVertexArrayPointeri_vEXT(GLuint vaobj, GLuint index, GLenum pname, void **param) {
+	glad_glGetVertexArrayPointeri_vEXT = (PFNGLGETVERTEXARRAYPOINTERI_VEXTPROC)gladLazyResolve("glGetVertexArrayPointeri_vEXT");
+	glad_glGetVertexArrayPointeri_vEXT(vaobj, index, pname, param);
+}
+
+static void * APIENTRY lazy_glMapNamedBufferRangeEXT(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glad_glMapNamedBufferRangeEXT = (PFNGLMAPNAMEDBUFFERRANGEEXTPROC)gladLazyResolve("glMapNamedBufferRangeEXT");
+	return glad_glMapNamedBufferRangeEXT(buffer, offset, length, access);
+}
+
+static void APIENTRY lazy_glFlushMappedNamedBufferRangeEXT(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	glad_glFlushMappedNamedBufferRangeEXT = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC)gladLazyResolve("glFlushMappedNamedBufferRangeEXT");
+	glad_glFlushMappedNamedBufferRangeEXT(buffer, offset, length);
+}
+
+static void APIENTRY lazy_glNamedBufferStorageEXT(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+	glad_glNamedBufferStorageEXT = (PFNGLNAMEDBUFFERSTORAGEEXTPROC)gladLazyResolve("glNamedBufferStorageEXT");
+	glad_glNamedBufferStorageEXT(buffer, size, data, flags);
+}
+
+static void APIENTRY lazy_glClearNamedBufferDataEXT(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	glad_glClearNamedBufferDataEXT = (PFNGLCLEARNAMEDBUFFERDATAEXTPROC)gladLazyResolve("glClearNamedBufferDataEXT");
+	glad_glClearNamedBufferDataEXT(buffer, internalformat, format, type, data);
+}
+
+static void APIENTRY lazy_glClearNamedBufferSubDataEXT(GLuint buffer, GLenum internalformat, GLsizeiptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	glad_glClearNamedBufferSubDataEXT = (PFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC)gladLazyResolve("glClearNamedBufferSubDataEXT");
+	glad_glClearNamedBufferSubDataEXT(buffer, internalformat, offset, size, format, type, data);
+}
+
+static void APIENTRY lazy_glNamedFramebufferParameteriEXT(GLuint framebuffer, GLenum pname, GLint param) {
+	glad_glNamedFramebufferParameteriEXT = (PFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC)gladLazyResolve("glNamedFramebufferParameteriEXT");
+	glad_glNamedFramebufferParameteriEXT(framebuffer, pname, param);
+}
+
+static void APIENTRY lazy_glGetNamedFramebufferParameterivEXT(GLuint framebuffer, GLenum pname, GLint *params) {
+	glad_glGetNamedFramebufferParameterivEXT = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC)gladLazyResolve("glGetNamedFramebufferParameterivEXT");
+	glad_glGetNamedFramebufferParameterivEXT(framebuffer, pname, params);
+}
+
+static void APIENTRY lazy_glProgramUniform1dEXT(GLuint program, GLint location, GLdouble x) {
+	glad_glProgramUniform1dEXT = (PFNGLPROGRAMUNIFORM1DEXTPROC)gladLazyResolve("glProgramUniform1dEXT");
+	glad_glProgramUniform1dEXT(program, location, x);
+}
+
+static void APIENTRY lazy_glProgramUniform2dEXT(GLuint program, GLint location, GLdouble x, GLdouble y) {
+	glad_glProgramUniform2dEXT = (PFNGLPROGRAMUNIFORM2DEXTPROC)gladLazyResolve("glProgramUniform2dEXT");
+	glad_glProgramUniform2dEXT(program, location, x, y);
+}
+
+static void APIENTRY lazy_glProgramUniform3dEXT(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glProgramUniform3dEXT = (PFNGLPROGRAMUNIFORM3DEXTPROC)gladLazyResolve("glProgramUniform3dEXT");
+	glad_glProgramUniform3dEXT(program, location, x, y, z);
+}
+
+static void APIENTRY lazy_glProgramUniform4dEXT(GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glProgramUniform4dEXT = (PFNGLPROGRAMUNIFORM4DEXTPROC)gladLazyResolve("glProgramUniform4dEXT");
+	glad_glProgramUniform4dEXT(program, location, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramUniform1dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform1dvEXT = (PFNGLPROGRAMUNIFORM1DVEXTPROC)gladLazyResolve("glProgramUniform1dvEXT");
+	glad_glProgramUniform1dvEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform2dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform2dvEXT = (PFNGLPROGRAMUNIFORM2DVEXTPROC)gladLazyResolve("glProgramUniform2dvEXT");
+	glad_glProgramUniform2dvEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform3dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform3dvEXT = (PFNGLPROGRAMUNIFORM3DVEXTPROC)gladLazyResolve("glProgramUniform3dvEXT");
+	glad_glProgramUniform3dvEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniform4dvEXT(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform4dvEXT = (PFNGLPROGRAMUNIFORM4DVEXTPROC)gladLazyResolve("glProgramUniform4dvEXT");
+	glad_glProgramUniform4dvEXT(program, location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2dvEXT = (PFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC)gladLazyResolve("glProgramUniformMatrix2dvEXT");
+	glad_glProgramUniformMatrix2dvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3dvEXT = (PFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC)gladLazyResolve("glProgramUniformMatrix3dvEXT");
+	glad_glProgramUniformMatrix3dvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4dvEXT = (PFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC)gladLazyResolve("glProgramUniformMatrix4dvEXT");
+	glad_glProgramUniformMatrix4dvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix2x3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2x3dvEXT = (PFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC)gladLazyResolve("glProgramUniformMatrix2x3dvEXT");
+	glad_glProgramUniformMatrix2x3dvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix2x4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2x4dvEXT = (PFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC)gladLazyResolve("glProgramUniformMatrix2x4dvEXT");
+	glad_glProgramUniformMatrix2x4dvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix3x2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3x2dvEXT = (PFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC)gladLazyResolve("glProgramUniformMatrix3x2dvEXT");
+	glad_glProgramUniformMatrix3x2dvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix3x4dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3x4dvEXT = (PFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC)gladLazyResolve("glProgramUniformMatrix3x4dvEXT");
+	glad_glProgramUniformMatrix3x4dvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix4x2dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4x2dvEXT = (PFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC)gladLazyResolve("glProgramUniformMatrix4x2dvEXT");
+	glad_glProgramUniformMatrix4x2dvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glProgramUniformMatrix4x3dvEXT(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4x3dvEXT = (PFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC)gladLazyResolve("glProgramUniformMatrix4x3dvEXT");
+	glad_glProgramUniformMatrix4x3dvEXT(program, location, count, transpose, value);
+}
+
+static void APIENTRY lazy_glTextureBufferRangeEXT(GLuint texture, GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTextureBufferRangeEXT = (PFNGLTEXTUREBUFFERRANGEEXTPROC)gladLazyResolve("glTextureBufferRangeEXT");
+	glad_glTextureBufferRangeEXT(texture, target, internalformat, buffer, offset, size);
+}
+
+static void APIENTRY lazy_glTextureStorage1DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+	glad_glTextureStorage1DEXT = (PFNGLTEXTURESTORAGE1DEXTPROC)gladLazyResolve("glTextureStorage1DEXT");
+	glad_glTextureStorage1DEXT(texture, target, levels, internalformat, width);
+}
+
+static void APIENTRY lazy_glTextureStorage2DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glTextureStorage2DEXT = (PFNGLTEXTURESTORAGE2DEXTPROC)gladLazyResolve("glTextureStorage2DEXT");
+	glad_glTextureStorage2DEXT(texture, target, levels, internalformat, width, height);
+}
+
+static void APIENTRY lazy_glTextureStorage3DEXT(GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glTextureStorage3DEXT = (PFNGLTEXTURESTORAGE3DEXTPROC)gladLazyResolve("glTextureStorage3DEXT");
+	glad_glTextureStorage3DEXT(texture, target, levels, internalformat, width, height, depth);
+}
+
+static void APIENTRY lazy_glTextureStorage2DMultisampleEXT(GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTextureStorage2DMultisampleEXT = (PFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC)gladLazyResolve("glTextureStorage2DMultisampleEXT");
+	glad_glTextureStorage2DMultisampleEXT(texture, target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void APIENTRY lazy_glTextureStorage3DMultisampleEXT(GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTextureStorage3DMultisampleEXT = (PFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC)gladLazyResolve("glTextureStorage3DMultisampleEXT");
+	glad_glTextureStorage3DMultisampleEXT(texture, target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void APIENTRY lazy_glVertexArrayBindVertexBufferEXT(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	glad_glVertexArrayBindVertexBufferEXT = (PFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC)gladLazyResolve("glVertexArrayBindVertexBufferEXT");
+	glad_glVertexArrayBindVertexBufferEXT(vaobj, bindingindex, buffer, offset, stride);
+}
+
+static void APIENTRY lazy_glVertexArrayVertexAttribFormatEXT(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	glad_glVertexArrayVertexAttribFormatEXT = (PFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC)gladLazyResolve("glVertexArrayVertexAttribFormatEXT");
+	glad_glVertexArrayVertexAttribFormatEXT(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+
+static void APIENTRY lazy_glVertexArrayVertexAttribIFormatEXT(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexArrayVertexAttribIFormatEXT = (PFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC)gladLazyResolve("glVertexArrayVertexAttribIFormatEXT");
+	glad_glVertexArrayVertexAttribIFormatEXT(vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY lazy_glVertexArrayVertexAttribLFormatEXT(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexArrayVertexAttribLFormatEXT = (PFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC)gladLazyResolve("glVertexArrayVertexAttribLFormatEXT");
+	glad_glVertexArrayVertexAttribLFormatEXT(vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void APIENTRY lazy_glVertexArrayVertexAttribBindingEXT(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+	glad_glVertexArrayVertexAttribBindingEXT = (PFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC)gladLazyResolve("glVertexArrayVertexAttribBindingEXT");
+	glad_glVertexArrayVertexAttribBindingEXT(vaobj, attribindex, bindingindex);
+}
+
+static void APIENTRY lazy_glVertexArrayVertexBindingDivisorEXT(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+	glad_glVertexArrayVertexBindingDivisorEXT = (PFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC)gladLazyResolve("glVertexArrayVertexBindingDivisorEXT");
+	glad_glVertexArrayVertexBindingDivisorEXT(vaobj, bindingindex, divisor);
+}
+
+static void APIENTRY lazy_glVertexArrayVertexAttribLOffsetEXT(GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset) {
+	glad_glVertexArrayVertexAttribLOffsetEXT = (PFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC)gladLazyResolve("glVertexArrayVertexAttribLOffsetEXT");
+	glad_glVertexArrayVertexAttribLOffsetEXT(vaobj, buffer, index, size, type, stride, offset);
+}
+
+static void APIENTRY lazy_glTexturePageCommitmentEXT(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit) {
+	glad_glTexturePageCommitmentEXT = (PFNGLTEXTUREPAGECOMMITMENTEXTPROC)gladLazyResolve("glTexturePageCommitmentEXT");
+	glad_glTexturePageCommitmentEXT(texture, level, xoffset, yoffset, zoffset, width, height, depth, commit);
+}
+
+static void APIENTRY lazy_glVertexArrayVertexAttribDivisorEXT(GLuint vaobj, GLuint index, GLuint divisor) {
+	glad_glVertexArrayVertexAttribDivisorEXT = (PFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC)gladLazyResolve("glVertexArrayVertexAttribDivisorEXT");
+	glad_glVertexArrayVertexAttribDivisorEXT(vaobj, index, divisor);
+}
+
+static void APIENTRY lazy_glColorMaskIndexedEXT(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	glad_glColorMaskIndexedEXT = (PFNGLCOLORMASKINDEXEDEXTPROC)gladLazyResolve("glColorMaskIndexedEXT");
+	glad_glColorMaskIndexedEXT(index, r, g, b, a);
+}
+
+static void APIENTRY lazy_glDrawArraysInstancedEXT(GLenum mode, GLint start, GLsizei count, GLsizei primcount) {
+	glad_glDrawArraysInstancedEXT = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)gladLazyResolve("glDrawArraysInstancedEXT");
+	glad_glDrawArraysInstancedEXT(mode, start, count, primcount);
+}
+
+static void APIENTRY lazy_glDrawElementsInstancedEXT(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount) {
+	glad_glDrawElementsInstancedEXT = (PFNGLDRAWELEMENTSINSTANCEDEXTPROC)gladLazyResolve("glDrawElementsInstancedEXT");
+	glad_glDrawElementsInstancedEXT(mode, count, type, indices, primcount);
+}
+
+static void APIENTRY lazy_glDrawRangeElementsEXT(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawRangeElementsEXT = (PFNGLDRAWRANGEELEMENTSEXTPROC)gladLazyResolve("glDrawRangeElementsEXT");
+	glad_glDrawRangeElementsEXT(mode, start, end, count, type, indices);
+}
+
+static void APIENTRY lazy_glBufferStorageExternalEXT(GLenum target, GLintptr offset, GLsizeiptr size, GLeglClientBufferEXT clientBuffer, GLbitfield flags) {
+	glad_glBufferStorageExternalEXT = (PFNGLBUFFERSTORAGEEXTERNALEXTPROC)gladLazyResolve("glBufferStorageExternalEXT");
+	glad_glBufferStorageExternalEXT(target, offset, size, clientBuffer, flags);
+}
+
+static void APIENTRY lazy_glNamedBufferStorageExternalEXT(GLuint buffer, GLintptr offset, GLsizeiptr size, GLeglClientBufferEXT clientBuffer, GLbitfield flags) {
+	glad_glNamedBufferStorageExternalEXT = (PFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC)gladLazyResolve("glNamedBufferStorageExternalEXT");
+	glad_glNamedBufferStorageExternalEXT(buffer, offset, size, clientBuffer, flags);
+}
+
+static void APIENTRY lazy_glFogCoordfEXT(GLfloat coord) {
+	glad_glFogCoordfEXT = (PFNGLFOGCOORDFEXTPROC)gladLazyResolve("glFogCoordfEXT");
+	glad_glFogCoordfEXT(coord);
+}
+
+static void APIENTRY lazy_glFogCoordfvEXT(const GLfloat *coord) {
+	glad_glFogCoordfvEXT = (PFNGLFOGCOORDFVEXTPROC)gladLazyResolve("glFogCoordfvEXT");
+	glad_glFogCoordfvEXT(coord);
+}
+
+static void APIENTRY lazy_glFogCoorddEXT(GLdouble coord) {
+	glad_glFogCoorddEXT = (PFNGLFOGCOORDDEXTPROC)gladLazyResolve("glFogCoorddEXT");
+	glad_glFogCoorddEXT(coord);
+}
+
+static void APIENTRY lazy_glFogCoorddvEXT(const GLdouble *coord) {
+	glad_glFogCoorddvEXT = (PFNGLFOGCOORDDVEXTPROC)gladLazyResolve("glFogCoorddvEXT");
+	glad_glFogCoorddvEXT(coord);
+}
+
+static void APIENTRY lazy_glFogCoordPointerEXT(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glFogCoordPointerEXT = (PFNGLFOGCOORDPOINTEREXTPROC)gladLazyResolve("glFogCoordPointerEXT");
+	glad_glFogCoordPointerEXT(type, stride, pointer);
+}
+
+static void APIENTRY lazy_glBlitFramebufferEXT(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glBlitFramebufferEXT = (PFNGLBLITFRAMEBUFFEREXTPROC)gladLazyResolve("glBlitFramebufferEXT");
+	glad_glBlitFramebufferEXT(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static void APIENTRY lazy_glBlitFramebufferLayersEXT(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glBlitFramebufferLayersEXT = (PFNGLBLITFRAMEBUFFERLAYERSEXTPROC)gladLazyResolve("glBlitFramebufferLayersEXT");
+	glad_glBlitFramebufferLayersEXT(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static void APIENTRY lazy_glBlitFramebufferLayerEXT(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint srcLayer, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLint dstLayer, GLbitfield mask, GLenum filter) {
+	glad_glBlitFramebufferLayerEXT = (PFNGLBLITFRAMEBUFFERLAYEREXTPROC)gladLazyResolve("glBlitFramebufferLayerEXT");
+	glad_glBlitFramebufferLayerEXT(srcX0, srcY0, srcX1, srcY1, srcLayer, dstX0, dstY0, dstX1, dstY1, dstLayer, mask, filter);
+}
+
+static void APIENTRY lazy_glRenderbufferStorageMultisampleEXT(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorageMultisampleEXT = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)gladLazyResolve("glRenderbufferStorageMultisampleEXT");
+	glad_glRenderbufferStorageMultisampleEXT(target, samples, internalformat, width, height);
+}
+
+static GLboolean APIENTRY lazy_glIsRenderbufferEXT(GLuint renderbuffer) {
+	glad_glIsRenderbufferEXT = (PFNGLISRENDERBUFFEREXTPROC)gladLazyResolve("glIsRenderbufferEXT");
+	return glad_glIsRenderbufferEXT(renderbuffer);
+}
+
+static void APIENTRY lazy_glBindRenderbufferEXT(GLenum target, GLuint renderbuffer) {
+	glad_glBindRenderbufferEXT = (PFNGLBINDRENDERBUFFEREXTPROC)gladLazyResolve("glBindRenderbufferEXT");
+	glad_glBindRenderbufferEXT(target, renderbuffer);
+}
+
+static void APIENTRY lazy_glDeleteRenderbuffersEXT(GLsizei n, const GLuint *renderbuffers) {
+	glad_glDeleteRenderbuffersEXT = (PFNGLDELETERENDERBUFFERSEXTPROC)gladLazyResolve("glDeleteRenderbuffersEXT");
+	glad_glDeleteRenderbuffersEXT(n, renderbuffers);
+}
+
+static void APIENTRY lazy_glGenRenderbuffersEXT(GLsizei n, GLuint *renderbuffers) {
+	glad_glGenRenderbuffersEXT = (PFNGLGENRENDERBUFFERSEXTPROC)gladLazyResolve("glGenRenderbuffersEXT");
+	glad_glGenRenderbuffersEXT(n, renderbuffers);
+}
+
+static void APIENTRY lazy_glRenderbufferStorageEXT(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorageEXT = (PFNGLRENDERBUFFERSTORAGEEXTPROC)gladLazyResolve("glRenderbufferStorageEXT");
+	glad_glRenderbufferStorageEXT(target, internalformat, width, height);
+}
+
+static void APIENTRY lazy_glGetRenderbufferParameterivEXT(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetRenderbufferParameterivEXT = (PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC)gladLazyResolve("glGetRenderbufferParameterivEXT");
+	glad_glGetRenderbufferParameterivEXT(target, pname, params);
+}
+
+static GLboolean APIENTRY lazy_glIsFramebufferEXT(GLuint framebuffer) {
+	glad_glIsFramebufferEXT = (PFNGLISFRAMEBUFFEREXTPROC)gladLazyResolve("glIsFramebufferEXT");
+	return glad_glIsFramebufferEXT(framebuffer);
+}
+
+static void APIENTRY lazy_glBindFramebufferEXT(GLenum target, GLuint framebuffer) {
+	glad_glBindFramebufferEXT = (PFNGLBINDFRAMEBUFFEREXTPROC)gladLazyResolve("glBindFramebufferEXT");
+	glad_glBindFramebufferEXT(target, framebuffer);
+}
+
+static void APIENTRY lazy_glDeleteFramebuffersEXT(GLsizei n, const GLuint *framebuffers) {
+	glad_glDeleteFramebuffersEXT = (PFNGLDELETEFRAMEBUFFERSEXTPROC)gladLazyResolve("glDeleteFramebuffersEXT");
+	glad_glDeleteFramebuffersEXT(n, framebuffers);
+}
+
+static void APIENTRY lazy_glGenFramebuffersEXT(GLsizei n, GLuint *framebuffers) {
+	glad_glGenFramebuffersEXT = (PFNGLGENFRAMEBUFFERSEXTPROC)gladLazyResolve("glGenFramebuffersEXT");
+	glad_glGenFramebuffersEXT(n, framebuffers);
+}
+
+static GLenum APIENTRY lazy_glCheckFramebufferStatusEXT(GLenum target) {
+	glad_glCheckFramebufferStatusEXT = (PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)gladLazyResolve("glCheckFramebufferStatusEXT");
+	return glad_glCheckFramebufferStatusEXT(target);
+}
+
+static void APIENTRY lazy_glFramebufferTexture1DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture1DEXT = (PFNGLFRAMEBUFFERTEXTURE1DEXTPROC)gladLazyResolve("glFramebufferTexture1DEXT");
+	glad_glFramebufferTexture1DEXT(target, attachment, textarget, texture, level);
+}
+
+static void APIENTRY lazy_glFramebufferTexture2DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture2DEXT = (PFNGLFRAMEBUFFERTEXTURE2DEXTPROC)gladLazyResolve("glFramebufferTexture2DEXT");
+	glad_glFramebufferTexture2DEXT(target, attachment, textarget, texture, level);
+}
+
+static void APIENTRY lazy_glFramebufferTexture3DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	glad_glFramebufferTexture3DEXT = (PFNGLFRAMEBUFFERTEXTURE3DEXTPROC)gladLazyResolve("glFramebufferTexture3DEXT");
+	glad_glFramebufferTexture3DEXT(target, attachment, textarget, texture, level, zoffset);
+}
+
+static void APIENTRY lazy_glFramebufferRenderbufferEXT(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_glFramebufferRenderbufferEXT = (PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC)gladLazyResolve("glFramebufferRenderbufferEXT");
+	glad_glFramebufferRenderbufferEXT(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void APIENTRY lazy_glGetFramebufferAttachmentParameterivEXT(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	glad_glGetFramebufferAttachmentParameterivEXT = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)gladLazyResolve("glGetFramebufferAttachmentParameterivEXT");
+	glad_glGetFramebufferAttachmentParameterivEXT(target, attachment, pname, params);
+}
+
+static void APIENTRY lazy_glGenerateMipmapEXT(GLenum target) {
+	glad_glGenerateMipmapEXT = (PFNGLGENERATEMIPMAPEXTPROC)gladLazyResolve("glGenerateMipmapEXT");
+	glad_glGenerateMipmapEXT(target);
+}
+
+static void APIENTRY lazy_glProgramParameteriEXT(GLuint program, GLenum pname, GLint value) {
+	glad_glProgramParameteriEXT = (PFNGLPROGRAMPARAMETERIEXTPROC)gladLazyResolve("glProgramParameteriEXT");
+	glad_glProgramParameteriEXT(program, pname, value);
+}
+
+static void APIENTRY lazy_glProgramEnvParameters4fvEXT(GLenum target, GLuint index, GLsizei count, const GLfloat *params) {
+	glad_glProgramEnvParameters4fvEXT = (PFNGLPROGRAMENVPARAMETERS4FVEXTPROC)gladLazyResolve("glProgramEnvParameters4fvEXT");
+	glad_glProgramEnvParameters4fvEXT(target, index, count, params);
+}
+
+static void APIENTRY lazy_glProgramLocalParameters4fvEXT(GLenum target, GLuint index, GLsizei count, const GLfloat *params) {
+	glad_glProgramLocalParameters4fvEXT = (PFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC)gladLazyResolve("glProgramLocalParameters4fvEXT");
+	glad_glProgramLocalParameters4fvEXT(target, index, count, params);
+}
+
+static void APIENTRY lazy_glGetUniformuivEXT(GLuint program, GLint location, GLuint *params) {
+	glad_glGetUniformuivEXT = (PFNGLGETUNIFORMUIVEXTPROC)gladLazyResolve("glGetUniformuivEXT");
+	glad_glGetUniformuivEXT(program, location, params);
+}
+
+static void APIENTRY lazy_glBindFragDataLocationEXT(GLuint program, GLuint color, const GLchar *name) {
+	glad_glBindFragDataLocationEXT = (PFNGLBINDFRAGDATALOCATIONEXTPROC)gladLazyResolve("glBindFragDataLocationEXT");
+	glad_glBindFragDataLocationEXT(program, color, name);
+}
+
+static GLint APIENTRY lazy_glGetFragDataLocationEXT(GLuint program, const GLchar *name) {
+	glad_glGetFragDataLocationEXT = (PFNGLGETFRAGDATALOCATIONEXTPROC)gladLazyResolve("glGetFragDataLocationEXT");
+	return glad_glGetFragDataLocationEXT(program, name);
+}
+
+static void APIENTRY lazy_glUniform1uiEXT(GLint location, GLuint v0) {
+	glad_glUniform1uiEXT = (PFNGLUNIFORM1UIEXTPROC)gladLazyResolve("glUniform1uiEXT");
+	glad_glUniform1uiEXT(location, v0);
+}
+
+static void APIENTRY lazy_glUniform2uiEXT(GLint location, GLuint v0, GLuint v1) {
+	glad_glUniform2uiEXT = (PFNGLUNIFORM2UIEXTPROC)gladLazyResolve("glUniform2uiEXT");
+	glad_glUniform2uiEXT(location, v0, v1);
+}
+
+static void APIENTRY lazy_glUniform3uiEXT(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_glUniform3uiEXT = (PFNGLUNIFORM3UIEXTPROC)gladLazyResolve("glUniform3uiEXT");
+	glad_glUniform3uiEXT(location, v0, v1, v2);
+}
+
+static void APIENTRY lazy_glUniform4uiEXT(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_glUniform4uiEXT = (PFNGLUNIFORM4UIEXTPROC)gladLazyResolve("glUniform4uiEXT");
+	glad_glUniform4uiEXT(location, v0, v1, v2, v3);
+}
+
+static void APIENTRY lazy_glUniform1uivEXT(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform1uivEXT = (PFNGLUNIFORM1UIVEXTPROC)gladLazyResolve("glUniform1uivEXT");
+	glad_glUniform1uivEXT(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform2uivEXT(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform2uivEXT = (PFNGLUNIFORM2UIVEXTPROC)gladLazyResolve("glUniform2uivEXT");
+	glad_glUniform2uivEXT(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform3uivEXT(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform3uivEXT = (PFNGLUNIFORM3UIVEXTPROC)gladLazyResolve("glUniform3uivEXT");
+	glad_glUniform3uivEXT(location, count, value);
+}
+
+static void APIENTRY lazy_glUniform4uivEXT(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform4uivEXT = (PFNGLUNIFORM4UIVEXTPROC)gladLazyResolve("glUniform4uivEXT");
+	glad_glUniform4uivEXT(location, count, value);
+}
+
+static void APIENTRY lazy_glVertexAttribI1iEXT(GLuint index, GLint x) {
+	glad_glVertexAttribI1iEXT = (PFNGLVERTEXATTRIBI1IEXTPROC)gladLazyResolve("glVertexAttribI1iEXT");
+	glad_glVertexAttribI1iEXT(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttribI2iEXT(GLuint index, GLint x, GLint y) {
+	glad_glVertexAttribI2iEXT = (PFNGLVERTEXATTRIBI2IEXTPROC)gladLazyResolve("glVertexAttribI2iEXT");
+	glad_glVertexAttribI2iEXT(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttribI3iEXT(GLuint index, GLint x, GLint y, GLint z) {
+	glad_glVertexAttribI3iEXT = (PFNGLVERTEXATTRIBI3IEXTPROC)gladLazyResolve("glVertexAttribI3iEXT");
+	glad_glVertexAttribI3iEXT(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttribI4iEXT(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glad_glVertexAttribI4iEXT = (PFNGLVERTEXATTRIBI4IEXTPROC)gladLazyResolve("glVertexAttribI4iEXT");
+	glad_glVertexAttribI4iEXT(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttribI1uiEXT(GLuint index, GLuint x) {
+	glad_glVertexAttribI1uiEXT = (PFNGLVERTEXATTRIBI1UIEXTPROC)gladLazyResolve("glVertexAttribI1uiEXT");
+	glad_glVertexAttribI1uiEXT(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttribI2uiEXT(GLuint index, GLuint x, GLuint y) {
+	glad_glVertexAttribI2uiEXT = (PFNGLVERTEXATTRIBI2UIEXTPROC)gladLazyResolve("glVertexAttribI2uiEXT");
+	glad_glVertexAttribI2uiEXT(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttribI3uiEXT(GLuint index, GLuint x, GLuint y, GLuint z) {
+	glad_glVertexAttribI3uiEXT = (PFNGLVERTEXATTRIBI3UIEXTPROC)gladLazyResolve("glVertexAttribI3uiEXT");
+	glad_glVertexAttribI3uiEXT(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttribI4uiEXT(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glad_glVertexAttribI4uiEXT = (PFNGLVERTEXATTRIBI4UIEXTPROC)gladLazyResolve("glVertexAttribI4uiEXT");
+	glad_glVertexAttribI4uiEXT(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttribI1ivEXT(GLuint index, const GLint *v) {
+	glad_glVertexAttribI1ivEXT = (PFNGLVERTEXATTRIBI1IVEXTPROC)gladLazyResolve("glVertexAttribI1ivEXT");
+	glad_glVertexAttribI1ivEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI2ivEXT(GLuint index, const GLint *v) {
+	glad_glVertexAttribI2ivEXT = (PFNGLVERTEXATTRIBI2IVEXTPROC)gladLazyResolve("glVertexAttribI2ivEXT");
+	glad_glVertexAttribI2ivEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI3ivEXT(GLuint index, const GLint *v) {
+	glad_glVertexAttribI3ivEXT = (PFNGLVERTEXATTRIBI3IVEXTPROC)gladLazyResolve("glVertexAttribI3ivEXT");
+	glad_glVertexAttribI3ivEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI4ivEXT(GLuint index, const GLint *v) {
+	glad_glVertexAttribI4ivEXT = (PFNGLVERTEXATTRIBI4IVEXTPROC)gladLazyResolve("glVertexAttribI4ivEXT");
+	glad_glVertexAttribI4ivEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI1uivEXT(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI1uivEXT = (PFNGLVERTEXATTRIBI1UIVEXTPROC)gladLazyResolve("glVertexAttribI1uivEXT");
+	glad_glVertexAttribI1uivEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI2uivEXT(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI2uivEXT = (PFNGLVERTEXATTRIBI2UIVEXTPROC)gladLazyResolve("glVertexAttribI2uivEXT");
+	glad_glVertexAttribI2uivEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI3uivEXT(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI3uivEXT = (PFNGLVERTEXATTRIBI3UIVEXTPROC)gladLazyResolve("glVertexAttribI3uivEXT");
+	glad_glVertexAttribI3uivEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI4uivEXT(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI4uivEXT = (PFNGLVERTEXATTRIBI4UIVEXTPROC)gladLazyResolve("glVertexAttribI4uivEXT");
+	glad_glVertexAttribI4uivEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI4bvEXT(GLuint index, const GLbyte *v) {
+	glad_glVertexAttribI4bvEXT = (PFNGLVERTEXATTRIBI4BVEXTPROC)gladLazyResolve("glVertexAttribI4bvEXT");
+	glad_glVertexAttribI4bvEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI4svEXT(GLuint index, const GLshort *v) {
+	glad_glVertexAttribI4svEXT = (PFNGLVERTEXATTRIBI4SVEXTPROC)gladLazyResolve("glVertexAttribI4svEXT");
+	glad_glVertexAttribI4svEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI4ubvEXT(GLuint index, const GLubyte *v) {
+	glad_glVertexAttribI4ubvEXT = (PFNGLVERTEXATTRIBI4UBVEXTPROC)gladLazyResolve("glVertexAttribI4ubvEXT");
+	glad_glVertexAttribI4ubvEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribI4usvEXT(GLuint index, const GLushort *v) {
+	glad_glVertexAttribI4usvEXT = (PFNGLVERTEXATTRIBI4USVEXTPROC)gladLazyResolve("glVertexAttribI4usvEXT");
+	glad_glVertexAttribI4usvEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribIPointerEXT(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribIPointerEXT = (PFNGLVERTEXATTRIBIPOINTEREXTPROC)gladLazyResolve("glVertexAttribIPointerEXT");
+	glad_glVertexAttribIPointerEXT(index, size, type, stride, pointer);
+}
+
+static void APIENTRY lazy_glGetVertexAttribIivEXT(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribIivEXT = (PFNGLGETVERTEXATTRIBIIVEXTPROC)gladLazyResolve("glGetVertexAttribIivEXT");
+	glad_glGetVertexAttribIivEXT(index, pname, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribIuivEXT(GLuint index, GLenum pname, GLuint *params) {
+	glad_glGetVertexAttribIuivEXT = (PFNGLGETVERTEXATTRIBIUIVEXTPROC)gladLazyResolve("glGetVertexAttribIuivEXT");
+	glad_glGetVertexAttribIuivEXT(index, pname, params);
+}
+
+static void APIENTRY lazy_glGetHistogramEXT(GLenum target, GLboolean reset, GLenum format, GLenum type, void *values) {
+	glad_glGetHistogramEXT = (PFNGLGETHISTOGRAMEXTPROC)gladLazyResolve("glGetHistogramEXT");
+	glad_glGetHistogramEXT(target, reset, format, type, values);
+}
+
+static void APIENTRY lazy_glGetHistogramParameterfvEXT(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetHistogramParameterfvEXT = (PFNGLGETHISTOGRAMPARAMETERFVEXTPROC)gladLazyResolve("glGetHistogramParameterfvEXT");
+	glad_glGetHistogramParameterfvEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetHistogramParameterivEXT(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetHistogramParameterivEXT = (PFNGLGETHISTOGRAMPARAMETERIVEXTPROC)gladLazyResolve("glGetHistogramParameterivEXT");
+	glad_glGetHistogramParameterivEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetMinmaxEXT(GLenum target, GLboolean reset, GLenum format, GLenum type, void *values) {
+	glad_glGetMinmaxEXT = (PFNGLGETMINMAXEXTPROC)gladLazyResolve("glGetMinmaxEXT");
+	glad_glGetMinmaxEXT(target, reset, format, type, values);
+}
+
+static void APIENTRY lazy_glGetMinmaxParameterfvEXT(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetMinmaxParameterfvEXT = (PFNGLGETMINMAXPARAMETERFVEXTPROC)gladLazyResolve("glGetMinmaxParameterfvEXT");
+	glad_glGetMinmaxParameterfvEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetMinmaxParameterivEXT(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetMinmaxParameterivEXT = (PFNGLGETMINMAXPARAMETERIVEXTPROC)gladLazyResolve("glGetMinmaxParameterivEXT");
+	glad_glGetMinmaxParameterivEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glHistogramEXT(GLenum target, GLsizei width, GLenum internalformat, GLboolean sink) {
+	glad_glHistogramEXT = (PFNGLHISTOGRAMEXTPROC)gladLazyResolve("glHistogramEXT");
+	glad_glHistogramEXT(target, width, internalformat, sink);
+}
+
+static void APIENTRY lazy_glMinmaxEXT(GLenum target, GLenum internalformat, GLboolean sink) {
+	glad_glMinmaxEXT = (PFNGLMINMAXEXTPROC)gladLazyResolve("glMinmaxEXT");
+	glad_glMinmaxEXT(target, internalformat, sink);
+}
+
+static void APIENTRY lazy_glResetHistogramEXT(GLenum target) {
+	glad_glResetHistogramEXT = (PFNGLRESETHISTOGRAMEXTPROC)gladLazyResolve("glResetHistogramEXT");
+	glad_glResetHistogramEXT(target);
+}
+
+static void APIENTRY lazy_glResetMinmaxEXT(GLenum target) {
+	glad_glResetMinmaxEXT = (PFNGLRESETMINMAXEXTPROC)gladLazyResolve("glResetMinmaxEXT");
+	glad_glResetMinmaxEXT(target);
+}
+
+static void APIENTRY lazy_glIndexFuncEXT(GLenum func, GLclampf ref) {
+	glad_glIndexFuncEXT = (PFNGLINDEXFUNCEXTPROC)gladLazyResolve("glIndexFuncEXT");
+	glad_glIndexFuncEXT(func, ref);
+}
+
+static void APIENTRY lazy_glIndexMaterialEXT(GLenum face, GLenum mode) {
+	glad_glIndexMaterialEXT = (PFNGLINDEXMATERIALEXTPROC)gladLazyResolve("glIndexMaterialEXT");
+	glad_glIndexMaterialEXT(face, mode);
+}
+
+static void APIENTRY lazy_glApplyTextureEXT(GLenum mode) {
+	glad_glApplyTextureEXT = (PFNGLAPPLYTEXTUREEXTPROC)gladLazyResolve("glApplyTextureEXT");
+	glad_glApplyTextureEXT(mode);
+}
+
+static void APIENTRY lazy_glTextureLightEXT(GLenum pname) {
+	glad_glTextureLightEXT = (PFNGLTEXTURELIGHTEXTPROC)gladLazyResolve("glTextureLightEXT");
+	glad_glTextureLightEXT(pname);
+}
+
+static void APIENTRY lazy_glTextureMaterialEXT(GLenum face, GLenum mode) {
+	glad_glTextureMaterialEXT = (PFNGLTEXTUREMATERIALEXTPROC)gladLazyResolve("glTextureMaterialEXT");
+	glad_glTextureMaterialEXT(face, mode);
+}
+
+static void APIENTRY lazy_glGetUnsignedBytevEXT(GLenum pname, GLubyte *data) {
+	glad_glGetUnsignedBytevEXT = (PFNGLGETUNSIGNEDBYTEVEXTPROC)gladLazyResolve("glGetUnsignedBytevEXT");
+	glad_glGetUnsignedBytevEXT(pname, data);
+}
+
+static void APIENTRY lazy_glGetUnsignedBytei_vEXT(GLenum target, GLuint index, GLubyte *data) {
+	glad_glGetUnsignedBytei_vEXT = (PFNGLGETUNSIGNEDBYTEI_VEXTPROC)gladLazyResolve("glGetUnsignedBytei_vEXT");
+	glad_glGetUnsignedBytei_vEXT(target, index, data);
+}
+
+static void APIENTRY lazy_glDeleteMemoryObjectsEXT(GLsizei n, const GLuint *memoryObjects) {
+	glad_glDeleteMemoryObjectsEXT = (PFNGLDELETEMEMORYOBJECTSEXTPROC)gladLazyResolve("glDeleteMemoryObjectsEXT");
+	glad_glDeleteMemoryObjectsEXT(n, memoryObjects);
+}
+
+static GLboolean APIENTRY lazy_glIsMemoryObjectEXT(GLuint memoryObject) {
+	glad_glIsMemoryObjectEXT = (PFNGLISMEMORYOBJECTEXTPROC)gladLazyResolve("glIsMemoryObjectEXT");
+	return glad_glIsMemoryObjectEXT(memoryObject);
+}
+
+static void APIENTRY lazy_glCreateMemoryObjectsEXT(GLsizei n, GLuint *memoryObjects) {
+	glad_glCreateMemoryObjectsEXT = (PFNGLCREATEMEMORYOBJECTSEXTPROC)gladLazyResolve("glCreateMemoryObjectsEXT");
+	glad_glCreateMemoryObjectsEXT(n, memoryObjects);
+}
+
+static void APIENTRY lazy_glMemoryObjectParameterivEXT(GLuint memoryObject, GLenum pname, const GLint *params) {
+	glad_glMemoryObjectParameterivEXT = (PFNGLMEMORYOBJECTPARAMETERIVEXTPROC)gladLazyResolve("glMemoryObjectParameterivEXT");
+	glad_glMemoryObjectParameterivEXT(memoryObject, pname, params);
+}
+
+static void APIENTRY lazy_glGetMemoryObjectParameterivEXT(GLuint memoryObject, GLenum pname, GLint *params) {
+	glad_glGetMemoryObjectParameterivEXT = (PFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC)gladLazyResolve("glGetMemoryObjectParameterivEXT");
+	glad_glGetMemoryObjectParameterivEXT(memoryObject, pname, params);
+}
+
+static void APIENTRY lazy_glTexStorageMem2DEXT(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset) {
+	glad_glTexStorageMem2DEXT = (PFNGLTEXSTORAGEMEM2DEXTPROC)gladLazyResolve("glTexStorageMem2DEXT");
+	glad_glTexStorageMem2DEXT(target, levels, internalFormat, width, height, memory, offset);
+}
+
+static void APIENTRY lazy_glTexStorageMem2DMultisampleEXT(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset) {
+	glad_glTexStorageMem2DMultisampleEXT = (PFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC)gladLazyResolve("glTexStorageMem2DMultisampleEXT");
+	glad_glTexStorageMem2DMultisampleEXT(target, samples, internalFormat, width, height, fixedSampleLocations, memory, offset);
+}
+
+static void APIENTRY lazy_glTexStorageMem3DEXT(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset) {
+	glad_glTexStorageMem3DEXT = (PFNGLTEXSTORAGEMEM3DEXTPROC)gladLazyResolve("glTexStorageMem3DEXT");
+	glad_glTexStorageMem3DEXT(target, levels, internalFormat, width, height, depth, memory, offset);
+}
+
+static void APIENTRY lazy_glTexStorageMem3DMultisampleEXT(GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset) {
+	glad_glTexStorageMem3DMultisampleEXT = (PFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC)gladLazyResolve("glTexStorageMem3DMultisampleEXT");
+	glad_glTexStorageMem3DMultisampleEXT(target, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset);
+}
+
+static void APIENTRY lazy_glBufferStorageMemEXT(GLenum target, GLsizeiptr size, GLuint memory, GLuint64 offset) {
+	glad_glBufferStorageMemEXT = (PFNGLBUFFERSTORAGEMEMEXTPROC)gladLazyResolve("glBufferStorageMemEXT");
+	glad_glBufferStorageMemEXT(target, size, memory, offset);
+}
+
+static void APIENTRY lazy_glTextureStorageMem2DEXT(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset) {
+	glad_glTextureStorageMem2DEXT = (PFNGLTEXTURESTORAGEMEM2DEXTPROC)gladLazyResolve("glTextureStorageMem2DEXT");
+	glad_glTextureStorageMem2DEXT(texture, levels, internalFormat, width, height, memory, offset);
+}
+
+static void APIENTRY lazy_glTextureStorageMem2DMultisampleEXT(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset) {
+	glad_glTextureStorageMem2DMultisampleEXT = (PFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC)gladLazyResolve("glTextureStorageMem2DMultisampleEXT");
+	glad_glTextureStorageMem2DMultisampleEXT(texture, samples, internalFormat, width, height, fixedSampleLocations, memory, offset);
+}
+
+static void APIENTRY lazy_glTextureStorageMem3DEXT(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset) {
+	glad_glTextureStorageMem3DEXT = (PFNGLTEXTURESTORAGEMEM3DEXTPROC)gladLazyResolve("glTextureStorageMem3DEXT");
+	glad_glTextureStorageMem3DEXT(texture, levels, internalFormat, width, height, depth, memory, offset);
+}
+
+static void APIENTRY lazy_glTextureStorageMem3DMultisampleEXT(GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset) {
+	glad_glTextureStorageMem3DMultisampleEXT = (PFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC)gladLazyResolve("glTextureStorageMem3DMultisampleEXT");
+	glad_glTextureStorageMem3DMultisampleEXT(texture, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, offset);
+}
+
+static void APIENTRY lazy_glNamedBufferStorageMemEXT(GLuint buffer, GLsizeiptr size, GLuint memory, GLuint64 offset) {
+	glad_glNamedBufferStorageMemEXT = (PFNGLNAMEDBUFFERSTORAGEMEMEXTPROC)gladLazyResolve("glNamedBufferStorageMemEXT");
+	glad_glNamedBufferStorageMemEXT(buffer, size, memory, offset);
+}
+
+static void APIENTRY lazy_glTexStorageMem1DEXT(GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset) {
+	glad_glTexStorageMem1DEXT = (PFNGLTEXSTORAGEMEM1DEXTPROC)gladLazyResolve("glTexStorageMem1DEXT");
+	glad_glTexStorageMem1DEXT(target, levels, internalFormat, width, memory, offset);
+}
+
+static void APIENTRY lazy_glTextureStorageMem1DEXT(GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset) {
+	glad_glTextureStorageMem1DEXT = (PFNGLTEXTURESTORAGEMEM1DEXTPROC)gladLazyResolve("glTextureStorageMem1DEXT");
+	glad_glTextureStorageMem1DEXT(texture, levels, internalFormat, width, memory, offset);
+}
+
+static void APIENTRY lazy_glImportMemoryFdEXT(GLuint memory, GLuint64 size, GLenum handleType, GLint fd) {
+	glad_glImportMemoryFdEXT = (PFNGLIMPORTMEMORYFDEXTPROC)gladLazyResolve("glImportMemoryFdEXT");
+	glad_glImportMemoryFdEXT(memory, size, handleType, fd);
+}
+
+static void APIENTRY lazy_glImportMemoryWin32HandleEXT(GLuint memory, GLuint64 size, GLenum handleType, void *handle) {
+	glad_glImportMemoryWin32HandleEXT = (PFNGLIMPORTMEMORYWIN32HANDLEEXTPROC)gladLazyResolve("glImportMemoryWin32HandleEXT");
+	glad_glImportMemoryWin32HandleEXT(memory, size, handleType, handle);
+}
+
+static void APIENTRY lazy_glImportMemoryWin32NameEXT(GLuint memory, GLuint64 size, GLenum handleType, const void *name) {
+	glad_glImportMemoryWin32NameEXT = (PFNGLIMPORTMEMORYWIN32NAMEEXTPROC)gladLazyResolve("glImportMemoryWin32NameEXT");
+	glad_glImportMemoryWin32NameEXT(memory, size, handleType, name);
+}
+
+static void APIENTRY lazy_glMultiDrawArraysEXT(GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount) {
+	glad_glMultiDrawArraysEXT = (PFNGLMULTIDRAWARRAYSEXTPROC)gladLazyResolve("glMultiDrawArraysEXT");
+	glad_glMultiDrawArraysEXT(mode, first, count, primcount);
+}
+
+static void APIENTRY lazy_glMultiDrawElementsEXT(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei primcount) {
+	glad_glMultiDrawElementsEXT = (PFNGLMULTIDRAWELEMENTSEXTPROC)gladLazyResolve("glMultiDrawElementsEXT");
+	glad_glMultiDrawElementsEXT(mode, count, type, indices, primcount);
+}
+
+static void APIENTRY lazy_glSampleMaskEXT(GLclampf value, GLboolean invert) {
+	glad_glSampleMaskEXT = (PFNGLSAMPLEMASKEXTPROC)gladLazyResolve("glSampleMaskEXT");
+	glad_glSampleMaskEXT(value, invert);
+}
+
+static void APIENTRY lazy_glSamplePatternEXT(GLenum pattern) {
+	glad_glSamplePatternEXT = (PFNGLSAMPLEPATTERNEXTPROC)gladLazyResolve("glSamplePatternEXT");
+	glad_glSamplePatternEXT(pattern);
+}
+
+static void APIENTRY lazy_glColorTableEXT(GLenum target, GLenum internalFormat, GLsizei width, GLenum format, GLenum type, const void *table) {
+	glad_glColorTableEXT = (PFNGLCOLORTABLEEXTPROC)gladLazyResolve("glColorTableEXT");
+	glad_glColorTableEXT(target, internalFormat, width, format, type, table);
+}
+
+static void APIENTRY lazy_glGetColorTableEXT(GLenum target, GLenum format, GLenum type, void *data) {
+	glad_glGetColorTableEXT = (PFNGLGETCOLORTABLEEXTPROC)gladLazyResolve("glGetColorTableEXT");
+	glad_glGetColorTableEXT(target, format, type, data);
+}
+
+static void APIENTRY lazy_glGetColorTableParameterivEXT(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetColorTableParameterivEXT = (PFNGLGETCOLORTABLEPARAMETERIVEXTPROC)gladLazyResolve("glGetColorTableParameterivEXT");
+	glad_glGetColorTableParameterivEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetColorTableParameterfvEXT(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetColorTableParameterfvEXT = (PFNGLGETCOLORTABLEPARAMETERFVEXTPROC)gladLazyResolve("glGetColorTableParameterfvEXT");
+	glad_glGetColorTableParameterfvEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glPixelTransformParameteriEXT(GLenum target, GLenum pname, GLint param) {
+	glad_glPixelTransformParameteriEXT = (PFNGLPIXELTRANSFORMPARAMETERIEXTPROC)gladLazyResolve("glPixelTransformParameteriEXT");
+	glad_glPixelTransformParameteriEXT(target, pname, param);
+}
+
+static void APIENTRY lazy_glPixelTransformParameterfEXT(GLenum target, GLenum pname, GLfloat param) {
+	glad_glPixelTransformParameterfEXT = (PFNGLPIXELTRANSFORMPARAMETERFEXTPROC)gladLazyResolve("glPixelTransformParameterfEXT");
+	glad_glPixelTransformParameterfEXT(target, pname, param);
+}
+
+static void APIENTRY lazy_glPixelTransformParameterivEXT(GLenum target, GLenum pname, const GLint *params) {
+	glad_glPixelTransformParameterivEXT = (PFNGLPIXELTRANSFORMPARAMETERIVEXTPROC)gladLazyResolve("glPixelTransformParameterivEXT");
+	glad_glPixelTransformParameterivEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glPixelTransformParameterfvEXT(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glPixelTransformParameterfvEXT = (PFNGLPIXELTRANSFORMPARAMETERFVEXTPROC)gladLazyResolve("glPixelTransformParameterfvEXT");
+	glad_glPixelTransformParameterfvEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetPixelTransformParameterivEXT(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetPixelTransformParameterivEXT = (PFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC)gladLazyResolve("glGetPixelTransformParameterivEXT");
+	glad_glGetPixelTransformParameterivEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetPixelTransformParameterfvEXT(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetPixelTransformParameterfvEXT = (PFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC)gladLazyResolve("glGetPixelTransformParameterfvEXT");
+	glad_glGetPixelTransformParameterfvEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glPointParameterfEXT(GLenum pname, GLfloat param) {
+	glad_glPointParameterfEXT = (PFNGLPOINTPARAMETERFEXTPROC)gladLazyResolve("glPointParameterfEXT");
+	glad_glPointParameterfEXT(pname, param);
+}
+
+static void APIENTRY lazy_glPointParameterfvEXT(GLenum pname, const GLfloat *params) {
+	glad_glPointParameterfvEXT = (PFNGLPOINTPARAMETERFVEXTPROC)gladLazyResolve("glPointParameterfvEXT");
+	glad_glPointParameterfvEXT(pname, params);
+}
+
+static void APIENTRY lazy_glPolygonOffsetEXT(GLfloat factor, GLfloat bias) {
+	glad_glPolygonOffsetEXT = (PFNGLPOLYGONOFFSETEXTPROC)gladLazyResolve("glPolygonOffsetEXT");
+	glad_glPolygonOffsetEXT(factor, bias);
+}
+
+static void APIENTRY lazy_glPolygonOffsetClampEXT(GLfloat factor, GLfloat units, GLfloat clamp) {
+	glad_glPolygonOffsetClampEXT = (PFNGLPOLYGONOFFSETCLAMPEXTPROC)gladLazyResolve("glPolygonOffsetClampEXT");
+	glad_glPolygonOffsetClampEXT(factor, units, clamp);
+}
+
+static void APIENTRY lazy_glProvokingVertexEXT(GLenum mode) {
+	glad_glProvokingVertexEXT = (PFNGLPROVOKINGVERTEXEXTPROC)gladLazyResolve("glProvokingVertexEXT");
+	glad_glProvokingVertexEXT(mode);
+}
+
+static void APIENTRY lazy_glRasterSamplesEXT(GLuint samples, GLboolean fixedsamplelocations) {
+	glad_glRasterSamplesEXT = (PFNGLRASTERSAMPLESEXTPROC)gladLazyResolve("glRasterSamplesEXT");
+	glad_glRasterSamplesEXT(samples, fixedsamplelocations);
+}
+
+static void APIENTRY lazy_glSecondaryColor3bEXT(GLbyte red, GLbyte green, GLbyte blue) {
+	glad_glSecondaryColor3bEXT = (PFNGLSECONDARYCOLOR3BEXTPROC)gladLazyResolve("glSecondaryColor3bEXT");
+	glad_glSecondaryColor3bEXT(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3bvEXT(const GLbyte *v) {
+	glad_glSecondaryColor3bvEXT = (PFNGLSECONDARYCOLOR3BVEXTPROC)gladLazyResolve("glSecondaryColor3bvEXT");
+	glad_glSecondaryColor3bvEXT(v);
+}
+
+static void APIENTRY lazy_glSecondaryColor3dEXT(GLdouble red, GLdouble green, GLdouble blue) {
+	glad_glSecondaryColor3dEXT = (PFNGLSECONDARYCOLOR3DEXTPROC)gladLazyResolve("glSecondaryColor3dEXT");
+	glad_glSecondaryColor3dEXT(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3dvEXT(const GLdouble *v) {
+	glad_glSecondaryColor3dvEXT = (PFNGLSECONDARYCOLOR3DVEXTPROC)gladLazyResolve("glSecondaryColor3dvEXT");
+	glad_glSecondaryColor3dvEXT(v);
+}
+
+static void APIENTRY lazy_glSecondaryColor3fEXT(GLfloat red, GLfloat green, GLfloat blue) {
+	glad_glSecondaryColor3fEXT = (PFNGLSECONDARYCOLOR3FEXTPROC)gladLazyResolve("glSecondaryColor3fEXT");
+	glad_glSecondaryColor3fEXT(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3fvEXT(const GLfloat *v) {
+	glad_glSecondaryColor3fvEXT = (PFNGLSECONDARYCOLOR3FVEXTPROC)gladLazyResolve("glSecondaryColor3fvEXT");
+	glad_glSecondaryColor3fvEXT(v);
+}
+
+static void APIENTRY lazy_glSecondaryColor3iEXT(GLint red, GLint green, GLint blue) {
+	glad_glSecondaryColor3iEXT = (PFNGLSECONDARYCOLOR3IEXTPROC)gladLazyResolve("glSecondaryColor3iEXT");
+	glad_glSecondaryColor3iEXT(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3ivEXT(const GLint *v) {
+	glad_glSecondaryColor3ivEXT = (PFNGLSECONDARYCOLOR3IVEXTPROC)gladLazyResolve("glSecondaryColor3ivEXT");
+	glad_glSecondaryColor3ivEXT(v);
+}
+
+static void APIENTRY lazy_glSecondaryColor3sEXT(GLshort red, GLshort green, GLshort blue) {
+	glad_glSecondaryColor3sEXT = (PFNGLSECONDARYCOLOR3SEXTPROC)gladLazyResolve("glSecondaryColor3sEXT");
+	glad_glSecondaryColor3sEXT(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3svEXT(const GLshort *v) {
+	glad_glSecondaryColor3svEXT = (PFNGLSECONDARYCOLOR3SVEXTPROC)gladLazyResolve("glSecondaryColor3svEXT");
+	glad_glSecondaryColor3svEXT(v);
+}
+
+static void APIENTRY lazy_glSecondaryColor3ubEXT(GLubyte red, GLubyte green, GLubyte blue) {
+	glad_glSecondaryColor3ubEXT = (PFNGLSECONDARYCOLOR3UBEXTPROC)gladLazyResolve("glSecondaryColor3ubEXT");
+	glad_glSecondaryColor3ubEXT(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3ubvEXT(const GLubyte *v) {
+	glad_glSecondaryColor3ubvEXT = (PFNGLSECONDARYCOLOR3UBVEXTPROC)gladLazyResolve("glSecondaryColor3ubvEXT");
+	glad_glSecondaryColor3ubvEXT(v);
+}
+
+static void APIENTRY lazy_glSecondaryColor3uiEXT(GLuint red, GLuint green, GLuint blue) {
+	glad_glSecondaryColor3uiEXT = (PFNGLSECONDARYCOLOR3UIEXTPROC)gladLazyResolve("glSecondaryColor3uiEXT");
+	glad_glSecondaryColor3uiEXT(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3uivEXT(const GLuint *v) {
+	glad_glSecondaryColor3uivEXT = (PFNGLSECONDARYCOLOR3UIVEXTPROC)gladLazyResolve("glSecondaryColor3uivEXT");
+	glad_glSecondaryColor3uivEXT(v);
+}
+
+static void APIENTRY lazy_glSecondaryColor3usEXT(GLushort red, GLushort green, GLushort blue) {
+	glad_glSecondaryColor3usEXT = (PFNGLSECONDARYCOLOR3USEXTPROC)gladLazyResolve("glSecondaryColor3usEXT");
+	glad_glSecondaryColor3usEXT(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3usvEXT(const GLushort *v) {
+	glad_glSecondaryColor3usvEXT = (PFNGLSECONDARYCOLOR3USVEXTPROC)gladLazyResolve("glSecondaryColor3usvEXT");
+	glad_glSecondaryColor3usvEXT(v);
+}
+
+static void APIENTRY lazy_glSecondaryColorPointerEXT(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glSecondaryColorPointerEXT = (PFNGLSECONDARYCOLORPOINTEREXTPROC)gladLazyResolve("glSecondaryColorPointerEXT");
+	glad_glSecondaryColorPointerEXT(size, type, stride, pointer);
+}
+
+static void APIENTRY lazy_glGenSemaphoresEXT(GLsizei n, GLuint *semaphores) {
+	glad_glGenSemaphoresEXT = (PFNGLGENSEMAPHORESEXTPROC)gladLazyResolve("glGenSemaphoresEXT");
+	glad_glGenSemaphoresEXT(n, semaphores);
+}
+
+static void APIENTRY lazy_glDeleteSemaphoresEXT(GLsizei n, const GLuint *semaphores) {
+	glad_glDeleteSemaphoresEXT = (PFNGLDELETESEMAPHORESEXTPROC)gladLazyResolve("glDeleteSemaphoresEXT");
+	glad_glDeleteSemaphoresEXT(n, semaphores);
+}
+
+static GLboolean APIENTRY lazy_glIsSemaphoreEXT(GLuint semaphore) {
+	glad_glIsSemaphoreEXT = (PFNGLISSEMAPHOREEXTPROC)gladLazyResolve("glIsSemaphoreEXT");
+	return glad_glIsSemaphoreEXT(semaphore);
+}
+
+static void APIENTRY lazy_glSemaphoreParameterui64vEXT(GLuint semaphore, GLenum pname, const GLuint64 *params) {
+	glad_glSemaphoreParameterui64vEXT = (PFNGLSEMAPHOREPARAMETERUI64VEXTPROC)gladLazyResolve("glSemaphoreParameterui64vEXT");
+	glad_glSemaphoreParameterui64vEXT(semaphore, pname, params);
+}
+
+static void APIENTRY lazy_glGetSemaphoreParameterui64vEXT(GLuint semaphore, GLenum pname, GLuint64 *params) {
+	glad_glGetSemaphoreParameterui64vEXT = (PFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC)gladLazyResolve("glGetSemaphoreParameterui64vEXT");
+	glad_glGetSemaphoreParameterui64vEXT(semaphore, pname, params);
+}
+
+static void APIENTRY lazy_glWaitSemaphoreEXT(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *srcLayouts) {
+	glad_glWaitSemaphoreEXT = (PFNGLWAITSEMAPHOREEXTPROC)gladLazyResolve("glWaitSemaphoreEXT");
+	glad_glWaitSemaphoreEXT(semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, srcLayouts);
+}
+
+static void APIENTRY lazy_glSignalSemaphoreEXT(GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *dstLayouts) {
+	glad_glSignalSemaphoreEXT = (PFNGLSIGNALSEMAPHOREEXTPROC)gladLazyResolve("glSignalSemaphoreEXT");
+	glad_glSignalSemaphoreEXT(semaphore, numBufferBarriers, buffers, numTextureBarriers, textures, dstLayouts);
+}
+
+static void APIENTRY lazy_glImportSemaphoreFdEXT(GLuint semaphore, GLenum handleType, GLint fd) {
+	glad_glImportSemaphoreFdEXT = (PFNGLIMPORTSEMAPHOREFDEXTPROC)gladLazyResolve("glImportSemaphoreFdEXT");
+	glad_glImportSemaphoreFdEXT(semaphore, handleType, fd);
+}
+
+static void APIENTRY lazy_glImportSemaphoreWin32HandleEXT(GLuint semaphore, GLenum handleType, void *handle) {
+	glad_glImportSemaphoreWin32HandleEXT = (PFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC)gladLazyResolve("glImportSemaphoreWin32HandleEXT");
+	glad_glImportSemaphoreWin32HandleEXT(semaphore, handleType, handle);
+}
+
+static void APIENTRY lazy_glImportSemaphoreWin32NameEXT(GLuint semaphore, GLenum handleType, const void *name) {
+	glad_glImportSemaphoreWin32NameEXT = (PFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC)gladLazyResolve("glImportSemaphoreWin32NameEXT");
+	glad_glImportSemaphoreWin32NameEXT(semaphore, handleType, name);
+}
+
+static void APIENTRY lazy_glUseShaderProgramEXT(GLenum type, GLuint program) {
+	glad_glUseShaderProgramEXT = (PFNGLUSESHADERPROGRAMEXTPROC)gladLazyResolve("glUseShaderProgramEXT");
+	glad_glUseShaderProgramEXT(type, program);
+}
+
+static void APIENTRY lazy_glActiveProgramEXT(GLuint program) {
+	glad_glActiveProgramEXT = (PFNGLACTIVEPROGRAMEXTPROC)gladLazyResolve("glActiveProgramEXT");
+	glad_glActiveProgramEXT(program);
+}
+
+static GLuint APIENTRY lazy_glCreateShaderProgramEXT(GLenum type, const GLchar *string) {
+	glad_glCreateShaderProgramEXT = (PFNGLCREATESHADERPROGRAMEXTPROC)gladLazyResolve("glCreateShaderProgramEXT");
+	return glad_glCreateShaderProgramEXT(type, string);
+}
+
+static void APIENTRY lazy_glActiveShaderProgramEXT(GLuint pipeline, GLuint program) {
+	glad_glActiveShaderProgramEXT = (PFNGLACTIVESHADERPROGRAMEXTPROC)gladLazyResolve("glActiveShaderProgramEXT");
+	glad_glActiveShaderProgramEXT(pipeline, program);
+}
+
+static void APIENTRY lazy_glBindProgramPipelineEXT(GLuint pipeline) {
+	glad_glBindProgramPipelineEXT = (PFNGLBINDPROGRAMPIPELINEEXTPROC)gladLazyResolve("glBindProgramPipelineEXT");
+	glad_glBindProgramPipelineEXT(pipeline);
+}
+
+static GLuint APIENTRY lazy_glCreateShaderProgramvEXT(GLenum type, GLsizei count, const GLchar *const*strings) {
+	glad_glCreateShaderProgramvEXT = (PFNGLCREATESHADERPROGRAMVEXTPROC)gladLazyResolve("glCreateShaderProgramvEXT");
+	return glad_glCreateShaderProgramvEXT(type, count, strings);
+}
+
+static void APIENTRY lazy_glDeleteProgramPipelinesEXT(GLsizei n, const GLuint *pipelines) {
+	glad_glDeleteProgramPipelinesEXT = (PFNGLDELETEPROGRAMPIPELINESEXTPROC)gladLazyResolve("glDeleteProgramPipelinesEXT");
+	glad_glDeleteProgramPipelinesEXT(n, pipelines);
+}
+
+static void APIENTRY lazy_glGenProgramPipelinesEXT(GLsizei n, GLuint *pipelines) {
+	glad_glGenProgramPipelinesEXT = (PFNGLGENPROGRAMPIPELINESEXTPROC)gladLazyResolve("glGenProgramPipelinesEXT");
+	glad_glGenProgramPipelinesEXT(n, pipelines);
+}
+
+static void APIENTRY lazy_glGetProgramPipelineInfoLogEXT(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetProgramPipelineInfoLogEXT = (PFNGLGETPROGRAMPIPELINEINFOLOGEXTPROC)gladLazyResolve("glGetProgramPipelineInfoLogEXT");
+	glad_glGetProgramPipelineInfoLogEXT(pipeline, bufSize, length, infoLog);
+}
+
+static void APIENTRY lazy_glGetProgramPipelineivEXT(GLuint pipeline, GLenum pname, GLint *params) {
+	glad_glGetProgramPipelineivEXT = (PFNGLGETPROGRAMPIPELINEIVEXTPROC)gladLazyResolve("glGetProgramPipelineivEXT");
+	glad_glGetProgramPipelineivEXT(pipeline, pname, params);
+}
+
+static GLboolean APIENTRY lazy_glIsProgramPipelineEXT(GLuint pipeline) {
+	glad_glIsProgramPipelineEXT = (PFNGLISPROGRAMPIPELINEEXTPROC)gladLazyResolve("glIsProgramPipelineEXT");
+	return glad_glIsProgramPipelineEXT(pipeline);
+}
+
+static void APIENTRY lazy_glUseProgramStagesEXT(GLuint pipeline, GLbitfield stages, GLuint program) {
+	glad_glUseProgramStagesEXT = (PFNGLUSEPROGRAMSTAGESEXTPROC)gladLazyResolve("glUseProgramStagesEXT");
+	glad_glUseProgramStagesEXT(pipeline, stages, program);
+}
+
+static void APIENTRY lazy_glValidateProgramPipelineEXT(GLuint pipeline) {
+	glad_glValidateProgramPipelineEXT = (PFNGLVALIDATEPROGRAMPIPELINEEXTPROC)gladLazyResolve("glValidateProgramPipelineEXT");
+	glad_glValidateProgramPipelineEXT(pipeline);
+}
+
+static void APIENTRY lazy_glFramebufferFetchBarrierEXT(void) {
+	glad_glFramebufferFetchBarrierEXT = (PFNGLFRAMEBUFFERFETCHBARRIEREXTPROC)gladLazyResolve("glFramebufferFetchBarrierEXT");
+	glad_glFramebufferFetchBarrierEXT();
+}
+
+static void APIENTRY lazy_glBindImageTextureEXT(GLuint index, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLint format) {
+	glad_glBindImageTextureEXT = (PFNGLBINDIMAGETEXTUREEXTPROC)gladLazyResolve("glBindImageTextureEXT");
+	glad_glBindImageTextureEXT(index, texture, level, layered, layer, access, format);
+}
+
+static void APIENTRY lazy_glMemoryBarrierEXT(GLbitfield barriers) {
+	glad_glMemoryBarrierEXT = (PFNGLMEMORYBARRIEREXTPROC)gladLazyResolve("glMemoryBarrierEXT");
+	glad_glMemoryBarrierEXT(barriers);
+}
+
+static void APIENTRY lazy_glStencilClearTagEXT(GLsizei stencilTagBits, GLuint stencilClearTag) {
+	glad_glStencilClearTagEXT = (PFNGLSTENCILCLEARTAGEXTPROC)gladLazyResolve("glStencilClearTagEXT");
+	glad_glStencilClearTagEXT(stencilTagBits, stencilClearTag);
+}
+
+static void APIENTRY lazy_glActiveStencilFaceEXT(GLenum face) {
+	glad_glActiveStencilFaceEXT = (PFNGLACTIVESTENCILFACEEXTPROC)gladLazyResolve("glActiveStencilFaceEXT");
+	glad_glActiveStencilFaceEXT(face);
+}
+
+static void APIENTRY lazy_glTexSubImage1DEXT(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage1DEXT = (PFNGLTEXSUBIMAGE1DEXTPROC)gladLazyResolve("glTexSubImage1DEXT");
+	glad_glTexSubImage1DEXT(target, level, xoffset, width, format, type, pixels);
+}
+
+static void APIENTRY lazy_glTexSubImage2DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage2DEXT = (PFNGLTEXSUBIMAGE2DEXTPROC)gladLazyResolve("glTexSubImage2DEXT");
+	glad_glTexSubImage2DEXT(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void APIENTRY lazy_glTexImage3DEXT(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage3DEXT = (PFNGLTEXIMAGE3DEXTPROC)gladLazyResolve("glTexImage3DEXT");
+	glad_glTexImage3DEXT(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static void APIENTRY lazy_glTexSubImage3DEXT(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage3DEXT = (PFNGLTEXSUBIMAGE3DEXTPROC)gladLazyResolve("glTexSubImage3DEXT");
+	glad_glTexSubImage3DEXT(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void APIENTRY lazy_glFramebufferTextureLayerEXT(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glFramebufferTextureLayerEXT = (PFNGLFRAMEBUFFERTEXTURELAYEREXTPROC)gladLazyResolve("glFramebufferTextureLayerEXT");
+	glad_glFramebufferTextureLayerEXT(target, attachment, texture, level, layer);
+}
+
+static void APIENTRY lazy_glTexBufferEXT(GLenum target, GLenum internalformat, GLuint buffer) {
+	glad_glTexBufferEXT = (PFNGLTEXBUFFEREXTPROC)gladLazyResolve("glTexBufferEXT");
+	glad_glTexBufferEXT(target, internalformat, buffer);
+}
+
+static void APIENTRY lazy_glTexParameterIivEXT(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameterIivEXT = (PFNGLTEXPARAMETERIIVEXTPROC)gladLazyResolve("glTexParameterIivEXT");
+	glad_glTexParameterIivEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glTexParameterIuivEXT(GLenum target, GLenum pname, const GLuint *params) {
+	glad_glTexParameterIuivEXT = (PFNGLTEXPARAMETERIUIVEXTPROC)gladLazyResolve("glTexParameterIuivEXT");
+	glad_glTexParameterIuivEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetTexParameterIivEXT(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameterIivEXT = (PFNGLGETTEXPARAMETERIIVEXTPROC)gladLazyResolve("glGetTexParameterIivEXT");
+	glad_glGetTexParameterIivEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetTexParameterIuivEXT(GLenum target, GLenum pname, GLuint *params) {
+	glad_glGetTexParameterIuivEXT = (PFNGLGETTEXPARAMETERIUIVEXTPROC)gladLazyResolve("glGetTexParameterIuivEXT");
+	glad_glGetTexParameterIuivEXT(target, pname, params);
+}
+
+static void APIENTRY lazy_glClearColorIiEXT(GLint red, GLint green, GLint blue, GLint alpha) {
+	glad_glClearColorIiEXT = (PFNGLCLEARCOLORIIEXTPROC)gladLazyResolve("glClearColorIiEXT");
+	glad_glClearColorIiEXT(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glClearColorIuiEXT(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+	glad_glClearColorIuiEXT = (PFNGLCLEARCOLORIUIEXTPROC)gladLazyResolve("glClearColorIuiEXT");
+	glad_glClearColorIuiEXT(red, green, blue, alpha);
+}
+
+static GLboolean APIENTRY lazy_glAreTexturesResidentEXT(GLsizei n, const GLuint *textures, GLboolean *residences) {
+	glad_glAreTexturesResidentEXT = (PFNGLARETEXTURESRESIDENTEXTPROC)gladLazyResolve("glAreTexturesResidentEXT");
+	return glad_glAreTexturesResidentEXT(n, textures, residences);
+}
+
+static void APIENTRY lazy_glBindTextureEXT(GLenum target, GLuint texture) {
+	glad_glBindTextureEXT = (PFNGLBINDTEXTUREEXTPROC)gladLazyResolve("glBindTextureEXT");
+	glad_glBindTextureEXT(target, texture);
+}
+
+static void APIENTRY lazy_glDeleteTexturesEXT(GLsizei n, const GLuint *textures) {
+	glad_glDeleteTexturesEXT = (PFNGLDELETETEXTURESEXTPROC)gladLazyResolve("glDeleteTexturesEXT");
+	glad_glDeleteTexturesEXT(n, textures);
+}
+
+static void APIENTRY lazy_glGenTexturesEXT(GLsizei n, GLuint *textures) {
+	glad_glGenTexturesEXT = (PFNGLGENTEXTURESEXTPROC)gladLazyResolve("glGenTexturesEXT");
+	glad_glGenTexturesEXT(n, textures);
+}
+
+static GLboolean APIENTRY lazy_glIsTextureEXT(GLuint texture) {
+	glad_glIsTextureEXT = (PFNGLISTEXTUREEXTPROC)gladLazyResolve("glIsTextureEXT");
+	return glad_glIsTextureEXT(texture);
+}
+
+static void APIENTRY lazy_glPrioritizeTexturesEXT(GLsizei n, const GLuint *textures, const GLclampf *priorities) {
+	glad_glPrioritizeTexturesEXT = (PFNGLPRIORITIZETEXTURESEXTPROC)gladLazyResolve("glPrioritizeTexturesEXT");
+	glad_glPrioritizeTexturesEXT(n, textures, priorities);
+}
+
+static void APIENTRY lazy_glTextureNormalEXT(GLenum mode) {
+	glad_glTextureNormalEXT = (PFNGLTEXTURENORMALEXTPROC)gladLazyResolve("glTextureNormalEXT");
+	glad_glTextureNormalEXT(mode);
+}
+
+static void APIENTRY lazy_glTexStorage1DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+	glad_glTexStorage1DEXT = (PFNGLTEXSTORAGE1DEXTPROC)gladLazyResolve("glTexStorage1DEXT");
+	glad_glTexStorage1DEXT(target, levels, internalformat, width);
+}
+
+static void APIENTRY lazy_glTexStorage2DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glTexStorage2DEXT = (PFNGLTEXSTORAGE2DEXTPROC)gladLazyResolve("glTexStorage2DEXT");
+	glad_glTexStorage2DEXT(target, levels, internalformat, width, height);
+}
+
+static void APIENTRY lazy_glTexStorage3DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glTexStorage3DEXT = (PFNGLTEXSTORAGE3DEXTPROC)gladLazyResolve("glTexStorage3DEXT");
+	glad_glTexStorage3DEXT(target, levels, internalformat, width, height, depth);
+}
+
+static void APIENTRY lazy_glGetQueryObjecti64vEXT(GLuint id, GLenum pname, GLint64 *params) {
+	glad_glGetQueryObjecti64vEXT = (PFNGLGETQUERYOBJECTI64VEXTPROC)gladLazyResolve("glGetQueryObjecti64vEXT");
+	glad_glGetQueryObjecti64vEXT(id, pname, params);
+}
+
+static void APIENTRY lazy_glGetQueryObjectui64vEXT(GLuint id, GLenum pname, GLuint64 *params) {
+	glad_glGetQueryObjectui64vEXT = (PFNGLGETQUERYOBJECTUI64VEXTPROC)gladLazyResolve("glGetQueryObjectui64vEXT");
+	glad_glGetQueryObjectui64vEXT(id, pname, params);
+}
+
+static void APIENTRY lazy_glBeginTransformFeedbackEXT(GLenum primitiveMode) {
+	glad_glBeginTransformFeedbackEXT = (PFNGLBEGINTRANSFORMFEEDBACKEXTPROC)gladLazyResolve("glBeginTransformFeedbackEXT");
+	glad_glBeginTransformFeedbackEXT(primitiveMode);
+}
+
+static void APIENTRY lazy_glEndTransformFeedbackEXT(void) {
+	glad_glEndTransformFeedbackEXT = (PFNGLENDTRANSFORMFEEDBACKEXTPROC)gladLazyResolve("glEndTransformFeedbackEXT");
+	glad_glEndTransformFeedbackEXT();
+}
+
+static void APIENTRY lazy_glBindBufferRangeEXT(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glBindBufferRangeEXT = (PFNGLBINDBUFFERRANGEEXTPROC)gladLazyResolve("glBindBufferRangeEXT");
+	glad_glBindBufferRangeEXT(target, index, buffer, offset, size);
+}
+
+static void APIENTRY lazy_glBindBufferOffsetEXT(GLenum target, GLuint index, GLuint buffer, GLintptr offset) {
+	glad_glBindBufferOffsetEXT = (PFNGLBINDBUFFEROFFSETEXTPROC)gladLazyResolve("glBindBufferOffsetEXT");
+	glad_glBindBufferOffsetEXT(target, index, buffer, offset);
+}
+
+static void APIENTRY lazy_glBindBufferBaseEXT(GLenum target, GLuint index, GLuint buffer) {
+	glad_glBindBufferBaseEXT = (PFNGLBINDBUFFERBASEEXTPROC)gladLazyResolve("glBindBufferBaseEXT");
+	glad_glBindBufferBaseEXT(target, index, buffer);
+}
+
+static void APIENTRY lazy_glTransformFeedbackVaryingsEXT(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	glad_glTransformFeedbackVaryingsEXT = (PFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC)gladLazyResolve("glTransformFeedbackVaryingsEXT");
+	glad_glTransformFeedbackVaryingsEXT(program, count, varyings, bufferMode);
+}
+
+static void APIENTRY lazy_glGetTransformFeedbackVaryingEXT(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	glad_glGetTransformFeedbackVaryingEXT = (PFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC)gladLazyResolve("glGetTransformFeedbackVaryingEXT");
+	glad_glGetTransformFeedbackVaryingEXT(program, index, bufSize, length, size, type, name);
+}
+
+static void APIENTRY lazy_glArrayElementEXT(GLint i) {
+	glad_glArrayElementEXT = (PFNGLARRAYELEMENTEXTPROC)gladLazyResolve("glArrayElementEXT");
+	glad_glArrayElementEXT(i);
+}
+
+static void APIENTRY lazy_glColorPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer) {
+	glad_glColorPointerEXT = (PFNGLCOLORPOINTEREXTPROC)gladLazyResolve("glColorPointerEXT");
+	glad_glColorPointerEXT(size, type, stride, count, pointer);
+}
+
+static void APIENTRY lazy_glDrawArraysEXT(GLenum mode, GLint first, GLsizei count) {
+	glad_glDrawArraysEXT = (PFNGLDRAWARRAYSEXTPROC)gladLazyResolve("glDrawArraysEXT");
+	glad_glDrawArraysEXT(mode, first, count);
+}
+
+static void APIENTRY lazy_glEdgeFlagPointerEXT(GLsizei stride, GLsizei count, const GLboolean *pointer) {
+	glad_glEdgeFlagPointerEXT = (PFNGLEDGEFLAGPOINTEREXTPROC)gladLazyResolve("glEdgeFlagPointerEXT");
+	glad_glEdgeFlagPointerEXT(stride, count, pointer);
+}
+
+static void APIENTRY lazy_glGetPointervEXT(GLenum pname, void **params) {
+	glad_glGetPointervEXT = (PFNGLGETPOINTERVEXTPROC)gladLazyResolve("glGetPointervEXT");
+	glad_glGetPointervEXT(pname, params);
+}
+
+static void APIENTRY lazy_glIndexPointerEXT(GLenum type, GLsizei stride, GLsizei count, const void *pointer) {
+	glad_glIndexPointerEXT = (PFNGLINDEXPOINTEREXTPROC)gladLazyResolve("glIndexPointerEXT");
+	glad_glIndexPointerEXT(type, stride, count, pointer);
+}
+
+static void APIENTRY lazy_glNormalPointerEXT(GLenum type, GLsizei stride, GLsizei count, const void *pointer) {
+	glad_glNormalPointerEXT = (PFNGLNORMALPOINTEREXTPROC)gladLazyResolve("glNormalPointerEXT");
+	glad_glNormalPointerEXT(type, stride, count, pointer);
+}
+
+static void APIENTRY lazy_glTexCoordPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer) {
+	glad_glTexCoordPointerEXT = (PFNGLTEXCOORDPOINTEREXTPROC)gladLazyResolve("glTexCoordPointerEXT");
+	glad_glTexCoordPointerEXT(size, type, stride, count, pointer);
+}
+
+static void APIENTRY lazy_glVertexPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer) {
+	glad_glVertexPointerEXT = (PFNGLVERTEXPOINTEREXTPROC)gladLazyResolve("glVertexPointerEXT");
+	glad_glVertexPointerEXT(size, type, stride, count, pointer);
+}
+
+static void APIENTRY lazy_glVertexAttribL1dEXT(GLuint index, GLdouble x) {
+	glad_glVertexAttribL1dEXT = (PFNGLVERTEXATTRIBL1DEXTPROC)gladLazyResolve("glVertexAttribL1dEXT");
+	glad_glVertexAttribL1dEXT(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttribL2dEXT(GLuint index, GLdouble x, GLdouble y) {
+	glad_glVertexAttribL2dEXT = (PFNGLVERTEXATTRIBL2DEXTPROC)gladLazyResolve("glVertexAttribL2dEXT");
+	glad_glVertexAttribL2dEXT(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttribL3dEXT(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexAttribL3dEXT = (PFNGLVERTEXATTRIBL3DEXTPROC)gladLazyResolve("glVertexAttribL3dEXT");
+	glad_glVertexAttribL3dEXT(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttribL4dEXT(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexAttribL4dEXT = (PFNGLVERTEXATTRIBL4DEXTPROC)gladLazyResolve("glVertexAttribL4dEXT");
+	glad_glVertexAttribL4dEXT(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttribL1dvEXT(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL1dvEXT = (PFNGLVERTEXATTRIBL1DVEXTPROC)gladLazyResolve("glVertexAttribL1dvEXT");
+	glad_glVertexAttribL1dvEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribL2dvEXT(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL2dvEXT = (PFNGLVERTEXATTRIBL2DVEXTPROC)gladLazyResolve("glVertexAttribL2dvEXT");
+	glad_glVertexAttribL2dvEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribL3dvEXT(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL3dvEXT = (PFNGLVERTEXATTRIBL3DVEXTPROC)gladLazyResolve("glVertexAttribL3dvEXT");
+	glad_glVertexAttribL3dvEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribL4dvEXT(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL4dvEXT = (PFNGLVERTEXATTRIBL4DVEXTPROC)gladLazyResolve("glVertexAttribL4dvEXT");
+	glad_glVertexAttribL4dvEXT(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribLPointerEXT(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribLPointerEXT = (PFNGLVERTEXATTRIBLPOINTEREXTPROC)gladLazyResolve("glVertexAttribLPointerEXT");
+	glad_glVertexAttribLPointerEXT(index, size, type, stride, pointer);
+}
+
+static void APIENTRY lazy_glGetVertexAttribLdvEXT(GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetVertexAttribLdvEXT = (PFNGLGETVERTEXATTRIBLDVEXTPROC)gladLazyResolve("glGetVertexAttribLdvEXT");
+	glad_glGetVertexAttribLdvEXT(index, pname, params);
+}
+
+static void APIENTRY lazy_glBeginVertexShaderEXT(void) {
+	glad_glBeginVertexShaderEXT = (PFNGLBEGINVERTEXSHADEREXTPROC)gladLazyResolve("glBeginVertexShaderEXT");
+	glad_glBeginVertexShaderEXT();
+}
+
+static void APIENTRY lazy_glEndVertexShaderEXT(void) {
+	glad_glEndVertexShaderEXT = (PFNGLENDVERTEXSHADEREXTPROC)gladLazyResolve("glEndVertexShaderEXT");
+	glad_glEndVertexShaderEXT();
+}
+
+static void APIENTRY lazy_glBindVertexShaderEXT(GLuint id) {
+	glad_glBindVertexShaderEXT = (PFNGLBINDVERTEXSHADEREXTPROC)gladLazyResolve("glBindVertexShaderEXT");
+	glad_glBindVertexShaderEXT(id);
+}
+
+static GLuint APIENTRY lazy_glGenVertexShadersEXT(GLuint range) {
+	glad_glGenVertexShadersEXT = (PFNGLGENVERTEXSHADERSEXTPROC)gladLazyResolve("glGenVertexShadersEXT");
+	return glad_glGenVertexShadersEXT(range);
+}
+
+static void APIENTRY lazy_glDeleteVertexShaderEXT(GLuint id) {
+	glad_glDeleteVertexShaderEXT = (PFNGLDELETEVERTEXSHADEREXTPROC)gladLazyResolve("glDeleteVertexShaderEXT");
+	glad_glDeleteVertexShaderEXT(id);
+}
+
+static void APIENTRY lazy_glShaderOp1EXT(GLenum op, GLuint res, GLuint arg1) {
+	glad_glShaderOp1EXT = (PFNGLSHADEROP1EXTPROC)gladLazyResolve("glShaderOp1EXT");
+	glad_glShaderOp1EXT(op, res, arg1);
+}
+
+static void APIENTRY lazy_glShaderOp2EXT(GLenum op, GLuint res, GLuint arg1, GLuint arg2) {
+	glad_glShaderOp2EXT = (PFNGLSHADEROP2EXTPROC)gladLazyResolve("glShaderOp2EXT");
+	glad_glShaderOp2EXT(op, res, arg1, arg2);
+}
+
+static void APIENTRY lazy_glShaderOp3EXT(GLenum op, GLuint res, GLuint arg1, GLuint arg2, GLuint arg3) {
+	glad_glShaderOp3EXT = (PFNGLSHADEROP3EXTPROC)gladLazyResolve("glShaderOp3EXT");
+	glad_glShaderOp3EXT(op, res, arg1, arg2, arg3);
+}
+
+static void APIENTRY lazy_glSwizzleEXT(GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW) {
+	glad_glSwizzleEXT = (PFNGLSWIZZLEEXTPROC)gladLazyResolve("glSwizzleEXT");
+	glad_glSwizzleEXT(res, in, outX, outY, outZ, outW);
+}
+
+static void APIENTRY lazy_glWriteMaskEXT(GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW) {
+	glad_glWriteMaskEXT = (PFNGLWRITEMASKEXTPROC)gladLazyResolve("glWriteMaskEXT");
+	glad_glWriteMaskEXT(res, in, outX, outY, outZ, outW);
+}
+
+static void APIENTRY lazy_glInsertComponentEXT(GLuint res, GLuint src, GLuint num) {
+	glad_glInsertComponentEXT = (PFNGLINSERTCOMPONENTEXTPROC)gladLazyResolve("glInsertComponentEXT");
+	glad_glInsertComponentEXT(res, src, num);
+}
+
+static void APIENTRY lazy_glExtractComponentEXT(GLuint res, GLuint src, GLuint num) {
+	glad_glExtractComponentEXT = (PFNGLEXTRACTCOMPONENTEXTPROC)gladLazyResolve("glExtractComponentEXT");
+	glad_glExtractComponentEXT(res, src, num);
+}
+
+static GLuint APIENTRY lazy_glGenSymbolsEXT(GLenum datatype, GLenum storagetype, GLenum range, GLuint components) {
+	glad_glGenSymbolsEXT = (PFNGLGENSYMBOLSEXTPROC)gladLazyResolve("glGenSymbolsEXT");
+	return glad_glGenSymbolsEXT(datatype, storagetype, range, components);
+}
+
+static void APIENTRY lazy_glSetInvariantEXT(GLuint id, GLenum type, const void *addr) {
+	glad_glSetInvariantEXT = (PFNGLSETINVARIANTEXTPROC)gladLazyResolve("glSetInvariantEXT");
+	glad_glSetInvariantEXT(id, type, addr);
+}
+
+static void APIENTRY lazy_glSetLocalConstantEXT(GLuint id, GLenum type, const void *addr) {
+	glad_glSetLocalConstantEXT = (PFNGLSETLOCALCONSTANTEXTPROC)gladLazyResolve("glSetLocalConstantEXT");
+	glad_glSetLocalConstantEXT(id, type, addr);
+}
+
+static void APIENTRY lazy_glVariantbvEXT(GLuint id, const GLbyte *addr) {
+	glad_glVariantbvEXT = (PFNGLVARIANTBVEXTPROC)gladLazyResolve("glVariantbvEXT");
+	glad_glVariantbvEXT(id, addr);
+}
+
+static void APIENTRY lazy_glVariantsvEXT(GLuint id, const GLshort *addr) {
+	glad_glVariantsvEXT = (PFNGLVARIANTSVEXTPROC)gladLazyResolve("glVariantsvEXT");
+	glad_glVariantsvEXT(id, addr);
+}
+
+static void APIENTRY lazy_glVariantivEXT(GLuint id, const GLint *addr) {
+	glad_glVariantivEXT = (PFNGLVARIANTIVEXTPROC)gladLazyResolve("glVariantivEXT");
+	glad_glVariantivEXT(id, addr);
+}
+
+static void APIENTRY lazy_glVariantfvEXT(GLuint id, const GLfloat *addr) {
+	glad_glVariantfvEXT = (PFNGLVARIANTFVEXTPROC)gladLazyResolve("glVariantfvEXT");
+	glad_glVariantfvEXT(id, addr);
+}
+
+static void APIENTRY lazy_glVariantdvEXT(GLuint id, const GLdouble *addr) {
+	glad_glVariantdvEXT = (PFNGLVARIANTDVEXTPROC)gladLazyResolve("glVariantdvEXT");
+	glad_glVariantdvEXT(id, addr);
+}
+
+static void APIENTRY lazy_glVariantubvEXT(GLuint id, const GLubyte *addr) {
+	glad_glVariantubvEXT = (PFNGLVARIANTUBVEXTPROC)gladLazyResolve("glVariantubvEXT");
+	glad_glVariantubvEXT(id, addr);
+}
+
+static void APIENTRY lazy_glVariantusvEXT(GLuint id, const GLushort *addr) {
+	glad_glVariantusvEXT = (PFNGLVARIANTUSVEXTPROC)gladLazyResolve("glVariantusvEXT");
+	glad_glVariantusvEXT(id, addr);
+}
+
+static void APIENTRY lazy_glVariantuivEXT(GLuint id, const GLuint *addr) {
+	glad_glVariantuivEXT = (PFNGLVARIANTUIVEXTPROC)gladLazyResolve("glVariantuivEXT");
+	glad_glVariantuivEXT(id, addr);
+}
+
+static void APIENTRY lazy_glVariantPointerEXT(GLuint id, GLenum type, GLuint stride, const void *addr) {
+	glad_glVariantPointerEXT = (PFNGLVARIANTPOINTEREXTPROC)gladLazyResolve("glVariantPointerEXT");
+	glad_glVariantPointerEXT(id, type, stride, addr);
+}
+
+static void APIENTRY lazy_glEnableVariantClientStateEXT(GLuint id) {
+	glad_glEnableVariantClientStateEXT = (PFNGLENABLEVARIANTCLIENTSTATEEXTPROC)gladLazyResolve("glEnableVariantClientStateEXT");
+	glad_glEnableVariantClientStateEXT(id);
+}
+
+static void APIENTRY lazy_glDisableVariantClientStateEXT(GLuint id) {
+	glad_glDisableVariantClientStateEXT = (PFNGLDISABLEVARIANTCLIENTSTATEEXTPROC)gladLazyResolve("glDisableVariantClientStateEXT");
+	glad_glDisableVariantClientStateEXT(id);
+}
+
+static GLuint APIENTRY lazy_glBindLightParameterEXT(GLenum light, GLenum value) {
+	glad_glBindLightParameterEXT = (PFNGLBINDLIGHTPARAMETEREXTPROC)gladLazyResolve("glBindLightParameterEXT");
+	return glad_glBindLightParameterEXT(light, value);
+}
+
+static GLuint APIENTRY lazy_glBindMaterialParameterEXT(GLenum face, GLenum value) {
+	glad_glBindMaterialParameterEXT = (PFNGLBINDMATERIALPARAMETEREXTPROC)gladLazyResolve("glBindMaterialParameterEXT");
+	return glad_glBindMaterialParameterEXT(face, value);
+}
+
+static GLuint APIENTRY lazy_glBindTexGenParameterEXT(GLenum unit, GLenum coord, GLenum value) {
+	glad_glBindTexGenParameterEXT = (PFNGLBINDTEXGENPARAMETEREXTPROC)gladLazyResolve("glBindTexGenParameterEXT");
+	return glad_glBindTexGenParameterEXT(unit, coord, value);
+}
+
+static GLuint APIENTRY lazy_glBindTextureUnitParameterEXT(GLenum unit, GLenum value) {
+	glad_glBindTextureUnitParameterEXT = (PFNGLBINDTEXTUREUNITPARAMETEREXTPROC)gladLazyResolve("glBindTextureUnitParameterEXT");
+	return glad_glBindTextureUnitParameterEXT(unit, value);
+}
+
+static GLuint APIENTRY lazy_glBindParameterEXT(GLenum value) {
+	glad_glBindParameterEXT = (PFNGLBINDPARAMETEREXTPROC)gladLazyResolve("glBindParameterEXT");
+	return glad_glBindParameterEXT(value);
+}
+
+static GLboolean APIENTRY lazy_glIsVariantEnabledEXT(GLuint id, GLenum cap) {
+	glad_glIsVariantEnabledEXT = (PFNGLISVARIANTENABLEDEXTPROC)gladLazyResolve("glIsVariantEnabledEXT");
+	return glad_glIsVariantEnabledEXT(id, cap);
+}
+
+static void APIENTRY lazy_glGetVariantBooleanvEXT(GLuint id, GLenum value, GLboolean *data) {
+	glad_glGetVariantBooleanvEXT = (PFNGLGETVARIANTBOOLEANVEXTPROC)gladLazyResolve("glGetVariantBooleanvEXT");
+	glad_glGetVariantBooleanvEXT(id, value, data);
+}
+
+static void APIENTRY lazy_glGetVariantIntegervEXT(GLuint id, GLenum value, GLint *data) {
+	glad_glGetVariantIntegervEXT = (PFNGLGETVARIANTINTEGERVEXTPROC)gladLazyResolve("glGetVariantIntegervEXT");
+	glad_glGetVariantIntegervEXT(id, value, data);
+}
+
+static void APIENTRY lazy_glGetVariantFloatvEXT(GLuint id, GLenum value, GLfloat *data) {
+	glad_glGetVariantFloatvEXT = (PFNGLGETVARIANTFLOATVEXTPROC)gladLazyResolve("glGetVariantFloatvEXT");
+	glad_glGetVariantFloatvEXT(id, value, data);
+}
+
+static void APIENTRY lazy_glGetVariantPointervEXT(GLuint id, GLenum value, void **data) {
+	glad_glGetVariantPointervEXT = (PFNGLGETVARIANTPOINTERVEXTPROC)gladLazyResolve("glGetVariantPointervEXT");
+	glad_glGetVariantPointervEXT(id, value, data);
+}
+
+static void APIENTRY lazy_glGetInvariantBooleanvEXT(GLuint id, GLenum value, GLboolean *data) {
+	glad_glGetInvariantBooleanvEXT = (PFNGLGETINVARIANTBOOLEANVEXTPROC)gladLazyResolve("glGetInvariantBooleanvEXT");
+	glad_glGetInvariantBooleanvEXT(id, value, data);
+}
+
+static void APIENTRY lazy_glGetInvariantIntegervEXT(GLuint id, GLenum value, GLint *data) {
+	glad_glGetInvariantIntegervEXT = (PFNGLGETINVARIANTINTEGERVEXTPROC)gladLazyResolve("glGetInvariantIntegervEXT");
+	glad_glGetInvariantIntegervEXT(id, value, data);
+}
+
+static void APIENTRY lazy_glGetInvariantFloatvEXT(GLuint id, GLenum value, GLfloat *data) {
+	glad_glGetInvariantFloatvEXT = (PFNGLGETINVARIANTFLOATVEXTPROC)gladLazyResolve("glGetInvariantFloatvEXT");
+	glad_glGetInvariantFloatvEXT(id, value, data);
+}
+
+static void APIENTRY lazy_glGetLocalConstantBooleanvEXT(GLuint id, GLenum value, GLboolean *data) {
+	glad_glGetLocalConstantBooleanvEXT = (PFNGLGETLOCALCONSTANTBOOLEANVEXTPROC)gladLazyResolve("glGetLocalConstantBooleanvEXT");
+	glad_glGetLocalConstantBooleanvEXT(id, value, data);
+}
+
+static void APIENTRY lazy_glGetLocalConstantIntegervEXT(GLuint id, GLenum value, GLint *data) {
+	glad_glGetLocalConstantIntegervEXT = (PFNGLGETLOCALCONSTANTINTEGERVEXTPROC)gladLazyResolve("glGetLocalConstantIntegervEXT");
+	glad_glGetLocalConstantIntegervEXT(id, value, data);
+}
+
+static void APIENTRY lazy_glGetLocalConstantFloatvEXT(GLuint id, GLenum value, GLfloat *data) {
+	glad_glGetLocalConstantFloatvEXT = (PFNGLGETLOCALCONSTANTFLOATVEXTPROC)gladLazyResolve("glGetLocalConstantFloatvEXT");
+	glad_glGetLocalConstantFloatvEXT(id, value, data);
+}
+
+static void APIENTRY lazy_glVertexWeightfEXT(GLfloat weight) {
+	glad_glVertexWeightfEXT = (PFNGLVERTEXWEIGHTFEXTPROC)gladLazyResolve("glVertexWeightfEXT");
+	glad_glVertexWeightfEXT(weight);
+}
+
+static void APIENTRY lazy_glVertexWeightfvEXT(const GLfloat *weight) {
+	glad_glVertexWeightfvEXT = (PFNGLVERTEXWEIGHTFVEXTPROC)gladLazyResolve("glVertexWeightfvEXT");
+	glad_glVertexWeightfvEXT(weight);
+}
+
+static void APIENTRY lazy_glVertexWeightPointerEXT(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexWeightPointerEXT = (PFNGLVERTEXWEIGHTPOINTEREXTPROC)gladLazyResolve("glVertexWeightPointerEXT");
+	glad_glVertexWeightPointerEXT(size, type, stride, pointer);
+}
+
+static GLboolean APIENTRY lazy_glAcquireKeyedMutexWin32EXT(GLuint memory, GLuint64 key, GLuint timeout) {
+	glad_glAcquireKeyedMutexWin32EXT = (PFNGLACQUIREKEYEDMUTEXWIN32EXTPROC)gladLazyResolve("glAcquireKeyedMutexWin32EXT");
+	return glad_glAcquireKeyedMutexWin32EXT(memory, key, timeout);
+}
+
+static GLboolean APIENTRY lazy_glReleaseKeyedMutexWin32EXT(GLuint memory, GLuint64 key) {
+	glad_glReleaseKeyedMutexWin32EXT = (PFNGLRELEASEKEYEDMUTEXWIN32EXTPROC)gladLazyResolve("glReleaseKeyedMutexWin32EXT");
+	return glad_glReleaseKeyedMutexWin32EXT(memory, key);
+}
+
+static void APIENTRY lazy_glWindowRectanglesEXT(GLenum mode, GLsizei count, const GLint *box) {
+	glad_glWindowRectanglesEXT = (PFNGLWINDOWRECTANGLESEXTPROC)gladLazyResolve("glWindowRectanglesEXT");
+	glad_glWindowRectanglesEXT(mode, count, box);
+}
+
+static GLsync APIENTRY lazy_glImportSyncEXT(GLenum external_sync_type, GLintptr external_sync, GLbitfield flags) {
+	glad_glImportSyncEXT = (PFNGLIMPORTSYNCEXTPROC)gladLazyResolve("glImportSyncEXT");
+	return glad_glImportSyncEXT(external_sync_type, external_sync, flags);
+}
+
+static void APIENTRY lazy_glFrameTerminatorGREMEDY(void) {
+	glad_glFrameTerminatorGREMEDY = (PFNGLFRAMETERMINATORGREMEDYPROC)gladLazyResolve("glFrameTerminatorGREMEDY");
+	glad_glFrameTerminatorGREMEDY();
+}
+
+static void APIENTRY lazy_glStringMarkerGREMEDY(GLsizei len, const void *string) {
+	glad_glStringMarkerGREMEDY = (PFNGLSTRINGMARKERGREMEDYPROC)gladLazyResolve("glStringMarkerGREMEDY");
+	glad_glStringMarkerGREMEDY(len, string);
+}
+
+static void APIENTRY lazy_glImageTransformParameteriHP(GLenum target, GLenum pname, GLint param) {
+	glad_glImageTransformParameteriHP = (PFNGLIMAGETRANSFORMPARAMETERIHPPROC)gladLazyResolve("glImageTransformParameteriHP");
+	glad_glImageTransformParameteriHP(target, pname, param);
+}
+
+static void APIENTRY lazy_glImageTransformParameterfHP(GLenum target, GLenum pname, GLfloat param) {
+	glad_glImageTransformParameterfHP = (PFNGLIMAGETRANSFORMPARAMETERFHPPROC)gladLazyResolve("glImageTransformParameterfHP");
+	glad_glImageTransformParameterfHP(target, pname, param);
+}
+
+static void APIENTRY lazy_glImageTransformParameterivHP(GLenum target, GLenum pname, const GLint *params) {
+	glad_glImageTransformParameterivHP = (PFNGLIMAGETRANSFORMPARAMETERIVHPPROC)gladLazyResolve("glImageTransformParameterivHP");
+	glad_glImageTransformParameterivHP(target, pname, params);
+}
+
+static void APIENTRY lazy_glImageTransformParameterfvHP(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glImageTransformParameterfvHP = (PFNGLIMAGETRANSFORMPARAMETERFVHPPROC)gladLazyResolve("glImageTransformParameterfvHP");
+	glad_glImageTransformParameterfvHP(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetImageTransformParameterivHP(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetImageTransformParameterivHP = (PFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC)gladLazyResolve("glGetImageTransformParameterivHP");
+	glad_glGetImageTransformParameterivHP(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetImageTransformParameterfvHP(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetImageTransformParameterfvHP = (PFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC)gladLazyResolve("glGetImageTransformParameterfvHP");
+	glad_glGetImageTransformParameterfvHP(target, pname, params);
+}
+
+static void APIENTRY lazy_glMultiModeDrawArraysIBM(const GLenum *mode, const GLint *first, const GLsizei *count, GLsizei primcount, GLint modestride) {
+	glad_glMultiModeDrawArraysIBM = (PFNGLMULTIMODEDRAWARRAYSIBMPROC)gladLazyResolve("glMultiModeDrawArraysIBM");
+	glad_glMultiModeDrawArraysIBM(mode, first, count, primcount, modestride);
+}
+
+static void APIENTRY lazy_glMultiModeDrawElementsIBM(const GLenum *mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei primcount, GLint modestride) {
+	glad_glMultiModeDrawElementsIBM = (PFNGLMULTIMODEDRAWELEMENTSIBMPROC)gladLazyResolve("glMultiModeDrawElementsIBM");
+	glad_glMultiModeDrawElementsIBM(mode, count, type, indices, primcount, modestride);
+}
+
+static void APIENTRY lazy_glFlushStaticDataIBM(GLenum target) {
+	glad_glFlushStaticDataIBM = (PFNGLFLUSHSTATICDATAIBMPROC)gladLazyResolve("glFlushStaticDataIBM");
+	glad_glFlushStaticDataIBM(target);
+}
+
+static void APIENTRY lazy_glColorPointerListIBM(GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride) {
+	glad_glColorPointerListIBM = (PFNGLCOLORPOINTERLISTIBMPROC)gladLazyResolve("glColorPointerListIBM");
+	glad_glColorPointerListIBM(size, type, stride, pointer, ptrstride);
+}
+
+static void APIENTRY lazy_glSecondaryColorPointerListIBM(GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride) {
+	glad_glSecondaryColorPointerListIBM = (PFNGLSECONDARYCOLORPOINTERLISTIBMPROC)gladLazyResolve("glSecondaryColorPointerListIBM");
+	glad_glSecondaryColorPointerListIBM(size, type, stride, pointer, ptrstride);
+}
+
+static void APIENTRY lazy_glEdgeFlagPointerListIBM(GLint stride, const GLboolean **pointer, GLint ptrstride) {
+	glad_glEdgeFlagPointerListIBM = (PFNGLEDGEFLAGPOINTERLISTIBMPROC)gladLazyResolve("glEdgeFlagPointerListIBM");
+	glad_glEdgeFlagPointerListIBM(stride, pointer, ptrstride);
+}
+
+static void APIENTRY lazy_glFogCoordPointerListIBM(GLenum type, GLint stride, const void **pointer, GLint ptrstride) {
+	glad_glFogCoordPointerListIBM = (PFNGLFOGCOORDPOINTERLISTIBMPROC)gladLazyResolve("glFogCoordPointerListIBM");
+	glad_glFogCoordPointerListIBM(type, stride, pointer, ptrstride);
+}
+
+static void APIENTRY lazy_glIndexPointerListIBM(GLenum type, GLint stride, const void **pointer, GLint ptrstride) {
+	glad_glIndexPointerListIBM = (PFNGLINDEXPOINTERLISTIBMPROC)gladLazyResolve("glIndexPointerListIBM");
+	glad_glIndexPointerListIBM(type, stride, pointer, ptrstride);
+}
+
+static void APIENTRY lazy_glNormalPointerListIBM(GLenum type, GLint stride, const void **pointer, GLint ptrstride) {
+	glad_glNormalPointerListIBM = (PFNGLNORMALPOINTERLISTIBMPROC)gladLazyResolve("glNormalPointerListIBM");
+	glad_glNormalPointerListIBM(type, stride, pointer, ptrstride);
+}
+
+static void APIENTRY lazy_glTexCoordPointerListIBM(GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride) {
+	glad_glTexCoordPointerListIBM = (PFNGLTEXCOORDPOINTERLISTIBMPROC)gladLazyResolve("glTexCoordPointerListIBM");
+	glad_glTexCoordPointerListIBM(size, type, stride, pointer, ptrstride);
+}
+
+static void APIENTRY lazy_glVertexPointerListIBM(GLint size, GLenum type, GLint stride, const void **pointer, GLint ptrstride) {
+	glad_glVertexPointerListIBM = (PFNGLVERTEXPOINTERLISTIBMPROC)gladLazyResolve("glVertexPointerListIBM");
+	glad_glVertexPointerListIBM(size, type, stride, pointer, ptrstride);
+}
+
+static void APIENTRY lazy_glBlendFuncSeparateINGR(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	glad_glBlendFuncSeparateINGR = (PFNGLBLENDFUNCSEPARATEINGRPROC)gladLazyResolve("glBlendFuncSeparateINGR");
+	glad_glBlendFuncSeparateINGR(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void APIENTRY lazy_glApplyFramebufferAttachmentCMAAINTEL(void) {
+	glad_glApplyFramebufferAttachmentCMAAINTEL = (PFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC)gladLazyResolve("glApplyFramebufferAttachmentCMAAINTEL");
+	glad_glApplyFramebufferAttachmentCMAAINTEL();
+}
+
+static void APIENTRY lazy_glSyncTextureINTEL(GLuint texture) {
+	glad_glSyncTextureINTEL = (PFNGLSYNCTEXTUREINTELPROC)gladLazyResolve("glSyncTextureINTEL");
+	glad_glSyncTextureINTEL(texture);
+}
+
+static void APIENTRY lazy_glUnmapTexture2DINTEL(GLuint texture, GLint level) {
+	glad_glUnmapTexture2DINTEL = (PFNGLUNMAPTEXTURE2DINTELPROC)gladLazyResolve("glUnmapTexture2DINTEL");
+	glad_glUnmapTexture2DINTEL(texture, level);
+}
+
+static void * APIENTRY lazy_glMapTexture2DINTEL(GLuint texture, GLint level, GLbitfield access, GLint *stride, GLenum *layout) {
+	glad_glMapTexture2DINTEL = (PFNGLMAPTEXTURE2DINTELPROC)gladLazyResolve("glMapTexture2DINTEL");
+	return glad_glMapTexture2DINTEL(texture, level, access, stride, layout);
+}
+
+static void APIENTRY lazy_glVertexPointervINTEL(GLint size, GLenum type, const void **pointer) {
+	glad_glVertexPointervINTEL = (PFNGLVERTEXPOINTERVINTELPROC)gladLazyResolve("glVertexPointervINTEL");
+	glad_glVertexPointervINTEL(size, type, pointer);
+}
+
+static void APIENTRY lazy_glNormalPointervINTEL(GLenum type, const void **pointer) {
+	glad_glNormalPointervINTEL = (PFNGLNORMALPOINTERVINTELPROC)gladLazyResolve("glNormalPointervINTEL");
+	glad_glNormalPointervINTEL(type, pointer);
+}
+
+static void APIENTRY lazy_glColorPointervINTEL(GLint size, GLenum type, const void **pointer) {
+	glad_glColorPointervINTEL = (PFNGLCOLORPOINTERVINTELPROC)gladLazyResolve("glColorPointervINTEL");
+	glad_glColorPointervINTEL(size, type, pointer);
+}
+
+static void APIENTRY lazy_glTexCoordPointervINTEL(GLint size, GLenum type, const void **pointer) {
+	glad_glTexCoordPointervINTEL = (PFNGLTEXCOORDPOINTERVINTELPROC)gladLazyResolve("glTexCoordPointervINTEL");
+	glad_glTexCoordPointervINTEL(size, type, pointer);
+}
+
+static void APIENTRY lazy_glBeginPerfQueryINTEL(GLuint queryHandle) {
+	glad_glBeginPerfQueryINTEL = (PFNGLBEGINPERFQUERYINTELPROC)gladLazyResolve("glBeginPerfQueryINTEL");
+	glad_glBeginPerfQueryINTEL(queryHandle);
+}
+
+static void APIENTRY lazy_glCreatePerfQueryINTEL(GLuint queryId, GLuint *queryHandle) {
+	glad_glCreatePerfQueryINTEL = (PFNGLCREATEPERFQUERYINTELPROC)gladLazyResolve("glCreatePerfQueryINTEL");
+	glad_glCreatePerfQueryINTEL(queryId, queryHandle);
+}
+
+static void APIENTRY lazy_glDeletePerfQueryINTEL(GLuint queryHandle) {
+	glad_glDeletePerfQueryINTEL = (PFNGLDELETEPERFQUERYINTELPROC)gladLazyResolve("glDeletePerfQueryINTEL");
+	glad_glDeletePerfQueryINTEL(queryHandle);
+}
+
+static void APIENTRY lazy_glEndPerfQueryINTEL(GLuint queryHandle) {
+	glad_glEndPerfQueryINTEL = (PFNGLENDPERFQUERYINTELPROC)gladLazyResolve("glEndPerfQueryINTEL");
+	glad_glEndPerfQueryINTEL(queryHandle);
+}
+
+static void APIENTRY lazy_glGetFirstPerfQueryIdINTEL(GLuint *queryId) {
+	glad_glGetFirstPerfQueryIdINTEL = (PFNGLGETFIRSTPERFQUERYIDINTELPROC)gladLazyResolve("glGetFirstPerfQueryIdINTEL");
+	glad_glGetFirstPerfQueryIdINTEL(queryId);
+}
+
+static void APIENTRY lazy_glGetNextPerfQueryIdINTEL(GLuint queryId, GLuint *nextQueryId) {
+	glad_glGetNextPerfQueryIdINTEL = (PFNGLGETNEXTPERFQUERYIDINTELPROC)gladLazyResolve("glGetNextPerfQueryIdINTEL");
+	glad_glGetNextPerfQueryIdINTEL(queryId, nextQueryId);
+}
+
+static void APIENTRY lazy_glGetPerfCounterInfoINTEL(GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar *counterName, GLuint counterDescLength, GLchar *counterDesc, GLuint *counterOffset, GLuint *counterDataSize, GLuint *counterTypeEnum, GLuint *counterDataTypeEnum, GLuint64 *rawCounterMaxValue) {
+	glad_glGetPerfCounterInfoINTEL = (PFNGLGETPERFCOUNTERINFOINTELPROC)gladLazyResolve("glGetPerfCounterInfoINTEL");
+	glad_glGetPerfCounterInfoINTEL(queryId, counterId, counterNameLength, counterName, counterDescLength, counterDesc, counterOffset, counterDataSize, counterTypeEnum, counterDataTypeEnum, rawCounterMaxValue);
+}
+
+static void APIENTRY lazy_glGetPerfQueryDataINTEL(GLuint queryHandle, GLuint flags, GLsizei dataSize, void *data, GLuint *bytesWritten) {
+	glad_glGetPerfQueryDataINTEL = (PFNGLGETPERFQUERYDATAINTELPROC)gladLazyResolve("glGetPerfQueryDataINTEL");
+	glad_glGetPerfQueryDataINTEL(queryHandle, flags, dataSize, data, bytesWritten);
+}
+
+static void APIENTRY lazy_glGetPerfQueryIdByNameINTEL(GLchar *queryName, GLuint *queryId) {
+	glad_glGetPerfQueryIdByNameINTEL = (PFNGLGETPERFQUERYIDBYNAMEINTELPROC)gladLazyResolve("glGetPerfQueryIdByNameINTEL");
+	glad_glGetPerfQueryIdByNameINTEL(queryName, queryId);
+}
+
+static void APIENTRY lazy_glGetPerfQueryInfoINTEL(GLuint queryId, GLuint queryNameLength, GLchar *queryName, GLuint *dataSize, GLuint *noCounters, GLuint *noInstances, GLuint *capsMask) {
+	glad_glGetPerfQueryInfoINTEL = (PFNGLGETPERFQUERYINFOINTELPROC)gladLazyResolve("glGetPerfQueryInfoINTEL");
+	glad_glGetPerfQueryInfoINTEL(queryId, queryNameLength, queryName, dataSize, noCounters, noInstances, capsMask);
+}
+
+static void APIENTRY lazy_glBlendBarrierKHR(void) {
+	glad_glBlendBarrierKHR = (PFNGLBLENDBARRIERKHRPROC)gladLazyResolve("glBlendBarrierKHR");
+	glad_glBlendBarrierKHR();
+}
+
+#endif
+static void APIENTRY lazy_glDebugMessageControlKHR(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	glad_glDebugMessageControlKHR = (PFNGLDEBUGMESSAGECONTROLKHRPROC)gladLazyResolve("glDebugMessageControlKHR");
+	glad_glDebugMessageControlKHR(source, type, severity, count, ids, enabled);
+}
+
+static void APIENTRY lazy_glDebugMessageInsertKHR(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	glad_glDebugMessageInsertKHR = (PFNGLDEBUGMESSAGEINSERTKHRPROC)gladLazyResolve("glDebugMessageInsertKHR");
+	glad_glDebugMessageInsertKHR(source, type, id, severity, length, buf);
+}
+
+static void APIENTRY lazy_glDebugMessageCallbackKHR(GLDEBUGPROCKHR callback, const void *userParam) {
+	glad_glDebugMessageCallbackKHR = (PFNGLDEBUGMESSAGECALLBACKKHRPROC)gladLazyResolve("glDebugMessageCallbackKHR");
+	glad_glDebugMessageCallbackKHR(callback, userParam);
+}
+
+static GLuint APIENTRY lazy_glGetDebugMessageLogKHR(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	glad_glGetDebugMessageLogKHR = (PFNGLGETDEBUGMESSAGELOGKHRPROC)gladLazyResolve("glGetDebugMessageLogKHR");
+	return glad_glGetDebugMessageLogKHR(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+
+static void APIENTRY lazy_glPushDebugGroupKHR(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+	glad_glPushDebugGroupKHR = (PFNGLPUSHDEBUGGROUPKHRPROC)gladLazyResolve("glPushDebugGroupKHR");
+	glad_glPushDebugGroupKHR(source, id, length, message);
+}
+
+static void APIENTRY lazy_glPopDebugGroupKHR(void) {
+	glad_glPopDebugGroupKHR = (PFNGLPOPDEBUGGROUPKHRPROC)gladLazyResolve("glPopDebugGroupKHR");
+	glad_glPopDebugGroupKHR();
+}
+
+static void APIENTRY lazy_glObjectLabelKHR(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+	glad_glObjectLabelKHR = (PFNGLOBJECTLABELKHRPROC)gladLazyResolve("glObjectLabelKHR");
+	glad_glObjectLabelKHR(identifier, name, length, label);
+}
+
+static void APIENTRY lazy_glGetObjectLabelKHR(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	glad_glGetObjectLabelKHR = (PFNGLGETOBJECTLABELKHRPROC)gladLazyResolve("glGetObjectLabelKHR");
+	glad_glGetObjectLabelKHR(identifier, name, bufSize, length, label);
+}
+
+static void APIENTRY lazy_glObjectPtrLabelKHR(const void *ptr, GLsizei length, const GLchar *label) {
+	glad_glObjectPtrLabelKHR = (PFNGLOBJECTPTRLABELKHRPROC)gladLazyResolve("glObjectPtrLabelKHR");
+	glad_glObjectPtrLabelKHR(ptr, length, label);
+}
+
+static void APIENTRY lazy_glGetObjectPtrLabelKHR(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	glad_glGetObjectPtrLabelKHR = (PFNGLGETOBJECTPTRLABELKHRPROC)gladLazyResolve("glGetObjectPtrLabelKHR");
+	glad_glGetObjectPtrLabelKHR(ptr, bufSize, length, label);
+}
+
+static void APIENTRY lazy_glGetPointervKHR(GLenum pname, void **params) {
+	glad_glGetPointervKHR = (PFNGLGETPOINTERVKHRPROC)gladLazyResolve("glGetPointervKHR");
+	glad_glGetPointervKHR(pname, params);
+}
+
+static void APIENTRY lazy_glMaxShaderCompilerThreadsKHR(GLuint count) {
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)gladLazyResolve("glMaxShaderCompilerThreadsKHR");
+	glad_glMaxShaderCompilerThreadsKHR(count);
+}
+
+#ifndef GLAD_CORE_PROFILE
+static GLenum APIENTRY lazy_glGetGraphicsResetStatusKHR(void) {
+	glad_glGetGraphicsResetStatusKHR = (PFNGLGETGRAPHICSRESETSTATUSKHRPROC)gladLazyResolve("glGetGraphicsResetStatusKHR");
+	return glad_glGetGraphicsResetStatusKHR();
+}
+
+static void APIENTRY lazy_glReadnPixelsKHR(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+	glad_glReadnPixelsKHR = (PFNGLREADNPIXELSKHRPROC)gladLazyResolve("glReadnPixelsKHR");
+	glad_glReadnPixelsKHR(x, y, width, height, format, type, bufSize, data);
+}
+
+static void APIENTRY lazy_glGetnUniformfvKHR(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+	glad_glGetnUniformfvKHR = (PFNGLGETNUNIFORMFVKHRPROC)gladLazyResolve("glGetnUniformfvKHR");
+	glad_glGetnUniformfvKHR(program, location, bufSize, params);
+}
+
+static void APIENTRY lazy_glGetnUniformivKHR(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+	glad_glGetnUniformivKHR = (PFNGLGETNUNIFORMIVKHRPROC)gladLazyResolve("glGetnUniformivKHR");
+	glad_glGetnUniformivKHR(program, location, bufSize, params);
+}
+
+static void APIENTRY lazy_glGetnUniformuivKHR(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+	glad_glGetnUniformuivKHR = (PFNGLGETNUNIFORMUIVKHRPROC)gladLazyResolve("glGetnUniformuivKHR");
+	glad_glGetnUniformuivKHR(program, location, bufSize, params);
+}
+
+static void APIENTRY lazy_glFramebufferParameteriMESA(GLenum target, GLenum pname, GLint param) {
+	glad_glFramebufferParameteriMESA = (PFNGLFRAMEBUFFERPARAMETERIMESAPROC)gladLazyResolve("glFramebufferParameteriMESA");
+	glad_glFramebufferParameteriMESA(target, pname, param);
+}
+
+static void APIENTRY lazy_glGetFramebufferParameterivMESA(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetFramebufferParameterivMESA = (PFNGLGETFRAMEBUFFERPARAMETERIVMESAPROC)gladLazyResolve("glGetFramebufferParameterivMESA");
+	glad_glGetFramebufferParameterivMESA(target, pname, params);
+}
+
+static void APIENTRY lazy_glResizeBuffersMESA(void) {
+	glad_glResizeBuffersMESA = (PFNGLRESIZEBUFFERSMESAPROC)gladLazyResolve("glResizeBuffersMESA");
+	glad_glResizeBuffersMESA();
+}
+
+static void APIENTRY lazy_glWindowPos2dMESA(GLdouble x, GLdouble y) {
+	glad_glWindowPos2dMESA = (PFNGLWINDOWPOS2DMESAPROC)gladLazyResolve("glWindowPos2dMESA");
+	glad_glWindowPos2dMESA(x, y);
+}
+
+static void APIENTRY lazy_glWindowPos2dvMESA(const GLdouble *v) {
+	glad_glWindowPos2dvMESA = (PFNGLWINDOWPOS2DVMESAPROC)gladLazyResolve("glWindowPos2dvMESA");
+	glad_glWindowPos2dvMESA(v);
+}
+
+static void APIENTRY lazy_glWindowPos2fMESA(GLfloat x, GLfloat y) {
+	glad_glWindowPos2fMESA = (PFNGLWINDOWPOS2FMESAPROC)gladLazyResolve("glWindowPos2fMESA");
+	glad_glWindowPos2fMESA(x, y);
+}
+
+static void APIENTRY lazy_glWindowPos2fvMESA(const GLfloat *v) {
+	glad_glWindowPos2fvMESA = (PFNGLWINDOWPOS2FVMESAPROC)gladLazyResolve("glWindowPos2fvMESA");
+	glad_glWindowPos2fvMESA(v);
+}
+
+static void APIENTRY lazy_glWindowPos2iMESA(GLint x, GLint y) {
+	glad_glWindowPos2iMESA = (PFNGLWINDOWPOS2IMESAPROC)gladLazyResolve("glWindowPos2iMESA");
+	glad_glWindowPos2iMESA(x, y);
+}
+
+static void APIENTRY lazy_glWindowPos2ivMESA(const GLint *v) {
+	glad_glWindowPos2ivMESA = (PFNGLWINDOWPOS2IVMESAPROC)gladLazyResolve("glWindowPos2ivMESA");
+	glad_glWindowPos2ivMESA(v);
+}
+
+static void APIENTRY lazy_glWindowPos2sMESA(GLshort x, GLshort y) {
+	glad_glWindowPos2sMESA = (PFNGLWINDOWPOS2SMESAPROC)gladLazyResolve("glWindowPos2sMESA");
+	glad_glWindowPos2sMESA(x, y);
+}
+
+static void APIENTRY lazy_glWindowPos2svMESA(const GLshort *v) {
+	glad_glWindowPos2svMESA = (PFNGLWINDOWPOS2SVMESAPROC)gladLazyResolve("glWindowPos2svMESA");
+	glad_glWindowPos2svMESA(v);
+}
+
+static void APIENTRY lazy_glWindowPos3dMESA(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glWindowPos3dMESA = (PFNGLWINDOWPOS3DMESAPROC)gladLazyResolve("glWindowPos3dMESA");
+	glad_glWindowPos3dMESA(x, y, z);
+}
+
+static void APIENTRY lazy_glWindowPos3dvMESA(const GLdouble *v) {
+	glad_glWindowPos3dvMESA = (PFNGLWINDOWPOS3DVMESAPROC)gladLazyResolve("glWindowPos3dvMESA");
+	glad_glWindowPos3dvMESA(v);
+}
+
+static void APIENTRY lazy_glWindowPos3fMESA(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glWindowPos3fMESA = (PFNGLWINDOWPOS3FMESAPROC)gladLazyResolve("glWindowPos3fMESA");
+	glad_glWindowPos3fMESA(x, y, z);
+}
+
+static void APIENTRY lazy_glWindowPos3fvMESA(const GLfloat *v) {
+	glad_glWindowPos3fvMESA = (PFNGLWINDOWPOS3FVMESAPROC)gladLazyResolve("glWindowPos3fvMESA");
+	glad_glWindowPos3fvMESA(v);
+}
+
+static void APIENTRY lazy_glWindowPos3iMESA(GLint x, GLint y, GLint z) {
+	glad_glWindowPos3iMESA = (PFNGLWINDOWPOS3IMESAPROC)gladLazyResolve("glWindowPos3iMESA");
+	glad_glWindowPos3iMESA(x, y, z);
+}
+
+static void APIENTRY lazy_glWindowPos3ivMESA(const GLint *v) {
+	glad_glWindowPos3ivMESA = (PFNGLWINDOWPOS3IVMESAPROC)gladLazyResolve("glWindowPos3ivMESA");
+	glad_glWindowPos3ivMESA(v);
+}
+
+static void APIENTRY lazy_glWindowPos3sMESA(GLshort x, GLshort y, GLshort z) {
+	glad_glWindowPos3sMESA = (PFNGLWINDOWPOS3SMESAPROC)gladLazyResolve("glWindowPos3sMESA");
+	glad_glWindowPos3sMESA(x, y, z);
+}
+
+static void APIENTRY lazy_glWindowPos3svMESA(const GLshort *v) {
+	glad_glWindowPos3svMESA = (PFNGLWINDOWPOS3SVMESAPROC)gladLazyResolve("glWindowPos3svMESA");
+	glad_glWindowPos3svMESA(v);
+}
+
+static void APIENTRY lazy_glWindowPos4dMESA(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glWindowPos4dMESA = (PFNGLWINDOWPOS4DMESAPROC)gladLazyResolve("glWindowPos4dMESA");
+	glad_glWindowPos4dMESA(x, y, z, w);
+}
+
+static void APIENTRY lazy_glWindowPos4dvMESA(const GLdouble *v) {
+	glad_glWindowPos4dvMESA = (PFNGLWINDOWPOS4DVMESAPROC)gladLazyResolve("glWindowPos4dvMESA");
+	glad_glWindowPos4dvMESA(v);
+}
+
+static void APIENTRY lazy_glWindowPos4fMESA(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glWindowPos4fMESA = (PFNGLWINDOWPOS4FMESAPROC)gladLazyResolve("glWindowPos4fMESA");
+	glad_glWindowPos4fMESA(x, y, z, w);
+}
+
+static void APIENTRY lazy_glWindowPos4fvMESA(const GLfloat *v) {
+	glad_glWindowPos4fvMESA = (PFNGLWINDOWPOS4FVMESAPROC)gladLazyResolve("glWindowPos4fvMESA");
+	glad_glWindowPos4fvMESA(v);
+}
+
+static void APIENTRY lazy_glWindowPos4iMESA(GLint x, GLint y, GLint z, GLint w) {
+	glad_glWindowPos4iMESA = (PFNGLWINDOWPOS4IMESAPROC)gladLazyResolve("glWindowPos4iMESA");
+	glad_glWindowPos4iMESA(x, y, z, w);
+}
+
+static void APIENTRY lazy_glWindowPos4ivMESA(const GLint *v) {
+	glad_glWindowPos4ivMESA = (PFNGLWINDOWPOS4IVMESAPROC)gladLazyResolve("glWindowPos4ivMESA");
+	glad_glWindowPos4ivMESA(v);
+}
+
+static void APIENTRY lazy_glWindowPos4sMESA(GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glWindowPos4sMESA = (PFNGLWINDOWPOS4SMESAPROC)gladLazyResolve("glWindowPos4sMESA");
+	glad_glWindowPos4sMESA(x, y, z, w);
+}
+
+static void APIENTRY lazy_glWindowPos4svMESA(const GLshort *v) {
+	glad_glWindowPos4svMESA = (PFNGLWINDOWPOS4SVMESAPROC)gladLazyResolve("glWindowPos4svMESA");
+	glad_glWindowPos4svMESA(v);
+}
+
+static void APIENTRY lazy_glBeginConditionalRenderNVX(GLuint id) {
+	glad_glBeginConditionalRenderNVX = (PFNGLBEGINCONDITIONALRENDERNVXPROC)gladLazyResolve("glBeginConditionalRenderNVX");
+	glad_glBeginConditionalRenderNVX(id);
+}
+
+static void APIENTRY lazy_glEndConditionalRenderNVX(void) {
+	glad_glEndConditionalRenderNVX = (PFNGLENDCONDITIONALRENDERNVXPROC)gladLazyResolve("glEndConditionalRenderNVX");
+	glad_glEndConditionalRenderNVX();
+}
+
+static void APIENTRY lazy_glUploadGpuMaskNVX(GLbitfield mask) {
+	glad_glUploadGpuMaskNVX = (PFNGLUPLOADGPUMASKNVXPROC)gladLazyResolve("glUploadGpuMaskNVX");
+	glad_glUploadGpuMaskNVX(mask);
+}
+
+static void APIENTRY lazy_glMulticastViewportArrayvNVX(GLuint gpu, GLuint first, GLsizei count, const GLfloat *v) {
+	glad_glMulticastViewportArrayvNVX = (PFNGLMULTICASTVIEWPORTARRAYVNVXPROC)gladLazyResolve("glMulticastViewportArrayvNVX");
+	glad_glMulticastViewportArrayvNVX(gpu, first, count, v);
+}
+
+static void APIENTRY lazy_glMulticastViewportPositionWScaleNVX(GLuint gpu, GLuint index, GLfloat xcoeff, GLfloat ycoeff) {
+	glad_glMulticastViewportPositionWScaleNVX = (PFNGLMULTICASTVIEWPORTPOSITIONWSCALENVXPROC)gladLazyResolve("glMulticastViewportPositionWScaleNVX");
+	glad_glMulticastViewportPositionWScaleNVX(gpu, index, xcoeff, ycoeff);
+}
+
+static void APIENTRY lazy_glMulticastScissorArrayvNVX(GLuint gpu, GLuint first, GLsizei count, const GLint *v) {
+	glad_glMulticastScissorArrayvNVX = (PFNGLMULTICASTSCISSORARRAYVNVXPROC)gladLazyResolve("glMulticastScissorArrayvNVX");
+	glad_glMulticastScissorArrayvNVX(gpu, first, count, v);
+}
+
+static GLuint APIENTRY lazy_glAsyncCopyBufferSubDataNVX(GLsizei waitSemaphoreCount, const GLuint *waitSemaphoreArray, const GLuint64 *fenceValueArray, GLuint readGpu, GLbitfield writeGpuMask, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size, GLsizei signalSemaphoreCount, const GLuint *signalSemaphoreArray, const GLuint64 *signalValueArray) {
+	glad_glAsyncCopyBufferSubDataNVX = (PFNGLASYNCCOPYBUFFERSUBDATANVXPROC)gladLazyResolve("glAsyncCopyBufferSubDataNVX");
+	return glad_glAsyncCopyBufferSubDataNVX(waitSemaphoreCount, waitSemaphoreArray, fenceValueArray, readGpu, writeGpuMask, readBuffer, writeBuffer, readOffset, writeOffset, size, signalSemaphoreCount, signalSemaphoreArray, signalValueArray);
+}
+
+static GLuint APIENTRY lazy_glAsyncCopyImageSubDataNVX(GLsizei waitSemaphoreCount, const GLuint *waitSemaphoreArray, const GLuint64 *waitValueArray, GLuint srcGpu, GLbitfield dstGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth, GLsizei signalSemaphoreCount, const GLuint *signalSemaphoreArray, const GLuint64 *signalValueArray) {
+	glad_glAsyncCopyImageSubDataNVX = (PFNGLASYNCCOPYIMAGESUBDATANVXPROC)gladLazyResolve("glAsyncCopyImageSubDataNVX");
+	return glad_glAsyncCopyImageSubDataNVX(waitSemaphoreCount, waitSemaphoreArray, waitValueArray, srcGpu, dstGpuMask, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth, signalSemaphoreCount, signalSemaphoreArray, signalValueArray);
+}
+
+static void APIENTRY lazy_glLGPUNamedBufferSubDataNVX(GLbitfield gpuMask, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glLGPUNamedBufferSubDataNVX = (PFNGLLGPUNAMEDBUFFERSUBDATANVXPROC)gladLazyResolve("glLGPUNamedBufferSubDataNVX");
+	glad_glLGPUNamedBufferSubDataNVX(gpuMask, buffer, offset, size, data);
+}
+
+static void APIENTRY lazy_glLGPUCopyImageSubDataNVX(GLuint sourceGpu, GLbitfield destinationGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srxY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glLGPUCopyImageSubDataNVX = (PFNGLLGPUCOPYIMAGESUBDATANVXPROC)gladLazyResolve("glLGPUCopyImageSubDataNVX");
+	glad_glLGPUCopyImageSubDataNVX(sourceGpu, destinationGpuMask, srcName, srcTarget, srcLevel, srcX, srxY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth);
+}
+
+static void APIENTRY lazy_glLGPUInterlockNVX(void) {
+	glad_glLGPUInterlockNVX = (PFNGLLGPUINTERLOCKNVXPROC)gladLazyResolve("glLGPUInterlockNVX");
+	glad_glLGPUInterlockNVX();
+}
+
+static GLuint APIENTRY lazy_glCreateProgressFenceNVX(void) {
+	glad_glCreateProgressFenceNVX = (PFNGLCREATEPROGRESSFENCENVXPROC)gladLazyResolve("glCreateProgressFenceNVX");
+	return glad_glCreateProgressFenceNVX();
+}
+
+static void APIENTRY lazy_glSignalSemaphoreui64NVX(GLuint signalGpu, GLsizei fenceObjectCount, const GLuint *semaphoreArray, const GLuint64 *fenceValueArray) {
+	glad_glSignalSemaphoreui64NVX = (PFNGLSIGNALSEMAPHOREUI64NVXPROC)gladLazyResolve("glSignalSemaphoreui64NVX");
+	glad_glSignalSemaphoreui64NVX(signalGpu, fenceObjectCount, semaphoreArray, fenceValueArray);
+}
+
+static void APIENTRY lazy_glWaitSemaphoreui64NVX(GLuint waitGpu, GLsizei fenceObjectCount, const GLuint *semaphoreArray, const GLuint64 *fenceValueArray) {
+	glad_glWaitSemaphoreui64NVX = (PFNGLWAITSEMAPHOREUI64NVXPROC)gladLazyResolve("glWaitSemaphoreui64NVX");
+	glad_glWaitSemaphoreui64NVX(waitGpu, fenceObjectCount, semaphoreArray, fenceValueArray);
+}
+
+static void APIENTRY lazy_glClientWaitSemaphoreui64NVX(GLsizei fenceObjectCount, const GLuint *semaphoreArray, const GLuint64 *fenceValueArray) {
+	glad_glClientWaitSemaphoreui64NVX = (PFNGLCLIENTWAITSEMAPHOREUI64NVXPROC)gladLazyResolve("glClientWaitSemaphoreui64NVX");
+	glad_glClientWaitSemaphoreui64NVX(fenceObjectCount, semaphoreArray, fenceValueArray);
+}
+
+static void APIENTRY lazy_glAlphaToCoverageDitherControlNV(GLenum mode) {
+	glad_glAlphaToCoverageDitherControlNV = (PFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC)gladLazyResolve("glAlphaToCoverageDitherControlNV");
+	glad_glAlphaToCoverageDitherControlNV(mode);
+}
+
+static void APIENTRY lazy_glMultiDrawArraysIndirectBindlessNV(GLenum mode, const void *indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount) {
+	glad_glMultiDrawArraysIndirectBindlessNV = (PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC)gladLazyResolve("glMultiDrawArraysIndirectBindlessNV");
+	glad_glMultiDrawArraysIndirectBindlessNV(mode, indirect, drawCount, stride, vertexBufferCount);
+}
+
+static void APIENTRY lazy_glMultiDrawElementsIndirectBindlessNV(GLenum mode, GLenum type, const void *indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount) {
+	glad_glMultiDrawElementsIndirectBindlessNV = (PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC)gladLazyResolve("glMultiDrawElementsIndirectBindlessNV");
+	glad_glMultiDrawElementsIndirectBindlessNV(mode, type, indirect, drawCount, stride, vertexBufferCount);
+}
+
+static void APIENTRY lazy_glMultiDrawArraysIndirectBindlessCountNV(GLenum mode, const void *indirect, GLsizei drawCount, GLsizei maxDrawCount, GLsizei stride, GLint vertexBufferCount) {
+	glad_glMultiDrawArraysIndirectBindlessCountNV = (PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC)gladLazyResolve("glMultiDrawArraysIndirectBindlessCountNV");
+	glad_glMultiDrawArraysIndirectBindlessCountNV(mode, indirect, drawCount, maxDrawCount, stride, vertexBufferCount);
+}
+
+static void APIENTRY lazy_glMultiDrawElementsIndirectBindlessCountNV(GLenum mode, GLenum type, const void *indirect, GLsizei drawCount, GLsizei maxDrawCount, GLsizei stride, GLint vertexBufferCount) {
+	glad_glMultiDrawElementsIndirectBindlessCountNV = (PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC)gladLazyResolve("glMultiDrawElementsIndirectBindlessCountNV");
+	glad_glMultiDrawElementsIndirectBindlessCountNV(mode, type, indirect, drawCount, maxDrawCount, stride, vertexBufferCount);
+}
+
+static GLuint64 APIENTRY lazy_glGetTextureHandleNV(GLuint texture) {
+	glad_glGetTextureHandleNV = (PFNGLGETTEXTUREHANDLENVPROC)gladLazyResolve("glGetTextureHandleNV");
+	return glad_glGetTextureHandleNV(texture);
+}
+
+static GLuint64 APIENTRY lazy_glGetTextureSamplerHandleNV(GLuint texture, GLuint sampler) {
+	glad_glGetTextureSamplerHandleNV = (PFNGLGETTEXTURESAMPLERHANDLENVPROC)gladLazyResolve("glGetTextureSamplerHandleNV");
+	return glad_glGetTextureSamplerHandleNV(texture, sampler);
+}
+
+static void APIENTRY lazy_glMakeTextureHandleResidentNV(GLuint64 handle) {
+	glad_glMakeTextureHandleResidentNV = (PFNGLMAKETEXTUREHANDLERESIDENTNVPROC)gladLazyResolve("glMakeTextureHandleResidentNV");
+	glad_glMakeTextureHandleResidentNV(handle);
+}
+
+static void APIENTRY lazy_glMakeTextureHandleNonResidentNV(GLuint64 handle) {
+	glad_glMakeTextureHandleNonResidentNV = (PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC)gladLazyResolve("glMakeTextureHandleNonResidentNV");
+	glad_glMakeTextureHandleNonResidentNV(handle);
+}
+
+static GLuint64 APIENTRY lazy_glGetImageHandleNV(GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format) {
+	glad_glGetImageHandleNV = (PFNGLGETIMAGEHANDLENVPROC)gladLazyResolve("glGetImageHandleNV");
+	return glad_glGetImageHandleNV(texture, level, layered, layer, format);
+}
+
+static void APIENTRY lazy_glMakeImageHandleResidentNV(GLuint64 handle, GLenum access) {
+	glad_glMakeImageHandleResidentNV = (PFNGLMAKEIMAGEHANDLERESIDENTNVPROC)gladLazyResolve("glMakeImageHandleResidentNV");
+	glad_glMakeImageHandleResidentNV(handle, access);
+}
+
+static void APIENTRY lazy_glMakeImageHandleNonResidentNV(GLuint64 handle) {
+	glad_glMakeImageHandleNonResidentNV = (PFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC)gladLazyResolve("glMakeImageHandleNonResidentNV");
+	glad_glMakeImageHandleNonResidentNV(handle);
+}
+
+static void APIENTRY lazy_glUniformHandleui64NV(GLint location, GLuint64 value) {
+	glad_glUniformHandleui64NV = (PFNGLUNIFORMHANDLEUI64NVPROC)gladLazyResolve("glUniformHandleui64NV");
+	glad_glUniformHandleui64NV(location, value);
+}
+
+static void APIENTRY lazy_glUniformHandleui64vNV(GLint location, GLsizei count, const GLuint64 *value) {
+	glad_glUniformHandleui64vNV = (PFNGLUNIFORMHANDLEUI64VNVPROC)gladLazyResolve("glUniformHandleui64vNV");
+	glad_glUniformHandleui64vNV(location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniformHandleui64NV(GLuint program, GLint location, GLuint64 value) {
+	glad_glProgramUniformHandleui64NV = (PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC)gladLazyResolve("glProgramUniformHandleui64NV");
+	glad_glProgramUniformHandleui64NV(program, location, value);
+}
+
+static void APIENTRY lazy_glProgramUniformHandleui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64 *values) {
+	glad_glProgramUniformHandleui64vNV = (PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC)gladLazyResolve("glProgramUniformHandleui64vNV");
+	glad_glProgramUniformHandleui64vNV(program, location, count, values);
+}
+
+static GLboolean APIENTRY lazy_glIsTextureHandleResidentNV(GLuint64 handle) {
+	glad_glIsTextureHandleResidentNV = (PFNGLISTEXTUREHANDLERESIDENTNVPROC)gladLazyResolve("glIsTextureHandleResidentNV");
+	return glad_glIsTextureHandleResidentNV(handle);
+}
+
+static GLboolean APIENTRY lazy_glIsImageHandleResidentNV(GLuint64 handle) {
+	glad_glIsImageHandleResidentNV = (PFNGLISIMAGEHANDLERESIDENTNVPROC)gladLazyResolve("glIsImageHandleResidentNV");
+	return glad_glIsImageHandleResidentNV(handle);
+}
+
+static void APIENTRY lazy_glBlendParameteriNV(GLenum pname, GLint value) {
+	glad_glBlendParameteriNV = (PFNGLBLENDPARAMETERINVPROC)gladLazyResolve("glBlendParameteriNV");
+	glad_glBlendParameteriNV(pname, value);
+}
+
+static void APIENTRY lazy_glBlendBarrierNV(void) {
+	glad_glBlendBarrierNV = (PFNGLBLENDBARRIERNVPROC)gladLazyResolve("glBlendBarrierNV");
+	glad_glBlendBarrierNV();
+}
+
+static void APIENTRY lazy_glViewportPositionWScaleNV(GLuint index, GLfloat xcoeff, GLfloat ycoeff) {
+	glad_glViewportPositionWScaleNV = (PFNGLVIEWPORTPOSITIONWSCALENVPROC)gladLazyResolve("glViewportPositionWScaleNV");
+	glad_glViewportPositionWScaleNV(index, xcoeff, ycoeff);
+}
+
+static void APIENTRY lazy_glCreateStatesNV(GLsizei n, GLuint *states) {
+	glad_glCreateStatesNV = (PFNGLCREATESTATESNVPROC)gladLazyResolve("glCreateStatesNV");
+	glad_glCreateStatesNV(n, states);
+}
+
+static void APIENTRY lazy_glDeleteStatesNV(GLsizei n, const GLuint *states) {
+	glad_glDeleteStatesNV = (PFNGLDELETESTATESNVPROC)gladLazyResolve("glDeleteStatesNV");
+	glad_glDeleteStatesNV(n, states);
+}
+
+static GLboolean APIENTRY lazy_glIsStateNV(GLuint state) {
+	glad_glIsStateNV = (PFNGLISSTATENVPROC)gladLazyResolve("glIsStateNV");
+	return glad_glIsStateNV(state);
+}
+
+static void APIENTRY lazy_glStateCaptureNV(GLuint state, GLenum mode) {
+	glad_glStateCaptureNV = (PFNGLSTATECAPTURENVPROC)gladLazyResolve("glStateCaptureNV");
+	glad_glStateCaptureNV(state, mode);
+}
+
+static GLuint APIENTRY lazy_glGetCommandHeaderNV(GLenum tokenID, GLuint size) {
+	glad_glGetCommandHeaderNV = (PFNGLGETCOMMANDHEADERNVPROC)gladLazyResolve("glGetCommandHeaderNV");
+	return glad_glGetCommandHeaderNV(tokenID, size);
+}
+
+static GLushort APIENTRY lazy_glGetStageIndexNV(GLenum shadertype) {
+	glad_glGetStageIndexNV = (PFNGLGETSTAGEINDEXNVPROC)gladLazyResolve("glGetStageIndexNV");
+	return glad_glGetStageIndexNV(shadertype);
+}
+
+static void APIENTRY lazy_glDrawCommandsNV(GLenum primitiveMode, GLuint buffer, const GLintptr *indirects, const GLsizei *sizes, GLuint count) {
+	glad_glDrawCommandsNV = (PFNGLDRAWCOMMANDSNVPROC)gladLazyResolve("glDrawCommandsNV");
+	glad_glDrawCommandsNV(primitiveMode, buffer, indirects, sizes, count);
+}
+
+static void APIENTRY lazy_glDrawCommandsAddressNV(GLenum primitiveMode, const GLuint64 *indirects, const GLsizei *sizes, GLuint count) {
+	glad_glDrawCommandsAddressNV = (PFNGLDRAWCOMMANDSADDRESSNVPROC)gladLazyResolve("glDrawCommandsAddressNV");
+	glad_glDrawCommandsAddressNV(primitiveMode, indirects, sizes, count);
+}
+
+static void APIENTRY lazy_glDrawCommandsStatesNV(GLuint buffer, const GLintptr *indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count) {
+	glad_glDrawCommandsStatesNV = (PFNGLDRAWCOMMANDSSTATESNVPROC)gladLazyResolve("glDrawCommandsStatesNV");
+	glad_glDrawCommandsStatesNV(buffer, indirects, sizes, states, fbos, count);
+}
+
+static void APIENTRY lazy_glDrawCommandsStatesAddressNV(const GLuint64 *indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count) {
+	glad_glDrawCommandsStatesAddressNV = (PFNGLDRAWCOMMANDSSTATESADDRESSNVPROC)gladLazyResolve("glDrawCommandsStatesAddressNV");
+	glad_glDrawCommandsStatesAddressNV(indirects, sizes, states, fbos, count);
+}
+
+static void APIENTRY lazy_glCreateCommandListsNV(GLsizei n, GLuint *lists) {
+	glad_glCreateCommandListsNV = (PFNGLCREATECOMMANDLISTSNVPROC)gladLazyResolve("glCreateCommandListsNV");
+	glad_glCreateCommandListsNV(n, lists);
+}
+
+static void APIENTRY lazy_glDeleteCommandListsNV(GLsizei n, const GLuint *lists) {
+	glad_glDeleteCommandListsNV = (PFNGLDELETECOMMANDLISTSNVPROC)gladLazyResolve("glDeleteCommandListsNV");
+	glad_glDeleteCommandListsNV(n, lists);
+}
+
+static GLboolean APIENTRY lazy_glIsCommandListNV(GLuint list) {
+	glad_glIsCommandListNV = (PFNGLISCOMMANDLISTNVPROC)gladLazyResolve("glIsCommandListNV");
+	return glad_glIsCommandListNV(list);
+}
+
+static void APIENTRY lazy_glListDrawCommandsStatesClientNV(GLuint list, GLuint segment, const void **indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count) {
+	glad_glListDrawCommandsStatesClientNV = (PFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC)gladLazyResolve("glListDrawCommandsStatesClientNV");
+	glad_glListDrawCommandsStatesClientNV(list, segment, indirects, sizes, states, fbos, count);
+}
+
+static void APIENTRY lazy_glCommandListSegmentsNV(GLuint list, GLuint segments) {
+	glad_glCommandListSegmentsNV = (PFNGLCOMMANDLISTSEGMENTSNVPROC)gladLazyResolve("glCommandListSegmentsNV");
+	glad_glCommandListSegmentsNV(list, segments);
+}
+
+static void APIENTRY lazy_glCompileCommandListNV(GLuint list) {
+	glad_glCompileCommandListNV = (PFNGLCOMPILECOMMANDLISTNVPROC)gladLazyResolve("glCompileCommandListNV");
+	glad_glCompileCommandListNV(list);
+}
+
+static void APIENTRY lazy_glCallCommandListNV(GLuint list) {
+	glad_glCallCommandListNV = (PFNGLCALLCOMMANDLISTNVPROC)gladLazyResolve("glCallCommandListNV");
+	glad_glCallCommandListNV(list);
+}
+
+static void APIENTRY lazy_glBeginConditionalRenderNV(GLuint id, GLenum mode) {
+	glad_glBeginConditionalRenderNV = (PFNGLBEGINCONDITIONALRENDERNVPROC)gladLazyResolve("glBeginConditionalRenderNV");
+	glad_glBeginConditionalRenderNV(id, mode);
+}
+
+static void APIENTRY lazy_glEndConditionalRenderNV(void) {
+	glad_glEndConditionalRenderNV = (PFNGLENDCONDITIONALRENDERNVPROC)gladLazyResolve("glEndConditionalRenderNV");
+	glad_glEndConditionalRenderNV();
+}
+
+static void APIENTRY lazy_glSubpixelPrecisionBiasNV(GLuint xbits, GLuint ybits) {
+	glad_glSubpixelPrecisionBiasNV = (PFNGLSUBPIXELPRECISIONBIASNVPROC)gladLazyResolve("glSubpixelPrecisionBiasNV");
+	glad_glSubpixelPrecisionBiasNV(xbits, ybits);
+}
+
+static void APIENTRY lazy_glConservativeRasterParameterfNV(GLenum pname, GLfloat value) {
+	glad_glConservativeRasterParameterfNV = (PFNGLCONSERVATIVERASTERPARAMETERFNVPROC)gladLazyResolve("glConservativeRasterParameterfNV");
+	glad_glConservativeRasterParameterfNV(pname, value);
+}
+
+static void APIENTRY lazy_glConservativeRasterParameteriNV(GLenum pname, GLint param) {
+	glad_glConservativeRasterParameteriNV = (PFNGLCONSERVATIVERASTERPARAMETERINVPROC)gladLazyResolve("glConservativeRasterParameteriNV");
+	glad_glConservativeRasterParameteriNV(pname, param);
+}
+
+static void APIENTRY lazy_glCopyImageSubDataNV(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glCopyImageSubDataNV = (PFNGLCOPYIMAGESUBDATANVPROC)gladLazyResolve("glCopyImageSubDataNV");
+	glad_glCopyImageSubDataNV(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth);
+}
+
+static void APIENTRY lazy_glDepthRangedNV(GLdouble zNear, GLdouble zFar) {
+	glad_glDepthRangedNV = (PFNGLDEPTHRANGEDNVPROC)gladLazyResolve("glDepthRangedNV");
+	glad_glDepthRangedNV(zNear, zFar);
+}
+
+static void APIENTRY lazy_glClearDepthdNV(GLdouble depth) {
+	glad_glClearDepthdNV = (PFNGLCLEARDEPTHDNVPROC)gladLazyResolve("glClearDepthdNV");
+	glad_glClearDepthdNV(depth);
+}
+
+static void APIENTRY lazy_glDepthBoundsdNV(GLdouble zmin, GLdouble zmax) {
+	glad_glDepthBoundsdNV = (PFNGLDEPTHBOUNDSDNVPROC)gladLazyResolve("glDepthBoundsdNV");
+	glad_glDepthBoundsdNV(zmin, zmax);
+}
+
+static void APIENTRY lazy_glDrawTextureNV(GLuint texture, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1) {
+	glad_glDrawTextureNV = (PFNGLDRAWTEXTURENVPROC)gladLazyResolve("glDrawTextureNV");
+	glad_glDrawTextureNV(texture, sampler, x0, y0, x1, y1, z, s0, t0, s1, t1);
+}
+
+static void APIENTRY lazy_glDrawVkImageNV(GLuint64 vkImage, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1) {
+	glad_glDrawVkImageNV = (PFNGLDRAWVKIMAGENVPROC)gladLazyResolve("glDrawVkImageNV");
+	glad_glDrawVkImageNV(vkImage, sampler, x0, y0, x1, y1, z, s0, t0, s1, t1);
+}
+
+static GLVULKANPROCNV APIENTRY lazy_glGetVkProcAddrNV(const GLchar *name) {
+	glad_glGetVkProcAddrNV = (PFNGLGETVKPROCADDRNVPROC)gladLazyResolve("glGetVkProcAddrNV");
+	return glad_glGetVkProcAddrNV(name);
+}
+
+static void APIENTRY lazy_glWaitVkSemaphoreNV(GLuint64 vkSemaphore) {
+	glad_glWaitVkSemaphoreNV = (PFNGLWAITVKSEMAPHORENVPROC)gladLazyResolve("glWaitVkSemaphoreNV");
+	glad_glWaitVkSemaphoreNV(vkSemaphore);
+}
+
+static void APIENTRY lazy_glSignalVkSemaphoreNV(GLuint64 vkSemaphore) {
+	glad_glSignalVkSemaphoreNV = (PFNGLSIGNALVKSEMAPHORENVPROC)gladLazyResolve("glSignalVkSemaphoreNV");
+	glad_glSignalVkSemaphoreNV(vkSemaphore);
+}
+
+static void APIENTRY lazy_glSignalVkFenceNV(GLuint64 vkFence) {
+	glad_glSignalVkFenceNV = (PFNGLSIGNALVKFENCENVPROC)gladLazyResolve("glSignalVkFenceNV");
+	glad_glSignalVkFenceNV(vkFence);
+}
+
+static void APIENTRY lazy_glMapControlPointsNV(GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLint uorder, GLint vorder, GLboolean packed, const void *points) {
+	glad_glMapControlPointsNV = (PFNGLMAPCONTROLPOINTSNVPROC)gladLazyResolve("glMapControlPointsNV");
+	glad_glMapControlPointsNV(target, index, type, ustride, vstride, uorder, vorder, packed, points);
+}
+
+static void APIENTRY lazy_glMapParameterivNV(GLenum target, GLenum pname, const GLint *params) {
+	glad_glMapParameterivNV = (PFNGLMAPPARAMETERIVNVPROC)gladLazyResolve("glMapParameterivNV");
+	glad_glMapParameterivNV(target, pname, params);
+}
+
+static void APIENTRY lazy_glMapParameterfvNV(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glMapParameterfvNV = (PFNGLMAPPARAMETERFVNVPROC)gladLazyResolve("glMapParameterfvNV");
+	glad_glMapParameterfvNV(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetMapControlPointsNV(GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLboolean packed, void *points) {
+	glad_glGetMapControlPointsNV = (PFNGLGETMAPCONTROLPOINTSNVPROC)gladLazyResolve("glGetMapControlPointsNV");
+	glad_glGetMapControlPointsNV(target, index, type, ustride, vstride, packed, points);
+}
+
+static void APIENTRY lazy_glGetMapParameterivNV(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetMapParameterivNV = (PFNGLGETMAPPARAMETERIVNVPROC)gladLazyResolve("glGetMapParameterivNV");
+	glad_glGetMapParameterivNV(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetMapParameterfvNV(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetMapParameterfvNV = (PFNGLGETMAPPARAMETERFVNVPROC)gladLazyResolve("glGetMapParameterfvNV");
+	glad_glGetMapParameterfvNV(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetMapAttribParameterivNV(GLenum target, GLuint index, GLenum pname, GLint *params) {
+	glad_glGetMapAttribParameterivNV = (PFNGLGETMAPATTRIBPARAMETERIVNVPROC)gladLazyResolve("glGetMapAttribParameterivNV");
+	glad_glGetMapAttribParameterivNV(target, index, pname, params);
+}
+
+static void APIENTRY lazy_glGetMapAttribParameterfvNV(GLenum target, GLuint index, GLenum pname, GLfloat *params) {
+	glad_glGetMapAttribParameterfvNV = (PFNGLGETMAPATTRIBPARAMETERFVNVPROC)gladLazyResolve("glGetMapAttribParameterfvNV");
+	glad_glGetMapAttribParameterfvNV(target, index, pname, params);
+}
+
+static void APIENTRY lazy_glEvalMapsNV(GLenum target, GLenum mode) {
+	glad_glEvalMapsNV = (PFNGLEVALMAPSNVPROC)gladLazyResolve("glEvalMapsNV");
+	glad_glEvalMapsNV(target, mode);
+}
+
+static void APIENTRY lazy_glGetMultisamplefvNV(GLenum pname, GLuint index, GLfloat *val) {
+	glad_glGetMultisamplefvNV = (PFNGLGETMULTISAMPLEFVNVPROC)gladLazyResolve("glGetMultisamplefvNV");
+	glad_glGetMultisamplefvNV(pname, index, val);
+}
+
+static void APIENTRY lazy_glSampleMaskIndexedNV(GLuint index, GLbitfield mask) {
+	glad_glSampleMaskIndexedNV = (PFNGLSAMPLEMASKINDEXEDNVPROC)gladLazyResolve("glSampleMaskIndexedNV");
+	glad_glSampleMaskIndexedNV(index, mask);
+}
+
+static void APIENTRY lazy_glTexRenderbufferNV(GLenum target, GLuint renderbuffer) {
+	glad_glTexRenderbufferNV = (PFNGLTEXRENDERBUFFERNVPROC)gladLazyResolve("glTexRenderbufferNV");
+	glad_glTexRenderbufferNV(target, renderbuffer);
+}
+
+static void APIENTRY lazy_glDeleteFencesNV(GLsizei n, const GLuint *fences) {
+	glad_glDeleteFencesNV = (PFNGLDELETEFENCESNVPROC)gladLazyResolve("glDeleteFencesNV");
+	glad_glDeleteFencesNV(n, fences);
+}
+
+static void APIENTRY lazy_glGenFencesNV(GLsizei n, GLuint *fences) {
+	glad_glGenFencesNV = (PFNGLGENFENCESNVPROC)gladLazyResolve("glGenFencesNV");
+	glad_glGenFencesNV(n, fences);
+}
+
+static GLboolean APIENTRY lazy_glIsFenceNV(GLuint fence) {
+	glad_glIsFenceNV = (PFNGLISFENCENVPROC)gladLazyResolve("glIsFenceNV");
+	return glad_glIsFenceNV(fence);
+}
+
+static GLboolean APIENTRY lazy_glTestFenceNV(GLuint fence) {
+	glad_glTestFenceNV = (PFNGLTESTFENCENVPROC)gladLazyResolve("glTestFenceNV");
+	return glad_glTestFenceNV(fence);
+}
+
+static void APIENTRY lazy_glGetFenceivNV(GLuint fence, GLenum pname, GLint *params) {
+	glad_glGetFenceivNV = (PFNGLGETFENCEIVNVPROC)gladLazyResolve("glGetFenceivNV");
+	glad_glGetFenceivNV(fence, pname, params);
+}
+
+static void APIENTRY lazy_glFinishFenceNV(GLuint fence) {
+	glad_glFinishFenceNV = (PFNGLFINISHFENCENVPROC)gladLazyResolve("glFinishFenceNV");
+	glad_glFinishFenceNV(fence);
+}
+
+static void APIENTRY lazy_glSetFenceNV(GLuint fence, GLenum condition) {
+	glad_glSetFenceNV = (PFNGLSETFENCENVPROC)gladLazyResolve("glSetFenceNV");
+	glad_glSetFenceNV(fence, condition);
+}
+
+static void APIENTRY lazy_glFragmentCoverageColorNV(GLuint color) {
+	glad_glFragmentCoverageColorNV = (PFNGLFRAGMENTCOVERAGECOLORNVPROC)gladLazyResolve("glFragmentCoverageColorNV");
+	glad_glFragmentCoverageColorNV(color);
+}
+
+static void APIENTRY lazy_glProgramNamedParameter4fNV(GLuint id, GLsizei len, const GLubyte *name, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glProgramNamedParameter4fNV = (PFNGLPROGRAMNAMEDPARAMETER4FNVPROC)gladLazyResolve("glProgramNamedParameter4fNV");
+	glad_glProgramNamedParameter4fNV(id, len, name, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramNamedParameter4fvNV(GLuint id, GLsizei len, const GLubyte *name, const GLfloat *v) {
+	glad_glProgramNamedParameter4fvNV = (PFNGLPROGRAMNAMEDPARAMETER4FVNVPROC)gladLazyResolve("glProgramNamedParameter4fvNV");
+	glad_glProgramNamedParameter4fvNV(id, len, name, v);
+}
+
+static void APIENTRY lazy_glProgramNamedParameter4dNV(GLuint id, GLsizei len, const GLubyte *name, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glProgramNamedParameter4dNV = (PFNGLPROGRAMNAMEDPARAMETER4DNVPROC)gladLazyResolve("glProgramNamedParameter4dNV");
+	glad_glProgramNamedParameter4dNV(id, len, name, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramNamedParameter4dvNV(GLuint id, GLsizei len, const GLubyte *name, const GLdouble *v) {
+	glad_glProgramNamedParameter4dvNV = (PFNGLPROGRAMNAMEDPARAMETER4DVNVPROC)gladLazyResolve("glProgramNamedParameter4dvNV");
+	glad_glProgramNamedParameter4dvNV(id, len, name, v);
+}
+
+static void APIENTRY lazy_glGetProgramNamedParameterfvNV(GLuint id, GLsizei len, const GLubyte *name, GLfloat *params) {
+	glad_glGetProgramNamedParameterfvNV = (PFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC)gladLazyResolve("glGetProgramNamedParameterfvNV");
+	glad_glGetProgramNamedParameterfvNV(id, len, name, params);
+}
+
+static void APIENTRY lazy_glGetProgramNamedParameterdvNV(GLuint id, GLsizei len, const GLubyte *name, GLdouble *params) {
+	glad_glGetProgramNamedParameterdvNV = (PFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC)gladLazyResolve("glGetProgramNamedParameterdvNV");
+	glad_glGetProgramNamedParameterdvNV(id, len, name, params);
+}
+
+static void APIENTRY lazy_glCoverageModulationTableNV(GLsizei n, const GLfloat *v) {
+	glad_glCoverageModulationTableNV = (PFNGLCOVERAGEMODULATIONTABLENVPROC)gladLazyResolve("glCoverageModulationTableNV");
+	glad_glCoverageModulationTableNV(n, v);
+}
+
+static void APIENTRY lazy_glGetCoverageModulationTableNV(GLsizei bufSize, GLfloat *v) {
+	glad_glGetCoverageModulationTableNV = (PFNGLGETCOVERAGEMODULATIONTABLENVPROC)gladLazyResolve("glGetCoverageModulationTableNV");
+	glad_glGetCoverageModulationTableNV(bufSize, v);
+}
+
+static void APIENTRY lazy_glCoverageModulationNV(GLenum components) {
+	glad_glCoverageModulationNV = (PFNGLCOVERAGEMODULATIONNVPROC)gladLazyResolve("glCoverageModulationNV");
+	glad_glCoverageModulationNV(components);
+}
+
+static void APIENTRY lazy_glRenderbufferStorageMultisampleCoverageNV(GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorageMultisampleCoverageNV = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC)gladLazyResolve("glRenderbufferStorageMultisampleCoverageNV");
+	glad_glRenderbufferStorageMultisampleCoverageNV(target, coverageSamples, colorSamples, internalformat, width, height);
+}
+
+static void APIENTRY lazy_glProgramVertexLimitNV(GLenum target, GLint limit) {
+	glad_glProgramVertexLimitNV = (PFNGLPROGRAMVERTEXLIMITNVPROC)gladLazyResolve("glProgramVertexLimitNV");
+	glad_glProgramVertexLimitNV(target, limit);
+}
+
+static void APIENTRY lazy_glFramebufferTextureEXT(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	glad_glFramebufferTextureEXT = (PFNGLFRAMEBUFFERTEXTUREEXTPROC)gladLazyResolve("glFramebufferTextureEXT");
+	glad_glFramebufferTextureEXT(target, attachment, texture, level);
+}
+
+static void APIENTRY lazy_glFramebufferTextureFaceEXT(GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face) {
+	glad_glFramebufferTextureFaceEXT = (PFNGLFRAMEBUFFERTEXTUREFACEEXTPROC)gladLazyResolve("glFramebufferTextureFaceEXT");
+	glad_glFramebufferTextureFaceEXT(target, attachment, texture, level, face);
+}
+
+static void APIENTRY lazy_glRenderGpuMaskNV(GLbitfield mask) {
+	glad_glRenderGpuMaskNV = (PFNGLRENDERGPUMASKNVPROC)gladLazyResolve("glRenderGpuMaskNV");
+	glad_glRenderGpuMaskNV(mask);
+}
+
+static void APIENTRY lazy_glMulticastBufferSubDataNV(GLbitfield gpuMask, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glMulticastBufferSubDataNV = (PFNGLMULTICASTBUFFERSUBDATANVPROC)gladLazyResolve("glMulticastBufferSubDataNV");
+	glad_glMulticastBufferSubDataNV(gpuMask, buffer, offset, size, data);
+}
+
+static void APIENTRY lazy_glMulticastCopyBufferSubDataNV(GLuint readGpu, GLbitfield writeGpuMask, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_glMulticastCopyBufferSubDataNV = (PFNGLMULTICASTCOPYBUFFERSUBDATANVPROC)gladLazyResolve("glMulticastCopyBufferSubDataNV");
+	glad_glMulticastCopyBufferSubDataNV(readGpu, writeGpuMask, readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+
+static void APIENTRY lazy_glMulticastCopyImageSubDataNV(GLuint srcGpu, GLbitfield dstGpuMask, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+	glad_glMulticastCopyImageSubDataNV = (PFNGLMULTICASTCOPYIMAGESUBDATANVPROC)gladLazyResolve("glMulticastCopyImageSubDataNV");
+	glad_glMulticastCopyImageSubDataNV(srcGpu, dstGpuMask, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+
+static void APIENTRY lazy_glMulticastBlitFramebufferNV(GLuint srcGpu, GLuint dstGpu, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glMulticastBlitFramebufferNV = (PFNGLMULTICASTBLITFRAMEBUFFERNVPROC)gladLazyResolve("glMulticastBlitFramebufferNV");
+	glad_glMulticastBlitFramebufferNV(srcGpu, dstGpu, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static void APIENTRY lazy_glMulticastFramebufferSampleLocationsfvNV(GLuint gpu, GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v) {
+	glad_glMulticastFramebufferSampleLocationsfvNV = (PFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)gladLazyResolve("glMulticastFramebufferSampleLocationsfvNV");
+	glad_glMulticastFramebufferSampleLocationsfvNV(gpu, framebuffer, start, count, v);
+}
+
+static void APIENTRY lazy_glMulticastBarrierNV(void) {
+	glad_glMulticastBarrierNV = (PFNGLMULTICASTBARRIERNVPROC)gladLazyResolve("glMulticastBarrierNV");
+	glad_glMulticastBarrierNV();
+}
+
+static void APIENTRY lazy_glMulticastWaitSyncNV(GLuint signalGpu, GLbitfield waitGpuMask) {
+	glad_glMulticastWaitSyncNV = (PFNGLMULTICASTWAITSYNCNVPROC)gladLazyResolve("glMulticastWaitSyncNV");
+	glad_glMulticastWaitSyncNV(signalGpu, waitGpuMask);
+}
+
+static void APIENTRY lazy_glMulticastGetQueryObjectivNV(GLuint gpu, GLuint id, GLenum pname, GLint *params) {
+	glad_glMulticastGetQueryObjectivNV = (PFNGLMULTICASTGETQUERYOBJECTIVNVPROC)gladLazyResolve("glMulticastGetQueryObjectivNV");
+	glad_glMulticastGetQueryObjectivNV(gpu, id, pname, params);
+}
+
+static void APIENTRY lazy_glMulticastGetQueryObjectuivNV(GLuint gpu, GLuint id, GLenum pname, GLuint *params) {
+	glad_glMulticastGetQueryObjectuivNV = (PFNGLMULTICASTGETQUERYOBJECTUIVNVPROC)gladLazyResolve("glMulticastGetQueryObjectuivNV");
+	glad_glMulticastGetQueryObjectuivNV(gpu, id, pname, params);
+}
+
+static void APIENTRY lazy_glMulticastGetQueryObjecti64vNV(GLuint gpu, GLuint id, GLenum pname, GLint64 *params) {
+	glad_glMulticastGetQueryObjecti64vNV = (PFNGLMULTICASTGETQUERYOBJECTI64VNVPROC)gladLazyResolve("glMulticastGetQueryObjecti64vNV");
+	glad_glMulticastGetQueryObjecti64vNV(gpu, id, pname, params);
+}
+
+static void APIENTRY lazy_glMulticastGetQueryObjectui64vNV(GLuint gpu, GLuint id, GLenum pname, GLuint64 *params) {
+	glad_glMulticastGetQueryObjectui64vNV = (PFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC)gladLazyResolve("glMulticastGetQueryObjectui64vNV");
+	glad_glMulticastGetQueryObjectui64vNV(gpu, id, pname, params);
+}
+
+static void APIENTRY lazy_glProgramLocalParameterI4iNV(GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glad_glProgramLocalParameterI4iNV = (PFNGLPROGRAMLOCALPARAMETERI4INVPROC)gladLazyResolve("glProgramLocalParameterI4iNV");
+	glad_glProgramLocalParameterI4iNV(target, index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramLocalParameterI4ivNV(GLenum target, GLuint index, const GLint *params) {
+	glad_glProgramLocalParameterI4ivNV = (PFNGLPROGRAMLOCALPARAMETERI4IVNVPROC)gladLazyResolve("glProgramLocalParameterI4ivNV");
+	glad_glProgramLocalParameterI4ivNV(target, index, params);
+}
+
+static void APIENTRY lazy_glProgramLocalParametersI4ivNV(GLenum target, GLuint index, GLsizei count, const GLint *params) {
+	glad_glProgramLocalParametersI4ivNV = (PFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC)gladLazyResolve("glProgramLocalParametersI4ivNV");
+	glad_glProgramLocalParametersI4ivNV(target, index, count, params);
+}
+
+static void APIENTRY lazy_glProgramLocalParameterI4uiNV(GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glad_glProgramLocalParameterI4uiNV = (PFNGLPROGRAMLOCALPARAMETERI4UINVPROC)gladLazyResolve("glProgramLocalParameterI4uiNV");
+	glad_glProgramLocalParameterI4uiNV(target, index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramLocalParameterI4uivNV(GLenum target, GLuint index, const GLuint *params) {
+	glad_glProgramLocalParameterI4uivNV = (PFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC)gladLazyResolve("glProgramLocalParameterI4uivNV");
+	glad_glProgramLocalParameterI4uivNV(target, index, params);
+}
+
+static void APIENTRY lazy_glProgramLocalParametersI4uivNV(GLenum target, GLuint index, GLsizei count, const GLuint *params) {
+	glad_glProgramLocalParametersI4uivNV = (PFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC)gladLazyResolve("glProgramLocalParametersI4uivNV");
+	glad_glProgramLocalParametersI4uivNV(target, index, count, params);
+}
+
+static void APIENTRY lazy_glProgramEnvParameterI4iNV(GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glad_glProgramEnvParameterI4iNV = (PFNGLPROGRAMENVPARAMETERI4INVPROC)gladLazyResolve("glProgramEnvParameterI4iNV");
+	glad_glProgramEnvParameterI4iNV(target, index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramEnvParameterI4ivNV(GLenum target, GLuint index, const GLint *params) {
+	glad_glProgramEnvParameterI4ivNV = (PFNGLPROGRAMENVPARAMETERI4IVNVPROC)gladLazyResolve("glProgramEnvParameterI4ivNV");
+	glad_glProgramEnvParameterI4ivNV(target, index, params);
+}
+
+static void APIENTRY lazy_glProgramEnvParametersI4ivNV(GLenum target, GLuint index, GLsizei count, const GLint *params) {
+	glad_glProgramEnvParametersI4ivNV = (PFNGLPROGRAMENVPARAMETERSI4IVNVPROC)gladLazyResolve("glProgramEnvParametersI4ivNV");
+	glad_glProgramEnvParametersI4ivNV(target, index, count, params);
+}
+
+static void APIENTRY lazy_glProgramEnvParameterI4uiNV(GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glad_glProgramEnvParameterI4uiNV = (PFNGLPROGRAMENVPARAMETERI4UINVPROC)gladLazyResolve("glProgramEnvParameterI4uiNV");
+	glad_glProgramEnvParameterI4uiNV(target, index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramEnvParameterI4uivNV(GLenum target, GLuint index, const GLuint *params) {
+	glad_glProgramEnvParameterI4uivNV = (PFNGLPROGRAMENVPARAMETERI4UIVNVPROC)gladLazyResolve("glProgramEnvParameterI4uivNV");
+	glad_glProgramEnvParameterI4uivNV(target, index, params);
+}
+
+static void APIENTRY lazy_glProgramEnvParametersI4uivNV(GLenum target, GLuint index, GLsizei count, const GLuint *params) {
+	glad_glProgramEnvParametersI4uivNV = (PFNGLPROGRAMENVPARAMETERSI4UIVNVPROC)gladLazyResolve("glProgramEnvParametersI4uivNV");
+	glad_glProgramEnvParametersI4uivNV(target, index, count, params);
+}
+
+static void APIENTRY lazy_glGetProgramLocalParameterIivNV(GLenum target, GLuint index, GLint *params) {
+	glad_glGetProgramLocalParameterIivNV = (PFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC)gladLazyResolve("glGetProgramLocalParameterIivNV");
+	glad_glGetProgramLocalParameterIivNV(target, index, params);
+}
+
+static void APIENTRY lazy_glGetProgramLocalParameterIuivNV(GLenum target, GLuint index, GLuint *params) {
+	glad_glGetProgramLocalParameterIuivNV = (PFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC)gladLazyResolve("glGetProgramLocalParameterIuivNV");
+	glad_glGetProgramLocalParameterIuivNV(target, index, params);
+}
+
+static void APIENTRY lazy_glGetProgramEnvParameterIivNV(GLenum target, GLuint index, GLint *params) {
+	glad_glGetProgramEnvParameterIivNV = (PFNGLGETPROGRAMENVPARAMETERIIVNVPROC)gladLazyResolve("glGetProgramEnvParameterIivNV");
+	glad_glGetProgramEnvParameterIivNV(target, index, params);
+}
+
+static void APIENTRY lazy_glGetProgramEnvParameterIuivNV(GLenum target, GLuint index, GLuint *params) {
+	glad_glGetProgramEnvParameterIuivNV = (PFNGLGETPROGRAMENVPARAMETERIUIVNVPROC)gladLazyResolve("glGetProgramEnvParameterIuivNV");
+	glad_glGetProgramEnvParameterIuivNV(target, index, params);
+}
+
+static void APIENTRY lazy_glProgramSubroutineParametersuivNV(GLenum target, GLsizei count, const GLuint *params) {
+	glad_glProgramSubroutineParametersuivNV = (PFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC)gladLazyResolve("glProgramSubroutineParametersuivNV");
+	glad_glProgramSubroutineParametersuivNV(target, count, params);
+}
+
+static void APIENTRY lazy_glGetProgramSubroutineParameteruivNV(GLenum target, GLuint index, GLuint *param) {
+	glad_glGetProgramSubroutineParameteruivNV = (PFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC)gladLazyResolve("glGetProgramSubroutineParameteruivNV");
+	glad_glGetProgramSubroutineParameteruivNV(target, index, param);
+}
+
+static void APIENTRY lazy_glVertex2hNV(GLhalfNV x, GLhalfNV y) {
+	glad_glVertex2hNV = (PFNGLVERTEX2HNVPROC)gladLazyResolve("glVertex2hNV");
+	glad_glVertex2hNV(x, y);
+}
+
+static void APIENTRY lazy_glVertex2hvNV(const GLhalfNV *v) {
+	glad_glVertex2hvNV = (PFNGLVERTEX2HVNVPROC)gladLazyResolve("glVertex2hvNV");
+	glad_glVertex2hvNV(v);
+}
+
+static void APIENTRY lazy_glVertex3hNV(GLhalfNV x, GLhalfNV y, GLhalfNV z) {
+	glad_glVertex3hNV = (PFNGLVERTEX3HNVPROC)gladLazyResolve("glVertex3hNV");
+	glad_glVertex3hNV(x, y, z);
+}
+
+static void APIENTRY lazy_glVertex3hvNV(const GLhalfNV *v) {
+	glad_glVertex3hvNV = (PFNGLVERTEX3HVNVPROC)gladLazyResolve("glVertex3hvNV");
+	glad_glVertex3hvNV(v);
+}
+
+static void APIENTRY lazy_glVertex4hNV(GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w) {
+	glad_glVertex4hNV = (PFNGLVERTEX4HNVPROC)gladLazyResolve("glVertex4hNV");
+	glad_glVertex4hNV(x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertex4hvNV(const GLhalfNV *v) {
+	glad_glVertex4hvNV = (PFNGLVERTEX4HVNVPROC)gladLazyResolve("glVertex4hvNV");
+	glad_glVertex4hvNV(v);
+}
+
+static void APIENTRY lazy_glNormal3hNV(GLhalfNV nx, GLhalfNV ny, GLhalfNV nz) {
+	glad_glNormal3hNV = (PFNGLNORMAL3HNVPROC)gladLazyResolve("glNormal3hNV");
+	glad_glNormal3hNV(nx, ny, nz);
+}
+
+static void APIENTRY lazy_glNormal3hvNV(const GLhalfNV *v) {
+	glad_glNormal3hvNV = (PFNGLNORMAL3HVNVPROC)gladLazyResolve("glNormal3hvNV");
+	glad_glNormal3hvNV(v);
+}
+
+static void APIENTRY lazy_glColor3hNV(GLhalfNV red, GLhalfNV green, GLhalfNV blue) {
+	glad_glColor3hNV = (PFNGLCOLOR3HNVPROC)gladLazyResolve("glColor3hNV");
+	glad_glColor3hNV(red, green, blue);
+}
+
+static void APIENTRY lazy_glColor3hvNV(const GLhalfNV *v) {
+	glad_glColor3hvNV = (PFNGLCOLOR3HVNVPROC)gladLazyResolve("glColor3hvNV");
+	glad_glColor3hvNV(v);
+}
+
+static void APIENTRY lazy_glColor4hNV(GLhalfNV red, GLhalfNV green, GLhalfNV blue, GLhalfNV alpha) {
+	glad_glColor4hNV = (PFNGLCOLOR4HNVPROC)gladLazyResolve("glColor4hNV");
+	glad_glColor4hNV(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glColor4hvNV(const GLhalfNV *v) {
+	glad_glColor4hvNV = (PFNGLCOLOR4HVNVPROC)gladLazyResolve("glColor4hvNV");
+	glad_glColor4hvNV(v);
+}
+
+static void APIENTRY lazy_glTexCoord1hNV(GLhalfNV s) {
+	glad_glTexCoord1hNV = (PFNGLTEXCOORD1HNVPROC)gladLazyResolve("glTexCoord1hNV");
+	glad_glTexCoord1hNV(s);
+}
+
+static void APIENTRY lazy_glTexCoord1hvNV(const GLhalfNV *v) {
+	glad_glTexCoord1hvNV = (PFNGLTEXCOORD1HVNVPROC)gladLazyResolve("glTexCoord1hvNV");
+	glad_glTexCoord1hvNV(v);
+}
+
+static void APIENTRY lazy_glTexCoord2hNV(GLhalfNV s, GLhalfNV t) {
+	glad_glTexCoord2hNV = (PFNGLTEXCOORD2HNVPROC)gladLazyResolve("glTexCoord2hNV");
+	glad_glTexCoord2hNV(s, t);
+}
+
+static void APIENTRY lazy_glTexCoord2hvNV(const GLhalfNV *v) {
+	glad_glTexCoord2hvNV = (PFNGLTEXCOORD2HVNVPROC)gladLazyResolve("glTexCoord2hvNV");
+	glad_glTexCoord2hvNV(v);
+}
+
+static void APIENTRY lazy_glTexCoord3hNV(GLhalfNV s, GLhalfNV t, GLhalfNV r) {
+	glad_glTexCoord3hNV = (PFNGLTEXCOORD3HNVPROC)gladLazyResolve("glTexCoord3hNV");
+	glad_glTexCoord3hNV(s, t, r);
+}
+
+static void APIENTRY lazy_glTexCoord3hvNV(const GLhalfNV *v) {
+	glad_glTexCoord3hvNV = (PFNGLTEXCOORD3HVNVPROC)gladLazyResolve("glTexCoord3hvNV");
+	glad_glTexCoord3hvNV(v);
+}
+
+static void APIENTRY lazy_glTexCoord4hNV(GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q) {
+	glad_glTexCoord4hNV = (PFNGLTEXCOORD4HNVPROC)gladLazyResolve("glTexCoord4hNV");
+	glad_glTexCoord4hNV(s, t, r, q);
+}
+
+static void APIENTRY lazy_glTexCoord4hvNV(const GLhalfNV *v) {
+	glad_glTexCoord4hvNV = (PFNGLTEXCOORD4HVNVPROC)gladLazyResolve("glTexCoord4hvNV");
+	glad_glTexCoord4hvNV(v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1hNV(GLenum target, GLhalfNV s) {
+	glad_glMultiTexCoord1hNV = (PFNGLMULTITEXCOORD1HNVPROC)gladLazyResolve("glMultiTexCoord1hNV");
+	glad_glMultiTexCoord1hNV(target, s);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1hvNV(GLenum target, const GLhalfNV *v) {
+	glad_glMultiTexCoord1hvNV = (PFNGLMULTITEXCOORD1HVNVPROC)gladLazyResolve("glMultiTexCoord1hvNV");
+	glad_glMultiTexCoord1hvNV(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2hNV(GLenum target, GLhalfNV s, GLhalfNV t) {
+	glad_glMultiTexCoord2hNV = (PFNGLMULTITEXCOORD2HNVPROC)gladLazyResolve("glMultiTexCoord2hNV");
+	glad_glMultiTexCoord2hNV(target, s, t);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2hvNV(GLenum target, const GLhalfNV *v) {
+	glad_glMultiTexCoord2hvNV = (PFNGLMULTITEXCOORD2HVNVPROC)gladLazyResolve("glMultiTexCoord2hvNV");
+	glad_glMultiTexCoord2hvNV(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3hNV(GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r) {
+	glad_glMultiTexCoord3hNV = (PFNGLMULTITEXCOORD3HNVPROC)gladLazyResolve("glMultiTexCoord3hNV");
+	glad_glMultiTexCoord3hNV(target, s, t, r);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3hvNV(GLenum target, const GLhalfNV *v) {
+	glad_glMultiTexCoord3hvNV = (PFNGLMULTITEXCOORD3HVNVPROC)gladLazyResolve("glMultiTexCoord3hvNV");
+	glad_glMultiTexCoord3hvNV(target, v);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4hNV(GLenum target, GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV q) {
+	glad_glMultiTexCoord4hNV = (PFNGLMULTITEXCOORD4HNVPROC)gladLazyResolve("glMultiTexCoord4hNV");
+	glad_glMultiTexCoord4hNV(target, s, t, r, q);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4hvNV(GLenum target, const GLhalfNV *v) {
+	glad_glMultiTexCoord4hvNV = (PFNGLMULTITEXCOORD4HVNVPROC)gladLazyResolve("glMultiTexCoord4hvNV");
+	glad_glMultiTexCoord4hvNV(target, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib1hNV(GLuint index, GLhalfNV x) {
+	glad_glVertexAttrib1hNV = (PFNGLVERTEXATTRIB1HNVPROC)gladLazyResolve("glVertexAttrib1hNV");
+	glad_glVertexAttrib1hNV(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttrib1hvNV(GLuint index, const GLhalfNV *v) {
+	glad_glVertexAttrib1hvNV = (PFNGLVERTEXATTRIB1HVNVPROC)gladLazyResolve("glVertexAttrib1hvNV");
+	glad_glVertexAttrib1hvNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib2hNV(GLuint index, GLhalfNV x, GLhalfNV y) {
+	glad_glVertexAttrib2hNV = (PFNGLVERTEXATTRIB2HNVPROC)gladLazyResolve("glVertexAttrib2hNV");
+	glad_glVertexAttrib2hNV(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttrib2hvNV(GLuint index, const GLhalfNV *v) {
+	glad_glVertexAttrib2hvNV = (PFNGLVERTEXATTRIB2HVNVPROC)gladLazyResolve("glVertexAttrib2hvNV");
+	glad_glVertexAttrib2hvNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib3hNV(GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z) {
+	glad_glVertexAttrib3hNV = (PFNGLVERTEXATTRIB3HNVPROC)gladLazyResolve("glVertexAttrib3hNV");
+	glad_glVertexAttrib3hNV(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttrib3hvNV(GLuint index, const GLhalfNV *v) {
+	glad_glVertexAttrib3hvNV = (PFNGLVERTEXATTRIB3HVNVPROC)gladLazyResolve("glVertexAttrib3hvNV");
+	glad_glVertexAttrib3hvNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4hNV(GLuint index, GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w) {
+	glad_glVertexAttrib4hNV = (PFNGLVERTEXATTRIB4HNVPROC)gladLazyResolve("glVertexAttrib4hNV");
+	glad_glVertexAttrib4hNV(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttrib4hvNV(GLuint index, const GLhalfNV *v) {
+	glad_glVertexAttrib4hvNV = (PFNGLVERTEXATTRIB4HVNVPROC)gladLazyResolve("glVertexAttrib4hvNV");
+	glad_glVertexAttrib4hvNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs1hvNV(GLuint index, GLsizei n, const GLhalfNV *v) {
+	glad_glVertexAttribs1hvNV = (PFNGLVERTEXATTRIBS1HVNVPROC)gladLazyResolve("glVertexAttribs1hvNV");
+	glad_glVertexAttribs1hvNV(index, n, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs2hvNV(GLuint index, GLsizei n, const GLhalfNV *v) {
+	glad_glVertexAttribs2hvNV = (PFNGLVERTEXATTRIBS2HVNVPROC)gladLazyResolve("glVertexAttribs2hvNV");
+	glad_glVertexAttribs2hvNV(index, n, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs3hvNV(GLuint index, GLsizei n, const GLhalfNV *v) {
+	glad_glVertexAttribs3hvNV = (PFNGLVERTEXATTRIBS3HVNVPROC)gladLazyResolve("glVertexAttribs3hvNV");
+	glad_glVertexAttribs3hvNV(index, n, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs4hvNV(GLuint index, GLsizei n, const GLhalfNV *v) {
+	glad_glVertexAttribs4hvNV = (PFNGLVERTEXATTRIBS4HVNVPROC)gladLazyResolve("glVertexAttribs4hvNV");
+	glad_glVertexAttribs4hvNV(index, n, v);
+}
+
+static void APIENTRY lazy_glFogCoordhNV(GLhalfNV fog) {
+	glad_glFogCoordhNV = (PFNGLFOGCOORDHNVPROC)gladLazyResolve("glFogCoordhNV");
+	glad_glFogCoordhNV(fog);
+}
+
+static void APIENTRY lazy_glFogCoordhvNV(const GLhalfNV *fog) {
+	glad_glFogCoordhvNV = (PFNGLFOGCOORDHVNVPROC)gladLazyResolve("glFogCoordhvNV");
+	glad_glFogCoordhvNV(fog);
+}
+
+static void APIENTRY lazy_glSecondaryColor3hNV(GLhalfNV red, GLhalfNV green, GLhalfNV blue) {
+	glad_glSecondaryColor3hNV = (PFNGLSECONDARYCOLOR3HNVPROC)gladLazyResolve("glSecondaryColor3hNV");
+	glad_glSecondaryColor3hNV(red, green, blue);
+}
+
+static void APIENTRY lazy_glSecondaryColor3hvNV(const GLhalfNV *v) {
+	glad_glSecondaryColor3hvNV = (PFNGLSECONDARYCOLOR3HVNVPROC)gladLazyResolve("glSecondaryColor3hvNV");
+	glad_glSecondaryColor3hvNV(v);
+}
+
+static void APIENTRY lazy_glVertexWeighthNV(GLhalfNV weight) {
+	glad_glVertexWeighthNV = (PFNGLVERTEXWEIGHTHNVPROC)gladLazyResolve("glVertexWeighthNV");
+	glad_glVertexWeighthNV(weight);
+}
+
+static void APIENTRY lazy_glVertexWeighthvNV(const GLhalfNV *weight) {
+	glad_glVertexWeighthvNV = (PFNGLVERTEXWEIGHTHVNVPROC)gladLazyResolve("glVertexWeighthvNV");
+	glad_glVertexWeighthvNV(weight);
+}
+
+static void APIENTRY lazy_glGetInternalformatSampleivNV(GLenum target, GLenum internalformat, GLsizei samples, GLenum pname, GLsizei count, GLint *params) {
+	glad_glGetInternalformatSampleivNV = (PFNGLGETINTERNALFORMATSAMPLEIVNVPROC)gladLazyResolve("glGetInternalformatSampleivNV");
+	glad_glGetInternalformatSampleivNV(target, internalformat, samples, pname, count, params);
+}
+
+static void APIENTRY lazy_glGetMemoryObjectDetachedResourcesuivNV(GLuint memory, GLenum pname, GLint first, GLsizei count, GLuint *params) {
+	glad_glGetMemoryObjectDetachedResourcesuivNV = (PFNGLGETMEMORYOBJECTDETACHEDRESOURCESUIVNVPROC)gladLazyResolve("glGetMemoryObjectDetachedResourcesuivNV");
+	glad_glGetMemoryObjectDetachedResourcesuivNV(memory, pname, first, count, params);
+}
+
+static void APIENTRY lazy_glResetMemoryObjectParameterNV(GLuint memory, GLenum pname) {
+	glad_glResetMemoryObjectParameterNV = (PFNGLRESETMEMORYOBJECTPARAMETERNVPROC)gladLazyResolve("glResetMemoryObjectParameterNV");
+	glad_glResetMemoryObjectParameterNV(memory, pname);
+}
+
+static void APIENTRY lazy_glTexAttachMemoryNV(GLenum target, GLuint memory, GLuint64 offset) {
+	glad_glTexAttachMemoryNV = (PFNGLTEXATTACHMEMORYNVPROC)gladLazyResolve("glTexAttachMemoryNV");
+	glad_glTexAttachMemoryNV(target, memory, offset);
+}
+
+static void APIENTRY lazy_glBufferAttachMemoryNV(GLenum target, GLuint memory, GLuint64 offset) {
+	glad_glBufferAttachMemoryNV = (PFNGLBUFFERATTACHMEMORYNVPROC)gladLazyResolve("glBufferAttachMemoryNV");
+	glad_glBufferAttachMemoryNV(target, memory, offset);
+}
+
+static void APIENTRY lazy_glTextureAttachMemoryNV(GLuint texture, GLuint memory, GLuint64 offset) {
+	glad_glTextureAttachMemoryNV = (PFNGLTEXTUREATTACHMEMORYNVPROC)gladLazyResolve("glTextureAttachMemoryNV");
+	glad_glTextureAttachMemoryNV(texture, memory, offset);
+}
+
+static void APIENTRY lazy_glNamedBufferAttachMemoryNV(GLuint buffer, GLuint memory, GLuint64 offset) {
+	glad_glNamedBufferAttachMemoryNV = (PFNGLNAMEDBUFFERATTACHMEMORYNVPROC)gladLazyResolve("glNamedBufferAttachMemoryNV");
+	glad_glNamedBufferAttachMemoryNV(buffer, memory, offset);
+}
+
+static void APIENTRY lazy_glBufferPageCommitmentMemNV(GLenum target, GLintptr offset, GLsizeiptr size, GLuint memory, GLuint64 memOffset, GLboolean commit) {
+	glad_glBufferPageCommitmentMemNV = (PFNGLBUFFERPAGECOMMITMENTMEMNVPROC)gladLazyResolve("glBufferPageCommitmentMemNV");
+	glad_glBufferPageCommitmentMemNV(target, offset, size, memory, memOffset, commit);
+}
+
+static void APIENTRY lazy_glTexPageCommitmentMemNV(GLenum target, GLint layer, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset, GLboolean commit) {
+	glad_glTexPageCommitmentMemNV = (PFNGLTEXPAGECOMMITMENTMEMNVPROC)gladLazyResolve("glTexPageCommitmentMemNV");
+	glad_glTexPageCommitmentMemNV(target, layer, level, xoffset, yoffset, zoffset, width, height, depth, memory, offset, commit);
+}
+
+static void APIENTRY lazy_glNamedBufferPageCommitmentMemNV(GLuint buffer, GLintptr offset, GLsizeiptr size, GLuint memory, GLuint64 memOffset, GLboolean commit) {
+	glad_glNamedBufferPageCommitmentMemNV = (PFNGLNAMEDBUFFERPAGECOMMITMENTMEMNVPROC)gladLazyResolve("glNamedBufferPageCommitmentMemNV");
+	glad_glNamedBufferPageCommitmentMemNV(buffer, offset, size, memory, memOffset, commit);
+}
+
+static void APIENTRY lazy_glTexturePageCommitmentMemNV(GLuint texture, GLint layer, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset, GLboolean commit) {
+	glad_glTexturePageCommitmentMemNV = (PFNGLTEXTUREPAGECOMMITMENTMEMNVPROC)gladLazyResolve("glTexturePageCommitmentMemNV");
+	glad_glTexturePageCommitmentMemNV(texture, layer, level, xoffset, yoffset, zoffset, width, height, depth, memory, offset, commit);
+}
+
+static void APIENTRY lazy_glDrawMeshTasksNV(GLuint first, GLuint count) {
+	glad_glDrawMeshTasksNV = (PFNGLDRAWMESHTASKSNVPROC)gladLazyResolve("glDrawMeshTasksNV");
+	glad_glDrawMeshTasksNV(first, count);
+}
+
+static void APIENTRY lazy_glDrawMeshTasksIndirectNV(GLintptr indirect) {
+	glad_glDrawMeshTasksIndirectNV = (PFNGLDRAWMESHTASKSINDIRECTNVPROC)gladLazyResolve("glDrawMeshTasksIndirectNV");
+	glad_glDrawMeshTasksIndirectNV(indirect);
+}
+
+static void APIENTRY lazy_glMultiDrawMeshTasksIndirectNV(GLintptr indirect, GLsizei drawcount, GLsizei stride) {
+	glad_glMultiDrawMeshTasksIndirectNV = (PFNGLMULTIDRAWMESHTASKSINDIRECTNVPROC)gladLazyResolve("glMultiDrawMeshTasksIndirectNV");
+	glad_glMultiDrawMeshTasksIndirectNV(indirect, drawcount, stride);
+}
+
+static void APIENTRY lazy_glMultiDrawMeshTasksIndirectCountNV(GLintptr indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+	glad_glMultiDrawMeshTasksIndirectCountNV = (PFNGLMULTIDRAWMESHTASKSINDIRECTCOUNTNVPROC)gladLazyResolve("glMultiDrawMeshTasksIndirectCountNV");
+	glad_glMultiDrawMeshTasksIndirectCountNV(indirect, drawcount, maxdrawcount, stride);
+}
+
+static void APIENTRY lazy_glGenOcclusionQueriesNV(GLsizei n, GLuint *ids) {
+	glad_glGenOcclusionQueriesNV = (PFNGLGENOCCLUSIONQUERIESNVPROC)gladLazyResolve("glGenOcclusionQueriesNV");
+	glad_glGenOcclusionQueriesNV(n, ids);
+}
+
+static void APIENTRY lazy_glDeleteOcclusionQueriesNV(GLsizei n, const GLuint *ids) {
+	glad_glDeleteOcclusionQueriesNV = (PFNGLDELETEOCCLUSIONQUERIESNVPROC)gladLazyResolve("glDeleteOcclusionQueriesNV");
+	glad_glDeleteOcclusionQueriesNV(n, ids);
+}
+
+static GLboolean APIENTRY lazy_glIsOcclusionQueryNV(GLuint id) {
+	glad_glIsOcclusionQueryNV = (PFNGLISOCCLUSIONQUERYNVPROC)gladLazyResolve("glIsOcclusionQueryNV");
+	return glad_glIsOcclusionQueryNV(id);
+}
+
+static void APIENTRY lazy_glBeginOcclusionQueryNV(GLuint id) {
+	glad_glBeginOcclusionQueryNV = (PFNGLBEGINOCCLUSIONQUERYNVPROC)gladLazyResolve("glBeginOcclusionQueryNV");
+	glad_glBeginOcclusionQueryNV(id);
+}
+
+static void APIENTRY lazy_glEndOcclusionQueryNV(void) {
+	glad_glEndOcclusionQueryNV = (PFNGLENDOCCLUSIONQUERYNVPROC)gladLazyResolve("glEndOcclusionQueryNV");
+	glad_glEndOcclusionQueryNV();
+}
+
+static void APIENTRY lazy_glGetOcclusionQueryivNV(GLuint id, GLenum pname, GLint *params) {
+	glad_glGetOcclusionQueryivNV = (PFNGLGETOCCLUSIONQUERYIVNVPROC)gladLazyResolve("glGetOcclusionQueryivNV");
+	glad_glGetOcclusionQueryivNV(id, pname, params);
+}
+
+static void APIENTRY lazy_glGetOcclusionQueryuivNV(GLuint id, GLenum pname, GLuint *params) {
+	glad_glGetOcclusionQueryuivNV = (PFNGLGETOCCLUSIONQUERYUIVNVPROC)gladLazyResolve("glGetOcclusionQueryuivNV");
+	glad_glGetOcclusionQueryuivNV(id, pname, params);
+}
+
+static void APIENTRY lazy_glProgramBufferParametersfvNV(GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLfloat *params) {
+	glad_glProgramBufferParametersfvNV = (PFNGLPROGRAMBUFFERPARAMETERSFVNVPROC)gladLazyResolve("glProgramBufferParametersfvNV");
+	glad_glProgramBufferParametersfvNV(target, bindingIndex, wordIndex, count, params);
+}
+
+static void APIENTRY lazy_glProgramBufferParametersIivNV(GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLint *params) {
+	glad_glProgramBufferParametersIivNV = (PFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC)gladLazyResolve("glProgramBufferParametersIivNV");
+	glad_glProgramBufferParametersIivNV(target, bindingIndex, wordIndex, count, params);
+}
+
+static void APIENTRY lazy_glProgramBufferParametersIuivNV(GLenum target, GLuint bindingIndex, GLuint wordIndex, GLsizei count, const GLuint *params) {
+	glad_glProgramBufferParametersIuivNV = (PFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC)gladLazyResolve("glProgramBufferParametersIuivNV");
+	glad_glProgramBufferParametersIuivNV(target, bindingIndex, wordIndex, count, params);
+}
+
+static GLuint APIENTRY lazy_glGenPathsNV(GLsizei range) {
+	glad_glGenPathsNV = (PFNGLGENPATHSNVPROC)gladLazyResolve("glGenPathsNV");
+	return glad_glGenPathsNV(range);
+}
+
+static void APIENTRY lazy_glDeletePathsNV(GLuint path, GLsizei range) {
+	glad_glDeletePathsNV = (PFNGLDELETEPATHSNVPROC)gladLazyResolve("glDeletePathsNV");
+	glad_glDeletePathsNV(path, range);
+}
+
+static GLboolean APIENTRY lazy_glIsPathNV(GLuint path) {
+	glad_glIsPathNV = (PFNGLISPATHNVPROC)gladLazyResolve("glIsPathNV");
+	return glad_glIsPathNV(path);
+}
+
+static void APIENTRY lazy_glPathCommandsNV(GLuint path, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords) {
+	glad_glPathCommandsNV = (PFNGLPATHCOMMANDSNVPROC)gladLazyResolve("glPathCommandsNV");
+	glad_glPathCommandsNV(path, numCommands, commands, numCoords, coordType, coords);
+}
+
+static void APIENTRY lazy_glPathCoordsNV(GLuint path, GLsizei numCoords, GLenum coordType, const void *coords) {
+	glad_glPathCoordsNV = (PFNGLPATHCOORDSNVPROC)gladLazyResolve("glPathCoordsNV");
+	glad_glPathCoordsNV(path, numCoords, coordType, coords);
+}
+
+static void APIENTRY lazy_glPathSubCommandsNV(GLuint path, GLsizei commandStart, GLsizei commandsToDelete, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords) {
+	glad_glPathSubCommandsNV = (PFNGLPATHSUBCOMMANDSNVPROC)gladLazyResolve("glPathSubCommandsNV");
+	glad_glPathSubCommandsNV(path, commandStart, commandsToDelete, numCommands, commands, numCoords, coordType, coords);
+}
+
+static void APIENTRY lazy_glPathSubCoordsNV(GLuint path, GLsizei coordStart, GLsizei numCoords, GLenum coordType, const void *coords) {
+	glad_glPathSubCoordsNV = (PFNGLPATHSUBCOORDSNVPROC)gladLazyResolve("glPathSubCoordsNV");
+	glad_glPathSubCoordsNV(path, coordStart, numCoords, coordType, coords);
+}
+
+static void APIENTRY lazy_glPathStringNV(GLuint path, GLenum format, GLsizei length, const void *pathString) {
+	glad_glPathStringNV = (PFNGLPATHSTRINGNVPROC)gladLazyResolve("glPathStringNV");
+	glad_glPathStringNV(path, format, length, pathString);
+}
+
+static void APIENTRY lazy_glPathGlyphsNV(GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLsizei numGlyphs, GLenum type, const void *charcodes, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale) {
+	glad_glPathGlyphsNV = (PFNGLPATHGLYPHSNVPROC)gladLazyResolve("glPathGlyphsNV");
+	glad_glPathGlyphsNV(firstPathName, fontTarget, fontName, fontStyle, numGlyphs, type, charcodes, handleMissingGlyphs, pathParameterTemplate, emScale);
+}
+
+static void APIENTRY lazy_glPathGlyphRangeNV(GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyph, GLsizei numGlyphs, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale) {
+	glad_glPathGlyphRangeNV = (PFNGLPATHGLYPHRANGENVPROC)gladLazyResolve("glPathGlyphRangeNV");
+	glad_glPathGlyphRangeNV(firstPathName, fontTarget, fontName, fontStyle, firstGlyph, numGlyphs, handleMissingGlyphs, pathParameterTemplate, emScale);
+}
+
+static void APIENTRY lazy_glWeightPathsNV(GLuint resultPath, GLsizei numPaths, const GLuint *paths, const GLfloat *weights) {
+	glad_glWeightPathsNV = (PFNGLWEIGHTPATHSNVPROC)gladLazyResolve("glWeightPathsNV");
+	glad_glWeightPathsNV(resultPath, numPaths, paths, weights);
+}
+
+static void APIENTRY lazy_glCopyPathNV(GLuint resultPath, GLuint srcPath) {
+	glad_glCopyPathNV = (PFNGLCOPYPATHNVPROC)gladLazyResolve("glCopyPathNV");
+	glad_glCopyPathNV(resultPath, srcPath);
+}
+
+static void APIENTRY lazy_glInterpolatePathsNV(GLuint resultPath, GLuint pathA, GLuint pathB, GLfloat weight) {
+	glad_glInterpolatePathsNV = (PFNGLINTERPOLATEPATHSNVPROC)gladLazyResolve("glInterpolatePathsNV");
+	glad_glInterpolatePathsNV(resultPath, pathA, pathB, weight);
+}
+
+static void APIENTRY lazy_glTransformPathNV(GLuint resultPath, GLuint srcPath, GLenum transformType, const GLfloat *transformValues) {
+	glad_glTransformPathNV = (PFNGLTRANSFORMPATHNVPROC)gladLazyResolve("glTransformPathNV");
+	glad_glTransformPathNV(resultPath, srcPath, transformType, transformValues);
+}
+
+static void APIENTRY lazy_glPathParameterivNV(GLuint path, GLenum pname, const GLint *value) {
+	glad_glPathParameterivNV = (PFNGLPATHPARAMETERIVNVPROC)gladLazyResolve("glPathParameterivNV");
+	glad_glPathParameterivNV(path, pname, value);
+}
+
+static void APIENTRY lazy_glPathParameteriNV(GLuint path, GLenum pname, GLint value) {
+	glad_glPathParameteriNV = (PFNGLPATHPARAMETERINVPROC)gladLazyResolve("glPathParameteriNV");
+	glad_glPathParameteriNV(path, pname, value);
+}
+
+static void APIENTRY lazy_glPathParameterfvNV(GLuint path, GLenum pname, const GLfloat *value) {
+	glad_glPathParameterfvNV = (PFNGLPATHPARAMETERFVNVPROC)gladLazyResolve("glPathParameterfvNV");
+	glad_glPathParameterfvNV(path, pname, value);
+}
+
+static void APIENTRY lazy_glPathParameterfNV(GLuint path, GLenum pname, GLfloat value) {
+	glad_glPathParameterfNV = (PFNGLPATHPARAMETERFNVPROC)gladLazyResolve("glPathParameterfNV");
+	glad_glPathParameterfNV(path, pname, value);
+}
+
+static void APIENTRY lazy_glPathDashArrayNV(GLuint path, GLsizei dashCount, const GLfloat *dashArray) {
+	glad_glPathDashArrayNV = (PFNGLPATHDASHARRAYNVPROC)gladLazyResolve("glPathDashArrayNV");
+	glad_glPathDashArrayNV(path, dashCount, dashArray);
+}
+
+static void APIENTRY lazy_glPathStencilFuncNV(GLenum func, GLint ref, GLuint mask) {
+	glad_glPathStencilFuncNV = (PFNGLPATHSTENCILFUNCNVPROC)gladLazyResolve("glPathStencilFuncNV");
+	glad_glPathStencilFuncNV(func, ref, mask);
+}
+
+static void APIENTRY lazy_glPathStencilDepthOffsetNV(GLfloat factor, GLfloat units) {
+	glad_glPathStencilDepthOffsetNV = (PFNGLPATHSTENCILDEPTHOFFSETNVPROC)gladLazyResolve("glPathStencilDepthOffsetNV");
+	glad_glPathStencilDepthOffsetNV(factor, units);
+}
+
+static void APIENTRY lazy_glStencilFillPathNV(GLuint path, GLenum fillMode, GLuint mask) {
+	glad_glStencilFillPathNV = (PFNGLSTENCILFILLPATHNVPROC)gladLazyResolve("glStencilFillPathNV");
+	glad_glStencilFillPathNV(path, fillMode, mask);
+}
+
+static void APIENTRY lazy_glStencilStrokePathNV(GLuint path, GLint reference, GLuint mask) {
+	glad_glStencilStrokePathNV = (PFNGLSTENCILSTROKEPATHNVPROC)gladLazyResolve("glStencilStrokePathNV");
+	glad_glStencilStrokePathNV(path, reference, mask);
+}
+
+static void APIENTRY lazy_glStencilFillPathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum transformType, const GLfloat *transformValues) {
+	glad_glStencilFillPathInstancedNV = (PFNGLSTENCILFILLPATHINSTANCEDNVPROC)gladLazyResolve("glStencilFillPathInstancedNV");
+	glad_glStencilFillPathInstancedNV(numPaths, pathNameType, paths, pathBase, fillMode, mask, transformType, transformValues);
+}
+
+static void APIENTRY lazy_glStencilStrokePathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum transformType, const GLfloat *transformValues) {
+	glad_glStencilStrokePathInstancedNV = (PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC)gladLazyResolve("glStencilStrokePathInstancedNV");
+	glad_glStencilStrokePathInstancedNV(numPaths, pathNameType, paths, pathBase, reference, mask, transformType, transformValues);
+}
+
+static void APIENTRY lazy_glPathCoverDepthFuncNV(GLenum func) {
+	glad_glPathCoverDepthFuncNV = (PFNGLPATHCOVERDEPTHFUNCNVPROC)gladLazyResolve("glPathCoverDepthFuncNV");
+	glad_glPathCoverDepthFuncNV(func);
+}
+
+static void APIENTRY lazy_glCoverFillPathNV(GLuint path, GLenum coverMode) {
+	glad_glCoverFillPathNV = (PFNGLCOVERFILLPATHNVPROC)gladLazyResolve("glCoverFillPathNV");
+	glad_glCoverFillPathNV(path, coverMode);
+}
+
+static void APIENTRY lazy_glCoverStrokePathNV(GLuint path, GLenum coverMode) {
+	glad_glCoverStrokePathNV = (PFNGLCOVERSTROKEPATHNVPROC)gladLazyResolve("glCoverStrokePathNV");
+	glad_glCoverStrokePathNV(path, coverMode);
+}
+
+static void APIENTRY lazy_glCoverFillPathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues) {
+	glad_glCoverFillPathInstancedNV = (PFNGLCOVERFILLPATHINSTANCEDNVPROC)gladLazyResolve("glCoverFillPathInstancedNV");
+	glad_glCoverFillPathInstancedNV(numPaths, pathNameType, paths, pathBase, coverMode, transformType, transformValues);
+}
+
+static void APIENTRY lazy_glCoverStrokePathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues) {
+	glad_glCoverStrokePathInstancedNV = (PFNGLCOVERSTROKEPATHINSTANCEDNVPROC)gladLazyResolve("glCoverStrokePathInstancedNV");
+	glad_glCoverStrokePathInstancedNV(numPaths, pathNameType, paths, pathBase, coverMode, transformType, transformValues);
+}
+
+static void APIENTRY lazy_glGetPathParameterivNV(GLuint path, GLenum pname, GLint *value) {
+	glad_glGetPathParameterivNV = (PFNGLGETPATHPARAMETERIVNVPROC)gladLazyResolve("glGetPathParameterivNV");
+	glad_glGetPathParameterivNV(path, pname, value);
+}
+
+static void APIENTRY lazy_glGetPathParameterfvNV(GLuint path, GLenum pname, GLfloat *value) {
+	glad_glGetPathParameterfvNV = (PFNGLGETPATHPARAMETERFVNVPROC)gladLazyResolve("glGetPathParameterfvNV");
+	glad_glGetPathParameterfvNV(path, pname, value);
+}
+
+static void APIENTRY lazy_glGetPathCommandsNV(GLuint path, GLubyte *commands) {
+	glad_glGetPathCommandsNV = (PFNGLGETPATHCOMMANDSNVPROC)gladLazyResolve("glGetPathCommandsNV");
+	glad_glGetPathCommandsNV(path, commands);
+}
+
+static void APIENTRY lazy_glGetPathCoordsNV(GLuint path, GLfloat *coords) {
+	glad_glGetPathCoordsNV = (PFNGLGETPATHCOORDSNVPROC)gladLazyResolve("glGetPathCoordsNV");
+	glad_glGetPathCoordsNV(path, coords);
+}
+
+static void APIENTRY lazy_glGetPathDashArrayNV(GLuint path, GLfloat *dashArray) {
+	glad_glGetPathDashArrayNV = (PFNGLGETPATHDASHARRAYNVPROC)gladLazyResolve("glGetPathDashArrayNV");
+	glad_glGetPathDashArrayNV(path, dashArray);
+}
+
+static void APIENTRY lazy_glGetPathMetricsNV(GLbitfield metricQueryMask, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLsizei stride, GLfloat *metrics) {
+	glad_glGetPathMetricsNV = (PFNGLGETPATHMETRICSNVPROC)gladLazyResolve("glGetPathMetricsNV");
+	glad_glGetPathMetricsNV(metricQueryMask, numPaths, pathNameType, paths, pathBase, stride, metrics);
+}
+
+static void APIENTRY lazy_glGetPathMetricRangeNV(GLbitfield metricQueryMask, GLuint firstPathName, GLsizei numPaths, GLsizei stride, GLfloat *metrics) {
+	glad_glGetPathMetricRangeNV = (PFNGLGETPATHMETRICRANGENVPROC)gladLazyResolve("glGetPathMetricRangeNV");
+	glad_glGetPathMetricRangeNV(metricQueryMask, firstPathName, numPaths, stride, metrics);
+}
+
+static void APIENTRY lazy_glGetPathSpacingNV(GLenum pathListMode, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLfloat advanceScale, GLfloat kerningScale, GLenum transformType, GLfloat *returnedSpacing) {
+	glad_glGetPathSpacingNV = (PFNGLGETPATHSPACINGNVPROC)gladLazyResolve("glGetPathSpacingNV");
+	glad_glGetPathSpacingNV(pathListMode, numPaths, pathNameType, paths, pathBase, advanceScale, kerningScale, transformType, returnedSpacing);
+}
+
+static GLboolean APIENTRY lazy_glIsPointInFillPathNV(GLuint path, GLuint mask, GLfloat x, GLfloat y) {
+	glad_glIsPointInFillPathNV = (PFNGLISPOINTINFILLPATHNVPROC)gladLazyResolve("glIsPointInFillPathNV");
+	return glad_glIsPointInFillPathNV(path, mask, x, y);
+}
+
+static GLboolean APIENTRY lazy_glIsPointInStrokePathNV(GLuint path, GLfloat x, GLfloat y) {
+	glad_glIsPointInStrokePathNV = (PFNGLISPOINTINSTROKEPATHNVPROC)gladLazyResolve("glIsPointInStrokePathNV");
+	return glad_glIsPointInStrokePathNV(path, x, y);
+}
+
+static GLfloat APIENTRY lazy_glGetPathLengthNV(GLuint path, GLsizei startSegment, GLsizei numSegments) {
+	glad_glGetPathLengthNV = (PFNGLGETPATHLENGTHNVPROC)gladLazyResolve("glGetPathLengthNV");
+	return glad_glGetPathLengthNV(path, startSegment, numSegments);
+}
+
+static GLboolean APIENTRY lazy_glPointAlongPathNV(GLuint path, GLsizei startSegment, GLsizei numSegments, GLfloat distance, GLfloat *x, GLfloat *y, GLfloat *tangentX, GLfloat *tangentY) {
+	glad_glPointAlongPathNV = (PFNGLPOINTALONGPATHNVPROC)gladLazyResolve("glPointAlongPathNV");
+	return glad_glPointAlongPathNV(path, startSegment, numSegments, distance, x, y, tangentX, tangentY);
+}
+
+static void APIENTRY lazy_glMatrixLoad3x2fNV(GLenum matrixMode, const GLfloat *m) {
+	glad_glMatrixLoad3x2fNV = (PFNGLMATRIXLOAD3X2FNVPROC)gladLazyResolve("glMatrixLoad3x2fNV");
+	glad_glMatrixLoad3x2fNV(matrixMode, m);
+}
+
+static void APIENTRY lazy_glMatrixLoad3x3fNV(GLenum matrixMode, const GLfloat *m) {
+	glad_glMatrixLoad3x3fNV = (PFNGLMATRIXLOAD3X3FNVPROC)gladLazyResolve("glMatrixLoad3x3fNV");
+	glad_glMatrixLoad3x3fNV(matrixMode, m);
+}
+
+static void APIENTRY lazy_glMatrixLoadTranspose3x3fNV(GLenum matrixMode, const GLfloat *m) {
+	glad_glMatrixLoadTranspose3x3fNV = (PFNGLMATRIXLOADTRANSPOSE3X3FNVPROC)gladLazyResolve("glMatrixLoadTranspose3x3fNV");
+	glad_glMatrixLoadTranspose3x3fNV(matrixMode, m);
+}
+
+static void APIENTRY lazy_glMatrixMult3x2fNV(GLenum matrixMode, const GLfloat *m) {
+	glad_glMatrixMult3x2fNV = (PFNGLMATRIXMULT3X2FNVPROC)gladLazyResolve("glMatrixMult3x2fNV");
+	glad_glMatrixMult3x2fNV(matrixMode, m);
+}
+
+static void APIENTRY lazy_glMatrixMult3x3fNV(GLenum matrixMode, const GLfloat *m) {
+	glad_glMatrixMult3x3fNV = (PFNGLMATRIXMULT3X3FNVPROC)gladLazyResolve("glMatrixMult3x3fNV");
+	glad_glMatrixMult3x3fNV(matrixMode, m);
+}
+
+static void APIENTRY lazy_glMatrixMultTranspose3x3fNV(GLenum matrixMode, const GLfloat *m) {
+	glad_glMatrixMultTranspose3x3fNV = (PFNGLMATRIXMULTTRANSPOSE3X3FNVPROC)gladLazyResolve("glMatrixMultTranspose3x3fNV");
+	glad_glMatrixMultTranspose3x3fNV(matrixMode, m);
+}
+
+static void APIENTRY lazy_glStencilThenCoverFillPathNV(GLuint path, GLenum fillMode, GLuint mask, GLenum coverMode) {
+	glad_glStencilThenCoverFillPathNV = (PFNGLSTENCILTHENCOVERFILLPATHNVPROC)gladLazyResolve("glStencilThenCoverFillPathNV");
+	glad_glStencilThenCoverFillPathNV(path, fillMode, mask, coverMode);
+}
+
+static void APIENTRY lazy_glStencilThenCoverStrokePathNV(GLuint path, GLint reference, GLuint mask, GLenum coverMode) {
+	glad_glStencilThenCoverStrokePathNV = (PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC)gladLazyResolve("glStencilThenCoverStrokePathNV");
+	glad_glStencilThenCoverStrokePathNV(path, reference, mask, coverMode);
+}
+
+static void APIENTRY lazy_glStencilThenCoverFillPathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues) {
+	glad_glStencilThenCoverFillPathInstancedNV = (PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC)gladLazyResolve("glStencilThenCoverFillPathInstancedNV");
+	glad_glStencilThenCoverFillPathInstancedNV(numPaths, pathNameType, paths, pathBase, fillMode, mask, coverMode, transformType, transformValues);
+}
+
+static void APIENTRY lazy_glStencilThenCoverStrokePathInstancedNV(GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues) {
+	glad_glStencilThenCoverStrokePathInstancedNV = (PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC)gladLazyResolve("glStencilThenCoverStrokePathInstancedNV");
+	glad_glStencilThenCoverStrokePathInstancedNV(numPaths, pathNameType, paths, pathBase, reference, mask, coverMode, transformType, transformValues);
+}
+
+static GLenum APIENTRY lazy_glPathGlyphIndexRangeNV(GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint pathParameterTemplate, GLfloat emScale, GLuint *baseAndCount) {
+	glad_glPathGlyphIndexRangeNV = (PFNGLPATHGLYPHINDEXRANGENVPROC)gladLazyResolve("glPathGlyphIndexRangeNV");
+	return glad_glPathGlyphIndexRangeNV(fontTarget, fontName, fontStyle, pathParameterTemplate, emScale, baseAndCount);
+}
+
+static GLenum APIENTRY lazy_glPathGlyphIndexArrayNV(GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale) {
+	glad_glPathGlyphIndexArrayNV = (PFNGLPATHGLYPHINDEXARRAYNVPROC)gladLazyResolve("glPathGlyphIndexArrayNV");
+	return glad_glPathGlyphIndexArrayNV(firstPathName, fontTarget, fontName, fontStyle, firstGlyphIndex, numGlyphs, pathParameterTemplate, emScale);
+}
+
+static GLenum APIENTRY lazy_glPathMemoryGlyphIndexArrayNV(GLuint firstPathName, GLenum fontTarget, GLsizeiptr fontSize, const void *fontData, GLsizei faceIndex, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale) {
+	glad_glPathMemoryGlyphIndexArrayNV = (PFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC)gladLazyResolve("glPathMemoryGlyphIndexArrayNV");
+	return glad_glPathMemoryGlyphIndexArrayNV(firstPathName, fontTarget, fontSize, fontData, faceIndex, firstGlyphIndex, numGlyphs, pathParameterTemplate, emScale);
+}
+
+static void APIENTRY lazy_glProgramPathFragmentInputGenNV(GLuint program, GLint location, GLenum genMode, GLint components, const GLfloat *coeffs) {
+	glad_glProgramPathFragmentInputGenNV = (PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC)gladLazyResolve("glProgramPathFragmentInputGenNV");
+	glad_glProgramPathFragmentInputGenNV(program, location, genMode, components, coeffs);
+}
+
+static void APIENTRY lazy_glGetProgramResourcefvNV(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLfloat *params) {
+	glad_glGetProgramResourcefvNV = (PFNGLGETPROGRAMRESOURCEFVNVPROC)gladLazyResolve("glGetProgramResourcefvNV");
+	glad_glGetProgramResourcefvNV(program, programInterface, index, propCount, props, count, length, params);
+}
+
+static void APIENTRY lazy_glPathColorGenNV(GLenum color, GLenum genMode, GLenum colorFormat, const GLfloat *coeffs) {
+	glad_glPathColorGenNV = (PFNGLPATHCOLORGENNVPROC)gladLazyResolve("glPathColorGenNV");
+	glad_glPathColorGenNV(color, genMode, colorFormat, coeffs);
+}
+
+static void APIENTRY lazy_glPathTexGenNV(GLenum texCoordSet, GLenum genMode, GLint components, const GLfloat *coeffs) {
+	glad_glPathTexGenNV = (PFNGLPATHTEXGENNVPROC)gladLazyResolve("glPathTexGenNV");
+	glad_glPathTexGenNV(texCoordSet, genMode, components, coeffs);
+}
+
+static void APIENTRY lazy_glPathFogGenNV(GLenum genMode) {
+	glad_glPathFogGenNV = (PFNGLPATHFOGGENNVPROC)gladLazyResolve("glPathFogGenNV");
+	glad_glPathFogGenNV(genMode);
+}
+
+static void APIENTRY lazy_glGetPathColorGenivNV(GLenum color, GLenum pname, GLint *value) {
+	glad_glGetPathColorGenivNV = (PFNGLGETPATHCOLORGENIVNVPROC)gladLazyResolve("glGetPathColorGenivNV");
+	glad_glGetPathColorGenivNV(color, pname, value);
+}
+
+static void APIENTRY lazy_glGetPathColorGenfvNV(GLenum color, GLenum pname, GLfloat *value) {
+	glad_glGetPathColorGenfvNV = (PFNGLGETPATHCOLORGENFVNVPROC)gladLazyResolve("glGetPathColorGenfvNV");
+	glad_glGetPathColorGenfvNV(color, pname, value);
+}
+
+static void APIENTRY lazy_glGetPathTexGenivNV(GLenum texCoordSet, GLenum pname, GLint *value) {
+	glad_glGetPathTexGenivNV = (PFNGLGETPATHTEXGENIVNVPROC)gladLazyResolve("glGetPathTexGenivNV");
+	glad_glGetPathTexGenivNV(texCoordSet, pname, value);
+}
+
+static void APIENTRY lazy_glGetPathTexGenfvNV(GLenum texCoordSet, GLenum pname, GLfloat *value) {
+	glad_glGetPathTexGenfvNV = (PFNGLGETPATHTEXGENFVNVPROC)gladLazyResolve("glGetPathTexGenfvNV");
+	glad_glGetPathTexGenfvNV(texCoordSet, pname, value);
+}
+
+static void APIENTRY lazy_glPixelDataRangeNV(GLenum target, GLsizei length, const void *pointer) {
+	glad_glPixelDataRangeNV = (PFNGLPIXELDATARANGENVPROC)gladLazyResolve("glPixelDataRangeNV");
+	glad_glPixelDataRangeNV(target, length, pointer);
+}
+
+static void APIENTRY lazy_glFlushPixelDataRangeNV(GLenum target) {
+	glad_glFlushPixelDataRangeNV = (PFNGLFLUSHPIXELDATARANGENVPROC)gladLazyResolve("glFlushPixelDataRangeNV");
+	glad_glFlushPixelDataRangeNV(target);
+}
+
+static void APIENTRY lazy_glPointParameteriNV(GLenum pname, GLint param) {
+	glad_glPointParameteriNV = (PFNGLPOINTPARAMETERINVPROC)gladLazyResolve("glPointParameteriNV");
+	glad_glPointParameteriNV(pname, param);
+}
+
+static void APIENTRY lazy_glPointParameterivNV(GLenum pname, const GLint *params) {
+	glad_glPointParameterivNV = (PFNGLPOINTPARAMETERIVNVPROC)gladLazyResolve("glPointParameterivNV");
+	glad_glPointParameterivNV(pname, params);
+}
+
+static void APIENTRY lazy_glPresentFrameKeyedNV(GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLuint key0, GLenum target1, GLuint fill1, GLuint key1) {
+	glad_glPresentFrameKeyedNV = (PFNGLPRESENTFRAMEKEYEDNVPROC)gladLazyResolve("glPresentFrameKeyedNV");
+	glad_glPresentFrameKeyedNV(video_slot, minPresentTime, beginPresentTimeId, presentDurationId, type, target0, fill0, key0, target1, fill1, key1);
+}
+
+static void APIENTRY lazy_glPresentFrameDualFillNV(GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLenum target1, GLuint fill1, GLenum target2, GLuint fill2, GLenum target3, GLuint fill3) {
+	glad_glPresentFrameDualFillNV = (PFNGLPRESENTFRAMEDUALFILLNVPROC)gladLazyResolve("glPresentFrameDualFillNV");
+	glad_glPresentFrameDualFillNV(video_slot, minPresentTime, beginPresentTimeId, presentDurationId, type, target0, fill0, target1, fill1, target2, fill2, target3, fill3);
+}
+
+static void APIENTRY lazy_glGetVideoivNV(GLuint video_slot, GLenum pname, GLint *params) {
+	glad_glGetVideoivNV = (PFNGLGETVIDEOIVNVPROC)gladLazyResolve("glGetVideoivNV");
+	glad_glGetVideoivNV(video_slot, pname, params);
+}
+
+static void APIENTRY lazy_glGetVideouivNV(GLuint video_slot, GLenum pname, GLuint *params) {
+	glad_glGetVideouivNV = (PFNGLGETVIDEOUIVNVPROC)gladLazyResolve("glGetVideouivNV");
+	glad_glGetVideouivNV(video_slot, pname, params);
+}
+
+static void APIENTRY lazy_glGetVideoi64vNV(GLuint video_slot, GLenum pname, GLint64EXT *params) {
+	glad_glGetVideoi64vNV = (PFNGLGETVIDEOI64VNVPROC)gladLazyResolve("glGetVideoi64vNV");
+	glad_glGetVideoi64vNV(video_slot, pname, params);
+}
+
+static void APIENTRY lazy_glGetVideoui64vNV(GLuint video_slot, GLenum pname, GLuint64EXT *params) {
+	glad_glGetVideoui64vNV = (PFNGLGETVIDEOUI64VNVPROC)gladLazyResolve("glGetVideoui64vNV");
+	glad_glGetVideoui64vNV(video_slot, pname, params);
+}
+
+static void APIENTRY lazy_glPrimitiveRestartNV(void) {
+	glad_glPrimitiveRestartNV = (PFNGLPRIMITIVERESTARTNVPROC)gladLazyResolve("glPrimitiveRestartNV");
+	glad_glPrimitiveRestartNV();
+}
+
+static void APIENTRY lazy_glPrimitiveRestartIndexNV(GLuint index) {
+	glad_glPrimitiveRestartIndexNV = (PFNGLPRIMITIVERESTARTINDEXNVPROC)gladLazyResolve("glPrimitiveRestartIndexNV");
+	glad_glPrimitiveRestartIndexNV(index);
+}
+
+static GLint APIENTRY lazy_glQueryResourceNV(GLenum queryType, GLint tagId, GLuint count, GLint *buffer) {
+	glad_glQueryResourceNV = (PFNGLQUERYRESOURCENVPROC)gladLazyResolve("glQueryResourceNV");
+	return glad_glQueryResourceNV(queryType, tagId, count, buffer);
+}
+
+static void APIENTRY lazy_glGenQueryResourceTagNV(GLsizei n, GLint *tagIds) {
+	glad_glGenQueryResourceTagNV = (PFNGLGENQUERYRESOURCETAGNVPROC)gladLazyResolve("glGenQueryResourceTagNV");
+	glad_glGenQueryResourceTagNV(n, tagIds);
+}
+
+static void APIENTRY lazy_glDeleteQueryResourceTagNV(GLsizei n, const GLint *tagIds) {
+	glad_glDeleteQueryResourceTagNV = (PFNGLDELETEQUERYRESOURCETAGNVPROC)gladLazyResolve("glDeleteQueryResourceTagNV");
+	glad_glDeleteQueryResourceTagNV(n, tagIds);
+}
+
+static void APIENTRY lazy_glQueryResourceTagNV(GLint tagId, const GLchar *tagString) {
+	glad_glQueryResourceTagNV = (PFNGLQUERYRESOURCETAGNVPROC)gladLazyResolve("glQueryResourceTagNV");
+	glad_glQueryResourceTagNV(tagId, tagString);
+}
+
+static void APIENTRY lazy_glCombinerParameterfvNV(GLenum pname, const GLfloat *params) {
+	glad_glCombinerParameterfvNV = (PFNGLCOMBINERPARAMETERFVNVPROC)gladLazyResolve("glCombinerParameterfvNV");
+	glad_glCombinerParameterfvNV(pname, params);
+}
+
+static void APIENTRY lazy_glCombinerParameterfNV(GLenum pname, GLfloat param) {
+	glad_glCombinerParameterfNV = (PFNGLCOMBINERPARAMETERFNVPROC)gladLazyResolve("glCombinerParameterfNV");
+	glad_glCombinerParameterfNV(pname, param);
+}
+
+static void APIENTRY lazy_glCombinerParameterivNV(GLenum pname, const GLint *params) {
+	glad_glCombinerParameterivNV = (PFNGLCOMBINERPARAMETERIVNVPROC)gladLazyResolve("glCombinerParameterivNV");
+	glad_glCombinerParameterivNV(pname, params);
+}
+
+static void APIENTRY lazy_glCombinerParameteriNV(GLenum pname, GLint param) {
+	glad_glCombinerParameteriNV = (PFNGLCOMBINERPARAMETERINVPROC)gladLazyResolve("glCombinerParameteriNV");
+	glad_glCombinerParameteriNV(pname, param);
+}
+
+static void APIENTRY lazy_glCombinerInputNV(GLenum stage, GLenum portion, GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage) {
+	glad_glCombinerInputNV = (PFNGLCOMBINERINPUTNVPROC)gladLazyResolve("glCombinerInputNV");
+	glad_glCombinerInputNV(stage, portion, variable, input, mapping, componentUsage);
+}
+
+static void APIENTRY lazy_glCombinerOutputNV(GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum) {
+	glad_glCombinerOutputNV = (PFNGLCOMBINEROUTPUTNVPROC)gladLazyResolve("glCombinerOutputNV");
+	glad_glCombinerOutputNV(stage, portion, abOutput, cdOutput, sumOutput, scale, bias, abDotProduct, cdDotProduct, muxSum);
+}
+
+static void APIENTRY lazy_glFinalCombinerInputNV(GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage) {
+	glad_glFinalCombinerInputNV = (PFNGLFINALCOMBINERINPUTNVPROC)gladLazyResolve("glFinalCombinerInputNV");
+	glad_glFinalCombinerInputNV(variable, input, mapping, componentUsage);
+}
+
+static void APIENTRY lazy_glGetCombinerInputParameterfvNV(GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLfloat *params) {
+	glad_glGetCombinerInputParameterfvNV = (PFNGLGETCOMBINERINPUTPARAMETERFVNVPROC)gladLazyResolve("glGetCombinerInputParameterfvNV");
+	glad_glGetCombinerInputParameterfvNV(stage, portion, variable, pname, params);
+}
+
+static void APIENTRY lazy_glGetCombinerInputParameterivNV(GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLint *params) {
+	glad_glGetCombinerInputParameterivNV = (PFNGLGETCOMBINERINPUTPARAMETERIVNVPROC)gladLazyResolve("glGetCombinerInputParameterivNV");
+	glad_glGetCombinerInputParameterivNV(stage, portion, variable, pname, params);
+}
+
+static void APIENTRY lazy_glGetCombinerOutputParameterfvNV(GLenum stage, GLenum portion, GLenum pname, GLfloat *params) {
+	glad_glGetCombinerOutputParameterfvNV = (PFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC)gladLazyResolve("glGetCombinerOutputParameterfvNV");
+	glad_glGetCombinerOutputParameterfvNV(stage, portion, pname, params);
+}
+
+static void APIENTRY lazy_glGetCombinerOutputParameterivNV(GLenum stage, GLenum portion, GLenum pname, GLint *params) {
+	glad_glGetCombinerOutputParameterivNV = (PFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC)gladLazyResolve("glGetCombinerOutputParameterivNV");
+	glad_glGetCombinerOutputParameterivNV(stage, portion, pname, params);
+}
+
+static void APIENTRY lazy_glGetFinalCombinerInputParameterfvNV(GLenum variable, GLenum pname, GLfloat *params) {
+	glad_glGetFinalCombinerInputParameterfvNV = (PFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC)gladLazyResolve("glGetFinalCombinerInputParameterfvNV");
+	glad_glGetFinalCombinerInputParameterfvNV(variable, pname, params);
+}
+
+static void APIENTRY lazy_glGetFinalCombinerInputParameterivNV(GLenum variable, GLenum pname, GLint *params) {
+	glad_glGetFinalCombinerInputParameterivNV = (PFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC)gladLazyResolve("glGetFinalCombinerInputParameterivNV");
+	glad_glGetFinalCombinerInputParameterivNV(variable, pname, params);
+}
+
+static void APIENTRY lazy_glCombinerStageParameterfvNV(GLenum stage, GLenum pname, const GLfloat *params) {
+	glad_glCombinerStageParameterfvNV = (PFNGLCOMBINERSTAGEPARAMETERFVNVPROC)gladLazyResolve("glCombinerStageParameterfvNV");
+	glad_glCombinerStageParameterfvNV(stage, pname, params);
+}
+
+static void APIENTRY lazy_glGetCombinerStageParameterfvNV(GLenum stage, GLenum pname, GLfloat *params) {
+	glad_glGetCombinerStageParameterfvNV = (PFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC)gladLazyResolve("glGetCombinerStageParameterfvNV");
+	glad_glGetCombinerStageParameterfvNV(stage, pname, params);
+}
+
+static void APIENTRY lazy_glFramebufferSampleLocationsfvNV(GLenum target, GLuint start, GLsizei count, const GLfloat *v) {
+	glad_glFramebufferSampleLocationsfvNV = (PFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)gladLazyResolve("glFramebufferSampleLocationsfvNV");
+	glad_glFramebufferSampleLocationsfvNV(target, start, count, v);
+}
+
+static void APIENTRY lazy_glNamedFramebufferSampleLocationsfvNV(GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v) {
+	glad_glNamedFramebufferSampleLocationsfvNV = (PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)gladLazyResolve("glNamedFramebufferSampleLocationsfvNV");
+	glad_glNamedFramebufferSampleLocationsfvNV(framebuffer, start, count, v);
+}
+
+static void APIENTRY lazy_glResolveDepthValuesNV(void) {
+	glad_glResolveDepthValuesNV = (PFNGLRESOLVEDEPTHVALUESNVPROC)gladLazyResolve("glResolveDepthValuesNV");
+	glad_glResolveDepthValuesNV();
+}
+
+static void APIENTRY lazy_glScissorExclusiveNV(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glScissorExclusiveNV = (PFNGLSCISSOREXCLUSIVENVPROC)gladLazyResolve("glScissorExclusiveNV");
+	glad_glScissorExclusiveNV(x, y, width, height);
+}
+
+static void APIENTRY lazy_glScissorExclusiveArrayvNV(GLuint first, GLsizei count, const GLint *v) {
+	glad_glScissorExclusiveArrayvNV = (PFNGLSCISSOREXCLUSIVEARRAYVNVPROC)gladLazyResolve("glScissorExclusiveArrayvNV");
+	glad_glScissorExclusiveArrayvNV(first, count, v);
+}
+
+static void APIENTRY lazy_glMakeBufferResidentNV(GLenum target, GLenum access) {
+	glad_glMakeBufferResidentNV = (PFNGLMAKEBUFFERRESIDENTNVPROC)gladLazyResolve("glMakeBufferResidentNV");
+	glad_glMakeBufferResidentNV(target, access);
+}
+
+static void APIENTRY lazy_glMakeBufferNonResidentNV(GLenum target) {
+	glad_glMakeBufferNonResidentNV = (PFNGLMAKEBUFFERNONRESIDENTNVPROC)gladLazyResolve("glMakeBufferNonResidentNV");
+	glad_glMakeBufferNonResidentNV(target);
+}
+
+static GLboolean APIENTRY lazy_glIsBufferResidentNV(GLenum target) {
+	glad_glIsBufferResidentNV = (PFNGLISBUFFERRESIDENTNVPROC)gladLazyResolve("glIsBufferResidentNV");
+	return glad_glIsBufferResidentNV(target);
+}
+
+static void APIENTRY lazy_glMakeNamedBufferResidentNV(GLuint buffer, GLenum access) {
+	glad_glMakeNamedBufferResidentNV = (PFNGLMAKENAMEDBUFFERRESIDENTNVPROC)gladLazyResolve("glMakeNamedBufferResidentNV");
+	glad_glMakeNamedBufferResidentNV(buffer, access);
+}
+
+static void APIENTRY lazy_glMakeNamedBufferNonResidentNV(GLuint buffer) {
+	glad_glMakeNamedBufferNonResidentNV = (PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC)gladLazyResolve("glMakeNamedBufferNonResidentNV");
+	glad_glMakeNamedBufferNonResidentNV(buffer);
+}
+
+static GLboolean APIENTRY lazy_glIsNamedBufferResidentNV(GLuint buffer) {
+	glad_glIsNamedBufferResidentNV = (PFNGLISNAMEDBUFFERRESIDENTNVPROC)gladLazyResolve("glIsNamedBufferResidentNV");
+	return glad_glIsNamedBufferResidentNV(buffer);
+}
+
+static void APIENTRY lazy_glGetBufferParameterui64vNV(GLenum target, GLenum pname, GLuint64EXT *params) {
+	glad_glGetBufferParameterui64vNV = (PFNGLGETBUFFERPARAMETERUI64VNVPROC)gladLazyResolve("glGetBufferParameterui64vNV");
+	glad_glGetBufferParameterui64vNV(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetNamedBufferParameterui64vNV(GLuint buffer, GLenum pname, GLuint64EXT *params) {
+	glad_glGetNamedBufferParameterui64vNV = (PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC)gladLazyResolve("glGetNamedBufferParameterui64vNV");
+	glad_glGetNamedBufferParameterui64vNV(buffer, pname, params);
+}
+
+static void APIENTRY lazy_glGetIntegerui64vNV(GLenum value, GLuint64EXT *result) {
+	glad_glGetIntegerui64vNV = (PFNGLGETINTEGERUI64VNVPROC)gladLazyResolve("glGetIntegerui64vNV");
+	glad_glGetIntegerui64vNV(value, result);
+}
+
+static void APIENTRY lazy_glUniformui64NV(GLint location, GLuint64EXT value) {
+	glad_glUniformui64NV = (PFNGLUNIFORMUI64NVPROC)gladLazyResolve("glUniformui64NV");
+	glad_glUniformui64NV(location, value);
+}
+
+static void APIENTRY lazy_glUniformui64vNV(GLint location, GLsizei count, const GLuint64EXT *value) {
+	glad_glUniformui64vNV = (PFNGLUNIFORMUI64VNVPROC)gladLazyResolve("glUniformui64vNV");
+	glad_glUniformui64vNV(location, count, value);
+}
+
+static void APIENTRY lazy_glProgramUniformui64NV(GLuint program, GLint location, GLuint64EXT value) {
+	glad_glProgramUniformui64NV = (PFNGLPROGRAMUNIFORMUI64NVPROC)gladLazyResolve("glProgramUniformui64NV");
+	glad_glProgramUniformui64NV(program, location, value);
+}
+
+static void APIENTRY lazy_glProgramUniformui64vNV(GLuint program, GLint location, GLsizei count, const GLuint64EXT *value) {
+	glad_glProgramUniformui64vNV = (PFNGLPROGRAMUNIFORMUI64VNVPROC)gladLazyResolve("glProgramUniformui64vNV");
+	glad_glProgramUniformui64vNV(program, location, count, value);
+}
+
+static void APIENTRY lazy_glBindShadingRateImageNV(GLuint texture) {
+	glad_glBindShadingRateImageNV = (PFNGLBINDSHADINGRATEIMAGENVPROC)gladLazyResolve("glBindShadingRateImageNV");
+	glad_glBindShadingRateImageNV(texture);
+}
+
+static void APIENTRY lazy_glGetShadingRateImagePaletteNV(GLuint viewport, GLuint entry, GLenum *rate) {
+	glad_glGetShadingRateImagePaletteNV = (PFNGLGETSHADINGRATEIMAGEPALETTENVPROC)gladLazyResolve("glGetShadingRateImagePaletteNV");
+	glad_glGetShadingRateImagePaletteNV(viewport, entry, rate);
+}
+
+static void APIENTRY lazy_glGetShadingRateSampleLocationivNV(GLenum rate, GLuint samples, GLuint index, GLint *location) {
+	glad_glGetShadingRateSampleLocationivNV = (PFNGLGETSHADINGRATESAMPLELOCATIONIVNVPROC)gladLazyResolve("glGetShadingRateSampleLocationivNV");
+	glad_glGetShadingRateSampleLocationivNV(rate, samples, index, location);
+}
+
+static void APIENTRY lazy_glShadingRateImageBarrierNV(GLboolean synchronize) {
+	glad_glShadingRateImageBarrierNV = (PFNGLSHADINGRATEIMAGEBARRIERNVPROC)gladLazyResolve("glShadingRateImageBarrierNV");
+	glad_glShadingRateImageBarrierNV(synchronize);
+}
+
+static void APIENTRY lazy_glShadingRateImagePaletteNV(GLuint viewport, GLuint first, GLsizei count, const GLenum *rates) {
+	glad_glShadingRateImagePaletteNV = (PFNGLSHADINGRATEIMAGEPALETTENVPROC)gladLazyResolve("glShadingRateImagePaletteNV");
+	glad_glShadingRateImagePaletteNV(viewport, first, count, rates);
+}
+
+static void APIENTRY lazy_glShadingRateSampleOrderNV(GLenum order) {
+	glad_glShadingRateSampleOrderNV = (PFNGLSHADINGRATESAMPLEORDERNVPROC)gladLazyResolve("glShadingRateSampleOrderNV");
+	glad_glShadingRateSampleOrderNV(order);
+}
+
+static void APIENTRY lazy_glShadingRateSampleOrderCustomNV(GLenum rate, GLuint samples, const GLint *locations) {
+	glad_glShadingRateSampleOrderCustomNV = (PFNGLSHADINGRATESAMPLEORDERCUSTOMNVPROC)gladLazyResolve("glShadingRateSampleOrderCustomNV");
+	glad_glShadingRateSampleOrderCustomNV(rate, samples, locations);
+}
+
+static void APIENTRY lazy_glTextureBarrierNV(void) {
+	glad_glTextureBarrierNV = (PFNGLTEXTUREBARRIERNVPROC)gladLazyResolve("glTextureBarrierNV");
+	glad_glTextureBarrierNV();
+}
+
+static void APIENTRY lazy_glTexImage2DMultisampleCoverageNV(GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations) {
+	glad_glTexImage2DMultisampleCoverageNV = (PFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC)gladLazyResolve("glTexImage2DMultisampleCoverageNV");
+	glad_glTexImage2DMultisampleCoverageNV(target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations);
+}
+
+static void APIENTRY lazy_glTexImage3DMultisampleCoverageNV(GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations) {
+	glad_glTexImage3DMultisampleCoverageNV = (PFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC)gladLazyResolve("glTexImage3DMultisampleCoverageNV");
+	glad_glTexImage3DMultisampleCoverageNV(target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations);
+}
+
+static void APIENTRY lazy_glTextureImage2DMultisampleNV(GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations) {
+	glad_glTextureImage2DMultisampleNV = (PFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC)gladLazyResolve("glTextureImage2DMultisampleNV");
+	glad_glTextureImage2DMultisampleNV(texture, target, samples, internalFormat, width, height, fixedSampleLocations);
+}
+
+static void APIENTRY lazy_glTextureImage3DMultisampleNV(GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations) {
+	glad_glTextureImage3DMultisampleNV = (PFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC)gladLazyResolve("glTextureImage3DMultisampleNV");
+	glad_glTextureImage3DMultisampleNV(texture, target, samples, internalFormat, width, height, depth, fixedSampleLocations);
+}
+
+static void APIENTRY lazy_glTextureImage2DMultisampleCoverageNV(GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations) {
+	glad_glTextureImage2DMultisampleCoverageNV = (PFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC)gladLazyResolve("glTextureImage2DMultisampleCoverageNV");
+	glad_glTextureImage2DMultisampleCoverageNV(texture, target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations);
+}
+
+static void APIENTRY lazy_glTextureImage3DMultisampleCoverageNV(GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations) {
+	glad_glTextureImage3DMultisampleCoverageNV = (PFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC)gladLazyResolve("glTextureImage3DMultisampleCoverageNV");
+	glad_glTextureImage3DMultisampleCoverageNV(texture, target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations);
+}
+
+static void APIENTRY lazy_glCreateSemaphoresNV(GLsizei n, GLuint *semaphores) {
+	glad_glCreateSemaphoresNV = (PFNGLCREATESEMAPHORESNVPROC)gladLazyResolve("glCreateSemaphoresNV");
+	glad_glCreateSemaphoresNV(n, semaphores);
+}
+
+static void APIENTRY lazy_glSemaphoreParameterivNV(GLuint semaphore, GLenum pname, const GLint *params) {
+	glad_glSemaphoreParameterivNV = (PFNGLSEMAPHOREPARAMETERIVNVPROC)gladLazyResolve("glSemaphoreParameterivNV");
+	glad_glSemaphoreParameterivNV(semaphore, pname, params);
+}
+
+static void APIENTRY lazy_glGetSemaphoreParameterivNV(GLuint semaphore, GLenum pname, GLint *params) {
+	glad_glGetSemaphoreParameterivNV = (PFNGLGETSEMAPHOREPARAMETERIVNVPROC)gladLazyResolve("glGetSemaphoreParameterivNV");
+	glad_glGetSemaphoreParameterivNV(semaphore, pname, params);
+}
+
+static void APIENTRY lazy_glBeginTransformFeedbackNV(GLenum primitiveMode) {
+	glad_glBeginTransformFeedbackNV = (PFNGLBEGINTRANSFORMFEEDBACKNVPROC)gladLazyResolve("glBeginTransformFeedbackNV");
+	glad_glBeginTransformFeedbackNV(primitiveMode);
+}
+
+static void APIENTRY lazy_glEndTransformFeedbackNV(void) {
+	glad_glEndTransformFeedbackNV = (PFNGLENDTRANSFORMFEEDBACKNVPROC)gladLazyResolve("glEndTransformFeedbackNV");
+	glad_glEndTransformFeedbackNV();
+}
+
+static void APIENTRY lazy_glTransformFeedbackAttribsNV(GLsizei count, const GLint *attribs, GLenum bufferMode) {
+	glad_glTransformFeedbackAttribsNV = (PFNGLTRANSFORMFEEDBACKATTRIBSNVPROC)gladLazyResolve("glTransformFeedbackAttribsNV");
+	glad_glTransformFeedbackAttribsNV(count, attribs, bufferMode);
+}
+
+static void APIENTRY lazy_glBindBufferRangeNV(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glBindBufferRangeNV = (PFNGLBINDBUFFERRANGENVPROC)gladLazyResolve("glBindBufferRangeNV");
+	glad_glBindBufferRangeNV(target, index, buffer, offset, size);
+}
+
+static void APIENTRY lazy_glBindBufferOffsetNV(GLenum target, GLuint index, GLuint buffer, GLintptr offset) {
+	glad_glBindBufferOffsetNV = (PFNGLBINDBUFFEROFFSETNVPROC)gladLazyResolve("glBindBufferOffsetNV");
+	glad_glBindBufferOffsetNV(target, index, buffer, offset);
+}
+
+static void APIENTRY lazy_glBindBufferBaseNV(GLenum target, GLuint index, GLuint buffer) {
+	glad_glBindBufferBaseNV = (PFNGLBINDBUFFERBASENVPROC)gladLazyResolve("glBindBufferBaseNV");
+	glad_glBindBufferBaseNV(target, index, buffer);
+}
+
+static void APIENTRY lazy_glTransformFeedbackVaryingsNV(GLuint program, GLsizei count, const GLint *locations, GLenum bufferMode) {
+	glad_glTransformFeedbackVaryingsNV = (PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC)gladLazyResolve("glTransformFeedbackVaryingsNV");
+	glad_glTransformFeedbackVaryingsNV(program, count, locations, bufferMode);
+}
+
+static void APIENTRY lazy_glActiveVaryingNV(GLuint program, const GLchar *name) {
+	glad_glActiveVaryingNV = (PFNGLACTIVEVARYINGNVPROC)gladLazyResolve("glActiveVaryingNV");
+	glad_glActiveVaryingNV(program, name);
+}
+
+static GLint APIENTRY lazy_glGetVaryingLocationNV(GLuint program, const GLchar *name) {
+	glad_glGetVaryingLocationNV = (PFNGLGETVARYINGLOCATIONNVPROC)gladLazyResolve("glGetVaryingLocationNV");
+	return glad_glGetVaryingLocationNV(program, name);
+}
+
+static void APIENTRY lazy_glGetActiveVaryingNV(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveVaryingNV = (PFNGLGETACTIVEVARYINGNVPROC)gladLazyResolve("glGetActiveVaryingNV");
+	glad_glGetActiveVaryingNV(program, index, bufSize, length, size, type, name);
+}
+
+static void APIENTRY lazy_glGetTransformFeedbackVaryingNV(GLuint program, GLuint index, GLint *location) {
+	glad_glGetTransformFeedbackVaryingNV = (PFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC)gladLazyResolve("glGetTransformFeedbackVaryingNV");
+	glad_glGetTransformFeedbackVaryingNV(program, index, location);
+}
+
+static void APIENTRY lazy_glTransformFeedbackStreamAttribsNV(GLsizei count, const GLint *attribs, GLsizei nbuffers, const GLint *bufstreams, GLenum bufferMode) {
+	glad_glTransformFeedbackStreamAttribsNV = (PFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC)gladLazyResolve("glTransformFeedbackStreamAttribsNV");
+	glad_glTransformFeedbackStreamAttribsNV(count, attribs, nbuffers, bufstreams, bufferMode);
+}
+
+static void APIENTRY lazy_glBindTransformFeedbackNV(GLenum target, GLuint id) {
+	glad_glBindTransformFeedbackNV = (PFNGLBINDTRANSFORMFEEDBACKNVPROC)gladLazyResolve("glBindTransformFeedbackNV");
+	glad_glBindTransformFeedbackNV(target, id);
+}
+
+static void APIENTRY lazy_glDeleteTransformFeedbacksNV(GLsizei n, const GLuint *ids) {
+	glad_glDeleteTransformFeedbacksNV = (PFNGLDELETETRANSFORMFEEDBACKSNVPROC)gladLazyResolve("glDeleteTransformFeedbacksNV");
+	glad_glDeleteTransformFeedbacksNV(n, ids);
+}
+
+static void APIENTRY lazy_glGenTransformFeedbacksNV(GLsizei n, GLuint *ids) {
+	glad_glGenTransformFeedbacksNV = (PFNGLGENTRANSFORMFEEDBACKSNVPROC)gladLazyResolve("glGenTransformFeedbacksNV");
+	glad_glGenTransformFeedbacksNV(n, ids);
+}
+
+static GLboolean APIENTRY lazy_glIsTransformFeedbackNV(GLuint id) {
+	glad_glIsTransformFeedbackNV = (PFNGLISTRANSFORMFEEDBACKNVPROC)gladLazyResolve("glIsTransformFeedbackNV");
+	return glad_glIsTransformFeedbackNV(id);
+}
+
+static void APIENTRY lazy_glPauseTransformFeedbackNV(void) {
+	glad_glPauseTransformFeedbackNV = (PFNGLPAUSETRANSFORMFEEDBACKNVPROC)gladLazyResolve("glPauseTransformFeedbackNV");
+	glad_glPauseTransformFeedbackNV();
+}
+
+static void APIENTRY lazy_glResumeTransformFeedbackNV(void) {
+	glad_glResumeTransformFeedbackNV = (PFNGLRESUMETRANSFORMFEEDBACKNVPROC)gladLazyResolve("glResumeTransformFeedbackNV");
+	glad_glResumeTransformFeedbackNV();
+}
+
+static void APIENTRY lazy_glDrawTransformFeedbackNV(GLenum mode, GLuint id) {
+	glad_glDrawTransformFeedbackNV = (PFNGLDRAWTRANSFORMFEEDBACKNVPROC)gladLazyResolve("glDrawTransformFeedbackNV");
+	glad_glDrawTransformFeedbackNV(mode, id);
+}
+
+static void APIENTRY lazy_glVDPAUInitNV(const void *vdpDevice, const void *getProcAddress) {
+	glad_glVDPAUInitNV = (PFNGLVDPAUINITNVPROC)gladLazyResolve("glVDPAUInitNV");
+	glad_glVDPAUInitNV(vdpDevice, getProcAddress);
+}
+
+static void APIENTRY lazy_glVDPAUFiniNV(void) {
+	glad_glVDPAUFiniNV = (PFNGLVDPAUFININVPROC)gladLazyResolve("glVDPAUFiniNV");
+	glad_glVDPAUFiniNV();
+}
+
+static GLvdpauSurfaceNV APIENTRY lazy_glVDPAURegisterVideoSurfaceNV(const void *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames) {
+	glad_glVDPAURegisterVideoSurfaceNV = (PFNGLVDPAUREGISTERVIDEOSURFACENVPROC)gladLazyResolve("glVDPAURegisterVideoSurfaceNV");
+	return glad_glVDPAURegisterVideoSurfaceNV(vdpSurface, target, numTextureNames, textureNames);
+}
+
+static GLvdpauSurfaceNV APIENTRY lazy_glVDPAURegisterOutputSurfaceNV(const void *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames) {
+	glad_glVDPAURegisterOutputSurfaceNV = (PFNGLVDPAUREGISTEROUTPUTSURFACENVPROC)gladLazyResolve("glVDPAURegisterOutputSurfaceNV");
+	return glad_glVDPAURegisterOutputSurfaceNV(vdpSurface, target, numTextureNames, textureNames);
+}
+
+static GLboolean APIENTRY lazy_glVDPAUIsSurfaceNV(GLvdpauSurfaceNV surface) {
+	glad_glVDPAUIsSurfaceNV = (PFNGLVDPAUISSURFACENVPROC)gladLazyResolve("glVDPAUIsSurfaceNV");
+	return glad_glVDPAUIsSurfaceNV(surface);
+}
+
+static void APIENTRY lazy_glVDPAUUnregisterSurfaceNV(GLvdpauSurfaceNV surface) {
+	glad_glVDPAUUnregisterSurfaceNV = (PFNGLVDPAUUNREGISTERSURFACENVPROC)gladLazyResolve("glVDPAUUnregisterSurfaceNV");
+	glad_glVDPAUUnregisterSurfaceNV(surface);
+}
+
+static void APIENTRY lazy_glVDPAUGetSurfaceivNV(GLvdpauSurfaceNV surface, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	glad_glVDPAUGetSurfaceivNV = (PFNGLVDPAUGETSURFACEIVNVPROC)gladLazyResolve("glVDPAUGetSurfaceivNV");
+	glad_glVDPAUGetSurfaceivNV(surface, pname, count, length, values);
+}
+
+static void APIENTRY lazy_glVDPAUSurfaceAccessNV(GLvdpauSurfaceNV surface, GLenum access) {
+	glad_glVDPAUSurfaceAccessNV = (PFNGLVDPAUSURFACEACCESSNVPROC)gladLazyResolve("glVDPAUSurfaceAccessNV");
+	glad_glVDPAUSurfaceAccessNV(surface, access);
+}
+
+static void APIENTRY lazy_glVDPAUMapSurfacesNV(GLsizei numSurfaces, const GLvdpauSurfaceNV *surfaces) {
+	glad_glVDPAUMapSurfacesNV = (PFNGLVDPAUMAPSURFACESNVPROC)gladLazyResolve("glVDPAUMapSurfacesNV");
+	glad_glVDPAUMapSurfacesNV(numSurfaces, surfaces);
+}
+
+static void APIENTRY lazy_glVDPAUUnmapSurfacesNV(GLsizei numSurface, const GLvdpauSurfaceNV *surfaces) {
+	glad_glVDPAUUnmapSurfacesNV = (PFNGLVDPAUUNMAPSURFACESNVPROC)gladLazyResolve("glVDPAUUnmapSurfacesNV");
+	glad_glVDPAUUnmapSurfacesNV(numSurface, surfaces);
+}
+
+static GLvdpauSurfaceNV APIENTRY lazy_glVDPAURegisterVideoSurfaceWithPictureStructureNV(const void *vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames, GLboolean isFrameStructure) {
+	glad_glVDPAURegisterVideoSurfaceWithPictureStructureNV = (PFNGLVDPAUREGISTERVIDEOSURFACEWITHPICTURESTRUCTURENVPROC)gladLazyResolve("glVDPAURegisterVideoSurfaceWithPictureStructureNV");
+	return glad_glVDPAURegisterVideoSurfaceWithPictureStructureNV(vdpSurface, target, numTextureNames, textureNames, isFrameStructure);
+}
+
+static void APIENTRY lazy_glFlushVertexArrayRangeNV(void) {
+	glad_glFlushVertexArrayRangeNV = (PFNGLFLUSHVERTEXARRAYRANGENVPROC)gladLazyResolve("glFlushVertexArrayRangeNV");
+	glad_glFlushVertexArrayRangeNV();
+}
+
+static void APIENTRY lazy_glVertexArrayRangeNV(GLsizei length, const void *pointer) {
+	glad_glVertexArrayRangeNV = (PFNGLVERTEXARRAYRANGENVPROC)gladLazyResolve("glVertexArrayRangeNV");
+	glad_glVertexArrayRangeNV(length, pointer);
+}
+
+static void APIENTRY lazy_glVertexAttribL1i64NV(GLuint index, GLint64EXT x) {
+	glad_glVertexAttribL1i64NV = (PFNGLVERTEXATTRIBL1I64NVPROC)gladLazyResolve("glVertexAttribL1i64NV");
+	glad_glVertexAttribL1i64NV(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttribL2i64NV(GLuint index, GLint64EXT x, GLint64EXT y) {
+	glad_glVertexAttribL2i64NV = (PFNGLVERTEXATTRIBL2I64NVPROC)gladLazyResolve("glVertexAttribL2i64NV");
+	glad_glVertexAttribL2i64NV(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttribL3i64NV(GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z) {
+	glad_glVertexAttribL3i64NV = (PFNGLVERTEXATTRIBL3I64NVPROC)gladLazyResolve("glVertexAttribL3i64NV");
+	glad_glVertexAttribL3i64NV(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttribL4i64NV(GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w) {
+	glad_glVertexAttribL4i64NV = (PFNGLVERTEXATTRIBL4I64NVPROC)gladLazyResolve("glVertexAttribL4i64NV");
+	glad_glVertexAttribL4i64NV(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttribL1i64vNV(GLuint index, const GLint64EXT *v) {
+	glad_glVertexAttribL1i64vNV = (PFNGLVERTEXATTRIBL1I64VNVPROC)gladLazyResolve("glVertexAttribL1i64vNV");
+	glad_glVertexAttribL1i64vNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribL2i64vNV(GLuint index, const GLint64EXT *v) {
+	glad_glVertexAttribL2i64vNV = (PFNGLVERTEXATTRIBL2I64VNVPROC)gladLazyResolve("glVertexAttribL2i64vNV");
+	glad_glVertexAttribL2i64vNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribL3i64vNV(GLuint index, const GLint64EXT *v) {
+	glad_glVertexAttribL3i64vNV = (PFNGLVERTEXATTRIBL3I64VNVPROC)gladLazyResolve("glVertexAttribL3i64vNV");
+	glad_glVertexAttribL3i64vNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribL4i64vNV(GLuint index, const GLint64EXT *v) {
+	glad_glVertexAttribL4i64vNV = (PFNGLVERTEXATTRIBL4I64VNVPROC)gladLazyResolve("glVertexAttribL4i64vNV");
+	glad_glVertexAttribL4i64vNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribL1ui64NV(GLuint index, GLuint64EXT x) {
+	glad_glVertexAttribL1ui64NV = (PFNGLVERTEXATTRIBL1UI64NVPROC)gladLazyResolve("glVertexAttribL1ui64NV");
+	glad_glVertexAttribL1ui64NV(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttribL2ui64NV(GLuint index, GLuint64EXT x, GLuint64EXT y) {
+	glad_glVertexAttribL2ui64NV = (PFNGLVERTEXATTRIBL2UI64NVPROC)gladLazyResolve("glVertexAttribL2ui64NV");
+	glad_glVertexAttribL2ui64NV(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttribL3ui64NV(GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z) {
+	glad_glVertexAttribL3ui64NV = (PFNGLVERTEXATTRIBL3UI64NVPROC)gladLazyResolve("glVertexAttribL3ui64NV");
+	glad_glVertexAttribL3ui64NV(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttribL4ui64NV(GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w) {
+	glad_glVertexAttribL4ui64NV = (PFNGLVERTEXATTRIBL4UI64NVPROC)gladLazyResolve("glVertexAttribL4ui64NV");
+	glad_glVertexAttribL4ui64NV(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttribL1ui64vNV(GLuint index, const GLuint64EXT *v) {
+	glad_glVertexAttribL1ui64vNV = (PFNGLVERTEXATTRIBL1UI64VNVPROC)gladLazyResolve("glVertexAttribL1ui64vNV");
+	glad_glVertexAttribL1ui64vNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribL2ui64vNV(GLuint index, const GLuint64EXT *v) {
+	glad_glVertexAttribL2ui64vNV = (PFNGLVERTEXATTRIBL2UI64VNVPROC)gladLazyResolve("glVertexAttribL2ui64vNV");
+	glad_glVertexAttribL2ui64vNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribL3ui64vNV(GLuint index, const GLuint64EXT *v) {
+	glad_glVertexAttribL3ui64vNV = (PFNGLVERTEXATTRIBL3UI64VNVPROC)gladLazyResolve("glVertexAttribL3ui64vNV");
+	glad_glVertexAttribL3ui64vNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribL4ui64vNV(GLuint index, const GLuint64EXT *v) {
+	glad_glVertexAttribL4ui64vNV = (PFNGLVERTEXATTRIBL4UI64VNVPROC)gladLazyResolve("glVertexAttribL4ui64vNV");
+	glad_glVertexAttribL4ui64vNV(index, v);
+}
+
+static void APIENTRY lazy_glGetVertexAttribLi64vNV(GLuint index, GLenum pname, GLint64EXT *params) {
+	glad_glGetVertexAttribLi64vNV = (PFNGLGETVERTEXATTRIBLI64VNVPROC)gladLazyResolve("glGetVertexAttribLi64vNV");
+	glad_glGetVertexAttribLi64vNV(index, pname, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribLui64vNV(GLuint index, GLenum pname, GLuint64EXT *params) {
+	glad_glGetVertexAttribLui64vNV = (PFNGLGETVERTEXATTRIBLUI64VNVPROC)gladLazyResolve("glGetVertexAttribLui64vNV");
+	glad_glGetVertexAttribLui64vNV(index, pname, params);
+}
+
+static void APIENTRY lazy_glVertexAttribLFormatNV(GLuint index, GLint size, GLenum type, GLsizei stride) {
+	glad_glVertexAttribLFormatNV = (PFNGLVERTEXATTRIBLFORMATNVPROC)gladLazyResolve("glVertexAttribLFormatNV");
+	glad_glVertexAttribLFormatNV(index, size, type, stride);
+}
+
+static void APIENTRY lazy_glBufferAddressRangeNV(GLenum pname, GLuint index, GLuint64EXT address, GLsizeiptr length) {
+	glad_glBufferAddressRangeNV = (PFNGLBUFFERADDRESSRANGENVPROC)gladLazyResolve("glBufferAddressRangeNV");
+	glad_glBufferAddressRangeNV(pname, index, address, length);
+}
+
+static void APIENTRY lazy_glVertexFormatNV(GLint size, GLenum type, GLsizei stride) {
+	glad_glVertexFormatNV = (PFNGLVERTEXFORMATNVPROC)gladLazyResolve("glVertexFormatNV");
+	glad_glVertexFormatNV(size, type, stride);
+}
+
+static void APIENTRY lazy_glNormalFormatNV(GLenum type, GLsizei stride) {
+	glad_glNormalFormatNV = (PFNGLNORMALFORMATNVPROC)gladLazyResolve("glNormalFormatNV");
+	glad_glNormalFormatNV(type, stride);
+}
+
+static void APIENTRY lazy_glColorFormatNV(GLint size, GLenum type, GLsizei stride) {
+	glad_glColorFormatNV = (PFNGLCOLORFORMATNVPROC)gladLazyResolve("glColorFormatNV");
+	glad_glColorFormatNV(size, type, stride);
+}
+
+static void APIENTRY lazy_glIndexFormatNV(GLenum type, GLsizei stride) {
+	glad_glIndexFormatNV = (PFNGLINDEXFORMATNVPROC)gladLazyResolve("glIndexFormatNV");
+	glad_glIndexFormatNV(type, stride);
+}
+
+static void APIENTRY lazy_glTexCoordFormatNV(GLint size, GLenum type, GLsizei stride) {
+	glad_glTexCoordFormatNV = (PFNGLTEXCOORDFORMATNVPROC)gladLazyResolve("glTexCoordFormatNV");
+	glad_glTexCoordFormatNV(size, type, stride);
+}
+
+static void APIENTRY lazy_glEdgeFlagFormatNV(GLsizei stride) {
+	glad_glEdgeFlagFormatNV = (PFNGLEDGEFLAGFORMATNVPROC)gladLazyResolve("glEdgeFlagFormatNV");
+	glad_glEdgeFlagFormatNV(stride);
+}
+
+static void APIENTRY lazy_glSecondaryColorFormatNV(GLint size, GLenum type, GLsizei stride) {
+	glad_glSecondaryColorFormatNV = (PFNGLSECONDARYCOLORFORMATNVPROC)gladLazyResolve("glSecondaryColorFormatNV");
+	glad_glSecondaryColorFormatNV(size, type, stride);
+}
+
+static void APIENTRY lazy_glFogCoordFormatNV(GLenum type, GLsizei stride) {
+	glad_glFogCoordFormatNV = (PFNGLFOGCOORDFORMATNVPROC)gladLazyResolve("glFogCoordFormatNV");
+	glad_glFogCoordFormatNV(type, stride);
+}
+
+static void APIENTRY lazy_glVertexAttribFormatNV(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride) {
+	glad_glVertexAttribFormatNV = (PFNGLVERTEXATTRIBFORMATNVPROC)gladLazyResolve("glVertexAttribFormatNV");
+	glad_glVertexAttribFormatNV(index, size, type, normalized, stride);
+}
+
+static void APIENTRY lazy_glVertexAttribIFormatNV(GLuint index, GLint size, GLenum type, GLsizei stride) {
+	glad_glVertexAttribIFormatNV = (PFNGLVERTEXATTRIBIFORMATNVPROC)gladLazyResolve("glVertexAttribIFormatNV");
+	glad_glVertexAttribIFormatNV(index, size, type, stride);
+}
+
+static void APIENTRY lazy_glGetIntegerui64i_vNV(GLenum value, GLuint index, GLuint64EXT *result) {
+	glad_glGetIntegerui64i_vNV = (PFNGLGETINTEGERUI64I_VNVPROC)gladLazyResolve("glGetIntegerui64i_vNV");
+	glad_glGetIntegerui64i_vNV(value, index, result);
+}
+
+static GLboolean APIENTRY lazy_glAreProgramsResidentNV(GLsizei n, const GLuint *programs, GLboolean *residences) {
+	glad_glAreProgramsResidentNV = (PFNGLAREPROGRAMSRESIDENTNVPROC)gladLazyResolve("glAreProgramsResidentNV");
+	return glad_glAreProgramsResidentNV(n, programs, residences);
+}
+
+static void APIENTRY lazy_glBindProgramNV(GLenum target, GLuint id) {
+	glad_glBindProgramNV = (PFNGLBINDPROGRAMNVPROC)gladLazyResolve("glBindProgramNV");
+	glad_glBindProgramNV(target, id);
+}
+
+static void APIENTRY lazy_glDeleteProgramsNV(GLsizei n, const GLuint *programs) {
+	glad_glDeleteProgramsNV = (PFNGLDELETEPROGRAMSNVPROC)gladLazyResolve("glDeleteProgramsNV");
+	glad_glDeleteProgramsNV(n, programs);
+}
+
+static void APIENTRY lazy_glExecuteProgramNV(GLenum target, GLuint id, const GLfloat *params) {
+	glad_glExecuteProgramNV = (PFNGLEXECUTEPROGRAMNVPROC)gladLazyResolve("glExecuteProgramNV");
+	glad_glExecuteProgramNV(target, id, params);
+}
+
+static void APIENTRY lazy_glGenProgramsNV(GLsizei n, GLuint *programs) {
+	glad_glGenProgramsNV = (PFNGLGENPROGRAMSNVPROC)gladLazyResolve("glGenProgramsNV");
+	glad_glGenProgramsNV(n, programs);
+}
+
+static void APIENTRY lazy_glGetProgramParameterdvNV(GLenum target, GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetProgramParameterdvNV = (PFNGLGETPROGRAMPARAMETERDVNVPROC)gladLazyResolve("glGetProgramParameterdvNV");
+	glad_glGetProgramParameterdvNV(target, index, pname, params);
+}
+
+static void APIENTRY lazy_glGetProgramParameterfvNV(GLenum target, GLuint index, GLenum pname, GLfloat *params) {
+	glad_glGetProgramParameterfvNV = (PFNGLGETPROGRAMPARAMETERFVNVPROC)gladLazyResolve("glGetProgramParameterfvNV");
+	glad_glGetProgramParameterfvNV(target, index, pname, params);
+}
+
+static void APIENTRY lazy_glGetProgramivNV(GLuint id, GLenum pname, GLint *params) {
+	glad_glGetProgramivNV = (PFNGLGETPROGRAMIVNVPROC)gladLazyResolve("glGetProgramivNV");
+	glad_glGetProgramivNV(id, pname, params);
+}
+
+static void APIENTRY lazy_glGetProgramStringNV(GLuint id, GLenum pname, GLubyte *program) {
+	glad_glGetProgramStringNV = (PFNGLGETPROGRAMSTRINGNVPROC)gladLazyResolve("glGetProgramStringNV");
+	glad_glGetProgramStringNV(id, pname, program);
+}
+
+static void APIENTRY lazy_glGetTrackMatrixivNV(GLenum target, GLuint address, GLenum pname, GLint *params) {
+	glad_glGetTrackMatrixivNV = (PFNGLGETTRACKMATRIXIVNVPROC)gladLazyResolve("glGetTrackMatrixivNV");
+	glad_glGetTrackMatrixivNV(target, address, pname, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribdvNV(GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetVertexAttribdvNV = (PFNGLGETVERTEXATTRIBDVNVPROC)gladLazyResolve("glGetVertexAttribdvNV");
+	glad_glGetVertexAttribdvNV(index, pname, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribfvNV(GLuint index, GLenum pname, GLfloat *params) {
+	glad_glGetVertexAttribfvNV = (PFNGLGETVERTEXATTRIBFVNVPROC)gladLazyResolve("glGetVertexAttribfvNV");
+	glad_glGetVertexAttribfvNV(index, pname, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribivNV(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribivNV = (PFNGLGETVERTEXATTRIBIVNVPROC)gladLazyResolve("glGetVertexAttribivNV");
+	glad_glGetVertexAttribivNV(index, pname, params);
+}
+
+static void APIENTRY lazy_glGetVertexAttribPointervNV(GLuint index, GLenum pname, void **pointer) {
+	glad_glGetVertexAttribPointervNV = (PFNGLGETVERTEXATTRIBPOINTERVNVPROC)gladLazyResolve("glGetVertexAttribPointervNV");
+	glad_glGetVertexAttribPointervNV(index, pname, pointer);
+}
+
+static GLboolean APIENTRY lazy_glIsProgramNV(GLuint id) {
+	glad_glIsProgramNV = (PFNGLISPROGRAMNVPROC)gladLazyResolve("glIsProgramNV");
+	return glad_glIsProgramNV(id);
+}
+
+static void APIENTRY lazy_glLoadProgramNV(GLenum target, GLuint id, GLsizei len, const GLubyte *program) {
+	glad_glLoadProgramNV = (PFNGLLOADPROGRAMNVPROC)gladLazyResolve("glLoadProgramNV");
+	glad_glLoadProgramNV(target, id, len, program);
+}
+
+static void APIENTRY lazy_glProgramParameter4dNV(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glProgramParameter4dNV = (PFNGLPROGRAMPARAMETER4DNVPROC)gladLazyResolve("glProgramParameter4dNV");
+	glad_glProgramParameter4dNV(target, index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramParameter4dvNV(GLenum target, GLuint index, const GLdouble *v) {
+	glad_glProgramParameter4dvNV = (PFNGLPROGRAMPARAMETER4DVNVPROC)gladLazyResolve("glProgramParameter4dvNV");
+	glad_glProgramParameter4dvNV(target, index, v);
+}
+
+static void APIENTRY lazy_glProgramParameter4fNV(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glProgramParameter4fNV = (PFNGLPROGRAMPARAMETER4FNVPROC)gladLazyResolve("glProgramParameter4fNV");
+	glad_glProgramParameter4fNV(target, index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glProgramParameter4fvNV(GLenum target, GLuint index, const GLfloat *v) {
+	glad_glProgramParameter4fvNV = (PFNGLPROGRAMPARAMETER4FVNVPROC)gladLazyResolve("glProgramParameter4fvNV");
+	glad_glProgramParameter4fvNV(target, index, v);
+}
+
+static void APIENTRY lazy_glProgramParameters4dvNV(GLenum target, GLuint index, GLsizei count, const GLdouble *v) {
+	glad_glProgramParameters4dvNV = (PFNGLPROGRAMPARAMETERS4DVNVPROC)gladLazyResolve("glProgramParameters4dvNV");
+	glad_glProgramParameters4dvNV(target, index, count, v);
+}
+
+static void APIENTRY lazy_glProgramParameters4fvNV(GLenum target, GLuint index, GLsizei count, const GLfloat *v) {
+	glad_glProgramParameters4fvNV = (PFNGLPROGRAMPARAMETERS4FVNVPROC)gladLazyResolve("glProgramParameters4fvNV");
+	glad_glProgramParameters4fvNV(target, index, count, v);
+}
+
+static void APIENTRY lazy_glRequestResidentProgramsNV(GLsizei n, const GLuint *programs) {
+	glad_glRequestResidentProgramsNV = (PFNGLREQUESTRESIDENTPROGRAMSNVPROC)gladLazyResolve("glRequestResidentProgramsNV");
+	glad_glRequestResidentProgramsNV(n, programs);
+}
+
+static void APIENTRY lazy_glTrackMatrixNV(GLenum target, GLuint address, GLenum matrix, GLenum transform) {
+	glad_glTrackMatrixNV = (PFNGLTRACKMATRIXNVPROC)gladLazyResolve("glTrackMatrixNV");
+	glad_glTrackMatrixNV(target, address, matrix, transform);
+}
+
+static void APIENTRY lazy_glVertexAttribPointerNV(GLuint index, GLint fsize, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribPointerNV = (PFNGLVERTEXATTRIBPOINTERNVPROC)gladLazyResolve("glVertexAttribPointerNV");
+	glad_glVertexAttribPointerNV(index, fsize, type, stride, pointer);
+}
+
+static void APIENTRY lazy_glVertexAttrib1dNV(GLuint index, GLdouble x) {
+	glad_glVertexAttrib1dNV = (PFNGLVERTEXATTRIB1DNVPROC)gladLazyResolve("glVertexAttrib1dNV");
+	glad_glVertexAttrib1dNV(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttrib1dvNV(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib1dvNV = (PFNGLVERTEXATTRIB1DVNVPROC)gladLazyResolve("glVertexAttrib1dvNV");
+	glad_glVertexAttrib1dvNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib1fNV(GLuint index, GLfloat x) {
+	glad_glVertexAttrib1fNV = (PFNGLVERTEXATTRIB1FNVPROC)gladLazyResolve("glVertexAttrib1fNV");
+	glad_glVertexAttrib1fNV(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttrib1fvNV(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib1fvNV = (PFNGLVERTEXATTRIB1FVNVPROC)gladLazyResolve("glVertexAttrib1fvNV");
+	glad_glVertexAttrib1fvNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib1sNV(GLuint index, GLshort x) {
+	glad_glVertexAttrib1sNV = (PFNGLVERTEXATTRIB1SNVPROC)gladLazyResolve("glVertexAttrib1sNV");
+	glad_glVertexAttrib1sNV(index, x);
+}
+
+static void APIENTRY lazy_glVertexAttrib1svNV(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib1svNV = (PFNGLVERTEXATTRIB1SVNVPROC)gladLazyResolve("glVertexAttrib1svNV");
+	glad_glVertexAttrib1svNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib2dNV(GLuint index, GLdouble x, GLdouble y) {
+	glad_glVertexAttrib2dNV = (PFNGLVERTEXATTRIB2DNVPROC)gladLazyResolve("glVertexAttrib2dNV");
+	glad_glVertexAttrib2dNV(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttrib2dvNV(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib2dvNV = (PFNGLVERTEXATTRIB2DVNVPROC)gladLazyResolve("glVertexAttrib2dvNV");
+	glad_glVertexAttrib2dvNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib2fNV(GLuint index, GLfloat x, GLfloat y) {
+	glad_glVertexAttrib2fNV = (PFNGLVERTEXATTRIB2FNVPROC)gladLazyResolve("glVertexAttrib2fNV");
+	glad_glVertexAttrib2fNV(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttrib2fvNV(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib2fvNV = (PFNGLVERTEXATTRIB2FVNVPROC)gladLazyResolve("glVertexAttrib2fvNV");
+	glad_glVertexAttrib2fvNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib2sNV(GLuint index, GLshort x, GLshort y) {
+	glad_glVertexAttrib2sNV = (PFNGLVERTEXATTRIB2SNVPROC)gladLazyResolve("glVertexAttrib2sNV");
+	glad_glVertexAttrib2sNV(index, x, y);
+}
+
+static void APIENTRY lazy_glVertexAttrib2svNV(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib2svNV = (PFNGLVERTEXATTRIB2SVNVPROC)gladLazyResolve("glVertexAttrib2svNV");
+	glad_glVertexAttrib2svNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib3dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexAttrib3dNV = (PFNGLVERTEXATTRIB3DNVPROC)gladLazyResolve("glVertexAttrib3dNV");
+	glad_glVertexAttrib3dNV(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttrib3dvNV(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib3dvNV = (PFNGLVERTEXATTRIB3DVNVPROC)gladLazyResolve("glVertexAttrib3dvNV");
+	glad_glVertexAttrib3dvNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib3fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertexAttrib3fNV = (PFNGLVERTEXATTRIB3FNVPROC)gladLazyResolve("glVertexAttrib3fNV");
+	glad_glVertexAttrib3fNV(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttrib3fvNV(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib3fvNV = (PFNGLVERTEXATTRIB3FVNVPROC)gladLazyResolve("glVertexAttrib3fvNV");
+	glad_glVertexAttrib3fvNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib3sNV(GLuint index, GLshort x, GLshort y, GLshort z) {
+	glad_glVertexAttrib3sNV = (PFNGLVERTEXATTRIB3SNVPROC)gladLazyResolve("glVertexAttrib3sNV");
+	glad_glVertexAttrib3sNV(index, x, y, z);
+}
+
+static void APIENTRY lazy_glVertexAttrib3svNV(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib3svNV = (PFNGLVERTEXATTRIB3SVNVPROC)gladLazyResolve("glVertexAttrib3svNV");
+	glad_glVertexAttrib3svNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexAttrib4dNV = (PFNGLVERTEXATTRIB4DNVPROC)gladLazyResolve("glVertexAttrib4dNV");
+	glad_glVertexAttrib4dNV(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttrib4dvNV(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib4dvNV = (PFNGLVERTEXATTRIB4DVNVPROC)gladLazyResolve("glVertexAttrib4dvNV");
+	glad_glVertexAttrib4dvNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertexAttrib4fNV = (PFNGLVERTEXATTRIB4FNVPROC)gladLazyResolve("glVertexAttrib4fNV");
+	glad_glVertexAttrib4fNV(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttrib4fvNV(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib4fvNV = (PFNGLVERTEXATTRIB4FVNVPROC)gladLazyResolve("glVertexAttrib4fvNV");
+	glad_glVertexAttrib4fvNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4sNV(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertexAttrib4sNV = (PFNGLVERTEXATTRIB4SNVPROC)gladLazyResolve("glVertexAttrib4sNV");
+	glad_glVertexAttrib4sNV(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttrib4svNV(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4svNV = (PFNGLVERTEXATTRIB4SVNVPROC)gladLazyResolve("glVertexAttrib4svNV");
+	glad_glVertexAttrib4svNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttrib4ubNV(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	glad_glVertexAttrib4ubNV = (PFNGLVERTEXATTRIB4UBNVPROC)gladLazyResolve("glVertexAttrib4ubNV");
+	glad_glVertexAttrib4ubNV(index, x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertexAttrib4ubvNV(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4ubvNV = (PFNGLVERTEXATTRIB4UBVNVPROC)gladLazyResolve("glVertexAttrib4ubvNV");
+	glad_glVertexAttrib4ubvNV(index, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs1dvNV(GLuint index, GLsizei count, const GLdouble *v) {
+	glad_glVertexAttribs1dvNV = (PFNGLVERTEXATTRIBS1DVNVPROC)gladLazyResolve("glVertexAttribs1dvNV");
+	glad_glVertexAttribs1dvNV(index, count, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs1fvNV(GLuint index, GLsizei count, const GLfloat *v) {
+	glad_glVertexAttribs1fvNV = (PFNGLVERTEXATTRIBS1FVNVPROC)gladLazyResolve("glVertexAttribs1fvNV");
+	glad_glVertexAttribs1fvNV(index, count, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs1svNV(GLuint index, GLsizei count, const GLshort *v) {
+	glad_glVertexAttribs1svNV = (PFNGLVERTEXATTRIBS1SVNVPROC)gladLazyResolve("glVertexAttribs1svNV");
+	glad_glVertexAttribs1svNV(index, count, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs2dvNV(GLuint index, GLsizei count, const GLdouble *v) {
+	glad_glVertexAttribs2dvNV = (PFNGLVERTEXATTRIBS2DVNVPROC)gladLazyResolve("glVertexAttribs2dvNV");
+	glad_glVertexAttribs2dvNV(index, count, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs2fvNV(GLuint index, GLsizei count, const GLfloat *v) {
+	glad_glVertexAttribs2fvNV = (PFNGLVERTEXATTRIBS2FVNVPROC)gladLazyResolve("glVertexAttribs2fvNV");
+	glad_glVertexAttribs2fvNV(index, count, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs2svNV(GLuint index, GLsizei count, const GLshort *v) {
+	glad_glVertexAttribs2svNV = (PFNGLVERTEXATTRIBS2SVNVPROC)gladLazyResolve("glVertexAttribs2svNV");
+	glad_glVertexAttribs2svNV(index, count, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs3dvNV(GLuint index, GLsizei count, const GLdouble *v) {
+	glad_glVertexAttribs3dvNV = (PFNGLVERTEXATTRIBS3DVNVPROC)gladLazyResolve("glVertexAttribs3dvNV");
+	glad_glVertexAttribs3dvNV(index, count, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs3fvNV(GLuint index, GLsizei count, const GLfloat *v) {
+	glad_glVertexAttribs3fvNV = (PFNGLVERTEXATTRIBS3FVNVPROC)gladLazyResolve("glVertexAttribs3fvNV");
+	glad_glVertexAttribs3fvNV(index, count, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs3svNV(GLuint index, GLsizei count, const GLshort *v) {
+	glad_glVertexAttribs3svNV = (PFNGLVERTEXATTRIBS3SVNVPROC)gladLazyResolve("glVertexAttribs3svNV");
+	glad_glVertexAttribs3svNV(index, count, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs4dvNV(GLuint index, GLsizei count, const GLdouble *v) {
+	glad_glVertexAttribs4dvNV = (PFNGLVERTEXATTRIBS4DVNVPROC)gladLazyResolve("glVertexAttribs4dvNV");
+	glad_glVertexAttribs4dvNV(index, count, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs4fvNV(GLuint index, GLsizei count, const GLfloat *v) {
+	glad_glVertexAttribs4fvNV = (PFNGLVERTEXATTRIBS4FVNVPROC)gladLazyResolve("glVertexAttribs4fvNV");
+	glad_glVertexAttribs4fvNV(index, count, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs4svNV(GLuint index, GLsizei count, const GLshort *v) {
+	glad_glVertexAttribs4svNV = (PFNGLVERTEXATTRIBS4SVNVPROC)gladLazyResolve("glVertexAttribs4svNV");
+	glad_glVertexAttribs4svNV(index, count, v);
+}
+
+static void APIENTRY lazy_glVertexAttribs4ubvNV(GLuint index, GLsizei count, const GLubyte *v) {
+	glad_glVertexAttribs4ubvNV = (PFNGLVERTEXATTRIBS4UBVNVPROC)gladLazyResolve("glVertexAttribs4ubvNV");
+	glad_glVertexAttribs4ubvNV(index, count, v);
+}
+
+static void APIENTRY lazy_glBeginVideoCaptureNV(GLuint video_capture_slot) {
+	glad_glBeginVideoCaptureNV = (PFNGLBEGINVIDEOCAPTURENVPROC)gladLazyResolve("glBeginVideoCaptureNV");
+	glad_glBeginVideoCaptureNV(video_capture_slot);
+}
+
+static void APIENTRY lazy_glBindVideoCaptureStreamBufferNV(GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLintptrARB offset) {
+	glad_glBindVideoCaptureStreamBufferNV = (PFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC)gladLazyResolve("glBindVideoCaptureStreamBufferNV");
+	glad_glBindVideoCaptureStreamBufferNV(video_capture_slot, stream, frame_region, offset);
+}
+
+static void APIENTRY lazy_glBindVideoCaptureStreamTextureNV(GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLenum target, GLuint texture) {
+	glad_glBindVideoCaptureStreamTextureNV = (PFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC)gladLazyResolve("glBindVideoCaptureStreamTextureNV");
+	glad_glBindVideoCaptureStreamTextureNV(video_capture_slot, stream, frame_region, target, texture);
+}
+
+static void APIENTRY lazy_glEndVideoCaptureNV(GLuint video_capture_slot) {
+	glad_glEndVideoCaptureNV = (PFNGLENDVIDEOCAPTURENVPROC)gladLazyResolve("glEndVideoCaptureNV");
+	glad_glEndVideoCaptureNV(video_capture_slot);
+}
+
+static void APIENTRY lazy_glGetVideoCaptureivNV(GLuint video_capture_slot, GLenum pname, GLint *params) {
+	glad_glGetVideoCaptureivNV = (PFNGLGETVIDEOCAPTUREIVNVPROC)gladLazyResolve("glGetVideoCaptureivNV");
+	glad_glGetVideoCaptureivNV(video_capture_slot, pname, params);
+}
+
+static void APIENTRY lazy_glGetVideoCaptureStreamivNV(GLuint video_capture_slot, GLuint stream, GLenum pname, GLint *params) {
+	glad_glGetVideoCaptureStreamivNV = (PFNGLGETVIDEOCAPTURESTREAMIVNVPROC)gladLazyResolve("glGetVideoCaptureStreamivNV");
+	glad_glGetVideoCaptureStreamivNV(video_capture_slot, stream, pname, params);
+}
+
+static void APIENTRY lazy_glGetVideoCaptureStreamfvNV(GLuint video_capture_slot, GLuint stream, GLenum pname, GLfloat *params) {
+	glad_glGetVideoCaptureStreamfvNV = (PFNGLGETVIDEOCAPTURESTREAMFVNVPROC)gladLazyResolve("glGetVideoCaptureStreamfvNV");
+	glad_glGetVideoCaptureStreamfvNV(video_capture_slot, stream, pname, params);
+}
+
+static void APIENTRY lazy_glGetVideoCaptureStreamdvNV(GLuint video_capture_slot, GLuint stream, GLenum pname, GLdouble *params) {
+	glad_glGetVideoCaptureStreamdvNV = (PFNGLGETVIDEOCAPTURESTREAMDVNVPROC)gladLazyResolve("glGetVideoCaptureStreamdvNV");
+	glad_glGetVideoCaptureStreamdvNV(video_capture_slot, stream, pname, params);
+}
+
+static GLenum APIENTRY lazy_glVideoCaptureNV(GLuint video_capture_slot, GLuint *sequence_num, GLuint64EXT *capture_time) {
+	glad_glVideoCaptureNV = (PFNGLVIDEOCAPTURENVPROC)gladLazyResolve("glVideoCaptureNV");
+	return glad_glVideoCaptureNV(video_capture_slot, sequence_num, capture_time);
+}
+
+static void APIENTRY lazy_glVideoCaptureStreamParameterivNV(GLuint video_capture_slot, GLuint stream, GLenum pname, const GLint *params) {
+	glad_glVideoCaptureStreamParameterivNV = (PFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC)gladLazyResolve("glVideoCaptureStreamParameterivNV");
+	glad_glVideoCaptureStreamParameterivNV(video_capture_slot, stream, pname, params);
+}
+
+static void APIENTRY lazy_glVideoCaptureStreamParameterfvNV(GLuint video_capture_slot, GLuint stream, GLenum pname, const GLfloat *params) {
+	glad_glVideoCaptureStreamParameterfvNV = (PFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC)gladLazyResolve("glVideoCaptureStreamParameterfvNV");
+	glad_glVideoCaptureStreamParameterfvNV(video_capture_slot, stream, pname, params);
+}
+
+static void APIENTRY lazy_glVideoCaptureStreamParameterdvNV(GLuint video_capture_slot, GLuint stream, GLenum pname, const GLdouble *params) {
+	glad_glVideoCaptureStreamParameterdvNV = (PFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC)gladLazyResolve("glVideoCaptureStreamParameterdvNV");
+	glad_glVideoCaptureStreamParameterdvNV(video_capture_slot, stream, pname, params);
+}
+
+static void APIENTRY lazy_glViewportSwizzleNV(GLuint index, GLenum swizzlex, GLenum swizzley, GLenum swizzlez, GLenum swizzlew) {
+	glad_glViewportSwizzleNV = (PFNGLVIEWPORTSWIZZLENVPROC)gladLazyResolve("glViewportSwizzleNV");
+	glad_glViewportSwizzleNV(index, swizzlex, swizzley, swizzlez, swizzlew);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1bOES(GLenum texture, GLbyte s) {
+	glad_glMultiTexCoord1bOES = (PFNGLMULTITEXCOORD1BOESPROC)gladLazyResolve("glMultiTexCoord1bOES");
+	glad_glMultiTexCoord1bOES(texture, s);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1bvOES(GLenum texture, const GLbyte *coords) {
+	glad_glMultiTexCoord1bvOES = (PFNGLMULTITEXCOORD1BVOESPROC)gladLazyResolve("glMultiTexCoord1bvOES");
+	glad_glMultiTexCoord1bvOES(texture, coords);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2bOES(GLenum texture, GLbyte s, GLbyte t) {
+	glad_glMultiTexCoord2bOES = (PFNGLMULTITEXCOORD2BOESPROC)gladLazyResolve("glMultiTexCoord2bOES");
+	glad_glMultiTexCoord2bOES(texture, s, t);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2bvOES(GLenum texture, const GLbyte *coords) {
+	glad_glMultiTexCoord2bvOES = (PFNGLMULTITEXCOORD2BVOESPROC)gladLazyResolve("glMultiTexCoord2bvOES");
+	glad_glMultiTexCoord2bvOES(texture, coords);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3bOES(GLenum texture, GLbyte s, GLbyte t, GLbyte r) {
+	glad_glMultiTexCoord3bOES = (PFNGLMULTITEXCOORD3BOESPROC)gladLazyResolve("glMultiTexCoord3bOES");
+	glad_glMultiTexCoord3bOES(texture, s, t, r);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3bvOES(GLenum texture, const GLbyte *coords) {
+	glad_glMultiTexCoord3bvOES = (PFNGLMULTITEXCOORD3BVOESPROC)gladLazyResolve("glMultiTexCoord3bvOES");
+	glad_glMultiTexCoord3bvOES(texture, coords);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4bOES(GLenum texture, GLbyte s, GLbyte t, GLbyte r, GLbyte q) {
+	glad_glMultiTexCoord4bOES = (PFNGLMULTITEXCOORD4BOESPROC)gladLazyResolve("glMultiTexCoord4bOES");
+	glad_glMultiTexCoord4bOES(texture, s, t, r, q);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4bvOES(GLenum texture, const GLbyte *coords) {
+	glad_glMultiTexCoord4bvOES = (PFNGLMULTITEXCOORD4BVOESPROC)gladLazyResolve("glMultiTexCoord4bvOES");
+	glad_glMultiTexCoord4bvOES(texture, coords);
+}
+
+static void APIENTRY lazy_glTexCoord1bOES(GLbyte s) {
+	glad_glTexCoord1bOES = (PFNGLTEXCOORD1BOESPROC)gladLazyResolve("glTexCoord1bOES");
+	glad_glTexCoord1bOES(s);
+}
+
+static void APIENTRY lazy_glTexCoord1bvOES(const GLbyte *coords) {
+	glad_glTexCoord1bvOES = (PFNGLTEXCOORD1BVOESPROC)gladLazyResolve("glTexCoord1bvOES");
+	glad_glTexCoord1bvOES(coords);
+}
+
+static void APIENTRY lazy_glTexCoord2bOES(GLbyte s, GLbyte t) {
+	glad_glTexCoord2bOES = (PFNGLTEXCOORD2BOESPROC)gladLazyResolve("glTexCoord2bOES");
+	glad_glTexCoord2bOES(s, t);
+}
+
+static void APIENTRY lazy_glTexCoord2bvOES(const GLbyte *coords) {
+	glad_glTexCoord2bvOES = (PFNGLTEXCOORD2BVOESPROC)gladLazyResolve("glTexCoord2bvOES");
+	glad_glTexCoord2bvOES(coords);
+}
+
+static void APIENTRY lazy_glTexCoord3bOES(GLbyte s, GLbyte t, GLbyte r) {
+	glad_glTexCoord3bOES = (PFNGLTEXCOORD3BOESPROC)gladLazyResolve("glTexCoord3bOES");
+	glad_glTexCoord3bOES(s, t, r);
+}
+
+static void APIENTRY lazy_glTexCoord3bvOES(const GLbyte *coords) {
+	glad_glTexCoord3bvOES = (PFNGLTEXCOORD3BVOESPROC)gladLazyResolve("glTexCoord3bvOES");
+	glad_glTexCoord3bvOES(coords);
+}
+
+static void APIENTRY lazy_glTexCoord4bOES(GLbyte s, GLbyte t, GLbyte r, GLbyte q) {
+	glad_glTexCoord4bOES = (PFNGLTEXCOORD4BOESPROC)gladLazyResolve("glTexCoord4bOES");
+	glad_glTexCoord4bOES(s, t, r, q);
+}
+
+static void APIENTRY lazy_glTexCoord4bvOES(const GLbyte *coords) {
+	glad_glTexCoord4bvOES = (PFNGLTEXCOORD4BVOESPROC)gladLazyResolve("glTexCoord4bvOES");
+	glad_glTexCoord4bvOES(coords);
+}
+
+static void APIENTRY lazy_glVertex2bOES(GLbyte x, GLbyte y) {
+	glad_glVertex2bOES = (PFNGLVERTEX2BOESPROC)gladLazyResolve("glVertex2bOES");
+	glad_glVertex2bOES(x, y);
+}
+
+static void APIENTRY lazy_glVertex2bvOES(const GLbyte *coords) {
+	glad_glVertex2bvOES = (PFNGLVERTEX2BVOESPROC)gladLazyResolve("glVertex2bvOES");
+	glad_glVertex2bvOES(coords);
+}
+
+static void APIENTRY lazy_glVertex3bOES(GLbyte x, GLbyte y, GLbyte z) {
+	glad_glVertex3bOES = (PFNGLVERTEX3BOESPROC)gladLazyResolve("glVertex3bOES");
+	glad_glVertex3bOES(x, y, z);
+}
+
+static void APIENTRY lazy_glVertex3bvOES(const GLbyte *coords) {
+	glad_glVertex3bvOES = (PFNGLVERTEX3BVOESPROC)gladLazyResolve("glVertex3bvOES");
+	glad_glVertex3bvOES(coords);
+}
+
+static void APIENTRY lazy_glVertex4bOES(GLbyte x, GLbyte y, GLbyte z, GLbyte w) {
+	glad_glVertex4bOES = (PFNGLVERTEX4BOESPROC)gladLazyResolve("glVertex4bOES");
+	glad_glVertex4bOES(x, y, z, w);
+}
+
+static void APIENTRY lazy_glVertex4bvOES(const GLbyte *coords) {
+	glad_glVertex4bvOES = (PFNGLVERTEX4BVOESPROC)gladLazyResolve("glVertex4bvOES");
+	glad_glVertex4bvOES(coords);
+}
+
+static void APIENTRY lazy_glAlphaFuncxOES(GLenum func, GLfixed ref) {
+	glad_glAlphaFuncxOES = (PFNGLALPHAFUNCXOESPROC)gladLazyResolve("glAlphaFuncxOES");
+	glad_glAlphaFuncxOES(func, ref);
+}
+
+static void APIENTRY lazy_glClearColorxOES(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha) {
+	glad_glClearColorxOES = (PFNGLCLEARCOLORXOESPROC)gladLazyResolve("glClearColorxOES");
+	glad_glClearColorxOES(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glClearDepthxOES(GLfixed depth) {
+	glad_glClearDepthxOES = (PFNGLCLEARDEPTHXOESPROC)gladLazyResolve("glClearDepthxOES");
+	glad_glClearDepthxOES(depth);
+}
+
+static void APIENTRY lazy_glClipPlanexOES(GLenum plane, const GLfixed *equation) {
+	glad_glClipPlanexOES = (PFNGLCLIPPLANEXOESPROC)gladLazyResolve("glClipPlanexOES");
+	glad_glClipPlanexOES(plane, equation);
+}
+
+static void APIENTRY lazy_glColor4xOES(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha) {
+	glad_glColor4xOES = (PFNGLCOLOR4XOESPROC)gladLazyResolve("glColor4xOES");
+	glad_glColor4xOES(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glDepthRangexOES(GLfixed n, GLfixed f) {
+	glad_glDepthRangexOES = (PFNGLDEPTHRANGEXOESPROC)gladLazyResolve("glDepthRangexOES");
+	glad_glDepthRangexOES(n, f);
+}
+
+static void APIENTRY lazy_glFogxOES(GLenum pname, GLfixed param) {
+	glad_glFogxOES = (PFNGLFOGXOESPROC)gladLazyResolve("glFogxOES");
+	glad_glFogxOES(pname, param);
+}
+
+static void APIENTRY lazy_glFogxvOES(GLenum pname, const GLfixed *param) {
+	glad_glFogxvOES = (PFNGLFOGXVOESPROC)gladLazyResolve("glFogxvOES");
+	glad_glFogxvOES(pname, param);
+}
+
+static void APIENTRY lazy_glFrustumxOES(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f) {
+	glad_glFrustumxOES = (PFNGLFRUSTUMXOESPROC)gladLazyResolve("glFrustumxOES");
+	glad_glFrustumxOES(l, r, b, t, n, f);
+}
+
+static void APIENTRY lazy_glGetClipPlanexOES(GLenum plane, GLfixed *equation) {
+	glad_glGetClipPlanexOES = (PFNGLGETCLIPPLANEXOESPROC)gladLazyResolve("glGetClipPlanexOES");
+	glad_glGetClipPlanexOES(plane, equation);
+}
+
+static void APIENTRY lazy_glGetFixedvOES(GLenum pname, GLfixed *params) {
+	glad_glGetFixedvOES = (PFNGLGETFIXEDVOESPROC)gladLazyResolve("glGetFixedvOES");
+	glad_glGetFixedvOES(pname, params);
+}
+
+static void APIENTRY lazy_glGetTexEnvxvOES(GLenum target, GLenum pname, GLfixed *params) {
+	glad_glGetTexEnvxvOES = (PFNGLGETTEXENVXVOESPROC)gladLazyResolve("glGetTexEnvxvOES");
+	glad_glGetTexEnvxvOES(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetTexParameterxvOES(GLenum target, GLenum pname, GLfixed *params) {
+	glad_glGetTexParameterxvOES = (PFNGLGETTEXPARAMETERXVOESPROC)gladLazyResolve("glGetTexParameterxvOES");
+	glad_glGetTexParameterxvOES(target, pname, params);
+}
+
+static void APIENTRY lazy_glLightModelxOES(GLenum pname, GLfixed param) {
+	glad_glLightModelxOES = (PFNGLLIGHTMODELXOESPROC)gladLazyResolve("glLightModelxOES");
+	glad_glLightModelxOES(pname, param);
+}
+
+static void APIENTRY lazy_glLightModelxvOES(GLenum pname, const GLfixed *param) {
+	glad_glLightModelxvOES = (PFNGLLIGHTMODELXVOESPROC)gladLazyResolve("glLightModelxvOES");
+	glad_glLightModelxvOES(pname, param);
+}
+
+static void APIENTRY lazy_glLightxOES(GLenum light, GLenum pname, GLfixed param) {
+	glad_glLightxOES = (PFNGLLIGHTXOESPROC)gladLazyResolve("glLightxOES");
+	glad_glLightxOES(light, pname, param);
+}
+
+static void APIENTRY lazy_glLightxvOES(GLenum light, GLenum pname, const GLfixed *params) {
+	glad_glLightxvOES = (PFNGLLIGHTXVOESPROC)gladLazyResolve("glLightxvOES");
+	glad_glLightxvOES(light, pname, params);
+}
+
+static void APIENTRY lazy_glLineWidthxOES(GLfixed width) {
+	glad_glLineWidthxOES = (PFNGLLINEWIDTHXOESPROC)gladLazyResolve("glLineWidthxOES");
+	glad_glLineWidthxOES(width);
+}
+
+static void APIENTRY lazy_glLoadMatrixxOES(const GLfixed *m) {
+	glad_glLoadMatrixxOES = (PFNGLLOADMATRIXXOESPROC)gladLazyResolve("glLoadMatrixxOES");
+	glad_glLoadMatrixxOES(m);
+}
+
+static void APIENTRY lazy_glMaterialxOES(GLenum face, GLenum pname, GLfixed param) {
+	glad_glMaterialxOES = (PFNGLMATERIALXOESPROC)gladLazyResolve("glMaterialxOES");
+	glad_glMaterialxOES(face, pname, param);
+}
+
+static void APIENTRY lazy_glMaterialxvOES(GLenum face, GLenum pname, const GLfixed *param) {
+	glad_glMaterialxvOES = (PFNGLMATERIALXVOESPROC)gladLazyResolve("glMaterialxvOES");
+	glad_glMaterialxvOES(face, pname, param);
+}
+
+static void APIENTRY lazy_glMultMatrixxOES(const GLfixed *m) {
+	glad_glMultMatrixxOES = (PFNGLMULTMATRIXXOESPROC)gladLazyResolve("glMultMatrixxOES");
+	glad_glMultMatrixxOES(m);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4xOES(GLenum texture, GLfixed s, GLfixed t, GLfixed r, GLfixed q) {
+	glad_glMultiTexCoord4xOES = (PFNGLMULTITEXCOORD4XOESPROC)gladLazyResolve("glMultiTexCoord4xOES");
+	glad_glMultiTexCoord4xOES(texture, s, t, r, q);
+}
+
+static void APIENTRY lazy_glNormal3xOES(GLfixed nx, GLfixed ny, GLfixed nz) {
+	glad_glNormal3xOES = (PFNGLNORMAL3XOESPROC)gladLazyResolve("glNormal3xOES");
+	glad_glNormal3xOES(nx, ny, nz);
+}
+
+static void APIENTRY lazy_glOrthoxOES(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f) {
+	glad_glOrthoxOES = (PFNGLORTHOXOESPROC)gladLazyResolve("glOrthoxOES");
+	glad_glOrthoxOES(l, r, b, t, n, f);
+}
+
+static void APIENTRY lazy_glPointParameterxvOES(GLenum pname, const GLfixed *params) {
+	glad_glPointParameterxvOES = (PFNGLPOINTPARAMETERXVOESPROC)gladLazyResolve("glPointParameterxvOES");
+	glad_glPointParameterxvOES(pname, params);
+}
+
+static void APIENTRY lazy_glPointSizexOES(GLfixed size) {
+	glad_glPointSizexOES = (PFNGLPOINTSIZEXOESPROC)gladLazyResolve("glPointSizexOES");
+	glad_glPointSizexOES(size);
+}
+
+static void APIENTRY lazy_glPolygonOffsetxOES(GLfixed factor, GLfixed units) {
+	glad_glPolygonOffsetxOES = (PFNGLPOLYGONOFFSETXOESPROC)gladLazyResolve("glPolygonOffsetxOES");
+	glad_glPolygonOffsetxOES(factor, units);
+}
+
+static void APIENTRY lazy_glRotatexOES(GLfixed angle, GLfixed x, GLfixed y, GLfixed z) {
+	glad_glRotatexOES = (PFNGLROTATEXOESPROC)gladLazyResolve("glRotatexOES");
+	glad_glRotatexOES(angle, x, y, z);
+}
+
+static void APIENTRY lazy_glScalexOES(GLfixed x, GLfixed y, GLfixed z) {
+	glad_glScalexOES = (PFNGLSCALEXOESPROC)gladLazyResolve("glScalexOES");
+	glad_glScalexOES(x, y, z);
+}
+
+static void APIENTRY lazy_glTexEnvxOES(GLenum target, GLenum pname, GLfixed param) {
+	glad_glTexEnvxOES = (PFNGLTEXENVXOESPROC)gladLazyResolve("glTexEnvxOES");
+	glad_glTexEnvxOES(target, pname, param);
+}
+
+static void APIENTRY lazy_glTexEnvxvOES(GLenum target, GLenum pname, const GLfixed *params) {
+	glad_glTexEnvxvOES = (PFNGLTEXENVXVOESPROC)gladLazyResolve("glTexEnvxvOES");
+	glad_glTexEnvxvOES(target, pname, params);
+}
+
+static void APIENTRY lazy_glTexParameterxOES(GLenum target, GLenum pname, GLfixed param) {
+	glad_glTexParameterxOES = (PFNGLTEXPARAMETERXOESPROC)gladLazyResolve("glTexParameterxOES");
+	glad_glTexParameterxOES(target, pname, param);
+}
+
+static void APIENTRY lazy_glTexParameterxvOES(GLenum target, GLenum pname, const GLfixed *params) {
+	glad_glTexParameterxvOES = (PFNGLTEXPARAMETERXVOESPROC)gladLazyResolve("glTexParameterxvOES");
+	glad_glTexParameterxvOES(target, pname, params);
+}
+
+static void APIENTRY lazy_glTranslatexOES(GLfixed x, GLfixed y, GLfixed z) {
+	glad_glTranslatexOES = (PFNGLTRANSLATEXOESPROC)gladLazyResolve("glTranslatexOES");
+	glad_glTranslatexOES(x, y, z);
+}
+
+static void APIENTRY lazy_glGetLightxvOES(GLenum light, GLenum pname, GLfixed *params) {
+	glad_glGetLightxvOES = (PFNGLGETLIGHTXVOESPROC)gladLazyResolve("glGetLightxvOES");
+	glad_glGetLightxvOES(light, pname, params);
+}
+
+static void APIENTRY lazy_glGetMaterialxvOES(GLenum face, GLenum pname, GLfixed *params) {
+	glad_glGetMaterialxvOES = (PFNGLGETMATERIALXVOESPROC)gladLazyResolve("glGetMaterialxvOES");
+	glad_glGetMaterialxvOES(face, pname, params);
+}
+
+static void APIENTRY lazy_glPointParameterxOES(GLenum pname, GLfixed param) {
+	glad_glPointParameterxOES = (PFNGLPOINTPARAMETERXOESPROC)gladLazyResolve("glPointParameterxOES");
+	glad_glPointParameterxOES(pname, param);
+}
+
+static void APIENTRY lazy_glSampleCoveragexOES(GLclampx value, GLboolean invert) {
+	glad_glSampleCoveragexOES = (PFNGLSAMPLECOVERAGEXOESPROC)gladLazyResolve("glSampleCoveragexOES");
+	glad_glSampleCoveragexOES(value, invert);
+}
+
+static void APIENTRY lazy_glAccumxOES(GLenum op, GLfixed value) {
+	glad_glAccumxOES = (PFNGLACCUMXOESPROC)gladLazyResolve("glAccumxOES");
+	glad_glAccumxOES(op, value);
+}
+
+static void APIENTRY lazy_glBitmapxOES(GLsizei width, GLsizei height, GLfixed xorig, GLfixed yorig, GLfixed xmove, GLfixed ymove, const GLubyte *bitmap) {
+	glad_glBitmapxOES = (PFNGLBITMAPXOESPROC)gladLazyResolve("glBitmapxOES");
+	glad_glBitmapxOES(width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+
+static void APIENTRY lazy_glBlendColorxOES(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha) {
+	glad_glBlendColorxOES = (PFNGLBLENDCOLORXOESPROC)gladLazyResolve("glBlendColorxOES");
+	glad_glBlendColorxOES(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glClearAccumxOES(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha) {
+	glad_glClearAccumxOES = (PFNGLCLEARACCUMXOESPROC)gladLazyResolve("glClearAccumxOES");
+	glad_glClearAccumxOES(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glColor3xOES(GLfixed red, GLfixed green, GLfixed blue) {
+	glad_glColor3xOES = (PFNGLCOLOR3XOESPROC)gladLazyResolve("glColor3xOES");
+	glad_glColor3xOES(red, green, blue);
+}
+
+static void APIENTRY lazy_glColor3xvOES(const GLfixed *components) {
+	glad_glColor3xvOES = (PFNGLCOLOR3XVOESPROC)gladLazyResolve("glColor3xvOES");
+	glad_glColor3xvOES(components);
+}
+
+static void APIENTRY lazy_glColor4xvOES(const GLfixed *components) {
+	glad_glColor4xvOES = (PFNGLCOLOR4XVOESPROC)gladLazyResolve("glColor4xvOES");
+	glad_glColor4xvOES(components);
+}
+
+static void APIENTRY lazy_glConvolutionParameterxOES(GLenum target, GLenum pname, GLfixed param) {
+	glad_glConvolutionParameterxOES = (PFNGLCONVOLUTIONPARAMETERXOESPROC)gladLazyResolve("glConvolutionParameterxOES");
+	glad_glConvolutionParameterxOES(target, pname, param);
+}
+
+static void APIENTRY lazy_glConvolutionParameterxvOES(GLenum target, GLenum pname, const GLfixed *params) {
+	glad_glConvolutionParameterxvOES = (PFNGLCONVOLUTIONPARAMETERXVOESPROC)gladLazyResolve("glConvolutionParameterxvOES");
+	glad_glConvolutionParameterxvOES(target, pname, params);
+}
+
+static void APIENTRY lazy_glEvalCoord1xOES(GLfixed u) {
+	glad_glEvalCoord1xOES = (PFNGLEVALCOORD1XOESPROC)gladLazyResolve("glEvalCoord1xOES");
+	glad_glEvalCoord1xOES(u);
+}
+
+static void APIENTRY lazy_glEvalCoord1xvOES(const GLfixed *coords) {
+	glad_glEvalCoord1xvOES = (PFNGLEVALCOORD1XVOESPROC)gladLazyResolve("glEvalCoord1xvOES");
+	glad_glEvalCoord1xvOES(coords);
+}
+
+static void APIENTRY lazy_glEvalCoord2xOES(GLfixed u, GLfixed v) {
+	glad_glEvalCoord2xOES = (PFNGLEVALCOORD2XOESPROC)gladLazyResolve("glEvalCoord2xOES");
+	glad_glEvalCoord2xOES(u, v);
+}
+
+static void APIENTRY lazy_glEvalCoord2xvOES(const GLfixed *coords) {
+	glad_glEvalCoord2xvOES = (PFNGLEVALCOORD2XVOESPROC)gladLazyResolve("glEvalCoord2xvOES");
+	glad_glEvalCoord2xvOES(coords);
+}
+
+static void APIENTRY lazy_glFeedbackBufferxOES(GLsizei n, GLenum type, const GLfixed *buffer) {
+	glad_glFeedbackBufferxOES = (PFNGLFEEDBACKBUFFERXOESPROC)gladLazyResolve("glFeedbackBufferxOES");
+	glad_glFeedbackBufferxOES(n, type, buffer);
+}
+
+static void APIENTRY lazy_glGetConvolutionParameterxvOES(GLenum target, GLenum pname, GLfixed *params) {
+	glad_glGetConvolutionParameterxvOES = (PFNGLGETCONVOLUTIONPARAMETERXVOESPROC)gladLazyResolve("glGetConvolutionParameterxvOES");
+	glad_glGetConvolutionParameterxvOES(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetHistogramParameterxvOES(GLenum target, GLenum pname, GLfixed *params) {
+	glad_glGetHistogramParameterxvOES = (PFNGLGETHISTOGRAMPARAMETERXVOESPROC)gladLazyResolve("glGetHistogramParameterxvOES");
+	glad_glGetHistogramParameterxvOES(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetLightxOES(GLenum light, GLenum pname, GLfixed *params) {
+	glad_glGetLightxOES = (PFNGLGETLIGHTXOESPROC)gladLazyResolve("glGetLightxOES");
+	glad_glGetLightxOES(light, pname, params);
+}
+
+static void APIENTRY lazy_glGetMapxvOES(GLenum target, GLenum query, GLfixed *v) {
+	glad_glGetMapxvOES = (PFNGLGETMAPXVOESPROC)gladLazyResolve("glGetMapxvOES");
+	glad_glGetMapxvOES(target, query, v);
+}
+
+static void APIENTRY lazy_glGetMaterialxOES(GLenum face, GLenum pname, GLfixed param) {
+	glad_glGetMaterialxOES = (PFNGLGETMATERIALXOESPROC)gladLazyResolve("glGetMaterialxOES");
+	glad_glGetMaterialxOES(face, pname, param);
+}
+
+static void APIENTRY lazy_glGetPixelMapxv(GLenum map, GLint size, GLfixed *values) {
+	glad_glGetPixelMapxv = (PFNGLGETPIXELMAPXVPROC)gladLazyResolve("glGetPixelMapxv");
+	glad_glGetPixelMapxv(map, size, values);
+}
+
+static void APIENTRY lazy_glGetTexGenxvOES(GLenum coord, GLenum pname, GLfixed *params) {
+	glad_glGetTexGenxvOES = (PFNGLGETTEXGENXVOESPROC)gladLazyResolve("glGetTexGenxvOES");
+	glad_glGetTexGenxvOES(coord, pname, params);
+}
+
+static void APIENTRY lazy_glGetTexLevelParameterxvOES(GLenum target, GLint level, GLenum pname, GLfixed *params) {
+	glad_glGetTexLevelParameterxvOES = (PFNGLGETTEXLEVELPARAMETERXVOESPROC)gladLazyResolve("glGetTexLevelParameterxvOES");
+	glad_glGetTexLevelParameterxvOES(target, level, pname, params);
+}
+
+static void APIENTRY lazy_glIndexxOES(GLfixed component) {
+	glad_glIndexxOES = (PFNGLINDEXXOESPROC)gladLazyResolve("glIndexxOES");
+	glad_glIndexxOES(component);
+}
+
+static void APIENTRY lazy_glIndexxvOES(const GLfixed *component) {
+	glad_glIndexxvOES = (PFNGLINDEXXVOESPROC)gladLazyResolve("glIndexxvOES");
+	glad_glIndexxvOES(component);
+}
+
+static void APIENTRY lazy_glLoadTransposeMatrixxOES(const GLfixed *m) {
+	glad_glLoadTransposeMatrixxOES = (PFNGLLOADTRANSPOSEMATRIXXOESPROC)gladLazyResolve("glLoadTransposeMatrixxOES");
+	glad_glLoadTransposeMatrixxOES(m);
+}
+
+static void APIENTRY lazy_glMap1xOES(GLenum target, GLfixed u1, GLfixed u2, GLint stride, GLint order, GLfixed points) {
+	glad_glMap1xOES = (PFNGLMAP1XOESPROC)gladLazyResolve("glMap1xOES");
+	glad_glMap1xOES(target, u1, u2, stride, order, points);
+}
+
+static void APIENTRY lazy_glMap2xOES(GLenum target, GLfixed u1, GLfixed u2, GLint ustride, GLint uorder, GLfixed v1, GLfixed v2, GLint vstride, GLint vorder, GLfixed points) {
+	glad_glMap2xOES = (PFNGLMAP2XOESPROC)gladLazyResolve("glMap2xOES");
+	glad_glMap2xOES(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+static void APIENTRY lazy_glMapGrid1xOES(GLint n, GLfixed u1, GLfixed u2) {
+	glad_glMapGrid1xOES = (PFNGLMAPGRID1XOESPROC)gladLazyResolve("glMapGrid1xOES");
+	glad_glMapGrid1xOES(n, u1, u2);
+}
+
+static void APIENTRY lazy_glMapGrid2xOES(GLint n, GLfixed u1, GLfixed u2, GLfixed v1, GLfixed v2) {
+	glad_glMapGrid2xOES = (PFNGLMAPGRID2XOESPROC)gladLazyResolve("glMapGrid2xOES");
+	glad_glMapGrid2xOES(n, u1, u2, v1, v2);
+}
+
+static void APIENTRY lazy_glMultTransposeMatrixxOES(const GLfixed *m) {
+	glad_glMultTransposeMatrixxOES = (PFNGLMULTTRANSPOSEMATRIXXOESPROC)gladLazyResolve("glMultTransposeMatrixxOES");
+	glad_glMultTransposeMatrixxOES(m);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1xOES(GLenum texture, GLfixed s) {
+	glad_glMultiTexCoord1xOES = (PFNGLMULTITEXCOORD1XOESPROC)gladLazyResolve("glMultiTexCoord1xOES");
+	glad_glMultiTexCoord1xOES(texture, s);
+}
+
+static void APIENTRY lazy_glMultiTexCoord1xvOES(GLenum texture, const GLfixed *coords) {
+	glad_glMultiTexCoord1xvOES = (PFNGLMULTITEXCOORD1XVOESPROC)gladLazyResolve("glMultiTexCoord1xvOES");
+	glad_glMultiTexCoord1xvOES(texture, coords);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2xOES(GLenum texture, GLfixed s, GLfixed t) {
+	glad_glMultiTexCoord2xOES = (PFNGLMULTITEXCOORD2XOESPROC)gladLazyResolve("glMultiTexCoord2xOES");
+	glad_glMultiTexCoord2xOES(texture, s, t);
+}
+
+static void APIENTRY lazy_glMultiTexCoord2xvOES(GLenum texture, const GLfixed *coords) {
+	glad_glMultiTexCoord2xvOES = (PFNGLMULTITEXCOORD2XVOESPROC)gladLazyResolve("glMultiTexCoord2xvOES");
+	glad_glMultiTexCoord2xvOES(texture, coords);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3xOES(GLenum texture, GLfixed s, GLfixed t, GLfixed r) {
+	glad_glMultiTexCoord3xOES = (PFNGLMULTITEXCOORD3XOESPROC)gladLazyResolve("glMultiTexCoord3xOES");
+	glad_glMultiTexCoord3xOES(texture, s, t, r);
+}
+
+static void APIENTRY lazy_glMultiTexCoord3xvOES(GLenum texture, const GLfixed *coords) {
+	glad_glMultiTexCoord3xvOES = (PFNGLMULTITEXCOORD3XVOESPROC)gladLazyResolve("glMultiTexCoord3xvOES");
+	glad_glMultiTexCoord3xvOES(texture, coords);
+}
+
+static void APIENTRY lazy_glMultiTexCoord4xvOES(GLenum texture, const GLfixed *coords) {
+	glad_glMultiTexCoord4xvOES = (PFNGLMULTITEXCOORD4XVOESPROC)gladLazyResolve("glMultiTexCoord4xvOES");
+	glad_glMultiTexCoord4xvOES(texture, coords);
+}
+
+static void APIENTRY lazy_glNormal3xvOES(const GLfixed *coords) {
+	glad_glNormal3xvOES = (PFNGLNORMAL3XVOESPROC)gladLazyResolve("glNormal3xvOES");
+	glad_glNormal3xvOES(coords);
+}
+
+static void APIENTRY lazy_glPassThroughxOES(GLfixed token) {
+	glad_glPassThroughxOES = (PFNGLPASSTHROUGHXOESPROC)gladLazyResolve("glPassThroughxOES");
+	glad_glPassThroughxOES(token);
+}
+
+static void APIENTRY lazy_glPixelMapx(GLenum map, GLint size, const GLfixed *values) {
+	glad_glPixelMapx = (PFNGLPIXELMAPXPROC)gladLazyResolve("glPixelMapx");
+	glad_glPixelMapx(map, size, values);
+}
+
+static void APIENTRY lazy_glPixelStorex(GLenum pname, GLfixed param) {
+	glad_glPixelStorex = (PFNGLPIXELSTOREXPROC)gladLazyResolve("glPixelStorex");
+	glad_glPixelStorex(pname, param);
+}
+
+static void APIENTRY lazy_glPixelTransferxOES(GLenum pname, GLfixed param) {
+	glad_glPixelTransferxOES = (PFNGLPIXELTRANSFERXOESPROC)gladLazyResolve("glPixelTransferxOES");
+	glad_glPixelTransferxOES(pname, param);
+}
+
+static void APIENTRY lazy_glPixelZoomxOES(GLfixed xfactor, GLfixed yfactor) {
+	glad_glPixelZoomxOES = (PFNGLPIXELZOOMXOESPROC)gladLazyResolve("glPixelZoomxOES");
+	glad_glPixelZoomxOES(xfactor, yfactor);
+}
+
+static void APIENTRY lazy_glPrioritizeTexturesxOES(GLsizei n, const GLuint *textures, const GLfixed *priorities) {
+	glad_glPrioritizeTexturesxOES = (PFNGLPRIORITIZETEXTURESXOESPROC)gladLazyResolve("glPrioritizeTexturesxOES");
+	glad_glPrioritizeTexturesxOES(n, textures, priorities);
+}
+
+static void APIENTRY lazy_glRasterPos2xOES(GLfixed x, GLfixed y) {
+	glad_glRasterPos2xOES = (PFNGLRASTERPOS2XOESPROC)gladLazyResolve("glRasterPos2xOES");
+	glad_glRasterPos2xOES(x, y);
+}
+
+static void APIENTRY lazy_glRasterPos2xvOES(const GLfixed *coords) {
+	glad_glRasterPos2xvOES = (PFNGLRASTERPOS2XVOESPROC)gladLazyResolve("glRasterPos2xvOES");
+	glad_glRasterPos2xvOES(coords);
+}
+
+static void APIENTRY lazy_glRasterPos3xOES(GLfixed x, GLfixed y, GLfixed z) {
+	glad_glRasterPos3xOES = (PFNGLRASTERPOS3XOESPROC)gladLazyResolve("glRasterPos3xOES");
+	glad_glRasterPos3xOES(x, y, z);
+}
+
+static void APIENTRY lazy_glRasterPos3xvOES(const GLfixed *coords) {
+	glad_glRasterPos3xvOES = (PFNGLRASTERPOS3XVOESPROC)gladLazyResolve("glRasterPos3xvOES");
+	glad_glRasterPos3xvOES(coords);
+}
+
+static void APIENTRY lazy_glRasterPos4xOES(GLfixed x, GLfixed y, GLfixed z, GLfixed w) {
+	glad_glRasterPos4xOES = (PFNGLRASTERPOS4XOESPROC)gladLazyResolve("glRasterPos4xOES");
+	glad_glRasterPos4xOES(x, y, z, w);
+}
+
+static void APIENTRY lazy_glRasterPos4xvOES(const GLfixed *coords) {
+	glad_glRasterPos4xvOES = (PFNGLRASTERPOS4XVOESPROC)gladLazyResolve("glRasterPos4xvOES");
+	glad_glRasterPos4xvOES(coords);
+}
+
+static void APIENTRY lazy_glRectxOES(GLfixed x1, GLfixed y1, GLfixed x2, GLfixed y2) {
+	glad_glRectxOES = (PFNGLRECTXOESPROC)gladLazyResolve("glRectxOES");
+	glad_glRectxOES(x1, y1, x2, y2);
+}
+
+static void APIENTRY lazy_glRectxvOES(const GLfixed *v1, const GLfixed *v2) {
+	glad_glRectxvOES = (PFNGLRECTXVOESPROC)gladLazyResolve("glRectxvOES");
+	glad_glRectxvOES(v1, v2);
+}
+
+static void APIENTRY lazy_glTexCoord1xOES(GLfixed s) {
+	glad_glTexCoord1xOES = (PFNGLTEXCOORD1XOESPROC)gladLazyResolve("glTexCoord1xOES");
+	glad_glTexCoord1xOES(s);
+}
+
+static void APIENTRY lazy_glTexCoord1xvOES(const GLfixed *coords) {
+	glad_glTexCoord1xvOES = (PFNGLTEXCOORD1XVOESPROC)gladLazyResolve("glTexCoord1xvOES");
+	glad_glTexCoord1xvOES(coords);
+}
+
+static void APIENTRY lazy_glTexCoord2xOES(GLfixed s, GLfixed t) {
+	glad_glTexCoord2xOES = (PFNGLTEXCOORD2XOESPROC)gladLazyResolve("glTexCoord2xOES");
+	glad_glTexCoord2xOES(s, t);
+}
+
+static void APIENTRY lazy_glTexCoord2xvOES(const GLfixed *coords) {
+	glad_glTexCoord2xvOES = (PFNGLTEXCOORD2XVOESPROC)gladLazyResolve("glTexCoord2xvOES");
+	glad_glTexCoord2xvOES(coords);
+}
+
+static void APIENTRY lazy_glTexCoord3xOES(GLfixed s, GLfixed t, GLfixed r) {
+	glad_glTexCoord3xOES = (PFNGLTEXCOORD3XOESPROC)gladLazyResolve("glTexCoord3xOES");
+	glad_glTexCoord3xOES(s, t, r);
+}
+
+static void APIENTRY lazy_glTexCoord3xvOES(const GLfixed *coords) {
+	glad_glTexCoord3xvOES = (PFNGLTEXCOORD3XVOESPROC)gladLazyResolve("glTexCoord3xvOES");
+	glad_glTexCoord3xvOES(coords);
+}
+
+static void APIENTRY lazy_glTexCoord4xOES(GLfixed s, GLfixed t, GLfixed r, GLfixed q) {
+	glad_glTexCoord4xOES = (PFNGLTEXCOORD4XOESPROC)gladLazyResolve("glTexCoord4xOES");
+	glad_glTexCoord4xOES(s, t, r, q);
+}
+
+static void APIENTRY lazy_glTexCoord4xvOES(const GLfixed *coords) {
+	glad_glTexCoord4xvOES = (PFNGLTEXCOORD4XVOESPROC)gladLazyResolve("glTexCoord4xvOES");
+	glad_glTexCoord4xvOES(coords);
+}
+
+static void APIENTRY lazy_glTexGenxOES(GLenum coord, GLenum pname, GLfixed param) {
+	glad_glTexGenxOES = (PFNGLTEXGENXOESPROC)gladLazyResolve("glTexGenxOES");
+	glad_glTexGenxOES(coord, pname, param);
+}
+
+static void APIENTRY lazy_glTexGenxvOES(GLenum coord, GLenum pname, const GLfixed *params) {
+	glad_glTexGenxvOES = (PFNGLTEXGENXVOESPROC)gladLazyResolve("glTexGenxvOES");
+	glad_glTexGenxvOES(coord, pname, params);
+}
+
+static void APIENTRY lazy_glVertex2xOES(GLfixed x) {
+	glad_glVertex2xOES = (PFNGLVERTEX2XOESPROC)gladLazyResolve("glVertex2xOES");
+	glad_glVertex2xOES(x);
+}
+
+static void APIENTRY lazy_glVertex2xvOES(const GLfixed *coords) {
+	glad_glVertex2xvOES = (PFNGLVERTEX2XVOESPROC)gladLazyResolve("glVertex2xvOES");
+	glad_glVertex2xvOES(coords);
+}
+
+static void APIENTRY lazy_glVertex3xOES(GLfixed x, GLfixed y) {
+	glad_glVertex3xOES = (PFNGLVERTEX3XOESPROC)gladLazyResolve("glVertex3xOES");
+	glad_glVertex3xOES(x, y);
+}
+
+static void APIENTRY lazy_glVertex3xvOES(const GLfixed *coords) {
+	glad_glVertex3xvOES = (PFNGLVERTEX3XVOESPROC)gladLazyResolve("glVertex3xvOES");
+	glad_glVertex3xvOES(coords);
+}
+
+static void APIENTRY lazy_glVertex4xOES(GLfixed x, GLfixed y, GLfixed z) {
+	glad_glVertex4xOES = (PFNGLVERTEX4XOESPROC)gladLazyResolve("glVertex4xOES");
+	glad_glVertex4xOES(x, y, z);
+}
+
+static void APIENTRY lazy_glVertex4xvOES(const GLfixed *coords) {
+	glad_glVertex4xvOES = (PFNGLVERTEX4XVOESPROC)gladLazyResolve("glVertex4xvOES");
+	glad_glVertex4xvOES(coords);
+}
+
+static GLbitfield APIENTRY lazy_glQueryMatrixxOES(GLfixed *mantissa, GLint *exponent) {
+	glad_glQueryMatrixxOES = (PFNGLQUERYMATRIXXOESPROC)gladLazyResolve("glQueryMatrixxOES");
+	return glad_glQueryMatrixxOES(mantissa, exponent);
+}
+
+static void APIENTRY lazy_glClearDepthfOES(GLclampf depth) {
+	glad_glClearDepthfOES = (PFNGLCLEARDEPTHFOESPROC)gladLazyResolve("glClearDepthfOES");
+	glad_glClearDepthfOES(depth);
+}
+
+static void APIENTRY lazy_glClipPlanefOES(GLenum plane, const GLfloat *equation) {
+	glad_glClipPlanefOES = (PFNGLCLIPPLANEFOESPROC)gladLazyResolve("glClipPlanefOES");
+	glad_glClipPlanefOES(plane, equation);
+}
+
+static void APIENTRY lazy_glDepthRangefOES(GLclampf n, GLclampf f) {
+	glad_glDepthRangefOES = (PFNGLDEPTHRANGEFOESPROC)gladLazyResolve("glDepthRangefOES");
+	glad_glDepthRangefOES(n, f);
+}
+
+static void APIENTRY lazy_glFrustumfOES(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f) {
+	glad_glFrustumfOES = (PFNGLFRUSTUMFOESPROC)gladLazyResolve("glFrustumfOES");
+	glad_glFrustumfOES(l, r, b, t, n, f);
+}
+
+static void APIENTRY lazy_glGetClipPlanefOES(GLenum plane, GLfloat *equation) {
+	glad_glGetClipPlanefOES = (PFNGLGETCLIPPLANEFOESPROC)gladLazyResolve("glGetClipPlanefOES");
+	glad_glGetClipPlanefOES(plane, equation);
+}
+
+static void APIENTRY lazy_glOrthofOES(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f) {
+	glad_glOrthofOES = (PFNGLORTHOFOESPROC)gladLazyResolve("glOrthofOES");
+	glad_glOrthofOES(l, r, b, t, n, f);
+}
+
+static void APIENTRY lazy_glFramebufferTextureMultiviewOVR(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint baseViewIndex, GLsizei numViews) {
+	glad_glFramebufferTextureMultiviewOVR = (PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)gladLazyResolve("glFramebufferTextureMultiviewOVR");
+	glad_glFramebufferTextureMultiviewOVR(target, attachment, texture, level, baseViewIndex, numViews);
+}
+
+static void APIENTRY lazy_glHintPGI(GLenum target, GLint mode) {
+	glad_glHintPGI = (PFNGLHINTPGIPROC)gladLazyResolve("glHintPGI");
+	glad_glHintPGI(target, mode);
+}
+
+static void APIENTRY lazy_glDetailTexFuncSGIS(GLenum target, GLsizei n, const GLfloat *points) {
+	glad_glDetailTexFuncSGIS = (PFNGLDETAILTEXFUNCSGISPROC)gladLazyResolve("glDetailTexFuncSGIS");
+	glad_glDetailTexFuncSGIS(target, n, points);
+}
+
+static void APIENTRY lazy_glGetDetailTexFuncSGIS(GLenum target, GLfloat *points) {
+	glad_glGetDetailTexFuncSGIS = (PFNGLGETDETAILTEXFUNCSGISPROC)gladLazyResolve("glGetDetailTexFuncSGIS");
+	glad_glGetDetailTexFuncSGIS(target, points);
+}
+
+static void APIENTRY lazy_glFogFuncSGIS(GLsizei n, const GLfloat *points) {
+	glad_glFogFuncSGIS = (PFNGLFOGFUNCSGISPROC)gladLazyResolve("glFogFuncSGIS");
+	glad_glFogFuncSGIS(n, points);
+}
+
+static void APIENTRY lazy_glGetFogFuncSGIS(GLfloat *points) {
+	glad_glGetFogFuncSGIS = (PFNGLGETFOGFUNCSGISPROC)gladLazyResolve("glGetFogFuncSGIS");
+	glad_glGetFogFuncSGIS(points);
+}
+
+static void APIENTRY lazy_glSampleMaskSGIS(GLclampf value, GLboolean invert) {
+	glad_glSampleMaskSGIS = (PFNGLSAMPLEMASKSGISPROC)gladLazyResolve("glSampleMaskSGIS");
+	glad_glSampleMaskSGIS(value, invert);
+}
+
+static void APIENTRY lazy_glSamplePatternSGIS(GLenum pattern) {
+	glad_glSamplePatternSGIS = (PFNGLSAMPLEPATTERNSGISPROC)gladLazyResolve("glSamplePatternSGIS");
+	glad_glSamplePatternSGIS(pattern);
+}
+
+static void APIENTRY lazy_glPixelTexGenParameteriSGIS(GLenum pname, GLint param) {
+	glad_glPixelTexGenParameteriSGIS = (PFNGLPIXELTEXGENPARAMETERISGISPROC)gladLazyResolve("glPixelTexGenParameteriSGIS");
+	glad_glPixelTexGenParameteriSGIS(pname, param);
+}
+
+static void APIENTRY lazy_glPixelTexGenParameterivSGIS(GLenum pname, const GLint *params) {
+	glad_glPixelTexGenParameterivSGIS = (PFNGLPIXELTEXGENPARAMETERIVSGISPROC)gladLazyResolve("glPixelTexGenParameterivSGIS");
+	glad_glPixelTexGenParameterivSGIS(pname, params);
+}
+
+static void APIENTRY lazy_glPixelTexGenParameterfSGIS(GLenum pname, GLfloat param) {
+	glad_glPixelTexGenParameterfSGIS = (PFNGLPIXELTEXGENPARAMETERFSGISPROC)gladLazyResolve("glPixelTexGenParameterfSGIS");
+	glad_glPixelTexGenParameterfSGIS(pname, param);
+}
+
+static void APIENTRY lazy_glPixelTexGenParameterfvSGIS(GLenum pname, const GLfloat *params) {
+	glad_glPixelTexGenParameterfvSGIS = (PFNGLPIXELTEXGENPARAMETERFVSGISPROC)gladLazyResolve("glPixelTexGenParameterfvSGIS");
+	glad_glPixelTexGenParameterfvSGIS(pname, params);
+}
+
+static void APIENTRY lazy_glGetPixelTexGenParameterivSGIS(GLenum pname, GLint *params) {
+	glad_glGetPixelTexGenParameterivSGIS = (PFNGLGETPIXELTEXGENPARAMETERIVSGISPROC)gladLazyResolve("glGetPixelTexGenParameterivSGIS");
+	glad_glGetPixelTexGenParameterivSGIS(pname, params);
+}
+
+static void APIENTRY lazy_glGetPixelTexGenParameterfvSGIS(GLenum pname, GLfloat *params) {
+	glad_glGetPixelTexGenParameterfvSGIS = (PFNGLGETPIXELTEXGENPARAMETERFVSGISPROC)gladLazyResolve("glGetPixelTexGenParameterfvSGIS");
+	glad_glGetPixelTexGenParameterfvSGIS(pname, params);
+}
+
+static void APIENTRY lazy_glPointParameterfSGIS(GLenum pname, GLfloat param) {
+	glad_glPointParameterfSGIS = (PFNGLPOINTPARAMETERFSGISPROC)gladLazyResolve("glPointParameterfSGIS");
+	glad_glPointParameterfSGIS(pname, param);
+}
+
+static void APIENTRY lazy_glPointParameterfvSGIS(GLenum pname, const GLfloat *params) {
+	glad_glPointParameterfvSGIS = (PFNGLPOINTPARAMETERFVSGISPROC)gladLazyResolve("glPointParameterfvSGIS");
+	glad_glPointParameterfvSGIS(pname, params);
+}
+
+static void APIENTRY lazy_glSharpenTexFuncSGIS(GLenum target, GLsizei n, const GLfloat *points) {
+	glad_glSharpenTexFuncSGIS = (PFNGLSHARPENTEXFUNCSGISPROC)gladLazyResolve("glSharpenTexFuncSGIS");
+	glad_glSharpenTexFuncSGIS(target, n, points);
+}
+
+static void APIENTRY lazy_glGetSharpenTexFuncSGIS(GLenum target, GLfloat *points) {
+	glad_glGetSharpenTexFuncSGIS = (PFNGLGETSHARPENTEXFUNCSGISPROC)gladLazyResolve("glGetSharpenTexFuncSGIS");
+	glad_glGetSharpenTexFuncSGIS(target, points);
+}
+
+static void APIENTRY lazy_glTexImage4DSGIS(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage4DSGIS = (PFNGLTEXIMAGE4DSGISPROC)gladLazyResolve("glTexImage4DSGIS");
+	glad_glTexImage4DSGIS(target, level, internalformat, width, height, depth, size4d, border, format, type, pixels);
+}
+
+static void APIENTRY lazy_glTexSubImage4DSGIS(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint woffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage4DSGIS = (PFNGLTEXSUBIMAGE4DSGISPROC)gladLazyResolve("glTexSubImage4DSGIS");
+	glad_glTexSubImage4DSGIS(target, level, xoffset, yoffset, zoffset, woffset, width, height, depth, size4d, format, type, pixels);
+}
+
+static void APIENTRY lazy_glTextureColorMaskSGIS(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	glad_glTextureColorMaskSGIS = (PFNGLTEXTURECOLORMASKSGISPROC)gladLazyResolve("glTextureColorMaskSGIS");
+	glad_glTextureColorMaskSGIS(red, green, blue, alpha);
+}
+
+static void APIENTRY lazy_glGetTexFilterFuncSGIS(GLenum target, GLenum filter, GLfloat *weights) {
+	glad_glGetTexFilterFuncSGIS = (PFNGLGETTEXFILTERFUNCSGISPROC)gladLazyResolve("glGetTexFilterFuncSGIS");
+	glad_glGetTexFilterFuncSGIS(target, filter, weights);
+}
+
+static void APIENTRY lazy_glTexFilterFuncSGIS(GLenum target, GLenum filter, GLsizei n, const GLfloat *weights) {
+	glad_glTexFilterFuncSGIS = (PFNGLTEXFILTERFUNCSGISPROC)gladLazyResolve("glTexFilterFuncSGIS");
+	glad_glTexFilterFuncSGIS(target, filter, n, weights);
+}
+
+static void APIENTRY lazy_glAsyncMarkerSGIX(GLuint marker) {
+	glad_glAsyncMarkerSGIX = (PFNGLASYNCMARKERSGIXPROC)gladLazyResolve("glAsyncMarkerSGIX");
+	glad_glAsyncMarkerSGIX(marker);
+}
+
+static GLint APIENTRY lazy_glFinishAsyncSGIX(GLuint *markerp) {
+	glad_glFinishAsyncSGIX = (PFNGLFINISHASYNCSGIXPROC)gladLazyResolve("glFinishAsyncSGIX");
+	return glad_glFinishAsyncSGIX(markerp);
+}
+
+static GLint APIENTRY lazy_glPollAsyncSGIX(GLuint *markerp) {
+	glad_glPollAsyncSGIX = (PFNGLPOLLASYNCSGIXPROC)gladLazyResolve("glPollAsyncSGIX");
+	return glad_glPollAsyncSGIX(markerp);
+}
+
+static GLuint APIENTRY lazy_glGenAsyncMarkersSGIX(GLsizei range) {
+	glad_glGenAsyncMarkersSGIX = (PFNGLGENASYNCMARKERSSGIXPROC)gladLazyResolve("glGenAsyncMarkersSGIX");
+	return glad_glGenAsyncMarkersSGIX(range);
+}
+
+static void APIENTRY lazy_glDeleteAsyncMarkersSGIX(GLuint marker, GLsizei range) {
+	glad_glDeleteAsyncMarkersSGIX = (PFNGLDELETEASYNCMARKERSSGIXPROC)gladLazyResolve("glDeleteAsyncMarkersSGIX");
+	glad_glDeleteAsyncMarkersSGIX(marker, range);
+}
+
+static GLboolean APIENTRY lazy_glIsAsyncMarkerSGIX(GLuint marker) {
+	glad_glIsAsyncMarkerSGIX = (PFNGLISASYNCMARKERSGIXPROC)gladLazyResolve("glIsAsyncMarkerSGIX");
+	return glad_glIsAsyncMarkerSGIX(marker);
+}
+
+static void APIENTRY lazy_glFlushRasterSGIX(void) {
+	glad_glFlushRasterSGIX = (PFNGLFLUSHRASTERSGIXPROC)gladLazyResolve("glFlushRasterSGIX");
+	glad_glFlushRasterSGIX();
+}
+
+static void APIENTRY lazy_glFragmentColorMaterialSGIX(GLenum face, GLenum mode) {
+	glad_glFragmentColorMaterialSGIX = (PFNGLFRAGMENTCOLORMATERIALSGIXPROC)gladLazyResolve("glFragmentColorMaterialSGIX");
+	glad_glFragmentColorMaterialSGIX(face, mode);
+}
+
+static void APIENTRY lazy_glFragmentLightfSGIX(GLenum light, GLenum pname, GLfloat param) {
+	glad_glFragmentLightfSGIX = (PFNGLFRAGMENTLIGHTFSGIXPROC)gladLazyResolve("glFragmentLightfSGIX");
+	glad_glFragmentLightfSGIX(light, pname, param);
+}
+
+static void APIENTRY lazy_glFragmentLightfvSGIX(GLenum light, GLenum pname, const GLfloat *params) {
+	glad_glFragmentLightfvSGIX = (PFNGLFRAGMENTLIGHTFVSGIXPROC)gladLazyResolve("glFragmentLightfvSGIX");
+	glad_glFragmentLightfvSGIX(light, pname, params);
+}
+
+static void APIENTRY lazy_glFragmentLightiSGIX(GLenum light, GLenum pname, GLint param) {
+	glad_glFragmentLightiSGIX = (PFNGLFRAGMENTLIGHTISGIXPROC)gladLazyResolve("glFragmentLightiSGIX");
+	glad_glFragmentLightiSGIX(light, pname, param);
+}
+
+static void APIENTRY lazy_glFragmentLightivSGIX(GLenum light, GLenum pname, const GLint *params) {
+	glad_glFragmentLightivSGIX = (PFNGLFRAGMENTLIGHTIVSGIXPROC)gladLazyResolve("glFragmentLightivSGIX");
+	glad_glFragmentLightivSGIX(light, pname, params);
+}
+
+static void APIENTRY lazy_glFragmentLightModelfSGIX(GLenum pname, GLfloat param) {
+	glad_glFragmentLightModelfSGIX = (PFNGLFRAGMENTLIGHTMODELFSGIXPROC)gladLazyResolve("glFragmentLightModelfSGIX");
+	glad_glFragmentLightModelfSGIX(pname, param);
+}
+
+static void APIENTRY lazy_glFragmentLightModelfvSGIX(GLenum pname, const GLfloat *params) {
+	glad_glFragmentLightModelfvSGIX = (PFNGLFRAGMENTLIGHTMODELFVSGIXPROC)gladLazyResolve("glFragmentLightModelfvSGIX");
+	glad_glFragmentLightModelfvSGIX(pname, params);
+}
+
+static void APIENTRY lazy_glFragmentLightModeliSGIX(GLenum pname, GLint param) {
+	glad_glFragmentLightModeliSGIX = (PFNGLFRAGMENTLIGHTMODELISGIXPROC)gladLazyResolve("glFragmentLightModeliSGIX");
+	glad_glFragmentLightModeliSGIX(pname, param);
+}
+
+static void APIENTRY lazy_glFragmentLightModelivSGIX(GLenum pname, const GLint *params) {
+	glad_glFragmentLightModelivSGIX = (PFNGLFRAGMENTLIGHTMODELIVSGIXPROC)gladLazyResolve("glFragmentLightModelivSGIX");
+	glad_glFragmentLightModelivSGIX(pname, params);
+}
+
+static void APIENTRY lazy_glFragmentMaterialfSGIX(GLenum face, GLenum pname, GLfloat param) {
+	glad_glFragmentMaterialfSGIX = (PFNGLFRAGMENTMATERIALFSGIXPROC)gladLazyResolve("glFragmentMaterialfSGIX");
+	glad_glFragmentMaterialfSGIX(face, pname, param);
+}
+
+static void APIENTRY lazy_glFragmentMaterialfvSGIX(GLenum face, GLenum pname, const GLfloat *params) {
+	glad_glFragmentMaterialfvSGIX = (PFNGLFRAGMENTMATERIALFVSGIXPROC)gladLazyResolve("glFragmentMaterialfvSGIX");
+	glad_glFragmentMaterialfvSGIX(face, pname, params);
+}
+
+static void APIENTRY lazy_glFragmentMaterialiSGIX(GLenum face, GLenum pname, GLint param) {
+	glad_glFragmentMaterialiSGIX = (PFNGLFRAGMENTMATERIALISGIXPROC)gladLazyResolve("glFragmentMaterialiSGIX");
+	glad_glFragmentMaterialiSGIX(face, pname, param);
+}
+
+static void APIENTRY lazy_glFragmentMaterialivSGIX(GLenum face, GLenum pname, const GLint *params) {
+	glad_glFragmentMaterialivSGIX = (PFNGLFRAGMENTMATERIALIVSGIXPROC)gladLazyResolve("glFragmentMaterialivSGIX");
+	glad_glFragmentMaterialivSGIX(face, pname, params);
+}
+
+static void APIENTRY lazy_glGetFragmentLightfvSGIX(GLenum light, GLenum pname, GLfloat *params) {
+	glad_glGetFragmentLightfvSGIX = (PFNGLGETFRAGMENTLIGHTFVSGIXPROC)gladLazyResolve("glGetFragmentLightfvSGIX");
+	glad_glGetFragmentLightfvSGIX(light, pname, params);
+}
+
+static void APIENTRY lazy_glGetFragmentLightivSGIX(GLenum light, GLenum pname, GLint *params) {
+	glad_glGetFragmentLightivSGIX = (PFNGLGETFRAGMENTLIGHTIVSGIXPROC)gladLazyResolve("glGetFragmentLightivSGIX");
+	glad_glGetFragmentLightivSGIX(light, pname, params);
+}
+
+static void APIENTRY lazy_glGetFragmentMaterialfvSGIX(GLenum face, GLenum pname, GLfloat *params) {
+	glad_glGetFragmentMaterialfvSGIX = (PFNGLGETFRAGMENTMATERIALFVSGIXPROC)gladLazyResolve("glGetFragmentMaterialfvSGIX");
+	glad_glGetFragmentMaterialfvSGIX(face, pname, params);
+}
+
+static void APIENTRY lazy_glGetFragmentMaterialivSGIX(GLenum face, GLenum pname, GLint *params) {
+	glad_glGetFragmentMaterialivSGIX = (PFNGLGETFRAGMENTMATERIALIVSGIXPROC)gladLazyResolve("glGetFragmentMaterialivSGIX");
+	glad_glGetFragmentMaterialivSGIX(face, pname, params);
+}
+
+static void APIENTRY lazy_glLightEnviSGIX(GLenum pname, GLint param) {
+	glad_glLightEnviSGIX = (PFNGLLIGHTENVISGIXPROC)gladLazyResolve("glLightEnviSGIX");
+	glad_glLightEnviSGIX(pname, param);
+}
+
+static void APIENTRY lazy_glFrameZoomSGIX(GLint factor) {
+	glad_glFrameZoomSGIX = (PFNGLFRAMEZOOMSGIXPROC)gladLazyResolve("glFrameZoomSGIX");
+	glad_glFrameZoomSGIX(factor);
+}
+
+static void APIENTRY lazy_glIglooInterfaceSGIX(GLenum pname, const void *params) {
+	glad_glIglooInterfaceSGIX = (PFNGLIGLOOINTERFACESGIXPROC)gladLazyResolve("glIglooInterfaceSGIX");
+	glad_glIglooInterfaceSGIX(pname, params);
+}
+
+static GLint APIENTRY lazy_glGetInstrumentsSGIX(void) {
+	glad_glGetInstrumentsSGIX = (PFNGLGETINSTRUMENTSSGIXPROC)gladLazyResolve("glGetInstrumentsSGIX");
+	return glad_glGetInstrumentsSGIX();
+}
+
+static void APIENTRY lazy_glInstrumentsBufferSGIX(GLsizei size, GLint *buffer) {
+	glad_glInstrumentsBufferSGIX = (PFNGLINSTRUMENTSBUFFERSGIXPROC)gladLazyResolve("glInstrumentsBufferSGIX");
+	glad_glInstrumentsBufferSGIX(size, buffer);
+}
+
+static GLint APIENTRY lazy_glPollInstrumentsSGIX(GLint *marker_p) {
+	glad_glPollInstrumentsSGIX = (PFNGLPOLLINSTRUMENTSSGIXPROC)gladLazyResolve("glPollInstrumentsSGIX");
+	return glad_glPollInstrumentsSGIX(marker_p);
+}
+
+static void APIENTRY lazy_glReadInstrumentsSGIX(GLint marker) {
+	glad_glReadInstrumentsSGIX = (PFNGLREADINSTRUMENTSSGIXPROC)gladLazyResolve("glReadInstrumentsSGIX");
+	glad_glReadInstrumentsSGIX(marker);
+}
+
+static void APIENTRY lazy_glStartInstrumentsSGIX(void) {
+	glad_glStartInstrumentsSGIX = (PFNGLSTARTINSTRUMENTSSGIXPROC)gladLazyResolve("glStartInstrumentsSGIX");
+	glad_glStartInstrumentsSGIX();
+}
+
+static void APIENTRY lazy_glStopInstrumentsSGIX(GLint marker) {
+	glad_glStopInstrumentsSGIX = (PFNGLSTOPINSTRUMENTSSGIXPROC)gladLazyResolve("glStopInstrumentsSGIX");
+	glad_glStopInstrumentsSGIX(marker);
+}
+
+static void APIENTRY lazy_glGetListParameterfvSGIX(GLuint list, GLenum pname, GLfloat *params) {
+	glad_glGetListParameterfvSGIX = (PFNGLGETLISTPARAMETERFVSGIXPROC)gladLazyResolve("glGetListParameterfvSGIX");
+	glad_glGetListParameterfvSGIX(list, pname, params);
+}
+
+static void APIENTRY lazy_glGetListParameterivSGIX(GLuint list, GLenum pname, GLint *params) {
+	glad_glGetListParameterivSGIX = (PFNGLGETLISTPARAMETERIVSGIXPROC)gladLazyResolve("glGetListParameterivSGIX");
+	glad_glGetListParameterivSGIX(list, pname, params);
+}
+
+static void APIENTRY lazy_glListParameterfSGIX(GLuint list, GLenum pname, GLfloat param) {
+	glad_glListParameterfSGIX = (PFNGLLISTPARAMETERFSGIXPROC)gladLazyResolve("glListParameterfSGIX");
+	glad_glListParameterfSGIX(list, pname, param);
+}
+
+static void APIENTRY lazy_glListParameterfvSGIX(GLuint list, GLenum pname, const GLfloat *params) {
+	glad_glListParameterfvSGIX = (PFNGLLISTPARAMETERFVSGIXPROC)gladLazyResolve("glListParameterfvSGIX");
+	glad_glListParameterfvSGIX(list, pname, params);
+}
+
+static void APIENTRY lazy_glListParameteriSGIX(GLuint list, GLenum pname, GLint param) {
+	glad_glListParameteriSGIX = (PFNGLLISTPARAMETERISGIXPROC)gladLazyResolve("glListParameteriSGIX");
+	glad_glListParameteriSGIX(list, pname, param);
+}
+
+static void APIENTRY lazy_glListParameterivSGIX(GLuint list, GLenum pname, const GLint *params) {
+	glad_glListParameterivSGIX = (PFNGLLISTPARAMETERIVSGIXPROC)gladLazyResolve("glListParameterivSGIX");
+	glad_glListParameterivSGIX(list, pname, params);
+}
+
+static void APIENTRY lazy_glPixelTexGenSGIX(GLenum mode) {
+	glad_glPixelTexGenSGIX = (PFNGLPIXELTEXGENSGIXPROC)gladLazyResolve("glPixelTexGenSGIX");
+	glad_glPixelTexGenSGIX(mode);
+}
+
+static void APIENTRY lazy_glDeformationMap3dSGIX(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, GLdouble w1, GLdouble w2, GLint wstride, GLint worder, const GLdouble *points) {
+	glad_glDeformationMap3dSGIX = (PFNGLDEFORMATIONMAP3DSGIXPROC)gladLazyResolve("glDeformationMap3dSGIX");
+	glad_glDeformationMap3dSGIX(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, w1, w2, wstride, worder, points);
+}
+
+static void APIENTRY lazy_glDeformationMap3fSGIX(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, GLfloat w1, GLfloat w2, GLint wstride, GLint worder, const GLfloat *points) {
+	glad_glDeformationMap3fSGIX = (PFNGLDEFORMATIONMAP3FSGIXPROC)gladLazyResolve("glDeformationMap3fSGIX");
+	glad_glDeformationMap3fSGIX(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, w1, w2, wstride, worder, points);
+}
+
+static void APIENTRY lazy_glDeformSGIX(GLbitfield mask) {
+	glad_glDeformSGIX = (PFNGLDEFORMSGIXPROC)gladLazyResolve("glDeformSGIX");
+	glad_glDeformSGIX(mask);
+}
+
+static void APIENTRY lazy_glLoadIdentityDeformationMapSGIX(GLbitfield mask) {
+	glad_glLoadIdentityDeformationMapSGIX = (PFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC)gladLazyResolve("glLoadIdentityDeformationMapSGIX");
+	glad_glLoadIdentityDeformationMapSGIX(mask);
+}
+
+static void APIENTRY lazy_glReferencePlaneSGIX(const GLdouble *equation) {
+	glad_glReferencePlaneSGIX = (PFNGLREFERENCEPLANESGIXPROC)gladLazyResolve("glReferencePlaneSGIX");
+	glad_glReferencePlaneSGIX(equation);
+}
+
+static void APIENTRY lazy_glSpriteParameterfSGIX(GLenum pname, GLfloat param) {
+	glad_glSpriteParameterfSGIX = (PFNGLSPRITEPARAMETERFSGIXPROC)gladLazyResolve("glSpriteParameterfSGIX");
+	glad_glSpriteParameterfSGIX(pname, param);
+}
+
+static void APIENTRY lazy_glSpriteParameterfvSGIX(GLenum pname, const GLfloat *params) {
+	glad_glSpriteParameterfvSGIX = (PFNGLSPRITEPARAMETERFVSGIXPROC)gladLazyResolve("glSpriteParameterfvSGIX");
+	glad_glSpriteParameterfvSGIX(pname, params);
+}
+
+static void APIENTRY lazy_glSpriteParameteriSGIX(GLenum pname, GLint param) {
+	glad_glSpriteParameteriSGIX = (PFNGLSPRITEPARAMETERISGIXPROC)gladLazyResolve("glSpriteParameteriSGIX");
+	glad_glSpriteParameteriSGIX(pname, param);
+}
+
+static void APIENTRY lazy_glSpriteParameterivSGIX(GLenum pname, const GLint *params) {
+	glad_glSpriteParameterivSGIX = (PFNGLSPRITEPARAMETERIVSGIXPROC)gladLazyResolve("glSpriteParameterivSGIX");
+	glad_glSpriteParameterivSGIX(pname, params);
+}
+
+static void APIENTRY lazy_glTagSampleBufferSGIX(void) {
+	glad_glTagSampleBufferSGIX = (PFNGLTAGSAMPLEBUFFERSGIXPROC)gladLazyResolve("glTagSampleBufferSGIX");
+	glad_glTagSampleBufferSGIX();
+}
+
+static void APIENTRY lazy_glColorTableSGI(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *table) {
+	glad_glColorTableSGI = (PFNGLCOLORTABLESGIPROC)gladLazyResolve("glColorTableSGI");
+	glad_glColorTableSGI(target, internalformat, width, format, type, table);
+}
+
+static void APIENTRY lazy_glColorTableParameterfvSGI(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glColorTableParameterfvSGI = (PFNGLCOLORTABLEPARAMETERFVSGIPROC)gladLazyResolve("glColorTableParameterfvSGI");
+	glad_glColorTableParameterfvSGI(target, pname, params);
+}
+
+static void APIENTRY lazy_glColorTableParameterivSGI(GLenum target, GLenum pname, const GLint *params) {
+	glad_glColorTableParameterivSGI = (PFNGLCOLORTABLEPARAMETERIVSGIPROC)gladLazyResolve("glColorTableParameterivSGI");
+	glad_glColorTableParameterivSGI(target, pname, params);
+}
+
+static void APIENTRY lazy_glCopyColorTableSGI(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width) {
+	glad_glCopyColorTableSGI = (PFNGLCOPYCOLORTABLESGIPROC)gladLazyResolve("glCopyColorTableSGI");
+	glad_glCopyColorTableSGI(target, internalformat, x, y, width);
+}
+
+static void APIENTRY lazy_glGetColorTableSGI(GLenum target, GLenum format, GLenum type, void *table) {
+	glad_glGetColorTableSGI = (PFNGLGETCOLORTABLESGIPROC)gladLazyResolve("glGetColorTableSGI");
+	glad_glGetColorTableSGI(target, format, type, table);
+}
+
+static void APIENTRY lazy_glGetColorTableParameterfvSGI(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetColorTableParameterfvSGI = (PFNGLGETCOLORTABLEPARAMETERFVSGIPROC)gladLazyResolve("glGetColorTableParameterfvSGI");
+	glad_glGetColorTableParameterfvSGI(target, pname, params);
+}
+
+static void APIENTRY lazy_glGetColorTableParameterivSGI(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetColorTableParameterivSGI = (PFNGLGETCOLORTABLEPARAMETERIVSGIPROC)gladLazyResolve("glGetColorTableParameterivSGI");
+	glad_glGetColorTableParameterivSGI(target, pname, params);
+}
+
+static void APIENTRY lazy_glFinishTextureSUNX(void) {
+	glad_glFinishTextureSUNX = (PFNGLFINISHTEXTURESUNXPROC)gladLazyResolve("glFinishTextureSUNX");
+	glad_glFinishTextureSUNX();
+}
+
+static void APIENTRY lazy_glGlobalAlphaFactorbSUN(GLbyte factor) {
+	glad_glGlobalAlphaFactorbSUN = (PFNGLGLOBALALPHAFACTORBSUNPROC)gladLazyResolve("glGlobalAlphaFactorbSUN");
+	glad_glGlobalAlphaFactorbSUN(factor);
+}
+
+static void APIENTRY lazy_glGlobalAlphaFactorsSUN(GLshort factor) {
+	glad_glGlobalAlphaFactorsSUN = (PFNGLGLOBALALPHAFACTORSSUNPROC)gladLazyResolve("glGlobalAlphaFactorsSUN");
+	glad_glGlobalAlphaFactorsSUN(factor);
+}
+
+static void APIENTRY lazy_glGlobalAlphaFactoriSUN(GLint factor) {
+	glad_glGlobalAlphaFactoriSUN = (PFNGLGLOBALALPHAFACTORISUNPROC)gladLazyResolve("glGlobalAlphaFactoriSUN");
+	glad_glGlobalAlphaFactoriSUN(factor);
+}
+
+static void APIENTRY lazy_glGlobalAlphaFactorfSUN(GLfloat factor) {
+	glad_glGlobalAlphaFactorfSUN = (PFNGLGLOBALALPHAFACTORFSUNPROC)gladLazyResolve("glGlobalAlphaFactorfSUN");
+	glad_glGlobalAlphaFactorfSUN(factor);
+}
+
+static void APIENTRY lazy_glGlobalAlphaFactordSUN(GLdouble factor) {
+	glad_glGlobalAlphaFactordSUN = (PFNGLGLOBALALPHAFACTORDSUNPROC)gladLazyResolve("glGlobalAlphaFactordSUN");
+	glad_glGlobalAlphaFactordSUN(factor);
+}
+
+static void APIENTRY lazy_glGlobalAlphaFactorubSUN(GLubyte factor) {
+	glad_glGlobalAlphaFactorubSUN = (PFNGLGLOBALALPHAFACTORUBSUNPROC)gladLazyResolve("glGlobalAlphaFactorubSUN");
+	glad_glGlobalAlphaFactorubSUN(factor);
+}
+
+static void APIENTRY lazy_glGlobalAlphaFactorusSUN(GLushort factor) {
+	glad_glGlobalAlphaFactorusSUN = (PFNGLGLOBALALPHAFACTORUSSUNPROC)gladLazyResolve("glGlobalAlphaFactorusSUN");
+	glad_glGlobalAlphaFactorusSUN(factor);
+}
+
+static void APIENTRY lazy_glGlobalAlphaFactoruiSUN(GLuint factor) {
+	glad_glGlobalAlphaFactoruiSUN = (PFNGLGLOBALALPHAFACTORUISUNPROC)gladLazyResolve("glGlobalAlphaFactoruiSUN");
+	glad_glGlobalAlphaFactoruiSUN(factor);
+}
+
+static void APIENTRY lazy_glDrawMeshArraysSUN(GLenum mode, GLint first, GLsizei count, GLsizei width) {
+	glad_glDrawMeshArraysSUN = (PFNGLDRAWMESHARRAYSSUNPROC)gladLazyResolve("glDrawMeshArraysSUN");
+	glad_glDrawMeshArraysSUN(mode, first, count, width);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiSUN(GLuint code) {
+	glad_glReplacementCodeuiSUN = (PFNGLREPLACEMENTCODEUISUNPROC)gladLazyResolve("glReplacementCodeuiSUN");
+	glad_glReplacementCodeuiSUN(code);
+}
+
+static void APIENTRY lazy_glReplacementCodeusSUN(GLushort code) {
+	glad_glReplacementCodeusSUN = (PFNGLREPLACEMENTCODEUSSUNPROC)gladLazyResolve("glReplacementCodeusSUN");
+	glad_glReplacementCodeusSUN(code);
+}
+
+static void APIENTRY lazy_glReplacementCodeubSUN(GLubyte code) {
+	glad_glReplacementCodeubSUN = (PFNGLREPLACEMENTCODEUBSUNPROC)gladLazyResolve("glReplacementCodeubSUN");
+	glad_glReplacementCodeubSUN(code);
+}
+
+static void APIENTRY lazy_glReplacementCodeuivSUN(const GLuint *code) {
+	glad_glReplacementCodeuivSUN = (PFNGLREPLACEMENTCODEUIVSUNPROC)gladLazyResolve("glReplacementCodeuivSUN");
+	glad_glReplacementCodeuivSUN(code);
+}
+
+static void APIENTRY lazy_glReplacementCodeusvSUN(const GLushort *code) {
+	glad_glReplacementCodeusvSUN = (PFNGLREPLACEMENTCODEUSVSUNPROC)gladLazyResolve("glReplacementCodeusvSUN");
+	glad_glReplacementCodeusvSUN(code);
+}
+
+static void APIENTRY lazy_glReplacementCodeubvSUN(const GLubyte *code) {
+	glad_glReplacementCodeubvSUN = (PFNGLREPLACEMENTCODEUBVSUNPROC)gladLazyResolve("glReplacementCodeubvSUN");
+	glad_glReplacementCodeubvSUN(code);
+}
+
+static void APIENTRY lazy_glReplacementCodePointerSUN(GLenum type, GLsizei stride, const void **pointer) {
+	glad_glReplacementCodePointerSUN = (PFNGLREPLACEMENTCODEPOINTERSUNPROC)gladLazyResolve("glReplacementCodePointerSUN");
+	glad_glReplacementCodePointerSUN(type, stride, pointer);
+}
+
+static void APIENTRY lazy_glColor4ubVertex2fSUN(GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y) {
+	glad_glColor4ubVertex2fSUN = (PFNGLCOLOR4UBVERTEX2FSUNPROC)gladLazyResolve("glColor4ubVertex2fSUN");
+	glad_glColor4ubVertex2fSUN(r, g, b, a, x, y);
+}
+
+static void APIENTRY lazy_glColor4ubVertex2fvSUN(const GLubyte *c, const GLfloat *v) {
+	glad_glColor4ubVertex2fvSUN = (PFNGLCOLOR4UBVERTEX2FVSUNPROC)gladLazyResolve("glColor4ubVertex2fvSUN");
+	glad_glColor4ubVertex2fvSUN(c, v);
+}
+
+static void APIENTRY lazy_glColor4ubVertex3fSUN(GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glColor4ubVertex3fSUN = (PFNGLCOLOR4UBVERTEX3FSUNPROC)gladLazyResolve("glColor4ubVertex3fSUN");
+	glad_glColor4ubVertex3fSUN(r, g, b, a, x, y, z);
+}
+
+static void APIENTRY lazy_glColor4ubVertex3fvSUN(const GLubyte *c, const GLfloat *v) {
+	glad_glColor4ubVertex3fvSUN = (PFNGLCOLOR4UBVERTEX3FVSUNPROC)gladLazyResolve("glColor4ubVertex3fvSUN");
+	glad_glColor4ubVertex3fvSUN(c, v);
+}
+
+static void APIENTRY lazy_glColor3fVertex3fSUN(GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glColor3fVertex3fSUN = (PFNGLCOLOR3FVERTEX3FSUNPROC)gladLazyResolve("glColor3fVertex3fSUN");
+	glad_glColor3fVertex3fSUN(r, g, b, x, y, z);
+}
+
+static void APIENTRY lazy_glColor3fVertex3fvSUN(const GLfloat *c, const GLfloat *v) {
+	glad_glColor3fVertex3fvSUN = (PFNGLCOLOR3FVERTEX3FVSUNPROC)gladLazyResolve("glColor3fVertex3fvSUN");
+	glad_glColor3fVertex3fvSUN(c, v);
+}
+
+static void APIENTRY lazy_glNormal3fVertex3fSUN(GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glNormal3fVertex3fSUN = (PFNGLNORMAL3FVERTEX3FSUNPROC)gladLazyResolve("glNormal3fVertex3fSUN");
+	glad_glNormal3fVertex3fSUN(nx, ny, nz, x, y, z);
+}
+
+static void APIENTRY lazy_glNormal3fVertex3fvSUN(const GLfloat *n, const GLfloat *v) {
+	glad_glNormal3fVertex3fvSUN = (PFNGLNORMAL3FVERTEX3FVSUNPROC)gladLazyResolve("glNormal3fVertex3fvSUN");
+	glad_glNormal3fVertex3fvSUN(n, v);
+}
+
+static void APIENTRY lazy_glColor4fNormal3fVertex3fSUN(GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glColor4fNormal3fVertex3fSUN = (PFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC)gladLazyResolve("glColor4fNormal3fVertex3fSUN");
+	glad_glColor4fNormal3fVertex3fSUN(r, g, b, a, nx, ny, nz, x, y, z);
+}
+
+static void APIENTRY lazy_glColor4fNormal3fVertex3fvSUN(const GLfloat *c, const GLfloat *n, const GLfloat *v) {
+	glad_glColor4fNormal3fVertex3fvSUN = (PFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC)gladLazyResolve("glColor4fNormal3fVertex3fvSUN");
+	glad_glColor4fNormal3fVertex3fvSUN(c, n, v);
+}
+
+static void APIENTRY lazy_glTexCoord2fVertex3fSUN(GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glTexCoord2fVertex3fSUN = (PFNGLTEXCOORD2FVERTEX3FSUNPROC)gladLazyResolve("glTexCoord2fVertex3fSUN");
+	glad_glTexCoord2fVertex3fSUN(s, t, x, y, z);
+}
+
+static void APIENTRY lazy_glTexCoord2fVertex3fvSUN(const GLfloat *tc, const GLfloat *v) {
+	glad_glTexCoord2fVertex3fvSUN = (PFNGLTEXCOORD2FVERTEX3FVSUNPROC)gladLazyResolve("glTexCoord2fVertex3fvSUN");
+	glad_glTexCoord2fVertex3fvSUN(tc, v);
+}
+
+static void APIENTRY lazy_glTexCoord4fVertex4fSUN(GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glTexCoord4fVertex4fSUN = (PFNGLTEXCOORD4FVERTEX4FSUNPROC)gladLazyResolve("glTexCoord4fVertex4fSUN");
+	glad_glTexCoord4fVertex4fSUN(s, t, p, q, x, y, z, w);
+}
+
+static void APIENTRY lazy_glTexCoord4fVertex4fvSUN(const GLfloat *tc, const GLfloat *v) {
+	glad_glTexCoord4fVertex4fvSUN = (PFNGLTEXCOORD4FVERTEX4FVSUNPROC)gladLazyResolve("glTexCoord4fVertex4fvSUN");
+	glad_glTexCoord4fVertex4fvSUN(tc, v);
+}
+
+static void APIENTRY lazy_glTexCoord2fColor4ubVertex3fSUN(GLfloat s, GLfloat t, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glTexCoord2fColor4ubVertex3fSUN = (PFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC)gladLazyResolve("glTexCoord2fColor4ubVertex3fSUN");
+	glad_glTexCoord2fColor4ubVertex3fSUN(s, t, r, g, b, a, x, y, z);
+}
+
+static void APIENTRY lazy_glTexCoord2fColor4ubVertex3fvSUN(const GLfloat *tc, const GLubyte *c, const GLfloat *v) {
+	glad_glTexCoord2fColor4ubVertex3fvSUN = (PFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC)gladLazyResolve("glTexCoord2fColor4ubVertex3fvSUN");
+	glad_glTexCoord2fColor4ubVertex3fvSUN(tc, c, v);
+}
+
+static void APIENTRY lazy_glTexCoord2fColor3fVertex3fSUN(GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glTexCoord2fColor3fVertex3fSUN = (PFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC)gladLazyResolve("glTexCoord2fColor3fVertex3fSUN");
+	glad_glTexCoord2fColor3fVertex3fSUN(s, t, r, g, b, x, y, z);
+}
+
+static void APIENTRY lazy_glTexCoord2fColor3fVertex3fvSUN(const GLfloat *tc, const GLfloat *c, const GLfloat *v) {
+	glad_glTexCoord2fColor3fVertex3fvSUN = (PFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC)gladLazyResolve("glTexCoord2fColor3fVertex3fvSUN");
+	glad_glTexCoord2fColor3fVertex3fvSUN(tc, c, v);
+}
+
+static void APIENTRY lazy_glTexCoord2fNormal3fVertex3fSUN(GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glTexCoord2fNormal3fVertex3fSUN = (PFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC)gladLazyResolve("glTexCoord2fNormal3fVertex3fSUN");
+	glad_glTexCoord2fNormal3fVertex3fSUN(s, t, nx, ny, nz, x, y, z);
+}
+
+static void APIENTRY lazy_glTexCoord2fNormal3fVertex3fvSUN(const GLfloat *tc, const GLfloat *n, const GLfloat *v) {
+	glad_glTexCoord2fNormal3fVertex3fvSUN = (PFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)gladLazyResolve("glTexCoord2fNormal3fVertex3fvSUN");
+	glad_glTexCoord2fNormal3fVertex3fvSUN(tc, n, v);
+}
+
+static void APIENTRY lazy_glTexCoord2fColor4fNormal3fVertex3fSUN(GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glTexCoord2fColor4fNormal3fVertex3fSUN = (PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)gladLazyResolve("glTexCoord2fColor4fNormal3fVertex3fSUN");
+	glad_glTexCoord2fColor4fNormal3fVertex3fSUN(s, t, r, g, b, a, nx, ny, nz, x, y, z);
+}
+
+static void APIENTRY lazy_glTexCoord2fColor4fNormal3fVertex3fvSUN(const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v) {
+	glad_glTexCoord2fColor4fNormal3fVertex3fvSUN = (PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)gladLazyResolve("glTexCoord2fColor4fNormal3fVertex3fvSUN");
+	glad_glTexCoord2fColor4fNormal3fVertex3fvSUN(tc, c, n, v);
+}
+
+static void APIENTRY lazy_glTexCoord4fColor4fNormal3fVertex4fSUN(GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glTexCoord4fColor4fNormal3fVertex4fSUN = (PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC)gladLazyResolve("glTexCoord4fColor4fNormal3fVertex4fSUN");
+	glad_glTexCoord4fColor4fNormal3fVertex4fSUN(s, t, p, q, r, g, b, a, nx, ny, nz, x, y, z, w);
+}
+
+static void APIENTRY lazy_glTexCoord4fColor4fNormal3fVertex4fvSUN(const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v) {
+	glad_glTexCoord4fColor4fNormal3fVertex4fvSUN = (PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC)gladLazyResolve("glTexCoord4fColor4fNormal3fVertex4fvSUN");
+	glad_glTexCoord4fColor4fNormal3fVertex4fvSUN(tc, c, n, v);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiVertex3fSUN(GLuint rc, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glReplacementCodeuiVertex3fSUN = (PFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC)gladLazyResolve("glReplacementCodeuiVertex3fSUN");
+	glad_glReplacementCodeuiVertex3fSUN(rc, x, y, z);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiVertex3fvSUN(const GLuint *rc, const GLfloat *v) {
+	glad_glReplacementCodeuiVertex3fvSUN = (PFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC)gladLazyResolve("glReplacementCodeuiVertex3fvSUN");
+	glad_glReplacementCodeuiVertex3fvSUN(rc, v);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiColor4ubVertex3fSUN(GLuint rc, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glReplacementCodeuiColor4ubVertex3fSUN = (PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC)gladLazyResolve("glReplacementCodeuiColor4ubVertex3fSUN");
+	glad_glReplacementCodeuiColor4ubVertex3fSUN(rc, r, g, b, a, x, y, z);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiColor4ubVertex3fvSUN(const GLuint *rc, const GLubyte *c, const GLfloat *v) {
+	glad_glReplacementCodeuiColor4ubVertex3fvSUN = (PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC)gladLazyResolve("glReplacementCodeuiColor4ubVertex3fvSUN");
+	glad_glReplacementCodeuiColor4ubVertex3fvSUN(rc, c, v);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiColor3fVertex3fSUN(GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glReplacementCodeuiColor3fVertex3fSUN = (PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC)gladLazyResolve("glReplacementCodeuiColor3fVertex3fSUN");
+	glad_glReplacementCodeuiColor3fVertex3fSUN(rc, r, g, b, x, y, z);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiColor3fVertex3fvSUN(const GLuint *rc, const GLfloat *c, const GLfloat *v) {
+	glad_glReplacementCodeuiColor3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC)gladLazyResolve("glReplacementCodeuiColor3fVertex3fvSUN");
+	glad_glReplacementCodeuiColor3fVertex3fvSUN(rc, c, v);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiNormal3fVertex3fSUN(GLuint rc, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glReplacementCodeuiNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC)gladLazyResolve("glReplacementCodeuiNormal3fVertex3fSUN");
+	glad_glReplacementCodeuiNormal3fVertex3fSUN(rc, nx, ny, nz, x, y, z);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiNormal3fVertex3fvSUN(const GLuint *rc, const GLfloat *n, const GLfloat *v) {
+	glad_glReplacementCodeuiNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC)gladLazyResolve("glReplacementCodeuiNormal3fVertex3fvSUN");
+	glad_glReplacementCodeuiNormal3fVertex3fvSUN(rc, n, v);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiColor4fNormal3fVertex3fSUN(GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glReplacementCodeuiColor4fNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC)gladLazyResolve("glReplacementCodeuiColor4fNormal3fVertex3fSUN");
+	glad_glReplacementCodeuiColor4fNormal3fVertex3fSUN(rc, r, g, b, a, nx, ny, nz, x, y, z);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiColor4fNormal3fVertex3fvSUN(const GLuint *rc, const GLfloat *c, const GLfloat *n, const GLfloat *v) {
+	glad_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC)gladLazyResolve("glReplacementCodeuiColor4fNormal3fVertex3fvSUN");
+	glad_glReplacementCodeuiColor4fNormal3fVertex3fvSUN(rc, c, n, v);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiTexCoord2fVertex3fSUN(GLuint rc, GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glReplacementCodeuiTexCoord2fVertex3fSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC)gladLazyResolve("glReplacementCodeuiTexCoord2fVertex3fSUN");
+	glad_glReplacementCodeuiTexCoord2fVertex3fSUN(rc, s, t, x, y, z);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiTexCoord2fVertex3fvSUN(const GLuint *rc, const GLfloat *tc, const GLfloat *v) {
+	glad_glReplacementCodeuiTexCoord2fVertex3fvSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC)gladLazyResolve("glReplacementCodeuiTexCoord2fVertex3fvSUN");
+	glad_glReplacementCodeuiTexCoord2fVertex3fvSUN(rc, tc, v);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(GLuint rc, GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC)gladLazyResolve("glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN");
+	glad_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(rc, s, t, nx, ny, nz, x, y, z);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(const GLuint *rc, const GLfloat *tc, const GLfloat *n, const GLfloat *v) {
+	glad_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)gladLazyResolve("glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN");
+	glad_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(rc, tc, n, v);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(GLuint rc, GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)gladLazyResolve("glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN");
+	glad_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(rc, s, t, r, g, b, a, nx, ny, nz, x, y, z);
+}
+
+static void APIENTRY lazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(const GLuint *rc, const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v) {
+	glad_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)gladLazyResolve("glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN");
+	glad_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(rc, tc, c, n, v);
+}
+
+#endif
+void gladInstallLazyGL(void) {
+	glad_glCullFace = lazy_glCullFace;
+	glad_glFrontFace = lazy_glFrontFace;
+	glad_glHint = lazy_glHint;
+	glad_glLineWidth = lazy_glLineWidth;
+	glad_glPointSize = lazy_glPointSize;
+	glad_glPolygonMode = lazy_glPolygonMode;
+	glad_glScissor = lazy_glScissor;
+	glad_glTexParameterf = lazy_glTexParameterf;
+	glad_glTexParameterfv = lazy_glTexParameterfv;
+	glad_glTexParameteri = lazy_glTexParameteri;
+	glad_glTexParameteriv = lazy_glTexParameteriv;
+	glad_glTexImage1D = lazy_glTexImage1D;
+	glad_glTexImage2D = lazy_glTexImage2D;
+	glad_glDrawBuffer = lazy_glDrawBuffer;
+	glad_glClear = lazy_glClear;
+	glad_glClearColor = lazy_glClearColor;
+	glad_glClearStencil = lazy_glClearStencil;
+	glad_glClearDepth = lazy_glClearDepth;
+	glad_glStencilMask = lazy_glStencilMask;
+	glad_glColorMask = lazy_glColorMask;
+	glad_glDepthMask = lazy_glDepthMask;
+	glad_glDisable = lazy_glDisable;
+	glad_glEnable = lazy_glEnable;
+	glad_glFinish = lazy_glFinish;
+	glad_glFlush = lazy_glFlush;
+	glad_glBlendFunc = lazy_glBlendFunc;
+	glad_glLogicOp = lazy_glLogicOp;
+	glad_glStencilFunc = lazy_glStencilFunc;
+	glad_glStencilOp = lazy_glStencilOp;
+	glad_glDepthFunc = lazy_glDepthFunc;
+	glad_glPixelStoref = lazy_glPixelStoref;
+	glad_glPixelStorei = lazy_glPixelStorei;
+	glad_glReadBuffer = lazy_glReadBuffer;
+	glad_glReadPixels = lazy_glReadPixels;
+	glad_glGetBooleanv = lazy_glGetBooleanv;
+	glad_glGetDoublev = lazy_glGetDoublev;
+	glad_glGetError = lazy_glGetError;
+	glad_glGetFloatv = lazy_glGetFloatv;
+	glad_glGetIntegerv = lazy_glGetIntegerv;
+	glad_glGetString = lazy_glGetString;
+	glad_glGetTexImage = lazy_glGetTexImage;
+	glad_glGetTexParameterfv = lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = lazy_glIsEnabled;
+	glad_glDepthRange = lazy_glDepthRange;
+	glad_glViewport = lazy_glViewport;
+#ifndef GLAD_CORE_PROFILE
+	glad_glNewList = lazy_glNewList;
+	glad_glEndList = lazy_glEndList;
+	glad_glCallList = lazy_glCallList;
+	glad_glCallLists = lazy_glCallLists;
+	glad_glDeleteLists = lazy_glDeleteLists;
+	glad_glGenLists = lazy_glGenLists;
+	glad_glListBase = lazy_glListBase;
+	glad_glBegin = lazy_glBegin;
+	glad_glBitmap = lazy_glBitmap;
+	glad_glColor3b = lazy_glColor3b;
+	glad_glColor3bv = lazy_glColor3bv;
+	glad_glColor3d = lazy_glColor3d;
+	glad_glColor3dv = lazy_glColor3dv;
+	glad_glColor3f = lazy_glColor3f;
+	glad_glColor3fv = lazy_glColor3fv;
+	glad_glColor3i = lazy_glColor3i;
+	glad_glColor3iv = lazy_glColor3iv;
+	glad_glColor3s = lazy_glColor3s;
+	glad_glColor3sv = lazy_glColor3sv;
+	glad_glColor3ub = lazy_glColor3ub;
+	glad_glColor3ubv = lazy_glColor3ubv;
+	glad_glColor3ui = lazy_glColor3ui;
+	glad_glColor3uiv = lazy_glColor3uiv;
+	glad_glColor3us = lazy_glColor3us;
+	glad_glColor3usv = lazy_glColor3usv;
+	glad_glColor4b = lazy_glColor4b;
+	glad_glColor4bv = lazy_glColor4bv;
+	glad_glColor4d = lazy_glColor4d;
+	glad_glColor4dv = lazy_glColor4dv;
+	glad_glColor4f = lazy_glColor4f;
+	glad_glColor4fv = lazy_glColor4fv;
+	glad_glColor4i = lazy_glColor4i;
+	glad_glColor4iv = lazy_glColor4iv;
+	glad_glColor4s = lazy_glColor4s;
+	glad_glColor4sv = lazy_glColor4sv;
+	glad_glColor4ub = lazy_glColor4ub;
+	glad_glColor4ubv = lazy_glColor4ubv;
+	glad_glColor4ui = lazy_glColor4ui;
+	glad_glColor4uiv = lazy_glColor4uiv;
+	glad_glColor4us = lazy_glColor4us;
+	glad_glColor4usv = lazy_glColor4usv;
+	glad_glEdgeFlag = lazy_glEdgeFlag;
+	glad_glEdgeFlagv = lazy_glEdgeFlagv;
+	glad_glEnd = lazy_glEnd;
+	glad_glIndexd = lazy_glIndexd;
+	glad_glIndexdv = lazy_glIndexdv;
+	glad_glIndexf = lazy_glIndexf;
+	glad_glIndexfv = lazy_glIndexfv;
+	glad_glIndexi = lazy_glIndexi;
+	glad_glIndexiv = lazy_glIndexiv;
+	glad_glIndexs = lazy_glIndexs;
+	glad_glIndexsv = lazy_glIndexsv;
+	glad_glNormal3b = lazy_glNormal3b;
+	glad_glNormal3bv = lazy_glNormal3bv;
+	glad_glNormal3d = lazy_glNormal3d;
+	glad_glNormal3dv = lazy_glNormal3dv;
+	glad_glNormal3f = lazy_glNormal3f;
+	glad_glNormal3fv = lazy_glNormal3fv;
+	glad_glNormal3i = lazy_glNormal3i;
+	glad_glNormal3iv = lazy_glNormal3iv;
+	glad_glNormal3s = lazy_glNormal3s;
+	glad_glNormal3sv = lazy_glNormal3sv;
+	glad_glRasterPos2d = lazy_glRasterPos2d;
+	glad_glRasterPos2dv = lazy_glRasterPos2dv;
+	glad_glRasterPos2f = lazy_glRasterPos2f;
+	glad_glRasterPos2fv = lazy_glRasterPos2fv;
+	glad_glRasterPos2i = lazy_glRasterPos2i;
+	glad_glRasterPos2iv = lazy_glRasterPos2iv;
+	glad_glRasterPos2s = lazy_glRasterPos2s;
+	glad_glRasterPos2sv = lazy_glRasterPos2sv;
+	glad_glRasterPos3d = lazy_glRasterPos3d;
+	glad_glRasterPos3dv = lazy_glRasterPos3dv;
+	glad_glRasterPos3f = lazy_glRasterPos3f;
+	glad_glRasterPos3fv = lazy_glRasterPos3fv;
+	glad_glRasterPos3i = lazy_glRasterPos3i;
+	glad_glRasterPos3iv = lazy_glRasterPos3iv;
+	glad_glRasterPos3s = lazy_glRasterPos3s;
+	glad_glRasterPos3sv = lazy_glRasterPos3sv;
+	glad_glRasterPos4d = lazy_glRasterPos4d;
+	glad_glRasterPos4dv = lazy_glRasterPos4dv;
+	glad_glRasterPos4f = lazy_glRasterPos4f;
+	glad_glRasterPos4fv = lazy_glRasterPos4fv;
+	glad_glRasterPos4i = lazy_glRasterPos4i;
+	glad_glRasterPos4iv = lazy_glRasterPos4iv;
+	glad_glRasterPos4s = lazy_glRasterPos4s;
+	glad_glRasterPos4sv = lazy_glRasterPos4sv;
+	glad_glRectd = lazy_glRectd;
+	glad_glRectdv = lazy_glRectdv;
+	glad_glRectf = lazy_glRectf;
+	glad_glRectfv = lazy_glRectfv;
+	glad_glRecti = lazy_glRecti;
+	glad_glRectiv = lazy_glRectiv;
+	glad_glRects = lazy_glRects;
+	glad_glRectsv = lazy_glRectsv;
+	glad_glTexCoord1d = lazy_glTexCoord1d;
+	glad_glTexCoord1dv = lazy_glTexCoord1dv;
+	glad_glTexCoord1f = lazy_glTexCoord1f;
+	glad_glTexCoord1fv = lazy_glTexCoord1fv;
+	glad_glTexCoord1i = lazy_glTexCoord1i;
+	glad_glTexCoord1iv = lazy_glTexCoord1iv;
+	glad_glTexCoord1s = lazy_glTexCoord1s;
+	glad_glTexCoord1sv = lazy_glTexCoord1sv;
+	glad_glTexCoord2d = lazy_glTexCoord2d;
+	glad_glTexCoord2dv = lazy_glTexCoord2dv;
+	glad_glTexCoord2f = lazy_glTexCoord2f;
+	glad_glTexCoord2fv = lazy_glTexCoord2fv;
+	glad_glTexCoord2i = lazy_glTexCoord2i;
+	glad_glTexCoord2iv = lazy_glTexCoord2iv;
+	glad_glTexCoord2s = lazy_glTexCoord2s;
+	glad_glTexCoord2sv = lazy_glTexCoord2sv;
+	glad_glTexCoord3d = lazy_glTexCoord3d;
+	glad_glTexCoord3dv = lazy_glTexCoord3dv;
+	glad_glTexCoord3f = lazy_glTexCoord3f;
+	glad_glTexCoord3fv = lazy_glTexCoord3fv;
+	glad_glTexCoord3i = lazy_glTexCoord3i;
+	glad_glTexCoord3iv = lazy_glTexCoord3iv;
+	glad_glTexCoord3s = lazy_glTexCoord3s;
+	glad_glTexCoord3sv = lazy_glTexCoord3sv;
+	glad_glTexCoord4d = lazy_glTexCoord4d;
+	glad_glTexCoord4dv = lazy_glTexCoord4dv;
+	glad_glTexCoord4f = lazy_glTexCoord4f;
+	glad_glTexCoord4fv = lazy_glTexCoord4fv;
+	glad_glTexCoord4i = lazy_glTexCoord4i;
+	glad_glTexCoord4iv = lazy_glTexCoord4iv;
+	glad_glTexCoord4s = lazy_glTexCoord4s;
+	glad_glTexCoord4sv = lazy_glTexCoord4sv;
+	glad_glVertex2d = lazy_glVertex2d;
+	glad_glVertex2dv = lazy_glVertex2dv;
+	glad_glVertex2f = lazy_glVertex2f;
+	glad_glVertex2fv = lazy_glVertex2fv;
+	glad_glVertex2i = lazy_glVertex2i;
+	glad_glVertex2iv = lazy_glVertex2iv;
+	glad_glVertex2s = lazy_glVertex2s;
+	glad_glVertex2sv = lazy_glVertex2sv;
+	glad_glVertex3d = lazy_glVertex3d;
+	glad_glVertex3dv = lazy_glVertex3dv;
+	glad_glVertex3f = lazy_glVertex3f;
+	glad_glVertex3fv = lazy_glVertex3fv;
+	glad_glVertex3i = lazy_glVertex3i;
+	glad_glVertex3iv = lazy_glVertex3iv;
+	glad_glVertex3s = lazy_glVertex3s;
+	glad_glVertex3sv = lazy_glVertex3sv;
+	glad_glVertex4d = lazy_glVertex4d;
+	glad_glVertex4dv = lazy_glVertex4dv;
+	glad_glVertex4f = lazy_glVertex4f;
+	glad_glVertex4fv = lazy_glVertex4fv;
+	glad_glVertex4i = lazy_glVertex4i;
+	glad_glVertex4iv = lazy_glVertex4iv;
+	glad_glVertex4s = lazy_glVertex4s;
+	glad_glVertex4sv = lazy_glVertex4sv;
+	glad_glClipPlane = lazy_glClipPlane;
+	glad_glColorMaterial = lazy_glColorMaterial;
+	glad_glFogf = lazy_glFogf;
+	glad_glFogfv = lazy_glFogfv;
+	glad_glFogi = lazy_glFogi;
+	glad_glFogiv = lazy_glFogiv;
+	glad_glLightf = lazy_glLightf;
+	glad_glLightfv = lazy_glLightfv;
+	glad_glLighti = lazy_glLighti;
+	glad_glLightiv = lazy_glLightiv;
+	glad_glLightModelf = lazy_glLightModelf;
+	glad_glLightModelfv = lazy_glLightModelfv;
+	glad_glLightModeli = lazy_glLightModeli;
+	glad_glLightModeliv = lazy_glLightModeliv;
+	glad_glLineStipple = lazy_glLineStipple;
+	glad_glMaterialf = lazy_glMaterialf;
+	glad_glMaterialfv = lazy_glMaterialfv;
+	glad_glMateriali = lazy_glMateriali;
+	glad_glMaterialiv = lazy_glMaterialiv;
+	glad_glPolygonStipple = lazy_glPolygonStipple;
+	glad_glShadeModel = lazy_glShadeModel;
+	glad_glTexEnvf = lazy_glTexEnvf;
+	glad_glTexEnvfv = lazy_glTexEnvfv;
+	glad_glTexEnvi = lazy_glTexEnvi;
+	glad_glTexEnviv = lazy_glTexEnviv;
+	glad_glTexGend = lazy_glTexGend;
+	glad_glTexGendv = lazy_glTexGendv;
+	glad_glTexGenf = lazy_glTexGenf;
+	glad_glTexGenfv = lazy_glTexGenfv;
+	glad_glTexGeni = lazy_glTexGeni;
+	glad_glTexGeniv = lazy_glTexGeniv;
+	glad_glFeedbackBuffer = lazy_glFeedbackBuffer;
+	glad_glSelectBuffer = lazy_glSelectBuffer;
+	glad_glRenderMode = lazy_glRenderMode;
+	glad_glInitNames = lazy_glInitNames;
+	glad_glLoadName = lazy_glLoadName;
+	glad_glPassThrough = lazy_glPassThrough;
+	glad_glPopName = lazy_glPopName;
+	glad_glPushName = lazy_glPushName;
+	glad_glClearAccum = lazy_glClearAccum;
+	glad_glClearIndex = lazy_glClearIndex;
+	glad_glIndexMask = lazy_glIndexMask;
+	glad_glAccum = lazy_glAccum;
+	glad_glPopAttrib = lazy_glPopAttrib;
+	glad_glPushAttrib = lazy_glPushAttrib;
+	glad_glMap1d = lazy_glMap1d;
+	glad_glMap1f = lazy_glMap1f;
+	glad_glMap2d = lazy_glMap2d;
+	glad_glMap2f = lazy_glMap2f;
+	glad_glMapGrid1d = lazy_glMapGrid1d;
+	glad_glMapGrid1f = lazy_glMapGrid1f;
+	glad_glMapGrid2d = lazy_glMapGrid2d;
+	glad_glMapGrid2f = lazy_glMapGrid2f;
+	glad_glEvalCoord1d = lazy_glEvalCoord1d;
+	glad_glEvalCoord1dv = lazy_glEvalCoord1dv;
+	glad_glEvalCoord1f = lazy_glEvalCoord1f;
+	glad_glEvalCoord1fv = lazy_glEvalCoord1fv;
+	glad_glEvalCoord2d = lazy_glEvalCoord2d;
+	glad_glEvalCoord2dv = lazy_glEvalCoord2dv;
+	glad_glEvalCoord2f = lazy_glEvalCoord2f;
+	glad_glEvalCoord2fv = lazy_glEvalCoord2fv;
+	glad_glEvalMesh1 = lazy_glEvalMesh1;
+	glad_glEvalPoint1 = lazy_glEvalPoint1;
+	glad_glEvalMesh2 = lazy_glEvalMesh2;
+	glad_glEvalPoint2 = lazy_glEvalPoint2;
+	glad_glAlphaFunc = lazy_glAlphaFunc;
+	glad_glPixelZoom = lazy_glPixelZoom;
+	glad_glPixelTransferf = lazy_glPixelTransferf;
+	glad_glPixelTransferi = lazy_glPixelTransferi;
+	glad_glPixelMapfv = lazy_glPixelMapfv;
+	glad_glPixelMapuiv = lazy_glPixelMapuiv;
+	glad_glPixelMapusv = lazy_glPixelMapusv;
+	glad_glCopyPixels = lazy_glCopyPixels;
+	glad_glDrawPixels = lazy_glDrawPixels;
+	glad_glGetClipPlane = lazy_glGetClipPlane;
+	glad_glGetLightfv = lazy_glGetLightfv;
+	glad_glGetLightiv = lazy_glGetLightiv;
+	glad_glGetMapdv = lazy_glGetMapdv;
+	glad_glGetMapfv = lazy_glGetMapfv;
+	glad_glGetMapiv = lazy_glGetMapiv;
+	glad_glGetMaterialfv = lazy_glGetMaterialfv;
+	glad_glGetMaterialiv = lazy_glGetMaterialiv;
+	glad_glGetPixelMapfv = lazy_glGetPixelMapfv;
+	glad_glGetPixelMapuiv = lazy_glGetPixelMapuiv;
+	glad_glGetPixelMapusv = lazy_glGetPixelMapusv;
+	glad_glGetPolygonStipple = lazy_glGetPolygonStipple;
+	glad_glGetTexEnvfv = lazy_glGetTexEnvfv;
+	glad_glGetTexEnviv = lazy_glGetTexEnviv;
+	glad_glGetTexGendv = lazy_glGetTexGendv;
+	glad_glGetTexGenfv = lazy_glGetTexGenfv;
+	glad_glGetTexGeniv = lazy_glGetTexGeniv;
+	glad_glIsList = lazy_glIsList;
+	glad_glFrustum = lazy_glFrustum;
+	glad_glLoadIdentity = lazy_glLoadIdentity;
+	glad_glLoadMatrixf = lazy_glLoadMatrixf;
+	glad_glLoadMatrixd = lazy_glLoadMatrixd;
+	glad_glMatrixMode = lazy_glMatrixMode;
+	glad_glMultMatrixf = lazy_glMultMatrixf;
+	glad_glMultMatrixd = lazy_glMultMatrixd;
+	glad_glOrtho = lazy_glOrtho;
+	glad_glPopMatrix = lazy_glPopMatrix;
+	glad_glPushMatrix = lazy_glPushMatrix;
+	glad_glRotated = lazy_glRotated;
+	glad_glRotatef = lazy_glRotatef;
+	glad_glScaled = lazy_glScaled;
+	glad_glScalef = lazy_glScalef;
+	glad_glTranslated = lazy_glTranslated;
+	glad_glTranslatef = lazy_glTranslatef;
+#endif
+	glad_glDrawArrays = lazy_glDrawArrays;
+	glad_glDrawElements = lazy_glDrawElements;
+	glad_glGetPointerv = lazy_glGetPointerv;
+	glad_glPolygonOffset = lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = lazy_glTexSubImage2D;
+	glad_glBindTexture = lazy_glBindTexture;
+	glad_glDeleteTextures = lazy_glDeleteTextures;
+	glad_glGenTextures = lazy_glGenTextures;
+	glad_glIsTexture = lazy_glIsTexture;
+#ifndef GLAD_CORE_PROFILE
+	glad_glArrayElement = lazy_glArrayElement;
+	glad_glColorPointer = lazy_glColorPointer;
+	glad_glDisableClientState = lazy_glDisableClientState;
+	glad_glEdgeFlagPointer = lazy_glEdgeFlagPointer;
+	glad_glEnableClientState = lazy_glEnableClientState;
+	glad_glIndexPointer = lazy_glIndexPointer;
+	glad_glInterleavedArrays = lazy_glInterleavedArrays;
+	glad_glNormalPointer = lazy_glNormalPointer;
+	glad_glTexCoordPointer = lazy_glTexCoordPointer;
+	glad_glVertexPointer = lazy_glVertexPointer;
+	glad_glAreTexturesResident = lazy_glAreTexturesResident;
+	glad_glPrioritizeTextures = lazy_glPrioritizeTextures;
+	glad_glIndexub = lazy_glIndexub;
+	glad_glIndexubv = lazy_glIndexubv;
+	glad_glPopClientAttrib = lazy_glPopClientAttrib;
+	glad_glPushClientAttrib = lazy_glPushClientAttrib;
+#endif
+	glad_glDrawRangeElements = lazy_glDrawRangeElements;
+	glad_glTexImage3D = lazy_glTexImage3D;
+	glad_glTexSubImage3D = lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = lazy_glCopyTexSubImage3D;
+	glad_glActiveTexture = lazy_glActiveTexture;
+	glad_glSampleCoverage = lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = lazy_glGetCompressedTexImage;
+#ifndef GLAD_CORE_PROFILE
+	glad_glClientActiveTexture = lazy_glClientActiveTexture;
+	glad_glMultiTexCoord1d = lazy_glMultiTexCoord1d;
+	glad_glMultiTexCoord1dv = lazy_glMultiTexCoord1dv;
+	glad_glMultiTexCoord1f = lazy_glMultiTexCoord1f;
+	glad_glMultiTexCoord1fv = lazy_glMultiTexCoord1fv;
+	glad_glMultiTexCoord1i = lazy_glMultiTexCoord1i;
+	glad_glMultiTexCoord1iv = lazy_glMultiTexCoord1iv;
+	glad_glMultiTexCoord1s = lazy_glMultiTexCoord1s;
+	glad_glMultiTexCoord1sv = lazy_glMultiTexCoord1sv;
+	glad_glMultiTexCoord2d = lazy_glMultiTexCoord2d;
+	glad_glMultiTexCoord2dv = lazy_glMultiTexCoord2dv;
+	glad_glMultiTexCoord2f = lazy_glMultiTexCoord2f;
+	glad_glMultiTexCoord2fv = lazy_glMultiTexCoord2fv;
+	glad_glMultiTexCoord2i = lazy_glMultiTexCoord2i;
+	glad_glMultiTexCoord2iv = lazy_glMultiTexCoord2iv;
+	glad_glMultiTexCoord2s = lazy_glMultiTexCoord2s;
+	glad_glMultiTexCoord2sv = lazy_glMultiTexCoord2sv;
+	glad_glMultiTexCoord3d = lazy_glMultiTexCoord3d;
+	glad_glMultiTexCoord3dv = lazy_glMultiTexCoord3dv;
+	glad_glMultiTexCoord3f = lazy_glMultiTexCoord3f;
+	glad_glMultiTexCoord3fv = lazy_glMultiTexCoord3fv;
+	glad_glMultiTexCoord3i = lazy_glMultiTexCoord3i;
+	glad_glMultiTexCoord3iv = lazy_glMultiTexCoord3iv;
+	glad_glMultiTexCoord3s = lazy_glMultiTexCoord3s;
+	glad_glMultiTexCoord3sv = lazy_glMultiTexCoord3sv;
+	glad_glMultiTexCoord4d = lazy_glMultiTexCoord4d;
+	glad_glMultiTexCoord4dv = lazy_glMultiTexCoord4dv;
+	glad_glMultiTexCoord4f = lazy_glMultiTexCoord4f;
+	glad_glMultiTexCoord4fv = lazy_glMultiTexCoord4fv;
+	glad_glMultiTexCoord4i = lazy_glMultiTexCoord4i;
+	glad_glMultiTexCoord4iv = lazy_glMultiTexCoord4iv;
+	glad_glMultiTexCoord4s = lazy_glMultiTexCoord4s;
+	glad_glMultiTexCoord4sv = lazy_glMultiTexCoord4sv;
+	glad_glLoadTransposeMatrixf = lazy_glLoadTransposeMatrixf;
+	glad_glLoadTransposeMatrixd = lazy_glLoadTransposeMatrixd;
+	glad_glMultTransposeMatrixf = lazy_glMultTransposeMatrixf;
+	glad_glMultTransposeMatrixd = lazy_glMultTransposeMatrixd;
+#endif
+	glad_glBlendFuncSeparate = lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = lazy_glMultiDrawElements;
+	glad_glPointParameterf = lazy_glPointParameterf;
+	glad_glPointParameterfv = lazy_glPointParameterfv;
+	glad_glPointParameteri = lazy_glPointParameteri;
+	glad_glPointParameteriv = lazy_glPointParameteriv;
+#ifndef GLAD_CORE_PROFILE
+	glad_glFogCoordf = lazy_glFogCoordf;
+	glad_glFogCoordfv = lazy_glFogCoordfv;
+	glad_glFogCoordd = lazy_glFogCoordd;
+	glad_glFogCoorddv = lazy_glFogCoorddv;
+	glad_glFogCoordPointer = lazy_glFogCoordPointer;
+	glad_glSecondaryColor3b = lazy_glSecondaryColor3b;
+	glad_glSecondaryColor3bv = lazy_glSecondaryColor3bv;
+	glad_glSecondaryColor3d = lazy_glSecondaryColor3d;
+	glad_glSecondaryColor3dv = lazy_glSecondaryColor3dv;
+	glad_glSecondaryColor3f = lazy_glSecondaryColor3f;
+	glad_glSecondaryColor3fv = lazy_glSecondaryColor3fv;
+	glad_glSecondaryColor3i = lazy_glSecondaryColor3i;
+	glad_glSecondaryColor3iv = lazy_glSecondaryColor3iv;
+	glad_glSecondaryColor3s = lazy_glSecondaryColor3s;
+	glad_glSecondaryColor3sv = lazy_glSecondaryColor3sv;
+	glad_glSecondaryColor3ub = lazy_glSecondaryColor3ub;
+	glad_glSecondaryColor3ubv = lazy_glSecondaryColor3ubv;
+	glad_glSecondaryColor3ui = lazy_glSecondaryColor3ui;
+	glad_glSecondaryColor3uiv = lazy_glSecondaryColor3uiv;
+	glad_glSecondaryColor3us = lazy_glSecondaryColor3us;
+	glad_glSecondaryColor3usv = lazy_glSecondaryColor3usv;
+	glad_glSecondaryColorPointer = lazy_glSecondaryColorPointer;
+	glad_glWindowPos2d = lazy_glWindowPos2d;
+	glad_glWindowPos2dv = lazy_glWindowPos2dv;
+	glad_glWindowPos2f = lazy_glWindowPos2f;
+	glad_glWindowPos2fv = lazy_glWindowPos2fv;
+	glad_glWindowPos2i = lazy_glWindowPos2i;
+	glad_glWindowPos2iv = lazy_glWindowPos2iv;
+	glad_glWindowPos2s = lazy_glWindowPos2s;
+	glad_glWindowPos2sv = lazy_glWindowPos2sv;
+	glad_glWindowPos3d = lazy_glWindowPos3d;
+	glad_glWindowPos3dv = lazy_glWindowPos3dv;
+	glad_glWindowPos3f = lazy_glWindowPos3f;
+	glad_glWindowPos3fv = lazy_glWindowPos3fv;
+	glad_glWindowPos3i = lazy_glWindowPos3i;
+	glad_glWindowPos3iv = lazy_glWindowPos3iv;
+	glad_glWindowPos3s = lazy_glWindowPos3s;
+	glad_glWindowPos3sv = lazy_glWindowPos3sv;
+#endif
+	glad_glBlendColor = lazy_glBlendColor;
+	glad_glBlendEquation = lazy_glBlendEquation;
+	glad_glGenQueries = lazy_glGenQueries;
+	glad_glDeleteQueries = lazy_glDeleteQueries;
+	glad_glIsQuery = lazy_glIsQuery;
+	glad_glBeginQuery = lazy_glBeginQuery;
+	glad_glEndQuery = lazy_glEndQuery;
+	glad_glGetQueryiv = lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = lazy_glBindBuffer;
+	glad_glDeleteBuffers = lazy_glDeleteBuffers;
+	glad_glGenBuffers = lazy_glGenBuffers;
+	glad_glIsBuffer = lazy_glIsBuffer;
+	glad_glBufferData = lazy_glBufferData;
+	glad_glBufferSubData = lazy_glBufferSubData;
+	glad_glGetBufferSubData = lazy_glGetBufferSubData;
+	glad_glMapBuffer = lazy_glMapBuffer;
+	glad_glUnmapBuffer = lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = lazy_glGetBufferPointerv;
+	glad_glBlendEquationSeparate = lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = lazy_glStencilMaskSeparate;
+	glad_glAttachShader = lazy_glAttachShader;
+	glad_glBindAttribLocation = lazy_glBindAttribLocation;
+	glad_glCompileShader = lazy_glCompileShader;
+	glad_glCreateProgram = lazy_glCreateProgram;
+	glad_glCreateShader = lazy_glCreateShader;
+	glad_glDeleteProgram = lazy_glDeleteProgram;
+	glad_glDeleteShader = lazy_glDeleteShader;
+	glad_glDetachShader = lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = lazy_glGetAttribLocation;
+	glad_glGetProgramiv = lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = lazy_glGetShaderSource;
+	glad_glGetUniformLocation = lazy_glGetUniformLocation;
+	glad_glGetUniformfv = lazy_glGetUniformfv;
+	glad_glGetUniformiv = lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = lazy_glIsProgram;
+	glad_glIsShader = lazy_glIsShader;
+	glad_glLinkProgram = lazy_glLinkProgram;
+	glad_glShaderSource = lazy_glShaderSource;
+	glad_glUseProgram = lazy_glUseProgram;
+	glad_glUniform1f = lazy_glUniform1f;
+	glad_glUniform2f = lazy_glUniform2f;
+	glad_glUniform3f = lazy_glUniform3f;
+	glad_glUniform4f = lazy_glUniform4f;
+	glad_glUniform1i = lazy_glUniform1i;
+	glad_glUniform2i = lazy_glUniform2i;
+	glad_glUniform3i = lazy_glUniform3i;
+	glad_glUniform4i = lazy_glUniform4i;
+	glad_glUniform1fv = lazy_glUniform1fv;
+	glad_glUniform2fv = lazy_glUniform2fv;
+	glad_glUniform3fv = lazy_glUniform3fv;
+	glad_glUniform4fv = lazy_glUniform4fv;
+	glad_glUniform1iv = lazy_glUniform1iv;
+	glad_glUniform2iv = lazy_glUniform2iv;
+	glad_glUniform3iv = lazy_glUniform3iv;
+	glad_glUniform4iv = lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = lazy_glValidateProgram;
+	glad_glVertexAttrib1d = lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = lazy_glVertexAttribPointer;
+	glad_glUniformMatrix2x3fv = lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = lazy_glUniformMatrix4x3fv;
+	glad_glColorMaski = lazy_glColorMaski;
+	glad_glGetBooleani_v = lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = lazy_glGetIntegeri_v;
+	glad_glEnablei = lazy_glEnablei;
+	glad_glDisablei = lazy_glDisablei;
+	glad_glIsEnabledi = lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = lazy_glBindBufferRange;
+	glad_glBindBufferBase = lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = lazy_glClampColor;
+	glad_glBeginConditionalRender = lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = lazy_glGetFragDataLocation;
+	glad_glUniform1ui = lazy_glUniform1ui;
+	glad_glUniform2ui = lazy_glUniform2ui;
+	glad_glUniform3ui = lazy_glUniform3ui;
+	glad_glUniform4ui = lazy_glUniform4ui;
+	glad_glUniform1uiv = lazy_glUniform1uiv;
+	glad_glUniform2uiv = lazy_glUniform2uiv;
+	glad_glUniform3uiv = lazy_glUniform3uiv;
+	glad_glUniform4uiv = lazy_glUniform4uiv;
+	glad_glTexParameterIiv = lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = lazy_glClearBufferiv;
+	glad_glClearBufferuiv = lazy_glClearBufferuiv;
+	glad_glClearBufferfv = lazy_glClearBufferfv;
+	glad_glClearBufferfi = lazy_glClearBufferfi;
+	glad_glGetStringi = lazy_glGetStringi;
+	glad_glIsRenderbuffer = lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = lazy_glGenVertexArrays;
+	glad_glIsVertexArray = lazy_glIsVertexArray;
+	glad_glDrawArraysInstanced = lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = lazy_glUniformBlockBinding;
+	glad_glDrawElementsBaseVertex = lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = lazy_glProvokingVertex;
+	glad_glFenceSync = lazy_glFenceSync;
+	glad_glIsSync = lazy_glIsSync;
+	glad_glDeleteSync = lazy_glDeleteSync;
+	glad_glClientWaitSync = lazy_glClientWaitSync;
+	glad_glWaitSync = lazy_glWaitSync;
+	glad_glGetInteger64v = lazy_glGetInteger64v;
+	glad_glGetSynciv = lazy_glGetSynciv;
+	glad_glGetInteger64i_v = lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = lazy_glGetMultisamplefv;
+	glad_glSampleMaski = lazy_glSampleMaski;
+	glad_glBindFragDataLocationIndexed = lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = lazy_glGetFragDataIndex;
+	glad_glGenSamplers = lazy_glGenSamplers;
+	glad_glDeleteSamplers = lazy_glDeleteSamplers;
+	glad_glIsSampler = lazy_glIsSampler;
+	glad_glBindSampler = lazy_glBindSampler;
+	glad_glSamplerParameteri = lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = lazy_glVertexAttribP4uiv;
+#ifndef GLAD_CORE_PROFILE
+	glad_glVertexP2ui = lazy_glVertexP2ui;
+	glad_glVertexP2uiv = lazy_glVertexP2uiv;
+	glad_glVertexP3ui = lazy_glVertexP3ui;
+	glad_glVertexP3uiv = lazy_glVertexP3uiv;
+	glad_glVertexP4ui = lazy_glVertexP4ui;
+	glad_glVertexP4uiv = lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = lazy_glNormalP3ui;
+	glad_glNormalP3uiv = lazy_glNormalP3uiv;
+	glad_glColorP3ui = lazy_glColorP3ui;
+	glad_glColorP3uiv = lazy_glColorP3uiv;
+	glad_glColorP4ui = lazy_glColorP4ui;
+	glad_glColorP4uiv = lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = lazy_glSecondaryColorP3uiv;
+#endif
+	glad_glMinSampleShading = lazy_glMinSampleShading;
+	glad_glBlendEquationi = lazy_glBlendEquationi;
+	glad_glBlendEquationSeparatei = lazy_glBlendEquationSeparatei;
+	glad_glBlendFunci = lazy_glBlendFunci;
+	glad_glBlendFuncSeparatei = lazy_glBlendFuncSeparatei;
+	glad_glDrawArraysIndirect = lazy_glDrawArraysIndirect;
+	glad_glDrawElementsIndirect = lazy_glDrawElementsIndirect;
+	glad_glUniform1d = lazy_glUniform1d;
+	glad_glUniform2d = lazy_glUniform2d;
+	glad_glUniform3d = lazy_glUniform3d;
+	glad_glUniform4d = lazy_glUniform4d;
+	glad_glUniform1dv = lazy_glUniform1dv;
+	glad_glUniform2dv = lazy_glUniform2dv;
+	glad_glUniform3dv = lazy_glUniform3dv;
+	glad_glUniform4dv = lazy_glUniform4dv;
+	glad_glUniformMatrix2dv = lazy_glUniformMatrix2dv;
+	glad_glUniformMatrix3dv = lazy_glUniformMatrix3dv;
+	glad_glUniformMatrix4dv = lazy_glUniformMatrix4dv;
+	glad_glUniformMatrix2x3dv = lazy_glUniformMatrix2x3dv;
+	glad_glUniformMatrix2x4dv = lazy_glUniformMatrix2x4dv;
+	glad_glUniformMatrix3x2dv = lazy_glUniformMatrix3x2dv;
+	glad_glUniformMatrix3x4dv = lazy_glUniformMatrix3x4dv;
+	glad_glUniformMatrix4x2dv = lazy_glUniformMatrix4x2dv;
+	glad_glUniformMatrix4x3dv = lazy_glUniformMatrix4x3dv;
+	glad_glGetUniformdv = lazy_glGetUniformdv;
+	glad_glGetSubroutineUniformLocation = lazy_glGetSubroutineUniformLocation;
+	glad_glGetSubroutineIndex = lazy_glGetSubroutineIndex;
+	glad_glGetActiveSubroutineUniformiv = lazy_glGetActiveSubroutineUniformiv;
+	glad_glGetActiveSubroutineUniformName = lazy_glGetActiveSubroutineUniformName;
+	glad_glGetActiveSubroutineName = lazy_glGetActiveSubroutineName;
+	glad_glUniformSubroutinesuiv = lazy_glUniformSubroutinesuiv;
+	glad_glGetUniformSubroutineuiv = lazy_glGetUniformSubroutineuiv;
+	glad_glGetProgramStageiv = lazy_glGetProgramStageiv;
+	glad_glPatchParameteri = lazy_glPatchParameteri;
+	glad_glPatchParameterfv = lazy_glPatchParameterfv;
+	glad_glBindTransformFeedback = lazy_glBindTransformFeedback;
+	glad_glDeleteTransformFeedbacks = lazy_glDeleteTransformFeedbacks;
+	glad_glGenTransformFeedbacks = lazy_glGenTransformFeedbacks;
+	glad_glIsTransformFeedback = lazy_glIsTransformFeedback;
+	glad_glPauseTransformFeedback = lazy_glPauseTransformFeedback;
+	glad_glResumeTransformFeedback = lazy_glResumeTransformFeedback;
+	glad_glDrawTransformFeedback = lazy_glDrawTransformFeedback;
+	glad_glDrawTransformFeedbackStream = lazy_glDrawTransformFeedbackStream;
+	glad_glBeginQueryIndexed = lazy_glBeginQueryIndexed;
+	glad_glEndQueryIndexed = lazy_glEndQueryIndexed;
+	glad_glGetQueryIndexediv = lazy_glGetQueryIndexediv;
+	glad_glReleaseShaderCompiler = lazy_glReleaseShaderCompiler;
+	glad_glShaderBinary = lazy_glShaderBinary;
+	glad_glGetShaderPrecisionFormat = lazy_glGetShaderPrecisionFormat;
+	glad_glDepthRangef = lazy_glDepthRangef;
+	glad_glClearDepthf = lazy_glClearDepthf;
+	glad_glGetProgramBinary = lazy_glGetProgramBinary;
+	glad_glProgramBinary = lazy_glProgramBinary;
+	glad_glProgramParameteri = lazy_glProgramParameteri;
+	glad_glUseProgramStages = lazy_glUseProgramStages;
+	glad_glActiveShaderProgram = lazy_glActiveShaderProgram;
+	glad_glCreateShaderProgramv = lazy_glCreateShaderProgramv;
+	glad_glBindProgramPipeline = lazy_glBindProgramPipeline;
+	glad_glDeleteProgramPipelines = lazy_glDeleteProgramPipelines;
+	glad_glGenProgramPipelines = lazy_glGenProgramPipelines;
+	glad_glIsProgramPipeline = lazy_glIsProgramPipeline;
+	glad_glGetProgramPipelineiv = lazy_glGetProgramPipelineiv;
+	glad_glProgramUniform1i = lazy_glProgramUniform1i;
+	glad_glProgramUniform1iv = lazy_glProgramUniform1iv;
+	glad_glProgramUniform1f = lazy_glProgramUniform1f;
+	glad_glProgramUniform1fv = lazy_glProgramUniform1fv;
+	glad_glProgramUniform1d = lazy_glProgramUniform1d;
+	glad_glProgramUniform1dv = lazy_glProgramUniform1dv;
+	glad_glProgramUniform1ui = lazy_glProgramUniform1ui;
+	glad_glProgramUniform1uiv = lazy_glProgramUniform1uiv;
+	glad_glProgramUniform2i = lazy_glProgramUniform2i;
+	glad_glProgramUniform2iv = lazy_glProgramUniform2iv;
+	glad_glProgramUniform2f = lazy_glProgramUniform2f;
+	glad_glProgramUniform2fv = lazy_glProgramUniform2fv;
+	glad_glProgramUniform2d = lazy_glProgramUniform2d;
+	glad_glProgramUniform2dv = lazy_glProgramUniform2dv;
+	glad_glProgramUniform2ui = lazy_glProgramUniform2ui;
+	glad_glProgramUniform2uiv = lazy_glProgramUniform2uiv;
+	glad_glProgramUniform3i = lazy_glProgramUniform3i;
+	glad_glProgramUniform3iv = lazy_glProgramUniform3iv;
+	glad_glProgramUniform3f = lazy_glProgramUniform3f;
+	glad_glProgramUniform3fv = lazy_glProgramUniform3fv;
+	glad_glProgramUniform3d = lazy_glProgramUniform3d;
+	glad_glProgramUniform3dv = lazy_glProgramUniform3dv;
+	glad_glProgramUniform3ui = lazy_glProgramUniform3ui;
+	glad_glProgramUniform3uiv = lazy_glProgramUniform3uiv;
+	glad_glProgramUniform4i = lazy_glProgramUniform4i;
+	glad_glProgramUniform4iv = lazy_glProgramUniform4iv;
+	glad_glProgramUniform4f = lazy_glProgramUniform4f;
+	glad_glProgramUniform4fv = lazy_glProgramUniform4fv;
+	glad_glProgramUniform4d = lazy_glProgramUniform4d;
+	glad_glProgramUniform4dv = lazy_glProgramUniform4dv;
+	glad_glProgramUniform4ui = lazy_glProgramUniform4ui;
+	glad_glProgramUniform4uiv = lazy_glProgramUniform4uiv;
+	glad_glProgramUniformMatrix2fv = lazy_glProgramUniformMatrix2fv;
+	glad_glProgramUniformMatrix3fv = lazy_glProgramUniformMatrix3fv;
+	glad_glProgramUniformMatrix4fv = lazy_glProgramUniformMatrix4fv;
+	glad_glProgramUniformMatrix2dv = lazy_glProgramUniformMatrix2dv;
+	glad_glProgramUniformMatrix3dv = lazy_glProgramUniformMatrix3dv;
+	glad_glProgramUniformMatrix4dv = lazy_glProgramUniformMatrix4dv;
+	glad_glProgramUniformMatrix2x3fv = lazy_glProgramUniformMatrix2x3fv;
+	glad_glProgramUniformMatrix3x2fv = lazy_glProgramUniformMatrix3x2fv;
+	glad_glProgramUniformMatrix2x4fv = lazy_glProgramUniformMatrix2x4fv;
+	glad_glProgramUniformMatrix4x2fv = lazy_glProgramUniformMatrix4x2fv;
+	glad_glProgramUniformMatrix3x4fv = lazy_glProgramUniformMatrix3x4fv;
+	glad_glProgramUniformMatrix4x3fv = lazy_glProgramUniformMatrix4x3fv;
+	glad_glProgramUniformMatrix2x3dv = lazy_glProgramUniformMatrix2x3dv;
+	glad_glProgramUniformMatrix3x2dv = lazy_glProgramUniformMatrix3x2dv;
+	glad_glProgramUniformMatrix2x4dv = lazy_glProgramUniformMatrix2x4dv;
+	glad_glProgramUniformMatrix4x2dv = lazy_glProgramUniformMatrix4x2dv;
+	glad_glProgramUniformMatrix3x4dv = lazy_glProgramUniformMatrix3x4dv;
+	glad_glProgramUniformMatrix4x3dv = lazy_glProgramUniformMatrix4x3dv;
+	glad_glValidateProgramPipeline = lazy_glValidateProgramPipeline;
+	glad_glGetProgramPipelineInfoLog = lazy_glGetProgramPipelineInfoLog;
+	glad_glVertexAttribL1d = lazy_glVertexAttribL1d;
+	glad_glVertexAttribL2d = lazy_glVertexAttribL2d;
+	glad_glVertexAttribL3d = lazy_glVertexAttribL3d;
+	glad_glVertexAttribL4d = lazy_glVertexAttribL4d;
+	glad_glVertexAttribL1dv = lazy_glVertexAttribL1dv;
+	glad_glVertexAttribL2dv = lazy_glVertexAttribL2dv;
+	glad_glVertexAttribL3dv = lazy_glVertexAttribL3dv;
+	glad_glVertexAttribL4dv = lazy_glVertexAttribL4dv;
+	glad_glVertexAttribLPointer = lazy_glVertexAttribLPointer;
+	glad_glGetVertexAttribLdv = lazy_glGetVertexAttribLdv;
+	glad_glViewportArrayv = lazy_glViewportArrayv;
+	glad_glViewportIndexedf = lazy_glViewportIndexedf;
+	glad_glViewportIndexedfv = lazy_glViewportIndexedfv;
+	glad_glScissorArrayv = lazy_glScissorArrayv;
+	glad_glScissorIndexed = lazy_glScissorIndexed;
+	glad_glScissorIndexedv = lazy_glScissorIndexedv;
+	glad_glDepthRangeArrayv = lazy_glDepthRangeArrayv;
+	glad_glDepthRangeIndexed = lazy_glDepthRangeIndexed;
+	glad_glGetFloati_v = lazy_glGetFloati_v;
+	glad_glGetDoublei_v = lazy_glGetDoublei_v;
+	glad_glDrawArraysInstancedBaseInstance = lazy_glDrawArraysInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseInstance = lazy_glDrawElementsInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = lazy_glDrawElementsInstancedBaseVertexBaseInstance;
+	glad_glGetInternalformativ = lazy_glGetInternalformativ;
+	glad_glGetActiveAtomicCounterBufferiv = lazy_glGetActiveAtomicCounterBufferiv;
+	glad_glBindImageTexture = lazy_glBindImageTexture;
+	glad_glMemoryBarrier = lazy_glMemoryBarrier;
+	glad_glTexStorage1D = lazy_glTexStorage1D;
+	glad_glTexStorage2D = lazy_glTexStorage2D;
+	glad_glTexStorage3D = lazy_glTexStorage3D;
+	glad_glDrawTransformFeedbackInstanced = lazy_glDrawTransformFeedbackInstanced;
+	glad_glDrawTransformFeedbackStreamInstanced = lazy_glDrawTransformFeedbackStreamInstanced;
+	glad_glClearBufferData = lazy_glClearBufferData;
+	glad_glClearBufferSubData = lazy_glClearBufferSubData;
+	glad_glDispatchCompute = lazy_glDispatchCompute;
+	glad_glDispatchComputeIndirect = lazy_glDispatchComputeIndirect;
+	glad_glCopyImageSubData = lazy_glCopyImageSubData;
+	glad_glFramebufferParameteri = lazy_glFramebufferParameteri;
+	glad_glGetFramebufferParameteriv = lazy_glGetFramebufferParameteriv;
+	glad_glGetInternalformati64v = lazy_glGetInternalformati64v;
+	glad_glInvalidateTexSubImage = lazy_glInvalidateTexSubImage;
+	glad_glInvalidateTexImage = lazy_glInvalidateTexImage;
+	glad_glInvalidateBufferSubData = lazy_glInvalidateBufferSubData;
+	glad_glInvalidateBufferData = lazy_glInvalidateBufferData;
+	glad_glInvalidateFramebuffer = lazy_glInvalidateFramebuffer;
+	glad_glInvalidateSubFramebuffer = lazy_glInvalidateSubFramebuffer;
+	glad_glMultiDrawArraysIndirect = lazy_glMultiDrawArraysIndirect;
+	glad_glMultiDrawElementsIndirect = lazy_glMultiDrawElementsIndirect;
+	glad_glGetProgramInterfaceiv = lazy_glGetProgramInterfaceiv;
+	glad_glGetProgramResourceIndex = lazy_glGetProgramResourceIndex;
+	glad_glGetProgramResourceName = lazy_glGetProgramResourceName;
+	glad_glGetProgramResourceiv = lazy_glGetProgramResourceiv;
+	glad_glGetProgramResourceLocation = lazy_glGetProgramResourceLocation;
+	glad_glGetProgramResourceLocationIndex = lazy_glGetProgramResourceLocationIndex;
+	glad_glShaderStorageBlockBinding = lazy_glShaderStorageBlockBinding;
+	glad_glTexBufferRange = lazy_glTexBufferRange;
+	glad_glTexStorage2DMultisample = lazy_glTexStorage2DMultisample;
+	glad_glTexStorage3DMultisample = lazy_glTexStorage3DMultisample;
+	glad_glTextureView = lazy_glTextureView;
+	glad_glBindVertexBuffer = lazy_glBindVertexBuffer;
+	glad_glVertexAttribFormat = lazy_glVertexAttribFormat;
+	glad_glVertexAttribIFormat = lazy_glVertexAttribIFormat;
+	glad_glVertexAttribLFormat = lazy_glVertexAttribLFormat;
+	glad_glVertexAttribBinding = lazy_glVertexAttribBinding;
+	glad_glVertexBindingDivisor = lazy_glVertexBindingDivisor;
+	glad_glDebugMessageControl = lazy_glDebugMessageControl;
+	glad_glDebugMessageInsert = lazy_glDebugMessageInsert;
+	glad_glDebugMessageCallback = lazy_glDebugMessageCallback;
+	glad_glGetDebugMessageLog = lazy_glGetDebugMessageLog;
+	glad_glPushDebugGroup = lazy_glPushDebugGroup;
+	glad_glPopDebugGroup = lazy_glPopDebugGroup;
+	glad_glObjectLabel = lazy_glObjectLabel;
+	glad_glGetObjectLabel = lazy_glGetObjectLabel;
+	glad_glObjectPtrLabel = lazy_glObjectPtrLabel;
+	glad_glGetObjectPtrLabel = lazy_glGetObjectPtrLabel;
+	glad_glBufferStorage = lazy_glBufferStorage;
+	glad_glClearTexImage = lazy_glClearTexImage;
+	glad_glClearTexSubImage = lazy_glClearTexSubImage;
+	glad_glBindBuffersBase = lazy_glBindBuffersBase;
+	glad_glBindBuffersRange = lazy_glBindBuffersRange;
+	glad_glBindTextures = lazy_glBindTextures;
+	glad_glBindSamplers = lazy_glBindSamplers;
+	glad_glBindImageTextures = lazy_glBindImageTextures;
+	glad_glBindVertexBuffers = lazy_glBindVertexBuffers;
+	glad_glClipControl = lazy_glClipControl;
+	glad_glCreateTransformFeedbacks = lazy_glCreateTransformFeedbacks;
+	glad_glTransformFeedbackBufferBase = lazy_glTransformFeedbackBufferBase;
+	glad_glTransformFeedbackBufferRange = lazy_glTransformFeedbackBufferRange;
+	glad_glGetTransformFeedbackiv = lazy_glGetTransformFeedbackiv;
+	glad_glGetTransformFeedbacki_v = lazy_glGetTransformFeedbacki_v;
+	glad_glGetTransformFeedbacki64_v = lazy_glGetTransformFeedbacki64_v;
+	glad_glCreateBuffers = lazy_glCreateBuffers;
+	glad_glNamedBufferStorage = lazy_glNamedBufferStorage;
+	glad_glNamedBufferData = lazy_glNamedBufferData;
+	glad_glNamedBufferSubData = lazy_glNamedBufferSubData;
+	glad_glCopyNamedBufferSubData = lazy_glCopyNamedBufferSubData;
+	glad_glClearNamedBufferData = lazy_glClearNamedBufferData;
+	glad_glClearNamedBufferSubData = lazy_glClearNamedBufferSubData;
+	glad_glMapNamedBuffer = lazy_glMapNamedBuffer;
+	glad_glMapNamedBufferRange = lazy_glMapNamedBufferRange;
+	glad_glUnmapNamedBuffer = lazy_glUnmapNamedBuffer;
+	glad_glFlushMappedNamedBufferRange = lazy_glFlushMappedNamedBufferRange;
+	glad_glGetNamedBufferParameteriv = lazy_glGetNamedBufferParameteriv;
+	glad_glGetNamedBufferParameteri64v = lazy_glGetNamedBufferParameteri64v;
+	glad_glGetNamedBufferPointerv = lazy_glGetNamedBufferPointerv;
+	glad_glGetNamedBufferSubData = lazy_glGetNamedBufferSubData;
+	glad_glCreateFramebuffers = lazy_glCreateFramebuffers;
+	glad_glNamedFramebufferRenderbuffer = lazy_glNamedFramebufferRenderbuffer;
+	glad_glNamedFramebufferParameteri = lazy_glNamedFramebufferParameteri;
+	glad_glNamedFramebufferTexture = lazy_glNamedFramebufferTexture;
+	glad_glNamedFramebufferTextureLayer = lazy_glNamedFramebufferTextureLayer;
+	glad_glNamedFramebufferDrawBuffer = lazy_glNamedFramebufferDrawBuffer;
+	glad_glNamedFramebufferDrawBuffers = lazy_glNamedFramebufferDrawBuffers;
+	glad_glNamedFramebufferReadBuffer = lazy_glNamedFramebufferReadBuffer;
+	glad_glInvalidateNamedFramebufferData = lazy_glInvalidateNamedFramebufferData;
+	glad_glInvalidateNamedFramebufferSubData = lazy_glInvalidateNamedFramebufferSubData;
+	glad_glClearNamedFramebufferiv = lazy_glClearNamedFramebufferiv;
+	glad_glClearNamedFramebufferuiv = lazy_glClearNamedFramebufferuiv;
+	glad_glClearNamedFramebufferfv = lazy_glClearNamedFramebufferfv;
+	glad_glClearNamedFramebufferfi = lazy_glClearNamedFramebufferfi;
+	glad_glBlitNamedFramebuffer = lazy_glBlitNamedFramebuffer;
+	glad_glCheckNamedFramebufferStatus = lazy_glCheckNamedFramebufferStatus;
+	glad_glGetNamedFramebufferParameteriv = lazy_glGetNamedFramebufferParameteriv;
+	glad_glGetNamedFramebufferAttachmentParameteriv = lazy_glGetNamedFramebufferAttachmentParameteriv;
+	glad_glCreateRenderbuffers = lazy_glCreateRenderbuffers;
+	glad_glNamedRenderbufferStorage = lazy_glNamedRenderbufferStorage;
+	glad_glNamedRenderbufferStorageMultisample = lazy_glNamedRenderbufferStorageMultisample;
+	glad_glGetNamedRenderbufferParameteriv = lazy_glGetNamedRenderbufferParameteriv;
+	glad_glCreateTextures = lazy_glCreateTextures;
+	glad_glTextureBuffer = lazy_glTextureBuffer;
+	glad_glTextureBufferRange = lazy_glTextureBufferRange;
+	glad_glTextureStorage1D = lazy_glTextureStorage1D;
+	glad_glTextureStorage2D = lazy_glTextureStorage2D;
+	glad_glTextureStorage3D = lazy_glTextureStorage3D;
+	glad_glTextureStorage2DMultisample = lazy_glTextureStorage2DMultisample;
+	glad_glTextureStorage3DMultisample = lazy_glTextureStorage3DMultisample;
+	glad_glTextureSubImage1D = lazy_glTextureSubImage1D;
+	glad_glTextureSubImage2D = lazy_glTextureSubImage2D;
+	glad_glTextureSubImage3D = lazy_glTextureSubImage3D;
+	glad_glCompressedTextureSubImage1D = lazy_glCompressedTextureSubImage1D;
+	glad_glCompressedTextureSubImage2D = lazy_glCompressedTextureSubImage2D;
+	glad_glCompressedTextureSubImage3D = lazy_glCompressedTextureSubImage3D;
+	glad_glCopyTextureSubImage1D = lazy_glCopyTextureSubImage1D;
+	glad_glCopyTextureSubImage2D = lazy_glCopyTextureSubImage2D;
+	glad_glCopyTextureSubImage3D = lazy_glCopyTextureSubImage3D;
+	glad_glTextureParameterf = lazy_glTextureParameterf;
+	glad_glTextureParameterfv = lazy_glTextureParameterfv;
+	glad_glTextureParameteri = lazy_glTextureParameteri;
+	glad_glTextureParameterIiv = lazy_glTextureParameterIiv;
+	glad_glTextureParameterIuiv = lazy_glTextureParameterIuiv;
+	glad_glTextureParameteriv = lazy_glTextureParameteriv;
+	glad_glGenerateTextureMipmap = lazy_glGenerateTextureMipmap;
+	glad_glBindTextureUnit = lazy_glBindTextureUnit;
+	glad_glGetTextureImage = lazy_glGetTextureImage;
+	glad_glGetCompressedTextureImage = lazy_glGetCompressedTextureImage;
+	glad_glGetTextureLevelParameterfv = lazy_glGetTextureLevelParameterfv;
+	glad_glGetTextureLevelParameteriv = lazy_glGetTextureLevelParameteriv;
+	glad_glGetTextureParameterfv = lazy_glGetTextureParameterfv;
+	glad_glGetTextureParameterIiv = lazy_glGetTextureParameterIiv;
+	glad_glGetTextureParameterIuiv = lazy_glGetTextureParameterIuiv;
+	glad_glGetTextureParameteriv = lazy_glGetTextureParameteriv;
+	glad_glCreateVertexArrays = lazy_glCreateVertexArrays;
+	glad_glDisableVertexArrayAttrib = lazy_glDisableVertexArrayAttrib;
+	glad_glEnableVertexArrayAttrib = lazy_glEnableVertexArrayAttrib;
+	glad_glVertexArrayElementBuffer = lazy_glVertexArrayElementBuffer;
+	glad_glVertexArrayVertexBuffer = lazy_glVertexArrayVertexBuffer;
+	glad_glVertexArrayVertexBuffers = lazy_glVertexArrayVertexBuffers;
+	glad_glVertexArrayAttribBinding = lazy_glVertexArrayAttribBinding;
+	glad_glVertexArrayAttribFormat = lazy_glVertexArrayAttribFormat;
+	glad_glVertexArrayAttribIFormat = lazy_glVertexArrayAttribIFormat;
+	glad_glVertexArrayAttribLFormat = lazy_glVertexArrayAttribLFormat;
+	glad_glVertexArrayBindingDivisor = lazy_glVertexArrayBindingDivisor;
+	glad_glGetVertexArrayiv = lazy_glGetVertexArrayiv;
+	glad_glGetVertexArrayIndexediv = lazy_glGetVertexArrayIndexediv;
+	glad_glGetVertexArrayIndexed64iv = lazy_glGetVertexArrayIndexed64iv;
+	glad_glCreateSamplers = lazy_glCreateSamplers;
+	glad_glCreateProgramPipelines = lazy_glCreateProgramPipelines;
+	glad_glCreateQueries = lazy_glCreateQueries;
+	glad_glGetQueryBufferObjecti64v = lazy_glGetQueryBufferObjecti64v;
+	glad_glGetQueryBufferObjectiv = lazy_glGetQueryBufferObjectiv;
+	glad_glGetQueryBufferObjectui64v = lazy_glGetQueryBufferObjectui64v;
+	glad_glGetQueryBufferObjectuiv = lazy_glGetQueryBufferObjectuiv;
+	glad_glMemoryBarrierByRegion = lazy_glMemoryBarrierByRegion;
+	glad_glGetTextureSubImage = lazy_glGetTextureSubImage;
+	glad_glGetCompressedTextureSubImage = lazy_glGetCompressedTextureSubImage;
+	glad_glGetGraphicsResetStatus = lazy_glGetGraphicsResetStatus;
+	glad_glGetnCompressedTexImage = lazy_glGetnCompressedTexImage;
+	glad_glGetnTexImage = lazy_glGetnTexImage;
+	glad_glGetnUniformdv = lazy_glGetnUniformdv;
+	glad_glGetnUniformfv = lazy_glGetnUniformfv;
+	glad_glGetnUniformiv = lazy_glGetnUniformiv;
+	glad_glGetnUniformuiv = lazy_glGetnUniformuiv;
+	glad_glReadnPixels = lazy_glReadnPixels;
+#ifndef GLAD_CORE_PROFILE
+	glad_glGetnMapdv = lazy_glGetnMapdv;
+	glad_glGetnMapfv = lazy_glGetnMapfv;
+	glad_glGetnMapiv = lazy_glGetnMapiv;
+	glad_glGetnPixelMapfv = lazy_glGetnPixelMapfv;
+	glad_glGetnPixelMapuiv = lazy_glGetnPixelMapuiv;
+	glad_glGetnPixelMapusv = lazy_glGetnPixelMapusv;
+	glad_glGetnPolygonStipple = lazy_glGetnPolygonStipple;
+	glad_glGetnColorTable = lazy_glGetnColorTable;
+	glad_glGetnConvolutionFilter = lazy_glGetnConvolutionFilter;
+	glad_glGetnSeparableFilter = lazy_glGetnSeparableFilter;
+	glad_glGetnHistogram = lazy_glGetnHistogram;
+	glad_glGetnMinmax = lazy_glGetnMinmax;
+#endif
+	glad_glTextureBarrier = lazy_glTextureBarrier;
+#ifndef GLAD_CORE_PROFILE
+	glad_glTbufferMask3DFX = lazy_glTbufferMask3DFX;
+	glad_glDebugMessageEnableAMD = lazy_glDebugMessageEnableAMD;
+	glad_glDebugMessageInsertAMD = lazy_glDebugMessageInsertAMD;
+	glad_glDebugMessageCallbackAMD = lazy_glDebugMessageCallbackAMD;
+	glad_glGetDebugMessageLogAMD = lazy_glGetDebugMessageLogAMD;
+	glad_glBlendFuncIndexedAMD = lazy_glBlendFuncIndexedAMD;
+	glad_glBlendFuncSeparateIndexedAMD = lazy_glBlendFuncSeparateIndexedAMD;
+	glad_glBlendEquationIndexedAMD = lazy_glBlendEquationIndexedAMD;
+	glad_glBlendEquationSeparateIndexedAMD = lazy_glBlendEquationSeparateIndexedAMD;
+	glad_glRenderbufferStorageMultisampleAdvancedAMD = lazy_glRenderbufferStorageMultisampleAdvancedAMD;
+	glad_glNamedRenderbufferStorageMultisampleAdvancedAMD = lazy_glNamedRenderbufferStorageMultisampleAdvancedAMD;
+	glad_glFramebufferSamplePositionsfvAMD = lazy_glFramebufferSamplePositionsfvAMD;
+	glad_glNamedFramebufferSamplePositionsfvAMD = lazy_glNamedFramebufferSamplePositionsfvAMD;
+	glad_glGetFramebufferParameterfvAMD = lazy_glGetFramebufferParameterfvAMD;
+	glad_glGetNamedFramebufferParameterfvAMD = lazy_glGetNamedFramebufferParameterfvAMD;
+	glad_glUniform1i64NV = lazy_glUniform1i64NV;
+	glad_glUniform2i64NV = lazy_glUniform2i64NV;
+	glad_glUniform3i64NV = lazy_glUniform3i64NV;
+	glad_glUniform4i64NV = lazy_glUniform4i64NV;
+	glad_glUniform1i64vNV = lazy_glUniform1i64vNV;
+	glad_glUniform2i64vNV = lazy_glUniform2i64vNV;
+	glad_glUniform3i64vNV = lazy_glUniform3i64vNV;
+	glad_glUniform4i64vNV = lazy_glUniform4i64vNV;
+	glad_glUniform1ui64NV = lazy_glUniform1ui64NV;
+	glad_glUniform2ui64NV = lazy_glUniform2ui64NV;
+	glad_glUniform3ui64NV = lazy_glUniform3ui64NV;
+	glad_glUniform4ui64NV = lazy_glUniform4ui64NV;
+	glad_glUniform1ui64vNV = lazy_glUniform1ui64vNV;
+	glad_glUniform2ui64vNV = lazy_glUniform2ui64vNV;
+	glad_glUniform3ui64vNV = lazy_glUniform3ui64vNV;
+	glad_glUniform4ui64vNV = lazy_glUniform4ui64vNV;
+	glad_glGetUniformi64vNV = lazy_glGetUniformi64vNV;
+	glad_glGetUniformui64vNV = lazy_glGetUniformui64vNV;
+	glad_glProgramUniform1i64NV = lazy_glProgramUniform1i64NV;
+	glad_glProgramUniform2i64NV = lazy_glProgramUniform2i64NV;
+	glad_glProgramUniform3i64NV = lazy_glProgramUniform3i64NV;
+	glad_glProgramUniform4i64NV = lazy_glProgramUniform4i64NV;
+	glad_glProgramUniform1i64vNV = lazy_glProgramUniform1i64vNV;
+	glad_glProgramUniform2i64vNV = lazy_glProgramUniform2i64vNV;
+	glad_glProgramUniform3i64vNV = lazy_glProgramUniform3i64vNV;
+	glad_glProgramUniform4i64vNV = lazy_glProgramUniform4i64vNV;
+	glad_glProgramUniform1ui64NV = lazy_glProgramUniform1ui64NV;
+	glad_glProgramUniform2ui64NV = lazy_glProgramUniform2ui64NV;
+	glad_glProgramUniform3ui64NV = lazy_glProgramUniform3ui64NV;
+	glad_glProgramUniform4ui64NV = lazy_glProgramUniform4ui64NV;
+	glad_glProgramUniform1ui64vNV = lazy_glProgramUniform1ui64vNV;
+	glad_glProgramUniform2ui64vNV = lazy_glProgramUniform2ui64vNV;
+	glad_glProgramUniform3ui64vNV = lazy_glProgramUniform3ui64vNV;
+	glad_glProgramUniform4ui64vNV = lazy_glProgramUniform4ui64vNV;
+	glad_glVertexAttribParameteriAMD = lazy_glVertexAttribParameteriAMD;
+	glad_glMultiDrawArraysIndirectAMD = lazy_glMultiDrawArraysIndirectAMD;
+	glad_glMultiDrawElementsIndirectAMD = lazy_glMultiDrawElementsIndirectAMD;
+	glad_glGenNamesAMD = lazy_glGenNamesAMD;
+	glad_glDeleteNamesAMD = lazy_glDeleteNamesAMD;
+	glad_glIsNameAMD = lazy_glIsNameAMD;
+	glad_glQueryObjectParameteruiAMD = lazy_glQueryObjectParameteruiAMD;
+	glad_glGetPerfMonitorGroupsAMD = lazy_glGetPerfMonitorGroupsAMD;
+	glad_glGetPerfMonitorCountersAMD = lazy_glGetPerfMonitorCountersAMD;
+	glad_glGetPerfMonitorGroupStringAMD = lazy_glGetPerfMonitorGroupStringAMD;
+	glad_glGetPerfMonitorCounterStringAMD = lazy_glGetPerfMonitorCounterStringAMD;
+	glad_glGetPerfMonitorCounterInfoAMD = lazy_glGetPerfMonitorCounterInfoAMD;
+	glad_glGenPerfMonitorsAMD = lazy_glGenPerfMonitorsAMD;
+	glad_glDeletePerfMonitorsAMD = lazy_glDeletePerfMonitorsAMD;
+	glad_glSelectPerfMonitorCountersAMD = lazy_glSelectPerfMonitorCountersAMD;
+	glad_glBeginPerfMonitorAMD = lazy_glBeginPerfMonitorAMD;
+	glad_glEndPerfMonitorAMD = lazy_glEndPerfMonitorAMD;
+	glad_glGetPerfMonitorCounterDataAMD = lazy_glGetPerfMonitorCounterDataAMD;
+	glad_glSetMultisamplefvAMD = lazy_glSetMultisamplefvAMD;
+	glad_glTexStorageSparseAMD = lazy_glTexStorageSparseAMD;
+	glad_glTextureStorageSparseAMD = lazy_glTextureStorageSparseAMD;
+	glad_glStencilOpValueAMD = lazy_glStencilOpValueAMD;
+	glad_glTessellationFactorAMD = lazy_glTessellationFactorAMD;
+	glad_glTessellationModeAMD = lazy_glTessellationModeAMD;
+	glad_glElementPointerAPPLE = lazy_glElementPointerAPPLE;
+	glad_glDrawElementArrayAPPLE = lazy_glDrawElementArrayAPPLE;
+	glad_glDrawRangeElementArrayAPPLE = lazy_glDrawRangeElementArrayAPPLE;
+	glad_glMultiDrawElementArrayAPPLE = lazy_glMultiDrawElementArrayAPPLE;
+	glad_glMultiDrawRangeElementArrayAPPLE = lazy_glMultiDrawRangeElementArrayAPPLE;
+	glad_glGenFencesAPPLE = lazy_glGenFencesAPPLE;
+	glad_glDeleteFencesAPPLE = lazy_glDeleteFencesAPPLE;
+	glad_glSetFenceAPPLE = lazy_glSetFenceAPPLE;
+	glad_glIsFenceAPPLE = lazy_glIsFenceAPPLE;
+	glad_glTestFenceAPPLE = lazy_glTestFenceAPPLE;
+	glad_glFinishFenceAPPLE = lazy_glFinishFenceAPPLE;
+	glad_glTestObjectAPPLE = lazy_glTestObjectAPPLE;
+	glad_glFinishObjectAPPLE = lazy_glFinishObjectAPPLE;
+	glad_glBufferParameteriAPPLE = lazy_glBufferParameteriAPPLE;
+	glad_glFlushMappedBufferRangeAPPLE = lazy_glFlushMappedBufferRangeAPPLE;
+	glad_glObjectPurgeableAPPLE = lazy_glObjectPurgeableAPPLE;
+	glad_glObjectUnpurgeableAPPLE = lazy_glObjectUnpurgeableAPPLE;
+	glad_glGetObjectParameterivAPPLE = lazy_glGetObjectParameterivAPPLE;
+	glad_glTextureRangeAPPLE = lazy_glTextureRangeAPPLE;
+	glad_glGetTexParameterPointervAPPLE = lazy_glGetTexParameterPointervAPPLE;
+	glad_glBindVertexArrayAPPLE = lazy_glBindVertexArrayAPPLE;
+	glad_glDeleteVertexArraysAPPLE = lazy_glDeleteVertexArraysAPPLE;
+	glad_glGenVertexArraysAPPLE = lazy_glGenVertexArraysAPPLE;
+	glad_glIsVertexArrayAPPLE = lazy_glIsVertexArrayAPPLE;
+	glad_glVertexArrayRangeAPPLE = lazy_glVertexArrayRangeAPPLE;
+	glad_glFlushVertexArrayRangeAPPLE = lazy_glFlushVertexArrayRangeAPPLE;
+	glad_glVertexArrayParameteriAPPLE = lazy_glVertexArrayParameteriAPPLE;
+	glad_glEnableVertexAttribAPPLE = lazy_glEnableVertexAttribAPPLE;
+	glad_glDisableVertexAttribAPPLE = lazy_glDisableVertexAttribAPPLE;
+	glad_glIsVertexAttribEnabledAPPLE = lazy_glIsVertexAttribEnabledAPPLE;
+	glad_glMapVertexAttrib1dAPPLE = lazy_glMapVertexAttrib1dAPPLE;
+	glad_glMapVertexAttrib1fAPPLE = lazy_glMapVertexAttrib1fAPPLE;
+	glad_glMapVertexAttrib2dAPPLE = lazy_glMapVertexAttrib2dAPPLE;
+	glad_glMapVertexAttrib2fAPPLE = lazy_glMapVertexAttrib2fAPPLE;
+	glad_glPrimitiveBoundingBoxARB = lazy_glPrimitiveBoundingBoxARB;
+#endif
+	glad_glGetTextureHandleARB = lazy_glGetTextureHandleARB;
+	glad_glGetTextureSamplerHandleARB = lazy_glGetTextureSamplerHandleARB;
+	glad_glMakeTextureHandleResidentARB = lazy_glMakeTextureHandleResidentARB;
+	glad_glMakeTextureHandleNonResidentARB = lazy_glMakeTextureHandleNonResidentARB;
+	glad_glGetImageHandleARB = lazy_glGetImageHandleARB;
+	glad_glMakeImageHandleResidentARB = lazy_glMakeImageHandleResidentARB;
+	glad_glMakeImageHandleNonResidentARB = lazy_glMakeImageHandleNonResidentARB;
+	glad_glUniformHandleui64ARB = lazy_glUniformHandleui64ARB;
+	glad_glUniformHandleui64vARB = lazy_glUniformHandleui64vARB;
+	glad_glProgramUniformHandleui64ARB = lazy_glProgramUniformHandleui64ARB;
+	glad_glProgramUniformHandleui64vARB = lazy_glProgramUniformHandleui64vARB;
+	glad_glIsTextureHandleResidentARB = lazy_glIsTextureHandleResidentARB;
+	glad_glIsImageHandleResidentARB = lazy_glIsImageHandleResidentARB;
+	glad_glVertexAttribL1ui64ARB = lazy_glVertexAttribL1ui64ARB;
+	glad_glVertexAttribL1ui64vARB = lazy_glVertexAttribL1ui64vARB;
+	glad_glGetVertexAttribLui64vARB = lazy_glGetVertexAttribLui64vARB;
+#ifndef GLAD_CORE_PROFILE
+	glad_glCreateSyncFromCLeventARB = lazy_glCreateSyncFromCLeventARB;
+	glad_glClampColorARB = lazy_glClampColorARB;
+	glad_glDispatchComputeGroupSizeARB = lazy_glDispatchComputeGroupSizeARB;
+	glad_glDebugMessageControlARB = lazy_glDebugMessageControlARB;
+	glad_glDebugMessageInsertARB = lazy_glDebugMessageInsertARB;
+	glad_glDebugMessageCallbackARB = lazy_glDebugMessageCallbackARB;
+	glad_glGetDebugMessageLogARB = lazy_glGetDebugMessageLogARB;
+	glad_glDrawBuffersARB = lazy_glDrawBuffersARB;
+	glad_glBlendEquationiARB = lazy_glBlendEquationiARB;
+	glad_glBlendEquationSeparateiARB = lazy_glBlendEquationSeparateiARB;
+	glad_glBlendFunciARB = lazy_glBlendFunciARB;
+	glad_glBlendFuncSeparateiARB = lazy_glBlendFuncSeparateiARB;
+	glad_glDrawArraysInstancedARB = lazy_glDrawArraysInstancedARB;
+	glad_glDrawElementsInstancedARB = lazy_glDrawElementsInstancedARB;
+	glad_glProgramStringARB = lazy_glProgramStringARB;
+	glad_glBindProgramARB = lazy_glBindProgramARB;
+	glad_glDeleteProgramsARB = lazy_glDeleteProgramsARB;
+	glad_glGenProgramsARB = lazy_glGenProgramsARB;
+	glad_glProgramEnvParameter4dARB = lazy_glProgramEnvParameter4dARB;
+	glad_glProgramEnvParameter4dvARB = lazy_glProgramEnvParameter4dvARB;
+	glad_glProgramEnvParameter4fARB = lazy_glProgramEnvParameter4fARB;
+	glad_glProgramEnvParameter4fvARB = lazy_glProgramEnvParameter4fvARB;
+	glad_glProgramLocalParameter4dARB = lazy_glProgramLocalParameter4dARB;
+	glad_glProgramLocalParameter4dvARB = lazy_glProgramLocalParameter4dvARB;
+	glad_glProgramLocalParameter4fARB = lazy_glProgramLocalParameter4fARB;
+	glad_glProgramLocalParameter4fvARB = lazy_glProgramLocalParameter4fvARB;
+	glad_glGetProgramEnvParameterdvARB = lazy_glGetProgramEnvParameterdvARB;
+	glad_glGetProgramEnvParameterfvARB = lazy_glGetProgramEnvParameterfvARB;
+	glad_glGetProgramLocalParameterdvARB = lazy_glGetProgramLocalParameterdvARB;
+	glad_glGetProgramLocalParameterfvARB = lazy_glGetProgramLocalParameterfvARB;
+	glad_glGetProgramivARB = lazy_glGetProgramivARB;
+	glad_glGetProgramStringARB = lazy_glGetProgramStringARB;
+	glad_glIsProgramARB = lazy_glIsProgramARB;
+	glad_glProgramParameteriARB = lazy_glProgramParameteriARB;
+	glad_glFramebufferTextureARB = lazy_glFramebufferTextureARB;
+	glad_glFramebufferTextureLayerARB = lazy_glFramebufferTextureLayerARB;
+	glad_glFramebufferTextureFaceARB = lazy_glFramebufferTextureFaceARB;
+#endif
+	glad_glSpecializeShaderARB = lazy_glSpecializeShaderARB;
+#ifndef GLAD_CORE_PROFILE
+	glad_glUniform1i64ARB = lazy_glUniform1i64ARB;
+	glad_glUniform2i64ARB = lazy_glUniform2i64ARB;
+	glad_glUniform3i64ARB = lazy_glUniform3i64ARB;
+	glad_glUniform4i64ARB = lazy_glUniform4i64ARB;
+	glad_glUniform1i64vARB = lazy_glUniform1i64vARB;
+	glad_glUniform2i64vARB = lazy_glUniform2i64vARB;
+	glad_glUniform3i64vARB = lazy_glUniform3i64vARB;
+	glad_glUniform4i64vARB = lazy_glUniform4i64vARB;
+	glad_glUniform1ui64ARB = lazy_glUniform1ui64ARB;
+	glad_glUniform2ui64ARB = lazy_glUniform2ui64ARB;
+	glad_glUniform3ui64ARB = lazy_glUniform3ui64ARB;
+	glad_glUniform4ui64ARB = lazy_glUniform4ui64ARB;
+	glad_glUniform1ui64vARB = lazy_glUniform1ui64vARB;
+	glad_glUniform2ui64vARB = lazy_glUniform2ui64vARB;
+	glad_glUniform3ui64vARB = lazy_glUniform3ui64vARB;
+	glad_glUniform4ui64vARB = lazy_glUniform4ui64vARB;
+	glad_glGetUniformi64vARB = lazy_glGetUniformi64vARB;
+	glad_glGetUniformui64vARB = lazy_glGetUniformui64vARB;
+	glad_glGetnUniformi64vARB = lazy_glGetnUniformi64vARB;
+	glad_glGetnUniformui64vARB = lazy_glGetnUniformui64vARB;
+	glad_glProgramUniform1i64ARB = lazy_glProgramUniform1i64ARB;
+	glad_glProgramUniform2i64ARB = lazy_glProgramUniform2i64ARB;
+	glad_glProgramUniform3i64ARB = lazy_glProgramUniform3i64ARB;
+	glad_glProgramUniform4i64ARB = lazy_glProgramUniform4i64ARB;
+	glad_glProgramUniform1i64vARB = lazy_glProgramUniform1i64vARB;
+	glad_glProgramUniform2i64vARB = lazy_glProgramUniform2i64vARB;
+	glad_glProgramUniform3i64vARB = lazy_glProgramUniform3i64vARB;
+	glad_glProgramUniform4i64vARB = lazy_glProgramUniform4i64vARB;
+	glad_glProgramUniform1ui64ARB = lazy_glProgramUniform1ui64ARB;
+	glad_glProgramUniform2ui64ARB = lazy_glProgramUniform2ui64ARB;
+	glad_glProgramUniform3ui64ARB = lazy_glProgramUniform3ui64ARB;
+	glad_glProgramUniform4ui64ARB = lazy_glProgramUniform4ui64ARB;
+	glad_glProgramUniform1ui64vARB = lazy_glProgramUniform1ui64vARB;
+	glad_glProgramUniform2ui64vARB = lazy_glProgramUniform2ui64vARB;
+	glad_glProgramUniform3ui64vARB = lazy_glProgramUniform3ui64vARB;
+	glad_glProgramUniform4ui64vARB = lazy_glProgramUniform4ui64vARB;
+	glad_glColorTable = lazy_glColorTable;
+	glad_glColorTableParameterfv = lazy_glColorTableParameterfv;
+	glad_glColorTableParameteriv = lazy_glColorTableParameteriv;
+	glad_glCopyColorTable = lazy_glCopyColorTable;
+	glad_glGetColorTable = lazy_glGetColorTable;
+	glad_glGetColorTableParameterfv = lazy_glGetColorTableParameterfv;
+	glad_glGetColorTableParameteriv = lazy_glGetColorTableParameteriv;
+	glad_glColorSubTable = lazy_glColorSubTable;
+	glad_glCopyColorSubTable = lazy_glCopyColorSubTable;
+	glad_glConvolutionFilter1D = lazy_glConvolutionFilter1D;
+	glad_glConvolutionFilter2D = lazy_glConvolutionFilter2D;
+	glad_glConvolutionParameterf = lazy_glConvolutionParameterf;
+	glad_glConvolutionParameterfv = lazy_glConvolutionParameterfv;
+	glad_glConvolutionParameteri = lazy_glConvolutionParameteri;
+	glad_glConvolutionParameteriv = lazy_glConvolutionParameteriv;
+	glad_glCopyConvolutionFilter1D = lazy_glCopyConvolutionFilter1D;
+	glad_glCopyConvolutionFilter2D = lazy_glCopyConvolutionFilter2D;
+	glad_glGetConvolutionFilter = lazy_glGetConvolutionFilter;
+	glad_glGetConvolutionParameterfv = lazy_glGetConvolutionParameterfv;
+	glad_glGetConvolutionParameteriv = lazy_glGetConvolutionParameteriv;
+	glad_glGetSeparableFilter = lazy_glGetSeparableFilter;
+	glad_glSeparableFilter2D = lazy_glSeparableFilter2D;
+	glad_glGetHistogram = lazy_glGetHistogram;
+	glad_glGetHistogramParameterfv = lazy_glGetHistogramParameterfv;
+	glad_glGetHistogramParameteriv = lazy_glGetHistogramParameteriv;
+	glad_glGetMinmax = lazy_glGetMinmax;
+	glad_glGetMinmaxParameterfv = lazy_glGetMinmaxParameterfv;
+	glad_glGetMinmaxParameteriv = lazy_glGetMinmaxParameteriv;
+	glad_glHistogram = lazy_glHistogram;
+	glad_glMinmax = lazy_glMinmax;
+	glad_glResetHistogram = lazy_glResetHistogram;
+	glad_glResetMinmax = lazy_glResetMinmax;
+#endif
+	glad_glMultiDrawArraysIndirectCountARB = lazy_glMultiDrawArraysIndirectCountARB;
+	glad_glMultiDrawElementsIndirectCountARB = lazy_glMultiDrawElementsIndirectCountARB;
+#ifndef GLAD_CORE_PROFILE
+	glad_glVertexAttribDivisorARB = lazy_glVertexAttribDivisorARB;
+	glad_glCurrentPaletteMatrixARB = lazy_glCurrentPaletteMatrixARB;
+	glad_glMatrixIndexubvARB = lazy_glMatrixIndexubvARB;
+	glad_glMatrixIndexusvARB = lazy_glMatrixIndexusvARB;
+	glad_glMatrixIndexuivARB = lazy_glMatrixIndexuivARB;
+	glad_glMatrixIndexPointerARB = lazy_glMatrixIndexPointerARB;
+	glad_glSampleCoverageARB = lazy_glSampleCoverageARB;
+	glad_glActiveTextureARB = lazy_glActiveTextureARB;
+	glad_glClientActiveTextureARB = lazy_glClientActiveTextureARB;
+	glad_glMultiTexCoord1dARB = lazy_glMultiTexCoord1dARB;
+	glad_glMultiTexCoord1dvARB = lazy_glMultiTexCoord1dvARB;
+	glad_glMultiTexCoord1fARB = lazy_glMultiTexCoord1fARB;
+	glad_glMultiTexCoord1fvARB = lazy_glMultiTexCoord1fvARB;
+	glad_glMultiTexCoord1iARB = lazy_glMultiTexCoord1iARB;
+	glad_glMultiTexCoord1ivARB = lazy_glMultiTexCoord1ivARB;
+	glad_glMultiTexCoord1sARB = lazy_glMultiTexCoord1sARB;
+	glad_glMultiTexCoord1svARB = lazy_glMultiTexCoord1svARB;
+	glad_glMultiTexCoord2dARB = lazy_glMultiTexCoord2dARB;
+	glad_glMultiTexCoord2dvARB = lazy_glMultiTexCoord2dvARB;
+	glad_glMultiTexCoord2fARB = lazy_glMultiTexCoord2fARB;
+	glad_glMultiTexCoord2fvARB = lazy_glMultiTexCoord2fvARB;
+	glad_glMultiTexCoord2iARB = lazy_glMultiTexCoord2iARB;
+	glad_glMultiTexCoord2ivARB = lazy_glMultiTexCoord2ivARB;
+	glad_glMultiTexCoord2sARB = lazy_glMultiTexCoord2sARB;
+	glad_glMultiTexCoord2svARB = lazy_glMultiTexCoord2svARB;
+	glad_glMultiTexCoord3dARB = lazy_glMultiTexCoord3dARB;
+	glad_glMultiTexCoord3dvARB = lazy_glMultiTexCoord3dvARB;
+	glad_glMultiTexCoord3fARB = lazy_glMultiTexCoord3fARB;
+	glad_glMultiTexCoord3fvARB = lazy_glMultiTexCoord3fvARB;
+	glad_glMultiTexCoord3iARB = lazy_glMultiTexCoord3iARB;
+	glad_glMultiTexCoord3ivARB = lazy_glMultiTexCoord3ivARB;
+	glad_glMultiTexCoord3sARB = lazy_glMultiTexCoord3sARB;
+	glad_glMultiTexCoord3svARB = lazy_glMultiTexCoord3svARB;
+	glad_glMultiTexCoord4dARB = lazy_glMultiTexCoord4dARB;
+	glad_glMultiTexCoord4dvARB = lazy_glMultiTexCoord4dvARB;
+	glad_glMultiTexCoord4fARB = lazy_glMultiTexCoord4fARB;
+	glad_glMultiTexCoord4fvARB = lazy_glMultiTexCoord4fvARB;
+	glad_glMultiTexCoord4iARB = lazy_glMultiTexCoord4iARB;
+	glad_glMultiTexCoord4ivARB = lazy_glMultiTexCoord4ivARB;
+	glad_glMultiTexCoord4sARB = lazy_glMultiTexCoord4sARB;
+	glad_glMultiTexCoord4svARB = lazy_glMultiTexCoord4svARB;
+	glad_glGenQueriesARB = lazy_glGenQueriesARB;
+	glad_glDeleteQueriesARB = lazy_glDeleteQueriesARB;
+	glad_glIsQueryARB = lazy_glIsQueryARB;
+	glad_glBeginQueryARB = lazy_glBeginQueryARB;
+	glad_glEndQueryARB = lazy_glEndQueryARB;
+	glad_glGetQueryivARB = lazy_glGetQueryivARB;
+	glad_glGetQueryObjectivARB = lazy_glGetQueryObjectivARB;
+	glad_glGetQueryObjectuivARB = lazy_glGetQueryObjectuivARB;
+#endif
+	glad_glMaxShaderCompilerThreadsARB = lazy_glMaxShaderCompilerThreadsARB;
+#ifndef GLAD_CORE_PROFILE
+	glad_glPointParameterfARB = lazy_glPointParameterfARB;
+	glad_glPointParameterfvARB = lazy_glPointParameterfvARB;
+#endif
+	glad_glPolygonOffsetClamp = lazy_glPolygonOffsetClamp;
+#ifndef GLAD_CORE_PROFILE
+	glad_glGetGraphicsResetStatusARB = lazy_glGetGraphicsResetStatusARB;
+	glad_glGetnTexImageARB = lazy_glGetnTexImageARB;
+	glad_glReadnPixelsARB = lazy_glReadnPixelsARB;
+	glad_glGetnCompressedTexImageARB = lazy_glGetnCompressedTexImageARB;
+	glad_glGetnUniformfvARB = lazy_glGetnUniformfvARB;
+	glad_glGetnUniformivARB = lazy_glGetnUniformivARB;
+	glad_glGetnUniformuivARB = lazy_glGetnUniformuivARB;
+	glad_glGetnUniformdvARB = lazy_glGetnUniformdvARB;
+	glad_glGetnMapdvARB = lazy_glGetnMapdvARB;
+	glad_glGetnMapfvARB = lazy_glGetnMapfvARB;
+	glad_glGetnMapivARB = lazy_glGetnMapivARB;
+	glad_glGetnPixelMapfvARB = lazy_glGetnPixelMapfvARB;
+	glad_glGetnPixelMapuivARB = lazy_glGetnPixelMapuivARB;
+	glad_glGetnPixelMapusvARB = lazy_glGetnPixelMapusvARB;
+	glad_glGetnPolygonStippleARB = lazy_glGetnPolygonStippleARB;
+	glad_glGetnColorTableARB = lazy_glGetnColorTableARB;
+	glad_glGetnConvolutionFilterARB = lazy_glGetnConvolutionFilterARB;
+	glad_glGetnSeparableFilterARB = lazy_glGetnSeparableFilterARB;
+	glad_glGetnHistogramARB = lazy_glGetnHistogramARB;
+	glad_glGetnMinmaxARB = lazy_glGetnMinmaxARB;
+	glad_glFramebufferSampleLocationsfvARB = lazy_glFramebufferSampleLocationsfvARB;
+	glad_glNamedFramebufferSampleLocationsfvARB = lazy_glNamedFramebufferSampleLocationsfvARB;
+	glad_glEvaluateDepthValuesARB = lazy_glEvaluateDepthValuesARB;
+	glad_glMinSampleShadingARB = lazy_glMinSampleShadingARB;
+	glad_glDeleteObjectARB = lazy_glDeleteObjectARB;
+	glad_glGetHandleARB = lazy_glGetHandleARB;
+	glad_glDetachObjectARB = lazy_glDetachObjectARB;
+	glad_glCreateShaderObjectARB = lazy_glCreateShaderObjectARB;
+	glad_glShaderSourceARB = lazy_glShaderSourceARB;
+	glad_glCompileShaderARB = lazy_glCompileShaderARB;
+	glad_glCreateProgramObjectARB = lazy_glCreateProgramObjectARB;
+	glad_glAttachObjectARB = lazy_glAttachObjectARB;
+	glad_glLinkProgramARB = lazy_glLinkProgramARB;
+	glad_glUseProgramObjectARB = lazy_glUseProgramObjectARB;
+	glad_glValidateProgramARB = lazy_glValidateProgramARB;
+	glad_glUniform1fARB = lazy_glUniform1fARB;
+	glad_glUniform2fARB = lazy_glUniform2fARB;
+	glad_glUniform3fARB = lazy_glUniform3fARB;
+	glad_glUniform4fARB = lazy_glUniform4fARB;
+	glad_glUniform1iARB = lazy_glUniform1iARB;
+	glad_glUniform2iARB = lazy_glUniform2iARB;
+	glad_glUniform3iARB = lazy_glUniform3iARB;
+	glad_glUniform4iARB = lazy_glUniform4iARB;
+	glad_glUniform1fvARB = lazy_glUniform1fvARB;
+	glad_glUniform2fvARB = lazy_glUniform2fvARB;
+	glad_glUniform3fvARB = lazy_glUniform3fvARB;
+	glad_glUniform4fvARB = lazy_glUniform4fvARB;
+	glad_glUniform1ivARB = lazy_glUniform1ivARB;
+	glad_glUniform2ivARB = lazy_glUniform2ivARB;
+	glad_glUniform3ivARB = lazy_glUniform3ivARB;
+	glad_glUniform4ivARB = lazy_glUniform4ivARB;
+	glad_glUniformMatrix2fvARB = lazy_glUniformMatrix2fvARB;
+	glad_glUniformMatrix3fvARB = lazy_glUniformMatrix3fvARB;
+	glad_glUniformMatrix4fvARB = lazy_glUniformMatrix4fvARB;
+	glad_glGetObjectParameterfvARB = lazy_glGetObjectParameterfvARB;
+	glad_glGetObjectParameterivARB = lazy_glGetObjectParameterivARB;
+	glad_glGetInfoLogARB = lazy_glGetInfoLogARB;
+	glad_glGetAttachedObjectsARB = lazy_glGetAttachedObjectsARB;
+	glad_glGetUniformLocationARB = lazy_glGetUniformLocationARB;
+	glad_glGetActiveUniformARB = lazy_glGetActiveUniformARB;
+	glad_glGetUniformfvARB = lazy_glGetUniformfvARB;
+	glad_glGetUniformivARB = lazy_glGetUniformivARB;
+	glad_glGetShaderSourceARB = lazy_glGetShaderSourceARB;
+	glad_glNamedStringARB = lazy_glNamedStringARB;
+	glad_glDeleteNamedStringARB = lazy_glDeleteNamedStringARB;
+	glad_glCompileShaderIncludeARB = lazy_glCompileShaderIncludeARB;
+	glad_glIsNamedStringARB = lazy_glIsNamedStringARB;
+	glad_glGetNamedStringARB = lazy_glGetNamedStringARB;
+	glad_glGetNamedStringivARB = lazy_glGetNamedStringivARB;
+#endif
+	glad_glBufferPageCommitmentARB = lazy_glBufferPageCommitmentARB;
+	glad_glNamedBufferPageCommitmentEXT = lazy_glNamedBufferPageCommitmentEXT;
+	glad_glNamedBufferPageCommitmentARB = lazy_glNamedBufferPageCommitmentARB;
+	glad_glTexPageCommitmentARB = lazy_glTexPageCommitmentARB;
+#ifndef GLAD_CORE_PROFILE
+	glad_glTexBufferARB = lazy_glTexBufferARB;
+	glad_glCompressedTexImage3DARB = lazy_glCompressedTexImage3DARB;
+	glad_glCompressedTexImage2DARB = lazy_glCompressedTexImage2DARB;
+	glad_glCompressedTexImage1DARB = lazy_glCompressedTexImage1DARB;
+	glad_glCompressedTexSubImage3DARB = lazy_glCompressedTexSubImage3DARB;
+	glad_glCompressedTexSubImage2DARB = lazy_glCompressedTexSubImage2DARB;
+	glad_glCompressedTexSubImage1DARB = lazy_glCompressedTexSubImage1DARB;
+	glad_glGetCompressedTexImageARB = lazy_glGetCompressedTexImageARB;
+	glad_glLoadTransposeMatrixfARB = lazy_glLoadTransposeMatrixfARB;
+	glad_glLoadTransposeMatrixdARB = lazy_glLoadTransposeMatrixdARB;
+	glad_glMultTransposeMatrixfARB = lazy_glMultTransposeMatrixfARB;
+	glad_glMultTransposeMatrixdARB = lazy_glMultTransposeMatrixdARB;
+	glad_glWeightbvARB = lazy_glWeightbvARB;
+	glad_glWeightsvARB = lazy_glWeightsvARB;
+	glad_glWeightivARB = lazy_glWeightivARB;
+	glad_glWeightfvARB = lazy_glWeightfvARB;
+	glad_glWeightdvARB = lazy_glWeightdvARB;
+	glad_glWeightubvARB = lazy_glWeightubvARB;
+	glad_glWeightusvARB = lazy_glWeightusvARB;
+	glad_glWeightuivARB = lazy_glWeightuivARB;
+	glad_glWeightPointerARB = lazy_glWeightPointerARB;
+	glad_glVertexBlendARB = lazy_glVertexBlendARB;
+	glad_glBindBufferARB = lazy_glBindBufferARB;
+	glad_glDeleteBuffersARB = lazy_glDeleteBuffersARB;
+	glad_glGenBuffersARB = lazy_glGenBuffersARB;
+	glad_glIsBufferARB = lazy_glIsBufferARB;
+	glad_glBufferDataARB = lazy_glBufferDataARB;
+	glad_glBufferSubDataARB = lazy_glBufferSubDataARB;
+	glad_glGetBufferSubDataARB = lazy_glGetBufferSubDataARB;
+	glad_glMapBufferARB = lazy_glMapBufferARB;
+	glad_glUnmapBufferARB = lazy_glUnmapBufferARB;
+	glad_glGetBufferParameterivARB = lazy_glGetBufferParameterivARB;
+	glad_glGetBufferPointervARB = lazy_glGetBufferPointervARB;
+	glad_glVertexAttrib1dARB = lazy_glVertexAttrib1dARB;
+	glad_glVertexAttrib1dvARB = lazy_glVertexAttrib1dvARB;
+	glad_glVertexAttrib1fARB = lazy_glVertexAttrib1fARB;
+	glad_glVertexAttrib1fvARB = lazy_glVertexAttrib1fvARB;
+	glad_glVertexAttrib1sARB = lazy_glVertexAttrib1sARB;
+	glad_glVertexAttrib1svARB = lazy_glVertexAttrib1svARB;
+	glad_glVertexAttrib2dARB = lazy_glVertexAttrib2dARB;
+	glad_glVertexAttrib2dvARB = lazy_glVertexAttrib2dvARB;
+	glad_glVertexAttrib2fARB = lazy_glVertexAttrib2fARB;
+	glad_glVertexAttrib2fvARB = lazy_glVertexAttrib2fvARB;
+	glad_glVertexAttrib2sARB = lazy_glVertexAttrib2sARB;
+	glad_glVertexAttrib2svARB = lazy_glVertexAttrib2svARB;
+	glad_glVertexAttrib3dARB = lazy_glVertexAttrib3dARB;
+	glad_glVertexAttrib3dvARB = lazy_glVertexAttrib3dvARB;
+	glad_glVertexAttrib3fARB = lazy_glVertexAttrib3fARB;
+	glad_glVertexAttrib3fvARB = lazy_glVertexAttrib3fvARB;
+	glad_glVertexAttrib3sARB = lazy_glVertexAttrib3sARB;
+	glad_glVertexAttrib3svARB = lazy_glVertexAttrib3svARB;
+	glad_glVertexAttrib4NbvARB = lazy_glVertexAttrib4NbvARB;
+	glad_glVertexAttrib4NivARB = lazy_glVertexAttrib4NivARB;
+	glad_glVertexAttrib4NsvARB = lazy_glVertexAttrib4NsvARB;
+	glad_glVertexAttrib4NubARB = lazy_glVertexAttrib4NubARB;
+	glad_glVertexAttrib4NubvARB = lazy_glVertexAttrib4NubvARB;
+	glad_glVertexAttrib4NuivARB = lazy_glVertexAttrib4NuivARB;
+	glad_glVertexAttrib4NusvARB = lazy_glVertexAttrib4NusvARB;
+	glad_glVertexAttrib4bvARB = lazy_glVertexAttrib4bvARB;
+	glad_glVertexAttrib4dARB = lazy_glVertexAttrib4dARB;
+	glad_glVertexAttrib4dvARB = lazy_glVertexAttrib4dvARB;
+	glad_glVertexAttrib4fARB = lazy_glVertexAttrib4fARB;
+	glad_glVertexAttrib4fvARB = lazy_glVertexAttrib4fvARB;
+	glad_glVertexAttrib4ivARB = lazy_glVertexAttrib4ivARB;
+	glad_glVertexAttrib4sARB = lazy_glVertexAttrib4sARB;
+	glad_glVertexAttrib4svARB = lazy_glVertexAttrib4svARB;
+	glad_glVertexAttrib4ubvARB = lazy_glVertexAttrib4ubvARB;
+	glad_glVertexAttrib4uivARB = lazy_glVertexAttrib4uivARB;
+	glad_glVertexAttrib4usvARB = lazy_glVertexAttrib4usvARB;
+	glad_glVertexAttribPointerARB = lazy_glVertexAttribPointerARB;
+	glad_glEnableVertexAttribArrayARB = lazy_glEnableVertexAttribArrayARB;
+	glad_glDisableVertexAttribArrayARB = lazy_glDisableVertexAttribArrayARB;
+	glad_glGetVertexAttribdvARB = lazy_glGetVertexAttribdvARB;
+	glad_glGetVertexAttribfvARB = lazy_glGetVertexAttribfvARB;
+	glad_glGetVertexAttribivARB = lazy_glGetVertexAttribivARB;
+	glad_glGetVertexAttribPointervARB = lazy_glGetVertexAttribPointervARB;
+	glad_glBindAttribLocationARB = lazy_glBindAttribLocationARB;
+	glad_glGetActiveAttribARB = lazy_glGetActiveAttribARB;
+	glad_glGetAttribLocationARB = lazy_glGetAttribLocationARB;
+	glad_glDepthRangeArraydvNV = lazy_glDepthRangeArraydvNV;
+	glad_glDepthRangeIndexeddNV = lazy_glDepthRangeIndexeddNV;
+	glad_glWindowPos2dARB = lazy_glWindowPos2dARB;
+	glad_glWindowPos2dvARB = lazy_glWindowPos2dvARB;
+	glad_glWindowPos2fARB = lazy_glWindowPos2fARB;
+	glad_glWindowPos2fvARB = lazy_glWindowPos2fvARB;
+	glad_glWindowPos2iARB = lazy_glWindowPos2iARB;
+	glad_glWindowPos2ivARB = lazy_glWindowPos2ivARB;
+	glad_glWindowPos2sARB = lazy_glWindowPos2sARB;
+	glad_glWindowPos2svARB = lazy_glWindowPos2svARB;
+	glad_glWindowPos3dARB = lazy_glWindowPos3dARB;
+	glad_glWindowPos3dvARB = lazy_glWindowPos3dvARB;
+	glad_glWindowPos3fARB = lazy_glWindowPos3fARB;
+	glad_glWindowPos3fvARB = lazy_glWindowPos3fvARB;
+	glad_glWindowPos3iARB = lazy_glWindowPos3iARB;
+	glad_glWindowPos3ivARB = lazy_glWindowPos3ivARB;
+	glad_glWindowPos3sARB = lazy_glWindowPos3sARB;
+	glad_glWindowPos3svARB = lazy_glWindowPos3svARB;
+	glad_glDrawBuffersATI = lazy_glDrawBuffersATI;
+	glad_glElementPointerATI = lazy_glElementPointerATI;
+	glad_glDrawElementArrayATI = lazy_glDrawElementArrayATI;
+	glad_glDrawRangeElementArrayATI = lazy_glDrawRangeElementArrayATI;
+	glad_glTexBumpParameterivATI = lazy_glTexBumpParameterivATI;
+	glad_glTexBumpParameterfvATI = lazy_glTexBumpParameterfvATI;
+	glad_glGetTexBumpParameterivATI = lazy_glGetTexBumpParameterivATI;
+	glad_glGetTexBumpParameterfvATI = lazy_glGetTexBumpParameterfvATI;
+	glad_glGenFragmentShadersATI = lazy_glGenFragmentShadersATI;
+	glad_glBindFragmentShaderATI = lazy_glBindFragmentShaderATI;
+	glad_glDeleteFragmentShaderATI = lazy_glDeleteFragmentShaderATI;
+	glad_glBeginFragmentShaderATI = lazy_glBeginFragmentShaderATI;
+	glad_glEndFragmentShaderATI = lazy_glEndFragmentShaderATI;
+	glad_glPassTexCoordATI = lazy_glPassTexCoordATI;
+	glad_glSampleMapATI = lazy_glSampleMapATI;
+	glad_glColorFragmentOp1ATI = lazy_glColorFragmentOp1ATI;
+	glad_glColorFragmentOp2ATI = lazy_glColorFragmentOp2ATI;
+	glad_glColorFragmentOp3ATI = lazy_glColorFragmentOp3ATI;
+	glad_glAlphaFragmentOp1ATI = lazy_glAlphaFragmentOp1ATI;
+	glad_glAlphaFragmentOp2ATI = lazy_glAlphaFragmentOp2ATI;
+	glad_glAlphaFragmentOp3ATI = lazy_glAlphaFragmentOp3ATI;
+	glad_glSetFragmentShaderConstantATI = lazy_glSetFragmentShaderConstantATI;
+	glad_glMapObjectBufferATI = lazy_glMapObjectBufferATI;
+	glad_glUnmapObjectBufferATI = lazy_glUnmapObjectBufferATI;
+	glad_glPNTrianglesiATI = lazy_glPNTrianglesiATI;
+	glad_glPNTrianglesfATI = lazy_glPNTrianglesfATI;
+	glad_glStencilOpSeparateATI = lazy_glStencilOpSeparateATI;
+	glad_glStencilFuncSeparateATI = lazy_glStencilFuncSeparateATI;
+	glad_glNewObjectBufferATI = lazy_glNewObjectBufferATI;
+	glad_glIsObjectBufferATI = lazy_glIsObjectBufferATI;
+	glad_glUpdateObjectBufferATI = lazy_glUpdateObjectBufferATI;
+	glad_glGetObjectBufferfvATI = lazy_glGetObjectBufferfvATI;
+	glad_glGetObjectBufferivATI = lazy_glGetObjectBufferivATI;
+	glad_glFreeObjectBufferATI = lazy_glFreeObjectBufferATI;
+	glad_glArrayObjectATI = lazy_glArrayObjectATI;
+	glad_glGetArrayObjectfvATI = lazy_glGetArrayObjectfvATI;
+	glad_glGetArrayObjectivATI = lazy_glGetArrayObjectivATI;
+	glad_glVariantArrayObjectATI = lazy_glVariantArrayObjectATI;
+	glad_glGetVariantArrayObjectfvATI = lazy_glGetVariantArrayObjectfvATI;
+	glad_glGetVariantArrayObjectivATI = lazy_glGetVariantArrayObjectivATI;
+	glad_glVertexAttribArrayObjectATI = lazy_glVertexAttribArrayObjectATI;
+	glad_glGetVertexAttribArrayObjectfvATI = lazy_glGetVertexAttribArrayObjectfvATI;
+	glad_glGetVertexAttribArrayObjectivATI = lazy_glGetVertexAttribArrayObjectivATI;
+	glad_glVertexStream1sATI = lazy_glVertexStream1sATI;
+	glad_glVertexStream1svATI = lazy_glVertexStream1svATI;
+	glad_glVertexStream1iATI = lazy_glVertexStream1iATI;
+	glad_glVertexStream1ivATI = lazy_glVertexStream1ivATI;
+	glad_glVertexStream1fATI = lazy_glVertexStream1fATI;
+	glad_glVertexStream1fvATI = lazy_glVertexStream1fvATI;
+	glad_glVertexStream1dATI = lazy_glVertexStream1dATI;
+	glad_glVertexStream1dvATI = lazy_glVertexStream1dvATI;
+	glad_glVertexStream2sATI = lazy_glVertexStream2sATI;
+	glad_glVertexStream2svATI = lazy_glVertexStream2svATI;
+	glad_glVertexStream2iATI = lazy_glVertexStream2iATI;
+	glad_glVertexStream2ivATI = lazy_glVertexStream2ivATI;
+	glad_glVertexStream2fATI = lazy_glVertexStream2fATI;
+	glad_glVertexStream2fvATI = lazy_glVertexStream2fvATI;
+	glad_glVertexStream2dATI = lazy_glVertexStream2dATI;
+	glad_glVertexStream2dvATI = lazy_glVertexStream2dvATI;
+	glad_glVertexStream3sATI = lazy_glVertexStream3sATI;
+	glad_glVertexStream3svATI = lazy_glVertexStream3svATI;
+	glad_glVertexStream3iATI = lazy_glVertexStream3iATI;
+	glad_glVertexStream3ivATI = lazy_glVertexStream3ivATI;
+	glad_glVertexStream3fATI = lazy_glVertexStream3fATI;
+	glad_glVertexStream3fvATI = lazy_glVertexStream3fvATI;
+	glad_glVertexStream3dATI = lazy_glVertexStream3dATI;
+	glad_glVertexStream3dvATI = lazy_glVertexStream3dvATI;
+	glad_glVertexStream4sATI = lazy_glVertexStream4sATI;
+	glad_glVertexStream4svATI = lazy_glVertexStream4svATI;
+	glad_glVertexStream4iATI = lazy_glVertexStream4iATI;
+	glad_glVertexStream4ivATI = lazy_glVertexStream4ivATI;
+	glad_glVertexStream4fATI = lazy_glVertexStream4fATI;
+	glad_glVertexStream4fvATI = lazy_glVertexStream4fvATI;
+	glad_glVertexStream4dATI = lazy_glVertexStream4dATI;
+	glad_glVertexStream4dvATI = lazy_glVertexStream4dvATI;
+	glad_glNormalStream3bATI = lazy_glNormalStream3bATI;
+	glad_glNormalStream3bvATI = lazy_glNormalStream3bvATI;
+	glad_glNormalStream3sATI = lazy_glNormalStream3sATI;
+	glad_glNormalStream3svATI = lazy_glNormalStream3svATI;
+	glad_glNormalStream3iATI = lazy_glNormalStream3iATI;
+	glad_glNormalStream3ivATI = lazy_glNormalStream3ivATI;
+	glad_glNormalStream3fATI = lazy_glNormalStream3fATI;
+	glad_glNormalStream3fvATI = lazy_glNormalStream3fvATI;
+	glad_glNormalStream3dATI = lazy_glNormalStream3dATI;
+	glad_glNormalStream3dvATI = lazy_glNormalStream3dvATI;
+	glad_glClientActiveVertexStreamATI = lazy_glClientActiveVertexStreamATI;
+	glad_glVertexBlendEnviATI = lazy_glVertexBlendEnviATI;
+	glad_glVertexBlendEnvfATI = lazy_glVertexBlendEnvfATI;
+	glad_glEGLImageTargetTexStorageEXT = lazy_glEGLImageTargetTexStorageEXT;
+	glad_glEGLImageTargetTextureStorageEXT = lazy_glEGLImageTargetTextureStorageEXT;
+	glad_glUniformBufferEXT = lazy_glUniformBufferEXT;
+	glad_glGetUniformBufferSizeEXT = lazy_glGetUniformBufferSizeEXT;
+	glad_glGetUniformOffsetEXT = lazy_glGetUniformOffsetEXT;
+	glad_glBlendColorEXT = lazy_glBlendColorEXT;
+	glad_glBlendEquationSeparateEXT = lazy_glBlendEquationSeparateEXT;
+	glad_glBlendFuncSeparateEXT = lazy_glBlendFuncSeparateEXT;
+	glad_glBlendEquationEXT = lazy_glBlendEquationEXT;
+	glad_glColorSubTableEXT = lazy_glColorSubTableEXT;
+	glad_glCopyColorSubTableEXT = lazy_glCopyColorSubTableEXT;
+	glad_glLockArraysEXT = lazy_glLockArraysEXT;
+	glad_glUnlockArraysEXT = lazy_glUnlockArraysEXT;
+	glad_glConvolutionFilter1DEXT = lazy_glConvolutionFilter1DEXT;
+	glad_glConvolutionFilter2DEXT = lazy_glConvolutionFilter2DEXT;
+	glad_glConvolutionParameterfEXT = lazy_glConvolutionParameterfEXT;
+	glad_glConvolutionParameterfvEXT = lazy_glConvolutionParameterfvEXT;
+	glad_glConvolutionParameteriEXT = lazy_glConvolutionParameteriEXT;
+	glad_glConvolutionParameterivEXT = lazy_glConvolutionParameterivEXT;
+	glad_glCopyConvolutionFilter1DEXT = lazy_glCopyConvolutionFilter1DEXT;
+	glad_glCopyConvolutionFilter2DEXT = lazy_glCopyConvolutionFilter2DEXT;
+	glad_glGetConvolutionFilterEXT = lazy_glGetConvolutionFilterEXT;
+	glad_glGetConvolutionParameterfvEXT = lazy_glGetConvolutionParameterfvEXT;
+	glad_glGetConvolutionParameterivEXT = lazy_glGetConvolutionParameterivEXT;
+	glad_glGetSeparableFilterEXT = lazy_glGetSeparableFilterEXT;
+	glad_glSeparableFilter2DEXT = lazy_glSeparableFilter2DEXT;
+	glad_glTangent3bEXT = lazy_glTangent3bEXT;
+	glad_glTangent3bvEXT = lazy_glTangent3bvEXT;
+	glad_glTangent3dEXT = lazy_glTangent3dEXT;
+	glad_glTangent3dvEXT = lazy_glTangent3dvEXT;
+	glad_glTangent3fEXT = lazy_glTangent3fEXT;
+	glad_glTangent3fvEXT = lazy_glTangent3fvEXT;
+	glad_glTangent3iEXT = lazy_glTangent3iEXT;
+	glad_glTangent3ivEXT = lazy_glTangent3ivEXT;
+	glad_glTangent3sEXT = lazy_glTangent3sEXT;
+	glad_glTangent3svEXT = lazy_glTangent3svEXT;
+	glad_glBinormal3bEXT = lazy_glBinormal3bEXT;
+	glad_glBinormal3bvEXT = lazy_glBinormal3bvEXT;
+	glad_glBinormal3dEXT = lazy_glBinormal3dEXT;
+	glad_glBinormal3dvEXT = lazy_glBinormal3dvEXT;
+	glad_glBinormal3fEXT = lazy_glBinormal3fEXT;
+	glad_glBinormal3fvEXT = lazy_glBinormal3fvEXT;
+	glad_glBinormal3iEXT = lazy_glBinormal3iEXT;
+	glad_glBinormal3ivEXT = lazy_glBinormal3ivEXT;
+	glad_glBinormal3sEXT = lazy_glBinormal3sEXT;
+	glad_glBinormal3svEXT = lazy_glBinormal3svEXT;
+	glad_glTangentPointerEXT = lazy_glTangentPointerEXT;
+	glad_glBinormalPointerEXT = lazy_glBinormalPointerEXT;
+	glad_glCopyTexImage1DEXT = lazy_glCopyTexImage1DEXT;
+	glad_glCopyTexImage2DEXT = lazy_glCopyTexImage2DEXT;
+	glad_glCopyTexSubImage1DEXT = lazy_glCopyTexSubImage1DEXT;
+	glad_glCopyTexSubImage2DEXT = lazy_glCopyTexSubImage2DEXT;
+	glad_glCopyTexSubImage3DEXT = lazy_glCopyTexSubImage3DEXT;
+	glad_glCullParameterdvEXT = lazy_glCullParameterdvEXT;
+	glad_glCullParameterfvEXT = lazy_glCullParameterfvEXT;
+	glad_glLabelObjectEXT = lazy_glLabelObjectEXT;
+	glad_glGetObjectLabelEXT = lazy_glGetObjectLabelEXT;
+	glad_glInsertEventMarkerEXT = lazy_glInsertEventMarkerEXT;
+	glad_glPushGroupMarkerEXT = lazy_glPushGroupMarkerEXT;
+	glad_glPopGroupMarkerEXT = lazy_glPopGroupMarkerEXT;
+	glad_glDepthBoundsEXT = lazy_glDepthBoundsEXT;
+	glad_glMatrixLoadfEXT = lazy_glMatrixLoadfEXT;
+	glad_glMatrixLoaddEXT = lazy_glMatrixLoaddEXT;
+	glad_glMatrixMultfEXT = lazy_glMatrixMultfEXT;
+	glad_glMatrixMultdEXT = lazy_glMatrixMultdEXT;
+	glad_glMatrixLoadIdentityEXT = lazy_glMatrixLoadIdentityEXT;
+	glad_glMatrixRotatefEXT = lazy_glMatrixRotatefEXT;
+	glad_glMatrixRotatedEXT = lazy_glMatrixRotatedEXT;
+	glad_glMatrixScalefEXT = lazy_glMatrixScalefEXT;
+	glad_glMatrixScaledEXT = lazy_glMatrixScaledEXT;
+	glad_glMatrixTranslatefEXT = lazy_glMatrixTranslatefEXT;
+	glad_glMatrixTranslatedEXT = lazy_glMatrixTranslatedEXT;
+	glad_glMatrixFrustumEXT = lazy_glMatrixFrustumEXT;
+	glad_glMatrixOrthoEXT = lazy_glMatrixOrthoEXT;
+	glad_glMatrixPopEXT = lazy_glMatrixPopEXT;
+	glad_glMatrixPushEXT = lazy_glMatrixPushEXT;
+	glad_glClientAttribDefaultEXT = lazy_glClientAttribDefaultEXT;
+	glad_glPushClientAttribDefaultEXT = lazy_glPushClientAttribDefaultEXT;
+	glad_glTextureParameterfEXT = lazy_glTextureParameterfEXT;
+	glad_glTextureParameterfvEXT = lazy_glTextureParameterfvEXT;
+	glad_glTextureParameteriEXT = lazy_glTextureParameteriEXT;
+	glad_glTextureParameterivEXT = lazy_glTextureParameterivEXT;
+	glad_glTextureImage1DEXT = lazy_glTextureImage1DEXT;
+	glad_glTextureImage2DEXT = lazy_glTextureImage2DEXT;
+	glad_glTextureSubImage1DEXT = lazy_glTextureSubImage1DEXT;
+	glad_glTextureSubImage2DEXT = lazy_glTextureSubImage2DEXT;
+	glad_glCopyTextureImage1DEXT = lazy_glCopyTextureImage1DEXT;
+	glad_glCopyTextureImage2DEXT = lazy_glCopyTextureImage2DEXT;
+	glad_glCopyTextureSubImage1DEXT = lazy_glCopyTextureSubImage1DEXT;
+	glad_glCopyTextureSubImage2DEXT = lazy_glCopyTextureSubImage2DEXT;
+	glad_glGetTextureImageEXT = lazy_glGetTextureImageEXT;
+	glad_glGetTextureParameterfvEXT = lazy_glGetTextureParameterfvEXT;
+	glad_glGetTextureParameterivEXT = lazy_glGetTextureParameterivEXT;
+	glad_glGetTextureLevelParameterfvEXT = lazy_glGetTextureLevelParameterfvEXT;
+	glad_glGetTextureLevelParameterivEXT = lazy_glGetTextureLevelParameterivEXT;
+	glad_glTextureImage3DEXT = lazy_glTextureImage3DEXT;
+	glad_glTextureSubImage3DEXT = lazy_glTextureSubImage3DEXT;
+	glad_glCopyTextureSubImage3DEXT = lazy_glCopyTextureSubImage3DEXT;
+	glad_glBindMultiTextureEXT = lazy_glBindMultiTextureEXT;
+	glad_glMultiTexCoordPointerEXT = lazy_glMultiTexCoordPointerEXT;
+	glad_glMultiTexEnvfEXT = lazy_glMultiTexEnvfEXT;
+	glad_glMultiTexEnvfvEXT = lazy_glMultiTexEnvfvEXT;
+	glad_glMultiTexEnviEXT = lazy_glMultiTexEnviEXT;
+	glad_glMultiTexEnvivEXT = lazy_glMultiTexEnvivEXT;
+	glad_glMultiTexGendEXT = lazy_glMultiTexGendEXT;
+	glad_glMultiTexGendvEXT = lazy_glMultiTexGendvEXT;
+	glad_glMultiTexGenfEXT = lazy_glMultiTexGenfEXT;
+	glad_glMultiTexGenfvEXT = lazy_glMultiTexGenfvEXT;
+	glad_glMultiTexGeniEXT = lazy_glMultiTexGeniEXT;
+	glad_glMultiTexGenivEXT = lazy_glMultiTexGenivEXT;
+	glad_glGetMultiTexEnvfvEXT = lazy_glGetMultiTexEnvfvEXT;
+	glad_glGetMultiTexEnvivEXT = lazy_glGetMultiTexEnvivEXT;
+	glad_glGetMultiTexGendvEXT = lazy_glGetMultiTexGendvEXT;
+	glad_glGetMultiTexGenfvEXT = lazy_glGetMultiTexGenfvEXT;
+	glad_glGetMultiTexGenivEXT = lazy_glGetMultiTexGenivEXT;
+	glad_glMultiTexParameteriEXT = lazy_glMultiTexParameteriEXT;
+	glad_glMultiTexParameterivEXT = lazy_glMultiTexParameterivEXT;
+	glad_glMultiTexParameterfEXT = lazy_glMultiTexParameterfEXT;
+	glad_glMultiTexParameterfvEXT = lazy_glMultiTexParameterfvEXT;
+	glad_glMultiTexImage1DEXT = lazy_glMultiTexImage1DEXT;
+	glad_glMultiTexImage2DEXT = lazy_glMultiTexImage2DEXT;
+	glad_glMultiTexSubImage1DEXT = lazy_glMultiTexSubImage1DEXT;
+	glad_glMultiTexSubImage2DEXT = lazy_glMultiTexSubImage2DEXT;
+	glad_glCopyMultiTexImage1DEXT = lazy_glCopyMultiTexImage1DEXT;
+	glad_glCopyMultiTexImage2DEXT = lazy_glCopyMultiTexImage2DEXT;
+	glad_glCopyMultiTexSubImage1DEXT = lazy_glCopyMultiTexSubImage1DEXT;
+	glad_glCopyMultiTexSubImage2DEXT = lazy_glCopyMultiTexSubImage2DEXT;
+	glad_glGetMultiTexImageEXT = lazy_glGetMultiTexImageEXT;
+	glad_glGetMultiTexParameterfvEXT = lazy_glGetMultiTexParameterfvEXT;
+	glad_glGetMultiTexParameterivEXT = lazy_glGetMultiTexParameterivEXT;
+	glad_glGetMultiTexLevelParameterfvEXT = lazy_glGetMultiTexLevelParameterfvEXT;
+	glad_glGetMultiTexLevelParameterivEXT = lazy_glGetMultiTexLevelParameterivEXT;
+	glad_glMultiTexImage3DEXT = lazy_glMultiTexImage3DEXT;
+	glad_glMultiTexSubImage3DEXT = lazy_glMultiTexSubImage3DEXT;
+	glad_glCopyMultiTexSubImage3DEXT = lazy_glCopyMultiTexSubImage3DEXT;
+	glad_glEnableClientStateIndexedEXT = lazy_glEnableClientStateIndexedEXT;
+	glad_glDisableClientStateIndexedEXT = lazy_glDisableClientStateIndexedEXT;
+	glad_glGetFloatIndexedvEXT = lazy_glGetFloatIndexedvEXT;
+	glad_glGetDoubleIndexedvEXT = lazy_glGetDoubleIndexedvEXT;
+	glad_glGetPointerIndexedvEXT = lazy_glGetPointerIndexedvEXT;
+	glad_glEnableIndexedEXT = lazy_glEnableIndexedEXT;
+	glad_glDisableIndexedEXT = lazy_glDisableIndexedEXT;
+	glad_glIsEnabledIndexedEXT = lazy_glIsEnabledIndexedEXT;
+	glad_glGetIntegerIndexedvEXT = lazy_glGetIntegerIndexedvEXT;
+	glad_glGetBooleanIndexedvEXT = lazy_glGetBooleanIndexedvEXT;
+	glad_glCompressedTextureImage3DEXT = lazy_glCompressedTextureImage3DEXT;
+	glad_glCompressedTextureImage2DEXT = lazy_glCompressedTextureImage2DEXT;
+	glad_glCompressedTextureImage1DEXT = lazy_glCompressedTextureImage1DEXT;
+	glad_glCompressedTextureSubImage3DEXT = lazy_glCompressedTextureSubImage3DEXT;
+	glad_glCompressedTextureSubImage2DEXT = lazy_glCompressedTextureSubImage2DEXT;
+	glad_glCompressedTextureSubImage1DEXT = lazy_glCompressedTextureSubImage1DEXT;
+	glad_glGetCompressedTextureImageEXT = lazy_glGetCompressedTextureImageEXT;
+	glad_glCompressedMultiTexImage3DEXT = lazy_glCompressedMultiTexImage3DEXT;
+	glad_glCompressedMultiTexImage2DEXT = lazy_glCompressedMultiTexImage2DEXT;
+	glad_glCompressedMultiTexImage1DEXT = lazy_glCompressedMultiTexImage1DEXT;
+	glad_glCompressedMultiTexSubImage3DEXT = lazy_glCompressedMultiTexSubImage3DEXT;
+	glad_glCompressedMultiTexSubImage2DEXT = lazy_glCompressedMultiTexSubImage2DEXT;
+	glad_glCompressedMultiTexSubImage1DEXT = lazy_glCompressedMultiTexSubImage1DEXT;
+	glad_glGetCompressedMultiTexImageEXT = lazy_glGetCompressedMultiTexImageEXT;
+	glad_glMatrixLoadTransposefEXT = lazy_glMatrixLoadTransposefEXT;
+	glad_glMatrixLoadTransposedEXT = lazy_glMatrixLoadTransposedEXT;
+	glad_glMatrixMultTransposefEXT = lazy_glMatrixMultTransposefEXT;
+	glad_glMatrixMultTransposedEXT = lazy_glMatrixMultTransposedEXT;
+	glad_glNamedBufferDataEXT = lazy_glNamedBufferDataEXT;
+	glad_glNamedBufferSubDataEXT = lazy_glNamedBufferSubDataEXT;
+	glad_glMapNamedBufferEXT = lazy_glMapNamedBufferEXT;
+	glad_glUnmapNamedBufferEXT = lazy_glUnmapNamedBufferEXT;
+	glad_glGetNamedBufferParameterivEXT = lazy_glGetNamedBufferParameterivEXT;
+	glad_glGetNamedBufferPointervEXT = lazy_glGetNamedBufferPointervEXT;
+	glad_glGetNamedBufferSubDataEXT = lazy_glGetNamedBufferSubDataEXT;
+	glad_glProgramUniform1fEXT = lazy_glProgramUniform1fEXT;
+	glad_glProgramUniform2fEXT = lazy_glProgramUniform2fEXT;
+	glad_glProgramUniform3fEXT = lazy_glProgramUniform3fEXT;
+	glad_glProgramUniform4fEXT = lazy_glProgramUniform4fEXT;
+	glad_glProgramUniform1iEXT = lazy_glProgramUniform1iEXT;
+	glad_glProgramUniform2iEXT = lazy_glProgramUniform2iEXT;
+	glad_glProgramUniform3iEXT = lazy_glProgramUniform3iEXT;
+	glad_glProgramUniform4iEXT = lazy_glProgramUniform4iEXT;
+	glad_glProgramUniform1fvEXT = lazy_glProgramUniform1fvEXT;
+	glad_glProgramUniform2fvEXT = lazy_glProgramUniform2fvEXT;
+	glad_glProgramUniform3fvEXT = lazy_glProgramUniform3fvEXT;
+	glad_glProgramUniform4fvEXT = lazy_glProgramUniform4fvEXT;
+	glad_glProgramUniform1ivEXT = lazy_glProgramUniform1ivEXT;
+	glad_glProgramUniform2ivEXT = lazy_glProgramUniform2ivEXT;
+	glad_glProgramUniform3ivEXT = lazy_glProgramUniform3ivEXT;
+	glad_glProgramUniform4ivEXT = lazy_glProgramUniform4ivEXT;
+	glad_glProgramUniformMatrix2fvEXT = lazy_glProgramUniformMatrix2fvEXT;
+	glad_glProgramUniformMatrix3fvEXT = lazy_glProgramUniformMatrix3fvEXT;
+	glad_glProgramUniformMatrix4fvEXT = lazy_glProgramUniformMatrix4fvEXT;
+	glad_glProgramUniformMatrix2x3fvEXT = lazy_glProgramUniformMatrix2x3fvEXT;
+	glad_glProgramUniformMatrix3x2fvEXT = lazy_glProgramUniformMatrix3x2fvEXT;
+	glad_glProgramUniformMatrix2x4fvEXT = lazy_glProgramUniformMatrix2x4fvEXT;
+	glad_glProgramUniformMatrix4x2fvEXT = lazy_glProgramUniformMatrix4x2fvEXT;
+	glad_glProgramUniformMatrix3x4fvEXT = lazy_glProgramUniformMatrix3x4fvEXT;
+	glad_glProgramUniformMatrix4x3fvEXT = lazy_glProgramUniformMatrix4x3fvEXT;
+	glad_glTextureBufferEXT = lazy_glTextureBufferEXT;
+	glad_glMultiTexBufferEXT = lazy_glMultiTexBufferEXT;
+	glad_glTextureParameterIivEXT = lazy_glTextureParameterIivEXT;
+	glad_glTextureParameterIuivEXT = lazy_glTextureParameterIuivEXT;
+	glad_glGetTextureParameterIivEXT = lazy_glGetTextureParameterIivEXT;
+	glad_glGetTextureParameterIuivEXT = lazy_glGetTextureParameterIuivEXT;
+	glad_glMultiTexParameterIivEXT = lazy_glMultiTexParameterIivEXT;
+	glad_glMultiTexParameterIuivEXT = lazy_glMultiTexParameterIuivEXT;
+	glad_glGetMultiTexParameterIivEXT = lazy_glGetMultiTexParameterIivEXT;
+	glad_glGetMultiTexParameterIuivEXT = lazy_glGetMultiTexParameterIuivEXT;
+	glad_glProgramUniform1uiEXT = lazy_glProgramUniform1uiEXT;
+	glad_glProgramUniform2uiEXT = lazy_glProgramUniform2uiEXT;
+	glad_glProgramUniform3uiEXT = lazy_glProgramUniform3uiEXT;
+	glad_glProgramUniform4uiEXT = lazy_glProgramUniform4uiEXT;
+	glad_glProgramUniform1uivEXT = lazy_glProgramUniform1uivEXT;
+	glad_glProgramUniform2uivEXT = lazy_glProgramUniform2uivEXT;
+	glad_glProgramUniform3uivEXT = lazy_glProgramUniform3uivEXT;
+	glad_glProgramUniform4uivEXT = lazy_glProgramUniform4uivEXT;
+	glad_glNamedProgramLocalParameters4fvEXT = lazy_glNamedProgramLocalParameters4fvEXT;
+	glad_glNamedProgramLocalParameterI4iEXT = lazy_glNamedProgramLocalParameterI4iEXT;
+	glad_glNamedProgramLocalParameterI4ivEXT = lazy_glNamedProgramLocalParameterI4ivEXT;
+	glad_glNamedProgramLocalParametersI4ivEXT = lazy_glNamedProgramLocalParametersI4ivEXT;
+	glad_glNamedProgramLocalParameterI4uiEXT = lazy_glNamedProgramLocalParameterI4uiEXT;
+	glad_glNamedProgramLocalParameterI4uivEXT = lazy_glNamedProgramLocalParameterI4uivEXT;
+	glad_glNamedProgramLocalParametersI4uivEXT = lazy_glNamedProgramLocalParametersI4uivEXT;
+	glad_glGetNamedProgramLocalParameterIivEXT = lazy_glGetNamedProgramLocalParameterIivEXT;
+	glad_glGetNamedProgramLocalParameterIuivEXT = lazy_glGetNamedProgramLocalParameterIuivEXT;
+	glad_glEnableClientStateiEXT = lazy_glEnableClientStateiEXT;
+	glad_glDisableClientStateiEXT = lazy_glDisableClientStateiEXT;
+	glad_glGetFloati_vEXT = lazy_glGetFloati_vEXT;
+	glad_glGetDoublei_vEXT = lazy_glGetDoublei_vEXT;
+	glad_glGetPointeri_vEXT = lazy_glGetPointeri_vEXT;
+	glad_glNamedProgramStringEXT = lazy_glNamedProgramStringEXT;
+	glad_glNamedProgramLocalParameter4dEXT = lazy_glNamedProgramLocalParameter4dEXT;
+	glad_glNamedProgramLocalParameter4dvEXT = lazy_glNamedProgramLocalParameter4dvEXT;
+	glad_glNamedProgramLocalParameter4fEXT = lazy_glNamedProgramLocalParameter4fEXT;
+	glad_glNamedProgramLocalParameter4fvEXT = lazy_glNamedProgramLocalParameter4fvEXT;
+	glad_glGetNamedProgramLocalParameterdvEXT = lazy_glGetNamedProgramLocalParameterdvEXT;
+	glad_glGetNamedProgramLocalParameterfvEXT = lazy_glGetNamedProgramLocalParameterfvEXT;
+	glad_glGetNamedProgramivEXT = lazy_glGetNamedProgramivEXT;
+	glad_glGetNamedProgramStringEXT = lazy_glGetNamedProgramStringEXT;
+	glad_glNamedRenderbufferStorageEXT = lazy_glNamedRenderbufferStorageEXT;
+	glad_glGetNamedRenderbufferParameterivEXT = lazy_glGetNamedRenderbufferParameterivEXT;
+	glad_glNamedRenderbufferStorageMultisampleEXT = lazy_glNamedRenderbufferStorageMultisampleEXT;
+	glad_glNamedRenderbufferStorageMultisampleCoverageEXT = lazy_glNamedRenderbufferStorageMultisampleCoverageEXT;
+	glad_glCheckNamedFramebufferStatusEXT = lazy_glCheckNamedFramebufferStatusEXT;
+	glad_glNamedFramebufferTexture1DEXT = lazy_glNamedFramebufferTexture1DEXT;
+	glad_glNamedFramebufferTexture2DEXT = lazy_glNamedFramebufferTexture2DEXT;
+	glad_glNamedFramebufferTexture3DEXT = lazy_glNamedFramebufferTexture3DEXT;
+	glad_glNamedFramebufferRenderbufferEXT = lazy_glNamedFramebufferRenderbufferEXT;
+	glad_glGetNamedFramebufferAttachmentParameterivEXT = lazy_glGetNamedFramebufferAttachmentParameterivEXT;
+	glad_glGenerateTextureMipmapEXT = lazy_glGenerateTextureMipmapEXT;
+	glad_glGenerateMultiTexMipmapEXT = lazy_glGenerateMultiTexMipmapEXT;
+	glad_glFramebufferDrawBufferEXT = lazy_glFramebufferDrawBufferEXT;
+	glad_glFramebufferDrawBuffersEXT = lazy_glFramebufferDrawBuffersEXT;
+	glad_glFramebufferReadBufferEXT = lazy_glFramebufferReadBufferEXT;
+	glad_glGetFramebufferParameterivEXT = lazy_glGetFramebufferParameterivEXT;
+	glad_glNamedCopyBufferSubDataEXT = lazy_glNamedCopyBufferSubDataEXT;
+	glad_glNamedFramebufferTextureEXT = lazy_glNamedFramebufferTextureEXT;
+	glad_glNamedFramebufferTextureLayerEXT = lazy_glNamedFramebufferTextureLayerEXT;
+	glad_glNamedFramebufferTextureFaceEXT = lazy_glNamedFramebufferTextureFaceEXT;
+	glad_glTextureRenderbufferEXT = lazy_glTextureRenderbufferEXT;
+	glad_glMultiTexRenderbufferEXT = lazy_glMultiTexRenderbufferEXT;
+	glad_glVertexArrayVertexOffsetEXT = lazy_glVertexArrayVertexOffsetEXT;
+	glad_glVertexArrayColorOffsetEXT = lazy_glVertexArrayColorOffsetEXT;
+	glad_glVertexArrayEdgeFlagOffsetEXT = lazy_glVertexArrayEdgeFlagOffsetEXT;
+	glad_glVertexArrayIndexOffsetEXT = lazy_glVertexArrayIndexOffsetEXT;
+	glad_glVertexArrayNormalOffsetEXT = lazy_glVertexArrayNormalOffsetEXT;
+	glad_glVertexArrayTexCoordOffsetEXT = lazy_glVertexArrayTexCoordOffsetEXT;
+	glad_glVertexArrayMultiTexCoordOffsetEXT = lazy_glVertexArrayMultiTexCoordOffsetEXT;
+	glad_glVertexArrayFogCoordOffsetEXT = lazy_glVertexArrayFogCoordOffsetEXT;
+	glad_glVertexArraySecondaryColorOffsetEXT = lazy_glVertexArraySecondaryColorOffsetEXT;
+	glad_glVertexArrayVertexAttribOffsetEXT = lazy_glVertexArrayVertexAttribOffsetEXT;
+	glad_glVertexArrayVertexAttribIOffsetEXT = lazy_glVertexArrayVertexAttribIOffsetEXT;
+	glad_glEnableVertexArrayEXT = lazy_glEnableVertexArrayEXT;
+	glad_glDisableVertexArrayEXT = lazy_glDisableVertexArrayEXT;
+	glad_glEnableVertexArrayAttribEXT = lazy_glEnableVertexArrayAttribEXT;
+	glad_glDisableVertexArrayAttribEXT = lazy_glDisableVertexArrayAttribEXT;
+	glad_glGetVertexArrayIntegervEXT = lazy_glGetVertexArrayIntegervEXT;
+	glad_glGetVertexArrayPointervEXT = lazy_glGetVertexArrayPointervEXT;
+	glad_glGetVertexArrayIntegeri_vEXT = lazy_glGetVertexArrayIntegeri_vEXT;
+	glad_glGetVertexArrayPointeri_vEXT = lazy_glGetVertexArrayPointeri_vEXT;
+	glad_glMapNamedBufferRangeEXT = lazy_glMapNamedBufferRangeEXT;
+	glad_glFlushMappedNamedBufferRangeEXT = lazy_glFlushMappedNamedBufferRangeEXT;
+	glad_glNamedBufferStorageEXT = lazy_glNamedBufferStorageEXT;
+	glad_glClearNamedBufferDataEXT = lazy_glClearNamedBufferDataEXT;
+	glad_glClearNamedBufferSubDataEXT = lazy_glClearNamedBufferSubDataEXT;
+	glad_glNamedFramebufferParameteriEXT = lazy_glNamedFramebufferParameteriEXT;
+	glad_glGetNamedFramebufferParameterivEXT = lazy_glGetNamedFramebufferParameterivEXT;
+	glad_glProgramUniform1dEXT = lazy_glProgramUniform1dEXT;
+	glad_glProgramUniform2dEXT = lazy_glProgramUniform2dEXT;
+	glad_glProgramUniform3dEXT = lazy_glProgramUniform3dEXT;
+	glad_glProgramUniform4dEXT = lazy_glProgramUniform4dEXT;
+	glad_glProgramUniform1dvEXT = lazy_glProgramUniform1dvEXT;
+	glad_glProgramUniform2dvEXT = lazy_glProgramUniform2dvEXT;
+	glad_glProgramUniform3dvEXT = lazy_glProgramUniform3dvEXT;
+	glad_glProgramUniform4dvEXT = lazy_glProgramUniform4dvEXT;
+	glad_glProgramUniformMatrix2dvEXT = lazy_glProgramUniformMatrix2dvEXT;
+	glad_glProgramUniformMatrix3dvEXT = lazy_glProgramUniformMatrix3dvEXT;
+	glad_glProgramUniformMatrix4dvEXT = lazy_glProgramUniformMatrix4dvEXT;
+	glad_glProgramUniformMatrix2x3dvEXT = lazy_glProgramUniformMatrix2x3dvEXT;
+	glad_glProgramUniformMatrix2x4dvEXT = lazy_glProgramUniformMatrix2x4dvEXT;
+	glad_glProgramUniformMatrix3x2dvEXT = lazy_glProgramUniformMatrix3x2dvEXT;
+	glad_glProgramUniformMatrix3x4dvEXT = lazy_glProgramUniformMatrix3x4dvEXT;
+	glad_glProgramUniformMatrix4x2dvEXT = lazy_glProgramUniformMatrix4x2dvEXT;
+	glad_glProgramUniformMatrix4x3dvEXT = lazy_glProgramUniformMatrix4x3dvEXT;
+	glad_glTextureBufferRangeEXT = lazy_glTextureBufferRangeEXT;
+	glad_glTextureStorage1DEXT = lazy_glTextureStorage1DEXT;
+	glad_glTextureStorage2DEXT = lazy_glTextureStorage2DEXT;
+	glad_glTextureStorage3DEXT = lazy_glTextureStorage3DEXT;
+	glad_glTextureStorage2DMultisampleEXT = lazy_glTextureStorage2DMultisampleEXT;
+	glad_glTextureStorage3DMultisampleEXT = lazy_glTextureStorage3DMultisampleEXT;
+	glad_glVertexArrayBindVertexBufferEXT = lazy_glVertexArrayBindVertexBufferEXT;
+	glad_glVertexArrayVertexAttribFormatEXT = lazy_glVertexArrayVertexAttribFormatEXT;
+	glad_glVertexArrayVertexAttribIFormatEXT = lazy_glVertexArrayVertexAttribIFormatEXT;
+	glad_glVertexArrayVertexAttribLFormatEXT = lazy_glVertexArrayVertexAttribLFormatEXT;
+	glad_glVertexArrayVertexAttribBindingEXT = lazy_glVertexArrayVertexAttribBindingEXT;
+	glad_glVertexArrayVertexBindingDivisorEXT = lazy_glVertexArrayVertexBindingDivisorEXT;
+	glad_glVertexArrayVertexAttribLOffsetEXT = lazy_glVertexArrayVertexAttribLOffsetEXT;
+	glad_glTexturePageCommitmentEXT = lazy_glTexturePageCommitmentEXT;
+	glad_glVertexArrayVertexAttribDivisorEXT = lazy_glVertexArrayVertexAttribDivisorEXT;
+	glad_glColorMaskIndexedEXT = lazy_glColorMaskIndexedEXT;
+	glad_glDrawArraysInstancedEXT = lazy_glDrawArraysInstancedEXT;
+	glad_glDrawElementsInstancedEXT = lazy_glDrawElementsInstancedEXT;
+	glad_glDrawRangeElementsEXT = lazy_glDrawRangeElementsEXT;
+	glad_glBufferStorageExternalEXT = lazy_glBufferStorageExternalEXT;
+	glad_glNamedBufferStorageExternalEXT = lazy_glNamedBufferStorageExternalEXT;
+	glad_glFogCoordfEXT = lazy_glFogCoordfEXT;
+	glad_glFogCoordfvEXT = lazy_glFogCoordfvEXT;
+	glad_glFogCoorddEXT = lazy_glFogCoorddEXT;
+	glad_glFogCoorddvEXT = lazy_glFogCoorddvEXT;
+	glad_glFogCoordPointerEXT = lazy_glFogCoordPointerEXT;
+	glad_glBlitFramebufferEXT = lazy_glBlitFramebufferEXT;
+	glad_glBlitFramebufferLayersEXT = lazy_glBlitFramebufferLayersEXT;
+	glad_glBlitFramebufferLayerEXT = lazy_glBlitFramebufferLayerEXT;
+	glad_glRenderbufferStorageMultisampleEXT = lazy_glRenderbufferStorageMultisampleEXT;
+	glad_glIsRenderbufferEXT = lazy_glIsRenderbufferEXT;
+	glad_glBindRenderbufferEXT = lazy_glBindRenderbufferEXT;
+	glad_glDeleteRenderbuffersEXT = lazy_glDeleteRenderbuffersEXT;
+	glad_glGenRenderbuffersEXT = lazy_glGenRenderbuffersEXT;
+	glad_glRenderbufferStorageEXT = lazy_glRenderbufferStorageEXT;
+	glad_glGetRenderbufferParameterivEXT = lazy_glGetRenderbufferParameterivEXT;
+	glad_glIsFramebufferEXT = lazy_glIsFramebufferEXT;
+	glad_glBindFramebufferEXT = lazy_glBindFramebufferEXT;
+	glad_glDeleteFramebuffersEXT = lazy_glDeleteFramebuffersEXT;
+	glad_glGenFramebuffersEXT = lazy_glGenFramebuffersEXT;
+	glad_glCheckFramebufferStatusEXT = lazy_glCheckFramebufferStatusEXT;
+	glad_glFramebufferTexture1DEXT = lazy_glFramebufferTexture1DEXT;
+	glad_glFramebufferTexture2DEXT = lazy_glFramebufferTexture2DEXT;
+	glad_glFramebufferTexture3DEXT = lazy_glFramebufferTexture3DEXT;
+	glad_glFramebufferRenderbufferEXT = lazy_glFramebufferRenderbufferEXT;
+	glad_glGetFramebufferAttachmentParameterivEXT = lazy_glGetFramebufferAttachmentParameterivEXT;
+	glad_glGenerateMipmapEXT = lazy_glGenerateMipmapEXT;
+	glad_glProgramParameteriEXT = lazy_glProgramParameteriEXT;
+	glad_glProgramEnvParameters4fvEXT = lazy_glProgramEnvParameters4fvEXT;
+	glad_glProgramLocalParameters4fvEXT = lazy_glProgramLocalParameters4fvEXT;
+	glad_glGetUniformuivEXT = lazy_glGetUniformuivEXT;
+	glad_glBindFragDataLocationEXT = lazy_glBindFragDataLocationEXT;
+	glad_glGetFragDataLocationEXT = lazy_glGetFragDataLocationEXT;
+	glad_glUniform1uiEXT = lazy_glUniform1uiEXT;
+	glad_glUniform2uiEXT = lazy_glUniform2uiEXT;
+	glad_glUniform3uiEXT = lazy_glUniform3uiEXT;
+	glad_glUniform4uiEXT = lazy_glUniform4uiEXT;
+	glad_glUniform1uivEXT = lazy_glUniform1uivEXT;
+	glad_glUniform2uivEXT = lazy_glUniform2uivEXT;
+	glad_glUniform3uivEXT = lazy_glUniform3uivEXT;
+	glad_glUniform4uivEXT = lazy_glUniform4uivEXT;
+	glad_glVertexAttribI1iEXT = lazy_glVertexAttribI1iEXT;
+	glad_glVertexAttribI2iEXT = lazy_glVertexAttribI2iEXT;
+	glad_glVertexAttribI3iEXT = lazy_glVertexAttribI3iEXT;
+	glad_glVertexAttribI4iEXT = lazy_glVertexAttribI4iEXT;
+	glad_glVertexAttribI1uiEXT = lazy_glVertexAttribI1uiEXT;
+	glad_glVertexAttribI2uiEXT = lazy_glVertexAttribI2uiEXT;
+	glad_glVertexAttribI3uiEXT = lazy_glVertexAttribI3uiEXT;
+	glad_glVertexAttribI4uiEXT = lazy_glVertexAttribI4uiEXT;
+	glad_glVertexAttribI1ivEXT = lazy_glVertexAttribI1ivEXT;
+	glad_glVertexAttribI2ivEXT = lazy_glVertexAttribI2ivEXT;
+	glad_glVertexAttribI3ivEXT = lazy_glVertexAttribI3ivEXT;
+	glad_glVertexAttribI4ivEXT = lazy_glVertexAttribI4ivEXT;
+	glad_glVertexAttribI1uivEXT = lazy_glVertexAttribI1uivEXT;
+	glad_glVertexAttribI2uivEXT = lazy_glVertexAttribI2uivEXT;
+	glad_glVertexAttribI3uivEXT = lazy_glVertexAttribI3uivEXT;
+	glad_glVertexAttribI4uivEXT = lazy_glVertexAttribI4uivEXT;
+	glad_glVertexAttribI4bvEXT = lazy_glVertexAttribI4bvEXT;
+	glad_glVertexAttribI4svEXT = lazy_glVertexAttribI4svEXT;
+	glad_glVertexAttribI4ubvEXT = lazy_glVertexAttribI4ubvEXT;
+	glad_glVertexAttribI4usvEXT = lazy_glVertexAttribI4usvEXT;
+	glad_glVertexAttribIPointerEXT = lazy_glVertexAttribIPointerEXT;
+	glad_glGetVertexAttribIivEXT = lazy_glGetVertexAttribIivEXT;
+	glad_glGetVertexAttribIuivEXT = lazy_glGetVertexAttribIuivEXT;
+	glad_glGetHistogramEXT = lazy_glGetHistogramEXT;
+	glad_glGetHistogramParameterfvEXT = lazy_glGetHistogramParameterfvEXT;
+	glad_glGetHistogramParameterivEXT = lazy_glGetHistogramParameterivEXT;
+	glad_glGetMinmaxEXT = lazy_glGetMinmaxEXT;
+	glad_glGetMinmaxParameterfvEXT = lazy_glGetMinmaxParameterfvEXT;
+	glad_glGetMinmaxParameterivEXT = lazy_glGetMinmaxParameterivEXT;
+	glad_glHistogramEXT = lazy_glHistogramEXT;
+	glad_glMinmaxEXT = lazy_glMinmaxEXT;
+	glad_glResetHistogramEXT = lazy_glResetHistogramEXT;
+	glad_glResetMinmaxEXT = lazy_glResetMinmaxEXT;
+	glad_glIndexFuncEXT = lazy_glIndexFuncEXT;
+	glad_glIndexMaterialEXT = lazy_glIndexMaterialEXT;
+	glad_glApplyTextureEXT = lazy_glApplyTextureEXT;
+	glad_glTextureLightEXT = lazy_glTextureLightEXT;
+	glad_glTextureMaterialEXT = lazy_glTextureMaterialEXT;
+	glad_glGetUnsignedBytevEXT = lazy_glGetUnsignedBytevEXT;
+	glad_glGetUnsignedBytei_vEXT = lazy_glGetUnsignedBytei_vEXT;
+	glad_glDeleteMemoryObjectsEXT = lazy_glDeleteMemoryObjectsEXT;
+	glad_glIsMemoryObjectEXT = lazy_glIsMemoryObjectEXT;
+	glad_glCreateMemoryObjectsEXT = lazy_glCreateMemoryObjectsEXT;
+	glad_glMemoryObjectParameterivEXT = lazy_glMemoryObjectParameterivEXT;
+	glad_glGetMemoryObjectParameterivEXT = lazy_glGetMemoryObjectParameterivEXT;
+	glad_glTexStorageMem2DEXT = lazy_glTexStorageMem2DEXT;
+	glad_glTexStorageMem2DMultisampleEXT = lazy_glTexStorageMem2DMultisampleEXT;
+	glad_glTexStorageMem3DEXT = lazy_glTexStorageMem3DEXT;
+	glad_glTexStorageMem3DMultisampleEXT = lazy_glTexStorageMem3DMultisampleEXT;
+	glad_glBufferStorageMemEXT = lazy_glBufferStorageMemEXT;
+	glad_glTextureStorageMem2DEXT = lazy_glTextureStorageMem2DEXT;
+	glad_glTextureStorageMem2DMultisampleEXT = lazy_glTextureStorageMem2DMultisampleEXT;
+	glad_glTextureStorageMem3DEXT = lazy_glTextureStorageMem3DEXT;
+	glad_glTextureStorageMem3DMultisampleEXT = lazy_glTextureStorageMem3DMultisampleEXT;
+	glad_glNamedBufferStorageMemEXT = lazy_glNamedBufferStorageMemEXT;
+	glad_glTexStorageMem1DEXT = lazy_glTexStorageMem1DEXT;
+	glad_glTextureStorageMem1DEXT = lazy_glTextureStorageMem1DEXT;
+	glad_glImportMemoryFdEXT = lazy_glImportMemoryFdEXT;
+	glad_glImportMemoryWin32HandleEXT = lazy_glImportMemoryWin32HandleEXT;
+	glad_glImportMemoryWin32NameEXT = lazy_glImportMemoryWin32NameEXT;
+	glad_glMultiDrawArraysEXT = lazy_glMultiDrawArraysEXT;
+	glad_glMultiDrawElementsEXT = lazy_glMultiDrawElementsEXT;
+	glad_glSampleMaskEXT = lazy_glSampleMaskEXT;
+	glad_glSamplePatternEXT = lazy_glSamplePatternEXT;
+	glad_glColorTableEXT = lazy_glColorTableEXT;
+	glad_glGetColorTableEXT = lazy_glGetColorTableEXT;
+	glad_glGetColorTableParameterivEXT = lazy_glGetColorTableParameterivEXT;
+	glad_glGetColorTableParameterfvEXT = lazy_glGetColorTableParameterfvEXT;
+	glad_glPixelTransformParameteriEXT = lazy_glPixelTransformParameteriEXT;
+	glad_glPixelTransformParameterfEXT = lazy_glPixelTransformParameterfEXT;
+	glad_glPixelTransformParameterivEXT = lazy_glPixelTransformParameterivEXT;
+	glad_glPixelTransformParameterfvEXT = lazy_glPixelTransformParameterfvEXT;
+	glad_glGetPixelTransformParameterivEXT = lazy_glGetPixelTransformParameterivEXT;
+	glad_glGetPixelTransformParameterfvEXT = lazy_glGetPixelTransformParameterfvEXT;
+	glad_glPointParameterfEXT = lazy_glPointParameterfEXT;
+	glad_glPointParameterfvEXT = lazy_glPointParameterfvEXT;
+	glad_glPolygonOffsetEXT = lazy_glPolygonOffsetEXT;
+	glad_glPolygonOffsetClampEXT = lazy_glPolygonOffsetClampEXT;
+	glad_glProvokingVertexEXT = lazy_glProvokingVertexEXT;
+	glad_glRasterSamplesEXT = lazy_glRasterSamplesEXT;
+	glad_glSecondaryColor3bEXT = lazy_glSecondaryColor3bEXT;
+	glad_glSecondaryColor3bvEXT = lazy_glSecondaryColor3bvEXT;
+	glad_glSecondaryColor3dEXT = lazy_glSecondaryColor3dEXT;
+	glad_glSecondaryColor3dvEXT = lazy_glSecondaryColor3dvEXT;
+	glad_glSecondaryColor3fEXT = lazy_glSecondaryColor3fEXT;
+	glad_glSecondaryColor3fvEXT = lazy_glSecondaryColor3fvEXT;
+	glad_glSecondaryColor3iEXT = lazy_glSecondaryColor3iEXT;
+	glad_glSecondaryColor3ivEXT = lazy_glSecondaryColor3ivEXT;
+	glad_glSecondaryColor3sEXT = lazy_glSecondaryColor3sEXT;
+	glad_glSecondaryColor3svEXT = lazy_glSecondaryColor3svEXT;
+	glad_glSecondaryColor3ubEXT = lazy_glSecondaryColor3ubEXT;
+	glad_glSecondaryColor3ubvEXT = lazy_glSecondaryColor3ubvEXT;
+	glad_glSecondaryColor3uiEXT = lazy_glSecondaryColor3uiEXT;
+	glad_glSecondaryColor3uivEXT = lazy_glSecondaryColor3uivEXT;
+	glad_glSecondaryColor3usEXT = lazy_glSecondaryColor3usEXT;
+	glad_glSecondaryColor3usvEXT = lazy_glSecondaryColor3usvEXT;
+	glad_glSecondaryColorPointerEXT = lazy_glSecondaryColorPointerEXT;
+	glad_glGenSemaphoresEXT = lazy_glGenSemaphoresEXT;
+	glad_glDeleteSemaphoresEXT = lazy_glDeleteSemaphoresEXT;
+	glad_glIsSemaphoreEXT = lazy_glIsSemaphoreEXT;
+	glad_glSemaphoreParameterui64vEXT = lazy_glSemaphoreParameterui64vEXT;
+	glad_glGetSemaphoreParameterui64vEXT = lazy_glGetSemaphoreParameterui64vEXT;
+	glad_glWaitSemaphoreEXT = lazy_glWaitSemaphoreEXT;
+	glad_glSignalSemaphoreEXT = lazy_glSignalSemaphoreEXT;
+	glad_glImportSemaphoreFdEXT = lazy_glImportSemaphoreFdEXT;
+	glad_glImportSemaphoreWin32HandleEXT = lazy_glImportSemaphoreWin32HandleEXT;
+	glad_glImportSemaphoreWin32NameEXT = lazy_glImportSemaphoreWin32NameEXT;
+	glad_glUseShaderProgramEXT = lazy_glUseShaderProgramEXT;
+	glad_glActiveProgramEXT = lazy_glActiveProgramEXT;
+	glad_glCreateShaderProgramEXT = lazy_glCreateShaderProgramEXT;
+	glad_glActiveShaderProgramEXT = lazy_glActiveShaderProgramEXT;
+	glad_glBindProgramPipelineEXT = lazy_glBindProgramPipelineEXT;
+	glad_glCreateShaderProgramvEXT = lazy_glCreateShaderProgramvEXT;
+	glad_glDeleteProgramPipelinesEXT = lazy_glDeleteProgramPipelinesEXT;
+	glad_glGenProgramPipelinesEXT = lazy_glGenProgramPipelinesEXT;
+	glad_glGetProgramPipelineInfoLogEXT = lazy_glGetProgramPipelineInfoLogEXT;
+	glad_glGetProgramPipelineivEXT = lazy_glGetProgramPipelineivEXT;
+	glad_glIsProgramPipelineEXT = lazy_glIsProgramPipelineEXT;
+	glad_glUseProgramStagesEXT = lazy_glUseProgramStagesEXT;
+	glad_glValidateProgramPipelineEXT = lazy_glValidateProgramPipelineEXT;
+	glad_glFramebufferFetchBarrierEXT = lazy_glFramebufferFetchBarrierEXT;
+	glad_glBindImageTextureEXT = lazy_glBindImageTextureEXT;
+	glad_glMemoryBarrierEXT = lazy_glMemoryBarrierEXT;
+	glad_glStencilClearTagEXT = lazy_glStencilClearTagEXT;
+	glad_glActiveStencilFaceEXT = lazy_glActiveStencilFaceEXT;
+	glad_glTexSubImage1DEXT = lazy_glTexSubImage1DEXT;
+	glad_glTexSubImage2DEXT = lazy_glTexSubImage2DEXT;
+	glad_glTexImage3DEXT = lazy_glTexImage3DEXT;
+	glad_glTexSubImage3DEXT = lazy_glTexSubImage3DEXT;
+	glad_glFramebufferTextureLayerEXT = lazy_glFramebufferTextureLayerEXT;
+	glad_glTexBufferEXT = lazy_glTexBufferEXT;
+	glad_glTexParameterIivEXT = lazy_glTexParameterIivEXT;
+	glad_glTexParameterIuivEXT = lazy_glTexParameterIuivEXT;
+	glad_glGetTexParameterIivEXT = lazy_glGetTexParameterIivEXT;
+	glad_glGetTexParameterIuivEXT = lazy_glGetTexParameterIuivEXT;
+	glad_glClearColorIiEXT = lazy_glClearColorIiEXT;
+	glad_glClearColorIuiEXT = lazy_glClearColorIuiEXT;
+	glad_glAreTexturesResidentEXT = lazy_glAreTexturesResidentEXT;
+	glad_glBindTextureEXT = lazy_glBindTextureEXT;
+	glad_glDeleteTexturesEXT = lazy_glDeleteTexturesEXT;
+	glad_glGenTexturesEXT = lazy_glGenTexturesEXT;
+	glad_glIsTextureEXT = lazy_glIsTextureEXT;
+	glad_glPrioritizeTexturesEXT = lazy_glPrioritizeTexturesEXT;
+	glad_glTextureNormalEXT = lazy_glTextureNormalEXT;
+	glad_glTexStorage1DEXT = lazy_glTexStorage1DEXT;
+	glad_glTexStorage2DEXT = lazy_glTexStorage2DEXT;
+	glad_glTexStorage3DEXT = lazy_glTexStorage3DEXT;
+	glad_glGetQueryObjecti64vEXT = lazy_glGetQueryObjecti64vEXT;
+	glad_glGetQueryObjectui64vEXT = lazy_glGetQueryObjectui64vEXT;
+	glad_glBeginTransformFeedbackEXT = lazy_glBeginTransformFeedbackEXT;
+	glad_glEndTransformFeedbackEXT = lazy_glEndTransformFeedbackEXT;
+	glad_glBindBufferRangeEXT = lazy_glBindBufferRangeEXT;
+	glad_glBindBufferOffsetEXT = lazy_glBindBufferOffsetEXT;
+	glad_glBindBufferBaseEXT = lazy_glBindBufferBaseEXT;
+	glad_glTransformFeedbackVaryingsEXT = lazy_glTransformFeedbackVaryingsEXT;
+	glad_glGetTransformFeedbackVaryingEXT = lazy_glGetTransformFeedbackVaryingEXT;
+	glad_glArrayElementEXT = lazy_glArrayElementEXT;
+	glad_glColorPointerEXT = lazy_glColorPointerEXT;
+	glad_glDrawArraysEXT = lazy_glDrawArraysEXT;
+	glad_glEdgeFlagPointerEXT = lazy_glEdgeFlagPointerEXT;
+	glad_glGetPointervEXT = lazy_glGetPointervEXT;
+	glad_glIndexPointerEXT = lazy_glIndexPointerEXT;
+	glad_glNormalPointerEXT = lazy_glNormalPointerEXT;
+	glad_glTexCoordPointerEXT = lazy_glTexCoordPointerEXT;
+	glad_glVertexPointerEXT = lazy_glVertexPointerEXT;
+	glad_glVertexAttribL1dEXT = lazy_glVertexAttribL1dEXT;
+	glad_glVertexAttribL2dEXT = lazy_glVertexAttribL2dEXT;
+	glad_glVertexAttribL3dEXT = lazy_glVertexAttribL3dEXT;
+	glad_glVertexAttribL4dEXT = lazy_glVertexAttribL4dEXT;
+	glad_glVertexAttribL1dvEXT = lazy_glVertexAttribL1dvEXT;
+	glad_glVertexAttribL2dvEXT = lazy_glVertexAttribL2dvEXT;
+	glad_glVertexAttribL3dvEXT = lazy_glVertexAttribL3dvEXT;
+	glad_glVertexAttribL4dvEXT = lazy_glVertexAttribL4dvEXT;
+	glad_glVertexAttribLPointerEXT = lazy_glVertexAttribLPointerEXT;
+	glad_glGetVertexAttribLdvEXT = lazy_glGetVertexAttribLdvEXT;
+	glad_glBeginVertexShaderEXT = lazy_glBeginVertexShaderEXT;
+	glad_glEndVertexShaderEXT = lazy_glEndVertexShaderEXT;
+	glad_glBindVertexShaderEXT = lazy_glBindVertexShaderEXT;
+	glad_glGenVertexShadersEXT = lazy_glGenVertexShadersEXT;
+	glad_glDeleteVertexShaderEXT = lazy_glDeleteVertexShaderEXT;
+	glad_glShaderOp1EXT = lazy_glShaderOp1EXT;
+	glad_glShaderOp2EXT = lazy_glShaderOp2EXT;
+	glad_glShaderOp3EXT = lazy_glShaderOp3EXT;
+	glad_glSwizzleEXT = lazy_glSwizzleEXT;
+	glad_glWriteMaskEXT = lazy_glWriteMaskEXT;
+	glad_glInsertComponentEXT = lazy_glInsertComponentEXT;
+	glad_glExtractComponentEXT = lazy_glExtractComponentEXT;
+	glad_glGenSymbolsEXT = lazy_glGenSymbolsEXT;
+	glad_glSetInvariantEXT = lazy_glSetInvariantEXT;
+	glad_glSetLocalConstantEXT = lazy_glSetLocalConstantEXT;
+	glad_glVariantbvEXT = lazy_glVariantbvEXT;
+	glad_glVariantsvEXT = lazy_glVariantsvEXT;
+	glad_glVariantivEXT = lazy_glVariantivEXT;
+	glad_glVariantfvEXT = lazy_glVariantfvEXT;
+	glad_glVariantdvEXT = lazy_glVariantdvEXT;
+	glad_glVariantubvEXT = lazy_glVariantubvEXT;
+	glad_glVariantusvEXT = lazy_glVariantusvEXT;
+	glad_glVariantuivEXT = lazy_glVariantuivEXT;
+	glad_glVariantPointerEXT = lazy_glVariantPointerEXT;
+	glad_glEnableVariantClientStateEXT = lazy_glEnableVariantClientStateEXT;
+	glad_glDisableVariantClientStateEXT = lazy_glDisableVariantClientStateEXT;
+	glad_glBindLightParameterEXT = lazy_glBindLightParameterEXT;
+	glad_glBindMaterialParameterEXT = lazy_glBindMaterialParameterEXT;
+	glad_glBindTexGenParameterEXT = lazy_glBindTexGenParameterEXT;
+	glad_glBindTextureUnitParameterEXT = lazy_glBindTextureUnitParameterEXT;
+	glad_glBindParameterEXT = lazy_glBindParameterEXT;
+	glad_glIsVariantEnabledEXT = lazy_glIsVariantEnabledEXT;
+	glad_glGetVariantBooleanvEXT = lazy_glGetVariantBooleanvEXT;
+	glad_glGetVariantIntegervEXT = lazy_glGetVariantIntegervEXT;
+	glad_glGetVariantFloatvEXT = lazy_glGetVariantFloatvEXT;
+	glad_glGetVariantPointervEXT = lazy_glGetVariantPointervEXT;
+	glad_glGetInvariantBooleanvEXT = lazy_glGetInvariantBooleanvEXT;
+	glad_glGetInvariantIntegervEXT = lazy_glGetInvariantIntegervEXT;
+	glad_glGetInvariantFloatvEXT = lazy_glGetInvariantFloatvEXT;
+	glad_glGetLocalConstantBooleanvEXT = lazy_glGetLocalConstantBooleanvEXT;
+	glad_glGetLocalConstantIntegervEXT = lazy_glGetLocalConstantIntegervEXT;
+	glad_glGetLocalConstantFloatvEXT = lazy_glGetLocalConstantFloatvEXT;
+	glad_glVertexWeightfEXT = lazy_glVertexWeightfEXT;
+	glad_glVertexWeightfvEXT = lazy_glVertexWeightfvEXT;
+	glad_glVertexWeightPointerEXT = lazy_glVertexWeightPointerEXT;
+	glad_glAcquireKeyedMutexWin32EXT = lazy_glAcquireKeyedMutexWin32EXT;
+	glad_glReleaseKeyedMutexWin32EXT = lazy_glReleaseKeyedMutexWin32EXT;
+	glad_glWindowRectanglesEXT = lazy_glWindowRectanglesEXT;
+	glad_glImportSyncEXT = lazy_glImportSyncEXT;
+	glad_glFrameTerminatorGREMEDY = lazy_glFrameTerminatorGREMEDY;
+	glad_glStringMarkerGREMEDY = lazy_glStringMarkerGREMEDY;
+	glad_glImageTransformParameteriHP = lazy_glImageTransformParameteriHP;
+	glad_glImageTransformParameterfHP = lazy_glImageTransformParameterfHP;
+	glad_glImageTransformParameterivHP = lazy_glImageTransformParameterivHP;
+	glad_glImageTransformParameterfvHP = lazy_glImageTransformParameterfvHP;
+	glad_glGetImageTransformParameterivHP = lazy_glGetImageTransformParameterivHP;
+	glad_glGetImageTransformParameterfvHP = lazy_glGetImageTransformParameterfvHP;
+	glad_glMultiModeDrawArraysIBM = lazy_glMultiModeDrawArraysIBM;
+	glad_glMultiModeDrawElementsIBM = lazy_glMultiModeDrawElementsIBM;
+	glad_glFlushStaticDataIBM = lazy_glFlushStaticDataIBM;
+	glad_glColorPointerListIBM = lazy_glColorPointerListIBM;
+	glad_glSecondaryColorPointerListIBM = lazy_glSecondaryColorPointerListIBM;
+	glad_glEdgeFlagPointerListIBM = lazy_glEdgeFlagPointerListIBM;
+	glad_glFogCoordPointerListIBM = lazy_glFogCoordPointerListIBM;
+	glad_glIndexPointerListIBM = lazy_glIndexPointerListIBM;
+	glad_glNormalPointerListIBM = lazy_glNormalPointerListIBM;
+	glad_glTexCoordPointerListIBM = lazy_glTexCoordPointerListIBM;
+	glad_glVertexPointerListIBM = lazy_glVertexPointerListIBM;
+	glad_glBlendFuncSeparateINGR = lazy_glBlendFuncSeparateINGR;
+	glad_glApplyFramebufferAttachmentCMAAINTEL = lazy_glApplyFramebufferAttachmentCMAAINTEL;
+	glad_glSyncTextureINTEL = lazy_glSyncTextureINTEL;
+	glad_glUnmapTexture2DINTEL = lazy_glUnmapTexture2DINTEL;
+	glad_glMapTexture2DINTEL = lazy_glMapTexture2DINTEL;
+	glad_glVertexPointervINTEL = lazy_glVertexPointervINTEL;
+	glad_glNormalPointervINTEL = lazy_glNormalPointervINTEL;
+	glad_glColorPointervINTEL = lazy_glColorPointervINTEL;
+	glad_glTexCoordPointervINTEL = lazy_glTexCoordPointervINTEL;
+	glad_glBeginPerfQueryINTEL = lazy_glBeginPerfQueryINTEL;
+	glad_glCreatePerfQueryINTEL = lazy_glCreatePerfQueryINTEL;
+	glad_glDeletePerfQueryINTEL = lazy_glDeletePerfQueryINTEL;
+	glad_glEndPerfQueryINTEL = lazy_glEndPerfQueryINTEL;
+	glad_glGetFirstPerfQueryIdINTEL = lazy_glGetFirstPerfQueryIdINTEL;
+	glad_glGetNextPerfQueryIdINTEL = lazy_glGetNextPerfQueryIdINTEL;
+	glad_glGetPerfCounterInfoINTEL = lazy_glGetPerfCounterInfoINTEL;
+	glad_glGetPerfQueryDataINTEL = lazy_glGetPerfQueryDataINTEL;
+	glad_glGetPerfQueryIdByNameINTEL = lazy_glGetPerfQueryIdByNameINTEL;
+	glad_glGetPerfQueryInfoINTEL = lazy_glGetPerfQueryInfoINTEL;
+	glad_glBlendBarrierKHR = lazy_glBlendBarrierKHR;
+#endif
+	glad_glDebugMessageControlKHR = lazy_glDebugMessageControlKHR;
+	glad_glDebugMessageInsertKHR = lazy_glDebugMessageInsertKHR;
+	glad_glDebugMessageCallbackKHR = lazy_glDebugMessageCallbackKHR;
+	glad_glGetDebugMessageLogKHR = lazy_glGetDebugMessageLogKHR;
+	glad_glPushDebugGroupKHR = lazy_glPushDebugGroupKHR;
+	glad_glPopDebugGroupKHR = lazy_glPopDebugGroupKHR;
+	glad_glObjectLabelKHR = lazy_glObjectLabelKHR;
+	glad_glGetObjectLabelKHR = lazy_glGetObjectLabelKHR;
+	glad_glObjectPtrLabelKHR = lazy_glObjectPtrLabelKHR;
+	glad_glGetObjectPtrLabelKHR = lazy_glGetObjectPtrLabelKHR;
+	glad_glGetPointervKHR = lazy_glGetPointervKHR;
+	glad_glMaxShaderCompilerThreadsKHR = lazy_glMaxShaderCompilerThreadsKHR;
+#ifndef GLAD_CORE_PROFILE
+	glad_glGetGraphicsResetStatusKHR = lazy_glGetGraphicsResetStatusKHR;
+	glad_glReadnPixelsKHR = lazy_glReadnPixelsKHR;
+	glad_glGetnUniformfvKHR = lazy_glGetnUniformfvKHR;
+	glad_glGetnUniformivKHR = lazy_glGetnUniformivKHR;
+	glad_glGetnUniformuivKHR = lazy_glGetnUniformuivKHR;
+	glad_glFramebufferParameteriMESA = lazy_glFramebufferParameteriMESA;
+	glad_glGetFramebufferParameterivMESA = lazy_glGetFramebufferParameterivMESA;
+	glad_glResizeBuffersMESA = lazy_glResizeBuffersMESA;
+	glad_glWindowPos2dMESA = lazy_glWindowPos2dMESA;
+	glad_glWindowPos2dvMESA = lazy_glWindowPos2dvMESA;
+	glad_glWindowPos2fMESA = lazy_glWindowPos2fMESA;
+	glad_glWindowPos2fvMESA = lazy_glWindowPos2fvMESA;
+	glad_glWindowPos2iMESA = lazy_glWindowPos2iMESA;
+	glad_glWindowPos2ivMESA = lazy_glWindowPos2ivMESA;
+	glad_glWindowPos2sMESA = lazy_glWindowPos2sMESA;
+	glad_glWindowPos2svMESA = lazy_glWindowPos2svMESA;
+	glad_glWindowPos3dMESA = lazy_glWindowPos3dMESA;
+	glad_glWindowPos3dvMESA = lazy_glWindowPos3dvMESA;
+	glad_glWindowPos3fMESA = lazy_glWindowPos3fMESA;
+	glad_glWindowPos3fvMESA = lazy_glWindowPos3fvMESA;
+	glad_glWindowPos3iMESA = lazy_glWindowPos3iMESA;
+	glad_glWindowPos3ivMESA = lazy_glWindowPos3ivMESA;
+	glad_glWindowPos3sMESA = lazy_glWindowPos3sMESA;
+	glad_glWindowPos3svMESA = lazy_glWindowPos3svMESA;
+	glad_glWindowPos4dMESA = lazy_glWindowPos4dMESA;
+	glad_glWindowPos4dvMESA = lazy_glWindowPos4dvMESA;
+	glad_glWindowPos4fMESA = lazy_glWindowPos4fMESA;
+	glad_glWindowPos4fvMESA = lazy_glWindowPos4fvMESA;
+	glad_glWindowPos4iMESA = lazy_glWindowPos4iMESA;
+	glad_glWindowPos4ivMESA = lazy_glWindowPos4ivMESA;
+	glad_glWindowPos4sMESA = lazy_glWindowPos4sMESA;
+	glad_glWindowPos4svMESA = lazy_glWindowPos4svMESA;
+	glad_glBeginConditionalRenderNVX = lazy_glBeginConditionalRenderNVX;
+	glad_glEndConditionalRenderNVX = lazy_glEndConditionalRenderNVX;
+	glad_glUploadGpuMaskNVX = lazy_glUploadGpuMaskNVX;
+	glad_glMulticastViewportArrayvNVX = lazy_glMulticastViewportArrayvNVX;
+	glad_glMulticastViewportPositionWScaleNVX = lazy_glMulticastViewportPositionWScaleNVX;
+	glad_glMulticastScissorArrayvNVX = lazy_glMulticastScissorArrayvNVX;
+	glad_glAsyncCopyBufferSubDataNVX = lazy_glAsyncCopyBufferSubDataNVX;
+	glad_glAsyncCopyImageSubDataNVX = lazy_glAsyncCopyImageSubDataNVX;
+	glad_glLGPUNamedBufferSubDataNVX = lazy_glLGPUNamedBufferSubDataNVX;
+	glad_glLGPUCopyImageSubDataNVX = lazy_glLGPUCopyImageSubDataNVX;
+	glad_glLGPUInterlockNVX = lazy_glLGPUInterlockNVX;
+	glad_glCreateProgressFenceNVX = lazy_glCreateProgressFenceNVX;
+	glad_glSignalSemaphoreui64NVX = lazy_glSignalSemaphoreui64NVX;
+	glad_glWaitSemaphoreui64NVX = lazy_glWaitSemaphoreui64NVX;
+	glad_glClientWaitSemaphoreui64NVX = lazy_glClientWaitSemaphoreui64NVX;
+	glad_glAlphaToCoverageDitherControlNV = lazy_glAlphaToCoverageDitherControlNV;
+	glad_glMultiDrawArraysIndirectBindlessNV = lazy_glMultiDrawArraysIndirectBindlessNV;
+	glad_glMultiDrawElementsIndirectBindlessNV = lazy_glMultiDrawElementsIndirectBindlessNV;
+	glad_glMultiDrawArraysIndirectBindlessCountNV = lazy_glMultiDrawArraysIndirectBindlessCountNV;
+	glad_glMultiDrawElementsIndirectBindlessCountNV = lazy_glMultiDrawElementsIndirectBindlessCountNV;
+	glad_glGetTextureHandleNV = lazy_glGetTextureHandleNV;
+	glad_glGetTextureSamplerHandleNV = lazy_glGetTextureSamplerHandleNV;
+	glad_glMakeTextureHandleResidentNV = lazy_glMakeTextureHandleResidentNV;
+	glad_glMakeTextureHandleNonResidentNV = lazy_glMakeTextureHandleNonResidentNV;
+	glad_glGetImageHandleNV = lazy_glGetImageHandleNV;
+	glad_glMakeImageHandleResidentNV = lazy_glMakeImageHandleResidentNV;
+	glad_glMakeImageHandleNonResidentNV = lazy_glMakeImageHandleNonResidentNV;
+	glad_glUniformHandleui64NV = lazy_glUniformHandleui64NV;
+	glad_glUniformHandleui64vNV = lazy_glUniformHandleui64vNV;
+	glad_glProgramUniformHandleui64NV = lazy_glProgramUniformHandleui64NV;
+	glad_glProgramUniformHandleui64vNV = lazy_glProgramUniformHandleui64vNV;
+	glad_glIsTextureHandleResidentNV = lazy_glIsTextureHandleResidentNV;
+	glad_glIsImageHandleResidentNV = lazy_glIsImageHandleResidentNV;
+	glad_glBlendParameteriNV = lazy_glBlendParameteriNV;
+	glad_glBlendBarrierNV = lazy_glBlendBarrierNV;
+	glad_glViewportPositionWScaleNV = lazy_glViewportPositionWScaleNV;
+	glad_glCreateStatesNV = lazy_glCreateStatesNV;
+	glad_glDeleteStatesNV = lazy_glDeleteStatesNV;
+	glad_glIsStateNV = lazy_glIsStateNV;
+	glad_glStateCaptureNV = lazy_glStateCaptureNV;
+	glad_glGetCommandHeaderNV = lazy_glGetCommandHeaderNV;
+	glad_glGetStageIndexNV = lazy_glGetStageIndexNV;
+	glad_glDrawCommandsNV = lazy_glDrawCommandsNV;
+	glad_glDrawCommandsAddressNV = lazy_glDrawCommandsAddressNV;
+	glad_glDrawCommandsStatesNV = lazy_glDrawCommandsStatesNV;
+	glad_glDrawCommandsStatesAddressNV = lazy_glDrawCommandsStatesAddressNV;
+	glad_glCreateCommandListsNV = lazy_glCreateCommandListsNV;
+	glad_glDeleteCommandListsNV = lazy_glDeleteCommandListsNV;
+	glad_glIsCommandListNV = lazy_glIsCommandListNV;
+	glad_glListDrawCommandsStatesClientNV = lazy_glListDrawCommandsStatesClientNV;
+	glad_glCommandListSegmentsNV = lazy_glCommandListSegmentsNV;
+	glad_glCompileCommandListNV = lazy_glCompileCommandListNV;
+	glad_glCallCommandListNV = lazy_glCallCommandListNV;
+	glad_glBeginConditionalRenderNV = lazy_glBeginConditionalRenderNV;
+	glad_glEndConditionalRenderNV = lazy_glEndConditionalRenderNV;
+	glad_glSubpixelPrecisionBiasNV = lazy_glSubpixelPrecisionBiasNV;
+	glad_glConservativeRasterParameterfNV = lazy_glConservativeRasterParameterfNV;
+	glad_glConservativeRasterParameteriNV = lazy_glConservativeRasterParameteriNV;
+	glad_glCopyImageSubDataNV = lazy_glCopyImageSubDataNV;
+	glad_glDepthRangedNV = lazy_glDepthRangedNV;
+	glad_glClearDepthdNV = lazy_glClearDepthdNV;
+	glad_glDepthBoundsdNV = lazy_glDepthBoundsdNV;
+	glad_glDrawTextureNV = lazy_glDrawTextureNV;
+	glad_glDrawVkImageNV = lazy_glDrawVkImageNV;
+	glad_glGetVkProcAddrNV = lazy_glGetVkProcAddrNV;
+	glad_glWaitVkSemaphoreNV = lazy_glWaitVkSemaphoreNV;
+	glad_glSignalVkSemaphoreNV = lazy_glSignalVkSemaphoreNV;
+	glad_glSignalVkFenceNV = lazy_glSignalVkFenceNV;
+	glad_glMapControlPointsNV = lazy_glMapControlPointsNV;
+	glad_glMapParameterivNV = lazy_glMapParameterivNV;
+	glad_glMapParameterfvNV = lazy_glMapParameterfvNV;
+	glad_glGetMapControlPointsNV = lazy_glGetMapControlPointsNV;
+	glad_glGetMapParameterivNV = lazy_glGetMapParameterivNV;
+	glad_glGetMapParameterfvNV = lazy_glGetMapParameterfvNV;
+	glad_glGetMapAttribParameterivNV = lazy_glGetMapAttribParameterivNV;
+	glad_glGetMapAttribParameterfvNV = lazy_glGetMapAttribParameterfvNV;
+	glad_glEvalMapsNV = lazy_glEvalMapsNV;
+	glad_glGetMultisamplefvNV = lazy_glGetMultisamplefvNV;
+	glad_glSampleMaskIndexedNV = lazy_glSampleMaskIndexedNV;
+	glad_glTexRenderbufferNV = lazy_glTexRenderbufferNV;
+	glad_glDeleteFencesNV = lazy_glDeleteFencesNV;
+	glad_glGenFencesNV = lazy_glGenFencesNV;
+	glad_glIsFenceNV = lazy_glIsFenceNV;
+	glad_glTestFenceNV = lazy_glTestFenceNV;
+	glad_glGetFenceivNV = lazy_glGetFenceivNV;
+	glad_glFinishFenceNV = lazy_glFinishFenceNV;
+	glad_glSetFenceNV = lazy_glSetFenceNV;
+	glad_glFragmentCoverageColorNV = lazy_glFragmentCoverageColorNV;
+	glad_glProgramNamedParameter4fNV = lazy_glProgramNamedParameter4fNV;
+	glad_glProgramNamedParameter4fvNV = lazy_glProgramNamedParameter4fvNV;
+	glad_glProgramNamedParameter4dNV = lazy_glProgramNamedParameter4dNV;
+	glad_glProgramNamedParameter4dvNV = lazy_glProgramNamedParameter4dvNV;
+	glad_glGetProgramNamedParameterfvNV = lazy_glGetProgramNamedParameterfvNV;
+	glad_glGetProgramNamedParameterdvNV = lazy_glGetProgramNamedParameterdvNV;
+	glad_glCoverageModulationTableNV = lazy_glCoverageModulationTableNV;
+	glad_glGetCoverageModulationTableNV = lazy_glGetCoverageModulationTableNV;
+	glad_glCoverageModulationNV = lazy_glCoverageModulationNV;
+	glad_glRenderbufferStorageMultisampleCoverageNV = lazy_glRenderbufferStorageMultisampleCoverageNV;
+	glad_glProgramVertexLimitNV = lazy_glProgramVertexLimitNV;
+	glad_glFramebufferTextureEXT = lazy_glFramebufferTextureEXT;
+	glad_glFramebufferTextureFaceEXT = lazy_glFramebufferTextureFaceEXT;
+	glad_glRenderGpuMaskNV = lazy_glRenderGpuMaskNV;
+	glad_glMulticastBufferSubDataNV = lazy_glMulticastBufferSubDataNV;
+	glad_glMulticastCopyBufferSubDataNV = lazy_glMulticastCopyBufferSubDataNV;
+	glad_glMulticastCopyImageSubDataNV = lazy_glMulticastCopyImageSubDataNV;
+	glad_glMulticastBlitFramebufferNV = lazy_glMulticastBlitFramebufferNV;
+	glad_glMulticastFramebufferSampleLocationsfvNV = lazy_glMulticastFramebufferSampleLocationsfvNV;
+	glad_glMulticastBarrierNV = lazy_glMulticastBarrierNV;
+	glad_glMulticastWaitSyncNV = lazy_glMulticastWaitSyncNV;
+	glad_glMulticastGetQueryObjectivNV = lazy_glMulticastGetQueryObjectivNV;
+	glad_glMulticastGetQueryObjectuivNV = lazy_glMulticastGetQueryObjectuivNV;
+	glad_glMulticastGetQueryObjecti64vNV = lazy_glMulticastGetQueryObjecti64vNV;
+	glad_glMulticastGetQueryObjectui64vNV = lazy_glMulticastGetQueryObjectui64vNV;
+	glad_glProgramLocalParameterI4iNV = lazy_glProgramLocalParameterI4iNV;
+	glad_glProgramLocalParameterI4ivNV = lazy_glProgramLocalParameterI4ivNV;
+	glad_glProgramLocalParametersI4ivNV = lazy_glProgramLocalParametersI4ivNV;
+	glad_glProgramLocalParameterI4uiNV = lazy_glProgramLocalParameterI4uiNV;
+	glad_glProgramLocalParameterI4uivNV = lazy_glProgramLocalParameterI4uivNV;
+	glad_glProgramLocalParametersI4uivNV = lazy_glProgramLocalParametersI4uivNV;
+	glad_glProgramEnvParameterI4iNV = lazy_glProgramEnvParameterI4iNV;
+	glad_glProgramEnvParameterI4ivNV = lazy_glProgramEnvParameterI4ivNV;
+	glad_glProgramEnvParametersI4ivNV = lazy_glProgramEnvParametersI4ivNV;
+	glad_glProgramEnvParameterI4uiNV = lazy_glProgramEnvParameterI4uiNV;
+	glad_glProgramEnvParameterI4uivNV = lazy_glProgramEnvParameterI4uivNV;
+	glad_glProgramEnvParametersI4uivNV = lazy_glProgramEnvParametersI4uivNV;
+	glad_glGetProgramLocalParameterIivNV = lazy_glGetProgramLocalParameterIivNV;
+	glad_glGetProgramLocalParameterIuivNV = lazy_glGetProgramLocalParameterIuivNV;
+	glad_glGetProgramEnvParameterIivNV = lazy_glGetProgramEnvParameterIivNV;
+	glad_glGetProgramEnvParameterIuivNV = lazy_glGetProgramEnvParameterIuivNV;
+	glad_glProgramSubroutineParametersuivNV = lazy_glProgramSubroutineParametersuivNV;
+	glad_glGetProgramSubroutineParameteruivNV = lazy_glGetProgramSubroutineParameteruivNV;
+	glad_glVertex2hNV = lazy_glVertex2hNV;
+	glad_glVertex2hvNV = lazy_glVertex2hvNV;
+	glad_glVertex3hNV = lazy_glVertex3hNV;
+	glad_glVertex3hvNV = lazy_glVertex3hvNV;
+	glad_glVertex4hNV = lazy_glVertex4hNV;
+	glad_glVertex4hvNV = lazy_glVertex4hvNV;
+	glad_glNormal3hNV = lazy_glNormal3hNV;
+	glad_glNormal3hvNV = lazy_glNormal3hvNV;
+	glad_glColor3hNV = lazy_glColor3hNV;
+	glad_glColor3hvNV = lazy_glColor3hvNV;
+	glad_glColor4hNV = lazy_glColor4hNV;
+	glad_glColor4hvNV = lazy_glColor4hvNV;
+	glad_glTexCoord1hNV = lazy_glTexCoord1hNV;
+	glad_glTexCoord1hvNV = lazy_glTexCoord1hvNV;
+	glad_glTexCoord2hNV = lazy_glTexCoord2hNV;
+	glad_glTexCoord2hvNV = lazy_glTexCoord2hvNV;
+	glad_glTexCoord3hNV = lazy_glTexCoord3hNV;
+	glad_glTexCoord3hvNV = lazy_glTexCoord3hvNV;
+	glad_glTexCoord4hNV = lazy_glTexCoord4hNV;
+	glad_glTexCoord4hvNV = lazy_glTexCoord4hvNV;
+	glad_glMultiTexCoord1hNV = lazy_glMultiTexCoord1hNV;
+	glad_glMultiTexCoord1hvNV = lazy_glMultiTexCoord1hvNV;
+	glad_glMultiTexCoord2hNV = lazy_glMultiTexCoord2hNV;
+	glad_glMultiTexCoord2hvNV = lazy_glMultiTexCoord2hvNV;
+	glad_glMultiTexCoord3hNV = lazy_glMultiTexCoord3hNV;
+	glad_glMultiTexCoord3hvNV = lazy_glMultiTexCoord3hvNV;
+	glad_glMultiTexCoord4hNV = lazy_glMultiTexCoord4hNV;
+	glad_glMultiTexCoord4hvNV = lazy_glMultiTexCoord4hvNV;
+	glad_glVertexAttrib1hNV = lazy_glVertexAttrib1hNV;
+	glad_glVertexAttrib1hvNV = lazy_glVertexAttrib1hvNV;
+	glad_glVertexAttrib2hNV = lazy_glVertexAttrib2hNV;
+	glad_glVertexAttrib2hvNV = lazy_glVertexAttrib2hvNV;
+	glad_glVertexAttrib3hNV = lazy_glVertexAttrib3hNV;
+	glad_glVertexAttrib3hvNV = lazy_glVertexAttrib3hvNV;
+	glad_glVertexAttrib4hNV = lazy_glVertexAttrib4hNV;
+	glad_glVertexAttrib4hvNV = lazy_glVertexAttrib4hvNV;
+	glad_glVertexAttribs1hvNV = lazy_glVertexAttribs1hvNV;
+	glad_glVertexAttribs2hvNV = lazy_glVertexAttribs2hvNV;
+	glad_glVertexAttribs3hvNV = lazy_glVertexAttribs3hvNV;
+	glad_glVertexAttribs4hvNV = lazy_glVertexAttribs4hvNV;
+	glad_glFogCoordhNV = lazy_glFogCoordhNV;
+	glad_glFogCoordhvNV = lazy_glFogCoordhvNV;
+	glad_glSecondaryColor3hNV = lazy_glSecondaryColor3hNV;
+	glad_glSecondaryColor3hvNV = lazy_glSecondaryColor3hvNV;
+	glad_glVertexWeighthNV = lazy_glVertexWeighthNV;
+	glad_glVertexWeighthvNV = lazy_glVertexWeighthvNV;
+	glad_glGetInternalformatSampleivNV = lazy_glGetInternalformatSampleivNV;
+	glad_glGetMemoryObjectDetachedResourcesuivNV = lazy_glGetMemoryObjectDetachedResourcesuivNV;
+	glad_glResetMemoryObjectParameterNV = lazy_glResetMemoryObjectParameterNV;
+	glad_glTexAttachMemoryNV = lazy_glTexAttachMemoryNV;
+	glad_glBufferAttachMemoryNV = lazy_glBufferAttachMemoryNV;
+	glad_glTextureAttachMemoryNV = lazy_glTextureAttachMemoryNV;
+	glad_glNamedBufferAttachMemoryNV = lazy_glNamedBufferAttachMemoryNV;
+	glad_glBufferPageCommitmentMemNV = lazy_glBufferPageCommitmentMemNV;
+	glad_glTexPageCommitmentMemNV = lazy_glTexPageCommitmentMemNV;
+	glad_glNamedBufferPageCommitmentMemNV = lazy_glNamedBufferPageCommitmentMemNV;
+	glad_glTexturePageCommitmentMemNV = lazy_glTexturePageCommitmentMemNV;
+	glad_glDrawMeshTasksNV = lazy_glDrawMeshTasksNV;
+	glad_glDrawMeshTasksIndirectNV = lazy_glDrawMeshTasksIndirectNV;
+	glad_glMultiDrawMeshTasksIndirectNV = lazy_glMultiDrawMeshTasksIndirectNV;
+	glad_glMultiDrawMeshTasksIndirectCountNV = lazy_glMultiDrawMeshTasksIndirectCountNV;
+	glad_glGenOcclusionQueriesNV = lazy_glGenOcclusionQueriesNV;
+	glad_glDeleteOcclusionQueriesNV = lazy_glDeleteOcclusionQueriesNV;
+	glad_glIsOcclusionQueryNV = lazy_glIsOcclusionQueryNV;
+	glad_glBeginOcclusionQueryNV = lazy_glBeginOcclusionQueryNV;
+	glad_glEndOcclusionQueryNV = lazy_glEndOcclusionQueryNV;
+	glad_glGetOcclusionQueryivNV = lazy_glGetOcclusionQueryivNV;
+	glad_glGetOcclusionQueryuivNV = lazy_glGetOcclusionQueryuivNV;
+	glad_glProgramBufferParametersfvNV = lazy_glProgramBufferParametersfvNV;
+	glad_glProgramBufferParametersIivNV = lazy_glProgramBufferParametersIivNV;
+	glad_glProgramBufferParametersIuivNV = lazy_glProgramBufferParametersIuivNV;
+	glad_glGenPathsNV = lazy_glGenPathsNV;
+	glad_glDeletePathsNV = lazy_glDeletePathsNV;
+	glad_glIsPathNV = lazy_glIsPathNV;
+	glad_glPathCommandsNV = lazy_glPathCommandsNV;
+	glad_glPathCoordsNV = lazy_glPathCoordsNV;
+	glad_glPathSubCommandsNV = lazy_glPathSubCommandsNV;
+	glad_glPathSubCoordsNV = lazy_glPathSubCoordsNV;
+	glad_glPathStringNV = lazy_glPathStringNV;
+	glad_glPathGlyphsNV = lazy_glPathGlyphsNV;
+	glad_glPathGlyphRangeNV = lazy_glPathGlyphRangeNV;
+	glad_glWeightPathsNV = lazy_glWeightPathsNV;
+	glad_glCopyPathNV = lazy_glCopyPathNV;
+	glad_glInterpolatePathsNV = lazy_glInterpolatePathsNV;
+	glad_glTransformPathNV = lazy_glTransformPathNV;
+	glad_glPathParameterivNV = lazy_glPathParameterivNV;
+	glad_glPathParameteriNV = lazy_glPathParameteriNV;
+	glad_glPathParameterfvNV = lazy_glPathParameterfvNV;
+	glad_glPathParameterfNV = lazy_glPathParameterfNV;
+	glad_glPathDashArrayNV = lazy_glPathDashArrayNV;
+	glad_glPathStencilFuncNV = lazy_glPathStencilFuncNV;
+	glad_glPathStencilDepthOffsetNV = lazy_glPathStencilDepthOffsetNV;
+	glad_glStencilFillPathNV = lazy_glStencilFillPathNV;
+	glad_glStencilStrokePathNV = lazy_glStencilStrokePathNV;
+	glad_glStencilFillPathInstancedNV = lazy_glStencilFillPathInstancedNV;
+	glad_glStencilStrokePathInstancedNV = lazy_glStencilStrokePathInstancedNV;
+	glad_glPathCoverDepthFuncNV = lazy_glPathCoverDepthFuncNV;
+	glad_glCoverFillPathNV = lazy_glCoverFillPathNV;
+	glad_glCoverStrokePathNV = lazy_glCoverStrokePathNV;
+	glad_glCoverFillPathInstancedNV = lazy_glCoverFillPathInstancedNV;
+	glad_glCoverStrokePathInstancedNV = lazy_glCoverStrokePathInstancedNV;
+	glad_glGetPathParameterivNV = lazy_glGetPathParameterivNV;
+	glad_glGetPathParameterfvNV = lazy_glGetPathParameterfvNV;
+	glad_glGetPathCommandsNV = lazy_glGetPathCommandsNV;
+	glad_glGetPathCoordsNV = lazy_glGetPathCoordsNV;
+	glad_glGetPathDashArrayNV = lazy_glGetPathDashArrayNV;
+	glad_glGetPathMetricsNV = lazy_glGetPathMetricsNV;
+	glad_glGetPathMetricRangeNV = lazy_glGetPathMetricRangeNV;
+	glad_glGetPathSpacingNV = lazy_glGetPathSpacingNV;
+	glad_glIsPointInFillPathNV = lazy_glIsPointInFillPathNV;
+	glad_glIsPointInStrokePathNV = lazy_glIsPointInStrokePathNV;
+	glad_glGetPathLengthNV = lazy_glGetPathLengthNV;
+	glad_glPointAlongPathNV = lazy_glPointAlongPathNV;
+	glad_glMatrixLoad3x2fNV = lazy_glMatrixLoad3x2fNV;
+	glad_glMatrixLoad3x3fNV = lazy_glMatrixLoad3x3fNV;
+	glad_glMatrixLoadTranspose3x3fNV = lazy_glMatrixLoadTranspose3x3fNV;
+	glad_glMatrixMult3x2fNV = lazy_glMatrixMult3x2fNV;
+	glad_glMatrixMult3x3fNV = lazy_glMatrixMult3x3fNV;
+	glad_glMatrixMultTranspose3x3fNV = lazy_glMatrixMultTranspose3x3fNV;
+	glad_glStencilThenCoverFillPathNV = lazy_glStencilThenCoverFillPathNV;
+	glad_glStencilThenCoverStrokePathNV = lazy_glStencilThenCoverStrokePathNV;
+	glad_glStencilThenCoverFillPathInstancedNV = lazy_glStencilThenCoverFillPathInstancedNV;
+	glad_glStencilThenCoverStrokePathInstancedNV = lazy_glStencilThenCoverStrokePathInstancedNV;
+	glad_glPathGlyphIndexRangeNV = lazy_glPathGlyphIndexRangeNV;
+	glad_glPathGlyphIndexArrayNV = lazy_glPathGlyphIndexArrayNV;
+	glad_glPathMemoryGlyphIndexArrayNV = lazy_glPathMemoryGlyphIndexArrayNV;
+	glad_glProgramPathFragmentInputGenNV = lazy_glProgramPathFragmentInputGenNV;
+	glad_glGetProgramResourcefvNV = lazy_glGetProgramResourcefvNV;
+	glad_glPathColorGenNV = lazy_glPathColorGenNV;
+	glad_glPathTexGenNV = lazy_glPathTexGenNV;
+	glad_glPathFogGenNV = lazy_glPathFogGenNV;
+	glad_glGetPathColorGenivNV = lazy_glGetPathColorGenivNV;
+	glad_glGetPathColorGenfvNV = lazy_glGetPathColorGenfvNV;
+	glad_glGetPathTexGenivNV = lazy_glGetPathTexGenivNV;
+	glad_glGetPathTexGenfvNV = lazy_glGetPathTexGenfvNV;
+	glad_glPixelDataRangeNV = lazy_glPixelDataRangeNV;
+	glad_glFlushPixelDataRangeNV = lazy_glFlushPixelDataRangeNV;
+	glad_glPointParameteriNV = lazy_glPointParameteriNV;
+	glad_glPointParameterivNV = lazy_glPointParameterivNV;
+	glad_glPresentFrameKeyedNV = lazy_glPresentFrameKeyedNV;
+	glad_glPresentFrameDualFillNV = lazy_glPresentFrameDualFillNV;
+	glad_glGetVideoivNV = lazy_glGetVideoivNV;
+	glad_glGetVideouivNV = lazy_glGetVideouivNV;
+	glad_glGetVideoi64vNV = lazy_glGetVideoi64vNV;
+	glad_glGetVideoui64vNV = lazy_glGetVideoui64vNV;
+	glad_glPrimitiveRestartNV = lazy_glPrimitiveRestartNV;
+	glad_glPrimitiveRestartIndexNV = lazy_glPrimitiveRestartIndexNV;
+	glad_glQueryResourceNV = lazy_glQueryResourceNV;
+	glad_glGenQueryResourceTagNV = lazy_glGenQueryResourceTagNV;
+	glad_glDeleteQueryResourceTagNV = lazy_glDeleteQueryResourceTagNV;
+	glad_glQueryResourceTagNV = lazy_glQueryResourceTagNV;
+	glad_glCombinerParameterfvNV = lazy_glCombinerParameterfvNV;
+	glad_glCombinerParameterfNV = lazy_glCombinerParameterfNV;
+	glad_glCombinerParameterivNV = lazy_glCombinerParameterivNV;
+	glad_glCombinerParameteriNV = lazy_glCombinerParameteriNV;
+	glad_glCombinerInputNV = lazy_glCombinerInputNV;
+	glad_glCombinerOutputNV = lazy_glCombinerOutputNV;
+	glad_glFinalCombinerInputNV = lazy_glFinalCombinerInputNV;
+	glad_glGetCombinerInputParameterfvNV = lazy_glGetCombinerInputParameterfvNV;
+	glad_glGetCombinerInputParameterivNV = lazy_glGetCombinerInputParameterivNV;
+	glad_glGetCombinerOutputParameterfvNV = lazy_glGetCombinerOutputParameterfvNV;
+	glad_glGetCombinerOutputParameterivNV = lazy_glGetCombinerOutputParameterivNV;
+	glad_glGetFinalCombinerInputParameterfvNV = lazy_glGetFinalCombinerInputParameterfvNV;
+	glad_glGetFinalCombinerInputParameterivNV = lazy_glGetFinalCombinerInputParameterivNV;
+	glad_glCombinerStageParameterfvNV = lazy_glCombinerStageParameterfvNV;
+	glad_glGetCombinerStageParameterfvNV = lazy_glGetCombinerStageParameterfvNV;
+	glad_glFramebufferSampleLocationsfvNV = lazy_glFramebufferSampleLocationsfvNV;
+	glad_glNamedFramebufferSampleLocationsfvNV = lazy_glNamedFramebufferSampleLocationsfvNV;
+	glad_glResolveDepthValuesNV = lazy_glResolveDepthValuesNV;
+	glad_glScissorExclusiveNV = lazy_glScissorExclusiveNV;
+	glad_glScissorExclusiveArrayvNV = lazy_glScissorExclusiveArrayvNV;
+	glad_glMakeBufferResidentNV = lazy_glMakeBufferResidentNV;
+	glad_glMakeBufferNonResidentNV = lazy_glMakeBufferNonResidentNV;
+	glad_glIsBufferResidentNV = lazy_glIsBufferResidentNV;
+	glad_glMakeNamedBufferResidentNV = lazy_glMakeNamedBufferResidentNV;
+	glad_glMakeNamedBufferNonResidentNV = lazy_glMakeNamedBufferNonResidentNV;
+	glad_glIsNamedBufferResidentNV = lazy_glIsNamedBufferResidentNV;
+	glad_glGetBufferParameterui64vNV = lazy_glGetBufferParameterui64vNV;
+	glad_glGetNamedBufferParameterui64vNV = lazy_glGetNamedBufferParameterui64vNV;
+	glad_glGetIntegerui64vNV = lazy_glGetIntegerui64vNV;
+	glad_glUniformui64NV = lazy_glUniformui64NV;
+	glad_glUniformui64vNV = lazy_glUniformui64vNV;
+	glad_glProgramUniformui64NV = lazy_glProgramUniformui64NV;
+	glad_glProgramUniformui64vNV = lazy_glProgramUniformui64vNV;
+	glad_glBindShadingRateImageNV = lazy_glBindShadingRateImageNV;
+	glad_glGetShadingRateImagePaletteNV = lazy_glGetShadingRateImagePaletteNV;
+	glad_glGetShadingRateSampleLocationivNV = lazy_glGetShadingRateSampleLocationivNV;
+	glad_glShadingRateImageBarrierNV = lazy_glShadingRateImageBarrierNV;
+	glad_glShadingRateImagePaletteNV = lazy_glShadingRateImagePaletteNV;
+	glad_glShadingRateSampleOrderNV = lazy_glShadingRateSampleOrderNV;
+	glad_glShadingRateSampleOrderCustomNV = lazy_glShadingRateSampleOrderCustomNV;
+	glad_glTextureBarrierNV = lazy_glTextureBarrierNV;
+	glad_glTexImage2DMultisampleCoverageNV = lazy_glTexImage2DMultisampleCoverageNV;
+	glad_glTexImage3DMultisampleCoverageNV = lazy_glTexImage3DMultisampleCoverageNV;
+	glad_glTextureImage2DMultisampleNV = lazy_glTextureImage2DMultisampleNV;
+	glad_glTextureImage3DMultisampleNV = lazy_glTextureImage3DMultisampleNV;
+	glad_glTextureImage2DMultisampleCoverageNV = lazy_glTextureImage2DMultisampleCoverageNV;
+	glad_glTextureImage3DMultisampleCoverageNV = lazy_glTextureImage3DMultisampleCoverageNV;
+	glad_glCreateSemaphoresNV = lazy_glCreateSemaphoresNV;
+	glad_glSemaphoreParameterivNV = lazy_glSemaphoreParameterivNV;
+	glad_glGetSemaphoreParameterivNV = lazy_glGetSemaphoreParameterivNV;
+	glad_glBeginTransformFeedbackNV = lazy_glBeginTransformFeedbackNV;
+	glad_glEndTransformFeedbackNV = lazy_glEndTransformFeedbackNV;
+	glad_glTransformFeedbackAttribsNV = lazy_glTransformFeedbackAttribsNV;
+	glad_glBindBufferRangeNV = lazy_glBindBufferRangeNV;
+	glad_glBindBufferOffsetNV = lazy_glBindBufferOffsetNV;
+	glad_glBindBufferBaseNV = lazy_glBindBufferBaseNV;
+	glad_glTransformFeedbackVaryingsNV = lazy_glTransformFeedbackVaryingsNV;
+	glad_glActiveVaryingNV = lazy_glActiveVaryingNV;
+	glad_glGetVaryingLocationNV = lazy_glGetVaryingLocationNV;
+	glad_glGetActiveVaryingNV = lazy_glGetActiveVaryingNV;
+	glad_glGetTransformFeedbackVaryingNV = lazy_glGetTransformFeedbackVaryingNV;
+	glad_glTransformFeedbackStreamAttribsNV = lazy_glTransformFeedbackStreamAttribsNV;
+	glad_glBindTransformFeedbackNV = lazy_glBindTransformFeedbackNV;
+	glad_glDeleteTransformFeedbacksNV = lazy_glDeleteTransformFeedbacksNV;
+	glad_glGenTransformFeedbacksNV = lazy_glGenTransformFeedbacksNV;
+	glad_glIsTransformFeedbackNV = lazy_glIsTransformFeedbackNV;
+	glad_glPauseTransformFeedbackNV = lazy_glPauseTransformFeedbackNV;
+	glad_glResumeTransformFeedbackNV = lazy_glResumeTransformFeedbackNV;
+	glad_glDrawTransformFeedbackNV = lazy_glDrawTransformFeedbackNV;
+	glad_glVDPAUInitNV = lazy_glVDPAUInitNV;
+	glad_glVDPAUFiniNV = lazy_glVDPAUFiniNV;
+	glad_glVDPAURegisterVideoSurfaceNV = lazy_glVDPAURegisterVideoSurfaceNV;
+	glad_glVDPAURegisterOutputSurfaceNV = lazy_glVDPAURegisterOutputSurfaceNV;
+	glad_glVDPAUIsSurfaceNV = lazy_glVDPAUIsSurfaceNV;
+	glad_glVDPAUUnregisterSurfaceNV = lazy_glVDPAUUnregisterSurfaceNV;
+	glad_glVDPAUGetSurfaceivNV = lazy_glVDPAUGetSurfaceivNV;
+	glad_glVDPAUSurfaceAccessNV = lazy_glVDPAUSurfaceAccessNV;
+	glad_glVDPAUMapSurfacesNV = lazy_glVDPAUMapSurfacesNV;
+	glad_glVDPAUUnmapSurfacesNV = lazy_glVDPAUUnmapSurfacesNV;
+	glad_glVDPAURegisterVideoSurfaceWithPictureStructureNV = lazy_glVDPAURegisterVideoSurfaceWithPictureStructureNV;
+	glad_glFlushVertexArrayRangeNV = lazy_glFlushVertexArrayRangeNV;
+	glad_glVertexArrayRangeNV = lazy_glVertexArrayRangeNV;
+	glad_glVertexAttribL1i64NV = lazy_glVertexAttribL1i64NV;
+	glad_glVertexAttribL2i64NV = lazy_glVertexAttribL2i64NV;
+	glad_glVertexAttribL3i64NV = lazy_glVertexAttribL3i64NV;
+	glad_glVertexAttribL4i64NV = lazy_glVertexAttribL4i64NV;
+	glad_glVertexAttribL1i64vNV = lazy_glVertexAttribL1i64vNV;
+	glad_glVertexAttribL2i64vNV = lazy_glVertexAttribL2i64vNV;
+	glad_glVertexAttribL3i64vNV = lazy_glVertexAttribL3i64vNV;
+	glad_glVertexAttribL4i64vNV = lazy_glVertexAttribL4i64vNV;
+	glad_glVertexAttribL1ui64NV = lazy_glVertexAttribL1ui64NV;
+	glad_glVertexAttribL2ui64NV = lazy_glVertexAttribL2ui64NV;
+	glad_glVertexAttribL3ui64NV = lazy_glVertexAttribL3ui64NV;
+	glad_glVertexAttribL4ui64NV = lazy_glVertexAttribL4ui64NV;
+	glad_glVertexAttribL1ui64vNV = lazy_glVertexAttribL1ui64vNV;
+	glad_glVertexAttribL2ui64vNV = lazy_glVertexAttribL2ui64vNV;
+	glad_glVertexAttribL3ui64vNV = lazy_glVertexAttribL3ui64vNV;
+	glad_glVertexAttribL4ui64vNV = lazy_glVertexAttribL4ui64vNV;
+	glad_glGetVertexAttribLi64vNV = lazy_glGetVertexAttribLi64vNV;
+	glad_glGetVertexAttribLui64vNV = lazy_glGetVertexAttribLui64vNV;
+	glad_glVertexAttribLFormatNV = lazy_glVertexAttribLFormatNV;
+	glad_glBufferAddressRangeNV = lazy_glBufferAddressRangeNV;
+	glad_glVertexFormatNV = lazy_glVertexFormatNV;
+	glad_glNormalFormatNV = lazy_glNormalFormatNV;
+	glad_glColorFormatNV = lazy_glColorFormatNV;
+	glad_glIndexFormatNV = lazy_glIndexFormatNV;
+	glad_glTexCoordFormatNV = lazy_glTexCoordFormatNV;
+	glad_glEdgeFlagFormatNV = lazy_glEdgeFlagFormatNV;
+	glad_glSecondaryColorFormatNV = lazy_glSecondaryColorFormatNV;
+	glad_glFogCoordFormatNV = lazy_glFogCoordFormatNV;
+	glad_glVertexAttribFormatNV = lazy_glVertexAttribFormatNV;
+	glad_glVertexAttribIFormatNV = lazy_glVertexAttribIFormatNV;
+	glad_glGetIntegerui64i_vNV = lazy_glGetIntegerui64i_vNV;
+	glad_glAreProgramsResidentNV = lazy_glAreProgramsResidentNV;
+	glad_glBindProgramNV = lazy_glBindProgramNV;
+	glad_glDeleteProgramsNV = lazy_glDeleteProgramsNV;
+	glad_glExecuteProgramNV = lazy_glExecuteProgramNV;
+	glad_glGenProgramsNV = lazy_glGenProgramsNV;
+	glad_glGetProgramParameterdvNV = lazy_glGetProgramParameterdvNV;
+	glad_glGetProgramParameterfvNV = lazy_glGetProgramParameterfvNV;
+	glad_glGetProgramivNV = lazy_glGetProgramivNV;
+	glad_glGetProgramStringNV = lazy_glGetProgramStringNV;
+	glad_glGetTrackMatrixivNV = lazy_glGetTrackMatrixivNV;
+	glad_glGetVertexAttribdvNV = lazy_glGetVertexAttribdvNV;
+	glad_glGetVertexAttribfvNV = lazy_glGetVertexAttribfvNV;
+	glad_glGetVertexAttribivNV = lazy_glGetVertexAttribivNV;
+	glad_glGetVertexAttribPointervNV = lazy_glGetVertexAttribPointervNV;
+	glad_glIsProgramNV = lazy_glIsProgramNV;
+	glad_glLoadProgramNV = lazy_glLoadProgramNV;
+	glad_glProgramParameter4dNV = lazy_glProgramParameter4dNV;
+	glad_glProgramParameter4dvNV = lazy_glProgramParameter4dvNV;
+	glad_glProgramParameter4fNV = lazy_glProgramParameter4fNV;
+	glad_glProgramParameter4fvNV = lazy_glProgramParameter4fvNV;
+	glad_glProgramParameters4dvNV = lazy_glProgramParameters4dvNV;
+	glad_glProgramParameters4fvNV = lazy_glProgramParameters4fvNV;
+	glad_glRequestResidentProgramsNV = lazy_glRequestResidentProgramsNV;
+	glad_glTrackMatrixNV = lazy_glTrackMatrixNV;
+	glad_glVertexAttribPointerNV = lazy_glVertexAttribPointerNV;
+	glad_glVertexAttrib1dNV = lazy_glVertexAttrib1dNV;
+	glad_glVertexAttrib1dvNV = lazy_glVertexAttrib1dvNV;
+	glad_glVertexAttrib1fNV = lazy_glVertexAttrib1fNV;
+	glad_glVertexAttrib1fvNV = lazy_glVertexAttrib1fvNV;
+	glad_glVertexAttrib1sNV = lazy_glVertexAttrib1sNV;
+	glad_glVertexAttrib1svNV = lazy_glVertexAttrib1svNV;
+	glad_glVertexAttrib2dNV = lazy_glVertexAttrib2dNV;
+	glad_glVertexAttrib2dvNV = lazy_glVertexAttrib2dvNV;
+	glad_glVertexAttrib2fNV = lazy_glVertexAttrib2fNV;
+	glad_glVertexAttrib2fvNV = lazy_glVertexAttrib2fvNV;
+	glad_glVertexAttrib2sNV = lazy_glVertexAttrib2sNV;
+	glad_glVertexAttrib2svNV = lazy_glVertexAttrib2svNV;
+	glad_glVertexAttrib3dNV = lazy_glVertexAttrib3dNV;
+	glad_glVertexAttrib3dvNV = lazy_glVertexAttrib3dvNV;
+	glad_glVertexAttrib3fNV = lazy_glVertexAttrib3fNV;
+	glad_glVertexAttrib3fvNV = lazy_glVertexAttrib3fvNV;
+	glad_glVertexAttrib3sNV = lazy_glVertexAttrib3sNV;
+	glad_glVertexAttrib3svNV = lazy_glVertexAttrib3svNV;
+	glad_glVertexAttrib4dNV = lazy_glVertexAttrib4dNV;
+	glad_glVertexAttrib4dvNV = lazy_glVertexAttrib4dvNV;
+	glad_glVertexAttrib4fNV = lazy_glVertexAttrib4fNV;
+	glad_glVertexAttrib4fvNV = lazy_glVertexAttrib4fvNV;
+	glad_glVertexAttrib4sNV = lazy_glVertexAttrib4sNV;
+	glad_glVertexAttrib4svNV = lazy_glVertexAttrib4svNV;
+	glad_glVertexAttrib4ubNV = lazy_glVertexAttrib4ubNV;
+	glad_glVertexAttrib4ubvNV = lazy_glVertexAttrib4ubvNV;
+	glad_glVertexAttribs1dvNV = lazy_glVertexAttribs1dvNV;
+	glad_glVertexAttribs1fvNV = lazy_glVertexAttribs1fvNV;
+	glad_glVertexAttribs1svNV = lazy_glVertexAttribs1svNV;
+	glad_glVertexAttribs2dvNV = lazy_glVertexAttribs2dvNV;
+	glad_glVertexAttribs2fvNV = lazy_glVertexAttribs2fvNV;
+	glad_glVertexAttribs2svNV = lazy_glVertexAttribs2svNV;
+	glad_glVertexAttribs3dvNV = lazy_glVertexAttribs3dvNV;
+	glad_glVertexAttribs3fvNV = lazy_glVertexAttribs3fvNV;
+	glad_glVertexAttribs3svNV = lazy_glVertexAttribs3svNV;
+	glad_glVertexAttribs4dvNV = lazy_glVertexAttribs4dvNV;
+	glad_glVertexAttribs4fvNV = lazy_glVertexAttribs4fvNV;
+	glad_glVertexAttribs4svNV = lazy_glVertexAttribs4svNV;
+	glad_glVertexAttribs4ubvNV = lazy_glVertexAttribs4ubvNV;
+	glad_glBeginVideoCaptureNV = lazy_glBeginVideoCaptureNV;
+	glad_glBindVideoCaptureStreamBufferNV = lazy_glBindVideoCaptureStreamBufferNV;
+	glad_glBindVideoCaptureStreamTextureNV = lazy_glBindVideoCaptureStreamTextureNV;
+	glad_glEndVideoCaptureNV = lazy_glEndVideoCaptureNV;
+	glad_glGetVideoCaptureivNV = lazy_glGetVideoCaptureivNV;
+	glad_glGetVideoCaptureStreamivNV = lazy_glGetVideoCaptureStreamivNV;
+	glad_glGetVideoCaptureStreamfvNV = lazy_glGetVideoCaptureStreamfvNV;
+	glad_glGetVideoCaptureStreamdvNV = lazy_glGetVideoCaptureStreamdvNV;
+	glad_glVideoCaptureNV = lazy_glVideoCaptureNV;
+	glad_glVideoCaptureStreamParameterivNV = lazy_glVideoCaptureStreamParameterivNV;
+	glad_glVideoCaptureStreamParameterfvNV = lazy_glVideoCaptureStreamParameterfvNV;
+	glad_glVideoCaptureStreamParameterdvNV = lazy_glVideoCaptureStreamParameterdvNV;
+	glad_glViewportSwizzleNV = lazy_glViewportSwizzleNV;
+	glad_glMultiTexCoord1bOES = lazy_glMultiTexCoord1bOES;
+	glad_glMultiTexCoord1bvOES = lazy_glMultiTexCoord1bvOES;
+	glad_glMultiTexCoord2bOES = lazy_glMultiTexCoord2bOES;
+	glad_glMultiTexCoord2bvOES = lazy_glMultiTexCoord2bvOES;
+	glad_glMultiTexCoord3bOES = lazy_glMultiTexCoord3bOES;
+	glad_glMultiTexCoord3bvOES = lazy_glMultiTexCoord3bvOES;
+	glad_glMultiTexCoord4bOES = lazy_glMultiTexCoord4bOES;
+	glad_glMultiTexCoord4bvOES = lazy_glMultiTexCoord4bvOES;
+	glad_glTexCoord1bOES = lazy_glTexCoord1bOES;
+	glad_glTexCoord1bvOES = lazy_glTexCoord1bvOES;
+	glad_glTexCoord2bOES = lazy_glTexCoord2bOES;
+	glad_glTexCoord2bvOES = lazy_glTexCoord2bvOES;
+	glad_glTexCoord3bOES = lazy_glTexCoord3bOES;
+	glad_glTexCoord3bvOES = lazy_glTexCoord3bvOES;
+	glad_glTexCoord4bOES = lazy_glTexCoord4bOES;
+	glad_glTexCoord4bvOES = lazy_glTexCoord4bvOES;
+	glad_glVertex2bOES = lazy_glVertex2bOES;
+	glad_glVertex2bvOES = lazy_glVertex2bvOES;
+	glad_glVertex3bOES = lazy_glVertex3bOES;
+	glad_glVertex3bvOES = lazy_glVertex3bvOES;
+	glad_glVertex4bOES = lazy_glVertex4bOES;
+	glad_glVertex4bvOES = lazy_glVertex4bvOES;
+	glad_glAlphaFuncxOES = lazy_glAlphaFuncxOES;
+	glad_glClearColorxOES = lazy_glClearColorxOES;
+	glad_glClearDepthxOES = lazy_glClearDepthxOES;
+	glad_glClipPlanexOES = lazy_glClipPlanexOES;
+	glad_glColor4xOES = lazy_glColor4xOES;
+	glad_glDepthRangexOES = lazy_glDepthRangexOES;
+	glad_glFogxOES = lazy_glFogxOES;
+	glad_glFogxvOES = lazy_glFogxvOES;
+	glad_glFrustumxOES = lazy_glFrustumxOES;
+	glad_glGetClipPlanexOES = lazy_glGetClipPlanexOES;
+	glad_glGetFixedvOES = lazy_glGetFixedvOES;
+	glad_glGetTexEnvxvOES = lazy_glGetTexEnvxvOES;
+	glad_glGetTexParameterxvOES = lazy_glGetTexParameterxvOES;
+	glad_glLightModelxOES = lazy_glLightModelxOES;
+	glad_glLightModelxvOES = lazy_glLightModelxvOES;
+	glad_glLightxOES = lazy_glLightxOES;
+	glad_glLightxvOES = lazy_glLightxvOES;
+	glad_glLineWidthxOES = lazy_glLineWidthxOES;
+	glad_glLoadMatrixxOES = lazy_glLoadMatrixxOES;
+	glad_glMaterialxOES = lazy_glMaterialxOES;
+	glad_glMaterialxvOES = lazy_glMaterialxvOES;
+	glad_glMultMatrixxOES = lazy_glMultMatrixxOES;
+	glad_glMultiTexCoord4xOES = lazy_glMultiTexCoord4xOES;
+	glad_glNormal3xOES = lazy_glNormal3xOES;
+	glad_glOrthoxOES = lazy_glOrthoxOES;
+	glad_glPointParameterxvOES = lazy_glPointParameterxvOES;
+	glad_glPointSizexOES = lazy_glPointSizexOES;
+	glad_glPolygonOffsetxOES = lazy_glPolygonOffsetxOES;
+	glad_glRotatexOES = lazy_glRotatexOES;
+	glad_glScalexOES = lazy_glScalexOES;
+	glad_glTexEnvxOES = lazy_glTexEnvxOES;
+	glad_glTexEnvxvOES = lazy_glTexEnvxvOES;
+	glad_glTexParameterxOES = lazy_glTexParameterxOES;
+	glad_glTexParameterxvOES = lazy_glTexParameterxvOES;
+	glad_glTranslatexOES = lazy_glTranslatexOES;
+	glad_glGetLightxvOES = lazy_glGetLightxvOES;
+	glad_glGetMaterialxvOES = lazy_glGetMaterialxvOES;
+	glad_glPointParameterxOES = lazy_glPointParameterxOES;
+	glad_glSampleCoveragexOES = lazy_glSampleCoveragexOES;
+	glad_glAccumxOES = lazy_glAccumxOES;
+	glad_glBitmapxOES = lazy_glBitmapxOES;
+	glad_glBlendColorxOES = lazy_glBlendColorxOES;
+	glad_glClearAccumxOES = lazy_glClearAccumxOES;
+	glad_glColor3xOES = lazy_glColor3xOES;
+	glad_glColor3xvOES = lazy_glColor3xvOES;
+	glad_glColor4xvOES = lazy_glColor4xvOES;
+	glad_glConvolutionParameterxOES = lazy_glConvolutionParameterxOES;
+	glad_glConvolutionParameterxvOES = lazy_glConvolutionParameterxvOES;
+	glad_glEvalCoord1xOES = lazy_glEvalCoord1xOES;
+	glad_glEvalCoord1xvOES = lazy_glEvalCoord1xvOES;
+	glad_glEvalCoord2xOES = lazy_glEvalCoord2xOES;
+	glad_glEvalCoord2xvOES = lazy_glEvalCoord2xvOES;
+	glad_glFeedbackBufferxOES = lazy_glFeedbackBufferxOES;
+	glad_glGetConvolutionParameterxvOES = lazy_glGetConvolutionParameterxvOES;
+	glad_glGetHistogramParameterxvOES = lazy_glGetHistogramParameterxvOES;
+	glad_glGetLightxOES = lazy_glGetLightxOES;
+	glad_glGetMapxvOES = lazy_glGetMapxvOES;
+	glad_glGetMaterialxOES = lazy_glGetMaterialxOES;
+	glad_glGetPixelMapxv = lazy_glGetPixelMapxv;
+	glad_glGetTexGenxvOES = lazy_glGetTexGenxvOES;
+	glad_glGetTexLevelParameterxvOES = lazy_glGetTexLevelParameterxvOES;
+	glad_glIndexxOES = lazy_glIndexxOES;
+	glad_glIndexxvOES = lazy_glIndexxvOES;
+	glad_glLoadTransposeMatrixxOES = lazy_glLoadTransposeMatrixxOES;
+	glad_glMap1xOES = lazy_glMap1xOES;
+	glad_glMap2xOES = lazy_glMap2xOES;
+	glad_glMapGrid1xOES = lazy_glMapGrid1xOES;
+	glad_glMapGrid2xOES = lazy_glMapGrid2xOES;
+	glad_glMultTransposeMatrixxOES = lazy_glMultTransposeMatrixxOES;
+	glad_glMultiTexCoord1xOES = lazy_glMultiTexCoord1xOES;
+	glad_glMultiTexCoord1xvOES = lazy_glMultiTexCoord1xvOES;
+	glad_glMultiTexCoord2xOES = lazy_glMultiTexCoord2xOES;
+	glad_glMultiTexCoord2xvOES = lazy_glMultiTexCoord2xvOES;
+	glad_glMultiTexCoord3xOES = lazy_glMultiTexCoord3xOES;
+	glad_glMultiTexCoord3xvOES = lazy_glMultiTexCoord3xvOES;
+	glad_glMultiTexCoord4xvOES = lazy_glMultiTexCoord4xvOES;
+	glad_glNormal3xvOES = lazy_glNormal3xvOES;
+	glad_glPassThroughxOES = lazy_glPassThroughxOES;
+	glad_glPixelMapx = lazy_glPixelMapx;
+	glad_glPixelStorex = lazy_glPixelStorex;
+	glad_glPixelTransferxOES = lazy_glPixelTransferxOES;
+	glad_glPixelZoomxOES = lazy_glPixelZoomxOES;
+	glad_glPrioritizeTexturesxOES = lazy_glPrioritizeTexturesxOES;
+	glad_glRasterPos2xOES = lazy_glRasterPos2xOES;
+	glad_glRasterPos2xvOES = lazy_glRasterPos2xvOES;
+	glad_glRasterPos3xOES = lazy_glRasterPos3xOES;
+	glad_glRasterPos3xvOES = lazy_glRasterPos3xvOES;
+	glad_glRasterPos4xOES = lazy_glRasterPos4xOES;
+	glad_glRasterPos4xvOES = lazy_glRasterPos4xvOES;
+	glad_glRectxOES = lazy_glRectxOES;
+	glad_glRectxvOES = lazy_glRectxvOES;
+	glad_glTexCoord1xOES = lazy_glTexCoord1xOES;
+	glad_glTexCoord1xvOES = lazy_glTexCoord1xvOES;
+	glad_glTexCoord2xOES = lazy_glTexCoord2xOES;
+	glad_glTexCoord2xvOES = lazy_glTexCoord2xvOES;
+	glad_glTexCoord3xOES = lazy_glTexCoord3xOES;
+	glad_glTexCoord3xvOES = lazy_glTexCoord3xvOES;
+	glad_glTexCoord4xOES = lazy_glTexCoord4xOES;
+	glad_glTexCoord4xvOES = lazy_glTexCoord4xvOES;
+	glad_glTexGenxOES = lazy_glTexGenxOES;
+	glad_glTexGenxvOES = lazy_glTexGenxvOES;
+	glad_glVertex2xOES = lazy_glVertex2xOES;
+	glad_glVertex2xvOES = lazy_glVertex2xvOES;
+	glad_glVertex3xOES = lazy_glVertex3xOES;
+	glad_glVertex3xvOES = lazy_glVertex3xvOES;
+	glad_glVertex4xOES = lazy_glVertex4xOES;
+	glad_glVertex4xvOES = lazy_glVertex4xvOES;
+	glad_glQueryMatrixxOES = lazy_glQueryMatrixxOES;
+	glad_glClearDepthfOES = lazy_glClearDepthfOES;
+	glad_glClipPlanefOES = lazy_glClipPlanefOES;
+	glad_glDepthRangefOES = lazy_glDepthRangefOES;
+	glad_glFrustumfOES = lazy_glFrustumfOES;
+	glad_glGetClipPlanefOES = lazy_glGetClipPlanefOES;
+	glad_glOrthofOES = lazy_glOrthofOES;
+	glad_glFramebufferTextureMultiviewOVR = lazy_glFramebufferTextureMultiviewOVR;
+	glad_glHintPGI = lazy_glHintPGI;
+	glad_glDetailTexFuncSGIS = lazy_glDetailTexFuncSGIS;
+	glad_glGetDetailTexFuncSGIS = lazy_glGetDetailTexFuncSGIS;
+	glad_glFogFuncSGIS = lazy_glFogFuncSGIS;
+	glad_glGetFogFuncSGIS = lazy_glGetFogFuncSGIS;
+	glad_glSampleMaskSGIS = lazy_glSampleMaskSGIS;
+	glad_glSamplePatternSGIS = lazy_glSamplePatternSGIS;
+	glad_glPixelTexGenParameteriSGIS = lazy_glPixelTexGenParameteriSGIS;
+	glad_glPixelTexGenParameterivSGIS = lazy_glPixelTexGenParameterivSGIS;
+	glad_glPixelTexGenParameterfSGIS = lazy_glPixelTexGenParameterfSGIS;
+	glad_glPixelTexGenParameterfvSGIS = lazy_glPixelTexGenParameterfvSGIS;
+	glad_glGetPixelTexGenParameterivSGIS = lazy_glGetPixelTexGenParameterivSGIS;
+	glad_glGetPixelTexGenParameterfvSGIS = lazy_glGetPixelTexGenParameterfvSGIS;
+	glad_glPointParameterfSGIS = lazy_glPointParameterfSGIS;
+	glad_glPointParameterfvSGIS = lazy_glPointParameterfvSGIS;
+	glad_glSharpenTexFuncSGIS = lazy_glSharpenTexFuncSGIS;
+	glad_glGetSharpenTexFuncSGIS = lazy_glGetSharpenTexFuncSGIS;
+	glad_glTexImage4DSGIS = lazy_glTexImage4DSGIS;
+	glad_glTexSubImage4DSGIS = lazy_glTexSubImage4DSGIS;
+	glad_glTextureColorMaskSGIS = lazy_glTextureColorMaskSGIS;
+	glad_glGetTexFilterFuncSGIS = lazy_glGetTexFilterFuncSGIS;
+	glad_glTexFilterFuncSGIS = lazy_glTexFilterFuncSGIS;
+	glad_glAsyncMarkerSGIX = lazy_glAsyncMarkerSGIX;
+	glad_glFinishAsyncSGIX = lazy_glFinishAsyncSGIX;
+	glad_glPollAsyncSGIX = lazy_glPollAsyncSGIX;
+	glad_glGenAsyncMarkersSGIX = lazy_glGenAsyncMarkersSGIX;
+	glad_glDeleteAsyncMarkersSGIX = lazy_glDeleteAsyncMarkersSGIX;
+	glad_glIsAsyncMarkerSGIX = lazy_glIsAsyncMarkerSGIX;
+	glad_glFlushRasterSGIX = lazy_glFlushRasterSGIX;
+	glad_glFragmentColorMaterialSGIX = lazy_glFragmentColorMaterialSGIX;
+	glad_glFragmentLightfSGIX = lazy_glFragmentLightfSGIX;
+	glad_glFragmentLightfvSGIX = lazy_glFragmentLightfvSGIX;
+	glad_glFragmentLightiSGIX = lazy_glFragmentLightiSGIX;
+	glad_glFragmentLightivSGIX = lazy_glFragmentLightivSGIX;
+	glad_glFragmentLightModelfSGIX = lazy_glFragmentLightModelfSGIX;
+	glad_glFragmentLightModelfvSGIX = lazy_glFragmentLightModelfvSGIX;
+	glad_glFragmentLightModeliSGIX = lazy_glFragmentLightModeliSGIX;
+	glad_glFragmentLightModelivSGIX = lazy_glFragmentLightModelivSGIX;
+	glad_glFragmentMaterialfSGIX = lazy_glFragmentMaterialfSGIX;
+	glad_glFragmentMaterialfvSGIX = lazy_glFragmentMaterialfvSGIX;
+	glad_glFragmentMaterialiSGIX = lazy_glFragmentMaterialiSGIX;
+	glad_glFragmentMaterialivSGIX = lazy_glFragmentMaterialivSGIX;
+	glad_glGetFragmentLightfvSGIX = lazy_glGetFragmentLightfvSGIX;
+	glad_glGetFragmentLightivSGIX = lazy_glGetFragmentLightivSGIX;
+	glad_glGetFragmentMaterialfvSGIX = lazy_glGetFragmentMaterialfvSGIX;
+	glad_glGetFragmentMaterialivSGIX = lazy_glGetFragmentMaterialivSGIX;
+	glad_glLightEnviSGIX = lazy_glLightEnviSGIX;
+	glad_glFrameZoomSGIX = lazy_glFrameZoomSGIX;
+	glad_glIglooInterfaceSGIX = lazy_glIglooInterfaceSGIX;
+	glad_glGetInstrumentsSGIX = lazy_glGetInstrumentsSGIX;
+	glad_glInstrumentsBufferSGIX = lazy_glInstrumentsBufferSGIX;
+	glad_glPollInstrumentsSGIX = lazy_glPollInstrumentsSGIX;
+	glad_glReadInstrumentsSGIX = lazy_glReadInstrumentsSGIX;
+	glad_glStartInstrumentsSGIX = lazy_glStartInstrumentsSGIX;
+	glad_glStopInstrumentsSGIX = lazy_glStopInstrumentsSGIX;
+	glad_glGetListParameterfvSGIX = lazy_glGetListParameterfvSGIX;
+	glad_glGetListParameterivSGIX = lazy_glGetListParameterivSGIX;
+	glad_glListParameterfSGIX = lazy_glListParameterfSGIX;
+	glad_glListParameterfvSGIX = lazy_glListParameterfvSGIX;
+	glad_glListParameteriSGIX = lazy_glListParameteriSGIX;
+	glad_glListParameterivSGIX = lazy_glListParameterivSGIX;
+	glad_glPixelTexGenSGIX = lazy_glPixelTexGenSGIX;
+	glad_glDeformationMap3dSGIX = lazy_glDeformationMap3dSGIX;
+	glad_glDeformationMap3fSGIX = lazy_glDeformationMap3fSGIX;
+	glad_glDeformSGIX = lazy_glDeformSGIX;
+	glad_glLoadIdentityDeformationMapSGIX = lazy_glLoadIdentityDeformationMapSGIX;
+	glad_glReferencePlaneSGIX = lazy_glReferencePlaneSGIX;
+	glad_glSpriteParameterfSGIX = lazy_glSpriteParameterfSGIX;
+	glad_glSpriteParameterfvSGIX = lazy_glSpriteParameterfvSGIX;
+	glad_glSpriteParameteriSGIX = lazy_glSpriteParameteriSGIX;
+	glad_glSpriteParameterivSGIX = lazy_glSpriteParameterivSGIX;
+	glad_glTagSampleBufferSGIX = lazy_glTagSampleBufferSGIX;
+	glad_glColorTableSGI = lazy_glColorTableSGI;
+	glad_glColorTableParameterfvSGI = lazy_glColorTableParameterfvSGI;
+	glad_glColorTableParameterivSGI = lazy_glColorTableParameterivSGI;
+	glad_glCopyColorTableSGI = lazy_glCopyColorTableSGI;
+	glad_glGetColorTableSGI = lazy_glGetColorTableSGI;
+	glad_glGetColorTableParameterfvSGI = lazy_glGetColorTableParameterfvSGI;
+	glad_glGetColorTableParameterivSGI = lazy_glGetColorTableParameterivSGI;
+	glad_glFinishTextureSUNX = lazy_glFinishTextureSUNX;
+	glad_glGlobalAlphaFactorbSUN = lazy_glGlobalAlphaFactorbSUN;
+	glad_glGlobalAlphaFactorsSUN = lazy_glGlobalAlphaFactorsSUN;
+	glad_glGlobalAlphaFactoriSUN = lazy_glGlobalAlphaFactoriSUN;
+	glad_glGlobalAlphaFactorfSUN = lazy_glGlobalAlphaFactorfSUN;
+	glad_glGlobalAlphaFactordSUN = lazy_glGlobalAlphaFactordSUN;
+	glad_glGlobalAlphaFactorubSUN = lazy_glGlobalAlphaFactorubSUN;
+	glad_glGlobalAlphaFactorusSUN = lazy_glGlobalAlphaFactorusSUN;
+	glad_glGlobalAlphaFactoruiSUN = lazy_glGlobalAlphaFactoruiSUN;
+	glad_glDrawMeshArraysSUN = lazy_glDrawMeshArraysSUN;
+	glad_glReplacementCodeuiSUN = lazy_glReplacementCodeuiSUN;
+	glad_glReplacementCodeusSUN = lazy_glReplacementCodeusSUN;
+	glad_glReplacementCodeubSUN = lazy_glReplacementCodeubSUN;
+	glad_glReplacementCodeuivSUN = lazy_glReplacementCodeuivSUN;
+	glad_glReplacementCodeusvSUN = lazy_glReplacementCodeusvSUN;
+	glad_glReplacementCodeubvSUN = lazy_glReplacementCodeubvSUN;
+	glad_glReplacementCodePointerSUN = lazy_glReplacementCodePointerSUN;
+	glad_glColor4ubVertex2fSUN = lazy_glColor4ubVertex2fSUN;
+	glad_glColor4ubVertex2fvSUN = lazy_glColor4ubVertex2fvSUN;
+	glad_glColor4ubVertex3fSUN = lazy_glColor4ubVertex3fSUN;
+	glad_glColor4ubVertex3fvSUN = lazy_glColor4ubVertex3fvSUN;
+	glad_glColor3fVertex3fSUN = lazy_glColor3fVertex3fSUN;
+	glad_glColor3fVertex3fvSUN = lazy_glColor3fVertex3fvSUN;
+	glad_glNormal3fVertex3fSUN = lazy_glNormal3fVertex3fSUN;
+	glad_glNormal3fVertex3fvSUN = lazy_glNormal3fVertex3fvSUN;
+	glad_glColor4fNormal3fVertex3fSUN = lazy_glColor4fNormal3fVertex3fSUN;
+	glad_glColor4fNormal3fVertex3fvSUN = lazy_glColor4fNormal3fVertex3fvSUN;
+	glad_glTexCoord2fVertex3fSUN = lazy_glTexCoord2fVertex3fSUN;
+	glad_glTexCoord2fVertex3fvSUN = lazy_glTexCoord2fVertex3fvSUN;
+	glad_glTexCoord4fVertex4fSUN = lazy_glTexCoord4fVertex4fSUN;
+	glad_glTexCoord4fVertex4fvSUN = lazy_glTexCoord4fVertex4fvSUN;
+	glad_glTexCoord2fColor4ubVertex3fSUN = lazy_glTexCoord2fColor4ubVertex3fSUN;
+	glad_glTexCoord2fColor4ubVertex3fvSUN = lazy_glTexCoord2fColor4ubVertex3fvSUN;
+	glad_glTexCoord2fColor3fVertex3fSUN = lazy_glTexCoord2fColor3fVertex3fSUN;
+	glad_glTexCoord2fColor3fVertex3fvSUN = lazy_glTexCoord2fColor3fVertex3fvSUN;
+	glad_glTexCoord2fNormal3fVertex3fSUN = lazy_glTexCoord2fNormal3fVertex3fSUN;
+	glad_glTexCoord2fNormal3fVertex3fvSUN = lazy_glTexCoord2fNormal3fVertex3fvSUN;
+	glad_glTexCoord2fColor4fNormal3fVertex3fSUN = lazy_glTexCoord2fColor4fNormal3fVertex3fSUN;
+	glad_glTexCoord2fColor4fNormal3fVertex3fvSUN = lazy_glTexCoord2fColor4fNormal3fVertex3fvSUN;
+	glad_glTexCoord4fColor4fNormal3fVertex4fSUN = lazy_glTexCoord4fColor4fNormal3fVertex4fSUN;
+	glad_glTexCoord4fColor4fNormal3fVertex4fvSUN = lazy_glTexCoord4fColor4fNormal3fVertex4fvSUN;
+	glad_glReplacementCodeuiVertex3fSUN = lazy_glReplacementCodeuiVertex3fSUN;
+	glad_glReplacementCodeuiVertex3fvSUN = lazy_glReplacementCodeuiVertex3fvSUN;
+	glad_glReplacementCodeuiColor4ubVertex3fSUN = lazy_glReplacementCodeuiColor4ubVertex3fSUN;
+	glad_glReplacementCodeuiColor4ubVertex3fvSUN = lazy_glReplacementCodeuiColor4ubVertex3fvSUN;
+	glad_glReplacementCodeuiColor3fVertex3fSUN = lazy_glReplacementCodeuiColor3fVertex3fSUN;
+	glad_glReplacementCodeuiColor3fVertex3fvSUN = lazy_glReplacementCodeuiColor3fVertex3fvSUN;
+	glad_glReplacementCodeuiNormal3fVertex3fSUN = lazy_glReplacementCodeuiNormal3fVertex3fSUN;
+	glad_glReplacementCodeuiNormal3fVertex3fvSUN = lazy_glReplacementCodeuiNormal3fVertex3fvSUN;
+	glad_glReplacementCodeuiColor4fNormal3fVertex3fSUN = lazy_glReplacementCodeuiColor4fNormal3fVertex3fSUN;
+	glad_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = lazy_glReplacementCodeuiColor4fNormal3fVertex3fvSUN;
+	glad_glReplacementCodeuiTexCoord2fVertex3fSUN = lazy_glReplacementCodeuiTexCoord2fVertex3fSUN;
+	glad_glReplacementCodeuiTexCoord2fVertex3fvSUN = lazy_glReplacementCodeuiTexCoord2fVertex3fvSUN;
+	glad_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = lazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN;
+	glad_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = lazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN;
+	glad_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = lazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN;
+	glad_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = lazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN;
+#endif
+}
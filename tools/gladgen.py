@@ -0,0 +1,345 @@
+#!/usr/bin/env python3
+"""Generate the glad dispatch table, lazy trampolines and core loader.
+
+Reads the PFNGL*PROC typedefs, "#define glX glad_glX" lines and extension
+guards from src/glad/glad.h, the compatibility loaders from src/glad.c and
+the core profile manifest tools/core.txt, and writes:
+
+  src/glad/glad_context.h  struct gladGLContext, holding GLVersion, every
+                           GLAD_GL_* flag and every glad_gl* pointer, plus
+                           macros that route those names through the
+                           thread-local current context.
+  src/glad_lazy.c          one trampoline per function; gladLoadGLLazy points
+                           each glad_gl* entry at its trampoline, which
+                           resolves the real function on first call, patches
+                           the entry and forwards the call.
+  src/glad.c               the generated region holding the core profile
+                           loaders, built instead of the compatibility ones
+                           with -DGLAD_CORE_PROFILE.
+
+Entries outside the core profile are wrapped in #ifndef GLAD_CORE_PROFILE in
+the first two files, so a core build carries neither their pointers nor
+their trampolines.
+
+Usage:
+    python3 tools/gladgen.py [--check]
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+HEADER = os.path.join(ROOT, "src", "glad", "glad.h")
+OUT_CONTEXT = os.path.join(ROOT, "src", "glad", "glad_context.h")
+OUT_LAZY = os.path.join(ROOT, "src", "glad_lazy.c")
+GLAD_C = os.path.join(ROOT, "src", "glad.c")
+CORE = os.path.join(ROOT, "tools", "core.txt")
+
+C_BEGIN = "/* BEGIN GENERATED (tools/gladgen.py) */\n"
+C_END = "/* END GENERATED */\n"
+CORE_GUARD = "#ifndef GLAD_CORE_PROFILE\n"
+
+PFN_RE = re.compile(r"^typedef (.+?)\(APIENTRYP (PFNGL\w+PROC)\)\((.*)\);$")
+DEFINE_RE = re.compile(r"^#define (gl\w+) glad_(gl\w+)$")
+GUARD_RE = re.compile(r"^#ifndef (GL_\w+)$")
+PARAM_NAME_RE = re.compile(r"(\w+)\s*(\[[^\]]*\])?$")
+LOADER_RE = re.compile(r"^static void load_(GL_\w+)\(GLADloadproc load\) \{$")
+LOAD_RE = re.compile(r"^glad_(gl\w+) = \((PFNGL\w+PROC)\)load\(\"gl\w+\"\);$")
+
+
+def parse_header():
+    """Return ([flag], [(glName, pfn, return_type, params)]) in header order."""
+    with open(HEADER) as f:
+        lines = [line.strip() for line in f]
+    typedefs = {}
+    flags = []
+    functions = []
+    for i, line in enumerate(lines):
+        m = PFN_RE.match(line)
+        if m:
+            typedefs[m.group(2)] = (m.group(1).strip(), m.group(3).strip())
+            continue
+        m = GUARD_RE.match(line)
+        if m and i + 1 < len(lines) and lines[i + 1] == "#define %s 1" % m.group(1):
+            flags.append("GLAD_" + m.group(1))
+            continue
+        m = DEFINE_RE.match(line)
+        if m and m.group(1) == m.group(2):
+            pfn = "PFN%sPROC" % m.group(1).upper()
+            ret, params = typedefs[pfn]
+            functions.append((m.group(1), pfn, ret, params))
+    return flags, functions
+
+
+def parse_core():
+    """Return ([extension], {compatibility-only function}) from tools/core.txt."""
+    extensions = []
+    removed = set()
+    with open(CORE) as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            if line.startswith("GL_"):
+                extensions.append(line)
+            else:
+                removed.add(line)
+    return extensions, removed
+
+
+def parse_loaders(source):
+    """Return [(section, [(glName, pfn)])] for the load_GL_* routines in source."""
+    loaders = []
+    current = None
+    for line in source.splitlines():
+        line = line.strip()
+        m = LOADER_RE.match(line)
+        if m:
+            current = []
+            loaders.append((m.group(1), current))
+            continue
+        m = LOAD_RE.match(line)
+        if m and current is not None:
+            current.append((m.group(1), m.group(2)))
+        elif line == "}":
+            current = None
+    return loaders
+
+
+def split_region(source):
+    """Split src/glad.c around the generated core loader region."""
+    begin = source.index(C_BEGIN) + len(C_BEGIN)
+    end = source.index(C_END, begin)
+    return source[:begin], source[end:]
+
+
+def core_selection(flags, loaders, extensions, removed):
+    """Return the core loaders and the sets of core flags and functions."""
+    known = set(flags)
+    for ext in extensions:
+        if "GLAD_" + ext not in known:
+            raise SystemExit("gladgen: %s in tools/core.txt is not in glad.h" % ext)
+    keep = set(extensions)
+    core_loaders = []
+    for section, loads in loaders:
+        if section.startswith("GL_VERSION_") or section in keep:
+            core_loaders.append((section, [l for l in loads if l[0] not in removed]))
+    core_flags = set("GLAD_" + s for s in extensions)
+    core_flags.update(f for f in flags if f.startswith("GLAD_GL_VERSION_"))
+    core_functions = set(name for _, loads in core_loaders for name, _ in loads)
+    return core_loaders, core_flags, core_functions
+
+
+def guarded(entries):
+    """Join (text, core) pairs, wrapping runs of non-core text in CORE_GUARD."""
+    out = []
+    inside = False
+    for text, core in entries:
+        if not core and not inside:
+            out.append(CORE_GUARD)
+            inside = True
+        elif core and inside:
+            out.append("#endif\n")
+            inside = False
+        out.append(text)
+    if inside:
+        out.append("#endif\n")
+    return out
+
+
+def param_names(params):
+    if params in ("", "void"):
+        return []
+    names = []
+    for p in params.split(","):
+        m = PARAM_NAME_RE.search(p.strip())
+        if m is None:
+            raise SystemExit("gladgen: cannot parse parameter '%s'" % p)
+        names.append(m.group(1))
+    return names
+
+
+def emit_context(flags, functions, core_flags, core_functions):
+    out = [
+        "/* Generated by tools/gladgen.py from src/glad/glad.h. Do not edit. */\n",
+        "\n",
+        "#ifndef __glad_context_h_\n",
+        "#define __glad_context_h_\n",
+        "\n",
+        "#include <stddef.h>\n",
+        "\n",
+        "#if defined(__cplusplus)\n",
+        "#define GLAD_THREAD_LOCAL thread_local\n",
+        "#elif defined(_MSC_VER)\n",
+        "#define GLAD_THREAD_LOCAL __declspec(thread)\n",
+        "#else\n",
+        "#define GLAD_THREAD_LOCAL _Thread_local\n",
+        "#endif\n",
+        "\n",
+        "/* One dispatch table per GL context. Flags and the version come first,\n",
+        "   then the entry points in header order, so the core functions share\n",
+        "   the leading cache lines. */\n",
+        "struct gladGLContext {\n",
+        "    struct gladGLversionStruct GLVersion;\n",
+    ]
+    out += guarded([("    int %s;\n" % flag, flag in core_flags) for flag in flags])
+    out += guarded([("    %s glad_%s;\n" % (pfn, name), name in core_functions)
+                    for name, pfn, _, _ in functions])
+    out += [
+        "    /* Extension set built by the loader */\n",
+        "    char **ext_names;\n",
+        "    unsigned int *ext_hashes;\n",
+        "    size_t ext_mask;\n",
+        "    /* Resolver used by lazy entries */\n",
+        "    GLADloadproc load;\n",
+        "    /* Owned by the code embedding glad */\n",
+        "    void *user;\n",
+        "};\n",
+        "\n",
+        "/* Used by threads that never select a context */\n",
+        "GLAPI struct gladGLContext glad_gl_default;\n",
+        "GLAPI GLAD_THREAD_LOCAL struct gladGLContext *glad_gl_current;\n",
+        "\n",
+        "/* Loads a new context's table from the GL context current on this\n",
+        "   thread and selects it. Returns NULL (leaving the selection alone)\n",
+        "   on failure. */\n",
+        "GLAPI struct gladGLContext *gladCreateGLContext(int lazy);\n",
+        "/* The same, resolving through load (e.g. gladGetProcAddressEGL). */\n",
+        "GLAPI struct gladGLContext *gladCreateGLContextLoader(GLADloadproc load, int lazy);\n",
+        "/* Selects the table used by GL calls on this thread; NULL selects\n",
+        "   glad_gl_default. */\n",
+        "GLAPI void gladMakeGLContextCurrent(struct gladGLContext *context);\n",
+        "GLAPI struct gladGLContext *gladGetGLContext(void);\n",
+        "GLAPI void gladDestroyGLContext(struct gladGLContext *context);\n",
+        "\n",
+        "#define GLVersion (glad_gl_current->GLVersion)\n",
+    ]
+    for flag in flags:
+        if flag in core_flags:
+            out.append("#define %s (glad_gl_current->%s)\n" % (flag, flag))
+    out.append("#ifdef GLAD_CORE_PROFILE\n")
+    for flag in flags:
+        if flag not in core_flags:
+            out.append("#define %s 0\n" % flag)
+    out.append("#else\n")
+    for flag in flags:
+        if flag not in core_flags:
+            out.append("#define %s (glad_gl_current->%s)\n" % (flag, flag))
+    out.append("#endif\n")
+    for name, _, _, _ in functions:
+        out.append("#define glad_%s (glad_gl_current->glad_%s)\n" % (name, name))
+    out += [
+        "\n",
+        "#endif\n",
+    ]
+    return "".join(out)
+
+
+def emit_lazy(functions, core_functions):
+    out = [
+        "// Generated by tools/gladgen.py from src/glad/glad.h. Do not edit.\n",
+        "//\n",
+        "// Each lazy_gl* trampoline resolves its entry point on first use, stores\n",
+        "// it in the current context's glad_gl* entry and forwards the call.\n",
+        "\n",
+        "#include <glad/glad.h>\n",
+        "\n",
+        "void* gladLazyResolve(const char* name);\n",
+        "void gladInstallLazyGL(void);\n",
+        "\n",
+    ]
+    trampolines = []
+    for name, pfn, ret, params in functions:
+        args = ", ".join(param_names(params))
+        decl = params if params else "void"
+        body = "static %s APIENTRY lazy_%s(%s) {\n" % (ret, name, decl)
+        body += "\tglad_%s = (%s)gladLazyResolve(\"%s\");\n" % (name, pfn, name)
+        if ret == "void":
+            body += "\tglad_%s(%s);\n" % (name, args)
+        else:
+            body += "\treturn glad_%s(%s);\n" % (name, args)
+        trampolines.append((body + "}\n\n", name in core_functions))
+    out += guarded(trampolines)
+    out.append("void gladInstallLazyGL(void) {\n")
+    out += guarded([("\tglad_%s = lazy_%s;\n" % (name, name), name in core_functions)
+                    for name, _, _, _ in functions])
+    out.append("}\n")
+    return "".join(out)
+
+
+def emit_core_loader(flags, core_loaders, core_flags):
+    out = []
+    for section, loads in core_loaders:
+        out.append("static void load_%s(GLADloadproc load) {\n" % section)
+        if not section.startswith("GL_VERSION_"):
+            out.append("\tif(!GLAD_%s) return;\n" % section)
+        for name, pfn in loads:
+            out.append("\tglad_%s = (%s)load(\"%s\");\n" % (name, pfn, name))
+        out.append("}\n")
+    out.append("static int find_extensionsGL(void) {\n")
+    out.append("\tif (!get_exts()) return 0;\n")
+    for flag in flags:
+        if flag in core_flags and not flag.startswith("GLAD_GL_VERSION_"):
+            out.append("\t%s = has_ext(\"%s\");\n" % (flag, flag[len("GLAD_"):]))
+    out.append("\treturn 1;\n")
+    out.append("}\n")
+    out.append("\n")
+    out.append("static void find_coreGL(void);\n")
+    out.append("\n")
+    out.append("int gladLoadGLLoader(GLADloadproc load) {\n")
+    out.append("\tGLVersion.major = 0; GLVersion.minor = 0;\n")
+    out.append("\tglGetString = (PFNGLGETSTRINGPROC)load(\"glGetString\");\n")
+    out.append("\tif(glGetString == NULL) return 0;\n")
+    out.append("\tif(glGetString(GL_VERSION) == NULL) return 0;\n")
+    out.append("\tfind_coreGL();\n")
+    versions = [s for s, _ in core_loaders if s.startswith("GL_VERSION_")]
+    extensions = [s for s, _ in core_loaders if not s.startswith("GL_VERSION_")]
+    for section in versions:
+        out.append("\tload_%s(load);\n" % section)
+    out.append("\n")
+    out.append("\tif (!find_extensionsGL()) return 0;\n")
+    for section in extensions:
+        out.append("\tload_%s(load);\n" % section)
+    out.append("\treturn GLVersion.major != 0 || GLVersion.minor != 0;\n")
+    out.append("}\n")
+    return "".join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--check", action="store_true",
+                    help="fail if the generated files are out of date instead of writing them")
+    args = ap.parse_args()
+
+    flags, functions = parse_header()
+    extensions, removed = parse_core()
+    with open(GLAD_C) as f:
+        head, tail = split_region(f.read())
+    core_loaders, core_flags, core_functions = core_selection(
+        flags, parse_loaders(head), extensions, removed)
+    outputs = [
+        (OUT_CONTEXT, emit_context(flags, functions, core_flags, core_functions)),
+        (OUT_LAZY, emit_lazy(functions, core_functions)),
+        (GLAD_C, head + emit_core_loader(flags, core_loaders, core_flags) + tail),
+    ]
+    status = 0
+    for path, text in outputs:
+        if args.check:
+            with open(path) as f:
+                if f.read() != text:
+                    print("gladgen: %s is out of date" % os.path.relpath(path, ROOT),
+                          file=sys.stderr)
+                    status = 1
+        else:
+            with open(path, "w") as f:
+                f.write(text)
+    if not args.check:
+        print("gladgen: wrote %d flags and %d functions (core profile: %d and %d)"
+              % (len(flags), len(functions), len(core_flags), len(core_functions)))
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,294 @@
+#!/usr/bin/env python3
+"""Generate Quadrate wrappers for GL entry points declared in glad.h.
+
+Reads the PFNGL*PROC typedefs from src/glad/glad.h and, for every function
+listed in tools/bindings.txt (or every GL 1.0-4.5 function with --all),
+emits a C wrapper into src/gl_generated.c and the matching declarations into
+the generated region of gl.qd.
+
+Usage:
+    python3 tools/glgen.py [--all] [--check]
+
+Generated wrappers validate their arguments with one fused check: a single
+stack-size comparison plus a branch-free comparison of every popped element
+against the function's type signature.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+HEADER = os.path.join(ROOT, "src", "glad", "glad.h")
+BINDINGS = os.path.join(ROOT, "tools", "bindings.txt")
+OUT_C = os.path.join(ROOT, "src", "gl_generated.c")
+OUT_QD = os.path.join(ROOT, "gl.qd")
+
+QD_BEGIN = "\t// BEGIN GENERATED (tools/glgen.py)\n"
+QD_END = "\t// END GENERATED\n"
+
+INT_TYPES = {
+    "GLenum", "GLbitfield", "GLboolean", "GLbyte", "GLubyte", "GLshort", "GLushort",
+    "GLint", "GLuint", "GLsizei", "GLintptr", "GLsizeiptr", "GLint64", "GLuint64",
+    "GLfixed",
+}
+FLOAT_TYPES = {"GLfloat", "GLdouble", "GLclampf", "GLclampd"}
+
+# Pointer parameters with these names are byte offsets into a bound buffer
+# (GL_ELEMENT_ARRAY_BUFFER, GL_DRAW_INDIRECT_BUFFER, ...) rather than client
+# memory, matching the offset:i64 convention of DrawElements.
+OFFSET_PARAMS = {"indices", "indirect", "pointer"}
+
+PFN_RE = re.compile(r"^typedef (.+?)\(APIENTRYP PFN(GL\w+)PROC\)\((.*)\);$")
+SECTION_RE = re.compile(r"^#define (GL_\w+) 1$")
+
+STACK_TYPES = {
+    "i": "QD_STACK_TYPE_INT",
+    "f": "QD_STACK_TYPE_FLOAT",
+    "p": "QD_STACK_TYPE_PTR",
+    "s": "QD_STACK_TYPE_STR",
+}
+QD_TYPES = {"i": "i64", "f": "f64", "p": "ptr", "s": "str"}
+VALUE_FIELDS = {"i": "i", "f": "f", "p": "p"}
+
+
+class Unsupported(Exception):
+    pass
+
+
+def parse_header():
+    """Return {glName: (return_type, [(ctype, name)], section)}."""
+    functions = {}
+    section = None
+    with open(HEADER) as f:
+        for line in f:
+            line = line.rstrip("\n")
+            m = SECTION_RE.match(line)
+            if m:
+                section = m.group(1)
+                continue
+            m = PFN_RE.match(line)
+            if not m:
+                continue
+            # The PFN name is upper case; the real name is recovered from the
+            # "#define glName glad_glName" lines below.
+            functions[m.group(2)] = (m.group(1).strip(), m.group(3).strip(), section)
+    names = {}
+    with open(HEADER) as f:
+        for line in f:
+            m = re.match(r"^#define (gl\w+) glad_(gl\w+)$", line.strip())
+            if m and m.group(1).upper() in functions:
+                ret, params, section = functions[m.group(1).upper()]
+                names[m.group(1)] = (ret, split_params(params), section)
+    return names
+
+
+def split_params(params):
+    if params in ("", "void"):
+        return []
+    out = []
+    for p in params.split(","):
+        p = p.strip()
+        m = re.match(r"^(.*?)(\w+)$", p)
+        ctype, name = m.group(1).strip(), m.group(2)
+        out.append((ctype, name))
+    return out
+
+
+def classify_param(ctype, name):
+    """Return (sig char, C expression template) for one parameter."""
+    base = ctype.replace("const", "").strip()
+    if base in INT_TYPES:
+        return "i", "(%s){v}.value.i" % base
+    if base in FLOAT_TYPES:
+        return "f", "(%s){v}.value.f" % base
+    if base == "GLsync":
+        return "p", "(GLsync){v}.value.p"
+    if base == "GLchar *" and ctype.startswith("const") and ctype.count("*") == 1:
+        return "s", "qd_string_data({v}.value.s)"
+    if base.count("*") == 1 and base.rstrip(" *") in INT_TYPES | FLOAT_TYPES | {"void", "GLchar"}:
+        if name in OFFSET_PARAMS and base == "void *":
+            return "i", "(%s)(intptr_t){v}.value.i" % ctype
+        return "p", "(%s){v}.value.p" % ctype
+    raise Unsupported("parameter '%s %s'" % (ctype, name))
+
+
+def classify_return(ret):
+    base = ret.replace("const", "").strip()
+    if base == "void":
+        return None, None
+    if base in INT_TYPES:
+        return "i", "qd_push_i(ctx, (int64_t)result);"
+    if base in FLOAT_TYPES:
+        return "f", "qd_push_f(ctx, (double)result);"
+    if base in ("void *", "GLsync"):
+        return "p", "qd_push_p(ctx, (void*)result);"
+    if base == "GLubyte *":
+        return "s", "qd_push_s(ctx, result ? (const char*)result : \"\");"
+    raise Unsupported("return type '%s'" % ret)
+
+
+def qd_name(gl_name):
+    return gl_name[2:]
+
+
+def emit_function(gl_name, ret, params):
+    name = qd_name(gl_name)
+    sig = []
+    args = []
+    for idx, (ctype, pname) in enumerate(params):
+        ch, expr = classify_param(ctype, pname)
+        sig.append(ch)
+        args.append(expr.format(v="args[%d]" % idx))
+    ret_ch, push = classify_return(ret)
+
+    qd_in = " ".join("%s:%s" % (p[1], QD_TYPES[c]) for p, c in zip(params, sig))
+    qd_out = "result:%s" % QD_TYPES[ret_ch] if ret_ch else ""
+    comment = "// %s( %s-- %s)" % (name, qd_in + " " if qd_in else "", qd_out + " " if qd_out else "")
+    decl = "\tpub fn %s(%s--%s)" % (name, qd_in + " " if qd_in else " ", " " + qd_out if qd_out else " ")
+
+    lines = [comment, "int %s(qd_context* ctx) {" % name]
+    if params:
+        lines.append("\tstatic const int sig[%d] = {%s};" % (
+            len(sig), ", ".join(STACK_TYPES[c] for c in sig)))
+        lines.append("\tqd_stack_element_t args[%d];" % len(sig))
+        lines.append("\tgl_pop_args(ctx, \"%s\", sig, %d, args);" % (name, len(sig)))
+    elif not ret_ch:
+        lines.append("\t(void)ctx;")
+    call = "%s(%s)" % (gl_name, ", ".join(args))
+    if ret_ch:
+        lines.append("\t%s result = %s;" % (ret.strip(), call))
+    else:
+        lines.append("\t%s;" % call)
+    for idx, ch in enumerate(sig):
+        if ch == "s":
+            lines.append("\tqd_string_release(args[%d].value.s);" % idx)
+    if push:
+        lines.append("\t%s" % push)
+    lines.append("\treturn 0;")
+    lines.append("}")
+    return "\n".join(lines), decl
+
+
+C_PRELUDE = """\
+// Code generated by tools/glgen.py from src/glad/glad.h and tools/bindings.txt.
+// DO NOT EDIT: add the function to tools/bindings.txt and re-run the generator.
+
+#include <glad/glad.h>
+#include <qdrt/ffi.h>
+#include <qdrt/runtime.h>
+#include <qdrt/stack.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Pops n arguments into args[0..n) (declaration order) and validates them
+// against sig with a single bounds check and a single type branch.
+static void gl_pop_args(qd_context* ctx, const char* fn, const int* sig, size_t n,
+		qd_stack_element_t* args) {
+	if (qd_stack_size(ctx->st) < n) {
+		fprintf(stderr, "Fatal error in %s: Stack underflow\\n", fn);
+		abort();
+	}
+	int mismatch = 0;
+	for (size_t i = n; i-- > 0;) {
+		qd_stack_pop(ctx->st, &args[i]);
+		mismatch |= (int)args[i].type ^ sig[i];
+	}
+	if (mismatch) {
+		fprintf(stderr, "Fatal error in %s: Type error\\n", fn);
+		abort();
+	}
+}
+"""
+
+
+def read_bindings():
+    entries = []
+    with open(BINDINGS) as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if line:
+                entries.append(line)
+    return entries
+
+
+def hand_written():
+    """Names already implemented by hand in src/*.c (other than the output)."""
+    names = set()
+    src = os.path.join(ROOT, "src")
+    for fn in os.listdir(src):
+        path = os.path.join(src, fn)
+        if fn.endswith(".c") and path != OUT_C and fn != "glad.c":
+            with open(path) as f:
+                names.update(re.findall(r"^int (\w+)\(qd_context\* ctx\)", f.read(), re.M))
+    return names
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--all", action="store_true",
+            help="wrap every supported GL 1.0-4.5 entry point, not just tools/bindings.txt")
+    ap.add_argument("--check", action="store_true",
+            help="fail if the generated files are out of date instead of writing them")
+    opts = ap.parse_args()
+
+    functions = parse_header()
+    manual = hand_written()
+    if opts.all:
+        wanted = sorted(n for n, (_, _, sec) in functions.items()
+                if sec and sec.startswith("GL_VERSION_"))
+    else:
+        wanted = read_bindings()
+
+    c_parts = [C_PRELUDE]
+    qd_lines = []
+    failed = False
+    for gl_name in wanted:
+        if gl_name not in functions:
+            print("glgen: %s is not declared in glad.h" % gl_name, file=sys.stderr)
+            failed = True
+            continue
+        if qd_name(gl_name) in manual:
+            if not opts.all:
+                print("glgen: %s is already wrapped by hand" % gl_name, file=sys.stderr)
+                failed = True
+            continue
+        ret, params, _ = functions[gl_name]
+        try:
+            body, decl = emit_function(gl_name, ret, params)
+        except Unsupported as e:
+            if not opts.all:
+                print("glgen: %s: unsupported %s" % (gl_name, e), file=sys.stderr)
+                failed = True
+            continue
+        c_parts.append("\n" + body + "\n")
+        qd_lines.append(decl + "\n")
+    if failed:
+        return 1
+
+    c_out = "".join(c_parts)
+    with open(OUT_QD) as f:
+        qd = f.read()
+    begin, end = qd.index(QD_BEGIN), qd.index(QD_END)
+    qd_out = qd[:begin + len(QD_BEGIN)] + "".join(qd_lines) + qd[end:]
+
+    if opts.check:
+        with open(OUT_C) as f:
+            stale = f.read() != c_out or qd != qd_out
+        if stale:
+            print("glgen: generated bindings are out of date", file=sys.stderr)
+            return 1
+        return 0
+
+    with open(OUT_C, "w") as f:
+        f.write(c_out)
+    with open(OUT_QD, "w") as f:
+        f.write(qd_out)
+    print("glgen: wrote %d functions" % len(qd_lines))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())